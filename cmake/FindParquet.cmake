@@ -0,0 +1,25 @@
+# Find the Apache Parquet C++ library and the Apache Arrow library it is built on.
+# Output variables:
+#  PARQUET_INCLUDE_DIR : e.g., /usr/include/.
+#  PARQUET_LIBRARY     : Library path of parquet library
+#  ARROW_LIBRARY       : Library path of arrow library
+#  PARQUET_FOUND       : True if found.
+FIND_PATH(PARQUET_INCLUDE_DIR NAME parquet/arrow/reader.h
+    HINTS $ENV{HOME}/local/include /opt/local/include /usr/local/include /usr/include)
+
+FIND_LIBRARY(PARQUET_LIBRARY NAME parquet
+    HINTS $ENV{HOME}/local/lib64 $ENV{HOME}/local/lib /usr/local/lib64 /usr/local/lib /opt/local/lib64 /opt/local/lib /usr/lib64 /usr/lib
+    )
+
+FIND_LIBRARY(ARROW_LIBRARY NAME arrow
+    HINTS $ENV{HOME}/local/lib64 $ENV{HOME}/local/lib /usr/local/lib64 /usr/local/lib /opt/local/lib64 /opt/local/lib /usr/lib64 /usr/lib
+    )
+
+IF (PARQUET_INCLUDE_DIR AND PARQUET_LIBRARY AND ARROW_LIBRARY)
+    SET(PARQUET_FOUND TRUE)
+    MESSAGE(STATUS "Found parquet library: inc=${PARQUET_INCLUDE_DIR}, lib=${PARQUET_LIBRARY};${ARROW_LIBRARY}")
+ELSE ()
+    SET(PARQUET_FOUND FALSE)
+    MESSAGE(STATUS "WARNING: Parquet library not found.")
+    MESSAGE(STATUS "Try: 'sudo apt-get install libarrow-dev libparquet-dev' (or brew install apache-arrow)")
+ENDIF ()
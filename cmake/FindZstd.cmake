@@ -0,0 +1,20 @@
+# Find the Zstandard compression library.
+# Output variables:
+#  ZSTD_INCLUDE_DIR : e.g., /usr/include/.
+#  ZSTD_LIBRARY     : Library path of zstd library
+#  ZSTD_FOUND       : True if found.
+FIND_PATH(ZSTD_INCLUDE_DIR NAME zstd.h
+    HINTS $ENV{HOME}/local/include /opt/local/include /usr/local/include /usr/include)
+
+FIND_LIBRARY(ZSTD_LIBRARY NAME zstd
+    HINTS $ENV{HOME}/local/lib64 $ENV{HOME}/local/lib /usr/local/lib64 /usr/local/lib /opt/local/lib64 /opt/local/lib /usr/lib64 /usr/lib
+    )
+
+IF (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    SET(ZSTD_FOUND TRUE)
+    MESSAGE(STATUS "Found zstd library: inc=${ZSTD_INCLUDE_DIR}, lib=${ZSTD_LIBRARY}")
+ELSE ()
+    SET(ZSTD_FOUND FALSE)
+    MESSAGE(STATUS "WARNING: zstd library not found.")
+    MESSAGE(STATUS "Try: 'sudo apt-get install libzstd-dev' (or brew install zstd)")
+ENDIF ()
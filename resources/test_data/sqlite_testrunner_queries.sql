@@ -129,6 +129,12 @@ SELECT DISTINCT * FROM mixed;
 SELECT DISTINCT a, MIN(b) FROM mixed GROUP BY a;
 SELECT DISTINCT MIN(b) FROM mixed GROUP BY a;
 
+-- INTERSECT/EXCEPT (SQLite does not support the ALL variants)
+SELECT a FROM mixed INTERSECT SELECT a FROM mixed_null;
+SELECT a, b FROM mixed_null INTERSECT SELECT a, b FROM mixed_null WHERE b IS NULL OR b > 50;
+SELECT a, b FROM mixed EXCEPT SELECT a, b FROM mixed WHERE b < 50;
+SELECT b FROM mixed_null EXCEPT SELECT b FROM mixed WHERE b > 10;
+
 -- Join, GROUP BY, Having, ...
 SELECT c_custkey, c_name, COUNT(a) FROM tpch_customer JOIN id_int_int_int_100 ON c_custkey = a GROUP BY c_custkey, c_name HAVING COUNT(a) >= 2;
 SELECT c_custkey, c_name, COUNT(a) FROM tpch_customer JOIN ( SELECT id_int_int_int_100.* FROM id_int_int_int_100 JOIN mixed ON id_int_int_int_100.a = mixed.id ) AS sub ON tpch_customer.c_custkey = sub.a GROUP BY c_custkey, c_name HAVING COUNT(sub.a) >= 2;
@@ -33,6 +33,20 @@ def get_iteration_durations(iterations):
 
     return iteration_durations
 
+def get_average_optimization_duration_ms(iterations):
+    # Average time the optimizer spent per query iteration. For optimizer-heavy benchmarks, such as the Join Order
+    # Benchmark, this catches regressions that are hidden by the overall execution time.
+
+    if not iterations:
+        return float('nan')
+
+    optimization_duration = 0
+    for iteration in iterations:
+        for statement in iteration["statements"]:
+            optimization_duration += statement["optimization_duration"]
+
+    return float(optimization_duration) / len(iterations) / 1000 / 1000
+
 def calculate_and_format_p_value(old, new):
     old_iteration_durations = get_iteration_durations(old["metrics"])
     new_iteration_durations = get_iteration_durations(new["metrics"])
@@ -66,7 +80,7 @@ with open(sys.argv[2]) as new_file:
     new_data = json.load(new_file)
 
 table_data = []
-table_data.append(["Benchmark", "prev. iter/s", "runs", "new iter/s", "runs", "change", "p-value (significant if <" + str(p_value_significance_threshold) + ")"])
+table_data.append(["Benchmark", "prev. iter/s", "runs", "new iter/s", "runs", "change", "prev. opt. ms", "new opt. ms", "p-value (significant if <" + str(p_value_significance_threshold) + ")"])
 
 average_diff_sum = 0.0
 
@@ -83,12 +97,17 @@ for old, new in zip(old_data['benchmarks'], new_data['benchmarks']):
     diff_formatted = format_diff(diff)
     p_value_formatted = calculate_and_format_p_value(old, new)
 
-    table_data.append([name, str(old['items_per_second']), str(len(old['metrics'])), str(new['items_per_second']), str(len(new['metrics'])), diff_formatted, p_value_formatted])
+    old_optimization_ms = "{0:.2f}".format(get_average_optimization_duration_ms(old['metrics']))
+    new_optimization_ms = "{0:.2f}".format(get_average_optimization_duration_ms(new['metrics']))
+
+    table_data.append([name, str(old['items_per_second']), str(len(old['metrics'])), str(new['items_per_second']), str(len(new['metrics'])), diff_formatted, old_optimization_ms, new_optimization_ms, p_value_formatted])
 
-table_data.append(['average', '', '', '', '', format_diff(average_diff_sum / len(old_data['benchmarks'])), ''])
+table_data.append(['average', '', '', '', '', format_diff(average_diff_sum / len(old_data['benchmarks'])), '', '', ''])
 
 table = AsciiTable(table_data)
 table.justify_columns[6] = 'right'
+table.justify_columns[7] = 'right'
+table.justify_columns[8] = 'right'
 
 print("")
 print(table.table)
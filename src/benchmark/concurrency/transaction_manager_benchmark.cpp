@@ -0,0 +1,34 @@
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+
+namespace opossum {
+
+// Starting and rolling back a transaction that did not modify anything
+static void BM_TransactionManager_NewTransactionContext(benchmark::State& state) {
+  auto& transaction_manager = TransactionManager::get();
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context();
+    transaction_context->rollback();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransactionManager_NewTransactionContext)->ThreadRange(1, 16)->UseRealTime();
+
+// Commit throughput of concurrent committers that do not modify anything, which measures the overhead of assigning
+// and publishing commit IDs (including the group commit, if configured)
+static void BM_TransactionManager_Commit(benchmark::State& state) {
+  auto& transaction_manager = TransactionManager::get();
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context();
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransactionManager_Commit)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace opossum
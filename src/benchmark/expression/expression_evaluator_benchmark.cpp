@@ -0,0 +1,205 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "constant_mappings.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "micro_benchmark_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+namespace {
+
+const auto ROWS = 1'000'000;
+const auto CHUNK_SIZE = Chunk::DEFAULT_SIZE;
+
+// Matching strings contain the needle, all others consist of the letters a to m only and never match the patterns
+const auto NEEDLE = std::string{"needle"};
+const auto STRING_LENGTH = 24;
+
+enum class SegmentKind { Value, Dictionary, Reference };
+
+// Evaluated to a segment (e.g., in a Projection) or, for predicates, to a PosList (e.g., in a TableScan)
+enum class ExpressionKind { Arithmetic, Comparison, Case, In, Like, Cast, Extract };
+
+std::string random_string(std::mt19937& generator, const bool matches) {
+  auto letter_distribution = std::uniform_int_distribution<int>{'a', 'm'};
+  auto string = std::string(STRING_LENGTH, ' ');
+  for (auto& character : string) character = static_cast<char>(letter_distribution(generator));
+  if (matches) {
+    const auto position = std::uniform_int_distribution<size_t>{0, STRING_LENGTH - NEEDLE.size()}(generator);
+    string.replace(position, NEEDLE.size(), NEEDLE);
+  }
+  return string;
+}
+
+// Creates a table with a single column "x" of @param data_type. For Int and Double, the values are drawn from
+// [0, 10 / selectivity), so that `x < 10` and `x IN (0, ..., 9)` select the given share of the rows. For Strings, the
+// share of the rows contains NEEDLE. Dates are spread over about 50 years.
+template <typename T>
+std::shared_ptr<Table> create_table(const DataType data_type, const double null_rate, const double selectivity,
+                                    const SegmentKind segment_kind) {
+  auto generator = std::mt19937{42};
+  auto null_distribution = std::bernoulli_distribution{null_rate};
+  auto selectivity_distribution = std::bernoulli_distribution{selectivity};
+  auto number_distribution = std::uniform_int_distribution<int32_t>{0, static_cast<int32_t>(10.0 / selectivity) - 1};
+  auto date_distribution = std::uniform_int_distribution<int32_t>{0, 50 * 365};
+
+  const auto nullable = null_rate > 0.0;
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"x", data_type, nullable}}, TableType::Data, CHUNK_SIZE);
+
+  for (auto chunk_begin = 0; chunk_begin < ROWS; chunk_begin += CHUNK_SIZE) {
+    auto values = std::vector<T>(CHUNK_SIZE);
+    auto nulls = std::vector<bool>(CHUNK_SIZE);
+    for (auto chunk_offset = size_t{0}; chunk_offset < CHUNK_SIZE; ++chunk_offset) {
+      nulls[chunk_offset] = null_distribution(generator);
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        values[chunk_offset] = pmr_string{random_string(generator, selectivity_distribution(generator))};
+      } else if (data_type == DataType::Date) {
+        values[chunk_offset] = static_cast<T>(date_distribution(generator));
+      } else {
+        values[chunk_offset] = static_cast<T>(number_distribution(generator));
+      }
+    }
+
+    if (nullable) {
+      table->append_chunk({std::make_shared<ValueSegment<T>>(std::move(values), std::move(nulls))});
+    } else {
+      table->append_chunk({std::make_shared<ValueSegment<T>>(std::move(values))});
+    }
+  }
+
+  if (segment_kind == SegmentKind::Dictionary) {
+    ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  }
+  if (segment_kind != SegmentKind::Reference) return table;
+
+  // The reference table points to all rows in their order, so that the results are comparable with the other kinds
+  const auto reference_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk_size = table->get_chunk(chunk_id)->size();
+    const auto pos_list = std::make_shared<PosList>(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+    pos_list->guarantee_single_chunk();
+    reference_table->append_chunk({std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)});
+  }
+  return reference_table;
+}
+
+std::shared_ptr<AbstractExpression> create_expression(const ExpressionKind expression_kind,
+                                                      const std::shared_ptr<AbstractExpression>& x) {
+  switch (expression_kind) {
+    case ExpressionKind::Arithmetic:
+      return add_(mul_(x, 3), 1);
+    case ExpressionKind::Comparison:
+      return less_than_(x, 10);
+    case ExpressionKind::Case:
+      return case_(less_than_(x, 10), x, 0);
+    case ExpressionKind::In:
+      return in_(x, list_(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    case ExpressionKind::Like:
+      return like_(x, pmr_string{"%" + NEEDLE + "%"});
+    case ExpressionKind::Cast:
+      return cast_(x, DataType::String);
+    case ExpressionKind::Extract:
+      return extract_(DatetimeComponent::Year, x);
+  }
+  Fail("GCC thinks this is reachable");
+}
+
+}  // namespace
+
+void BM_ExpressionEvaluator(benchmark::State& state, const ExpressionKind expression_kind, const DataType data_type,
+                            const SegmentKind segment_kind, const double null_rate, const double selectivity) {
+  micro_benchmark_clear_cache();
+
+  auto table = std::shared_ptr<Table>{};
+  resolve_data_type(physical_data_type(data_type), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    table = create_table<ColumnDataType>(data_type, null_rate, selectivity, segment_kind);
+  });
+
+  const auto x = pqp_column_(ColumnID{0}, data_type, null_rate > 0.0, "x");
+  const auto expression = create_expression(expression_kind, x);
+  const auto is_predicate = expression_kind == ExpressionKind::Comparison || expression_kind == ExpressionKind::In ||
+                            expression_kind == ExpressionKind::Like;
+
+  for (auto _ : state) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      auto evaluator = ExpressionEvaluator{table, chunk_id};
+      if (is_predicate) {
+        benchmark::DoNotOptimize(evaluator.evaluate_expression_to_pos_list(*expression));
+      } else {
+        benchmark::DoNotOptimize(evaluator.evaluate_expression_to_segment(*expression));
+      }
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ROWS);
+}
+
+namespace {
+
+void register_expression_evaluator_benchmarks() {
+  const auto expression_kinds = std::vector<std::pair<std::string, ExpressionKind>>{
+      {"Arithmetic", ExpressionKind::Arithmetic}, {"Comparison", ExpressionKind::Comparison},
+      {"Case", ExpressionKind::Case},             {"In", ExpressionKind::In},
+      {"Like", ExpressionKind::Like},             {"Cast", ExpressionKind::Cast},
+      {"Extract", ExpressionKind::Extract}};
+  const auto segment_kinds = std::vector<std::pair<std::string, SegmentKind>>{
+      {"Value", SegmentKind::Value}, {"Dictionary", SegmentKind::Dictionary}, {"Reference", SegmentKind::Reference}};
+  const auto null_rates = std::vector<double>{0.0, 0.1};
+
+  for (const auto& [expression_name, expression_kind] : expression_kinds) {
+    // The data types that the expression is benchmarked with
+    auto data_types = std::vector<DataType>{DataType::Int, DataType::Double};
+    if (expression_kind == ExpressionKind::Like) data_types = {DataType::String};
+    if (expression_kind == ExpressionKind::Extract) data_types = {DataType::Date};
+
+    // The selectivity only matters for the predicates and CASE
+    auto selectivities = std::vector<double>{0.5};
+    if (expression_kind == ExpressionKind::Comparison || expression_kind == ExpressionKind::Case ||
+        expression_kind == ExpressionKind::In || expression_kind == ExpressionKind::Like) {
+      selectivities = {0.01, 0.1, 0.5, 0.9};
+    }
+
+    for (const auto data_type : data_types) {
+      for (const auto& [segment_name, segment_kind] : segment_kinds) {
+        for (const auto null_rate : null_rates) {
+          for (const auto selectivity : selectivities) {
+            const auto name = "BM_ExpressionEvaluator/" + expression_name + "/" +
+                              data_type_to_string.left.at(data_type) + "/" + segment_name +
+                              "/Nulls:" + std::to_string(null_rate) + "/Selectivity:" + std::to_string(selectivity);
+            benchmark::RegisterBenchmark(name.c_str(), BM_ExpressionEvaluator, expression_kind, data_type,
+                                         segment_kind, null_rate, selectivity);
+          }
+        }
+      }
+    }
+  }
+}
+
+// See table_scan_sorted_benchmark.cpp for why the benchmarks are registered by a global object
+class StartUp {
+ public:
+  StartUp() { register_expression_evaluator_benchmarks(); }
+};
+StartUp startup;
+
+}  // namespace
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "expression/evaluation/like_matcher.hpp"
+
+namespace opossum {
+
+namespace {
+
+const auto STRING_COUNT = 100'000;
+const auto STRING_LENGTH = 32;
+
+// Creates strings of the letters a to m, which do not match any of the benchmarked patterns. The share of
+// @param selectivity of them begins and ends with "needle", so that they match all patterns.
+std::vector<pmr_string> create_strings(const double selectivity) {
+  auto generator = std::mt19937{42};
+  auto letter_distribution = std::uniform_int_distribution<int>{'a', 'm'};
+  auto selectivity_distribution = std::bernoulli_distribution{selectivity};
+
+  auto strings = std::vector<pmr_string>(STRING_COUNT);
+  for (auto& string : strings) {
+    string.resize(STRING_LENGTH);
+    for (auto& character : string) character = static_cast<char>(letter_distribution(generator));
+    if (selectivity_distribution(generator)) {
+      string.replace(0, 6, "needle");
+      string.replace(STRING_LENGTH - 6, 6, "needle");
+    }
+  }
+  return strings;
+}
+
+}  // namespace
+
+// Matches the strings with the specialized matcher that LikeMatcher picks for the pattern
+void BM_LikeMatcher(benchmark::State& state, const pmr_string& pattern, const double selectivity) {
+  const auto strings = create_strings(selectivity);
+  const auto like_matcher = LikeMatcher{pattern};
+
+  for (auto _ : state) {
+    auto match_count = size_t{0};
+    like_matcher.resolve(false, [&](const auto& matcher) {
+      for (const auto& string : strings) {
+        match_count += matcher(string);
+      }
+    });
+    benchmark::DoNotOptimize(match_count);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * STRING_COUNT);
+}
+
+// Matches the strings with a std::regex built from the pattern, as a baseline for the specialized matchers
+void BM_LikeMatcherRegex(benchmark::State& state, const pmr_string& pattern, const double selectivity) {
+  const auto strings = create_strings(selectivity);
+  const auto regex = std::regex{LikeMatcher::sql_like_to_regex(pattern)};
+
+  for (auto _ : state) {
+    auto match_count = size_t{0};
+    for (const auto& string : strings) {
+      match_count += std::regex_match(string.begin(), string.end(), regex);
+    }
+    benchmark::DoNotOptimize(match_count);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * STRING_COUNT);
+}
+
+namespace {
+
+void register_like_matcher_benchmarks() {
+  // One pattern for each of LikeMatcher's specialized matchers
+  const auto patterns = std::vector<std::pair<std::string, pmr_string>>{{"StartsWith", "needle%"},
+                                                                        {"EndsWith", "%needle"},
+                                                                        {"Contains", "%needle%"},
+                                                                        {"MultipleContains", "%nee%dle%"},
+                                                                        {"Wildcard", "ne_dle%n_edle"}};
+  const auto selectivities = std::vector<double>{0.01, 0.1, 0.5, 0.9};
+
+  for (const auto& [pattern_name, pattern] : patterns) {
+    for (const auto selectivity : selectivities) {
+      const auto suffix = pattern_name + "/Selectivity:" + std::to_string(selectivity);
+      benchmark::RegisterBenchmark(("BM_LikeMatcher/" + suffix).c_str(), BM_LikeMatcher, pattern, selectivity);
+      benchmark::RegisterBenchmark(("BM_LikeMatcherRegex/" + suffix).c_str(), BM_LikeMatcherRegex, pattern,
+                                   selectivity);
+    }
+  }
+}
+
+// See table_scan_sorted_benchmark.cpp for why the benchmarks are registered by a global object
+class StartUp {
+ public:
+  StartUp() { register_like_matcher_benchmarks(); }
+};
+StartUp startup;
+
+}  // namespace
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "tpcc/tpcc_benchmark_runner.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_query_generator.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark runs the TPC-C transactions and the TPC-H queries at the same time, similar to the CH-benCHmark. The
+ * simulated clients (--clients) are TPC-C terminals, and --analytical_clients clients issue the TPC-H queries one
+ * after the other. It reports the tpmC and the latencies of the transactions next to the latencies of the queries, so
+ * that changes to, e.g., the scheduler or MVCC can be judged on a mixed workload. See TpccBenchmarkRunner for details.
+ * The queries run on the TPC-H tables, not on the TPC-C tables. TPC-H query 15 is not run, as the clients would
+ * create and drop the same view. Of the basic benchmark options, --runs, --mode, --warmup, --verify, and --visualize
+ * are ignored.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("Hyrise Hybrid TPC-C/TPC-H Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Number of TPC-C warehouses", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("tpch_scale", "TPC-H scale factor (1.0 ~ 1GB)", cxxopts::value<float>()->default_value("0.1")) // NOLINT
+    ("analytical_clients", "Number of clients issuing TPC-H queries", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("q,queries", "Specify TPC-H queries to run (comma-separated query ids, e.g. \"--queries 1,3,19\"), default is all", cxxopts::value<std::string>()) // NOLINT
+    ("analytical_priority", "Scheduling priority of the TPC-H queries (Low, Default, or High)", cxxopts::value<std::string>()->default_value("Default")); // NOLINT
+  // clang-format on
+
+  std::shared_ptr<BenchmarkConfig> config;
+  auto warehouse_count = size_t{1};
+  auto tpch_scale_factor = 0.1f;
+  auto analytical_client_count = size_t{1};
+  auto comma_separated_queries = std::string{};
+  auto analytical_priority_str = std::string{"Default"};
+
+  if (CLIConfigParser::cli_has_json_config(argc, argv)) {
+    // JSON config file was passed in
+    const auto json_config = CLIConfigParser::parse_json_config_file(argv[1]);
+    warehouse_count = json_config.value("scale", size_t{1});
+    tpch_scale_factor = json_config.value("tpch_scale", 0.1f);
+    analytical_client_count = json_config.value("analytical_clients", size_t{1});
+    comma_separated_queries = json_config.value("queries", std::string{});
+    analytical_priority_str = json_config.value("analytical_priority", std::string{"Default"});
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
+  } else {
+    // Parse regular command line args
+    const auto cli_parse_result = cli_options.parse(argc, argv);
+
+    if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+    warehouse_count = cli_parse_result["scale"].as<size_t>();
+    tpch_scale_factor = cli_parse_result["tpch_scale"].as<float>();
+    analytical_client_count = cli_parse_result["analytical_clients"].as<size_t>();
+    if (cli_parse_result.count("queries")) {
+      comma_separated_queries = cli_parse_result["queries"].as<std::string>();
+    }
+    analytical_priority_str = cli_parse_result["analytical_priority"].as<std::string>();
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
+  }
+
+  auto analytical_priority = SchedulePriority::Default;
+  if (analytical_priority_str == "Low") {
+    analytical_priority = SchedulePriority::Low;
+  } else if (analytical_priority_str == "High") {
+    analytical_priority = SchedulePriority::High;
+  } else {
+    Assert(analytical_priority_str == "Default", "Unknown priority '" + analytical_priority_str + "'");
+  }
+
+  auto query_ids = std::vector<QueryID>{};
+  if (comma_separated_queries.empty()) {
+    for (const auto& [query_number, query] : tpch_queries) {
+      query_ids.emplace_back(query_number - 1);
+    }
+  } else {
+    // Split the input into query ids, ignoring leading, trailing, or duplicate commas
+    auto query_ids_str = std::vector<std::string>();
+    boost::trim_if(comma_separated_queries, boost::is_any_of(","));
+    boost::split(query_ids_str, comma_separated_queries, boost::is_any_of(","), boost::token_compress_on);
+    for (const auto& query_id_str : query_ids_str) {
+      const auto query_id = QueryID{boost::lexical_cast<QueryID::base_type, std::string>(query_id_str) - 1};
+      Assert(query_id < 22, "There are only 22 TPC-H queries");
+      query_ids.emplace_back(query_id);
+    }
+  }
+  // QueryID{14} represents TPC-H query 15 because we use 0 indexing
+  query_ids.erase(std::remove(query_ids.begin(), query_ids.end(), QueryID{14}), query_ids.end());
+
+  std::cout << "- TPC-C scale is " << warehouse_count << " warehouse(s)" << std::endl;
+  std::cout << "- TPC-H scale factor is " << tpch_scale_factor << std::endl;
+  std::cout << "- Benchmarking TPC-H Queries: [ ";
+  for (const auto& query_id : query_ids) {
+    std::cout << (query_id + 1) << ", ";
+  }
+  std::cout << "] with priority " << analytical_priority_str << std::endl;
+
+  auto context = BenchmarkRunner::create_context(*config);
+  context.emplace("scale", warehouse_count);
+  context.emplace("tpch_scale_factor", tpch_scale_factor);
+  context.emplace("analytical_priority", analytical_priority_str);
+
+  auto analytical_workload = TpccAnalyticalWorkload{};
+  analytical_workload.table_generator = std::make_unique<TpchTableGenerator>(tpch_scale_factor, config);
+  analytical_workload.query_generator = std::make_unique<TPCHQueryGenerator>(false, tpch_scale_factor, query_ids);
+  analytical_workload.client_count = analytical_client_count;
+  analytical_workload.priority = analytical_priority;
+
+  TpccBenchmarkRunner{*config, warehouse_count, context, std::move(analytical_workload)}.run();
+}
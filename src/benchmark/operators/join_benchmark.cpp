@@ -1,4 +1,8 @@
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 #include "operators/join_hash.hpp"
@@ -10,6 +14,8 @@
 #include "storage/chunk.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "table_generator.hpp"
 
 namespace {
@@ -57,6 +63,27 @@ std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
   return table_wrapper;
 }
 
+// Table with the keys 0 to number_of_rows - 1 in random order
+std::shared_ptr<TableWrapper> generate_unique_key_table(const size_t number_of_rows) {
+  auto keys = std::vector<int32_t>(number_of_rows);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937{42});
+
+  const auto chunk_size = number_of_rows / NUMBER_OF_CHUNKS;
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"key", DataType::Int, false}}, TableType::Data,
+                                       static_cast<uint32_t>(chunk_size));
+  for (auto chunk_begin = keys.cbegin(); chunk_begin < keys.cend(); chunk_begin += chunk_size) {
+    const auto chunk_end = std::min(chunk_begin + chunk_size, keys.cend());
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{chunk_begin,
+                                                                                                          chunk_end})});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  return table_wrapper;
+}
+
 template <class C>
 void bm_join_impl(benchmark::State& state, std::shared_ptr<TableWrapper> table_wrapper_left,
                   std::shared_ptr<TableWrapper> table_wrapper_right) {
@@ -100,6 +127,25 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+// Joins unique keys with a single radix partition, so that the hash table of the build side exceeds the caches. The
+// argument enables prefetching in the probe phase, see probe() in join_hash_steps.hpp.
+void BM_JoinHash_UniqueBuildSideProbe(benchmark::State& state) {  // NOLINT 1,000,000 x 10,000,000
+  auto table_wrapper_left = generate_unique_key_table(TABLE_SIZE_MEDIUM * 10);
+  auto table_wrapper_right = generate_unique_key_table(TABLE_SIZE_BIG);
+
+  clear_cache();
+
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+                                           ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                           size_t{0});
+    join->set_probe_prefetching(state.range(0) != 0);
+    join->execute();
+  }
+
+  opossum::StorageManager::get().reset();
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -110,6 +156,8 @@ BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
 
+BENCHMARK(BM_JoinHash_UniqueBuildSideProbe)->Arg(0)->Arg(1);
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
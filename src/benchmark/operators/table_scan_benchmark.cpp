@@ -5,6 +5,8 @@
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
 #include "storage/table.hpp"
 #include "table_generator.hpp"
 #include "utils/load_table.hpp"
@@ -58,6 +60,40 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_LessThan)(benchmark::State& state) {
+  _clear_cache();
+  benchmark_tablescan_impl(state, _table_wrapper_a, ColumnID{0}, PredicateCondition::LessThan, 500);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnDictSimdBp128)(benchmark::State& state) {
+  const auto table = TableGenerator{}.generate_table(ChunkID{2000});
+  ChunkEncoder::encode_all_chunks(table,
+                                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  _clear_cache();
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 7);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnFrameOfReference)(benchmark::State& state) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      TableGenerator{}.generate_table(ChunkID{2000}, EncodingType::FrameOfReference));
+  table_wrapper->execute();
+
+  _clear_cache();
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 7);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_LessThan_OnFrameOfReference)(benchmark::State& state) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      TableGenerator{}.generate_table(ChunkID{2000}, EncodingType::FrameOfReference));
+  table_wrapper->execute();
+
+  _clear_cache();
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 500);
+}
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
@@ -0,0 +1,131 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+
+namespace {
+
+constexpr auto TASK_QUEUE_BATCH_SIZE = 1'000;
+
+// Worker count, workers per node, and job count
+void scheduler_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto worker_count : {1, 4, 16}) {
+    for (const auto workers_per_node : {1, 4}) {
+      for (const auto job_count : {100, 10'000}) {
+        benchmark->Args({worker_count, workers_per_node, job_count});
+      }
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Micro benchmarks for the NodeQueueScheduler. The scheduler runs on a fake NUMA topology with the given number of
+ * workers and workers per node, so that the cost of distributing tasks across nodes (and stealing them) can be
+ * measured on any machine.
+ */
+class SchedulerBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    const auto worker_count = static_cast<uint32_t>(state.range(0));
+    const auto workers_per_node = static_cast<uint32_t>(state.range(1));
+    Topology::use_fake_numa_topology(worker_count, workers_per_node);
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  }
+
+  void TearDown(::benchmark::State&) override {
+    CurrentScheduler::set(nullptr);
+    Topology::use_default_topology();
+  }
+};
+
+// Time from scheduling a single empty job until it is done
+BENCHMARK_DEFINE_F(SchedulerBenchmarkFixture, BM_Scheduler_JobLatency)(benchmark::State& state) {
+  for (auto _ : state) {
+    const auto job = std::make_shared<JobTask>([]() {});
+    job->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{job});
+  }
+}
+BENCHMARK_REGISTER_F(SchedulerBenchmarkFixture, BM_Scheduler_JobLatency)
+    ->Args({1, 1})
+    ->Args({4, 1})
+    ->Args({4, 4})
+    ->Args({16, 4})
+    ->UseRealTime();
+
+// Throughput of independent empty jobs, spread over all nodes
+BENCHMARK_DEFINE_F(SchedulerBenchmarkFixture, BM_Scheduler_EmptyJobs)(benchmark::State& state) {
+  const auto job_count = state.range(2);
+
+  for (auto _ : state) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_id = int64_t{0}; job_id < job_count; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
+  state.SetItemsProcessed(state.iterations() * job_count);
+}
+BENCHMARK_REGISTER_F(SchedulerBenchmarkFixture, BM_Scheduler_EmptyJobs)
+    ->Apply(scheduler_arguments)
+    ->UseRealTime();
+
+// A job that fans out into child jobs, which are followed by a single job that depends on all of them
+BENCHMARK_DEFINE_F(SchedulerBenchmarkFixture, BM_Scheduler_FanOutFanIn)(benchmark::State& state) {
+  const auto child_count = state.range(2);
+
+  for (auto _ : state) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(child_count + 2);
+
+    const auto fan_in_job = std::make_shared<JobTask>([]() {});
+    const auto fan_out_job = std::make_shared<JobTask>([]() {});
+    jobs.emplace_back(fan_out_job);
+    for (auto child_id = int64_t{0}; child_id < child_count; ++child_id) {
+      const auto child_job = std::make_shared<JobTask>([]() {});
+      fan_out_job->set_as_predecessor_of(child_job);
+      child_job->set_as_predecessor_of(fan_in_job);
+      jobs.emplace_back(child_job);
+    }
+    jobs.emplace_back(fan_in_job);
+
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
+  state.SetItemsProcessed(state.iterations() * (child_count + 2));
+}
+BENCHMARK_REGISTER_F(SchedulerBenchmarkFixture, BM_Scheduler_FanOutFanIn)
+    ->Apply(scheduler_arguments)
+    ->UseRealTime();
+
+// Pushing tasks into a TaskQueue and pulling them out again, without any workers
+static void BM_TaskQueue_PushPull(benchmark::State& state) {
+  auto task_queue = TaskQueue{NodeID{0}};
+  auto jobs = std::vector<std::shared_ptr<JobTask>>(TASK_QUEUE_BATCH_SIZE);
+
+  for (auto _ : state) {
+    // Tasks can only be enqueued once
+    state.PauseTiming();
+    for (auto& job : jobs) job = std::make_shared<JobTask>([]() {});
+    state.ResumeTiming();
+
+    for (const auto& job : jobs) task_queue.push(job, static_cast<uint32_t>(SchedulePriority::Default));
+    for (auto job_id = 0; job_id < TASK_QUEUE_BATCH_SIZE; ++job_id) benchmark::DoNotOptimize(task_queue.pull());
+  }
+
+  state.SetItemsProcessed(state.iterations() * TASK_QUEUE_BATCH_SIZE);
+}
+BENCHMARK(BM_TaskQueue_PushPull);
+
+}  // namespace opossum
@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "constant_mappings.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+/**
+ * Benchmarks every EncodingType x VectorCompressionType x DataType on segments with different value distributions.
+ * For each configuration, it measures
+ *   - Encode:       the time to encode a ValueSegment, with its memory usage reported as counters
+ *   - Iterate:      the sequential throughput of the segment's iterables
+ *   - RandomAccess: the throughput of point accesses through a SegmentAccessor
+ *   - Scan:         the run time of a TableScan for different selectivities
+ *
+ * Run the hyriseMicroBenchmarks with --benchmark_filter=BM_Encoding and --benchmark_format=json to get the numbers in
+ * a machine-readable form, e.g., to calibrate the cost model of ChunkEncoder::select_segment_encoding().
+ */
+
+namespace opossum {
+
+namespace {
+
+const auto ROW_COUNT = size_t{Chunk::DEFAULT_SIZE};
+const auto DISTINCT_VALUE_COUNT = 10'000;
+const auto RUN_LENGTH = 64;
+const auto STRING_SIZE = 16;
+const auto RANDOM_ACCESS_COUNT = 10'000;
+
+enum class ValueDistribution { Uniform, Zipf, Sorted, Runs };
+
+// The value with the given rank among the distinct values, so that the order of the values follows the ranks
+template <typename T>
+T value_from_rank(const int32_t rank) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto string = std::to_string(rank);
+    return pmr_string{std::string(STRING_SIZE - string.length(), '0').append(string)};
+  } else {
+    return static_cast<T>(rank);
+  }
+}
+
+// Ranks in [0, DISTINCT_VALUE_COUNT) following the distribution. The seed is fixed, so that all encodings get the same
+// values.
+std::vector<int32_t> generate_ranks(const ValueDistribution distribution) {
+  auto random_engine = std::mt19937{42};
+  auto uniform_distribution = std::uniform_int_distribution<int32_t>{0, DISTINCT_VALUE_COUNT - 1};
+  auto ranks = std::vector<int32_t>(ROW_COUNT);
+
+  switch (distribution) {
+    case ValueDistribution::Uniform:
+      for (auto& rank : ranks) rank = uniform_distribution(random_engine);
+      break;
+
+    case ValueDistribution::Zipf: {
+      // Zipf's law with an exponent of 1: the k-th most frequent value occurs with a probability proportional to 1/k
+      auto weights = std::vector<double>(DISTINCT_VALUE_COUNT);
+      for (auto rank = 0; rank < DISTINCT_VALUE_COUNT; ++rank) weights[rank] = 1.0 / (rank + 1);
+      auto zipf_distribution = std::discrete_distribution<int32_t>{weights.cbegin(), weights.cend()};
+      for (auto& rank : ranks) rank = zipf_distribution(random_engine);
+      break;
+    }
+
+    case ValueDistribution::Sorted:
+      for (auto& rank : ranks) rank = uniform_distribution(random_engine);
+      std::sort(ranks.begin(), ranks.end());
+      break;
+
+    case ValueDistribution::Runs:
+      for (auto run_begin = size_t{0}; run_begin < ROW_COUNT; run_begin += RUN_LENGTH) {
+        const auto run_end = std::min(run_begin + RUN_LENGTH, ROW_COUNT);
+        std::fill(ranks.begin() + run_begin, ranks.begin() + run_end, uniform_distribution(random_engine));
+      }
+      break;
+  }
+
+  return ranks;
+}
+
+struct EncodingConfiguration {
+  EncodingType encoding_type;
+  std::optional<VectorCompressionType> vector_compression_type;
+  DataType data_type;
+  ValueDistribution distribution;
+};
+
+std::shared_ptr<const BaseValueSegment> create_value_segment(const EncodingConfiguration& configuration) {
+  const auto ranks = generate_ranks(configuration.distribution);
+
+  auto value_segment = std::shared_ptr<BaseValueSegment>{};
+  resolve_data_type(configuration.data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = pmr_concurrent_vector<ColumnDataType>(ROW_COUNT);
+    std::transform(ranks.cbegin(), ranks.cend(), values.begin(), value_from_rank<ColumnDataType>);
+    value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+  });
+  return value_segment;
+}
+
+std::shared_ptr<BaseSegment> encode(const EncodingConfiguration& configuration,
+                                    const std::shared_ptr<const BaseValueSegment>& value_segment) {
+  if (configuration.encoding_type == EncodingType::Unencoded) {
+    return std::const_pointer_cast<BaseValueSegment>(value_segment);
+  }
+  return encode_segment(configuration.encoding_type, configuration.data_type, value_segment,
+                        configuration.vector_compression_type);
+}
+
+void BM_EncodingEncode(benchmark::State& state, const EncodingConfiguration configuration) {
+  const auto value_segment = create_value_segment(configuration);
+
+  auto segment = std::shared_ptr<BaseSegment>{};
+  for (auto _ : state) {
+    segment = encode(configuration, value_segment);
+    benchmark::DoNotOptimize(segment);
+  }
+
+  const auto memory_usage = segment->estimate_memory_usage();
+  state.counters["bytes"] = static_cast<double>(memory_usage);
+  state.counters["bytes_per_value"] = static_cast<double>(memory_usage) / ROW_COUNT;
+  state.counters["compression_ratio"] =
+      static_cast<double>(value_segment->estimate_memory_usage()) / static_cast<double>(memory_usage);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+void BM_EncodingIterate(benchmark::State& state, const EncodingConfiguration configuration) {
+  const auto segment = encode(configuration, create_value_segment(configuration));
+
+  for (auto _ : state) {
+    auto null_count = size_t{0};
+    segment_iterate(*segment, [&](const auto& position) {
+      if (position.is_null()) {
+        ++null_count;
+      } else {
+        benchmark::DoNotOptimize(position.value());
+      }
+    });
+    benchmark::DoNotOptimize(null_count);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+void BM_EncodingRandomAccess(benchmark::State& state, const EncodingConfiguration configuration) {
+  const auto segment = encode(configuration, create_value_segment(configuration));
+
+  auto random_engine = std::mt19937{42};
+  auto offset_distribution = std::uniform_int_distribution<ChunkOffset>{0, ROW_COUNT - 1};
+  auto chunk_offsets = std::vector<ChunkOffset>(RANDOM_ACCESS_COUNT);
+  for (auto& chunk_offset : chunk_offsets) chunk_offset = offset_distribution(random_engine);
+
+  resolve_data_type(configuration.data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+    for (auto _ : state) {
+      for (const auto chunk_offset : chunk_offsets) {
+        benchmark::DoNotOptimize(accessor->access(chunk_offset));
+      }
+    }
+  });
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RANDOM_ACCESS_COUNT));
+}
+
+void BM_EncodingScan(benchmark::State& state, const EncodingConfiguration configuration, const double selectivity) {
+  const auto segment = encode(configuration, create_value_segment(configuration));
+
+  const auto column_definitions = TableColumnDefinitions{{"a", configuration.data_type, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append_chunk({segment});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // For the Zipf distribution, the share of values below the search value is larger than the selectivity
+  auto search_value = AllTypeVariant{};
+  resolve_data_type(configuration.data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    search_value = value_from_rank<ColumnDataType>(static_cast<int32_t>(DISTINCT_VALUE_COUNT * selectivity));
+  });
+  const auto predicate = less_than_(pqp_column_(ColumnID{0}, configuration.data_type, false, "a"), search_value);
+
+  for (auto _ : state) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+void register_encoding_benchmarks() {
+  const auto distributions = std::vector<std::pair<ValueDistribution, std::string>>{
+      {ValueDistribution::Uniform, "Uniform"},
+      {ValueDistribution::Zipf, "Zipf"},
+      {ValueDistribution::Sorted, "Sorted"},
+      {ValueDistribution::Runs, "Runs"}};
+  const auto selectivities = std::vector<double>{0.001, 0.01, 0.1, 0.5, 0.9};
+
+  for (const auto encoding_type : encoding_type_enum_values) {
+    auto vector_compression_types = std::vector<std::optional<VectorCompressionType>>{std::nullopt};
+    if (encoding_type != EncodingType::Unencoded && create_encoder(encoding_type)->uses_vector_compression()) {
+      vector_compression_types = {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128,
+                                  VectorCompressionType::BitPacking};
+    }
+
+    for (const auto& vector_compression_type : vector_compression_types) {
+      for (const auto& [data_type, data_type_name] : data_type_to_string.left) {
+        if (data_type == DataType::Null || !encoding_supports_data_type(encoding_type, data_type)) continue;
+
+        for (const auto& [distribution, distribution_name] : distributions) {
+          const auto configuration =
+              EncodingConfiguration{encoding_type, vector_compression_type, data_type, distribution};
+          const auto name = encoding_type_to_string.left.at(encoding_type) + "/" +
+                            (vector_compression_type
+                                 ? vector_compression_type_to_string.left.at(*vector_compression_type)
+                                 : std::string{"None"}) +
+                            "/" + data_type_name + "/" + distribution_name;
+
+          benchmark::RegisterBenchmark(("BM_Encoding/Encode/" + name).c_str(), BM_EncodingEncode, configuration);
+          benchmark::RegisterBenchmark(("BM_Encoding/Iterate/" + name).c_str(), BM_EncodingIterate, configuration);
+          benchmark::RegisterBenchmark(("BM_Encoding/RandomAccess/" + name).c_str(), BM_EncodingRandomAccess,
+                                       configuration);
+          for (const auto selectivity : selectivities) {
+            benchmark::RegisterBenchmark(("BM_Encoding/Scan/" + name + "/" + std::to_string(selectivity)).c_str(),
+                                         BM_EncodingScan, configuration, selectivity);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Registers the benchmarks when the hyriseMicroBenchmarks are started, see table_scan_sorted_benchmark.cpp
+class StartUp {
+ public:
+  StartUp() { register_encoding_benchmarks(); }
+};
+StartUp startup;
+
+}  // namespace
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include <iostream>
+#include <memory>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "tpcc/tpcc_benchmark_runner.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark runs the five TPC-C transactions (New-Order, Payment, Order-Status, Delivery, and Stock-Level) on
+ * concurrent terminals, each of which is one of the simulated clients (--clients). It measures the transactional paths
+ * of Hyrise, i.e., MVCC validation, Insert, Update, Delete, and commits under contention, and reports the tpmC, the
+ * abort rate, and the latency of each transaction type. See TpccBenchmarkRunner for where it deviates from the
+ * specification. Of the basic benchmark options, --runs, --mode, --warmup, --verify, and --visualize are ignored.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("Hyrise TPC-C Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Number of warehouses", cxxopts::value<size_t>()->default_value("1")); // NOLINT
+  // clang-format on
+
+  std::shared_ptr<BenchmarkConfig> config;
+  auto warehouse_count = size_t{1};
+
+  if (CLIConfigParser::cli_has_json_config(argc, argv)) {
+    // JSON config file was passed in
+    const auto json_config = CLIConfigParser::parse_json_config_file(argv[1]);
+    warehouse_count = json_config.value("scale", size_t{1});
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
+  } else {
+    // Parse regular command line args
+    const auto cli_parse_result = cli_options.parse(argc, argv);
+
+    if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+    warehouse_count = cli_parse_result["scale"].as<size_t>();
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
+  }
+
+  std::cout << "- TPC-C scale is " << warehouse_count << " warehouse(s)" << std::endl;
+
+  auto context = BenchmarkRunner::create_context(*config);
+  context.emplace("scale", warehouse_count);
+
+  TpccBenchmarkRunner{*config, warehouse_count, context}.run();
+}
@@ -3,7 +3,10 @@
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
 
@@ -11,6 +14,7 @@ namespace opossum {
 
 void to_json(nlohmann::json& json, const TableGenerationMetrics& metrics) {
   json = {{"generation_duration", metrics.generation_duration.count()},
+          {"sort_duration", metrics.sort_duration.count()},
           {"encoding_duration", metrics.encoding_duration.count()},
           {"binary_caching_duration", metrics.binary_caching_duration.count()},
           {"store_duration", metrics.store_duration.count()}};
@@ -27,6 +31,27 @@ void AbstractTableGenerator::generate_and_store() {
   metrics.generation_duration = timer.lap();
   std::cout << "- Loading/Generating tables done (" << format_duration(metrics.generation_duration) << ")" << std::endl;
 
+  /**
+   * Sort the Tables if requested, so that their chunks know the column they are sorted by (see Chunk::ordered_by())
+   */
+  if (!_benchmark_config->sort_on_load.empty()) {
+    std::cout << "- Sorting tables" << std::endl;
+    for (const auto& [table_name, column_name] : _benchmark_config->sort_on_load) {
+      const auto table_info_iter = table_info_by_name.find(table_name);
+      Assert(table_info_iter != table_info_by_name.end(), "Cannot sort unknown table '" + table_name + "'");
+      auto& table_info = table_info_iter->second;
+
+      std::cout << "-  Sorting '" << table_name << "' by '" << column_name << "' " << std::flush;
+      Timer per_table_timer;
+      table_info.table = _sort_table(table_info.table, table_info.table->column_id_by_name(column_name));
+      // The binary file, if any, does not contain the sorted table
+      table_info.binary_file_out_of_date = true;
+      std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
+    }
+    metrics.sort_duration = timer.lap();
+    std::cout << "- Sorting tables done (" << format_duration(metrics.sort_duration) << ")" << std::endl;
+  }
+
   /**
    * Encode the Tables
    */
@@ -43,7 +68,26 @@ void AbstractTableGenerator::generate_and_store() {
   std::cout << "- Encoding tables done (" << format_duration(metrics.encoding_duration) << ")" << std::endl;
 
   /**
-   * Write the Tables into binary files if required
+   * Add the Tables to the StorageManager
+   */
+  std::cout << "- Adding Tables to StorageManager and generating statistics " << std::endl;
+  auto& storage_manager = StorageManager::get();
+  for (auto& [table_name, table_info] : table_info_by_name) {
+    std::cout << "-  Adding '" << table_name << "' " << std::flush;
+    Timer per_table_timer;
+    if (storage_manager.has_table(table_name)) storage_manager.drop_table(table_name);
+    storage_manager.add_table(table_name, table_info.table);
+    std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
+  }
+
+  metrics.store_duration = timer.lap();
+
+  std::cout << "- Adding Tables to StorageManager and generating statistics done ("
+            << format_duration(metrics.store_duration) << ")" << std::endl;
+
+  /**
+   * Write the Tables into binary files if required. This happens after they were added to the StorageManager, so that
+   * the binary files contain their statistics, which ImportBinary reads instead of generating them again.
    */
   if (_benchmark_config->cache_binary_tables) {
     std::cout << "- Writing tables into binary files if necessary" << std::endl;
@@ -70,24 +114,25 @@ void AbstractTableGenerator::generate_and_store() {
     std::cout << "- Writing tables into binary files done (" << format_duration(metrics.binary_caching_duration) << ")"
               << std::endl;
   }
+}
 
-  /**
-   * Add the Tables to the StorageManager
-   */
-  std::cout << "- Adding Tables to StorageManager and generating statistics " << std::endl;
-  auto& storage_manager = StorageManager::get();
-  for (auto& [table_name, table_info] : table_info_by_name) {
-    std::cout << "-  Adding '" << table_name << "' " << std::flush;
-    Timer per_table_timer;
-    if (storage_manager.has_table(table_name)) storage_manager.drop_table(table_name);
-    storage_manager.add_table(table_name, table_info.table);
-    std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
-  }
+std::shared_ptr<Table> AbstractTableGenerator::_sort_table(const std::shared_ptr<Table>& table, const ColumnID column_id) {
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, column_id, OrderByMode::Ascending, table->max_chunk_size());
+  sort->execute();
+  const auto sorted_table = sort->get_output();
 
-  metrics.store_duration = timer.lap();
+  // Sort does not create MVCC data, so the chunks are copied into a table that has the same MVCC setting as the input
+  auto output = std::make_shared<Table>(table->column_definitions(), TableType::Data, table->max_chunk_size(),
+                                        table->has_mvcc());
+  for (auto chunk_id = ChunkID{0}; chunk_id < sorted_table->chunk_count(); ++chunk_id) {
+    const auto sorted_chunk = sorted_table->get_chunk(chunk_id);
+    output->append_chunk(sorted_chunk->segments());
+    output->get_chunk(chunk_id)->set_ordered_by(std::make_pair(column_id, OrderByMode::Ascending));
+  }
 
-  std::cout << "- Adding Tables to StorageManager and generating statistics done ("
-            << format_duration(metrics.store_duration) << ")" << std::endl;
+  return output;
 }
 
 }  // namespace opossum
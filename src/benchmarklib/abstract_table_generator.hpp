@@ -34,6 +34,7 @@ struct BenchmarkTableInfo {
 
 struct TableGenerationMetrics {
   std::chrono::nanoseconds generation_duration{};
+  std::chrono::nanoseconds sort_duration{};
   std::chrono::nanoseconds encoding_duration{};
   std::chrono::nanoseconds binary_caching_duration{};
   std::chrono::nanoseconds store_duration{};
@@ -56,6 +57,9 @@ class AbstractTableGenerator {
   TableGenerationMetrics metrics;
 
  protected:
+  // Returns a copy of @param table that is sorted ascendingly by @param column_id and whose chunks know about that
+  static std::shared_ptr<Table> _sort_table(const std::shared_ptr<Table>& table, const ColumnID column_id);
+
   const std::shared_ptr<BenchmarkConfig> _benchmark_config;
 };
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
+#include <string>
+#include <unordered_map>
 
 #include "encoding_config.hpp"
 #include "utils/null_streambuf.hpp"
@@ -24,7 +27,10 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables);
+                  const bool cache_binary_tables,
+                  const std::unordered_map<std::string, std::string>& sort_on_load = {},
+                  const std::optional<double>& arrival_rate = std::nullopt, const bool hardware_counters = false,
+                  const bool cardinality_estimation_report = false);
 
   static BenchmarkConfig get_default_config();
 
@@ -43,6 +49,20 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;
 
+  // Maps the names of tables to the names of the columns by which they are sorted after loading/generating them
+  std::unordered_map<std::string, std::string> sort_on_load = {};
+
+  // If set, queries are issued at this rate (queries per second, exponentially distributed inter-arrival times) instead
+  // of by the closed loop of simulated clients, each of which waits for its query (set) to finish (open-loop mode)
+  std::optional<double> arrival_rate = std::nullopt;
+
+  // Count hardware events (cycles, cache misses, ...) per operator and report them per query, see HardwareCounters
+  bool hardware_counters = false;
+
+  // Report the estimated and actual row count of each LQP node of each query and the q-errors of the estimates, see
+  // collect_cardinality_estimation_errors()
+  bool cardinality_estimation_report = false;
+
   static const char* description;
 
  private:
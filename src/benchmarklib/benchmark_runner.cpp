@@ -1,6 +1,8 @@
 #include <json.hpp>
 
 #include <boost/range/adaptors.hpp>
+#include <algorithm>
+#include <map>
 #include <random>
 
 #include "cxxopts.hpp"
@@ -9,21 +11,86 @@
 #include "benchmark_runner.hpp"
 #include "benchmark_state.hpp"
 #include "constant_mappings.hpp"
+#include "latency_percentiles.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "statistics/cardinality_estimation_errors.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/check_table_equal.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/sqlite_wrapper.hpp"
 #include "utils/timer.hpp"
 #include "version.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the id of a simulated client that is not running a query (set) and marks it as busy. If all clients are
+// busy, nullopt is returned.
+std::optional<uint32_t> acquire_idle_client(std::vector<std::atomic_bool>& busy_clients) {
+  for (auto client_id = uint32_t{0}; client_id < busy_clients.size(); ++client_id) {
+    auto busy = false;
+    if (busy_clients[client_id].compare_exchange_strong(busy, true)) return client_id;
+  }
+  return std::nullopt;
+}
+
+template <typename Value>
+nlohmann::json cache_metrics_to_json(const Cache<Value>& cache) {
+  const auto metrics = cache.metrics();
+  const auto lookup_count = metrics.hits + metrics.misses;
+  return nlohmann::json{
+      {"capacity", cache.cache().capacity()},
+      {"size", cache.size()},
+      {"hits", metrics.hits},
+      {"misses", metrics.misses},
+      {"hit_rate", lookup_count > 0 ? static_cast<double>(metrics.hits) / static_cast<double>(lookup_count) : 0.0},
+      {"rejected_admissions", metrics.rejected_admissions},
+      {"evictions", metrics.evictions}};
+}
+
+nlohmann::json hardware_counters_to_json(const HardwareCounterValues& counters, const size_t divisor = 1) {
+  auto json = nlohmann::json::object();
+  for (auto counter_id = size_t{0}; counter_id < HardwareCounterValues::COUNTER_COUNT; ++counter_id) {
+    json[HardwareCounterValues::COUNTER_NAMES[counter_id]] = counters.values[counter_id] / divisor;
+  }
+  return json;
+}
+
+nlohmann::json q_error_distribution_to_json(const QErrorDistribution& distribution) {
+  return nlohmann::json{{"count", distribution.count},
+                        {"geometric_mean", distribution.geometric_mean},
+                        {"median", distribution.median},
+                        {"p90", distribution.percentile_90},
+                        {"max", distribution.max}};
+}
+
+// Groups the q-errors by the type of the LQP node and summarizes each group and all q-errors ("All")
+nlohmann::json q_errors_per_node_type_to_json(const std::vector<CardinalityEstimationError>& errors) {
+  auto q_errors_per_node_type = std::map<std::string, std::vector<double>>{};
+  for (const auto& error : errors) {
+    q_errors_per_node_type[lqp_node_type_to_string.at(error.node_type)].emplace_back(error.q_error);
+    q_errors_per_node_type["All"].emplace_back(error.q_error);
+  }
+
+  auto json = nlohmann::json::object();
+  for (auto& [node_type, q_errors] : q_errors_per_node_type) {
+    json[node_type] = q_error_distribution_to_json(summarize_q_errors(std::move(q_errors)));
+  }
+  return json;
+}
+
+}  // namespace
+
 namespace opossum {
 
 BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
@@ -51,12 +118,17 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<
     const auto scheduler = std::make_shared<NodeQueueScheduler>();
     CurrentScheduler::set(scheduler);
   }
+
+  if (config.hardware_counters) {
+    HardwareCounters::enable();
+  }
 }
 
 BenchmarkRunner::~BenchmarkRunner() {
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->finish();
   }
+  HardwareCounters::enable(false);
 }
 
 void BenchmarkRunner::run() {
@@ -96,8 +168,13 @@ void BenchmarkRunner::run() {
   const auto available_queries_count = _query_generator->available_query_count();
   _query_plans.resize(available_queries_count);
   _query_results.resize(available_queries_count);
+  _client_latencies.resize(_config.clients);
+
+  // The plan cache metrics in the report only cover the benchmark itself
+  SQLLogicalPlanCache::get().reset_metrics();
+  SQLPhysicalPlanCache::get().reset_metrics();
 
-  auto benchmark_start = std::chrono::steady_clock::now();
+  _benchmark_begin = std::chrono::steady_clock::now();
 
   // Run the queries in the selected mode
   switch (_config.benchmark_mode) {
@@ -112,7 +189,7 @@ void BenchmarkRunner::run() {
   }
 
   auto benchmark_end = std::chrono::steady_clock::now();
-  _total_run_duration = benchmark_end - benchmark_start;
+  _total_run_duration = benchmark_end - _benchmark_begin;
 
   // Create report
   if (_config.output_file_path) {
@@ -173,48 +250,93 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
   std::random_device random_device;
   std::mt19937 random_generator(random_device());
 
-  // The atomic uints are modified by other threads when finishing a query set, to keep track of when we can
-  // let a simulated client schedule the next set, as well as the total number of finished query sets so far
-  auto currently_running_clients = std::atomic_uint{0};
+  // The atomics are modified by other threads when finishing a query, to keep track of when we can let a simulated
+  // client schedule the next set, as well as the total number of finished query sets so far
+  auto busy_clients = std::vector<std::atomic_bool>(_config.clients);
+  for (auto& busy : busy_clients) busy = false;
   auto finished_query_set_runs = std::atomic_uint{0};
   auto finished_queries_total = std::atomic_uint{0};
 
+  // In open-loop mode, queries are issued one by one at exponentially distributed intervals (i.e., a Poisson process),
+  // no matter how many queries are still running. The next query is taken from the shuffled query set.
+  auto interarrival_distribution = std::exponential_distribution<double>{_config.arrival_rate.value_or(1.0)};
+  auto next_arrival = std::chrono::steady_clock::now();
+  auto next_query_idx = number_of_queries;
+
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
   auto state = BenchmarkState{_config.max_duration};
 
   while (state.keep_running() && finished_query_set_runs.load(std::memory_order_relaxed) < _config.max_num_query_runs) {
-    // We want to only schedule as many query sets simultaneously as we have simulated clients
-    if (currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
-      currently_running_clients++;
-      std::shuffle(query_ids.begin(), query_ids.end(), random_generator);
+    if (_config.arrival_rate) {
+      const auto now = std::chrono::steady_clock::now();
+      if (now < next_arrival) {
+        // Sleep in short steps so that the end of the benchmark is not missed at low arrival rates
+        const auto max_sleep_duration = std::chrono::steady_clock::duration{std::chrono::milliseconds(10)};
+        std::this_thread::sleep_for(std::min(next_arrival - now, max_sleep_duration));
+        continue;
+      }
 
-      for (const auto& query_id : query_ids) {
-        const auto pipeline = _build_sql_pipeline(query_id);
+      if (next_query_idx == number_of_queries) {
+        std::shuffle(query_ids.begin(), query_ids.end(), random_generator);
+        next_query_idx = 0;
+      }
+      const auto query_id = query_ids[next_query_idx++];
+      const auto pipeline = _build_sql_pipeline(query_id);
 
-        // The on_query_done callback will be appended to the last Task of the query,
-        // to measure its duration as well as signal that the query was finished
-        const auto query_run_begin = std::chrono::steady_clock::now();
-        auto on_query_done = [pipeline, query_id, number_of_queries, query_run_begin, &currently_running_clients,
-                              &finished_query_set_runs, &finished_queries_total, &state, this]() {
-          if (finished_queries_total++ % number_of_queries == 0) {
-            currently_running_clients--;
-            finished_query_set_runs++;
-          }
+      // The latency is measured from the planned arrival, so that a late issue (e.g., because the benchmark thread was
+      // not scheduled in time) does not hide the time the query should have been waiting
+      const auto query_run_begin = next_arrival;
+      auto on_query_done = [pipeline, query_id, number_of_queries, query_run_begin, &finished_query_set_runs,
+                            &finished_queries_total, &state, this]() {
+        if (++finished_queries_total % number_of_queries == 0) {
+          finished_query_set_runs++;
+        }
+
+        if (!state.is_done()) {  // To prevent queries to add their results after the time is up
+          _record_query_run(query_id, std::nullopt, query_run_begin, *pipeline);
+        }
+      };
 
-          if (!state.is_done()) {  // To prevent queries to add their results after the time is up
-            const auto duration = std::chrono::steady_clock::now() - query_run_begin;
-            auto& result = _query_results[query_id];
-            result.duration_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
-            result.metrics.push_back(pipeline->metrics());
-            result.num_iterations++;
-          }
-        };
+      auto query_tasks = _schedule_or_execute_query(query_id, pipeline, on_query_done);
+      tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
 
-        auto query_tasks = _schedule_or_execute_query(query_id, pipeline, on_query_done);
-        tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
-      }
-    } else {
+      next_arrival += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>{interarrival_distribution(random_generator)});
+      continue;
+    }
+
+    // We want to only schedule as many query sets simultaneously as we have simulated clients
+    const auto client_id = acquire_idle_client(busy_clients);
+    if (!client_id) {
       std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
+    }
+
+    std::shuffle(query_ids.begin(), query_ids.end(), random_generator);
+
+    // The client becomes idle once the last query of its set is done
+    const auto remaining_queries = std::make_shared<std::atomic_size_t>(number_of_queries);
+
+    for (const auto& query_id : query_ids) {
+      const auto pipeline = _build_sql_pipeline(query_id);
+
+      // The on_query_done callback will be appended to the last Task of the query,
+      // to measure its duration as well as signal that the query was finished
+      const auto query_run_begin = std::chrono::steady_clock::now();
+      auto on_query_done = [pipeline, query_id, client_id, query_run_begin, remaining_queries, &busy_clients,
+                            &finished_query_set_runs, &state, this]() {
+        if (!state.is_done()) {  // To prevent queries to add their results after the time is up
+          _record_query_run(query_id, client_id, query_run_begin, *pipeline);
+        }
+
+        if (--(*remaining_queries) == 0) {
+          finished_query_set_runs++;
+          busy_clients[*client_id] = false;
+        }
+      };
+
+      auto query_tasks = _schedule_or_execute_query(query_id, pipeline, on_query_done);
+      tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
     }
   }
   state.set_done();
@@ -223,7 +345,8 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
   // TODO(leander/anyone): To be replaced with something like CurrentScheduler::abort(),
   // that properly removes all remaining tasks from all queues, without having to wait for them
   CurrentScheduler::wait_for_tasks(tasks);
-  Assert(currently_running_clients == 0, "All query set runs must be finished at this point");
+  Assert(std::none_of(busy_clients.begin(), busy_clients.end(), [](const auto& busy) { return busy.load(); }),
+         "All query set runs must be finished at this point");
 }
 
 void BenchmarkRunner::_benchmark_individual_queries() {
@@ -233,9 +356,10 @@ void BenchmarkRunner::_benchmark_individual_queries() {
     const auto& name = _query_generator->query_name(query_id);
     std::cout << "- Benchmarking Query " << name << std::endl;
 
-    // The atomic uints are modified by other threads when finishing a query, to keep track of when we can
-    // let a simulated client schedule the next query, as well as the total number of finished queries so far
-    auto currently_running_clients = std::atomic_uint{0};
+    // The atomics are modified by other threads when finishing a query, to keep track of when we can let a simulated
+    // client schedule the next query
+    auto busy_clients = std::vector<std::atomic_bool>(_config.clients);
+    for (auto& busy : busy_clients) busy = false;
     auto& result = _query_results[query_id];
 
     auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -243,19 +367,17 @@ void BenchmarkRunner::_benchmark_individual_queries() {
 
     while (state.keep_running() && result.num_iterations.load(std::memory_order_relaxed) < _config.max_num_query_runs) {
       // We want to only schedule as many queries simultaneously as we have simulated clients
-      if (currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
-        currently_running_clients++;
-
+      if (const auto client_id = acquire_idle_client(busy_clients)) {
         const auto pipeline = _build_sql_pipeline(query_id);
 
         // The on_query_done callback will be appended to the last Task of the query,
         // to measure its duration as well as signal that the query was finished
-        auto on_query_done = [pipeline, &currently_running_clients, &result, &state]() {
-          currently_running_clients--;
+        const auto query_run_begin = std::chrono::steady_clock::now();
+        auto on_query_done = [pipeline, query_id, client_id, query_run_begin, &busy_clients, &state, this]() {
           if (!state.is_done()) {  // To prevent queries to add their results after the time is up
-            result.num_iterations++;
-            result.metrics.push_back(pipeline->metrics());
+            _record_query_run(query_id, client_id, query_run_begin, *pipeline);
           }
+          busy_clients[*client_id] = false;
         };
 
         const auto query_tasks = _schedule_or_execute_query(query_id, pipeline, on_query_done);
@@ -277,7 +399,8 @@ void BenchmarkRunner::_benchmark_individual_queries() {
     // TODO(leander/anyone): To be replaced with something like CurrentScheduler::abort(),
     // that properly removes all remaining tasks from all queues, without having to wait for them
     CurrentScheduler::wait_for_tasks(tasks);
-    Assert(currently_running_clients == 0, "All query runs must be finished at this point");
+    Assert(std::none_of(busy_clients.begin(), busy_clients.end(), [](const auto& busy) { return busy.load(); }),
+           "All query runs must be finished at this point");
   }
 }
 
@@ -397,6 +520,37 @@ void BenchmarkRunner::_execute_query(const QueryID query_id, const std::shared_p
   _store_plan(query_id, *pipeline);
 }
 
+void BenchmarkRunner::_record_query_run(const QueryID query_id, const std::optional<uint32_t> client_id,
+                                        const std::chrono::steady_clock::time_point query_run_begin,
+                                        SQLPipeline& pipeline) {
+  const auto query_run_end = std::chrono::steady_clock::now();
+  const auto latency = std::chrono::duration_cast<Duration>(query_run_end - query_run_begin);
+
+  auto& result = _query_results[query_id];
+
+  // In IndividualQueries mode, the duration is the wall time of all runs of the query, stored once they are done
+  if (_config.benchmark_mode == BenchmarkMode::PermutedQuerySet) {
+    result.duration_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+  }
+  result.metrics.push_back(pipeline.metrics());
+  result.latencies.push_back(latency);
+  const auto is_first_iteration = result.num_iterations++ == 0;
+
+  // The estimates and row counts do not change between iterations
+  if (_config.cardinality_estimation_report && is_first_iteration) {
+    for (const auto& pqp : pipeline.get_physical_plans()) {
+      const auto statement_errors = collect_cardinality_estimation_errors(pqp);
+      result.cardinality_estimation_errors.insert(result.cardinality_estimation_errors.end(),
+                                                  statement_errors.begin(), statement_errors.end());
+    }
+  }
+
+  if (client_id) {
+    _client_latencies[*client_id].push_back(latency);
+  }
+  _query_completion_times.push_back(std::chrono::duration_cast<Duration>(query_run_end - _benchmark_begin));
+}
+
 void BenchmarkRunner::_store_plan(const QueryID query_id, SQLPipeline& pipeline) {
   if (_config.enable_visualization) {
     if (_query_plans[query_id].lqps.empty()) {
@@ -409,6 +563,9 @@ void BenchmarkRunner::_store_plan(const QueryID query_id, SQLPipeline& pipeline)
 void BenchmarkRunner::_create_report(std::ostream& stream) const {
   nlohmann::json benchmarks;
 
+  // The estimates of all queries, summarized per node type at the end of the report
+  auto all_cardinality_estimation_errors = std::vector<CardinalityEstimationError>{};
+
   for (const auto& query_id : _query_generator->selected_queries()) {
     const auto& name = _query_generator->query_name(query_id);
     const auto& query_result = _query_results[query_id];
@@ -424,6 +581,9 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     // Convert the SQLPipelineMetrics for each query iteration into JSON
     auto all_pipeline_metrics_json = nlohmann::json::array();
 
+    // Sum of the hardware counters of all iterations (if counted), reported as the average per iteration
+    auto hardware_counters = std::optional<HardwareCounterValues>{};
+
     for (const auto& pipeline_metrics : query_result.metrics) {
       // clang-format off
       auto pipeline_metrics_json = nlohmann::json{
@@ -437,9 +597,21 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
           {"optimization_duration", statement_metrics->optimization_duration.count()},
           {"lqp_translation_duration", statement_metrics->lqp_translation_duration.count()},
           {"plan_execution_duration", statement_metrics->plan_execution_duration.count()},
-          {"query_plan_cache_hit", statement_metrics->query_plan_cache_hit}
+          {"query_plan_cache_hit", statement_metrics->query_plan_cache_hit},
+          {"optimizer_rule_durations", nlohmann::json::object()}
         };
 
+        for (const auto& rule_metrics : statement_metrics->optimizer_rule_metrics) {
+          statement_metrics_json["optimizer_rule_durations"][rule_metrics.rule_name] = rule_metrics.duration.count();
+        }
+
+        if (statement_metrics->hardware_counters) {
+          const auto& statement_hardware_counters = *statement_metrics->hardware_counters;
+          statement_metrics_json["hardware_counters"] = hardware_counters_to_json(statement_hardware_counters);
+          if (!hardware_counters) hardware_counters.emplace();
+          *hardware_counters += statement_hardware_counters;
+        }
+
         pipeline_metrics_json["statements"].push_back(statement_metrics_json);
       }
       // clang-format on
@@ -447,11 +619,34 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
       all_pipeline_metrics_json.push_back(pipeline_metrics_json);
     }
 
-    nlohmann::json benchmark{{"name", name},
-                             {"iterations", query_result.num_iterations.load()},
-                             {"metrics", all_pipeline_metrics_json},
-                             {"avg_real_time_per_iteration", time_per_query},
-                             {"items_per_second", items_per_second}};
+    nlohmann::json benchmark{
+        {"name", name},
+        {"iterations", query_result.num_iterations.load()},
+        {"metrics", all_pipeline_metrics_json},
+        {"avg_real_time_per_iteration", time_per_query},
+        {"items_per_second", items_per_second},
+        {"latency_percentiles",
+         latency_percentiles_to_json({query_result.latencies.begin(), query_result.latencies.end()})}};
+
+    if (hardware_counters) {
+      benchmark["hardware_counters_per_iteration"] =
+          hardware_counters_to_json(*hardware_counters, query_result.num_iterations.load());
+    }
+
+    if (_config.cardinality_estimation_report) {
+      const auto& errors = query_result.cardinality_estimation_errors;
+      auto nodes_json = nlohmann::json::array();
+      for (const auto& error : errors) {
+        nodes_json.push_back({{"node_type", lqp_node_type_to_string.at(error.node_type)},
+                              {"description", error.node_description},
+                              {"estimated_row_count", error.estimated_row_count},
+                              {"actual_row_count", error.actual_row_count},
+                              {"q_error", error.q_error}});
+      }
+      benchmark["cardinality_estimation"] = {{"q_errors", q_errors_per_node_type_to_json(errors)},
+                                             {"nodes", nodes_json}};
+      all_cardinality_estimation_errors.insert(all_cardinality_estimation_errors.end(), errors.begin(), errors.end());
+    }
 
     if (_config.verify) {
       Assert(query_result.verification_passed, "Verification should have been performed");
@@ -467,12 +662,47 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     table_size += table_pair.second->estimate_memory_usage();
   }
 
+  // The latencies of the query runs issued by each simulated client (none in open-loop mode)
+  auto clients = nlohmann::json::array();
+  if (!_config.arrival_rate) {
+    for (auto client_id = size_t{0}; client_id < _client_latencies.size(); ++client_id) {
+      const auto& client_latencies = _client_latencies[client_id];
+      clients.push_back({{"client_id", client_id},
+                         {"iterations", client_latencies.size()},
+                         {"latency_percentiles",
+                          latency_percentiles_to_json({client_latencies.begin(), client_latencies.end()})}});
+    }
+  }
+
+  // The number of query runs that finished in each second of the benchmark
+  const auto throughput_interval = std::chrono::seconds{1};
+  const auto interval_count = static_cast<size_t>(_total_run_duration / throughput_interval) + 1;
+  auto queries_per_interval = std::vector<size_t>(interval_count);
+  for (const auto& completion_time : _query_completion_times) {
+    ++queries_per_interval[std::min(static_cast<size_t>(completion_time / throughput_interval), interval_count - 1)];
+  }
+
+  const auto total_run_seconds = std::chrono::duration<double>{_total_run_duration}.count();
+  nlohmann::json throughput{
+      {"interval", std::chrono::duration_cast<std::chrono::nanoseconds>(throughput_interval).count()},
+      {"queries_per_interval", queries_per_interval},
+      {"queries_per_second", static_cast<double>(_query_completion_times.size()) / total_run_seconds}};
+
   nlohmann::json summary{
       {"table_size_in_bytes", table_size},
-      {"total_run_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()}};
+      {"total_run_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()},
+      {"plan_caches",
+       {{"logical", cache_metrics_to_json(SQLLogicalPlanCache::get())},
+        {"physical", cache_metrics_to_json(SQLPhysicalPlanCache::get())}}}};
+
+  if (_config.cardinality_estimation_report) {
+    summary["cardinality_estimation_q_errors"] = q_errors_per_node_type_to_json(all_cardinality_estimation_errors);
+  }
 
   nlohmann::json report{{"context", _context},
                         {"benchmarks", benchmarks},
+                        {"clients", clients},
+                        {"throughput", throughput},
                         {"summary", summary},
                         {"table_generation", _table_generator->metrics}};
 
@@ -516,10 +746,14 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint>()->default_value("0")) // NOLINT
     ("clients", "Specify how many queries should run in parallel if the scheduler is active", cxxopts::value<uint>()->default_value("1")) // NOLINT
+    ("arrival_rate", "Issue queries in an open loop at this rate (queries per second) instead of by the clients. Requires PermutedQuerySet mode and the scheduler. 0 means closed loop", cxxopts::value<double>()->default_value("0")) // NOLINT
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("sort_on_load", "Sort tables by a column after loading them, given as table.column[,table.column]*", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("hardware_counters", "Count cycles, instructions, LLC misses, dTLB misses, and branch misses per operator with perf_event_open (Linux only)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("cardinality_estimation_report", "Report the estimated and actual row count of each LQP node and the q-errors of the estimates per query and node type", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -559,7 +793,10 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"using_scheduler", config.enable_scheduler},
       {"cores", config.cores},
       {"clients", config.clients},
+      {"arrival_rate", config.arrival_rate ? nlohmann::json(*config.arrival_rate) : nlohmann::json()},
       {"verify", config.verify},
+      {"hardware_counters", config.hardware_counters},
+      {"cardinality_estimation_report", config.cardinality_estimation_report},
       {"time_unit", "ns"},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
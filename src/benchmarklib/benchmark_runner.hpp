@@ -1,6 +1,7 @@
 #pragma once
 
 #include <json.hpp>
+#include <tbb/concurrent_vector.h>
 
 #include <atomic>
 #include <chrono>
@@ -65,6 +66,11 @@ class BenchmarkRunner {
   void _execute_query(const QueryID query_id, const std::shared_ptr<SQLPipeline>& pipeline,
                       const std::function<void()>& done_callback);
 
+  // Adds the latency of a query run that was issued at query_run_begin to the results of the query, of the issuing
+  // client (if the query was not issued in open-loop mode), and to the throughput timeline
+  void _record_query_run(const QueryID query_id, const std::optional<uint32_t> client_id,
+                         const std::chrono::steady_clock::time_point query_run_begin, SQLPipeline& pipeline);
+
   // If visualization is enabled, stores an executed plan
   void _store_plan(const QueryID query_id, SQLPipeline& pipeline);
 
@@ -97,6 +103,14 @@ class BenchmarkRunner {
 
   Duration _total_run_duration{};
 
+  std::chrono::steady_clock::time_point _benchmark_begin{};
+
+  // Latencies of the query runs issued by each simulated client. Its length is defined by the number of clients.
+  std::vector<tbb::concurrent_vector<Duration>> _client_latencies;
+
+  // Points in time (relative to _benchmark_begin) at which query runs finished, used to report the throughput over time
+  tbb::concurrent_vector<Duration> _query_completion_times;
+
   // If the query execution should be validated, this stores a pointer to the used SQLite instance
   std::unique_ptr<SQLiteWrapper> _sqlite_wrapper;
 };
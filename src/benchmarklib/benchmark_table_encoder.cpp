@@ -31,6 +31,8 @@ SegmentEncodingSpec get_segment_encoding_spec(const BaseEncodedSegment& base_enc
         return {base_encoded_segment.encoding_type(), VectorCompressionType::FixedSizeByteAligned};
       case CompressedVectorType::SimdBp128:
         return {base_encoded_segment.encoding_type(), VectorCompressionType::SimdBp128};
+      case CompressedVectorType::BitPacking:
+        return {base_encoded_segment.encoding_type(), VectorCompressionType::BitPacking};
     }
 
     Fail("GCC thinks this is reachable");
@@ -84,6 +86,43 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
   /**
    * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
    */
+  const auto chunk_encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(table_name, *table, encoding_config);
+
+  /**
+   * 2. Actually encode chunks
+   */
+  auto encoding_performed = std::atomic<bool>{false};
+  const auto column_data_types = table->column_data_types();
+
+  // Encode chunks in parallel, using `hardware_concurrency + 1` worker
+  // Not using JobTasks here because we want parallelism even if the scheduler is disabled.
+  auto next_chunk = std::atomic_uint{0};
+  auto threads = std::vector<std::thread>{};
+
+  for (auto thread_id = 0u;
+       thread_id < std::min(static_cast<uint>(table->chunk_count()), std::thread::hardware_concurrency() + 1);
+       ++thread_id) {
+    threads.emplace_back([&] {
+      while (true) {
+        auto my_chunk = next_chunk++;
+        if (my_chunk >= table->chunk_count()) return;
+
+        const auto& chunk = table->get_chunk(ChunkID{my_chunk});
+        if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
+          ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+          encoding_performed = true;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) thread.join();
+
+  return encoding_performed;
+}
+
+ChunkEncodingSpec BenchmarkTableEncoder::chunk_encoding_spec(const std::string& table_name, const Table& table,
+                                                             const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -92,10 +131,10 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
   ChunkEncodingSpec chunk_encoding_spec;
 
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     // Check if a column specific encoding was specified
     if (table_has_custom_encoding) {
-      const auto& column_name = table->column_name(column_id);
+      const auto& column_name = table.column_name(column_id);
       const auto& encoding_by_column_name = column_mapping_it->second;
       const auto& segment_encoding = encoding_by_column_name.find(column_name);
       if (segment_encoding != encoding_by_column_name.end()) {
@@ -106,7 +145,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
 
     // Check if a type specific encoding was specified
-    const auto& column_data_type = table->column_data_type(column_id);
+    const auto& column_data_type = table.column_data_type(column_id);
     const auto& encoding_by_data_type = type_mapping.find(column_data_type);
     if (encoding_by_data_type != type_mapping.end()) {
       // The column type has a specific encoding
@@ -119,7 +158,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
       chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
     } else {
-      std::cout << " - Column '" << table_name << "." << table->column_name(column_id) << "' of type ";
+      std::cout << " - Column '" << table_name << "." << table.column_name(column_id) << "' of type ";
       std::cout << data_type_to_string.left.at(column_data_type) << " cannot be encoded as ";
       std::cout << encoding_type_to_string.left.at(encoding_config.default_encoding_spec.encoding_type) << " and is ";
       std::cout << "left Unencoded." << std::endl;
@@ -127,37 +166,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
   }
 
-  /**
-   * 2. Actually encode chunks
-   */
-  auto encoding_performed = std::atomic<bool>{false};
-  const auto column_data_types = table->column_data_types();
-
-  // Encode chunks in parallel, using `hardware_concurrency + 1` worker
-  // Not using JobTasks here because we want parallelism even if the scheduler is disabled.
-  auto next_chunk = std::atomic_uint{0};
-  auto threads = std::vector<std::thread>{};
-
-  for (auto thread_id = 0u;
-       thread_id < std::min(static_cast<uint>(table->chunk_count()), std::thread::hardware_concurrency() + 1);
-       ++thread_id) {
-    threads.emplace_back([&] {
-      while (true) {
-        auto my_chunk = next_chunk++;
-        if (my_chunk >= table->chunk_count()) return;
-
-        const auto& chunk = table->get_chunk(ChunkID{my_chunk});
-        if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
-          ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
-          encoding_performed = true;
-        }
-      }
-    });
-  }
-
-  for (auto& thread : threads) thread.join();
-
-  return encoding_performed;
+  return chunk_encoding_spec;
 }
 
 }  // namespace opossum
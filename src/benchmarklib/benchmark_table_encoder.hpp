@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "storage/chunk_encoder.hpp"
+
 namespace opossum {
 
 class EncodingConfig;
@@ -15,6 +17,11 @@ class BenchmarkTableEncoder {
   //              false, if the @param table was already encoded as required by @param encoding_config
   static bool encode(const std::string& table_name, const std::shared_ptr<Table>& table,
                      const EncodingConfig& encoding_config);
+
+  // @return      the encoding of each column of @param table as requested by @param encoding_config. Only the column
+  //              definitions of the table are used, so the table may be empty.
+  static ChunkEncodingSpec chunk_encoding_spec(const std::string& table_name, const Table& table,
+                                               const EncodingConfig& encoding_config);
 };
 
 }  // namespace opossum
@@ -2,6 +2,9 @@
 
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "boost/algorithm/string.hpp"
 
@@ -130,10 +133,49 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Not caching tables as binary files" << std::endl;
   }
 
+  // Parse the columns to sort tables by, given as "table.column[,table.column]*"
+  auto sort_on_load = std::unordered_map<std::string, std::string>{};
+  const auto sort_on_load_str = json_config.value("sort_on_load", "");
+  if (!sort_on_load_str.empty()) {
+    auto table_columns = std::vector<std::string>{};
+    boost::algorithm::split(table_columns, sort_on_load_str, boost::is_any_of(","));
+    for (const auto& table_column : table_columns) {
+      const auto dot_position = table_column.find('.');
+      Assert(dot_position != std::string::npos && dot_position > 0 && dot_position + 1 < table_column.size(),
+             "Expected 'table.column' in sort_on_load, got '" + table_column + "'");
+      sort_on_load[table_column.substr(0, dot_position)] = table_column.substr(dot_position + 1);
+    }
+    std::cout << "- Sorting tables on load by '" << sort_on_load_str << "'" << std::endl;
+  }
+
+  // An arrival rate of 0 means that the simulated clients issue queries in a closed loop
+  auto arrival_rate = std::optional<double>{};
+  const auto arrival_rate_value = json_config.value("arrival_rate", 0.0);
+  if (arrival_rate_value > 0.0) {
+    if (benchmark_mode != BenchmarkMode::PermutedQuerySet || !enable_scheduler) {
+      throw std::runtime_error("'--arrival_rate' requires the 'PermutedQuerySet' mode and '--scheduler'");
+    }
+    arrival_rate = arrival_rate_value;
+    std::cout << "- Issuing queries in an open loop at " << arrival_rate_value << " queries per second" << std::endl;
+  } else {
+    std::cout << "- Issuing queries in a closed loop" << std::endl;
+  }
+
+  const auto hardware_counters = json_config.value("hardware_counters", false);
+  if (hardware_counters) {
+    std::cout << "- Counting hardware events per operator" << std::endl;
+  }
+
+  const auto cardinality_estimation_report = json_config.value("cardinality_estimation_report", false);
+  if (cardinality_estimation_report) {
+    std::cout << "- Reporting the q-errors of the cardinality estimates" << std::endl;
+  }
+
   return BenchmarkConfig{
       benchmark_mode, chunk_size,         *encoding_config, max_runs, timeout_duration, warmup_duration,
       use_mvcc,       output_file_path,   enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables};
+      verify,         cache_binary_tables, sort_on_load,    arrival_rate, hardware_counters,
+      cardinality_estimation_report};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -158,6 +200,10 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("sort_on_load", parse_result["sort_on_load"].as<std::string>());
+  json_config.emplace("arrival_rate", parse_result["arrival_rate"].as<double>());
+  json_config.emplace("hardware_counters", parse_result["hardware_counters"].as<bool>());
+  json_config.emplace("cardinality_estimation_report", parse_result["cardinality_estimation_report"].as<bool>());
 
   return json_config;
 }
@@ -87,13 +87,22 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
       std::cout << "from " << *table_info.binary_file_path << std::flush;
       table_info.table = ImportBinary::read_binary(*table_info.binary_file_path);
       table_info.loaded_from_binary = true;
+      // Binary files written without statistics are re-exported, so that the statistics need not be generated again
+      if (!table_info.table->table_statistics()) table_info.binary_file_out_of_date = true;
     } else {
       std::cout << "from " << *table_info.text_file_path << std::flush;
       const auto extension = table_info.text_file_path->extension();
       if (extension == ".tbl") {
         table_info.table = load_table(*table_info.text_file_path, _benchmark_config->chunk_size);
       } else if (extension == ".csv") {
-        table_info.table = CsvParser{}.parse(*table_info.text_file_path, std::nullopt, _benchmark_config->chunk_size);
+        // Encode the chunks while parsing, so that the uncompressed table never needs to be in memory as a whole
+        const auto meta_file_path = table_info.text_file_path->string() + CsvMeta::META_FILE_EXTENSION;
+        const auto empty_table =
+            CsvParser{}.create_table_from_meta_file(meta_file_path, _benchmark_config->chunk_size);
+        const auto chunk_encoding_spec =
+            BenchmarkTableEncoder::chunk_encoding_spec(table_name, *empty_table, _benchmark_config->encoding_config);
+        table_info.table = CsvParser{}.parse(*table_info.text_file_path, std::nullopt, _benchmark_config->chunk_size,
+                                             chunk_encoding_spec);
       } else {
         Fail("Unknown textual file format. This should have been caught earlier.");
       }
@@ -0,0 +1,28 @@
+#include "latency_percentiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace opossum {
+
+nlohmann::json latency_percentiles_to_json(std::vector<Duration> latencies) {
+  auto percentiles_json = nlohmann::json::object();
+  if (latencies.empty()) return percentiles_json;
+
+  std::sort(latencies.begin(), latencies.end());
+
+  for (const auto& [percentile_name, percentile] : {std::pair<std::string, double>{"p50", 50.0},
+                                                    {"p95", 95.0},
+                                                    {"p99", 99.0},
+                                                    {"p99.9", 99.9}}) {
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(latencies.size())));
+    const auto& latency = latencies[std::max(rank, size_t{1}) - 1];
+    percentiles_json[percentile_name] = std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+  }
+
+  return percentiles_json;
+}
+
+}  // namespace opossum
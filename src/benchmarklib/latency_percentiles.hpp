@@ -0,0 +1,15 @@
+#pragma once
+
+#include <json.hpp>
+
+#include <vector>
+
+#include "benchmark_config.hpp"
+
+namespace opossum {
+
+// Returns the nearest-rank p50, p95, p99, and p99.9 of the latencies in nanoseconds, or an empty object if there are
+// no latencies
+nlohmann::json latency_percentiles_to_json(std::vector<Duration> latencies);
+
+}  // namespace opossum
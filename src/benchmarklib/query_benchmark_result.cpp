@@ -2,13 +2,18 @@
 
 namespace opossum {
 
-QueryBenchmarkResult::QueryBenchmarkResult() { metrics.reserve(1'000'000); }
+QueryBenchmarkResult::QueryBenchmarkResult() {
+  metrics.reserve(1'000'000);
+  latencies.reserve(1'000'000);
+}
 
 QueryBenchmarkResult::QueryBenchmarkResult(QueryBenchmarkResult&& other) noexcept {
   num_iterations.store(other.num_iterations);
   duration_ns.store(other.duration_ns);
   metrics = other.metrics;
+  latencies = other.latencies;
   verification_passed = other.verification_passed;
+  cardinality_estimation_errors = other.cardinality_estimation_errors;
 }
 
 }  // namespace opossum
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <vector>
+
 #include "sql/sql_pipeline.hpp"
+#include "statistics/cardinality_estimation_errors.hpp"
 
 #include "benchmark_config.hpp"
 
@@ -21,7 +24,15 @@ struct QueryBenchmarkResult {
 
   tbb::concurrent_vector<SQLPipelineMetrics> metrics;
 
+  // Latency of each iteration, measured from the time the query was issued to the time it finished. In open-loop mode,
+  // the query is issued at its planned arrival time, so the latency includes the time it was queued.
+  tbb::concurrent_vector<Duration> latencies;
+
   std::optional<bool> verification_passed;
+
+  // Estimated and actual row counts of the LQP nodes of all statements, taken from the first iteration only (if
+  // BenchmarkConfig::cardinality_estimation_report is set)
+  std::vector<CardinalityEstimationError> cardinality_estimation_errors;
 };
 
 }  // namespace opossum
@@ -0,0 +1,68 @@
+#include "abstract_tpcc_procedure.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractTpccProcedure::AbstractTpccProcedure(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                                             const size_t home_warehouse_id)
+    : _random_generator(random_generator), _warehouse_count(warehouse_count), _home_warehouse_id(home_warehouse_id) {
+  Assert(home_warehouse_id < warehouse_count, "Home warehouse does not exist");
+}
+
+bool AbstractTpccProcedure::execute() {
+  _transaction_context = TransactionManager::get().new_transaction_context();
+
+  if (!_on_execute()) {
+    DebugAssert(_transaction_context->aborted(), "A failed statement should have rolled back the transaction");
+    return false;
+  }
+
+  // The transaction was rolled back on purpose
+  if (_transaction_context->aborted()) return true;
+
+  return _transaction_context->commit();
+}
+
+std::optional<std::shared_ptr<const Table>> AbstractTpccProcedure::_execute_sql(const std::string& sql) {
+  // The statements of a transaction type only differ in their literals, so they can share their plans
+  auto pipeline = SQLPipelineBuilder{sql}
+                      .with_transaction_context(_transaction_context)
+                      .with_parameterized_plan_caching()
+                      .create_pipeline();
+
+  const auto& result_tables = pipeline.get_result_tables();
+  if (pipeline.failed_pipeline_statement()) return std::nullopt;
+
+  return result_tables.back();
+}
+
+void AbstractTpccProcedure::_rollback() { _transaction_context->rollback(); }
+
+size_t AbstractTpccProcedure::_random_remote_warehouse_id() {
+  if (_warehouse_count == 1) return _home_warehouse_id;
+
+  // Draw from all other warehouses, skipping the home warehouse
+  const auto warehouse_id = _random_generator.random_number(0, _warehouse_count - 2);
+  return warehouse_id >= _home_warehouse_id ? warehouse_id + 1 : warehouse_id;
+}
+
+std::optional<int32_t> AbstractTpccProcedure::_select_customer_id_by_last_name(const size_t warehouse_id,
+                                                                              const size_t district_id,
+                                                                              const std::string& last_name) {
+  const auto customers = _execute_sql("SELECT C_ID FROM CUSTOMER WHERE C_W_ID = " + std::to_string(warehouse_id) +
+                                      " AND C_D_ID = " + std::to_string(district_id) + " AND C_LAST = '" + last_name +
+                                      "' ORDER BY C_FIRST");
+  if (!customers) return std::nullopt;
+
+  // The generated names cover the IDs 0 to 999, so each of them belongs to at least one customer per district
+  const auto customer_count = (*customers)->row_count();
+  Assert(customer_count > 0, "No customer with the last name " + last_name);
+  return (*customers)->get_value<int32_t>(ColumnID{0}, (customer_count - 1) / 2);
+}
+
+}  // namespace opossum
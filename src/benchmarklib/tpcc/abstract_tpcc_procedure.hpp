@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "tpcc_random_generator.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+/**
+ * Base class of the five TPC-C transactions (TPC-C v5.11.0, Clause 2). The input data of a transaction is drawn in the
+ * constructor of the subclass, execute() runs its statements in a TransactionContext of its own. The IDs of
+ * warehouses, districts, customers, orders, and items start at 0, as they do in the TpccTableGenerator.
+ */
+class AbstractTpccProcedure {
+ public:
+  AbstractTpccProcedure(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                        const size_t home_warehouse_id);
+  virtual ~AbstractTpccProcedure() = default;
+
+  // Runs the transaction. Returns false if it was aborted because one of its statements conflicted with a concurrent
+  // transaction. In that case, its changes were rolled back. Transactions that are rolled back as part of their
+  // specification (1% of the New-Order transactions) count as successful.
+  bool execute();
+
+ protected:
+  // Executes the statements of the transaction and returns false if one of them failed
+  virtual bool _on_execute() = 0;
+
+  // Executes a statement within the transaction. Returns nullopt if the statement failed, which rolled back the
+  // transaction.
+  std::optional<std::shared_ptr<const Table>> _execute_sql(const std::string& sql);
+
+  // Rolls back the transaction on purpose, i.e., without it counting as aborted
+  void _rollback();
+
+  // Returns a random warehouse other than the home warehouse, or the home warehouse if there is only one
+  size_t _random_remote_warehouse_id();
+
+  // Payment and Order-Status select their customer by last name 60% of the time. The name identifies the customer in
+  // the middle of those with that name, ordered by C_FIRST (Clause 2.5.2.2). Returns nullopt if the statement failed.
+  std::optional<int32_t> _select_customer_id_by_last_name(const size_t warehouse_id, const size_t district_id,
+                                                          const std::string& last_name);
+
+  TpccRandomGenerator& _random_generator;
+  const size_t _warehouse_count;
+  const size_t _home_warehouse_id;
+
+ private:
+  std::shared_ptr<TransactionContext> _transaction_context;
+};
+
+}  // namespace opossum
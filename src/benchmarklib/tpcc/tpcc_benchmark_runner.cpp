@@ -0,0 +1,319 @@
+#include "tpcc_benchmark_runner.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <utility>
+
+#include "latency_percentiles.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpcc_delivery.hpp"
+#include "tpcc_new_order.hpp"
+#include "tpcc_order_status.hpp"
+#include "tpcc_payment.hpp"
+#include "tpcc_stock_level.hpp"
+#include "tpcc_table_generator.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+TpccBenchmarkRunner::TpccBenchmarkRunner(const BenchmarkConfig& config, const size_t warehouse_count,
+                                         const nlohmann::json& context,
+                                         std::optional<TpccAnalyticalWorkload> analytical_workload)
+    : _config(config),
+      _warehouse_count(warehouse_count),
+      _context(context),
+      _analytical_workload(std::move(analytical_workload)) {
+  Assert(warehouse_count > 0, "TPC-C needs at least one warehouse");
+  Assert(config.clients > 0, "TPC-C needs at least one terminal");
+  if (_analytical_workload) {
+    Assert(_analytical_workload->client_count > 0, "The analytical workload needs at least one client");
+    Assert(_analytical_workload->query_generator->selected_query_count() > 0, "No analytical queries selected");
+  }
+
+  // The terminals run in threads of their own. The scheduler additionally parallelizes the operators of a statement.
+  if (config.enable_scheduler) {
+    Topology::use_default_topology(config.cores);
+    std::cout << "- Multi-threaded Topology:" << std::endl;
+    Topology::get().print(std::cout, 2);
+
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  }
+}
+
+TpccBenchmarkRunner::~TpccBenchmarkRunner() {
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->finish();
+  }
+}
+
+void TpccBenchmarkRunner::run() {
+  std::cout << "- Generating TPC-C tables for " << _warehouse_count << " warehouse(s)" << std::endl;
+  Timer timer;
+  auto tables = TpccTableGenerator{_config.chunk_size, _warehouse_count, _config.encoding_config}.generate_all_tables();
+  for (auto& [table_name, table] : tables) {
+    StorageManager::get().add_table(table_name, table);
+  }
+  std::cout << "- Tables generated (" << timer.lap_formatted() << ")" << std::endl;
+
+  if (_analytical_workload) {
+    _analytical_workload->table_generator->generate_and_store();
+
+    const auto preparation_sql = _analytical_workload->query_generator->get_preparation_queries();
+    if (!preparation_sql.empty()) {
+      std::cout << "- Preparing analytical queries" << std::endl;
+      SQLPipelineBuilder{preparation_sql}.create_pipeline().get_result_table();
+    }
+  }
+
+  std::cout << "- Running TPC-C with " << _config.clients << " terminal(s)";
+  if (_analytical_workload) std::cout << " and " << _analytical_workload->client_count << " analytical client(s)";
+  std::cout << std::endl;
+
+  // Results are read with Table::get_value(), which is fine for the few rows of a TPC-C statement
+  const auto performance_warning_disabler = PerformanceWarningDisabler{};
+
+  auto terminal_results = std::vector<TerminalResult>(_config.clients);
+  auto terminals = std::vector<std::thread>{};
+  terminals.reserve(_config.clients);
+
+  const auto begin = std::chrono::steady_clock::now();
+  const auto end = begin + _config.max_duration;
+  for (auto terminal_id = size_t{0}; terminal_id < _config.clients; ++terminal_id) {
+    terminals.emplace_back([&, terminal_id]() { _run_terminal(terminal_id, end, terminal_results[terminal_id]); });
+  }
+
+  const auto analytical_client_count = _analytical_workload ? _analytical_workload->client_count : size_t{0};
+  auto analytical_client_results = std::vector<AnalyticalClientResult>(analytical_client_count);
+  auto analytical_clients = std::vector<std::thread>{};
+  analytical_clients.reserve(analytical_client_count);
+  for (auto client_id = size_t{0}; client_id < analytical_client_count; ++client_id) {
+    analytical_clients.emplace_back(
+        [&, client_id]() { _run_analytical_client(client_id, end, analytical_client_results[client_id]); });
+  }
+
+  for (auto& terminal : terminals) {
+    terminal.join();
+  }
+  // Analytical queries might take much longer than transactions, so the run is over once the terminals are done
+  _total_run_duration = std::chrono::steady_clock::now() - begin;
+  for (auto& analytical_client : analytical_clients) {
+    analytical_client.join();
+  }
+
+  for (const auto& terminal_result : terminal_results) {
+    for (auto type_idx = size_t{0}; type_idx < TPCC_TRANSACTION_TYPE_COUNT; ++type_idx) {
+      auto& result = _result[type_idx];
+      result.committed_count += terminal_result[type_idx].committed_count;
+      result.aborted_count += terminal_result[type_idx].aborted_count;
+      result.latencies.insert(result.latencies.end(), terminal_result[type_idx].latencies.begin(),
+                              terminal_result[type_idx].latencies.end());
+    }
+  }
+
+  for (auto type_idx = size_t{0}; type_idx < TPCC_TRANSACTION_TYPE_COUNT; ++type_idx) {
+    const auto& result = _result[type_idx];
+    std::cout << "  -> " << transaction_type_name(static_cast<TpccTransactionType>(type_idx)) << ": "
+              << result.committed_count << " committed, " << result.aborted_count << " aborted" << std::endl;
+  }
+
+  const auto minutes = std::chrono::duration<double, std::ratio<60>>{_total_run_duration}.count();
+  const auto tpmc = static_cast<double>(_result[static_cast<size_t>(TpccTransactionType::NewOrder)].committed_count) /
+                    minutes;
+  std::cout << "- " << tpmc << " tpmC" << std::endl;
+
+  if (_analytical_workload) {
+    const auto& selected_queries = _analytical_workload->query_generator->selected_queries();
+    _analytical_result.resize(selected_queries.size());
+    for (const auto& client_result : analytical_client_results) {
+      for (auto query_idx = size_t{0}; query_idx < selected_queries.size(); ++query_idx) {
+        auto& result = _analytical_result[query_idx];
+        result.run_count += client_result[query_idx].run_count;
+        result.latencies.insert(result.latencies.end(), client_result[query_idx].latencies.begin(),
+                                client_result[query_idx].latencies.end());
+      }
+    }
+
+    for (auto query_idx = size_t{0}; query_idx < selected_queries.size(); ++query_idx) {
+      std::cout << "  -> " << _analytical_workload->query_generator->query_name(selected_queries[query_idx]) << ": "
+                << _analytical_result[query_idx].run_count << " run(s)" << std::endl;
+    }
+  }
+
+  if (_config.output_file_path) {
+    std::ofstream output_file(*_config.output_file_path);
+    _create_report(output_file);
+  } else {
+    _create_report(std::cout);
+  }
+}
+
+std::string TpccBenchmarkRunner::transaction_type_name(const TpccTransactionType transaction_type) {
+  switch (transaction_type) {
+    case TpccTransactionType::NewOrder:
+      return "New-Order";
+    case TpccTransactionType::Payment:
+      return "Payment";
+    case TpccTransactionType::OrderStatus:
+      return "Order-Status";
+    case TpccTransactionType::Delivery:
+      return "Delivery";
+    case TpccTransactionType::StockLevel:
+      return "Stock-Level";
+  }
+  Fail("Unknown transaction type");
+}
+
+void TpccBenchmarkRunner::_run_terminal(const size_t terminal_id, const std::chrono::steady_clock::time_point end,
+                                        TerminalResult& terminal_result) const {
+  // Each terminal draws its own input data, so that the generator does not have to be synchronized
+  auto random_generator = TpccRandomGenerator{static_cast<uint32_t>(42 + terminal_id)};
+  const auto home_warehouse_id = terminal_id % _warehouse_count;
+
+  while (std::chrono::steady_clock::now() < end) {
+    // The mix of Clause 5.2.3
+    const auto draw = random_generator.random_number(1, 100);
+    auto transaction_type = TpccTransactionType::NewOrder;
+    if (draw > 45 && draw <= 88) {
+      transaction_type = TpccTransactionType::Payment;
+    } else if (draw > 88 && draw <= 92) {
+      transaction_type = TpccTransactionType::OrderStatus;
+    } else if (draw > 92 && draw <= 96) {
+      transaction_type = TpccTransactionType::Delivery;
+    } else if (draw > 96) {
+      transaction_type = TpccTransactionType::StockLevel;
+    }
+
+    const auto procedure = _create_procedure(transaction_type, random_generator, _warehouse_count, home_warehouse_id);
+
+    const auto transaction_begin = std::chrono::steady_clock::now();
+    const auto committed = procedure->execute();
+    const auto latency = std::chrono::steady_clock::now() - transaction_begin;
+
+    // Transactions that were still running when the time was up do not count
+    if (std::chrono::steady_clock::now() >= end) break;
+
+    auto& result = terminal_result[static_cast<size_t>(transaction_type)];
+    if (committed) {
+      ++result.committed_count;
+      result.latencies.emplace_back(std::chrono::duration_cast<Duration>(latency));
+    } else {
+      ++result.aborted_count;
+    }
+  }
+}
+
+void TpccBenchmarkRunner::_run_analytical_client(const size_t client_id,
+                                                 const std::chrono::steady_clock::time_point end,
+                                                 AnalyticalClientResult& client_result) const {
+  auto& query_generator = *_analytical_workload->query_generator;
+  const auto& selected_queries = query_generator.selected_queries();
+  client_result.resize(selected_queries.size());
+
+  // Each client runs the queries in an order of its own, so that the clients do not run the same query at a time
+  auto query_indices = std::vector<size_t>(selected_queries.size());
+  std::iota(query_indices.begin(), query_indices.end(), size_t{0});
+  auto random_engine = std::minstd_rand{static_cast<uint32_t>(42 + client_id)};
+
+  while (true) {
+    std::shuffle(query_indices.begin(), query_indices.end(), random_engine);
+
+    for (const auto query_idx : query_indices) {
+      if (std::chrono::steady_clock::now() >= end) return;
+
+      // The queries run in transactions like the TPC-C statements, so that they take part in MVCC
+      auto pipeline = SQLPipelineBuilder{query_generator.build_query(selected_queries[query_idx])}
+                          .with_mvcc(UseMvcc::Yes)
+                          .with_priority(_analytical_workload->priority)
+                          .create_pipeline();
+
+      const auto query_begin = std::chrono::steady_clock::now();
+      pipeline.get_result_tables();
+      const auto latency = std::chrono::steady_clock::now() - query_begin;
+
+      // Queries that were still running when the time was up do not count
+      if (std::chrono::steady_clock::now() >= end) return;
+
+      auto& result = client_result[query_idx];
+      ++result.run_count;
+      result.latencies.emplace_back(std::chrono::duration_cast<Duration>(latency));
+    }
+  }
+}
+
+std::unique_ptr<AbstractTpccProcedure> TpccBenchmarkRunner::_create_procedure(
+    const TpccTransactionType transaction_type, TpccRandomGenerator& random_generator, const size_t warehouse_count,
+    const size_t home_warehouse_id) {
+  switch (transaction_type) {
+    case TpccTransactionType::NewOrder:
+      return std::make_unique<TpccNewOrder>(random_generator, warehouse_count, home_warehouse_id);
+    case TpccTransactionType::Payment:
+      return std::make_unique<TpccPayment>(random_generator, warehouse_count, home_warehouse_id);
+    case TpccTransactionType::OrderStatus:
+      return std::make_unique<TpccOrderStatus>(random_generator, warehouse_count, home_warehouse_id);
+    case TpccTransactionType::Delivery:
+      return std::make_unique<TpccDelivery>(random_generator, warehouse_count, home_warehouse_id);
+    case TpccTransactionType::StockLevel:
+      return std::make_unique<TpccStockLevel>(random_generator, warehouse_count, home_warehouse_id);
+  }
+  Fail("Unknown transaction type");
+}
+
+void TpccBenchmarkRunner::_create_report(std::ostream& stream) const {
+  auto transactions = nlohmann::json::array();
+
+  for (auto type_idx = size_t{0}; type_idx < TPCC_TRANSACTION_TYPE_COUNT; ++type_idx) {
+    const auto& result = _result[type_idx];
+    const auto attempt_count = result.committed_count + result.aborted_count;
+    const auto abort_rate =
+        attempt_count > 0 ? static_cast<double>(result.aborted_count) / static_cast<double>(attempt_count) : 0.0;
+
+    transactions.push_back({{"name", transaction_type_name(static_cast<TpccTransactionType>(type_idx))},
+                            {"committed", result.committed_count},
+                            {"aborted", result.aborted_count},
+                            {"abort_rate", abort_rate},
+                            {"latency_percentiles", latency_percentiles_to_json(result.latencies)}});
+  }
+
+  const auto minutes = std::chrono::duration<double, std::ratio<60>>{_total_run_duration}.count();
+  const auto new_order_count = _result[static_cast<size_t>(TpccTransactionType::NewOrder)].committed_count;
+
+  nlohmann::json summary{
+      {"warehouses", _warehouse_count},
+      {"tpmC", static_cast<double>(new_order_count) / minutes},
+      {"total_run_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()}};
+
+  nlohmann::json report{{"context", _context}, {"transactions", transactions}, {"summary", summary}};
+
+  if (_analytical_workload) {
+    auto analytical_queries = nlohmann::json::array();
+
+    const auto& query_generator = *_analytical_workload->query_generator;
+    const auto& selected_queries = query_generator.selected_queries();
+    for (auto query_idx = size_t{0}; query_idx < selected_queries.size(); ++query_idx) {
+      const auto& result = _analytical_result[query_idx];
+      analytical_queries.push_back({{"name", query_generator.query_name(selected_queries[query_idx])},
+                                    {"runs", result.run_count},
+                                    {"latency_percentiles", latency_percentiles_to_json(result.latencies)}});
+    }
+
+    report["analytical_queries"] = analytical_queries;
+    report["summary"]["analytical_clients"] = _analytical_workload->client_count;
+    report["table_generation"] = _analytical_workload->table_generator->metrics;
+  }
+
+  stream << std::setw(2) << report << std::endl;
+}
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <json.hpp>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "abstract_query_generator.hpp"
+#include "abstract_table_generator.hpp"
+#include "abstract_tpcc_procedure.hpp"
+#include "benchmark_config.hpp"
+
+namespace opossum {
+
+enum class TpccTransactionType { NewOrder, Payment, OrderStatus, Delivery, StockLevel };
+
+constexpr auto TPCC_TRANSACTION_TYPE_COUNT = size_t{5};
+
+// Analytical queries that run alongside the TPC-C terminals, see TpccBenchmarkRunner
+struct TpccAnalyticalWorkload {
+  // Generates the tables of the queries, which are stored next to the TPC-C tables
+  std::unique_ptr<AbstractTableGenerator> table_generator;
+  std::unique_ptr<AbstractQueryGenerator> query_generator;
+  size_t client_count{1};
+  // The priority of the queries' tasks, e.g., to check whether the transactions benefit from preferring them
+  SchedulePriority priority{SchedulePriority::Default};
+};
+
+/**
+ * Runs the TPC-C transactions on the tables of the TpccTableGenerator. Each of the BenchmarkConfig::clients simulates
+ * a terminal in a thread of its own that issues one transaction after the other, drawn from the mix of Clause 5.2.3
+ * (45% New-Order, 43% Payment, and 4% each of Order-Status, Delivery, and Stock-Level). Unlike specified, there are no
+ * keying and think times. Terminals are assigned to the warehouses round-robin. Aborted transactions are not retried.
+ *
+ * The report contains the tpmC (committed New-Order transactions per minute), and the abort rate and the latency
+ * percentiles of each transaction type.
+ *
+ * With a TpccAnalyticalWorkload (similar to the CH-benCHmark), analytical clients run at the same time as the
+ * terminals. Each of them issues the selected queries of the workload's query generator one after the other, in a
+ * random order per pass, within a transaction of its own. The transactions and queries thus compete for the cores, the
+ * scheduler, and the TransactionManager, so that the report shows how they slow each other down. In addition to the
+ * TPC-C results, it then contains the number of runs and the latency percentiles of each query. Unlike in the
+ * CH-benCHmark, the queries run on the tables of the workload's table generator (e.g., TPC-H) instead of on the TPC-C
+ * tables.
+ */
+class TpccBenchmarkRunner {
+ public:
+  TpccBenchmarkRunner(const BenchmarkConfig& config, const size_t warehouse_count, const nlohmann::json& context,
+                      std::optional<TpccAnalyticalWorkload> analytical_workload = std::nullopt);
+  ~TpccBenchmarkRunner();
+
+  void run();
+
+  static std::string transaction_type_name(const TpccTransactionType transaction_type);
+
+ private:
+  // The results of one transaction type on one terminal. They are merged after the run.
+  struct TransactionTypeResult {
+    size_t committed_count{0};
+    size_t aborted_count{0};
+    std::vector<Duration> latencies;
+  };
+
+  using TerminalResult = std::array<TransactionTypeResult, TPCC_TRANSACTION_TYPE_COUNT>;
+
+  // The results of one analytical query on one analytical client, indexed like the selected queries
+  struct QueryResult {
+    size_t run_count{0};
+    std::vector<Duration> latencies;
+  };
+
+  using AnalyticalClientResult = std::vector<QueryResult>;
+
+  // Issues transactions until the time is up
+  void _run_terminal(const size_t terminal_id, const std::chrono::steady_clock::time_point end,
+                     TerminalResult& terminal_result) const;
+
+  // Issues analytical queries until the time is up
+  void _run_analytical_client(const size_t client_id, const std::chrono::steady_clock::time_point end,
+                              AnalyticalClientResult& client_result) const;
+
+  static std::unique_ptr<AbstractTpccProcedure> _create_procedure(const TpccTransactionType transaction_type,
+                                                                  TpccRandomGenerator& random_generator,
+                                                                  const size_t warehouse_count,
+                                                                  const size_t home_warehouse_id);
+
+  void _create_report(std::ostream& stream) const;
+
+  const BenchmarkConfig _config;
+  const size_t _warehouse_count;
+  nlohmann::json _context;
+  std::optional<TpccAnalyticalWorkload> _analytical_workload;
+
+  TerminalResult _result;
+  AnalyticalClientResult _analytical_result;
+  Duration _total_run_duration{};
+};
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include "tpcc_delivery.hpp"
+
+#include <ctime>
+#include <string>
+
+#include "constants.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TpccDelivery::TpccDelivery(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                           const size_t home_warehouse_id)
+    : AbstractTpccProcedure(random_generator, warehouse_count, home_warehouse_id),
+      _carrier_id(random_generator.random_number(MIN_CARRIER_ID, MAX_CARRIER_ID)) {}
+
+bool TpccDelivery::_on_execute() {
+  const auto warehouse_id = std::to_string(_home_warehouse_id);
+  const auto delivery_date = std::to_string(std::time(nullptr));
+
+  for (auto district_idx = size_t{0}; district_idx < NUM_DISTRICTS_PER_WAREHOUSE; ++district_idx) {
+    const auto district_id = std::to_string(district_idx);
+
+    const auto new_order = _execute_sql("SELECT NO_O_ID FROM NEW_ORDER WHERE NO_W_ID = " + warehouse_id +
+                                        " AND NO_D_ID = " + district_id + " ORDER BY NO_O_ID LIMIT 1");
+    if (!new_order) return false;
+
+    // Districts without undelivered orders are skipped (Clause 2.7.4.2)
+    if ((*new_order)->row_count() == 0) continue;
+    const auto order_id = std::to_string((*new_order)->get_value<int32_t>(ColumnID{0}, 0));
+
+    if (!_execute_sql("DELETE FROM NEW_ORDER WHERE NO_W_ID = " + warehouse_id + " AND NO_D_ID = " + district_id +
+                      " AND NO_O_ID = " + order_id)) {
+      return false;
+    }
+
+    const auto order_predicate =
+        " WHERE O_W_ID = " + warehouse_id + " AND O_D_ID = " + district_id + " AND O_ID = " + order_id;
+    const auto order = _execute_sql("SELECT O_C_ID FROM \"ORDER\"" + order_predicate);
+    if (!order) return false;
+    if ((*order)->row_count() == 0) continue;
+    const auto customer_id = std::to_string((*order)->get_value<int32_t>(ColumnID{0}, 0));
+
+    if (!_execute_sql("UPDATE \"ORDER\" SET O_CARRIER_ID = " + std::to_string(_carrier_id) + order_predicate)) {
+      return false;
+    }
+
+    const auto order_line_predicate =
+        " WHERE OL_W_ID = " + warehouse_id + " AND OL_D_ID = " + district_id + " AND OL_O_ID = " + order_id;
+    if (!_execute_sql("UPDATE ORDER_LINE SET OL_DELIVERY_D = " + delivery_date + order_line_predicate)) return false;
+
+    const auto order_lines = _execute_sql("SELECT OL_AMOUNT FROM ORDER_LINE" + order_line_predicate);
+    if (!order_lines) return false;
+
+    auto total_amount = 0.f;
+    for (auto row_idx = size_t{0}; row_idx < (*order_lines)->row_count(); ++row_idx) {
+      total_amount += (*order_lines)->get_value<float>(ColumnID{0}, row_idx);
+    }
+
+    if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE + " + std::to_string(total_amount) +
+                      ", C_DELIVERY_CNT = C_DELIVERY_CNT + 1 WHERE C_W_ID = " + warehouse_id +
+                      " AND C_D_ID = " + district_id + " AND C_ID = " + customer_id)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
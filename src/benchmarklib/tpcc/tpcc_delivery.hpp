@@ -0,0 +1,22 @@
+#pragma once
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Delivery transaction (Clause 2.7): Delivers the oldest undelivered order of each district of the home warehouse,
+ * i.e., removes it from NEW_ORDER, sets its carrier and the delivery date of its lines, and charges the customer.
+ * Unlike specified, it is not queued for deferred execution, but executed like the other transactions.
+ */
+class TpccDelivery : public AbstractTpccProcedure {
+ public:
+  TpccDelivery(TpccRandomGenerator& random_generator, const size_t warehouse_count, const size_t home_warehouse_id);
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _carrier_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include "tpcc_new_order.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "constants.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TpccNewOrder::TpccNewOrder(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                           const size_t home_warehouse_id)
+    : AbstractTpccProcedure(random_generator, warehouse_count, home_warehouse_id),
+      _district_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _customer_id(random_generator.nurand(1023, 1, NUM_CUSTOMERS_PER_DISTRICT) - 1) {
+  const auto order_line_count = random_generator.random_number(MIN_ORDER_LINE_COUNT, MAX_ORDER_LINE_COUNT);
+  const auto rollback = random_generator.random_number(1, 100) == 1;
+
+  _order_lines.reserve(order_line_count);
+  for (auto order_line_idx = size_t{0}; order_line_idx < order_line_count; ++order_line_idx) {
+    auto order_line = OrderLine{};
+
+    // The last item of a rolled back order is an unused item number
+    const auto is_unused_item = rollback && order_line_idx + 1 == order_line_count;
+    order_line.item_id = is_unused_item ? NUM_ITEMS : random_generator.nurand(8191, 1, NUM_ITEMS) - 1;
+
+    // 1% of the items are supplied by a remote warehouse
+    order_line.supply_warehouse_id =
+        random_generator.random_number(1, 100) == 1 ? _random_remote_warehouse_id() : home_warehouse_id;
+    order_line.quantity = static_cast<int32_t>(random_generator.random_number(1, MAX_ORDER_LINE_QUANTITY));
+
+    _order_lines.emplace_back(order_line);
+  }
+}
+
+bool TpccNewOrder::_on_execute() {
+  const auto warehouse_id = std::to_string(_home_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+  const auto customer_id = std::to_string(_customer_id);
+  const auto entry_date = std::to_string(std::time(nullptr));
+
+  const auto warehouse = _execute_sql("SELECT W_TAX FROM WAREHOUSE WHERE W_ID = " + warehouse_id);
+  if (!warehouse) return false;
+
+  // Reserve the next order ID of the district. Concurrent New-Orders of the same district conflict on this update.
+  const auto district = _execute_sql("SELECT D_TAX, D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + warehouse_id +
+                                     " AND D_ID = " + district_id);
+  if (!district) return false;
+  const auto order_id = (*district)->get_value<int32_t>(ColumnID{1}, 0);
+
+  if (!_execute_sql("UPDATE DISTRICT SET D_NEXT_O_ID = " + std::to_string(order_id + 1) + " WHERE D_W_ID = " +
+                    warehouse_id + " AND D_ID = " + district_id)) {
+    return false;
+  }
+
+  const auto customer = _execute_sql("SELECT C_DISCOUNT, C_LAST, C_CREDIT FROM CUSTOMER WHERE C_W_ID = " +
+                                     warehouse_id + " AND C_D_ID = " + district_id + " AND C_ID = " + customer_id);
+  if (!customer) return false;
+
+  const auto all_local = std::all_of(_order_lines.begin(), _order_lines.end(), [&](const auto& order_line) {
+    return order_line.supply_warehouse_id == _home_warehouse_id;
+  });
+
+  // O_CARRIER_ID is -1 (i.e., NULL) until the order is delivered, as in the TpccTableGenerator
+  if (!_execute_sql("INSERT INTO \"ORDER\" VALUES (" + std::to_string(order_id) + ", " + district_id + ", " +
+                    warehouse_id + ", " + customer_id + ", " + entry_date + ", -1, " +
+                    std::to_string(_order_lines.size()) + ", " + std::to_string(all_local ? 1 : 0) + ")")) {
+    return false;
+  }
+
+  if (!_execute_sql("INSERT INTO NEW_ORDER VALUES (" + std::to_string(order_id) + ", " + district_id + ", " +
+                    warehouse_id + ")")) {
+    return false;
+  }
+
+  // The stock keeps one S_DIST column per district, S_DIST_01 to S_DIST_10
+  auto district_info_column = std::stringstream{};
+  district_info_column << "S_DIST_" << std::setw(2) << std::setfill('0') << (_district_id + 1);
+
+  for (auto order_line_idx = size_t{0}; order_line_idx < _order_lines.size(); ++order_line_idx) {
+    const auto& order_line = _order_lines[order_line_idx];
+    const auto item_id = std::to_string(order_line.item_id);
+    const auto supply_warehouse_id = std::to_string(order_line.supply_warehouse_id);
+
+    const auto item = _execute_sql("SELECT I_PRICE FROM ITEM WHERE I_ID = " + item_id);
+    if (!item) return false;
+
+    // An unused item number rolls back the whole order (Clause 2.4.2.3)
+    if ((*item)->row_count() == 0) {
+      _rollback();
+      return true;
+    }
+    const auto price = (*item)->get_value<float>(ColumnID{0}, 0);
+
+    const auto stock = _execute_sql("SELECT S_QUANTITY, " + district_info_column.str() +
+                                    " FROM STOCK WHERE S_I_ID = " + item_id + " AND S_W_ID = " + supply_warehouse_id);
+    if (!stock) return false;
+    const auto stock_quantity = (*stock)->get_value<int32_t>(ColumnID{0}, 0);
+    const auto district_info = (*stock)->get_value<pmr_string>(ColumnID{1}, 0);
+
+    // Restock by 91 items if less than 10 would be left (Clause 2.4.2.2)
+    const auto new_stock_quantity = stock_quantity >= order_line.quantity + 10
+                                        ? stock_quantity - order_line.quantity
+                                        : stock_quantity - order_line.quantity + 91;
+    const auto is_remote = order_line.supply_warehouse_id != _home_warehouse_id;
+
+    if (!_execute_sql("UPDATE STOCK SET S_QUANTITY = " + std::to_string(new_stock_quantity) + ", S_YTD = S_YTD + " +
+                      std::to_string(order_line.quantity) + ", S_ORDER_CNT = S_ORDER_CNT + 1, S_REMOTE_CNT = " +
+                      "S_REMOTE_CNT + " + std::to_string(is_remote ? 1 : 0) + " WHERE S_I_ID = " + item_id +
+                      " AND S_W_ID = " + supply_warehouse_id)) {
+      return false;
+    }
+
+    // OL_DELIVERY_D is -1 (i.e., NULL) until the order is delivered
+    const auto amount = static_cast<float>(order_line.quantity) * price;
+    if (!_execute_sql("INSERT INTO ORDER_LINE VALUES (" + std::to_string(order_id) + ", " + district_id + ", " +
+                      warehouse_id + ", " + std::to_string(order_line_idx) + ", " + item_id + ", " +
+                      supply_warehouse_id + ", -1, " + std::to_string(order_line.quantity) + ", " +
+                      std::to_string(amount) + ", '" + std::string{district_info} + "')")) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
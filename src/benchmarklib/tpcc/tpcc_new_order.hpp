@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * New-Order transaction (Clause 2.4): Enters an order of 5 to 15 items for a customer, reading and updating the stock
+ * of each item. 1% of the orders contain an unused item number, which rolls the transaction back.
+ */
+class TpccNewOrder : public AbstractTpccProcedure {
+ public:
+  TpccNewOrder(TpccRandomGenerator& random_generator, const size_t warehouse_count, const size_t home_warehouse_id);
+
+ protected:
+  bool _on_execute() override;
+
+  struct OrderLine {
+    size_t item_id;
+    size_t supply_warehouse_id;
+    int32_t quantity;
+  };
+
+  const size_t _district_id;
+  const size_t _customer_id;
+  std::vector<OrderLine> _order_lines;
+};
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#include "tpcc_order_status.hpp"
+
+#include <string>
+
+#include "constants.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TpccOrderStatus::TpccOrderStatus(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                                 const size_t home_warehouse_id)
+    : AbstractTpccProcedure(random_generator, warehouse_count, home_warehouse_id),
+      _district_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _select_customer_by_name(random_generator.random_number(1, 100) <= 60),
+      _customer_last_name(random_generator.last_name(1000)),
+      _customer_id(random_generator.nurand(1023, 1, NUM_CUSTOMERS_PER_DISTRICT) - 1) {}
+
+bool TpccOrderStatus::_on_execute() {
+  const auto warehouse_id = std::to_string(_home_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+
+  auto customer_id = static_cast<int32_t>(_customer_id);
+  if (_select_customer_by_name) {
+    const auto customer_id_by_name =
+        _select_customer_id_by_last_name(_home_warehouse_id, _district_id, _customer_last_name);
+    if (!customer_id_by_name) return false;
+    customer_id = *customer_id_by_name;
+  }
+
+  if (!_execute_sql("SELECT C_BALANCE, C_FIRST, C_MIDDLE, C_LAST FROM CUSTOMER WHERE C_W_ID = " + warehouse_id +
+                    " AND C_D_ID = " + district_id + " AND C_ID = " + std::to_string(customer_id))) {
+    return false;
+  }
+
+  const auto order = _execute_sql("SELECT O_ID, O_ENTRY_D, O_CARRIER_ID FROM \"ORDER\" WHERE O_W_ID = " +
+                                  warehouse_id + " AND O_D_ID = " + district_id + " AND O_C_ID = " +
+                                  std::to_string(customer_id) + " ORDER BY O_ID DESC LIMIT 1");
+  if (!order) return false;
+
+  // Not every customer has placed an order
+  if ((*order)->row_count() == 0) return true;
+  const auto order_id = (*order)->get_value<int32_t>(ColumnID{0}, 0);
+
+  return _execute_sql("SELECT OL_I_ID, OL_SUPPLY_W_ID, OL_QUANTITY, OL_AMOUNT, OL_DELIVERY_D FROM ORDER_LINE "
+                      "WHERE OL_W_ID = " +
+                      warehouse_id + " AND OL_D_ID = " + district_id + " AND OL_O_ID = " + std::to_string(order_id))
+      .has_value();
+}
+
+}  // namespace opossum
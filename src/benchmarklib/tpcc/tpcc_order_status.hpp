@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Order-Status transaction (Clause 2.6): Reads the balance of a customer and the lines of their most recent order.
+ * It does not modify any table.
+ */
+class TpccOrderStatus : public AbstractTpccProcedure {
+ public:
+  TpccOrderStatus(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                  const size_t home_warehouse_id);
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _district_id;
+  const bool _select_customer_by_name;
+  const std::string _customer_last_name;
+  const size_t _customer_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include "tpcc_payment.hpp"
+
+#include <ctime>
+#include <string>
+
+#include "constants.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TpccPayment::TpccPayment(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                         const size_t home_warehouse_id)
+    : AbstractTpccProcedure(random_generator, warehouse_count, home_warehouse_id),
+      _district_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _customer_warehouse_id(home_warehouse_id),
+      _customer_district_id(_district_id),
+      _select_customer_by_name(random_generator.random_number(1, 100) <= 60),
+      _customer_last_name(random_generator.last_name(1000)),
+      _customer_id(random_generator.nurand(1023, 1, NUM_CUSTOMERS_PER_DISTRICT) - 1),
+      _amount(static_cast<float>(random_generator.random_number(100, 500'000)) / 100.f) {
+  if (random_generator.random_number(1, 100) > 85) {
+    _customer_warehouse_id = _random_remote_warehouse_id();
+    _customer_district_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+  }
+}
+
+bool TpccPayment::_on_execute() {
+  const auto warehouse_id = std::to_string(_home_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+  const auto amount = std::to_string(_amount);
+
+  const auto warehouse = _execute_sql("SELECT W_NAME FROM WAREHOUSE WHERE W_ID = " + warehouse_id);
+  if (!warehouse) return false;
+  const auto warehouse_name = (*warehouse)->get_value<pmr_string>(ColumnID{0}, 0);
+
+  if (!_execute_sql("UPDATE WAREHOUSE SET W_YTD = W_YTD + " + amount + " WHERE W_ID = " + warehouse_id)) return false;
+
+  const auto district =
+      _execute_sql("SELECT D_NAME FROM DISTRICT WHERE D_W_ID = " + warehouse_id + " AND D_ID = " + district_id);
+  if (!district) return false;
+  const auto district_name = (*district)->get_value<pmr_string>(ColumnID{0}, 0);
+
+  if (!_execute_sql("UPDATE DISTRICT SET D_YTD = D_YTD + " + amount + " WHERE D_W_ID = " + warehouse_id +
+                    " AND D_ID = " + district_id)) {
+    return false;
+  }
+
+  auto customer_id = static_cast<int32_t>(_customer_id);
+  if (_select_customer_by_name) {
+    const auto customer_id_by_name =
+        _select_customer_id_by_last_name(_customer_warehouse_id, _customer_district_id, _customer_last_name);
+    if (!customer_id_by_name) return false;
+    customer_id = *customer_id_by_name;
+  }
+
+  const auto customer_predicate = " WHERE C_W_ID = " + std::to_string(_customer_warehouse_id) +
+                                  " AND C_D_ID = " + std::to_string(_customer_district_id) +
+                                  " AND C_ID = " + std::to_string(customer_id);
+
+  const auto customer = _execute_sql("SELECT C_CREDIT, C_DATA FROM CUSTOMER" + customer_predicate);
+  if (!customer) return false;
+  const auto credit = (*customer)->get_value<pmr_string>(ColumnID{0}, 0);
+
+  auto data_update = std::string{};
+  if (credit == "BC") {
+    // Customers with bad credit get the payment prepended to their C_DATA, which is truncated to 500 characters
+    const auto customer_data = (*customer)->get_value<pmr_string>(ColumnID{1}, 0);
+    const auto payment_data = std::to_string(customer_id) + " " + std::to_string(_customer_district_id) + " " +
+                              std::to_string(_customer_warehouse_id) + " " + district_id + " " + warehouse_id + " " +
+                              amount + " | ";
+    data_update = ", C_DATA = '" + (payment_data + std::string{customer_data}).substr(0, 500) + "'";
+  }
+
+  if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE - " + amount + ", C_YTD_PAYMENT = C_YTD_PAYMENT + " +
+                    amount + ", C_PAYMENT_CNT = C_PAYMENT_CNT + 1" + data_update + customer_predicate)) {
+    return false;
+  }
+
+  const auto history_data = std::string{warehouse_name} + "    " + std::string{district_name};
+  return _execute_sql("INSERT INTO HISTORY VALUES (" + std::to_string(customer_id) + ", " +
+                      std::to_string(_customer_district_id) + ", " + std::to_string(_customer_warehouse_id) + ", " +
+                      std::to_string(std::time(nullptr)) + ", " + amount + ", '" + history_data + "')")
+      .has_value();
+}
+
+}  // namespace opossum
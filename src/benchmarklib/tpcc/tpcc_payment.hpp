@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Payment transaction (Clause 2.5): Updates the balance of a customer and the year-to-date payments of the warehouse
+ * and the district, and records the payment in the history. 15% of the customers belong to a remote warehouse.
+ */
+class TpccPayment : public AbstractTpccProcedure {
+ public:
+  TpccPayment(TpccRandomGenerator& random_generator, const size_t warehouse_count, const size_t home_warehouse_id);
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _district_id;
+  size_t _customer_warehouse_id;
+  size_t _customer_district_id;
+  const bool _select_customer_by_name;
+  const std::string _customer_last_name;
+  const size_t _customer_id;
+  const float _amount;
+};
+
+}  // namespace opossum
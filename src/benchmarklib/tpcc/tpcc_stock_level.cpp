@@ -0,0 +1,32 @@
+#include "tpcc_stock_level.hpp"
+
+#include <string>
+
+#include "constants.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TpccStockLevel::TpccStockLevel(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                               const size_t home_warehouse_id)
+    : AbstractTpccProcedure(random_generator, warehouse_count, home_warehouse_id),
+      _district_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _threshold(random_generator.random_number(10, 20)) {}
+
+bool TpccStockLevel::_on_execute() {
+  const auto warehouse_id = std::to_string(_home_warehouse_id);
+  const auto district_id = std::to_string(_district_id);
+
+  const auto district = _execute_sql("SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + warehouse_id +
+                                     " AND D_ID = " + district_id);
+  if (!district) return false;
+  const auto next_order_id = (*district)->get_value<int32_t>(ColumnID{0}, 0);
+
+  return _execute_sql("SELECT COUNT(DISTINCT S_I_ID) FROM ORDER_LINE, STOCK WHERE OL_W_ID = " + warehouse_id +
+                      " AND OL_D_ID = " + district_id + " AND OL_O_ID < " + std::to_string(next_order_id) +
+                      " AND OL_O_ID >= " + std::to_string(next_order_id - 20) + " AND S_W_ID = " + warehouse_id +
+                      " AND S_I_ID = OL_I_ID AND S_QUANTITY < " + std::to_string(_threshold))
+      .has_value();
+}
+
+}  // namespace opossum
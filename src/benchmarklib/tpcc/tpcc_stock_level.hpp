@@ -0,0 +1,23 @@
+#pragma once
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Stock-Level transaction (Clause 2.8): Counts the distinct items of the last 20 orders of a district whose stock is
+ * below a threshold. It does not modify any table.
+ */
+class TpccStockLevel : public AbstractTpccProcedure {
+ public:
+  TpccStockLevel(TpccRandomGenerator& random_generator, const size_t warehouse_count,
+                 const size_t home_warehouse_id);
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _district_id;
+  const size_t _threshold;
+};
+
+}  // namespace opossum
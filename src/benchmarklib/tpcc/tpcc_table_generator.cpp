@@ -61,6 +61,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_items_table() {
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("ITEM", table);
   return table;
@@ -98,6 +99,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_warehouse_table() {
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("WAREHOUSE", table);
   return table;
@@ -148,6 +150,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_stock_table() {
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("STOCK", table);
   return table;
@@ -186,10 +189,11 @@ std::shared_ptr<Table> TpccTableGenerator::generate_district_table() {
   add_column<float>(segments_by_chunk, column_definitions, "D_YTD", cardinalities,
                     [&](std::vector<size_t>) { return CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT; });
   add_column<int>(segments_by_chunk, column_definitions, "D_NEXT_O_ID", cardinalities,
-                  [&](std::vector<size_t>) { return NUM_ORDERS + 1; });
+                  [&](std::vector<size_t>) { return NUM_ORDERS; });
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("DISTRICT", table);
   return table;
@@ -257,6 +261,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_customer_table() {
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{2}, ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("CUSTOMER", table);
   return table;
@@ -326,7 +331,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
 
   add_column<int>(segments_by_chunk, column_definitions, "O_CARRIER_ID", cardinalities,
                   [&](std::vector<size_t> indices) {
-                    return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? _random_gen.random_number(1, 10) : -1;
+                    return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? _random_gen.random_number(1, 10) : -1;
                   });
   add_column<int>(segments_by_chunk, column_definitions, "O_OL_CNT", cardinalities,
                   [&](std::vector<size_t> indices) { return order_line_counts[indices[0]][indices[1]][indices[2]]; });
@@ -335,6 +340,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{2}, ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("ORDER", table);
   return table;
@@ -423,14 +429,14 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
   // TODO(anybody) -1 should be null
   _add_order_line_column<int>(
       segments_by_chunk, column_definitions, "OL_DELIVERY_D", cardinalities, order_line_counts,
-      [&](std::vector<size_t> indices) { return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? _current_date : -1; });
+      [&](std::vector<size_t> indices) { return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? _current_date : -1; });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_QUANTITY", cardinalities, order_line_counts,
                               [&](std::vector<size_t>) { return 5; });
 
   _add_order_line_column<float>(
       segments_by_chunk, column_definitions, "OL_AMOUNT", cardinalities, order_line_counts,
       [&](std::vector<size_t> indices) {
-        return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? 0.f : _random_gen.random_number(1, 999999) / 100.f;
+        return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? 0.f : _random_gen.random_number(1, 999999) / 100.f;
       });
   _add_order_line_column<pmr_string>(segments_by_chunk, column_definitions, "OL_DIST_INFO", cardinalities,
                                      order_line_counts,
@@ -438,6 +444,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{2}, ColumnID{1}, ColumnID{0}, ColumnID{3}}, IsPrimaryKey::Yes);
 
   _encode_table("ORDER_LINE", table);
   return table;
@@ -445,7 +452,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
 
 std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   auto cardinalities = std::make_shared<std::vector<size_t>>(
-      std::initializer_list<size_t>{_warehouse_size, NUM_DISTRICTS_PER_WAREHOUSE, NUM_ORDERS});
+      std::initializer_list<size_t>{_warehouse_size, NUM_DISTRICTS_PER_WAREHOUSE, NUM_NEW_ORDERS});
 
   /**
    * indices[0] = warehouse
@@ -456,7 +463,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   TableColumnDefinitions column_definitions;
 
   add_column<int>(segments_by_chunk, column_definitions, "NO_O_ID", cardinalities,
-                  [&](std::vector<size_t> indices) { return indices[2] + NUM_ORDERS + 1 - NUM_NEW_ORDERS; });
+                  [&](std::vector<size_t> indices) { return indices[2] + NUM_ORDERS - NUM_NEW_ORDERS; });
   add_column<int>(segments_by_chunk, column_definitions, "NO_D_ID", cardinalities,
                   [&](std::vector<size_t> indices) { return indices[1]; });
   add_column<int>(segments_by_chunk, column_definitions, "NO_W_ID", cardinalities,
@@ -464,6 +471,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
 
   auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
   for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+  table->add_unique_constraint({ColumnID{2}, ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
 
   _encode_table("NEW_ORDER", table);
   return table;
@@ -4,9 +4,21 @@ extern "C" {
 #include <dss.h>
 #include <dsstypes.h>
 #include <rnd.h>
+
+// Skip the thread-local seeds ahead by skip_count rows of the respective table (see speed_seed.c)
+long sd_cust(int child, DSS_HUGE skip_count);
+long sd_line(int child, DSS_HUGE skip_count);
+long sd_order(int child, DSS_HUGE skip_count);
+long sd_part(int child, DSS_HUGE skip_count);
+long sd_psupp(int child, DSS_HUGE skip_count);
+long sd_supp(int child, DSS_HUGE skip_count);
 }
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "boost/hana/for_each.hpp"
 #include "boost/hana/integral_constant.hpp"
@@ -196,6 +208,61 @@ void dbgen_cleanup() {
   asc_date = nullptr;
 }
 
+/**
+ * dbgen initializes some of its state lazily when the first row is generated (the text pool, the date strings, and the
+ * name formats). Generate one row of each table before the generation threads run into that concurrently.
+ */
+void dbgen_initialize_lazy_state(const float scale_factor) {
+  dbgen_reset_seeds();
+  call_dbgen_mk<customer_t>(1, mk_cust, TpchTable::Customer);
+  call_dbgen_mk<order_t>(1, mk_order, TpchTable::Orders, 0l, scale_factor);
+  call_dbgen_mk<part_t>(1, mk_part, TpchTable::Part, scale_factor);
+  call_dbgen_mk<supplier_t>(1, mk_supp, TpchTable::Supplier);
+}
+
+/**
+ * Splits the rows [0, row_count) of a table into ranges of range_size rows and calls `functor(range_begin, range_end)`
+ * for each range. The ranges are processed by multiple threads, the results are returned in the order of the ranges.
+ * Since dbgen's seeds are thread-local, the functor has to reset them and skip them ahead to range_begin itself.
+ *
+ * Not using JobTasks here because we want parallelism even if the scheduler is disabled (as in BenchmarkTableEncoder).
+ */
+template <typename Functor>
+auto generate_ranges_in_parallel(const size_t row_count, const size_t range_size, const Functor& functor) {
+  using Result = std::invoke_result_t<Functor, size_t, size_t>;
+
+  const auto range_count = (row_count + range_size - 1) / range_size;
+  auto results = std::vector<Result>(range_count);
+
+  auto next_range = std::atomic<size_t>{0};
+  auto threads = std::vector<std::thread>{};
+  const auto thread_count = std::min(range_count, static_cast<size_t>(std::thread::hardware_concurrency() + 1));
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&] {
+      while (true) {
+        const auto range_id = next_range++;
+        if (range_id >= range_count) return;
+
+        const auto range_begin = range_id * range_size;
+        results[range_id] = functor(range_begin, std::min(range_begin + range_size, row_count));
+      }
+    });
+  }
+
+  for (auto& thread : threads) thread.join();
+
+  return results;
+}
+
+// Appends the chunks of the tables generated for each range to `table`
+void append_chunks(const std::shared_ptr<Table>& table, const std::vector<std::shared_ptr<Table>>& range_tables) {
+  for (const auto& range_table : range_tables) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < range_table->chunk_count(); ++chunk_id) {
+      table->append_chunk(range_table->get_chunk(chunk_id)->segments());
+    }
+  }
+}
+
 std::shared_ptr<BenchmarkConfig> create_benchmark_config_with_chunk_size(uint32_t chunk_size) {
   auto config = BenchmarkConfig::get_default_config();
   config.chunk_size = chunk_size;
@@ -227,98 +294,116 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   const auto nation_count = static_cast<size_t>(tdefs[NATION].base);
   const auto region_count = static_cast<size_t>(tdefs[REGION].base);
 
-  // The `* 4` part is defined in the TPC-H specification.
-  TableBuilder customer_builder{_benchmark_config->chunk_size, customer_column_types, customer_column_names,
-                                UseMvcc::Yes, customer_count};
-  TableBuilder order_builder{_benchmark_config->chunk_size, order_column_types, order_column_names, UseMvcc::Yes,
-                             order_count};
-  TableBuilder lineitem_builder{_benchmark_config->chunk_size, lineitem_column_types, lineitem_column_names,
-                                UseMvcc::Yes, order_count * 4};
-  TableBuilder part_builder{_benchmark_config->chunk_size, part_column_types, part_column_names, UseMvcc::Yes,
-                            part_count};
-  TableBuilder partsupp_builder{_benchmark_config->chunk_size, partsupp_column_types, partsupp_column_names,
-                                UseMvcc::Yes, part_count * 4};
-  TableBuilder supplier_builder{_benchmark_config->chunk_size, supplier_column_types, supplier_column_names,
-                                UseMvcc::Yes, supplier_count};
-  TableBuilder nation_builder{_benchmark_config->chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes,
-                              nation_count};
-  TableBuilder region_builder{_benchmark_config->chunk_size, region_column_types, region_column_names, UseMvcc::Yes,
-                              region_count};
-
-  dbgen_reset_seeds();
+  const auto chunk_size = static_cast<size_t>(_benchmark_config->chunk_size);
 
-  /**
-   * CUSTOMER
-   */
+  // The `* 4` part is defined in the TPC-H specification.
+  TableBuilder customer_builder{chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes};
+  TableBuilder order_builder{chunk_size, order_column_types, order_column_names, UseMvcc::Yes};
+  TableBuilder lineitem_builder{chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::Yes};
+  TableBuilder part_builder{chunk_size, part_column_types, part_column_names, UseMvcc::Yes};
+  TableBuilder partsupp_builder{chunk_size, partsupp_column_types, partsupp_column_names, UseMvcc::Yes};
+  TableBuilder supplier_builder{chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes};
+  TableBuilder nation_builder{chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes, nation_count};
+  TableBuilder region_builder{chunk_size, region_column_types, region_column_names, UseMvcc::Yes, region_count};
 
-  for (size_t row_idx = 0; row_idx < customer_count; row_idx++) {
-    auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
-    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
-                                convert_money(customer.acctbal), customer.mktsegment, customer.comment);
-  }
+  dbgen_initialize_lazy_state(_scale_factor);
 
   /**
-   * ORDER and LINEITEM
+   * CUSTOMER, ORDER and LINEITEM, PART and PARTSUPP, and SUPPLIER are generated in parallel, one chunk of the (parent)
+   * table per range. Each range skips the seeds ahead to its first row, as dbgen does for its -C/-S options. Thus, the
+   * data is the same as if it was generated sequentially. As the number of LINEITEMs per ORDER varies, each range of
+   * ORDERs ends with a LINEITEM chunk that is not full.
    */
 
-  for (size_t order_idx = 0; order_idx < order_count; ++order_idx) {
-    const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
-
-    order_builder.append_row(order.okey, order.custkey, pmr_string(1, order.orderstatus),
-                             convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
-                             order.spriority, order.comment);
+  const auto customers = generate_ranges_in_parallel(customer_count, chunk_size, [&](const auto begin, const auto end) {
+    dbgen_reset_seeds();
+    sd_cust(0, begin);
 
-    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
-      const auto& lineitem = order.l[line_idx];
-
-      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
-                                  convert_money(lineitem.eprice), convert_money(lineitem.discount),
-                                  convert_money(lineitem.tax), pmr_string(1, lineitem.rflag[0]),
-                                  pmr_string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
-                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
+    TableBuilder builder{chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes, end - begin};
+    for (auto row_idx = begin; row_idx < end; ++row_idx) {
+      auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
+      builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
+                         convert_money(customer.acctbal), customer.mktsegment, customer.comment);
     }
-  }
-
-  /**
-   * PART and PARTSUPP
-   */
-
-  for (size_t part_idx = 0; part_idx < part_count; ++part_idx) {
-    const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
-
-    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
-                            convert_money(part.retailprice), part.comment);
-
-    for (const auto& partsupp : part.s) {
-      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
-                                  partsupp.comment);
+    return builder.finish_table();
+  });
+
+  const auto orders_and_lineitems =
+      generate_ranges_in_parallel(order_count, chunk_size, [&](const auto begin, const auto end) {
+        dbgen_reset_seeds();
+        sd_order(0, begin);
+        sd_line(0, begin);
+
+        TableBuilder orders{chunk_size, order_column_types, order_column_names, UseMvcc::Yes, end - begin};
+        TableBuilder lineitems{chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::Yes,
+                               (end - begin) * 4};
+        for (auto order_idx = begin; order_idx < end; ++order_idx) {
+          const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+
+          orders.append_row(order.okey, order.custkey, pmr_string(1, order.orderstatus),
+                            convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
+                            order.spriority, order.comment);
+
+          for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
+            const auto& lineitem = order.l[line_idx];
+
+            lineitems.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
+                                 convert_money(lineitem.eprice), convert_money(lineitem.discount),
+                                 convert_money(lineitem.tax), pmr_string(1, lineitem.rflag[0]),
+                                 pmr_string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
+                                 lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
+          }
+        }
+        return std::make_pair(orders.finish_table(), lineitems.finish_table());
+      });
+
+  const auto parts_and_partsupps =
+      generate_ranges_in_parallel(part_count, chunk_size, [&](const auto begin, const auto end) {
+        dbgen_reset_seeds();
+        sd_part(0, begin);
+        sd_psupp(0, begin);
+
+        TableBuilder parts{chunk_size, part_column_types, part_column_names, UseMvcc::Yes, end - begin};
+        TableBuilder partsupps{chunk_size, partsupp_column_types, partsupp_column_names, UseMvcc::Yes,
+                               (end - begin) * 4};
+        for (auto part_idx = begin; part_idx < end; ++part_idx) {
+          const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
+
+          parts.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
+                           convert_money(part.retailprice), part.comment);
+
+          for (const auto& partsupp : part.s) {
+            partsupps.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
+                                 partsupp.comment);
+          }
+        }
+        return std::make_pair(parts.finish_table(), partsupps.finish_table());
+      });
+
+  const auto suppliers = generate_ranges_in_parallel(supplier_count, chunk_size, [&](const auto begin, const auto end) {
+    dbgen_reset_seeds();
+    sd_supp(0, begin);
+
+    TableBuilder builder{chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes, end - begin};
+    for (auto row_idx = begin; row_idx < end; ++row_idx) {
+      const auto supplier = call_dbgen_mk<supplier_t>(row_idx + 1, mk_supp, TpchTable::Supplier);
+      builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
+                         convert_money(supplier.acctbal), supplier.comment);
     }
-  }
+    return builder.finish_table();
+  });
 
   /**
-   * SUPPLIER
+   * NATION and REGION are small and generated by this thread
    */
 
-  for (size_t supplier_idx = 0; supplier_idx < supplier_count; ++supplier_idx) {
-    const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
-
-    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
-                                convert_money(supplier.acctbal), supplier.comment);
-  }
-
-  /**
-   * NATION
-   */
+  dbgen_reset_seeds();
 
   for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
     const auto nation = call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TpchTable::Nation);
     nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
   }
 
-  /**
-   * REGION
-   */
-
   for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
     const auto region = call_dbgen_mk<code_t>(region_idx + 1, mk_region, TpchTable::Region);
     region_builder.append_row(region.code, region.text, region.comment);
@@ -334,15 +419,56 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
    */
   std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
 
+  const auto split = [](const auto& pairs) {
+    auto firsts = std::vector<std::shared_ptr<Table>>{};
+    auto seconds = std::vector<std::shared_ptr<Table>>{};
+    for (const auto& [first, second] : pairs) {
+      firsts.emplace_back(first);
+      seconds.emplace_back(second);
+    }
+    return std::make_pair(firsts, seconds);
+  };
+  const auto [orders, lineitems] = split(orders_and_lineitems);
+  const auto [parts, partsupps] = split(parts_and_partsupps);
+
   table_info_by_name["customer"].table = customer_builder.finish_table();
+  append_chunks(table_info_by_name["customer"].table, customers);
   table_info_by_name["orders"].table = order_builder.finish_table();
+  append_chunks(table_info_by_name["orders"].table, orders);
   table_info_by_name["lineitem"].table = lineitem_builder.finish_table();
+  append_chunks(table_info_by_name["lineitem"].table, lineitems);
   table_info_by_name["part"].table = part_builder.finish_table();
+  append_chunks(table_info_by_name["part"].table, parts);
   table_info_by_name["partsupp"].table = partsupp_builder.finish_table();
+  append_chunks(table_info_by_name["partsupp"].table, partsupps);
   table_info_by_name["supplier"].table = supplier_builder.finish_table();
+  append_chunks(table_info_by_name["supplier"].table, suppliers);
   table_info_by_name["nation"].table = nation_builder.finish_table();
   table_info_by_name["region"].table = region_builder.finish_table();
 
+  /**
+   * Key constraints as defined in the TPC-H specification (1.4.2). They are not checked, but used by the optimizer.
+   */
+  const auto table = [&](const std::string& name) { return table_info_by_name[name].table; };
+  table("customer")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table("customer")->add_foreign_key_constraint({ColumnID{3}}, "nation", {ColumnID{0}});
+  table("orders")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table("orders")->add_foreign_key_constraint({ColumnID{1}}, "customer", {ColumnID{0}});
+  table("lineitem")->add_unique_constraint({ColumnID{0}, ColumnID{3}}, IsPrimaryKey::Yes);
+  table("lineitem")->add_foreign_key_constraint({ColumnID{0}}, "orders", {ColumnID{0}});
+  table("lineitem")->add_foreign_key_constraint({ColumnID{1}, ColumnID{2}}, "partsupp", {ColumnID{0}, ColumnID{1}});
+  table("lineitem")->add_foreign_key_constraint({ColumnID{1}}, "part", {ColumnID{0}});
+  table("lineitem")->add_foreign_key_constraint({ColumnID{2}}, "supplier", {ColumnID{0}});
+  table("part")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table("partsupp")->add_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes);
+  table("partsupp")->add_foreign_key_constraint({ColumnID{0}}, "part", {ColumnID{0}});
+  table("partsupp")->add_foreign_key_constraint({ColumnID{1}}, "supplier", {ColumnID{0}});
+  table("supplier")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table("supplier")->add_foreign_key_constraint({ColumnID{3}}, "nation", {ColumnID{0}});
+  table("nation")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table("nation")->add_foreign_key_constraint({ColumnID{2}}, "region", {ColumnID{0}});
+  table("region")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+
   return table_info_by_name;
 }
 
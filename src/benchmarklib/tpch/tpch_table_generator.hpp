@@ -25,7 +25,9 @@ extern std::unordered_map<opossum::TpchTable, std::string> tpch_table_names;
  * Wrapper around the official tpch-dbgen tool, making it directly generate opossum::Table instances without having
  * to generate and then load .tbl files.
  *
- * NOT thread safe because the underlying tpch-dbgen is not (since it has global data and malloc races).
+ * generate() uses multiple threads, each generating a range of rows into its own chunks (see
+ * generate_ranges_in_parallel()). Still, multiple generators must NOT run at the same time, because the underlying
+ * tpch-dbgen has global data apart from its (thread-local) seeds.
  */
 class TpchTableGenerator final : public AbstractTableGenerator {
  public:
@@ -35,6 +35,7 @@
 #include "pagination.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_statistics.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
@@ -132,6 +133,7 @@ Console::Console()
   register_command("rollback", std::bind(&Console::_rollback_transaction, this, std::placeholders::_1));
   register_command("commit", std::bind(&Console::_commit_transaction, this, std::placeholders::_1));
   register_command("txinfo", std::bind(&Console::_print_transaction_info, this, std::placeholders::_1));
+  register_command("scheduler_info", std::bind(&Console::_print_scheduler_info, this, std::placeholders::_1));
   register_command("pwd", std::bind(&Console::_print_current_working_directory, this, std::placeholders::_1));
   register_command("setting", std::bind(&Console::_change_runtime_setting, this, std::placeholders::_1));
   register_command("load_plugin", std::bind(&Console::_load_plugin, this, std::placeholders::_1));
@@ -400,6 +402,7 @@ int Console::_help(const std::string&) {
   out("  rollback                                - Roll back a manually created transaction\n");
   out("  commit                                  - Commit a manually created transaction\n");
   out("  txinfo                                  - Print information on the current transaction\n");
+  out("  scheduler_info                          - Print the counters of the scheduler's workers and the queued tasks\n");  // NOLINT
   out("  pwd                                     - Print current working directory\n");
   out("  load_plugin FILE                        - Load and start plugin stored at FILE\n");
   out("  unload_plugin NAME                      - Stop and unload the plugin libNAME.so/dylib (also clears the query cache)\n");  // NOLINT
@@ -897,6 +900,16 @@ int Console::_print_transaction_info(const std::string& input) {
   return ReturnCode::Ok;
 }
 
+int Console::_print_scheduler_info(const std::string&) {
+  if (!CurrentScheduler::is_set()) {
+    out("The scheduler is turned off. Type `setting scheduler on` to turn it on.\n");
+    return ReturnCode::Error;
+  }
+
+  out(create_scheduler_statistics_table());
+  return ReturnCode::Ok;
+}
+
 int Console::_print_current_working_directory(const std::string&) {
   out(filesystem::current_path().string() + "\n");
   return ReturnCode::Ok;
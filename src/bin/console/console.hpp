@@ -121,6 +121,7 @@ class Console : public Singleton<Console> {
   int _rollback_transaction(const std::string& input);
   int _commit_transaction(const std::string& input);
   int _print_transaction_info(const std::string& input);
+  int _print_scheduler_info(const std::string& input);
   int _print_current_working_directory(const std::string& args);
 
   int _load_plugin(const std::string& args);
@@ -3,6 +3,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <thread>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -23,6 +24,16 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    // By default, one thread per core handles the network I/O of the sessions
+    auto io_thread_count = static_cast<size_t>(std::thread::hardware_concurrency());
+    if (argc >= 3) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto io_thread_count_long = std::strtol(argv[2], &endptr, 10);
+      Assert(errno == 0 && io_thread_count_long >= 0 && *endptr == 0, "invalid number of I/O threads");
+      io_thread_count = static_cast<size_t>(io_thread_count_long);
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
@@ -30,8 +41,8 @@ int main(int argc, char* argv[]) {
 
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
-    // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    // constructor and then runs forever. The sessions are served by the server's I/O threads.
+    opossum::Server server{io_service, port, io_thread_count};
 
     io_service.run();
   } catch (std::exception& e) {
@@ -12,6 +12,26 @@ bool is_floating_point_data_type(const DataType data_type) {
   return data_type == DataType::Float || data_type == DataType::Double;
 }
 
+bool is_date_time_data_type(const DataType data_type) {
+  return data_type == DataType::Date || data_type == DataType::Timestamp;
+}
+
+bool is_logical_data_type(const DataType data_type) {
+  return is_date_time_data_type(data_type) || data_type == DataType::Decimal;
+}
+
+DataType physical_data_type(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Date:
+      return DataType::Int;
+    case DataType::Timestamp:
+    case DataType::Decimal:
+      return DataType::Long;
+    default:
+      return data_type;
+  }
+}
+
 }  // namespace opossum
 
 namespace std {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <boost/hana/concat.hpp>
 #include <boost/hana/core/to.hpp>
 #include <boost/hana/ext/boost/mpl/vector.hpp>
 #include <boost/hana/map.hpp>
@@ -55,7 +56,15 @@ namespace detail {
 // We thus only add "Bool" to the DataType enum and define JIT_DATA_TYPE_INFO (with a boolean data type) in
 // "lib/operators/jit_operator/jit_types.hpp".
 // We need to append to the end of the enum to not break the matching of indices between DataType and AllTypeVariant.
-enum class DataType : uint8_t { Null, BOOST_PP_SEQ_ENUM(DATA_TYPE_ENUM_VALUES), Bool };
+//
+// Date, Timestamp, and Decimal are logical data types: Their values are stored as int32_t (days since 1970-01-01),
+// int64_t (microseconds since 1970-01-01 00:00:00), and int64_t (scaled by 10^DECIMAL_SCALE), so that they use the
+// segments, encodings, scans, and statistics of Int and Long columns. As they have no C++ types of their own, they are
+// not part of DATA_TYPE_INFO and AllTypeVariant. Instead, they are appended to the enum and to data_type_pairs below, so
+// that resolve_data_type() resolves them to their storage types. See utils/date_time_utils.hpp and
+// utils/decimal_utils.hpp for their representation and utils/logical_data_types.hpp for the conversion from and to
+// strings.
+enum class DataType : uint8_t { Null, BOOST_PP_SEQ_ENUM(DATA_TYPE_ENUM_VALUES), Bool, Date, Timestamp, Decimal };
 
 static constexpr auto data_types = hana::to_tuple(hana::tuple_t<BOOST_PP_SEQ_ENUM(DATA_TYPES)>);
 static constexpr auto data_type_enum_values =
@@ -64,9 +73,17 @@ static constexpr auto data_type_strings = hana::make_tuple(BOOST_PP_SEQ_ENUM(DAT
 
 constexpr auto to_pair = [](auto tuple) { return hana::make_pair(hana::at_c<0>(tuple), hana::at_c<1>(tuple)); };
 
-static constexpr auto data_type_enum_pairs = hana::transform(hana::zip(data_type_enum_values, data_types), to_pair);
-static constexpr auto data_type_enum_string_pairs =
-    hana::transform(hana::zip(data_type_enum_values, data_type_strings), to_pair);
+static constexpr auto logical_data_type_enum_pairs = hana::make_tuple(
+    hana::make_pair(DataType::Date, hana::type_c<int32_t>), hana::make_pair(DataType::Timestamp, hana::type_c<int64_t>),
+    hana::make_pair(DataType::Decimal, hana::type_c<int64_t>));
+static constexpr auto logical_data_type_enum_string_pairs =
+    hana::make_tuple(hana::make_pair(DataType::Date, "date"), hana::make_pair(DataType::Timestamp, "timestamp"),
+                     hana::make_pair(DataType::Decimal, "decimal"));
+
+static constexpr auto data_type_enum_pairs = hana::concat(
+    hana::transform(hana::zip(data_type_enum_values, data_types), to_pair), logical_data_type_enum_pairs);
+static constexpr auto data_type_enum_string_pairs = hana::concat(
+    hana::transform(hana::zip(data_type_enum_values, data_type_strings), to_pair), logical_data_type_enum_string_pairs);
 
 // Prepends NullValue to tuple of types
 static constexpr auto data_types_including_null = hana::prepend(data_types, hana::type_c<NullValue>);
@@ -92,6 +109,16 @@ inline bool variant_is_null(const AllTypeVariant& variant) { return (variant.whi
 
 bool is_floating_point_data_type(const DataType data_type);
 
+// True for the logical data types Date and Timestamp
+bool is_date_time_data_type(const DataType data_type);
+
+// True for the logical data types Date, Timestamp, and Decimal, whose values need to be converted from and to strings
+bool is_logical_data_type(const DataType data_type);
+
+// The DataType of the stored values, i.e., Int for Date and Long for Timestamp and Decimal. Segments always report this
+// type.
+DataType physical_data_type(const DataType data_type);
+
 /**
  * Notes:
  *   – Use this instead of AllTypeVariant{}, AllTypeVariant{NullValue{}}, NullValue{}, etc.
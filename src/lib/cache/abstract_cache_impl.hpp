@@ -2,6 +2,8 @@
 
 #include <boost/iterator/iterator_facade.hpp>
 
+#include <memory>
+#include <optional>
 #include <utility>
 
 namespace opossum {
@@ -49,12 +51,22 @@ class AbstractCacheImpl {
   // Causes undefined behavior if the item is not in the cache.
   virtual Value& get(const Key& key) = 0;
 
+  // Returns the cached value at the given key, if any.
+  virtual std::optional<Value> try_get(const Key& key) {
+    if (!has(key)) return std::nullopt;
+    return get(key);
+  }
+
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
+  // Returns the key of the entry that would be evicted next if the policy can tell without changing its state, e.g.,
+  // for the admission filter of the Cache.
+  virtual std::optional<Key> eviction_candidate() const { return std::nullopt; }
+
   // Remove all elements from the cache.
   virtual void clear() = 0;
 
@@ -67,6 +79,10 @@ class AbstractCacheImpl {
   // Return the capacity of the cache.
   size_t capacity() const { return _capacity; }
 
+  // Returns true if set(), get(), try_get(), and has() may be called concurrently. Otherwise, the Cache wrapper
+  // serializes them.
+  virtual bool is_thread_safe() const { return false; }
+
  protected:
   // Remove an element from the cache according to the cache algorithm's strategy
   virtual void _evict() = 0;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -7,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "frequency_sketch.hpp"
 #include "gdfs_cache.hpp"
 
 #include "utils/singleton.hpp"
@@ -15,14 +17,34 @@ namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
-// Per-default, uses the GDFS cache as underlying storage.
+// Counters of a Cache since its creation or the last reset_metrics()
+struct CacheMetrics {
+  size_t hits{0};
+  size_t misses{0};
+
+  // New entries that were not added to the full cache by the admission filter
+  size_t rejected_admissions{0};
+
+  // Entries that were evicted by the policy to make room for new ones or because the cache was shrunk
+  size_t evictions{0};
+};
+
+// Per-default, uses the GDFS cache as underlying storage. Accesses to cache implementations that are not thread-safe
+// are serialized by a mutex. Under high concurrency, replace the implementation by a ShardedCache, which synchronizes
+// its shards independently.
+//
+// Once the cache is full, a TinyLFU admission filter decides whether a new entry replaces an existing one: a
+// FrequencySketch counts the recent lookups of all keys, cached or not. A new entry is only added if its key was
+// looked up more often than that of the entry the policy would evict (see AbstractCacheImpl::eviction_candidate()).
+// If the policy cannot tell which entry it would evict, the key must have been looked up before the current miss.
+// Thus, a burst of one-off queries does not evict the plans of frequently executed queries.
 template <typename Value, typename Key = std::string>
 class Cache : public Singleton<Cache<Value, Key>> {
  public:
   using Iterator = typename AbstractCacheImpl<Key, Value>::ErasedIterator;
 
   explicit Cache(size_t capacity = DefaultCacheCapacity)
-      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))), _frequency_sketch(capacity) {}
 
   virtual ~Cache() {}
 
@@ -30,8 +52,23 @@ class Cache : public Singleton<Cache<Value, Key>> {
   void set(const Key& query, const Value& value) {
     if (_impl->capacity() == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
+    auto lock = _lock();
+    if (_impl->has(query)) {
+      _impl->set(query, value);
+      return;
+    }
+
+    const auto size = _impl->size();
+    if (size >= _impl->capacity() && !_admit(query)) {
+      ++_rejected_admissions;
+      return;
+    }
+
     _impl->set(query, value);
+
+    // With a thread-safe implementation, other threads might have added or evicted entries in the meantime
+    const auto new_size = _impl->size();
+    if (new_size <= size) _evictions += size + 1 - new_size;
   }
 
   // Tries to fetch the cache entry for the query into the result object.
@@ -39,11 +76,12 @@ class Cache : public Singleton<Cache<Value, Key>> {
   std::optional<Value> try_get(const Key& query) {
     if (_impl->capacity() == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
-      return {};
-    }
-    return _impl->get(query);
+    if (_admission_filter_enabled) _frequency_sketch.record(query);
+
+    auto lock = _lock();
+    auto value = _impl->try_get(query);
+    ++(value ? _hits : _misses);
+    return value;
   }
 
   // Checks whether an entry for the query exists.
@@ -52,14 +90,27 @@ class Cache : public Singleton<Cache<Value, Key>> {
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
+    if (_admission_filter_enabled) _frequency_sketch.record(query);
+    ++_hits;
+
+    auto lock = _lock();
+    // The reference returned by get() may be invalidated by concurrent modifications of a thread-safe cache
+    if (_impl->is_thread_safe()) return *_impl->try_get(query);
     return _impl->get(query);
   }
 
   // Purges all entries from the cache.
-  void clear() { _impl->clear(); }
+  void clear() {
+    _impl->clear();
+    _frequency_sketch.clear();
+  }
 
-  void resize(size_t capacity) { _impl->resize(capacity); }
+  void resize(size_t capacity) {
+    const auto size = _impl->size();
+    _impl->resize(capacity);
+    _frequency_sketch.resize(capacity);
+    _evictions += size - _impl->size();
+  }
 
   size_t size() const { return _impl->size(); }
 
@@ -69,9 +120,26 @@ class Cache : public Singleton<Cache<Value, Key>> {
 
   // Replaces the underlying cache by creating a new object
   // of the given cache type.
-  template <class cache_t>
-  void replace_cache_impl(size_t capacity) {
-    _impl = std::make_unique<cache_t>(capacity);
+  template <class cache_t, typename... Args>
+  void replace_cache_impl(size_t capacity, Args&&... args) {
+    _impl = std::make_unique<cache_t>(capacity, std::forward<Args>(args)...);
+    _frequency_sketch.resize(capacity);
+  }
+
+  // The admission filter is enabled by default. Without it, new entries are always added and the policy alone
+  // decides which entries are evicted.
+  void set_admission_filter_enabled(const bool enabled) { _admission_filter_enabled = enabled; }
+  bool admission_filter_enabled() const { return _admission_filter_enabled; }
+
+  CacheMetrics metrics() const {
+    return CacheMetrics{_hits.load(), _misses.load(), _rejected_admissions.load(), _evictions.load()};
+  }
+
+  void reset_metrics() {
+    _hits = 0;
+    _misses = 0;
+    _rejected_admissions = 0;
+    _evictions = 0;
   }
 
   Iterator begin() { return _impl->begin(); }
@@ -83,6 +151,30 @@ class Cache : public Singleton<Cache<Value, Key>> {
   std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
 
   std::mutex _mutex;
+
+  FrequencySketch<Key> _frequency_sketch;
+  std::atomic<bool> _admission_filter_enabled{true};
+
+  std::atomic<size_t> _hits{0};
+  std::atomic<size_t> _misses{0};
+  std::atomic<size_t> _rejected_admissions{0};
+  std::atomic<size_t> _evictions{0};
+
+  // Only locks the mutex if the underlying cache is not thread-safe on its own
+  std::unique_lock<std::mutex> _lock() {
+    if (_impl->is_thread_safe()) return {};
+    return std::unique_lock<std::mutex>{_mutex};
+  }
+
+  // Whether a new entry for the query is added to the full cache, see above
+  bool _admit(const Key& query) const {
+    if (!_admission_filter_enabled) return true;
+
+    const auto frequency = _frequency_sketch.estimate(query);
+    const auto eviction_candidate = _impl->eviction_candidate();
+    if (!eviction_candidate) return frequency > 1;
+    return frequency > _frequency_sketch.estimate(*eviction_candidate);
+  }
 };
 
 }  // namespace opossum
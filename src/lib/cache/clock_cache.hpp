@@ -0,0 +1,142 @@
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+
+namespace opossum {
+
+// Generic cache implementation using the CLOCK policy, an approximation of LRU. A hit only sets the reference bit of
+// the entry, so that, unlike LRU and GDFS, get() does not need to reorder any data structure. On eviction, the clock
+// hand sweeps over the entries, clearing their reference bits, until it finds an entry that has not been referenced
+// since the last sweep.
+// Note: This implementation is not thread-safe.
+template <typename Key, typename Value>
+class ClockCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  class Iterator : public AbstractIterator {
+   public:
+    using IteratorType = typename std::vector<KeyValuePair>::iterator;
+    explicit Iterator(IteratorType p) : _wrapped_iterator(p) {}
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    IteratorType _wrapped_iterator;
+
+    void increment() { ++_wrapped_iterator; }
+
+    bool equal(const AbstractIterator& other) const {
+      return _wrapped_iterator == static_cast<const Iterator&>(other)._wrapped_iterator;
+    }
+
+    const KeyValuePair& dereference() const { return *_wrapped_iterator; }
+  };
+
+  explicit ClockCache(size_t capacity) : AbstractCacheImpl<Key, Value>(capacity) {
+    _entries.reserve(capacity);
+    _referenced.reserve(capacity);
+  }
+
+  // Sets the value to be cached at the given key.
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    // Override old element at that key, if it exists.
+    auto it = _map.find(key);
+    if (it != _map.end()) {
+      _entries[it->second].second = value;
+      _referenced[it->second] = true;
+      return;
+    }
+
+    if (this->_capacity == 0) return;
+
+    // If the cache is full, the new entry takes the place of the evicted one.
+    if (_entries.size() >= this->_capacity) {
+      const auto index = _advance_hand();
+      _map.erase(_entries[index].first);
+
+      _entries[index] = KeyValuePair(key, value);
+      _referenced[index] = false;
+      _map[key] = index;
+      return;
+    }
+
+    _entries.emplace_back(key, value);
+    _referenced.emplace_back(false);
+    _map[key] = _entries.size() - 1;
+  }
+
+  // Retrieves the value cached at the key.
+  // Causes undefined behavior if the key is not in the cache.
+  Value& get(const Key& key) {
+    const auto index = _map.find(key)->second;
+    _referenced[index] = true;
+    return _entries[index].second;
+  }
+
+  bool has(const Key& key) const { return _map.find(key) != _map.end(); }
+
+  size_t size() const { return _map.size(); }
+
+  void clear() {
+    _entries.clear();
+    _referenced.clear();
+    _map.clear();
+    _hand = 0;
+  }
+
+  void resize(size_t capacity) {
+    while (_entries.size() > capacity) {
+      _evict();
+    }
+    this->_capacity = capacity;
+  }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_entries.begin())}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_entries.end())}; }
+
+ protected:
+  // Entries in the order of the clock, and whether they have been referenced since the hand last passed them.
+  std::vector<KeyValuePair> _entries;
+  std::vector<bool> _referenced;
+
+  // Map to point towards the index of the element in _entries.
+  std::unordered_map<Key, size_t> _map;
+
+  // Index of the next entry to be considered for eviction.
+  size_t _hand{0};
+
+  // Returns the index of the next entry that has not been referenced and moves the hand past it
+  size_t _advance_hand() {
+    while (true) {
+      if (_hand >= _entries.size()) _hand = 0;
+
+      const auto index = _hand++;
+      if (!_referenced[index]) return index;
+      _referenced[index] = false;
+    }
+  }
+
+  void _evict() {
+    const auto index = _advance_hand();
+    _map.erase(_entries[index].first);
+
+    // Remove the entry while keeping the order of the others. Only used when shrinking the cache.
+    _entries.erase(_entries.begin() + index);
+    _referenced.erase(_referenced.begin() + index);
+    for (auto& [key, entry_index] : _map) {
+      if (entry_index > index) --entry_index;
+    }
+    _hand = index;
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opossum {
+
+// Approximates how often keys were accessed recently, for the TinyLFU admission filter of the Cache (Einziger et
+// al., "TinyLFU: A Highly Efficient Cache Admission Policy"). It is a count-min sketch: each key increments one
+// counter in each of four rows, and its frequency is estimated as the minimum of these counters. The counters saturate
+// at MaxFrequency. After a sample of ten accesses per cache entry, all counters are halved, so that the frequencies
+// reflect the recent accesses.
+//
+// The counters are atomic and accessed without ordering, so record() and estimate() may be called concurrently. As
+// for a cache, lost updates only make the estimates slightly less accurate. resize() and clear() must not happen
+// concurrently with other operations.
+template <typename Key>
+class FrequencySketch {
+ public:
+  static constexpr auto MaxFrequency = uint8_t{15};
+  static constexpr auto SampleSizePerEntry = size_t{10};
+
+  explicit FrequencySketch(const size_t capacity) { resize(capacity); }
+
+  // Adapts the sketch to a cache with the given capacity and forgets all frequencies
+  void resize(const size_t capacity) {
+    auto row_size = size_t{16};
+    while (row_size < capacity) row_size *= 2;
+
+    _row_mask = row_size - 1;
+    _counters = std::vector<std::atomic<uint8_t>>(RowCount * row_size);
+    _sample_size = std::max(SampleSizePerEntry * capacity, size_t{1});
+    _access_count = 0;
+  }
+
+  void record(const Key& key) {
+    const auto hash = std::hash<Key>{}(key);
+    for (auto row = size_t{0}; row < RowCount; ++row) {
+      auto& counter = _counters[_index(hash, row)];
+      const auto frequency = counter.load(std::memory_order_relaxed);
+      if (frequency < MaxFrequency) counter.store(frequency + 1, std::memory_order_relaxed);
+    }
+
+    if (_access_count.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_size) _halve();
+  }
+
+  uint8_t estimate(const Key& key) const {
+    const auto hash = std::hash<Key>{}(key);
+    auto frequency = MaxFrequency;
+    for (auto row = size_t{0}; row < RowCount; ++row) {
+      frequency = std::min(frequency, _counters[_index(hash, row)].load(std::memory_order_relaxed));
+    }
+    return frequency;
+  }
+
+  void clear() {
+    for (auto& counter : _counters) counter.store(0, std::memory_order_relaxed);
+    _access_count = 0;
+  }
+
+ private:
+  static constexpr auto RowCount = size_t{4};
+
+  size_t _index(const size_t hash, const size_t row) const {
+    // Derives an independent hash for each row by multiplying with an odd constant and mixing the high bits down
+    static constexpr auto seeds = std::array<uint64_t, RowCount>{0x9E3779B97F4A7C15, 0xC2B2AE3D27D4EB4F,
+                                                                  0x165667B19E3779F9, 0xFF51AFD7ED558CCD};
+    auto row_hash = static_cast<uint64_t>(hash) * seeds[row];
+    row_hash ^= row_hash >> 32;
+    return row * (_row_mask + 1) + (row_hash & _row_mask);
+  }
+
+  void _halve() {
+    for (auto& counter : _counters) {
+      counter.store(counter.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+    _access_count = 0;
+  }
+
+  std::vector<std::atomic<uint8_t>> _counters;
+  size_t _row_mask{0};
+  size_t _sample_size{1};
+  std::atomic<size_t> _access_count{0};
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -69,6 +70,7 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
 
       GDFSCacheEntry& entry = (*handle);
       entry.value = value;
+      _total_size += size - entry.size;
       entry.size = size;
       entry.frequency++;
       entry.priority = _inflation + entry.frequency / entry.size;
@@ -80,10 +82,7 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
     // If the cache is full, erase the item at the top of the heap
     // so that we can insert the new item.
     if (_queue.size() >= this->_capacity) {
-      auto top = _queue.top();
-      _inflation = top.priority;
-      _map.erase(top.key);
-      _queue.pop();
+      _evict();
     }
 
     // Insert new item in cache.
@@ -91,6 +90,7 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
     entry.priority = _inflation + entry.frequency / entry.size;
     Handle handle = _queue.push(entry);
     _map[key] = handle;
+    _total_size += size;
   }
 
   Value& get(const Key& key) {
@@ -107,9 +107,36 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::optional<Key> eviction_candidate() const {
+    if (_queue.empty()) return std::nullopt;
+    return _queue.top().key;
+  }
+
   void clear() {
     _map.clear();
     _queue.clear();
+    _total_size = 0.0;
+  }
+
+  // Removes the entry for the key without updating the inflation, e.g., because the entry became invalid.
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _total_size -= (*it->second).size;
+    _queue.erase(it->second);
+    _map.erase(it);
+  }
+
+  // Sum of the sizes of all entries. If the sizes are, e.g., the bytes of the values, the cache can be limited to a
+  // memory budget using evict_until_total_size().
+  double total_size() const { return _total_size; }
+
+  // Evicts the entries with the lowest priority until the total size is at most max_total_size
+  void evict_until_total_size(const double max_total_size) {
+    while (!_queue.empty() && _total_size > max_total_size) {
+      _evict();
+    }
   }
 
   void resize(size_t capacity) {
@@ -142,10 +169,13 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
   // Inflation value that will be updated whenever an item is evicted.
   double _inflation;
 
+  double _total_size{0.0};
+
   void _evict() {
     auto top = _queue.top();
 
     _inflation = top.priority;
+    _total_size -= top.size;
     _map.erase(top.key);
     _queue.pop();
   }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -102,6 +103,11 @@ class GDSCache : public AbstractCacheImpl<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::optional<Key> eviction_candidate() const {
+    if (_queue.empty()) return std::nullopt;
+    return _queue.top().key;
+  }
+
   void clear() {
     _map.clear();
     _queue.clear();
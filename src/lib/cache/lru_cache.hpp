@@ -1,6 +1,7 @@
 #pragma once
 
 #include <list>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -72,6 +73,11 @@ class LRUCache : public AbstractCacheImpl<Key, Value> {
 
   size_t size() const { return _map.size(); }
 
+  std::optional<Key> eviction_candidate() const {
+    if (_list.empty()) return std::nullopt;
+    return _list.back().first;
+  }
+
   void clear() {
     _list.clear();
     _map.clear();
@@ -0,0 +1,179 @@
+#include "query_result_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The names of the stored tables read by the LQP, including those read by its subqueries
+std::vector<std::string> find_stored_table_names(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto table_names = std::vector<std::string>{};
+  for (const auto& root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        table_names.emplace_back(std::static_pointer_cast<StoredTableNode>(node)->table_name);
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  std::sort(table_names.begin(), table_names.end());
+  table_names.erase(std::unique(table_names.begin(), table_names.end()), table_names.end());
+  return table_names;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string QueryResultCache::key(const std::string& sql, const std::optional<NormalizedSQL>& normalized_sql) {
+  if (!normalized_sql) return sql;
+
+  // The values are prefixed with their length, so that, e.g., the strings 'a b' and 'c' cannot be confused with 'a'
+  // and 'b c'. Their types are part of the cache key of the normalized SQL.
+  auto key = normalized_sql->cache_key() + "\n-- literal values:";
+  for (const auto& value : normalized_sql->literal_values) {
+    const auto value_string = boost::lexical_cast<std::string>(value);
+    key += " " + std::to_string(value_string.size()) + ":" + value_string;
+  }
+  return key;
+}
+
+bool QueryResultCache::is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto cacheable = true;
+  for (const auto& root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::Aggregate:
+        case LQPNodeType::Alias:
+        case LQPNodeType::DummyTable:
+        case LQPNodeType::Except:
+        case LQPNodeType::Intersect:
+        case LQPNodeType::Join:
+        case LQPNodeType::Limit:
+        case LQPNodeType::Predicate:
+        case LQPNodeType::Projection:
+        case LQPNodeType::Sort:
+        case LQPNodeType::StoredTable:
+        case LQPNodeType::Union:
+        case LQPNodeType::Validate:
+        case LQPNodeType::Window:
+          break;
+
+        default:
+          cacheable = false;
+      }
+
+      // Unlike the values of parameterized literals, the values of placeholders are not part of the key
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::Placeholder) cacheable = false;
+          return cacheable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+        });
+      }
+
+      return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+
+    if (!cacheable) return false;
+  }
+
+  return true;
+}
+
+std::shared_ptr<const Table> QueryResultCache::try_get(const std::string& key, const CommitID snapshot_commit_id) {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (!_entries.has(key)) return nullptr;
+
+  auto& storage_manager = StorageManager::get();
+  const auto& entry = _entries.get(key);
+  for (const auto& [table_name, table] : entry.tables) {
+    // The table was dropped or modified after the result was computed. The entry will not become valid again.
+    if (!storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table ||
+        table->last_modification_commit_id() > entry.max_last_modification_commit_id) {
+      _entries.erase(key);
+      return nullptr;
+    }
+  }
+
+  // The transaction does not see the latest version of the tables yet
+  if (snapshot_commit_id < entry.max_last_modification_commit_id) return nullptr;
+
+  ++_hit_count;
+  return entry.result;
+}
+
+void QueryResultCache::set(const std::string& key, const std::shared_ptr<AbstractLQPNode>& lqp,
+                           const CommitID snapshot_commit_id, const std::shared_ptr<const Table>& result,
+                           const size_t result_bytes) {
+  if (!is_cacheable(lqp)) return;
+
+  auto entry = Entry{{}, CommitID{0}, result};
+  for (const auto& table_name : find_stored_table_names(lqp)) {
+    auto& storage_manager = StorageManager::get();
+    if (!storage_manager.has_table(table_name)) return;
+    const auto table = storage_manager.get_table(table_name);
+
+    // The table was modified after the snapshot, so that the result would never be valid
+    const auto last_modification_commit_id = table->last_modification_commit_id();
+    if (last_modification_commit_id > snapshot_commit_id) return;
+
+    entry.max_last_modification_commit_id =
+        std::max(entry.max_last_modification_commit_id, last_modification_commit_id);
+    entry.tables.emplace_back(table_name, table);
+  }
+
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (result_bytes > _memory_budget_bytes) return;
+
+  _entries.set(key, std::move(entry), 1.0, static_cast<double>(result_bytes));
+  _entries.evict_until_total_size(static_cast<double>(_memory_budget_bytes));
+}
+
+size_t QueryResultCache::memory_budget() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_budget_bytes;
+}
+
+void QueryResultCache::set_memory_budget(const size_t memory_budget_bytes) {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  _memory_budget_bytes = memory_budget_bytes;
+  _entries.evict_until_total_size(static_cast<double>(_memory_budget_bytes));
+}
+
+size_t QueryResultCache::size() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+size_t QueryResultCache::memory_usage() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return static_cast<size_t>(_entries.total_size());
+}
+
+void QueryResultCache::clear() {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+  _hit_count = 0;
+}
+
+size_t QueryResultCache::hit_count() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _hit_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gdfs_cache.hpp"
+#include "sql/normalize_sql_literals.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the result tables of read-only SQL statements, so that statements that are issued repeatedly (e.g., by
+ * dashboards) are not executed again as long as the tables they read are not modified, see CacheQueryResults in
+ * SQLPipelineStatement.
+ *
+ * Entries are keyed by the SQL string of the statement or, if its literals were parameterized, by its normalized SQL
+ * and the values of the literals (see key()). Along with the result, an entry stores the tables read by the statement
+ * and the maximum of their last modifying commit IDs (see Table::last_modification_commit_id()) at the snapshot of
+ * the transaction that computed it. A transaction with the snapshot commit ID S sees the same versions of the tables
+ * if S is not smaller than that commit ID and none of the tables was modified since. Once a table is modified (or
+ * dropped), the entry can never become valid again and is evicted. As in the SubplanResultCache, only the results of
+ * transactions that did not modify data themselves are cached.
+ *
+ * The cache is limited to a budget of bytes of the result tables (see Table::estimate_memory_usage()). If it exceeds
+ * the budget, the entries are evicted according to the GDFS policy, which prefers frequently used and small results.
+ */
+class QueryResultCache : public Singleton<QueryResultCache> {
+ public:
+  static constexpr auto DEFAULT_MEMORY_BUDGET = size_t{256} * 1024 * 1024;
+
+  // Returns the key for a statement, depending on whether its literals were parameterized
+  static std::string key(const std::string& sql, const std::optional<NormalizedSQL>& normalized_sql);
+
+  // Whether the result of the optimized LQP of a statement can be cached: it must only read stored tables and must
+  // not modify them
+  static bool is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns nullptr if there is no valid entry for the key
+  std::shared_ptr<const Table> try_get(const std::string& key, const CommitID snapshot_commit_id);
+
+  // Stores the result of the LQP as computed by a transaction with the given snapshot commit ID. Does nothing if the
+  // LQP is not cacheable or a table it reads was modified after the snapshot. The result is charged with result_bytes,
+  // which includes the memory that it keeps alive, e.g., the ArenaMemoryResource of the statement.
+  void set(const std::string& key, const std::shared_ptr<AbstractLQPNode>& lqp, const CommitID snapshot_commit_id,
+           const std::shared_ptr<const Table>& result, const size_t result_bytes);
+
+  size_t memory_budget() const;
+  void set_memory_budget(const size_t memory_budget_bytes);
+
+  size_t size() const;
+
+  // Estimated bytes of the cached result tables
+  size_t memory_usage() const;
+
+  void clear();
+
+  // Number of successful lookups since the last clear()
+  size_t hit_count() const;
+
+ protected:
+  QueryResultCache() = default;
+
+  friend class Singleton;
+
+ private:
+  struct Entry {
+    std::vector<std::pair<std::string, std::shared_ptr<const Table>>> tables;
+    CommitID max_last_modification_commit_id;
+    std::shared_ptr<const Table> result;
+  };
+
+  mutable std::mutex _mutex;
+
+  // The number of entries is not limited, only their total size in bytes
+  GDFSCache<std::string, Entry> _entries{std::numeric_limits<size_t>::max()};
+
+  size_t _memory_budget_bytes{DEFAULT_MEMORY_BUDGET};
+  size_t _hit_count{0};
+};
+
+}  // namespace opossum
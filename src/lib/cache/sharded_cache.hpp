@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+#include "clock_cache.hpp"
+
+namespace opossum {
+
+// Thread-safe cache that partitions its entries by the hash of their key into shards, each of which is an independent
+// cache of the type ShardImpl (CLOCK per default) guarded by its own mutex. Thus, concurrent lookups only contend if
+// they hit the same shard, and with the CLOCK policy, a hit only sets a reference bit. As every shard evicts on its
+// own, the eviction order only approximates that of ShardImpl for the entire cache.
+//
+// The capacity is distributed evenly over the shards. To avoid shards that are too small to hold frequently used
+// entries, the number of shards is reduced for small capacities.
+//
+// Note: get() returns a reference that can be invalidated by concurrent modifications, use try_get() instead.
+// resize() as well as iterating over the cache must not happen concurrently with other operations.
+template <typename Key, typename Value, typename ShardImpl = ClockCache<Key, Value>>
+class ShardedCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  static constexpr auto MaxShardCount = size_t{32};
+  static constexpr auto MinShardCapacity = size_t{32};
+
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  // Chains the iterators of the individual shards
+  class Iterator : public AbstractIterator {
+   public:
+    Iterator(ShardedCache& cache, size_t shard_id) : _cache(cache), _shard_id(shard_id) { _skip_empty_shards(); }
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    ShardedCache& _cache;
+    size_t _shard_id;
+    std::optional<ErasedIterator> _shard_iterator;
+    std::optional<ErasedIterator> _shard_end;
+
+    void _skip_empty_shards() {
+      while (_shard_id < _cache._shards.size()) {
+        if (!_shard_iterator) {
+          _shard_iterator.emplace(_cache._shards[_shard_id]->impl.begin());
+          _shard_end.emplace(_cache._shards[_shard_id]->impl.end());
+        }
+        if (*_shard_iterator != *_shard_end) return;
+
+        _shard_iterator.reset();
+        _shard_end.reset();
+        ++_shard_id;
+      }
+    }
+
+    void increment() {
+      ++*_shard_iterator;
+      _skip_empty_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const {
+      const auto& other_iterator = static_cast<const Iterator&>(other);
+      if (_shard_id != other_iterator._shard_id) return false;
+      return _shard_id == _cache._shards.size() || *_shard_iterator == *other_iterator._shard_iterator;
+    }
+
+    const KeyValuePair& dereference() const { return **_shard_iterator; }
+  };
+
+  explicit ShardedCache(size_t capacity) : AbstractCacheImpl<Key, Value>(capacity) { _create_shards(capacity); }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto& shard = _shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.impl.set(key, value, cost, size);
+  }
+
+  Value& get(const Key& key) {
+    auto& shard = _shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.impl.get(key);
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    auto& shard = _shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.impl.has(key)) return std::nullopt;
+    return shard.impl.get(key);
+  }
+
+  bool has(const Key& key) const {
+    auto& shard = _shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.impl.has(key);
+  }
+
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      size += shard->impl.size();
+    }
+    return size;
+  }
+
+  void clear() {
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->impl.clear();
+    }
+  }
+
+  // Redistributes the entries over a new set of shards, evicting entries of shards that exceed their new capacity
+  void resize(size_t capacity) {
+    auto entries = std::vector<KeyValuePair>{};
+    for (const auto& shard : _shards) {
+      for (const auto& entry : shard->impl) {
+        entries.emplace_back(entry);
+      }
+    }
+
+    _create_shards(capacity);
+    this->_capacity = capacity;
+
+    for (const auto& [key, value] : entries) {
+      _shard(key).impl.set(key, value);
+    }
+  }
+
+  bool is_thread_safe() const { return true; }
+
+  size_t shard_count() const { return _shards.size(); }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(*this, 0)}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(*this, _shards.size())}; }
+
+ protected:
+  struct Shard {
+    explicit Shard(size_t capacity) : impl(capacity) {}
+
+    ShardImpl impl;
+    mutable std::mutex mutex;
+  };
+
+  // Shards are not movable because of their mutex
+  std::vector<std::unique_ptr<Shard>> _shards;
+
+  void _create_shards(size_t capacity) {
+    const auto shard_count = std::clamp(capacity / MinShardCapacity, size_t{1}, MaxShardCount);
+
+    _shards.clear();
+    _shards.reserve(shard_count);
+    for (auto shard_id = size_t{0}; shard_id < shard_count; ++shard_id) {
+      const auto shard_capacity = capacity / shard_count + (shard_id < capacity % shard_count ? 1 : 0);
+      _shards.emplace_back(std::make_unique<Shard>(shard_capacity));
+    }
+  }
+
+  Shard& _shard(const Key& key) const { return *_shards[std::hash<Key>{}(key) % _shards.size()]; }
+
+  // The shards evict their entries on their own
+  void _evict() {}
+};
+
+}  // namespace opossum
@@ -0,0 +1,227 @@
+#include "subplan_result_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The names of the stored tables read by the LQP, including those read by its subqueries
+std::vector<std::string> find_stored_table_names(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto table_names = std::vector<std::string>{};
+  for (const auto& root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        table_names.emplace_back(std::static_pointer_cast<StoredTableNode>(node)->table_name);
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  std::sort(table_names.begin(), table_names.end());
+  table_names.erase(std::unique(table_names.begin(), table_names.end()), table_names.end());
+  return table_names;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool SubplanResultCache::is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto cacheable = true;
+  for (const auto& root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::Aggregate:
+        case LQPNodeType::Alias:
+        case LQPNodeType::DummyTable:
+        case LQPNodeType::Except:
+        case LQPNodeType::Intersect:
+        case LQPNodeType::Join:
+        case LQPNodeType::Limit:
+        case LQPNodeType::Predicate:
+        case LQPNodeType::Projection:
+        case LQPNodeType::Sort:
+        case LQPNodeType::StoredTable:
+        case LQPNodeType::Union:
+        case LQPNodeType::Validate:
+        case LQPNodeType::Window:
+          break;
+
+        default:
+          cacheable = false;
+      }
+
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::Placeholder ||
+              sub_expression->type == ExpressionType::CorrelatedParameter) {
+            cacheable = false;
+          }
+          return cacheable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+        });
+      }
+
+      return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+
+    if (!cacheable) return false;
+  }
+
+  return true;
+}
+
+size_t SubplanResultCache::hash(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  // AbstractExpression::hash() and the descriptions of the nodes depend on the addresses of the nodes referenced by
+  // LQPColumnExpressions and LQPSubqueryExpressions. As equal LQPs have to have the same hash, only the types of the
+  // nodes and expressions, the names of the columns, the values, and the names of the stored tables are hashed.
+  auto hash = size_t{0};
+  for (const auto& root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(root, [&](const auto& node) {
+      boost::hash_combine(hash, static_cast<size_t>(node->type));
+      if (node->type == LQPNodeType::StoredTable) {
+        boost::hash_combine(hash, std::static_pointer_cast<StoredTableNode>(node)->table_name);
+      }
+
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          boost::hash_combine(hash, static_cast<size_t>(sub_expression->type));
+          if (sub_expression->type == ExpressionType::LQPColumn || sub_expression->type == ExpressionType::Value) {
+            boost::hash_combine(hash, sub_expression->as_column_name());
+          }
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+  return hash;
+}
+
+std::shared_ptr<const Table> SubplanResultCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                         const size_t lqp_hash, const CommitID snapshot_commit_id) {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto [begin, end] = _entries_by_hash.equal_range(lqp_hash);
+  for (auto entries_by_hash_iter = begin; entries_by_hash_iter != end; ++entries_by_hash_iter) {
+    const auto entry_iter = entries_by_hash_iter->second;
+    if (*entry_iter->lqp != *lqp) continue;
+
+    auto valid = true;
+    auto& storage_manager = StorageManager::get();
+    for (const auto& [table_name, table] : entry_iter->tables) {
+      const auto last_modification_commit_id = table->last_modification_commit_id();
+
+      // The table was dropped or modified after the result was computed. The entry will not become valid again.
+      if (!storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table ||
+          last_modification_commit_id > entry_iter->snapshot_commit_id) {
+        _erase(entry_iter);
+        return nullptr;
+      }
+
+      // The table was modified after the snapshot of the transaction, which thus sees an older version of the table
+      if (last_modification_commit_id > snapshot_commit_id) valid = false;
+    }
+    if (!valid) return nullptr;
+
+    _entries.splice(_entries.begin(), _entries, entry_iter);
+    ++_hit_count;
+    return entry_iter->result;
+  }
+
+  return nullptr;
+}
+
+void SubplanResultCache::set(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t lqp_hash,
+                             const CommitID snapshot_commit_id, const std::shared_ptr<const Table>& result) {
+  if (result->row_count() > MAX_ROW_COUNT) return;
+
+  auto entry = Entry{lqp, lqp_hash, snapshot_commit_id, {}, result};
+  for (const auto& table_name : find_stored_table_names(lqp)) {
+    auto& storage_manager = StorageManager::get();
+    if (!storage_manager.has_table(table_name)) return;
+    const auto table = storage_manager.get_table(table_name);
+
+    // The table was modified after the snapshot, so that the result would never be valid
+    if (table->last_modification_commit_id() > snapshot_commit_id) return;
+    entry.tables.emplace_back(table_name, table);
+  }
+
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_capacity == 0) return;
+
+  // Replace an existing entry for the same LQP, e.g., one that is only valid for older snapshots
+  const auto [begin, end] = _entries_by_hash.equal_range(lqp_hash);
+  for (auto entries_by_hash_iter = begin; entries_by_hash_iter != end; ++entries_by_hash_iter) {
+    if (*entries_by_hash_iter->second->lqp == *lqp) {
+      _erase(entries_by_hash_iter->second);
+      break;
+    }
+  }
+
+  _entries.emplace_front(std::move(entry));
+  _entries_by_hash.emplace(lqp_hash, _entries.begin());
+
+  while (_entries.size() > _capacity) {
+    _erase(std::prev(_entries.end()));
+  }
+}
+
+size_t SubplanResultCache::capacity() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _capacity;
+}
+
+void SubplanResultCache::resize(const size_t capacity) {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  _capacity = capacity;
+
+  while (_entries.size() > _capacity) {
+    _erase(std::prev(_entries.end()));
+  }
+}
+
+size_t SubplanResultCache::size() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+void SubplanResultCache::clear() {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+  _entries_by_hash.clear();
+  _hit_count = 0;
+}
+
+size_t SubplanResultCache::hit_count() const {
+  auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _hit_count;
+}
+
+void SubplanResultCache::_erase(const EntryIterator entry_iter) {
+  const auto [begin, end] = _entries_by_hash.equal_range(entry_iter->lqp_hash);
+  for (auto entries_by_hash_iter = begin; entries_by_hash_iter != end; ++entries_by_hash_iter) {
+    if (entries_by_hash_iter->second == entry_iter) {
+      _entries_by_hash.erase(entries_by_hash_iter);
+      break;
+    }
+  }
+
+  _entries.erase(entry_iter);
+}
+
+}  // namespace opossum
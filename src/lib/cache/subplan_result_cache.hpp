@@ -0,0 +1,90 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cache.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the results of subplans (uncorrelated subqueries and small aggregates, see CachedSubplan) across statements,
+ * so that, e.g., the same subquery on a dimension table is not executed again for every query that contains it.
+ *
+ * Entries are looked up by the LQP of the subplan: the canonical hash() of an LQP is the same for equal LQPs, and
+ * collisions are resolved by comparing the LQPs. The result of a subplan executed by a transaction with the snapshot
+ * commit ID S0 is the same for a transaction with snapshot S as long as none of the tables read by the subplan was
+ * modified by a commit between S0 and S. Thus, an entry is valid for S if the last modifying commit of all these
+ * tables (see Table::last_modification_commit_id()) is not greater than min(S0, S). Once a table is modified after S0
+ * (or dropped), the entry is evicted. Only the results of transactions that did not modify data themselves are
+ * cached, as they might see their own uncommitted changes.
+ *
+ * The least recently used entries are evicted if more than capacity() subplans are cached.
+ */
+class SubplanResultCache : public Singleton<SubplanResultCache> {
+ public:
+  // Results with more rows are not cached
+  static constexpr auto MAX_ROW_COUNT = size_t{100'000};
+
+  // Whether the results of the LQP can be cached: it must only read stored tables and must not contain parameters,
+  // as their values are not part of the LQP
+  static bool is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  static size_t hash(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns nullptr if there is no valid entry for the LQP
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t lqp_hash,
+                                       const CommitID snapshot_commit_id);
+
+  // Stores the result of the LQP as computed by a transaction with the given snapshot commit ID
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const size_t lqp_hash, const CommitID snapshot_commit_id,
+           const std::shared_ptr<const Table>& result);
+
+  size_t capacity() const;
+  void resize(const size_t capacity);
+
+  size_t size() const;
+  void clear();
+
+  // Number of successful lookups since the last clear()
+  size_t hit_count() const;
+
+ protected:
+  SubplanResultCache() = default;
+
+  friend class Singleton;
+
+ private:
+  struct Entry {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    size_t lqp_hash;
+    CommitID snapshot_commit_id;
+    std::vector<std::pair<std::string, std::shared_ptr<const Table>>> tables;
+    std::shared_ptr<const Table> result;
+  };
+
+  using EntryIterator = std::list<Entry>::iterator;
+
+  void _erase(const EntryIterator entry_iter);
+
+  mutable std::mutex _mutex;
+
+  // Most recently used entries first
+  std::list<Entry> _entries;
+  std::unordered_multimap<size_t, EntryIterator> _entries_by_hash;
+
+  size_t _capacity{DefaultCacheCapacity};
+  size_t _hit_count{0};
+};
+
+}  // namespace opossum
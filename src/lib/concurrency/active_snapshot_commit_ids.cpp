@@ -0,0 +1,85 @@
+#include "active_snapshot_commit_ids.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void ActiveSnapshotCommitIds::insert(const CommitID commit_id) {
+  auto& slot = _slots[_slot_index(commit_id)];
+
+  auto expected = slot.load();
+  while (_slot_count(expected) == 0 || _slot_commit_id(expected) == commit_id) {
+    const auto desired = _slot_count(expected) == 0 ? COUNT_ONE | commit_id : expected + COUNT_ONE;
+    if (slot.compare_exchange_weak(expected, desired)) return;
+  }
+
+  // The slot is taken by another commit id
+  std::lock_guard<std::mutex> lock(_overflow_mutex);
+  _overflow.insert(commit_id);
+  ++_overflow_size;
+}
+
+void ActiveSnapshotCommitIds::erase(const CommitID commit_id) {
+  auto& slot = _slots[_slot_index(commit_id)];
+
+  // As all occurrences of a commit id are equivalent, it does not matter whether the erased one was inserted into the
+  // slot or into the overflow set
+  auto expected = slot.load();
+  while (_slot_count(expected) > 0 && _slot_commit_id(expected) == commit_id) {
+    if (slot.compare_exchange_weak(expected, expected - COUNT_ONE)) return;
+  }
+
+  std::lock_guard<std::mutex> lock(_overflow_mutex);
+  const auto iter = _overflow.find(commit_id);
+  Assert(iter != _overflow.end(),
+         "Could not find snapshot_commit_id in the active snapshot commit ids. Therefore, the removal failed and the "
+         "function should not have been called.");
+  _overflow.erase(iter);
+  --_overflow_size;
+}
+
+std::optional<CommitID> ActiveSnapshotCommitIds::lowest() const {
+  auto lowest_commit_id = std::optional<CommitID>{};
+
+  for (const auto& slot : _slots) {
+    const auto value = slot.load();
+    if (_slot_count(value) == 0) continue;
+    if (!lowest_commit_id || _slot_commit_id(value) < *lowest_commit_id) lowest_commit_id = _slot_commit_id(value);
+  }
+
+  if (_overflow_size > 0) {
+    std::lock_guard<std::mutex> lock(_overflow_mutex);
+    for (const auto commit_id : _overflow) {
+      if (!lowest_commit_id || commit_id < *lowest_commit_id) lowest_commit_id = commit_id;
+    }
+  }
+
+  return lowest_commit_id;
+}
+
+std::vector<CommitID> ActiveSnapshotCommitIds::commit_ids() const {
+  auto commit_ids = std::vector<CommitID>{};
+
+  for (const auto& slot : _slots) {
+    const auto value = slot.load();
+    commit_ids.insert(commit_ids.end(), _slot_count(value), _slot_commit_id(value));
+  }
+
+  std::lock_guard<std::mutex> lock(_overflow_mutex);
+  commit_ids.insert(commit_ids.end(), _overflow.begin(), _overflow.end());
+
+  return commit_ids;
+}
+
+size_t ActiveSnapshotCommitIds::_slot_index(const CommitID commit_id) {
+  // Transposes the slots, viewed as a matrix with one cache line per column, so that consecutive commit ids are
+  // placed in consecutive cache lines. This is a permutation of the slots, so that any SLOT_COUNT consecutive commit
+  // ids still have different slots.
+  constexpr auto slots_per_cache_line = 64 / sizeof(uint64_t);
+  constexpr auto cache_line_count = SLOT_COUNT / slots_per_cache_line;
+
+  const auto index = commit_id % SLOT_COUNT;
+  return (index % cache_line_count) * slots_per_cache_line + index / cache_line_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Tracks the snapshot commit ids of the active transactions (as a multiset), so that the TransactionManager can tell
+ * the lowest one to the MVCC garbage collection. As every transaction inserts its snapshot commit id when it begins
+ * and erases it when it ends, a global lock would be a point of contention for short transactions.
+ *
+ * Instead, the commit ids are counted in a fixed number of slots, keyed by the commit id modulo the slot count. Each
+ * slot is a single atomic word holding a commit id and the number of active transactions with that snapshot commit
+ * id, so that inserting and erasing is a compare-and-swap. As the snapshot commit ids of the active transactions
+ * usually lie within a small window below the last commit id, they rarely compete for a slot. Only if the slot of a
+ * commit id is taken by a different one (i.e., by a transaction that is more than SLOT_COUNT commits older), the
+ * commit id is stored in a locked overflow multiset instead.
+ *
+ * Computing the lowest commit id scans all slots without locking (and the overflow set only if it is not empty).
+ * Transactions that begin or end concurrently may or may not be seen, just as with a lock that is only held while
+ * inserting or erasing.
+ */
+class ActiveSnapshotCommitIds : private Noncopyable {
+ public:
+  static constexpr auto SLOT_COUNT = size_t{1024};
+
+  void insert(const CommitID commit_id);
+
+  // Erases one occurrence of the commit id, which must have been inserted before
+  void erase(const CommitID commit_id);
+
+  std::optional<CommitID> lowest() const;
+
+  // Returns each active commit id as often as it was inserted. Not atomic, meant for tests and assertions.
+  std::vector<CommitID> commit_ids() const;
+
+ private:
+  // A slot holds the number of active transactions in the upper 32 bits and their commit id in the lower 32 bits. A
+  // slot with a count of 0 is free, regardless of its commit id.
+  static constexpr auto COUNT_ONE = uint64_t{1} << 32;
+
+  static CommitID _slot_commit_id(const uint64_t slot) { return static_cast<CommitID>(slot); }
+  static uint64_t _slot_count(const uint64_t slot) { return slot >> 32; }
+
+  // Consecutive commit ids are placed in different cache lines, as their transactions are likely to run concurrently
+  static size_t _slot_index(const CommitID commit_id);
+
+  std::array<std::atomic<uint64_t>, SLOT_COUNT> _slots{};
+
+  std::atomic<size_t> _overflow_size{0};
+  mutable std::mutex _overflow_mutex;
+  std::unordered_multiset<CommitID> _overflow;
+};
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#include "cancellation_token.hpp"
+
+namespace opossum {
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+void CancellationToken::set_timeout(const std::chrono::nanoseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  _deadline = deadline.time_since_epoch().count();
+}
+
+bool CancellationToken::is_cancelled() const { return _cancelled || _deadline_passed(); }
+
+void CancellationToken::throw_if_cancelled() const {
+  // The message matches the one of PostgreSQL, which clients might rely on
+  if (_cancelled) throw QueryCancelledException("canceling statement due to user request");
+  if (_deadline_passed()) throw QueryCancelledException("canceling statement due to statement timeout");
+}
+
+bool CancellationToken::_deadline_passed() const {
+  // Most tokens have no deadline, which saves reading the clock
+  const auto deadline = _deadline.load();
+  return deadline != NO_DEADLINE && std::chrono::steady_clock::now().time_since_epoch().count() >= deadline;
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Thrown by SQLPipelineStatement::get_result_table() and the server if a statement was cancelled
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what_arg) : std::runtime_error(what_arg) {}
+};
+
+/**
+ * Cancels the execution of a statement, either explicitly (e.g., by a CancelRequest of a client) or once its timeout
+ * has passed. The token is passed to the operators of the statement (see
+ * AbstractOperator::set_cancellation_token_recursively()). Long-running operators check it between chunks or
+ * partitions and stop early, OperatorTasks of a cancelled statement that have not started yet skip their operator. As
+ * the outputs of the operators are incomplete then, the statement discards them and throws a QueryCancelledException.
+ *
+ * Cancellation is cooperative and cannot be undone. Operators do not throw themselves, as exceptions must not escape
+ * the tasks of the scheduler.
+ */
+class CancellationToken : private Noncopyable {
+ public:
+  void cancel();
+
+  // Cancels the token once @param timeout has passed from now on
+  void set_timeout(const std::chrono::nanoseconds timeout);
+
+  bool is_cancelled() const;
+
+  // Throws a QueryCancelledException, which tells whether the token was cancelled or timed out, if is_cancelled()
+  void throw_if_cancelled() const;
+
+ private:
+  static constexpr auto NO_DEADLINE = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+
+  bool _deadline_passed() const;
+
+  std::atomic_bool _cancelled{false};
+
+  // Time since the epoch of the steady_clock, stored as a count to be atomic
+  std::atomic<std::chrono::steady_clock::rep> _deadline{NO_DEADLINE};
+};
+
+}  // namespace opossum
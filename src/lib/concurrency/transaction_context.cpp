@@ -6,7 +6,10 @@
 #include "commit_context.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
+#include "write_ahead_log.hpp"
 #include "utils/assert.hpp"
+#include "utils/execution_hooks.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
@@ -16,6 +19,7 @@ TransactionContext::TransactionContext(const TransactionID transaction_id, const
       _phase{TransactionPhase::Active},
       _num_active_operators{0} {
   TransactionManager::get()._register_transaction(snapshot_commit_id);
+  DTRACE_PROBE2(HYRISE, TRANSACTION_BEGIN, _transaction_id, _snapshot_commit_id);
 }
 
 TransactionContext::~TransactionContext() {
@@ -53,7 +57,9 @@ TransactionID TransactionContext::transaction_id() const { return _transaction_i
 CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
 
 CommitID TransactionContext::commit_id() const {
-  Assert((_commit_context != nullptr), "TransactionContext cid only available after commit context has been created.");
+  Assert((_commit_context != nullptr),
+         "TransactionContext cid only available after commit context has been created. Read-only transactions do "
+         "not have one.");
 
   return _commit_context->commit_id();
 }
@@ -83,11 +89,31 @@ bool TransactionContext::commit_async(const std::function<void(TransactionID)>&
 
   if (!success) return false;
 
+  if (!_commit_context) {
+    // Read-only transaction: Nothing becomes visible, so there is no need to wait for previous transactions
+    _phase = TransactionPhase::Committed;
+    DTRACE_PROBE2(HYRISE, TRANSACTION_COMMIT, _transaction_id, _snapshot_commit_id);
+    ExecutionHooks::get().transaction_committed.fire(_transaction_id, _snapshot_commit_id);
+
+    if (callback) callback(_transaction_id);
+    return true;
+  }
+
+  // The changes are durable before they are committed, i.e., before they can become visible to other transactions
+  if (!_rw_operators.empty() && WriteAheadLog::get().is_enabled()) {
+    auto changes = WriteAheadLog::TransactionChanges{};
+    for (const auto& op : _rw_operators) {
+      op->log_changes(changes);
+    }
+    WriteAheadLog::get().log_commit(commit_id(), changes);
+  }
+
   for (const auto& op : _rw_operators) {
     op->commit_records(commit_id());
   }
 
   _mark_as_pending_and_try_commit(callback);
+  DTRACE_PROBE2(HYRISE, TRANSACTION_COMMIT, _transaction_id, commit_id());
 
   return true;
 }
@@ -112,6 +138,7 @@ bool TransactionContext::_abort() {
 
   if (!success) return false;
 
+  DTRACE_PROBE1(HYRISE, TRANSACTION_ABORT, _transaction_id);
   _wait_for_active_operators_to_finish();
   return true;
 }
@@ -146,6 +173,9 @@ bool TransactionContext::_prepare_commit() {
 
   _wait_for_active_operators_to_finish();
 
+  // Read-only transactions do not take part in the chain of commit contexts
+  if (_rw_operators.empty()) return true;
+
   _commit_context = TransactionManager::get()._new_commit_context();
   return true;
 }
@@ -160,12 +190,14 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
               "All read/write operators need to have been committed.");
 
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
+  const auto commit_id = this->commit_id();
+  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback, commit_id](auto transaction_id) {
     // If the transaction context still exists, set its phase to Committed.
     if (auto context_ptr = context_weak_ptr.lock()) {
       context_ptr->_phase = TransactionPhase::Committed;
     }
 
+    ExecutionHooks::get().transaction_committed.fire(transaction_id, commit_id);
     if (callback) callback(transaction_id);
   });
 
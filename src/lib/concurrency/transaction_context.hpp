@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "cancellation_token.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -46,6 +47,10 @@ enum class TransactionPhase {
 
 /**
  * @brief Representation of a transaction
+ *
+ * Transactions that have not registered any read/write operator when they commit are read-only. They go from Active
+ * directly to Committed: They neither get a commit id nor a CommitContext, and they do not wait for other transactions
+ * to commit. Their snapshot commit id is all they need.
  */
 class TransactionContext : public std::enable_shared_from_this<TransactionContext> {
   friend class TransactionManager;
@@ -68,7 +73,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * The commit id that this transaction has once it is committed. This is the one that is written to the
    * begin/end commit ids of rows modified by this transaction.
-   * Only available after TransactionManager::prepare_commit has been called
+   * Only available after TransactionManager::prepare_commit has been called and never for read-only transactions
    */
   CommitID commit_id() const;
 
@@ -112,6 +117,19 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
 
+  /**
+   * Whether the transaction has modified data, i.e., whether it might see its own, uncommitted changes. Transactions
+   * without read/write operators are committed as read-only transactions.
+   */
+  bool has_read_write_operators() const { return !_rw_operators.empty(); }
+
+  /**
+   * Cancels all statements of the transaction, including their subqueries, see CancellationToken. A statement that is
+   * cancelled rolls back its transaction.
+   */
+  CancellationToken& cancellation_token() { return _cancellation_token; }
+  const CancellationToken& cancellation_token() const { return _cancellation_token; }
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -141,7 +159,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Sets transaction phase to Committing.
-   * Creates a new commit context and assigns a new commit id.
+   * Creates a new commit context and assigns a new commit id, unless the transaction is read-only.
    * All operators within this context must be finished and
    * none of the registered operators should have failed when
    * calling this function.
@@ -182,6 +200,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   std::atomic_size_t _num_active_operators;
 
+  CancellationToken _cancellation_token;
+
   mutable std::condition_variable _active_operators_cv;
   mutable std::mutex _active_operators_mutex;
 };
@@ -1,5 +1,7 @@
 #include "transaction_manager.hpp"
 
+#include <thread>
+
 #include "commit_context.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
@@ -12,14 +14,18 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
-  Assert(manager._active_snapshot_commit_ids.empty(),
+  manager._max_commit_group_size = DEFAULT_MAX_COMMIT_GROUP_SIZE;
+  manager._group_commit_window = DEFAULT_GROUP_COMMIT_WINDOW;
+  Assert(!manager._active_snapshot_commit_ids.lowest(),
          "Some transactions do not seem to have finished yet as they are still registered as active.")
 }
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)},
+      _max_commit_group_size{DEFAULT_MAX_COMMIT_GROUP_SIZE},
+      _group_commit_window{DEFAULT_GROUP_COMMIT_WINDOW} {}
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
@@ -29,37 +35,28 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
 }
 
 void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
   _active_snapshot_commit_ids.insert(snapshot_commit_id);
 }
 
 void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
-
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
-    return;
-  }
-
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+  _active_snapshot_commit_ids.erase(snapshot_commit_id);
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-
-  if (_active_snapshot_commit_ids.empty()) {
-    return std::nullopt;
-  }
+  return _active_snapshot_commit_ids.lowest();
+}
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+void TransactionManager::set_group_commit(const size_t max_group_size, const std::chrono::microseconds window) {
+  Assert(max_group_size > 0, "A commit group needs to contain at least one transaction");
+  Assert(window.count() >= 0, "Group commit window must not be negative");
+  _max_commit_group_size = max_group_size;
+  _group_commit_window = window;
 }
 
+size_t TransactionManager::max_commit_group_size() const { return _max_commit_group_size; }
+
+std::chrono::microseconds TransactionManager::group_commit_window() const { return _group_commit_window; }
+
 /**
  * Logic of the lock-free algorithm
  *
@@ -100,20 +97,83 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
+void TransactionManager::_advance_last_commit_id(const CommitID commit_id) {
+  Assert(!get_lowest_active_snapshot_commit_id(), "Cannot change the last commit id while transactions are active");
+  if (commit_id <= _last_commit_id) return;
+
+  _last_commit_id = commit_id;
+  std::atomic_store(&_last_commit_context, std::make_shared<CommitContext>(commit_id));
+}
+
+/**
+ * Group commit
+ *
+ * A context can only be committed once its predecessor has been committed, i.e., once _last_commit_id is its commit
+ * id - 1. The thread that finds its context in this position collects the group of directly following pending
+ * contexts and commits them by advancing _last_commit_id to the commit id of the group's last context. As this is a
+ * single compare-and-swap, only one thread succeeds if several threads try to commit the same (or an overlapping)
+ * group. That thread fires the callbacks of the group and continues with the next group.
+ *
+ * A context that becomes pending after the group was collected is not missed: Its thread marks it as pending before
+ * checking _last_commit_id, and the committing thread checks whether the next context is pending after advancing
+ * _last_commit_id. At least one of them sees the state of the other.
+ */
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
+  auto group_begin = context;
+  auto wait_for_group = _group_commit_window.load().count() > 0;
+
+  while (group_begin->is_pending()) {
+    const auto previous_commit_id = group_begin->commit_id() - 1;
+    if (_last_commit_id != previous_commit_id) return;
+
+    // Only the group started by the calling thread's own context waits. Contexts that became pending in the meantime
+    // form the following groups.
+    if (wait_for_group) {
+      _wait_for_commit_group(group_begin);
+      wait_for_group = false;
+    }
+
+    const auto group_end = _commit_group_end(group_begin).first;
+
+    auto expected_last_commit_id = previous_commit_id;
+    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, group_end->commit_id())) return;
+
+    for (auto current_context = group_begin;; current_context = current_context->next()) {
+      current_context->fire_callback();
+      if (current_context == group_end) break;
+    }
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+    if (!group_end->has_next()) return;
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    group_begin = group_end->next();
+  }
+}
 
-    current_context->fire_callback();
+void TransactionManager::_wait_for_commit_group(const std::shared_ptr<CommitContext>& group_begin) const {
+  const auto deadline = std::chrono::steady_clock::now() + _group_commit_window.load();
+  const auto max_group_size = _max_commit_group_size.load();
 
-    if (!current_context->has_next()) return;
+  while (_commit_group_end(group_begin).second < max_group_size &&
+         _last_commit_id == group_begin->commit_id() - 1 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+}
 
-    current_context = current_context->next();
+std::pair<std::shared_ptr<CommitContext>, size_t> TransactionManager::_commit_group_end(
+    const std::shared_ptr<CommitContext>& group_begin) const {
+  const auto max_group_size = _max_commit_group_size.load();
+
+  auto group_end = group_begin;
+  auto group_size = size_t{1};
+  while (group_size < max_group_size) {
+    const auto next_context = group_end->next();
+    if (!next_context || !next_context->is_pending()) break;
+
+    group_end = next_context;
+    ++group_size;
   }
+
+  return {group_end, group_size};
 }
 
 }  // namespace opossum
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
-#include <mutex>
-#include <unordered_set>
+#include <optional>
+#include <utility>
 
+#include "active_snapshot_commit_ids.hpp"
 #include "types.hpp"
 #include "utils/singleton.hpp"
 
@@ -34,7 +36,11 @@
  *
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
- * a new commit ID that is used to make its changes visible to others.
+ * a new commit ID that is used to make its changes visible to others. Read-only transactions, i.e., transactions
+ * without read/write operators, skip the commit phase and never get a CommitContext.
+ *
+ * Transactions that are ready to be committed with consecutive commit IDs are committed as a group, i.e., the last
+ * commit ID is advanced past all of them with a single atomic update (group commit, see set_group_commit()).
  */
 
 namespace opossum {
@@ -66,26 +72,53 @@ class TransactionManager : public Singleton<TransactionManager> {
    */
   std::optional<CommitID> get_lowest_active_snapshot_commit_id() const;
 
+  /**
+   * Configures the group commit. A group contains at most max_group_size transactions. The transaction that is next
+   * in line to be committed waits for up to window for following transactions to become ready, so that they can be
+   * committed together. Larger windows reduce the per-commit overhead under high commit rates at the cost of commit
+   * latency. With a window of zero (the default), only transactions that are already ready join the group.
+   */
+  void set_group_commit(const size_t max_group_size, const std::chrono::microseconds window);
+
+  size_t max_commit_group_size() const;
+  std::chrono::microseconds group_commit_window() const;
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed)
   static constexpr auto INVALID_TRANSACTION_ID = TransactionID{0};
   static constexpr auto INITIAL_TRANSACTION_ID = TransactionID{1};
 
+  static constexpr auto DEFAULT_MAX_COMMIT_GROUP_SIZE = size_t{64};
+  static constexpr auto DEFAULT_GROUP_COMMIT_WINDOW = std::chrono::microseconds{0};
+
  private:
   TransactionManager();
 
   friend class Singleton;
   friend class TransactionContext;
+  friend class WriteAheadLog;
 
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Used by the recovery, so that new transactions see the recovered rows and get higher commit ids than the logged
+  // ones. Must not be called while transactions are active.
+  void _advance_last_commit_id(const CommitID commit_id);
+
+  // Waits until the group of pending contexts starting at group_begin is complete, the window has passed, or another
+  // thread committed the group
+  void _wait_for_commit_group(const std::shared_ptr<CommitContext>& group_begin) const;
+
+  // Returns the last context of the group of pending contexts starting at group_begin and the size of the group
+  std::pair<std::shared_ptr<CommitContext>, size_t> _commit_group_end(
+      const std::shared_ptr<CommitContext>& group_begin) const;
+
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
    * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * snapshot-commit-ids up to date. They do not lock, see ActiveSnapshotCommitIds.
    */
   void _register_transaction(CommitID snapshot_commit_id);
   void _deregister_transaction(CommitID snapshot_commit_id);
@@ -99,7 +132,9 @@ class TransactionManager : public Singleton<TransactionManager> {
 
   std::shared_ptr<CommitContext> _last_commit_context;
 
-  mutable std::mutex _mutex_active_snapshot_commit_ids;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  std::atomic<size_t> _max_commit_group_size;
+  std::atomic<std::chrono::microseconds> _group_commit_window;
+
+  ActiveSnapshotCommitIds _active_snapshot_commit_ids;
 };
 }  // namespace opossum
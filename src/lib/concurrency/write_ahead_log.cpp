@@ -0,0 +1,941 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "import_export/mapped_file_reader.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto LOG_FILE_PREFIX = std::string{"wal_"};
+const auto LOG_FILE_EXTENSION = std::string{".log"};
+const auto CHECKPOINT_FILE_PREFIX = std::string{"checkpoint_"};
+const auto CHECKPOINT_FILE_EXTENSION = std::string{".bin"};
+const auto TEMPORARY_FILE_EXTENSION = std::string{".tmp"};
+
+/**
+ * Each record of the log is framed by a header, so that a record that was only partially written before a crash is
+ * detected during recovery.
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Payload size          | uint32_t                              |   4
+ * Payload checksum      | uint64_t (FNV-1a)                     |   8
+ * Payload               | see below                             |   Payload size
+ *
+ * The payload starts with the RecordType, followed by
+ *   - Commit:      CommitID, table count, and per table: name, column types, the inserted RowIDs with their values,
+ *                  and the deleted RowIDs
+ *   - CreateTable: name, max chunk size, column definitions
+ *   - DropTable:   name
+ */
+enum class RecordType : uint8_t { Commit, CreateTable, DropTable };
+
+constexpr auto RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint64_t);
+
+uint64_t checksum(const char* data, const size_t size) {
+  auto hash = uint64_t{14'695'981'039'346'656'037ull};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= uint64_t{1'099'511'628'211ull};
+  }
+  return hash;
+}
+
+filesystem::path file_path(const filesystem::path& directory, const std::string& prefix, const uint64_t sequence_number,
+                           const std::string& extension) {
+  return directory / (prefix + std::to_string(sequence_number) + extension);
+}
+
+// Returns the files of the directory with the given prefix and extension by their sequence number
+std::map<uint64_t, filesystem::path> list_files(const filesystem::path& directory, const std::string& prefix,
+                                                const std::string& extension) {
+  auto files = std::map<uint64_t, filesystem::path>{};
+  if (!filesystem::exists(directory)) return files;
+
+  for (const auto& entry : filesystem::directory_iterator(directory)) {
+    const auto file_name = entry.path().filename().string();
+    if (file_name.size() <= prefix.size() + extension.size() || file_name.compare(0, prefix.size(), prefix) != 0 ||
+        entry.path().extension() != extension) {
+      continue;
+    }
+
+    const auto number = file_name.substr(prefix.size(), file_name.size() - prefix.size() - extension.size());
+    if (!std::all_of(number.begin(), number.end(), [](const auto character) { return std::isdigit(character); })) {
+      continue;
+    }
+    files.emplace(std::stoull(number), entry.path());
+  }
+  return files;
+}
+
+void write_fully(const int file_descriptor, const char* data, size_t size, const filesystem::path& path) {
+  while (size > 0) {
+    const auto written = ::write(file_descriptor, data, size);
+    if (written < 0 && errno == EINTR) continue;
+    Assert(written > 0, "Could not write to " + path.string() + ": " + std::strerror(errno));
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+}
+
+void sync_file(const int file_descriptor, const filesystem::path& path) {
+  Assert(::fsync(file_descriptor) == 0, "Could not sync " + path.string() + ": " + std::strerror(errno));
+}
+
+// Makes the creation, renaming, or removal of files in the directory durable
+void sync_directory(const filesystem::path& directory) {
+  const auto file_descriptor = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+  Assert(file_descriptor >= 0, "Could not open directory " + directory.string());
+  sync_file(file_descriptor, directory);
+  ::close(file_descriptor);
+}
+
+/**
+ * @defgroup Serialization of the records and the checkpoints
+ * @{
+ */
+template <typename T>
+void write_value(std::string& buffer, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename String>
+void write_string(std::string& buffer, const String& string) {
+  write_value(buffer, static_cast<uint32_t>(string.size()));
+  buffer.append(string.data(), string.size());
+}
+
+void write_variant(std::string& buffer, const DataType data_type, const AllTypeVariant& value) {
+  const auto is_null = variant_is_null(value);
+  write_value(buffer, static_cast<uint8_t>(is_null));
+  if (is_null) return;
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      write_string(buffer, boost::get<pmr_string>(value));
+    } else {
+      write_value(buffer, boost::get<ColumnDataType>(value));
+    }
+  });
+}
+
+void write_column_definitions(std::string& buffer, const TableColumnDefinitions& column_definitions) {
+  write_value(buffer, static_cast<uint16_t>(column_definitions.size()));
+  for (const auto& column_definition : column_definitions) {
+    write_value(buffer, static_cast<uint8_t>(column_definition.data_type));
+    write_value(buffer, static_cast<uint8_t>(column_definition.nullable));
+    write_string(buffer, column_definition.name);
+  }
+}
+
+// Reads the payload of a log record, which has the same interface as the MappedFileReader used for checkpoints
+class RecordReader {
+ public:
+  RecordReader(const char* data, const size_t size) : _data(data), _size(size) {}
+
+  const char* read_bytes(const size_t byte_count) {
+    Assert(byte_count <= _size - _position, "Unexpected end of log record");
+    const auto* const bytes = _data + _position;
+    _position += byte_count;
+    return bytes;
+  }
+
+  template <typename T>
+  T read_value() {
+    auto value = T{};
+    std::memcpy(&value, read_bytes(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+ private:
+  const char* _data;
+  size_t _size;
+  size_t _position{0};
+};
+
+template <typename Reader>
+std::string read_string(Reader& reader) {
+  const auto size = reader.template read_value<uint32_t>();
+  return std::string(reader.read_bytes(size), size);
+}
+
+template <typename Reader>
+AllTypeVariant read_variant(Reader& reader, const DataType data_type) {
+  if (reader.template read_value<uint8_t>()) return NULL_VALUE;
+
+  auto value = AllTypeVariant{};
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      value = pmr_string{read_string(reader)};
+    } else {
+      value = reader.template read_value<ColumnDataType>();
+    }
+  });
+  return value;
+}
+
+template <typename Reader>
+TableColumnDefinitions read_column_definitions(Reader& reader) {
+  const auto column_count = reader.template read_value<uint16_t>();
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = static_cast<DataType>(reader.template read_value<uint8_t>());
+    const auto nullable = static_cast<bool>(reader.template read_value<uint8_t>());
+    column_definitions.emplace_back(read_string(reader), data_type, nullable);
+  }
+  return column_definitions;
+}
+
+std::string frame_record(const std::string& payload) {
+  auto record = std::string{};
+  record.reserve(RECORD_HEADER_SIZE + payload.size());
+  write_value(record, static_cast<uint32_t>(payload.size()));
+  write_value(record, checksum(payload.data(), payload.size()));
+  record.append(payload);
+  return record;
+}
+
+// Calls functor(RecordReader&) for the payload of each complete record of the log file. Reading stops at the first
+// record that was not written entirely, which can only be the last one.
+template <typename Functor>
+void for_each_record(const filesystem::path& path, const Functor& functor) {
+  auto file = MappedFileReader{path.string()};
+  while (file.size() - file.position() >= RECORD_HEADER_SIZE) {
+    const auto payload_size = file.read_value<uint32_t>();
+    const auto payload_checksum = file.read_value<uint64_t>();
+    if (payload_size > file.size() - file.position()) return;
+
+    const auto* const payload = file.read_bytes(payload_size);
+    if (checksum(payload, payload_size) != payload_checksum) return;
+
+    auto reader = RecordReader{payload, payload_size};
+    functor(reader);
+  }
+}
+/** @} */
+
+/**
+ * @defgroup Checkpoints
+ *
+ * A checkpoint file starts with the snapshot commit id and a directory of the tables, so that the tables can be read
+ * in parallel:
+ *   CommitID, table count, and per table: name, offset of the table in the file
+ *
+ * Each table consists of its max chunk size, its column definitions, its chunk count, and per chunk a flag whether
+ * the chunk was removed. Chunks that were not removed are written with ExportBinary::write_chunk(), followed by their
+ * row count and one byte per row that tells whether the row is visible.
+ * @{
+ */
+
+// Copies the rows of the chunk that are visible at the snapshot commit id into ValueSegments. All other rows are
+// replaced by placeholders, as their values might be written concurrently.
+std::shared_ptr<Chunk> materialize_visible_rows(const Table& table, const Chunk& chunk,
+                                                const CommitID snapshot_commit_id, std::vector<uint8_t>& is_visible) {
+  const auto row_count = chunk.size();
+  is_visible.resize(row_count);
+  {
+    const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      is_visible[chunk_offset] = mvcc_data->get_begin_cid(chunk_offset) <= snapshot_commit_id &&
+                                 mvcc_data->get_end_cid(chunk_offset) > snapshot_commit_id;
+    }
+  }
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto nullable = table.column_is_nullable(column_id);
+    const auto segment = chunk.get_segment(column_id);
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>(row_count);
+      auto null_values = NullValueVector(nullable ? row_count : 0);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        const auto value = is_visible[chunk_offset] ? (*segment)[chunk_offset] : NULL_VALUE;
+        if (variant_is_null(value)) {
+          if (nullable) null_values[chunk_offset] = true;
+          continue;
+        }
+
+        values[chunk_offset] = boost::get<ColumnDataType>(value);
+      }
+
+      if (nullable) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+  return std::make_shared<Chunk>(segments);
+}
+
+std::string serialize_table(const Table& table, const CommitID snapshot_commit_id) {
+  auto buffer = std::string{};
+  write_value(buffer, table.max_chunk_size());
+  write_column_definitions(buffer, table.column_definitions());
+
+  const auto chunk_count = table.chunk_count();
+  write_value(buffer, static_cast<uint32_t>(chunk_count));
+
+  auto is_visible = std::vector<uint8_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    write_value(buffer, static_cast<uint8_t>(!chunk));
+    if (!chunk) continue;
+
+    const auto materialized_chunk = materialize_visible_rows(table, *chunk, snapshot_commit_id, is_visible);
+    auto stream = std::ostringstream{};
+    ExportBinary::write_chunk(*materialized_chunk, table.column_definitions(), stream);
+    buffer.append(stream.str());
+
+    write_value(buffer, static_cast<uint32_t>(is_visible.size()));
+    buffer.append(reinterpret_cast<const char*>(is_visible.data()), is_visible.size());
+  }
+
+  return buffer;
+}
+
+std::shared_ptr<Table> deserialize_table(MappedFileReader& file) {
+  const auto max_chunk_size = file.read_value<uint32_t>();
+  const auto column_definitions = read_column_definitions(file);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, UseMvcc::Yes);
+
+  const auto chunk_count = file.read_value<uint32_t>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto is_removed = file.read_value<uint8_t>();
+    if (is_removed) {
+      // Keep the ChunkIDs of the following chunks
+      table->append_mutable_chunk();
+      table->remove_chunk(chunk_id);
+      continue;
+    }
+
+    const auto segments = ImportBinary::read_chunk(file, column_definitions);
+    const auto row_count = file.read_value<uint32_t>();
+    const auto* const is_visible = file.read_bytes(row_count);
+
+    // Visible rows exist "from the beginning of time", the others are invisible placeholders like rolled back rows
+    const auto mvcc_data = std::make_shared<MvccData>(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (!is_visible[chunk_offset]) mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+    }
+    table->append_chunk(std::make_shared<Chunk>(segments, mvcc_data));
+  }
+
+  return table;
+}
+/** @} */
+
+/**
+ * @defgroup Replay of the log
+ * @{
+ */
+
+// An operation on a single table, in the order in which they were logged
+struct TableOperation {
+  enum class Type { Create, Drop, Insert, Delete };
+
+  explicit TableOperation(const Type init_type, const CommitID init_commit_id = CommitID{0})
+      : type(init_type), commit_id(init_commit_id) {}
+
+  Type type;
+  CommitID commit_id;
+
+  // Create
+  TableColumnDefinitions column_definitions;
+  uint32_t max_chunk_size{0};
+
+  // Insert and Delete
+  std::vector<RowID> row_ids;
+  std::vector<std::vector<AllTypeVariant>> values;
+};
+
+// Returns the chunk that contains the row and appends rows that are invisible to everyone up to it, as the rows
+// in between might have been inserted by transactions that did not commit. Returns nullptr if the chunk was removed.
+std::shared_ptr<Chunk> chunk_with_row(Table& table, const RowID& row_id) {
+  while (table.chunk_count() <= row_id.chunk_id) {
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (!chunk) return nullptr;
+
+  if (chunk->size() <= row_id.chunk_offset) {
+    auto placeholder_values = std::vector<AllTypeVariant>{};
+    for (const auto& column_definition : table.column_definitions()) {
+      resolve_data_type(column_definition.data_type, [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        placeholder_values.emplace_back(column_definition.nullable ? NULL_VALUE : AllTypeVariant{ColumnDataType{}});
+      });
+    }
+
+    while (chunk->size() <= row_id.chunk_offset) {
+      chunk->append(placeholder_values);
+      auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      const auto chunk_offset = static_cast<ChunkOffset>(chunk->size() - 1);
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+      mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+    }
+  }
+
+  return chunk;
+}
+
+void replay_insert(Table& table, const RowID& row_id, const std::vector<AllTypeVariant>& values,
+                   const CommitID commit_id) {
+  const auto chunk = chunk_with_row(table, row_id);
+  if (!chunk) return;
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(segment, "Recovered rows are expected to be stored in ValueSegments");
+
+      const auto& value = values[column_id];
+      if (segment->is_nullable()) segment->null_values()[row_id.chunk_offset] = variant_is_null(value);
+      if (!variant_is_null(value)) segment->values()[row_id.chunk_offset] = boost::get<ColumnDataType>(value);
+    });
+  }
+
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  mvcc_data->set_begin_cid(row_id.chunk_offset, commit_id);
+  mvcc_data->set_end_cid(row_id.chunk_offset, MvccData::MAX_COMMIT_ID);
+}
+
+void replay_delete(Table& table, const RowID& row_id, const CommitID commit_id) {
+  const auto chunk = chunk_with_row(table, row_id);
+  if (!chunk) return;
+
+  chunk->get_scoped_mvcc_data_lock()->set_end_cid(row_id.chunk_offset, commit_id);
+}
+
+std::shared_ptr<Table> replay(std::shared_ptr<Table> table, const std::vector<TableOperation>& operations) {
+  for (const auto& operation : operations) {
+    switch (operation.type) {
+      case TableOperation::Type::Create:
+        table = std::make_shared<Table>(operation.column_definitions, TableType::Data, operation.max_chunk_size,
+                                        UseMvcc::Yes);
+        break;
+      case TableOperation::Type::Drop:
+        table = nullptr;
+        break;
+      case TableOperation::Type::Insert:
+        if (!table) break;
+        for (auto index = size_t{0}; index < operation.row_ids.size(); ++index) {
+          replay_insert(*table, operation.row_ids[index], operation.values[index], operation.commit_id);
+        }
+        break;
+      case TableOperation::Type::Delete:
+        if (!table) break;
+        for (const auto& row_id : operation.row_ids) {
+          replay_delete(*table, row_id, operation.commit_id);
+        }
+        break;
+    }
+  }
+
+  if (!table) return nullptr;
+
+  // Count the rows that are not visible anymore. The chunks stay mutable, so that the ChunkCompressionService
+  // compresses them once they are completed.
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    auto invalid_row_count = uint64_t{0};
+    {
+      auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        invalid_row_count += mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID;
+      }
+      mvcc_data->has_invalidated_rows = invalid_row_count > 0;
+    }
+    chunk->increase_invalid_row_count(invalid_row_count);
+  }
+
+  return table;
+}
+/** @} */
+
+}  // namespace
+
+namespace opossum {
+
+WriteAheadLog::~WriteAheadLog() { disable(); }
+
+void WriteAheadLog::enable(const filesystem::path& directory) {
+  std::lock_guard<std::mutex> lock{_mutex};
+  Assert(_file_descriptor < 0, "Logging is already enabled");
+
+  filesystem::create_directories(directory);
+  _directory = directory;
+
+  // Existing log files are replayed by a later recovery, so that they are only removed once a checkpoint covers them
+  auto sequence_number = uint64_t{0};
+  for (const auto& [log_sequence_number, path] : list_files(directory, LOG_FILE_PREFIX, LOG_FILE_EXTENSION)) {
+    auto max_commit_id = CommitID{0};
+    for_each_record(path, [&](auto& reader) {
+      if (static_cast<RecordType>(reader.template read_value<uint8_t>()) != RecordType::Commit) return;
+      max_commit_id = std::max(max_commit_id, reader.template read_value<CommitID>());
+    });
+    _max_commit_ids[log_sequence_number] = max_commit_id;
+    sequence_number = std::max(sequence_number, log_sequence_number);
+  }
+  for (const auto& checkpoint : list_files(directory, CHECKPOINT_FILE_PREFIX, CHECKPOINT_FILE_EXTENSION)) {
+    sequence_number = std::max(sequence_number, checkpoint.first);
+  }
+
+  _flush_count = 0;
+  _open_log_file(sequence_number + 1);
+}
+
+void WriteAheadLog::disable() {
+  stop_checkpointing();
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  if (_file_descriptor < 0) return;
+
+  while (_is_flushing || !_buffer.empty()) {
+    if (_is_flushing) {
+      _flushed.wait(lock);
+    } else {
+      _flush(lock);
+    }
+  }
+  _close_log_file();
+  _max_commit_ids.clear();
+}
+
+bool WriteAheadLog::is_enabled() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _file_descriptor >= 0;
+}
+
+filesystem::path WriteAheadLog::directory() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _directory;
+}
+
+void WriteAheadLog::log_commit(const CommitID commit_id, const TransactionChanges& changes) {
+  // The changes of each operator are grouped by table, as the record contains the table names, not the tables
+  struct ChangesOfTable {
+    std::shared_ptr<const Table> table;
+    std::vector<const PosList*> inserted_rows;
+    std::vector<const PosList*> deleted_rows;
+  };
+  auto changes_by_table = std::unordered_map<std::string, ChangesOfTable>{};
+
+  const auto& tables = StorageManager::get().tables();
+  const auto table_name = [&](const std::shared_ptr<const Table>& table) -> const std::string* {
+    const auto iter = std::find_if(tables.cbegin(), tables.cend(),
+                                   [&](const auto& name_and_table) { return name_and_table.second == table; });
+    return iter != tables.cend() ? &iter->first : nullptr;
+  };
+
+  for (const auto& [table, row_ids] : changes.inserted_rows) {
+    const auto* const name = table_name(table);
+    if (!name || row_ids->empty()) continue;
+    auto& changes_of_table = changes_by_table[*name];
+    changes_of_table.table = table;
+    changes_of_table.inserted_rows.emplace_back(row_ids);
+  }
+  for (const auto& [table, row_ids] : changes.deleted_rows) {
+    const auto* const name = table_name(table);
+    if (!name || row_ids->empty()) continue;
+    auto& changes_of_table = changes_by_table[*name];
+    changes_of_table.table = table;
+    changes_of_table.deleted_rows.emplace_back(row_ids);
+  }
+
+  if (changes_by_table.empty()) return;
+
+  auto payload = std::string{};
+  write_value(payload, static_cast<uint8_t>(RecordType::Commit));
+  write_value(payload, commit_id);
+  write_value(payload, static_cast<uint32_t>(changes_by_table.size()));
+
+  for (const auto& [name, changes_of_table] : changes_by_table) {
+    const auto& table = *changes_of_table.table;
+    write_string(payload, name);
+
+    // The column types are part of the record, so that it can be read without knowing the table
+    write_value(payload, static_cast<uint16_t>(table.column_count()));
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      write_value(payload, static_cast<uint8_t>(table.column_data_type(column_id)));
+    }
+
+    auto inserted_row_count = uint32_t{0};
+    for (const auto* const row_ids : changes_of_table.inserted_rows) inserted_row_count += row_ids->size();
+    write_value(payload, inserted_row_count);
+
+    for (const auto* const row_ids : changes_of_table.inserted_rows) {
+      for (const auto& row_id : *row_ids) {
+        write_value(payload, row_id.chunk_id);
+        write_value(payload, row_id.chunk_offset);
+
+        // The rows are locked by the committing transaction, so that their values do not change anymore
+        const auto chunk = table.get_chunk(row_id.chunk_id);
+        for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+          write_variant(payload, table.column_data_type(column_id),
+                        (*chunk->get_segment(column_id))[row_id.chunk_offset]);
+        }
+      }
+    }
+
+    auto deleted_row_count = uint32_t{0};
+    for (const auto* const row_ids : changes_of_table.deleted_rows) deleted_row_count += row_ids->size();
+    write_value(payload, deleted_row_count);
+
+    for (const auto* const row_ids : changes_of_table.deleted_rows) {
+      for (const auto& row_id : *row_ids) {
+        write_value(payload, row_id.chunk_id);
+        write_value(payload, row_id.chunk_offset);
+      }
+    }
+  }
+
+  _append(frame_record(payload), commit_id);
+}
+
+void WriteAheadLog::log_create_table(const std::string& table_name, const Table& table) {
+  auto payload = std::string{};
+  write_value(payload, static_cast<uint8_t>(RecordType::CreateTable));
+  write_string(payload, table_name);
+  write_value(payload, table.max_chunk_size());
+  write_column_definitions(payload, table.column_definitions());
+  _append(frame_record(payload), CommitID{0});
+}
+
+void WriteAheadLog::log_drop_table(const std::string& table_name) {
+  auto payload = std::string{};
+  write_value(payload, static_cast<uint8_t>(RecordType::DropTable));
+  write_string(payload, table_name);
+  _append(frame_record(payload), CommitID{0});
+}
+
+void WriteAheadLog::_append(const std::string& record, const CommitID commit_id) {
+  std::unique_lock<std::mutex> lock{_mutex};
+  Assert(_file_descriptor >= 0, "Logging is not enabled");
+
+  _buffer.append(record);
+  auto& max_commit_id = _max_commit_ids[_sequence_number];
+  max_commit_id = std::max(max_commit_id, commit_id);
+  const auto record_number = ++_appended_record_count;
+
+  // Group fsync: If no flush is running, this thread writes all buffered records. Otherwise, it waits for the running
+  // flush, which either contains its record or is followed by a flush that does.
+  while (_durable_record_count < record_number) {
+    if (_is_flushing) {
+      _flushed.wait(lock);
+    } else {
+      _flush(lock);
+    }
+  }
+}
+
+void WriteAheadLog::_flush(std::unique_lock<std::mutex>& lock) {
+  DebugAssert(!_is_flushing, "Only one flush can run at a time");
+  _is_flushing = true;
+
+  auto buffer = std::string{};
+  buffer.swap(_buffer);
+  const auto record_count = _appended_record_count;
+  const auto file_descriptor = _file_descriptor;
+  const auto path = file_path(_directory, LOG_FILE_PREFIX, _sequence_number, LOG_FILE_EXTENSION);
+
+  lock.unlock();
+  write_fully(file_descriptor, buffer.data(), buffer.size(), path);
+  sync_file(file_descriptor, path);
+  lock.lock();
+
+  _durable_record_count = record_count;
+  _is_flushing = false;
+  ++_flush_count;
+  _flushed.notify_all();
+}
+
+void WriteAheadLog::_open_log_file(const uint64_t sequence_number) {
+  const auto path = file_path(_directory, LOG_FILE_PREFIX, sequence_number, LOG_FILE_EXTENSION);
+  _file_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+  Assert(_file_descriptor >= 0, "Could not open log file " + path.string() + ": " + std::strerror(errno));
+  sync_directory(_directory);
+
+  _sequence_number = sequence_number;
+  _max_commit_ids.emplace(sequence_number, CommitID{0});
+}
+
+void WriteAheadLog::_close_log_file() {
+  DebugAssert(!_is_flushing && _buffer.empty(), "Log file has to be flushed before it is closed");
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+CommitID WriteAheadLog::checkpoint() {
+  std::lock_guard<std::mutex> checkpoint_lock{_checkpoint_mutex};
+
+  auto checkpoint_sequence_number = uint64_t{0};
+  auto snapshot_commit_id = CommitID{0};
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  auto directory = filesystem::path{};
+
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    Assert(_file_descriptor >= 0, "Checkpoints require logging to be enabled");
+
+    while (_is_flushing || !_buffer.empty()) {
+      if (_is_flushing) {
+        _flushed.wait(lock);
+      } else {
+        _flush(lock);
+      }
+    }
+
+    // All table creations and removals logged from now on are not part of the checkpoint. As commit records are
+    // logged before the transaction becomes visible, all transactions up to the snapshot commit id are already logged.
+    _close_log_file();
+    _open_log_file(_sequence_number + 1);
+    checkpoint_sequence_number = _sequence_number;
+    snapshot_commit_id = TransactionManager::get().last_commit_id();
+    tables = StorageManager::get().tables();
+    directory = _directory;
+  }
+
+  auto table_names = std::vector<std::string>{};
+  auto serialized_tables = std::vector<std::string>(tables.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [table_name, table] : tables) {
+    table_names.emplace_back(table_name);
+    jobs.emplace_back(std::make_shared<JobTask>(
+        [&, &table = table, table_index = table_names.size() - 1]() {
+          serialized_tables[table_index] = serialize_table(*table, snapshot_commit_id);
+        }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto header_size = sizeof(CommitID) + sizeof(uint32_t);
+  for (const auto& table_name : table_names) header_size += sizeof(uint32_t) + table_name.size() + sizeof(uint64_t);
+
+  auto header = std::string{};
+  write_value(header, snapshot_commit_id);
+  write_value(header, static_cast<uint32_t>(table_names.size()));
+  auto table_offset = static_cast<uint64_t>(header_size);
+  for (auto table_index = size_t{0}; table_index < table_names.size(); ++table_index) {
+    write_string(header, table_names[table_index]);
+    write_value(header, table_offset);
+    table_offset += serialized_tables[table_index].size();
+  }
+
+  // The checkpoint is written to a temporary file first, so that a crash never leaves an incomplete checkpoint
+  const auto temporary_path =
+      file_path(directory, CHECKPOINT_FILE_PREFIX, checkpoint_sequence_number, TEMPORARY_FILE_EXTENSION);
+  const auto file_descriptor = ::open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  Assert(file_descriptor >= 0, "Could not create checkpoint " + temporary_path.string());
+  write_fully(file_descriptor, header.data(), header.size(), temporary_path);
+  for (const auto& serialized_table : serialized_tables) {
+    write_fully(file_descriptor, serialized_table.data(), serialized_table.size(), temporary_path);
+  }
+  sync_file(file_descriptor, temporary_path);
+  ::close(file_descriptor);
+
+  filesystem::rename(temporary_path, file_path(directory, CHECKPOINT_FILE_PREFIX, checkpoint_sequence_number,
+                                               CHECKPOINT_FILE_EXTENSION));
+  sync_directory(directory);
+
+  _remove_obsolete_files(checkpoint_sequence_number, snapshot_commit_id);
+  return snapshot_commit_id;
+}
+
+void WriteAheadLog::_remove_obsolete_files(const uint64_t checkpoint_sequence_number,
+                                           const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  for (const auto& [sequence_number, path] :
+       list_files(_directory, CHECKPOINT_FILE_PREFIX, CHECKPOINT_FILE_EXTENSION)) {
+    if (sequence_number < checkpoint_sequence_number) filesystem::remove(path);
+  }
+
+  // Log files written before the checkpoint might still contain commit records of transactions that were not visible
+  // to the checkpoint. They are kept until a later checkpoint covers them.
+  for (const auto& [sequence_number, path] : list_files(_directory, LOG_FILE_PREFIX, LOG_FILE_EXTENSION)) {
+    if (sequence_number >= checkpoint_sequence_number) continue;
+
+    const auto iter = _max_commit_ids.find(sequence_number);
+    if (iter == _max_commit_ids.end() || iter->second > snapshot_commit_id) continue;
+
+    filesystem::remove(path);
+    _max_commit_ids.erase(iter);
+  }
+
+  sync_directory(_directory);
+}
+
+void WriteAheadLog::start_checkpointing(const std::chrono::milliseconds interval) {
+  if (_checkpoint_thread) {
+    _checkpoint_thread->set_loop_sleep_time(interval);
+    return;
+  }
+
+  _checkpoint_thread = std::make_unique<PausableLoopThread>(interval, [&](size_t) { checkpoint(); });
+}
+
+void WriteAheadLog::stop_checkpointing() { _checkpoint_thread.reset(); }
+
+size_t WriteAheadLog::recover(const filesystem::path& directory) {
+  Assert(!is_enabled(), "Recovery has to happen before logging is enabled");
+  Assert(StorageManager::get().tables().empty(), "Tables can only be recovered into an empty StorageManager");
+
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  auto snapshot_commit_id = CommitID{0};
+  auto checkpoint_sequence_number = uint64_t{0};
+
+  // Load the tables of the latest checkpoint, one job per table
+  const auto checkpoints = list_files(directory, CHECKPOINT_FILE_PREFIX, CHECKPOINT_FILE_EXTENSION);
+  if (!checkpoints.empty()) {
+    const auto& [sequence_number, path] = *checkpoints.rbegin();
+    checkpoint_sequence_number = sequence_number;
+
+    auto file = MappedFileReader{path.string()};
+    snapshot_commit_id = file.read_value<CommitID>();
+    const auto table_count = file.read_value<uint32_t>();
+
+    auto table_offsets = std::vector<std::pair<std::string, uint64_t>>{};
+    for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+      auto table_name = read_string(file);
+      table_offsets.emplace_back(std::move(table_name), file.read_value<uint64_t>());
+      tables.emplace(table_offsets.back().first, nullptr);
+    }
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (const auto& [table_name, table_offset] : table_offsets) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, &table = tables[table_name], table_offset = table_offset]() {
+        auto table_file = file;
+        table_file.seek(table_offset);
+        table = deserialize_table(table_file);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
+  // Collect the operations that are not covered by the checkpoint per table
+  auto operations = std::map<std::string, std::vector<TableOperation>>{};
+  auto max_commit_id = snapshot_commit_id;
+  auto replayed_record_count = size_t{0};
+
+  for (const auto& [sequence_number, path] : list_files(directory, LOG_FILE_PREFIX, LOG_FILE_EXTENSION)) {
+    const auto is_after_checkpoint = sequence_number >= checkpoint_sequence_number;
+
+    for_each_record(path, [&](auto& reader) {
+      switch (static_cast<RecordType>(reader.template read_value<uint8_t>())) {
+        case RecordType::Commit: {
+          const auto commit_id = reader.template read_value<CommitID>();
+          max_commit_id = std::max(max_commit_id, commit_id);
+          if (commit_id <= snapshot_commit_id) return;
+          ++replayed_record_count;
+
+          const auto table_count = reader.template read_value<uint32_t>();
+          for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+            const auto table_name = read_string(reader);
+
+            auto data_types = std::vector<DataType>(reader.template read_value<uint16_t>());
+            for (auto& data_type : data_types) data_type = static_cast<DataType>(reader.template read_value<uint8_t>());
+
+            auto insert = TableOperation{TableOperation::Type::Insert, commit_id};
+            insert.row_ids.resize(reader.template read_value<uint32_t>());
+            insert.values.resize(insert.row_ids.size());
+            for (auto row_index = size_t{0}; row_index < insert.row_ids.size(); ++row_index) {
+              insert.row_ids[row_index].chunk_id = reader.template read_value<ChunkID>();
+              insert.row_ids[row_index].chunk_offset = reader.template read_value<ChunkOffset>();
+              for (const auto data_type : data_types) {
+                insert.values[row_index].emplace_back(read_variant(reader, data_type));
+              }
+            }
+
+            auto delete_ = TableOperation{TableOperation::Type::Delete, commit_id};
+            delete_.row_ids.resize(reader.template read_value<uint32_t>());
+            for (auto& row_id : delete_.row_ids) {
+              row_id.chunk_id = reader.template read_value<ChunkID>();
+              row_id.chunk_offset = reader.template read_value<ChunkOffset>();
+            }
+
+            auto& table_operations = operations[table_name];
+            if (!insert.row_ids.empty()) table_operations.emplace_back(std::move(insert));
+            if (!delete_.row_ids.empty()) table_operations.emplace_back(std::move(delete_));
+          }
+          return;
+        }
+
+        case RecordType::CreateTable: {
+          if (!is_after_checkpoint) return;
+          auto create = TableOperation{TableOperation::Type::Create};
+          const auto table_name = read_string(reader);
+          create.max_chunk_size = reader.template read_value<uint32_t>();
+          create.column_definitions = read_column_definitions(reader);
+          operations[table_name].emplace_back(std::move(create));
+          return;
+        }
+
+        case RecordType::DropTable: {
+          if (!is_after_checkpoint) return;
+          operations[read_string(reader)].emplace_back(TableOperation{TableOperation::Type::Drop});
+          return;
+        }
+      }
+    });
+  }
+
+  // Replay the operations, one job per table
+  for (const auto& [table_name, table_operations] : operations) tables.emplace(table_name, nullptr);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto& [table_name, table] : tables) {
+    const auto iter = operations.find(table_name);
+    jobs.emplace_back(std::make_shared<JobTask>([&, &table = table, iter]() {
+      table = replay(table, iter != operations.end() ? iter->second : std::vector<TableOperation>{});
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& [table_name, table] : tables) {
+    if (table) StorageManager::get().add_table(table_name, table);
+  }
+
+  TransactionManager::get()._advance_last_commit_id(max_commit_id);
+
+  return replayed_record_count;
+}
+
+size_t WriteAheadLog::flush_count() const { return _flush_count; }
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Makes committed transactions durable with a redo-only, logical write-ahead log and periodic checkpoints.
+ *
+ * Log
+ * When logging is enabled, TransactionContext::commit_async() appends a commit record with the RowIDs of all inserted
+ * (including their values) and deleted rows to the log before the changes are committed, and waits until the record
+ * is on disk. Transactions that commit concurrently share a single fsync (group fsync): The first waiting transaction
+ * writes the records of all transactions that were appended up to then and syncs the file, while the others wait for
+ * it. StorageManager::add_table() and drop_table() log the creation and the removal of tables. Rows that a table
+ * contains when it is added are not logged - take a checkpoint after loading tables.
+ *
+ * Checkpoints
+ * A checkpoint contains all tables of the StorageManager with the rows that are visible to its snapshot commit id.
+ * The chunks are written in the format of ExportBinary, so that they can be mapped into memory with the
+ * MappedFileReader when they are recovered. Rows that are not visible are kept as invisible placeholders, so that all
+ * rows keep their RowIDs and the logged RowIDs remain valid. The log is switched to a new file for every checkpoint.
+ * Older log files are removed once all of their commit records are covered by a checkpoint.
+ *
+ * Recovery
+ * recover() loads the latest checkpoint and replays the commit records with a higher commit id as well as the table
+ * creations and removals that were logged after the checkpoint. The tables are loaded and the log is replayed with
+ * one job per table.
+ *
+ * Like the other background services, checkpoints assume that tables are not added to or dropped from the
+ * StorageManager concurrently. The partitioning of tables (see TablePartitioning) is not logged, so that recovered
+ * tables are not partitioned. Logging is disabled by default.
+ */
+class WriteAheadLog : public Singleton<WriteAheadLog> {
+ public:
+  static constexpr auto DEFAULT_CHECKPOINT_INTERVAL = std::chrono::milliseconds{60'000};
+
+  // The rows of a single table that a committing transaction inserted or deleted
+  struct TableRows {
+    std::shared_ptr<const Table> table;
+    const PosList* row_ids;
+  };
+
+  // The changes of a committing transaction, collected from its read/write operators
+  struct TransactionChanges {
+    std::vector<TableRows> inserted_rows;
+    std::vector<TableRows> deleted_rows;
+  };
+
+  ~WriteAheadLog();
+
+  // Starts logging into a new log file in the given directory, which is created if it does not exist. Existing log
+  // files and checkpoints are kept, so call recover() first.
+  void enable(const filesystem::path& directory);
+
+  // Stops the periodic checkpoints and closes the log file
+  void disable();
+
+  bool is_enabled() const;
+  filesystem::path directory() const;
+
+  /**
+   * @defgroup Logging, called by TransactionContext and StorageManager
+   * Changes to tables that are not in the StorageManager are not logged.
+   * @{
+   */
+  // Blocks until the commit record is durable
+  void log_commit(const CommitID commit_id, const TransactionChanges& changes);
+  void log_create_table(const std::string& table_name, const Table& table);
+  void log_drop_table(const std::string& table_name);
+  /** @} */
+
+  // Writes a checkpoint of all tables in the StorageManager and returns its snapshot commit id
+  CommitID checkpoint();
+
+  void start_checkpointing(const std::chrono::milliseconds interval = DEFAULT_CHECKPOINT_INTERVAL);
+  void stop_checkpointing();
+
+  /**
+   * Restores the tables of the StorageManager from the latest checkpoint and the log in the given directory and
+   * advances the last commit id of the TransactionManager past the recovered transactions. Must be called before
+   * logging is enabled, while the StorageManager has no tables and no transaction is active. Returns the number of
+   * replayed commit records.
+   */
+  size_t recover(const filesystem::path& directory);
+
+  // The number of fsyncs of the log since logging was enabled
+  size_t flush_count() const;
+
+ protected:
+  friend class Singleton;
+
+  WriteAheadLog() = default;
+
+  // Appends a serialized record to the log buffer and blocks until it was written and synced
+  void _append(const std::string& record, const CommitID commit_id);
+
+  // Writes and syncs the buffered records. Expects _mutex to be locked by the given lock, which is released during I/O.
+  void _flush(std::unique_lock<std::mutex>& lock);
+
+  // Opens the log file with the given sequence number. Expects _mutex to be locked.
+  void _open_log_file(const uint64_t sequence_number);
+  void _close_log_file();
+
+  // Removes checkpoints and log files that are covered by the checkpoint with the given sequence number
+  void _remove_obsolete_files(const uint64_t checkpoint_sequence_number, const CommitID snapshot_commit_id);
+
+  mutable std::mutex _mutex;
+  std::condition_variable _flushed;
+
+  filesystem::path _directory;
+  int _file_descriptor{-1};
+  uint64_t _sequence_number{0};
+
+  // Records that were appended, but not yet written to the file
+  std::string _buffer;
+  uint64_t _appended_record_count{0};
+  uint64_t _durable_record_count{0};
+  bool _is_flushing{false};
+  std::atomic<size_t> _flush_count{0};
+
+  // The highest commit id logged in each log file, used to decide which files are covered by a checkpoint
+  std::map<uint64_t, CommitID> _max_commit_ids;
+
+  // Makes sure that only one checkpoint is written at a time
+  std::mutex _checkpoint_mutex;
+  std::unique_ptr<PausableLoopThread> _checkpoint_thread;
+};
+
+}  // namespace opossum
@@ -11,8 +11,11 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "utils/make_bimap.hpp"
 
@@ -54,6 +57,9 @@ const std::unordered_map<JoinMode, std::string> join_mode_to_string = {
 
 const std::unordered_map<UnionMode, std::string> union_mode_to_string = {{UnionMode::Positions, "UnionPositions"}};
 
+const std::unordered_map<SetOperationMode, std::string> set_operation_mode_to_string = {
+    {SetOperationMode::Unique, "Unique"}, {SetOperationMode::All, "All"}};
+
 const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string =
     make_bimap<AggregateFunction, std::string>({
         {AggregateFunction::Min, "MIN"},
@@ -62,6 +68,19 @@ const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string
         {AggregateFunction::Avg, "AVG"},
         {AggregateFunction::Count, "COUNT"},
         {AggregateFunction::CountDistinct, "COUNT DISTINCT"},
+        {AggregateFunction::ApproxCountDistinct, "APPROX_COUNT_DISTINCT"},
+    });
+
+const boost::bimap<WindowFunction, std::string> window_function_to_string =
+    make_bimap<WindowFunction, std::string>({
+        {WindowFunction::RowNumber, "ROW_NUMBER"},
+        {WindowFunction::Rank, "RANK"},
+        {WindowFunction::DenseRank, "DENSE_RANK"},
+        {WindowFunction::Sum, "SUM"},
+        {WindowFunction::Avg, "AVG"},
+        {WindowFunction::Count, "COUNT"},
+        {WindowFunction::Min, "MIN"},
+        {WindowFunction::Max, "MAX"},
     });
 
 const boost::bimap<FunctionType, std::string> function_type_to_string =
@@ -79,6 +98,9 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
     {EncodingType::LZ4, "LZ4"},
+    {EncodingType::FrontCodedDictionary, "FrontCodedDictionary"},
+    {EncodingType::Delta, "Delta"},
+    {EncodingType::GlobalDictionary, "GlobalDictionary"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -86,9 +108,48 @@ const boost::bimap<VectorCompressionType, std::string> vector_compression_type_t
     make_bimap<VectorCompressionType, std::string>({
         {VectorCompressionType::FixedSizeByteAligned, "Fixed-size byte-aligned"},
         {VectorCompressionType::SimdBp128, "SIMD-BP128"},
+        {VectorCompressionType::BitPacking, "Bit-packing"},
+    });
+
+const boost::bimap<CompressedVectorType, std::string> compressed_vector_type_to_string =
+    make_bimap<CompressedVectorType, std::string>({
+        {CompressedVectorType::FixedSize4ByteAligned, "FixedSize4ByteAligned"},
+        {CompressedVectorType::FixedSize2ByteAligned, "FixedSize2ByteAligned"},
+        {CompressedVectorType::FixedSize1ByteAligned, "FixedSize1ByteAligned"},
+        {CompressedVectorType::SimdBp128, "SimdBp128"},
+        {CompressedVectorType::BitPacking, "BitPacking"},
     });
 
 const boost::bimap<TableType, std::string> table_type_to_string =
     make_bimap<TableType, std::string>({{TableType::Data, "Data"}, {TableType::References, "References"}});
 
+const std::unordered_map<LQPNodeType, std::string> lqp_node_type_to_string = {
+    {LQPNodeType::Aggregate, "Aggregate"},
+    {LQPNodeType::Alias, "Alias"},
+    {LQPNodeType::CreateTable, "CreateTable"},
+    {LQPNodeType::CreatePreparedPlan, "CreatePreparedPlan"},
+    {LQPNodeType::CreateView, "CreateView"},
+    {LQPNodeType::Delete, "Delete"},
+    {LQPNodeType::DropView, "DropView"},
+    {LQPNodeType::DropTable, "DropTable"},
+    {LQPNodeType::DummyTable, "DummyTable"},
+    {LQPNodeType::Except, "Except"},
+    {LQPNodeType::Insert, "Insert"},
+    {LQPNodeType::IntermediateResult, "IntermediateResult"},
+    {LQPNodeType::Intersect, "Intersect"},
+    {LQPNodeType::Join, "Join"},
+    {LQPNodeType::Limit, "Limit"},
+    {LQPNodeType::Predicate, "Predicate"},
+    {LQPNodeType::Projection, "Projection"},
+    {LQPNodeType::Root, "Root"},
+    {LQPNodeType::ShowColumns, "ShowColumns"},
+    {LQPNodeType::ShowTables, "ShowTables"},
+    {LQPNodeType::Sort, "Sort"},
+    {LQPNodeType::StoredTable, "StoredTable"},
+    {LQPNodeType::Update, "Update"},
+    {LQPNodeType::Union, "Union"},
+    {LQPNodeType::Validate, "Validate"},
+    {LQPNodeType::Window, "Window"},
+    {LQPNodeType::Mock, "Mock"}};
+
 }  // namespace opossum
@@ -13,8 +13,11 @@ namespace opossum {
 
 enum class EncodingType : uint8_t;
 enum class VectorCompressionType : uint8_t;
+enum class CompressedVectorType : uint8_t;
 enum class AggregateFunction;
+enum class WindowFunction;
 enum class ExpressionType;
+enum class LQPNodeType;
 enum class TableType;
 
 extern const boost::bimap<PredicateCondition, std::string> predicate_condition_to_string;
@@ -23,11 +26,15 @@ extern const std::unordered_map<hsql::OrderType, OrderByMode> order_type_to_orde
 extern const std::unordered_map<ExpressionType, std::string> expression_type_to_operator_string;
 extern const std::unordered_map<JoinMode, std::string> join_mode_to_string;
 extern const std::unordered_map<UnionMode, std::string> union_mode_to_string;
+extern const std::unordered_map<SetOperationMode, std::string> set_operation_mode_to_string;
 extern const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string;
+extern const boost::bimap<WindowFunction, std::string> window_function_to_string;
 extern const boost::bimap<FunctionType, std::string> function_type_to_string;
 extern const boost::bimap<DataType, std::string> data_type_to_string;
 extern const boost::bimap<EncodingType, std::string> encoding_type_to_string;
 extern const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string;
+extern const boost::bimap<CompressedVectorType, std::string> compressed_vector_type_to_string;
 extern const boost::bimap<TableType, std::string> table_type_to_string;
+extern const std::unordered_map<LQPNodeType, std::string> lqp_node_type_to_string;
 
 }  // namespace opossum
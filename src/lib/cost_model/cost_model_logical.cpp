@@ -23,6 +23,7 @@ Cost CostModelLogical::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode
       return left_input_row_count + right_input_row_count + output_row_count;
 
     case LQPNodeType::Sort:
+    case LQPNodeType::Window:
       return left_input_row_count * std::log(left_input_row_count);
 
     case LQPNodeType::Union: {
@@ -0,0 +1,223 @@
+#include "cost_model_physical.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_range.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The predicate conditions supported by JoinSortMerge and JoinIndex
+bool is_comparison(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals ||
+         predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+JoinInputFeatures input_features(const std::shared_ptr<AbstractLQPNode>& input, const ColumnID column_id,
+                                 const PredicateCondition predicate_condition) {
+  auto features = JoinInputFeatures{};
+  features.row_count = input->get_statistics()->row_count();
+
+  // A Validate keeps the order of the chunks of a stored table, but its output consists of ReferenceSegments, so that
+  // neither the encoding nor the indexes of the stored table can be used by the join
+  const auto is_validated = input->type == LQPNodeType::Validate;
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(is_validated ? input->left_input() : input);
+  if (!stored_table_node) return features;
+
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  if (table->row_count() == 0) return features;
+
+  auto presorted_row_count = size_t{0};
+  auto indexed_row_count = size_t{0};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& ordered_by = chunk->ordered_by();
+    const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+    const auto is_dictionary_encoded =
+        encoded_segment && (encoded_segment->encoding_type() == EncodingType::Dictionary ||
+                            encoded_segment->encoding_type() == EncodingType::GlobalDictionary);
+    if ((ordered_by && ordered_by->first == column_id) || (is_dictionary_encoded && !is_validated)) {
+      presorted_row_count += chunk->size();
+    }
+
+    if (is_validated) continue;
+    if (!chunk->get_indices(std::vector<ColumnID>{column_id}).empty() || chunk->get_mutable_index(column_id)) {
+      indexed_row_count += chunk->size();
+      ++features.indexed_chunk_count;
+    }
+  }
+
+  const auto table_row_count = static_cast<float>(table->row_count());
+  features.presorted_share = static_cast<float>(presorted_row_count) / table_row_count;
+  features.indexed_share = static_cast<float>(indexed_row_count) / table_row_count;
+  features.has_table_index =
+      !is_validated && predicate_condition == PredicateCondition::Equals && table->get_table_index(column_id);
+
+  return features;
+}
+
+}  // namespace
+
+namespace opossum {
+
+CostModelPhysical::CostModelPhysical(const JoinCostCoefficients& coefficients) : _coefficients(coefficients) {}
+
+JoinFeatures CostModelPhysical::join_features(const std::shared_ptr<JoinNode>& join_node,
+                                              const OperatorJoinPredicate& join_predicate) {
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+  const auto [left_column_id, right_column_id] = join_predicate.column_ids;
+
+  auto features = JoinFeatures{};
+  features.mode = join_node->join_mode;
+  features.predicate_condition = join_predicate.predicate_condition;
+  features.data_types_match = left_input->column_expressions().at(left_column_id)->data_type() ==
+                              right_input->column_expressions().at(right_column_id)->data_type();
+  features.left = input_features(left_input, left_column_id, join_predicate.predicate_condition);
+  features.right = input_features(right_input, right_column_id, join_predicate.predicate_condition);
+  features.output_row_count = join_node->get_statistics()->row_count();
+
+  return features;
+}
+
+std::optional<Cost> CostModelPhysical::estimate_join_cost(const JoinImplementation join_implementation,
+                                                          const JoinFeatures& join_features) const {
+  const auto mode = join_features.mode;
+  const auto predicate_condition = join_features.predicate_condition;
+  const auto left_row_count = join_features.left.row_count;
+  const auto right_row_count = join_features.right.row_count;
+  const auto output_cost = _coefficients.output * join_features.output_row_count;
+
+  // Only JoinHash and JoinMPSM implement semi and anti joins
+  const auto is_semi_or_anti = mode == JoinMode::Semi || mode == JoinMode::Anti;
+  if (mode == JoinMode::Cross) return std::nullopt;
+
+  switch (join_implementation) {
+    case JoinImplementation::Hash: {
+      if (predicate_condition != PredicateCondition::Equals || mode == JoinMode::Outer) return std::nullopt;
+
+      // See JoinHash::_on_execute() for which input is used to build the hash table
+      auto build_row_count = std::min(left_row_count, right_row_count);
+      if (mode == JoinMode::Left || is_semi_or_anti) build_row_count = right_row_count;
+      if (mode == JoinMode::Right) build_row_count = left_row_count;
+      const auto probe_row_count = left_row_count + right_row_count - build_row_count;
+
+      return _coefficients.hash_build * build_row_count + _coefficients.hash_probe * probe_row_count + output_cost;
+    }
+
+    case JoinImplementation::SortMerge: {
+      if (is_semi_or_anti || !join_features.data_types_match) return std::nullopt;
+      if (predicate_condition == PredicateCondition::NotEquals && mode != JoinMode::Inner) return std::nullopt;
+      if (!is_comparison(predicate_condition)) return std::nullopt;
+
+      return _sort_cost(join_features.left) + _sort_cost(join_features.right) +
+             _coefficients.merge * (left_row_count + right_row_count) + output_cost;
+    }
+
+    case JoinImplementation::MPSM: {
+      if (!JoinMPSM::supports(mode, predicate_condition) || !join_features.data_types_match) return std::nullopt;
+
+      // Both inputs are partitioned into one cluster per NUMA node (see JoinMPSM::_determine_number_of_clusters()),
+      // which are sorted in parallel. Each cluster of the left input is merged with all clusters of the right input.
+      // The fixed cost per cluster lets the parallelism only pay off for large inputs.
+      const auto node_count = std::max(size_t{1}, Topology::get().nodes().size());
+      const auto cluster_count = std::pow(2.0f, std::floor(std::log2(static_cast<float>(node_count))));
+
+      return (_sort_cost(join_features.left) + _sort_cost(join_features.right)) / cluster_count +
+             _coefficients.mpsm_partition * (left_row_count + right_row_count) +
+             _coefficients.mpsm_cluster * cluster_count +
+             _coefficients.merge * (left_row_count + right_row_count * cluster_count) / cluster_count + output_cost;
+    }
+
+    case JoinImplementation::Index: {
+      if (is_semi_or_anti || !join_features.data_types_match) return std::nullopt;
+      if (!is_comparison(predicate_condition)) return std::nullopt;
+
+      const auto& right = join_features.right;
+      if (right.has_table_index) return _coefficients.index_probe * left_row_count + output_cost;
+      if (right.indexed_chunk_count == 0.0f) return std::nullopt;
+
+      // Chunks without index are joined with a nested loop
+      return _coefficients.index_probe * left_row_count * right.indexed_chunk_count +
+             _coefficients.nested_loop * left_row_count * right_row_count * (1.0f - right.indexed_share) + output_cost;
+    }
+
+    case JoinImplementation::Range: {
+      if (!JoinRange::supports(mode, predicate_condition) || !join_features.data_types_match) return std::nullopt;
+
+      // Only the right input is materialized and sorted. It is not clustered, and presorted chunks are sorted anyway.
+      const auto search_step_count = std::log2(std::max(right_row_count, 2.0f));
+      return _coefficients.materialize * right_row_count + _coefficients.sort * right_row_count * search_step_count +
+             _coefficients.binary_search_step * left_row_count * search_step_count + output_cost;
+    }
+  }
+  Fail("GCC thinks this is reachable");
+}
+
+std::optional<JoinImplementation> CostModelPhysical::cheapest_join_implementation(
+    const JoinFeatures& join_features) const {
+  auto cheapest_implementation = std::optional<JoinImplementation>{};
+  auto cheapest_cost = Cost{0};
+
+  for (const auto join_implementation : {JoinImplementation::Hash, JoinImplementation::SortMerge,
+                                         JoinImplementation::MPSM, JoinImplementation::Index,
+                                         JoinImplementation::Range}) {
+    const auto cost = estimate_join_cost(join_implementation, join_features);
+    if (cost && (!cheapest_implementation || *cost < cheapest_cost)) {
+      cheapest_implementation = join_implementation;
+      cheapest_cost = *cost;
+    }
+  }
+
+  return cheapest_implementation;
+}
+
+Cost CostModelPhysical::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Join) {
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+    const auto join_predicate =
+        join_node->join_predicate()
+            ? OperatorJoinPredicate::from_expression(*join_node->join_predicate(), *node->left_input(),
+                                                     *node->right_input())
+            : std::nullopt;
+
+    if (join_predicate) {
+      const auto features = join_features(join_node, *join_predicate);
+      const auto join_implementation = cheapest_join_implementation(features);
+      if (join_implementation) return *estimate_join_cost(*join_implementation, features);
+    }
+  }
+
+  return _coefficients.tuple_access * CostModelLogical::_estimate_node_cost(node);
+}
+
+Cost CostModelPhysical::_sort_cost(const JoinInputFeatures& input_features) const {
+  const auto row_count = input_features.row_count;
+  const auto unsorted_row_count = row_count * (1.0f - input_features.presorted_share);
+
+  return (_coefficients.materialize + _coefficients.cluster) * row_count +
+         _coefficients.sort * unsorted_row_count * std::log2(std::max(row_count, 2.0f));
+}
+
+}  // namespace opossum
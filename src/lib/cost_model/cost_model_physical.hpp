@@ -0,0 +1,115 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "cost_model_logical.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinNode;
+struct OperatorJoinPredicate;
+
+// The join operators that CostModelPhysical chooses from
+enum class JoinImplementation { Hash, SortMerge, MPSM, Index, Range };
+
+/**
+ * Properties of one input of a join that affect the runtime of the join operators
+ */
+struct JoinInputFeatures {
+  float row_count{0.0f};
+
+  // Share of the rows that JoinSortMerge and JoinMPSM do not have to sort during materialization, because their chunk
+  // is ordered by the join column (see Chunk::ordered_by()) or the join column is dictionary-encoded
+  float presorted_share{0.0f};
+
+  // Share of the rows in chunks that JoinIndex can probe with a chunk index on the join column, and the number of
+  // these chunks, each of which is probed separately. Only set for stored tables.
+  float indexed_share{0.0f};
+  float indexed_chunk_count{0.0f};
+
+  // Whether the input is a stored table with a table-level index on the join column (used for equi joins only)
+  bool has_table_index{false};
+};
+
+struct JoinFeatures {
+  JoinMode mode{JoinMode::Inner};
+  PredicateCondition predicate_condition{PredicateCondition::Equals};
+  bool data_types_match{true};
+
+  JoinInputFeatures left;
+  JoinInputFeatures right;
+  float output_row_count{0.0f};
+};
+
+/**
+ * Runtimes in nanoseconds per row (or per pair of rows for nested_loop) of the phases of the join operators. The
+ * defaults are rough single-threaded estimates for a current x86 server. They should be calibrated for the target
+ * machine by fitting them to the runtimes of the join micro-benchmarks (see benchmark/operators/join_benchmark.cpp).
+ */
+struct JoinCostCoefficients {
+  // JoinHash: inserting a row of the smaller input into the hash table and probing it with a row of the larger one
+  float hash_build{25.0f};
+  float hash_probe{12.0f};
+
+  // JoinSortMerge and JoinMPSM: materializing and radix-clustering a row, sorting (per row and log2 of the row count,
+  // only for rows that are not presorted), and merging
+  float materialize{8.0f};
+  float cluster{10.0f};
+  float sort{3.0f};
+  float merge{4.0f};
+
+  // JoinMPSM: additional cost of the NUMA-aware partitioning per row, which only pays off with multiple NUMA nodes,
+  // and of scheduling the jobs and allocating the memory of a cluster
+  float mpsm_partition{10.0f};
+  float mpsm_cluster{50'000.0f};
+
+  // JoinIndex: looking up a value in the index of one chunk, and comparing a pair of rows in chunks without index
+  float index_probe{60.0f};
+  float nested_loop{2.0f};
+
+  // JoinRange: one step of the binary search for the matches of a left row in the sorted right input
+  float binary_search_step{4.0f};
+
+  // Writing a row of the output
+  float output{5.0f};
+
+  // Accessing a tuple in other operators, as counted by CostModelLogical
+  float tuple_access{5.0f};
+};
+
+/**
+ * Cost model estimating the runtime (in nanoseconds) of the physical operators. For joins, it distinguishes the
+ * implementations, based on the sizes of the inputs, the sortedness and encoding of the join columns, and the
+ * availability of indexes. The LQPTranslator uses it to pick the cheapest join implementation. Other nodes are costed
+ * by their tuple accesses as in CostModelLogical.
+ */
+class CostModelPhysical : public CostModelLogical {
+ public:
+  explicit CostModelPhysical(const JoinCostCoefficients& coefficients = {});
+
+  /**
+   * Collects the features of a join for the given predicate, which has to refer to the inputs of join_node
+   */
+  static JoinFeatures join_features(const std::shared_ptr<JoinNode>& join_node,
+                                    const OperatorJoinPredicate& join_predicate);
+
+  // Returns std::nullopt if the implementation does not support the join
+  std::optional<Cost> estimate_join_cost(const JoinImplementation join_implementation,
+                                         const JoinFeatures& join_features) const;
+
+  // Returns std::nullopt if none of the implementations supports the join
+  std::optional<JoinImplementation> cheapest_join_implementation(const JoinFeatures& join_features) const;
+
+ protected:
+  Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  // Materializing, clustering and sorting an input of JoinSortMerge and JoinMPSM
+  Cost _sort_cost(const JoinInputFeatures& input_features) const;
+
+  const JoinCostCoefficients _coefficients;
+};
+
+}  // namespace opossum
@@ -27,6 +27,8 @@ bool AbstractExpression::is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
 }
 
 bool AbstractExpression::operator==(const AbstractExpression& other) const {
+  // Expressions are frequently compared to themselves, e.g., when looking up a column in the LQP that produced it
+  if (this == &other) return true;
   if (type != other.type) return false;
   if (!expressions_equal(arguments, other.arguments)) return false;
   return _shallow_equals(other);
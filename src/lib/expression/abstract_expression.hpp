@@ -31,7 +31,8 @@ enum class ExpressionType {
   PQPSubquery,
   LQPSubquery,
   UnaryMinus,
-  Value
+  Value,
+  WindowFunction
 };
 
 /**
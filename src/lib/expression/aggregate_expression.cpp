@@ -61,7 +61,23 @@ DataType AggregateExpression::data_type() const {
     return AggregateTraits<NullValue, AggregateFunction::CountDistinct>::AGGREGATE_DATA_TYPE;
   }
 
+  if (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    return AggregateTraits<NullValue, AggregateFunction::ApproxCountDistinct>::AGGREGATE_DATA_TYPE;
+  }
+
   const auto argument_data_type = arguments[0]->data_type();
+
+  // The MIN and MAX of Dates and Timestamps are Dates and Timestamps, not the integers they are stored as
+  if (is_date_time_data_type(argument_data_type) &&
+      (aggregate_function == AggregateFunction::Min || aggregate_function == AggregateFunction::Max)) {
+    return argument_data_type;
+  }
+
+  // The MIN, MAX, and SUM of Decimals are Decimals, their AVG is a Double (see Aggregate::write_aggregate_output())
+  if (argument_data_type == DataType::Decimal && aggregate_function != AggregateFunction::Avg) {
+    return argument_data_type;
+  }
+
   auto aggregate_data_type = DataType::Null;
 
   resolve_data_type(argument_data_type, [&](const auto data_type_t) {
@@ -78,6 +94,7 @@ DataType AggregateExpression::data_type() const {
         break;
       case AggregateFunction::Count:
       case AggregateFunction::CountDistinct:
+      case AggregateFunction::ApproxCountDistinct:
         break;  // These are handled above
       case AggregateFunction::Sum:
         aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
@@ -95,9 +112,10 @@ bool AggregateExpression::_shallow_equals(const AbstractExpression& expression)
 size_t AggregateExpression::_on_hash() const { return boost::hash_value(static_cast<size_t>(aggregate_function)); }
 
 bool AggregateExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
-  // Aggregates (except COUNT and COUNT DISTINCT) will return NULL when executed on an
+  // Aggregates (except COUNT, COUNT DISTINCT, and APPROX_COUNT_DISTINCT) will return NULL when executed on an
   // empty group - thus they are always nullable
-  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct;
+  return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+         aggregate_function != AggregateFunction::ApproxCountDistinct;
 }
 
 }  // namespace opossum
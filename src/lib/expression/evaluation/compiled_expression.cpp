@@ -0,0 +1,500 @@
+#include "compiled_expression.hpp"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+struct CompiledExpression::Buffers {
+  std::vector<std::variant<std::vector<int32_t>, std::vector<int64_t>, std::vector<float>, std::vector<double>>> values;
+
+  // Whether the values of a buffer can be NULL in the current chunk. Only then, its NULL flags are valid.
+  std::vector<bool> nullable;
+  std::vector<std::vector<uint8_t>> nulls;
+};
+
+struct CompiledExpression::Operand {
+  DataType data_type;
+
+  // Either the index of the buffer holding the values of the operand, or the value of a literal
+  std::optional<size_t> buffer_idx;
+  AllTypeVariant literal;
+};
+
+}  // namespace opossum
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Buffers = CompiledExpression::Buffers;
+
+template <typename T>
+struct BufferOperand {
+  using Type = T;
+
+  // nullptr if the values cannot be NULL
+  const uint8_t* nulls(const Buffers& buffers) const {
+    return buffers.nullable[buffer_idx] ? buffers.nulls[buffer_idx].data() : nullptr;
+  }
+
+  // Indexed like an array, so that the kernels are the same for buffers and literals
+  struct Values {
+    const T* data;
+    T operator[](const size_t row_idx) const { return data[row_idx]; }
+  };
+
+  Values access(const Buffers& buffers) const {
+    return {std::get<std::vector<T>>(buffers.values[buffer_idx]).data()};
+  }
+
+  size_t buffer_idx;
+};
+
+template <typename T>
+struct LiteralOperand {
+  using Type = T;
+
+  const uint8_t* nulls(const Buffers& buffers) const { return nullptr; }
+
+  struct Values {
+    T value;
+    T operator[](const size_t row_idx) const { return value; }
+  };
+
+  Values access(const Buffers& buffers) const { return {value}; }
+
+  T value;
+};
+
+// Calls the functor with two operands of the given types, of which at most one is a literal
+template <typename LeftDataType, typename RightDataType, typename Functor>
+void resolve_operands(const std::optional<size_t>& left_buffer_idx, const AllTypeVariant& left_literal,
+                      const std::optional<size_t>& right_buffer_idx, const AllTypeVariant& right_literal,
+                      const Functor& functor) {
+  if (left_buffer_idx && right_buffer_idx) {
+    functor(BufferOperand<LeftDataType>{*left_buffer_idx}, BufferOperand<RightDataType>{*right_buffer_idx});
+  } else if (left_buffer_idx) {
+    functor(BufferOperand<LeftDataType>{*left_buffer_idx},
+            LiteralOperand<RightDataType>{boost::get<RightDataType>(right_literal)});
+  } else {
+    // Operations on two literals are not compiled, so there is no need to instantiate the kernels for them
+    DebugAssert(right_buffer_idx, "Operations on two literals should not have been compiled");
+    functor(LiteralOperand<LeftDataType>{boost::get<LeftDataType>(left_literal)},
+            BufferOperand<RightDataType>{*right_buffer_idx});
+  }
+}
+
+// Calls the functor with two numeric operands, of which at most one is a literal
+template <typename Functor>
+void resolve_operands(const DataType left_data_type, const std::optional<size_t>& left_buffer_idx,
+                      const AllTypeVariant& left_literal, const DataType right_data_type,
+                      const std::optional<size_t>& right_buffer_idx, const AllTypeVariant& right_literal,
+                      const Functor& functor) {
+  resolve_data_type(left_data_type, [&](const auto left_data_type_t) {
+    using LeftDataType = typename decltype(left_data_type_t)::type;
+
+    resolve_data_type(right_data_type, [&](const auto right_data_type_t) {
+      using RightDataType = typename decltype(right_data_type_t)::type;
+
+      if constexpr (std::is_arithmetic_v<LeftDataType> && std::is_arithmetic_v<RightDataType>) {
+        resolve_operands<LeftDataType, RightDataType>(left_buffer_idx, left_literal, right_buffer_idx, right_literal,
+                                                      functor);
+      } else {
+        Fail("Only numeric operands can be compiled");
+      }
+    });
+  });
+}
+
+// The result type of arithmetics, as in expression_common_type()
+template <typename Left, typename Right>
+using ArithmeticResult = std::conditional_t<
+    std::is_same_v<Left, double> || std::is_same_v<Right, double> ||
+        (std::is_same_v<Left, int64_t> && std::is_floating_point_v<Right>) ||
+        (std::is_same_v<Right, int64_t> && std::is_floating_point_v<Left>),
+    double,
+    std::conditional_t<
+        std::is_same_v<Left, int64_t> || std::is_same_v<Right, int64_t>, int64_t,
+        std::conditional_t<std::is_same_v<Left, float> || std::is_same_v<Right, float>, float, int32_t>>>;
+
+// The operations compute the same values as the AdditionEvaluator etc. of the ExpressionEvaluator
+template <template <typename T> typename Functor>
+struct STLArithmetic {
+  static constexpr auto null_if_divisor_is_zero = false;
+
+  template <typename Result, typename Left, typename Right>
+  static Result apply(const Left left, const Right right) {
+    return static_cast<Result>(Functor<std::common_type_t<Left, Right>>{}(left, right));
+  }
+};
+
+struct Division {
+  static constexpr auto null_if_divisor_is_zero = true;
+
+  template <typename Result, typename Left, typename Right>
+  static Result apply(const Left left, const Right right) {
+    if constexpr (std::is_integral_v<Left> && std::is_integral_v<Right>) {
+      // The result is NULL anyway, but the division must not be executed
+      return right == 0 ? Result{} : static_cast<Result>(left / right);
+    } else {
+      return static_cast<Result>(left / right);
+    }
+  }
+};
+
+struct Modulo {
+  static constexpr auto null_if_divisor_is_zero = true;
+
+  template <typename Result, typename Left, typename Right>
+  static Result apply(const Left left, const Right right) {
+    if constexpr (std::is_integral_v<Left> && std::is_integral_v<Right>) {
+      return right == 0 ? Result{} : static_cast<Result>(left % right);
+    } else {
+      return static_cast<Result>(fmod(left, right));
+    }
+  }
+};
+
+template <typename Functor>
+void resolve_arithmetic_operation(const ArithmeticOperator arithmetic_operator, const Functor& functor) {
+  // clang-format off
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:       functor(STLArithmetic<std::plus>{});       break;
+    case ArithmeticOperator::Subtraction:    functor(STLArithmetic<std::minus>{});      break;
+    case ArithmeticOperator::Multiplication: functor(STLArithmetic<std::multiplies>{}); break;
+    case ArithmeticOperator::Division:       functor(Division{});                       break;
+    case ArithmeticOperator::Modulo:         functor(Modulo{});                         break;
+  }
+  // clang-format on
+}
+
+template <typename T>
+CompiledExpression::Kernel make_column_kernel(const ColumnID column_id, const size_t buffer_idx) {
+  return [=](const Table& table, const ChunkID chunk_id, Buffers& buffers, const ChunkOffset row_count) {
+    const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+    auto& values = std::get<std::vector<T>>(buffers.values[buffer_idx]);
+
+    // As in the ExpressionEvaluator, the nullability of the column determines whether NULL flags are materialized
+    const auto nullable = table.column_is_nullable(column_id);
+    buffers.nullable[buffer_idx] = nullable;
+
+    auto chunk_offset = ChunkOffset{0};
+    if (nullable) {
+      auto& nulls = buffers.nulls[buffer_idx];
+      nulls.resize(row_count);
+
+      segment_iterate<T>(segment, [&](const auto& position) {
+        nulls[chunk_offset] = position.is_null();
+        values[chunk_offset] = position.is_null() ? T{} : position.value();
+        ++chunk_offset;
+      });
+    } else {
+      segment_iterate<T>(segment, [&](const auto& position) {
+        values[chunk_offset] = position.value();
+        ++chunk_offset;
+      });
+    }
+  };
+}
+
+template <typename Operation, typename Left, typename Right>
+CompiledExpression::Kernel make_arithmetic_kernel(const Left left, const Right right, const size_t result_buffer_idx) {
+  return [=](const Table& table, const ChunkID chunk_id, Buffers& buffers, const ChunkOffset row_count) {
+    using Result = ArithmeticResult<typename Left::Type, typename Right::Type>;
+
+    auto& result_values = std::get<std::vector<Result>>(buffers.values[result_buffer_idx]);
+    const auto left_values = left.access(buffers);
+    const auto right_values = right.access(buffers);
+
+    for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+      result_values[row_idx] = Operation::template apply<Result>(left_values[row_idx], right_values[row_idx]);
+    }
+
+    // The result is NULL if any operand is NULL or, for divisions, if the divisor is zero
+    const auto* left_nulls = left.nulls(buffers);
+    const auto* right_nulls = right.nulls(buffers);
+    const auto nullable = left_nulls || right_nulls || Operation::null_if_divisor_is_zero;
+    buffers.nullable[result_buffer_idx] = nullable;
+    if (!nullable) return;
+
+    auto& result_nulls = buffers.nulls[result_buffer_idx];
+    result_nulls.resize(row_count);
+
+    if (left_nulls && right_nulls) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+        result_nulls[row_idx] = static_cast<uint8_t>(left_nulls[row_idx] | right_nulls[row_idx]);
+      }
+    } else if (left_nulls || right_nulls) {
+      std::copy(left_nulls ? left_nulls : right_nulls, (left_nulls ? left_nulls : right_nulls) + row_count,
+                result_nulls.begin());
+    } else {
+      std::fill(result_nulls.begin(), result_nulls.end(), uint8_t{0});
+    }
+
+    if constexpr (Operation::null_if_divisor_is_zero) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+        result_nulls[row_idx] |= static_cast<uint8_t>(right_values[row_idx] == 0);
+      }
+    }
+  };
+}
+
+template <template <typename T> typename Functor, typename Left, typename Right>
+CompiledExpression::Comparison make_comparison(const Left left, const Right right) {
+  return [=](const Buffers& buffers, const ChunkID chunk_id, const ChunkOffset row_count, PosList& matches) {
+    using CommonType = std::common_type_t<typename Left::Type, typename Right::Type>;
+
+    const auto left_values = left.access(buffers);
+    const auto right_values = right.access(buffers);
+    const auto* left_nulls = left.nulls(buffers);
+    const auto* right_nulls = right.nulls(buffers);
+
+    // Each position is written, but only the matching ones are kept by advancing the match count. This avoids
+    // mispredicted branches for predicates of medium selectivity.
+    matches.resize(row_count);
+    auto match_count = size_t{0};
+
+    if (!left_nulls && !right_nulls) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+        matches[match_count] = RowID{chunk_id, row_idx};
+        match_count += Functor<CommonType>{}(left_values[row_idx], right_values[row_idx]);
+      }
+    } else {
+      for (auto row_idx = ChunkOffset{0}; row_idx < row_count; ++row_idx) {
+        const auto is_null = (left_nulls && left_nulls[row_idx]) || (right_nulls && right_nulls[row_idx]);
+        matches[match_count] = RowID{chunk_id, row_idx};
+        match_count += !is_null && Functor<CommonType>{}(left_values[row_idx], right_values[row_idx]);
+      }
+    }
+
+    matches.resize(match_count);
+  };
+}
+
+bool is_compilable_literal(const AllTypeVariant& value) {
+  return value.type() == typeid(int32_t) || value.type() == typeid(int64_t) || value.type() == typeid(float) ||
+         value.type() == typeid(double);
+}
+
+// Reuses the buffers of the current thread, so that they only have to be allocated for the first chunk
+Buffers& prepare_buffers(const std::vector<DataType>& buffer_data_types, const ChunkOffset row_count) {
+  thread_local auto buffers = Buffers{};
+
+  buffers.values.resize(std::max(buffers.values.size(), buffer_data_types.size()));
+  buffers.nullable.resize(buffers.values.size());
+  buffers.nulls.resize(buffers.values.size());
+
+  for (auto buffer_idx = size_t{0}; buffer_idx < buffer_data_types.size(); ++buffer_idx) {
+    resolve_data_type(buffer_data_types[buffer_idx], [&](const auto data_type_t) {
+      using BufferDataType = typename decltype(data_type_t)::type;
+
+      if constexpr (std::is_arithmetic_v<BufferDataType>) {
+        auto& buffer = buffers.values[buffer_idx];
+        if (!std::holds_alternative<std::vector<BufferDataType>>(buffer)) {
+          buffer.template emplace<std::vector<BufferDataType>>();
+        }
+        std::get<std::vector<BufferDataType>>(buffer).resize(row_count);
+      } else {
+        Fail("Only numeric values can be buffered");
+      }
+    });
+  }
+
+  return buffers;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const CompiledExpression> CompiledExpression::compile(const AbstractExpression& expression) {
+  auto compiled_expression = std::shared_ptr<CompiledExpression>(new CompiledExpression{});
+  auto buffer_idx_by_column_id = std::unordered_map<ColumnID, size_t>{};
+
+  if (expression.type == ExpressionType::Arithmetic) {
+    if (!compiled_expression->_compile_operand(expression, buffer_idx_by_column_id)) return nullptr;
+    return compiled_expression;
+  }
+
+  const auto* predicate_expression = dynamic_cast<const BinaryPredicateExpression*>(&expression);
+  if (!predicate_expression) return nullptr;
+
+  // Only LessThan(Equals) kernels are needed for the GreaterThan(Equals) conditions, with the operands flipped
+  auto predicate_condition = predicate_expression->predicate_condition;
+  auto left_expression = predicate_expression->left_operand();
+  auto right_expression = predicate_expression->right_operand();
+  if (predicate_condition == PredicateCondition::GreaterThan ||
+      predicate_condition == PredicateCondition::GreaterThanEquals) {
+    predicate_condition = flip_predicate_condition(predicate_condition);
+    std::swap(left_expression, right_expression);
+  }
+
+  if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+      predicate_condition != PredicateCondition::LessThan &&
+      predicate_condition != PredicateCondition::LessThanEquals) {
+    return nullptr;
+  }
+
+  const auto left = compiled_expression->_compile_operand(*left_expression, buffer_idx_by_column_id);
+  const auto right = compiled_expression->_compile_operand(*right_expression, buffer_idx_by_column_id);
+  if (!left || !right || (!left->buffer_idx && !right->buffer_idx)) return nullptr;
+
+  resolve_operands(left->data_type, left->buffer_idx, left->literal, right->data_type, right->buffer_idx,
+                   right->literal, [&](const auto left_operand, const auto right_operand) {
+                     // clang-format off
+                     switch (predicate_condition) {
+                       case PredicateCondition::Equals:         compiled_expression->_comparison = make_comparison<std::equal_to>(left_operand, right_operand); break;  // NOLINT
+                       case PredicateCondition::NotEquals:      compiled_expression->_comparison = make_comparison<std::not_equal_to>(left_operand, right_operand); break;  // NOLINT
+                       case PredicateCondition::LessThan:       compiled_expression->_comparison = make_comparison<std::less>(left_operand, right_operand); break;  // NOLINT
+                       case PredicateCondition::LessThanEquals: compiled_expression->_comparison = make_comparison<std::less_equal>(left_operand, right_operand); break;  // NOLINT
+                       default: Fail("Unexpected PredicateCondition");
+                     }
+                     // clang-format on
+                   });
+
+  return compiled_expression;
+}
+
+std::shared_ptr<BaseValueSegment> CompiledExpression::evaluate_to_segment(const Table& table,
+                                                                          const ChunkID chunk_id) const {
+  Assert(!_comparison, "Comparisons can only be evaluated to PosLists");
+
+  const auto row_count = table.get_chunk(chunk_id)->size();
+  auto& buffers = prepare_buffers(_buffer_data_types, row_count);
+  for (const auto& kernel : _kernels) {
+    kernel(table, chunk_id, buffers, row_count);
+  }
+
+  const auto result_buffer_idx = _buffer_data_types.size() - 1;
+  auto segment = std::shared_ptr<BaseValueSegment>{};
+
+  resolve_data_type(_buffer_data_types[result_buffer_idx], [&](const auto data_type_t) {
+    using ResultDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_arithmetic_v<ResultDataType>) {
+      const auto& values = std::get<std::vector<ResultDataType>>(buffers.values[result_buffer_idx]);
+      if (buffers.nullable[result_buffer_idx]) {
+        const auto& result_nulls = buffers.nulls[result_buffer_idx];
+        auto nulls = std::vector<bool>(result_nulls.begin(), result_nulls.end());
+        segment = std::make_shared<ValueSegment<ResultDataType>>(values, nulls);
+      } else {
+        segment = std::make_shared<ValueSegment<ResultDataType>>(values);
+      }
+    } else {
+      Fail("Only numeric results can be compiled");
+    }
+  });
+
+  return segment;
+}
+
+PosList CompiledExpression::evaluate_to_pos_list(const Table& table, const ChunkID chunk_id) const {
+  Assert(_comparison, "Only comparisons can be evaluated to PosLists");
+
+  const auto row_count = table.get_chunk(chunk_id)->size();
+  auto& buffers = prepare_buffers(_buffer_data_types, row_count);
+  for (const auto& kernel : _kernels) {
+    kernel(table, chunk_id, buffers, row_count);
+  }
+
+  auto matches = PosList{};
+  _comparison(buffers, chunk_id, row_count, matches);
+  return matches;
+}
+
+std::optional<CompiledExpression::Operand> CompiledExpression::_compile_operand(
+    const AbstractExpression& expression, std::unordered_map<ColumnID, size_t>& buffer_idx_by_column_id) {
+  switch (expression.type) {
+    case ExpressionType::PQPColumn: {
+      const auto column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+      const auto data_type = expression.data_type();
+      if (data_type == DataType::String || data_type == DataType::Null) return std::nullopt;
+
+      // Each column is materialized only once
+      const auto buffer_idx_iter = buffer_idx_by_column_id.find(column_id);
+      if (buffer_idx_iter != buffer_idx_by_column_id.end()) {
+        return Operand{data_type, buffer_idx_iter->second, NullValue{}};
+      }
+
+      const auto buffer_idx = _buffer_data_types.size();
+      _buffer_data_types.emplace_back(data_type);
+      buffer_idx_by_column_id.emplace(column_id, buffer_idx);
+
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          _kernels.emplace_back(make_column_kernel<ColumnDataType>(column_id, buffer_idx));
+        }
+      });
+
+      return Operand{data_type, buffer_idx, NullValue{}};
+    }
+
+    case ExpressionType::Value: {
+      const auto& value = static_cast<const ValueExpression&>(expression).value;
+      if (!is_compilable_literal(value)) return std::nullopt;
+      return Operand{data_type_from_all_type_variant(value), std::nullopt, value};
+    }
+
+    case ExpressionType::CorrelatedParameter: {
+      const auto& value = static_cast<const CorrelatedParameterExpression&>(expression).value();
+      if (!value || !is_compilable_literal(*value)) return std::nullopt;
+      return Operand{data_type_from_all_type_variant(*value), std::nullopt, *value};
+    }
+
+    case ExpressionType::Arithmetic: {
+      const auto& arithmetic_expression = static_cast<const ArithmeticExpression&>(expression);
+
+      const auto left = _compile_operand(*arithmetic_expression.left_operand(), buffer_idx_by_column_id);
+      if (!left) return std::nullopt;
+      const auto right = _compile_operand(*arithmetic_expression.right_operand(), buffer_idx_by_column_id);
+      if (!right) return std::nullopt;
+
+      // Arithmetics on literals are not worth compiling and should have been folded by the ExpressionReductionRule
+      if (!left->buffer_idx && !right->buffer_idx) return std::nullopt;
+
+      const auto buffer_idx = _buffer_data_types.size();
+      _buffer_data_types.emplace_back(expression.data_type());
+
+      resolve_operands(
+          left->data_type, left->buffer_idx, left->literal, right->data_type, right->buffer_idx, right->literal,
+          [&](const auto left_operand, const auto right_operand) {
+            using Result = ArithmeticResult<typename std::decay_t<decltype(left_operand)>::Type,
+                                            typename std::decay_t<decltype(right_operand)>::Type>;
+            DebugAssert(data_type_from_type<Result>() == expression.data_type(),
+                        "Compiled result type differs from that of the expression");
+
+            resolve_arithmetic_operation(arithmetic_expression.arithmetic_operator, [&](const auto operation) {
+              using Operation = std::decay_t<decltype(operation)>;
+              _kernels.emplace_back(make_arithmetic_kernel<Operation>(left_operand, right_operand, buffer_idx));
+            });
+          });
+
+      return Operand{expression.data_type(), buffer_idx, NullValue{}};
+    }
+
+    default:
+      return std::nullopt;
+  }
+}
+
+}  // namespace opossum
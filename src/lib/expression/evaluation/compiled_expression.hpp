@@ -0,0 +1,74 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class BaseValueSegment;
+class Table;
+
+/**
+ * The ExpressionEvaluator resolves the data types of every node of an expression tree for every chunk and materializes
+ * a full ExpressionResult, including a vector of NULL flags, for each intermediate result. For arithmetic-heavy
+ * expressions such as TPC-H Q1's `l_extendedprice * (1 - l_discount) * (1 + l_tax)`, this interpretation overhead
+ * dominates the evaluation.
+ *
+ * A CompiledExpression translates such an expression once into a sequence of kernels, which is then executed for each
+ * chunk. Each kernel is a tight loop over the rows of the chunk that is specialized for the data types of its operands
+ * and for whether they are literals, so that the compiler can vectorize it. Intermediate results are held in
+ * thread-local buffers that are reused across chunks. Columns are materialized once, even if they are referenced
+ * multiple times. NULL flags are only computed if a nullable column is involved or for divisions and modulos, which
+ * are NULL if the divisor is zero.
+ *
+ * Only arithmetics on numeric columns, non-NULL literals, and parameters can be compiled, as well as comparisons of
+ * those (for TableScans). compile() returns nullptr for other expressions, which are left to the ExpressionEvaluator.
+ * The results are the same as those of the ExpressionEvaluator, including the nullability of the result.
+ */
+class CompiledExpression final {
+ public:
+  // The values of CorrelatedParameterExpressions have to be set before compiling the expression
+  static std::shared_ptr<const CompiledExpression> compile(const AbstractExpression& expression);
+
+  // Only for arithmetic expressions. Returns a ValueSegment with the result of the expression for each row of the
+  // chunk.
+  std::shared_ptr<BaseValueSegment> evaluate_to_segment(const Table& table, const ChunkID chunk_id) const;
+
+  // Only for comparisons. Returns the positions of the rows of the chunk for which the comparison is true.
+  PosList evaluate_to_pos_list(const Table& table, const ChunkID chunk_id) const;
+
+  // Implementation details, public so that the kernels can be generated by free functions
+  struct Buffers;
+  using Kernel = std::function<void(const Table& table, const ChunkID chunk_id, Buffers& buffers,
+                                    const ChunkOffset row_count)>;
+  using Comparison = std::function<void(const Buffers& buffers, const ChunkID chunk_id, const ChunkOffset row_count,
+                                        PosList& matches)>;
+
+ private:
+  struct Operand;
+
+  CompiledExpression() = default;
+
+  // Appends the kernels computing the expression. Returns std::nullopt if the expression cannot be compiled.
+  std::optional<Operand> _compile_operand(const AbstractExpression& expression,
+                                          std::unordered_map<ColumnID, size_t>& buffer_idx_by_column_id);
+
+  // The data types of the buffers. For arithmetic expressions, the result is written to the last buffer.
+  std::vector<DataType> _buffer_data_types;
+
+  // Executed in this order for each chunk
+  std::vector<Kernel> _kernels;
+
+  // Only set for comparisons, which are evaluated after all kernels
+  Comparison _comparison;
+};
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
 #include <iterator>
+#include <map>
 #include <type_traits>
 
 #include "boost/lexical_cast.hpp"
@@ -30,9 +32,17 @@
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
+#include "utils/decimal_utils.hpp"
+#include "utils/logical_data_types.hpp"
 #include "utils/performance_warning.hpp"
 
 using namespace std::string_literals;            // NOLINT
@@ -65,6 +75,13 @@ void resolve_binary_predicate_evaluator(const PredicateCondition predicate_condi
   // clang-format on
 }
 
+// Literals and the values of a column are cheap to read for all rows. Evaluating them on a subset of the rows or on the
+// values of an encoded segment (see the private constructors of the ExpressionEvaluator) does not pay off.
+bool is_cheap_to_evaluate(const AbstractExpression& expression) {
+  return expression.type == ExpressionType::Value || expression.type == ExpressionType::CorrelatedParameter ||
+         expression.type == ExpressionType::PQPColumn;
+}
+
 std::shared_ptr<AbstractExpression> rewrite_between_expression(const AbstractExpression& expression) {
   // `a BETWEEN b AND c` --> `a >= b AND a <= c`
   //
@@ -133,18 +150,101 @@ namespace opossum {
 
 ExpressionEvaluator::ExpressionEvaluator(
     const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results)
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions)
     : _table(table),
       _chunk(_table->get_chunk(chunk_id)),
       _chunk_id(chunk_id),
-      _uncorrelated_subquery_results(uncorrelated_subquery_results) {
+      _uncorrelated_subquery_results(uncorrelated_subquery_results),
+      _common_subexpressions(common_subexpressions) {
   _output_row_count = _chunk->size();
   _segment_materializations.resize(_chunk->column_count());
 }
 
+ExpressionEvaluator::ExpressionEvaluator(const ExpressionEvaluator& parent, const std::vector<ChunkOffset>& rows)
+    : _table(parent._table),
+      _chunk(parent._chunk),
+      _chunk_id(parent._chunk_id),
+      _operates_on_encoded_values(parent._operates_on_encoded_values),
+      _uncorrelated_subquery_results(parent._uncorrelated_subquery_results),
+      _common_subexpressions(parent._common_subexpressions) {
+  Assert(_chunk, "Only evaluators operating on a Chunk can select rows");
+
+  _output_row_count = rows.size();
+
+  _position_filter = std::make_shared<PosList>();
+  _position_filter->reserve(rows.size());
+  for (const auto row : rows) {
+    const auto chunk_offset = parent._position_filter ? (*parent._position_filter)[row].chunk_offset : row;
+    _position_filter->emplace_back(_chunk_id, chunk_offset);
+  }
+  _position_filter->guarantee_single_chunk();
+
+  // Segments that the parent has already materialized are not read again, their selected rows are copied instead
+  _segment_materializations.resize(parent._segment_materializations.size());
+  for (auto column_id = ColumnID{0}; column_id < _segment_materializations.size(); ++column_id) {
+    const auto& parent_materialization = parent._segment_materializations[column_id];
+    if (!parent_materialization) continue;
+
+    resolve_data_type(_chunk->get_segment(column_id)->data_type(), [&](const auto column_data_type_t) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+
+      const auto& parent_result = static_cast<const ExpressionResult<ColumnDataType>&>(*parent_materialization);
+
+      std::vector<ColumnDataType> values(rows.size());
+      std::vector<bool> nulls(parent_result.is_nullable() ? rows.size() : 0);
+      for (auto row_idx = size_t{0}; row_idx < rows.size(); ++row_idx) {
+        values[row_idx] = parent_result.values[rows[row_idx]];
+        if (parent_result.is_nullable()) nulls[row_idx] = parent_result.nulls[rows[row_idx]];
+      }
+
+      _segment_materializations[column_id] =
+          std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
+    });
+  }
+}
+
+ExpressionEvaluator::ExpressionEvaluator(const ExpressionEvaluator& parent, const ColumnID column_id,
+                                         const std::shared_ptr<BaseExpressionResult>& values, const size_t value_count)
+    : _table(parent._table),
+      _chunk(parent._chunk),
+      _chunk_id(parent._chunk_id),
+      _operates_on_encoded_values(true),
+      _uncorrelated_subquery_results(parent._uncorrelated_subquery_results),
+      _common_subexpressions(parent._common_subexpressions) {
+  _output_row_count = value_count;
+  _segment_materializations.resize(parent._segment_materializations.size());
+  _segment_materializations[column_id] = values;
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  if (!_common_subexpressions || _common_subexpressions->empty()) {
+    return _evaluate_expression_to_result<Result>(expression);
+  }
+
+  const auto shared_expression = std::const_pointer_cast<AbstractExpression>(expression.shared_from_this());
+  if (!_common_subexpressions->count(shared_expression)) return _evaluate_expression_to_result<Result>(expression);
+
+  // Results are never modified once they are computed, so they can be handed out multiple times. If the expression is
+  // requested with a different data type than before (which the evaluator does not do for the same expression), it
+  // is evaluated again.
+  auto& common_subexpression_result = _common_subexpression_results[shared_expression];
+  if (const auto result = std::dynamic_pointer_cast<ExpressionResult<Result>>(common_subexpression_result)) {
+    return result;
+  }
+
+  const auto result = _evaluate_expression_to_result<Result>(expression);
+  common_subexpression_result = result;
+  return result;
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result(
+    const AbstractExpression& expression) {
+  if (const auto result = _evaluate_on_encoded_segment<Result>(expression)) return result;
+
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       return _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
@@ -188,6 +288,9 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
     case ExpressionType::Aggregate:
       Fail("ExpressionEvaluator doesn't support Aggregates, use the Aggregate Operator to compute them");
 
+    case ExpressionType::WindowFunction:
+      Fail("ExpressionEvaluator doesn't support window functions, use the Window Operator to compute them");
+
     case ExpressionType::List:
       Fail("Can't evaluate a ListExpression, lists should only appear as the right operand of an InExpression");
 
@@ -203,9 +306,158 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
   Fail("GCC thinks this is reachable");
 }
 
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_on_encoded_segment(
+    const AbstractExpression& expression) {
+  if (!_chunk || _operates_on_encoded_values || _output_row_count == 0 || is_cheap_to_evaluate(expression)) {
+    return nullptr;
+  }
+
+  // Find the only column that the expression references. Subqueries are evaluated per row and not supported.
+  auto column_id = std::optional<ColumnID>{};
+  auto is_supported = true;
+  auto shared_expression = std::const_pointer_cast<AbstractExpression>(expression.shared_from_this());
+  visit_expression(shared_expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSubquery) {
+      is_supported = false;
+    } else if (const auto column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(sub_expression)) {
+      is_supported &= !column_id || *column_id == column_expression->column_id;
+      column_id = column_expression->column_id;
+    }
+    return is_supported ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+  });
+  if (!is_supported || !column_id) return nullptr;
+
+  // Look through ReferenceSegments that reference a single chunk
+  auto segment = _chunk->get_segment(*column_id);
+  auto pos_list = std::shared_ptr<const PosList>{};
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    pos_list = reference_segment->pos_list();
+    if (pos_list->empty() || !pos_list->references_single_chunk()) return nullptr;
+
+    const auto referenced_chunk_id = pos_list->common_chunk_id();
+    if (referenced_chunk_id == INVALID_CHUNK_ID) return nullptr;
+    const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(referenced_chunk_id);
+    if (!referenced_chunk) return nullptr;
+    segment = referenced_chunk->get_segment(reference_segment->referenced_column_id());
+  }
+
+  // The offset into `segment` of each row of this evaluator, INVALID_CHUNK_OFFSET for NULLs of the ReferenceSegment
+  const auto is_sequential = !pos_list && !_position_filter;
+  const auto chunk_offset_of_row = [&](const size_t row_idx) {
+    auto chunk_offset = static_cast<ChunkOffset>(row_idx);
+    if (_position_filter) chunk_offset = (*_position_filter)[row_idx].chunk_offset;
+    if (pos_list) chunk_offset = (*pos_list)[chunk_offset].chunk_offset;
+    return chunk_offset;
+  };
+
+  auto result = std::shared_ptr<ExpressionResult<Result>>{};
+
+  resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // Evaluates the expression once per encoded value. `nulls` marks the values that represent NULLs.
+    const auto evaluate_on_values = [&](std::vector<ColumnDataType>&& values, std::vector<bool>&& nulls) {
+      const auto value_count = values.size();
+      auto values_result = std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
+      auto evaluator = ExpressionEvaluator{*this, *column_id, values_result, value_count};
+      return evaluator.evaluate_expression_to_result<Result>(expression);
+    };
+
+    // Maps the results of the encoded values to the rows. `for_each_row` calls its functor with the index of each row
+    // and the index of the row's encoded value.
+    const auto map_to_rows = [&](const ExpressionResult<Result>& encoded_result, const auto& for_each_row) {
+      auto values = std::vector<Result>(_output_row_count);
+      auto nulls = std::vector<bool>(encoded_result.is_nullable() ? _output_row_count : 0);
+      for_each_row([&](const size_t row_idx, const size_t value_idx) {
+        values[row_idx] = encoded_result.value(value_idx);
+        if (encoded_result.is_nullable()) nulls[row_idx] = encoded_result.is_null(value_idx);
+      });
+      result = std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+    };
+
+    const auto evaluate_on_dictionary = [&](const pmr_vector<ColumnDataType>& dictionary,
+                                            const BaseDictionarySegment& dictionary_segment) {
+      if ((dictionary.size() + 1) * 2 > _output_row_count) return;
+
+      // NULL is evaluated as an additional value at the index of the null_value_id
+      DebugAssert(static_cast<size_t>(dictionary_segment.null_value_id()) == dictionary.size(),
+                  "Expected the null_value_id to follow the dictionary");
+      auto values = std::vector<ColumnDataType>(dictionary.cbegin(), dictionary.cend());
+      values.emplace_back();
+      auto nulls = std::vector<bool>(values.size());
+      nulls.back() = true;
+      const auto encoded_result = evaluate_on_values(std::move(values), std::move(nulls));
+
+      resolve_compressed_vector_type(*dictionary_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        map_to_rows(*encoded_result, [&](const auto& functor) {
+          if (is_sequential) {
+            auto row_idx = size_t{0};
+            for (auto iter = attribute_vector.cbegin(); iter != attribute_vector.cend(); ++iter, ++row_idx) {
+              functor(row_idx, static_cast<size_t>(*iter));
+            }
+          } else {
+            const auto null_value_id = static_cast<size_t>(dictionary_segment.null_value_id());
+            auto decompressor = attribute_vector.create_decompressor();
+            for (auto row_idx = size_t{0}; row_idx < _output_row_count; ++row_idx) {
+              const auto chunk_offset = chunk_offset_of_row(row_idx);
+              if (chunk_offset == INVALID_CHUNK_OFFSET) {
+                functor(row_idx, null_value_id);
+              } else {
+                functor(row_idx, static_cast<size_t>(decompressor->get(chunk_offset)));
+              }
+            }
+          }
+        });
+      });
+    };
+
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(segment.get())) {
+      evaluate_on_dictionary(*dictionary_segment->dictionary(), *dictionary_segment);
+      return;
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      const auto* dictionary_segment = dynamic_cast<const FixedStringDictionarySegment<pmr_string>*>(segment.get());
+      if (dictionary_segment) {
+        evaluate_on_dictionary(*dictionary_segment->dictionary(), *dictionary_segment);
+        return;
+      }
+    }
+
+    // Runs are only mapped to consecutive rows
+    const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(segment.get());
+    if (run_length_segment && is_sequential) {
+      const auto& run_values = *run_length_segment->values();
+      if (run_values.size() * 2 > _output_row_count) return;
+
+      const auto& run_nulls = *run_length_segment->null_values();
+      const auto& end_positions = *run_length_segment->end_positions();
+      const auto encoded_result =
+          evaluate_on_values(std::vector<ColumnDataType>(run_values.cbegin(), run_values.cend()),
+                             std::vector<bool>(run_nulls.cbegin(), run_nulls.cend()));
+
+      map_to_rows(*encoded_result, [&](const auto& functor) {
+        auto row_idx = size_t{0};
+        for (auto run_idx = size_t{0}; run_idx < end_positions.size(); ++run_idx) {
+          for (; row_idx <= end_positions[run_idx]; ++row_idx) {
+            functor(row_idx, run_idx);
+          }
+        }
+      });
+    }
+  });
+
+  return result;
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_arithmetic_expression(
     const ArithmeticExpression& expression) {
+  if constexpr (std::is_same_v<Result, int64_t>) {
+    if (expression.data_type() == DataType::Decimal) return _evaluate_decimal_arithmetic_expression(expression);
+  }
+
   const auto& left = *expression.left_operand();
   const auto& right = *expression.right_operand();
 
@@ -223,6 +475,82 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_arithme
   Fail("GCC thinks this is reachable");
 }
 
+std::shared_ptr<ExpressionResult<int64_t>> ExpressionEvaluator::_evaluate_decimal_arithmetic_expression(
+    const ArithmeticExpression& expression) {
+  // Additions, subtractions, and modulos work on the scaled values. Products and quotients need to be scaled back.
+  const auto left = _evaluate_decimal_operand(*expression.left_operand());
+  const auto right = _evaluate_decimal_operand(*expression.right_operand());
+
+  const auto result_size = _result_size(left.size(), right.size());
+  auto values = std::vector<int64_t>(result_size);
+  auto nulls = std::vector<bool>(result_size);
+
+  switch (expression.arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+        values[row_idx] = left.value(row_idx) + right.value(row_idx);
+      }
+      break;
+    case ArithmeticOperator::Subtraction:
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+        values[row_idx] = left.value(row_idx) - right.value(row_idx);
+      }
+      break;
+    case ArithmeticOperator::Multiplication:
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+        values[row_idx] = decimal_multiply(left.value(row_idx), right.value(row_idx));
+      }
+      break;
+    case ArithmeticOperator::Division:
+    case ArithmeticOperator::Modulo:
+      // As for other data types, a division by zero yields NULL
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+        const auto divisor = right.value(row_idx);
+        if (divisor == 0) {
+          nulls[row_idx] = true;
+        } else if (expression.arithmetic_operator == ArithmeticOperator::Division) {
+          values[row_idx] = decimal_divide(left.value(row_idx), divisor);
+        } else {
+          values[row_idx] = left.value(row_idx) % divisor;
+        }
+      }
+      break;
+  }
+
+  for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+    nulls[row_idx] = nulls[row_idx] || left.is_null(row_idx) || right.is_null(row_idx);
+  }
+
+  return std::make_shared<ExpressionResult<int64_t>>(std::move(values), std::move(nulls));
+}
+
+ExpressionResult<int64_t> ExpressionEvaluator::_evaluate_decimal_operand(const AbstractExpression& expression) {
+  // Integers are scaled, see expression_common_type()
+  const auto factor = expression.data_type() == DataType::Decimal ? int64_t{1} : DECIMAL_FACTOR;
+
+  auto values = std::vector<int64_t>{};
+  auto nulls = std::vector<bool>{};
+
+  _resolve_to_expression_result(expression, [&](const auto& result) {
+    using OperandDataType = typename std::decay_t<decltype(result)>::Type;
+
+    if constexpr (std::is_same_v<OperandDataType, NullValue>) {
+      values.resize(1);
+      nulls = result.nulls;
+    } else if constexpr (std::is_integral_v<OperandDataType>) {
+      values.resize(result.size());
+      for (auto row_idx = ChunkOffset{0}; row_idx < result.size(); ++row_idx) {
+        values[row_idx] = static_cast<int64_t>(result.values[row_idx]) * factor;
+      }
+      nulls = result.nulls;
+    } else {
+      Fail("Decimals can only be combined with integers and other Decimals");
+    }
+  });
+
+  return ExpressionResult<int64_t>{std::move(values), std::move(nulls)};
+}
+
 template <>
 std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
 ExpressionEvaluator::_evaluate_binary_predicate_expression<ExpressionEvaluator::Bool>(
@@ -591,32 +919,76 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
     const CaseExpression& case_expression) {
   const auto when = evaluate_expression_to_result<ExpressionEvaluator::Bool>(*case_expression.when());
 
+  // THEN and ELSE are only evaluated on the rows that take them. As `CASE WHEN a THEN x WHEN b THEN y ELSE z END` is
+  // represented as `CASE WHEN a THEN x ELSE (CASE WHEN b THEN y ELSE z END) END`, each further WHEN clause is only
+  // evaluated on the rows that no previous WHEN clause has decided.
+  auto then_rows = std::vector<ChunkOffset>{};
+  auto else_rows = std::vector<ChunkOffset>{};
+  for (auto row_idx = ChunkOffset{0}; row_idx < when->size(); ++row_idx) {
+    if (when->value(row_idx) && !when->is_null(row_idx)) {
+      then_rows.emplace_back(row_idx);
+    } else {
+      else_rows.emplace_back(row_idx);
+    }
+  }
+
   std::vector<Result> values;
   std::vector<bool> nulls;
 
-  _resolve_to_expression_results(
-      *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
-        using ThenResultType = typename std::decay_t<decltype(then_result)>::Type;
-        using ElseResultType = typename std::decay_t<decltype(else_result)>::Type;
+  if (then_rows.empty() || else_rows.empty()) {
+    // All rows take the same branch (this includes a literal WHEN), so it is evaluated on all rows
+    const auto& branch = then_rows.empty() ? *case_expression.otherwise() : *case_expression.then();
+    _resolve_to_expression_result(branch, [&](const auto& branch_result) {
+      using BranchResultType = typename std::decay_t<decltype(branch_result)>::Type;
 
-        if constexpr (CaseEvaluator::supports_v<Result, ThenResultType, ElseResultType>) {
-          const auto result_size = _result_size(when->size(), then_result.size(), else_result.size());
-          values.resize(result_size);
-          nulls.resize(result_size);
+      if constexpr (CaseEvaluator::supports_v<Result, BranchResultType, BranchResultType>) {
+        const auto result_size = _result_size(when->size(), branch_result.size());
+        values.resize(result_size);
+        nulls.resize(result_size);
 
-          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < result_size; ++chunk_offset) {
-            if (when->value(chunk_offset) && !when->is_null(chunk_offset)) {
-              values[chunk_offset] = to_value<Result>(then_result.value(chunk_offset));
-              nulls[chunk_offset] = then_result.is_null(chunk_offset);
-            } else {
-              values[chunk_offset] = to_value<Result>(else_result.value(chunk_offset));
-              nulls[chunk_offset] = else_result.is_null(chunk_offset);
-            }
-          }
-        } else {
-          Fail("Illegal operands for CaseExpression");
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < result_size; ++chunk_offset) {
+          values[chunk_offset] = to_value<Result>(branch_result.value(chunk_offset));
+          nulls[chunk_offset] = branch_result.is_null(chunk_offset);
         }
-      });
+      } else {
+        Fail("Illegal operands for CaseExpression");
+      }
+    });
+
+    return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  }
+
+  values.resize(when->size());
+  nulls.resize(when->size());
+
+  const auto evaluate_branch = [&](const AbstractExpression& branch, const std::vector<ChunkOffset>& rows) {
+    const auto on_subset = !is_cheap_to_evaluate(branch);
+
+    const auto scatter = [&](const auto& branch_result) {
+      using BranchResultType = typename std::decay_t<decltype(branch_result)>::Type;
+
+      if constexpr (CaseEvaluator::supports_v<Result, BranchResultType, BranchResultType>) {
+        for (auto row_idx = size_t{0}; row_idx < rows.size(); ++row_idx) {
+          const auto chunk_offset = rows[row_idx];
+          const auto result_idx = on_subset ? row_idx : chunk_offset;
+          values[chunk_offset] = to_value<Result>(branch_result.value(result_idx));
+          nulls[chunk_offset] = branch_result.is_null(result_idx);
+        }
+      } else {
+        Fail("Illegal operands for CaseExpression");
+      }
+    };
+
+    if (on_subset) {
+      auto evaluator = ExpressionEvaluator{*this, rows};
+      evaluator._resolve_to_expression_result(branch, scatter);
+    } else {
+      _resolve_to_expression_result(branch, scatter);
+    }
+  };
+
+  evaluate_branch(*case_expression.then(), then_rows);
+  evaluate_branch(*case_expression.otherwise(), else_rows);
 
   return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
 }
@@ -630,11 +1002,19 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
    *    String -> Int/Long/Float/Double:    Conversion is attempted, on error zero is returned
    *                                        in accordance with SQLite. (" 5hallo" AS INT) -> 5
    *    NULL -> Any type                    A nulled value of the requested type is returned.
+   *    String -> Date/Timestamp:           The string is parsed (YYYY-MM-DD[ HH:MM:SS]), on error zero is returned.
+   *    String -> Decimal:                  The string is parsed, on error zero is returned.
+   *    Date/Timestamp/Decimal -> String:   The value is formatted as above.
+   *    Numeric -> Decimal:                 The value is scaled (and rounded).
+   *    Decimal -> Numeric:                 The value is scaled back (and truncated for integers).
    */
 
   auto values = std::vector<Result>{};
   auto nulls = std::vector<bool>{};
 
+  const auto target_data_type = cast_expression.data_type();
+  const auto argument_data_type = cast_expression.argument()->data_type();
+
   _resolve_to_expression_result(*cast_expression.argument(), [&](const auto& argument_result) {
     using ArgumentDataType = typename std::decay_t<decltype(argument_result)>::Type;
 
@@ -648,9 +1028,54 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
       if constexpr (std::is_same_v<Result, NullValue> || std::is_same_v<ArgumentDataType, NullValue>) {
         // "<Something> to Null" cast. Do nothing, this is handled by the `nulls` vector
       } else if constexpr (std::is_same_v<Result, pmr_string>) {  // NOLINT
-        // "<Something> to String" cast. Sould never fail, thus boost::lexical_cast (which throws on error) is fine
-        values[chunk_offset] = boost::lexical_cast<Result>(argument_value);
+        if (is_logical_data_type(argument_data_type) && !argument_result.is_null(chunk_offset)) {
+          // "Date/Timestamp/Decimal to String" cast
+          values[chunk_offset] = pmr_string{value_to_string(argument_data_type, argument_value)};
+        } else {
+          // "<Something> to String" cast. Sould never fail, thus boost::lexical_cast (which throws on error) is fine
+          values[chunk_offset] = boost::lexical_cast<Result>(argument_value);
+        }
       } else {
+        if constexpr (std::is_same_v<ArgumentDataType, pmr_string> && std::is_integral_v<Result>) {  // NOLINT
+          if (is_date_time_data_type(target_data_type)) {
+            // "String to Date/Timestamp" cast
+            const auto string = std::string{argument_value};
+            const auto parsed_value = target_data_type == DataType::Date ? std::optional<int64_t>{string_to_date(string)}
+                                                                          : string_to_timestamp(string);
+            values[chunk_offset] = parsed_value ? static_cast<Result>(*parsed_value) : Result{0};
+            continue;
+          }
+
+          if (target_data_type == DataType::Decimal) {
+            // "String to Decimal" cast
+            const auto parsed_value = string_to_decimal(std::string{argument_value});
+            values[chunk_offset] = parsed_value ? static_cast<Result>(*parsed_value) : Result{0};
+            continue;
+          }
+        }
+
+        if constexpr (std::is_arithmetic_v<ArgumentDataType> && std::is_arithmetic_v<Result>) {
+          if (target_data_type == DataType::Decimal && argument_data_type != DataType::Decimal) {
+            // "Numeric to Decimal" cast
+            if constexpr (std::is_floating_point_v<ArgumentDataType>) {
+              values[chunk_offset] = static_cast<Result>(decimal_from_double(static_cast<double>(argument_value)));
+            } else {
+              values[chunk_offset] = static_cast<Result>(static_cast<int64_t>(argument_value) * DECIMAL_FACTOR);
+            }
+            continue;
+          }
+
+          if (argument_data_type == DataType::Decimal && target_data_type != DataType::Decimal) {
+            // "Decimal to Numeric" cast
+            if constexpr (std::is_floating_point_v<Result>) {
+              values[chunk_offset] = static_cast<Result>(decimal_to_double(static_cast<int64_t>(argument_value)));
+            } else {
+              values[chunk_offset] = static_cast<Result>(static_cast<int64_t>(argument_value) / DECIMAL_FACTOR);
+            }
+            continue;
+          }
+        }
+
         if constexpr (std::is_same_v<ArgumentDataType, pmr_string>) {  // NOLINT
           // "String to Numeric" cast
           // As in SQLite, an illegal conversion (e.g. CAST("Hello" AS INT)) yields zero
@@ -776,10 +1201,59 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_ext
   Fail("GCC thinks this is reachable");
 }
 
+template <>
+std::shared_ptr<ExpressionResult<int32_t>> ExpressionEvaluator::_evaluate_extract_expression<int32_t>(
+    const ExtractExpression& extract_expression) {
+  // Dates and Timestamps are stored as integers, so their components are computed arithmetically
+  const auto from_data_type = extract_expression.from()->data_type();
+  Assert(is_date_time_data_type(from_data_type), "Can only extract Int components from Dates and Timestamps");
+
+  std::vector<int32_t> values;
+  std::vector<bool> nulls;
+
+  const auto extract_component = [&](const int64_t microseconds) {
+    constexpr auto MICROSECONDS_PER_DAY = int64_t{86'400'000'000};
+    const auto days = microseconds / MICROSECONDS_PER_DAY - (microseconds % MICROSECONDS_PER_DAY < 0 ? 1 : 0);
+    const auto seconds_of_day = (microseconds - days * MICROSECONDS_PER_DAY) / 1'000'000;
+
+    switch (extract_expression.datetime_component) {
+      case DatetimeComponent::Year:
+        return civil_from_days(static_cast<int32_t>(days)).year;
+      case DatetimeComponent::Month:
+        return static_cast<int32_t>(civil_from_days(static_cast<int32_t>(days)).month);
+      case DatetimeComponent::Day:
+        return static_cast<int32_t>(civil_from_days(static_cast<int32_t>(days)).day);
+      case DatetimeComponent::Hour:
+        return static_cast<int32_t>(seconds_of_day / 3600);
+      case DatetimeComponent::Minute:
+        return static_cast<int32_t>(seconds_of_day / 60 % 60);
+      case DatetimeComponent::Second:
+        return static_cast<int32_t>(seconds_of_day % 60);
+    }
+    Fail("GCC thinks this is reachable");
+  };
+
+  const auto extract = [&](const auto& from_result, const int64_t microseconds_per_unit) {
+    values.resize(from_result.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < from_result.size(); ++chunk_offset) {
+      values[chunk_offset] = extract_component(int64_t{from_result.values[chunk_offset]} * microseconds_per_unit);
+    }
+    nulls = from_result.nulls;
+  };
+
+  if (from_data_type == DataType::Date) {
+    extract(*evaluate_expression_to_result<int32_t>(*extract_expression.from()), int64_t{86'400'000'000});
+  } else {
+    extract(*evaluate_expression_to_result<int64_t>(*extract_expression.from()), int64_t{1});
+  }
+
+  return std::make_shared<ExpressionResult<int32_t>>(std::move(values), std::move(nulls));
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_extract_expression(
     const ExtractExpression& extract_expression) {
-  Fail("Only Strings (YYYY-MM-DD) supported for Dates right now");
+  Fail("Only Strings (YYYY-MM-DD), Dates, and Timestamps supported for EXTRACT");
 }
 
 template <size_t offset, size_t count>
@@ -884,8 +1358,22 @@ std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_subquer
 
   std::vector<std::shared_ptr<const Table>> results(_output_row_count);
 
+  // The subquery has the same result for all rows with the same parameter values (e.g., the same foreign key in
+  // `SELECT ... FROM lineitem WHERE l_quantity < (SELECT 0.2 * AVG(...) FROM ... WHERE p_partkey = l_partkey)`), so it
+  // is only executed once per distinct combination of parameter values. Correlated subqueries that can be unnested
+  // into joins are rewritten by the optimizer (see SubqueryToJoinRule), this covers the remaining ones.
+  auto results_by_parameter_values = std::map<std::vector<AllTypeVariant>, std::shared_ptr<const Table>>{};
+  auto parameter_values = std::vector<AllTypeVariant>(expression.parameters.size());
+
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-    results[chunk_offset] = _evaluate_subquery_expression_for_row(expression, chunk_offset);
+    for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
+      const auto column_id = expression.parameters[parameter_idx].second;
+      parameter_values[parameter_idx] = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+    }
+
+    auto& result = results_by_parameter_values[parameter_values];
+    if (!result) result = _evaluate_subquery_expression_for_row(expression, chunk_offset);
+    results[chunk_offset] = result;
   }
 
   return results;
@@ -942,7 +1430,6 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
     const AbstractExpression& expression) {
   std::shared_ptr<BaseValueSegment> segment;
-  std::vector<bool> nulls;
 
   _resolve_to_expression_result_view(expression, [&](const auto& view) {
     using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
@@ -951,16 +1438,18 @@ std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_se
     if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
       Fail("Can't create a Segment from a NULL");
     } else {
-      std::vector<ColumnDataType> values(_output_row_count);
+      // Values and NULLs are written into the vectors of the segment directly, so that the segment needs no copy
+      pmr_concurrent_vector<ColumnDataType> values(_output_row_count);
 
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
         values[chunk_offset] = std::move(view.value(chunk_offset));
       }
 
       if (view.is_nullable()) {
-        nulls.resize(_output_row_count);
+        // Only NULLs are set, so that the segment is all_valid() if the result contains none
+        auto nulls = NullValueVector(_output_row_count);
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-          nulls[chunk_offset] = view.is_null(chunk_offset);
+          if (view.is_null(chunk_offset)) nulls.set(chunk_offset, true);
         }
         segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls));
       } else {
@@ -1077,18 +1566,50 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
     case ExpressionType::Logical: {
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
-      const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
-      const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+      const auto& right = *logical_expression.arguments[1];
+      auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
+
+      // The right operand is only evaluated on the rows that the left operand has not decided, i.e., on the matches of
+      // the left operand for AND and on its non-matches for OR
+      auto undecided_rows = std::vector<ChunkOffset>{};
+      if (logical_expression.logical_operator == LogicalOperator::And) {
+        undecided_rows.reserve(left_pos_list.size());
+        for (const auto& row_id : left_pos_list) {
+          undecided_rows.emplace_back(row_id.chunk_offset);
+        }
+      } else {
+        auto left_pos_list_iter = left_pos_list.cbegin();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+          if (left_pos_list_iter != left_pos_list.cend() && left_pos_list_iter->chunk_offset == chunk_offset) {
+            ++left_pos_list_iter;
+          } else {
+            undecided_rows.emplace_back(chunk_offset);
+          }
+        }
+      }
+
+      if (undecided_rows.empty()) return left_pos_list;
+
+      auto right_pos_list = PosList{};
+      if (undecided_rows.size() == _output_row_count) {
+        right_pos_list = evaluate_expression_to_pos_list(right);
+      } else {
+        // The evaluator of the undecided rows returns its matches as offsets into `undecided_rows`
+        auto evaluator = ExpressionEvaluator{*this, undecided_rows};
+        right_pos_list = evaluator.evaluate_expression_to_pos_list(right);
+        for (auto& row_id : right_pos_list) {
+          row_id.chunk_offset = undecided_rows[row_id.chunk_offset];
+        }
+      }
 
       switch (logical_expression.logical_operator) {
         case LogicalOperator::And:
-          std::set_intersection(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(),
-                                right_pos_list.end(), std::back_inserter(result_pos_list));
-          break;
+          return right_pos_list;
 
         case LogicalOperator::Or:
-          std::set_union(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(), right_pos_list.end(),
-                         std::back_inserter(result_pos_list));
+          // Both lists are sorted and disjoint
+          std::merge(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(), right_pos_list.end(),
+                     std::back_inserter(result_pos_list));
           break;
       }
     } break;
@@ -1143,14 +1664,80 @@ ExpressionEvaluator::_evaluate_logical_expression<ExpressionEvaluator::Bool>(con
   const auto& left = *expression.left_operand();
   const auto& right = *expression.right_operand();
 
-  // clang-format off
+  // Operands that are not of DataTypeBool (i.e., NULL literals) are rare and evaluated without short-circuiting
+  if (left.data_type() != DataTypeBool || right.data_type() != DataTypeBool) {
+    // clang-format off
+    switch (expression.logical_operator) {
+      case LogicalOperator::Or:  return _evaluate_binary_with_functor_based_null_logic<ExpressionEvaluator::Bool, TernaryOrEvaluator>(left, right);  // NOLINT
+      case LogicalOperator::And: return _evaluate_binary_with_functor_based_null_logic<ExpressionEvaluator::Bool, TernaryAndEvaluator>(left, right);  // NOLINT
+    }
+    // clang-format on
+  }
+
+  // The left operand alone decides the rows where it is FALSE (for AND) or TRUE (for OR). The right operand is only
+  // evaluated on the remaining rows.
+  const auto left_result = evaluate_expression_to_result<ExpressionEvaluator::Bool>(left);
+  const auto deciding_value = expression.logical_operator == LogicalOperator::Or;
+
+  auto undecided_rows = std::vector<ChunkOffset>{};
+  for (auto row_idx = ChunkOffset{0}; row_idx < left_result->size(); ++row_idx) {
+    if (left_result->is_null(row_idx) || (left_result->value(row_idx) != 0) != deciding_value) {
+      undecided_rows.emplace_back(row_idx);
+    }
+  }
+
+  if (undecided_rows.empty()) return left_result;
+
+  // If no row is decided (e.g., for a literal left operand), the right operand is evaluated on all rows anyway
+  const auto evaluate_all_rows = undecided_rows.size() == left_result->size() || is_cheap_to_evaluate(right);
+
+  auto right_result = std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>{};
+  if (evaluate_all_rows) {
+    right_result = evaluate_expression_to_result<ExpressionEvaluator::Bool>(right);
+  } else {
+    auto evaluator = ExpressionEvaluator{*this, undecided_rows};
+    right_result = evaluator.evaluate_expression_to_result<ExpressionEvaluator::Bool>(right);
+  }
+
+  const auto result_size =
+      evaluate_all_rows ? _result_size(left_result->size(), right_result->size()) : left_result->size();
+  auto values = std::vector<ExpressionEvaluator::Bool>(result_size);
+  auto nulls = std::vector<bool>(result_size);
+
+  const auto combine = [&](auto functor) {
+    if (evaluate_all_rows) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+        bool null;
+        functor(values[row_idx], null, left_result->value(row_idx), left_result->is_null(row_idx),
+                right_result->value(row_idx), right_result->is_null(row_idx));
+        nulls[row_idx] = null;
+      }
+    } else {
+      // Decided rows keep the value of the left operand
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
+        values[row_idx] = left_result->value(row_idx);
+      }
+
+      for (auto undecided_idx = size_t{0}; undecided_idx < undecided_rows.size(); ++undecided_idx) {
+        const auto row_idx = undecided_rows[undecided_idx];
+        bool null;
+        functor(values[row_idx], null, left_result->value(row_idx), left_result->is_null(row_idx),
+                right_result->value(undecided_idx), right_result->is_null(undecided_idx));
+        nulls[row_idx] = null;
+      }
+    }
+  };
+
   switch (expression.logical_operator) {
-    case LogicalOperator::Or:  return _evaluate_binary_with_functor_based_null_logic<ExpressionEvaluator::Bool, TernaryOrEvaluator>(left, right);  // NOLINT
-    case LogicalOperator::And: return _evaluate_binary_with_functor_based_null_logic<ExpressionEvaluator::Bool, TernaryAndEvaluator>(left, right);  // NOLINT
+    case LogicalOperator::Or:
+      combine(TernaryOrEvaluator{});
+      break;
+    case LogicalOperator::And:
+      combine(TernaryAndEvaluator{});
+      break;
   }
-  // clang-format on
 
-  Fail("GCC thinks this is reachable");
+  return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(std::move(values), std::move(nulls));
 }
 
 template <typename Result>
@@ -1330,14 +1917,30 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
     using ColumnDataType = typename decltype(column_data_type_t)::type;
 
-    std::vector<ColumnDataType> values(segment.size());
+    std::vector<ColumnDataType> values(_output_row_count);
+
+    // Evaluators that operate on a subset of the chunk's rows only materialize these rows
+    const auto iterate = [&](const auto& functor) {
+      if (_position_filter) {
+        segment_iterate_filtered<ColumnDataType>(segment, _position_filter, functor);
+      } else {
+        segment_iterate<ColumnDataType>(segment, functor);
+      }
+    };
 
     auto chunk_offset = ChunkOffset{0};
 
-    if (_table->column_is_nullable(column_id)) {
-      std::vector<bool> nulls(segment.size());
+    // ValueSegments know whether they contain NULLs. If they do not, the result is not nullable, which spares the
+    // NULL handling in all expressions using it.
+    const auto* value_segment = dynamic_cast<const BaseValueSegment*>(&segment);
+    const auto segment_contains_nulls =
+        _table->column_is_nullable(column_id) &&
+        (!value_segment || (value_segment->is_nullable() && !value_segment->null_values().all_valid()));
+
+    if (segment_contains_nulls) {
+      std::vector<bool> nulls(_output_row_count);
 
-      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      iterate([&](const auto& position) {
         if (position.is_null()) {
           nulls[chunk_offset] = true;
         } else {
@@ -1350,7 +1953,7 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
           std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
 
     } else {
-      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      iterate([&](const auto& position) {
         values[chunk_offset] = position.value();
         ++chunk_offset;
       });
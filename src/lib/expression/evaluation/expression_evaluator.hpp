@@ -41,6 +41,10 @@ class PQPColumnExpression;
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
  *      - ...without a Chunk, thus returning a single value (and failing if Columns are encountered in the Expression)
+ *
+ * The branches of CaseExpressions and the right operands of LogicalExpressions are only evaluated on the rows that are
+ * not yet decided by the WHEN clause or the left operand, respectively. For this, a nested evaluator operates on the
+ * selected rows of the Chunk only.
  */
 class ExpressionEvaluator final {
  public:
@@ -62,9 +66,13 @@ class ExpressionEvaluator final {
    * For Expressions that reference segments from a single table
    * @param uncorrelated_subquery_results  Results from pre-computed uncorrelated selects, so they do not need to be
    *                                     evaluated for every chunk. Solely for performance.
+   * @param common_subexpressions        Subexpressions that occur multiple times in the evaluated expressions (see
+   *                                     expressions_find_common_subexpressions()). Their results are kept, so that
+   *                                     each of them is evaluated only once. Solely for performance.
    */
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {});
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {},
+                      const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions = {});
 
   std::shared_ptr<BaseValueSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   PosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
@@ -77,9 +85,35 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
  private:
+  // For evaluating Expressions on a subset of the rows of `parent`. `rows` are offsets into the rows of `parent`, the
+  // results (and PosLists) of this evaluator refer to the positions in `rows`.
+  ExpressionEvaluator(const ExpressionEvaluator& parent, const std::vector<ChunkOffset>& rows);
+
+  // For evaluating Expressions on the values of an encoded segment (e.g., the dictionary of a DictionarySegment)
+  // instead of on its rows. `values` takes the place of the column `column_id`, which is the only column that the
+  // Expressions may reference.
+  ExpressionEvaluator(const ExpressionEvaluator& parent, const ColumnID column_id,
+                      const std::shared_ptr<BaseExpressionResult>& values, const size_t value_count);
+
+  // Evaluates the expression without looking up the results of common subexpressions
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result(const AbstractExpression& expression);
+
+  // Expressions that reference a single column whose segment is dictionary- or run-length-encoded are computed once
+  // per dictionary entry (or run) and mapped to the rows, if there are fewer entries than rows. Returns nullptr if
+  // the expression is not evaluated this way.
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_on_encoded_segment(const AbstractExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
+  std::shared_ptr<ExpressionResult<int64_t>> _evaluate_decimal_arithmetic_expression(
+      const ArithmeticExpression& expression);
+
+  // The values of a Decimal or integer expression as Decimals
+  ExpressionResult<int64_t> _evaluate_decimal_operand(const AbstractExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_logical_expression(const LogicalExpression& expression);
 
@@ -194,10 +228,21 @@ class ExpressionEvaluator final {
   const ChunkID _chunk_id;
   size_t _output_row_count{1};
 
+  // The rows of the _chunk that are evaluated, nullptr if all rows are evaluated
+  std::shared_ptr<PosList> _position_filter;
+
+  // Set for evaluators that operate on the values of an encoded segment instead of on the rows of the _chunk
+  const bool _operates_on_encoded_values{false};
+
   // One entry for each segment in the _chunk, may be nullptr if the segment hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+
+  const std::shared_ptr<const ExpressionUnorderedSet> _common_subexpressions;
+
+  // Results of the _common_subexpressions that have been evaluated so far
+  ExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _common_subexpression_results;
 };
 
 }  // namespace opossum
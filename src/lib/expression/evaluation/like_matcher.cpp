@@ -1,9 +1,77 @@
 #include "like_matcher.hpp"
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <cstring>
+
 #include "boost/algorithm/string/replace.hpp"
 
+#include "operators/table_scan/simd_scan_kernels.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+#if defined(__x86_64__)
+
+// Number of candidate positions that are filtered at once
+constexpr auto AVX2_BLOCK_SIZE = size_t{32};
+
+// Requires needle.size() >= 2 and haystack.size() >= needle.size() - 1 + AVX2_BLOCK_SIZE
+__attribute__((target("avx2"))) size_t find_substring_avx2(const std::string_view haystack,
+                                                           const std::string_view needle) {
+  const auto needle_size = needle.size();
+  const auto first_chars = _mm256_set1_epi8(needle.front());
+  const auto last_chars = _mm256_set1_epi8(needle.back());
+
+  auto position = size_t{0};
+  for (; position + needle_size - 1 + AVX2_BLOCK_SIZE <= haystack.size(); position += AVX2_BLOCK_SIZE) {
+    const auto* block = haystack.data() + position;
+    const auto block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const auto block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + needle_size - 1));
+
+    // Bit i is set if the first and the last character of the needle match at position + i
+    auto candidates = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(first_chars, block_first), _mm256_cmpeq_epi8(last_chars, block_last))));
+
+    while (candidates) {
+      const auto offset = static_cast<size_t>(__builtin_ctz(candidates));
+      if (std::memcmp(block + offset + 1, needle.data() + 1, needle_size - 2) == 0) return position + offset;
+      candidates &= candidates - 1;
+    }
+  }
+
+  // The remaining positions do not fill an entire block
+  const auto remaining_position = haystack.substr(position).find(needle);
+  return remaining_position == std::string_view::npos ? std::string_view::npos : position + remaining_position;
+}
+
+#endif
+
+// Compares the segment with the string at the given position, where '_' in the segment matches any character. The
+// string has to hold at least position + segment.size() characters.
+bool segment_matches_at(const std::string_view string, const size_t position, const std::string_view segment) {
+  for (auto index = size_t{0}; index < segment.size(); ++index) {
+    if (segment[index] != '_' && segment[index] != string[position + index]) return false;
+  }
+  return true;
+}
+
+// Returns the first position at which the segment matches or std::string_view::npos
+size_t find_segment(const std::string_view string, const std::string_view segment) {
+  if (segment.find('_') == std::string_view::npos) return LikeMatcher::find_substring(string, segment);
+
+  for (auto position = size_t{0}; position + segment.size() <= string.size(); ++position) {
+    if (segment_matches_at(string, position, segment)) return position;
+  }
+  return std::string_view::npos;
+}
+
+}  // namespace
+
 namespace opossum {
 
 LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
@@ -87,14 +155,69 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern has to end with '%' (which also excludes the empty pattern)
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
-    } else {
-      return std::regex(sql_like_to_regex(pattern));
     }
+
+    // Split the pattern into the segments between the '%'s. Empty infixes (from '%%') match anywhere.
+    auto segments = std::vector<pmr_string>{};
+    auto segment_begin = size_t{0};
+    while (true) {
+      const auto any_chars_position = pattern.find('%', segment_begin);
+      segments.emplace_back(pattern.substr(segment_begin, any_chars_position - segment_begin));
+      if (any_chars_position == pmr_string::npos) break;
+      segment_begin = any_chars_position + 1;
+    }
+
+    auto wildcard_pattern = WildcardPattern{segments.front(), {}, {}, segments.size() > 1};
+    if (wildcard_pattern.has_any_chars) wildcard_pattern.suffix = segments.back();
+    for (auto segment_id = size_t{1}; segment_id + 1 < segments.size(); ++segment_id) {
+      if (!segments[segment_id].empty()) wildcard_pattern.infixes.emplace_back(segments[segment_id]);
+    }
+
+    return wildcard_pattern;
   }
 }
 
+bool LikeMatcher::matches_wildcard_pattern(const std::string_view string, const WildcardPattern& pattern) {
+  const auto& prefix = pattern.prefix;
+  const auto& suffix = pattern.suffix;
+
+  if (!pattern.has_any_chars) return string.size() == prefix.size() && segment_matches_at(string, 0, prefix);
+
+  if (string.size() < prefix.size() + suffix.size()) return false;
+  if (!segment_matches_at(string, 0, prefix)) return false;
+  if (!segment_matches_at(string, string.size() - suffix.size(), suffix)) return false;
+
+  // Matching each infix at its first occurrence leaves the most characters for the following infixes, so no
+  // backtracking is needed
+  auto remainder = string.substr(prefix.size(), string.size() - prefix.size() - suffix.size());
+  for (const auto& infix : pattern.infixes) {
+    const auto position = find_segment(remainder, infix);
+    if (position == std::string_view::npos) return false;
+    remainder.remove_prefix(position + infix.size());
+  }
+
+  return true;
+}
+
+std::optional<std::string_view> LikeMatcher::contained_string() const {
+  if (_pattern_variant.type() != typeid(ContainsPattern)) return std::nullopt;
+  return std::string_view{boost::get<ContainsPattern>(_pattern_variant).string};
+}
+
+size_t LikeMatcher::find_substring(const std::string_view haystack, const std::string_view needle) {
+#if defined(__x86_64__)
+  static const auto use_avx2 = detect_simd_instruction_set() >= SimdInstructionSet::AVX2;
+  if (use_avx2 && needle.size() >= 2 && haystack.size() >= needle.size() - 1 + AVX2_BLOCK_SIZE) {
+    return find_substring_avx2(haystack, needle);
+  }
+#endif
+
+  return haystack.find(needle);
+}
+
 std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
   // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
   // backslashes introduced by the other substitutions
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <regex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -14,7 +15,9 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. Substrings are searched using find_substring(), which uses AVX2 if available. Other patterns are split into
+ * segments at '%', which are matched from left to right (see WildcardPattern). Unlike a backtracking regex, this takes
+ * at most O(string length * pattern length) steps.
  */
 class LikeMatcher {
  public:
@@ -23,6 +26,13 @@ class LikeMatcher {
    */
   static std::string sql_like_to_regex(pmr_string sql_like);
 
+  /**
+   * Returns the position of the first occurrence of needle in haystack or std::string_view::npos. With AVX2, 32
+   * candidate positions are filtered at once by comparing the first and the last character of the needle, and only
+   * the remaining candidates are compared with the entire needle.
+   */
+  static size_t find_substring(std::string_view haystack, std::string_view needle);
+
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -58,16 +68,35 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // Any other pattern, e.g., 'H_llo%w_rld' or 'hello'. The segments between the '%'s may contain '_'.
+  struct WildcardPattern final {
+    // Segment at the beginning of the string (empty if the pattern starts with '%')
+    pmr_string prefix;
+    // Segments that have to appear in this order after the prefix and before the suffix
+    std::vector<pmr_string> infixes;
+    // Segment at the end of the string (empty if the pattern ends with '%')
+    pmr_string suffix;
+    // If the pattern contains no '%', the string has to match the prefix exactly
+    bool has_any_chars;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a WildcardPattern for a general
+   * pattern.
    */
-  using AllPatternVariant =
-      boost::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+  using AllPatternVariant = boost::variant<WildcardPattern, StartsWithPattern, EndsWithPattern, ContainsPattern,
+                                           MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
+  static bool matches_wildcard_pattern(std::string_view string, const WildcardPattern& pattern);
+
+  /**
+   * For patterns like '%hello%', returns the string that has to be contained ("hello"), std::nullopt otherwise. This
+   * allows callers to search many strings at once, e.g., the contiguous buffer of a FixedStringVector.
+   */
+  std::optional<std::string_view> contained_string() const;
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
@@ -79,41 +108,43 @@ class LikeMatcher {
   void resolve(const bool invert_results, const Functor& functor) const {
     if (_pattern_variant.type() == typeid(StartsWithPattern)) {
       const auto& prefix = boost::get<StartsWithPattern>(_pattern_variant).string;
-      functor([&](const pmr_string& string) -> bool {
+      functor([&](const std::string_view string) -> bool {
         if (string.size() < prefix.size()) return invert_results;
         return (string.compare(0, prefix.size(), prefix) == 0) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(EndsWithPattern)) {
       const auto& suffix = boost::get<EndsWithPattern>(_pattern_variant).string;
-      functor([&](const pmr_string& string) -> bool {
+      functor([&](const std::string_view string) -> bool {
         if (string.size() < suffix.size()) return invert_results;
         return (string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(ContainsPattern)) {
       const auto& contains_str = boost::get<ContainsPattern>(_pattern_variant).string;
-      functor([&](const pmr_string& string) -> bool {
-        return (string.find(contains_str) != pmr_string::npos) ^ invert_results;
+      functor([&](const std::string_view string) -> bool {
+        return (find_substring(string, contains_str) != std::string_view::npos) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(MultipleContainsPattern)) {
       const auto& contains_strs = boost::get<MultipleContainsPattern>(_pattern_variant).strings;
 
-      functor([&](const pmr_string& string) -> bool {
-        auto current_position = size_t{0};
+      functor([&](const std::string_view string) -> bool {
+        auto remainder = std::string_view{string};
         for (const auto& contains_str : contains_strs) {
-          current_position = string.find(contains_str, current_position);
-          if (current_position == pmr_string::npos) return invert_results;
-          current_position += contains_str.size();
+          const auto position = find_substring(remainder, contains_str);
+          if (position == std::string_view::npos) return invert_results;
+          remainder.remove_prefix(position + contains_str.size());
         }
         return !invert_results;
       });
 
-    } else if (_pattern_variant.type() == typeid(std::regex)) {
-      const auto& regex = boost::get<std::regex>(_pattern_variant);
+    } else if (_pattern_variant.type() == typeid(WildcardPattern)) {
+      const auto& wildcard_pattern = boost::get<WildcardPattern>(_pattern_variant);
 
-      functor([&](const pmr_string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      functor([&](const std::string_view string) -> bool {
+        return matches_wildcard_pattern(string, wildcard_pattern) ^ invert_results;
+      });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
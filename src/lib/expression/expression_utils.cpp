@@ -117,10 +117,60 @@ std::string expression_column_names(const std::vector<std::shared_ptr<AbstractEx
   return stream.str();
 }
 
-DataType expression_common_type(const DataType lhs, const DataType rhs) {
+std::vector<std::shared_ptr<AbstractExpression>> expressions_find_common_subexpressions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+    const std::function<bool(const AbstractExpression&)>& is_input) {
+  auto occurrence_counts = ExpressionUnorderedMap<size_t>{};
+  auto common_subexpressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (is_input && is_input(*sub_expression)) return ExpressionVisitation::DoNotVisitArguments;
+
+      switch (sub_expression->type) {
+        case ExpressionType::Arithmetic:
+        case ExpressionType::Case:
+        case ExpressionType::Cast:
+        case ExpressionType::Extract:
+        case ExpressionType::Function:
+        case ExpressionType::Logical:
+        case ExpressionType::Predicate:
+        case ExpressionType::UnaryMinus:
+          break;
+
+        case ExpressionType::Aggregate:
+        case ExpressionType::LQPSubquery:
+        case ExpressionType::PQPSubquery:
+          return ExpressionVisitation::DoNotVisitArguments;
+
+        default:
+          return ExpressionVisitation::VisitArguments;
+      }
+
+      const auto occurrence_count = ++occurrence_counts[sub_expression];
+      if (occurrence_count == 1) return ExpressionVisitation::VisitArguments;
+
+      if (occurrence_count == 2) common_subexpressions.emplace_back(sub_expression);
+      return ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+
+  return common_subexpressions;
+}
+
+DataType expression_common_type(const DataType logical_lhs, const DataType logical_rhs) {
+  // Dates and Timestamps are compared and computed as the integers they are stored as
+  const auto lhs = physical_data_type(logical_lhs);
+  const auto rhs = physical_data_type(logical_rhs);
+
   Assert(lhs != DataType::Null || rhs != DataType::Null, "Can't deduce common type if both sides are NULL");
   Assert((lhs == DataType::String) == (rhs == DataType::String), "Strings only compatible with strings");
 
+  // Combined with integers, Decimals stay exact. Combined with floating point numbers, they are not exact anyway.
+  if (logical_lhs == DataType::Decimal || logical_rhs == DataType::Decimal) {
+    return is_floating_point_data_type(lhs) || is_floating_point_data_type(rhs) ? DataType::Double : DataType::Decimal;
+  }
+
   // Long+NULL -> Long; NULL+Long -> Long; NULL+NULL -> NULL
   if (lhs == DataType::Null) return rhs;
   if (rhs == DataType::Null) return lhs;
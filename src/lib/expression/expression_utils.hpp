@@ -99,9 +99,22 @@ void visit_expression(Expression& expression, Visitor visitor) {
   }
 }
 
+/**
+ * @return  The subexpressions that occur more than once in @param expressions and need to be computed (e.g.,
+ *          arithmetics, functions, and predicates, but not columns or values), in the order of their first occurrence.
+ *          Occurrences within an occurrence of a common subexpression are not counted, as they are computed only once
+ *          if the enclosing subexpression is. Arguments of aggregates and subqueries are not looked into, neither are
+ *          subexpressions for which @param is_input returns true (e.g., because they are columns of the input).
+ */
+std::vector<std::shared_ptr<AbstractExpression>> expressions_find_common_subexpressions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+    const std::function<bool(const AbstractExpression&)>& is_input = {});
+
 /**
  * @return  The result DataType of a non-boolean binary expression where the operands have the specified types.
  *          E.g., `<float> + <long> => <double>`, `(<float>, <int>, <int>) => <float>`
+ *          Dates and Timestamps are treated as the Ints and Longs they are stored as. Decimals combined with integers
+ *          (or Decimals) are Decimals, combined with floating point numbers they are Doubles.
  */
 DataType expression_common_type(const DataType lhs, const DataType rhs);
 
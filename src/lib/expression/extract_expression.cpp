@@ -43,8 +43,9 @@ std::string ExtractExpression::as_column_name() const {
 }
 
 DataType ExtractExpression::data_type() const {
-  // Dates are Strings, DateComponents COULD be Ints, but lets leave it at String for now
-  return DataType::String;
+  // Components of Date and Timestamp columns are computed as Ints. Dates stored as Strings (YYYY-MM-DD) are cut into
+  // substrings, so the components are Strings as well.
+  return is_date_time_data_type(from()->data_type()) ? DataType::Int : DataType::String;
 }
 
 std::shared_ptr<AbstractExpression> ExtractExpression::from() const { return arguments[0]; }
@@ -70,10 +70,10 @@ bool LQPSubqueryExpression::_shallow_equals(const AbstractExpression& expression
 }
 
 size_t LQPSubqueryExpression::_on_hash() const {
-  // Return 0, thus forcing a hash collision for LQPSubqueryExpressions and triggering a full equality check.
-  // TODO(moritz) LQP hashing will be introduced with the JoinOrdering optimizer, until then we live with these
-  //              collisions
-  return AbstractExpression::_on_hash();
+  // The structural hash of the LQP is equal for equal LQPs, see AbstractLQPNode::hash()
+  auto hash = lqp->hash();
+  boost::hash_combine(hash, parameter_ids.size());
+  return hash;
 }
 
 }  // namespace opossum
@@ -0,0 +1,156 @@
+#include "window_function_expression.hpp"
+
+#include <sstream>
+
+#include "boost/functional/hash.hpp"
+
+#include "aggregate_expression.hpp"
+#include "constant_mappings.hpp"
+#include "expression_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::string frame_bound_to_string(const std::optional<uint64_t>& offset, const std::string& direction) {
+  if (!offset) return "UNBOUNDED " + direction;
+  if (*offset == 0) return "CURRENT ROW";
+  return std::to_string(*offset) + " " + direction;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool operator==(const WindowFrame& lhs, const WindowFrame& rhs) {
+  return lhs.type == rhs.type && lhs.preceding == rhs.preceding && lhs.following == rhs.following;
+}
+
+WindowFunctionExpression::WindowFunctionExpression(
+    const WindowFunction window_function, const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+    const std::vector<OrderByMode>& order_by_modes, const WindowFrame& frame)
+    : AbstractExpression(ExpressionType::WindowFunction, {}),
+      window_function(window_function),
+      order_by_modes(order_by_modes),
+      frame(frame),
+      _has_argument(argument != nullptr),
+      _partition_by_count(partition_by_expressions.size()) {
+  Assert(order_by_expressions.size() == order_by_modes.size(), "Expected one OrderByMode per ORDER BY expression");
+  Assert(frame.type == WindowFrameType::Rows || ((!frame.preceding || *frame.preceding == 0) &&
+                                                 (!frame.following || *frame.following == 0)),
+         "RANGE frames only support UNBOUNDED and CURRENT ROW bounds");
+
+  if (argument) arguments.emplace_back(argument);
+  arguments.insert(arguments.end(), partition_by_expressions.begin(), partition_by_expressions.end());
+  arguments.insert(arguments.end(), order_by_expressions.begin(), order_by_expressions.end());
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::argument() const {
+  return _has_argument ? arguments[0] : nullptr;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::partition_by_expressions() const {
+  const auto begin = arguments.begin() + (_has_argument ? 1 : 0);
+  return {begin, begin + _partition_by_count};
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::order_by_expressions() const {
+  return {arguments.begin() + (_has_argument ? 1 : 0) + _partition_by_count, arguments.end()};
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::deep_copy() const {
+  return std::make_shared<WindowFunctionExpression>(
+      window_function, _has_argument ? argument()->deep_copy() : nullptr,
+      expressions_deep_copy(partition_by_expressions()), expressions_deep_copy(order_by_expressions()),
+      order_by_modes, frame);
+}
+
+std::string WindowFunctionExpression::as_column_name() const {
+  std::stringstream stream;
+
+  stream << window_function_to_string.left.at(window_function) << "(";
+  if (_has_argument) {
+    stream << argument()->as_column_name();
+  } else if (window_function == WindowFunction::Count) {
+    stream << "*";
+  }
+  stream << ") OVER (";
+
+  auto separator = "";
+  const auto partition_by_expressions = this->partition_by_expressions();
+  if (!partition_by_expressions.empty()) {
+    stream << "PARTITION BY " << expression_column_names(partition_by_expressions);
+    separator = " ";
+  }
+
+  const auto order_by_expressions = this->order_by_expressions();
+  for (auto order_by_idx = size_t{0}; order_by_idx < order_by_expressions.size(); ++order_by_idx) {
+    stream << (order_by_idx == 0 ? std::string{separator} + "ORDER BY " : ", ")
+           << order_by_expressions[order_by_idx]->as_column_name();
+
+    const auto order_by_mode = order_by_modes[order_by_idx];
+    if (order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast) {
+      stream << " DESC";
+    }
+    if (order_by_mode == OrderByMode::AscendingNullsLast || order_by_mode == OrderByMode::DescendingNullsLast) {
+      stream << " NULLS LAST";
+    }
+    separator = " ";
+  }
+
+  if (!(frame == WindowFrame{})) {
+    stream << separator << (frame.type == WindowFrameType::Rows ? "ROWS" : "RANGE") << " BETWEEN "
+           << frame_bound_to_string(frame.preceding, "PRECEDING") << " AND "
+           << frame_bound_to_string(frame.following, "FOLLOWING");
+  }
+
+  stream << ")";
+  return stream.str();
+}
+
+DataType WindowFunctionExpression::data_type() const {
+  switch (window_function) {
+    case WindowFunction::RowNumber:
+    case WindowFunction::Rank:
+    case WindowFunction::DenseRank:
+    case WindowFunction::Count:
+      return DataType::Long;
+
+    // These have the same types as the respective aggregates
+    case WindowFunction::Sum:
+      return AggregateExpression{AggregateFunction::Sum, argument()}.data_type();
+    case WindowFunction::Avg:
+      return AggregateExpression{AggregateFunction::Avg, argument()}.data_type();
+    case WindowFunction::Min:
+      return AggregateExpression{AggregateFunction::Min, argument()}.data_type();
+    case WindowFunction::Max:
+      return AggregateExpression{AggregateFunction::Max, argument()}.data_type();
+  }
+  Fail("Invalid enum value");
+}
+
+bool WindowFunctionExpression::_shallow_equals(const AbstractExpression& expression) const {
+  const auto& window_function_expression = static_cast<const WindowFunctionExpression&>(expression);
+  return window_function == window_function_expression.window_function &&
+         order_by_modes == window_function_expression.order_by_modes && frame == window_function_expression.frame &&
+         _has_argument == window_function_expression._has_argument &&
+         _partition_by_count == window_function_expression._partition_by_count;
+}
+
+size_t WindowFunctionExpression::_on_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(window_function));
+  boost::hash_combine(hash, _partition_by_count);
+  boost::hash_combine(hash, static_cast<size_t>(frame.type));
+  return hash;
+}
+
+bool WindowFunctionExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
+  // Aggregates of frames without non-NULL values are NULL
+  return window_function == WindowFunction::Sum || window_function == WindowFunction::Avg ||
+         window_function == WindowFunction::Min || window_function == WindowFunction::Max;
+}
+
+}  // namespace opossum
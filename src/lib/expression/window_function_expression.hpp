@@ -0,0 +1,68 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class WindowFunction { RowNumber, Rank, DenseRank, Sum, Avg, Count, Min, Max };
+
+// ROWS frames count rows, RANGE frames extend from the first to the last peer (i.e., row with the same ORDER BY values)
+// of their bounds
+enum class WindowFrameType { Rows, Range };
+
+/**
+ * The rows of its partition that a window function aggregates for the current row. The bounds are given as the number
+ * of rows before (preceding) and after (following) the current row, std::nullopt stands for UNBOUNDED. RANGE frames
+ * only support UNBOUNDED and CURRENT ROW (i.e., 0) bounds.
+ * The default frame, RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW, covers the entire partition if there is no
+ * ORDER BY, as all rows are peers then.
+ */
+struct WindowFrame {
+  WindowFrameType type{WindowFrameType::Range};
+  std::optional<uint64_t> preceding;
+  std::optional<uint64_t> following{0};
+};
+
+bool operator==(const WindowFrame& lhs, const WindowFrame& rhs);
+
+/**
+ * A window function, e.g., `SUM(a) OVER (PARTITION BY b ORDER BY c)`, is computed for every row from the rows of its
+ * partition that are within its frame. The arguments are the argument of the function (if it has one), followed by the
+ * PARTITION BY and ORDER BY expressions.
+ */
+class WindowFunctionExpression : public AbstractExpression {
+ public:
+  WindowFunctionExpression(const WindowFunction window_function, const std::shared_ptr<AbstractExpression>& argument,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+                           const std::vector<OrderByMode>& order_by_modes, const WindowFrame& frame = {});
+
+  // nullptr for ROW_NUMBER(), RANK(), DENSE_RANK(), and COUNT(*)
+  std::shared_ptr<AbstractExpression> argument() const;
+  std::vector<std::shared_ptr<AbstractExpression>> partition_by_expressions() const;
+  std::vector<std::shared_ptr<AbstractExpression>> order_by_expressions() const;
+
+  std::shared_ptr<AbstractExpression> deep_copy() const override;
+  std::string as_column_name() const override;
+  DataType data_type() const override;
+
+  const WindowFunction window_function;
+  const std::vector<OrderByMode> order_by_modes;
+  const WindowFrame frame;
+
+ protected:
+  bool _shallow_equals(const AbstractExpression& expression) const override;
+  size_t _on_hash() const override;
+  bool _on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const override;
+
+ private:
+  const bool _has_argument;
+  const size_t _partition_by_count;
+};
+
+}  // namespace opossum
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
-enum class BinarySegmentType : uint8_t { value_segment = 0, dictionary_segment = 1 };
+enum class BinarySegmentType : uint8_t { value_segment = 0, dictionary_segment = 1, delta_segment = 2 };
+
+enum class BinaryFilterType : uint8_t { min_max_filter = 0, range_filter = 1, blocked_bloom_filter = 2 };
 
 using BoolAsByteType = uint8_t;
 
+// Ends the chunk index of binary files (see ExportBinary::_write_chunk_index()), reads "CNKINDEX" in little endian
+constexpr uint64_t BINARY_CHUNK_INDEX_MAGIC = 0x5845444e494b4e43;
+
 }  // namespace opossum
@@ -4,16 +4,20 @@
 
 #include <algorithm>
 #include <cstdlib>
-#include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "csv_meta.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/null_value_vector.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/logical_data_types.hpp"
 
 namespace opossum {
 
@@ -46,8 +50,14 @@ class BaseCsvConverter {
 template <typename T>
 class CsvConverter : public BaseCsvConverter {
  public:
-  explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false)
-      : _parsed_values(size), _null_values(size, false), _is_nullable(is_nullable), _config(config) {}
+  // For Date, Timestamp, and Decimal columns, which are stored as integers, pass their DataType as logical_data_type
+  explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false,
+                        const DataType logical_data_type = DataType::Null)
+      : _parsed_values(size),
+        _null_values(size, false),
+        _is_nullable(is_nullable),
+        _config(config),
+        _logical_data_type(logical_data_type) {}
 
   void insert(std::string& value, ChunkOffset position) override {
     if (_is_nullable && value.length() == 0) {
@@ -55,7 +65,9 @@ class CsvConverter : public BaseCsvConverter {
       return;
     }
 
-    if (boost::to_lower_copy(value) == ParseConfig::NULL_STRING) {
+    // Checking the length first avoids the case-insensitive comparison for almost all fields
+    if (value.size() == std::char_traits<char>::length(ParseConfig::NULL_STRING) &&
+        boost::iequals(value, ParseConfig::NULL_STRING)) {
       Assert(!_config.reject_null_strings,
              "Unquoted null found in CSV file. Quote it for string literal \"null\", leave field empty for null value, "
              "or set 'reject_null_strings' to false in parse config.");
@@ -70,7 +82,8 @@ class CsvConverter : public BaseCsvConverter {
       unescape(value, _config);
     } else {  // NOLINT
       // clang-format on
-      if (_config.reject_quoted_nonstrings) {
+      // Dates, Timestamps, and Decimals are written as (quoted) strings by the CsvWriter
+      if (_config.reject_quoted_nonstrings && !is_logical_data_type(_logical_data_type)) {
         Assert(value == unescape_copy(value, _config),
                "Unexpected quoted string " + value + " encountered in non-string column");
       } else {
@@ -78,7 +91,16 @@ class CsvConverter : public BaseCsvConverter {
       }
     }
 
-    _parsed_values[position] = _get_conversion_function()(value);
+    // clang-format off
+    if constexpr(std::is_integral_v<T>) {
+      // clang-format on
+      if (is_logical_data_type(_logical_data_type)) {
+        _parsed_values[position] = boost::get<T>(logical_value_from_string(_logical_data_type, value));
+        return;
+      }
+    }
+
+    _parsed_values[position] = _convert(value);
   }
 
   std::unique_ptr<BaseSegment> finish() override {
@@ -91,61 +113,86 @@ class CsvConverter : public BaseCsvConverter {
 
  private:
   /*
-   * Returns a conversion function that converts from a string to type T.
+   * Converts a csv field to type T.
    * This function is defined for each type that can be stored in a ValueSegment.
    * The assumption is that only csv fields of type string must be unescaped because other types cannot contain special
    * csv characters.
    */
-  std::function<T(const std::string&)> _get_conversion_function();
+  static T _convert(const std::string& str);
+
   tbb::concurrent_vector<T> _parsed_values;
-  tbb::concurrent_vector<bool> _null_values;
+  NullValueVector _null_values;
   const bool _is_nullable;
   ParseConfig _config;
+  const DataType _logical_data_type;
 };
 
+/*
+ * Parses plain decimal integers ([+-]?[0-9]+) that are short enough to never overflow T, without the overhead of
+ * std::stoi/std::stoll (locale handling, errno, and exceptions). Returns std::nullopt for all other fields, which are
+ * then handled by the standard library functions.
+ */
+template <typename T>
+std::optional<T> parse_plain_integer(const std::string& str) {
+  const auto* begin = str.data();
+  const auto* const end = begin + str.size();
+
+  const auto is_negative = begin != end && *begin == '-';
+  if (begin != end && (*begin == '-' || *begin == '+')) ++begin;
+
+  const auto digit_count = end - begin;
+  if (digit_count == 0 || digit_count > std::numeric_limits<T>::digits10) return std::nullopt;
+
+  auto value = std::make_unsigned_t<T>{0};
+  for (; begin != end; ++begin) {
+    const auto digit = static_cast<unsigned char>(*begin - '0');
+    if (digit > 9) return std::nullopt;
+    value = value * 10 + digit;
+  }
+
+  const auto signed_value = static_cast<T>(value);
+  return is_negative ? -signed_value : signed_value;
+}
+
 template <>
-inline std::function<int32_t(const std::string&)> CsvConverter<int32_t>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stoi(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to int: " + str);
-    return converted;
-  };
+inline int32_t CsvConverter<int32_t>::_convert(const std::string& str) {
+  if (const auto parsed = parse_plain_integer<int32_t>(str)) return *parsed;
+
+  size_t pos;
+  auto converted = std::stoi(str, &pos);
+  Assert(pos == str.size(), "Unprocessed characters found while converting to int: " + str);
+  return converted;
 }
 
 template <>
-inline std::function<int64_t(const std::string&)> CsvConverter<int64_t>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = static_cast<int64_t>(std::stoll(str, &pos));
-    Assert(pos == str.size(), "Unprocessed characters found while converting to long: " + str);
-    return converted;
-  };
+inline int64_t CsvConverter<int64_t>::_convert(const std::string& str) {
+  if (const auto parsed = parse_plain_integer<int64_t>(str)) return *parsed;
+
+  size_t pos;
+  auto converted = static_cast<int64_t>(std::stoll(str, &pos));
+  Assert(pos == str.size(), "Unprocessed characters found while converting to long: " + str);
+  return converted;
 }
 
 template <>
-inline std::function<float(const std::string&)> CsvConverter<float>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stof(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to float: " + str);
-    return converted;
-  };
+inline float CsvConverter<float>::_convert(const std::string& str) {
+  size_t pos;
+  auto converted = std::stof(str, &pos);
+  Assert(pos == str.size(), "Unprocessed characters found while converting to float: " + str);
+  return converted;
 }
 
 template <>
-inline std::function<double(const std::string&)> CsvConverter<double>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stod(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to double: " + str);
-    return converted;
-  };
+inline double CsvConverter<double>::_convert(const std::string& str) {
+  size_t pos;
+  auto converted = std::stod(str, &pos);
+  Assert(pos == str.size(), "Unprocessed characters found while converting to double: " + str);
+  return converted;
 }
 
 template <>
-inline std::function<pmr_string(const std::string&)> CsvConverter<pmr_string>::_get_conversion_function() {
-  return [](const std::string& str) { return pmr_string{str}; };
+inline pmr_string CsvConverter<pmr_string>::_convert(const std::string& str) {
+  return pmr_string{str};
 }
 
 }  // namespace opossum
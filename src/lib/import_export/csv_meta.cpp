@@ -57,6 +57,12 @@ void from_json(const nlohmann::json& json, CsvMeta& meta) {
     }
   }
 
+  if (json.find("chunk_size") != json.end()) {
+    Assert(json.at("chunk_size").is_number_unsigned() && json.at("chunk_size") > 0,
+           "CSV meta file, \"chunk_size\" field has to be a positive integer.");
+    meta.chunk_size = json.at("chunk_size").get<ChunkOffset>();
+  }
+
   meta.config = config;
 }
 
@@ -77,6 +83,7 @@ void to_json(nlohmann::json& json, const CsvMeta& meta) {
   }
 
   json = nlohmann::json{{"config", config}, {"columns", columns}};
+  if (meta.chunk_size) json["chunk_size"] = *meta.chunk_size;
 }
 
 bool operator==(const ColumnMeta& left, const ColumnMeta& right) {
@@ -91,7 +98,7 @@ bool operator==(const ParseConfig& left, const ParseConfig& right) {
 }
 
 bool operator==(const CsvMeta& left, const CsvMeta& right) {
-  return std::tie(left.config, left.columns) == std::tie(right.config, right.columns);
+  return std::tie(left.config, left.columns, left.chunk_size) == std::tie(right.config, right.columns, right.chunk_size);
 }
 
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,10 +40,12 @@ struct ParseConfig {
  *
  * config        characters and options that specify how the CSV should be parsed (delimiter, separator, etc.)
  * columns       column meta information (name, type, nullable) for each column
+ * chunk_size    optional max_chunk_size of the table, overrides the chunk size passed to the CsvParser
  */
 struct CsvMeta {
   ParseConfig config;
   std::vector<ColumnMeta> columns;
+  std::optional<ChunkOffset> chunk_size;
 
   static constexpr const char* META_FILE_EXTENSION = ".json";
 };
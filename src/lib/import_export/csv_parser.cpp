@@ -1,7 +1,6 @@
 #include "csv_parser.hpp"
 
 #include <boost/algorithm/string/trim.hpp>
-#include <fstream>
 #include <functional>
 #include <list>
 #include <memory>
@@ -14,9 +13,11 @@
 #include "constant_mappings.hpp"
 #include "import_export/csv_converter.hpp"
 #include "import_export/csv_meta.hpp"
+#include "import_export/csv_structural_index.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/base_value_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
@@ -25,34 +26,99 @@
 
 namespace opossum {
 
+CsvParser::CsvParser(const size_t block_size) : _block_size(block_size) {}
+
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta,
-                                        const ChunkOffset chunk_size) {
+                                        const ChunkOffset chunk_size,
+                                        const std::optional<ChunkEncodingSpec>& chunk_encoding_spec) {
   // If no meta info is given as a parameter, look for a json file
-  if (csv_meta == std::nullopt) {
-    _meta = process_csv_meta_file(filename + CsvMeta::META_FILE_EXTENSION);
-  } else {
-    _meta = *csv_meta;
-  }
+  _meta = csv_meta ? *csv_meta : process_csv_meta_file(filename + CsvMeta::META_FILE_EXTENSION);
 
   _escaped_linebreak = std::string(1, _meta.config.delimiter_escape) + std::string(1, _meta.config.delimiter);
 
   auto table = _create_table_from_meta(chunk_size);
 
-  std::ifstream csvfile{filename};
+  auto reader = StreamingFileReader{filename, _block_size};
+
+  // Save chunks in list to avoid memory relocation
+  std::list<Segments> segments_by_chunks;
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  std::vector<size_t> field_ends;
+
+  // Content that was read, but not yet assigned to a chunk, as its last row might continue in the next block
+  auto pending_content = std::string{};
+  auto end_of_file = false;
+  auto first_block = true;
+
+  try {
+    while (!end_of_file) {
+      auto block = reader.next_block();
+      end_of_file = !block;
+
+      if (block) {
+        // return empty table if the content is empty
+        if (first_block && (block->front() == '\r' || block->front() == '\n')) return table;
+        first_block = false;
+
+        if (pending_content.empty()) {
+          pending_content = std::move(*block);
+        } else {
+          pending_content += *block;
+        }
+
+        // Without a maximum chunk size, everything is parsed into a single chunk once the whole file was read
+        if (table->max_chunk_size() == 0) continue;
+      } else {
+        if (pending_content.empty()) break;
+
+        // make sure content ends with a delimiter for better row processing later
+        if (pending_content.back() != _meta.config.delimiter) pending_content.push_back(_meta.config.delimiter);
+      }
+
+      const auto content = std::make_shared<const std::string>(std::move(pending_content));
+      auto content_view = std::string_view{*content};
+
+      while (_find_fields_in_chunk(content_view, *table, field_ends)) {
+        // Before the end of the file, only full chunks are known to be complete
+        const auto row_count = field_ends.size() / table->column_count();
+        if (!end_of_file && row_count < table->max_chunk_size()) break;
+
+        segments_by_chunks.emplace_back();
+        tasks.emplace_back(_schedule_parse_task(content_view.substr(0, field_ends.back()), field_ends, *table,
+                                                segments_by_chunks.back(), chunk_encoding_spec, content));
+
+        // Remove processed part of the csv content
+        content_view = content_view.substr(field_ends.back() + 1);
+      }
+
+      pending_content = std::string{content_view};
+    }
+  } catch (...) {
+    // The scheduled tasks reference the segments of this scope
+    CurrentScheduler::wait_for_tasks(tasks);
+    throw;
+  }
+
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  for (auto& segments : segments_by_chunks) {
+    table->append_chunk(segments);
+  }
+
+  return table;
+}
+
+std::shared_ptr<Table> CsvParser::parse_content(std::string content, const CsvMeta& csv_meta,
+                                                const ChunkOffset chunk_size,
+                                                const std::optional<ChunkEncodingSpec>& chunk_encoding_spec) {
+  _meta = csv_meta;
 
-  // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
+  _escaped_linebreak = std::string(1, _meta.config.delimiter_escape) + std::string(1, _meta.config.delimiter);
+
+  auto table = _create_table_from_meta(chunk_size);
 
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
+  // return empty table if the content is empty
+  if (content.empty() || content.front() == '\r' || content.front() == '\n') return table;
 
   // make sure content ends with a delimiter for better row processing later
   if (content.back() != _meta.config.delimiter) content.push_back(_meta.config.delimiter);
@@ -66,19 +132,16 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::
   while (_find_fields_in_chunk(content_view, *table, field_ends)) {
     // create empty chunk
     segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
 
     // Only pass the part of the string that is actually needed to the parsing task
     std::string_view relevant_content = content_view.substr(0, field_ends.back());
 
+    // create and start parsing task to fill chunk
+    tasks.emplace_back(
+        _schedule_parse_task(relevant_content, field_ends, *table, segments_by_chunks.back(), chunk_encoding_spec));
+
     // Remove processed part of the csv content
     content_view = content_view.substr(field_ends.back() + 1);
-
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([this, relevant_content, field_ends, &table, &segments]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments);
-    }));
-    tasks.back()->schedule();
   }
 
   CurrentScheduler::wait_for_tasks(tasks);
@@ -110,7 +173,8 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
     column_definitions.emplace_back(column_name, data_type, column_meta.nullable);
   }
 
-  return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
+  return std::make_shared<Table>(column_definitions, TableType::Data, _meta.chunk_size.value_or(chunk_size),
+                                 UseMvcc::Yes);
 }
 
 bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table,
@@ -120,18 +184,18 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     return false;
   }
 
-  std::string search_for{_meta.config.separator, _meta.config.delimiter, _meta.config.quote};
+  auto structural_index =
+      CsvStructuralIndex{csv_content, {_meta.config.separator, _meta.config.delimiter, _meta.config.quote}};
 
-  size_t pos, from = 0;
+  size_t pos;
   unsigned int rows = 0, field_count = 1;
   bool in_quotes = false;
   while (rows < table.max_chunk_size() || 0 == table.max_chunk_size()) {
     // Find either of row separator, column delimiter, quote identifier
-    pos = csv_content.find_first_of(search_for, from);
+    pos = structural_index.next();
     if (std::string::npos == pos) {
       break;
     }
-    from = pos + 1;
     const char elem = csv_content[pos];
 
     // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
@@ -164,6 +228,19 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
   return true;
 }
 
+std::shared_ptr<AbstractTask> CsvParser::_schedule_parse_task(
+    std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table, Segments& segments,
+    const std::optional<ChunkEncodingSpec>& chunk_encoding_spec, std::shared_ptr<const std::string> content) {
+  auto task = std::make_shared<JobTask>(
+      [this, csv_chunk, field_ends, &table, &segments, &chunk_encoding_spec, content = std::move(content)]() mutable {
+        _parse_into_chunk(csv_chunk, field_ends, table, segments);
+        if (chunk_encoding_spec) _encode_chunk(table, *chunk_encoding_spec, segments);
+        content.reset();
+      });
+  task->schedule();
+  return task;
+}
+
 size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
                                     const Table& table, Segments& segments) {
   // For each csv column, create a CsvConverter which builds up a ValueSegment
@@ -176,7 +253,8 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
     const auto column_type = table.column_data_type(column_id);
 
     converters.emplace_back(
-        make_unique_by_data_type<BaseCsvConverter, CsvConverter>(column_type, row_count, _meta.config, is_nullable));
+        make_unique_by_data_type<BaseCsvConverter, CsvConverter>(column_type, row_count, _meta.config, is_nullable,
+                                                                 column_type));
   }
 
   Assert(field_ends.size() == row_count * column_count, "Unexpected number of fields");
@@ -214,6 +292,21 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
   return row_count;
 }
 
+void CsvParser::_encode_chunk(const Table& table, const ChunkEncodingSpec& chunk_encoding_spec, Segments& segments) {
+  DebugAssert(chunk_encoding_spec.size() == segments.size(), "Expected one SegmentEncodingSpec per column");
+
+  for (ColumnID column_id{0}; column_id < segments.size(); ++column_id) {
+    const auto& segment_encoding_spec = chunk_encoding_spec[column_id];
+    if (segment_encoding_spec.encoding_type == EncodingType::Unencoded) continue;
+
+    const auto value_segment = std::static_pointer_cast<const BaseValueSegment>(segments[column_id]);
+    // Replacing the segment frees the ValueSegment
+    segments[column_id] =
+        encode_segment(segment_encoding_spec.encoding_type, table.column_data_type(column_id), value_segment,
+                       segment_encoding_spec.vector_compression_type);
+  }
+}
+
 void CsvParser::_sanitize_field(std::string& field) {
   std::string::size_type pos = 0;
   while ((pos = field.find(_escaped_linebreak, pos)) != std::string::npos) {
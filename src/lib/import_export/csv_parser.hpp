@@ -7,9 +7,12 @@
 #include <vector>
 
 #include "import_export/csv_meta.hpp"
+#include "import_export/streaming_file_reader.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class Table;
 class Chunk;
 
@@ -21,22 +24,43 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser reads the csv file block by block using a StreamingFileReader, which also decompresses gzip and zstd
+ * files, and separates the data into chunks that are aligned with the csv rows. The structural characters are found
+ * using a CsvStructuralIndex. As soon as all rows of a chunk have been read, the chunk is parsed and converted into an
+ * opossum chunk by a separate task, while the following blocks are read. In the end all chunks are combined to the
+ * final table.
  */
 class CsvParser {
  public:
+  // @param block_size  Size of the blocks in which the file is read, only to be changed for testing
+  explicit CsvParser(const size_t block_size = StreamingFileReader::DEFAULT_BLOCK_SIZE);
+
   // cannot move-assign because of const members
   CsvParser& operator=(CsvParser&&) = delete;
 
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param chunk_encoding_spec  Optional. If set, each chunk is encoded as soon as it has been parsed and its
+   *                             ValueSegments are freed right away, so that the uncompressed table never needs to
+   *                             fit into memory as a whole.
    * @returns             The table that was created from the csv file.
    */
   std::shared_ptr<Table> parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta = std::nullopt,
-                               const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+                               const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
+                               const std::optional<ChunkEncodingSpec>& chunk_encoding_spec = std::nullopt);
+
+  /*
+   * Parses csv data that is already held in memory, e.g., data received by the server, in the same way as parse().
+   *
+   * @param content       The csv data.
+   * @param csv_meta      Meta information (columns, parse config) of the csv data.
+   * @returns             The table that was created from the csv data.
+   */
+  std::shared_ptr<Table> parse_content(std::string content, const CsvMeta& csv_meta,
+                                       const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
+                                       const std::optional<ChunkEncodingSpec>& chunk_encoding_spec = std::nullopt);
+
   std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                      const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
@@ -55,6 +79,15 @@ class CsvParser {
    */
   bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends);
 
+  /*
+   * Schedules a task that parses one chunk of the CSV into @param segments and encodes it if requested.
+   * @param content  Optional. Owns the memory that @param csv_chunk points to and is released once the chunk is parsed.
+   */
+  std::shared_ptr<AbstractTask> _schedule_parse_task(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
+                                                     const Table& table, Segments& segments,
+                                                     const std::optional<ChunkEncodingSpec>& chunk_encoding_spec,
+                                                     std::shared_ptr<const std::string> content = nullptr);
+
   /*
    * @param      csv_chunk  String_view on one chunk of the CSV.
    * @param      field_ends Positions of the field ends of the given \p csv_chunk.
@@ -65,6 +98,11 @@ class CsvParser {
   size_t _parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table,
                            Segments& segments);
 
+  /*
+   * Replaces the ValueSegments of a parsed chunk by segments encoded according to the given spec.
+   */
+  static void _encode_chunk(const Table& table, const ChunkEncodingSpec& chunk_encoding_spec, Segments& segments);
+
   /*
    * @param field The field that needs to be modified to be RFC 4180 compliant.
    */
@@ -74,5 +112,7 @@ class CsvParser {
   CsvMeta _meta;
 
   std::string _escaped_linebreak;
+
+  const size_t _block_size;
 };
 }  // namespace opossum
@@ -0,0 +1,82 @@
+#include "csv_structural_index.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <string>
+
+#include "operators/table_scan/simd_scan_kernels.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+uint64_t find_in_block_scalar(const char* block, const size_t size, const std::array<char, 3>& characters) {
+  auto mask = uint64_t{0};
+  for (auto index = size_t{0}; index < size; ++index) {
+    const auto character = block[index];
+    const auto is_structural = character == characters[0] || character == characters[1] || character == characters[2];
+    mask |= static_cast<uint64_t>(is_structural) << index;
+  }
+  return mask;
+}
+
+#if defined(__x86_64__)
+
+__attribute__((target("avx2"))) uint64_t find_in_block_avx2(const char* block, const std::array<char, 3>& characters) {
+  const auto first = _mm256_set1_epi8(characters[0]);
+  const auto second = _mm256_set1_epi8(characters[1]);
+  const auto third = _mm256_set1_epi8(characters[2]);
+
+  auto mask = uint64_t{0};
+  for (auto half = size_t{0}; half < 2; ++half) {
+    const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + half * 32));
+    const auto matches = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(bytes, first), _mm256_cmpeq_epi8(bytes, second)),
+        _mm256_cmpeq_epi8(bytes, third));
+    mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches))) << (half * 32);
+  }
+  return mask;
+}
+
+#endif
+
+}  // namespace
+
+namespace opossum {
+
+CsvStructuralIndex::CsvStructuralIndex(std::string_view content, const std::array<char, 3>& characters)
+    : _content(content),
+      _characters(characters),
+      _use_avx2(detect_simd_instruction_set() != SimdInstructionSet::Scalar),
+      _mask(_find_in_block(0)) {}
+
+size_t CsvStructuralIndex::next() {
+  while (!_mask) {
+    _block_begin += BLOCK_SIZE;
+    if (_block_begin >= _content.size()) return std::string::npos;
+    _mask = _find_in_block(_block_begin);
+  }
+
+  const auto position = _block_begin + __builtin_ctzll(_mask);
+  _mask &= _mask - 1;
+  return position;
+}
+
+uint64_t CsvStructuralIndex::_find_in_block(const size_t block_begin) const {
+  if (block_begin >= _content.size()) return 0;
+
+  const auto* block = _content.data() + block_begin;
+  const auto size = std::min(BLOCK_SIZE, _content.size() - block_begin);
+
+#if defined(__x86_64__)
+  // The last block might be incomplete and is handled by the scalar variant, so that no bytes beyond the end are read
+  if (_use_avx2 && size == BLOCK_SIZE) return find_in_block_avx2(block, _characters);
+#endif
+
+  return find_in_block_scalar(block, size, _characters);
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace opossum {
+
+/**
+ * Finds the structural characters of a CSV file (separators, delimiters, and quotes) one after the other.
+ *
+ * Instead of comparing byte by byte, blocks of 64 bytes are compared with all three characters at once. The result is
+ * a bit mask of the positions of structural characters in the block, whose set bits are then consumed one by one. With
+ * AVX2, a block takes two 32-byte comparisons per character. As in the SIMD scan kernels, the AVX2 variant is compiled
+ * with a target attribute and only used if the CPU supports it.
+ */
+class CsvStructuralIndex {
+ public:
+  CsvStructuralIndex(std::string_view content, const std::array<char, 3>& characters);
+
+  // Returns the position of the next structural character after the previously returned one, or std::string::npos
+  size_t next();
+
+  static constexpr auto BLOCK_SIZE = size_t{64};
+
+ private:
+  uint64_t _find_in_block(const size_t block_begin) const;
+
+  const std::string_view _content;
+  const std::array<char, 3> _characters;
+  const bool _use_avx2;
+
+  size_t _block_begin{0};
+  uint64_t _mask{0};
+};
+
+}  // namespace opossum
@@ -1,10 +1,18 @@
 #include "csv_writer.hpp"
 
+#include <array>
+#include <charconv>
+#include <cstdio>
 #include <fstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
 #include "types.hpp"
+#include "utils/logical_data_types.hpp"
 
 namespace opossum {
 
@@ -13,32 +21,96 @@ CsvWriter::CsvWriter(const std::string& file, const ParseConfig& config) : _conf
   _stream.open(file);
 }
 
-void CsvWriter::write(const AllTypeVariant& value) {
-  if (_current_column_count > 0) {
-    _stream << _config.separator;
+std::string CsvWriter::format_chunk(const Chunk& chunk, const std::vector<DataType>& data_types) const {
+  const auto row_count = chunk.size();
+  const auto column_count = chunk.column_count();
+
+  /**
+   * The values are formatted segment by segment, so that the data type and encoding are resolved once per segment
+   * instead of once per value. column_value_ends stores where each row's value ends in column_values, so that the
+   * values can be assembled into rows afterwards.
+   */
+  auto column_values = std::vector<std::string>(column_count);
+  auto column_value_ends = std::vector<std::vector<size_t>>(column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = data_types[column_id];
+    const auto is_logical = is_logical_data_type(data_type);
+    auto& values = column_values[column_id];
+    auto& value_ends = column_value_ends[column_id];
+    value_ends.reserve(row_count);
+
+    resolve_data_type(physical_data_type(data_type), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(*chunk.get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) {
+          if (is_logical) {
+            // Dates, Timestamps, and Decimals are written as strings, as the CsvParser (and other databases) expects
+            // them
+            _append_string_value(values, value_to_string(data_type, AllTypeVariant{position.value()}));
+          } else {
+            _append_value(values, position.value());
+          }
+        }
+        value_ends.push_back(values.size());
+      });
+    });
   }
 
-  _write_value(value);
-  ++_current_column_count;
+  // One separator or delimiter follows each value
+  auto rows_size = size_t{row_count} * column_count;
+  for (const auto& values : column_values) rows_size += values.size();
+
+  auto rows = std::string{};
+  rows.reserve(rows_size);
+  auto value_begins = std::vector<size_t>(column_count);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (column_id > 0) rows += _config.separator;
+
+      const auto value_end = column_value_ends[column_id][chunk_offset];
+      rows.append(column_values[column_id], value_begins[column_id], value_end - value_begins[column_id]);
+      value_begins[column_id] = value_end;
+    }
+    rows += _config.delimiter;
+  }
+
+  return rows;
 }
 
-void CsvWriter::end_line() {
-  _stream << _config.delimiter;
-  _current_column_count = 0;
+void CsvWriter::write(const std::string& rows) {
+  _stream.write(rows.data(), static_cast<std::streamsize>(rows.size()));
 }
 
-void CsvWriter::_write_value(const AllTypeVariant& value) {
-  if (variant_is_null(value)) return;
+template <typename T>
+void CsvWriter::_append_value(std::string& buffer, const T& value) const {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    _append_string_value(buffer, value);
+  } else {
+    // Large enough for any int64_t and for any double with six significant digits
+    auto characters = std::array<char, 32>{};
+    auto* end = characters.data();
 
-  if (value.type() == typeid(pmr_string)) {
-    _write_string_value(type_cast_variant<pmr_string>(value));
-    return;
-  }
+    if constexpr (std::is_integral_v<T>) {
+      end = std::to_chars(characters.data(), characters.data() + characters.size(), value).ptr;
+    } else {
+#if defined(__cpp_lib_to_chars)
+      end = std::to_chars(characters.data(), characters.data() + characters.size(), value, std::chars_format::general,
+                          6)
+                .ptr;
+#else
+      // Older standard libraries do not support std::to_chars for floating-point numbers yet
+      end += std::snprintf(characters.data(), characters.size(), "%g", static_cast<double>(value));
+#endif
+    }
 
-  _stream << value;
+    buffer.append(characters.data(), end);
+  }
 }
 
-void CsvWriter::_write_string_value(const pmr_string& value) {
+void CsvWriter::_append_string_value(std::string& buffer, const std::string_view value) const {
   /**
    * We put an the quotechars around any string value by default
    * as this is the only time when a comma (,) might be inside a value.
@@ -48,23 +120,20 @@ void CsvWriter::_write_string_value(const pmr_string& value) {
    * this behaviour to either general quoting or checking for "illegal"
    * characters.
    */
-  _stream << _config.quote;
-  _stream << _escape(value);
-  _stream << _config.quote;
-}
+  buffer += _config.quote;
 
-/*
- * Escapes each quote character with an escape symbol.
- */
-pmr_string CsvWriter::_escape(const pmr_string& string) {
-  pmr_string result(string);
-  size_t next_pos = 0;
-  while (std::string::npos != (next_pos = result.find(_config.quote, next_pos))) {
-    result.insert(next_pos, 1, _config.escape);
-    // Has to jump 2 positions ahead because a new character had been inserted.
-    next_pos += 2;
+  // Escape each quote character with an escape symbol
+  auto begin = size_t{0};
+  auto quote_position = size_t{0};
+  while (std::string_view::npos != (quote_position = value.find(_config.quote, begin))) {
+    buffer.append(value.data() + begin, quote_position - begin);
+    buffer += _config.escape;
+    buffer += _config.quote;
+    begin = quote_position + 1;
   }
-  return result;
+  buffer.append(value.data() + begin, value.size() - begin);
+
+  buffer += _config.quote;
 }
 
 }  // namespace opossum
@@ -2,15 +2,21 @@
 
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "csv_meta.hpp"
-#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class Chunk;
+
+/*
+ * Writes the rows of a table to a csv file. Formatting a chunk (format_chunk()) is independent of the file and thread
+ * safe, so that multiple chunks can be formatted in parallel and then written in order with write().
+ */
 class CsvWriter {
  public:
   /*
@@ -19,21 +25,27 @@ class CsvWriter {
    */
   explicit CsvWriter(const std::string& file, const ParseConfig& config = {});
 
-  void write(const AllTypeVariant& value);
+  /*
+   * Formats all rows of @param chunk as csv, including the delimiter after the last row.
+   * @param data_types  Data types of the chunk's columns, see Table::column_data_types().
+   */
+  std::string format_chunk(const Chunk& chunk, const std::vector<DataType>& data_types) const;
 
   /*
-   * Ends a row of entries in the csv file.
+   * Appends @param rows, as formatted by format_chunk(), to the csv file.
    */
-  void end_line();
+  void write(const std::string& rows);
 
  protected:
-  pmr_string _escape(const pmr_string& string);
-
-  void _write_value(const AllTypeVariant& value);
-  void _write_string_value(const pmr_string& value);
+  /*
+   * Numbers are formatted with std::to_chars, which neither allocates nor depends on the locale. Floating-point
+   * numbers keep the six significant digits that std::ostream uses. Strings are quoted and escaped.
+   */
+  template <typename T>
+  void _append_value(std::string& buffer, const T& value) const;
+  void _append_string_value(std::string& buffer, const std::string_view value) const;
 
   std::ofstream _stream;
-  ColumnID _current_column_count{0};
   ParseConfig _config;
 };
 
@@ -0,0 +1,59 @@
+#include "mapped_file_reader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFileReader::MappedFileReader(const std::string& filename) : _filename(filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + filename);
+
+  struct stat file_stat {};
+  if (fstat(file_descriptor, &file_stat) != 0) {
+    close(file_descriptor);
+    Fail("Could not determine the size of file " + filename);
+  }
+  _size = static_cast<size_t>(file_stat.st_size);
+
+  // Empty files cannot be mapped, but every read from them fails anyway
+  if (_size > 0) {
+    auto* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+    Assert(data != MAP_FAILED, "Could not map file " + filename);
+
+    madvise(data, _size, MADV_SEQUENTIAL);
+    _data = static_cast<const char*>(data);
+    const auto size = _size;
+    _mapping = std::shared_ptr<const char>(_data, [size](const char* mapping) {
+      munmap(const_cast<char*>(mapping), size);
+    });
+  } else {
+    close(file_descriptor);
+  }
+}
+
+const char* MappedFileReader::read_bytes(const size_t byte_count) {
+  Assert(byte_count <= _size - _position, "Unexpected end of file " + _filename);
+  const auto* const bytes = _data + _position;
+  _position += byte_count;
+  return bytes;
+}
+
+size_t MappedFileReader::size() const { return _size; }
+
+size_t MappedFileReader::position() const { return _position; }
+
+void MappedFileReader::seek(const size_t position) {
+  Assert(position <= _size, "Cannot seek beyond the end of file " + _filename);
+  _position = position;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Sequential reader for a read-only memory mapping of a file, used by ImportBinary.
+ *
+ * Compared to an std::ifstream, values are copied straight from the page cache into the containers that end up in the
+ * segments, without intermediate buffers or stream overhead. The kernel is advised that the file is read sequentially,
+ * so that it reads ahead and can drop the pages once they have been consumed.
+ *
+ * Reading beyond the end of the file throws. Copies of a reader share the mapping but have their own read position,
+ * so that different parts of the file can be read concurrently.
+ */
+class MappedFileReader {
+ public:
+  explicit MappedFileReader(const std::string& filename);
+
+  // Returns a pointer to the next @param byte_count bytes and advances the read position behind them. The pointer is
+  // valid for the lifetime of the reader, but not necessarily aligned.
+  const char* read_bytes(const size_t byte_count);
+
+  // Reads a single, trivially copyable value
+  template <typename T>
+  T read_value() {
+    auto value = T{};
+    std::memcpy(&value, read_bytes(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  size_t size() const;
+  size_t position() const;
+  void seek(const size_t position);
+
+ private:
+  std::string _filename;
+  // Unmaps the file when the last reader is destroyed
+  std::shared_ptr<const char> _mapping;
+  const char* _data{nullptr};
+  size_t _size{0};
+  size_t _position{0};
+};
+
+}  // namespace opossum
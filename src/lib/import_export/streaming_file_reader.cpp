@@ -0,0 +1,273 @@
+#include "streaming_file_reader.hpp"
+
+#if HYRISE_GZIP_SUPPORT
+#include <zlib.h>
+#endif
+
+#if HYRISE_ZSTD_SUPPORT
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto GZIP_MAGIC_BYTES = std::array<unsigned char, 2>{0x1f, 0x8b};
+constexpr auto ZSTD_MAGIC_BYTES = std::array<unsigned char, 4>{0x28, 0xb5, 0x2f, 0xfd};
+
+// Appends up to @param byte_count bytes of the file to @param buffer, returns false if the end of the file was reached
+bool read_into(std::ifstream& file, std::string& buffer, const size_t byte_count) {
+  const auto previous_size = buffer.size();
+  buffer.resize(previous_size + byte_count);
+  file.read(buffer.data() + previous_size, static_cast<std::streamsize>(byte_count));
+  buffer.resize(previous_size + static_cast<size_t>(file.gcount()));
+  return static_cast<size_t>(file.gcount()) == byte_count;
+}
+
+}  // namespace
+
+namespace opossum {
+
+FileCompression StreamingFileReader::detect_compression(const std::string& filename) {
+  auto file = std::ifstream{filename, std::ios::binary};
+  auto magic_bytes = std::array<unsigned char, 4>{};
+  file.read(reinterpret_cast<char*>(magic_bytes.data()), magic_bytes.size());
+  const auto byte_count = static_cast<size_t>(file.gcount());
+
+  if (byte_count >= GZIP_MAGIC_BYTES.size() &&
+      std::equal(GZIP_MAGIC_BYTES.begin(), GZIP_MAGIC_BYTES.end(), magic_bytes.begin())) {
+    return FileCompression::Gzip;
+  }
+  if (byte_count >= ZSTD_MAGIC_BYTES.size() &&
+      std::equal(ZSTD_MAGIC_BYTES.begin(), ZSTD_MAGIC_BYTES.end(), magic_bytes.begin())) {
+    return FileCompression::Zstd;
+  }
+  return FileCompression::None;
+}
+
+StreamingFileReader::StreamingFileReader(const std::string& filename, const size_t block_size)
+    : _filename(filename), _block_size(block_size), _compression(detect_compression(filename)) {
+  Assert(_block_size > 0, "Block size must be greater than 0");
+  _thread = std::thread([&]() { _read(); });
+}
+
+StreamingFileReader::~StreamingFileReader() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _stopped = true;
+  }
+  _condition.notify_all();
+  _thread.join();
+}
+
+FileCompression StreamingFileReader::compression() const { return _compression; }
+
+std::optional<std::string> StreamingFileReader::next_block() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  _condition.wait(lock, [&]() { return !_blocks.empty() || _done; });
+
+  if (_blocks.empty()) {
+    if (_exception) std::rethrow_exception(_exception);
+    return std::nullopt;
+  }
+
+  auto block = std::move(_blocks.front());
+  _blocks.pop_front();
+  lock.unlock();
+  _condition.notify_all();
+  return block;
+}
+
+void StreamingFileReader::_read() {
+  try {
+    auto file = std::ifstream{_filename, std::ios::binary};
+    Assert(file.is_open(), "Could not open file " + _filename);
+
+    switch (_compression) {
+      case FileCompression::None:
+        _read_uncompressed(file);
+        break;
+      case FileCompression::Gzip:
+        _read_gzip(file);
+        break;
+      case FileCompression::Zstd:
+        _read_zstd(file);
+        break;
+    }
+  } catch (...) {
+    // The blocks read so far are consumed before the exception is rethrown by next_block()
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _exception = std::current_exception();
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _done = true;
+  }
+  _condition.notify_all();
+}
+
+void StreamingFileReader::_read_uncompressed(std::ifstream& file) {
+  auto end_of_file = false;
+  while (!end_of_file) {
+    auto block = std::string{};
+    end_of_file = !read_into(file, block, _block_size);
+    if (!block.empty() && !_push_block(std::move(block))) return;
+  }
+}
+
+void StreamingFileReader::_read_gzip(std::ifstream& file) {
+#if HYRISE_GZIP_SUPPORT
+  auto stream = z_stream{};
+  // 15 is the maximum window size, adding 32 detects and skips the gzip header
+  const auto init_result = inflateInit2(&stream, 15 + 32);
+  Assert(init_result == Z_OK, "Could not initialize gzip decompression");
+  const auto stream_guard = std::unique_ptr<z_stream, decltype(&inflateEnd)>{&stream, &inflateEnd};
+
+  auto input = std::string{};
+  auto stream_end = false;
+  auto end_of_file = false;
+
+  while (true) {
+    if (stream.avail_in == 0) {
+      if (end_of_file) break;
+      input.clear();
+      end_of_file = !read_into(file, input, _block_size);
+      if (input.empty()) break;
+      stream.next_in = reinterpret_cast<Bytef*>(input.data());
+      stream.avail_in = static_cast<uInt>(input.size());
+    }
+
+    // Files written by parallel compressors (e.g., pigz) or by appending consist of multiple gzip members
+    if (stream_end) {
+      const auto reset_result = inflateReset(&stream);
+      Assert(reset_result == Z_OK, "Could not reset gzip decompression");
+      stream_end = false;
+    }
+
+    auto block = std::string(_block_size, '\0');
+    stream.next_out = reinterpret_cast<Bytef*>(block.data());
+    stream.avail_out = static_cast<uInt>(block.size());
+
+    const auto result = inflate(&stream, Z_NO_FLUSH);
+    Assert(result == Z_OK || result == Z_STREAM_END, "Could not decompress gzip file " + _filename);
+    stream_end = result == Z_STREAM_END;
+
+    block.resize(block.size() - stream.avail_out);
+    if (!block.empty() && !_push_block(std::move(block))) return;
+  }
+
+  Assert(stream_end, "Gzip file " + _filename + " is truncated");
+#else
+  Fail("Cannot read gzip file " + _filename + ", Hyrise was built without gzip support");
+#endif
+}
+
+void StreamingFileReader::_read_zstd(std::ifstream& file) {
+#if HYRISE_ZSTD_SUPPORT
+  const auto context = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+  Assert(context, "Could not initialize zstd decompression");
+
+  const auto max_parallel_frame_count = std::max(size_t{2}, static_cast<size_t>(std::thread::hardware_concurrency()));
+
+  // Compressed data that was read but not decompressed yet, starting at input_offset
+  auto input = std::string{};
+  auto input_offset = size_t{0};
+  auto end_of_file = false;
+  // Whether the streaming decompression stopped within a frame
+  auto within_frame = false;
+
+  while (true) {
+    if (!end_of_file && input.size() - input_offset < _block_size) {
+      input.erase(0, input_offset);
+      input_offset = 0;
+      end_of_file = !read_into(file, input, _block_size);
+    }
+    if (input_offset == input.size()) break;
+
+    const auto remaining_input = std::string_view{input}.substr(input_offset);
+
+    if (!within_frame) {
+      // Collect the complete frames at the beginning of the remaining input whose decompressed size is known
+      auto frames = std::vector<std::string_view>{};
+      auto frames_size = size_t{0};
+      while (frames.size() < max_parallel_frame_count && frames_size < remaining_input.size()) {
+        const auto frame = remaining_input.substr(frames_size);
+        const auto compressed_size = ZSTD_findFrameCompressedSize(frame.data(), frame.size());
+        if (ZSTD_isError(compressed_size)) break;
+        const auto content_size = ZSTD_getFrameContentSize(frame.data(), frame.size());
+        if (content_size == ZSTD_CONTENTSIZE_UNKNOWN || content_size == ZSTD_CONTENTSIZE_ERROR) break;
+
+        frames.emplace_back(frame.substr(0, compressed_size));
+        frames_size += compressed_size;
+      }
+
+      if (frames.size() > 1) {
+        // The frames are not decompressed by JobTasks, as the consumer might block the only worker while it waits
+        // for the next block
+        auto decompressions = std::vector<std::future<std::string>>{};
+        decompressions.reserve(frames.size());
+        for (const auto& frame : frames) {
+          decompressions.emplace_back(std::async(std::launch::async, [&, frame]() {
+            auto block = std::string(ZSTD_getFrameContentSize(frame.data(), frame.size()), '\0');
+            const auto result = ZSTD_decompress(block.data(), block.size(), frame.data(), frame.size());
+            Assert(!ZSTD_isError(result),
+                   "Could not decompress zstd file " + _filename + ": " + ZSTD_getErrorName(result));
+            return block;
+          }));
+        }
+
+        // Wait for all decompressions before leaving the scope of the frames, even if one of them failed
+        for (auto& decompression : decompressions) decompression.wait();
+        for (auto& decompression : decompressions) {
+          auto block = decompression.get();
+          if (!block.empty() && !_push_block(std::move(block))) return;
+        }
+        input_offset += frames_size;
+        continue;
+      }
+    }
+
+    // Single frames, frames without a known size, and frames larger than the buffered input are streamed
+    auto input_buffer = ZSTD_inBuffer{remaining_input.data(), remaining_input.size(), 0};
+    auto block = std::string(_block_size, '\0');
+    auto output_buffer = ZSTD_outBuffer{block.data(), block.size(), 0};
+    const auto result = ZSTD_decompressStream(context.get(), &output_buffer, &input_buffer);
+    Assert(!ZSTD_isError(result), "Could not decompress zstd file " + _filename + ": " + ZSTD_getErrorName(result));
+    Assert(input_buffer.pos > 0 || output_buffer.pos > 0 || !end_of_file, "Zstd file " + _filename + " is truncated");
+
+    within_frame = result != 0;
+    input_offset += input_buffer.pos;
+
+    block.resize(output_buffer.pos);
+    if (!block.empty() && !_push_block(std::move(block))) return;
+  }
+
+  Assert(!within_frame, "Zstd file " + _filename + " is truncated");
+#else
+  Fail("Cannot read zstd file " + _filename + ", Hyrise was built without zstd support");
+#endif
+}
+
+bool StreamingFileReader::_push_block(std::string block) {
+  {
+    auto lock = std::unique_lock<std::mutex>{_mutex};
+    _condition.wait(lock, [&]() { return _blocks.size() < READ_AHEAD_BLOCK_COUNT || _stopped; });
+    if (_stopped) return false;
+    _blocks.emplace_back(std::move(block));
+  }
+  _condition.notify_all();
+  return true;
+}
+
+}  // namespace opossum
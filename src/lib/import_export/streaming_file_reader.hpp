@@ -0,0 +1,72 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class FileCompression { None, Gzip, Zstd };
+
+/**
+ * Reads a file block by block and decompresses it on the fly if it is gzip or zstd compressed, used by the CsvParser.
+ *
+ * Reading and decompressing happen in a thread of the reader, which stays up to READ_AHEAD_BLOCK_COUNT blocks ahead
+ * of the consumer. Thus, the consumer (e.g., parsing the previous blocks) overlaps with I/O and decompression, and
+ * neither the compressed nor the decompressed file needs to fit into memory or be written to disk. Consecutive zstd
+ * frames whose decompressed size is stored in their header (as written by pzstd) are decompressed in parallel, other
+ * frames and gzip files are decompressed as a stream.
+ *
+ * The compression is detected by the magic bytes at the beginning of the file, not by its extension. Support for
+ * gzip and zstd depends on the libraries found when building Hyrise (see HYRISE_GZIP_SUPPORT and
+ * HYRISE_ZSTD_SUPPORT).
+ */
+class StreamingFileReader : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_BLOCK_SIZE = size_t{16 * 1024 * 1024};
+  static constexpr auto READ_AHEAD_BLOCK_COUNT = size_t{4};
+
+  static FileCompression detect_compression(const std::string& filename);
+
+  explicit StreamingFileReader(const std::string& filename, const size_t block_size = DEFAULT_BLOCK_SIZE);
+  ~StreamingFileReader();
+
+  FileCompression compression() const;
+
+  // Returns the next block of the (decompressed) file, or std::nullopt after the last block. Blocks are split at
+  // arbitrary positions and are usually, but not necessarily, block_size bytes large. Rethrows errors of the reader.
+  std::optional<std::string> next_block();
+
+ private:
+  void _read();
+  void _read_uncompressed(std::ifstream& file);
+  void _read_gzip(std::ifstream& file);
+  void _read_zstd(std::ifstream& file);
+
+  // Hands a block to the consumer and waits while it has READ_AHEAD_BLOCK_COUNT blocks left to consume. Returns false
+  // if the reader is being destroyed and reading should stop.
+  bool _push_block(std::string block);
+
+  const std::string _filename;
+  const size_t _block_size;
+  const FileCompression _compression;
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<std::string> _blocks;
+  bool _done{false};
+  bool _stopped{false};
+  std::exception_ptr _exception;
+
+  // Started last, once all other members are initialized
+  std::thread _thread;
+};
+
+}  // namespace opossum
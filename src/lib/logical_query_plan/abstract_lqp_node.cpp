@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <unordered_map>
 
+#include "boost/functional/hash.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
@@ -250,11 +251,32 @@ void AbstractLQPNode::print(std::ostream& out) const {
 }
 
 bool AbstractLQPNode::operator==(const AbstractLQPNode& rhs) const {
+  if (this == &rhs) return true;
   return !lqp_find_subplan_mismatch(shared_from_this(), rhs.shared_from_this());
 }
 
 bool AbstractLQPNode::operator!=(const AbstractLQPNode& rhs) const { return !operator==(rhs); }
 
+size_t AbstractLQPNode::hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(type));
+
+  for (const auto& node_expression : node_expressions) {
+    visit_expression(node_expression, [&](const auto& sub_expression) {
+      boost::hash_combine(hash, static_cast<size_t>(sub_expression->type));
+      boost::hash_combine(hash, sub_expression->arguments.size());
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  boost::hash_combine(hash, _on_shallow_hash());
+  boost::hash_combine(hash, left_input() ? left_input()->hash() : size_t{0});
+  boost::hash_combine(hash, right_input() ? right_input()->hash() : size_t{0});
+
+  return hash;
+}
+
+size_t AbstractLQPNode::_on_shallow_hash() const { return 0; }
+
 void AbstractLQPNode::_print_impl(std::ostream& out) const {
   const auto get_inputs_fn = [](const auto& node) {
     std::vector<std::shared_ptr<const AbstractLQPNode>> inputs;
@@ -286,6 +308,7 @@ std::shared_ptr<AbstractLQPNode> AbstractLQPNode::_shallow_copy(LQPNodeMapping&
   if (node_mapping_iter != node_mapping.end()) return node_mapping_iter->second;
 
   auto shallow_copy = _on_shallow_copy(node_mapping);
+  shallow_copy->row_count_hint = row_count_hint;
   node_mapping.emplace(shared_from_this(), shallow_copy);
 
   return shallow_copy;
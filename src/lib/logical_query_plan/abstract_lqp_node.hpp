@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -22,7 +23,10 @@ enum class LQPNodeType {
   DropView,
   DropTable,
   DummyTable,
+  Except,
   Insert,
+  IntermediateResult,
+  Intersect,
   Join,
   Limit,
   Predicate,
@@ -35,6 +39,7 @@ enum class LQPNodeType {
   Update,
   Union,
   Validate,
+  Window,
   Mock
 };
 
@@ -169,6 +174,14 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   bool operator==(const AbstractLQPNode& rhs) const;
   bool operator!=(const AbstractLQPNode& rhs) const;
 
+  /**
+   * Hashes the structure of the LQP: node types, inputs, the types of the expressions of each node, and the
+   * node-specific members that are considered for equality (e.g., the LimitType of a LimitNode). Column
+   * references are not hashed, so LQPs that are equal according to operator== (e.g., deep copies of each other) have
+   * the same hash. Use it to avoid full comparisons of LQPs that are definitely not equal.
+   */
+  size_t hash() const;
+
   const LQPNodeType type;
 
   /**
@@ -181,11 +194,21 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
    */
   std::vector<std::shared_ptr<AbstractExpression>> node_expressions;
 
+  /**
+   * Set by the LimitPushdownRule if only the first rows of this node's output are consumed. The operator of the node
+   * may stop processing its input once it has produced that many rows. As it does not change the result, it is neither
+   * printed nor considered for equality.
+   */
+  std::optional<size_t> row_count_hint;
+
  protected:
   void _print_impl(std::ostream& out) const;
   virtual std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const = 0;
   virtual bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const = 0;
 
+  // Hashes the members that _on_shallow_equals() compares in addition to the node expressions, see hash()
+  virtual size_t _on_shallow_hash() const;
+
  private:
   std::shared_ptr<AbstractLQPNode> _deep_copy_impl(LQPNodeMapping& node_mapping) const;
   std::shared_ptr<AbstractLQPNode> _shallow_copy(LQPNodeMapping& node_mapping) const;
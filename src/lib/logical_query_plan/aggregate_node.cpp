@@ -54,6 +54,8 @@ std::string AggregateNode::description() const {
   }
   stream << "]";
 
+  if (combines_partial_aggregates) stream << " (combines partial aggregates)";
+
   return stream.str();
 }
 
@@ -62,16 +64,29 @@ std::shared_ptr<TableStatistics> AggregateNode::derive_statistics_from(
   DebugAssert(left_input && !right_input, "AggregateNode need left_input and no right_input");
 
   const auto input_statistics = left_input->get_statistics();
-  const auto row_count = input_statistics->row_count();
 
   std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
   column_statistics.reserve(node_expressions.size());
 
-  for (const auto& expression : node_expressions) {
+  // Assuming that the group-by columns are independent, the number of groups is the product of their distinct counts
+  // (NULL forming a group of its own), but at most the number of input rows
+  auto group_count = 1.0f;
+
+  for (auto expression_idx = size_t{0}; expression_idx < node_expressions.size(); ++expression_idx) {
+    const auto& expression = node_expressions[expression_idx];
+    const auto is_group_by_expression = expression_idx < aggregate_expressions_begin_idx;
+
     const auto column_id = left_input->find_column_id(*expression);
-    if (column_id) {
+    if (column_id && is_group_by_expression) {
+      const auto& input_column_statistics = input_statistics->column_statistics()[*column_id];
+      const auto null_group_count = input_column_statistics->null_value_ratio() > 0.0f ? 1.0f : 0.0f;
+      group_count *= input_column_statistics->distinct_count() + null_group_count;
+      column_statistics.emplace_back(input_column_statistics->without_duplicates());
+    } else if (column_id) {
       column_statistics.emplace_back(input_statistics->column_statistics()[*column_id]);
     } else {
+      if (is_group_by_expression) group_count *= input_statistics->row_count();
+
       // TODO(anybody) Statistics for expressions not yet supported
       resolve_data_type(expression->data_type(), [&](const auto data_type_t) {
         using ExpressionDataType = typename decltype(data_type_t)::type;
@@ -81,6 +96,10 @@ std::shared_ptr<TableStatistics> AggregateNode::derive_statistics_from(
     }
   }
 
+  // Without GROUP BY, the aggregates produce a single row
+  const auto row_count =
+      aggregate_expressions_begin_idx == 0 ? 1.0f : std::min(group_count, input_statistics->row_count());
+
   return std::make_shared<TableStatistics>(TableType::Data, row_count, column_statistics);
 }
 
@@ -101,9 +120,11 @@ std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping&
   const auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
       node_expressions.begin() + aggregate_expressions_begin_idx, node_expressions.end()};
 
-  return std::make_shared<AggregateNode>(
+  const auto copy = std::make_shared<AggregateNode>(
       expressions_copy_and_adapt_to_different_lqp(group_by_expressions, node_mapping),
       expressions_copy_and_adapt_to_different_lqp(aggregate_expressions, node_mapping));
+  copy->combines_partial_aggregates = combines_partial_aggregates;
+  return copy;
 }
 
 bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -111,6 +132,7 @@ bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNode
 
   return expressions_equal_to_expressions_in_different_lqp(node_expressions, aggregate_node.node_expressions,
                                                            node_mapping) &&
-         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx;
+         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx &&
+         combines_partial_aggregates == aggregate_node.combines_partial_aggregates;
 }
 }  // namespace opossum
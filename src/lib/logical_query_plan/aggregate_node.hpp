@@ -34,6 +34,11 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
   // node_expression contains both the group_by- and the aggregate_expressions in that order.
   const size_t aggregate_expressions_begin_idx;
 
+  // Set by the EagerAggregationRule. If true, the input does not contain the arguments of the aggregates, but columns
+  // with the (partial) results of the aggregate expressions themselves, which were computed per group of a finer
+  // grouping. These are combined by SUMming COUNTs and by applying the other aggregate functions once more.
+  bool combines_partial_aggregates{false};
+
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
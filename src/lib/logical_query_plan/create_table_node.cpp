@@ -6,8 +6,12 @@
 
 namespace opossum {
 
-CreateTableNode::CreateTableNode(const std::string& table_name, const TableColumnDefinitions& column_definitions)
-    : BaseNonQueryNode(LQPNodeType::CreateTable), table_name(table_name), column_definitions(column_definitions) {}
+CreateTableNode::CreateTableNode(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+                                 const ChunkOffset max_chunk_size)
+    : BaseNonQueryNode(LQPNodeType::CreateTable),
+      table_name(table_name),
+      column_definitions(column_definitions),
+      max_chunk_size(max_chunk_size) {}
 
 std::string CreateTableNode::description() const {
   std::ostringstream stream;
@@ -28,17 +32,19 @@ std::string CreateTableNode::description() const {
     }
   }
   stream << ")";
+  if (max_chunk_size != Chunk::DEFAULT_SIZE) stream << " ChunkSize: " << max_chunk_size;
 
   return stream.str();
 }
 
 std::shared_ptr<AbstractLQPNode> CreateTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return CreateTableNode::make(table_name, column_definitions);
+  return CreateTableNode::make(table_name, column_definitions, max_chunk_size);
 }
 
 bool CreateTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& create_table_node = static_cast<const CreateTableNode&>(rhs);
-  return table_name == create_table_node.table_name && column_definitions == create_table_node.column_definitions;
+  return table_name == create_table_node.table_name && column_definitions == create_table_node.column_definitions &&
+         max_chunk_size == create_table_node.max_chunk_size;
 }
 
 }  // namespace opossum
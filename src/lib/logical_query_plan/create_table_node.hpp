@@ -4,6 +4,7 @@
 
 #include "base_non_query_node.hpp"
 #include "enable_make_for_lqp_node.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table_column_definition.hpp"
 
 namespace opossum {
@@ -13,12 +14,14 @@ namespace opossum {
  */
 class CreateTableNode : public EnableMakeForLQPNode<CreateTableNode>, public BaseNonQueryNode {
  public:
-  CreateTableNode(const std::string& table_name, const TableColumnDefinitions& column_definitions);
+  CreateTableNode(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+                  const ChunkOffset max_chunk_size = Chunk::DEFAULT_SIZE);
 
   std::string description() const override;
 
   const std::string table_name;
   const TableColumnDefinitions column_definitions;
+  const ChunkOffset max_chunk_size;
 
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
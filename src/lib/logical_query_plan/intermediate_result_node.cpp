@@ -0,0 +1,63 @@
+#include "intermediate_result_node.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lqp_utils.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IntermediateResultNode::IntermediateResultNode(const std::shared_ptr<AbstractLQPNode>& subplan,
+                                               const std::shared_ptr<const Table>& table,
+                                               const std::shared_ptr<TableStatistics>& statistics)
+    : AbstractLQPNode(LQPNodeType::IntermediateResult),
+      table(table),
+      _subplan(subplan),
+      _statistics(statistics),
+      _column_expressions(subplan->column_expressions()) {
+  Assert(table->column_count() == _column_expressions.size(), "Table does not match the output of the subplan");
+
+  _column_nullabilities.reserve(_column_expressions.size());
+  for (auto column_id = ColumnID{0}; column_id < _column_expressions.size(); ++column_id) {
+    _column_nullabilities.emplace_back(subplan->is_column_nullable(column_id));
+  }
+}
+
+std::string IntermediateResultNode::description() const {
+  return "[IntermediateResult] " + std::to_string(table->row_count()) + " rows";
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& IntermediateResultNode::column_expressions() const {
+  return _column_expressions;
+}
+
+bool IntermediateResultNode::is_column_nullable(const ColumnID column_id) const {
+  Assert(column_id < _column_nullabilities.size(), "ColumnID out of range");
+  return _column_nullabilities[column_id];
+}
+
+std::shared_ptr<TableStatistics> IntermediateResultNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  return _statistics;
+}
+
+std::shared_ptr<AbstractLQPNode> IntermediateResultNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  // The copy outputs the column expressions of the same subplan, so expressions that refer to them are not adapted
+  visit_lqp(_subplan, [&](const auto& node) {
+    node_mapping.emplace(node, node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  return IntermediateResultNode::make(_subplan, table, _statistics);
+}
+
+bool IntermediateResultNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& intermediate_result_node = static_cast<const IntermediateResultNode&>(rhs);
+  return table == intermediate_result_node.table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class Table;
+class TableStatistics;
+
+/**
+ * Stands in for a subplan that has already been executed, e.g., during adaptive re-optimization (see
+ * SQLPipelineStatement) or for a MaterializedView (see MaterializedViewRule). It outputs the result table of the
+ * subplan with the same column expressions, so that expressions of the remaining LQP that refer to these columns stay
+ * valid. Its statistics carry the actual row count of the result.
+ *
+ * The node keeps the executed subplan alive, as the column expressions reference its nodes. As these nodes are not part
+ * of the LQP anymore, copies of the node share the subplan, and deep copies of the LQP keep referring to its nodes.
+ */
+class IntermediateResultNode : public EnableMakeForLQPNode<IntermediateResultNode>, public AbstractLQPNode {
+ public:
+  IntermediateResultNode(const std::shared_ptr<AbstractLQPNode>& subplan, const std::shared_ptr<const Table>& table,
+                         const std::shared_ptr<TableStatistics>& statistics);
+
+  std::string description() const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input = nullptr) const override;
+
+  const std::shared_ptr<const Table> table;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+
+ private:
+  const std::shared_ptr<AbstractLQPNode> _subplan;
+  const std::shared_ptr<TableStatistics> _statistics;
+  const std::vector<std::shared_ptr<AbstractExpression>> _column_expressions;
+  std::vector<bool> _column_nullabilities;
+};
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#include "intersect_node.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IntersectNode::IntersectNode(const SetOperationMode set_operation_mode)
+    : AbstractLQPNode(LQPNodeType::Intersect), set_operation_mode(set_operation_mode) {}
+
+std::string IntersectNode::description() const {
+  return "[IntersectNode] Mode: " + set_operation_mode_to_string.at(set_operation_mode);
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& IntersectNode::column_expressions() const {
+  Assert(left_input()->column_expressions().size() == right_input()->column_expressions().size(),
+         "Inputs must have the same number of columns");
+  return left_input()->column_expressions();
+}
+
+bool IntersectNode::is_column_nullable(const ColumnID column_id) const {
+  Assert(left_input(), "Need left input to determine nullability");
+  return left_input()->is_column_nullable(column_id);
+}
+
+std::shared_ptr<TableStatistics> IntersectNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(left_input && right_input, "IntersectNode needs left_input and right_input");
+
+  // The output is a subset of the left input, which is the best estimation we have for now
+  return left_input->get_statistics();
+}
+
+std::shared_ptr<AbstractLQPNode> IntersectNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  return IntersectNode::make(set_operation_mode);
+}
+
+bool IntersectNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& intersect_node = static_cast<const IntersectNode&>(rhs);
+  return set_operation_mode == intersect_node.set_operation_mode;
+}
+
+}  // namespace opossum
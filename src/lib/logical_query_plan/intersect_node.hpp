@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * SQL's INTERSECT [ALL]. Outputs the rows of the left input that also occur in the right input. The columns are matched by position, the
+ * output columns are those of the left input.
+ */
+class IntersectNode : public EnableMakeForLQPNode<IntersectNode>, public AbstractLQPNode {
+ public:
+  explicit IntersectNode(const SetOperationMode set_operation_mode);
+
+  std::string description() const override;
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input) const override;
+
+  const SetOperationMode set_operation_mode;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+}  // namespace opossum
@@ -11,12 +11,14 @@
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -25,6 +27,7 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_limit.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
@@ -94,13 +97,23 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
   auto input_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
 
+  // The right inputs of jittable joins are not part of the operator chain, but are built before the chain is executed
+  auto build_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  auto join_count = size_t{0};
+
   bool use_validate = false;
   bool validate_after_filter = false;
 
   // Traverse query tree until a non-jittable nodes is found in each branch
   visit_lqp(node, [&](auto& current_node) {
+    if (build_nodes.count(current_node)) return LQPVisitation::DoNotVisitInputs;
+
     const auto is_root_node = current_node == node;
     if (_node_is_jittable(current_node, is_root_node)) {
+      if (current_node->type == LQPNodeType::Join) {
+        build_nodes.emplace(current_node->right_input());
+        ++join_count;
+      }
       use_validate |= current_node->type == LQPNodeType::Validate;
       validate_after_filter |= use_validate && current_node->type == LQPNodeType::Predicate;
       if (requires_computation(current_node)) ++jittable_node_count;
@@ -130,6 +143,21 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   // The input_node is not being integrated into the operator chain, but instead serves as the input to the JitOperators
   const auto input_node = *input_nodes.begin();
 
+  // Joins are fused into the operator chain as JitHashJoinProbes. These are placed after the JitFilter and JitValidate
+  // operators, so we only support joins on the path from the root node to the input node (i.e., the probe side) with no
+  // PredicateNode, UnionNode, or ValidateNode above them.
+  auto join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  for (auto current_node = node; current_node != input_node; current_node = current_node->left_input()) {
+    if (current_node->type == LQPNodeType::Join) {
+      join_nodes.emplace_back(std::static_pointer_cast<JoinNode>(current_node));
+    } else if (join_nodes.size() < join_count &&
+               (current_node->type == LQPNodeType::Predicate || current_node->type == LQPNodeType::Union ||
+                current_node->type == LQPNodeType::Validate)) {
+      return nullptr;
+    }
+  }
+  if (join_nodes.size() != join_count || build_nodes.count(input_node)) return nullptr;
+
   const auto jit_operator = std::make_shared<JitOperatorWrapper>(translate_node(input_node));
   const auto read_tuples = std::make_shared<JitReadTuples>(use_validate, row_count_expression);
   jit_operator->add_jit_operator(read_tuples);
@@ -158,6 +186,33 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
   if (use_validate && validate_after_filter) jit_operator->add_jit_operator(std::make_shared<JitValidate>());
 
+  // Add the probe operators bottom-up, so that the key of a probe can reference the columns of lower build sides
+  auto build_sides = BuildSides{};
+  for (auto join_node_iter = join_nodes.rbegin(); join_node_iter != join_nodes.rend(); ++join_node_iter) {
+    const auto& join_node = *join_node_iter;
+    const auto& build_node = join_node->right_input();
+    const auto join_predicate = std::static_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+
+    auto probe_operand = join_predicate->left_operand();
+    auto build_operand = join_predicate->right_operand();
+    if (!build_node->find_column_id(*build_operand)) std::swap(probe_operand, build_operand);
+    const auto build_key_column_id = build_node->find_column_id(*build_operand);
+    if (!build_key_column_id) return nullptr;
+
+    const auto probe_key =
+        _try_translate_expression_to_jit_expression(probe_operand, *read_tuples, input_node, build_sides);
+    if (!probe_key) return nullptr;
+    if (probe_key->expression_type() != JitExpressionType::Column) {
+      jit_operator->add_jit_operator(std::make_shared<JitCompute>(probe_key));
+    }
+
+    const auto build_input_idx = jit_operator->add_build_input(translate_node(build_node));
+    const auto hash_join_probe =
+        std::make_shared<JitHashJoinProbe>(build_input_idx, probe_key->result_entry(), *build_key_column_id);
+    jit_operator->add_jit_operator(hash_join_probe);
+    build_sides.emplace_back(build_node, hash_join_probe);
+  }
+
   if (node->type == LQPNodeType::Aggregate) {
     // Since aggregate nodes cause materialization, there is at most one JitAggregate operator in each operator chain
     // and it must be the last operator of the chain. The _node_is_jittable function takes care of this by rejecting
@@ -170,7 +225,7 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
          ++expression_idx) {
       const auto& groupby_expression = aggregate_node->node_expressions[expression_idx];
       const auto jit_expression =
-          _try_translate_expression_to_jit_expression(groupby_expression, *read_tuples, input_node);
+          _try_translate_expression_to_jit_expression(groupby_expression, *read_tuples, input_node, build_sides);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each computed groupby column ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -196,8 +251,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
         aggregate->add_aggregate_column(aggregate_expression->as_column_name(), {DataType::Long, false, tuple_index},
                                         aggregate_expression->aggregate_function);
       } else {
-        const auto jit_expression =
-            _try_translate_expression_to_jit_expression(aggregate_expression->arguments[0], *read_tuples, input_node);
+        const auto jit_expression = _try_translate_expression_to_jit_expression(
+            aggregate_expression->arguments[0], *read_tuples, input_node, build_sides);
         if (!jit_expression) return nullptr;
         // Create a JitCompute operator for each aggregate expression on a computed value ...
         if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -226,7 +281,7 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
       for (const auto& column_expression : node->column_expressions()) {
         const auto jit_expression =
-            _try_translate_expression_to_jit_expression(column_expression, *read_tuples, input_node);
+            _try_translate_expression_to_jit_expression(column_expression, *read_tuples, input_node, build_sides);
         if (!jit_expression) return nullptr;
         // Add a compute operator for each computed output column (i.e., a column that is not from a stored table).
         if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -256,7 +311,7 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
 std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expression_to_jit_expression(
     const std::shared_ptr<AbstractExpression>& expression, JitReadTuples& jit_source,
-    const std::shared_ptr<AbstractLQPNode>& input_node) const {
+    const std::shared_ptr<AbstractLQPNode>& input_node, const BuildSides& build_sides) const {
   const auto input_node_column_id = input_node->find_column_id(*expression);
   if (input_node_column_id) {
     const auto tuple_entry = jit_source.add_input_column(
@@ -265,12 +320,23 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     return std::make_shared<JitExpression>(tuple_entry);
   }
 
+  // Columns of a build side are written to the runtime tuple by the corresponding JitHashJoinProbe
+  for (const auto& [build_node, hash_join_probe] : build_sides) {
+    if (const auto build_column_id = build_node->find_column_id(*expression)) {
+      const auto tuple_entry = hash_join_probe->add_build_column(
+          *build_column_id, expression->data_type(), build_node->is_column_nullable(*build_column_id), jit_source);
+      return std::make_shared<JitExpression>(tuple_entry);
+    }
+  }
+
   std::shared_ptr<const JitExpression> left, right;
   switch (expression->type) {
     case ExpressionType::Value: {
       const auto value_expression = std::dynamic_pointer_cast<const ValueExpression>(expression);
       const auto tuple_entry = jit_source.add_literal_value(value_expression->value);
-      return std::make_shared<JitExpression>(tuple_entry, value_expression->value);
+      // The literal is read from the runtime tuple rather than folded into the specialized code, so that the compiled
+      // pipeline can be reused from the JitCodeCache for other values of the literal
+      return std::make_shared<JitExpression>(tuple_entry);
     }
 
     case ExpressionType::CorrelatedParameter: {
@@ -288,7 +354,8 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     case ExpressionType::Logical: {
       std::vector<std::shared_ptr<const JitExpression>> jit_expression_arguments;
       for (const auto& argument : expression->arguments) {
-        const auto jit_expression = _try_translate_expression_to_jit_expression(argument, jit_source, input_node);
+        const auto jit_expression =
+            _try_translate_expression_to_jit_expression(argument, jit_source, input_node, build_sides);
         if (!jit_expression) return nullptr;
         jit_expression_arguments.emplace_back(jit_expression);
       }
@@ -336,8 +403,9 @@ bool JitAwareLQPTranslator::_expression_is_jittable(const std::shared_ptr<Abstra
     }
     case ExpressionType::Aggregate: {
       const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
-      // We do not support the count distinct function yet.
-      return aggregate_expression->aggregate_function != AggregateFunction::CountDistinct;
+      // We do not support the count distinct functions yet.
+      return aggregate_expression->aggregate_function != AggregateFunction::CountDistinct &&
+             aggregate_expression->aggregate_function != AggregateFunction::ApproxCountDistinct;
     }
     case ExpressionType::Arithmetic:
     case ExpressionType::Logical:
@@ -357,13 +425,32 @@ bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPN
     return false;
   }
 
-  if (node->type == LQPNodeType::Limit) {
+  // The JitAggregate cannot combine partial aggregates
+  if (node->type == LQPNodeType::Aggregate &&
+      std::static_pointer_cast<AggregateNode>(node)->combines_partial_aggregates) {
+    return false;
+  }
+
+  if (const auto limit_node = std::dynamic_pointer_cast<LimitNode>(node)) {
+    // A TopK is executed together with the SortNode below it, which is not jittable
+    if (limit_node->limit_type == LimitType::TopK) return false;
+
     // Limit must be the last node in the jittable operator pipeline. Hence, the the root node in the lpp.
     return is_root_node;
   }
 
   if (const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node)) {
-    if (predicate_node->scan_type == ScanType::IndexScan) return false;
+    if (predicate_node->scan_type != ScanType::TableScan) return false;
+  }
+
+  if (const auto join_node = std::dynamic_pointer_cast<JoinNode>(node)) {
+    // Only inner equi-joins on keys of the same data type can be executed by a JitHashJoinProbe. The build side must
+    // not be shared with other parts of the plan, since it is executed by the JitOperatorWrapper.
+    if (join_node->join_mode != JoinMode::Inner || join_node->right_input()->output_count() != 1) return false;
+    const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+    return join_predicate && join_predicate->predicate_condition == PredicateCondition::Equals &&
+           join_predicate->left_operand()->data_type() == join_predicate->right_operand()->data_type() &&
+           !is_logical_data_type(join_predicate->left_operand()->data_type());
   }
 
   if (node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Projection ||
@@ -373,6 +460,12 @@ bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPN
     for (const auto& expression : node->node_expressions) {
       // Recursively iterate over each nested expression
       visit_expression(expression, [&](const auto& current_expression) {
+        // The JitTupleEntries only know the stored data types, not the logical Date, Timestamp, and Decimal types
+        if (is_logical_data_type(current_expression->data_type())) {
+          node_is_jittable = false;
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+
         // Check if expression was already evaluated in a previous node
         if (parent_lqp_node->find_column_id(*current_expression)) {
           return ExpressionVisitation::DoNotVisitArguments;
@@ -5,6 +5,7 @@
 #if HYRISE_JIT_SUPPORT
 
 #include "operators/jit_operator/operators/jit_expression.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 
 namespace opossum {
@@ -32,6 +33,10 @@ namespace opossum {
  *    The output columns are determined by the top-most ProjectionNode. If there is no ProjectionNode, all columns from
  *    the input node are considered as outputs.
  *    In case we find any PredicateNode or UnionNode during our traversal, we need to create a JitFilter operator.
+ *    Inner equi-joins on the path from the root node to the input node are translated to JitHashJoinProbe operators,
+ *    which follow the JitFilter. Their right inputs are not part of the chain, but are translated separately and
+ *    added to the JitOperatorWrapper as build inputs. This way, a scan followed by several joins and an aggregate
+ *    (e.g., of a star join) is executed in a single loop.
  *    Whenever a non-primitive value (such as a predicate conditions, LQPExpression of LQPColumnReferences - which
  *    can in turn reference a LQPExpression in a ProjectionNode) is encountered, it is converted to an JitExpression
  *    by a helper method first. We then add a JitCompute operator to our chain and use its result value instead of the
@@ -42,12 +47,15 @@ class JitAwareLQPTranslator final : public LQPTranslator {
   std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
 
  private:
+  // The build side nodes of the joins translated so far, with the JitHashJoinProbes that provide their columns
+  using BuildSides = std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, std::shared_ptr<JitHashJoinProbe>>>;
+
   std::shared_ptr<JitOperatorWrapper> _try_translate_sub_plan_to_jit_operators(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
   std::shared_ptr<const JitExpression> _try_translate_expression_to_jit_expression(
       const std::shared_ptr<AbstractExpression>& expression, JitReadTuples& jit_source,
-      const std::shared_ptr<AbstractLQPNode>& input_node) const;
+      const std::shared_ptr<AbstractLQPNode>& input_node, const BuildSides& build_sides = {}) const;
 
   // Returns whether an LQP node with its current configuration can be part of an operator pipeline.
   bool _node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node, const bool is_root_node) const;
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <string>
 
+#include "boost/functional/hash.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "utils/assert.hpp"
@@ -15,19 +16,26 @@ LimitNode::LimitNode(const std::shared_ptr<AbstractExpression>& num_rows_express
 std::string LimitNode::description() const {
   std::stringstream stream;
   stream << "[Limit] " << num_rows_expression()->as_column_name();
+  if (limit_type == LimitType::TopK) stream << " (TopK)";
   return stream.str();
 }
 
 std::shared_ptr<AbstractExpression> LimitNode::num_rows_expression() const { return node_expressions[0]; }
 
 std::shared_ptr<AbstractLQPNode> LimitNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  const auto limit_node =
+      LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  limit_node->limit_type = limit_type;
+  return limit_node;
 }
 
 bool LimitNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& limit_node = static_cast<const LimitNode&>(rhs);
-  return expression_equal_to_expression_in_different_lqp(*num_rows_expression(), *limit_node.num_rows_expression(),
+  return limit_type == limit_node.limit_type &&
+         expression_equal_to_expression_in_different_lqp(*num_rows_expression(), *limit_node.num_rows_expression(),
                                                          node_mapping);
 }
 
+size_t LimitNode::_on_shallow_hash() const { return boost::hash_value(static_cast<size_t>(limit_type)); }
+
 }  // namespace opossum
@@ -6,6 +6,9 @@
 
 namespace opossum {
 
+// TopK means that the LimitNode is translated together with the SortNode below it into a TopK operator
+enum class LimitType : uint8_t { Limit, TopK };
+
 /**
  * This node type represents limiting a result to a certain number of rows (LIMIT operator).
  */
@@ -17,9 +20,12 @@ class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode
 
   std::shared_ptr<AbstractExpression> num_rows_expression() const;
 
+  LimitType limit_type{LimitType::Limit};
+
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+  size_t _on_shallow_hash() const override;
 };
 
 }  // namespace opossum
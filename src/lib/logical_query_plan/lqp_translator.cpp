@@ -8,6 +8,8 @@
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
+#include "cache/subplan_result_cache.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -15,6 +17,7 @@
 #include "drop_table_node.hpp"
 #include "drop_view_node.hpp"
 #include "dummy_table_node.hpp"
+#include "except_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/between_expression.hpp"
@@ -27,16 +30,26 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "insert_node.hpp"
+#include "intermediate_result_node.hpp"
+#include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/alias_operator.hpp"
+#include "operators/cached_subplan.hpp"
 #include "operators/delete.hpp"
+#include "operators/difference.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/intersect.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_range.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -53,23 +66,30 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 #include "validate_node.hpp"
+#include "window_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator(const CacheSubplanResults cache_subplan_results)
+    : _cache_subplan_results(cache_subplan_results) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -93,7 +113,26 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
     return operator_iter->second;
   }
 
-  const auto pqp = _translate_by_node_type(node->type, node);
+  // Small aggregates are likely to be the result of a lookup in a dimension table, which is repeated by many queries
+  auto pqp = std::shared_ptr<AbstractOperator>{};
+  if (_cache_subplan_results == CacheSubplanResults::Yes && node->type == LQPNodeType::Aggregate &&
+      node->get_statistics()->row_count() <= SubplanResultCache::MAX_ROW_COUNT) {
+    pqp = _translate_cached_subplan(node);
+  }
+  if (!pqp) pqp = _translate_by_node_type(node->type, node);
+
+  // See LimitPushdownRule
+  if (node->row_count_hint) {
+    if (const auto chunkwise_operator = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(pqp)) {
+      chunkwise_operator->set_row_count_hint(node->row_count_hint);
+    } else if (const auto get_table = std::dynamic_pointer_cast<GetTable>(pqp)) {
+      get_table->set_row_count_hint(node->row_count_hint);
+    }
+  }
+
+  // Do not overwrite the node of an operator that was translated for an input node and returned unchanged
+  if (!pqp->lqp_node) pqp->lqp_node = node;
+
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
@@ -113,9 +152,13 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::Insert:             return _translate_insert_node(node);
     case LQPNodeType::Delete:             return _translate_delete_node(node);
     case LQPNodeType::DummyTable:         return _translate_dummy_table_node(node);
+    case LQPNodeType::IntermediateResult: return _translate_intermediate_result_node(node);
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
+    case LQPNodeType::Intersect:          return _translate_intersect_node(node);
+    case LQPNodeType::Except:             return _translate_except_node(node);
+    case LQPNodeType::Window:             return _translate_window_node(node);
 
       // Maintenance operators
     case LQPNodeType::ShowTables:         return _translate_show_tables_node(node);
@@ -137,27 +180,158 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
   const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
   const auto get_table = std::make_shared<GetTable>(stored_table_node->table_name);
   get_table->set_excluded_chunk_ids(stored_table_node->excluded_chunk_ids());
+  get_table->set_table_sample(stored_table_node->table_sample());
   return get_table;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+  if (const auto join_range = _translate_predicate_node_to_join_range(predicate_node)) return join_range;
+  if (const auto join_hash = _translate_predicate_node_to_join_hash(predicate_node)) return join_hash;
+
   const auto input_node = node->left_input();
   const auto input_operator = translate_node(input_node);
-  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
 
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
       return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
     case ScanType::IndexScan:
+    case ScanType::IndexOnlyScan:
       return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
   }
 
   Fail("GCC thinks this is reachable");
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_join_range(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * `a BETWEEN b AND c` on top of a cross join, where a is a column of one input and b and c are columns of the other
+   * input (e.g., the result of `JOIN ... ON a BETWEEN b AND c`), is executed as a band join with the predicates
+   * `a >= b` and `a <= c`. Without it, the whole cross product would be built and scanned.
+   */
+  const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(node->predicate());
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(node->left_input());
+  if (!between_expression || !join_node || join_node->join_mode != JoinMode::Cross) return nullptr;
+
+  const auto data_type = between_expression->value()->data_type();
+  if (between_expression->lower_bound()->data_type() != data_type ||
+      between_expression->upper_bound()->data_type() != data_type) {
+    return nullptr;
+  }
+
+  const auto& left_input = *join_node->left_input();
+  const auto& right_input = *join_node->right_input();
+  const auto lower_bound_predicate = OperatorJoinPredicate::from_expression(
+      BinaryPredicateExpression{PredicateCondition::GreaterThanEquals, between_expression->value(),
+                                between_expression->lower_bound()},
+      left_input, right_input);
+  const auto upper_bound_predicate = OperatorJoinPredicate::from_expression(
+      BinaryPredicateExpression{PredicateCondition::LessThanEquals, between_expression->value(),
+                                between_expression->upper_bound()},
+      left_input, right_input);
+  if (!lower_bound_predicate || !upper_bound_predicate) return nullptr;
+
+  // Both bounds need to come from the same input
+  if (lower_bound_predicate->column_ids.first != upper_bound_predicate->column_ids.first &&
+      lower_bound_predicate->column_ids.second != upper_bound_predicate->column_ids.second) {
+    return nullptr;
+  }
+
+  return std::make_shared<JoinRange>(translate_node(join_node->left_input()), translate_node(join_node->right_input()),
+                                     JoinMode::Inner, lower_bound_predicate->column_ids,
+                                     lower_bound_predicate->predicate_condition, upper_bound_predicate);
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_join_hash(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * Joins on composite keys (e.g., `a.x = b.x AND a.y = b.y`) are represented as a JoinNode with one of the predicates
+   * and PredicateNodes with the others on top of it. Instead of scanning the output of the join, which contains all
+   * rows matching in the first column, the predicates are evaluated by the JoinHash while probing.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{node};
+  while (predicate_nodes.back()->left_input()->type == LQPNodeType::Predicate) {
+    const auto input_node = predicate_nodes.back()->left_input();
+    if (input_node->output_count() > 1) return nullptr;
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(input_node));
+  }
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(predicate_nodes.back()->left_input());
+  if (!join_node || join_node->join_mode != JoinMode::Inner || join_node->output_count() > 1) return nullptr;
+
+  const auto operator_join_predicate = OperatorJoinPredicate::from_expression(
+      *join_node->join_predicate(), *join_node->left_input(), *join_node->right_input());
+  if (!operator_join_predicate || operator_join_predicate->predicate_condition != PredicateCondition::Equals ||
+      _join_implementation(join_node, *operator_join_predicate) != JoinImplementation::Hash) {
+    return nullptr;
+  }
+
+  // All predicates between the topmost one and the join need to compare a column of each input
+  auto secondary_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto secondary_predicate = OperatorJoinPredicate::from_expression(
+        *predicate_node->predicate(), *join_node->left_input(), *join_node->right_input());
+    if (!secondary_predicate) return nullptr;
+
+    switch (secondary_predicate->predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        break;
+      default:
+        return nullptr;
+    }
+
+    const auto left_is_string = join_node->left_input()->column_expressions()[secondary_predicate->column_ids.first]
+                                    ->data_type() == DataType::String;
+    const auto right_is_string = join_node->right_input()->column_expressions()[secondary_predicate->column_ids.second]
+                                     ->data_type() == DataType::String;
+    if (left_is_string != right_is_string) return nullptr;
+
+    secondary_predicates.emplace_back(*secondary_predicate);
+  }
+
+  return std::make_shared<JoinHash>(translate_node(join_node->left_input()), translate_node(join_node->right_input()),
+                                    JoinMode::Inner, operator_join_predicate->column_ids, PredicateCondition::Equals,
+                                    std::nullopt, secondary_predicates);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  const auto index_scan = _create_index_scan(node, input_operator);
+
+  const auto predicate = std::static_pointer_cast<AbstractPredicateExpression>(node->predicate());
+  const auto column_ids = std::vector<ColumnID>{node->left_input()->get_column_id(*predicate->arguments[0])};
+
+  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  const auto table_name = stored_table_node->table_name;
+  const auto table = StorageManager::get().get_table(table_name);
+
+  // A table-level index covers all chunks of the table, so no TableScan is needed
+  if (predicate->predicate_condition == PredicateCondition::Equals && table->get_table_index(column_ids[0]) &&
+      stored_table_node->excluded_chunk_ids().empty()) {
+    return index_scan;
+  }
+
+  const auto indexed_chunks = _get_indexed_chunk_ids(*table, column_ids);
+
+  // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
+  // TableScan(s).
+  const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
+
+  index_scan->set_included_chunk_ids(indexed_chunks);
+  table_scan->set_excluded_chunk_ids(indexed_chunks);
+
+  return std::make_shared<UnionPositions>(index_scan, table_scan);
+}
+
+std::shared_ptr<IndexScan> LQPTranslator::_create_index_scan(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
    * Not using OperatorScanPredicate, since it splits up BETWEEN into two scans for some cases that TableScan cannot handle
    */
@@ -193,29 +367,50 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   std::vector<AllTypeVariant> right_values2 = {};
   if (value2_variant) right_values2.emplace_back(*value2_variant);
 
-  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
-  const auto table_name = stored_table_node->table_name;
-  const auto table = StorageManager::get().get_table(table_name);
+  return std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                     predicate->predicate_condition, right_values, right_values2);
+}
+
+std::vector<ChunkID> LQPTranslator::_get_indexed_chunk_ids(const Table& table,
+                                                           const std::vector<ColumnID>& column_ids) const {
   std::vector<ChunkID> indexed_chunks;
 
-  for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-    if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+  for (ChunkID chunk_id{0u}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    // Mutable chunks are indexed by a mutable index until they are compressed
+    if (chunk && (chunk->get_index(SegmentIndexType::GroupKey, column_ids) ||
+                  (column_ids.size() == 1 && chunk->get_mutable_index(column_ids[0])))) {
       indexed_chunks.emplace_back(chunk_id);
     }
   }
 
-  // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
-  // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
-
-  const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
+  return indexed_chunks;
+}
 
-  index_scan->set_included_chunk_ids(indexed_chunks);
-  table_scan->set_excluded_chunk_ids(indexed_chunks);
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_index_only_scan(
+    const std::shared_ptr<AbstractLQPNode>& node, const IndexScanOutput output) const {
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node->left_input());
+  if (!predicate_node || predicate_node->scan_type != ScanType::IndexOnlyScan) return nullptr;
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(predicate_node->left_input());
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  const auto predicate = std::static_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+  const auto column_ids =
+      std::vector<ColumnID>{predicate_node->left_input()->get_column_id(*predicate->arguments[0])};
+
+  // The result can only be computed from indexes if they cover all chunks. Otherwise, the unindexed chunks have to be
+  // scanned and the predicate is executed as a regular IndexScan.
+  if (predicate->predicate_condition != PredicateCondition::Equals || !table->get_table_index(column_ids[0])) {
+    auto existing_chunk_count = size_t{0};
+    for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (table->get_chunk(chunk_id)) ++existing_chunk_count;
+    }
+    if (_get_indexed_chunk_ids(*table, column_ids).size() != existing_chunk_count) return nullptr;
+  }
 
-  return std::make_shared<UnionPositions>(index_scan, table_scan);
+  const auto index_scan = _create_index_scan(predicate_node, translate_node(predicate_node->left_input()));
+  index_scan->set_index_only_output(output, node->column_expressions()[0]->as_column_name());
+  return index_scan;
 }
 
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
@@ -241,6 +436,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_alias_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (const auto index_scan = _translate_index_only_scan(node, IndexScanOutput::Values)) return index_scan;
+
   const auto input_node = node->left_input();
   const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(node);
   const auto input_operator = translate_node(input_node);
@@ -251,34 +448,42 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
-  auto input_operator = translate_node(node->left_input());
+  const auto [sort_definitions, input_node] = _translate_sort_definitions(node);
+  return std::make_shared<Sort>(translate_node(input_node), sort_definitions);
+}
 
+std::pair<std::vector<SortColumnDefinition>, std::shared_ptr<AbstractLQPNode>>
+LQPTranslator::_translate_sort_definitions(const std::shared_ptr<AbstractLQPNode>& sort_node) const {
   /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
+   * Create a single sort operator for all order descriptions. Since sorting is stable, a chain of SortNodes is
+   * equivalent to a single Sort by the order descriptions of the topmost node, followed by those of the node below and
+   * so on. Thus, SortNodes directly below this one are merged into the same operator, unless the PQP of the lower
+   * node is used elsewhere, too.
    */
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  auto current_node = sort_node;
+
+  while (true) {
+    const auto current_sort_node = std::dynamic_pointer_cast<SortNode>(current_node);
+    const auto& pqp_expressions =
+        _translate_expressions(current_sort_node->node_expressions, current_sort_node->left_input());
+
+    auto order_by_mode_iter = current_sort_node->order_by_modes.begin();
+    for (const auto& pqp_expression : pqp_expressions) {
+      const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
+      Assert(pqp_column_expression,
+             "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+
+      sort_definitions.emplace_back(pqp_column_expression->column_id, *order_by_mode_iter);
+      ++order_by_mode_iter;
+    }
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
-
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
-    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
-    Assert(pqp_column_expression,
-           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
-
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
+    const auto input_node = current_node->left_input();
+    if (input_node->type != LQPNodeType::Sort || input_node->output_count() > 1) {
+      return {sort_definitions, input_node};
+    }
+    current_node = input_node;
   }
-
-  return current_pqp;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -305,18 +510,47 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
          "Couldn't translate join predicate: "s + join_node->join_predicate()->as_column_name());
 
   const auto predicate_condition = operator_join_predicate->predicate_condition;
-
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+  const auto& column_ids = operator_join_predicate->column_ids;
+
+  switch (_join_implementation(join_node, *operator_join_predicate)) {
+    case JoinImplementation::Hash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                        predicate_condition);
+    case JoinImplementation::SortMerge:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
+                                             column_ids, predicate_condition);
+    case JoinImplementation::MPSM:
+      return std::make_shared<JoinMPSM>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                        predicate_condition);
+    case JoinImplementation::Index:
+      return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                         predicate_condition);
+    case JoinImplementation::Range:
+      return std::make_shared<JoinRange>(input_left_operator, input_right_operator, join_node->join_mode, column_ids,
+                                         predicate_condition);
   }
+  Fail("GCC thinks this is reachable");
+}
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+JoinImplementation LQPTranslator::_join_implementation(const std::shared_ptr<JoinNode>& join_node,
+                                                      const OperatorJoinPredicate& operator_join_predicate) const {
+  // Pick the join implementation that is expected to be the fastest. If none of them supports the join (e.g., non-equi
+  // joins of columns with different data types), fall back to the hash join for equi joins and the sort merge join
+  // else. On machines with multiple NUMA nodes, the cost model prefers JoinMPSM for large inputs that JoinHash cannot
+  // join.
+  const auto join_features = CostModelPhysical::join_features(join_node, operator_join_predicate);
+  const auto join_implementation = CostModelPhysical{}.cheapest_join_implementation(join_features);
+  if (join_implementation) return *join_implementation;
+
+  const auto use_hash = operator_join_predicate.predicate_condition == PredicateCondition::Equals &&
+                        join_node->join_mode != JoinMode::Outer;
+  return use_hash ? JoinImplementation::Hash : JoinImplementation::SortMerge;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (const auto index_scan = _translate_index_only_scan(node, IndexScanOutput::Count)) return index_scan;
+
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
 
   const auto input_operator = translate_node(node->left_input());
@@ -335,6 +569,16 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
     const auto& aggregate_expression = std::static_pointer_cast<AggregateExpression>(expression);
 
+    // Partial results of the aggregate are combined, see AggregateNode::combines_partial_aggregates
+    if (aggregate_node->combines_partial_aggregates) {
+      const auto partial_aggregate_column_id = node->left_input()->get_column_id(*aggregate_expression);
+      const auto aggregate_function = aggregate_expression->aggregate_function == AggregateFunction::Count
+                                          ? AggregateFunction::Sum
+                                          : aggregate_expression->aggregate_function;
+      aggregate_column_definitions.emplace_back(partial_aggregate_column_id, aggregate_function);
+      continue;
+    }
+
     // Always resolve the aggregate to a column, even if it is a Value. The Aggregate operator only takes columns as
     // arguments
     if (aggregate_expression->argument()) {
@@ -359,15 +603,35 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(*column_id);
   }
 
-  return std::make_shared<Aggregate>(input_operator, aggregate_column_definitions, group_by_column_ids);
+  const auto aggregate = std::make_shared<Aggregate>(input_operator, aggregate_column_definitions, group_by_column_ids);
+  if (!aggregate_node->combines_partial_aggregates) return aggregate;
+
+  // The Aggregate operator names its output columns after its input columns, e.g., `SUM(COUNT(*))`. Restore the names
+  // of the aggregate expressions.
+  auto column_ids = std::vector<ColumnID>{};
+  auto column_names = std::vector<std::string>{};
+  for (auto column_id = ColumnID{0}; column_id < aggregate_node->node_expressions.size(); ++column_id) {
+    column_ids.emplace_back(column_id);
+    column_names.emplace_back(aggregate_node->node_expressions[column_id]->as_column_name());
+  }
+  return std::make_shared<AliasOperator>(aggregate, column_ids, column_names);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto num_rows_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  if (limit_node->limit_type == LimitType::TopK) {
+    // The SortNode below is fused into the TopK operator, see TopKRule
+    Assert(node->left_input()->type == LQPNodeType::Sort, "TopK expects a SortNode as its input");
+    const auto [sort_definitions, input_node] = _translate_sort_definitions(node->left_input());
+    return std::make_shared<TopK>(translate_node(input_node), sort_definitions, num_rows_expression);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  return std::make_shared<Limit>(input_operator, num_rows_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -408,12 +672,69 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
   Fail("GCC thinks this is reachable");
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intersect_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto intersect_node = std::dynamic_pointer_cast<IntersectNode>(node);
+
+  const auto input_operator_left = translate_node(node->left_input());
+  const auto input_operator_right = translate_node(node->right_input());
+
+  return std::make_shared<Intersect>(input_operator_left, input_operator_right, intersect_node->set_operation_mode);
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_except_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto except_node = std::dynamic_pointer_cast<ExceptNode>(node);
+
+  const auto input_operator_left = translate_node(node->left_input());
+  const auto input_operator_right = translate_node(node->right_input());
+
+  return std::make_shared<Difference>(input_operator_left, input_operator_right, except_node->set_operation_mode);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = translate_node(node->left_input());
+
+  // Like the arguments of aggregates, the arguments, PARTITION BY, and ORDER BY expressions of the window functions
+  // have to be available as columns of the input
+  auto window_function_definitions = std::vector<WindowFunctionDefinition>{};
+  window_function_definitions.reserve(node->node_expressions.size());
+  for (const auto& expression : node->node_expressions) {
+    Assert(expression->type == ExpressionType::WindowFunction,
+           "Expression '" + expression->as_column_name() + "' used by WindowNode is not a WindowFunctionExpression");
+    const auto& window_function_expression = static_cast<const WindowFunctionExpression&>(*expression);
+
+    auto definition = WindowFunctionDefinition{};
+    definition.window_function = window_function_expression.window_function;
+    if (const auto argument = window_function_expression.argument()) {
+      definition.argument_column_id = node->left_input()->get_column_id(*argument);
+    }
+
+    for (const auto& partition_by_expression : window_function_expression.partition_by_expressions()) {
+      definition.partition_by_column_ids.emplace_back(node->left_input()->get_column_id(*partition_by_expression));
+    }
+
+    const auto order_by_expressions = window_function_expression.order_by_expressions();
+    for (auto order_by_idx = size_t{0}; order_by_idx < order_by_expressions.size(); ++order_by_idx) {
+      const auto column_id = node->left_input()->get_column_id(*order_by_expressions[order_by_idx]);
+      definition.order_by_definitions.emplace_back(column_id, window_function_expression.order_by_modes[order_by_idx]);
+    }
+
+    definition.frame = window_function_expression.frame;
+    definition.column_name = window_function_expression.as_column_name();
+    window_function_definitions.emplace_back(std::move(definition));
+  }
+
+  return std::make_shared<Window>(input_operator, window_function_definitions);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_show_tables_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   DebugAssert(node->left_input() == nullptr, "ShowTables should not have an input operator.");
@@ -442,7 +763,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_view_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_create_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto create_table_node = std::dynamic_pointer_cast<CreateTableNode>(node);
-  return std::make_shared<CreateTable>(create_table_node->table_name, create_table_node->column_definitions);
+  return std::make_shared<CreateTable>(create_table_node->table_name, create_table_node->column_definitions,
+                                       create_table_node->max_chunk_size);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_table_node(
@@ -463,6 +785,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dummy_table_node(
   return std::make_shared<TableWrapper>(Projection::dummy_table());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intermediate_result_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto intermediate_result_node = std::dynamic_pointer_cast<IntermediateResultNode>(node);
+  return std::make_shared<TableWrapper>(intermediate_result_node->table);
+}
+
 std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
     const std::shared_ptr<AbstractExpression>& lqp_expression, const std::shared_ptr<AbstractLQPNode>& node) const {
   auto pqp_expression = lqp_expression->deep_copy();
@@ -488,7 +816,11 @@ std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
       const auto subquery_expression = std::dynamic_pointer_cast<LQPSubqueryExpression>(expression);
       Assert(subquery_expression, "Expected LQPSubqueryExpression");
 
-      const auto subquery_pqp = translate_node(subquery_expression->lqp);
+      auto subquery_pqp = std::shared_ptr<AbstractOperator>{};
+      if (_cache_subplan_results == CacheSubplanResults::Yes && subquery_expression->parameter_count() == 0) {
+        subquery_pqp = _translate_cached_subplan(subquery_expression->lqp);
+      }
+      if (!subquery_pqp) subquery_pqp = translate_node(subquery_expression->lqp);
 
       auto subquery_parameters = PQPSubqueryExpression::Parameters{};
       subquery_parameters.reserve(subquery_expression->parameter_count());
@@ -521,6 +853,15 @@ std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
   return pqp_expression;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_cached_subplan(
+    const std::shared_ptr<AbstractLQPNode>& lqp) const {
+  if (!SubplanResultCache::is_cacheable(lqp)) return nullptr;
+
+  // The subplan is translated separately, so that none of its operators is shared with (and executed by) the rest of
+  // the PQP. The LQP is copied, as it serves as the key of the cached result and must not be modified.
+  return std::make_shared<CachedSubplan>(lqp->deep_copy(), LQPTranslator{}.translate_node(lqp));
+}
+
 std::vector<std::shared_ptr<AbstractExpression>> LQPTranslator::_translate_expressions(
     const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
     const std::shared_ptr<AbstractLQPNode>& node) const {
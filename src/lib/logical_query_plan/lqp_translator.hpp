@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -12,17 +14,27 @@ namespace opossum {
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class IndexScan;
+class JoinNode;
 class PredicateNode;
+class Table;
 class TableScan;
+enum class IndexScanOutput;
+enum class JoinImplementation;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
+struct SortColumnDefinition;
 
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * With CacheSubplanResults::Yes, uncorrelated subqueries and aggregates with at most SubplanResultCache::MAX_ROW_COUNT
+ * estimated rows are wrapped in CachedSubplan operators, so that their results are reused across statements.
  */
 class LQPTranslator {
  public:
+  explicit LQPTranslator(const CacheSubplanResults cache_subplan_results = CacheSubplanResults::No);
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -37,18 +49,45 @@ class LQPTranslator {
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  // Returns a JoinRange if node is a BETWEEN on the output of a cross join that can be executed as a band join, else
+  // nullptr
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_join_range(
+      const std::shared_ptr<PredicateNode>& node) const;
+  // Returns a JoinHash if node is the topmost of the predicates between the inputs of an inner equi join that is
+  // executed as a hash join, else nullptr. These predicates are evaluated by the JoinHash as secondary predicates.
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_join_hash(
+      const std::shared_ptr<PredicateNode>& node) const;
+  std::shared_ptr<IndexScan> _create_index_scan(const std::shared_ptr<PredicateNode>& node,
+                                                const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::vector<ChunkID> _get_indexed_chunk_ids(const Table& table, const std::vector<ColumnID>& column_ids) const;
+
+  // Returns an IndexScan computing the output of node from the index if its input is an IndexOnlyScan, else nullptr
+  std::shared_ptr<AbstractOperator> _translate_index_only_scan(const std::shared_ptr<AbstractLQPNode>& node,
+                                                               const IndexScanOutput output) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // Collects the sort definitions of @param sort_node and all SortNodes directly below it that can be merged into the
+  // same operator. Returns the definitions and the input of the lowest merged SortNode.
+  std::pair<std::vector<SortColumnDefinition>, std::shared_ptr<AbstractLQPNode>> _translate_sort_definitions(
+      const std::shared_ptr<AbstractLQPNode>& sort_node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  JoinImplementation _join_implementation(const std::shared_ptr<JoinNode>& join_node,
+                                          const OperatorJoinPredicate& operator_join_predicate) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_dummy_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_intermediate_result_node(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_update_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_union_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_intersect_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_except_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_window_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -60,6 +99,9 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_create_prepared_plan_node(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Returns a CachedSubplan executing the translated LQP, or nullptr if the results of the LQP cannot be cached
+  std::shared_ptr<AbstractOperator> _translate_cached_subplan(const std::shared_ptr<AbstractLQPNode>& lqp) const;
+
   // Translate LQP- to PQPExpressions
   std::shared_ptr<AbstractExpression> _translate_expression(const std::shared_ptr<AbstractExpression>& lqp_expression,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -70,6 +112,8 @@ class LQPTranslator {
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
+
+  const CacheSubplanResults _cache_subplan_results;
 };
 
 }  // namespace opossum
@@ -1,7 +1,9 @@
 #include "lqp_utils.hpp"
 
+#include <algorithm>
 #include <set>
 
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -12,6 +14,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -95,6 +98,8 @@ LQPNodeMapping lqp_create_node_mapping(const std::shared_ptr<AbstractLQPNode>& l
 
 std::optional<LQPMismatch> lqp_find_subplan_mismatch(const std::shared_ptr<const AbstractLQPNode>& lhs,
                                                      const std::shared_ptr<const AbstractLQPNode>& rhs) {
+  if (lhs == rhs) return std::nullopt;
+
   // Check for type/structural mismatched
   auto mismatch = lqp_find_structure_mismatch(lhs, rhs);
   if (mismatch) return mismatch;
@@ -212,6 +217,9 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::CreateView:
       case LQPNodeType::DropView:
       case LQPNodeType::DummyTable:
+      case LQPNodeType::Except:
+      case LQPNodeType::IntermediateResult:
+      case LQPNodeType::Intersect:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
       case LQPNodeType::Predicate:
@@ -222,6 +230,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Sort:
       case LQPNodeType::StoredTable:
       case LQPNodeType::Union:
+      case LQPNodeType::Window:
       case LQPNodeType::Mock:
         return LQPVisitation::VisitInputs;
     }
@@ -239,6 +248,23 @@ namespace {
  * translated expressions to the translation of its children nodes which enables to add the translated expression of
  * child node before its parent node to the output expression.
  */
+// For an equi join, the operand of the predicate that stems from the left input and the one from the right input
+std::optional<std::pair<std::shared_ptr<AbstractExpression>, std::shared_ptr<AbstractExpression>>> equi_join_operands(
+    const JoinNode& join_node) {
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node.join_predicate());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+
+  if (join_node.left_input()->find_column_id(*predicate->left_operand()) &&
+      join_node.right_input()->find_column_id(*predicate->right_operand())) {
+    return std::make_pair(predicate->left_operand(), predicate->right_operand());
+  }
+  if (join_node.left_input()->find_column_id(*predicate->right_operand()) &&
+      join_node.right_input()->find_column_id(*predicate->left_operand())) {
+    return std::make_pair(predicate->right_operand(), predicate->left_operand());
+  }
+  return std::nullopt;
+}
+
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression_impl(
     const std::shared_ptr<AbstractLQPNode>& begin, const std::optional<const std::shared_ptr<AbstractLQPNode>>& end,
     const std::optional<const std::shared_ptr<AbstractExpression>>& subsequent_expression) {
@@ -284,6 +310,75 @@ std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression_impl(
 
 // Function wraps the call to the lqp_subplan_to_boolean_expression_impl() function to hide its third parameter,
 // subsequent_predicate, which is only used internally.
+bool lqp_columns_are_unique(const std::shared_ptr<AbstractLQPNode>& lqp, const ExpressionUnorderedSet& expressions) {
+  switch (lqp->type) {
+    case LQPNodeType::StoredTable: {
+      const auto& stored_table_node = static_cast<const StoredTableNode&>(*lqp);
+      const auto table = StorageManager::get().get_table(stored_table_node.table_name);
+      const auto& column_expressions = lqp->column_expressions();
+
+      for (const auto& constraint : table->get_unique_constraints()) {
+        // Multiple NULLs do not violate a UNIQUE constraint, but would form a single group
+        const auto constraint_applies = std::all_of(
+            constraint.columns.begin(), constraint.columns.end(), [&](const auto column_id) {
+              return !table->column_is_nullable(column_id) && expressions.count(column_expressions[column_id]) > 0;
+            });
+        if (constraint_applies) return true;
+      }
+      return false;
+    }
+
+    case LQPNodeType::Alias:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Validate:
+      // These nodes do not add rows. Expressions that the input does not contain are not unique in the input either.
+      return lqp_columns_are_unique(lqp->left_input(), expressions);
+
+    case LQPNodeType::Aggregate: {
+      const auto& aggregate_node = static_cast<const AggregateNode&>(*lqp);
+      const auto& node_expressions = aggregate_node.node_expressions;
+      const auto group_by_expressions = ExpressionUnorderedSet{
+          node_expressions.begin(), node_expressions.begin() + aggregate_node.aggregate_expressions_begin_idx};
+
+      // Each group is a single row
+      auto contained_group_by_expressions = ExpressionUnorderedSet{};
+      for (const auto& group_by_expression : group_by_expressions) {
+        if (expressions.count(group_by_expression)) contained_group_by_expressions.emplace(group_by_expression);
+      }
+      if (contained_group_by_expressions.size() == group_by_expressions.size()) return true;
+
+      return lqp_columns_are_unique(lqp->left_input(), contained_group_by_expressions);
+    }
+
+    case LQPNodeType::Join: {
+      const auto& join_node = static_cast<const JoinNode&>(*lqp);
+      if (join_node.join_mode == JoinMode::Semi || join_node.join_mode == JoinMode::Anti) {
+        return lqp_columns_are_unique(lqp->left_input(), expressions);
+      }
+
+      const auto operands = equi_join_operands(join_node);
+      if (!operands) return false;
+
+      // If each row of one side has at most one join partner, the rows of the other side are not duplicated
+      const auto left_rows_are_kept = join_node.join_mode == JoinMode::Inner || join_node.join_mode == JoinMode::Left;
+      if (left_rows_are_kept && lqp_columns_are_unique(lqp->right_input(), {operands->second}) &&
+          lqp_columns_are_unique(lqp->left_input(), expressions)) {
+        return true;
+      }
+
+      const auto right_rows_are_kept = join_node.join_mode == JoinMode::Inner || join_node.join_mode == JoinMode::Right;
+      return right_rows_are_kept && lqp_columns_are_unique(lqp->left_input(), {operands->first}) &&
+             lqp_columns_are_unique(lqp->right_input(), expressions);
+    }
+
+    default:
+      return false;
+  }
+}
+
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(
     const std::shared_ptr<AbstractLQPNode>& begin, const std::optional<const std::shared_ptr<AbstractLQPNode>>& end) {
   return lqp_subplan_to_boolean_expression_impl(begin, end, std::nullopt);
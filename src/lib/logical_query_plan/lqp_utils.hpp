@@ -55,6 +55,13 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
  */
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return whether, according to the unique constraints of the stored tables, no two rows in the output of @param lqp
+ *         have the same values in all of the @param expressions. NULLs count as equal values, as in GROUP BY. A false
+ *         result only means that uniqueness could not be derived.
+ */
+bool lqp_columns_are_unique(const std::shared_ptr<AbstractLQPNode>& lqp, const ExpressionUnorderedSet& expressions);
+
 /**
  * Create a boolean expression from an LQP by considering PredicateNodes and UnionNodes. It traverses the LQP from the
  * begin node until it reaches the end node if set or an LQP node which is a not a Predicate, Union, Projection, Sort,
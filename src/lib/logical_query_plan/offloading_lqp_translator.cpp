@@ -0,0 +1,43 @@
+#include "offloading_lqp_translator.hpp"
+
+#include <algorithm>
+
+#include "operators/offload/abstract_offload_backend.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+OffloadingLQPTranslator::OffloadingLQPTranslator(const std::shared_ptr<AbstractOffloadBackend>& backend,
+                                                 const CacheSubplanResults cache_subplan_results)
+    : LQPTranslator(cache_subplan_results), _backend(backend) {
+  Assert(_backend, "OffloadingLQPTranslator needs a backend");
+}
+
+std::shared_ptr<AbstractOperator> OffloadingLQPTranslator::translate_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto pqp = LQPTranslator::translate_node(node);
+
+  const auto offloaded_operator_iter = _offloaded_operators.find(pqp);
+  if (offloaded_operator_iter != _offloaded_operators.end()) return offloaded_operator_iter->second;
+
+  const auto type = pqp->type();
+  if (type != OperatorType::TableScan && type != OperatorType::JoinHash && type != OperatorType::Aggregate) {
+    return pqp;
+  }
+
+  auto input_row_count = 0.0f;
+  for (const auto& input : {node->left_input(), node->right_input()}) {
+    if (input) input_row_count = std::max(input_row_count, input->get_statistics()->row_count());
+  }
+  if (input_row_count < static_cast<float>(_backend->min_input_row_count())) return pqp;
+
+  auto offloaded_operator = _backend->offload(pqp);
+  if (!offloaded_operator) return pqp;
+
+  offloaded_operator->lqp_node = node;
+  _offloaded_operators.emplace(pqp, offloaded_operator);
+  return offloaded_operator;
+}
+
+}  // namespace opossum
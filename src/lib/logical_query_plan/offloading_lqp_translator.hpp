@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "logical_query_plan/lqp_translator.hpp"
+
+namespace opossum {
+
+class AbstractOffloadBackend;
+
+/**
+ * This class can be used as a drop-in specialization for the LQPTranslator, e.g., with
+ * SQLPipelineBuilder::with_lqp_translator(). It translates the LQP like the LQPTranslator and offers the resulting
+ * TableScans, JoinHashes, and Aggregates with large inputs to an AbstractOffloadBackend, which may replace them with
+ * operators that run on an accelerator.
+ */
+class OffloadingLQPTranslator final : public LQPTranslator {
+ public:
+  explicit OffloadingLQPTranslator(const std::shared_ptr<AbstractOffloadBackend>& backend,
+                                   const CacheSubplanResults cache_subplan_results = CacheSubplanResults::No);
+
+  std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
+
+ private:
+  const std::shared_ptr<AbstractOffloadBackend> _backend;
+
+  // Operators that are used by several nodes (e.g., below a diamond) are only offloaded once
+  mutable std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>>
+      _offloaded_operators;
+};
+
+}  // namespace opossum
@@ -15,7 +15,12 @@ namespace opossum {
 class AbstractExpression;
 class TableStatistics;
 
-enum class ScanType : uint8_t { TableScan, IndexScan };
+/**
+ * IndexOnlyScan is an IndexScan whose only output (an AggregateNode computing COUNT(*) or a ProjectionNode selecting
+ * the search value of an equality predicate) can be computed from the index alone. The LQPTranslator then translates
+ * both nodes into a single IndexScan that does not produce positions.
+ */
+enum class ScanType : uint8_t { TableScan, IndexScan, IndexOnlyScan };
 
 /**
  * This node type represents a filter.
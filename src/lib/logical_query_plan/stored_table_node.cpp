@@ -1,6 +1,9 @@
 #include "stored_table_node.hpp"
 
+#include <sstream>
+
 #include "expression/lqp_column_expression.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -19,7 +22,18 @@ void StoredTableNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunks)
 
 const std::vector<ChunkID>& StoredTableNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
 
-std::string StoredTableNode::description() const { return "[StoredTable] Name: '" + table_name + "'"; }
+void StoredTableNode::set_table_sample(const std::optional<TableSample>& table_sample) {
+  _table_sample = table_sample;
+}
+
+const std::optional<TableSample>& StoredTableNode::table_sample() const { return _table_sample; }
+
+std::string StoredTableNode::description() const {
+  std::stringstream stream;
+  stream << "[StoredTable] Name: '" << table_name << "'";
+  if (_table_sample) stream << " TABLESAMPLE " << *_table_sample;
+  return stream.str();
+}
 
 const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_expressions() const {
   // Need to initialize the expressions lazily because they will have a weak_ptr to this node and we can't obtain that
@@ -45,18 +59,28 @@ bool StoredTableNode::is_column_nullable(const ColumnID column_id) const {
 std::shared_ptr<TableStatistics> StoredTableNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   DebugAssert(!left_input && !right_input, "StoredTableNode must be leaf");
-  return StorageManager::get().get_table(table_name)->table_statistics();
+  const auto table_statistics = StorageManager::get().get_table(table_name)->table_statistics();
+  if (!_table_sample) return table_statistics;
+
+  // A BERNOULLI sample references the rows of the table, while a SYSTEM sample keeps the data chunks
+  const auto table_type =
+      _table_sample->method == TableSampleMethod::Bernoulli ? TableType::References : table_statistics->table_type();
+  return std::make_shared<TableStatistics>(table_type,
+                                           table_statistics->row_count() * _table_sample->percentage / 100.0f,
+                                           table_statistics->column_statistics());
 }
 
 std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto copy = make(table_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_table_sample(_table_sample);
   return copy;
 }
 
 bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& stored_table_node = static_cast<const StoredTableNode&>(rhs);
-  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids;
+  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids &&
+         _table_sample == stored_table_node._table_sample;
 }
 
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include "abstract_lqp_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "lqp_column_reference.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
@@ -20,6 +21,10 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunks);
   const std::vector<ChunkID>& excluded_chunk_ids() const;
 
+  // If set, only a sample of the table's rows is read (TABLESAMPLE)
+  void set_table_sample(const std::optional<TableSample>& table_sample);
+  const std::optional<TableSample>& table_sample() const;
+
   std::string description() const override;
   const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
@@ -36,6 +41,7 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
  private:
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _expressions;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<TableSample> _table_sample;
 };
 
 }  // namespace opossum
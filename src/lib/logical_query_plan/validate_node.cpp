@@ -20,8 +20,11 @@ std::shared_ptr<TableStatistics> ValidateNode::derive_statistics_from(
 
   auto input_statistics = left_input->get_statistics();
 
-  return std::make_shared<TableStatistics>(input_statistics->table_type(), input_statistics->approx_valid_row_count(),
-                                           input_statistics->column_statistics());
+  auto output_statistics =
+      std::make_shared<TableStatistics>(input_statistics->table_type(), input_statistics->approx_valid_row_count(),
+                                        input_statistics->column_statistics());
+  output_statistics->set_column_groups(input_statistics->column_groups());
+  return output_statistics;
 }
 
 bool ValidateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -0,0 +1,81 @@
+#include "window_node.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include "expression/expression_utils.hpp"
+#include "resolve_type.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WindowNode::WindowNode(const std::vector<std::shared_ptr<AbstractExpression>>& window_function_expressions)
+    : AbstractLQPNode(LQPNodeType::Window, window_function_expressions) {
+  Assert(std::all_of(window_function_expressions.begin(), window_function_expressions.end(),
+                     [](const auto& expression) { return expression->type == ExpressionType::WindowFunction; }),
+         "WindowNode expects WindowFunctionExpressions");
+}
+
+std::string WindowNode::description() const {
+  std::stringstream stream;
+
+  stream << "[Window] " << expression_column_names(node_expressions);
+
+  return stream.str();
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& WindowNode::column_expressions() const {
+  Assert(left_input(), "Need left input to determine the output expressions");
+
+  // Recomputed every time, as the columns of the input might have been pruned (see JoinNode::column_expressions())
+  const auto& input_expressions = left_input()->column_expressions();
+  _column_expressions.resize(input_expressions.size() + node_expressions.size());
+  const auto window_functions_begin =
+      std::copy(input_expressions.begin(), input_expressions.end(), _column_expressions.begin());
+  std::copy(node_expressions.begin(), node_expressions.end(), window_functions_begin);
+
+  return _column_expressions;
+}
+
+bool WindowNode::is_column_nullable(const ColumnID column_id) const {
+  Assert(left_input(), "Need left input to determine nullability");
+
+  const auto input_column_count = left_input()->column_expressions().size();
+  if (column_id < input_column_count) return left_input()->is_column_nullable(column_id);
+
+  Assert(column_id < input_column_count + node_expressions.size(), "ColumnID out of range");
+  return node_expressions[column_id - input_column_count]->is_nullable_on_lqp(*left_input());
+}
+
+std::shared_ptr<TableStatistics> WindowNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(left_input && !right_input, "WindowNode needs left_input and no right_input");
+
+  // Window functions add columns, but neither add nor remove rows
+  const auto input_statistics = left_input->get_statistics();
+  auto column_statistics = input_statistics->column_statistics();
+
+  for (const auto& expression : node_expressions) {
+    // TODO(anybody) Statistics for expressions not yet supported
+    resolve_data_type(expression->data_type(), [&](const auto data_type_t) {
+      using ExpressionDataType = typename decltype(data_type_t)::type;
+      column_statistics.emplace_back(
+          std::make_shared<ColumnStatistics<ExpressionDataType>>(ColumnStatistics<ExpressionDataType>::dummy()));
+    });
+  }
+
+  return std::make_shared<TableStatistics>(TableType::Data, input_statistics->row_count(), column_statistics);
+}
+
+std::shared_ptr<AbstractLQPNode> WindowNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  return make(expressions_copy_and_adapt_to_different_lqp(node_expressions, node_mapping));
+}
+
+bool WindowNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& rhs_expressions = static_cast<const WindowNode&>(rhs).node_expressions;
+  return expressions_equal_to_expressions_in_different_lqp(node_expressions, rhs_expressions, node_mapping);
+}
+
+}  // namespace opossum
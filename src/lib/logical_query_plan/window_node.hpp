@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "expression/abstract_expression.hpp"
+
+namespace opossum {
+
+/**
+ * Computes WindowFunctionExpressions. The output columns are those of the input, followed by one column per window
+ * function. The arguments, PARTITION BY, and ORDER BY expressions of the window functions need to be columns of the
+ * input.
+ */
+class WindowNode : public EnableMakeForLQPNode<WindowNode>, public AbstractLQPNode {
+ public:
+  explicit WindowNode(const std::vector<std::shared_ptr<AbstractExpression>>& window_function_expressions);
+
+  std::string description() const override;
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input) const override;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+
+ private:
+  mutable std::vector<std::shared_ptr<AbstractExpression>> _column_expressions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include "arena_memory_resource.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace {
+
+// All allocations from the blocks are rounded up to this alignment, so that the offset can be bumped atomically
+// without knowing where the previous allocation ended.
+constexpr auto BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+// Allocations above this size get an upstream allocation of their own, so that they do not waste most of a block
+constexpr auto MAX_BLOCK_ALLOCATION_SIZE = opossum::ArenaMemoryResource::MAX_BLOCK_SIZE / 4;
+
+}  // namespace
+
+namespace opossum {
+
+ArenaMemoryResource::ArenaMemoryResource(boost::container::pmr::memory_resource* upstream) : _upstream(upstream) {}
+
+ArenaMemoryResource::ArenaMemoryResource(const std::shared_ptr<MemoryBudget>& memory_budget,
+                                         boost::container::pmr::memory_resource* upstream)
+    : _upstream(upstream), _memory_budget(memory_budget) {}
+
+ArenaMemoryResource::~ArenaMemoryResource() {
+  for (const auto& block : _blocks) {
+    _upstream->deallocate(block->data, block->size, BLOCK_ALIGNMENT);
+  }
+  for (const auto& [pointer, size_and_alignment] : _upstream_allocations) {
+    _upstream->deallocate(pointer, size_and_alignment.first, size_and_alignment.second);
+  }
+}
+
+size_t ArenaMemoryResource::allocated_bytes() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto allocated_bytes = size_t{0};
+  for (const auto& block : _blocks) {
+    allocated_bytes += block->size;
+  }
+  for (const auto& [pointer, size_and_alignment] : _upstream_allocations) {
+    allocated_bytes += size_and_alignment.first;
+  }
+  return allocated_bytes;
+}
+
+const std::shared_ptr<MemoryBudget>& ArenaMemoryResource::memory_budget() const { return _memory_budget; }
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  const auto aligned_bytes = (bytes + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+  if (alignment > BLOCK_ALIGNMENT || aligned_bytes > MAX_BLOCK_ALLOCATION_SIZE) {
+    return _allocate_from_upstream(bytes, alignment);
+  }
+
+  auto block = _current_block.load();
+  while (true) {
+    if (block) {
+      const auto offset = block->offset.fetch_add(aligned_bytes);
+      if (offset + aligned_bytes <= block->size) return block->data + offset;
+    }
+
+    // The block is exhausted (or there is none yet). Other threads might already have replaced it.
+    block = _replace_block(block, aligned_bytes);
+  }
+}
+
+void ArenaMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  // Memory is released when the arena is destroyed
+}
+
+bool ArenaMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return this == &other; }
+
+ArenaMemoryResource::Block* ArenaMemoryResource::_replace_block(const Block* exhausted_block, const size_t min_size) {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  const auto current_block = _current_block.load();
+  if (current_block != exhausted_block) return current_block;
+
+  const auto size = std::max(_next_block_size, min_size);
+  _next_block_size = std::min(_next_block_size * 2, MAX_BLOCK_SIZE);
+
+  auto block = std::make_unique<Block>();
+  block->data = static_cast<std::byte*>(_upstream->allocate(size, BLOCK_ALIGNMENT));
+  block->size = size;
+  if (_memory_budget) _memory_budget->track(size);
+
+  _blocks.emplace_back(std::move(block));
+  _current_block = _blocks.back().get();
+  return _blocks.back().get();
+}
+
+void* ArenaMemoryResource::_allocate_from_upstream(const size_t bytes, const size_t alignment) {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto pointer = _upstream->allocate(bytes, alignment);
+  if (_memory_budget) _memory_budget->track(bytes);
+  _upstream_allocations.emplace_back(pointer, std::pair{bytes, alignment});
+  return pointer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "memory/memory_budget.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thread-safe monotonic memory resource for the intermediate results of a single query. Memory is taken from large
+ * blocks by atomically bumping an offset, so that concurrent operator jobs do not contend on the global allocator.
+ * Deallocation is a no-op - all memory is returned to the upstream resource in one step when the arena is destroyed.
+ *
+ * As memory is never reused, containers that grow step by step (e.g., by emplace_back) leave their previous buffers
+ * behind. This is fine for intermediate results, which are short-lived, but the arena should not be used for anything
+ * that is modified over a longer time.
+ *
+ * If a MemoryBudget is given, all memory taken from the upstream resource is charged to it.
+ */
+class ArenaMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static constexpr auto INITIAL_BLOCK_SIZE = size_t{64 * 1024};
+  static constexpr auto MAX_BLOCK_SIZE = size_t{16 * 1024 * 1024};
+
+  explicit ArenaMemoryResource(
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+  explicit ArenaMemoryResource(
+      const std::shared_ptr<MemoryBudget>& memory_budget,
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+  ~ArenaMemoryResource() override;
+
+  ArenaMemoryResource(const ArenaMemoryResource&) = delete;
+  ArenaMemoryResource& operator=(const ArenaMemoryResource&) = delete;
+
+  // Number of bytes the arena has allocated from its upstream resource
+  size_t allocated_bytes() const;
+
+  // Returns nullptr if the arena has no budget
+  const std::shared_ptr<MemoryBudget>& memory_budget() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  struct Block {
+    std::byte* data;
+    size_t size;
+    std::atomic<size_t> offset{0};
+  };
+
+  // Replaces the current block if it is still the exhausted one and returns the (new) current block
+  Block* _replace_block(const Block* exhausted_block, const size_t min_size);
+
+  void* _allocate_from_upstream(const size_t bytes, const size_t alignment);
+
+  boost::container::pmr::memory_resource* const _upstream;
+  const std::shared_ptr<MemoryBudget> _memory_budget;
+
+  std::atomic<Block*> _current_block{nullptr};
+
+  // Guards the following members, which are only accessed when a new block is needed
+  mutable std::mutex _mutex;
+  std::vector<std::unique_ptr<Block>> _blocks;
+  std::vector<std::pair<void*, std::pair<size_t, size_t>>> _upstream_allocations;
+  size_t _next_block_size{INITIAL_BLOCK_SIZE};
+};
+
+/**
+ * Creates an object whose memory (e.g., the buffer of a PosList) is allocated from the arena. The allocator is passed
+ * as the last constructor argument. The returned object keeps the arena alive, so that intermediate results may
+ * outlive the query that created them (e.g., as its result table). Without an arena, the object is created as usual.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> make_shared_in_arena(const std::shared_ptr<ArenaMemoryResource>& arena, Args&&... args) {
+  if (!arena) return std::make_shared<T>(std::forward<Args>(args)...);
+
+  return std::shared_ptr<T>(new T(std::forward<Args>(args)..., PolymorphicAllocator<T>{arena.get()}),
+                            [arena](T* object) { delete object; });
+}
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include "huge_page_memory_resource.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+#ifdef __linux__
+
+// From linux/mempolicy.h, which is not available everywhere
+constexpr auto MPOL_BIND_MODE = 2;
+
+void* map_from_hugetlbfs(const size_t mapping_size) {
+#ifdef MAP_HUGETLB
+  auto flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+  // Request the page size explicitly, the default hugetlbfs page size is configurable
+  flags |= (mapping_size % opossum::HugePageMemoryResource::GIGANTIC_PAGE_SIZE == 0 ? 30 : 21) << MAP_HUGE_SHIFT;
+#endif
+  auto* const pointer = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+  if (pointer != MAP_FAILED) return pointer;
+#endif
+  return nullptr;
+}
+
+void* map_for_transparent_huge_pages(const size_t mapping_size) {
+  // Transparent huge pages are only used for 2 MB-aligned ranges. mmap() only guarantees the alignment of regular
+  // pages, so we map one huge page more than needed and unmap the unaligned head and tail.
+  constexpr auto HUGE_PAGE_SIZE = opossum::HugePageMemoryResource::HUGE_PAGE_SIZE;
+  const auto oversized_size = mapping_size + HUGE_PAGE_SIZE;
+  auto* const oversized = mmap(nullptr, oversized_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (oversized == MAP_FAILED) return nullptr;
+
+  const auto begin = reinterpret_cast<uintptr_t>(oversized);
+  const auto aligned_begin = (begin + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+  const auto head_size = aligned_begin - begin;
+  if (head_size > 0) munmap(oversized, head_size);
+  const auto tail_size = oversized_size - head_size - mapping_size;
+  if (tail_size > 0) munmap(reinterpret_cast<void*>(aligned_begin + mapping_size), tail_size);
+
+  auto* const pointer = reinterpret_cast<void*>(aligned_begin);
+#ifdef MADV_HUGEPAGE
+  // Fails if transparent huge pages are disabled, in which case the memory is still usable
+  madvise(pointer, mapping_size, MADV_HUGEPAGE);
+#endif
+  return pointer;
+}
+
+void bind_to_node(void* pointer, const size_t mapping_size, const int node_id) {
+#ifdef SYS_mbind
+  constexpr auto BITS_PER_MASK = sizeof(unsigned long) * 8;  // NOLINT(runtime/int) - the type used by the syscall
+  if (node_id < 0 || static_cast<size_t>(node_id) >= BITS_PER_MASK) return;
+
+  const auto node_mask = 1ul << static_cast<unsigned>(node_id);
+  // Like madvise(), this is a hint: if the node does not exist (e.g., for fake NUMA nodes), the memory is placed as
+  // usual.
+  syscall(SYS_mbind, pointer, mapping_size, MPOL_BIND_MODE, &node_mask, BITS_PER_MASK, 0);
+#endif
+}
+
+#endif
+
+}  // namespace
+
+namespace opossum {
+
+HugePageMemoryResource::HugePageMemoryResource(const int node_id, const size_t threshold,
+                                               boost::container::pmr::memory_resource* upstream)
+    : _node_id(node_id), _threshold(threshold), _upstream(upstream) {
+  Assert(threshold > 0, "Threshold must be positive");
+}
+
+HugePageMemoryResource* HugePageMemoryResource::get_default() {
+  // Leaked on purpose, see get_default_resource() in boost_default_memory_resource.cpp
+  static auto* default_instance = new HugePageMemoryResource();  // NOLINT
+  return default_instance;
+}
+
+int HugePageMemoryResource::node_id() const { return _node_id; }
+
+size_t HugePageMemoryResource::threshold() const { return _threshold; }
+
+size_t HugePageMemoryResource::mapped_bytes() const { return _mapped_bytes.load(); }
+
+size_t HugePageMemoryResource::mapping_size(const size_t bytes) {
+  const auto page_size = bytes >= GIGANTIC_PAGE_SIZE ? GIGANTIC_PAGE_SIZE : HUGE_PAGE_SIZE;
+  return (bytes + page_size - 1) / page_size * page_size;
+}
+
+void* HugePageMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#ifdef __linux__
+  if (_is_large(bytes, alignment)) {
+    const auto size = mapping_size(bytes);
+    auto* pointer = map_from_hugetlbfs(size);
+    if (!pointer) pointer = map_for_transparent_huge_pages(size);
+    if (!pointer) throw std::bad_alloc{};
+
+    if (_node_id != NUMAMemoryResource::UNDEFINED_NODE_ID) bind_to_node(pointer, size, _node_id);
+    _mapped_bytes += size;
+    return pointer;
+  }
+#endif
+  return _upstream->allocate(bytes, alignment);
+}
+
+void HugePageMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+#ifdef __linux__
+  if (_is_large(bytes, alignment)) {
+    const auto size = mapping_size(bytes);
+    munmap(p, size);
+    _mapped_bytes -= size;
+    return;
+  }
+#endif
+  _upstream->deallocate(p, bytes, alignment);
+}
+
+bool HugePageMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return this == &other; }
+
+bool HugePageMemoryResource::_is_large(const size_t bytes, const size_t alignment) const {
+  return bytes >= _threshold && alignment <= HUGE_PAGE_SIZE;
+}
+
+}  // namespace opossum
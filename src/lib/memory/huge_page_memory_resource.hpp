@@ -0,0 +1,75 @@
+#pragma once
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+
+#include "memory/numa_memory_resource.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that maps large allocations (e.g., big attribute vectors, hash tables, and aggregation buffers)
+ * directly from the OS in huge pages, so that scans and hash probes on them cause fewer dTLB misses. Allocations below
+ * the threshold are passed to the upstream resource, so that using the resource for small containers is harmless.
+ *
+ * Large allocations are rounded up to multiples of 2 MB, or 1 GB if they are at least 1 GB. On Linux, they are first
+ * requested from hugetlbfs (MAP_HUGETLB), which only succeeds if huge pages were reserved by the administrator.
+ * Otherwise, a 2 MB-aligned regular mapping is created and marked for transparent huge pages (MADV_HUGEPAGE). If a
+ * node id is given, the mapping is bound to that NUMA node before it is first touched. On other platforms, all
+ * allocations go to the upstream resource.
+ */
+class HugePageMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static constexpr auto HUGE_PAGE_SIZE = size_t{2 * 1024 * 1024};
+  static constexpr auto GIGANTIC_PAGE_SIZE = size_t{1024 * 1024 * 1024};
+
+  // Smaller allocations would waste most of their huge page
+  static constexpr auto DEFAULT_THRESHOLD = HUGE_PAGE_SIZE;
+
+  explicit HugePageMemoryResource(
+      const int node_id = NUMAMemoryResource::UNDEFINED_NODE_ID, const size_t threshold = DEFAULT_THRESHOLD,
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+
+  HugePageMemoryResource(const HugePageMemoryResource&) = delete;
+  HugePageMemoryResource& operator=(const HugePageMemoryResource&) = delete;
+
+  // Process-wide instance without NUMA binding whose upstream is the default resource. Like the default resource, it
+  // is never destroyed, so that objects allocated from it may outlive any other singleton.
+  static HugePageMemoryResource* get_default();
+
+  int node_id() const;
+  size_t threshold() const;
+
+  // Number of bytes currently mapped for large allocations, including the rounding to full pages
+  size_t mapped_bytes() const;
+
+  // Size of the mapping of a large allocation of the given size
+  static size_t mapping_size(const size_t bytes);
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  bool _is_large(const size_t bytes, const size_t alignment) const;
+
+  const int _node_id;
+  const size_t _threshold;
+  boost::container::pmr::memory_resource* const _upstream;
+
+  std::atomic<size_t> _mapped_bytes{0};
+};
+
+// Returns an allocator that serves large allocations from huge pages if the given allocator uses the default resource.
+// Allocators of other resources (e.g., of an arena or a NUMA node) are returned unchanged.
+template <typename T>
+PolymorphicAllocator<T> with_huge_pages(const PolymorphicAllocator<T>& allocator) {
+  if (allocator.resource() != boost::container::pmr::get_default_resource()) return allocator;
+  return PolymorphicAllocator<T>{HugePageMemoryResource::get_default()};
+}
+
+}  // namespace opossum
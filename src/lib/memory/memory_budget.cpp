@@ -0,0 +1,60 @@
+#include "memory_budget.hpp"
+
+#include <utility>
+
+namespace opossum {
+
+MemoryBudget::MemoryBudget(const size_t limit) : _limit(limit) {}
+
+size_t MemoryBudget::limit() const { return _limit; }
+
+size_t MemoryBudget::used_bytes() const { return _used_bytes.load(); }
+
+size_t MemoryBudget::peak_bytes() const { return _peak_bytes.load(); }
+
+size_t MemoryBudget::available_bytes() const {
+  const auto used_bytes = _used_bytes.load();
+  return used_bytes < _limit ? _limit - used_bytes : size_t{0};
+}
+
+void MemoryBudget::track(const size_t bytes) { _update_peak(_used_bytes += bytes); }
+
+std::optional<MemoryReservation> MemoryBudget::try_reserve(const size_t bytes) {
+  auto used_bytes = _used_bytes.load();
+  do {
+    if (used_bytes + bytes > _limit || used_bytes + bytes < used_bytes) return std::nullopt;
+  } while (!_used_bytes.compare_exchange_weak(used_bytes, used_bytes + bytes));
+  _update_peak(used_bytes + bytes);
+
+  return MemoryReservation{*this, bytes};
+}
+
+void MemoryBudget::_release(const size_t bytes) { _used_bytes -= bytes; }
+
+void MemoryBudget::_update_peak(const size_t used_bytes) {
+  auto peak_bytes = _peak_bytes.load();
+  while (used_bytes > peak_bytes && !_peak_bytes.compare_exchange_weak(peak_bytes, used_bytes)) {
+  }
+}
+
+MemoryReservation::MemoryReservation(MemoryBudget& budget, const size_t bytes) : _budget(&budget), _bytes(bytes) {}
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other) noexcept
+    : _budget(other._budget), _bytes(std::exchange(other._bytes, size_t{0})) {}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other) noexcept {
+  if (this != &other) {
+    if (_bytes > 0) _budget->_release(_bytes);
+    _budget = other._budget;
+    _bytes = std::exchange(other._bytes, size_t{0});
+  }
+  return *this;
+}
+
+MemoryReservation::~MemoryReservation() {
+  if (_bytes > 0) _budget->_release(_bytes);
+}
+
+size_t MemoryReservation::bytes() const { return _bytes; }
+
+}  // namespace opossum
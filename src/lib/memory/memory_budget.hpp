@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class MemoryReservation;
+
+/**
+ * Upper bound for the memory used by a single query. The ArenaMemoryResource of the query charges all memory it takes
+ * from its upstream resource to the budget. Operators whose data structures would exceed the remaining budget (e.g.,
+ * the materialized sort column of a large table) reserve their memory before building them. If the reservation fails,
+ * they fall back to a path that spills intermediate results to disk (see operators/spill/).
+ *
+ * The budget is a soft limit: memory that has to be allocated anyway (e.g., for the result table) is tracked even if it
+ * exceeds the limit, so that later reservations fail.
+ *
+ * Every SQLPipelineStatement has a budget, which is UNLIMITED unless configured otherwise. It is used to report the
+ * peak memory of the statement and by the AdmissionController.
+ */
+class MemoryBudget : private Noncopyable {
+ public:
+  static constexpr auto UNLIMITED = std::numeric_limits<size_t>::max();
+
+  explicit MemoryBudget(const size_t limit = UNLIMITED);
+
+  size_t limit() const;
+  size_t used_bytes() const;
+
+  // Highest number of bytes that were used at the same time
+  size_t peak_bytes() const;
+
+  // Number of bytes that can still be reserved, zero if the budget is exceeded
+  size_t available_bytes() const;
+
+  // Counts memory that is allocated regardless of the budget. It is not released before the query is done.
+  void track(const size_t bytes);
+
+  // Reserves @param bytes until the returned reservation is destroyed. Returns std::nullopt if they exceed the
+  // remaining budget.
+  std::optional<MemoryReservation> try_reserve(const size_t bytes);
+
+ private:
+  friend class MemoryReservation;
+
+  void _release(const size_t bytes);
+
+  void _update_peak(const size_t used_bytes);
+
+  const size_t _limit;
+  std::atomic<size_t> _used_bytes{0};
+  std::atomic<size_t> _peak_bytes{0};
+};
+
+// Memory reserved from a MemoryBudget, which is returned to the budget when the reservation is destroyed
+class MemoryReservation : private Noncopyable {
+ public:
+  MemoryReservation(MemoryReservation&& other) noexcept;
+  MemoryReservation& operator=(MemoryReservation&& other) noexcept;
+  ~MemoryReservation();
+
+  size_t bytes() const;
+
+ private:
+  friend class MemoryBudget;
+
+  MemoryReservation(MemoryBudget& budget, const size_t bytes);
+
+  MemoryBudget* _budget;
+  size_t _bytes;
+};
+
+}  // namespace opossum
@@ -0,0 +1,189 @@
+#include "abstract_chunkwise_operator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/numa_placement.hpp"
+#include "utils/assert.hpp"
+#include "utils/execution_hooks.hpp"
+#include "utils/hardware_counters.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+bool AbstractChunkwiseOperator::is_pipelineable() const { return true; }
+
+void AbstractChunkwiseOperator::set_row_count_hint(const std::optional<size_t>& row_count_hint) {
+  _row_count_hint = row_count_hint;
+}
+
+const std::optional<size_t>& AbstractChunkwiseOperator::row_count_hint() const { return _row_count_hint; }
+
+void AbstractChunkwiseOperator::execute_pipeline(
+    const std::vector<std::shared_ptr<AbstractChunkwiseOperator>>& pipeline) {
+  Assert(!pipeline.empty(), "Expected at least one operator");
+  for (auto operator_idx = size_t{1}; operator_idx < pipeline.size(); ++operator_idx) {
+    Assert(pipeline[operator_idx]->input_left() == pipeline[operator_idx - 1], "Operators do not form a chain");
+    DebugAssert(!pipeline[operator_idx]->input_right(), "Chunkwise operators have only one input");
+  }
+
+  const auto& last_operator = pipeline.back();
+  DebugAssert(!last_operator->_output, "Operator has already been executed");
+
+  auto performance_timer = Timer{};
+
+  // Only the events of this thread are counted, see OperatorPerformanceData::hardware_counters
+  auto hardware_counter_scope = std::optional<HardwareCounterScope>{};
+  hardware_counter_scope.emplace(last_operator->_performance_data->hardware_counters);
+
+  // As in AbstractOperator::execute(), the operators are not executed if the transaction has been aborted
+  const auto transaction_context = last_operator->transaction_context();
+  if (transaction_context) {
+    if (transaction_context->aborted()) return;
+    transaction_context->on_operator_started();
+  }
+
+  for (const auto& op : pipeline) {
+    op->_on_prepare_chunks(op->transaction_context());
+  }
+
+  const auto in_table = pipeline.front()->input_table_left();
+  DebugAssert(in_table, "Input of the pipeline has not yet been executed");
+
+  // The output of the last operator for each morsel, as a single-chunk table
+  auto morsel_tables = std::vector<std::shared_ptr<Table>>(in_table->chunk_count());
+
+  _process_chunks(*in_table, last_operator->_row_count_hint, [&](const ChunkID chunk_id) {
+    // The chunks are skipped once the statement is cancelled, see CancellationToken
+    if (last_operator->is_cancelled()) return size_t{0};
+
+    auto morsel_in_table = in_table;
+    auto morsel_chunk_id = chunk_id;
+    auto morsel_out_table = std::shared_ptr<Table>{};
+
+    for (const auto& op : pipeline) {
+      const auto output_chunk = op->_on_execute_chunk(morsel_in_table, morsel_chunk_id, op->transaction_context());
+      if (!output_chunk) return size_t{0};
+
+      morsel_out_table = op->_create_output_table(*morsel_in_table, {output_chunk});
+      morsel_out_table->append_chunk(output_chunk);
+
+      morsel_in_table = morsel_out_table;
+      morsel_chunk_id = ChunkID{0};
+    }
+
+    morsel_tables[chunk_id] = morsel_out_table;
+    return static_cast<size_t>(morsel_out_table->row_count());
+  });
+
+  // Build the output from the morsel tables. It has the columns of the first morsel table, but a column is nullable if
+  // it is nullable in any of them. If no chunk made it through the pipeline, the output table is created from the
+  // input table by passing it through the operators without any chunks.
+  auto first_morsel_table = std::shared_ptr<Table>{};
+  auto column_definitions = TableColumnDefinitions{};
+  for (const auto& morsel_table : morsel_tables) {
+    if (!morsel_table) continue;
+
+    if (!first_morsel_table) {
+      first_morsel_table = morsel_table;
+      column_definitions = morsel_table->column_definitions();
+      continue;
+    }
+
+    for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+      DebugAssert(morsel_table->column_data_type(column_id) == column_definitions[column_id].data_type,
+                  "Morsels have different column types");
+      column_definitions[column_id].nullable |= morsel_table->column_is_nullable(column_id);
+    }
+  }
+
+  auto output_table = std::shared_ptr<Table>{};
+  if (first_morsel_table) {
+    output_table = std::make_shared<Table>(column_definitions, first_morsel_table->type(), std::nullopt,
+                                           first_morsel_table->has_mvcc());
+    for (const auto& morsel_table : morsel_tables) {
+      if (morsel_table) output_table->append_chunk(morsel_table->get_chunk(ChunkID{0}));
+    }
+  } else {
+    auto empty_table = std::shared_ptr<const Table>{in_table};
+    for (const auto& op : pipeline) {
+      output_table = op->_create_output_table(*empty_table, {});
+      empty_table = output_table;
+    }
+  }
+
+  if (transaction_context) transaction_context->on_operator_finished();
+
+  for (const auto& op : pipeline) {
+    op->_on_cleanup();
+  }
+
+  last_operator->_output = output_table;
+  hardware_counter_scope.reset();
+  last_operator->_performance_data->walltime = performance_timer.lap();
+  last_operator->_performance_data->output_row_count = output_table->row_count();
+  last_operator->_performance_data->output_chunk_count = output_table->chunk_count();
+
+  for (const auto& op : pipeline) {
+    ExecutionHooks::get().operator_finished.fire(*op);
+  }
+}
+
+std::shared_ptr<const Table> AbstractChunkwiseOperator::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _on_prepare_chunks(context);
+
+  const auto in_table = input_table_left();
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(in_table->chunk_count());
+
+  _process_chunks(*in_table, _row_count_hint, [&](const ChunkID chunk_id) {
+    if (is_cancelled()) return size_t{0};
+
+    output_chunks[chunk_id] = _on_execute_chunk(in_table, chunk_id, context);
+    return output_chunks[chunk_id] ? static_cast<size_t>(output_chunks[chunk_id]->size()) : size_t{0};
+  });
+
+  output_chunks.erase(std::remove(output_chunks.begin(), output_chunks.end(), nullptr), output_chunks.end());
+
+  const auto output_table = _create_output_table(*in_table, output_chunks);
+  for (const auto& output_chunk : output_chunks) {
+    output_table->append_chunk(output_chunk);
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<const Table> AbstractChunkwiseOperator::_on_execute() { return _on_execute(nullptr); }
+
+void AbstractChunkwiseOperator::_on_prepare_chunks(const std::shared_ptr<TransactionContext>& context) {}
+
+void AbstractChunkwiseOperator::_process_chunks(const Table& in_table, const std::optional<size_t>& row_count_hint,
+                                                const std::function<size_t(ChunkID)>& process_chunk) {
+  const auto chunk_count = static_cast<size_t>(in_table.chunk_count());
+  auto batch_size = row_count_hint ? std::max(size_t{1}, Topology::get().num_cpus()) : chunk_count;
+
+  auto row_count = std::atomic<size_t>{0};
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size, batch_size *= 2) {
+    if (row_count_hint && row_count >= *row_count_hint) break;
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+
+    for (auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(batch_begin)}; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { row_count += process_chunk(chunk_id); }));
+      jobs.back()->schedule(preferred_node_for_chunk(in_table, chunk_id));
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
+}
+
+}  // namespace opossum
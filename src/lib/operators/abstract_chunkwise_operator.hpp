@@ -0,0 +1,80 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/**
+ * AbstractChunkwiseOperator is the superclass for non-blocking operators that compute each output chunk from exactly
+ * one chunk of their (left) input, e.g., TableScan, Validate, and Projection.
+ *
+ * When executed on its own, such an operator processes the chunks of its input in parallel and appends the resulting
+ * chunks to its output in the order of the input chunks. Additionally, chains of chunkwise operators can be fused into
+ * a pipeline via execute_pipeline(). In that case, every morsel (i.e., chunk of the pipeline's input) passes through
+ * all operators of the pipeline within a single task and only the output of the last operator is materialized.
+ */
+class AbstractChunkwiseOperator : public AbstractReadOnlyOperator {
+ public:
+  using AbstractReadOnlyOperator::AbstractReadOnlyOperator;
+
+  // Returns false if the operator, in its current configuration, must not be fused with other operators
+  virtual bool is_pipelineable() const;
+
+  /**
+   * Executes a pipeline of chunkwise operators, where each operator's left input is the previous operator. The input
+   * of the first operator must have been executed. For each chunk of that input, one task runs the chunk through all
+   * operators, wrapping the intermediate result of each operator into a single-chunk table. Afterwards, the last
+   * operator's output consists of the output chunks of all morsels, in the order of the input chunks. The other
+   * operators do not have an output.
+   */
+  static void execute_pipeline(const std::vector<std::shared_ptr<AbstractChunkwiseOperator>>& pipeline);
+
+  /**
+   * If only the first rows of the output are consumed (see LimitPushdownRule), the chunks are processed in order and in
+   * batches. No further batch is started once the output has at least row_count_hint rows. The output may still
+   * contain more rows than hinted. For a pipeline, the hint of its last operator is used.
+   */
+  void set_row_count_hint(const std::optional<size_t>& row_count_hint);
+  const std::optional<size_t>& row_count_hint() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Called once before the first chunk is processed
+  virtual void _on_prepare_chunks(const std::shared_ptr<TransactionContext>& context);
+
+  /**
+   * Computes the output chunk for the chunk `chunk_id` of `in_table`, or returns nullptr if the output chunk would be
+   * empty and can be omitted. `in_table` has the same columns as the output of the left input, but is a single-chunk
+   * table holding the output of the previous operator if the operator is part of a pipeline. Called concurrently for
+   * different chunks.
+   */
+  virtual std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& in_table,
+                                                   const ChunkID chunk_id,
+                                                   const std::shared_ptr<TransactionContext>& context) = 0;
+
+  // Creates the (still empty) output table for `in_table`. The output chunks can be used to determine the nullability
+  // of the output columns.
+  virtual std::shared_ptr<Table> _create_output_table(
+      const Table& in_table, const std::vector<std::shared_ptr<Chunk>>& output_chunks) const = 0;
+
+  /**
+   * Calls process_chunk for the chunks of in_table, which returns the number of output rows for the chunk. Without a
+   * row count hint, all chunks are processed concurrently. Otherwise, the first batch consists of one chunk per CPU and
+   * each following batch is twice as large as the previous one, until the processed chunks have produced enough rows.
+   */
+  static void _process_chunks(const Table& in_table, const std::optional<size_t>& row_count_hint,
+                              const std::function<size_t(ChunkID)>& process_chunk);
+
+  std::optional<size_t> _row_count_hint;
+};
+
+}  // namespace opossum
@@ -1,13 +1,25 @@
 #include "abstract_join_operator.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 
 namespace opossum {
 
+// Each key of the build side is checked against the statistics of each probe chunk, so runtime join pruning is only
+// used for build sides with few distinct keys
+constexpr auto JOIN_PRUNING_MAX_BUILD_KEY_COUNT = size_t{100};
+
 AbstractJoinOperator::AbstractJoinOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
                                            const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                                            const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
@@ -69,4 +81,77 @@ std::shared_ptr<Table> AbstractJoinOperator::_initialize_output_table() const {
   return std::make_shared<Table>(output_column_definitions, TableType::References);
 }
 
+std::shared_ptr<const Table> AbstractJoinOperator::_prune_chunks_without_join_partners(
+    const Table& build_table, const ColumnID build_column_id, const std::shared_ptr<const Table>& probe_table,
+    const ColumnID probe_column_id) {
+  if (probe_table->chunk_count() < 2 || build_table.row_count() > probe_table->row_count()) return probe_table;
+
+  // Collect the distinct keys of the build side, unless there are too many of them
+  auto build_keys = std::vector<AllTypeVariant>{};
+  auto too_many_build_keys = false;
+  resolve_data_type(build_table.column_data_type(build_column_id), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto distinct_keys = std::set<ColumnDataType>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < build_table.chunk_count() && !too_many_build_keys; ++chunk_id) {
+      const auto chunk = build_table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(build_column_id), [&](const auto& position) {
+        if (too_many_build_keys || position.is_null()) return;
+        distinct_keys.emplace(position.value());
+        too_many_build_keys = distinct_keys.size() > JOIN_PRUNING_MAX_BUILD_KEY_COUNT;
+      });
+    }
+
+    build_keys.assign(distinct_keys.cbegin(), distinct_keys.cend());
+  });
+  if (too_many_build_keys || build_keys.empty()) return probe_table;
+
+  auto retained_chunk_ids = std::vector<ChunkID>{};
+  auto pruned_chunk_id = std::optional<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < probe_table->chunk_count(); ++chunk_id) {
+    const auto chunk = probe_table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    // The statistics of a reference chunk are those of the data chunk it references, if there is a single one
+    auto statistics = std::shared_ptr<ChunkStatistics>{};
+    auto statistics_column_id = probe_column_id;
+    if (probe_table->type() == TableType::Data) {
+      statistics = chunk->statistics();
+    } else {
+      const auto reference_segment =
+          std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(probe_column_id));
+      const auto& pos_list = *reference_segment->pos_list();
+      if (!pos_list.empty() && pos_list.references_single_chunk()) {
+        const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+        if (referenced_chunk) statistics = referenced_chunk->statistics();
+        statistics_column_id = reference_segment->referenced_column_id();
+      }
+    }
+
+    const auto can_prune = statistics && std::all_of(build_keys.cbegin(), build_keys.cend(), [&](const auto& key) {
+                             return statistics->can_prune(statistics_column_id, PredicateCondition::Equals, key);
+                           });
+    if (can_prune) {
+      pruned_chunk_id = chunk_id;
+    } else {
+      retained_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  if (!pruned_chunk_id) return probe_table;
+
+  // Keep one chunk, so that the join does not have to handle an input without chunks. It has no join partners anyway.
+  if (retained_chunk_ids.empty()) retained_chunk_ids.emplace_back(*pruned_chunk_id);
+
+  // The segments of the retained chunks are shared with a new table. Joins do not forward MVCC data, so it is omitted.
+  const auto pruned_table = std::make_shared<Table>(probe_table->column_definitions(), probe_table->type());
+  for (const auto chunk_id : retained_chunk_ids) {
+    pruned_table->append_chunk(probe_table->get_chunk(chunk_id)->segments());
+  }
+
+  return pruned_table;
+}
+
 }  // namespace opossum
@@ -39,6 +39,16 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
 
   std::shared_ptr<Table> _initialize_output_table() const;
 
+  /**
+   * Runtime join pruning: If the build side of an equi-join has only a few distinct keys, the ChunkStatistics of the
+   * probe column (e.g., RangeFilter, CountingQuotientFilter) may prove that a probe chunk contains none of them.
+   * Returns probe_table without these chunks, or probe_table itself if no chunk can be pruned. Only valid if probe
+   * rows without a join partner are not part of the output (e.g., the probe side of inner and semi joins).
+   */
+  static std::shared_ptr<const Table> _prune_chunks_without_join_partners(
+      const Table& build_table, const ColumnID build_column_id, const std::shared_ptr<const Table>& probe_table,
+      const ColumnID probe_column_id);
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in join_hash.hpp.
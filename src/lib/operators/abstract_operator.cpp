@@ -6,14 +6,37 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "concurrency/cancellation_token.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "memory/arena_memory_resource.hpp"
+#include "scheduler/current_scheduler.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/execution_hooks.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
 #include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Adds the time that the current thread waits for tasks to an operator's wait time while the scope exists
+class WaitTimeScope : private Noncopyable {
+ public:
+  explicit WaitTimeScope(std::chrono::nanoseconds& wait_time)
+      : _previous_wait_time(CurrentScheduler::set_wait_time_of_this_thread(&wait_time)) {}
+
+  ~WaitTimeScope() { CurrentScheduler::set_wait_time_of_this_thread(_previous_wait_time); }
+
+ private:
+  std::chrono::nanoseconds* const _previous_wait_time;
+};
+
+}  // namespace
+
 namespace opossum {
 
 AbstractOperator::AbstractOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
@@ -24,39 +47,58 @@ AbstractOperator::AbstractOperator(const OperatorType type, const std::shared_pt
 OperatorType AbstractOperator::type() const { return _type; }
 
 void AbstractOperator::execute() {
-  DTRACE_PROBE1(HYRISE, OPERATOR_STARTED, name().c_str());
   DebugAssert(!_input_left || _input_left->get_output(), "Left input has not yet been executed");
   DebugAssert(!_input_right || _input_right->get_output(), "Right input has not yet been executed");
   DebugAssert(!_output, "Operator has already been executed");
 
   Timer performance_timer;
 
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input) continue;
+    _performance_data->input_row_count += input->get_output()->row_count();
+    _performance_data->input_chunk_count += input->get_output()->chunk_count();
+  }
+
+  DTRACE_PROBE3(HYRISE, OPERATOR_STARTED, name().c_str(), _performance_data->input_row_count,
+                reinterpret_cast<uintptr_t>(this));
+
   auto transaction_context = this->transaction_context();
 
-  if (transaction_context) {
-    /**
-     * Do not execute Operators if transaction has been aborted.
-     * Not doing so is crucial in order to make sure no other
-     * tasks of the Transaction run while the Rollback happens.
-     */
-    if (transaction_context->aborted()) {
-      return;
+  {
+    const auto wait_time_scope = WaitTimeScope{_performance_data->wait_time};
+    const auto hardware_counter_scope = HardwareCounterScope{_performance_data->hardware_counters};
+
+    if (transaction_context) {
+      /**
+       * Do not execute Operators if transaction has been aborted.
+       * Not doing so is crucial in order to make sure no other
+       * tasks of the Transaction run while the Rollback happens.
+       */
+      if (transaction_context->aborted()) {
+        return;
+      }
+      transaction_context->on_operator_started();
+      _output = _on_execute(transaction_context);
+      transaction_context->on_operator_finished();
+    } else {
+      _output = _on_execute(nullptr);
     }
-    transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
-    transaction_context->on_operator_finished();
-  } else {
-    _output = _on_execute(nullptr);
-  }
 
-  // release any temporary data if possible
-  _on_cleanup();
+    // release any temporary data if possible
+    _on_cleanup();
+  }
 
   _performance_data->walltime = performance_timer.lap();
+  if (_output) {
+    _performance_data->output_row_count = _output->row_count();
+    _performance_data->output_chunk_count = _output->chunk_count();
+  }
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
                 _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
                 reinterpret_cast<uintptr_t>(this));
+
+  ExecutionHooks::get().operator_finished.fire(*this);
 }
 
 // returns the result of the operator
@@ -86,6 +128,12 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   return _deep_copy_impl(copied_ops);
 }
 
+std::shared_ptr<const OperatorTaskGraph> AbstractOperator::task_graph() const { return std::atomic_load(&_task_graph); }
+
+void AbstractOperator::set_task_graph(const std::shared_ptr<const OperatorTaskGraph>& task_graph) {
+  std::atomic_store(&_task_graph, task_graph);
+}
+
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_right() const { return _input_right->get_output(); }
@@ -111,6 +159,38 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_input_right != nullptr) mutable_input_right()->set_transaction_context_recursively(transaction_context);
 }
 
+std::shared_ptr<ArenaMemoryResource> AbstractOperator::arena() const { return _arena.lock(); }
+
+std::shared_ptr<MemoryBudget> AbstractOperator::memory_budget() const {
+  const auto arena = _arena.lock();
+  return arena ? arena->memory_budget() : nullptr;
+}
+
+void AbstractOperator::set_arena_recursively(const std::weak_ptr<ArenaMemoryResource>& arena) {
+  _arena = arena;
+
+  if (_input_left != nullptr) mutable_input_left()->set_arena_recursively(arena);
+  if (_input_right != nullptr) mutable_input_right()->set_arena_recursively(arena);
+}
+
+std::shared_ptr<CancellationToken> AbstractOperator::cancellation_token() const { return _cancellation_token.lock(); }
+
+void AbstractOperator::set_cancellation_token_recursively(const std::weak_ptr<CancellationToken>& cancellation_token) {
+  _cancellation_token = cancellation_token;
+
+  if (_input_left != nullptr) mutable_input_left()->set_cancellation_token_recursively(cancellation_token);
+  if (_input_right != nullptr) mutable_input_right()->set_cancellation_token_recursively(cancellation_token);
+}
+
+bool AbstractOperator::is_cancelled() const {
+  const auto cancellation_token = _cancellation_token.lock();
+  if (cancellation_token && cancellation_token->is_cancelled()) return true;
+
+  // Subqueries only know the transaction context of the statement
+  const auto transaction_context = _transaction_context ? _transaction_context->lock() : nullptr;
+  return transaction_context && transaction_context->cancellation_token().is_cancelled();
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -170,10 +250,18 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
   const auto copied_input_right =
       input_right() ? input_right()->_deep_copy_impl(copied_ops) : std::shared_ptr<AbstractOperator>{};
 
+  const auto copied_op = _copy_with_inputs(copied_input_left, copied_input_right);
+  copied_ops.emplace(this, copied_op);
+
+  return copied_op;
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::_copy_with_inputs(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
-
-  copied_ops.emplace(this, copied_op);
+  copied_op->lqp_node = lqp_node;
 
   return copied_op;
 }
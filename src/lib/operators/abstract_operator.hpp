@@ -11,27 +11,37 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
+class ArenaMemoryResource;
+class CancellationToken;
+class MemoryBudget;
 class OperatorTask;
+class OperatorTaskGraph;
 class Table;
 class TransactionContext;
 
 enum class OperatorType {
   Aggregate,
   Alias,
+  CachedSubplan,
   Delete,
   Difference,
   ExportBinary,
   ExportCsv,
+  ExportParquet,
   GetTable,
   ImportBinary,
   ImportCsv,
+  ImportParquet,
   IndexScan,
   Insert,
+  Intersect,
   JitOperatorWrapper,
   JoinHash,
   JoinIndex,
   JoinMPSM,
   JoinNestedLoop,
+  JoinRange,
   JoinSortMerge,
   Limit,
   Print,
@@ -40,10 +50,12 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
   Validate,
+  Window,
   CreateTable,
   CreatePreparedPlan,
   CreateView,
@@ -103,11 +115,39 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // Arena from which operators may allocate their intermediate results (e.g., PosLists), see ArenaMemoryResource. The
+  // operator only holds a weak reference, as it might outlive the query, e.g., in the SQLPhysicalPlanCache.
+  // Returns nullptr if no arena was set or if it is no longer alive.
+  std::shared_ptr<ArenaMemoryResource> arena() const;
+
+  // Sets the arena of this operator and, recursively, of its inputs. The arena is not passed to subqueries.
+  void set_arena_recursively(const std::weak_ptr<ArenaMemoryResource>& arena);
+
+  // Memory budget of the query, taken from the arena. Returns nullptr if the memory of the query is not limited.
+  std::shared_ptr<MemoryBudget> memory_budget() const;
+
+  // Token with which the statement cancels the execution of the operator, see CancellationToken. Like the arena, it
+  // is only referenced weakly and not passed to subqueries, which are cancelled through their transaction context.
+  // Returns nullptr if no token was set or if it is no longer alive.
+  std::shared_ptr<CancellationToken> cancellation_token() const;
+
+  // Sets the cancellation token of this operator and, recursively, of its inputs
+  void set_cancellation_token_recursively(const std::weak_ptr<CancellationToken>& cancellation_token);
+
+  // Whether the cancellation token of the operator or that of its transaction context was cancelled. Long-running
+  // operators check this between chunks or partitions and stop early, leaving an incomplete output.
+  bool is_cancelled() const;
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
+  // The task graph with which copies of this PQP are executed if it is cached, see OperatorTaskGraph. Only set on the
+  // root of a PQP by whoever executes its copies. Thread-safe, as cached PQPs are shared between statements.
+  std::shared_ptr<const OperatorTaskGraph> task_graph() const;
+  void set_task_graph(const std::shared_ptr<const OperatorTaskGraph>& task_graph);
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -129,6 +169,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // The LQP node that this operator was translated from, set by the LQPTranslator. If a node is translated into
+  // multiple operators, only the topmost one, whose output is the output of the node, has it. Used to compare the
+  // estimated cardinality of the node with the actual one (see collect_cardinality_estimation_errors()).
+  std::shared_ptr<AbstractLQPNode> lqp_node;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -149,10 +194,15 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   void _print_impl(std::ostream& out, std::vector<bool>& levels,
                    std::unordered_map<const AbstractOperator*, size_t>& id_by_operator, size_t& id_counter) const;
 
-  // Looks itself up in @param copied_ops to support diamond shapes in PQPs, if not found calls _on_deep_copy()
+  // Looks itself up in @param copied_ops to support diamond shapes in PQPs, if not found calls _copy_with_inputs()
   std::shared_ptr<AbstractOperator> _deep_copy_impl(
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
 
+  // Copies only this operator by calling _on_deep_copy() with the already copied inputs
+  std::shared_ptr<AbstractOperator> _copy_with_inputs(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const;
+
   virtual std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const = 0;
@@ -169,7 +219,16 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  std::weak_ptr<ArenaMemoryResource> _arena;
+
+  std::weak_ptr<CancellationToken> _cancellation_token;
+
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
+
+  // Accessed with std::atomic_load/store. Not copied by deep_copy(), the copies are executed and not cached.
+  std::shared_ptr<const OperatorTaskGraph> _task_graph;
+
+  friend class OperatorTaskGraph;
 };
 
 }  // namespace opossum
@@ -7,6 +7,7 @@
 #include "abstract_operator.hpp"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "storage/table.hpp"
 
 #include "utils/assert.hpp"
@@ -46,6 +47,13 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds the rows inserted or deleted by the operator to the changes that are written to the WriteAheadLog when the
+   * transaction commits. Operators that do not modify rows themselves, like Update, which consists of a Delete and an
+   * Insert, do not need to override this.
+   */
+  virtual void log_changes(WriteAheadLog::TransactionChanges& changes) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
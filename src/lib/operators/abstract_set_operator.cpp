@@ -0,0 +1,359 @@
+#include "abstract_set_operator.hpp"
+
+#include <boost/container/small_vector.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bytell_hash_map.hpp"
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using RowHash = size_t;
+
+// Hash of a NULL value, so that NULLs in different rows are considered equal
+constexpr auto NULL_VALUE_HASH = RowHash{0x9e3779b97f4a7c15};
+
+// The materialized values of one column of an input. They are needed to tell equal rows from hash collisions.
+class BaseMaterializedColumn {
+ public:
+  virtual ~BaseMaterializedColumn() = default;
+
+  // Materializes the segment and combines the hashes of its values into the hashes of the rows
+  virtual void materialize_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                   std::vector<RowHash>& row_hashes) = 0;
+
+  // other must be a column of the same data type
+  virtual bool equals(const RowID& row_id, const BaseMaterializedColumn& other, const RowID& other_row_id) const = 0;
+};
+
+template <typename T>
+class MaterializedColumn : public BaseMaterializedColumn {
+ public:
+  explicit MaterializedColumn(const ChunkID chunk_count) : _values(chunk_count), _null_values(chunk_count) {}
+
+  void materialize_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                           std::vector<RowHash>& row_hashes) final {
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(segment.size());
+    null_values.resize(segment.size());
+
+    auto chunk_offset = ChunkOffset{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[chunk_offset] = true;
+        boost::hash_combine(row_hashes[chunk_offset], NULL_VALUE_HASH);
+      } else {
+        values[chunk_offset] = position.value();
+        boost::hash_combine(row_hashes[chunk_offset], std::hash<T>{}(position.value()));
+      }
+      ++chunk_offset;
+    });
+  }
+
+  bool equals(const RowID& row_id, const BaseMaterializedColumn& other, const RowID& other_row_id) const final {
+    const auto& other_column = static_cast<const MaterializedColumn<T>&>(other);
+
+    const auto is_null = _null_values[row_id.chunk_id][row_id.chunk_offset];
+    if (is_null != other_column._null_values[other_row_id.chunk_id][other_row_id.chunk_offset]) return false;
+
+    return is_null || _values[row_id.chunk_id][row_id.chunk_offset] ==
+                          other_column._values[other_row_id.chunk_id][other_row_id.chunk_offset];
+  }
+
+ private:
+  std::vector<std::vector<T>> _values;
+  std::vector<std::vector<bool>> _null_values;
+};
+
+struct MaterializedInput {
+  std::vector<std::unique_ptr<BaseMaterializedColumn>> columns;
+  std::vector<std::vector<RowHash>> row_hashes;
+};
+
+MaterializedInput materialize_input(const Table& table) {
+  const auto chunk_count = table.chunk_count();
+
+  auto input = MaterializedInput{};
+  input.row_hashes.resize(chunk_count);
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      input.columns.emplace_back(std::make_unique<MaterializedColumn<ColumnDataType>>(chunk_count));
+    });
+  }
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table.get_chunk(chunk_id);
+      auto& row_hashes = input.row_hashes[chunk_id];
+      row_hashes.resize(chunk->size());
+
+      for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+        input.columns[column_id]->materialize_segment(*chunk->get_segment(column_id), chunk_id, row_hashes);
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return input;
+}
+
+bool rows_equal(const MaterializedInput& input, const RowID& row_id, const MaterializedInput& other_input,
+                const RowID& other_row_id) {
+  for (auto column_id = size_t{0}; column_id < input.columns.size(); ++column_id) {
+    if (!input.columns[column_id]->equals(row_id, *other_input.columns[column_id], other_row_id)) return false;
+  }
+  return true;
+}
+
+// The rows of an input, radix partitioned by their hash. Within a partition, the rows keep the order of the input.
+struct PartitionedRows {
+  std::vector<RowID> row_ids;
+
+  // Partition i spans row_ids[partition_offsets[i]] to row_ids[partition_offsets[i + 1]]
+  std::vector<size_t> partition_offsets;
+};
+
+PartitionedRows partition_rows(const MaterializedInput& input, const size_t radix_bits) {
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto mask = partition_count - 1;
+  const auto chunk_count = input.row_hashes.size();
+
+  // Count the rows per chunk and partition
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto histogram = std::vector<size_t>(partition_count);
+      for (const auto row_hash : input.row_hashes[chunk_id]) {
+        ++histogram[row_hash & mask];
+      }
+      histograms[chunk_id] = std::move(histogram);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Within each partition, the rows of a chunk are placed after those of the preceding chunks
+  auto partitioned_rows = PartitionedRows{};
+  partitioned_rows.partition_offsets.resize(partition_count + 1);
+
+  auto output_offsets_by_chunk = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto offset = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    partitioned_rows.partition_offsets[partition_id] = offset;
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      output_offsets_by_chunk[chunk_id][partition_id] = offset;
+      offset += histograms[chunk_id][partition_id];
+    }
+  }
+  partitioned_rows.partition_offsets[partition_count] = offset;
+  partitioned_rows.row_ids.resize(offset);
+
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& output_offsets = output_offsets_by_chunk[chunk_id];
+      const auto& row_hashes = input.row_hashes[chunk_id];
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_hashes.size(); ++chunk_offset) {
+        partitioned_rows.row_ids[output_offsets[row_hashes[chunk_offset] & mask]++] = RowID{chunk_id, chunk_offset};
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return partitioned_rows;
+}
+
+// Rows that are equal to each other. The first row of the group is used for comparisons.
+struct RowGroup {
+  RowID row_id;
+  bool is_left_row;
+  size_t right_count;
+  size_t left_count;
+};
+
+using RowGroups = ska::bytell_hash_map<RowHash, boost::container::small_vector<RowGroup, 1>>;
+
+size_t calculate_radix_bits(const size_t row_count) {
+  // As in the JoinHash, the hash table of a partition should fit into the L2 cache, which we assume to be 256 KB large.
+  // We pessimistically assume that all rows are distinct.
+  const auto l2_cache_size = 256'000;  // bytes
+  const auto complete_hash_map_size = row_count * (sizeof(RowHash) + sizeof(RowGroup) + 1) / 0.8;
+  const auto adaption_factor = 2.0;  // don't occupy the whole L2 cache
+  const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+
+  return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+}
+
+}  // namespace
+
+namespace opossum {
+
+AbstractSetOperator::AbstractSetOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
+                                         const std::shared_ptr<const AbstractOperator>& right,
+                                         const SetOperationMode mode)
+    : AbstractReadOnlyOperator(type, left, right), _mode(mode) {}
+
+SetOperationMode AbstractSetOperator::mode() const { return _mode; }
+
+const std::string AbstractSetOperator::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + set_operation_mode_to_string.at(_mode) + ")";
+}
+
+void AbstractSetOperator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> AbstractSetOperator::_on_execute() {
+  const auto left_table = input_table_left();
+  const auto right_table = input_table_right();
+
+  Assert(left_table->column_count() == right_table->column_count(), "Input tables must have the same column count");
+  for (auto column_id = ColumnID{0}; column_id < left_table->column_count(); ++column_id) {
+    Assert(left_table->column_data_type(column_id) == right_table->column_data_type(column_id),
+           "Input tables must have the same column data types");
+  }
+
+  // 1. Materialize both inputs and hash their rows
+  const auto left_input = materialize_input(*left_table);
+  const auto right_input = materialize_input(*right_table);
+
+  // 2. Radix partition the rows of both inputs by their hashes
+  const auto radix_bits = calculate_radix_bits(left_table->row_count() + right_table->row_count());
+  const auto left_rows = partition_rows(left_input, radix_bits);
+  const auto right_rows = partition_rows(right_input, radix_bits);
+
+  // 3. Per partition, group the rows and decide which left rows are part of the output. Different partitions write
+  //    different flags, so no synchronization is needed.
+  auto keep_flags = std::vector<std::vector<uint8_t>>(left_table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < left_table->chunk_count(); ++chunk_id) {
+    keep_flags[chunk_id].resize(left_table->get_chunk(chunk_id)->size());
+  }
+
+  const auto partition_count = left_rows.partition_offsets.size() - 1;
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(partition_count);
+
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto left_begin = left_rows.partition_offsets[partition_id];
+    const auto left_end = left_rows.partition_offsets[partition_id + 1];
+    if (left_begin == left_end) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id, left_begin, left_end]() {
+      const auto right_begin = right_rows.partition_offsets[partition_id];
+      const auto right_end = right_rows.partition_offsets[partition_id + 1];
+
+      auto row_groups = RowGroups(right_end - right_begin);
+
+      const auto find_group = [&](auto& groups, const bool is_left_row, const RowID& row_id) -> RowGroup* {
+        const auto& input = is_left_row ? left_input : right_input;
+        for (auto& group : groups) {
+          const auto& group_input = group.is_left_row ? left_input : right_input;
+          if (rows_equal(input, row_id, group_input, group.row_id)) return &group;
+        }
+        return nullptr;
+      };
+
+      for (auto right_offset = right_begin; right_offset < right_end; ++right_offset) {
+        const auto& row_id = right_rows.row_ids[right_offset];
+        auto& groups = row_groups[right_input.row_hashes[row_id.chunk_id][row_id.chunk_offset]];
+
+        auto* group = find_group(groups, false, row_id);
+        if (group) {
+          ++group->right_count;
+        } else {
+          groups.emplace_back(RowGroup{row_id, false, 1, 0});
+        }
+      }
+
+      for (auto left_offset = left_begin; left_offset < left_end; ++left_offset) {
+        const auto& row_id = left_rows.row_ids[left_offset];
+        auto& groups = row_groups[left_input.row_hashes[row_id.chunk_id][row_id.chunk_offset]];
+
+        auto* group = find_group(groups, true, row_id);
+        if (!group) {
+          groups.emplace_back(RowGroup{row_id, true, 0, 0});
+          group = &groups.back();
+        }
+
+        keep_flags[row_id.chunk_id][row_id.chunk_offset] = _keep_row(group->left_count, group->right_count);
+        ++group->left_count;
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 4. Create the output, which references the kept left rows
+  auto output = std::make_shared<Table>(left_table->column_definitions(), TableType::References);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < left_table->chunk_count(); ++chunk_id) {
+    const auto& chunk_keep_flags = keep_flags[chunk_id];
+    if (std::find(chunk_keep_flags.begin(), chunk_keep_flags.end(), uint8_t{1}) == chunk_keep_flags.end()) continue;
+
+    const auto in_chunk = left_table->get_chunk(chunk_id);
+
+    Segments output_segments;
+
+    // Segments that reference the same PosList in the input share their PosList in the output (see table_scan.hpp)
+    std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>> out_pos_list_map;
+
+    for (auto column_id = ColumnID{0}; column_id < left_table->column_count(); ++column_id) {
+      auto out_referenced_table = left_table;
+      auto out_column_id = column_id;
+      std::shared_ptr<const PosList> in_pos_list;
+
+      if (const auto reference_segment =
+              std::dynamic_pointer_cast<const ReferenceSegment>(in_chunk->get_segment(column_id))) {
+        out_referenced_table = reference_segment->referenced_table();
+        out_column_id = reference_segment->referenced_column_id();
+        in_pos_list = reference_segment->pos_list();
+      }
+
+      auto& pos_list_out = out_pos_list_map[in_pos_list];
+      if (!pos_list_out) {
+        pos_list_out = std::make_shared<PosList>();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_keep_flags.size(); ++chunk_offset) {
+          if (!chunk_keep_flags[chunk_offset]) continue;
+          pos_list_out->emplace_back(in_pos_list ? (*in_pos_list)[chunk_offset] : RowID{chunk_id, chunk_offset});
+        }
+        if (!in_pos_list || in_pos_list->references_single_chunk()) pos_list_out->guarantee_single_chunk();
+      }
+
+      output_segments.push_back(std::make_shared<ReferenceSegment>(out_referenced_table, out_column_id, pos_list_out));
+    }
+
+    output->append_chunk(output_segments);
+  }
+
+  return output;
+}
+
+}  // namespace opossum
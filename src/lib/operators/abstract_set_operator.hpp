@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Base class for the hash-based set operators (Difference for EXCEPT, Intersect for INTERSECT). Both inputs need to
+ * have the same column data types. The output references those rows of the left input that are part of the result,
+ * its column definitions are those of the left input.
+ *
+ * Rows are compared as a whole, NULLs being equal to each other (as SQL does for set operations):
+ *   1. Both inputs are materialized column by column in parallel (per chunk). While doing so, the hashes of the values
+ *      are combined into one hash per row.
+ *   2. Like the JoinHash, the rows of both inputs are radix partitioned by their hash, so that the hash table of a
+ *      partition is expected to fit into the L2 cache.
+ *   3. Each partition is processed in parallel: The right rows are grouped by their hash and (to detect collisions)
+ *      their values. Then, each left row is looked up in these groups. _keep_row() decides, based on the number of
+ *      equal right rows and on the number of equal left rows seen before, whether the row is part of the output.
+ *
+ * As each partition processes its left rows in the order of the input, the first of several equal left rows is the
+ * one that is kept for SetOperationMode::Unique.
+ */
+class AbstractSetOperator : public AbstractReadOnlyOperator {
+ public:
+  AbstractSetOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
+                      const std::shared_ptr<const AbstractOperator>& right, const SetOperationMode mode);
+
+  SetOperationMode mode() const;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Decides whether a left row is part of the output. left_occurrence is the number of equal left rows that precede it,
+  // right_count the number of equal right rows.
+  virtual bool _keep_row(const size_t left_occurrence, const size_t right_count) const = 0;
+
+  const SetOperationMode _mode;
+};
+
+}  // namespace opossum
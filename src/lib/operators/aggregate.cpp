@@ -4,49 +4,287 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "aggregate/aggregate_grouping.hpp"
 #include "aggregate/aggregate_traits.hpp"
 #include "constant_mappings.hpp"
+#include "memory/huge_page_memory_resource.hpp"
+#include "memory/memory_budget.hpp"
+#include "operators/spill/spill_partitioning.hpp"
+#include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/base_column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/global_dictionary_segment.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table_partitioning.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
+#include "utils/decimal_utils.hpp"
+#include "utils/format_duration.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
 
 namespace {
 using namespace opossum;  // NOLINT
 
-// Given an AggregateKey key, and a RowId row_id where this AggregateKey was encountered, this first checks if the
-// AggregateKey was seen before. If not, a new aggregate result is inserted into results and connected to the row id.
-// This is important so that we can reconstruct the original values later. In any case, a reference to the result is
-// returned so that result information, such as the aggregate's count or sum, can be modified by the caller.
-template <typename ResultIds, typename Results, typename AggregateKey>
-typename Results::reference get_or_add_result(ResultIds& result_ids, Results& results, const AggregateKey& key,
-                                              const RowID& row_id) {
-  // Get the result id for the current key or add it to the id map
-  auto it = result_ids.find(key);
-  if (it != result_ids.end()) return results[it->second];
+// Key domains up to this size are always grouped through a dense array, see group_dense_aggregate_keys()
+constexpr auto DENSE_GROUPING_MIN_DOMAIN_SIZE = size_t{1} << 16;
+
+// Partial aggregates hold a result for every group. To keep the cost of creating and merging them small compared to
+// the aggregation itself, each range of chunks that is aggregated separately needs this many rows per group.
+constexpr auto MIN_ROWS_PER_GROUP_FOR_PARTIAL_AGGREGATES = size_t{16};
+
+// Estimates the number of groups as the product of the distinct counts of the group-by columns, capped by the row
+// count. For ReferenceSegments, the statistics of the referenced table are used. If no statistics are available, the
+// row count is returned.
+size_t estimate_group_count(const Table& input_table, const std::vector<ColumnID>& groupby_column_ids) {
+  const auto row_count = static_cast<double>(input_table.row_count());
+  if (groupby_column_ids.empty() || input_table.chunk_count() == 0) return std::min(size_t{1}, input_table.row_count());
+
+  auto group_count = 1.0;
+  for (const auto& column_id : groupby_column_ids) {
+    auto table_statistics = input_table.table_statistics();
+    auto statistics_column_id = column_id;
+
+    if (input_table.type() == TableType::References) {
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+          input_table.get_chunk(ChunkID{0})->get_segment(column_id));
+      if (!reference_segment) return input_table.row_count();
+      table_statistics = reference_segment->referenced_table()->table_statistics();
+      statistics_column_id = reference_segment->referenced_column_id();
+    }
+
+    if (!table_statistics) return input_table.row_count();
+
+    // NULL is a group of its own
+    group_count *= table_statistics->column_statistics()[statistics_column_id]->distinct_count() + 1.0;
+    if (group_count >= row_count) return input_table.row_count();
+  }
+
+  return static_cast<size_t>(group_count);
+}
+
+// Fixed-width AggregateKeys hold at most this many bits, see group_key_bit_widths()
+constexpr auto MAX_PACKED_KEY_BIT_WIDTH = size_t{128};
+
+struct GroupKeyBitWidths {
+  // For each group-by column, the number of bits needed for its ids (including 0 for NULL)
+  std::vector<size_t> bit_widths;
+  size_t total_bit_width{0};
+
+  // Whether all segments of the group-by columns are DictionarySegments or GlobalDictionarySegments, so that the ids
+  // can be built from their ValueIDs, see build_dictionary_aggregate_keys()
+  bool dictionary_encoded{false};
+};
+
+// Bounds the number of ids that each group-by column assigns to its values. The column-wide ids are bounded by the
+// summed dictionary sizes of its DictionarySegments (as the dictionaries of the chunks may differ) and by the sizes of
+// its other segments. Dictionaries that are shared by GlobalDictionarySegments are only counted once. If the ids of
+// all columns fit into MAX_PACKED_KEY_BIT_WIDTH bits, they can be packed into a single fixed-width AggregateKey.
+GroupKeyBitWidths group_key_bit_widths(const Table& input_table, const std::vector<ColumnID>& groupby_column_ids) {
+  auto key_bit_widths = GroupKeyBitWidths{std::vector<size_t>(groupby_column_ids.size()), 0,
+                                          !groupby_column_ids.empty() && input_table.chunk_count() > 0};
+
+  for (auto column_index = size_t{0}; column_index < groupby_column_ids.size(); ++column_index) {
+    auto id_count = uint64_t{1};
+    auto previous_global_dictionary = std::shared_ptr<const void>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table.chunk_count(); ++chunk_id) {
+      const auto segment = input_table.get_chunk(chunk_id)->get_segment(groupby_column_ids[column_index]);
+      const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+      if (!dictionary_segment || (dictionary_segment->encoding_type() != EncodingType::Dictionary &&
+                                  dictionary_segment->encoding_type() != EncodingType::GlobalDictionary)) {
+        key_bit_widths.dictionary_encoded = false;
+        id_count += segment->size();
+        continue;
+      }
+
+      if (dictionary_segment->encoding_type() == EncodingType::GlobalDictionary) {
+        auto global_dictionary = std::shared_ptr<const void>{};
+        resolve_data_type(segment->data_type(), [&](const auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          global_dictionary = static_cast<const GlobalDictionarySegment<ColumnDataType>&>(*segment).dictionary();
+        });
+        if (global_dictionary == previous_global_dictionary) continue;
+        previous_global_dictionary = global_dictionary;
+      }
+
+      id_count += dictionary_segment->unique_values_count();
+    }
+
+    auto& bit_width = key_bit_widths.bit_widths[column_index];
+    while (bit_width < 64 && (uint64_t{1} << bit_width) < id_count) ++bit_width;
+    key_bit_widths.total_bit_width += bit_width;
+  }
+
+  return key_bit_widths;
+}
+
+// Maps the ValueIDs of a DictionarySegment to column-wide AggregateKeyEntries using id_map, which is shared by all
+// chunks of the column. The entry at null_value_id() (i.e., the dictionary size) is 0, which is reserved for NULL.
+template <typename ColumnDataType, typename IdMap>
+std::vector<AggregateKeyEntry> map_dictionary_to_key_entries(const DictionarySegment<ColumnDataType>& segment,
+                                                             IdMap& id_map, AggregateKeyEntry& id_counter) {
+  const auto& dictionary = *segment.dictionary();
+
+  auto key_entries = std::vector<AggregateKeyEntry>(dictionary.size() + 1);
+  for (auto value_id = ValueID{0}; value_id < dictionary.size(); ++value_id) {
+    const auto inserted = id_map.try_emplace(dictionary[value_id], id_counter);
+    key_entries[value_id] = inserted.first->second;
+    if (inserted.second) ++id_counter;
+  }
+  key_entries[segment.null_value_id()] = 0u;
+
+  return key_entries;
+}
+
+/*
+Builds the AggregateKeys for group-by columns that are dictionary-encoded in all chunks without decoding or hashing
+the individual values: Per chunk and column, the ValueIDs are mapped to column-wide ids (as the dictionaries of the
+chunks differ). Chunks that share the dictionary of a GlobalDictionarySegment share the mapping as well. The ids of all
+columns are then packed into a single AggregateKeyEntry, using the bit widths from group_key_bit_widths().
+*/
+void build_dictionary_aggregate_keys(const Table& input_table, const std::vector<ColumnID>& groupby_column_ids,
+                                     const std::vector<size_t>& bit_widths,
+                                     KeysPerChunk<AggregateKeyEntry>& keys_per_chunk) {
+  const auto chunk_count = input_table.chunk_count();
+
+  // For each group-by column and chunk, the AggregateKeyEntry of each ValueID
+  auto key_entries_per_column =
+      std::vector<std::vector<std::shared_ptr<const std::vector<AggregateKeyEntry>>>>(groupby_column_ids.size());
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(std::max(groupby_column_ids.size(), static_cast<size_t>(chunk_count)));
+
+  for (auto column_index = size_t{0}; column_index < groupby_column_ids.size(); ++column_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_index]() {
+      const auto column_id = groupby_column_ids[column_index];
+      auto& key_entries_per_chunk = key_entries_per_column[column_index];
+      key_entries_per_chunk.resize(chunk_count);
+
+      resolve_data_type(input_table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry>{};
+        AggregateKeyEntry id_counter = 1u;
 
-  auto result_id = results.size();
+        auto previous_global_dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto& segment = static_cast<const DictionarySegment<ColumnDataType>&>(
+              *input_table.get_chunk(chunk_id)->get_segment(column_id));
+          const auto is_global_dictionary = segment.encoding_type() == EncodingType::GlobalDictionary;
+          if (is_global_dictionary && segment.dictionary() == previous_global_dictionary) {
+            key_entries_per_chunk[chunk_id] = key_entries_per_chunk[chunk_id - 1];
+            continue;
+          }
+          previous_global_dictionary = is_global_dictionary ? segment.dictionary() : nullptr;
+          key_entries_per_chunk[chunk_id] = std::make_shared<const std::vector<AggregateKeyEntry>>(
+              map_dictionary_to_key_entries(segment, id_map, id_counter));
+        }
+      });
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table.get_chunk(chunk_id);
+      auto& keys = keys_per_chunk[chunk_id];
+
+      auto shift = size_t{0};
+      for (auto column_index = size_t{0}; column_index < groupby_column_ids.size(); ++column_index) {
+        // Columns with only NULLs do not contribute to the key
+        if (bit_widths[column_index] == 0) continue;
+
+        const auto& segment =
+            static_cast<const BaseDictionarySegment&>(*chunk->get_segment(groupby_column_ids[column_index]));
+        const auto& key_entries = *key_entries_per_column[column_index][chunk_id];
+
+        resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+          auto chunk_offset = ChunkOffset{0};
+          for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+               ++value_id_it, ++chunk_offset) {
+            keys[chunk_offset] |= key_entries[*value_id_it] << shift;
+          }
+        });
 
-  result_ids.emplace_hint(it, key, result_id);
+        shift += bit_widths[column_index];
+      }
+    }));
+    jobs.back()->schedule(preferred_node_for_chunk(input_table, chunk_id));
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+/*
+Packs the ids of all group-by columns into one fixed-width key per row: The ids of a column are shifted by the summed
+bit widths of the previous columns. In a 128-bit key (i.e., std::array<AggregateKeyEntry, 2>), a column may straddle
+both entries. Whether it does is known per column, so the loops over the rows do not branch. Each chunk is packed by a
+separate job, as the ids of different columns may share an entry and cannot be written by the per-column jobs.
+*/
+template <typename AggregateKey>
+void pack_aggregate_key_entries(const std::vector<std::vector<std::vector<AggregateKeyEntry>>>& entries_per_column,
+                                const std::vector<size_t>& bit_widths, KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(keys_per_chunk.size());
 
-  // If it was added to the id map, add the current row id to the result list so that we can revert the
-  // value(s) -> key mapping
-  results.emplace_back();
-  results[result_id].row_id = row_id;
+  for (auto chunk_id = ChunkID{0}; chunk_id < keys_per_chunk.size(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& keys = keys_per_chunk[chunk_id];
 
-  return results[result_id];
+      auto shift = size_t{0};
+      for (auto column_index = size_t{0}; column_index < bit_widths.size(); ++column_index) {
+        // Columns with only NULLs do not contribute to the key
+        if (bit_widths[column_index] == 0) continue;
+
+        const auto& entries = entries_per_column[column_index][chunk_id];
+        const auto entry_shift = shift % 64;
+
+        if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+            keys[chunk_offset] |= entries[chunk_offset] << entry_shift;
+          }
+        } else {
+          static_assert(std::is_same_v<AggregateKey, std::array<AggregateKeyEntry, 2>>, "Unexpected fixed-width key");
+
+          const auto entry_index = shift / 64;
+          if (entry_shift + bit_widths[column_index] <= 64) {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+              keys[chunk_offset][entry_index] |= entries[chunk_offset] << entry_shift;
+            }
+          } else {
+            // entry_shift is not 0 here, so the right shift is smaller than 64
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+              keys[chunk_offset][0] |= entries[chunk_offset] << entry_shift;
+              keys[chunk_offset][1] |= entries[chunk_offset] >> (64 - entry_shift);
+            }
+          }
+        }
+
+        shift += bit_widths[column_index];
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
 }
 }  // namespace
 
@@ -55,7 +293,7 @@ namespace opossum {
 Aggregate::Aggregate(const std::shared_ptr<AbstractOperator>& in,
                      const std::vector<AggregateColumnDefinition>& aggregates,
                      const std::vector<ColumnID>& groupby_column_ids)
-    : AbstractReadOnlyOperator(OperatorType::Aggregate, in),
+    : AbstractReadOnlyOperator(OperatorType::Aggregate, in, nullptr, std::make_unique<PerformanceData>()),
       _aggregates(aggregates),
       _groupby_column_ids(groupby_column_ids) {
   Assert(!(aggregates.empty() && groupby_column_ids.empty()),
@@ -105,30 +343,38 @@ void Aggregate::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 
 void Aggregate::_on_cleanup() { _contexts_per_column.clear(); }
 
+std::string Aggregate::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += "group " + format_duration(grouping) + ", aggregate " + format_duration(aggregating) + ", write " +
+            format_duration(output_writing);
+  if (table_partition_count > 0) string += ", " + std::to_string(table_partition_count) + " table partitions";
+  return string;
+}
+
 /*
-Visitor context for the AggregateVisitor. The AggregateResultContext can be used without knowing the
-AggregateKey, the AggregateContext is the "full" version.
+Visitor context for the AggregateVisitor. It holds one AggregateResult per group, which is indexed by the group id
+(see aggregate_grouping.hpp).
 */
 template <typename ColumnDataType, typename AggregateType>
 struct AggregateResultContext : SegmentVisitorContext {
   using AggregateResultAllocator = PolymorphicAllocator<AggregateResults<ColumnDataType, AggregateType>>;
 
-  AggregateResultContext() : results(AggregateResultAllocator{&buffer}) {}
+  // Creates one result per group and connects it to the first row of the group. This is important so that we can
+  // reconstruct the values of the group-by columns later.
+  // The distinct values of COUNT(DISTINCT) are allocated from the same buffer.
+  explicit AggregateResultContext(const std::vector<RowID>& group_row_ids)
+      : results(AggregateResultAllocator{&buffer}) {
+    results.reserve(group_row_ids.size());
+    for (const auto& row_id : group_row_ids) {
+      results.emplace_back(row_id, PolymorphicAllocator<ColumnDataType>{&buffer});
+    }
+  }
 
   boost::container::pmr::monotonic_buffer_resource buffer;
   AggregateResults<ColumnDataType, AggregateType> results;
 };
 
-template <typename ColumnDataType, typename AggregateType, typename AggregateKey>
-struct AggregateContext : public AggregateResultContext<ColumnDataType, AggregateType> {
-  AggregateContext() {
-    auto allocator = AggregateResultIdMapAllocator<AggregateKey>{&this->buffer};
-    result_ids = std::make_unique<AggregateResultIdMap<AggregateKey>>(allocator);
-  }
-
-  std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
-};
-
 /*
 The AggregateFunctionBuilder is used to create the lambda function that will be used by
 the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
@@ -201,23 +447,30 @@ struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction
   }
 };
 
-template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                   const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+template <typename ColumnDataType, typename AggregateType>
+struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct> {
+  auto get_aggregate_function() {
+    return [](const ColumnDataType&, std::optional<AggregateType>& current_aggregate) { return std::nullopt; };
+  }
+};
+
+template <typename ColumnDataType, AggregateFunction function>
+void Aggregate::_aggregate_segment(SegmentVisitorContext& context, const BaseSegment& base_segment,
+                                   const std::vector<AggregateResultId>& group_ids) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& results = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(context).results;
 
-  auto& result_ids = *context.result_ids;
-  auto& results = context.results;
-  const auto& hash_keys = keys_per_chunk[chunk_id];
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&base_segment)) {
+    _aggregate_run_length_segment<ColumnDataType, function>(context, *run_length_segment, group_ids);
+    return;
+  }
 
   ChunkOffset chunk_offset{0};
   segment_iterate<ColumnDataType>(base_segment, [&](const auto& position) {
-    auto& result = get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID(chunk_id, chunk_offset));
+    auto& result = results[group_ids[chunk_offset]];
 
     /**
     * If the value is NULL, the current aggregate value does not change.
@@ -233,6 +486,9 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
         // clang-tidy error: https://bugs.llvm.org/show_bug.cgi?id=35824
         // for the case of CountDistinct, insert this value into the set to keep track of distinct values
         result.distinct_values.insert(position.value());
+      } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {  // NOLINT
+        // Only the hash of the value is kept in the group's sketch
+        result.distinct_value_sketch.insert(std::hash<ColumnDataType>{}(position.value()));
       }
     }
 
@@ -240,8 +496,213 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
   });
 }
 
+/*
+Aggregates a RunLengthSegment run by run. Within a run, the rows of the same group are consecutive if the group-by
+columns are sorted as well (or if there are none), so that each such range of rows updates its group's result only
+once: MIN and MAX with the run's value, SUM and AVG with the value times the number of rows, and the counts with the
+number of rows.
+*/
+template <typename ColumnDataType, AggregateFunction function>
+void Aggregate::_aggregate_run_length_segment(SegmentVisitorContext& context,
+                                              const RunLengthSegment<ColumnDataType>& segment,
+                                              const std::vector<AggregateResultId>& group_ids) {
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+
+  auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+
+  auto& results = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(context).results;
+
+  segment.for_each_run([&](const ColumnDataType& value, const bool is_null, const ChunkOffset run_begin,
+                           const ChunkOffset run_end) {
+    // NULL values do not change the aggregates
+    if (is_null) return;
+
+    auto range_begin = run_begin;
+    while (range_begin < run_end) {
+      const auto group_id = group_ids[range_begin];
+      auto range_end = range_begin + 1;
+      while (range_end < run_end && group_ids[range_end] == group_id) ++range_end;
+      const auto row_count = range_end - range_begin;
+
+      auto& result = results[group_id];
+      if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          const auto run_sum = static_cast<AggregateType>(value) * static_cast<AggregateType>(row_count);
+          result.current_aggregate = result.current_aggregate ? *result.current_aggregate + run_sum : run_sum;
+        } else {
+          Fail("SUM and AVG are not defined for strings");
+        }
+      } else {
+        aggregator(value, result.current_aggregate);
+      }
+
+      result.aggregate_count += row_count;
+
+      if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+        result.distinct_values.insert(value);
+      } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {  // NOLINT
+        result.distinct_value_sketch.insert(std::hash<ColumnDataType>{}(value));
+      }
+
+      range_begin = range_end;
+    }
+  });
+}
+
+/*
+Merges the results of an aggregate function that were computed for a range of chunks into the results that were
+computed for other chunks. As all functions are decomposable, the merged results equal the results of aggregating all
+chunks at once.
+*/
+template <typename ColumnDataType, AggregateFunction function>
+void merge_partial_aggregate_results(SegmentVisitorContext& context, const SegmentVisitorContext& partial_context) {
+  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+  using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+  auto& results = static_cast<Context&>(context).results;
+  const auto& partial_results = static_cast<const Context&>(partial_context).results;
+  DebugAssert(results.size() == partial_results.size(), "Partial aggregates need to hold the same groups");
+
+  for (auto group_id = AggregateResultId{0}; group_id < results.size(); ++group_id) {
+    auto& result = results[group_id];
+    const auto& partial_result = partial_results[group_id];
+
+    // Groups without (non-NULL) values in the range of chunks do not change the result
+    if (partial_result.aggregate_count == 0) continue;
+
+    result.aggregate_count += partial_result.aggregate_count;
+
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max ||
+                  function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      const auto& partial_aggregate = *partial_result.current_aggregate;
+      if (!result.current_aggregate) {
+        result.current_aggregate = partial_aggregate;
+      } else if constexpr (function == AggregateFunction::Min) {
+        if (value_smaller(partial_aggregate, *result.current_aggregate)) result.current_aggregate = partial_aggregate;
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (value_greater(partial_aggregate, *result.current_aggregate)) result.current_aggregate = partial_aggregate;
+      } else {
+        // AVG is computed from the sum and aggregate_count
+        *result.current_aggregate += partial_aggregate;
+      }
+    } else if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+      result.distinct_values.insert(partial_result.distinct_values.begin(), partial_result.distinct_values.end());
+    } else if constexpr (function == AggregateFunction::ApproxCountDistinct) {  // NOLINT
+      result.distinct_value_sketch.merge(partial_result.distinct_value_sketch);
+    }
+  }
+}
+
+void Aggregate::_aggregate_chunks(ColumnID column_index, SegmentVisitorContext& context,
+                                  const std::vector<std::vector<AggregateResultId>>& group_ids_per_chunk,
+                                  ChunkID chunk_begin, ChunkID chunk_end) {
+  const auto& input_table = input_table_left();
+  const auto& aggregate = _aggregates[column_index];
+
+  /**
+   * Special COUNT(*) implementation.
+   * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+   * We then go through the group ids and count the occurrences of each group.
+   * The results are saved in the regular aggregate_count variable so that we don't need a
+   * specific output logic for COUNT(*).
+   */
+  if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+    auto& results = static_cast<AggregateResultContext<CountColumnType, CountAggregateType>&>(context).results;
+
+    for (auto chunk_id = chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+      if (is_cancelled()) return;
+
+      for (const auto group_id : group_ids_per_chunk[chunk_id]) {
+        ++results[group_id].aggregate_count;
+      }
+    }
+    return;
+  }
+
+  const auto data_type = input_table->column_data_type(*aggregate.column);
+
+  /*
+  Invoke correct aggregator for each segment
+  */
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    for (auto chunk_id = chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+      // The remaining chunks are skipped once the statement is cancelled, see CancellationToken
+      if (is_cancelled()) return;
+
+      const auto base_segment = input_table->get_chunk(chunk_id)->get_segment(*aggregate.column);
+      const auto& group_ids = group_ids_per_chunk[chunk_id];
+
+      switch (aggregate.function) {
+        case AggregateFunction::Min:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Min>(context, *base_segment, group_ids);
+          break;
+        case AggregateFunction::Max:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Max>(context, *base_segment, group_ids);
+          break;
+        case AggregateFunction::Sum:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Sum>(context, *base_segment, group_ids);
+          break;
+        case AggregateFunction::Avg:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Avg>(context, *base_segment, group_ids);
+          break;
+        case AggregateFunction::Count:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Count>(context, *base_segment, group_ids);
+          break;
+        case AggregateFunction::CountDistinct:
+          _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct>(context, *base_segment, group_ids);
+          break;
+        case AggregateFunction::ApproxCountDistinct:
+          _aggregate_segment<ColumnDataType, AggregateFunction::ApproxCountDistinct>(context, *base_segment,
+                                                                                     group_ids);
+          break;
+      }
+    }
+  });
+}
+
+void Aggregate::_merge_partial_aggregates(ColumnID column_index, const SegmentVisitorContext& partial_context) {
+  auto& context = *_contexts_per_column[column_index];
+  const auto& aggregate = _aggregates[column_index];
+
+  if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+    merge_partial_aggregate_results<CountColumnType, AggregateFunction::Count>(context, partial_context);
+    return;
+  }
+
+  resolve_data_type(input_table_left()->column_data_type(*aggregate.column), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (aggregate.function) {
+      case AggregateFunction::Min:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::Min>(context, partial_context);
+        break;
+      case AggregateFunction::Max:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::Max>(context, partial_context);
+        break;
+      case AggregateFunction::Sum:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::Sum>(context, partial_context);
+        break;
+      case AggregateFunction::Avg:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::Avg>(context, partial_context);
+        break;
+      case AggregateFunction::Count:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::Count>(context, partial_context);
+        break;
+      case AggregateFunction::CountDistinct:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::CountDistinct>(context, partial_context);
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        merge_partial_aggregate_results<ColumnDataType, AggregateFunction::ApproxCountDistinct>(context,
+                                                                                               partial_context);
+        break;
+    }
+  });
+}
+
 template <typename AggregateKey>
-void Aggregate::_aggregate() {
+void Aggregate::_aggregate(const std::optional<std::vector<size_t>>& key_bit_widths, const bool from_dictionaries) {
   // We use monotonic_buffer_resource for the vector of vectors that hold the aggregate keys. That is so that we can
   // save time when allocating and we can throw away everything in this temporary structure at once (once the resource
   // gets deleted). Also, we use the scoped_allocator_adaptor to propagate the allocator to all inner vectors.
@@ -273,6 +734,9 @@ void Aggregate::_aggregate() {
     }
   }
 
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  Timer timer;
+
   /*
   PARTITIONING PHASE
   First we partition the input chunks by the given group key(s).
@@ -293,7 +757,9 @@ void Aggregate::_aggregate() {
                          input_table->row_count() * needed_size_per_aggregate_key;
     needed_size *= 1.1;  // Give it a little bit more, just in case
 
-    auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size);
+    // For large inputs, the buffer is allocated from huge pages, see HugePageMemoryResource
+    auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size,
+                                                                        HugePageMemoryResource::get_default());
     auto allocator = AggregateKeysAllocator{PolymorphicAllocator<AggregateKeys<AggregateKey>>{&temp_buffer}};
     allocator.allocate(1);  // Make sure that the buffer is initialized
     const auto start_next_buffer_size = temp_buffer.next_buffer_size();
@@ -319,12 +785,40 @@ void Aggregate::_aggregate() {
     }
   }
 
+  // If the keys are known to be smaller than key_domain_size, they can be grouped without hashing
+  auto key_domain_size = std::optional<size_t>{};
+
   // Now that we have the data structures in place, we can start the actual work
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(_groupby_column_ids.size());
 
-  for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
+  if (key_bit_widths) {
+    const auto total_bit_width = std::accumulate(key_bit_widths->begin(), key_bit_widths->end(), size_t{0});
+    if (total_bit_width < 64) key_domain_size = size_t{1} << total_bit_width;
+  }
+
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+    if (from_dictionaries) {
+      build_dictionary_aggregate_keys(*input_table, _groupby_column_ids, *key_bit_widths, keys_per_chunk);
+    }
+  }
+
+  // For packed keys, the per-column jobs write the ids of each column into a separate buffer (for each chunk), which
+  // are packed into the keys afterwards, see pack_aggregate_key_entries()
+  auto entries_per_column = std::vector<std::vector<std::vector<AggregateKeyEntry>>>{};
+  if (key_bit_widths && !from_dictionaries) {
+    entries_per_column.resize(_groupby_column_ids.size());
+    for (auto& entries_per_chunk : entries_per_column) {
+      entries_per_chunk.resize(input_table->chunk_count());
+      for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+        entries_per_chunk[chunk_id].resize(input_table->get_chunk(chunk_id)->size());
+      }
+    }
+  }
+
+  for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size() && !from_dictionaries;
+       ++group_column_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, group_column_index]() {
       const auto column_id = _groupby_column_ids.at(group_column_index);
       const auto data_type = input_table->column_data_type(column_id);
 
@@ -339,41 +833,107 @@ void Aggregate::_aggregate() {
         // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
         // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
         // allocate a bit too much.
-        auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
+        auto temp_buffer =
+            boost::container::pmr::monotonic_buffer_resource(1'000'000, HugePageMemoryResource::get_default());
         auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
 
         auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
                                          std::equal_to<ColumnDataType>, decltype(allocator)>(allocator);
         AggregateKeyEntry id_counter = 1u;
 
+        const auto key_entry = [&](const ChunkID chunk_id, const ChunkOffset chunk_offset) -> AggregateKeyEntry& {
+          if (key_bit_widths) return entries_per_column[group_column_index][chunk_id][chunk_offset];
+
+          if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+            return keys_per_chunk[chunk_id][chunk_offset];
+          } else {
+            return keys_per_chunk[chunk_id][chunk_offset][group_column_index];
+          }
+        };
+
+        auto previous_dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+        auto key_entries = std::vector<AggregateKeyEntry>{};
+
         for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+          // The rows of the remaining chunks keep the key of the NULL group
+          if (is_cancelled()) break;
+
           const auto chunk_in = input_table->get_chunk(chunk_id);
           const auto base_segment = chunk_in->get_segment(column_id);
 
+          // For DictionarySegments, only the dictionary needs to be looked up in the id_map. The chunks that share the
+          // dictionary of a GlobalDictionarySegment reuse its AggregateKeyEntries.
+          if (const auto dictionary_segment =
+                  std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(base_segment)) {
+            if (dictionary_segment->dictionary() != previous_dictionary) {
+              key_entries = map_dictionary_to_key_entries(*dictionary_segment, id_map, id_counter);
+              previous_dictionary = dictionary_segment->encoding_type() == EncodingType::GlobalDictionary
+                                        ? dictionary_segment->dictionary()
+                                        : nullptr;
+            }
+
+            resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+              auto chunk_offset = ChunkOffset{0};
+              for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+                   ++value_id_it, ++chunk_offset) {
+                key_entry(chunk_id, chunk_offset) = key_entries[*value_id_it];
+              }
+            });
+            continue;
+          }
+
+          // For RunLengthSegments, the id_map is only looked up once per run
+          if (const auto run_length_segment =
+                  std::dynamic_pointer_cast<const RunLengthSegment<ColumnDataType>>(base_segment)) {
+            run_length_segment->for_each_run([&](const ColumnDataType& value, const bool is_null,
+                                                 const ChunkOffset run_begin, const ChunkOffset run_end) {
+              auto run_key_entry = AggregateKeyEntry{0};
+              if (!is_null) {
+                const auto inserted = id_map.try_emplace(value, id_counter);
+                run_key_entry = inserted.first->second;
+                if (inserted.second) ++id_counter;
+              }
+
+              for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+                key_entry(chunk_id, chunk_offset) = run_key_entry;
+              }
+            });
+            continue;
+          }
+
+          // In chunks that are sorted by the column, equal values are adjacent. Rows with the same value as their
+          // predecessor reuse its entry instead of looking it up in the id_map.
+          const auto& ordered_by = chunk_in->ordered_by();
+          const auto is_sorted = ordered_by && ordered_by->first == column_id;
+          auto previous_value = std::optional<ColumnDataType>{};
+          auto previous_key_entry = AggregateKeyEntry{0};
+
           ChunkOffset chunk_offset{0};
           segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
             if (position.is_null()) {
-              if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                keys_per_chunk[chunk_id][chunk_offset] = 0u;
-              } else {
-                keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
-              }
+              key_entry(chunk_id, chunk_offset) = 0u;
+            } else if (is_sorted && previous_value && *previous_value == position.value()) {
+              key_entry(chunk_id, chunk_offset) = previous_key_entry;
             } else {
               auto inserted = id_map.try_emplace(position.value(), id_counter);
               // store either the current id_counter or the existing ID of the value
-              if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                keys_per_chunk[chunk_id][chunk_offset] = inserted.first->second;
-              } else {
-                keys_per_chunk[chunk_id][chunk_offset][group_column_index] = inserted.first->second;
-              }
+              key_entry(chunk_id, chunk_offset) = inserted.first->second;
 
               // if the id_map didn't have the value as a key and a new element was inserted
               if (inserted.second) ++id_counter;
+
+              if (is_sorted) {
+                previous_value = position.value();
+                previous_key_entry = inserted.first->second;
+              }
             }
 
             ++chunk_offset;
           });
         }
+
+        // With a single group-by column, the entries are the keys. Only this job writes key_domain_size.
+        if (_groupby_column_ids.size() == 1) key_domain_size = id_counter;
       });
     }));
     jobs.back()->schedule();
@@ -381,176 +941,190 @@ void Aggregate::_aggregate() {
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  if constexpr (!std::is_same_v<AggregateKey, std::vector<AggregateKeyEntry>>) {
+    if (key_bit_widths && !from_dictionaries) {
+      pack_aggregate_key_entries(entries_per_column, *key_bit_widths, keys_per_chunk);
+      entries_per_column = {};
+    }
+  }
+
+  /*
+  GROUPING PHASE
+  Map each AggregateKey to a dense group id. For many groups, this radix partitions the keys so that each partition
+  can be grouped within the cache, see aggregate_grouping.hpp. Keys from a small domain (e.g., built from dictionary
+  ValueIDs) are grouped through a dense array instead.
+  */
+  // A dense array is used for small key domains, i.e., if it is not much larger than the keys themselves
+  const auto use_dense_grouping =
+      key_domain_size && *key_domain_size <= std::max(input_table->row_count(), DENSE_GROUPING_MIN_DOMAIN_SIZE);
+
+  auto groups = AggregateGroups{};
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+    if (use_dense_grouping) groups = group_dense_aggregate_keys(keys_per_chunk, *key_domain_size);
+  }
+
+  if (!use_dense_grouping) {
+    const auto estimated_group_count = estimate_group_count(*input_table, _groupby_column_ids);
+    const auto radix_bits = calculate_aggregate_radix_bits<AggregateKey>(estimated_group_count);
+    groups = group_aggregate_keys(keys_per_chunk, estimated_group_count, radix_bits);
+  }
+
+  // The keys are not needed anymore
+  keys_per_chunk = KeysPerChunk<AggregateKey>{};
+
+  performance_data.grouping = timer.lap();
+
   /*
   AGGREGATION PHASE
   */
   _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
 
   if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. The grouping phase already determined one group
+     * for every distinct key, so we only insert a dummy context that holds one (unused) AggregateResult per group.
+     * That way, _contexts_per_column will always have at least one context with results. This is important later on
+     * when we write the group keys into the table.
+     *
+     * We choose int8_t for column type and aggregate type because it's small.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+    auto context = std::make_shared<AggregateResultContext<DistinctColumnType, DistinctAggregateType>>(groups.row_ids);
     _contexts_per_column.push_back(context);
+    performance_data.aggregating = timer.lap();
+    return;
   }
 
   /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
+   * Create an AggregateResultContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate
+   * is created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the
+   * input and _write_aggregate_output() needs these contexts anyway.
    */
-  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
+  const auto create_context = [&](const ColumnID column_id) -> std::shared_ptr<SegmentVisitorContext> {
     const auto& aggregate = _aggregates[column_id];
     if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[column_id] = context;
-      continue;
+      return std::make_shared<AggregateResultContext<CountColumnType, CountAggregateType>>(groups.row_ids);
     }
     auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
-  }
-
-  // Process Chunks and perform aggregations
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    auto chunk_in = input_table->get_chunk(chunk_id);
-
-    const auto& hash_keys = keys_per_chunk[chunk_id];
-
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-      }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[column_index]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          // count occurrences for each group key
-          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-            auto& result =
-                get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-            ++result.aggregate_count;
-          }
-
-          ++column_index;
-          continue;
-        }
+    return _create_aggregate_context(data_type, aggregate.function, groups.row_ids);
+  };
 
-        auto base_segment = chunk_in->get_segment(*aggregate.column);
-        auto data_type = input_table->column_data_type(*aggregate.column);
+  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
+    _contexts_per_column[column_id] = create_context(column_id);
+  }
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  /**
+   * Perform the aggregations. As each aggregate has its own results, they are processed in parallel. Additionally,
+   * if there are few groups, consecutive ranges of chunks are aggregated in parallel: The first range aggregates into
+   * _contexts_per_column, the others into partial contexts that are merged into it afterwards.
+   */
+  const auto chunk_count = input_table->chunk_count();
+  const auto group_count = std::max(groups.row_ids.size(), size_t{1});
+  const auto range_count = std::max(
+      size_t{1}, std::min(aggregate_chunk_range_count(chunk_count),
+                          input_table->row_count() / (group_count * MIN_ROWS_PER_GROUP_FOR_PARTIAL_AGGREGATES)));
+
+  auto partial_contexts_per_column =
+      std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(_aggregates.size());
+
+  jobs.clear();
+  jobs.reserve(_aggregates.size() * range_count);
+
+  for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+    partial_contexts_per_column[column_index].resize(range_count);
+
+    for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, column_index, range_id]() {
+        auto& context = range_id == 0 ? _contexts_per_column[column_index]
+                                      : partial_contexts_per_column[column_index][range_id];
+        if (!context) context = create_context(column_index);
+
+        _aggregate_chunks(column_index, *context, groups.group_ids_per_chunk,
+                          aggregate_chunk_range_begin(chunk_count, range_count, range_id),
+                          aggregate_chunk_range_begin(chunk_count, range_count, range_id + 1));
+      }));
+      jobs.back()->schedule();
+    }
+  }
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+  CurrentScheduler::wait_for_tasks(jobs);
 
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
-              break;
-          }
-        });
+  if (range_count > 1) {
+    jobs.clear();
 
-        ++column_index;
-      }
+    for (ColumnID column_index{0}; column_index < _aggregates.size(); ++column_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, column_index]() {
+        auto& partial_contexts = partial_contexts_per_column[column_index];
+        for (auto range_id = size_t{1}; range_id < range_count; ++range_id) {
+          _merge_partial_aggregates(column_index, *partial_contexts[range_id]);
+          partial_contexts[range_id] = nullptr;
+        }
+      }));
+      jobs.back()->schedule();
     }
+
+    CurrentScheduler::wait_for_tasks(jobs);
   }
+
+  performance_data.aggregating = timer.lap();
 }
 
 std::shared_ptr<const Table> Aggregate::_on_execute() {
+  // If the input is partitioned by one of the group-by columns (see TablePartitioning), each group lies within a single
+  // partition. The partitions are aggregated independently and in parallel.
+  if (const auto output = _aggregate_partition_wise()) return output;
+
+  // If the groups might exceed the memory budget of the query, the input is partitioned by the group-by values and
+  // written to disk. As the partitions have disjoint groups, they are aggregated one at a time.
+  auto reservation = std::optional<MemoryReservation>{};
+  if (const auto budget = memory_budget(); budget && !_groupby_column_ids.empty()) {
+    const auto entries_per_row = _groupby_column_ids.size() + _aggregates.size();
+    const auto required_bytes = input_table_left()->row_count() * (sizeof(RowID) + entries_per_row * sizeof(uint64_t));
+
+    reservation = budget->try_reserve(required_bytes);
+    if (!reservation) return _aggregate_spilled_partitions(required_bytes, budget->available_bytes());
+  }
+
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
-  // The reason we only have specializations up to 2 is because every specialization increases the compile time.
-  // Also, we need to make sure that there are tests for at least the first case, one array case, and the fallback.
-  switch (_groupby_column_ids.size()) {
-    case 0:
-    case 1:
-      // No need for a complex data structure if we only have one entry
-      _aggregate<AggregateKeyEntry>();
-      break;
-    case 2:
-      // We need to explicitly list all array sizes that we want to support
-      _aggregate<std::array<AggregateKeyEntry, 2>>();
-      break;
-    default:
-      PerformanceWarning("No std::array implementation initialized - falling back to vector");
-      _aggregate<std::vector<AggregateKeyEntry>>();
-      break;
+  // If the ids of all group-by columns fit into 64 or 128 bits, they are packed into a single AggregateKeyEntry or a
+  // std::array<AggregateKeyEntry, 2>, which are hashed and compared without loops. For dictionary-encoded group-by
+  // columns, the ids are built from the ValueIDs. Only the wider keys fall back to an unpacked array or vector.
+  // Every specialization increases the compile time, and we need to make sure that there are tests for each of them.
+  const auto key_bits = group_key_bit_widths(*input_table_left(), _groupby_column_ids);
+  if (key_bits.dictionary_encoded && key_bits.total_bit_width <= 64) {
+    _aggregate<AggregateKeyEntry>(key_bits.bit_widths, true);
+  } else if (_groupby_column_ids.size() <= 1) {
+    // No need for a complex data structure if we only have one entry
+    _aggregate<AggregateKeyEntry>();
+  } else if (key_bits.total_bit_width <= 64) {
+    _aggregate<AggregateKeyEntry>(key_bits.bit_widths);
+  } else if (_groupby_column_ids.size() == 2) {
+    // Two unpacked entries are as wide as a packed 128-bit key, packing them would only cost time
+    _aggregate<std::array<AggregateKeyEntry, 2>>();
+  } else if (key_bits.total_bit_width <= MAX_PACKED_KEY_BIT_WIDTH) {
+    _aggregate<std::array<AggregateKeyEntry, 2>>(key_bits.bit_widths);
+  } else {
+    PerformanceWarning("Group-by ids exceed " + std::to_string(MAX_PACKED_KEY_BIT_WIDTH) +
+                       " bits - falling back to vector");
+    _aggregate<std::vector<AggregateKeyEntry>>();
   }
 
   const auto& input_table = input_table_left();
 
+  Timer timer;
+
   /**
    * Write group-by columns.
    *
@@ -590,6 +1164,85 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   auto output = std::make_shared<Table>(_output_column_definitions, TableType::Data);
   output->append_chunk(_output_segments);
 
+  static_cast<PerformanceData&>(*_performance_data).output_writing = timer.lap();
+
+  return output;
+}
+
+std::shared_ptr<const Table> Aggregate::_aggregate_partition_wise() {
+  const auto& input_table = input_table_left();
+
+  auto partitioned_chunks = std::optional<PartitionedChunks>{};
+  for (const auto column_id : _groupby_column_ids) {
+    partitioned_chunks = partition_chunks(*input_table, column_id);
+    if (partitioned_chunks) break;
+  }
+  if (!partitioned_chunks) return nullptr;
+
+  auto chunk_ids_by_partition = std::vector<std::vector<ChunkID>>{};
+  for (auto& chunk_ids : partitioned_chunks->chunk_ids_by_partition) {
+    if (!chunk_ids.empty()) chunk_ids_by_partition.emplace_back(std::move(chunk_ids));
+  }
+  if (chunk_ids_by_partition.size() < 2) return nullptr;
+
+  auto partition_outputs = std::vector<std::shared_ptr<const Table>>(chunk_ids_by_partition.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_ids_by_partition.size());
+  for (auto partition_idx = size_t{0}; partition_idx < chunk_ids_by_partition.size(); ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      const auto table_wrapper =
+          std::make_shared<TableWrapper>(table_of_chunks(input_table, chunk_ids_by_partition[partition_idx]));
+      table_wrapper->execute();
+      const auto aggregate = std::make_shared<Aggregate>(table_wrapper, _aggregates, _groupby_column_ids);
+      aggregate->set_cancellation_token_recursively(_cancellation_token);
+      aggregate->execute();
+      partition_outputs[partition_idx] = aggregate->get_output();
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  const auto output = std::make_shared<Table>(partition_outputs.front()->column_definitions(), TableType::Data);
+  for (const auto& partition_output : partition_outputs) {
+    for (const auto& chunk : partition_output->chunks()) {
+      output->append_chunk(chunk->segments());
+    }
+  }
+
+  static_cast<PerformanceData&>(*_performance_data).table_partition_count = chunk_ids_by_partition.size();
+  return output;
+}
+
+std::shared_ptr<const Table> Aggregate::_aggregate_spilled_partitions(const size_t required_bytes,
+                                                                      const size_t available_bytes) {
+  const auto& input_table = input_table_left();
+
+  const auto partition_count = spill_partition_count(required_bytes, available_bytes);
+  auto partitions = spill_partitions(*input_table, _groupby_column_ids, partition_count);
+
+  std::shared_ptr<Table> output;
+  for (auto& partition : partitions) {
+    // The remaining partitions are not read once the statement is cancelled
+    if (output && is_cancelled()) break;
+
+    const auto partition_table = read_partition(input_table, *partition);
+    partition.reset();
+    if (partition_table->row_count() == 0) continue;
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(partition_table);
+    table_wrapper->execute();
+    const auto aggregate = std::make_shared<Aggregate>(table_wrapper, _aggregates, _groupby_column_ids);
+    aggregate->set_cancellation_token_recursively(_cancellation_token);
+    aggregate->execute();
+
+    const auto partition_output = aggregate->get_output();
+    if (!output) output = std::make_shared<Table>(partition_output->column_definitions(), TableType::Data);
+    for (const auto& chunk : partition_output->chunks()) {
+      output->append_chunk(chunk->segments());
+    }
+  }
+
+  DebugAssert(output, "Expected at least one partition to contain rows");
   return output;
 }
 
@@ -656,6 +1309,23 @@ std::enable_if_t<func == AggregateFunction::CountDistinct, void> write_aggregate
   }
 }
 
+// APPROX_COUNT_DISTINCT writes the estimated number of distinct values
+template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
+std::enable_if_t<func == AggregateFunction::ApproxCountDistinct, void> write_aggregate_values(
+    std::shared_ptr<ValueSegment<AggregateType>> segment,
+    const AggregateResults<ColumnDataType, AggregateType>& results) {
+  DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
+
+  auto& values = segment->values();
+  values.resize(results.size());
+
+  size_t i = 0;
+  for (const auto& result : results) {
+    values[i] = result.distinct_value_sketch.estimate();
+    ++i;
+  }
+}
+
 // AVG writes the calculated average from current aggregate and the aggregate counter
 template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
 std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
@@ -700,29 +1370,45 @@ void Aggregate::_write_groupby_output(PosList& pos_list) {
       using ColumnDataType = typename decltype(typed_value)::type;
 
       auto values = pmr_concurrent_vector<ColumnDataType>(pos_list.size());
-      auto null_values = pmr_concurrent_vector<bool>(pos_list.size());
+      auto null_values = NullValueVector(pos_list.size());
       std::vector<std::unique_ptr<BaseSegmentAccessor<ColumnDataType>>> accessors(input_table->chunk_count());
 
-      auto output_offset = ChunkOffset{0};
+      // Consecutive rows of the same chunk are gathered with a single call to the chunk's accessor. The buffers hold
+      // one such run at a time, as the concurrent vectors cannot be written to directly.
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      auto gathered_values = std::vector<ColumnDataType>{};
+      auto gathered_null_values = std::make_unique<bool[]>(pos_list.size());
 
-      for (const auto& row_id : pos_list) {
+      auto run_begin = size_t{0};
+      while (run_begin < pos_list.size()) {
         // pos_list was generated by grouping the input data. While it might point to rows that contain NULL
         // values, no new NULL values should have been added.
-        DebugAssert(!row_id.is_null(), "Did not expect NULL value here");
+        DebugAssert(!pos_list[run_begin].is_null(), "Did not expect NULL value here");
 
-        auto& accessor = accessors[row_id.chunk_id];
+        const auto chunk_id = pos_list[run_begin].chunk_id;
+        chunk_offsets.clear();
+        auto run_end = run_begin;
+        for (; run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id; ++run_end) {
+          chunk_offsets.emplace_back(pos_list[run_end].chunk_offset);
+        }
+
+        auto& accessor = accessors[chunk_id];
         if (!accessor) {
-          accessor =
-              create_segment_accessor<ColumnDataType>(input_table->get_chunk(row_id.chunk_id)->get_segment(column_id));
+          accessor = create_segment_accessor<ColumnDataType>(input_table->get_chunk(chunk_id)->get_segment(column_id));
         }
 
-        const auto& optional_value = accessor->access(row_id.chunk_offset);
-        if (!optional_value) {
-          null_values[output_offset] = true;
-        } else {
-          values[output_offset] = *optional_value;
+        gathered_values.resize(chunk_offsets.size());
+        accessor->gather(chunk_offsets.data(), chunk_offsets.size(), gathered_values.data(),
+                         gathered_null_values.get());
+        for (auto run_offset = size_t{0}; run_offset < chunk_offsets.size(); ++run_offset) {
+          if (gathered_null_values[run_offset]) {
+            null_values[run_begin + run_offset] = true;
+          } else {
+            values[run_begin + run_offset] = std::move(gathered_values[run_offset]);
+          }
         }
-        ++output_offset;
+
+        run_begin = run_end;
       }
 
       auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
@@ -753,6 +1439,9 @@ void Aggregate::_write_aggregate_output(boost::hana::basic_type<ColumnDataType>
     case AggregateFunction::CountDistinct:
       write_aggregate_output<ColumnDataType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
   }
 }
 
@@ -769,6 +1458,17 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
     aggregate_data_type = input_table_left()->column_data_type(*aggregate.column);
   }
 
+  // MIN and MAX keep the logical type of Dates, Timestamps, and Decimals, which the traits only know as Int and Long.
+  // SUM keeps the logical type of Decimals.
+  if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max ||
+                function == AggregateFunction::Sum) {
+    const auto input_data_type = input_table_left()->column_data_type(*aggregate.column);
+    if (input_data_type == DataType::Decimal ||
+        (is_date_time_data_type(input_data_type) && function != AggregateFunction::Sum)) {
+      aggregate_data_type = input_data_type;
+    }
+  }
+
   // Generate column name, TODO(anybody), actually, the AggregateExpression can do this, but the Aggregate operator
   // doesn't use Expressions, yet
   std::stringstream column_name_stream;
@@ -802,7 +1502,8 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   }
 
   // write aggregated values into the segment
-  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
+  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct &&
+                               function != AggregateFunction::ApproxCountDistinct);
   _output_column_definitions.emplace_back(column_name_stream.str(), aggregate_data_type, NEEDS_NULL);
 
   auto output_segment = std::make_shared<ValueSegment<decltype(aggregate_type)>>(NEEDS_NULL);
@@ -812,50 +1513,62 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   } else if (_groupby_column_ids.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
     output_segment->values().push_back(decltype(aggregate_type){});
-    if (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct) {
+    if constexpr (NEEDS_NULL) {
       output_segment->null_values().push_back(true);
     }
   }
 
+  // The AVG of Decimals is computed from the sum of their scaled values
+  if constexpr (function == AggregateFunction::Avg && std::is_same_v<decltype(aggregate_type), double>) {
+    if (input_table_left()->column_data_type(*aggregate.column) == DataType::Decimal) {
+      for (auto& value : output_segment->values()) value /= static_cast<double>(DECIMAL_FACTOR);
+    }
+  }
+
   _output_segments.push_back(output_segment);
 }
 
-template <typename AggregateKey>
-std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(const DataType data_type,
-                                                                            const AggregateFunction function) const {
+std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(
+    const DataType data_type, const AggregateFunction function, const std::vector<RowID>& group_row_ids) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
     switch (function) {
       case AggregateFunction::Min:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Max:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Sum:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Avg:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::Count:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType>>(
+            group_row_ids);
         break;
       case AggregateFunction::CountDistinct:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType>>(
+            group_row_ids);
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType,
+            typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxCountDistinct>::AggregateType>>(
+            group_row_ids);
         break;
     }
   });
@@ -3,17 +3,19 @@
 #include <boost/container/pmr/polymorphic_allocator.hpp>
 #include <boost/container/scoped_allocator.hpp>
 #include <boost/functional/hash.hpp>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
-#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "aggregate/hyper_log_log.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_segment_visitor.hpp"
@@ -27,6 +29,9 @@ namespace opossum {
 template <typename AggregateKey>
 struct GroupByContext;
 
+template <typename T>
+class RunLengthSegment;
+
 /**
  * Aggregates are defined by the column (ColumnID for Operators, LQPColumnReference in LQP) they operate on and the aggregate
  * function they use. COUNT() is the exception that doesn't use a column, which is why column is optional
@@ -48,33 +53,37 @@ Operator to aggregate columns by certain functions, such as min, max, sum, avera
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Aggregate-Operator
 */
 
+// Tracks the distinct values of a group for COUNT(DISTINCT). The values are allocated from the memory resource of the
+// AggregateResultContext, see aggregate.cpp.
+template <typename ColumnDataType>
+using DistinctValues =
+    std::unordered_set<ColumnDataType, std::hash<ColumnDataType>, std::equal_to<ColumnDataType>,
+                       PolymorphicAllocator<ColumnDataType>>;
+
 /*
 For each group in the output, one AggregateResult is created.
 Current aggregated value and the number of rows that were used.
-The latter is used for AVG and COUNT.
+The latter is used for AVG and COUNT. For COUNT(DISTINCT), the distinct values are tracked exactly, while
+APPROX_COUNT_DISTINCT only updates the HyperLogLog sketch. Neither allocates memory for other aggregate functions.
 */
 template <typename ColumnDataType, typename AggregateType>
 struct AggregateResult {
+  AggregateResult(const RowID init_row_id, const PolymorphicAllocator<ColumnDataType>& allocator)
+      : distinct_values(allocator), distinct_value_sketch(allocator), row_id(init_row_id) {}
+
   std::optional<AggregateType> current_aggregate;
   size_t aggregate_count = 0;
-  std::set<ColumnDataType> distinct_values;
+  DistinctValues<ColumnDataType> distinct_values;
+  HyperLogLog distinct_value_sketch;
   RowID row_id;
 };
 
-// This vector holds the results for every group that was encountered and is indexed by AggregateResultId.
+// This vector holds the results for every group that was encountered and is indexed by AggregateResultId, i.e., the
+// id of the group (see aggregate_grouping.hpp).
 template <typename ColumnDataType, typename AggregateType>
 using AggregateResults = pmr_vector<AggregateResult<ColumnDataType, AggregateType>>;
 using AggregateResultId = size_t;
 
-// The AggregateResultIdMap maps AggregateKeys to their index in the list of aggregate results.
-template <typename AggregateKey>
-using AggregateResultIdMapAllocator = PolymorphicAllocator<std::pair<const AggregateKey, AggregateResultId>>;
-
-template <typename AggregateKey>
-using AggregateResultIdMap =
-    std::unordered_map<AggregateKey, AggregateResultId, std::hash<AggregateKey>, std::equal_to<AggregateKey>,
-                       AggregateResultIdMapAllocator<AggregateKey>>;
-
 /*
 The key type that is used for the aggregation map.
 */
@@ -112,11 +121,27 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename ColumnDataType, AggregateFunction function>
   void write_aggregate_output(ColumnID column_index);
 
+  struct PerformanceData : public OperatorPerformanceData {
+    // Durations of building and grouping the keys, of computing the aggregates, and of writing the output
+    std::chrono::nanoseconds grouping{0};
+    std::chrono::nanoseconds aggregating{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    // Number of table partitions that were aggregated independently, see TablePartitioning
+    size_t table_partition_count{0};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  // If key_bit_widths is set, the ids of all group-by columns are packed into a single fixed-width AggregateKey, each
+  // column using the given number of bits. With from_dictionaries, the ids are taken from the ValueIDs of the
+  // dictionary-encoded group-by columns.
   template <typename AggregateKey>
-  void _aggregate();
+  void _aggregate(const std::optional<std::vector<size_t>>& key_bit_widths = std::nullopt,
+                  const bool from_dictionaries = false);
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -126,19 +151,39 @@ class Aggregate : public AbstractReadOnlyOperator {
 
   void _on_cleanup() override;
 
+  // Aggregates the table partitions of an input that is partitioned by a group-by column in parallel, see
+  // _on_execute(). Returns nullptr if the input is not partitioned by any of the group-by columns.
+  std::shared_ptr<const Table> _aggregate_partition_wise();
+
+  // Aggregates the input in partitions that are spilled to disk, see _on_execute()
+  std::shared_ptr<const Table> _aggregate_spilled_partitions(const size_t required_bytes,
+                                                             const size_t available_bytes);
+
   template <typename ColumnDataType>
   void _write_aggregate_output(boost::hana::basic_type<ColumnDataType> type, ColumnID column_index,
                                AggregateFunction function);
 
   void _write_groupby_output(PosList& pos_list);
 
-  template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  template <typename ColumnDataType, AggregateFunction function>
+  void _aggregate_segment(SegmentVisitorContext& context, const BaseSegment& base_segment,
+                          const std::vector<AggregateResultId>& group_ids);
+
+  template <typename ColumnDataType, AggregateFunction function>
+  void _aggregate_run_length_segment(SegmentVisitorContext& context, const RunLengthSegment<ColumnDataType>& segment,
+                                     const std::vector<AggregateResultId>& group_ids);
+
+  // Aggregates the segments of the chunks in [chunk_begin, chunk_end) for the given aggregate into context
+  void _aggregate_chunks(ColumnID column_index, SegmentVisitorContext& context,
+                         const std::vector<std::vector<AggregateResultId>>& group_ids_per_chunk, ChunkID chunk_begin,
+                         ChunkID chunk_end);
+
+  // Merges results that were aggregated for a range of chunks into the context in _contexts_per_column
+  void _merge_partial_aggregates(ColumnID column_index, const SegmentVisitorContext& partial_context);
 
-  template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction function) const;
+                                                                   const AggregateFunction function,
+                                                                   const std::vector<RowID>& group_row_ids) const;
 
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
@@ -162,9 +207,11 @@ struct hash<std::vector<opossum::AggregateKeyEntry>> {
 
 template <>
 struct hash<std::array<opossum::AggregateKeyEntry, 2>> {
-  // gcc7 doesn't support templating by `int N` here.
+  // gcc7 doesn't support templating by `int N` here. Unlike boost::hash_range, this mixes both entries without
+  // branches, so that packed 128-bit keys (see Aggregate::_aggregate) hash as cheaply as single entries.
   size_t operator()(const std::array<opossum::AggregateKeyEntry, 2>& key) const {
-    return boost::hash_range(key.begin(), key.end());
+    auto hash = (key[0] * 0xC2B2AE3D27D4EB4FULL + key[1]) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash ^ (hash >> 32));
   }
 };
 }  // namespace std
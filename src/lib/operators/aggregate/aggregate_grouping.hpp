@@ -0,0 +1,428 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "operators/aggregate.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+/*
+  This file contains the grouping step of the Aggregate operator: Each row's AggregateKey is mapped to a dense group
+  id, so that the aggregation itself can index the results directly instead of looking up the key for every aggregate.
+
+  For high-cardinality GROUP BYs, a single hash table that holds all groups does not fit into the cache. Thus, the
+  keys are radix partitioned by their hash (using the partitioning of JoinHash, see join_hash_steps.hpp) and each
+  partition is grouped by a separate task into a cache-sized open-addressing table. The group ids of a partition are
+  offset by the number of groups in all previous partitions, i.e., the partitions' groups are concatenated.
+
+  If the keys are known to lie within a small domain (e.g., because they are built from dictionary ValueIDs), they are
+  grouped through a dense array instead, see group_dense_aggregate_keys().
+
+  For few groups, one table suffices, but filling it from all rows on a single thread does not scale. Instead,
+  consecutive ranges of chunks are grouped into separate tables in parallel, which are merged afterwards, see
+  group_aggregate_keys_in_ranges().
+*/
+namespace opossum {
+
+/*
+Open-addressing (linear probing) hash table that maps AggregateKeys to group ids in the order of their insertion.
+As all keys of one radix partition share the lowest bits of their hash, the slot is determined by the highest bits
+of the (mixed) hash.
+*/
+template <typename AggregateKey>
+class AggregateGroupTable {
+ public:
+  explicit AggregateGroupTable(const size_t expected_group_count) {
+    auto capacity = size_t{16};
+    while (capacity * MAX_LOAD_FACTOR < static_cast<double>(expected_group_count)) capacity <<= 1;
+    _resize(capacity);
+  }
+
+  // Returns the group id of the key, creating a new group if the key was not seen before, and whether a new group was
+  // created.
+  std::pair<AggregateResultId, bool> find_or_insert(const AggregateKey& key) {
+    if (static_cast<double>(_group_count + 1) > static_cast<double>(_slots.size()) * MAX_LOAD_FACTOR) {
+      _resize(_slots.size() * 2);
+    }
+
+    auto slot_id = _slot_id(key);
+    while (true) {
+      auto& slot = _slots[slot_id];
+      if (slot.group_id == INVALID_GROUP_ID) {
+        slot.key = key;
+        slot.group_id = _group_count++;
+        return {slot.group_id, true};
+      }
+      if (slot.key == key) return {slot.group_id, false};
+
+      slot_id = (slot_id + 1) & _mask;
+    }
+  }
+
+  size_t group_count() const { return _group_count; }
+
+ private:
+  static constexpr auto MAX_LOAD_FACTOR = 0.7;
+  static constexpr auto INVALID_GROUP_ID = std::numeric_limits<AggregateResultId>::max();
+
+  struct Slot {
+    AggregateKey key{};
+    AggregateResultId group_id{INVALID_GROUP_ID};
+  };
+
+  size_t _slot_id(const AggregateKey& key) const {
+    // Fibonacci hashing spreads the hash, std::hash is the identity for integers
+    const auto mixed_hash = static_cast<uint64_t>(std::hash<AggregateKey>{}(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(mixed_hash >> _shift);
+  }
+
+  void _resize(const size_t capacity) {
+    auto old_slots = std::move(_slots);
+
+    _slots = std::vector<Slot>(capacity);
+    _mask = capacity - 1;
+    _shift = 64 - static_cast<size_t>(std::log2(capacity));
+
+    for (auto& old_slot : old_slots) {
+      if (old_slot.group_id == INVALID_GROUP_ID) continue;
+
+      auto slot_id = _slot_id(old_slot.key);
+      while (_slots[slot_id].group_id != INVALID_GROUP_ID) slot_id = (slot_id + 1) & _mask;
+      _slots[slot_id] = std::move(old_slot);
+    }
+  }
+
+  std::vector<Slot> _slots;
+  size_t _mask{0};
+  size_t _shift{0};
+  size_t _group_count{0};
+};
+
+/*
+Maps keys that are smaller than the key domain size to group ids in the order of their insertion. Instead of hashing
+the keys, a dense array that is indexed by the key holds the group ids.
+*/
+class DenseAggregateGroupTable {
+ public:
+  explicit DenseAggregateGroupTable(const size_t key_domain_size) : _group_ids(key_domain_size, INVALID_GROUP_ID) {}
+
+  std::pair<AggregateResultId, bool> find_or_insert(const AggregateKeyEntry key) {
+    DebugAssert(key < _group_ids.size(), "Key exceeds the domain of the dense grouping");
+    auto& group_id = _group_ids[key];
+    if (group_id != INVALID_GROUP_ID) return {group_id, false};
+
+    group_id = _group_count++;
+    return {group_id, true};
+  }
+
+  size_t group_count() const { return _group_count; }
+
+ private:
+  static constexpr auto INVALID_GROUP_ID = std::numeric_limits<AggregateResultId>::max();
+
+  std::vector<AggregateResultId> _group_ids;
+  size_t _group_count{0};
+};
+
+// Dense key domains up to this size are grouped in chunk ranges, as each range allocates an array of that size
+constexpr auto MAX_RANGED_DENSE_GROUPING_DOMAIN_SIZE = size_t{1} << 16;
+
+struct AggregateGroups {
+  // For each input row (by ChunkID and ChunkOffset), the id of its group. Group ids are in [0, row_ids.size()).
+  std::vector<std::vector<AggregateResultId>> group_ids_per_chunk;
+
+  // For each group, the first input row that belongs to it. Used to write the group-by columns.
+  std::vector<RowID> row_ids;
+};
+
+/*
+The number of consecutive chunk ranges that are grouped (and aggregated) by separate tasks: one per CPU, but not more
+than there are chunks. Without a scheduler, the tasks are executed sequentially and a single range is used.
+*/
+inline size_t aggregate_chunk_range_count(const size_t chunk_count) {
+  if (!CurrentScheduler::is_set()) return 1;
+  return std::max(size_t{1}, std::min(chunk_count, Topology::get().num_cpus()));
+}
+
+// The first ChunkID of the given range, where range_id == range_count yields the end of the last range
+inline ChunkID aggregate_chunk_range_begin(const size_t chunk_count, const size_t range_count, const size_t range_id) {
+  return static_cast<ChunkID>(chunk_count * range_id / range_count);
+}
+
+/*
+Assign a group id to each key in keys_per_chunk by grouping consecutive ranges of chunks into separate group tables in
+parallel. Afterwards, the groups of all ranges are inserted into a single table in the order of the ranges and the
+range-local group ids are replaced. Thus, the group ids follow the order in which the groups first appear in the
+input, just as if a single table was filled from all rows. make_group_table creates an empty AggregateGroupTable or
+DenseAggregateGroupTable. As every range may see every group, this is meant for few groups.
+*/
+template <typename AggregateKey, typename MakeGroupTable>
+AggregateGroups group_aggregate_keys_in_ranges(const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                               const size_t range_count, const MakeGroupTable& make_group_table) {
+  const auto chunk_count = keys_per_chunk.size();
+
+  auto groups = AggregateGroups{};
+  groups.group_ids_per_chunk.resize(chunk_count);
+
+  // For each range, the first row of each of its groups, in the order of the range-local group ids
+  auto row_ids_per_range = std::vector<std::vector<RowID>>(range_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(std::max(range_count, chunk_count));
+
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+      auto group_table = make_group_table();
+      auto& range_row_ids = row_ids_per_range[range_id];
+
+      const auto range_end = aggregate_chunk_range_begin(chunk_count, range_count, range_id + 1);
+      for (auto chunk_id = aggregate_chunk_range_begin(chunk_count, range_count, range_id); chunk_id < range_end;
+           ++chunk_id) {
+        const auto& keys = keys_per_chunk[chunk_id];
+        auto& group_ids = groups.group_ids_per_chunk[chunk_id];
+        group_ids.resize(keys.size());
+
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+          const auto [group_id, inserted] = group_table.find_or_insert(keys[chunk_offset]);
+          group_ids[chunk_offset] = group_id;
+          if (inserted) range_row_ids.emplace_back(chunk_id, chunk_offset);
+        }
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  if (range_count == 1) {
+    groups.row_ids = std::move(row_ids_per_range.front());
+    return groups;
+  }
+
+  /**
+   * MERGING
+   * The first row of each range-local group holds the group's key. As the first range is merged first, its local
+   * group ids equal the global ones and do not need to be replaced.
+   */
+  auto group_table = make_group_table();
+  auto global_group_ids_per_range = std::vector<std::vector<AggregateResultId>>(range_count);
+
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    auto& global_group_ids = global_group_ids_per_range[range_id];
+    global_group_ids.reserve(row_ids_per_range[range_id].size());
+
+    for (const auto& row_id : row_ids_per_range[range_id]) {
+      const auto [group_id, inserted] =
+          group_table.find_or_insert(keys_per_chunk[row_id.chunk_id][row_id.chunk_offset]);
+      global_group_ids.emplace_back(group_id);
+      if (inserted) groups.row_ids.emplace_back(row_id);
+    }
+  }
+
+  for (auto range_id = size_t{1}; range_id < range_count; ++range_id) {
+    const auto range_end = aggregate_chunk_range_begin(chunk_count, range_count, range_id + 1);
+    for (auto chunk_id = aggregate_chunk_range_begin(chunk_count, range_count, range_id); chunk_id < range_end;
+         ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, range_id, chunk_id]() {
+        const auto& global_group_ids = global_group_ids_per_range[range_id];
+        for (auto& group_id : groups.group_ids_per_chunk[chunk_id]) {
+          group_id = global_group_ids[group_id];
+        }
+      }));
+      jobs.back()->schedule();
+    }
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return groups;
+}
+
+/*
+Determine the number of radix bits so that the hash table of each partition can be expected to fit into the L2 cache
+(assumed to be 256 KB, as in JoinHash).
+*/
+template <typename AggregateKey>
+size_t calculate_aggregate_radix_bits(const size_t estimated_group_count) {
+  const auto l2_cache_size = 256'000;  // bytes
+
+  const auto group_table_size = static_cast<double>(estimated_group_count) *
+                                (sizeof(AggregateKey) + sizeof(AggregateResultId)) /
+                                0.7;  // fill factor, see AggregateGroupTable
+
+  const auto adaption_factor = 2.0;  // don't occupy the whole L2 cache
+  const auto cluster_count = std::max(1.0, (adaption_factor * group_table_size) / l2_cache_size);
+
+  return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+}
+
+/*
+Assign a group id to each AggregateKey in keys_per_chunk. With radix_bits == 0, no partitioning takes place and the
+group ids follow the order in which the groups first appear in the input.
+*/
+template <typename AggregateKey>
+AggregateGroups group_aggregate_keys(const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     const size_t estimated_group_count, const size_t radix_bits) {
+  const auto chunk_count = keys_per_chunk.size();
+
+  if (radix_bits == 0) {
+    return group_aggregate_keys_in_ranges(keys_per_chunk, aggregate_chunk_range_count(chunk_count), [&]() {
+      return AggregateGroupTable<AggregateKey>{estimated_group_count};
+    });
+  }
+
+  auto groups = AggregateGroups{};
+  groups.group_ids_per_chunk.resize(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    groups.group_ids_per_chunk[chunk_id].resize(keys_per_chunk[chunk_id].size());
+  }
+
+  /**
+   * PARTITIONING
+   * Materialize the keys together with their RowIndexes into a RadixContainer (one "partition" per chunk, just like
+   * materialize_input() in JoinHash) and let partition_radix_parallel() cluster them.
+   */
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto mask = partition_count - 1;
+
+  auto chunk_offsets = std::vector<size_t>(chunk_count);
+  auto row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_offsets[chunk_id] = row_count;
+    row_count += keys_per_chunk[chunk_id].size();
+  }
+  Assert(row_count < INVALID_ROW_INDEX, "Too many rows to be addressed by RowIndexes");
+
+  auto materialized = RadixContainer<AggregateKey>{std::make_shared<Partition<AggregateKey>>(row_count),
+                                                   std::vector<size_t>{row_count},
+                                                   std::make_shared<std::vector<bool>>()};
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& keys = keys_per_chunk[chunk_id];
+      auto& elements = *materialized.elements;
+      auto histogram = std::vector<size_t>(partition_count);
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+        const auto& key = keys[chunk_offset];
+        const auto row_index = chunk_offsets[chunk_id] + chunk_offset;
+        elements[row_index] = PartitionedElement<AggregateKey>{static_cast<RowIndex>(row_index), key};
+        ++histogram[std::hash<AggregateKey>{}(key) & mask];
+      }
+
+      histograms[chunk_id] = std::move(histogram);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  const auto partitioned =
+      partition_radix_parallel<AggregateKey, AggregateKey, false>(materialized, chunk_offsets, histograms, radix_bits);
+  materialized = RadixContainer<AggregateKey>{};
+
+  /**
+   * GROUPING
+   * Each partition is grouped independently. As equal keys end up in the same partition, the groups of different
+   * partitions are disjoint. Within a partition, the elements keep their input order.
+   */
+  auto row_ids_per_partition = std::vector<std::vector<RowID>>(partition_count);
+  auto local_group_ids = std::vector<AggregateResultId>(row_count);
+  const auto estimated_group_count_per_partition = estimated_group_count / partition_count + 1;
+
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto partition_begin = partition_id == 0 ? size_t{0} : partitioned.partition_offsets[partition_id - 1];
+    const auto partition_end = partitioned.partition_offsets[partition_id];
+    if (partition_begin == partition_end) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id, partition_begin, partition_end]() {
+      const auto& elements = *partitioned.elements;
+      auto& partition_row_ids = row_ids_per_partition[partition_id];
+      auto row_id_decoder = RowIDDecoder{chunk_offsets};
+
+      auto group_table = AggregateGroupTable<AggregateKey>{
+          std::min(partition_end - partition_begin, estimated_group_count_per_partition)};
+
+      for (auto element_id = partition_begin; element_id < partition_end; ++element_id) {
+        const auto& element = elements[element_id];
+        const auto [group_id, inserted] = group_table.find_or_insert(element.value);
+        local_group_ids[element_id] = group_id;
+        if (inserted) partition_row_ids.emplace_back(row_id_decoder.decode(element.row_index));
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  /**
+   * CONCATENATION
+   * Offset the group ids of each partition by the number of groups in all previous partitions and scatter them back
+   * to the positions of the input rows.
+   */
+  auto group_id_offsets = std::vector<AggregateResultId>(partition_count);
+  auto group_count = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    group_id_offsets[partition_id] = group_count;
+    group_count += row_ids_per_partition[partition_id].size();
+  }
+
+  groups.row_ids.reserve(group_count);
+  for (const auto& partition_row_ids : row_ids_per_partition) {
+    groups.row_ids.insert(groups.row_ids.end(), partition_row_ids.begin(), partition_row_ids.end());
+  }
+
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto partition_begin = partition_id == 0 ? size_t{0} : partitioned.partition_offsets[partition_id - 1];
+    const auto partition_end = partitioned.partition_offsets[partition_id];
+    if (partition_begin == partition_end) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id, partition_begin, partition_end]() {
+      const auto& elements = *partitioned.elements;
+      const auto group_id_offset = group_id_offsets[partition_id];
+      auto row_id_decoder = RowIDDecoder{chunk_offsets};
+
+      // Each input row belongs to exactly one partition, so the tasks write to disjoint positions
+      for (auto element_id = partition_begin; element_id < partition_end; ++element_id) {
+        const auto row_id = row_id_decoder.decode(elements[element_id].row_index);
+        groups.group_ids_per_chunk[row_id.chunk_id][row_id.chunk_offset] =
+            group_id_offset + local_group_ids[element_id];
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return groups;
+}
+
+/*
+Assign a group id to each key in keys_per_chunk, where all keys are known to be smaller than key_domain_size (e.g.,
+because they were built from dictionary ValueIDs), using DenseAggregateGroupTables. As with group_aggregate_keys()
+without partitioning, the group ids follow the order in which the groups first appear in the input.
+*/
+inline AggregateGroups group_dense_aggregate_keys(const KeysPerChunk<AggregateKeyEntry>& keys_per_chunk,
+                                                  const size_t key_domain_size) {
+  const auto range_count = key_domain_size <= MAX_RANGED_DENSE_GROUPING_DOMAIN_SIZE
+                               ? aggregate_chunk_range_count(keys_per_chunk.size())
+                               : size_t{1};
+
+  return group_aggregate_keys_in_ranges(keys_per_chunk, range_count,
+                                        [&]() { return DenseAggregateGroupTable{key_domain_size}; });
+}
+
+}  // namespace opossum
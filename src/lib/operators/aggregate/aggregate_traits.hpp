@@ -1,5 +1,6 @@
 #pragma once
 
+#include "expression/aggregate_expression.hpp"
 #include "resolve_type.hpp"
 
 namespace opossum {
@@ -26,6 +27,13 @@ struct AggregateTraits<ColumnType, AggregateFunction::CountDistinct> {
   static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Long;
 };
 
+// APPROX_COUNT_DISTINCT on all types
+template <typename ColumnType>
+struct AggregateTraits<ColumnType, AggregateFunction::ApproxCountDistinct> {
+  typedef int64_t AggregateType;
+  static constexpr DataType AGGREGATE_DATA_TYPE = DataType::Long;
+};
+
 // MIN/MAX on all types
 template <typename ColumnType, AggregateFunction function>
 struct AggregateTraits<
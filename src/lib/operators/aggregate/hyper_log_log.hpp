@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch [1] that estimates the number of distinct values inserted into it, as used by the Aggregate
+ * operator for APPROX_COUNT_DISTINCT.
+ *
+ * The sketch uses REGISTER_COUNT one-byte registers (4 KB), which results in a standard error of 1.04 / sqrt(4096),
+ * i.e., about 1.6%. As the registers are allocated on the first insert(), empty groups do not occupy that memory.
+ * Instead of the original estimator with its linear counting correction for small cardinalities, estimate() uses the
+ * improved estimator by Ertl [2], which is unbiased over the whole range of cardinalities.
+ *
+ * [1] Flajolet, Fusy, Gandouet, Meunier: HyperLogLog: the analysis of a near-optimal cardinality estimation
+ *     algorithm, AofA 2007
+ * [2] Ertl: New cardinality estimation algorithms for HyperLogLog sketches, arXiv:1702.01284, 2017
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = size_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  explicit HyperLogLog(const PolymorphicAllocator<uint8_t>& allocator = {}) : _registers(allocator) {}
+
+  void insert(const size_t hash) {
+    if (_registers.empty()) _registers.resize(REGISTER_COUNT);
+
+    const auto mixed_hash = _mix(hash);
+    const auto register_id = static_cast<size_t>(mixed_hash >> (64 - PRECISION));
+
+    // The rank is the position of the first set bit in the remaining bits. The sentinel bit bounds it to
+    // 64 - PRECISION + 1.
+    const auto remaining_bits = (mixed_hash << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+
+    _registers[register_id] = std::max(_registers[register_id], rank);
+  }
+
+  // Afterwards, the sketch estimates the number of distinct values inserted into either of the two sketches
+  void merge(const HyperLogLog& other) {
+    if (other._registers.empty()) return;
+    if (_registers.empty()) _registers.resize(REGISTER_COUNT);
+
+    for (auto register_id = size_t{0}; register_id < REGISTER_COUNT; ++register_id) {
+      _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+    }
+  }
+
+  uint64_t estimate() const {
+    if (_registers.empty()) return 0;
+
+    // Histogram of the register values, which range from 0 to MAX_RANK
+    auto rank_counts = std::array<size_t, MAX_RANK + 1>{};
+    for (const auto rank : _registers) {
+      ++rank_counts[rank];
+    }
+
+    const auto register_count = static_cast<double>(REGISTER_COUNT);
+    if (rank_counts[0] == REGISTER_COUNT) return 0;
+
+    auto denominator = register_count * _tau(1.0 - static_cast<double>(rank_counts[MAX_RANK]) / register_count);
+    for (auto rank = MAX_RANK - 1; rank >= 1; --rank) {
+      denominator = 0.5 * (denominator + static_cast<double>(rank_counts[rank]));
+    }
+    denominator += register_count * _sigma(static_cast<double>(rank_counts[0]) / register_count);
+
+    const auto alpha = 1.0 / (2.0 * std::log(2.0));
+    return static_cast<uint64_t>(std::llround(alpha * register_count * register_count / denominator));
+  }
+
+ private:
+  static constexpr auto MAX_RANK = 64 - PRECISION + 1;
+
+  // Correction terms for registers with the minimum and maximum value, see [2]
+  static double _sigma(double x) {
+    auto y = 1.0;
+    auto z = x;
+    auto previous_z = 0.0;
+    do {
+      x *= x;
+      previous_z = z;
+      z += x * y;
+      y += y;
+    } while (z != previous_z);
+    return z;
+  }
+
+  static double _tau(double x) {
+    if (x == 0.0 || x == 1.0) return 0.0;
+
+    auto y = 1.0;
+    auto z = 1.0 - x;
+    auto previous_z = 0.0;
+    do {
+      x = std::sqrt(x);
+      previous_z = z;
+      y *= 0.5;
+      z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous_z);
+    return z / 3.0;
+  }
+
+  // std::hash is the identity for integers, but the sketch relies on uniformly distributed bits. This is the
+  // finalizer of MurmurHash3.
+  static uint64_t _mix(const size_t hash) {
+    auto mixed_hash = static_cast<uint64_t>(hash);
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xff51afd7ed558ccdULL;
+    mixed_hash ^= mixed_hash >> 33;
+    mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+    mixed_hash ^= mixed_hash >> 33;
+    return mixed_hash;
+  }
+
+  pmr_vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
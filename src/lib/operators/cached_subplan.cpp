@@ -0,0 +1,70 @@
+#include "cached_subplan.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "cache/subplan_result_cache.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+
+namespace opossum {
+
+CachedSubplan::CachedSubplan(const std::shared_ptr<AbstractLQPNode>& lqp,
+                             const std::shared_ptr<AbstractOperator>& subplan)
+    : AbstractReadOnlyOperator(OperatorType::CachedSubplan), _lqp(lqp), _subplan(subplan) {}
+
+const std::string CachedSubplan::name() const { return "CachedSubplan"; }
+
+const std::string CachedSubplan::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  return name() + separator + "(" + _subplan->description(description_mode) + ")";
+}
+
+const std::shared_ptr<AbstractOperator>& CachedSubplan::subplan() const { return _subplan; }
+
+bool CachedSubplan::cache_hit() const { return _cache_hit; }
+
+std::shared_ptr<const Table> CachedSubplan::_on_execute() {
+  // A transaction that modified data itself might see its own uncommitted changes, which must not be cached
+  const auto context = transaction_context();
+  const auto use_cache = context && !context->has_read_write_operators();
+
+  auto& cache = SubplanResultCache::get();
+  const auto lqp_hash = use_cache ? SubplanResultCache::hash(_lqp) : size_t{0};
+
+  if (use_cache) {
+    const auto cached_result = cache.try_get(_lqp, lqp_hash, context->snapshot_commit_id());
+    if (cached_result) {
+      _cache_hit = true;
+      return cached_result;
+    }
+  }
+
+  // The arena is not passed to the subplan, as a cached result would keep the arena of the statement alive
+  const auto tasks = OperatorTask::make_tasks_from_operator(_subplan, CleanupTemporaries::Yes);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  const auto result = _subplan->get_output();
+
+  // The subplan is not executed if the transaction was aborted in the meantime
+  if (use_cache && result) cache.set(_lqp, lqp_hash, context->snapshot_commit_id(), result);
+
+  return result;
+}
+
+std::shared_ptr<AbstractOperator> CachedSubplan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<CachedSubplan>(_lqp, _subplan->deep_copy());
+}
+
+void CachedSubplan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  _subplan->set_parameters(parameters);
+}
+
+void CachedSubplan::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  _subplan->set_transaction_context_recursively(transaction_context);
+}
+
+}  // namespace opossum
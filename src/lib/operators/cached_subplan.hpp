@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Operator that returns the result of a subplan from the SubplanResultCache if it is valid for the snapshot of the
+ * transaction. Otherwise, it executes the subplan and caches its result. The subplan is not an input of the operator,
+ * as its operators are not supposed to be executed on a cache hit.
+ *
+ * The LQPTranslator wraps the PQPs of cacheable uncorrelated subqueries and small aggregates into this operator (see
+ * CacheSubplanResults). Without a transaction context, the subplan is always executed.
+ */
+class CachedSubplan : public AbstractReadOnlyOperator {
+ public:
+  // @param lqp  the LQP that subplan was translated from, it must not be modified afterwards
+  CachedSubplan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<AbstractOperator>& subplan);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::shared_ptr<AbstractOperator>& subplan() const;
+
+  // Whether the result was taken from the cache. Only valid after execution.
+  bool cache_hit() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+ private:
+  const std::shared_ptr<AbstractLQPNode> _lqp;
+  const std::shared_ptr<AbstractOperator> _subplan;
+  bool _cache_hit{false};
+};
+
+}  // namespace opossum
@@ -1,13 +1,21 @@
 #include "delete.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/split_pos_list_by_chunk_id.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
@@ -19,24 +27,25 @@ Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_
 const std::string Delete::name() const { return "Delete"; }
 
 std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionContext> context) {
-  _referencing_table = input_table_left();
+  const auto referencing_table = input_table_left();
 
-  DebugAssert(_referencing_table->type() == TableType::References,
-              "_referencing_table needs to reference another table");
-  DebugAssert(_referencing_table->column_count() > 0, "_referencing_table needs columns to determine referenced table");
+  DebugAssert(referencing_table->type() == TableType::References,
+              "The referencing table needs to reference another table");
+  DebugAssert(referencing_table->column_count() > 0, "The referencing table needs columns to determine referenced table");
 
   context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
 
   _transaction_id = context->transaction_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < _referencing_table->chunk_count(); ++chunk_id) {
-    const auto chunk = _referencing_table->get_chunk(chunk_id);
+  for (ChunkID chunk_id{0}; chunk_id < referencing_table->chunk_count(); ++chunk_id) {
+    const auto chunk = referencing_table->get_chunk(chunk_id);
 
     DebugAssert(chunk->references_exactly_one_table(),
-                "All segments in _referencing_table must reference the same table");
+                "All segments in the referencing table must reference the same table");
 
     const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
     const auto pos_list = first_segment->pos_list();
+    const auto referenced_table = first_segment->referenced_table();
 
     DebugAssert(std::all_of(chunk->segments().begin(), chunk->segments().end(),
                             [&](const auto& segment) {
@@ -46,92 +55,175 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
                               // pointers is sufficient
                               return segment_pos_list == pos_list;
                             }),
-                "All segments of a Chunk in _referencing_table must have the same PosList");
-
-    for (auto row_id : *pos_list) {
-      auto referenced_chunk = first_segment->referenced_table()->get_chunk(row_id.chunk_id);
-
-      // Scope for the lock on the MVCC data
-      {
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
-
-        DebugAssert(
-            Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
-                                     mvcc_data->tids[row_id.chunk_offset], mvcc_data->begin_cids[row_id.chunk_offset],
-                                     mvcc_data->end_cids[row_id.chunk_offset]),
-            "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
-
-        // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
-        auto expected = 0u;
-        const auto success = mvcc_data->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
-
-        if (!success) {
-          // If the row has a set TID, it might be a row that our TX inserted
-          // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
-          // change this row from the initial tid
-
-          if (mvcc_data->tids[row_id.chunk_offset] == _transaction_id) {
-            // Make sure that even we don't see it anymore
-            mvcc_data->tids[row_id.chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
-          } else {
-            // the row is already locked by someone else and the transaction needs to be rolled back
-            _mark_as_failed();
-            return nullptr;
-          }
-        }
-      }
+                "All segments of a Chunk in the referencing table must have the same PosList");
+
+    if (pos_list->empty()) continue;
+
+    if (pos_list->references_single_chunk()) {
+      const auto referenced_chunk = referenced_table->get_chunk(pos_list->front().chunk_id);
+      _rows_by_chunk.emplace_back(ChunkRows{referenced_table, referenced_chunk, pos_list});
+      continue;
     }
+
+    auto sub_pos_lists = split_pos_list_by_chunk_id(pos_list, referenced_table->chunk_count());
+    for (auto referenced_chunk_id = ChunkID{0}; referenced_chunk_id < sub_pos_lists.size(); ++referenced_chunk_id) {
+      auto& row_ids = sub_pos_lists[referenced_chunk_id].row_ids;
+      if (row_ids->empty()) continue;
+
+      const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+      _rows_by_chunk.emplace_back(ChunkRows{referenced_table, referenced_chunk, std::move(row_ids)});
+    }
+  }
+
+  // Set by the first job that finds a row locked by another transaction, so that the others can stop early
+  auto failed = std::atomic_bool{false};
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(_rows_by_chunk.size());
+  for (auto& chunk_rows : _rows_by_chunk) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if (_try_lock_chunk(chunk_rows, context)) return;
+      if (!_lock_rows(chunk_rows, context, failed)) failed = true;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  if (failed) {
+    // The rollback unlocks the rows that were locked by this transaction
+    _mark_as_failed();
   }
 
   return nullptr;
 }
 
+bool Delete::_try_lock_chunk(ChunkRows& chunk_rows, const std::shared_ptr<TransactionContext>& context) const {
+  // The rows of a chunk are unique in the validated input, so that all of them are deleted if their numbers match
+  const auto& chunk = *chunk_rows.chunk;
+  if (chunk.is_mutable() || chunk_rows.row_ids->size() != chunk.size()) return false;
+
+  auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+
+  // Rows inserted after the snapshot (or by this transaction) are not visible and thus not deleted
+  if (mvcc_data->max_begin_cid > context->snapshot_commit_id()) return false;
+
+  auto expected = TransactionID{0};
+  if (!mvcc_data->chunk_tid.compare_exchange_strong(expected, _transaction_id)) return false;
+
+  // Transactions that lock rows set has_invalidated_rows before their tids. If it is not set, all of them will notice
+  // the chunk lock. Otherwise, rows that are locked already are left to _lock_rows(), which reports the conflict.
+  if (mvcc_data->has_invalidated_rows) {
+    const auto has_locked_rows = std::any_of(mvcc_data->tids.begin(), mvcc_data->tids.end(),
+                                             [](const auto& tid) { return tid.load() != 0; });
+    if (has_locked_rows) {
+      mvcc_data->chunk_tid = 0;
+      return false;
+    }
+  }
+
+  // The chunk cannot be skipped by Validate anymore
+  mvcc_data->has_invalidated_rows = true;
+  chunk_rows.is_chunk_locked = true;
+  return true;
+}
+
+bool Delete::_lock_rows(const ChunkRows& chunk_rows, const std::shared_ptr<TransactionContext>& context,
+                        const std::atomic_bool& failed) const {
+  // Number of rows ahead of the current one whose tids are prefetched
+  constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+  const auto& row_ids = *chunk_rows.row_ids;
+  auto mvcc_data = chunk_rows.chunk->get_scoped_mvcc_data_lock();
+
+  // Even if the lock fails, this chunk cannot be skipped by Validate anymore
+  mvcc_data->has_invalidated_rows = true;
+
+  for (auto row_idx = size_t{0}; row_idx < row_ids.size(); ++row_idx) {
+    // Another job ran into a conflict, the transaction will be rolled back anyway
+    if (failed.load(std::memory_order_relaxed)) return true;
+
+    if (row_idx + PREFETCH_DISTANCE < row_ids.size()) {
+      __builtin_prefetch(&mvcc_data->tids[row_ids[row_idx + PREFETCH_DISTANCE].chunk_offset], 1);
+    }
+
+    const auto chunk_offset = row_ids[row_idx].chunk_offset;
+
+    DebugAssert(
+        Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
+                                 mvcc_data->tids[chunk_offset], mvcc_data->get_begin_cid(chunk_offset),
+                                 mvcc_data->get_end_cid(chunk_offset)),
+        "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
+
+    // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
+    auto expected = 0u;
+    const auto success = mvcc_data->tids[chunk_offset].compare_exchange_strong(expected, _transaction_id);
+
+    if (!success) {
+      // If the row has a set TID, it might be a row that our TX inserted
+      // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
+      // change this row from the initial tid
+
+      if (mvcc_data->tids[chunk_offset] == _transaction_id) {
+        // Make sure that even we don't see it anymore
+        mvcc_data->tids[chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
+      } else {
+        // the row is already locked by someone else and the transaction needs to be rolled back
+        return false;
+      }
+    }
+  }
+
+  // The chunk might have been locked as a whole by another transaction, which did not see our row locks
+  const auto chunk_tid = mvcc_data->chunk_tid.load();
+  return chunk_tid == 0 || chunk_tid == _transaction_id;
+}
+
+void Delete::log_changes(WriteAheadLog::TransactionChanges& changes) const {
+  for (const auto& chunk_rows : _rows_by_chunk) {
+    changes.deleted_rows.push_back({chunk_rows.table, chunk_rows.row_ids.get()});
+  }
+}
+
 void Delete::_on_commit_records(const CommitID cid) {
-  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
-       ++referencing_chunk_id) {
-    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
-    const auto referencing_segment =
-        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
-    const auto referenced_table = referencing_segment->referenced_table();
-
-    for (const auto& row_id : *referencing_segment->pos_list()) {
-      auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
-
-      referenced_chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = cid;
-      referenced_chunk->increase_invalid_row_count(1);
-      // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+  for (const auto& chunk_rows : _rows_by_chunk) {
+    // Scope for the lock on the MVCC data
+    {
+      auto mvcc_data = chunk_rows.chunk->get_scoped_mvcc_data_lock();
+      if (chunk_rows.is_chunk_locked) {
+        // As for the rows, the chunk lock is kept
+        mvcc_data->chunk_end_cid = cid;
+      } else {
+        for (const auto& row_id : *chunk_rows.row_ids) {
+          mvcc_data->set_end_cid(row_id.chunk_offset, cid);
+          // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+        }
+      }
     }
+    chunk_rows.chunk->increase_invalid_row_count(chunk_rows.row_ids->size());
 
     // Update statistics about deleted rows
-    const auto table_statistics = referenced_table->table_statistics();
+    const auto table_statistics = chunk_rows.table->table_statistics();
     if (table_statistics) {
-      table_statistics->increase_invalid_row_count(referencing_segment->pos_list()->size());
+      table_statistics->increase_invalid_row_count(chunk_rows.row_ids->size());
     }
+
+    chunk_rows.table->update_last_modification_commit_id(cid);
   }
 }
 
 void Delete::_on_rollback_records() {
-  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
-       ++referencing_chunk_id) {
-    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
-    const auto referencing_segment =
-        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
-    const auto referenced_table = referencing_segment->referenced_table();
-
-    for (const auto& row_id : *referencing_segment->pos_list()) {
-      auto expected = _transaction_id;
-
-      auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+  for (const auto& chunk_rows : _rows_by_chunk) {
+    auto mvcc_data = chunk_rows.chunk->get_scoped_mvcc_data_lock();
 
-      // unlock all rows locked in _on_execute
-      const auto result =
-          referenced_chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset].compare_exchange_strong(expected,
-                                                                                                           0u);
+    if (chunk_rows.is_chunk_locked) {
+      mvcc_data->chunk_tid = 0;
+      continue;
+    }
 
-      // If the above operation fails, it means the row is locked by another transaction. This must have been
-      // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
-      // unlocking rows here as well.
-      if (!result) return;
+    for (const auto& row_id : *chunk_rows.row_ids) {
+      // Unlock all rows locked in _on_execute. As the chunks were locked in parallel, the rows that could not be
+      // locked are not necessarily at the end. Rows locked by other transactions keep their tid.
+      auto expected = _transaction_id;
+      mvcc_data->tids[row_id.chunk_offset].compare_exchange_strong(expected, 0u);
     }
   }
 }
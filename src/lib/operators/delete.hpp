@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "storage/chunk.hpp"
 #include "storage/pos_list.hpp"
 #include "utils/assert.hpp"
 
@@ -13,6 +15,14 @@ namespace opossum {
 /**
  * Operator that marks the rows referenced by its input table as MVCC-expired.
  * Assumption: The input has been validated before.
+ *
+ * The rows are grouped by the chunk they are stored in. Each group is locked by a separate job, which acquires the
+ * chunk's MVCC lock only once. If any row is already locked by another transaction, all jobs stop and the Delete fails.
+ *
+ * If all rows of an immutable chunk are deleted (e.g., by a TRUNCATE or because the ChunkStatistics let the TableScan
+ * forward the entire chunk), the chunk is locked and invalidated as a whole (see MvccData::chunk_tid and
+ * MvccData::chunk_end_cid) instead of row by row. Such chunks are skipped by later transactions and physically removed
+ * by the MvccDeletePlugin once no transaction can see them anymore.
  */
 class Delete : public AbstractReadWriteOperator {
  public:
@@ -20,6 +30,8 @@ class Delete : public AbstractReadWriteOperator {
 
   const std::string name() const override;
 
+  void log_changes(WriteAheadLog::TransactionChanges& changes) const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -30,7 +42,24 @@ class Delete : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  // The rows of a single chunk of a referenced table that are deleted
+  struct ChunkRows {
+    std::shared_ptr<const Table> table;
+    std::shared_ptr<const Chunk> chunk;
+    std::shared_ptr<const PosList> row_ids;
+    // Set if all rows of the chunk are deleted and the chunk was locked as a whole
+    bool is_chunk_locked{false};
+  };
+
+  // Locks the chunk as a whole if all of its rows are deleted and none of them is locked already. Returns false if the
+  // rows need to be locked one by one instead.
+  bool _try_lock_chunk(ChunkRows& chunk_rows, const std::shared_ptr<TransactionContext>& context) const;
+
+  // Locks the rows by setting their tid. Returns false if a row is already locked by another transaction.
+  bool _lock_rows(const ChunkRows& chunk_rows, const std::shared_ptr<TransactionContext>& context,
+                  const std::atomic_bool& failed) const;
+
   TransactionID _transaction_id;
-  std::shared_ptr<const Table> _referencing_table;
+  std::vector<ChunkRows> _rows_by_chunk;
 };
 }  // namespace opossum
@@ -1,34 +1,30 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
-#include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_set_operator.hpp"
 #include "types.hpp"
-#include "utils/assert.hpp"
 
 namespace opossum {
 
 /**
- * Note: Difference does not support null values at the moment
+ * Computes left EXCEPT right (SetOperationMode::Unique) or left EXCEPT ALL right (SetOperationMode::All), i.e., with
+ * SetOperationMode::All, a row that occurs n times in the left and m times in the right input occurs max(n - m, 0)
+ * times in the output. See AbstractSetOperator for the algorithm.
  */
-class Difference : public AbstractReadOnlyOperator {
+class Difference : public AbstractSetOperator {
  public:
   Difference(const std::shared_ptr<const AbstractOperator>& left_in,
-             const std::shared_ptr<const AbstractOperator>& right_in);
+             const std::shared_ptr<const AbstractOperator>& right_in,
+             const SetOperationMode mode = SetOperationMode::All);
 
   const std::string name() const override;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
-  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
-
- private:
-  void _append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant& value);
+  bool _keep_row(const size_t left_occurrence, const size_t right_count) const override;
 };
 }  // namespace opossum
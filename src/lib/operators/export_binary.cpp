@@ -1,18 +1,40 @@
 #include "export_binary.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
 #include "import_export/binary.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/block_min_max_filter.hpp"
+#include "statistics/chunk_statistics/blocked_bloom_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/range_filter.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -23,11 +45,11 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the stream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& stream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the string are
+/* Writes the given strings to the stream. First an array of string lengths is written. After that the string are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
@@ -35,7 +57,7 @@ void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values)
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
 template <typename Alloc>
-void export_string_values(std::ofstream& ofstream, const std::vector<pmr_string, Alloc>& values) {
+void export_string_values(std::ostream& stream, const std::vector<pmr_string, Alloc>& values) {
   std::vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -45,7 +67,7 @@ void export_string_values(std::ofstream& ofstream, const std::vector<pmr_string,
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(stream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -58,60 +80,214 @@ void export_string_values(std::ofstream& ofstream, const std::vector<pmr_string,
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(stream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& stream, const std::vector<T, Alloc>& values) {
+  stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& stream, const pmr_vector<pmr_string>& values) {
+  export_string_values(stream, values);
 }
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& stream, const std::vector<pmr_string>& values) {
+  export_string_values(stream, values);
 }
 
-// specialized implementation for bool values
+// Writes one byte per NULL flag, as the bitmap of the NullValueVector is not part of the binary format
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
+void export_values(std::ostream& stream, const std::vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(stream, writable_bools);
 }
 
 template <typename T>
-void export_values(std::ofstream& ofstream, const pmr_concurrent_vector<T>& values) {
+void export_values(std::ostream& stream, const pmr_concurrent_vector<T>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<T>{values.begin(), values.end()};
-  ofstream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
+  stream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_concurrent_vector<pmr_string>& values) {
+void export_values(std::ostream& stream, const pmr_concurrent_vector<pmr_string>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<pmr_string>{values.begin(), values.end()};
-  export_string_values(ofstream, value_block);
+  export_string_values(stream, value_block);
 }
 
-// specialized implementation for bool values
-template <>
-void export_values(std::ofstream& ofstream, const pmr_concurrent_vector<bool>& values) {
+// Writes one byte per NULL flag, as the bitmap of the NullValueVector is not part of the binary format
+void export_values(std::ostream& stream, const NullValueVector& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(stream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Writes a shallow copy of the given value to the stream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
+
+// Writes the column statistics in the format described at ExportBinary::_write_statistics()
+template <typename T>
+void export_column_statistics(std::ostream& stream, const ColumnStatistics<T>& column_statistics) {
+  export_value(stream, column_statistics.null_value_ratio());
+  export_value(stream, column_statistics.distinct_count());
+  export_values(stream, std::vector<T>{column_statistics.min(), column_statistics.max()});
+
+  const auto& histogram = column_statistics.histogram();
+  if (!histogram) {
+    export_value(stream, uint32_t{0});
+    return;
+  }
+
+  const auto& bin_data = histogram->bin_data();
+  export_value(stream, static_cast<uint32_t>(histogram->bin_count()));
+  export_values(stream, bin_data.bin_minima);
+  export_values(stream, bin_data.bin_maxima);
+  export_values(stream, bin_data.bin_heights);
+  export_values(stream, bin_data.bin_distinct_counts);
+}
+
+// Only the filters that SegmentStatistics::build_statistics() creates are written
+template <typename T>
+std::optional<BinaryFilterType> binary_filter_type(const AbstractFilter& filter) {
+  if (dynamic_cast<const MinMaxFilter<T>*>(&filter)) return BinaryFilterType::min_max_filter;
+  if (dynamic_cast<const BlockedBloomFilter<T>*>(&filter)) return BinaryFilterType::blocked_bloom_filter;
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (dynamic_cast<const RangeFilter<T>*>(&filter)) return BinaryFilterType::range_filter;
+  }
+  return std::nullopt;
+}
+
+// Writes the segment statistics in the format described at ExportBinary::_write_statistics()
+template <typename T>
+void export_segment_statistics(std::ostream& stream, const SegmentStatistics& segment_statistics) {
+  const auto& filters = segment_statistics.filters();
+  const auto filter_count = std::count_if(filters.cbegin(), filters.cend(),
+                                          [](const auto& filter) { return binary_filter_type<T>(*filter); });
+  export_value(stream, static_cast<uint32_t>(filter_count));
+
+  for (const auto& filter : filters) {
+    const auto filter_type = binary_filter_type<T>(*filter);
+    if (!filter_type) continue;
+
+    export_value(stream, *filter_type);
+    if (*filter_type == BinaryFilterType::min_max_filter) {
+      const auto& min_max_filter = static_cast<const MinMaxFilter<T>&>(*filter);
+      export_values(stream, std::vector<T>{min_max_filter.min(), min_max_filter.max()});
+    } else if (*filter_type == BinaryFilterType::blocked_bloom_filter) {
+      const auto& blocks = static_cast<const BlockedBloomFilter<T>&>(*filter).blocks();
+      auto words = std::vector<uint32_t>{};
+      words.reserve(blocks.size() * BaseBlockedBloomFilter::WORDS_PER_BLOCK);
+      for (const auto& block : blocks) {
+        words.insert(words.end(), block.words.cbegin(), block.words.cend());
+      }
+      export_value(stream, static_cast<uint32_t>(blocks.size()));
+      export_values(stream, words);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+      const auto& ranges = static_cast<const RangeFilter<T>&>(*filter).ranges();
+      auto minima = std::vector<T>{};
+      auto maxima = std::vector<T>{};
+      minima.reserve(ranges.size());
+      maxima.reserve(ranges.size());
+      for (const auto& [min, max] : ranges) {
+        minima.emplace_back(min);
+        maxima.emplace_back(max);
+      }
+      export_value(stream, static_cast<uint32_t>(ranges.size()));
+      export_values(stream, minima);
+      export_values(stream, maxima);
+    }
+  }
+
+  const auto block_min_max_filter =
+      std::dynamic_pointer_cast<const BlockMinMaxFilter<T>>(segment_statistics.block_min_max_filter());
+  export_value(stream, static_cast<BoolAsByteType>(block_min_max_filter != nullptr));
+  if (!block_min_max_filter) return;
+
+  const auto& block_ranges = block_min_max_filter->block_ranges();
+  auto blocks_are_not_null = std::vector<bool>(block_ranges.size());
+  auto minima = std::vector<T>{};
+  auto maxima = std::vector<T>{};
+  for (auto block_index = size_t{0}; block_index < block_ranges.size(); ++block_index) {
+    const auto& block_range = block_ranges[block_index];
+    if (!block_range) continue;
+    blocks_are_not_null[block_index] = true;
+    minima.emplace_back(block_range->first);
+    maxima.emplace_back(block_range->second);
+  }
+
+  export_value(stream, block_min_max_filter->segment_size());
+  export_value(stream, static_cast<uint32_t>(block_ranges.size()));
+  export_values(stream, blocks_are_not_null);
+  export_values(stream, minima);
+  export_values(stream, maxima);
+}
+// Returns the rows of the chunk that are visible to the transaction as a chunk of ValueSegments, or nullptr if all
+// rows are visible and the chunk can be written as it is
+std::shared_ptr<Chunk> materialize_visible_rows(const Table& table, const ChunkID chunk_id,
+                                                const TransactionContext& transaction_context) {
+  const auto& chunk = *table.get_chunk(chunk_id);
+  const auto snapshot_commit_id = transaction_context.snapshot_commit_id();
+  if (Validate::is_entire_chunk_visible(chunk, snapshot_commit_id)) {
+    const auto segments = chunk.segments();
+    const auto is_supported = std::all_of(segments.cbegin(), segments.cend(), [](const auto& segment) {
+      return ExportBinary::supports_segment(*segment);
+    });
+    if (is_supported) return nullptr;
+  }
+
+  // Rows appended concurrently are not visible to the transaction, so that the chunk's size is determined once
+  const auto row_count = chunk.size();
+  const auto visible_rows = std::make_shared<PosList>();
+  visible_rows->reserve(row_count);
+  {
+    const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+    const auto our_tid = transaction_context.transaction_id();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data->get_tid(chunk_offset),
+                                   mvcc_data->get_begin_cid(chunk_offset), mvcc_data->get_end_cid(chunk_offset))) {
+        visible_rows->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+  }
+  visible_rows->guarantee_single_chunk();
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto nullable = table.column_is_nullable(column_id);
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>{};
+      auto null_values = NullValueVector{};
+      values.reserve(visible_rows->size());
+      if (nullable) null_values.reserve(visible_rows->size());
+
+      segment_iterate_filtered<ColumnDataType>(*chunk.get_segment(column_id), visible_rows, [&](const auto& position) {
+        values.push_back(position.value());
+        if (nullable) null_values.push_back(position.is_null());
+      });
+
+      if (nullable) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+  return std::make_shared<Chunk>(segments);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -126,9 +302,91 @@ void ExportBinary::write_binary(const Table& table, const std::string& filename)
 
   _write_header(table, ofstream);
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  // The chunks are serialized into buffers concurrently and written to the file in order. To bound the memory needed
+  // for the buffers, this happens in batches of one chunk per CPU.
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto batch_size = std::max(size_t{1}, Topology::get().num_cpus());
+  auto chunk_offsets = std::vector<uint64_t>{};
+  chunk_offsets.reserve(chunk_count + 1);
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    auto buffers = std::vector<std::string>(batch_end - batch_begin);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto stream = std::ostringstream{};
+        _write_chunk(table, stream, ChunkID{static_cast<ChunkID::base_type>(chunk_id)});
+        buffers[chunk_id - batch_begin] = stream.str();
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (const auto& buffer : buffers) {
+      chunk_offsets.emplace_back(ofstream.tellp());
+      ofstream.write(buffer.data(), buffer.size());
+    }
   }
+  chunk_offsets.emplace_back(ofstream.tellp());
+
+  if (table.table_statistics()) _write_statistics(table, ofstream);
+  _write_chunk_index(chunk_offsets, ofstream);
+}
+
+void ExportBinary::write_binary_snapshot(const Table& table, const std::string& filename,
+                                         const TransactionContext& transaction_context) {
+  Assert(table.has_mvcc() == UseMvcc::Yes, "Snapshots can only be exported from tables with MVCC data");
+
+  std::ofstream ofstream;
+  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  ofstream.open(filename, std::ios::binary);
+
+  _write_header(table, ofstream);
+
+  // As in write_binary(), the chunks are validated and serialized concurrently in batches of one chunk per CPU
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto batch_size = std::max(size_t{1}, Topology::get().num_cpus());
+  auto chunk_offsets = std::vector<uint64_t>{};
+  chunk_offsets.reserve(chunk_count + 1);
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    // Buffers of skipped chunks stay empty
+    auto buffers = std::vector<std::string>(batch_end - batch_begin);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        // Chunks might have been removed physically after all of their rows were deleted
+        const auto typed_chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_id)};
+        const auto chunk = table.get_chunk(typed_chunk_id);
+        if (!chunk) return;
+
+        const auto materialized_chunk = materialize_visible_rows(table, typed_chunk_id, transaction_context);
+        if (materialized_chunk && materialized_chunk->size() == 0) return;
+
+        auto stream = std::ostringstream{};
+        write_chunk(materialized_chunk ? *materialized_chunk : *chunk, table.column_definitions(), stream);
+        buffers[chunk_id - batch_begin] = stream.str();
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (const auto& buffer : buffers) {
+      if (buffer.empty()) continue;
+      chunk_offsets.emplace_back(ofstream.tellp());
+      ofstream.write(buffer.data(), buffer.size());
+    }
+  }
+  chunk_offsets.emplace_back(ofstream.tellp());
+  _write_chunk_index(chunk_offsets, ofstream);
+
+  // The chunk count in the header follows the chunk size (see _write_header())
+  ofstream.seekp(sizeof(ChunkOffset));
+  export_value(ofstream, static_cast<ChunkID::base_type>(chunk_offsets.size() - 1));
 }
 
 const std::string ExportBinary::name() const { return "ExportBinary"; }
@@ -146,10 +404,10 @@ std::shared_ptr<AbstractOperator> ExportBinary::_on_deep_copy(
 
 void ExportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
-  export_value(ofstream, static_cast<ChunkOffset>(table.max_chunk_size()));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+void ExportBinary::_write_header(const Table& table, std::ostream& stream) {
+  export_value(stream, static_cast<ChunkOffset>(table.max_chunk_size()));
+  export_value(stream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(stream, static_cast<ColumnID::base_type>(table.column_count()));
 
   std::vector<pmr_string> column_types(table.column_count());
   std::vector<pmr_string> column_names(table.column_count());
@@ -161,41 +419,93 @@ void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(stream, column_types);
+  export_values(stream, columns_are_nullable);
+  export_string_values(stream, column_names);
+}
+
+void ExportBinary::_write_chunk(const Table& table, std::ostream& stream, const ChunkID& chunk_id) {
+  write_chunk(*table.get_chunk(chunk_id), table.column_definitions(), stream);
 }
 
-void ExportBinary::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
-  const auto chunk = table.get_chunk(chunk_id);
-  const auto context = std::make_shared<ExportContext>(ofstream);
+void ExportBinary::write_chunk(const Chunk& chunk, const TableColumnDefinitions& column_definitions,
+                               std::ostream& stream) {
+  const auto context = std::make_shared<ExportContext>(stream);
 
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(stream, static_cast<ChunkOffset>(chunk.size()));
 
   // Iterating over all segments of this chunk and exporting them
-  for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
-    auto visitor =
-        make_unique_by_data_type<AbstractSegmentVisitor, ExportBinaryVisitor>(table.column_data_type(column_id));
-    resolve_data_and_segment_type(*chunk->get_segment(column_id),
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); column_id++) {
+    auto visitor = make_unique_by_data_type<AbstractSegmentVisitor, ExportBinaryVisitor>(
+        column_definitions[column_id].data_type);
+    resolve_data_and_segment_type(*chunk.get_segment(column_id),
                                   [&](const auto data_type_t, const auto& resolved_segment) {
                                     visitor->handle_segment(resolved_segment, context);
                                   });
   }
 }
 
+void ExportBinary::_write_chunk_index(const std::vector<uint64_t>& chunk_offsets, std::ostream& stream) {
+  export_values(stream, chunk_offsets);
+  export_value(stream, BINARY_CHUNK_INDEX_MAGIC);
+}
+
+void ExportBinary::_write_statistics(const Table& table, std::ostream& stream) {
+  const auto table_statistics = table.table_statistics();
+  export_value(stream, table_statistics->row_count());
+
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      export_column_statistics(stream, static_cast<const ColumnStatistics<ColumnDataType>&>(
+                                           *table_statistics->column_statistics()[column_id]));
+    });
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk_statistics = table.get_chunk(chunk_id)->statistics();
+    export_value(stream, static_cast<BoolAsByteType>(chunk_statistics != nullptr));
+    if (!chunk_statistics) continue;
+
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        export_segment_statistics<ColumnDataType>(stream, *chunk_statistics->statistics()[column_id]);
+      });
+    }
+  }
+}
+
+bool ExportBinary::supports_segment(const BaseSegment& segment) {
+  if (dynamic_cast<const BaseValueSegment*>(&segment)) return true;
+
+  const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+  if (!encoded_segment) return false;
+
+  switch (encoded_segment->encoding_type()) {
+    case EncodingType::Dictionary:
+      return encoded_segment->compressed_vector_type() &&
+             is_fixed_size_byte_aligned(*encoded_segment->compressed_vector_type());
+    case EncodingType::Delta:
+      return segment.data_type() == DataType::Int || segment.data_type() == DataType::Long;
+    default:
+      return false;
+  }
+}
+
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseValueSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<ExportContext>(base_context);
   const auto& segment = static_cast<const ValueSegment<T>&>(base_segment);
 
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->stream, BinarySegmentType::value_segment);
 
   if (segment.is_nullable()) {
-    export_values(context->ofstream, segment.null_values());
+    export_values(context->stream, segment.null_values());
   }
 
-  export_values(context->ofstream, segment.values());
+  export_values(context->stream, segment.values());
 }
 
 template <typename T>
@@ -204,12 +514,12 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const ReferenceSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->stream, BinarySegmentType::value_segment);
 
   // Unfortunately, we have to iterate over all values of the reference segment
   // to materialize its contents. Then we can write them to the file
   for (ChunkOffset row = 0; row < ref_segment.size(); ++row) {
-    export_value(context->ofstream, type_cast_variant<T>(ref_segment[row]));
+    export_value(context->stream, type_cast_variant<T>(ref_segment[row]));
   }
 }
 
@@ -220,7 +530,7 @@ void ExportBinary::ExportBinaryVisitor<pmr_string>::handle_segment(
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->stream, BinarySegmentType::value_segment);
 
   // If there is no data, we can skip all of the coming steps.
   if (ref_segment.size() == 0) return;
@@ -236,8 +546,8 @@ void ExportBinary::ExportBinaryVisitor<pmr_string>::handle_segment(
     values << value;
   }
 
-  export_values(context->ofstream, string_lengths);
-  context->ofstream << values.rdbuf();
+  export_values(context->stream, string_lengths);
+  context->stream << values.rdbuf();
 }
 
 template <typename T>
@@ -250,7 +560,7 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
   Assert(is_fixed_size_byte_aligned(*base_segment.compressed_vector_type()),
          "Does only support fixed-size byte-aligned compressed attribute vectors.");
 
-  export_value(context->ofstream, BinarySegmentType::dictionary_segment);
+  export_value(context->stream, BinarySegmentType::dictionary_segment);
 
   const auto attribute_vector_width = [&]() {
     Assert(base_segment.compressed_vector_type(),
@@ -268,47 +578,89 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
   }();
 
   // Write attribute vector width
-  export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
+  export_value(context->stream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
 
   if (base_segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(base_segment);
 
     // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_value(context->stream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
+    export_values(context->stream, *segment.dictionary());
+  } else if (base_segment.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& segment = static_cast<const FrontCodedDictionarySegment<pmr_string>&>(base_segment);
+
+    // The dictionary is decoded and written like that of a DictionarySegment
+    export_value(context->stream, static_cast<ValueID::base_type>(segment.unique_values_count()));
+    export_values(context->stream, *segment.dictionary());
   } else {
     const auto& segment = static_cast<const DictionarySegment<T>&>(base_segment);
 
     // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_value(context->stream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
+    export_values(context->stream, *segment.dictionary());
   }
 
   // Write attribute vector
   Assert(base_segment.compressed_vector_type(),
          "Expected DictionarySegment to use vector compression for attribute vector");
-  _export_attribute_vector(context->ofstream, *base_segment.compressed_vector_type(), *base_segment.attribute_vector());
+  _export_attribute_vector(context->stream, *base_segment.compressed_vector_type(), *base_segment.attribute_vector());
 }
 
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseEncodedSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (base_segment.encoding_type() == EncodingType::Delta) {
+      auto context = std::static_pointer_cast<ExportContext>(base_context);
+      const auto& segment = static_cast<const DeltaSegment<T>&>(base_segment);
+
+      export_value(context->stream, BinarySegmentType::delta_segment);
+
+      // The deltas are written with the smallest sufficient width, independent of the segment's vector compression
+      auto deltas = std::vector<uint32_t>{};
+      resolve_compressed_vector_type(segment.deltas(), [&](const auto& vector) {
+        deltas = std::vector<uint32_t>(vector.cbegin(), vector.cend());
+      });
+      const auto max_delta = deltas.empty() ? uint32_t{0} : *std::max_element(deltas.cbegin(), deltas.cend());
+      const auto delta_vector_width = max_delta <= std::numeric_limits<uint8_t>::max()    ? 1u
+                                      : max_delta <= std::numeric_limits<uint16_t>::max() ? 2u
+                                                                                          : 4u;
+
+      export_value(context->stream, static_cast<AttributeVectorWidth>(delta_vector_width));
+      export_values(context->stream, segment.block_checkpoints());
+      export_values(context->stream,
+                    std::vector<BoolAsByteType>(segment.null_values().cbegin(), segment.null_values().cend()));
+
+      switch (delta_vector_width) {
+        case 1u:
+          export_values(context->stream, std::vector<uint8_t>(deltas.cbegin(), deltas.cend()));
+          return;
+        case 2u:
+          export_values(context->stream, std::vector<uint16_t>(deltas.cbegin(), deltas.cend()));
+          return;
+        default:
+          export_values(context->stream, deltas);
+          return;
+      }
+    }
+  }
+
   Fail("Binary export not implemented yet for encoded segments.");
 }
 
 template <typename T>
-void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstream& ofstream,
+void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ostream& stream,
                                                                     const CompressedVectorType type,
                                                                     const BaseCompressedVector& attribute_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
       return;
     default:
       Fail("Any other type should have been caught before.");
@@ -8,15 +8,20 @@
 #include "import_export/binary.hpp"
 #include "storage/abstract_segment_visitor.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/table_column_definition.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 class BaseCompressedVector;
+class Chunk;
+class TransactionContext;
 enum class CompressedVectorType : uint8_t;
 
 /**
+ * Writes a table into a binary file that can be read by ImportBinary. The chunks are serialized concurrently.
+ *
  * Note: ExportBinary does not support null values at the moment
  */
 class ExportBinary : public AbstractReadOnlyOperator {
@@ -25,6 +30,23 @@ class ExportBinary : public AbstractReadOnlyOperator {
 
   static void write_binary(const Table& table, const std::string& filename);
 
+  /**
+   * Writes the rows of @param table that are visible to @param transaction_context, applying the same rules as
+   * Validate. Thus, the file holds a transactionally consistent snapshot of the table even if the table is modified
+   * concurrently, and writers are not blocked. Entirely visible chunks are written as they are, the visible rows of
+   * all other chunks are materialized into ValueSegments. Chunks without visible rows are skipped. The table's
+   * statistics are not written, as they do not describe the snapshot.
+   */
+  static void write_binary_snapshot(const Table& table, const std::string& filename,
+                                    const TransactionContext& transaction_context);
+
+  // Writes a single chunk in the format described at _write_chunk(). ImportBinary::read_chunk() reads it back.
+  static void write_chunk(const Chunk& chunk, const TableColumnDefinitions& column_definitions, std::ostream& stream);
+
+  // Returns whether the binary format can represent the segment. This is the case for ValueSegments, DeltaSegments, and
+  // DictionarySegments with fixed-size byte-aligned attribute vectors.
+  static bool supports_segment(const BaseSegment& segment);
+
   /**
    * Executes the export operator
    * @return The table that was also the input
@@ -47,7 +69,7 @@ class ExportBinary : public AbstractReadOnlyOperator {
   const std::string _filename;
 
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given stream.
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
@@ -60,12 +82,12 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    * @param table The table that is to be exported
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& stream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given stream.
    * First, it creates a chunk header with the following contents:
    *
    * Description           | Type                                  | Size in bytes
@@ -76,18 +98,83 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * of the segment, such as ReferenceSegment, DictionarySegment, ValueSegment).
    *
    * @param table The table we are currently exporting
-   * @param ofstream The output stream to write to
+   * @param stream The output stream to write to
    * @param chunkId The id of the chunk that is to be worked on now
    *
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const Table& table, std::ostream& stream, const ChunkID& chunk_id);
+
+  /**
+   * Writes the statistics of the table and of its chunks behind the last chunk, so that they do not have to be
+   * generated again when the table is imported. This section is only written if the table has TableStatistics (i.e.,
+   * usually once it was added to the StorageManager). It has the following contents:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Row count             | float                                 |   4
+   * Column statistics     | see below                             |   Column count * variable
+   * Chunk statistics      | see below                             |   Chunk count * variable
+   *
+   * The statistics of each column are written as follows:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Null value ratio      | float                                 |   4
+   * Distinct count        | float                                 |   4
+   * Min and max°          | T (int, float, double, long)          |   2 * sizeof(T)
+   * Min and max^          | Two lengths and strings               |   2 * 8 + length of min and max
+   * Bin count             | uint32_t                              |   4
+   * Bin minima            | T (strings as above)                  |   bin count * sizeof(T)
+   * Bin maxima            | T (strings as above)                  |   bin count * sizeof(T)
+   * Bin heights           | HistogramCountType                    |   bin count * 4
+   * Bin distinct counts   | HistogramCountType                    |   bin count * 4
+   *
+   * The bin count is zero if the column statistics have no histogram.
+   *
+   * The statistics of each chunk consist of a flag whether the chunk has ChunkStatistics and, if so, the statistics of
+   * each of its segments:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Filter count          | uint32_t                              |   4
+   * Filters               | BinaryFilterType and the filter       |   Filter count * variable
+   * Has block filter      | bool (stored as BoolAsByteType)       |   1
+   * Segment size'         | ChunkOffset                           |   4
+   * Block count'          | uint32_t                              |   4
+   * Block is not NULL'    | bool (stored as BoolAsByteType)       |   Block count * 1
+   * Block minima'         | T (strings as above)                  |   Non-NULL block count * sizeof(T)
+   * Block maxima'         | T (strings as above)                  |   Non-NULL block count * sizeof(T)
+   *
+   * A MinMaxFilter stores its min and max, a RangeFilter the number of its ranges followed by their minima and maxima.
+   * A BlockedBloomFilter stores the number of its blocks followed by their words (uint32_t). As the filter is built on
+   * std::hash, files with BlockedBloomFilters are only portable between builds with the same standard library. Other
+   * filters are not written.
+   *
+   * ': These fields are only written if the segment has a BlockMinMaxFilter.
+   */
+  static void _write_statistics(const Table& table, std::ostream& stream);
+
+  /**
+   * Writes the index of the chunks to the end of the file, so that ImportBinary can decode the chunks concurrently
+   * without scanning the file for their beginnings first. As the index is written last, the exporter does not need to
+   * know the sizes of the serialized chunks in advance.
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Chunk offsets         | uint64_t array                        |   (Chunk count + 1) * 8
+   * Magic number          | uint64_t (BINARY_CHUNK_INDEX_MAGIC)   |   8
+   *
+   * The chunk offsets are the file positions at which the chunks begin, followed by the position behind the last
+   * chunk, where the statistics begin if there are any.
+   */
+  static void _write_chunk_index(const std::vector<uint64_t>& chunk_offsets, std::ostream& stream);
 
   template <typename T>
   class ExportBinaryVisitor;
 
   struct ExportContext : SegmentVisitorContext {
-    explicit ExportContext(std::ofstream& ofstream) : ofstream(ofstream) {}
-    std::ofstream& ofstream;
+    explicit ExportContext(std::ostream& stream) : stream(stream) {}
+    std::ostream& stream;
   };
 };
 
@@ -112,7 +199,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the output stream.
    *
    */
   void handle_segment(const BaseValueSegment& base_segment, std::shared_ptr<SegmentVisitorContext> base_context) final;
@@ -134,7 +221,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the output stream.
    */
   void handle_segment(const ReferenceSegment& ref_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -159,17 +246,33 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is written if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the output stream.
    */
   void handle_segment(const BaseDictionarySegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
+  /**
+   * Delta Segments are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Width of delta v.     | AttributeVectorWidth                  |   1
+   * Block checkpoints     | T (int, long)                         |   ceil(rows / block size) * sizeof(T)
+   * Null Values           | vector<bool> (BoolAsByteType)         |   rows * 1
+   * Delta v. values       | uintX                                 |   rows * width of delta v.
+   *
+   * Other encoded segments are not supported yet.
+   *
+   * @param base_segment The segment to export
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the output stream.
+   */
   void handle_segment(const BaseEncodedSegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
  private:
   // Chooses the right FixedSizeByteAlignedVector depending on the attribute_vector_width and exports it.
-  static void _export_attribute_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  static void _export_attribute_vector(std::ostream& stream, const CompressedVectorType type,
                                        const BaseCompressedVector& attribute_vector);
 };
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "export_csv.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,11 +10,15 @@
 
 #include "import_export/csv_meta.hpp"
 #include "import_export/csv_writer.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/materialize.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
+#include "utils/logical_data_types.hpp"
 
 namespace opossum {
 
@@ -71,28 +76,40 @@ void ExportCsv::_generate_content_file(const std::shared_ptr<const Table>& table
   CsvWriter writer(csv_file);
 
   /**
-   * Multiple rows containing the values of each respective row are written.
-   * Therefore we first iterate through the chunks, then through the rows
-   * in the chunks and afterwards through the segments of the chunks.
-   *
-   * This is a lot of iterating, but to convert a column-based table to
-   * a row-based representation takes some effort.
+   * The chunks are formatted in parallel and written in order. To bound the memory used by the formatted chunks, at
+   * most max_formatted_chunk_count chunks are formatted ahead of the chunk that is written next.
    */
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-
-    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
-      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-        const auto segment = chunk->get_segment(column_id);
-
-        // The previous implementation did a double dispatch (at least two virtual method calls)
-        // So the subscript operator cannot be much slower.
-        const auto value = (*segment)[chunk_offset];
-        writer.write(value);
+  const auto chunk_count = table->chunk_count();
+  const auto data_types = table->column_data_types();
+  const auto max_formatted_chunk_count = 2 * std::max(size_t{1}, Topology::get().num_cpus());
+
+  auto formatted_chunks = std::vector<std::string>(chunk_count);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(chunk_count);
+
+  const auto schedule_formatting = [&](const ChunkID chunk_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      formatted_chunks[chunk_id] = writer.format_chunk(*table->get_chunk(chunk_id), data_types);
+    }));
+    tasks.back()->schedule();
+  };
+
+  try {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      while (tasks.size() < chunk_count && tasks.size() <= size_t{chunk_id} + max_formatted_chunk_count) {
+        schedule_formatting(static_cast<ChunkID>(tasks.size()));
       }
 
-      writer.end_line();
+      CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{tasks[chunk_id]});
+      writer.write(formatted_chunks[chunk_id]);
+
+      // Free the formatted chunk right away
+      formatted_chunks[chunk_id] = std::string{};
     }
+  } catch (...) {
+    // The scheduled tasks reference the formatted chunks of this scope
+    CurrentScheduler::wait_for_tasks(tasks);
+    throw;
   }
 }
 
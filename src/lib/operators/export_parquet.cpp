@@ -0,0 +1,157 @@
+#include "export_parquet.hpp"
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/properties.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void check_status(const arrow::Status& status) { Assert(status.ok(), "Parquet export failed: " + status.ToString()); }
+
+// Maps Hyrise's column types to the Arrow type and builder used for them
+template <typename T>
+struct ArrowTypeFor;
+template <>
+struct ArrowTypeFor<int32_t> {
+  using Builder = arrow::Int32Builder;
+  static std::shared_ptr<arrow::DataType> data_type() { return arrow::int32(); }
+};
+template <>
+struct ArrowTypeFor<int64_t> {
+  using Builder = arrow::Int64Builder;
+  static std::shared_ptr<arrow::DataType> data_type() { return arrow::int64(); }
+};
+template <>
+struct ArrowTypeFor<float> {
+  using Builder = arrow::FloatBuilder;
+  static std::shared_ptr<arrow::DataType> data_type() { return arrow::float32(); }
+};
+template <>
+struct ArrowTypeFor<double> {
+  using Builder = arrow::DoubleBuilder;
+  static std::shared_ptr<arrow::DataType> data_type() { return arrow::float64(); }
+};
+template <>
+struct ArrowTypeFor<pmr_string> {
+  using Builder = arrow::StringBuilder;
+  static std::shared_ptr<arrow::DataType> data_type() { return arrow::utf8(); }
+};
+
+std::shared_ptr<arrow::DataType> arrow_data_type(const DataType data_type) {
+  auto arrow_type = std::shared_ptr<arrow::DataType>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    arrow_type = ArrowTypeFor<ColumnDataType>::data_type();
+  });
+  return arrow_type;
+}
+
+std::shared_ptr<arrow::Array> export_segment(const BaseSegment& segment, const DataType data_type) {
+  auto array = std::shared_ptr<arrow::Array>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto builder = typename ArrowTypeFor<ColumnDataType>::Builder{};
+    check_status(builder.Reserve(segment.size()));
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        check_status(builder.AppendNull());
+      } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        check_status(builder.Append(position.value().data(), static_cast<int32_t>(position.value().size())));
+      } else {
+        check_status(builder.Append(position.value()));
+      }
+    });
+    check_status(builder.Finish(&array));
+  });
+  return array;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ExportParquet::ExportParquet(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename)
+    : AbstractReadOnlyOperator(OperatorType::ExportParquet, in), _filename(filename) {}
+
+void ExportParquet::write_parquet(const Table& table, const std::string& filename) {
+  auto fields = std::vector<std::shared_ptr<arrow::Field>>{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    fields.emplace_back(arrow::field(table.column_name(column_id), arrow_data_type(table.column_data_type(column_id)),
+                                     table.column_is_nullable(column_id)));
+  }
+  const auto schema = arrow::schema(fields);
+
+  auto file = std::shared_ptr<arrow::io::FileOutputStream>{};
+  check_status(arrow::io::FileOutputStream::Open(filename, &file));
+
+  auto writer = std::unique_ptr<parquet::arrow::FileWriter>{};
+  check_status(parquet::arrow::FileWriter::Open(*schema, arrow::default_memory_pool(), file,
+                                                parquet::default_writer_properties(), &writer));
+
+  // The chunks are converted into Arrow arrays concurrently and written as one row group each, in order. As in
+  // ExportBinary, this happens in batches of one chunk per CPU to bound the memory needed for the arrays.
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto batch_size = std::max(size_t{1}, Topology::get().num_cpus());
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+
+    auto chunk_tables = std::vector<std::shared_ptr<arrow::Table>>(batch_end - batch_begin);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_end - batch_begin);
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        const auto chunk = table.get_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_id)});
+        auto arrays = std::vector<std::shared_ptr<arrow::Array>>{};
+        for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+          arrays.emplace_back(export_segment(*chunk->get_segment(column_id), table.column_data_type(column_id)));
+        }
+        chunk_tables[chunk_id - batch_begin] = arrow::Table::Make(schema, arrays);
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (const auto& chunk_table : chunk_tables) {
+      // Empty chunks carry no data, and Parquet does not need a row group to remember them
+      if (chunk_table->num_rows() == 0) continue;
+      check_status(writer->WriteTable(*chunk_table, chunk_table->num_rows()));
+    }
+  }
+
+  check_status(writer->Close());
+  check_status(file->Close());
+}
+
+const std::string ExportParquet::name() const { return "ExportParquet"; }
+
+std::shared_ptr<const Table> ExportParquet::_on_execute() {
+  write_parquet(*input_table_left(), _filename);
+  return _input_left->get_output();
+}
+
+std::shared_ptr<AbstractOperator> ExportParquet::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ExportParquet>(copied_input_left, _filename);
+}
+
+void ExportParquet::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
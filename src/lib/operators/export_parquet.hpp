@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Writes a table into an Apache Parquet file that can be read by ImportParquet or any other Parquet reader. Each chunk
+ * becomes a row group of its own, so that the chunking survives a round trip. The chunks are converted into Arrow
+ * arrays concurrently, the Parquet writer then applies its default dictionary and RLE encodings to them.
+ *
+ * Only available if Hyrise was built with Parquet support (see ENABLE_PARQUET_SUPPORT).
+ */
+class ExportParquet : public AbstractReadOnlyOperator {
+ public:
+  explicit ExportParquet(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename);
+
+  static void write_parquet(const Table& table, const std::string& filename);
+
+  const std::string name() const final;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() final;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::string _filename;
+};
+
+}  // namespace opossum
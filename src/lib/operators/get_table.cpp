@@ -1,15 +1,45 @@
 #include "get_table.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/meta_tables.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Increment of SplitMix64, which spreads consecutive positions over the entire range of 64 bit values
+constexpr auto GOLDEN_GAMMA = uint64_t{0x9e3779b97f4a7c15};
+
+// Finalizer of SplitMix64 (see https://prng.di.unimi.it/splitmix64.c). Maps every position of a sampled table to a
+// uniformly distributed value that only depends on the seed and the position, so that samples are reproducible no
+// matter in which order chunks are processed. It is branch-free and thus vectorized when applied to entire chunks.
+uint64_t mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  value = (value ^ (value >> 27)) * uint64_t{0x94d049bb133111eb};
+  return value ^ (value >> 31);
+}
+
+// Positions whose value is below the threshold are part of the sample
+uint64_t sample_threshold(const double percentage) {
+  return static_cast<uint64_t>(std::ldexp(percentage / 100.0, 64));
+}
+
+}  // namespace
+
 namespace opossum {
 
 GetTable::GetTable(const std::string& name) : AbstractReadOnlyOperator(OperatorType::GetTable), _name(name) {}
@@ -23,6 +53,9 @@ const std::string GetTable::description(DescriptionMode description_mode) const
   if (!_excluded_chunk_ids.empty()) {
     stream << separator << "(" << _excluded_chunk_ids.size() << " Chunks pruned)";
   }
+  if (_table_sample) {
+    stream << separator << "(TABLESAMPLE " << *_table_sample << ")";
+  }
   return stream.str();
 }
 
@@ -32,11 +65,23 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+void GetTable::set_row_count_hint(const std::optional<size_t>& row_count_hint) { _row_count_hint = row_count_hint; }
+
+void GetTable::set_table_sample(const std::optional<TableSample>& table_sample) {
+  DebugAssert(!table_sample || (table_sample->percentage >= 0.0 && table_sample->percentage <= 100.0),
+              "Sample percentage must be between 0 and 100");
+  _table_sample = table_sample;
+}
+
+const std::optional<TableSample>& GetTable::table_sample() const { return _table_sample; }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   auto copy = std::make_shared<GetTable>(_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_row_count_hint(_row_count_hint);
+  copy->set_table_sample(_table_sample);
   return copy;
 }
 
@@ -46,7 +91,9 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   DebugAssert(!transaction_context_is_set() || transaction_context()->phase() == TransactionPhase::Active,
               "Transaction is not active anymore.");
 
-  auto original_table = StorageManager::get().get_table(_name);
+  // Meta tables are generated from the current state of the stored tables
+  auto original_table = is_meta_table_name(_name) ? StorageManager::get().generate_meta_table(_name)
+                                                  : StorageManager::get().get_table(_name);
   auto temp_excluded_chunk_ids = std::vector<ChunkID>(_excluded_chunk_ids);
 
   if (HYRISE_DEBUG && !transaction_context_is_set()) {
@@ -68,26 +115,126 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     }
   }
 
-  if (temp_excluded_chunk_ids.empty()) {
-    return original_table;
+  // Samples of 100 percent contain the entire table
+  const auto is_sampled = _table_sample && _table_sample->percentage < 100.0;
+  auto seed = uint64_t{0};
+  if (is_sampled) {
+    if (_table_sample->seed) {
+      seed = *_table_sample->seed;
+    } else {
+      auto random_device = std::random_device{};
+      seed = (uint64_t{random_device()} << 32) | random_device();
+    }
   }
 
-  // We create a copy of the original table, but omit excluded chunks
-  const auto pruned_table = std::make_shared<Table>(original_table->column_definitions(), TableType::Data,
-                                                    original_table->max_chunk_size(), original_table->has_mvcc());
+  // A SYSTEM sample decides for every chunk whether all or none of its rows are part of it
+  if (is_sampled && _table_sample->method == TableSampleMethod::System) {
+    const auto threshold = sample_threshold(_table_sample->percentage);
+    for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+      if (mix(seed + chunk_id * GOLDEN_GAMMA) >= threshold) temp_excluded_chunk_ids.emplace_back(chunk_id);
+    }
+  }
 
   std::sort(temp_excluded_chunk_ids.begin(), temp_excluded_chunk_ids.end());
   temp_excluded_chunk_ids.erase(std::unique(temp_excluded_chunk_ids.begin(), temp_excluded_chunk_ids.end()),
                                 temp_excluded_chunk_ids.end());
 
-  for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+  if (is_sampled && _table_sample->method == TableSampleMethod::Bernoulli) {
+    _performance_data->pruned_chunk_count = temp_excluded_chunk_ids.size();
+    return _sample_rows(original_table, temp_excluded_chunk_ids, seed);
+  }
+
+  // The chunks after the first ones that hold enough rows for the consumer are not needed
+  auto chunk_end = original_table->chunk_count();
+  if (_row_count_hint) {
+    auto row_count = size_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < chunk_end; ++chunk_id) {
+      if (row_count >= *_row_count_hint) {
+        chunk_end = chunk_id;
+        break;
+      }
+
+      const auto chunk = original_table->get_chunk(chunk_id);
+      if (chunk && !std::binary_search(temp_excluded_chunk_ids.cbegin(), temp_excluded_chunk_ids.cend(), chunk_id)) {
+        row_count += chunk->size();
+      }
+    }
+  }
+
+  if (temp_excluded_chunk_ids.empty() && chunk_end == original_table->chunk_count()) {
+    return original_table;
+  }
+
+  // We create a copy of the original table, but omit excluded chunks
+  const auto pruned_table = std::make_shared<Table>(original_table->column_definitions(), TableType::Data,
+                                                    original_table->max_chunk_size(), original_table->has_mvcc());
+  // Operators on the pruned table can still process its partitions independently
+  if (original_table->partitioning()) pruned_table->set_partitioning(original_table->partitioning());
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_end; ++chunk_id) {
     const auto chunk = original_table->get_chunk(chunk_id);
     if (chunk && !std::binary_search(temp_excluded_chunk_ids.cbegin(), temp_excluded_chunk_ids.cend(), chunk_id)) {
       pruned_table->append_chunk(chunk);
     }
   }
 
+  _performance_data->pruned_chunk_count = original_table->chunk_count() - pruned_table->chunk_count();
+
   return pruned_table;
 }
 
+std::shared_ptr<const Table> GetTable::_sample_rows(const std::shared_ptr<const Table>& table,
+                                                    const std::vector<ChunkID>& excluded_chunk_ids,
+                                                    const uint64_t seed) const {
+  const auto threshold = sample_threshold(_table_sample->percentage);
+  const auto chunk_count = table->chunk_count();
+
+  // The rows of each chunk are sampled by a separate job. Every RowID is written and the output is only advanced for
+  // sampled rows (i.e., a compress-store), so that there are no mispredicted branches.
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (std::binary_search(excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend(), chunk_id)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+      const auto chunk_seed = seed + (uint64_t{chunk_id} << 32) * GOLDEN_GAMMA;
+
+      auto pos_list = std::make_shared<PosList>(chunk_size);
+      auto output_index = size_t{0};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        (*pos_list)[output_index] = RowID{chunk_id, chunk_offset};
+        output_index += mix(chunk_seed + chunk_offset * GOLDEN_GAMMA) < threshold;
+      }
+      pos_list->resize(output_index);
+
+      pos_list->guarantee_single_chunk();
+      pos_list->shrink_to_compact_representation();
+      pos_lists[chunk_id] = std::move(pos_list);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  const auto sampled_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& pos_list = pos_lists[chunk_id];
+    if (!pos_list || pos_list->empty()) continue;
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    sampled_table->append_chunk(segments);
+
+    // Sampling keeps the order of the rows
+    const auto& ordered_by = table->get_chunk(chunk_id)->ordered_by();
+    if (ordered_by) {
+      sampled_table->get_chunk(ChunkID{sampled_table->chunk_count() - 1})->set_ordered_by(*ordered_by);
+    }
+  }
+
+  return sampled_table;
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -22,6 +23,14 @@ class GetTable : public AbstractReadOnlyOperator {
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
 
+  // If set, only the first chunks that together hold at least row_count_hint rows are returned (see LimitPushdownRule)
+  void set_row_count_hint(const std::optional<size_t>& row_count_hint);
+
+  // If set, only a sample of the table is returned. A SYSTEM sample excludes chunks, so that the output is still a data
+  // table. A BERNOULLI sample selects rows and yields a reference table.
+  void set_table_sample(const std::optional<TableSample>& table_sample);
+  const std::optional<TableSample>& table_sample() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -30,8 +39,14 @@ class GetTable : public AbstractReadOnlyOperator {
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  // Returns a reference table with the sampled rows of the chunks that are not excluded
+  std::shared_ptr<const Table> _sample_rows(const std::shared_ptr<const Table>& table,
+                                            const std::vector<ChunkID>& excluded_chunk_ids, const uint64_t seed) const;
+
   // name of the table to retrieve
   const std::string _name;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<size_t> _row_count_hint;
+  std::optional<TableSample> _table_sample;
 };
 }  // namespace opossum
@@ -2,19 +2,33 @@
 
 #include <boost/hana/for_each.hpp>
 
+#include <algorithm>
 #include <cstdint>
-#include <fstream>
+#include <cstring>
+#include <exception>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "constant_mappings.hpp"
 #include "import_export/binary.hpp"
+#include "memory/huge_page_memory_resource.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/block_min_max_filter.hpp"
+#include "statistics/chunk_statistics/blocked_bloom_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/min_max_filter.hpp"
+#include "statistics/chunk_statistics/range_filter.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "utils/assert.hpp"
@@ -27,54 +41,97 @@ ImportBinary::ImportBinary(const std::string& filename, const std::optional<std:
 const std::string ImportBinary::name() const { return "ImportBinary"; }
 
 std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-
-  Assert(file.is_open(), "ImportBinary: Could not open file " + filename);
-
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  auto file = MappedFileReader{filename};
 
   std::shared_ptr<Table> table;
   ChunkID chunk_count;
   std::tie(table, chunk_count) = _read_header(file);
+
+  // Files written by ExportBinary end with an index of the chunks, so that they can be decoded concurrently right
+  // away. Older files are scanned once to find where each chunk begins (and to validate the segment types).
+  auto statistics_end = file.size();
+  auto chunk_offsets = _read_chunk_index(file, chunk_count);
+  if (chunk_offsets) {
+    statistics_end -= _chunk_index_size(chunk_count);
+  } else {
+    chunk_offsets.emplace();
+    chunk_offsets->reserve(chunk_count + 1);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunk_offsets->emplace_back(file.position());
+      _skip_chunk(file, *table);
+    }
+    chunk_offsets->emplace_back(file.position());
+  }
+
+  // An exception thrown while decoding a chunk is rethrown once all jobs are done, as the other jobs still access
+  // the file and the table
+  auto chunk_segments = std::vector<Segments>(chunk_count);
+  auto chunk_exceptions = std::vector<std::exception_ptr>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      try {
+        auto chunk_file = file;
+        chunk_file.seek((*chunk_offsets)[chunk_id]);
+        chunk_segments[chunk_id] = _import_chunk(chunk_file, *table);
+        Assert(chunk_file.position() == (*chunk_offsets)[chunk_id + 1], "Chunk does not end where the next one begins");
+      } catch (...) {
+        chunk_exceptions[chunk_id] = std::current_exception();
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& exception : chunk_exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+
+  for (const auto& segments : chunk_segments) {
+    table->append_chunk(segments);
+  }
+
+  if (chunk_offsets->back() < statistics_end) {
+    file.seek(chunk_offsets->back());
+    _import_statistics(file, *table);
   }
 
   return table;
 }
 
 template <typename T>
-pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+pmr_vector<T> ImportBinary::_read_values(MappedFileReader& file, const size_t count) {
+  // Large columns are placed in huge pages, see HugePageMemoryResource
+  pmr_vector<T> values(count, PolymorphicAllocator<T>{HugePageMemoryResource::get_default()});
+  if (count > 0) std::memcpy(values.data(), file.read_bytes(count * sizeof(T)), count * sizeof(T));
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> ImportBinary::_read_values(MappedFileReader& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
-  return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
+pmr_vector<bool> ImportBinary::_read_values(MappedFileReader& file, const size_t count) {
+  const auto* const readable_bools = reinterpret_cast<const BoolAsByteType*>(file.read_bytes(count));
+  return pmr_vector<bool>(readable_bools, readable_bools + count);
 }
 
-pmr_vector<pmr_string> ImportBinary::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> ImportBinary::_read_string_values(MappedFileReader& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  // The characters are copied straight from the mapped file into the strings
+  const auto* const buffer = file.read_bytes(total_length);
 
   pmr_vector<pmr_string> values(count);
   size_t start = 0;
 
   for (size_t i = 0; i < count; ++i) {
-    values[i] = pmr_string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
+    values[i] = pmr_string(buffer + start, buffer + start + string_lengths[i]);
     start += string_lengths[i];
   }
 
@@ -82,10 +139,8 @@ pmr_vector<pmr_string> ImportBinary::_read_string_values(std::ifstream& file, co
 }
 
 template <typename T>
-T ImportBinary::_read_value(std::ifstream& file) {
-  T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
-  return result;
+T ImportBinary::_read_value(MappedFileReader& file) {
+  return file.read_value<T>();
 }
 
 std::shared_ptr<const Table> ImportBinary::_on_execute() {
@@ -110,7 +165,7 @@ std::shared_ptr<AbstractOperator> ImportBinary::_on_deep_copy(
 
 void ImportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(MappedFileReader& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -130,18 +185,104 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+Segments ImportBinary::_import_chunk(MappedFileReader& file, const Table& table) {
+  return read_chunk(file, table.column_definitions());
+}
+
+Segments ImportBinary::read_chunk(MappedFileReader& file, const TableColumnDefinitions& column_definitions) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (const auto& column_definition : column_definitions) {
     output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_segment(file, row_count, column_definition.data_type, column_definition.nullable));
   }
-  table->append_chunk(output_segments);
+  return output_segments;
+}
+
+size_t ImportBinary::_chunk_index_size(const ChunkID chunk_count) {
+  // The offsets of the chunks, the end of the last chunk, and the magic number
+  return (size_t{chunk_count} + 2) * sizeof(uint64_t);
 }
 
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::optional<std::vector<size_t>> ImportBinary::_read_chunk_index(const MappedFileReader& file,
+                                                                   const ChunkID chunk_count) {
+  const auto chunks_begin = file.position();
+  const auto index_size = _chunk_index_size(chunk_count);
+  if (file.size() < chunks_begin + index_size) return std::nullopt;
+
+  auto index_file = file;
+  index_file.seek(file.size() - sizeof(uint64_t));
+  if (index_file.read_value<uint64_t>() != BINARY_CHUNK_INDEX_MAGIC) return std::nullopt;
+
+  const auto index_begin = file.size() - index_size;
+  index_file.seek(index_begin);
+  auto chunk_offsets = std::vector<size_t>(chunk_count + 1);
+  for (auto& chunk_offset : chunk_offsets) {
+    chunk_offset = index_file.read_value<uint64_t>();
+  }
+
+  Assert(chunk_offsets.front() == chunks_begin && chunk_offsets.back() <= index_begin &&
+             std::is_sorted(chunk_offsets.begin(), chunk_offsets.end()),
+         "Invalid chunk index");
+  return chunk_offsets;
+}
+
+void ImportBinary::_skip_chunk(MappedFileReader& file, const Table& table) {
+  const auto row_count = _read_value<ChunkOffset>(file);
+
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _skip_segment<ColumnDataType>(file, row_count, table.column_is_nullable(column_id));
+    });
+  }
+}
+
+template <typename T>
+void ImportBinary::_skip_segment(MappedFileReader& file, ChunkOffset row_count, bool is_nullable) {
+  const auto column_type = _read_value<BinarySegmentType>(file);
+
+  switch (column_type) {
+    case BinarySegmentType::value_segment:
+      if (is_nullable) file.read_bytes(row_count * sizeof(BoolAsByteType));
+      _skip_values<T>(file, row_count);
+      return;
+    case BinarySegmentType::dictionary_segment: {
+      const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
+      Assert(attribute_vector_width == 1 || attribute_vector_width == 2 || attribute_vector_width == 4,
+             "Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
+      const auto dictionary_size = _read_value<ValueID>(file);
+      _skip_values<T>(file, dictionary_size);
+      file.read_bytes(size_t{row_count} * attribute_vector_width);
+      return;
+    }
+    case BinarySegmentType::delta_segment: {
+      Assert((std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>), "Delta segments must be of type int or long");
+      const auto delta_vector_width = _read_value<AttributeVectorWidth>(file);
+      Assert(delta_vector_width == 1 || delta_vector_width == 2 || delta_vector_width == 4,
+             "Cannot import delta vector with width: " + std::to_string(delta_vector_width));
+      _skip_values<T>(file, _delta_block_count(row_count));
+      file.read_bytes(row_count * sizeof(BoolAsByteType));
+      file.read_bytes(size_t{row_count} * delta_vector_width);
+      return;
+    }
+    default:
+      Fail("Cannot import column: invalid column type");
+  }
+}
+
+template <typename T>
+void ImportBinary::_skip_values(MappedFileReader& file, const size_t count) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto string_lengths = _read_values<size_t>(file, count);
+    file.read_bytes(std::accumulate(string_lengths.cbegin(), string_lengths.cend(), size_t{0}));
+  } else {
+    file.read_bytes(count * sizeof(T));
+  }
+}
+
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(MappedFileReader& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -153,7 +294,7 @@ std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file,
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(MappedFileReader& file, ChunkOffset row_count,
                                                            bool is_nullable) {
   const auto column_type = _read_value<BinarySegmentType>(file);
 
@@ -162,53 +303,201 @@ std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file,
       return _import_value_segment<ColumnDataType>(file, row_count, is_nullable);
     case BinarySegmentType::dictionary_segment:
       return _import_dictionary_segment<ColumnDataType>(file, row_count);
+    case BinarySegmentType::delta_segment:
+      if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+        return _import_delta_segment<ColumnDataType>(file, row_count);
+      }
+      Fail("Cannot import column: delta segments must be of type int or long");
     default:
       // This case happens if the read column type is not a valid BinarySegmentType.
       Fail("Cannot import column: invalid column type");
   }
 }
 
-std::shared_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+std::unique_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
+    MappedFileReader& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(MappedFileReader& file, ChunkOffset row_count,
                                                                      bool is_nullable) {
-  // TODO(unknown): Ideally _read_values would directly write into a tbb::concurrent_vector so that no conversion is
-  // needed
+  auto null_values = NullValueVector{};
   if (is_nullable) {
     const auto nullables = _read_values<bool>(file, row_count);
-    const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueSegment<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()},
-                                             tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
+    null_values = NullValueVector(nullables.begin(), nullables.end());
+  }
+
+  auto values = pmr_concurrent_vector<T>{};
+  if constexpr (std::is_arithmetic_v<T>) {
+    // Fill the concurrent_vector straight from the mapped file. As its storage is not contiguous and the values in the
+    // file are not necessarily aligned, they are copied one by one.
+    values = pmr_concurrent_vector<T>(row_count);
+    const auto* const bytes = file.read_bytes(row_count * sizeof(T));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      std::memcpy(&values[chunk_offset], bytes + chunk_offset * sizeof(T), sizeof(T));
+    }
   } else {
-    const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueSegment<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()});
+    auto strings = _read_values<T>(file, row_count);
+    values = pmr_concurrent_vector<T>(std::make_move_iterator(strings.begin()), std::make_move_iterator(strings.end()));
   }
+
+  if (is_nullable) return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  return std::make_shared<ValueSegment<T>>(std::move(values));
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(MappedFileReader& file,
                                                                                ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   const auto null_value_id = dictionary_size;
   auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
 
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  auto attribute_vector = std::shared_ptr<const BaseCompressedVector>{
+      _import_attribute_vector(file, row_count, attribute_vector_width)};
 
   return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector, null_value_id);
 }
 
+template <typename T>
+std::shared_ptr<DeltaSegment<T>> ImportBinary::_import_delta_segment(MappedFileReader& file, ChunkOffset row_count) {
+  const auto delta_vector_width = _read_value<AttributeVectorWidth>(file);
+  auto block_checkpoints = _read_values<T>(file, _delta_block_count(row_count));
+  auto null_values = _read_values<bool>(file, row_count);
+  auto deltas = _import_attribute_vector(file, row_count, delta_vector_width);
+
+  return std::make_shared<DeltaSegment<T>>(std::move(block_checkpoints), std::move(null_values), std::move(deltas));
+}
+
+size_t ImportBinary::_delta_block_count(const ChunkOffset row_count) {
+  constexpr auto block_size = size_t{DeltaSegment<int32_t>::block_size};
+  return (size_t{row_count} + block_size - 1) / block_size;
+}
+
+void ImportBinary::_import_statistics(MappedFileReader& file, Table& table) {
+  const auto row_count = _read_value<float>(file);
+
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.reserve(table.column_count());
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      column_statistics.emplace_back(_import_column_statistics<ColumnDataType>(file));
+    });
+  }
+  table.set_table_statistics(std::make_shared<TableStatistics>(TableType::Data, row_count, column_statistics));
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto has_chunk_statistics = _read_value<BoolAsByteType>(file);
+    if (!has_chunk_statistics) continue;
+
+    auto segment_statistics = std::vector<std::shared_ptr<SegmentStatistics>>{};
+    segment_statistics.reserve(table.column_count());
+    for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segment_statistics.emplace_back(_import_segment_statistics<ColumnDataType>(file));
+      });
+    }
+    table.get_chunk(chunk_id)->set_statistics(std::make_shared<ChunkStatistics>(segment_statistics));
+  }
+}
+
+template <typename T>
+std::shared_ptr<ColumnStatistics<T>> ImportBinary::_import_column_statistics(MappedFileReader& file) {
+  const auto null_value_ratio = _read_value<float>(file);
+  const auto distinct_count = _read_value<float>(file);
+  const auto min_max = _read_values<T>(file, 2);
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<T>>(null_value_ratio, distinct_count, min_max[0], min_max[1]);
+
+  const auto bin_count = _read_value<uint32_t>(file);
+  if (bin_count == 0) return column_statistics;
+
+  auto bin_minima = _read_values<T>(file, bin_count);
+  auto bin_maxima = _read_values<T>(file, bin_count);
+  auto bin_heights = _read_values<HistogramCountType>(file, bin_count);
+  auto bin_distinct_counts = _read_values<HistogramCountType>(file, bin_count);
+  column_statistics->set_histogram(std::make_shared<GenericHistogram<T>>(
+      std::vector<T>(bin_minima.begin(), bin_minima.end()), std::vector<T>(bin_maxima.begin(), bin_maxima.end()),
+      std::vector<HistogramCountType>(bin_heights.begin(), bin_heights.end()),
+      std::vector<HistogramCountType>(bin_distinct_counts.begin(), bin_distinct_counts.end())));
+  return column_statistics;
+}
+
+template <typename T>
+std::shared_ptr<SegmentStatistics> ImportBinary::_import_segment_statistics(MappedFileReader& file) {
+  auto segment_statistics = std::make_shared<SegmentStatistics>();
+
+  const auto filter_count = _read_value<uint32_t>(file);
+  for (auto filter_index = uint32_t{0}; filter_index < filter_count; ++filter_index) {
+    const auto filter_type = _read_value<BinaryFilterType>(file);
+    switch (filter_type) {
+      case BinaryFilterType::min_max_filter: {
+        const auto min_max = _read_values<T>(file, 2);
+        segment_statistics->add_filter(std::make_shared<MinMaxFilter<T>>(min_max[0], min_max[1]));
+      } break;
+      case BinaryFilterType::range_filter: {
+        if constexpr (std::is_arithmetic_v<T>) {
+          const auto range_count = _read_value<uint32_t>(file);
+          const auto minima = _read_values<T>(file, range_count);
+          const auto maxima = _read_values<T>(file, range_count);
+          auto ranges = std::vector<std::pair<T, T>>{};
+          ranges.reserve(range_count);
+          for (auto range_index = uint32_t{0}; range_index < range_count; ++range_index) {
+            ranges.emplace_back(minima[range_index], maxima[range_index]);
+          }
+          segment_statistics->add_filter(std::make_shared<RangeFilter<T>>(std::move(ranges)));
+        } else {
+          Fail("RangeFilters are not supported for strings");
+        }
+      } break;
+      case BinaryFilterType::blocked_bloom_filter: {
+        const auto block_count = _read_value<uint32_t>(file);
+        const auto words = _read_values<uint32_t>(file, block_count * BaseBlockedBloomFilter::WORDS_PER_BLOCK);
+        auto blocks = std::vector<BaseBlockedBloomFilter::Block>(block_count);
+        for (auto block_index = uint32_t{0}; block_index < block_count; ++block_index) {
+          std::copy_n(words.cbegin() + block_index * BaseBlockedBloomFilter::WORDS_PER_BLOCK,
+                      BaseBlockedBloomFilter::WORDS_PER_BLOCK, blocks[block_index].words.begin());
+        }
+        segment_statistics->add_filter(std::make_shared<BlockedBloomFilter<T>>(std::move(blocks)));
+      } break;
+      default:
+        Fail("Cannot import unknown filter type");
+    }
+  }
+
+  const auto has_block_min_max_filter = _read_value<BoolAsByteType>(file);
+  if (!has_block_min_max_filter) return segment_statistics;
+
+  const auto segment_size = _read_value<ChunkOffset>(file);
+  const auto block_count = _read_value<uint32_t>(file);
+  const auto blocks_are_not_null = _read_values<bool>(file, block_count);
+  const auto not_null_block_count = std::count(blocks_are_not_null.cbegin(), blocks_are_not_null.cend(), true);
+  const auto minima = _read_values<T>(file, not_null_block_count);
+  const auto maxima = _read_values<T>(file, not_null_block_count);
+
+  auto block_ranges = typename BlockMinMaxFilter<T>::BlockRanges(block_count);
+  auto not_null_block_index = size_t{0};
+  for (auto block_index = uint32_t{0}; block_index < block_count; ++block_index) {
+    if (!blocks_are_not_null[block_index]) continue;
+    block_ranges[block_index].emplace(minima[not_null_block_index], maxima[not_null_block_index]);
+    ++not_null_block_index;
+  }
+  segment_statistics->set_block_min_max_filter(
+      std::make_shared<BlockMinMaxFilter<T>>(segment_size, std::move(block_ranges)));
+
+  return segment_statistics;
+}
+
 }  // namespace opossum
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -9,7 +8,11 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "import_export/binary.hpp"
+#include "import_export/mapped_file_reader.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "statistics/column_statistics.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/value_segment.hpp"
 
@@ -20,6 +23,14 @@ namespace opossum {
  * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
  * already exists, it is returned and no import is performed.
  *
+ * The file is memory-mapped (see MappedFileReader) and the values are copied directly from the mapping into the
+ * segments, so that no intermediate buffers are needed. The chunks are decoded concurrently by JobTasks, which find
+ * their chunks using the chunk index at the end of the file. Files without an index (i.e., written before it was
+ * introduced) are scanned once for the beginnings of their chunks first.
+ *
+ * If the file contains statistics (see ExportBinary::_write_statistics()), they are set for the table and its chunks,
+ * so that the StorageManager does not need to generate them again.
+ *
  * Note: ImportBinary does not support null values at the moment
  */
 class ImportBinary : public AbstractReadOnlyOperator {
@@ -28,16 +39,25 @@ class ImportBinary : public AbstractReadOnlyOperator {
 
   static std::shared_ptr<Table> read_binary(const std::string& filename);
 
+  // Reads the segments of a single chunk written by ExportBinary::write_chunk()
+  static Segments read_chunk(MappedFileReader& file, const TableColumnDefinitions& column_definitions);
+
   /*
    * Reads the given binary file. The file must be in the following form:
    *
-   * --------------
-   * |   Header   |
-   * |------------|
-   * |   Chunks¹  |
-   * --------------
+   * ---------------
+   * |   Header    |
+   * |-------------|
+   * |   Chunks¹   |
+   * |-------------|
+   * | Statistics² |
+   * |-------------|
+   * | Chunk index³|
+   * ---------------
    *
    * ¹ Zero or more chunks
+   * ² Optional, see ExportBinary::_write_statistics()
+   * ³ Optional, see ExportBinary::_write_chunk_index()
    */
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -67,10 +87,10 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(MappedFileReader& file);
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
+   * Creates the segments of a chunk from chunk information from the given file.
    * The chunk information has the following form:
    *
    * ----------------
@@ -81,15 +101,34 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static Segments _import_chunk(MappedFileReader& file, const Table& table);
+
+  // Returns the size of the chunk index (see ExportBinary::_write_chunk_index()) of a file with @param chunk_count
+  // chunks
+  static size_t _chunk_index_size(const ChunkID chunk_count);
+
+  // Returns the beginnings of the chunks followed by the end of the last chunk if the file ends with a chunk index,
+  // std::nullopt otherwise. The file must be positioned at the beginning of the first chunk.
+  static std::optional<std::vector<size_t>> _read_chunk_index(const MappedFileReader& file,
+                                                              const ChunkID chunk_count);
+
+  // Advances the file behind the chunk at its current position without creating any segments. This finds the
+  // beginning of the next chunk in files without a chunk index.
+  static void _skip_chunk(MappedFileReader& file, const Table& table);
+
+  template <typename T>
+  static void _skip_segment(MappedFileReader& file, ChunkOffset row_count, bool is_nullable);
+
+  template <typename T>
+  static void _skip_values(MappedFileReader& file, const size_t count);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
-                                                      bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(MappedFileReader& file, ChunkOffset row_count,
+                                                      DataType data_type, bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(MappedFileReader& file, ChunkOffset row_count, bool is_nullable);
 
   /*
    * Imports a serialized ValueSegment from the given file.
@@ -117,7 +156,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    */
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(MappedFileReader& file, ChunkOffset row_count,
                                                                 bool is_nullable);
 
   /*
@@ -137,22 +176,55 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * °: This field is needed if the type of the column is NOT a string
    */
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(MappedFileReader& file,
+                                                                          ChunkOffset row_count);
+
+  /*
+   * Imports a serialized DeltaSegment from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Width of delta v.     | AttributeVectorWidth                  |   1
+   * Block checkpoints     | T (int, long)                         |   block count * sizeof(T)
+   * Is Value Null?        | bool (stored as BoolAsByteType)       |   row_count * 1
+   * Delta v. values       | uintX                                 |   row_count * width of delta v.
+   *
+   * The block count follows from the row count and DeltaSegment::block_size.
+   */
+  template <typename T>
+  static std::shared_ptr<DeltaSegment<T>> _import_delta_segment(MappedFileReader& file, ChunkOffset row_count);
+
+  static size_t _delta_block_count(const ChunkOffset row_count);
+
+  /*
+   * Reads the statistics that ExportBinary::_write_statistics() writes behind the last chunk (see there for the format)
+   * and sets them as the TableStatistics of the table and the ChunkStatistics of its chunks. Files without statistics
+   * end after the last chunk, their tables get statistics once they are added to the StorageManager.
+   */
+  static void _import_statistics(MappedFileReader& file, Table& table);
+
+  template <typename T>
+  static std::shared_ptr<ColumnStatistics<T>> _import_column_statistics(MappedFileReader& file);
+
+  template <typename T>
+  static std::shared_ptr<SegmentStatistics> _import_segment_statistics(MappedFileReader& file);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  static std::unique_ptr<BaseCompressedVector> _import_attribute_vector(MappedFileReader& file,
+                                                                        ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(MappedFileReader& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(MappedFileReader& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(MappedFileReader& file);
 
  private:
   // Name of the import file
@@ -0,0 +1,271 @@
+#include "import_parquet.hpp"
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/properties.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void check_status(const arrow::Status& status) { Assert(status.ok(), "Parquet import failed: " + status.ToString()); }
+
+DataType data_type_from_arrow(const arrow::DataType& arrow_type) {
+  switch (arrow_type.id()) {
+    case arrow::Type::INT32:
+      return DataType::Int;
+    case arrow::Type::INT64:
+      return DataType::Long;
+    case arrow::Type::FLOAT:
+      return DataType::Float;
+    case arrow::Type::DOUBLE:
+      return DataType::Double;
+    case arrow::Type::STRING:
+    case arrow::Type::BINARY:
+      return DataType::String;
+    default:
+      Fail("Cannot import Parquet column of type " + arrow_type.ToString());
+  }
+}
+
+// Opens a reader that returns the given string columns as dictionary arrays instead of materializing their values
+std::unique_ptr<parquet::arrow::FileReader> open_reader(const std::string& filename,
+                                                        const std::vector<int>& string_column_indices) {
+  auto file = std::shared_ptr<arrow::io::ReadableFile>{};
+  check_status(arrow::io::ReadableFile::Open(filename, &file));
+
+  auto properties = parquet::default_arrow_reader_properties();
+  for (const auto column_index : string_column_indices) {
+    properties.set_read_dictionary(column_index, true);
+  }
+
+  auto builder = parquet::arrow::FileReaderBuilder{};
+  check_status(builder.Open(file));
+  auto reader = std::unique_ptr<parquet::arrow::FileReader>{};
+  check_status(builder.properties(properties)->Build(&reader));
+  return reader;
+}
+
+template <typename T, typename ArrowArray>
+std::shared_ptr<BaseSegment> import_values(const arrow::ChunkedArray& chunked_array, const bool nullable) {
+  auto values = pmr_concurrent_vector<T>(chunked_array.length());
+  auto null_values = NullValueVector(nullable ? chunked_array.length() : 0);
+
+  auto offset = size_t{0};
+  for (const auto& array : chunked_array.chunks()) {
+    const auto& typed_array = static_cast<const ArrowArray&>(*array);
+    Assert(nullable || typed_array.null_count() == 0, "Found null value in a column that is not nullable");
+
+    for (auto index = int64_t{0}; index < typed_array.length(); ++index, ++offset) {
+      if (typed_array.IsNull(index)) {
+        null_values[offset] = true;
+      } else if constexpr (std::is_same_v<T, pmr_string>) {
+        const auto view = typed_array.GetView(index);
+        values[offset] = pmr_string{view.data(), view.size()};
+      } else {
+        values[offset] = typed_array.Value(index);
+      }
+    }
+  }
+
+  if (nullable) return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  return std::make_shared<ValueSegment<T>>(std::move(values));
+}
+
+/**
+ * Parquet dictionaries are stored in insertion order and a column may be split into several Arrow chunks, each with a
+ * dictionary of its own. The dictionaries are thus merged into one sorted dictionary and the indices are remapped
+ * into it, which only touches each distinct string once.
+ */
+std::shared_ptr<BaseSegment> import_dictionary(const arrow::ChunkedArray& chunked_array, const bool nullable) {
+  auto dictionary = pmr_vector<pmr_string>{};
+  for (const auto& array : chunked_array.chunks()) {
+    const auto& arrow_dictionary =
+        static_cast<const arrow::BinaryArray&>(*static_cast<const arrow::DictionaryArray&>(*array).dictionary());
+    for (auto index = int64_t{0}; index < arrow_dictionary.length(); ++index) {
+      const auto view = arrow_dictionary.GetView(index);
+      dictionary.emplace_back(view.data(), view.size());
+    }
+  }
+  std::sort(dictionary.begin(), dictionary.end());
+  dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+  const auto null_value_id = static_cast<uint32_t>(dictionary.size());
+
+  auto attribute_vector = pmr_vector<uint32_t>(chunked_array.length());
+  auto offset = size_t{0};
+  for (const auto& array : chunked_array.chunks()) {
+    const auto& dictionary_array = static_cast<const arrow::DictionaryArray&>(*array);
+    Assert(nullable || dictionary_array.null_count() == 0, "Found null value in a column that is not nullable");
+
+    const auto& arrow_dictionary = static_cast<const arrow::BinaryArray&>(*dictionary_array.dictionary());
+    auto value_ids = std::vector<uint32_t>(arrow_dictionary.length());
+    for (auto index = int64_t{0}; index < arrow_dictionary.length(); ++index) {
+      const auto view = arrow_dictionary.GetView(index);
+      const auto search = std::string_view{view.data(), view.size()};
+      const auto it =
+          std::lower_bound(dictionary.cbegin(), dictionary.cend(), search,
+                           [](const auto& value, const auto& key) { return std::string_view{value} < key; });
+      value_ids[index] = static_cast<uint32_t>(std::distance(dictionary.cbegin(), it));
+    }
+
+    for (auto index = int64_t{0}; index < dictionary_array.length(); ++index, ++offset) {
+      attribute_vector[offset] =
+          dictionary_array.IsNull(index) ? null_value_id : value_ids[dictionary_array.GetValueIndex(index)];
+    }
+  }
+
+  // We need to increment the dictionary size here because of possible null values.
+  const auto max_value = null_value_id + 1u;
+  auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>{
+      compress_vector(attribute_vector, VectorCompressionType::FixedSizeByteAligned, {}, {max_value})};
+
+  return std::make_shared<DictionarySegment<pmr_string>>(
+      std::make_shared<pmr_vector<pmr_string>>(std::move(dictionary)), compressed_attribute_vector,
+      ValueID{null_value_id});
+}
+
+std::shared_ptr<BaseSegment> import_segment(const arrow::ChunkedArray& chunked_array, const bool nullable) {
+  switch (chunked_array.type()->id()) {
+    case arrow::Type::INT32:
+      return import_values<int32_t, arrow::Int32Array>(chunked_array, nullable);
+    case arrow::Type::INT64:
+      return import_values<int64_t, arrow::Int64Array>(chunked_array, nullable);
+    case arrow::Type::FLOAT:
+      return import_values<float, arrow::FloatArray>(chunked_array, nullable);
+    case arrow::Type::DOUBLE:
+      return import_values<double, arrow::DoubleArray>(chunked_array, nullable);
+    case arrow::Type::STRING:
+    case arrow::Type::BINARY:
+      return import_values<pmr_string, arrow::BinaryArray>(chunked_array, nullable);
+    case arrow::Type::DICTIONARY:
+      return import_dictionary(chunked_array, nullable);
+    default:
+      Fail("Cannot import Parquet column of type " + chunked_array.type()->ToString());
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+ImportParquet::ImportParquet(const std::string& filename, const std::optional<std::string>& tablename,
+                             const std::optional<std::vector<std::string>>& column_names)
+    : AbstractReadOnlyOperator(OperatorType::ImportParquet),
+      _filename(filename),
+      _tablename(tablename),
+      _column_names(column_names) {}
+
+const std::string ImportParquet::name() const { return "ImportParquet"; }
+
+std::shared_ptr<Table> ImportParquet::read_parquet(const std::string& filename,
+                                                   const std::optional<std::vector<std::string>>& column_names) {
+  auto reader = open_reader(filename, {});
+  auto schema = std::shared_ptr<arrow::Schema>{};
+  check_status(reader->GetSchema(&schema));
+
+  // Resolve the projection to the indices of the Parquet columns
+  auto column_indices = std::vector<int>{};
+  if (column_names) {
+    for (const auto& column_name : *column_names) {
+      const auto column_index = schema->GetFieldIndex(column_name);
+      Assert(column_index >= 0, "Parquet file " + filename + " has no column " + column_name);
+      column_indices.emplace_back(column_index);
+    }
+  } else {
+    column_indices.resize(schema->num_fields());
+    std::iota(column_indices.begin(), column_indices.end(), 0);
+  }
+
+  auto column_definitions = TableColumnDefinitions{};
+  auto string_column_indices = std::vector<int>{};
+  for (const auto column_index : column_indices) {
+    const auto& field = schema->field(column_index);
+    const auto data_type = data_type_from_arrow(*field->type());
+    column_definitions.emplace_back(field->name(), data_type, field->nullable());
+    if (data_type == DataType::String) string_column_indices.emplace_back(column_index);
+  }
+
+  const auto row_group_count = reader->num_row_groups();
+  const auto& metadata = *reader->parquet_reader()->metadata();
+  auto max_chunk_size = ChunkOffset{1};
+  for (auto row_group = 0; row_group < row_group_count; ++row_group) {
+    const auto row_count = metadata.RowGroup(row_group)->num_rows();
+    Assert(static_cast<uint64_t>(row_count) <= Chunk::MAX_SIZE,
+           "Row group " + std::to_string(row_group) + " does not fit into a chunk");
+    max_chunk_size = std::max(max_chunk_size, static_cast<ChunkOffset>(row_count));
+  }
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, UseMvcc::Yes);
+
+  // Each row group becomes a chunk. They are decoded concurrently, each job with a reader of its own, as the readers
+  // are not safe to be shared between threads.
+  auto chunk_segments = std::vector<Segments>(row_group_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(row_group_count);
+  for (auto row_group = 0; row_group < row_group_count; ++row_group) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, row_group]() {
+      auto row_group_reader = open_reader(filename, string_column_indices);
+      auto row_group_table = std::shared_ptr<arrow::Table>{};
+      check_status(row_group_reader->ReadRowGroup(row_group, column_indices, &row_group_table));
+
+      auto& segments = chunk_segments[row_group];
+      for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+        segments.emplace_back(
+            import_segment(*row_group_table->column(column_id), column_definitions[column_id].nullable));
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& segments : chunk_segments) {
+    table->append_chunk(segments);
+  }
+
+  return table;
+}
+
+std::shared_ptr<const Table> ImportParquet::_on_execute() {
+  if (_tablename && StorageManager::get().has_table(*_tablename)) {
+    return StorageManager::get().get_table(*_tablename);
+  }
+
+  const auto table = read_parquet(_filename, _column_names);
+
+  if (_tablename) {
+    StorageManager::get().add_table(*_tablename, table);
+  }
+
+  return table;
+}
+
+std::shared_ptr<AbstractOperator> ImportParquet::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ImportParquet>(_filename, _tablename, _column_names);
+}
+
+void ImportParquet::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
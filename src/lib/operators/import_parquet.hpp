@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Reads an Apache Parquet file and creates a table from it, with one chunk per row group. If a tablename is given, the
+ * imported table is stored in the StorageManager. If a table with this name already exists, it is returned and no
+ * import is performed.
+ *
+ * If column_names is given, only these columns are read (in the given order). The columns that are not needed are
+ * never decoded.
+ *
+ * The row groups are read concurrently by JobTasks, each of which uses its own reader. String columns are requested
+ * from Arrow in their dictionary-encoded form, so that the dictionary pages of the file become DictionarySegments
+ * without materializing every value. Numeric columns are decoded into ValueSegments.
+ *
+ * Only available if Hyrise was built with Parquet support (see ENABLE_PARQUET_SUPPORT).
+ */
+class ImportParquet : public AbstractReadOnlyOperator {
+ public:
+  explicit ImportParquet(const std::string& filename, const std::optional<std::string>& tablename = std::nullopt,
+                         const std::optional<std::vector<std::string>>& column_names = std::nullopt);
+
+  static std::shared_ptr<Table> read_parquet(
+      const std::string& filename, const std::optional<std::vector<std::string>>& column_names = std::nullopt);
+
+  const std::string name() const final;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() final;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::string _filename;
+  const std::optional<std::string> _tablename;
+  const std::optional<std::vector<std::string>> _column_names;
+};
+
+}  // namespace opossum
@@ -1,13 +1,22 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/base_index.hpp"
+#include "storage/index/base_mutable_index.hpp"
+#include "storage/index/base_table_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
 
 #include "utils/assert.hpp"
 
@@ -27,13 +36,29 @@ const std::string IndexScan::name() const { return "IndexScan"; }
 
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
+void IndexScan::set_index_only_output(const IndexScanOutput output, const std::string& column_name) {
+  Assert(output != IndexScanOutput::Values || _predicate_condition == PredicateCondition::Equals,
+         "Only equality predicates know the values of their matches");
+  _output = output;
+  _output_column_name = column_name;
+}
+
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
 
   _validate_input();
 
+  if (_output != IndexScanOutput::Positions) return _scan_index_only();
+
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_predicate_condition == PredicateCondition::Equals && _left_column_ids.size() == 1) {
+    if (const auto table_index = _in_table->get_table_index(_left_column_ids[0])) {
+      _scan_table_index(*table_index);
+      return _out_table;
+    }
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -57,8 +82,10 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
+                                                _right_values, _right_values2);
+  if (_output != IndexScanOutput::Positions) copy->set_index_only_output(_output, _output_column_name);
+  return copy;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -84,6 +111,86 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
   return job_task;
 }
 
+void IndexScan::_scan_table_index(const BaseTableIndex& table_index) {
+  const auto matches_out = std::make_shared<PosList>(_get_table_index_matches(table_index));
+
+  Segments segments;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(segments);
+}
+
+PosList IndexScan::_get_table_index_matches(const BaseTableIndex& table_index) const {
+  auto matches = PosList{};
+  table_index.append_equal_rows(_right_values[0], matches);
+
+  // The index also holds rows of removed chunks and of chunks that were appended after the chunk count was taken
+  const auto chunk_count = _in_table->chunk_count();
+  auto chunk_is_scanned = std::vector<bool>(chunk_count, _included_chunk_ids.empty());
+  for (const auto chunk_id : _included_chunk_ids) {
+    chunk_is_scanned[chunk_id] = true;
+  }
+  for (auto chunk_id = ChunkID{0u}; chunk_id < chunk_count; ++chunk_id) {
+    if (!_in_table->get_chunk(chunk_id)) chunk_is_scanned[chunk_id] = false;
+  }
+
+  matches.erase(std::remove_if(matches.begin(), matches.end(),
+                               [&](const auto& row_id) {
+                                 return row_id.chunk_id >= chunk_count || !chunk_is_scanned[row_id.chunk_id];
+                               }),
+                matches.end());
+
+  // The index returns the rows in arbitrary order, sorting them keeps the accesses of later operators sequential
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+std::shared_ptr<const Table> IndexScan::_scan_index_only() {
+  auto match_count = size_t{0};
+
+  const auto table_index = _predicate_condition == PredicateCondition::Equals && _left_column_ids.size() == 1
+                               ? _in_table->get_table_index(_left_column_ids[0])
+                               : nullptr;
+  if (table_index) {
+    match_count = _get_table_index_matches(*table_index).size();
+  } else {
+    const auto count_matches = [&](const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+      match_count += std::distance(begin, end);
+    };
+
+    if (_included_chunk_ids.empty()) {
+      for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+        if (!_in_table->get_chunk(chunk_id)) continue;
+        _for_each_match_range(chunk_id, count_matches);
+      }
+    } else {
+      for (const auto chunk_id : _included_chunk_ids) {
+        _for_each_match_range(chunk_id, count_matches);
+      }
+    }
+  }
+
+  if (_output == IndexScanOutput::Count) {
+    const auto out_table = std::make_shared<Table>(
+        TableColumnDefinitions{{_output_column_name, DataType::Long, false}}, TableType::Data);
+    out_table->append({static_cast<int64_t>(match_count)});
+    return out_table;
+  }
+
+  // All matches of an equality predicate have the search value, converted to the type of the column
+  const auto data_type = _in_table->column_data_type(_left_column_ids[0]);
+  const auto out_table =
+      std::make_shared<Table>(TableColumnDefinitions{{_output_column_name, data_type, false}}, TableType::Data);
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto value = type_cast_variant<ColumnDataType>(_right_values[0]);
+    auto values = pmr_concurrent_vector<ColumnDataType>(match_count, value);
+    out_table->append_chunk({std::make_shared<ValueSegment<ColumnDataType>>(std::move(values))});
+  });
+  return out_table;
+}
+
 void IndexScan::_validate_input() {
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
@@ -101,13 +208,37 @@ void IndexScan::_validate_input() {
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
+  auto matches_out = PosList{};
+  _for_each_match_range(chunk_id, [&](const BaseIndex::Iterator range_begin, const BaseIndex::Iterator range_end) {
+    matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
+    std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+  });
+
+  return matches_out;
+}
+
+void IndexScan::_for_each_match_range(
+    const ChunkID chunk_id, const std::function<void(BaseIndex::Iterator, BaseIndex::Iterator)>& functor) const {
   auto range_begin = BaseIndex::Iterator{};
   auto range_end = BaseIndex::Iterator{};
 
   const auto chunk = _in_table->get_chunk(chunk_id);
-  auto matches_out = PosList{};
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
+
+  // Mutable chunks are not indexed by a BaseIndex yet, but may have a mutable index on the column
+  if (!index && _left_column_ids.size() == 1) {
+    const auto mutable_index = chunk->get_mutable_index(_left_column_ids[0]);
+    if (mutable_index) {
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      mutable_index->append_matches(_predicate_condition, _right_values[0],
+                                    _right_values2.empty() ? std::nullopt : std::optional{_right_values2[0]},
+                                    chunk_offsets);
+      functor(chunk_offsets.cbegin(), chunk_offsets.cend());
+      return;
+    }
+  }
+
   Assert(index != nullptr, "Index of specified type not found for segment (vector).");
 
   switch (_predicate_condition) {
@@ -118,11 +249,7 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
     }
     case PredicateCondition::NotEquals: {
       // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+      functor(index->cbegin(), index->lower_bound(_right_values));
 
       // set range for second half to all values greater than the search value
       range_begin = index->upper_bound(_right_values);
@@ -158,10 +285,7 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
       Fail("Unsupported comparison type encountered");
   }
 
-  matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
-  std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-  return matches_out;
+  functor(range_begin, range_end);
 }
 
 }  // namespace opossum
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
 #include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
 #include "storage/index/segment_index_type.hpp"
 #include "storage/pos_list.hpp"
 #include "types.hpp"
@@ -13,10 +17,17 @@ namespace opossum {
 
 class Table;
 class AbstractTask;
+class BaseTableIndex;
+
+// What an IndexScan outputs, see IndexScan::set_index_only_output()
+enum class IndexScanOutput { Positions, Count, Values };
 
 /**
  * Operator that performs a predicate search using indices
  *
+ * Equality predicates on a single column are answered by the table-level index of that column (see BaseTableIndex),
+ * if there is one. Otherwise, the chunk-level indexes of the given type are used.
+ *
  * Note: Scans only the set of chunks passed to the constructor
  */
 class IndexScan : public AbstractReadOnlyOperator {
@@ -36,6 +47,15 @@ class IndexScan : public AbstractReadOnlyOperator {
    */
   void set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * @brief Index-only execution: outputs a single data column that is computed from the index alone
+   *
+   * With IndexScanOutput::Count, the column holds the number of matching rows (as COUNT(*) would). With
+   * IndexScanOutput::Values, which requires PredicateCondition::Equals, it holds the search value once per matching
+   * row. Neither builds PosLists for the chunk indexes or accesses the indexed segments.
+   */
+  void set_index_only_output(const IndexScanOutput output, const std::string& column_name);
+
  protected:
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -47,6 +67,15 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_table_index(const BaseTableIndex& table_index);
+  std::shared_ptr<const Table> _scan_index_only();
+
+  // Calls functor(begin, end) for each range of matching chunk offsets in the index of the chunk
+  void _for_each_match_range(const ChunkID chunk_id,
+                             const std::function<void(BaseIndex::Iterator, BaseIndex::Iterator)>& functor) const;
+
+  // Returns the matches of the table-level index in the scanned chunks, sorted by RowID
+  PosList _get_table_index_matches(const BaseTableIndex& table_index) const;
 
  private:
   const SegmentIndexType _index_type;
@@ -57,6 +86,9 @@ class IndexScan : public AbstractReadOnlyOperator {
 
   std::vector<ChunkID> _included_chunk_ids;
 
+  IndexScanOutput _output{IndexScanOutput::Positions};
+  std::string _output_column_name;
+
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
 };
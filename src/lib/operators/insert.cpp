@@ -2,13 +2,18 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/base_mutable_index.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table_partitioning.hpp"
 #include "storage/value_segment.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
@@ -24,7 +29,6 @@ class AbstractTypedSegmentProcessor : public Noncopyable {
   AbstractTypedSegmentProcessor(AbstractTypedSegmentProcessor&&) = default;
   AbstractTypedSegmentProcessor& operator=(AbstractTypedSegmentProcessor&&) = default;
   virtual ~AbstractTypedSegmentProcessor() = default;
-  virtual void resize_vector(std::shared_ptr<BaseSegment> segment, size_t new_size) = 0;
   virtual void copy_data(std::shared_ptr<const BaseSegment> source, ChunkOffset source_start_index,
                          std::shared_ptr<BaseSegment> target, ChunkOffset target_start_index, ChunkOffset length) = 0;
 };
@@ -32,18 +36,6 @@ class AbstractTypedSegmentProcessor : public Noncopyable {
 template <typename T>
 class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
  public:
-  void resize_vector(std::shared_ptr<BaseSegment> segment, size_t new_size) override {
-    auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
-    DebugAssert(value_segment, "Cannot insert into non-ValueColumns");
-    auto& values = value_segment->values();
-
-    values.resize(new_size);
-
-    if (value_segment->is_nullable()) {
-      value_segment->null_values().resize(new_size);
-    }
-  }
-
   // this copies
   void copy_data(std::shared_ptr<const BaseSegment> source, ChunkOffset source_start_index,
                  std::shared_ptr<BaseSegment> target, ChunkOffset target_start_index, ChunkOffset length) override {
@@ -56,7 +48,8 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
     if (auto casted_source = std::dynamic_pointer_cast<const ValueSegment<T>>(source)) {
       std::copy_n(casted_source->values().begin() + source_start_index, length, values.begin() + target_start_index);
 
-      if (casted_source->is_nullable()) {
+      // Target rows are not NULL when they are reserved, so only NULLs have to be copied
+      if (casted_source->is_nullable() && !casted_source->null_values().all_valid()) {
         const auto nulls_begin_iter = casted_source->null_values().begin() + source_start_index;
         const auto nulls_end_iter = nulls_begin_iter + length;
 
@@ -78,11 +71,25 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
 
       // Ignore source value and only set null to true
       casted_target->null_values()[target_start_index] = true;
+    } else if (source->data_type() == data_type_from_type<T>()) {
+      // Other segments of the same data type (e.g., ReferenceSegments resulting from an INSERT INTO ... SELECT or
+      // encoded segments) are read with their typed iterators, which avoids boxing each value into an AllTypeVariant.
+      segment_with_iterators<T>(*source, [&](auto source_it, const auto source_end) {
+        source_it += source_start_index;
+        for (auto target_offset = target_start_index; target_offset < target_start_index + length; ++target_offset) {
+          const auto& position = *source_it;
+          if (position.is_null()) {
+            Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
+            casted_target->null_values()[target_offset] = true;
+          } else {
+            values[target_offset] = position.value();
+          }
+          ++source_it;
+        }
+      });
     } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceSegment>(source)){
-      // since we have no guarantee that a ReferenceSegment references only a single other segment,
-      // this would require us to find out the referenced segment's type for each single row.
-      // instead, we just use the slow path below.
+      // The data types of the source and the target differ, so that each value has to be cast. This is slow, but rarely
+      // needed.
       for (auto i = 0u; i < length; i++) {
         auto ref_value = (*source)[source_start_index + i];
         if (variant_is_null(ref_value)) {
@@ -114,117 +121,114 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         make_unique_by_data_type<AbstractTypedSegmentProcessor, TypedSegmentProcessor>(column_type));
   }
 
-  auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
-
-  // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
-  // modifying the table's size simultaneously.
-  auto start_index = 0u;
-  auto start_chunk_id = ChunkID{0};
-  auto end_chunk_id = 0u;
-  {
-    auto scoped_lock = _target_table->acquire_append_mutex();
-
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
-    }
+  // Reserve the rows at the end of the last chunk of the target table (see Chunk::reserve_rows()). Concurrent Inserts
+  // thus write disjoint rows without locking the table. Only if the last chunk is full or immutable, a new chunk is
+  // appended while holding the table's append mutex. Rows of partitioned tables are inserted into the last chunk of
+  // their partition.
+  // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
+  const auto insert_rows = [&](const Table& source_table, const std::optional<PartitionID>& partition_id) {
+    const auto last_chunk_id = [&]() {
+      if (partition_id) return _target_table->last_chunk_id(*partition_id);
+      const auto chunk_count = _target_table->appended_chunk_count();
+      return chunk_count > 0 ? ChunkID{chunk_count - 1} : INVALID_CHUNK_ID;
+    };
 
-    start_chunk_id = _target_table->chunk_count() - 1;
-    end_chunk_id = start_chunk_id + 1;
-    auto last_chunk = _target_table->get_chunk(start_chunk_id);
-    start_index = last_chunk->size();
+    auto remaining_rows = static_cast<uint32_t>(source_table.row_count());
+    auto source_chunk_id = ChunkID{0};
+    auto source_chunk_start_index = 0u;
 
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (!last_chunk->is_mutable()) {
-      _target_table->append_mutable_chunk();
-      end_chunk_id++;
-    }
-
-    auto remaining_rows = total_rows_to_insert;
     while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
-      auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
-
-      // Resize MVCC vectors.
-      current_chunk->get_scoped_mvcc_data_lock()->grow_by(rows_to_insert_this_loop, MvccData::MAX_COMMIT_ID);
+      const auto target_chunk_id = last_chunk_id();
+      const auto target_chunk =
+          target_chunk_id != INVALID_CHUNK_ID ? _target_table->get_chunk(target_chunk_id) : nullptr;
 
-      // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
-      for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
-        typed_segment_processors[column_id]->resize_vector(current_chunk->get_segment(column_id),
-                                                           old_size + rows_to_insert_this_loop);
+      auto reserved_rows = std::pair<ChunkOffset, ChunkOffset>{0u, 0u};
+      if (target_chunk && target_chunk->is_mutable()) {
+        reserved_rows = target_chunk->reserve_rows(remaining_rows, _target_table->max_chunk_size());
       }
+      const auto [start_index, num_rows_to_insert] = reserved_rows;
 
-      remaining_rows -= rows_to_insert_this_loop;
+      if (num_rows_to_insert == 0) {
+        auto scoped_lock = _target_table->acquire_append_mutex();
+        // Another Insert might have appended a new chunk in the meantime
+        if (last_chunk_id() == target_chunk_id) _target_table->append_mutable_chunk(partition_id);
+        continue;
+      }
 
-      // Create new chunk if necessary.
-      if (remaining_rows > 0) {
-        _target_table->append_mutable_chunk();
-        end_chunk_id++;
+      // Copy the values into the reserved rows
+      auto target_start_index = start_index;
+      auto still_to_insert = num_rows_to_insert;
+      while (still_to_insert > 0) {
+        const auto source_chunk = source_table.get_chunk(source_chunk_id);
+        auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
+        for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
+          const auto& source_segment = source_chunk->get_segment(column_id);
+          typed_segment_processors[column_id]->copy_data(source_segment, source_chunk_start_index,
+                                                         target_chunk->get_segment(column_id), target_start_index,
+                                                         num_to_insert);
+        }
+        still_to_insert -= num_to_insert;
+        target_start_index += num_to_insert;
+        source_chunk_start_index += num_to_insert;
+
+        bool source_chunk_depleted = source_chunk_start_index == source_chunk->size();
+        if (source_chunk_depleted) {
+          source_chunk_id++;
+          source_chunk_start_index = 0u;
+        }
       }
-    }
-  }
-  // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
-  // Then, actually insert the data.
-  auto input_offset = 0u;
-  auto source_chunk_id = ChunkID{0};
-  auto source_chunk_start_index = 0u;
-
-  for (auto target_chunk_id = start_chunk_id; target_chunk_id < end_chunk_id; target_chunk_id++) {
-    auto target_chunk = _target_table->get_chunk(target_chunk_id);
-
-    const auto current_num_rows_to_insert =
-        std::min(target_chunk->size() - start_index, total_rows_to_insert - input_offset);
-
-    auto target_start_index = start_index;
-    auto still_to_insert = current_num_rows_to_insert;
-
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
-      const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
-      auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
-      for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
-        const auto& source_segment = source_chunk->get_segment(column_id);
-        typed_segment_processors[column_id]->copy_data(source_segment, source_chunk_start_index,
-                                                       target_chunk->get_segment(column_id), target_start_index,
-                                                       num_to_insert);
+      // Deleted rows and rows of rolled back inserts are not removed from table-level or mutable indexes, Validate
+      // filters them
+      for (const auto& table_index : _target_table->table_indexes()) {
+        table_index->insert(target_chunk_id, *target_chunk->get_segment(table_index->column_id()), start_index,
+                            start_index + num_rows_to_insert);
       }
-      still_to_insert -= num_to_insert;
-      target_start_index += num_to_insert;
-      source_chunk_start_index += num_to_insert;
-
-      bool source_chunk_depleted = source_chunk_start_index == source_chunk->size();
-      if (source_chunk_depleted) {
-        source_chunk_id++;
-        source_chunk_start_index = 0u;
+      for (const auto& mutable_index : target_chunk->mutable_indexes()) {
+        mutable_index->insert(*target_chunk->get_segment(mutable_index->column_id()), start_index,
+                              start_index + num_rows_to_insert);
       }
-    }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
-      // we do not need to check whether other operators have locked the rows, we have just created them
-      // and they are not visible for other operators.
-      // the transaction IDs are set here and not during the resize, because
-      // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
-      // deleted.
-      target_chunk->get_scoped_mvcc_data_lock()->tids[i] = context->transaction_id();
-      _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+      for (auto i = start_index; i < start_index + num_rows_to_insert; i++) {
+        // we do not need to check whether other operators have locked the rows, we have just created them
+        // and they are not visible for other operators.
+        // the transaction IDs are set here and not during the resize, because
+        // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
+        // deleted.
+        target_chunk->get_scoped_mvcc_data_lock()->tids[i] = context->transaction_id();
+        _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+      }
+
+      remaining_rows -= num_rows_to_insert;
     }
+  };
 
-    input_offset += current_num_rows_to_insert;
-    start_index = 0u;
+  if (const auto partitioning = _target_table->partitioning()) {
+    const auto partitions = split_by_partition(input_table_left(), partitioning->column_id(), *partitioning);
+    for (auto partition_id = PartitionID{0}; partition_id < partitions.size(); ++partition_id) {
+      insert_rows(*partitions[partition_id], partition_id);
+    }
+  } else {
+    insert_rows(*input_table_left(), std::nullopt);
   }
 
   return nullptr;
 }
 
+void Insert::log_changes(WriteAheadLog::TransactionChanges& changes) const {
+  changes.inserted_rows.push_back({_target_table, &_inserted_rows});
+}
+
 void Insert::_on_commit_records(const CommitID cid) {
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
 
     auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
-    mvcc_data->begin_cids[row_id.chunk_offset] = cid;
+    mvcc_data->set_begin_cid(row_id.chunk_offset, cid);
     mvcc_data->tids[row_id.chunk_offset] = 0u;
   }
+
+  _target_table->update_last_modification_commit_id(cid);
 }
 
 void Insert::_on_rollback_records() {
@@ -232,11 +236,15 @@ void Insert::_on_rollback_records() {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
-    chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = 0u;
+    chunk->get_scoped_mvcc_data_lock()->set_end_cid(row_id.chunk_offset, 0u);
     std::atomic_thread_fence(std::memory_order_release);
-    chunk->get_scoped_mvcc_data_lock()->begin_cids[row_id.chunk_offset] = 0u;
+    chunk->get_scoped_mvcc_data_lock()->set_begin_cid(row_id.chunk_offset, 0u);
 
     chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
+    chunk->get_scoped_mvcc_data_lock()->has_invalidated_rows = true;
+
+    // The row will never become visible, so that it counts towards the invalidated rows, just like deleted ones
+    chunk->increase_invalid_row_count(1);
   }
 }
 
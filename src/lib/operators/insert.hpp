@@ -27,6 +27,8 @@ class Insert : public AbstractReadWriteOperator {
 
   const std::string name() const override;
 
+  void log_changes(WriteAheadLog::TransactionChanges& changes) const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -0,0 +1,31 @@
+#include "intersect.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+Intersect::Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+                     const std::shared_ptr<const AbstractOperator>& right_in, const SetOperationMode mode)
+    : AbstractSetOperator(OperatorType::Intersect, left_in, right_in, mode) {}
+
+const std::string Intersect::name() const { return "Intersect"; }
+
+std::shared_ptr<AbstractOperator> Intersect::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Intersect>(copied_input_left, copied_input_right, _mode);
+}
+
+bool Intersect::_keep_row(const size_t left_occurrence, const size_t right_count) const {
+  switch (_mode) {
+    case SetOperationMode::Unique:
+      return left_occurrence == 0 && right_count > 0;
+    case SetOperationMode::All:
+      return left_occurrence < right_count;
+  }
+  Fail("GCC thinks this is reachable");
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_set_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Computes left INTERSECT right (SetOperationMode::Unique) or left INTERSECT ALL right (SetOperationMode::All), i.e.,
+ * with SetOperationMode::All, a row that occurs n times in the left and m times in the right input occurs min(n, m)
+ * times in the output. See AbstractSetOperator for the algorithm.
+ */
+class Intersect : public AbstractSetOperator {
+ public:
+  Intersect(const std::shared_ptr<const AbstractOperator>& left_in,
+            const std::shared_ptr<const AbstractOperator>& right_in, const SetOperationMode mode);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  bool _keep_row(const size_t left_occurrence, const size_t right_count) const override;
+};
+}  // namespace opossum
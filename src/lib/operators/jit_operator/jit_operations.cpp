@@ -1,5 +1,7 @@
 #include "jit_operations.hpp"
 
+#include <regex>
+
 namespace opossum {
 
 #define JIT_HASH_CASE(r, types)                      \
@@ -15,6 +17,14 @@ namespace opossum {
   case JIT_GET_ENUM_VALUE(0, types): \
     return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(context), to_index, context);
 
+#define JIT_JOIN_EQUALS_CASE(r, types) \
+  case JIT_GET_ENUM_VALUE(0, types):   \
+    return lhs.get<JIT_GET_DATA_TYPE(0, types)>(context) == rhs.get<JIT_GET_DATA_TYPE(0, types)>(rhs_index);
+
+#define JIT_ASSIGN_FROM_VECTOR_CASE(r, types) \
+  case JIT_GET_ENUM_VALUE(0, types):          \
+    return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(from_index), context);
+
 #define JIT_GROW_BY_ONE_CASE(r, types)                                                                     \
   case JIT_GET_ENUM_VALUE(0, types):                                                                       \
     return context.hashmap.columns[hashmap_entry.column_index()].grow_by_one<JIT_GET_DATA_TYPE(0, types)>( \
@@ -150,6 +160,10 @@ std::optional<bool> jit_is_null(const JitExpression& left_side, JitRuntimeContex
     BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_IS_NULL_CASE, (JIT_DATA_TYPE_INFO))
     case DataType::Null:
       return true;
+    case DataType::Date:
+    case DataType::Timestamp:
+    case DataType::Decimal:
+      Fail("Dates, Timestamps, and Decimals are not supported by the JIT");
   }
 }
 
@@ -160,6 +174,10 @@ std::optional<bool> jit_is_not_null(const JitExpression& left_side, JitRuntimeCo
     BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_IS_NOT_NULL_CASE, (JIT_DATA_TYPE_INFO))
     case DataType::Null:
       return false;
+    case DataType::Date:
+    case DataType::Timestamp:
+    case DataType::Decimal:
+      Fail("Dates, Timestamps, and Decimals are not supported by the JIT");
   }
 }
 
@@ -220,6 +238,33 @@ void jit_assign(const JitTupleEntry& from, const JitHashmapEntry& to, const size
   }
 }
 
+bool jit_join_equals(const JitTupleEntry& lhs, const JitVariantVector& rhs, const size_t rhs_index,
+                     JitRuntimeContext& context) {
+  switch (lhs.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_JOIN_EQUALS_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      return false;
+  }
+}
+
+void jit_assign(const JitVariantVector& from, const size_t from_index, const JitTupleEntry& to,
+                JitRuntimeContext& context) {
+  if (to.is_nullable()) {
+    const bool is_null = from.is_null(from_index);
+    to.set_is_null(is_null, context);
+    // The value is NULL - our work is done here.
+    if (is_null) {
+      return;
+    }
+  }
+
+  switch (to.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_ASSIGN_FROM_VECTOR_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      break;
+  }
+}
+
 size_t jit_grow_by_one(const JitHashmapEntry& hashmap_entry, const JitVariantVector::InitialValue initial_value,
                        JitRuntimeContext& context) {
   switch (hashmap_entry.data_type()) {
@@ -233,6 +278,8 @@ size_t jit_grow_by_one(const JitHashmapEntry& hashmap_entry, const JitVariantVec
 #undef JIT_HASH_CASE
 #undef JIT_AGGREGATE_EQUALS_CASE
 #undef JIT_ASSIGN_CASE
+#undef JIT_JOIN_EQUALS_CASE
+#undef JIT_ASSIGN_FROM_VECTOR_CASE
 #undef JIT_GROW_BY_ONE_CASE
 #undef JIT_IS_NULL_CASE
 #undef JIT_IS_NOT_NULL_CASE
@@ -265,6 +265,14 @@ __attribute__((noinline)) bool jit_aggregate_equals(const JitTupleEntry& lhs, co
 __attribute__((noinline)) void jit_assign(const JitTupleEntry& from, const JitHashmapEntry& to, const size_t to_index,
                                           JitRuntimeContext& context);
 
+// Compares a JitTupleEntry to a non-NULL value of a JitVariantVector. Both values MUST be of the same data type.
+__attribute__((noinline)) bool jit_join_equals(const JitTupleEntry& lhs, const JitVariantVector& rhs,
+                                               const size_t rhs_index, JitRuntimeContext& context);
+
+// Copies a value of a JitVariantVector to a JitTupleEntry. Both values MUST be of the same data type.
+__attribute__((noinline)) void jit_assign(const JitVariantVector& from, const size_t from_index,
+                                          const JitTupleEntry& to, JitRuntimeContext& context);
+
 // Adds an element to a column represented by some JitHashmapEntry
 __attribute__((noinline)) size_t jit_grow_by_one(const JitHashmapEntry& hashmap_entry,
                                                  const JitVariantVector::InitialValue initial_value,
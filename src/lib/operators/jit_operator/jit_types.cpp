@@ -48,7 +48,7 @@ void JitVariantVector::resize(const size_t new_size) {
   _is_null.resize(new_size);
 }
 
-bool JitVariantVector::is_null(const size_t index) { return _is_null[index]; }
+bool JitVariantVector::is_null(const size_t index) const { return _is_null[index]; }
 
 void JitVariantVector::set_is_null(const size_t index, const bool is_null) { _is_null[index] = is_null; }
 
@@ -97,7 +97,7 @@ class JitVariantVector {
   __attribute__((optnone)) void set(const size_t index, const pmr_string& value);
   template <typename T, typename = typename std::enable_if_t<std::is_scalar_v<T>>>
   void set(const size_t index, const T& value);
-  bool is_null(const size_t index);
+  bool is_null(const size_t index) const;
   void set_is_null(const size_t index, const bool is_null);
 
   // Adds an element to the internal vector for the specified data type.
@@ -142,6 +142,9 @@ struct JitRuntimeContext {
   std::vector<std::shared_ptr<BaseJitSegmentReader>> inputs;
   std::vector<std::shared_ptr<BaseJitSegmentWriter>> outputs;
   JitRuntimeHashmap hashmap;
+  // One hashmap per JitHashJoinProbe, indexed by its build input. The hashmaps are only read while tuples are consumed
+  // and can thus be shared by the contexts of chunks that are processed in parallel.
+  std::vector<std::shared_ptr<const JitRuntimeHashmap>> join_hashmaps;
   Segments out_chunk;
 
   // Required by JitLimit operator
@@ -155,6 +158,10 @@ struct JitRuntimeContext {
   TransactionID transaction_id;
   CommitID snapshot_commit_id;
 
+  // Whether all rows of the current input chunk (or of the chunk it references) are visible, so that JitValidate does
+  // not need to look at the MVCC data. See Validate::is_entire_chunk_visible().
+  bool entire_chunk_is_visible{false};
+
   // MVCC data from the current input chunk required by JitValidate
   // If the input table is a data table, its MVCC data is used.
   std::shared_ptr<MvccData> mvcc_data;
@@ -34,6 +34,11 @@ class AbstractJittableSink : public AbstractJittable {
   // It is used to create a new chunk in the output table for each input chunk.
   virtual void after_chunk(const std::shared_ptr<const Table>& in_table, Table& out_table,
                            JitRuntimeContext& context) const {}
+
+  // This function is called by the JitOperatorWrapper if the chunks have been pushed through the pipeline in parallel,
+  // each with its own context. After after_chunk() has been called for the chunk, it merges the state kept in the
+  // context of the chunk into the context that is passed to after_query(). The chunks are merged in order.
+  virtual void merge_context(JitRuntimeContext& context, JitRuntimeContext& chunk_context) const {}
 };
 
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #include "jit_aggregate.hpp"
 
+#include <algorithm>
+
 #include "constant_mappings.hpp"
 #include "operators/jit_operator/jit_operations.hpp"
 #include "resolve_type.hpp"
@@ -184,6 +186,127 @@ DataType get_sum_data_type(const DataType data_type) {
 
 }  // namespace
 
+void JitAggregate::merge_context(JitRuntimeContext& context, JitRuntimeContext& chunk_context) const {
+  auto& hashmap = context.hashmap;
+  auto& chunk_hashmap = chunk_context.hashmap;
+
+  // The groups are merged in the order of their creation, so that the order of the output rows is the same as if all
+  // chunks had been processed with a single context.
+  auto group_count = size_t{0};
+  for (const auto& [hash, indices] : hashmap.indices) {
+    group_count += indices.size();
+  }
+  auto chunk_group_hashes = std::vector<uint64_t>{};
+  for (const auto& [hash, chunk_indices] : chunk_hashmap.indices) {
+    for (const auto chunk_index : chunk_indices) {
+      if (chunk_group_hashes.size() <= chunk_index) chunk_group_hashes.resize(chunk_index + 1);
+      chunk_group_hashes[chunk_index] = hash;
+    }
+  }
+
+  // NULL == NULL when grouping tuples
+  const auto groups_equal = [&](const size_t index, const size_t chunk_index) {
+    for (const auto& column : _groupby_columns) {
+      auto& values = hashmap.columns[column.hashmap_entry.column_index()];
+      auto& chunk_values = chunk_hashmap.columns[column.hashmap_entry.column_index()];
+      if (column.hashmap_entry.is_nullable()) {
+        const auto is_null = values.is_null(index);
+        if (is_null != chunk_values.is_null(chunk_index)) return false;
+        if (is_null) continue;
+      }
+
+      auto values_equal = false;
+      resolve_data_type(column.hashmap_entry.data_type(), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        values_equal = values.template get_vector<ColumnDataType>()[index] ==
+                       chunk_values.template get_vector<ColumnDataType>()[chunk_index];
+      });
+      if (!values_equal) return false;
+    }
+    return true;
+  };
+
+  const auto append_value = [&](const JitHashmapEntry& hashmap_entry, const size_t chunk_index) {
+    auto& values = hashmap.columns[hashmap_entry.column_index()];
+    auto& chunk_values = chunk_hashmap.columns[hashmap_entry.column_index()];
+    resolve_data_type(hashmap_entry.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      values.template get_vector<ColumnDataType>().emplace_back(
+          chunk_values.template get_vector<ColumnDataType>()[chunk_index]);
+    });
+    values.get_is_null_vector().emplace_back(chunk_values.is_null(chunk_index));
+  };
+
+  const auto merge_aggregate = [&](const JitHashmapEntry& hashmap_entry, const AggregateFunction function,
+                                   const size_t index, const size_t chunk_index) {
+    auto& values = hashmap.columns[hashmap_entry.column_index()];
+    auto& chunk_values = chunk_hashmap.columns[hashmap_entry.column_index()];
+
+    // NULL aggregates have not seen any value yet
+    const auto chunk_value_is_null = hashmap_entry.is_nullable() && chunk_values.is_null(chunk_index);
+    if (chunk_value_is_null) return;
+    const auto value_is_null = hashmap_entry.is_nullable() && values.is_null(index);
+    if (value_is_null) values.set_is_null(index, false);
+
+    resolve_data_type(hashmap_entry.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto& value = values.template get_vector<ColumnDataType>()[index];
+      const auto& chunk_value = chunk_values.template get_vector<ColumnDataType>()[chunk_index];
+      if (value_is_null) {
+        value = chunk_value;
+        return;
+      }
+
+      switch (function) {
+        case AggregateFunction::Count:
+        case AggregateFunction::Sum:
+        case AggregateFunction::Avg:
+          if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+            value += chunk_value;
+          } else {
+            Fail("Invalid aggregate");
+          }
+          break;
+        case AggregateFunction::Max:
+          value = std::max(value, chunk_value);
+          break;
+        case AggregateFunction::Min:
+          value = std::min(value, chunk_value);
+          break;
+        case AggregateFunction::CountDistinct:
+        case AggregateFunction::ApproxCountDistinct:
+          Fail("Aggregate function count distinct not supported");
+      }
+    });
+  };
+
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_group_hashes.size(); ++chunk_index) {
+    auto& hash_bucket = hashmap.indices[chunk_group_hashes[chunk_index]];
+    const auto match = std::find_if(hash_bucket.cbegin(), hash_bucket.cend(),
+                                    [&](const auto index) { return groups_equal(index, chunk_index); });
+
+    if (match == hash_bucket.cend()) {
+      // The group does not exist yet and is copied as a whole
+      for (const auto& column : _groupby_columns) {
+        append_value(column.hashmap_entry, chunk_index);
+      }
+      for (const auto& column : _aggregate_columns) {
+        append_value(column.hashmap_entry, chunk_index);
+        if (column.hashmap_count_for_avg) append_value(*column.hashmap_count_for_avg, chunk_index);
+      }
+      hash_bucket.emplace_back(group_count++);
+      continue;
+    }
+
+    for (const auto& column : _aggregate_columns) {
+      merge_aggregate(column.hashmap_entry, column.function, *match, chunk_index);
+      if (column.hashmap_count_for_avg) {
+        merge_aggregate(*column.hashmap_count_for_avg, AggregateFunction::Count, *match, chunk_index);
+      }
+    }
+  }
+}
+
 void JitAggregate::add_aggregate_column(const std::string& column_name, const JitTupleEntry& tuple_entry,
                                         const AggregateFunction function) {
   auto column_position = _aggregate_columns.size() + _groupby_columns.size();
@@ -218,6 +341,7 @@ void JitAggregate::add_aggregate_column(const std::string& column_name, const Ji
                              JitHashmapEntry(DataType::Long, false, _num_hashmap_columns++)});
       break;
     case AggregateFunction::CountDistinct:
+    case AggregateFunction::ApproxCountDistinct:
       Fail("Aggregate function count distinct not supported");
   }
 }
@@ -312,7 +436,8 @@ void JitAggregate::_consume(JitRuntimeContext& context) const {
           jit_grow_by_one(_aggregate_columns[i].hashmap_count_for_avg.value(), JitVariantVector::InitialValue::Zero,
                           context);
           break;
-        case AggregateFunction::CountDistinct: {
+        case AggregateFunction::CountDistinct:
+        case AggregateFunction::ApproxCountDistinct: {
           Fail("Aggregate function count distinct not supported");
         }
       }
@@ -349,7 +474,8 @@ void JitAggregate::_consume(JitRuntimeContext& context) const {
         jit_aggregate_compute(jit_increment, _aggregate_columns[i].tuple_entry,
                               _aggregate_columns[i].hashmap_count_for_avg.value(), row_index, context);
         break;
-      case AggregateFunction::CountDistinct: {
+      case AggregateFunction::CountDistinct:
+      case AggregateFunction::ApproxCountDistinct: {
         Fail("Aggregate function count distinct not supported");
       }
     }
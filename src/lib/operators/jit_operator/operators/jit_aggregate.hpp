@@ -71,6 +71,10 @@ class JitAggregate : public AbstractJittableSink {
   // This is used to perform the post-processing for average aggregates and to build the final output table.
   void after_query(Table& out_table, JitRuntimeContext& context) const final;
 
+  // Is called by the JitOperatorWrapper if chunks are processed in parallel.
+  // Adds the groups and aggregates of the chunk's hashmap to the hashmap of the context.
+  void merge_context(JitRuntimeContext& context, JitRuntimeContext& chunk_context) const final;
+
   // Adds an aggregate to the operator that is to be computed on tuple groups.
   void add_aggregate_column(const std::string& column_name, const JitTupleEntry& tuple_entry,
                             const AggregateFunction function);
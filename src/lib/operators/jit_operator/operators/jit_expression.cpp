@@ -111,6 +111,10 @@ void JitExpression::compute_and_store(JitRuntimeContext& context) const {
     BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_EXPRESSION_COMPUTE_CASE, (JIT_DATA_TYPE_INFO))
     case DataType::Null:
       break;
+    case DataType::Date:
+    case DataType::Timestamp:
+    case DataType::Decimal:
+      Fail("Dates, Timestamps, and Decimals are not supported by the JIT");
   }
 }
 
@@ -0,0 +1,116 @@
+#include "jit_hash_join_probe.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+#include "../jit_operations.hpp"
+#include "jit_read_tuples.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+JitHashJoinProbe::JitHashJoinProbe(const size_t build_input_idx, const JitTupleEntry& probe_key,
+                                   const ColumnID build_key_column_id)
+    : _build_input_idx{build_input_idx}, _probe_key{probe_key}, _build_key_column_id{build_key_column_id} {}
+
+std::string JitHashJoinProbe::description() const {
+  std::stringstream desc;
+  desc << "[HashJoinProbe] x" << _probe_key.tuple_index() << " = Build#" << _build_input_idx << ".Column#"
+       << _build_key_column_id << ", ";
+  for (const auto& build_column : _build_columns) {
+    desc << "x" << build_column.tuple_entry.tuple_index() << " = Build#" << _build_input_idx << ".Column#"
+         << build_column.column_id << ", ";
+  }
+  return desc.str();
+}
+
+void JitHashJoinProbe::before_query(const Table& build_table, JitRuntimeContext& context) const {
+  auto hashmap = JitRuntimeHashmap{};
+
+  // The first hashmap column holds the join keys, the others the requested build columns
+  hashmap.columns.resize(_build_columns.size() + 1);
+
+  const auto row_count = build_table.row_count();
+
+  const auto materialize_column = [&](const ColumnID column_id, JitVariantVector& column, const bool is_key) {
+    column.resize(row_count);
+
+    resolve_data_type(build_table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto row_idx = size_t{0};
+      for (auto chunk_id = ChunkID{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+        const auto& segment = *build_table.get_chunk(chunk_id)->get_segment(column_id);
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          column.set_is_null(row_idx, position.is_null());
+          if (!position.is_null()) {
+            column.set<ColumnDataType>(row_idx, position.value());
+            // Rows with NULL keys never find a join partner and are thus not added to the hashmap. The hash has to
+            // match the one computed by jit_hash().
+            if (is_key) hashmap.indices[std::hash<ColumnDataType>()(position.value())].emplace_back(row_idx);
+          }
+          ++row_idx;
+        });
+      }
+    });
+  };
+
+  materialize_column(_build_key_column_id, hashmap.columns[0], true);
+  for (auto build_column_idx = size_t{0}; build_column_idx < _build_columns.size(); ++build_column_idx) {
+    materialize_column(_build_columns[build_column_idx].column_id, hashmap.columns[build_column_idx + 1], false);
+  }
+
+  if (context.join_hashmaps.size() <= _build_input_idx) context.join_hashmaps.resize(_build_input_idx + 1);
+  context.join_hashmaps[_build_input_idx] = std::make_shared<const JitRuntimeHashmap>(std::move(hashmap));
+}
+
+JitTupleEntry JitHashJoinProbe::add_build_column(const ColumnID column_id, const DataType data_type,
+                                                 const bool is_nullable, JitReadTuples& jit_source) {
+  // There is no need to add the same build column twice.
+  const auto it = std::find_if(_build_columns.begin(), _build_columns.end(),
+                               [&column_id](const auto& build_column) { return build_column.column_id == column_id; });
+  if (it != _build_columns.end()) {
+    return it->tuple_entry;
+  }
+
+  const auto tuple_entry = JitTupleEntry{data_type, is_nullable, jit_source.add_temporary_value()};
+  _build_columns.push_back({column_id, tuple_entry});
+  return tuple_entry;
+}
+
+size_t JitHashJoinProbe::build_input_idx() const { return _build_input_idx; }
+
+const JitTupleEntry& JitHashJoinProbe::probe_key() const { return _probe_key; }
+
+ColumnID JitHashJoinProbe::build_key_column_id() const { return _build_key_column_id; }
+
+const std::vector<JitBuildColumn>& JitHashJoinProbe::build_columns() const { return _build_columns; }
+
+void JitHashJoinProbe::_consume(JitRuntimeContext& context) const {
+  // We use index-based for loops in this function, since the LLVM optimizer is not able to properly unroll range-based
+  // loops, and we need the unrolling for proper specialization (see JitAggregate).
+
+  if (_probe_key.is_null(context)) return;
+
+  const auto& hashmap = *context.join_hashmaps[_build_input_idx];
+  const auto hash_bucket = hashmap.indices.find(jit_hash(_probe_key, context));
+  if (hash_bucket == hashmap.indices.end()) return;
+
+  const auto num_build_columns = _build_columns.size();
+
+  // The number of build rows per hash depends on the data and is thus not specializable
+  for (const auto& row_idx : hash_bucket->second) {
+    // Skip hash collisions
+    if (!jit_join_equals(_probe_key, hashmap.columns[0], row_idx, context)) continue;
+
+    for (uint32_t build_column_idx = 0; build_column_idx < num_build_columns; ++build_column_idx) {
+      jit_assign(hashmap.columns[build_column_idx + 1], row_idx, _build_columns[build_column_idx].tuple_entry,
+                 context);
+    }
+    _emit(context);
+  }
+}
+
+}  // namespace opossum
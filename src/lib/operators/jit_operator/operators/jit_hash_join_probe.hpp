@@ -0,0 +1,58 @@
+#pragma once
+
+#include "abstract_jittable.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JitReadTuples;
+
+struct JitBuildColumn {
+  ColumnID column_id;
+  JitTupleEntry tuple_entry;
+};
+
+/* The JitHashJoinProbe operator performs the probe phase of an inner equi-join within an operator chain. This allows
+ * the JitOperatorWrapper to fuse a scan with a number of joins and a subsequent aggregate (e.g., of a star join) into
+ * a single loop without materializing the intermediate join results.
+ *
+ * The build side is a separate input of the JitOperatorWrapper (identified by the build_input_idx), which is
+ * executed before the pipeline. Before any tuple is consumed, the operator materializes the join key and all
+ * requested columns of the build input into a JitRuntimeHashmap, which maps the hashes of the keys to the build rows.
+ * For each consumed tuple, the probe key is hashed and looked up in the hashmap. For each build row with an equal key,
+ * the requested build columns are written to the runtime tuple and the tuple is emitted. Thus, a tuple with multiple
+ * join partners is emitted multiple times and a tuple without join partners is not emitted at all.
+ * NULL keys never find a join partner.
+ *
+ * The probe key and the build key must be of the same data type.
+ */
+class JitHashJoinProbe : public AbstractJittable {
+ public:
+  JitHashJoinProbe(const size_t build_input_idx, const JitTupleEntry& probe_key, const ColumnID build_key_column_id);
+
+  std::string description() const final;
+
+  // Is called by the JitOperatorWrapper with the output of the build input before any tuple is consumed.
+  // Builds the hashmap of the build side.
+  void before_query(const Table& build_table, JitRuntimeContext& context) const;
+
+  // Requests a column of the build input that is written to the runtime tuple for each join partner. The returned
+  // JitTupleEntry identifies the value in the runtime tuple.
+  JitTupleEntry add_build_column(const ColumnID column_id, const DataType data_type, const bool is_nullable,
+                                 JitReadTuples& jit_source);
+
+  size_t build_input_idx() const;
+  const JitTupleEntry& probe_key() const;
+  ColumnID build_key_column_id() const;
+  const std::vector<JitBuildColumn>& build_columns() const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  const size_t _build_input_idx;
+  const JitTupleEntry _probe_key;
+  const ColumnID _build_key_column_id;
+  std::vector<JitBuildColumn> _build_columns;
+};
+
+}  // namespace opossum
@@ -1,7 +1,10 @@
 #include "jit_read_tuples.hpp"
 
+#include <algorithm>
+
 #include "../jit_types.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
+#include "operators/validate.hpp"
 #include "resolve_type.hpp"
 #include "storage/segment_iterate.hpp"
 
@@ -85,11 +88,19 @@ void JitReadTuples::before_chunk(const Table& in_table, const ChunkID chunk_id,
   // Not related to reading tuples - set MVCC in context if JitValidate operator is used.
   if (_has_validate) {
     if (in_chunk.has_mvcc_data()) {
+      context.entire_chunk_is_visible = Validate::is_entire_chunk_visible(in_chunk, context.snapshot_commit_id);
+
       // materialize atomic transaction ids as specialization cannot handle atomics
-      context.row_tids.resize(in_chunk.mvcc_data()->tids.size());
-      auto itr = context.row_tids.begin();
-      for (const auto& tid : in_chunk.mvcc_data()->tids) {
-        *itr++ = tid.load();
+      if (!context.entire_chunk_is_visible) {
+        context.row_tids.resize(in_chunk.mvcc_data()->tids.size());
+        auto itr = context.row_tids.begin();
+        for (const auto& tid : in_chunk.mvcc_data()->tids) {
+          *itr++ = tid.load();
+        }
+
+        // The tid of a chunk that is locked as a whole replaces those of its rows
+        const auto chunk_tid = in_chunk.mvcc_data()->chunk_tid.load();
+        if (chunk_tid != 0) std::fill(context.row_tids.begin(), context.row_tids.end(), chunk_tid);
       }
       // Lock MVCC data before accessing it.
       context.mvcc_data_lock = std::make_unique<SharedScopedLockingPtr<MvccData>>(in_chunk.get_scoped_mvcc_data_lock());
@@ -100,6 +111,12 @@ void JitReadTuples::before_chunk(const Table& in_table, const ChunkID chunk_id,
       const auto& ref_col_in = std::dynamic_pointer_cast<const ReferenceSegment>(in_chunk.get_segment(ColumnID{0}));
       context.referenced_table = ref_col_in->referenced_table();
       context.pos_list = ref_col_in->pos_list();
+
+      const auto& pos_list = *context.pos_list;
+      context.entire_chunk_is_visible =
+          pos_list.references_single_chunk() && !pos_list.empty() &&
+          Validate::is_entire_chunk_visible(*context.referenced_table->get_chunk(pos_list.common_chunk_id()),
+                                            context.snapshot_commit_id);
     }
   }
 
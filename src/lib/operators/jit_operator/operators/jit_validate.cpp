@@ -9,8 +9,8 @@ namespace {
 
 bool is_row_visible(const CommitID our_tid, const TransactionID row_tid, const CommitID snapshot_commit_id,
                     const ChunkOffset chunk_offset, const MvccData& mvcc_data) {
-  const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
-  const auto end_cid = mvcc_data.end_cids[chunk_offset];
+  const auto begin_cid = mvcc_data.get_begin_cid(chunk_offset);
+  const auto end_cid = mvcc_data.get_end_cid(chunk_offset);
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
@@ -23,11 +23,16 @@ std::string JitValidate::description() const { return "[Validate]"; }
 void JitValidate::set_input_table_type(const TableType input_table_type) { _input_table_type = input_table_type; }
 
 void JitValidate::_consume(JitRuntimeContext& context) const {
+  if (context.entire_chunk_is_visible) {
+    _emit(context);
+    return;
+  }
+
   if (_input_table_type == TableType::References) {
     const auto row_id = (*context.pos_list)[context.chunk_offset];
     const auto& referenced_chunk = context.referenced_table->get_chunk(row_id.chunk_id);
     const auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
-    const auto row_tid = _load_atomic_value(mvcc_data->tids[row_id.chunk_offset]);
+    const auto row_tid = _load_row_tid(*mvcc_data, row_id.chunk_offset);
     if (is_row_visible(context.transaction_id, row_tid, context.snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
       _emit(context);
     }
@@ -40,8 +45,8 @@ void JitValidate::_consume(JitRuntimeContext& context) const {
   }
 }
 
-TransactionID JitValidate::_load_atomic_value(const copyable_atomic<TransactionID>& transaction_id) {
-  return transaction_id.load();
+TransactionID JitValidate::_load_row_tid(const MvccData& mvcc_data, const ChunkOffset chunk_offset) {
+  return mvcc_data.get_tid(chunk_offset);
 }
 
 }  // namespace opossum
@@ -6,6 +6,8 @@
 
 namespace opossum {
 
+struct MvccData;
+
 /* The JitValidate operator validates visibility of tuples
  * within the context of a given transaction
  */
@@ -22,8 +24,8 @@ class JitValidate : public AbstractJittable {
 
  private:
   // Function not optimized due to specialization issues with atomic
-  __attribute__((optnone)) static TransactionID _load_atomic_value(
-      const copyable_atomic<TransactionID>& transaction_id);
+  __attribute__((optnone)) static TransactionID _load_row_tid(const MvccData& mvcc_data,
+                                                              const ChunkOffset chunk_offset);
 
   TableType _input_table_type;
 };
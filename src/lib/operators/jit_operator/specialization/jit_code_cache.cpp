@@ -0,0 +1,123 @@
+#include "jit_code_cache.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <typeinfo>
+
+#include "constant_mappings.hpp"
+#include "operators/jit_operator/operators/jit_aggregate.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void describe_tuple_entry(std::stringstream& key, const JitTupleEntry& tuple_entry) {
+  key << "x" << tuple_entry.tuple_index() << ":" << data_type_to_string.left.at(tuple_entry.data_type())
+      << (tuple_entry.is_nullable() ? "?" : "") << ",";
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const JitCodeCache::Entry> JitCodeCache::get_or_specialize(
+    const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators, const TableType input_table_type) {
+  const auto cache_key = key(jit_operators, input_table_type);
+
+  std::lock_guard<std::mutex> specialization_lock(_specialization_mutex);
+  {
+    std::lock_guard<std::mutex> entries_lock(_entries_mutex);
+    const auto entry_iter = _entries.find(cache_key);
+    if (entry_iter != _entries.end()) return entry_iter->second;
+  }
+
+  const auto source = std::dynamic_pointer_cast<JitReadTuples>(jit_operators.front());
+  Assert(source, "JitCodeCache requires a JitReadTuples operator as source.");
+
+  auto entry = std::make_shared<Entry>();
+  entry->jit_operators = jit_operators;
+  entry->specializer = std::make_unique<JitCodeSpecializer>();
+
+  // We want to perform two specialization passes if the operator chain contains a JitAggregate or JitHashJoinProbe
+  // operator, since these operators contain multiple loops that need unrolling.
+  const auto two_specialization_passes =
+      std::dynamic_pointer_cast<JitAggregate>(jit_operators.back()) ||
+      std::any_of(jit_operators.begin(), jit_operators.end(), [](const auto& jit_operator) {
+        return static_cast<bool>(std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operator));
+      });
+
+  // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
+  entry->execute_func =
+      entry->specializer->specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+          "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+          std::make_shared<JitConstantRuntimePointer>(source.get()), two_specialization_passes);
+
+  std::lock_guard<std::mutex> entries_lock(_entries_mutex);
+  _entries.emplace(cache_key, entry);
+  return entry;
+}
+
+std::shared_ptr<const JitCodeCache::Entry> JitCodeCache::try_get(
+    const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators, const TableType input_table_type) const {
+  const auto cache_key = key(jit_operators, input_table_type);
+
+  std::lock_guard<std::mutex> lock(_entries_mutex);
+  const auto entry_iter = _entries.find(cache_key);
+  return entry_iter != _entries.end() ? entry_iter->second : nullptr;
+}
+
+std::string JitCodeCache::key(const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                              const TableType input_table_type) {
+  std::stringstream key;
+  key << table_type_to_string.left.at(input_table_type) << "|";
+
+  for (const auto& jit_operator : jit_operators) {
+    // Derived operators (e.g., in tests) might behave differently than the operators they are derived from
+    const auto& jit_operator_ref = *jit_operator;
+    key << typeid(jit_operator_ref).name() << ":";
+
+    if (const auto source = std::dynamic_pointer_cast<const JitReadTuples>(jit_operator)) {
+      // The description of the JitReadTuples operator contains the values of the literals, which are only written to
+      // the runtime tuple. The compiled code depends on the layout of the tuple only.
+      for (const auto& input_column : source->input_columns()) {
+        describe_tuple_entry(key, input_column.tuple_entry);
+      }
+      key << ";";
+      for (const auto& input_literal : source->input_literals()) {
+        describe_tuple_entry(key, input_literal.tuple_entry);
+      }
+      key << ";";
+      for (const auto& input_parameter : source->input_parameters()) {
+        describe_tuple_entry(key, input_parameter.tuple_entry);
+      }
+    } else if (const auto hash_join_probe = std::dynamic_pointer_cast<const JitHashJoinProbe>(jit_operator)) {
+      // The description does not contain the data types of the probe key and the build columns
+      describe_tuple_entry(key, hash_join_probe->probe_key());
+      for (const auto& build_column : hash_join_probe->build_columns()) {
+        describe_tuple_entry(key, build_column.tuple_entry);
+      }
+      key << hash_join_probe->description();
+    } else {
+      // The other descriptions contain the tuple indices and expressions. The data types of computed tuple entries
+      // follow from those of the input tuple entries.
+      key << jit_operator->description();
+    }
+    key << "|";
+  }
+
+  return key.str();
+}
+
+size_t JitCodeCache::size() const {
+  std::lock_guard<std::mutex> lock(_entries_mutex);
+  return _entries.size();
+}
+
+void JitCodeCache::clear() {
+  std::lock_guard<std::mutex> lock(_entries_mutex);
+  _entries.clear();
+}
+
+}  // namespace opossum
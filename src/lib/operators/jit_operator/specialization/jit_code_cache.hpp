@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "jit_code_specializer.hpp"
+#include "operators/jit_operator/operators/abstract_jittable.hpp"
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/* Specializing and compiling a jittable operator pipeline takes tens to hundreds of milliseconds. Without the
+ * JitCodeCache, this time is spent again for every PQP that contains the pipeline, e.g., whenever the same query is
+ * issued with different literals or by another session.
+ *
+ * The JitCodeCache holds the specialized JitReadTuples::execute() function of every pipeline compiled so far. Entries
+ * are identified by a key that describes everything the specialization depends on: the types of the jittable operators,
+ * the tuple entries they read and write (including data types and nullability), their expressions, and the type of
+ * the input table.
+ * The values of literals are not part of the key, as long as they are read from the runtime tuple: JitReadTuples writes
+ * them to the runtime tuple in before_query(), i.e., they act as placeholders in the compiled code and a pipeline can
+ * be reused for different literal values. Only the values of JitExpressions of type Value are folded into the code and
+ * are thus part of the key.
+ *
+ * The compiled code only remains valid within the current process, so the cache is not persisted.
+ */
+class JitCodeCache : public Singleton<JitCodeCache> {
+ public:
+  using ExecuteFunction = std::function<void(const JitReadTuples*, JitRuntimeContext&)>;
+
+  /* A specialized function together with everything it depends on. The specializer owns the compiled code, and the
+   * operators it was specialized for are kept alive, since runtime values of these operators might have been
+   * substituted into the code.
+   */
+  struct Entry {
+    std::vector<std::shared_ptr<AbstractJittable>> jit_operators;
+    std::unique_ptr<JitCodeSpecializer> specializer;
+    ExecuteFunction execute_func;
+  };
+
+  // Returns the function specialized for an equivalent operator pipeline, or specializes and caches the function for
+  // the given pipeline. The operators have to be connected to a chain already.
+  std::shared_ptr<const Entry> get_or_specialize(const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                                                 const TableType input_table_type);
+
+  // Returns the function specialized for an equivalent operator pipeline, or nullptr if there is none yet. Does not
+  // wait for running specializations.
+  std::shared_ptr<const Entry> try_get(const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                                       const TableType input_table_type) const;
+
+  static std::string key(const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                         const TableType input_table_type);
+
+  size_t size() const;
+
+  // Functions that are still referenced by JitOperatorWrappers remain valid until these are destroyed
+  void clear();
+
+ private:
+  JitCodeCache() = default;
+
+  friend class Singleton;
+
+  std::unordered_map<std::string, std::shared_ptr<const Entry>> _entries;
+  mutable std::mutex _entries_mutex;
+
+  // Held during the specialization, so that each pipeline is only specialized once, even if equivalent pipelines are
+  // executed concurrently
+  std::mutex _specialization_mutex;
+};
+
+}  // namespace opossum
@@ -1,8 +1,11 @@
 #include "jit_operator_wrapper.hpp"
 
 #include "expression/expression_utils.hpp"
-#include "operators/jit_operator/operators/jit_aggregate.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
 
 namespace opossum {
 
@@ -29,10 +32,19 @@ void JitOperatorWrapper::add_jit_operator(const std::shared_ptr<AbstractJittable
   _specialized_function_wrapper->jit_operators.push_back(op);
 }
 
+size_t JitOperatorWrapper::add_build_input(const std::shared_ptr<AbstractOperator>& build_input) {
+  _build_inputs.push_back(build_input);
+  return _build_inputs.size() - 1;
+}
+
 const std::vector<std::shared_ptr<AbstractJittable>>& JitOperatorWrapper::jit_operators() const {
   return _specialized_function_wrapper->jit_operators;
 }
 
+const std::vector<std::shared_ptr<AbstractOperator>>& JitOperatorWrapper::build_inputs() const {
+  return _build_inputs;
+}
+
 const std::vector<AllTypeVariant>& JitOperatorWrapper::input_parameter_values() const {
   return _input_parameter_values;
 }
@@ -53,21 +65,64 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
 
   auto out_table = _sink()->create_output_table(*in_table);
 
+  const auto initialize_context = [&](JitRuntimeContext& context) {
+    if (transaction_context_is_set()) {
+      context.transaction_id = transaction_context()->transaction_id();
+      context.snapshot_commit_id = transaction_context()->snapshot_commit_id();
+    }
+
+    _source()->before_query(*in_table, _input_parameter_values, context);
+    _sink()->before_query(*out_table, context);
+  };
+
   JitRuntimeContext context;
-  if (transaction_context_is_set()) {
-    context.transaction_id = transaction_context()->transaction_id();
-    context.snapshot_commit_id = transaction_context()->snapshot_commit_id();
+  initialize_context(context);
+
+  for (const auto& build_input : _build_inputs) {
+    if (build_input->get_output()) continue;
+    const auto tasks = OperatorTask::make_tasks_from_operator(build_input, CleanupTemporaries::Yes);
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
   }
 
-  _source()->before_query(*in_table, _input_parameter_values, context);
-  _sink()->before_query(*out_table, context);
+  context.join_hashmaps.resize(_build_inputs.size());
+  for (const auto& jit_operator : _specialized_function_wrapper->jit_operators) {
+    if (const auto hash_join_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operator)) {
+      hash_join_probe->before_query(*_build_inputs[hash_join_probe->build_input_idx()]->get_output(), context);
+    }
+  }
 
   _prepare_and_specialize_operator_pipeline();
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count() && context.limit_rows; ++chunk_id) {
-    _source()->before_chunk(*in_table, chunk_id, context);
-    _specialized_function_wrapper->execute_func(_source().get(), context);
-    _sink()->after_chunk(in_table, *out_table, context);
+  const auto chunk_count = in_table->chunk_count();
+
+  // A limit is shared by all chunks, so that pipelines with a JitLimit operator are executed sequentially
+  if (!CurrentScheduler::is_set() || chunk_count <= 1 || _source()->row_count_expression()) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count && context.limit_rows; ++chunk_id) {
+      _execute_chunk(*in_table, chunk_id, context);
+      _sink()->after_chunk(in_table, *out_table, context);
+    }
+  } else {
+    // Each chunk is pushed through the pipeline by a separate job with its own context. The state of the chunks'
+    // contexts is merged in order afterwards, so that the output is the same as if the chunks were executed
+    // sequentially.
+    auto chunk_contexts = std::vector<JitRuntimeContext>(chunk_count);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& chunk_context = chunk_contexts[chunk_id];
+        initialize_context(chunk_context);
+        chunk_context.join_hashmaps = context.join_hashmaps;
+        _execute_chunk(*in_table, chunk_id, chunk_context);
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      _sink()->after_chunk(in_table, *out_table, chunk_contexts[chunk_id]);
+      _sink()->merge_context(context, chunk_contexts[chunk_id]);
+    }
   }
 
   _sink()->after_query(*out_table, context);
@@ -75,11 +130,22 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   return out_table;
 }
 
+void JitOperatorWrapper::_execute_chunk(const Table& in_table, const ChunkID chunk_id,
+                                        JitRuntimeContext& context) const {
+  _source()->before_chunk(in_table, chunk_id, context);
+  // In the Tiered mode, chunks are interpreted until the compiled function is ready
+  if (_execution_mode == JitExecutionMode::Tiered && !_specialized_function_wrapper->compilation_finished) {
+    _source()->execute(context);
+  } else {
+    _specialized_function_wrapper->execute_func(_source().get(), context);
+  }
+}
+
 void JitOperatorWrapper::_prepare_and_specialize_operator_pipeline() {
   // Use a mutex to specialize a jittable operator pipeline within a subquery only once.
   // See jit_operator_wrapper.hpp for details.
   std::lock_guard<std::mutex> guard(_specialized_function_wrapper->specialization_mutex);
-  if (_specialized_function_wrapper->execute_func) return;
+  if (_specialized_function_wrapper->compilation_started || _specialized_function_wrapper->execute_func) return;
 
   const auto jit_operators = _specialized_function_wrapper->jit_operators;
 
@@ -94,22 +160,39 @@ void JitOperatorWrapper::_prepare_and_specialize_operator_pipeline() {
     (*it)->set_next_operator(*(it + 1));
   }
 
-  std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
-  // We want to perform two specialization passes if the operator chain contains a JitAggregate operator, since the
-  // JitAggregate operator contains multiple loops that need unrolling.
-  auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
   switch (_execution_mode) {
     case JitExecutionMode::Compile:
-      // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
-      _specialized_function_wrapper->execute_func =
-          _specialized_function_wrapper->module
-              .specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
-                  "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
-                  std::make_shared<JitConstantRuntimePointer>(_source().get()), two_specialization_passes);
+      _specialized_function_wrapper->cache_entry =
+          JitCodeCache::get().get_or_specialize(jit_operators, input_left()->get_output()->type());
+      _specialized_function_wrapper->execute_func = _specialized_function_wrapper->cache_entry->execute_func;
       break;
     case JitExecutionMode::Interpret:
       _specialized_function_wrapper->execute_func = &JitReadTuples::execute;
       break;
+    case JitExecutionMode::Tiered: {
+      _specialized_function_wrapper->compilation_started = true;
+
+      const auto input_table_type = input_left()->get_output()->type();
+      if (const auto cache_entry = JitCodeCache::get().try_get(jit_operators, input_table_type)) {
+        _specialized_function_wrapper->cache_entry = cache_entry;
+        _specialized_function_wrapper->execute_func = cache_entry->execute_func;
+        _specialized_function_wrapper->compilation_finished = true;
+        break;
+      }
+
+      // The task keeps the SpecializedFunctionWrapper alive, so that the compiled function is available to later
+      // executions (e.g., of a correlated subquery) even if this operator has finished in the meantime
+      const auto specialized_function_wrapper = _specialized_function_wrapper;
+      const auto compile_task = std::make_shared<JobTask>([specialized_function_wrapper, input_table_type]() {
+        const auto cache_entry =
+            JitCodeCache::get().get_or_specialize(specialized_function_wrapper->jit_operators, input_table_type);
+        specialized_function_wrapper->cache_entry = cache_entry;
+        specialized_function_wrapper->execute_func = cache_entry->execute_func;
+        specialized_function_wrapper->compilation_finished = true;
+      });
+      compile_task->schedule();
+      break;
+    }
   }
 }
 
@@ -124,6 +207,10 @@ void JitOperatorWrapper::_on_set_parameters(const std::unordered_map<ParameterID
     }
   }
 
+  for (const auto& build_input : _build_inputs) {
+    build_input->set_parameters(parameters);
+  }
+
   // Set any parameter values used within in the row count expression.
   if (const auto row_count_expression = _source()->row_count_expression()) {
     expression_set_parameters(row_count_expression, parameters);
@@ -131,6 +218,10 @@ void JitOperatorWrapper::_on_set_parameters(const std::unordered_map<ParameterID
 }
 
 void JitOperatorWrapper::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  for (const auto& build_input : _build_inputs) {
+    build_input->set_transaction_context_recursively(transaction_context);
+  }
+
   // Set the MVCC data in the row count expression required by possible subqueries within the expression.
   if (const auto row_count_expression = _source()->row_count_expression()) {
     expression_set_transaction_context(row_count_expression, transaction_context);
@@ -140,7 +231,18 @@ void JitOperatorWrapper::_on_set_transaction_context(const std::weak_ptr<Transac
 std::shared_ptr<AbstractOperator> JitOperatorWrapper::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _specialized_function_wrapper);
+  const auto copy =
+      std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _specialized_function_wrapper);
+  for (const auto& build_input : _build_inputs) {
+    copy->add_build_input(build_input->deep_copy());
+  }
+  return copy;
+}
+
+void JitOperatorWrapper::_on_cleanup() {
+  for (const auto& build_input : _build_inputs) {
+    build_input->clear_output();
+  }
 }
 
 }  // namespace opossum
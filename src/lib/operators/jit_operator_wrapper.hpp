@@ -1,15 +1,23 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "abstract_read_only_operator.hpp"
 #include "jit_operator/operators/abstract_jittable_sink.hpp"
 #include "jit_operator/operators/jit_read_tuples.hpp"
-#include "operators/jit_operator/specialization/jit_code_specializer.hpp"
+#include "operators/jit_operator/specialization/jit_code_cache.hpp"
 
 namespace opossum {
 
-enum class JitExecutionMode { Interpret, Compile };
+/* Interpret: Executes the virtual functions of the jittable operators.
+ * Compile: Specializes and compiles the operator pipeline before processing the first chunk.
+ * Tiered: Interprets the first chunks while the pipeline is compiled by a background task, and switches to the
+ *         compiled function as soon as it is ready. Short queries do not wait for the compilation, while long-running
+ *         ones still mostly execute compiled code. If no scheduler is active, the background task is executed
+ *         immediately, which makes this mode equivalent to Compile.
+ */
+enum class JitExecutionMode { Interpret, Compile, Tiered };
 
 /* The JitOperatorWrapper wraps a number of jittable operators and exposes them through Hyrise's default
  * operator interface. This allows a number of jit operators to be seamlessly integrated with
@@ -17,6 +25,9 @@ enum class JitExecutionMode { Interpret, Compile };
  * The JitOperatorWrapper is responsible for chaining the operators it contains, compiling code for the operators at
  * runtime, creating and managing the runtime context and calling hooks (before/after processing a chunk or the entire
  * query) on the its operators.
+ * If a scheduler is active, the chunks are processed in parallel, each by a JobTask with its own runtime context. The
+ * sink merges the chunks' contexts afterwards (see AbstractJittableSink::merge_context()). Pipelines with a JitLimit
+ * operator are always executed sequentially, since the limit applies across chunks.
  */
 class JitOperatorWrapper : public AbstractReadOnlyOperator {
  public:
@@ -30,16 +41,23 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
    * instance will also start specializing the pipeline as no specialized function exists so far.
    * To prevent this, a mutex is used during specialization which ensures that only the first JitOperatorWrapper
    * instance specializes the pipeline and all other instances wait till the specialization finishes.
+   *
+   * In the Compile mode, the specialized function is taken from the JitCodeCache, which is shared by all pipelines.
+   * The cache entry owns the compiled code and is kept alive as long as the function is used.
    */
   struct SpecializedFunctionWrapper {
     std::vector<std::shared_ptr<AbstractJittable>> jit_operators;
     std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
     std::mutex specialization_mutex;
-    JitCodeSpecializer module;
+    std::shared_ptr<const JitCodeCache::Entry> cache_entry;
+
+    // Only used in the Tiered mode, in which execute_func may only be called once the compilation has finished
+    bool compilation_started{false};
+    std::atomic_bool compilation_finished{false};
   };
 
   explicit JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
-                              const JitExecutionMode execution_mode = JitExecutionMode::Compile,
+                              const JitExecutionMode execution_mode = JitExecutionMode::Tiered,
                               const std::shared_ptr<SpecializedFunctionWrapper>& specialized_function_wrapper =
                                   std::make_shared<SpecializedFunctionWrapper>());
 
@@ -50,7 +68,13 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
   // The operators will later be chained by the JitOperatorWrapper.
   void add_jit_operator(const std::shared_ptr<AbstractJittable>& op);
 
+  // Adds the build input of a JitHashJoinProbe and returns its index, by which the JitHashJoinProbe identifies it.
+  // Build inputs are not part of the task graph of the PQP, but are executed by the JitOperatorWrapper itself before
+  // the pipeline.
+  size_t add_build_input(const std::shared_ptr<AbstractOperator>& build_input);
+
   const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators() const;
+  const std::vector<std::shared_ptr<AbstractOperator>>& build_inputs() const;
   const std::vector<AllTypeVariant>& input_parameter_values() const;
 
  protected:
@@ -61,6 +85,7 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+  void _on_cleanup() override;
 
  private:
   const std::shared_ptr<JitReadTuples> _source() const;
@@ -68,10 +93,16 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
 
   void _prepare_and_specialize_operator_pipeline();
 
+  // Pushes the tuples of a chunk through the pipeline, using the compiled or the interpreted function
+  void _execute_chunk(const Table& in_table, const ChunkID chunk_id, JitRuntimeContext& context) const;
+
   const JitExecutionMode _execution_mode;
   const std::shared_ptr<SpecializedFunctionWrapper> _specialized_function_wrapper;
 
   std::vector<AllTypeVariant> _input_parameter_values;
+
+  // Unlike the jittable operators, the build inputs are not shared with deep copies of the JitOperatorWrapper
+  std::vector<std::shared_ptr<AbstractOperator>> _build_inputs;
 };
 
 }  // namespace opossum
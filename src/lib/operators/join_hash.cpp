@@ -3,6 +3,7 @@
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -12,36 +13,136 @@
 #include "bytell_hash_map.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/arena_memory_resource.hpp"
+#include "memory/memory_budget.hpp"
+#include "operators/spill/spill_partitioning.hpp"
+#include "operators/table_wrapper.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table_partitioning.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
 
+// Only if the probe relation is larger than the build relation by this factor, a BloomFilter is used (see below)
+constexpr auto BLOOM_FILTER_MIN_PROBE_TO_BUILD_RATIO = size_t{2};
+
+// Semi and anti joins build the hash tables on the output side if it is smaller than the other input by this factor
+constexpr auto SEMI_ANTI_BUILD_OUTPUT_SIDE_RATIO = size_t{8};
+
+// Maximum number of bits for the single pass of radix partitioning. With a larger fan-out, the writes to the partitions
+// cause too many TLB misses.
+constexpr auto JOIN_HASH_MAX_RADIX_BITS = size_t{12};
+
+// Estimated memory per input row for the materialized partitions and the hash tables, used for the memory budget
+constexpr auto JOIN_HASH_BYTES_PER_ROW = 2 * (sizeof(RowID) + sizeof(uint64_t));
+
+// Like make_unique_by_data_types(), but for joins on the ids of a DictionaryIDMapping (see JoinHash::_on_execute())
+template <class Base, template <typename...> class Impl, typename... ConstructorArgs>
+std::unique_ptr<Base> make_unique_for_value_ids(ConstructorArgs&&... args) {
+  return std::make_unique<Impl<ValueID, ValueID>>(std::forward<ConstructorArgs>(args)...);
+}
+
+// Like make_unique_by_data_types(), but for joins of two string columns, which are materialized as GermanStrings
+template <class Base, template <typename...> class Impl, typename... ConstructorArgs>
+std::unique_ptr<Base> make_unique_for_german_strings(ConstructorArgs&&... args) {
+  return std::make_unique<Impl<GermanString, GermanString>>(std::forward<ConstructorArgs>(args)...);
+}
+
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const std::optional<size_t>& radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
-      _radix_bits(radix_bits) {
+                   const std::optional<size_t>& radix_bits,
+                   const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition,
+                           std::make_unique<JoinHash::PerformanceData>()),
+      _radix_bits(radix_bits),
+      _secondary_predicates(secondary_predicates) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
+  Assert(_secondary_predicates.empty() || mode == JoinMode::Inner || mode == JoinMode::Left ||
+             mode == JoinMode::Right || mode == JoinMode::Semi || mode == JoinMode::Anti,
+         "Secondary predicates are not supported for this join mode");
 }
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
+const std::string JoinHash::description(DescriptionMode description_mode) const {
+  auto description = AbstractJoinOperator::description(description_mode);
+
+  for (const auto& secondary_predicate : _secondary_predicates) {
+    const auto [left_column_id, right_column_id] = secondary_predicate.column_ids;
+    const auto column_name_left = input_table_left() ? input_table_left()->column_name(left_column_id)
+                                                     : std::string("Column #") + std::to_string(left_column_id);
+    const auto column_name_right = input_table_right() ? input_table_right()->column_name(right_column_id)
+                                                       : std::string("Column #") + std::to_string(right_column_id);
+
+    // Insert the secondary predicate before the closing parenthesis
+    description.insert(description.size() - 1,
+                       " AND " + column_name_left + " " +
+                           predicate_condition_to_string.left.at(secondary_predicate.predicate_condition) + " " +
+                           column_name_right);
+  }
+  return description;
+}
+
+const std::vector<OperatorJoinPredicate>& JoinHash::secondary_predicates() const { return _secondary_predicates; }
+
+std::string JoinHash::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += std::to_string(size_t{1} << radix_bits) + " radix partitions";
+  if (table_partition_count > 0) string += ", " + std::to_string(table_partition_count) + " table partitions";
+  if (unique_build_side) string += ", unique build side";
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += "materialize " + format_duration(materialization) + ", partition " + format_duration(partitioning) +
+            ", build " + format_duration(building) + ", probe " + format_duration(probing) + ", write " +
+            format_duration(output_writing);
+  return string;
+}
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  auto copy = std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids,
+                                         _predicate_condition, _radix_bits, _secondary_predicates);
+  copy->set_probe_prefetching(_probe_prefetching);
+  return copy;
 }
 
+void JoinHash::set_probe_prefetching(const bool enabled) { _probe_prefetching = enabled; }
+
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 std::shared_ptr<const Table> JoinHash::_on_execute() {
+  // If both inputs are partitioned by their join columns in the same way (see TablePartitioning), rows only find join
+  // partners in the same partition. The pairs of partitions are joined independently and in parallel, without radix
+  // clustering. As below, anti joins are not joined partition-wise.
+  if (_mode != JoinMode::Anti) {
+    if (const auto output = _join_partition_wise()) return output;
+  }
+
+  // If the join might exceed the memory budget of the query, both inputs are partitioned by their join keys and written
+  // to disk (Grace hash join). Rows only find join partners in the same partition, so the pairs of partitions are
+  // joined one at a time. Equal keys only get the same hash if they have the same type. Anti joins are not partitioned,
+  // as they treat NULLs differently depending on whether the build input is empty.
+  auto reservation = std::optional<MemoryReservation>{};
+  const auto budget = memory_budget();
+  if (budget && _mode != JoinMode::Anti &&
+      input_table_left()->column_data_type(_column_ids.first) ==
+          input_table_right()->column_data_type(_column_ids.second)) {
+    const auto required_bytes =
+        (input_table_left()->row_count() + input_table_right()->row_count()) * JOIN_HASH_BYTES_PER_ROW;
+
+    reservation = budget->try_reserve(required_bytes);
+    if (!reservation) return _join_spilled_partitions(required_bytes, budget->available_bytes());
+  }
+
   std::shared_ptr<const AbstractOperator> build_operator;
   std::shared_ptr<const AbstractOperator> probe_operator;
   ColumnID build_column_id;
@@ -49,8 +150,15 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   // This is the expected implementation for swapping tables:
   // (1) if left or right outer join, outer relation becomes probe relation (we have to swap only for left outer)
-  // (2) for a semi and anti join the inputs are always swapped
+  // (2) for a semi and anti join the inputs are swapped, so that the output side is probed against the distinct keys
+  //     of the other input. If the output side is much smaller, it is kept as the build relation instead and the other
+  //     input is streamed through its hash tables (see probe_semi_anti_build_side()).
   bool inputs_swapped = (_mode == JoinMode::Left || _mode == JoinMode::Anti || _mode == JoinMode::Semi);
+  if ((_mode == JoinMode::Semi || _mode == JoinMode::Anti) && _secondary_predicates.empty() &&
+      _input_left->get_output()->row_count() * SEMI_ANTI_BUILD_OUTPUT_SIDE_RATIO <
+          _input_right->get_output()->row_count()) {
+    inputs_swapped = false;
+  }
 
   // (3) else the smaller relation will become build relation, the larger probe relation
   if (!inputs_swapped && _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
@@ -72,31 +180,163 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   auto adjusted_column_ids = std::make_pair(build_column_id, probe_column_id);
 
+  // The secondary predicates are evaluated with the build column first, too
+  auto adjusted_secondary_predicates = _secondary_predicates;
+  if (inputs_swapped) {
+    for (auto& secondary_predicate : adjusted_secondary_predicates) {
+      std::swap(secondary_predicate.column_ids.first, secondary_predicate.column_ids.second);
+      secondary_predicate.predicate_condition = flip_predicate_condition(secondary_predicate.predicate_condition);
+    }
+  }
+
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
-  _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
-      build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), *this,
-      build_operator, probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
+  // Probe rows without a join partner are dropped by inner and semi joins, so chunks without any of the build keys
+  // can be skipped entirely
+  if (_mode == JoinMode::Inner || _mode == JoinMode::Semi) {
+    const auto probe_chunk_count = probe_input->chunk_count();
+    probe_input = _prune_chunks_without_join_partners(*build_input, build_column_id, probe_input, probe_column_id);
+    _performance_data->pruned_chunk_count = probe_chunk_count - probe_input->chunk_count();
+  }
+
+  // If both join columns are dictionary-encoded, equal values can be given equal ids (see DictionaryIDMapping). The
+  // join then works on these ids and neither materializes nor hashes nor compares any values.
+  const auto dictionary_id_mapping =
+      DictionaryIDMapping::create({{build_input, build_column_id}, {probe_input, probe_column_id}});
+
+  if (dictionary_id_mapping) {
+    _impl = make_unique_for_value_ids<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
+        *this, build_input, probe_input, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped,
+        adjusted_secondary_predicates, _radix_bits, dictionary_id_mapping);
+  } else if (build_input->column_data_type(build_column_id) == DataType::String &&
+             probe_input->column_data_type(probe_column_id) == DataType::String) {
+    _impl = make_unique_for_german_strings<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
+        *this, build_input, probe_input, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped,
+        adjusted_secondary_predicates, _radix_bits);
+  } else {
+    _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
+        build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), *this,
+        build_input, probe_input, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped,
+        adjusted_secondary_predicates, _radix_bits);
+  }
   return _impl->_on_execute();
 }
 
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
+std::shared_ptr<const Table> JoinHash::_join_partition_wise() {
+  const auto left_partitions = partition_chunks(*input_table_left(), _column_ids.first);
+  if (!left_partitions) return nullptr;
+  const auto right_partitions = partition_chunks(*input_table_right(), _column_ids.second);
+  if (!right_partitions || !left_partitions->partitioning->is_compatible_with(*right_partitions->partitioning)) {
+    return nullptr;
+  }
+
+  // A pair of partitions only has to be joined if it can produce output rows
+  const auto keeps_left_rows = _mode == JoinMode::Left || _mode == JoinMode::Outer;
+  const auto keeps_right_rows = _mode == JoinMode::Right || _mode == JoinMode::Outer;
+  auto partition_ids = std::vector<PartitionID>{};
+  for (auto partition_id = PartitionID{0}; partition_id < left_partitions->chunk_ids_by_partition.size();
+       ++partition_id) {
+    const auto has_left_rows = !left_partitions->chunk_ids_by_partition[partition_id].empty();
+    const auto has_right_rows = !right_partitions->chunk_ids_by_partition[partition_id].empty();
+    if ((has_left_rows && has_right_rows) || (has_left_rows && keeps_left_rows) ||
+        (has_right_rows && keeps_right_rows)) {
+      partition_ids.emplace_back(partition_id);
+    }
+  }
+  if (partition_ids.size() < 2) return nullptr;
+
+  auto partition_outputs = std::vector<std::shared_ptr<const Table>>(partition_ids.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(partition_ids.size());
+  for (auto partition_idx = size_t{0}; partition_idx < partition_ids.size(); ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      const auto partition_id = partition_ids[partition_idx];
+      const auto left_wrapper = std::make_shared<TableWrapper>(
+          table_of_chunks(input_table_left(), left_partitions->chunk_ids_by_partition[partition_id]));
+      const auto right_wrapper = std::make_shared<TableWrapper>(
+          table_of_chunks(input_table_right(), right_partitions->chunk_ids_by_partition[partition_id]));
+      left_wrapper->execute();
+      right_wrapper->execute();
+
+      const auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, _mode, _column_ids,
+                                                   _predicate_condition, size_t{0}, _secondary_predicates);
+      join->set_cancellation_token_recursively(_cancellation_token);
+      join->execute();
+      partition_outputs[partition_idx] = join->get_output();
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  const auto output =
+      std::make_shared<Table>(partition_outputs.front()->column_definitions(), TableType::References);
+  for (const auto& partition_output : partition_outputs) {
+    for (const auto& chunk : partition_output->chunks()) {
+      output->append_chunk(chunk->segments());
+    }
+  }
+
+  static_cast<PerformanceData&>(*_performance_data).table_partition_count = partition_ids.size();
+  return output;
+}
+
+std::shared_ptr<const Table> JoinHash::_join_spilled_partitions(const size_t required_bytes,
+                                                                const size_t available_bytes) {
+  const auto partition_count = spill_partition_count(required_bytes, available_bytes);
+  auto left_partitions = spill_partitions(*input_table_left(), {_column_ids.first}, partition_count);
+  auto right_partitions = spill_partitions(*input_table_right(), {_column_ids.second}, partition_count);
+
+  std::shared_ptr<Table> output;
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    // The remaining partitions are not read once the statement is cancelled
+    if (output && is_cancelled()) break;
+
+    const auto left_wrapper =
+        std::make_shared<TableWrapper>(read_partition(input_table_left(), *left_partitions[partition_idx]));
+    const auto right_wrapper =
+        std::make_shared<TableWrapper>(read_partition(input_table_right(), *right_partitions[partition_idx]));
+    left_partitions[partition_idx].reset();
+    right_partitions[partition_idx].reset();
+    left_wrapper->execute();
+    right_wrapper->execute();
+
+    const auto join =
+        std::make_shared<JoinHash>(left_wrapper, right_wrapper, _mode, _column_ids, _predicate_condition, _radix_bits,
+                                   _secondary_predicates);
+    join->set_cancellation_token_recursively(_cancellation_token);
+    join->execute();
+
+    const auto partition_output = join->get_output();
+    if (!output) output = std::make_shared<Table>(partition_output->column_definitions(), TableType::References);
+    for (const auto& chunk : partition_output->chunks()) {
+      output->append_chunk(chunk->segments());
+    }
+  }
+
+  return output;
+}
+
 template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
-  JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const AbstractOperator>& left,
-               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+  JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const Table>& left,
+               const std::shared_ptr<const Table>& right, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
-               const std::optional<size_t>& radix_bits = std::nullopt)
+               const std::vector<OperatorJoinPredicate>& secondary_predicates,
+               const std::optional<size_t>& radix_bits = std::nullopt,
+               const std::shared_ptr<const DictionaryIDMapping>& dictionary_id_mapping = nullptr)
       : _join_hash(join_hash),
         _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
-        _inputs_swapped(inputs_swapped) {
+        _inputs_swapped(inputs_swapped),
+        _secondary_predicates(secondary_predicates),
+        _dictionary_id_mapping(dictionary_id_mapping) {
     if (radix_bits.has_value()) {
       _radix_bits = radix_bits.value();
     } else {
@@ -106,11 +346,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
  protected:
   const JoinHash& _join_hash;
-  const std::shared_ptr<const AbstractOperator> _left, _right;
+  const std::shared_ptr<const Table> _left, _right;
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
   const bool _inputs_swapped;
+  // With the build column first, see JoinHash::_on_execute()
+  const std::vector<OperatorJoinPredicate> _secondary_predicates;
+  // Only for joins on ids, i.e., with ValueID as LeftType and RightType
+  const std::shared_ptr<const DictionaryIDMapping> _dictionary_id_mapping;
 
   std::shared_ptr<Table> _output_table;
 
@@ -124,16 +368,17 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       Setting number of bits for radix clustering:
       The number of bits is used to create probe partitions with a size that can
       be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
+      The L2 cache size is taken from the Topology, which reads it from the system.
       We estimate the size the following way:
         - we assume each key appears once (that is an overestimation space-wise, but we
         aim rather for a hash map that is slightly smaller than L2 than slightly larger)
         - each entry in the hash map is a data structure holding the actual value
-        and the RowID
+        and the RowID (or only the value for key-only hash sets of semi/anti joins)
+      The partitioning is done in a single pass. As its fan-out is limited by the TLB, partitions that would still
+      exceed the L2 cache at the maximum fan-out are only sized to fit into the last level cache.
     */
-    const auto build_relation_size = _left->get_output()->row_count();
-    const auto probe_relation_size = _right->get_output()->row_count();
+    const auto build_relation_size = _left->row_count();
+    const auto probe_relation_size = _right->row_count();
 
     if (build_relation_size > probe_relation_size) {
       /*
@@ -146,32 +391,43 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    const auto l2_cache_size = static_cast<double>(Topology::get().l2_cache_size());  // bytes
 
     // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
     // that each value maps to a PosList with a single RowID. For the used small_vector's, we assume a
     // size of 2*RowID per PosList. For sizing, see comments:
     // https://probablydance.com/2018/05/28/a-new-fast-hash-table-in-response-to-googles-new-fast-hash-table/
+    const auto keys_only =
+        (_mode == JoinMode::Semi || _mode == JoinMode::Anti) && _inputs_swapped && _secondary_predicates.empty();
+    const auto entry_size = keys_only ? sizeof(LeftType) + 1 : sizeof(LeftType) + 2 * sizeof(RowID) + 1;
     const auto complete_hash_map_size =
         // number of items in map
         (build_relation_size *
          // key + value (and one byte overhead, see link above)
-         (sizeof(LeftType) + 2 * sizeof(RowID) + 1))
+         entry_size)
         // fill factor
         / 0.8;
 
     const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+    auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+
+    if (cluster_count > static_cast<double>(size_t{1} << JOIN_HASH_MAX_RADIX_BITS)) {
+      const auto last_level_cache_size = static_cast<double>(Topology::get().last_level_cache_size());
+      cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / last_level_cache_size);
+    }
 
-    return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+    return std::min(static_cast<size_t>(std::ceil(std::log2(cluster_count))), JOIN_HASH_MAX_RADIX_BITS);
   }
 
   std::shared_ptr<const Table> _on_execute() override {
-    auto right_in_table = _right->get_output();
-    auto left_in_table = _left->get_output();
+    auto right_in_table = _right;
+    auto left_in_table = _left;
 
     _output_table = _join_hash._initialize_output_table();
 
+    auto& performance_data = static_cast<PerformanceData&>(*_join_hash._performance_data);
+    performance_data.radix_bits = _radix_bits;
+
     /*
      * This flag is used in the materialization and probing phases.
      * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
@@ -180,12 +436,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     const auto keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
 
     // Pre-partitioning:
-    // Save chunk offsets into the input relation.
+    // Save chunk offsets into the input relation. They are also used to decode the RowIndexes of the matches.
     const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
     const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
 
-    Timer performance_timer;
-
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
     std::vector<std::vector<size_t>> histograms_left;
@@ -201,6 +455,17 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     RadixContainer<LeftType> radix_left;
     RadixContainer<RightType> radix_right;
     std::vector<std::optional<HashTable<HashedType>>> hashtables;
+    std::vector<std::optional<HashSet<HashedType>>> hashsets;
+    std::optional<std::vector<std::optional<UniqueHashTable<HashedType>>>> unique_hashtables;
+
+    // Semi and anti joins that output the probe side only need the distinct keys of the build side
+    const auto semi_or_anti = _mode == JoinMode::Semi || _mode == JoinMode::Anti;
+    const auto build_keys_only = semi_or_anti && _inputs_swapped && _secondary_predicates.empty();
+
+    // Build sides with unique keys (e.g., primary keys) are stored in UniqueHashTables, which hold a single RowIndex
+    // per key. Whether the keys are unique is found out while building them. probe_semi_anti_build_side() erases keys
+    // from the hash tables, which UniqueHashTables do not support.
+    const auto try_unique_build = !build_keys_only && !(semi_or_anti && !_inputs_swapped);
 
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
@@ -222,14 +487,35 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //                         \_                   _/
     //                           \                 /
     //                          Probing (actual Join)
+    //
+    // If a BloomFilter is used (see below), the right path is only started once build() is finished.
+
+    // For inner and semi joins, probe rows without a join partner are not part of the result. A BloomFilter filled
+    // while building the hash tables allows materialize_input() to drop most of them, so that they are neither
+    // partitioned nor probed. The price is that the right relation can only be materialized once build() is done.
+    // For selective joins (e.g., a filtered dimension table joined with a fact table), this pays off.
+    std::unique_ptr<BloomFilter> bloom_filter;
+    if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+        left_in_table->row_count() * BLOOM_FILTER_MIN_PROBE_TO_BUILD_RATIO < right_in_table->row_count()) {
+      bloom_filter = std::make_unique<BloomFilter>(left_in_table->row_count());
+    }
 
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
+    // Durations of the steps of both paths, which run concurrently
+    auto materialization_left = std::chrono::nanoseconds{0};
+    auto materialization_right = std::chrono::nanoseconds{0};
+    auto partitioning_left = std::chrono::nanoseconds{0};
+    auto partitioning_right = std::chrono::nanoseconds{0};
+
     // Pre-Probing path of left relation
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      Timer timer;
+
       // materialize left table (NULLs are always discarded for the build side)
-      materialized_left = materialize_input<LeftType, HashedType, false>(left_in_table, _column_ids.first,
-                                                                         histograms_left, _radix_bits);
+      materialized_left = materialize_input<LeftType, HashedType, false>(
+          left_in_table, _column_ids.first, histograms_left, _radix_bits, nullptr, _dictionary_id_mapping.get());
+      materialization_left = timer.lap();
 
       if (_radix_bits > 0) {
         // radix partition the left table
@@ -239,22 +525,32 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         // short cut: skip radix partitioning and use materialized data directly
         radix_left = std::move(materialized_left);
       }
+      partitioning_left = timer.lap();
 
       // build hash tables
-      hashtables = build<LeftType, HashedType>(radix_left);
+      if (build_keys_only) {
+        hashsets = build<LeftType, HashedType, HashSet<HashedType>>(radix_left, bloom_filter.get());
+      } else {
+        if (try_unique_build) unique_hashtables = build_unique<LeftType, HashedType>(radix_left, bloom_filter.get());
+        if (!unique_hashtables) hashtables = build<LeftType, HashedType>(radix_left, bloom_filter.get());
+      }
+      performance_data.building = timer.lap();
     }));
-    jobs.back()->schedule();
 
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      Timer timer;
+
       // Materialize right table. The third template parameter signals if the relation on the right (probe
       // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
       if (keep_nulls) {
-        materialized_right = materialize_input<RightType, HashedType, true>(right_in_table, _column_ids.second,
-                                                                            histograms_right, _radix_bits);
+        materialized_right = materialize_input<RightType, HashedType, true>(
+            right_in_table, _column_ids.second, histograms_right, _radix_bits, nullptr, _dictionary_id_mapping.get());
       } else {
-        materialized_right = materialize_input<RightType, HashedType, false>(right_in_table, _column_ids.second,
-                                                                             histograms_right, _radix_bits);
+        materialized_right = materialize_input<RightType, HashedType, false>(
+            right_in_table, _column_ids.second, histograms_right, _radix_bits, bloom_filter.get(),
+            _dictionary_id_mapping.get());
       }
+      materialization_right = timer.lap();
 
       if (_radix_bits > 0) {
         // radix partition the right table. 'keep_nulls' makes sure that the
@@ -270,40 +566,90 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         // short cut: skip radix partitioning and use materialized data directly
         radix_right = std::move(materialized_right);
       }
+      partitioning_right = timer.lap();
     }));
-    jobs.back()->schedule();
 
+    // The right relation can only be filtered once the BloomFilter is complete
+    if (bloom_filter) jobs.front()->set_as_predecessor_of(jobs.back());
+
+    // The columns of the secondary predicates are materialized while the hash tables are built
+    std::optional<SecondaryPredicateEvaluator> secondary_predicate_evaluator;
+    if (!_secondary_predicates.empty()) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        secondary_predicate_evaluator.emplace(*left_in_table, *right_in_table, _secondary_predicates);
+      }));
+    }
+
+    for (const auto& job : jobs) job->schedule();
     CurrentScheduler::wait_for_tasks(jobs);
 
-    // Probe phase
+    performance_data.materialization = materialization_left + materialization_right;
+    performance_data.partitioning = partitioning_left + partitioning_right;
+
+    // The partitions are not probed once the statement is cancelled, see CancellationToken
+    if (_join_hash.is_cancelled()) return _output_table;
+
+    Timer timer;
+
+    // Probe phase. The probe writes the PosLists of each partition using their allocators, so that the output is
+    // allocated from the arena of the query, if there is one.
+    const auto arena = _join_hash.arena();
+    const auto pos_list_allocator = arena ? PolymorphicAllocator<RowID>{arena.get()} : PolymorphicAllocator<RowID>{};
+
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
     const size_t partition_count = radix_right.partition_offsets.size();
-    left_pos_lists.resize(partition_count);
-    right_pos_lists.resize(partition_count);
+    left_pos_lists.reserve(partition_count);
+    right_pos_lists.reserve(partition_count);
     for (size_t i = 0; i < partition_count; i++) {
-      // simple heuristic: half of the rows of the right relation will match
-      const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
-
-      left_pos_lists[i].reserve(result_rows_per_partition);
-      right_pos_lists[i].reserve(result_rows_per_partition);
+      left_pos_lists.emplace_back(pos_list_allocator);
+      right_pos_lists.emplace_back(pos_list_allocator);
     }
-    /*
-    NUMA notes:
-    The workers for each radix partition P should be scheduled on the same node as the input data:
-    leftP, rightP and hashtableP.
-    */
-    if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+    // The workers for each radix partition are scheduled on the node of its hash table, see numa_node_for_partition()
+    const auto secondary_predicates = secondary_predicate_evaluator ? &*secondary_predicate_evaluator : nullptr;
+    if (semi_or_anti && !_inputs_swapped) {
+      probe_semi_anti_build_side<RightType, HashedType>(radix_right, hashtables, left_pos_lists, left_chunk_offsets,
+                                                        _mode);
+    } else if (build_keys_only) {
+      probe_semi_anti<RightType, HashedType>(radix_right, hashsets, right_pos_lists, right_chunk_offsets, _mode);
+    } else if (unique_hashtables) {
+      performance_data.unique_build_side = true;
+      if (semi_or_anti) {
+        probe_semi_anti<RightType, HashedType>(radix_right, *unique_hashtables, right_pos_lists, right_chunk_offsets,
+                                               _mode, secondary_predicates);
+      } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+        probe<RightType, HashedType, true>(radix_right, *unique_hashtables, left_pos_lists, right_pos_lists,
+                                           left_chunk_offsets, right_chunk_offsets, _mode, secondary_predicates,
+                                           _join_hash._probe_prefetching);
+      } else {
+        probe<RightType, HashedType, false>(radix_right, *unique_hashtables, left_pos_lists, right_pos_lists,
+                                            left_chunk_offsets, right_chunk_offsets, _mode, secondary_predicates,
+                                            _join_hash._probe_prefetching);
+      }
+    } else if (semi_or_anti) {
+      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, right_chunk_offsets, _mode,
+                                             secondary_predicates);
     } else {
       if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
-        probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+        probe<RightType, HashedType, true>(radix_right, hashtables, left_pos_lists, right_pos_lists,
+                                           left_chunk_offsets, right_chunk_offsets, _mode, secondary_predicates);
       } else {
-        probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+        probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists,
+                                            left_chunk_offsets, right_chunk_offsets, _mode, secondary_predicates);
       }
     }
 
-    auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
+    performance_data.probing = timer.lap();
+
+    // The probe splits heavy partitions into several ranges with their own PosLists (see determine_probe_ranges())
+    const auto pos_list_count = std::max(left_pos_lists.size(), right_pos_lists.size());
+    grow_pos_lists(left_pos_lists, pos_list_count);
+    grow_pos_lists(right_pos_lists, pos_list_count);
+
+    // Semi/Anti joins only output the relation on the left of the operator, which is the right relation here if the
+    // inputs are swapped
+    const auto only_output_right_input = semi_or_anti && _inputs_swapped;
+    const auto only_output_left_input = semi_or_anti && !_inputs_swapped;
 
     /**
      * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
@@ -325,16 +671,18 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       left_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
     }
 
-    // right_pos_lists_by_segment will only be needed if right is a reference table
-    if (right_in_table->type() == TableType::References) {
+    // right_pos_lists_by_segment will only be needed if right is a reference table and being output
+    if (right_in_table->type() == TableType::References && !only_output_left_input) {
       right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
     }
 
-    for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
+    for (size_t pos_list_idx = 0; pos_list_idx < left_pos_lists.size(); ++pos_list_idx) {
+      if (_join_hash.is_cancelled()) break;
+
       // moving the values into a shared pos list saves us some work in write_output_segments. We know that
       // left_pos_lists and right_pos_lists will not be used again.
-      auto left = std::make_shared<PosList>(std::move(left_pos_lists[partition_id]));
-      auto right = std::make_shared<PosList>(std::move(right_pos_lists[partition_id]));
+      auto left = make_shared_in_arena<PosList>(arena, std::move(left_pos_lists[pos_list_idx]));
+      auto right = make_shared_in_arena<PosList>(arena, std::move(right_pos_lists[pos_list_idx]));
 
       if (left->empty() && right->empty()) {
         continue;
@@ -344,20 +692,26 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       // we need to swap back the inputs, so that the order of the output columns is not harmed
       if (_inputs_swapped) {
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right, arena);
 
         // Semi/Anti joins are always swapped but do not need the outer relation
         if (!only_output_right_input) {
-          write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
+          write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left, arena);
         }
       } else {
-        write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+        write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left, arena);
+
+        // Semi/Anti joins that build the hash tables on their output side do not need the other relation
+        if (!only_output_left_input) {
+          write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right, arena);
+        }
       }
 
       _output_table->append_chunk(output_segments);
     }
 
+    performance_data.output_writing = timer.lap();
+
     return _output_table;
   }
 };
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <vector>
+
 #include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -9,7 +12,9 @@ namespace opossum {
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
- * If you want to filter by multiple criteria, you can chain this operator.
+ * Further predicates between the inputs (e.g., on the other columns of a composite key) can be passed as secondary
+ * predicates. Only the primary column is hashed, the secondary predicates are evaluated for each pair of rows with
+ * matching hashes while probing, so that rows that fail them never become part of the output.
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
@@ -20,9 +25,38 @@ class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const std::optional<size_t>& radix_bits = std::nullopt);
+           const std::optional<size_t>& radix_bits = std::nullopt,
+           const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<OperatorJoinPredicate>& secondary_predicates() const;
+
+  // Whether the probe phase prefetches the hash table slots of groups of probe keys (enabled by default), see probe()
+  // in join_hash_steps.hpp. Disabling it is mostly useful for benchmarking.
+  void set_probe_prefetching(const bool enabled);
+
+  struct PerformanceData : public OperatorPerformanceData {
+    // Number of bits used for radix partitioning, i.e., there are 2^radix_bits partitions and hash tables
+    size_t radix_bits{0};
+
+    // Durations of the steps of the join. Both inputs are materialized and partitioned concurrently, their durations
+    // are summed up.
+    std::chrono::nanoseconds materialization{0};
+    std::chrono::nanoseconds partitioning{0};
+    std::chrono::nanoseconds building{0};
+    std::chrono::nanoseconds probing{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    // Number of pairs of table partitions that were joined independently, see TablePartitioning
+    size_t table_partition_count{0};
+
+    // Whether the keys of the build side were unique, so that UniqueHashTables were used
+    bool unique_build_side{false};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -32,8 +66,17 @@ class JoinHash : public AbstractJoinOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_cleanup() override;
 
+  // Joins the pairs of table partitions of co-partitioned inputs in parallel, see _on_execute(). Returns nullptr if the
+  // inputs are not co-partitioned by their join columns.
+  std::shared_ptr<const Table> _join_partition_wise();
+
+  // Joins the inputs in pairs of partitions that are spilled to disk, see _on_execute()
+  std::shared_ptr<const Table> _join_spilled_partitions(const size_t required_bytes, const size_t available_bytes);
+
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   const std::optional<size_t> _radix_bits;
+  const std::vector<OperatorJoinPredicate> _secondary_predicates;
+  bool _probe_prefetching{true};
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Cache-line-blocked Bloom filter over precomputed hash values, as used by JoinHash to drop probe rows that cannot
+ * find a join partner before they are partitioned and probed.
+ *
+ * Each hash selects a single 64-byte block and sets one bit in each of the block's eight 64-bit words (a "split block"
+ * Bloom filter, see Putze, Sanders, Singler: Cache-, Hash- and Space-Efficient Bloom Filters, WEA 2007). Thus, both
+ * insert() and may_contain() touch exactly one cache line. With BITS_PER_ELEMENT bits per inserted element, the false
+ * positive rate is below 1%. There are no false negatives.
+ *
+ * insert() may be called concurrently, e.g., by the tasks building the hash tables of different partitions.
+ */
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr auto BITS_PER_ELEMENT = size_t{12};
+
+  explicit BloomFilter(const size_t expected_element_count) {
+    const auto min_block_count = (expected_element_count * BITS_PER_ELEMENT + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+
+    // Use a power of two so that the block can be selected with a mask
+    auto block_count = size_t{1};
+    while (block_count < min_block_count) block_count <<= 1;
+
+    _blocks = std::vector<Block>(block_count);
+    _block_mask = block_count - 1;
+  }
+
+  void insert(const size_t hash) {
+    const auto mixed_hash = _mix(hash);
+    auto& block = _blocks[_block_index(mixed_hash)];
+
+    for (auto word_id = size_t{0}; word_id < WORDS_PER_BLOCK; ++word_id) {
+      const auto mask = _bit_mask(mixed_hash, word_id);
+      auto& word = block.words[word_id];
+
+      // Avoid writing (and thus invalidating the cache line in other cores) if the bit is already set
+      if ((word.load(std::memory_order_relaxed) & mask) == 0) {
+        word.fetch_or(mask, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool may_contain(const size_t hash) const {
+    const auto mixed_hash = _mix(hash);
+    const auto& block = _blocks[_block_index(mixed_hash)];
+
+    auto matches = true;
+    for (auto word_id = size_t{0}; word_id < WORDS_PER_BLOCK; ++word_id) {
+      matches &= (block.words[word_id].load(std::memory_order_relaxed) & _bit_mask(mixed_hash, word_id)) != 0;
+    }
+    return matches;
+  }
+
+  size_t block_count() const { return _blocks.size(); }
+
+ private:
+  static constexpr auto WORDS_PER_BLOCK = size_t{8};
+  static constexpr auto BITS_PER_BLOCK = WORDS_PER_BLOCK * 64;
+
+  // Odd constants used to derive the bit positions of the eight words from a single hash, taken from Impala
+  static constexpr std::array<uint32_t, WORDS_PER_BLOCK> SALTS = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                                  0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+  struct alignas(64) Block {
+    std::array<std::atomic<uint64_t>, WORDS_PER_BLOCK> words;
+  };
+
+  // std::hash is the identity for integers, so the bits are spread before being used
+  static uint64_t _mix(const size_t hash) { return static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL; }
+
+  size_t _block_index(const uint64_t mixed_hash) const { return static_cast<size_t>(mixed_hash >> 32) & _block_mask; }
+
+  static uint64_t _bit_mask(const uint64_t mixed_hash, const size_t word_id) {
+    const auto bit = (static_cast<uint32_t>(mixed_hash) * SALTS[word_id]) >> 26;
+    return uint64_t{1} << bit;
+  }
+
+  std::vector<Block> _blocks;
+  size_t _block_mask{0};
+};
+
+}  // namespace opossum
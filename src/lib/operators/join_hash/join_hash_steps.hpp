@@ -1,18 +1,37 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <boost/container/pmr/global_resource.hpp>
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include "bloom_filter.hpp"
 #include "bytell_hash_map.hpp"
+#include "row_index.hpp"
+#include "unique_hash_table.hpp"
+#include "memory/arena_memory_resource.hpp"
+#include "memory/huge_page_memory_resource.hpp"
+#include "operators/operator_join_predicate.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment/dictionary_id_mapping.hpp"
+#include "storage/german_string.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "uninitialized_vector.hpp"
+#include "utils/write_combining_scatter.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -25,14 +44,15 @@ using Hash = size_t;
 
 /*
 This is how elements of the input relations are saved after materialization.
-The original value is used to detect hash collisions.
+The original value is used to detect hash collisions. The position of the element is stored as a RowIndex, see
+row_index.hpp.
 */
 template <typename T>
 struct PartitionedElement {
-  PartitionedElement() : row_id(NULL_ROW_ID), value(T()) {}
-  PartitionedElement(RowID row, T val) : row_id(row), value(val) {}
+  PartitionedElement() : row_index(INVALID_ROW_INDEX), value(T()) {}
+  PartitionedElement(RowIndex index, T val) : row_index(index), value(val) {}
 
-  RowID row_id;
+  RowIndex row_index;
   T value;
 };
 
@@ -42,15 +62,54 @@ template <typename T>
 using Partition = std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
                                      std::vector<PartitionedElement<T>>>;
 
-// The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
-// as n because in many cases, we join on primary key attributes where by definition we have only one match on the
-// smaller side.
-using SmallPosList = boost::container::small_vector<RowID, 1>;
+// The small_vector holds the first n values in local storage and only resorts to heap storage after that. In many
+// cases, we join on primary key attributes where by definition we have only one match on the smaller side. As a
+// RowIndex takes half the size of a RowID, two of them fit into the space that a single RowID would take.
+using SmallPosList = boost::container::small_vector<RowIndex, 2>;
 
 // In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
 // with bytell hash map and in some cases up to 5% faster) but is significantly larger than the bytell hash map.
+// The hash tables use a PolymorphicAllocator so that they can be allocated on the NUMA node of their partition.
 template <typename T>
-using HashTable = ska::bytell_hash_map<T, SmallPosList>;
+using HashTable = ska::bytell_hash_map<T, SmallPosList, std::hash<T>, std::equal_to<T>,
+                                       PolymorphicAllocator<std::pair<T, SmallPosList>>>;
+
+// Semi and anti joins that output the probe side only need to know whether a key exists on the build side. Storing the
+// distinct keys only saves the memory and allocations for the PosLists of highly duplicated build sides.
+template <typename T>
+using HashSet = ska::bytell_hash_set<T, std::hash<T>, std::equal_to<T>, PolymorphicAllocator<T>>;
+
+// The RowIndexes of the build rows with the given key as a range, which is empty if the key is not contained
+template <typename HashTableType, typename HashedType>
+std::pair<const RowIndex*, const RowIndex*> find_build_rows(const HashTableType& hashtable, const HashedType& key) {
+  if constexpr (std::is_same_v<HashTableType, UniqueHashTable<HashedType>>) {
+    const auto* row_index = hashtable.find(key);
+    return {row_index, row_index ? row_index + 1 : row_index};
+  } else {
+    const auto it = hashtable.find(key);
+    if (it == hashtable.end()) return {nullptr, nullptr};
+    return {it->second.data(), it->second.data() + it->second.size()};
+  }
+}
+
+/*
+NUMA placement: The radix partitions are assigned to the nodes of the Topology round-robin. The hash table of a
+partition is allocated on the partition's node, and the jobs that build and probe it are scheduled on that node, so
+that the random accesses into the hash tables stay node-local. Without multiple nodes, the jobs are scheduled on the
+current node and the hash tables use the process-wide HugePageMemoryResource.
+*/
+inline NodeID numa_node_for_partition(const size_t partition_id) {
+  const auto node_count = Topology::get().nodes().size();
+  if (node_count <= 1) return CURRENT_NODE_ID;
+  return static_cast<NodeID>(partition_id % node_count);
+}
+
+// Large hash tables are allocated from huge pages, see HugePageMemoryResource
+inline boost::container::pmr::memory_resource* numa_memory_resource_for_partition(const size_t partition_id) {
+  const auto node_id = numa_node_for_partition(partition_id);
+  if (node_id == CURRENT_NODE_ID) return HugePageMemoryResource::get_default();
+  return Topology::get().get_huge_page_memory_resource(static_cast<int>(node_id));
+}
 
 /*
 This struct contains radix-partitioned data in a contiguous buffer, as well as a list of offsets for each partition.
@@ -72,6 +131,9 @@ struct RadixContainer {
 
   // bit vector to store NULL flags
   std::shared_ptr<std::vector<bool>> null_value_bitvector;
+
+  // Holds the characters of long strings if T is GermanString
+  std::shared_ptr<ArenaMemoryResource> string_arena;
 };
 
 inline std::vector<size_t> determine_chunk_offsets(std::shared_ptr<const Table> table) {
@@ -86,13 +148,121 @@ inline std::vector<size_t> determine_chunk_offsets(std::shared_ptr<const Table>
   return chunk_offsets;
 }
 
+/*
+Evaluates the secondary predicates of a join, i.e., all predicates besides the hashed one, for a pair of a build row
+and a probe row. The RowIndexes are those written by materialize_input(), i.e., positions in the build and the probe
+input. The columns of the predicates are materialized per chunk upfront, so that the partitions can be probed in
+parallel. As in SQL, a predicate on a NULL value is not satisfied.
+*/
+class SecondaryPredicateEvaluator {
+ public:
+  // The first column of each predicate belongs to the build input
+  SecondaryPredicateEvaluator(const Table& build_table, const Table& probe_table,
+                              const std::vector<OperatorJoinPredicate>& predicates) {
+    for (const auto& predicate : predicates) {
+      const auto build_data_type = build_table.column_data_type(predicate.column_ids.first);
+      const auto probe_data_type = probe_table.column_data_type(predicate.column_ids.second);
+      Assert((build_data_type == DataType::String) == (probe_data_type == DataType::String),
+             "Strings can only be compared with strings");
+
+      resolve_data_type(build_data_type, [&](const auto build_type) {
+        using BuildType = typename decltype(build_type)::type;
+        const auto build_values = _materialize<BuildType>(build_table, predicate.column_ids.first);
+
+        resolve_data_type(probe_data_type, [&](const auto probe_type) {
+          using ProbeType = typename decltype(probe_type)::type;
+          if constexpr (std::is_same_v<BuildType, pmr_string> == std::is_same_v<ProbeType, pmr_string>) {
+            const auto probe_values = _materialize<ProbeType>(probe_table, predicate.column_ids.second);
+
+            with_comparator(predicate.predicate_condition, [&](const auto comparator) {
+              _predicates.emplace_back([build_values, probe_values, comparator](const RowIndex build_row_index,
+                                                                                const RowIndex probe_row_index) {
+                if (build_row_index == INVALID_ROW_INDEX || probe_row_index == INVALID_ROW_INDEX) return false;
+                const auto& build_value = (*build_values)[build_row_index];
+                const auto& probe_value = (*probe_values)[probe_row_index];
+                return build_value && probe_value && comparator(*build_value, *probe_value);
+              });
+            });
+          }
+        });
+      });
+    }
+  }
+
+  bool satisfied(const RowIndex build_row_index, const RowIndex probe_row_index) const {
+    for (const auto& predicate : _predicates) {
+      if (!predicate(build_row_index, probe_row_index)) return false;
+    }
+    return true;
+  }
+
+ protected:
+  template <typename T>
+  using MaterializedColumn = std::vector<std::optional<T>>;
+
+  // Values are stored at the RowIndex that materialize_input() uses, i.e., for ReferenceSegments at their position in
+  // the ReferenceSegment
+  template <typename T>
+  static std::shared_ptr<const MaterializedColumn<T>> _materialize(const Table& table, const ColumnID column_id) {
+    auto materialized_column = std::make_shared<MaterializedColumn<T>>(table.row_count());
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(table.chunk_count());
+
+    auto chunk_offset = size_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, chunk_offset]() {
+        const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+        auto values_iter = materialized_column->begin() + chunk_offset;
+
+        segment_iterate<T>(segment, [&](const auto& position) {
+          if (!position.is_null()) *values_iter = position.value();
+          ++values_iter;
+        });
+      }));
+      jobs.back()->schedule(preferred_node_for_chunk(table, chunk_id));
+      chunk_offset += table.get_chunk(chunk_id)->size();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    return materialized_column;
+  }
+
+  std::vector<std::function<bool(const RowIndex, const RowIndex)>> _predicates;
+};
+
+/*
+Materialize the join column of in_table. If a bloom_filter (filled by build()) is given, values that have no join
+partner on the build side are (mostly) dropped already during materialization. This is only valid if non-matching rows
+are not part of the join result, i.e., not for outer and anti joins.
+
+With ValueID as T, the ids of the given DictionaryIDMapping are materialized instead of the values. With GermanString
+as T, string columns are materialized as GermanStrings, whose long strings are copied into the string_arena of the
+returned RadixContainer. Compared to pmr_strings, this saves an allocation per long string, halves the size of the
+partitions, and lets most comparisons in the hash tables be decided by the inline prefix.
+*/
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    const BloomFilter* bloom_filter = nullptr,
+                                    const DictionaryIDMapping* dictionary_id_mapping = nullptr) {
+  DebugAssert(!consider_null_values || !bloom_filter, "NULL values cannot be kept if a BloomFilter is used");
+  DebugAssert((std::is_same_v<T, ValueID>) == (dictionary_id_mapping != nullptr),
+              "A DictionaryIDMapping is needed to materialize ids, and only then");
+  Assert(in_table->row_count() < INVALID_ROW_INDEX, "Too many rows to be addressed by RowIndexes");
+
   const std::hash<HashedType> hash_function;
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
 
+  // The data type of the segments
+  using ColumnDataType = std::conditional_t<std::is_same_v<T, GermanString>, pmr_string, T>;
+
+  [[maybe_unused]] auto string_arena = std::shared_ptr<ArenaMemoryResource>{};
+  if constexpr (std::is_same_v<T, GermanString>) {
+    string_arena = std::make_shared<ArenaMemoryResource>();
+  }
+
   [[maybe_unused]] auto null_value_bitvector = std::make_shared<std::vector<bool>>();
   if constexpr (consider_null_values) {
     null_value_bitvector->resize(in_table->row_count());
@@ -139,46 +309,66 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       // prepare histogram
       auto histogram = std::vector<size_t>(num_partitions);
 
-      auto reference_chunk_offset = ChunkOffset{0};
+      const auto materialize = [&](const bool is_null, const T& value, const ChunkOffset chunk_offset) {
+        auto hashed_value = Hash{0};
+        auto materialize_value = !is_null || consider_null_values;
+        if (materialize_value) {
+          hashed_value = hash_function(type_cast<HashedType>(value));
+
+          // Skip values that are guaranteed to have no join partner
+          if (bloom_filter && !bloom_filter->may_contain(hashed_value)) materialize_value = false;
+        }
+
+        if (materialize_value) {
+          const auto row_index = static_cast<RowIndex>(chunk_offsets[chunk_id] + chunk_offset);
+          *(output_iterator++) = PartitionedElement<T>{row_index, value};
+
+          // In case we care about NULL values, store the NULL flag
+          if constexpr (consider_null_values) {
+            if (is_null) {
+              *null_value_bitvector_iterator = true;
+            }
+          }
 
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
-        using IterableType = typename decltype(it)::IterableType;
+          const Hash radix = hashed_value & mask;
+          ++histogram[radix];
+          ++null_value_bitvector_iterator;
+        }
+      };
+
+      if constexpr (std::is_same_v<T, ValueID>) {
+        dictionary_id_mapping->for_each_id(*segment, materialize);
+      } else {
+        auto reference_chunk_offset = ChunkOffset{0};
 
-        while (it != end) {
-          const auto& value = *it;
-          ++it;
+        segment_with_iterators<ColumnDataType>(*segment, [&](auto it, const auto end) {
+          using IterableType = typename decltype(it)::IterableType;
 
-          if (!value.is_null() || consider_null_values) {
-            const Hash hashed_value = hash_function(type_cast<HashedType>(value.value()));
+          while (it != end) {
+            const auto& value = *it;
+            ++it;
 
             /*
             For ReferenceSegments we do not use the RowIDs from the referenced tables.
             Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
             values from different inputs (important for Multi Joins).
             */
-            if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+            auto chunk_offset = ChunkOffset{};
+            if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<ColumnDataType>>) {
+              chunk_offset = reference_chunk_offset++;
             } else {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+              chunk_offset = value.chunk_offset();
             }
 
-            // In case we care about NULL values, store the NULL flag
-            if constexpr (consider_null_values) {
-              if (value.is_null()) {
-                *null_value_bitvector_iterator = true;
-              }
+            if constexpr (std::is_same_v<T, GermanString>) {
+              const auto german_string = value.is_null() ? GermanString{} : GermanString{value.value(), *string_arena};
+              materialize(value.is_null(), german_string, chunk_offset);
+            } else {
+              materialize(value.is_null(), value.value(), chunk_offset);
             }
-
-            const Hash radix = hashed_value & mask;
-            ++histogram[radix];
-            ++null_value_bitvector_iterator;
-          }
-          // reference_chunk_offset is only used for ReferenceSegments
-          if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
-            ++reference_chunk_offset;
           }
-        }
-      });
+        });
+      }
 
       if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
         // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
@@ -190,23 +380,22 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       histograms[chunk_id] = std::move(histogram);
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(preferred_node_for_chunk(*in_table, chunk_id));
   }
   CurrentScheduler::wait_for_tasks(jobs);
 
-  return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector};
+  return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector, string_arena};
 }
 
 /*
-Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
+Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left.
+If a bloom_filter is given, the hashes of all inserted values are added to it so that it can be used to filter the
+probe side in materialize_input(). With HashSet as HashTableType, only the distinct keys are stored.
 */
-template <typename LeftType, typename HashedType>
-std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container) {
-  /*
-  NUMA notes:
-  The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
-  */
-  std::vector<std::optional<HashTable<HashedType>>> hashtables;
+template <typename LeftType, typename HashedType, typename HashTableType = HashTable<HashedType>>
+std::vector<std::optional<HashTableType>> build(const RadixContainer<LeftType>& radix_container,
+                                                BloomFilter* bloom_filter = nullptr) {
+  std::vector<std::optional<HashTableType>> hashtables;
   hashtables.resize(radix_container.partition_offsets.size());
 
   std::vector<std::shared_ptr<AbstractTask>> jobs;
@@ -229,32 +418,113 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
       auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
 
       // slightly oversize the hash table to avoid unnecessary rebuilds
-      auto hashtable = HashTable<HashedType>(static_cast<size_t>(partition_size * 1.2));
+      auto hashtable = HashTableType(static_cast<size_t>(partition_size * 1.2), typename HashTableType::hasher{},
+                                     typename HashTableType::key_equal{},
+                                     typename HashTableType::allocator_type{
+                                         numa_memory_resource_for_partition(current_partition_id)});
 
       for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
         auto& element = partition_left[partition_offset];
 
-        if (element.row_id == NULL_ROW_ID) {
+        if (element.row_index == INVALID_ROW_INDEX) {
           // Skip initialized PartitionedElements that might remain after materialization phase.
           continue;
         }
 
         auto casted_value = type_cast<HashedType>(std::move(element.value));
-        auto it = hashtable.find(casted_value);
-        if (it != hashtable.end()) {
-          it->second.emplace_back(element.row_id);
+        if (bloom_filter) {
+          bloom_filter->insert(std::hash<HashedType>{}(casted_value));
+        }
+
+        if constexpr (std::is_same_v<HashTableType, HashSet<HashedType>>) {
+          hashtable.emplace(std::move(casted_value));
         } else {
-          hashtable.emplace(casted_value, SmallPosList{element.row_id});
+          auto it = hashtable.find(casted_value);
+          if (it != hashtable.end()) {
+            it->second.emplace_back(element.row_index);
+          } else {
+            hashtable.emplace(casted_value, SmallPosList{element.row_index});
+          }
         }
       }
 
       hashtables[current_partition_id] = std::move(hashtable);
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(numa_node_for_partition(current_partition_id));
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return hashtables;
+}
+
+/*
+Build UniqueHashTables, which store a single RowIndex per key, for the partitions of Left. This only succeeds if the
+keys of Left are unique, e.g., because it is joined on its primary key. Otherwise, std::nullopt is returned as soon as
+one of the partitions finds a key twice, and the caller falls back to build(). The BloomFilter can be passed to build()
+again afterwards, as inserting the same hashes twice does not change it.
+*/
+template <typename LeftType, typename HashedType>
+std::optional<std::vector<std::optional<UniqueHashTable<HashedType>>>> build_unique(
+    const RadixContainer<LeftType>& radix_container, BloomFilter* bloom_filter = nullptr) {
+  std::vector<std::optional<UniqueHashTable<HashedType>>> hashtables;
+  hashtables.resize(radix_container.partition_offsets.size());
+
+  // Set by the first partition with a duplicate key, so that the other partitions stop building
+  auto keys_are_unique = std::atomic_bool{true};
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(radix_container.partition_offsets.size());
+
+  for (size_t current_partition_id = 0; current_partition_id < radix_container.partition_offsets.size();
+       ++current_partition_id) {
+    const auto partition_left_begin =
+        current_partition_id == 0 ? 0 : radix_container.partition_offsets[current_partition_id - 1];
+    const auto partition_left_end = radix_container.partition_offsets[current_partition_id];  // make end non-inclusive
+    const auto partition_size = partition_left_end - partition_left_begin;
+
+    if (partition_size == 0) {
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_left_begin, partition_left_end, current_partition_id,
+                                                 partition_size]() {
+      auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
+
+      auto hashtable = UniqueHashTable<HashedType>(
+          partition_size, PolymorphicAllocator<typename UniqueHashTable<HashedType>::Entry>{
+                              numa_memory_resource_for_partition(current_partition_id)});
+
+      for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
+        const auto& element = partition_left[partition_offset];
+
+        if (element.row_index == INVALID_ROW_INDEX) {
+          // Skip initialized PartitionedElements that might remain after materialization phase.
+          continue;
+        }
+
+        const auto casted_value = type_cast<HashedType>(element.value);
+        if (bloom_filter) {
+          bloom_filter->insert(std::hash<HashedType>{}(casted_value));
+        }
+
+        if (!hashtable.insert(casted_value, element.row_index)) {
+          keys_are_unique = false;
+          return;
+        }
+
+        // Stop early if another partition found a duplicate. Checking every 64 elements is frequent enough.
+        if ((partition_offset & 63) == 0 && !keys_are_unique.load(std::memory_order_relaxed)) return;
+      }
+
+      hashtables[current_partition_id] = std::move(hashtable);
+    }));
+    jobs.back()->schedule(numa_node_for_partition(current_partition_id));
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  if (!keys_are_unique) return std::nullopt;
   return hashtables;
 }
 
@@ -294,6 +564,7 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   radix_output.elements = output;
   radix_output.partition_offsets.resize(num_partitions);
   radix_output.null_value_bitvector = output_nulls;
+  radix_output.string_arena = radix_container.string_arena;
 
   // use histograms to calculate partition offsets
   size_t offset = 0;
@@ -321,15 +592,21 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
         input_size = container_elements.size() - input_offset;
       }
 
+      auto destinations = std::vector<PartitionedElement<T>*>(num_partitions);
+      for (auto partition_id = size_t{0}; partition_id < num_partitions; ++partition_id) {
+        destinations[partition_id] = output->data() + output_offsets[partition_id];
+      }
+      auto scatter = WriteCombiningScatter<PartitionedElement<T>>{std::move(destinations)};
+
       for (size_t chunk_offset = input_offset; chunk_offset < input_offset + input_size; ++chunk_offset) {
         auto& element = container_elements[chunk_offset];
 
         // In case of NULL-removing inner-joins, we ignore all NULL values.
         // Such values can be created in several ways: join input already has non-phyiscal NULL values (non-physical
         // means no RowID, e.g., created during an OUTER join), a physical value is NULL but is ignored for an inner
-        // join (hence, we overwrite the RowID with NULL_ROW_ID), or it is simply a remainder of the pre-sized
-        // RadixPartition which is initialized with default values (i.e., NULL_ROW_IDs).
-        if (!consider_null_values && element.row_id == NULL_ROW_ID) {
+        // join (hence, it is not materialized), or it is simply a remainder of the pre-sized RadixPartition which is
+        // initialized with default values (i.e., INVALID_ROW_INDEXes).
+        if (!consider_null_values && element.row_index == INVALID_ROW_INDEX) {
           continue;
         }
 
@@ -339,11 +616,13 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
         // we need to keep them during the radix clustering phase.
         if constexpr (consider_null_values) {
           (*output_nulls)[output_offsets[radix]] = null_value_bitvector[chunk_offset];
+          ++output_offsets[radix];
         }
 
-        (*output)[output_offsets[radix]] = element;
-        ++output_offsets[radix];
+        scatter.push(radix, element);
       }
+
+      scatter.flush();
     }));
     jobs.back()->schedule();
   }
@@ -353,41 +632,96 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   return radix_output;
 }
 
+/*
+The probe phase is parallelized over ranges of the partitions of the probe side. Usually, each partition is a single
+range. With skewed join keys (e.g., a few customers with most of the orders), a single partition can hold most rows,
+and its JobTask would run long after all other partitions are done. The RadixContainer's partition offsets, which are
+derived from the histograms of materialize_input(), reveal such heavy partitions. As the hash table of a partition is
+only read while probing, it is shared by all ranges of the partition, which are probed by separate JobTasks. Each
+range writes its own PosLists.
+*/
+constexpr auto PROBE_RANGE_MIN_SIZE = size_t{1} << 14;
+constexpr auto PROBE_RANGE_MAX_SIZE = size_t{1} << 17;
+
+struct ProbeRange {
+  size_t partition_id;
+  size_t begin;
+  size_t end;
+};
+
+// Splits the partitions into ranges of about the average partition size. Empty partitions have no range.
+inline std::vector<ProbeRange> determine_probe_ranges(const std::vector<size_t>& partition_offsets) {
+  std::vector<ProbeRange> probe_ranges;
+  if (partition_offsets.empty()) return probe_ranges;
+
+  const auto average_partition_size = partition_offsets.back() / partition_offsets.size();
+  const auto range_size = std::clamp(average_partition_size, PROBE_RANGE_MIN_SIZE, PROBE_RANGE_MAX_SIZE);
+
+  for (auto partition_id = size_t{0}; partition_id < partition_offsets.size(); ++partition_id) {
+    const auto partition_begin = partition_id == 0 ? 0 : partition_offsets[partition_id - 1];
+    const auto partition_end = partition_offsets[partition_id];
+
+    for (auto range_begin = partition_begin; range_begin < partition_end; range_begin += range_size) {
+      const auto range_end = std::min(range_begin + range_size, partition_end);
+      probe_ranges.emplace_back(ProbeRange{partition_id, range_begin, range_end});
+    }
+  }
+
+  return probe_ranges;
+}
+
+// Number of probe keys whose hash table slots are prefetched together, see probe()
+constexpr auto PROBE_GROUP_SIZE = size_t{16};
+
+// Appends empty PosLists (using the allocator of the existing ones) until there are @param count of them
+inline void grow_pos_lists(std::vector<PosList>& pos_lists, const size_t count) {
+  const auto allocator = pos_lists.empty() ? PosList::allocator_type{} : pos_lists.front().get_allocator();
+  while (pos_lists.size() < count) {
+    pos_lists.emplace_back(allocator);
+  }
+}
+
 /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
-  number of hash tables that need to be looked into to just 1.
+  number of hash tables that need to be looked into to just 1. The hash tables are HashTables or, if the keys of the
+  build side are unique, UniqueHashTables.
+
+  Once the hash tables exceed the caches, every lookup is a cache miss that the next lookup has to wait for. With
+  use_prefetching, the keys are therefore probed in groups of PROBE_GROUP_SIZE whose slots are prefetched upfront
+  (group prefetching). Only UniqueHashTables can prefetch their slots, as bytell_hash_map does not expose where a key
+  is stored.
+
+  The RowIndexes of the matches are decoded into the RowIDs of the output PosLists using the chunk offsets of the
+  build (left) and the probe (right) input.
   */
-template <typename RightType, typename HashedType, bool consider_null_values>
+template <typename RightType, typename HashedType, bool consider_null_values,
+          typename HashTableType = HashTable<HashedType>>
 void probe(const RadixContainer<RightType>& radix_container,
-           const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
-           std::vector<PosList>& pos_lists_right, const JoinMode mode) {
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(radix_container.partition_offsets.size());
+           const std::vector<std::optional<HashTableType>>& hashtables, std::vector<PosList>& pos_lists_left,
+           std::vector<PosList>& pos_lists_right, const std::vector<size_t>& chunk_offsets_left,
+           const std::vector<size_t>& chunk_offsets_right, const JoinMode mode,
+           const SecondaryPredicateEvaluator* secondary_predicates = nullptr, const bool use_prefetching = true) {
+  // Empty partitions have no range, which avoids empty output chunks
+  const auto probe_ranges = determine_probe_ranges(radix_container.partition_offsets);
+  grow_pos_lists(pos_lists_left, probe_ranges.size());
+  grow_pos_lists(pos_lists_right, probe_ranges.size());
 
-  /*
-    NUMA notes:
-    At this point both input relations are partitioned using radix partitioning.
-    Probing will be done per partition for both sides.
-    Therefore, inputs for one partition should be located on the same NUMA node,
-    and the job that probes that partition should also be on that NUMA node.
-  */
-  for (size_t current_partition_id = 0; current_partition_id < radix_container.partition_offsets.size();
-       ++current_partition_id) {
-    const auto partition_begin =
-        current_partition_id == 0 ? 0 : radix_container.partition_offsets[current_partition_id - 1];
-    const auto partition_end = radix_container.partition_offsets[current_partition_id];  // make end non-inclusive
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(probe_ranges.size());
 
-    // Skip empty partitions to avoid empty output chunks
-    if (partition_begin == partition_end) {
-      continue;
-    }
+  // The ranges of a partition are probed on the NUMA node that holds the partition's hash table
+  for (size_t range_id = 0; range_id < probe_ranges.size(); ++range_id) {
+    const auto [current_partition_id, partition_begin, partition_end] = probe_ranges[range_id];
 
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id, current_partition_id = current_partition_id,
+                                                 partition_begin = partition_begin, partition_end = partition_end]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
-      PosList pos_list_left_local;
-      PosList pos_list_right_local;
+      PosList pos_list_left_local{pos_lists_left[range_id].get_allocator()};
+      PosList pos_list_right_local{pos_lists_right[range_id].get_allocator()};
+      auto row_id_decoder_left = RowIDDecoder{chunk_offsets_left};
+      auto row_id_decoder_right = RowIDDecoder{chunk_offsets_right};
 
       if constexpr (consider_null_values) {
         DebugAssert(
@@ -405,52 +739,80 @@ void probe(const RadixContainer<RightType>& radix_container,
         pos_list_left_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_right_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-          auto& row = partition[partition_offset];
+        // The rows are probed in groups. With prefetching, the hash table slots of all keys of a group are requested
+        // before the first one is looked up, so that the cache misses of the lookups overlap.
+        for (auto group_begin = partition_begin; group_begin < partition_end; group_begin += PROBE_GROUP_SIZE) {
+          const auto group_end = std::min(group_begin + PROBE_GROUP_SIZE, partition_end);
 
-          if (mode == JoinMode::Inner && row.row_id == NULL_ROW_ID) {
-            // From previous joins, we could potentially have NULL values that do not refer to
-            // an actual row but to the NULL_ROW_ID. Hence, we can only skip for inner joins.
-            continue;
+          if constexpr (std::is_same_v<HashTableType, UniqueHashTable<HashedType>>) {
+            if (use_prefetching) {
+              for (auto partition_offset = group_begin; partition_offset < group_end; ++partition_offset) {
+                hashtable.prefetch(type_cast<HashedType>(partition[partition_offset].value));
+              }
+            }
           }
 
-          const auto& rows_iter = hashtable.find(type_cast<HashedType>(row.value));
+          for (auto partition_offset = group_begin; partition_offset < group_end; ++partition_offset) {
+            auto& row = partition[partition_offset];
 
-          if (rows_iter != hashtable.end()) {
-            // Key exists, thus we have at least one hit
-            const auto& matching_rows = rows_iter->second;
+            if (mode == JoinMode::Inner && row.row_index == INVALID_ROW_INDEX) {
+              // Unused slots of the partitions do not refer to an actual row. We can only skip them for inner joins,
+              // as the NULL values of outer joins are materialized.
+              continue;
+            }
 
-            // Since we cannot store NULL values directly in off-the-shelf containers,
-            // we need to the check the NULL bit vector here because a NULL value (represented
-            // as a zero) yields the same rows as an actual zero value.
-            // For inner joins, we skip NULL values and output them for outer joins.
-            // Note, if the materialization/radix partitioning phase did not explicitely consider
-            // NULL values, they will not be handed to the probe function.
-            if constexpr (consider_null_values) {
-              if ((*radix_container.null_value_bitvector)[partition_offset]) {
-                if (mode == JoinMode::Left || mode == JoinMode::Right) {
-                  pos_list_left_local.emplace_back(NULL_ROW_ID);
-                  pos_list_right_local.emplace_back(row.row_id);
+            const auto [matching_rows_begin, matching_rows_end] =
+                find_build_rows(hashtable, type_cast<HashedType>(row.value));
+
+            if (matching_rows_begin != matching_rows_end) {
+              // Key exists, thus we have at least one hit
+
+              // Since we cannot store NULL values directly in off-the-shelf containers,
+              // we need to the check the NULL bit vector here because a NULL value (represented
+              // as a zero) yields the same rows as an actual zero value.
+              // For inner joins, we skip NULL values and output them for outer joins.
+              // Note, if the materialization/radix partitioning phase did not explicitely consider
+              // NULL values, they will not be handed to the probe function.
+              if constexpr (consider_null_values) {
+                if ((*radix_container.null_value_bitvector)[partition_offset]) {
+                  if (mode == JoinMode::Left || mode == JoinMode::Right) {
+                    pos_list_left_local.emplace_back(NULL_ROW_ID);
+                    pos_list_right_local.emplace_back(row_id_decoder_right.decode(row.row_index));
+                  }
+                  // ignore found matches and continue with next probe item
+                  continue;
                 }
-                // ignore found matches and continue with next probe item
-                continue;
               }
-            }
 
-            // If NULL values are discarded, the matching row pairs will be written to the result pos lists.
-            for (const auto& row_id : matching_rows) {
-              pos_list_left_local.emplace_back(row_id);
-              pos_list_right_local.emplace_back(row.row_id);
-            }
-          } else {
-            // We have not found matching items. Only continue for non-equi join modes.
-            // We use constexpr to prune this conditional for the equi-join implementation.
-            // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
-            // relation since the relations are swapped upfront.
-            if constexpr (consider_null_values) {
-              if (mode == JoinMode::Left || mode == JoinMode::Right) {
-                pos_list_left_local.emplace_back(NULL_ROW_ID);
-                pos_list_right_local.emplace_back(row.row_id);
+              // If NULL values are discarded, the matching row pairs will be written to the result pos lists. Pairs
+              // that fail one of the secondary predicates are not part of the result.
+              auto match_found = false;
+              for (auto matching_row = matching_rows_begin; matching_row != matching_rows_end; ++matching_row) {
+                const auto build_row_index = *matching_row;
+                if (secondary_predicates && !secondary_predicates->satisfied(build_row_index, row.row_index)) continue;
+
+                pos_list_left_local.emplace_back(row_id_decoder_left.decode(build_row_index));
+                pos_list_right_local.emplace_back(row_id_decoder_right.decode(row.row_index));
+                match_found = true;
+              }
+
+              // If all pairs failed the secondary predicates, the row has no join partner after all
+              if constexpr (consider_null_values) {
+                if (!match_found && (mode == JoinMode::Left || mode == JoinMode::Right)) {
+                  pos_list_left_local.emplace_back(NULL_ROW_ID);
+                  pos_list_right_local.emplace_back(row_id_decoder_right.decode(row.row_index));
+                }
+              }
+            } else {
+              // We have not found matching items. Only continue for non-equi join modes.
+              // We use constexpr to prune this conditional for the equi-join implementation.
+              // Note, the outer relation (i.e., left relation for LEFT OUTER JOINs) is the probing
+              // relation since the relations are swapped upfront.
+              if constexpr (consider_null_values) {
+                if (mode == JoinMode::Left || mode == JoinMode::Right) {
+                  pos_list_left_local.emplace_back(NULL_ROW_ID);
+                  pos_list_right_local.emplace_back(row_id_decoder_right.decode(row.row_index));
+                }
               }
             }
           }
@@ -475,46 +837,53 @@ void probe(const RadixContainer<RightType>& radix_container,
             for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
               auto& row = partition[partition_offset];
               pos_list_left_local.emplace_back(NULL_ROW_ID);
-              pos_list_right_local.emplace_back(row.row_id);
+              pos_list_right_local.emplace_back(row_id_decoder_right.decode(row.row_index));
             }
           }
         }
       }
 
       if (!pos_list_left_local.empty()) {
-        pos_lists_left[current_partition_id] = std::move(pos_list_left_local);
-        pos_lists_right[current_partition_id] = std::move(pos_list_right_local);
+        pos_lists_left[range_id] = std::move(pos_list_left_local);
+        pos_lists_right[range_id] = std::move(pos_list_right_local);
       }
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(numa_node_for_partition(current_partition_id));
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
 }
 
-template <typename RightType, typename HashedType>
+/*
+Probes the hash tables for a semi or anti join that outputs the probe side. The hash tables can be HashSets unless
+secondary predicates are given, which need the RowIndexes of the build side. Those are also held by UniqueHashTables.
+The RowIndexes of the output rows are decoded using the chunk offsets of the probe side.
+*/
+template <typename RightType, typename HashedType, typename HashTableType>
 void probe_semi_anti(const RadixContainer<RightType>& radix_container,
-                     const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
-                     std::vector<PosList>& pos_lists, const JoinMode mode) {
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(radix_container.partition_offsets.size());
+                     const std::vector<std::optional<HashTableType>>& hashtables, std::vector<PosList>& pos_lists,
+                     const std::vector<size_t>& chunk_offsets, const JoinMode mode,
+                     const SecondaryPredicateEvaluator* secondary_predicates = nullptr) {
+  constexpr auto keys_only = std::is_same_v<HashTableType, HashSet<HashedType>>;
+  DebugAssert(!keys_only || !secondary_predicates, "Secondary predicates need the RowIndexes of the build side");
 
-  for (size_t current_partition_id = 0; current_partition_id < radix_container.partition_offsets.size();
-       ++current_partition_id) {
-    const auto partition_begin =
-        current_partition_id == 0 ? 0 : radix_container.partition_offsets[current_partition_id - 1];
-    const auto partition_end = radix_container.partition_offsets[current_partition_id];  // make end non-inclusive
+  // Empty partitions have no range, which avoids empty output chunks
+  const auto probe_ranges = determine_probe_ranges(radix_container.partition_offsets);
+  grow_pos_lists(pos_lists, probe_ranges.size());
 
-    // Skip empty partitions to avoid empty output chunks
-    if (partition_begin == partition_end) {
-      continue;
-    }
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(probe_ranges.size());
 
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+  for (size_t range_id = 0; range_id < probe_ranges.size(); ++range_id) {
+    const auto [current_partition_id, partition_begin, partition_end] = probe_ranges[range_id];
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id, current_partition_id = current_partition_id,
+                                                 partition_begin = partition_begin, partition_end = partition_end]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
 
-      PosList pos_list_local;
+      PosList pos_list_local{pos_lists[range_id].get_allocator()};
+      auto row_id_decoder = RowIDDecoder{chunk_offsets};
 
       if (hashtables[current_partition_id].has_value()) {
         // Valid hashtable found, so there is at least one match in this partition
@@ -522,17 +891,31 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
         for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
           auto& row = partition[partition_offset];
 
-          if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+          if (row.row_index == INVALID_ROW_INDEX) {
             continue;
           }
 
           const auto& hashtable = hashtables[current_partition_id].value();
-          const auto it = hashtable.find(type_cast<HashedType>(row.value));
 
-          if ((mode == JoinMode::Semi && it != hashtable.end()) || (mode == JoinMode::Anti && it == hashtable.end())) {
+          // With secondary predicates, at least one of the rows with the same key needs to satisfy them
+          auto match_found = false;
+          if constexpr (keys_only) {
+            match_found = hashtable.count(type_cast<HashedType>(row.value)) > 0;
+          } else {
+            const auto [matching_rows_begin, matching_rows_end] =
+                find_build_rows(hashtable, type_cast<HashedType>(row.value));
+            match_found = matching_rows_begin != matching_rows_end;
+            if (match_found && secondary_predicates) {
+              match_found = std::any_of(matching_rows_begin, matching_rows_end, [&](const auto build_row_index) {
+                return secondary_predicates->satisfied(build_row_index, row.row_index);
+              });
+            }
+          }
+
+          if ((mode == JoinMode::Semi && match_found) || (mode == JoinMode::Anti && !match_found)) {
             // Semi: found at least one match for this row -> match
             // Anti: no matching rows found -> match
-            pos_list_local.emplace_back(row.row_id);
+            pos_list_local.emplace_back(row_id_decoder.decode(row.row_index));
           }
         }
       } else if (mode == JoinMode::Anti) {
@@ -540,7 +923,80 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
         pos_list_local.reserve(partition_end - partition_begin);
         for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
           auto& row = partition[partition_offset];
-          pos_list_local.emplace_back(row.row_id);
+          pos_list_local.emplace_back(row_id_decoder.decode(row.row_index));
+        }
+      }
+
+      if (!pos_list_local.empty()) {
+        pos_lists[range_id] = std::move(pos_list_local);
+      }
+    }));
+    jobs.back()->schedule(numa_node_for_partition(current_partition_id));
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+/*
+Probes the hash tables for a semi or anti join that outputs the build side. This is used if the output side is much
+smaller than the other input, so that only its rows need to be held in the hash tables while the larger input is
+streamed through. Instead of marking matched entries in a bitmap, they are erased from the hash tables: For semi joins,
+the rows of a key are written to the output when the key is matched first. For anti joins, the rows of the keys that
+were never matched remain in the hash tables and are written to the output once the partition is probed. The
+RowIndexes of the output rows are decoded using the chunk offsets of the build side.
+*/
+template <typename RightType, typename HashedType>
+void probe_semi_anti_build_side(const RadixContainer<RightType>& radix_container,
+                                std::vector<std::optional<HashTable<HashedType>>>& hashtables,
+                                std::vector<PosList>& pos_lists, const std::vector<size_t>& chunk_offsets,
+                                const JoinMode mode) {
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(hashtables.size());
+
+  for (size_t current_partition_id = 0; current_partition_id < hashtables.size(); ++current_partition_id) {
+    // Without a hash table, the partition has no rows of the output side
+    if (!hashtables[current_partition_id]) {
+      continue;
+    }
+
+    const auto partition_begin =
+        current_partition_id == 0 ? 0 : radix_container.partition_offsets[current_partition_id - 1];
+    const auto partition_end = radix_container.partition_offsets[current_partition_id];  // make end non-inclusive
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+      auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
+      auto& hashtable = *hashtables[current_partition_id];
+
+      PosList pos_list_local{pos_lists[current_partition_id].get_allocator()};
+      auto row_id_decoder = RowIDDecoder{chunk_offsets};
+      const auto write_rows = [&](const SmallPosList& row_indexes) {
+        for (const auto row_index : row_indexes) {
+          pos_list_local.emplace_back(row_id_decoder.decode(row_index));
+        }
+      };
+
+      for (size_t partition_offset = partition_begin; partition_offset < partition_end && !hashtable.empty();
+           ++partition_offset) {
+        const auto& row = partition[partition_offset];
+
+        if (row.row_index == INVALID_ROW_INDEX) {
+          continue;
+        }
+
+        const auto it = hashtable.find(type_cast<HashedType>(row.value));
+        if (it == hashtable.end()) {
+          continue;
+        }
+
+        if (mode == JoinMode::Semi) {
+          write_rows(it->second);
+        }
+        hashtable.erase(it);
+      }
+
+      if (mode == JoinMode::Anti) {
+        for (const auto& entry : hashtable) {
+          write_rows(entry.second);
         }
       }
 
@@ -548,7 +1004,7 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
         pos_lists[current_partition_id] = std::move(pos_list_local);
       }
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(numa_node_for_partition(current_partition_id));
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
@@ -591,7 +1047,8 @@ inline PosListsBySegment setup_pos_lists_by_segment(const std::shared_ptr<const
 
 inline void write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                                   const PosListsBySegment& input_pos_list_ptrs_sptrs_by_segments,
-                                  std::shared_ptr<PosList> pos_list) {
+                                  std::shared_ptr<PosList> pos_list,
+                                  const std::shared_ptr<ArenaMemoryResource>& arena = nullptr) {
   std::map<std::shared_ptr<PosLists>, std::shared_ptr<PosList>> output_pos_list_cache;
 
   // We might use this later, but want to have it outside of the for loop
@@ -606,7 +1063,7 @@ inline void write_output_segments(Segments& output_segments, const std::shared_p
         auto iter = output_pos_list_cache.find(input_table_pos_lists);
         if (iter == output_pos_list_cache.end()) {
           // Get the row ids that are referenced
-          auto new_pos_list = std::make_shared<PosList>(pos_list->size());
+          auto new_pos_list = make_shared_in_arena<PosList>(arena, pos_list->size());
           auto new_pos_list_iter = new_pos_list->begin();
           for (const auto& row : *pos_list) {
             if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
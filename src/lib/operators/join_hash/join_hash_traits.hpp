@@ -3,6 +3,9 @@
 #include <string>
 #include <type_traits>
 
+#include "storage/german_string.hpp"
+#include "types.hpp"
+
 namespace opossum {
 
 // JoinHashTraits
@@ -35,6 +38,20 @@ struct JoinHashTraits<L, R,
   static constexpr bool needs_lexical_cast = false;
 };
 
+// The ids of a DictionaryIDMapping are hashed as they are
+template <>
+struct JoinHashTraits<ValueID, ValueID> {
+  using HashType = ValueID;
+  static constexpr bool needs_lexical_cast = false;
+};
+
+// String columns on both sides are joined on GermanStrings, see materialize_input()
+template <>
+struct JoinHashTraits<GermanString, GermanString> {
+  using HashType = GermanString;
+  static constexpr bool needs_lexical_cast = false;
+};
+
 // Joining with strings will use strings for hashing and a lexical cast if necessary
 template <typename L, typename R>
 struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, pmr_string> || std::is_same_v<L, pmr_string>>> {
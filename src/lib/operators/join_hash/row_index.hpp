@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * JoinHash does not store the RowID of every materialized row in the radix partitions and hash tables, but the index
+ * of the row in its input table, i.e., the number of rows in the previous chunks (see determine_chunk_offsets()) plus
+ * its ChunkOffset. This halves the size of the positions, so that, e.g., a PartitionedElement<int> takes 8 instead of
+ * 12 bytes. The RowIDs are only restored by a RowIDDecoder when the output PosLists are written. Thus, the inputs of a
+ * JoinHash can hold at most INVALID_ROW_INDEX - 1 rows.
+ */
+using RowIndex = uint32_t;
+
+// Marks slots of the partitions that are not used, similar to NULL_ROW_ID for RowIDs
+constexpr auto INVALID_ROW_INDEX = std::numeric_limits<RowIndex>::max();
+
+class RowIDDecoder {
+ public:
+  // The chunk offsets of the input, as returned by determine_chunk_offsets()
+  explicit RowIDDecoder(const std::vector<size_t>& chunk_offsets) : _chunk_offsets(chunk_offsets) {}
+
+  // Consecutive indexes are usually in the same chunk (e.g., the probe side of a partition is ordered by RowIndex, and
+  // single-chunk inputs have only one chunk). Thus, the chunk of the previous index is tried before searching.
+  RowID decode(const RowIndex row_index) {
+    if (row_index == INVALID_ROW_INDEX) return NULL_ROW_ID;
+
+    if (row_index < _chunk_begin || row_index >= _chunk_end) {
+      // The last chunk whose offset is not larger than the index holds it. Empty chunks share the offset of their
+      // successor and are thus skipped.
+      const auto chunk_iter = std::upper_bound(_chunk_offsets.begin(), _chunk_offsets.end(), size_t{row_index});
+      DebugAssert(chunk_iter != _chunk_offsets.begin(), "RowIndex precedes the first chunk");
+
+      _chunk_id = ChunkID{static_cast<ChunkID::base_type>(std::distance(_chunk_offsets.begin(), chunk_iter) - 1)};
+      _chunk_begin = *(chunk_iter - 1);
+      _chunk_end = chunk_iter == _chunk_offsets.end() ? std::numeric_limits<size_t>::max() : *chunk_iter;
+    }
+
+    return RowID{_chunk_id, static_cast<ChunkOffset>(row_index - _chunk_begin)};
+  }
+
+ private:
+  const std::vector<size_t>& _chunk_offsets;
+
+  // The range of indexes of the chunk of the previous index, which is empty initially
+  ChunkID _chunk_id{0};
+  size_t _chunk_begin{0};
+  size_t _chunk_end{0};
+};
+
+}  // namespace opossum
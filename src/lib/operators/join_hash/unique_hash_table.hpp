@@ -0,0 +1,139 @@
+#pragma once
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "row_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Hash table for JoinHash build sides whose keys are unique, e.g., primary keys. Instead of a SmallPosList per key (as
+ * in HashTable), the single RowIndex (see row_index.hpp) of a key is stored next to the key in a flat array of slots
+ * (open addressing). This saves the memory of the SmallPosLists and an indirection per probed key.
+ *
+ * The slots are organized in groups of GROUP_SIZE slots with one control byte per slot, as in Abseil's SwissTable.
+ * A control byte either marks an empty slot or holds seven bits of the hash of the slot's key. A lookup compares the
+ * control bytes of a group with the hash bits at once (using SSE2 on x86) and only compares the keys of the matching
+ * slots. As keys are never erased, a group with an empty slot ends the lookup. Otherwise, the next group is probed.
+ *
+ * The capacity is fixed on construction, as JoinHash knows the number of rows of each partition upfront.
+ */
+template <typename T>
+class UniqueHashTable {
+ public:
+  static constexpr auto GROUP_SIZE = size_t{16};
+
+  struct Entry {
+    T key;
+    RowIndex row_index;
+  };
+
+  using allocator_type = PolymorphicAllocator<Entry>;
+
+  explicit UniqueHashTable(const size_t capacity, const allocator_type& allocator = {}) {
+    // Keep the load factor below 7/8, so that every lookup finds a group with an empty slot
+    const auto min_group_count = (capacity + capacity / 7 + GROUP_SIZE) / GROUP_SIZE;
+
+    // Use a power of two so that the group can be selected with a mask
+    auto group_count = size_t{1};
+    while (group_count < min_group_count) group_count <<= 1;
+    _group_mask = group_count - 1;
+
+    _control_bytes = pmr_vector<uint8_t>(group_count * GROUP_SIZE, EMPTY, PolymorphicAllocator<uint8_t>{allocator});
+    _entries = pmr_vector<Entry>(group_count * GROUP_SIZE, allocator);
+  }
+
+  // Returns false (and does not insert anything) if the key is already contained, i.e., the keys are not unique
+  bool insert(const T& key, const RowIndex row_index) {
+    const auto mixed_hash = _mix(std::hash<T>{}(key));
+    const auto hash_bits = _hash_bits(mixed_hash);
+
+    for (auto group = _group(mixed_hash);; group = (group + 1) & _group_mask) {
+      const auto [match_mask, empty_mask] = _match_group(group, hash_bits);
+
+      for (auto mask = match_mask; mask != 0; mask &= mask - 1) {
+        if (_entries[group * GROUP_SIZE + __builtin_ctz(mask)].key == key) return false;
+      }
+
+      if (empty_mask != 0) {
+        const auto slot = group * GROUP_SIZE + __builtin_ctz(empty_mask);
+        _control_bytes[slot] = hash_bits;
+        _entries[slot] = Entry{key, row_index};
+        ++_size;
+        return true;
+      }
+    }
+  }
+
+  // The RowIndex of the key, or nullptr if the key is not contained
+  const RowIndex* find(const T& key) const {
+    const auto mixed_hash = _mix(std::hash<T>{}(key));
+    const auto hash_bits = _hash_bits(mixed_hash);
+
+    for (auto group = _group(mixed_hash);; group = (group + 1) & _group_mask) {
+      const auto [match_mask, empty_mask] = _match_group(group, hash_bits);
+
+      for (auto mask = match_mask; mask != 0; mask &= mask - 1) {
+        const auto& entry = _entries[group * GROUP_SIZE + __builtin_ctz(mask)];
+        if (entry.key == key) return &entry.row_index;
+      }
+
+      if (empty_mask != 0) return nullptr;
+    }
+  }
+
+  // Prefetches the slots of the first group that find(key) looks at, so that the cache misses of lookups can overlap
+  void prefetch(const T& key) const {
+    const auto group = _group(_mix(std::hash<T>{}(key)));
+    __builtin_prefetch(&_control_bytes[group * GROUP_SIZE]);
+    __builtin_prefetch(&_entries[group * GROUP_SIZE]);
+  }
+
+  size_t size() const { return _size; }
+
+  size_t memory_usage() const { return _control_bytes.size() * (sizeof(uint8_t) + sizeof(Entry)); }
+
+ private:
+  // Control bytes of empty slots have the highest bit set, those of used slots hold seven bits of the hash
+  static constexpr auto EMPTY = uint8_t{0x80};
+
+  // std::hash is the identity for integers, so the bits are spread before being used. The radix partitioning of
+  // JoinHash already used the lowest bits of the hash, so that these are the same for all keys of a partition.
+  static uint64_t _mix(const size_t hash) { return static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL; }
+
+  size_t _group(const uint64_t mixed_hash) const { return static_cast<size_t>(mixed_hash >> 32) & _group_mask; }
+
+  static uint8_t _hash_bits(const uint64_t mixed_hash) { return static_cast<uint8_t>((mixed_hash >> 25) & 0x7F); }
+
+  // Bit masks of the slots of the group whose control bytes equal hash_bits, and of the empty slots
+  std::pair<uint32_t, uint32_t> _match_group(const size_t group, const uint8_t hash_bits) const {
+    const auto* control_bytes = &_control_bytes[group * GROUP_SIZE];
+#if defined(__x86_64__)
+    const auto group_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control_bytes));
+    const auto match_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(group_bytes, _mm_set1_epi8(static_cast<char>(hash_bits))));
+    return {static_cast<uint32_t>(match_mask), static_cast<uint32_t>(_mm_movemask_epi8(group_bytes))};
+#else
+    auto match_mask = uint32_t{0};
+    auto empty_mask = uint32_t{0};
+    for (auto slot = size_t{0}; slot < GROUP_SIZE; ++slot) {
+      match_mask |= static_cast<uint32_t>(control_bytes[slot] == hash_bits) << slot;
+      empty_mask |= static_cast<uint32_t>(control_bytes[slot] == EMPTY) << slot;
+    }
+    return {match_mask, empty_mask};
+#endif
+  }
+
+  pmr_vector<uint8_t> _control_bytes;
+  pmr_vector<Entry> _entries;
+  size_t _group_mask{0};
+  size_t _size{0};
+};
+
+}  // namespace opossum
@@ -1,17 +1,24 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/base_mutable_index.hpp"
+#include "storage/index/base_table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -76,37 +83,82 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+  const auto left_chunk_count = input_table_left()->chunk_count();
+  const auto right_chunk_count = input_table_right()->chunk_count();
+
+  // Equi joins can look up the matches of all right chunks at once in a table-level index
+  const auto table_index = _predicate_condition == PredicateCondition::Equals
+                               ? input_table_right()->get_table_index(_column_ids.second)
+                               : nullptr;
+
+  // Removed chunks have no rows, rows appended to the table after this point are ignored
+  auto chunk_sizes_right = std::vector<ChunkOffset>(right_chunk_count, ChunkOffset{0});
+
+  // Without a table-level index, each right chunk is probed using its index, its mutable index, or a nested loop
+  auto indexes_right = std::vector<std::shared_ptr<BaseIndex>>(right_chunk_count);
+  auto mutable_indexes_right = std::vector<std::shared_ptr<BaseMutableIndex>>(right_chunk_count);
+
+  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
     const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+    if (table_index) {
+      if (chunk_right) chunk_sizes_right[chunk_id_right] = static_cast<ChunkOffset>(chunk_right->size());
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_sizes_right[chunk_id_right]);
+      continue;
+    }
 
-    std::shared_ptr<BaseIndex> index = nullptr;
+    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
 
+    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
     if (!indices.empty()) {
       // We assume the first index to be efficient for our join
       // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+      indexes_right[chunk_id_right] = indices.front();
+    } else {
+      mutable_indexes_right[chunk_id_right] = chunk_right->get_mutable_index(_column_ids.second);
     }
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+    if (indexes_right[chunk_id_right] || mutable_indexes_right[chunk_id_right]) {
+      performance_data.chunks_scanned_with_index++;
+    } else {
+      performance_data.chunks_scanned_without_index++;
+    }
+  }
+  if (table_index) performance_data.chunks_scanned_with_index += right_chunk_count;
+
+  // Each left chunk is probed against all right chunks and writes its matches into its own PosLists
+  auto pos_lists_left = std::vector<PosList>(left_chunk_count);
+  auto pos_lists_right = std::vector<PosList>(left_chunk_count);
+
+  const auto probe_chunk = [&](const ChunkID chunk_id_left) {
+    auto& pos_list_left = pos_lists_left[chunk_id_left];
+    auto& pos_list_right = pos_lists_right[chunk_id_left];
+    const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+
+    if (table_index) {
+      segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+        _join_segment_using_table_index(it, end, chunk_id_left, *table_index, chunk_sizes_right, pos_list_left,
+                                        pos_list_right);
+      });
+      return;
+    }
 
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      if (indexes_right[chunk_id_right]) {
         segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
+          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, *indexes_right[chunk_id_right],
+                                         pos_list_left, pos_list_right);
         });
-      }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
+      } else if (mutable_indexes_right[chunk_id_right]) {
+        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+          _join_two_segments_using_mutable_index(it, end, chunk_id_left, chunk_id_right,
+                                                 *mutable_indexes_right[chunk_id_right], pos_list_left,
+                                                 pos_list_right);
+        });
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
+        JoinNestedLoop::JoinParams params{pos_list_left,
+                                          pos_list_right,
                                           _left_matches[chunk_id_left],
                                           _right_matches[chunk_id_right],
                                           track_left_matches,
@@ -116,8 +168,28 @@ void JoinIndex::_perform_join() {
         JoinNestedLoop::_join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right,
                                                    params);
       }
-      performance_data.chunks_scanned_without_index++;
     }
+  };
+
+  if (track_right_matches) {
+    // The matches of the right rows are tracked in std::vector<bool>s, which cannot be written concurrently
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+      probe_chunk(chunk_id_left);
+    }
+  } else {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(left_chunk_count);
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left]() { probe_chunk(chunk_id_left); }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
+  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+    _pos_list_left->insert(_pos_list_left->end(), pos_lists_left[chunk_id_left].begin(),
+                           pos_lists_left[chunk_id_left].end());
+    _pos_list_right->insert(_pos_list_right->end(), pos_lists_right[chunk_id_left].begin(),
+                            pos_lists_right[chunk_id_left].end());
   }
 
   // For Full Outer and Left Join we need to add all unmatched rows for the left side
@@ -166,57 +238,137 @@ void JoinIndex::_perform_join() {
 // join loop that joins two segments of two columns using an iterator for the left, and an index for the right
 template <typename LeftIterator>
 void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
-                                               const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index) {
+                                               const ChunkID chunk_id_right, const BaseIndex& index,
+                                               PosList& pos_list_left, PosList& pos_list_right) {
+  using LeftValue = std::decay_t<decltype((*left_it).value())>;
+
+  // The lookups are batched: The left values are sorted, so that the index is traversed in order, and each distinct
+  // value is looked up only once.
+  auto left_values = std::vector<std::pair<LeftValue, ChunkOffset>>{};
   for (; left_it != left_end; ++left_it) {
     const auto left_value = *left_it;
     if (left_value.is_null()) continue;
+    left_values.emplace_back(left_value.value(), left_value.chunk_offset());
+  }
+  std::sort(left_values.begin(), left_values.end());
+
+  for (auto run_begin = left_values.cbegin(); run_begin != left_values.cend();) {
+    const auto& value = run_begin->first;
+    const auto run_end = std::find_if(run_begin, left_values.cend(),
+                                      [&](const auto& left_value) { return left_value.first != value; });
 
+    // The matches of the value: [range_begin, range_end) and, for NotEquals, [second_range_begin, second_range_end)
     auto range_begin = BaseIndex::Iterator{};
     auto range_end = BaseIndex::Iterator{};
+    auto second_range_begin = BaseIndex::Iterator{};
+    auto second_range_end = BaseIndex::Iterator{};
 
     switch (_predicate_condition) {
       case PredicateCondition::Equals: {
-        range_begin = index->lower_bound({left_value.value()});
-        range_end = index->upper_bound({left_value.value()});
+        range_begin = index.lower_bound({value});
+        range_end = index.upper_bound({value});
         break;
       }
       case PredicateCondition::NotEquals: {
         // first, get all values less than the search value
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({left_value.value()});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound({value});
 
-        _append_matches(range_begin, range_end, left_value.chunk_offset(), chunk_id_left, chunk_id_right);
-
-        // set range for second half to all values greater than the search value
-        range_begin = index->upper_bound({left_value.value()});
-        range_end = index->cend();
+        // the second range holds all values greater than the search value
+        second_range_begin = index.upper_bound({value});
+        second_range_end = index.cend();
         break;
       }
       case PredicateCondition::GreaterThan: {
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({left_value.value()});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound({value});
         break;
       }
       case PredicateCondition::GreaterThanEquals: {
-        range_begin = index->cbegin();
-        range_end = index->upper_bound({left_value.value()});
+        range_begin = index.cbegin();
+        range_end = index.upper_bound({value});
         break;
       }
       case PredicateCondition::LessThan: {
-        range_begin = index->upper_bound({left_value.value()});
-        range_end = index->cend();
+        range_begin = index.upper_bound({value});
+        range_end = index.cend();
         break;
       }
       case PredicateCondition::LessThanEquals: {
-        range_begin = index->lower_bound({left_value.value()});
-        range_end = index->cend();
+        range_begin = index.lower_bound({value});
+        range_end = index.cend();
         break;
       }
       default:
         Fail("Unsupported comparison type encountered");
     }
 
-    _append_matches(range_begin, range_end, left_value.chunk_offset(), chunk_id_left, chunk_id_right);
+    for (auto run_it = run_begin; run_it != run_end; ++run_it) {
+      _append_matches(range_begin, range_end, run_it->second, chunk_id_left, chunk_id_right, pos_list_left,
+                      pos_list_right);
+      if (_predicate_condition == PredicateCondition::NotEquals) {
+        _append_matches(second_range_begin, second_range_end, run_it->second, chunk_id_left, chunk_id_right,
+                        pos_list_left, pos_list_right);
+      }
+    }
+
+    run_begin = run_end;
+  }
+}
+
+// join loop that joins two segments of two columns via their iterators using the mutable index of the right chunk
+template <typename LeftIterator>
+void JoinIndex::_join_two_segments_using_mutable_index(LeftIterator left_it, LeftIterator left_end,
+                                                       const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                                                       const BaseMutableIndex& mutable_index,
+                                                       PosList& pos_list_left, PosList& pos_list_right) {
+  // The index finds right values for `right_value <condition> left_value`
+  const auto flipped_predicate_condition = flip_predicate_condition(_predicate_condition);
+  auto chunk_offsets_right = std::vector<ChunkOffset>{};
+
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    chunk_offsets_right.clear();
+    mutable_index.append_matches(flipped_predicate_condition, left_value.value(), std::nullopt, chunk_offsets_right);
+    _append_matches(chunk_offsets_right.cbegin(), chunk_offsets_right.cend(), left_value.chunk_offset(), chunk_id_left,
+                    chunk_id_right, pos_list_left, pos_list_right);
+  }
+}
+
+// join loop that joins a segment of the left column with all chunks of the right column using a table-level index
+template <typename LeftIterator>
+void JoinIndex::_join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end,
+                                                const ChunkID chunk_id_left, const BaseTableIndex& table_index,
+                                                const std::vector<ChunkOffset>& chunk_sizes_right,
+                                                PosList& pos_list_left, PosList& pos_list_right) {
+  auto right_row_ids = PosList{};
+
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    right_row_ids.clear();
+    table_index.append_equal_rows(left_value.value(), right_row_ids);
+
+    for (const auto& row_id_right : right_row_ids) {
+      if (row_id_right.chunk_id >= chunk_sizes_right.size() ||
+          row_id_right.chunk_offset >= chunk_sizes_right[row_id_right.chunk_id]) {
+        continue;
+      }
+
+      pos_list_left.emplace_back(RowID{chunk_id_left, left_value.chunk_offset()});
+      pos_list_right.emplace_back(row_id_right);
+
+      if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+        _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+      }
+
+      if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+        _right_matches[row_id_right.chunk_id][row_id_right.chunk_offset] = true;
+      }
+    }
   }
 }
 
@@ -224,7 +376,8 @@ void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterato
 template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
 void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                                                RightIterator right_begin, RightIterator right_end,
-                                               const ChunkID chunk_id_left, const ChunkID chunk_id_right) {
+                                               const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                                               PosList& pos_list_left, PosList& pos_list_right) {
   // No index so we fall back on a nested loop join
   for (; left_it != left_end; ++left_it) {
     const auto left_value = *left_it;
@@ -235,8 +388,8 @@ void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIt
       if (right_value.is_null()) continue;
 
       if (func(left_value.value(), right_value.value())) {
-        _pos_list_left->emplace_back(RowID{chunk_id_left, left_value.chunk_offset()});
-        _pos_list_right->emplace_back(RowID{chunk_id_right, right_value.chunk_offset()});
+        pos_list_left.emplace_back(RowID{chunk_id_left, left_value.chunk_offset()});
+        pos_list_right.emplace_back(RowID{chunk_id_right, right_value.chunk_offset()});
 
         if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
           _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
@@ -255,7 +408,7 @@ void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIt
 
 void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                                 const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left,
-                                const ChunkID chunk_id_right) {
+                                const ChunkID chunk_id_right, PosList& pos_list_left, PosList& pos_list_right) {
   const auto num_right_matches = std::distance(range_begin, range_end);
 
   if (num_right_matches == 0) {
@@ -268,9 +421,9 @@ void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const Ba
   }
 
   // we replicate the left value for each right value
-  std::fill_n(std::back_inserter(*_pos_list_left), num_right_matches, RowID{chunk_id_left, chunk_offset_left});
+  std::fill_n(std::back_inserter(pos_list_left), num_right_matches, RowID{chunk_id_left, chunk_offset_left});
 
-  std::transform(range_begin, range_end, std::back_inserter(*_pos_list_right),
+  std::transform(range_begin, range_end, std::back_inserter(pos_list_right),
                  [chunk_id_right](ChunkOffset chunk_offset_right) {
                    return RowID{chunk_id_right, chunk_offset_right};
                  });
@@ -294,8 +447,8 @@ void JoinIndex::_write_output_segments(Segments& output_segments, const std::sha
 
         ChunkID current_chunk_id{0};
 
-        auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(
-            input_table->get_chunk(ChunkID{0})->get_segment(column_id));
+        const auto* reference_segment = static_cast<const ReferenceSegment*>(
+            &input_table->get_chunk_view(ChunkID{0}).get_segment_view(column_id));
 
         // de-reference to the correct RowID so the output can be used in a Multi Join
         for (const auto& row : *pos_list) {
@@ -306,8 +459,9 @@ void JoinIndex::_write_output_segments(Segments& output_segments, const std::sha
           if (row.chunk_id != current_chunk_id) {
             current_chunk_id = row.chunk_id;
 
-            reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
-                input_table->get_chunk(current_chunk_id)->get_segment(column_id));
+            // A view spares the atomic reference counting of the chunk and segment
+            reference_segment = static_cast<const ReferenceSegment*>(
+                &input_table->get_chunk_view(current_chunk_id).get_segment_view(column_id));
           }
           new_pos_list->push_back((*reference_segment->pos_list())[row.chunk_offset]);
         }
@@ -12,12 +12,22 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class BaseMutableIndex;
+class BaseTableIndex;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. For equi joins, a
+   * table-level index on the right column (see BaseTableIndex) is preferred over the indexes of the single chunks.
+   * Mutable chunks of the right table are probed using their mutable index (see BaseMutableIndex), if they have one.
+   *
+   * The left chunks are probed in parallel, unless the matches of the right rows need to be tracked (right and outer
+   * joins). Lookups in the indexes of the single chunks are batched per left chunk, i.e., the left values are sorted
+   * and each distinct value is looked up once.
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -44,17 +54,32 @@ class JoinIndex : public AbstractJoinOperator {
 
   void _perform_join();
 
+  // The helpers below write the matches of a left chunk into @param pos_list_left and @param pos_list_right
   template <typename LeftIterator>
   void _join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
-                                      const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
+                                      const ChunkID chunk_id_right, const BaseIndex& index, PosList& pos_list_left,
+                                      PosList& pos_list_right);
+
+  template <typename LeftIterator>
+  void _join_two_segments_using_mutable_index(LeftIterator left_it, LeftIterator left_end,
+                                              const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                                              const BaseMutableIndex& mutable_index, PosList& pos_list_left,
+                                              PosList& pos_list_right);
+
+  template <typename LeftIterator>
+  void _join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
+                                       const BaseTableIndex& table_index,
+                                       const std::vector<ChunkOffset>& chunk_sizes_right, PosList& pos_list_left,
+                                       PosList& pos_list_right);
 
   template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   void _join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                                       RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
-                                      const ChunkID chunk_id_right);
+                                      const ChunkID chunk_id_right, PosList& pos_list_left, PosList& pos_list_right);
 
   void _append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
-                       const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right);
+                       const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                       PosList& pos_list_left, PosList& pos_list_right);
 
   void _write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                               std::shared_ptr<PosList> pos_list);
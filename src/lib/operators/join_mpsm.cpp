@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -44,7 +45,16 @@ JoinMPSM::JoinMPSM(const std::shared_ptr<const AbstractOperator>& left,
   DebugAssert(mode != JoinMode::Cross, "This operator does not support cross joins.");
   DebugAssert(left != nullptr, "The left input operator is null.");
   DebugAssert(right != nullptr, "The right input operator is null.");
-  DebugAssert(op == PredicateCondition::Equals, "Only Equi joins are supported by MPSM join.");
+  DebugAssert(supports(mode, op), "MPSM join does not support this predicate condition.");
+}
+
+bool JoinMPSM::supports(const JoinMode mode, const PredicateCondition predicate_condition) {
+  return mode != JoinMode::Cross &&
+         (predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals ||
+          predicate_condition == PredicateCondition::LessThan ||
+          predicate_condition == PredicateCondition::LessThanEquals ||
+          predicate_condition == PredicateCondition::GreaterThan ||
+          predicate_condition == PredicateCondition::GreaterThanEquals);
 }
 
 std::shared_ptr<const Table> JoinMPSM::_on_execute() {
@@ -85,10 +95,6 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     _cluster_count = _determine_number_of_clusters();
     _output_pos_lists_left.resize(_cluster_count);
     _output_pos_lists_right.resize(_cluster_count);
-    for (auto cluster = ClusterID{0}; cluster < _cluster_count; ++cluster) {
-      _output_pos_lists_left[cluster].resize(1);
-      _output_pos_lists_right[cluster].resize(_cluster_count);
-    }
   }
 
  protected:
@@ -102,6 +108,11 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   std::unique_ptr<PosList> _null_rows_left;
   std::unique_ptr<PosList> _null_rows_right;
 
+  // The smallest and largest value of the left input, used to find the right rows without a join partner in the
+  // non-equi cases. Not set if the left input has no values.
+  std::optional<T> _left_min_value;
+  std::optional<T> _left_max_value;
+
   const ColumnID _left_column_id;
   const ColumnID _right_column_id;
 
@@ -111,9 +122,10 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   ClusterID _cluster_count;
 
-  // Contains the output row ids for each cluster
-  std::vector<std::vector<std::shared_ptr<PosList>>> _output_pos_lists_left;
-  std::vector<std::vector<std::shared_ptr<PosList>>> _output_pos_lists_right;
+  // Contains the output row ids for each cluster. Each cluster is joined by a single job, which writes only to the
+  // pos lists of its cluster.
+  std::vector<std::shared_ptr<PosList>> _output_pos_lists_left;
+  std::vector<std::shared_ptr<PosList>> _output_pos_lists_right;
 
   /**
    * The TablePosition is a utility struct that is used during the merge phase to identify the
@@ -133,37 +145,28 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   };
 
   /**
-    * The TableRange is a utility struct that is used to define ranges of rows in a sorted input table spanning from
-    * a start position to an end position.
+    * The TableRange is a utility struct that is used to define ranges of rows in a cluster of a sorted input table
+    * spanning from a start position to an end position.
   **/
   struct TableRange {
     TableRange(TablePosition start_position, TablePosition end_position) : start{start_position}, end{end_position} {
-      DebugAssert(start.partition == end.partition, "Table ranges are only allowed over the same position");
+      DebugAssert(start.partition == end.partition && start.cluster == end.cluster,
+                  "Table ranges are only allowed within the same cluster");
     }
     TableRange(NodeID partition, ClusterID cluster, size_t start_index, size_t end_index)
-        : start{TablePosition(partition, cluster, start_index)}, end{TablePosition(partition, cluster, end_index)} {
-      DebugAssert(start.partition == end.partition, "Table ranges are only allowed over the same position");
-    }
+        : start{TablePosition(partition, cluster, start_index)}, end{TablePosition(partition, cluster, end_index)} {}
 
     TablePosition start;
     TablePosition end;
 
+    bool empty() const { return start.index >= end.index; }
+
     // Executes the given action for every row id of the table in this range.
     template <typename F>
     void for_every_row_id(std::unique_ptr<MaterializedNUMAPartitionList<T>>& table, F action) {
-      for (auto cluster = start.cluster; cluster <= end.cluster; ++cluster) {
-        const auto current_cluster = (*table)[end.partition].materialized_segments[cluster];
-        size_t start_index = 0;
-        // For the end index we need to find out how long the cluster is on this partition
-        size_t end_index = current_cluster->size();
-
-        // See whether we have more specific start or end indices
-        if (cluster == start.cluster) start_index = start.index;
-        if (cluster == end.cluster) end_index = end.index;
-
-        for (size_t index = start_index; index < end_index; ++index) {
-          action((*current_cluster)[index].row_id);
-        }
+      const auto& cluster = *(*table)[start.partition].materialized_segments[start.cluster];
+      for (auto index = start.index; index < end.index; ++index) {
+        action(cluster[index].row_id);
       }
     }
   };
@@ -179,21 +182,15 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   }
 
   /**
-  * Gets the table position corresponding to the end of the table, i.e. the last entry of the last cluster.
+  * Whether the join has to know which left rows found a join partner, because they are written to the output (semi),
+  * or the rows without one are (left outer and anti).
   **/
-  static std::vector<TablePosition> _end_of_table(std::unique_ptr<MaterializedNUMAPartitionList<T>>& table) {
-    DebugAssert(table->size() > 0, "table has no chunks");
-    auto end_positions = std::vector<TablePosition>{table->size()};
-    for (auto& partition : (*table)) {
-      auto last_cluster = partition.materialized_segments.size() - 1;
-      auto node_id = partition.node_id;
-      end_positions[node_id] =
-          TablePosition(node_id, last_cluster, partition.materialized_segments[last_cluster]->size());
-    }
-
-    return end_positions;
+  bool _tracks_left_matches() const {
+    return _mode == JoinMode::Left || _mode == JoinMode::Outer || _mode == JoinMode::Semi || _mode == JoinMode::Anti;
   }
 
+  bool _emits_combinations() const { return _mode != JoinMode::Semi && _mode != JoinMode::Anti; }
+
   /**
   * Represents the result of a value comparison.
   **/
@@ -201,67 +198,108 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
 
   /**
   * Performs the join for two runs of a specified cluster.
-  * A run is a series of rows in a cluster with the same value.
+  * A run is a series of rows in a cluster with the same value. The end positions denote the ends of the clusters of
+  * the runs, which are used by the non-equi predicates to emit all rows after a run.
   **/
   void _join_runs(TableRange left_run, TableRange right_run, ComparisonResult comparison_result,
-                  std::vector<bool>& left_joined) {
-    auto cluster_number = left_run.start.cluster;
-    auto partition_number = left_run.start.partition;
-    switch (comparison_result) {
-      case ComparisonResult::Equal:
-        _emit_all_combinations(partition_number, cluster_number, left_run, right_run);
-
-        // Since we step multiple times over the left chunk
-        // we need to memorize the joined rows for the left and outer case
-        if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
-          for (auto joined_id = left_run.start.index; joined_id < left_run.end.index; ++joined_id) {
-            left_joined[joined_id] = true;
+                  TablePosition end_of_left_cluster, TablePosition end_of_right_cluster,
+                  std::vector<bool>& left_matched) {
+    switch (_op) {
+      case PredicateCondition::Equals:
+        if (comparison_result == ComparisonResult::Equal) {
+          _emit_all_combinations(left_run, right_run, left_matched);
+        } else if (comparison_result == ComparisonResult::Greater) {
+          // Since we step multiple times over the left cluster (once per right partition), left rows without a join
+          // partner are only known after all partitions have been merged. See _join_cluster().
+          if (_mode == JoinMode::Right || _mode == JoinMode::Outer) {
+            _emit_left_null_combinations(left_run.start.partition, right_run);
           }
         }
-
         break;
-      case ComparisonResult::Less:
-        // This usually does something for the left join case
-        // but we could hit an equal when stepping again over the left side
+      case PredicateCondition::NotEquals:
+        if (comparison_result == ComparisonResult::Greater) {
+          _emit_all_combinations(left_run.start.to(end_of_left_cluster), right_run, left_matched);
+        } else if (comparison_result == ComparisonResult::Equal) {
+          _emit_all_combinations(left_run.end.to(end_of_left_cluster), right_run, left_matched);
+          _emit_all_combinations(left_run, right_run.end.to(end_of_right_cluster), left_matched);
+        } else if (comparison_result == ComparisonResult::Less) {
+          _emit_all_combinations(left_run, right_run.start.to(end_of_right_cluster), left_matched);
+        }
+        break;
+      case PredicateCondition::GreaterThan:
+        if (comparison_result == ComparisonResult::Greater) {
+          _emit_all_combinations(left_run.start.to(end_of_left_cluster), right_run, left_matched);
+        } else if (comparison_result == ComparisonResult::Equal) {
+          _emit_all_combinations(left_run.end.to(end_of_left_cluster), right_run, left_matched);
+        }
+        break;
+      case PredicateCondition::GreaterThanEquals:
+        if (comparison_result == ComparisonResult::Greater || comparison_result == ComparisonResult::Equal) {
+          _emit_all_combinations(left_run.start.to(end_of_left_cluster), right_run, left_matched);
+        }
+        break;
+      case PredicateCondition::LessThan:
+        if (comparison_result == ComparisonResult::Less) {
+          _emit_all_combinations(left_run, right_run.start.to(end_of_right_cluster), left_matched);
+        } else if (comparison_result == ComparisonResult::Equal) {
+          _emit_all_combinations(left_run, right_run.end.to(end_of_right_cluster), left_matched);
+        }
         break;
-      case ComparisonResult::Greater:
-        if (_mode == JoinMode::Right || _mode == JoinMode::Outer) {
-          _emit_left_null_combinations(partition_number, cluster_number, right_run);
+      case PredicateCondition::LessThanEquals:
+        if (comparison_result == ComparisonResult::Less || comparison_result == ComparisonResult::Equal) {
+          _emit_all_combinations(left_run, right_run.start.to(end_of_right_cluster), left_matched);
         }
         break;
+      default:
+        Fail("Unsupported PredicateCondition");
     }
   }
 
   /**
   * Emits a combination of a left row id and a right row id to the join output.
   **/
-  void _emit_combination(NodeID output_partition, ClusterID output_cluster, RowID left, RowID right) {
-    _output_pos_lists_left[output_partition][output_cluster]->push_back(left);
-    _output_pos_lists_right[output_partition][output_cluster]->push_back(right);
+  void _emit_combination(NodeID output_cluster, RowID left, RowID right) {
+    _output_pos_lists_left[output_cluster]->push_back(left);
+    _output_pos_lists_right[output_cluster]->push_back(right);
   }
 
   /**
   * Emits all the combinations of row ids from the left table range and the right table range to the join output.
-  * I.e. the cross product of the ranges is emitted.
+  * I.e. the cross product of the ranges is emitted. Semi and anti joins only remember that the left rows have a
+  * join partner.
   **/
-  void _emit_all_combinations(NodeID output_partition, ClusterID output_cluster, TableRange left_range,
-                              TableRange right_range) {
+  void _emit_all_combinations(TableRange left_range, TableRange right_range, std::vector<bool>& left_matched) {
+    if (left_range.empty() || right_range.empty()) return;
+
+    if (_tracks_left_matches()) {
+      std::fill(left_matched.begin() + left_range.start.index, left_matched.begin() + left_range.end.index, true);
+    }
+    if (!_emits_combinations()) return;
+
+    // The left cluster is stored on the node of the joined cluster, which is also where the output is written to
+    const auto output_cluster = left_range.start.partition;
     left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-        _emit_combination(output_partition, output_cluster, left_row_id, right_row_id);
+        _emit_combination(output_cluster, left_row_id, right_row_id);
       });
     });
   }
 
   /**
-  * Emits all combinations of row ids from the left table range and a NULL value on the right side to the join output.
+  * Emits the rows of the left cluster to the join output depending on whether they found a join partner: with a NULL
+  * value on the right side for left outer joins, only the matched ones for semi joins, and only the unmatched ones
+  * for anti joins.
   **/
-  void _emit_right_null_combinations(NodeID output_partition, ClusterID output_cluster,
-                                     std::shared_ptr<MaterializedSegment<T>> left_chunk,
-                                     std::vector<bool> left_joined) {
-    for (auto entry_id = size_t{0}; entry_id < left_joined.size(); ++entry_id) {
-      if (!left_joined[entry_id]) {
-        _emit_combination(output_partition, output_cluster, (*left_chunk)[entry_id].row_id, NULL_ROW_ID);
+  void _emit_left_rows(NodeID output_cluster, const MaterializedSegment<T>& left_cluster,
+                       const std::vector<bool>& left_matched) {
+    const auto emit_matched = _mode == JoinMode::Semi;
+    for (auto entry_id = size_t{0}; entry_id < left_matched.size(); ++entry_id) {
+      if (left_matched[entry_id] != emit_matched) continue;
+
+      if (_emits_combinations()) {
+        _emit_combination(output_cluster, left_cluster[entry_id].row_id, NULL_ROW_ID);
+      } else {
+        _output_pos_lists_left[output_cluster]->push_back(left_cluster[entry_id].row_id);
       }
     }
   }
@@ -269,12 +307,64 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   /**
   * Emits all combinations of row ids from the right table range and a NULL value on the left side to the join output.
   **/
-  void _emit_left_null_combinations(NodeID output_partition, ClusterID output_cluster, TableRange right_range) {
+  void _emit_left_null_combinations(NodeID output_cluster, TableRange right_range) {
     right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
-      _emit_combination(output_partition, output_cluster, NULL_ROW_ID, right_row_id);
+      _emit_combination(output_cluster, NULL_ROW_ID, right_row_id);
     });
   }
 
+  /**
+  * Emits the rows of a right cluster that have no join partner with a NULL value on the left side in the non-equi
+  * cases. Whether a right row has a join partner is determined by comparing it to the smallest or largest left value.
+  * As the cluster is sorted, the rows without a join partner are a prefix or a suffix of it (or, for NotEquals, the
+  * run of the only left value).
+  **/
+  void _emit_unmatched_right_rows(NodeID output_cluster, NodeID right_partition, ClusterID right_cluster_id) {
+    const auto& right_cluster = *(*_sorted_right_table)[right_partition].materialized_segments[right_cluster_id];
+    auto begin = size_t{0};
+    auto end = right_cluster.size();
+
+    if (_left_min_value) {
+      const auto less_than = [](const auto& a, const auto& b) { return a.value < b; };
+      const auto greater_than = [](const auto& a, const auto& b) { return a < b.value; };
+      const auto lower_bound = [&](const T& value) {
+        return static_cast<size_t>(std::lower_bound(right_cluster.begin(), right_cluster.end(), value, less_than) -
+                                   right_cluster.begin());
+      };
+      const auto upper_bound = [&](const T& value) {
+        return static_cast<size_t>(std::upper_bound(right_cluster.begin(), right_cluster.end(), value, greater_than) -
+                                   right_cluster.begin());
+      };
+
+      switch (_op) {
+        case PredicateCondition::LessThan:
+          end = upper_bound(*_left_min_value);
+          break;
+        case PredicateCondition::LessThanEquals:
+          end = lower_bound(*_left_min_value);
+          break;
+        case PredicateCondition::GreaterThan:
+          begin = lower_bound(*_left_max_value);
+          break;
+        case PredicateCondition::GreaterThanEquals:
+          begin = upper_bound(*_left_max_value);
+          break;
+        case PredicateCondition::NotEquals:
+          if (*_left_min_value == *_left_max_value) {
+            begin = lower_bound(*_left_min_value);
+            end = upper_bound(*_left_min_value);
+          } else {
+            end = begin;
+          }
+          break;
+        default:
+          Fail("Unsupported PredicateCondition");
+      }
+    }
+
+    _emit_left_null_combinations(output_cluster, TableRange(right_partition, right_cluster_id, begin, end));
+  }
+
   /**
   * Determines the length of the run starting at start_index in the values vector.
   * A run is a series of the same value.
@@ -305,78 +395,129 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   }
 
   /**
-  * Performs the join on a single cluster. Runs of entries with the same value are identified and handled together.
-  * This constitutes the merge phase of the join. The output combinations of row ids are determined by _join_runs.
+  * In the non-equi cases, the clusters are range clusters, i.e., all values of a cluster are smaller than the values
+  * of the following clusters. Determines whether all rows of a left cluster match all rows of a different right
+  * cluster because of the order of the clusters. Otherwise, none of them match.
   **/
-  void _join_cluster(ClusterID cluster_number) {
-    // For MPSM join the left side is reshuffled to contain one cluster per NUMA node,
-    // it is therefore the first (and only) cluster in the corresponding data structure
-    const auto left_node_id = static_cast<NodeID>(cluster_number);
-    const auto left_cluster_id = ClusterID{0};
-
-    // The right side is not reshuffled and is worked on for each partition
-    const auto right_cluster_id = cluster_number;
-
-    _output_pos_lists_left[left_node_id][left_cluster_id] = std::make_shared<PosList>();
+  bool _clusters_match(ClusterID left_cluster_id, ClusterID right_cluster_id) const {
+    switch (_op) {
+      case PredicateCondition::NotEquals:
+        return left_cluster_id != right_cluster_id;
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        return left_cluster_id > right_cluster_id;
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        return left_cluster_id < right_cluster_id;
+      default:
+        return false;
+    }
+  }
 
+  /**
+  * Merges the left cluster with the cluster of the same id in a partition of the right table. Runs of entries with the
+  * same value are identified and handled together. The output combinations of row ids are determined by _join_runs.
+  **/
+  void _merge_clusters(NodeID left_node_id, ClusterID left_cluster_id, NodeID right_node_id,
+                       ClusterID right_cluster_id, std::vector<bool>& left_matched) {
     std::shared_ptr<MaterializedSegment<T>> left_cluster =
         (*_sorted_left_table)[left_node_id].materialized_segments[left_cluster_id];
+    std::shared_ptr<MaterializedSegment<T>> right_cluster =
+        (*_sorted_right_table)[right_node_id].materialized_segments[right_cluster_id];
+
+    auto left_run_start = size_t{0};
+    auto right_run_start = size_t{0};
+
+    auto left_run_end = left_run_start + _run_length(left_run_start, left_cluster);
+    auto right_run_end = right_run_start + _run_length(right_run_start, right_cluster);
+
+    const auto left_size = left_cluster->size();
+    const auto right_size = right_cluster->size();
+
+    const auto end_of_left_cluster = TablePosition(left_node_id, left_cluster_id, left_size);
+    const auto end_of_right_cluster = TablePosition(right_node_id, right_cluster_id, right_size);
+
+    while (left_run_start < left_size && right_run_start < right_size) {
+      auto& left_value = (*left_cluster)[left_run_start].value;
+      auto& right_value = (*right_cluster)[right_run_start].value;
+
+      auto comparison_result = _compare(left_value, right_value);
+
+      TableRange left_run(left_node_id, left_cluster_id, left_run_start, left_run_end);
+      TableRange right_run(right_node_id, right_cluster_id, right_run_start, right_run_end);
+      _join_runs(left_run, right_run, comparison_result, end_of_left_cluster, end_of_right_cluster, left_matched);
+
+      // Advance to the next run on the smaller side or both if equal
+      if (comparison_result == ComparisonResult::Equal) {
+        // Advance both runs
+        left_run_start = left_run_end;
+        right_run_start = right_run_end;
+        left_run_end = left_run_start + _run_length(left_run_start, left_cluster);
+        right_run_end = right_run_start + _run_length(right_run_start, right_cluster);
+      } else if (comparison_result == ComparisonResult::Less) {
+        // Advance the left run
+        left_run_start = left_run_end;
+        left_run_end = left_run_start + _run_length(left_run_start, left_cluster);
+      } else {
+        // Advance the right run
+        right_run_start = right_run_end;
+        right_run_end = right_run_start + _run_length(right_run_start, right_cluster);
+      }
+    }
 
-    auto left_joined = std::vector<bool>(left_cluster->size(), false);
-
-    for (auto right_node_id = NodeID{0}; right_node_id < static_cast<NodeID>(_cluster_count); ++right_node_id) {
-      _output_pos_lists_right[right_node_id][right_cluster_id] = std::make_shared<PosList>();
+    // Join the rest of the unfinished right side, which is relevant for right outer joins. The unfinished rest of the
+    // left side has no join partners in this partition.
+    auto left_rest = TableRange(left_node_id, left_cluster_id, left_run_start, left_size);
+    auto right_rest = TableRange(right_node_id, right_cluster_id, right_run_start, right_size);
+    if (right_run_start < right_size) {
+      _join_runs(left_rest, right_rest, ComparisonResult::Greater, end_of_left_cluster, end_of_right_cluster,
+                 left_matched);
+    }
+  }
 
-      std::shared_ptr<MaterializedSegment<T>> right_cluster =
-          (*_sorted_right_table)[right_node_id].materialized_segments[right_cluster_id];
+  /**
+  * Performs the join on a single cluster. This constitutes the merge phase of the join. The left cluster is merged
+  * with the cluster of the same id in every partition of the right table. In the non-equi cases, it is additionally
+  * joined with the right clusters whose order lets all or none of their rows match.
+  **/
+  void _join_cluster(ClusterID cluster_number) {
+    // For MPSM join the left side is reshuffled to contain one cluster per NUMA node,
+    // it is therefore the first (and only) cluster in the corresponding data structure
+    const auto left_node_id = static_cast<NodeID>(cluster_number);
+    const auto left_cluster_id = ClusterID{0};
 
-      auto left_run_start = size_t{0};
-      auto right_run_start = size_t{0};
+    _output_pos_lists_left[left_node_id] = std::make_shared<PosList>();
+    _output_pos_lists_right[left_node_id] = std::make_shared<PosList>();
 
-      auto left_run_end = left_run_start + _run_length(left_run_start, left_cluster);
-      auto right_run_end = right_run_start + _run_length(right_run_start, right_cluster);
+    const auto& left_cluster = *(*_sorted_left_table)[left_node_id].materialized_segments[left_cluster_id];
+    const auto left_range = TableRange(left_node_id, left_cluster_id, 0, left_cluster.size());
 
-      const auto left_size = left_cluster->size();
-      const auto right_size = right_cluster->size();
+    // Only this job joins the left cluster, so that it can remember which of its rows found a join partner
+    auto left_matched = std::vector<bool>(_tracks_left_matches() ? left_cluster.size() : 0, false);
 
-      while (left_run_start < left_size && right_run_start < right_size) {
-        auto& left_value = (*left_cluster)[left_run_start].value;
-        auto& right_value = (*right_cluster)[right_run_start].value;
+    // The right side is not reshuffled and is worked on for each partition
+    for (auto right_node_id = NodeID{0}; right_node_id < _sorted_right_table->size(); ++right_node_id) {
+      _merge_clusters(left_node_id, left_cluster_id, right_node_id, cluster_number, left_matched);
 
-        auto comparison_result = _compare(left_value, right_value);
+      if (_op == PredicateCondition::Equals) continue;
 
-        TableRange left_run(left_node_id, left_cluster_id, left_run_start, left_run_end);
-        TableRange right_run(right_node_id, right_cluster_id, right_run_start, right_run_end);
-        _join_runs(left_run, right_run, comparison_result, left_joined);
+      const auto& right_partition = (*_sorted_right_table)[right_node_id];
+      for (auto right_cluster_id = ClusterID{0}; right_cluster_id < _cluster_count; ++right_cluster_id) {
+        if (!_clusters_match(cluster_number, right_cluster_id)) continue;
 
-        // Advance to the next run on the smaller side or both if equal
-        if (comparison_result == ComparisonResult::Equal) {
-          // Advance both runs
-          left_run_start = left_run_end;
-          right_run_start = right_run_end;
-          left_run_end = left_run_start + _run_length(left_run_start, left_cluster);
-          right_run_end = right_run_start + _run_length(right_run_start, right_cluster);
-        } else if (comparison_result == ComparisonResult::Less) {
-          // Advance the left run
-          left_run_start = left_run_end;
-          left_run_end = left_run_start + _run_length(left_run_start, left_cluster);
-        } else {
-          // Advance the right run
-          right_run_start = right_run_end;
-          right_run_end = right_run_start + _run_length(right_run_start, right_cluster);
-        }
+        const auto right_cluster_size = right_partition.materialized_segments[right_cluster_id]->size();
+        _emit_all_combinations(left_range, TableRange(right_node_id, right_cluster_id, 0, right_cluster_size),
+                               left_matched);
       }
 
-      // Join the rest of the unfinished side, which is relevant for outer joins and non-equi joins
-      auto left_rest = TableRange(left_node_id, left_cluster_id, left_run_start, left_size);
-      auto right_rest = TableRange(right_node_id, right_cluster_id, right_run_start, right_size);
-      if (right_run_start < right_size) {
-        _join_runs(left_rest, right_rest, ComparisonResult::Greater, left_joined);
+      // Each right cluster is handled by the job of its cluster id, so that its rows are emitted only once
+      if (_mode == JoinMode::Right || _mode == JoinMode::Outer) {
+        _emit_unmatched_right_rows(left_node_id, right_node_id, cluster_number);
       }
     }
 
-    if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
-      _emit_right_null_combinations(left_node_id, left_cluster_id, left_cluster, left_joined);
+    if (_tracks_left_matches()) {
+      _emit_left_rows(left_node_id, left_cluster, left_matched);
     }
   }
 
@@ -398,23 +539,19 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   /**
   * Flattens the multiple pos lists into a single pos list
   **/
-  std::shared_ptr<PosList> _concatenate_pos_lists(std::vector<std::vector<std::shared_ptr<PosList>>>& pos_lists) {
+  std::shared_ptr<PosList> _concatenate_pos_lists(std::vector<std::shared_ptr<PosList>>& pos_lists) {
     auto output = std::make_shared<PosList>();
 
     // Determine the required space
     auto total_size = size_t{0};
-    for (const auto& partition_lists : pos_lists) {
-      for (const auto& pos_list : partition_lists) {
-        total_size += pos_list->size();
-      }
+    for (const auto& pos_list : pos_lists) {
+      total_size += pos_list->size();
     }
 
     // Move the entries over the output pos list
     output->reserve(total_size);
-    for (const auto& partition_lists : pos_lists) {
-      for (const auto& pos_list : partition_lists) {
-        output->insert(output->end(), pos_list->begin(), pos_list->end());
-      }
+    for (const auto& pos_list : pos_lists) {
+      output->insert(output->end(), pos_list->begin(), pos_list->end());
     }
 
     return output;
@@ -488,9 +625,9 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   std::shared_ptr<const Table> _on_execute() override {
     auto include_null_left = (_mode == JoinMode::Left || _mode == JoinMode::Outer);
     auto include_null_right = (_mode == JoinMode::Right || _mode == JoinMode::Outer);
-    auto radix_clusterer =
-        RadixClusterSortNUMA<T>(_mpsm_join.input_table_left(), _mpsm_join.input_table_right(), _mpsm_join._column_ids,
-                                include_null_left, include_null_right, _cluster_count);
+    auto radix_clusterer = RadixClusterSortNUMA<T>(_mpsm_join.input_table_left(), _mpsm_join.input_table_right(),
+                                                   _mpsm_join._column_ids, _op == PredicateCondition::Equals,
+                                                   include_null_left, include_null_right, _cluster_count);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
     _sorted_left_table = std::move(sort_output.clusters_left);
@@ -498,6 +635,14 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
 
+    // The left clusters are sorted, so their extremes are their first and last values
+    for (const auto& partition : *_sorted_left_table) {
+      const auto& cluster = *partition.materialized_segments[0];
+      if (cluster.empty()) continue;
+      if (!_left_min_value || cluster.front().value < *_left_min_value) _left_min_value = cluster.front().value;
+      if (!_left_max_value || *_left_max_value < cluster.back().value) _left_max_value = cluster.back().value;
+    }
+
     // this generates the actual join results and fills the _output_pos_lists
     _perform_join();
 
@@ -519,10 +664,12 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
       }
     }
 
-    // Add the segments from both input tables to the output
+    // Add the segments from both input tables to the output. Semi and anti joins only output the left table.
     Segments output_segments;
     _add_output_segments(output_segments, _mpsm_join.input_table_left(), output_left);
-    _add_output_segments(output_segments, _mpsm_join.input_table_right(), output_right);
+    if (_emits_combinations()) {
+      _add_output_segments(output_segments, _mpsm_join.input_table_right(), output_right);
+    }
 
     // Build the output_table with one Chunk
     auto output_table = _mpsm_join._initialize_output_table();
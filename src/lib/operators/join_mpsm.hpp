@@ -12,6 +12,8 @@ namespace opossum {
    * This operator joins two tables using one column of each table by performing radix-partition-sort and a merge join.
    * This is done in multiple phases to minimize random reads. This makes the Multi Phase Sort Merge (MPSM) Join more
    * efficient on NUMA systems, leading to increased performance compared to other joins, especially the Sort Merge Join.
+   * It supports all join modes except cross joins and all comparison predicates. For non-equi predicates, the inputs
+   * are range clustered instead of radix clustered, so that matches across clusters follow from the cluster order.
    *
    * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
    *
@@ -25,6 +27,9 @@ class JoinMPSM : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  // Whether JoinMPSM can execute a join with the given mode and predicate condition
+  static bool supports(const JoinMode mode, const PredicateCondition predicate_condition);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
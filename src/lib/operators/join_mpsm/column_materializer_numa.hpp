@@ -130,7 +130,7 @@ class ColumnMaterializerNUMA {
             _materialize_generic_segment(*segment, chunk_id, null_rows_output, (*output)[numa_node_id]);
           }
         },
-        SchedulePriority::Default, false);
+        AbstractTask::current_priority(), false);
   }
 
   /**
@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -28,11 +30,12 @@ struct RadixClusterOutput {
 * of the least significant bits of the values because the values there are much more evenly distributed than for the
 * most significant bits. As a result, equal values always get moved to the same cluster and the clusters are
 * sorted in themselves but not in between the clusters. This is okay for the equi join, because we are only interested
-* in equality. The non equi join is not considered because non equi joins over multiple partitions do not work well, so
-* the mpsm join does not support non equi joins.
+* in equality. For the non-equi joins, range clustering is performed instead: Split values are picked from samples of
+* both inputs, so that all values of a cluster are smaller than the values of the following clusters. The mpsm join can
+* then decide for pairs of different clusters from their order alone whether all or none of their rows match.
 * General clustering process:
-* -> Input chunks are materialized and sorted. Every value is stored together with its row id.
-* -> Then, radix clustering is performed.
+* -> Input chunks are materialized. Every value is stored together with its row id.
+* -> Then, radix clustering (or range clustering) is performed.
 * -> The clusters of the left hand side parition are distributed to their corresponding numa nodes.
 * -> At last, the resulting clusters are sorted.
 *
@@ -49,12 +52,13 @@ template <typename T>
 class RadixClusterSortNUMA {
  public:
   RadixClusterSortNUMA(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
-                       const std::pair<ColumnID, ColumnID>& column_ids, const bool materialize_null_left,
-                       const bool materialize_null_right, uint32_t cluster_count)
+                       const std::pair<ColumnID, ColumnID>& column_ids, const bool equi_case,
+                       const bool materialize_null_left, const bool materialize_null_right, uint32_t cluster_count)
       : _input_table_left{left},
         _input_table_right{right},
         _left_column_id{column_ids.first},
         _right_column_id{column_ids.second},
+        _equi_case{equi_case},
         _cluster_count{cluster_count},
         _materialize_null_left{materialize_null_left},
         _materialize_null_right{materialize_null_right} {
@@ -110,6 +114,7 @@ class RadixClusterSortNUMA {
   std::shared_ptr<const Table> _input_table_right;
   const ColumnID _left_column_id;
   const ColumnID _right_column_id;
+  const bool _equi_case;
 
   // The cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   // It is asserted to be a power of two in the constructor.
@@ -118,6 +123,9 @@ class RadixClusterSortNUMA {
   bool _materialize_null_left;
   bool _materialize_null_right;
 
+  // Number of values per materialized segment from which the split values of the range clustering are picked
+  static constexpr auto SAMPLES_PER_SEGMENT = size_t{10};
+
   // Radix calculation for arithmetic types
   template <typename T2>
   static std::enable_if_t<std::is_arithmetic_v<T2>, uint32_t> get_radix(T2 value, uint32_t radix_bitmask) {
@@ -233,24 +241,22 @@ class RadixClusterSortNUMA {
   }
 
   /**
-  * Performs least significant bit radix clustering which is used in the equi join case.
+  * Clusters all NUMA partitions of a materialized table in parallel, each on its own node.
   **/
-  std::unique_ptr<MaterializedNUMAPartitionList<T>> _radix_cluster_numa(
-      std::unique_ptr<MaterializedNUMAPartitionList<T>>& input_chunks) {
+  std::unique_ptr<MaterializedNUMAPartitionList<T>> _cluster_partitions(
+      std::unique_ptr<MaterializedNUMAPartitionList<T>>& input_chunks,
+      const std::function<size_t(const T&)>& clusterer) {
     auto output = std::make_unique<MaterializedNUMAPartitionList<T>>();
 
-    auto radix_bitmask = _cluster_count - 1;
-
-    output->resize(_cluster_count);
+    // All partitions are clustered, also if the number of NUMA nodes is not a power of two and thus differs from the
+    // cluster count
+    output->resize(input_chunks->size());
 
     std::vector<std::shared_ptr<AbstractTask>> cluster_jobs;
 
-    for (NodeID node_id{0}; node_id < _cluster_count; node_id++) {
-      DebugAssert(node_id < input_chunks->size(), "Node ID out of range. Node ID: " + std::to_string(node_id) +
-                                                      " Cluster count: " + std::to_string(_cluster_count));
-      auto job = std::make_shared<JobTask>([&output, &input_chunks, node_id, radix_bitmask, this]() {
-        (*output)[node_id] = _cluster((*input_chunks)[node_id],
-                                      [=](const T& value) { return get_radix<T>(value, radix_bitmask); }, node_id);
+    for (NodeID node_id{0}; node_id < input_chunks->size(); node_id++) {
+      auto job = std::make_shared<JobTask>([&output, &input_chunks, &clusterer, node_id, this]() {
+        (*output)[node_id] = _cluster((*input_chunks)[node_id], clusterer, node_id);
       });
 
       cluster_jobs.push_back(job);
@@ -262,6 +268,67 @@ class RadixClusterSortNUMA {
     return output;
   }
 
+  /**
+  * Performs least significant bit radix clustering which is used in the equi join case.
+  **/
+  std::unique_ptr<MaterializedNUMAPartitionList<T>> _radix_cluster_numa(
+      std::unique_ptr<MaterializedNUMAPartitionList<T>>& input_chunks) {
+    const auto radix_bitmask = _cluster_count - 1;
+    return _cluster_partitions(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+  }
+
+  /**
+  * Picks the split values for the range clustering from samples of both inputs. Each split value is the inclusive
+  * upper bound of its cluster. If there are fewer distinct samples than clusters, the last clusters stay empty.
+  **/
+  std::vector<T> _pick_split_values(const MaterializedNUMAPartitionList<T>& left,
+                                    const MaterializedNUMAPartitionList<T>& right) const {
+    auto samples = std::vector<T>{};
+    for (const auto* partitions : {&left, &right}) {
+      for (const auto& partition : *partitions) {
+        for (const auto& segment : partition.materialized_segments) {
+          const auto sample_count = std::min(SAMPLES_PER_SEGMENT, segment->size());
+          for (auto sample_id = size_t{0}; sample_id < sample_count; ++sample_id) {
+            samples.push_back((*segment)[sample_id * segment->size() / sample_count].value);
+          }
+        }
+      }
+    }
+
+    auto split_values = std::vector<T>{};
+    if (samples.empty()) return split_values;
+
+    std::sort(samples.begin(), samples.end());
+    split_values.reserve(_cluster_count - 1);
+    for (auto cluster_id = size_t{1}; cluster_id < _cluster_count; ++cluster_id) {
+      split_values.push_back(samples[cluster_id * samples.size() / _cluster_count]);
+    }
+    split_values.erase(std::unique(split_values.begin(), split_values.end()), split_values.end());
+
+    return split_values;
+  }
+
+  /**
+  * Performs range clustering, which is used in the non-equi join cases. Both inputs are clustered with the same split
+  * values.
+  **/
+  std::pair<std::unique_ptr<MaterializedNUMAPartitionList<T>>, std::unique_ptr<MaterializedNUMAPartitionList<T>>>
+  _range_cluster_numa(std::unique_ptr<MaterializedNUMAPartitionList<T>>& input_left,
+                      std::unique_ptr<MaterializedNUMAPartitionList<T>>& input_right) {
+    const auto split_values = _pick_split_values(*input_left, *input_right);
+
+    // The cluster of a value is the one of the first split value that is greater or equal to it
+    const auto clusterer = [&split_values](const T& value) {
+      return static_cast<size_t>(std::lower_bound(split_values.begin(), split_values.end(), value) -
+                                 split_values.begin());
+    };
+
+    auto output_left = _cluster_partitions(input_left, clusterer);
+    auto output_right = _cluster_partitions(input_right, clusterer);
+
+    return {std::move(output_left), std::move(output_right)};
+  }
+
   /**
   * Moves the values so that each cluster resides on a seperate node
   **/
@@ -282,14 +349,18 @@ class RadixClusterSortNUMA {
 
     auto repartition_jobs = std::vector<std::shared_ptr<AbstractTask>>();
 
+    // The partitions are created up front, so that the jobs do not modify the list concurrently
+    homogenous_partitions->reserve(_cluster_count);
     for (NodeID numa_node{0}; numa_node < _cluster_count; ++numa_node) {
-      auto job = std::make_shared<JobTask>([this, numa_node, &private_partitions, &homogenous_partitions]() {
-        homogenous_partitions->emplace_back(MaterializedNUMAPartition<T>(numa_node, 1));
+      homogenous_partitions->emplace_back(MaterializedNUMAPartition<T>(numa_node, 1));
+    }
 
+    for (NodeID numa_node{0}; numa_node < _cluster_count; ++numa_node) {
+      auto job = std::make_shared<JobTask>([numa_node, &private_partitions, &homogenous_partitions, &cluster_sizes]() {
         auto& homogenous_partition = (*homogenous_partitions)[numa_node];
 
-        auto materialized_segment = std::make_shared<MaterializedSegment<T>>();
-        materialized_segment->reserve(_cluster_count);
+        auto materialized_segment = std::make_shared<MaterializedSegment<T>>(homogenous_partition.alloc);
+        materialized_segment->reserve(cluster_sizes[numa_node]);
         homogenous_partition.materialized_segments[0] = materialized_segment;
 
         for (const auto& partition : (*private_partitions)) {
@@ -335,7 +406,6 @@ class RadixClusterSortNUMA {
   RadixClusterOutput<T> execute() {
     auto output = RadixClusterOutput<T>();
 
-    // Sort the chunks of the input tables in the non-equi cases
     auto left_column_materializer = ColumnMaterializerNUMA<T>(_materialize_null_left);
     auto right_column_materializer = ColumnMaterializerNUMA<T>(_materialize_null_right);
     auto materialization_left = left_column_materializer.materialize(_input_table_left, _left_column_id);
@@ -349,9 +419,12 @@ class RadixClusterSortNUMA {
     if (_cluster_count == 1) {
       output.clusters_left = _concatenate_chunks(materialized_left_segments);
       output.clusters_right = _concatenate_chunks(materialized_right_segments);
-    } else {
+    } else if (_equi_case) {
       output.clusters_left = _radix_cluster_numa(materialized_left_segments);
       output.clusters_right = _radix_cluster_numa(materialized_right_segments);
+    } else {
+      std::tie(output.clusters_left, output.clusters_right) =
+          _range_cluster_numa(materialized_left_segments, materialized_right_segments);
     }
 
     output.clusters_left = _repartition_clusters(output.clusters_left);
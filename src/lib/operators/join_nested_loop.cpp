@@ -1,14 +1,19 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
+#include "table_scan/simd_scan_kernels.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/ignore_unused_variable.hpp"
@@ -58,15 +63,90 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
     }
   }
 }
+
+// Number of right values that are compared with all left values of a chunk before moving on to the next block, so
+// that the block stays in the L1 cache
+constexpr auto JOIN_BLOCK_SIZE = size_t{2048};
+
+// The non-NULL values of a segment and their chunk offsets
+template <typename T>
+struct MaterializedSegment {
+  std::vector<T> values;
+  std::vector<ChunkOffset> chunk_offsets;
+};
+
+template <typename T>
+MaterializedSegment<T> materialize_segment(const BaseSegment& segment) {
+  auto materialized_segment = MaterializedSegment<T>{};
+  materialized_segment.values.reserve(segment.size());
+  materialized_segment.chunk_offsets.reserve(segment.size());
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    materialized_segment.values.emplace_back(position.value());
+    materialized_segment.chunk_offsets.emplace_back(position.chunk_offset());
+  });
+
+  return materialized_segment;
+}
+
+/**
+ * Joins two materialized segments block by block. For the data types and predicates supported by the SIMD scan
+ * kernels, each left value is compared with a whole block of right values by simd_scan_values(), which reports the
+ * positions within the block that match the flipped predicate.
+ */
+template <typename T>
+void __attribute__((noinline))
+join_materialized_segments(const MaterializedSegment<T>& left, const MaterializedSegment<T>& right,
+                           const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                           const JoinNestedLoop::JoinParams& params) {
+  constexpr auto SIMD_TYPE = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> || std::is_same_v<T, float> ||
+                             std::is_same_v<T, double>;
+  const auto use_simd = SIMD_TYPE && simd_scan_supports_predicate_condition(params.predicate_condition);
+  const auto flipped_predicate_condition =
+      use_simd ? flip_predicate_condition(params.predicate_condition) : params.predicate_condition;
+  auto block_matches = PosList{};
+
+  with_comparator(params.predicate_condition, [&](auto comparator) {
+    for (auto block_begin = size_t{0}; block_begin < right.values.size(); block_begin += JOIN_BLOCK_SIZE) {
+      const auto block_end = std::min(block_begin + JOIN_BLOCK_SIZE, right.values.size());
+
+      for (auto left_index = size_t{0}; left_index < left.values.size(); ++left_index) {
+        const auto& left_value = left.values[left_index];
+        const auto left_row_id = RowID{chunk_id_left, left.chunk_offsets[left_index]};
+
+        if constexpr (SIMD_TYPE) {
+          if (use_simd) {
+            block_matches.clear();
+            simd_scan_values(right.values.data() + block_begin, block_end - block_begin, flipped_predicate_condition,
+                             left_value, chunk_id_right, ChunkOffset{0}, block_matches);
+            for (const auto& block_match : block_matches) {
+              const auto right_index = block_begin + block_match.chunk_offset;
+              process_match(left_row_id, RowID{chunk_id_right, right.chunk_offsets[right_index]}, params);
+            }
+            continue;
+          }
+        }
+
+        for (auto right_index = block_begin; right_index < block_end; ++right_index) {
+          if (comparator(left_value, right.values[right_index])) {
+            process_match(left_row_id, RowID{chunk_id_right, right.chunk_offsets[right_index]}, params);
+          }
+        }
+      }
+    }
+  });
+}
+
 }  // namespace
 
 namespace opossum {
 
 /*
- * This is a Nested Loop Join implementation completely based on iterables.
- * It supports all current join and predicate conditions, as well as NULL values.
- * Because this is a Nested Loop Join, the performance is going to be far inferior to JoinHash and JoinSortMerge,
- * so only use this for testing or benchmarking purposes.
+ * This is a Nested Loop Join implementation that supports all current join and predicate conditions, as well as NULL
+ * values. The chunks of the left input are joined in parallel, and the values of both inputs are materialized and
+ * compared block by block. Still, because this is a Nested Loop Join, the performance is going to be far inferior to
+ * JoinHash and JoinSortMerge, so it is only a fallback for predicates that they do not support.
  */
 
 JoinNestedLoop::JoinNestedLoop(const std::shared_ptr<const AbstractOperator>& left,
@@ -105,17 +185,38 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
     maybe_flipped_predicate_condition = flip_predicate_condition(_predicate_condition);
   }
 
-  const auto pos_list_left = std::make_shared<PosList>();
-  const auto pos_list_right = std::make_shared<PosList>();
-
   const auto is_outer_join = (_mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::Outer);
+  const auto track_right_matches = (_mode == JoinMode::Outer);
 
-  // for Full Outer, remember the matches on the right side
-  std::vector<std::vector<bool>> right_matches(right_table->chunk_count());
+  /**
+   * Each chunk of the left input is joined with all chunks of the right input by a separate job, which writes its own
+   * PosLists. They are concatenated in the order of the left chunks afterwards, so that the output does not depend on
+   * the scheduling. If both join columns have the same data type, the right input is materialized once into typed
+   * vectors, and each job materializes its left chunk (see join_materialized_segments()). Otherwise, the segments are
+   * joined through their iterables.
+   */
+  struct LeftChunkResult {
+    PosList pos_list_left;
+    PosList pos_list_right;
+    // For Full Outer, the matches of the right side found by this job
+    std::vector<std::vector<bool>> right_matches;
+  };
+  auto left_chunk_results = std::vector<LeftChunkResult>(left_table->chunk_count());
+
+  // The right segments are accessed by all jobs. Getting them once spares the jobs from contending for the reference
+  // counts of the same chunks and segments.
+  auto segments_right = std::vector<std::shared_ptr<const BaseSegment>>{};
+  segments_right.reserve(right_table->chunk_count());
+  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+    segments_right.emplace_back(right_table->get_chunk(chunk_id_right)->get_segment(right_column_id));
+  }
 
-  // Scan all chunks from left input
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_table->chunk_count(); ++chunk_id_left) {
-    auto segment_left = left_table->get_chunk(chunk_id_left)->get_segment(left_column_id);
+  const auto join_left_chunk = [&](const ChunkID chunk_id_left, const auto& join_segments) {
+    // The remaining chunks are skipped once the statement is cancelled, see CancellationToken
+    if (is_cancelled()) return;
+
+    auto& result = left_chunk_results[chunk_id_left];
+    const auto segment_left = left_table->get_chunk(chunk_id_left)->get_segment(left_column_id);
 
     // for Outer joins, remember matches on the left side
     std::vector<bool> left_matches;
@@ -124,36 +225,98 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
       left_matches.resize(segment_left->size());
     }
 
-    // Scan all chunks for right input
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
-      const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
-      right_matches[chunk_id_right].resize(segment_right->size());
+    if (track_right_matches) result.right_matches.resize(segments_right.size());
+    std::vector<bool> untracked_right_matches;
+
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < segments_right.size(); ++chunk_id_right) {
+      auto& right_matches = track_right_matches ? result.right_matches[chunk_id_right] : untracked_right_matches;
+      if (track_right_matches) right_matches.resize(segments_right[chunk_id_right]->size());
 
-      const auto track_right_matches = (_mode == JoinMode::Outer);
-      JoinParams params{*pos_list_left, *pos_list_right,     left_matches, right_matches[chunk_id_right],
-                        is_outer_join,  track_right_matches, _mode,        maybe_flipped_predicate_condition};
-      _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+      JoinParams params{result.pos_list_left, result.pos_list_right, left_matches,
+                        right_matches,        is_outer_join,         track_right_matches,
+                        _mode,                maybe_flipped_predicate_condition};
+      join_segments(*segment_left, chunk_id_right, params);
     }
 
     if (is_outer_join) {
       // add unmatched rows on the left for Left and Full Outer joins
       for (ChunkOffset chunk_offset{0}; chunk_offset < left_matches.size(); ++chunk_offset) {
         if (!left_matches[chunk_offset]) {
-          pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset});
-          pos_list_right->emplace_back(NULL_ROW_ID);
+          result.pos_list_left.emplace_back(RowID{chunk_id_left, chunk_offset});
+          result.pos_list_right.emplace_back(NULL_ROW_ID);
         }
       }
     }
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(left_table->chunk_count());
+
+  const auto left_data_type = left_table->column_data_type(left_column_id);
+  if (left_data_type == right_table->column_data_type(right_column_id)) {
+    resolve_data_type(left_data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto materialized_segments_right = std::vector<MaterializedSegment<ColumnDataType>>{};
+      materialized_segments_right.reserve(segments_right.size());
+      for (const auto& segment_right : segments_right) {
+        materialized_segments_right.emplace_back(materialize_segment<ColumnDataType>(*segment_right));
+      }
+
+      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_table->chunk_count(); ++chunk_id_left) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left]() {
+          auto materialized_segment_left = std::optional<MaterializedSegment<ColumnDataType>>{};
+          join_left_chunk(chunk_id_left, [&](const BaseSegment& segment_left, const ChunkID chunk_id_right,
+                                             const JoinParams& params) {
+            if (!materialized_segment_left) {
+              materialized_segment_left = materialize_segment<ColumnDataType>(segment_left);
+            }
+            join_materialized_segments(*materialized_segment_left, materialized_segments_right[chunk_id_right],
+                                       chunk_id_left, chunk_id_right, params);
+          });
+        }));
+      }
+      CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+    });
+  } else {
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_table->chunk_count(); ++chunk_id_left) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left]() {
+        join_left_chunk(chunk_id_left, [&](const BaseSegment& segment_left, const ChunkID chunk_id_right,
+                                           JoinParams& params) {
+          _join_two_untyped_segments(segment_left, *segments_right[chunk_id_right], chunk_id_left, chunk_id_right,
+                                     params);
+        });
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
+  auto output_row_count = size_t{0};
+  for (const auto& result : left_chunk_results) {
+    output_row_count += result.pos_list_left.size();
+  }
+
+  const auto pos_list_left = std::make_shared<PosList>();
+  const auto pos_list_right = std::make_shared<PosList>();
+  pos_list_left->reserve(output_row_count);
+  pos_list_right->reserve(output_row_count);
+  for (const auto& result : left_chunk_results) {
+    pos_list_left->insert(pos_list_left->end(), result.pos_list_left.begin(), result.pos_list_left.end());
+    pos_list_right->insert(pos_list_right->end(), result.pos_list_right.begin(), result.pos_list_right.end());
   }
 
   // For Full Outer we need to add all unmatched rows for the right side.
-  // Unmatched rows on the left side are already added in the main loop above
-  if (_mode == JoinMode::Outer) {
+  // Unmatched rows on the left side are already added by the jobs above. If the jobs were cancelled, the matches of
+  // the right side are incomplete.
+  if (_mode == JoinMode::Outer && !is_cancelled()) {
     for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
       const auto chunk_size = right_table->get_chunk(chunk_id_right)->size();
 
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-        if (!right_matches[chunk_id_right][chunk_offset]) {
+        const auto matched = std::any_of(left_chunk_results.begin(), left_chunk_results.end(), [&](const auto& result) {
+          return result.right_matches[chunk_id_right][chunk_offset];
+        });
+        if (!matched) {
           pos_list_left->emplace_back(NULL_ROW_ID);
           pos_list_right->emplace_back(chunk_id_right, chunk_offset);
         }
@@ -284,9 +447,10 @@ void JoinNestedLoop::_write_output_chunks(Segments& segments, const std::shared_
           if (row.is_null()) {
             new_pos_list->push_back(NULL_ROW_ID);
           } else {
-            auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(
-                input_table->get_chunk(row.chunk_id)->get_segment(column_id));
-            new_pos_list->push_back((*reference_segment->pos_list())[row.chunk_offset]);
+            // Views spare the atomic reference counting of the input's chunks and segments for every row
+            const auto& reference_segment = static_cast<const ReferenceSegment&>(
+                input_table->get_chunk_view(row.chunk_id).get_segment_view(column_id));
+            new_pos_list->push_back((*reference_segment.pos_list())[row.chunk_offset]);
           }
         }
 
@@ -0,0 +1,277 @@
+#include "join_range.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/parallel_sort.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A predicate on a column of the probe input, as in `sorted_value <predicate_condition> probe_value`
+struct ProbeBound {
+  ColumnID probe_column_id;
+  PredicateCondition predicate_condition;
+};
+
+// Adds a ReferenceSegment for each column of input_table. References are resolved, so that the output references the
+// stored tables.
+void write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
+                           const std::shared_ptr<PosList>& pos_list) {
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    if (input_table->type() == TableType::Data) {
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      continue;
+    }
+
+    if (input_table->chunk_count() == 0) {
+      // The output is empty, so it does not matter which table it references
+      const auto dummy_table = Table::create_dummy_table(input_table->column_definitions());
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(dummy_table, column_id, pos_list));
+      continue;
+    }
+
+    auto resolved_pos_list = std::make_shared<PosList>();
+    resolved_pos_list->reserve(pos_list->size());
+    for (const auto& row_id : *pos_list) {
+      // Views spare the atomic reference counting of the input's chunks and segments for every row
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(
+          input_table->get_chunk_view(row_id.chunk_id).get_segment_view(column_id));
+      resolved_pos_list->emplace_back((*reference_segment.pos_list())[row_id.chunk_offset]);
+    }
+
+    const auto first_reference_segment =
+        std::static_pointer_cast<const ReferenceSegment>(input_table->get_chunk(ChunkID{0})->get_segment(column_id));
+    output_segments.emplace_back(std::make_shared<ReferenceSegment>(first_reference_segment->referenced_table(),
+                                                                    first_reference_segment->referenced_column_id(),
+                                                                    resolved_pos_list));
+  }
+}
+
+// Materializes the non-null values of a column with their RowIDs and sorts them by value. As in Sort, each chunk is
+// sorted by a separate job, the runs are merged in parallel.
+template <typename ColumnDataType>
+std::vector<std::pair<RowID, ColumnDataType>> materialize_sorted(const Table& table, const ColumnID column_id) {
+  auto runs = std::vector<std::vector<std::pair<RowID, ColumnDataType>>>(table.chunk_count());
+  const auto comparator = [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; };
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(runs.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      auto& run = runs[chunk_id];
+      run.reserve(chunk->size());
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+        run.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+      });
+
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (run.size() >= RADIX_SORT_MIN_SIZE) {
+          radix_sort(run, false);
+          return;
+        }
+      }
+      std::stable_sort(run.begin(), run.end(), comparator);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return merge_sorted_runs(std::move(runs), comparator);
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinRange::JoinRange(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                     const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+                     const std::optional<OperatorJoinPredicate>& secondary_predicate)
+    : AbstractJoinOperator(OperatorType::JoinRange, left, right, mode, column_ids, predicate_condition),
+      _secondary_predicate(secondary_predicate) {
+  Assert(supports(mode, predicate_condition), "JoinRange only supports inner joins with inequality predicates");
+  if (_secondary_predicate) {
+    Assert(supports(mode, _secondary_predicate->predicate_condition),
+           "JoinRange only supports inner joins with inequality predicates");
+    Assert(_secondary_predicate->column_ids.first == column_ids.first ||
+               _secondary_predicate->column_ids.second == column_ids.second,
+           "The predicates of JoinRange need to share a column");
+  }
+}
+
+const std::string JoinRange::name() const { return "JoinRange"; }
+
+const std::string JoinRange::description(DescriptionMode description_mode) const {
+  auto description = AbstractJoinOperator::description(description_mode);
+  if (!_secondary_predicate) return description;
+
+  const auto [left_column_id, right_column_id] = _secondary_predicate->column_ids;
+  const auto column_name_left = input_table_left() ? input_table_left()->column_name(left_column_id)
+                                                   : std::string("Column #") + std::to_string(left_column_id);
+  const auto column_name_right = input_table_right() ? input_table_right()->column_name(right_column_id)
+                                                     : std::string("Column #") + std::to_string(right_column_id);
+
+  // Insert the secondary predicate before the closing parenthesis
+  description.insert(description.size() - 1,
+                     " AND " + column_name_left + " " +
+                         predicate_condition_to_string.left.at(_secondary_predicate->predicate_condition) + " " +
+                         column_name_right);
+  return description;
+}
+
+const std::optional<OperatorJoinPredicate>& JoinRange::secondary_predicate() const { return _secondary_predicate; }
+
+bool JoinRange::supports(const JoinMode mode, const PredicateCondition predicate_condition) {
+  return mode == JoinMode::Inner &&
+         (predicate_condition == PredicateCondition::LessThan ||
+          predicate_condition == PredicateCondition::LessThanEquals ||
+          predicate_condition == PredicateCondition::GreaterThan ||
+          predicate_condition == PredicateCondition::GreaterThanEquals);
+}
+
+std::shared_ptr<AbstractOperator> JoinRange::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinRange>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                     _secondary_predicate);
+}
+
+std::shared_ptr<const Table> JoinRange::_on_execute() {
+  // Without a secondary predicate, the right input is sorted
+  const auto sort_left = _secondary_predicate && _secondary_predicate->column_ids.first == _column_ids.first;
+  const auto sorted_table = sort_left ? input_table_left() : input_table_right();
+  const auto probe_table = sort_left ? input_table_right() : input_table_left();
+  const auto sorted_column_id = sort_left ? _column_ids.first : _column_ids.second;
+
+  // The predicates are turned into bounds `sorted_value <predicate_condition> probe_value`
+  auto probe_bounds = std::vector<ProbeBound>{};
+  const auto add_probe_bound = [&](const ColumnIDPair& column_ids, const PredicateCondition predicate_condition) {
+    if (sort_left) {
+      probe_bounds.emplace_back(ProbeBound{column_ids.second, predicate_condition});
+    } else {
+      probe_bounds.emplace_back(ProbeBound{column_ids.first, flip_predicate_condition(predicate_condition)});
+    }
+  };
+  add_probe_bound(_column_ids, _predicate_condition);
+  if (_secondary_predicate) {
+    add_probe_bound(_secondary_predicate->column_ids, _secondary_predicate->predicate_condition);
+  }
+
+  const auto data_type = sorted_table->column_data_type(sorted_column_id);
+  for (const auto& probe_bound : probe_bounds) {
+    Assert(probe_table->column_data_type(probe_bound.probe_column_id) == data_type,
+           "JoinRange requires the join columns to have the same data type");
+  }
+
+  const auto probe_chunk_count = probe_table->chunk_count();
+  auto sorted_pos_lists = std::vector<PosList>(probe_chunk_count);
+  auto probe_pos_lists = std::vector<PosList>(probe_chunk_count);
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto sorted_rows = materialize_sorted<ColumnDataType>(*sorted_table, sorted_column_id);
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(probe_chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < probe_chunk_count; ++chunk_id) {
+      const auto chunk = probe_table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+        // The matches of each probe row are the sorted rows in [range_begins[offset], range_ends[offset])
+        auto range_begins = std::vector<size_t>(chunk->size(), 0);
+        auto range_ends = std::vector<size_t>(chunk->size(), sorted_rows.size());
+
+        for (const auto& probe_bound : probe_bounds) {
+          segment_iterate<ColumnDataType>(*chunk->get_segment(probe_bound.probe_column_id), [&](const auto& position) {
+            const auto chunk_offset = position.chunk_offset();
+            if (position.is_null()) {
+              range_begins[chunk_offset] = sorted_rows.size();
+              return;
+            }
+
+            const auto& value = position.value();
+            const auto lower_bound = [&]() {
+              const auto it = std::lower_bound(sorted_rows.cbegin(), sorted_rows.cend(), value,
+                                               [](const auto& row, const auto& bound) { return row.second < bound; });
+              return static_cast<size_t>(it - sorted_rows.cbegin());
+            };
+            const auto upper_bound = [&]() {
+              const auto it = std::upper_bound(sorted_rows.cbegin(), sorted_rows.cend(), value,
+                                               [](const auto& bound, const auto& row) { return bound < row.second; });
+              return static_cast<size_t>(it - sorted_rows.cbegin());
+            };
+
+            switch (probe_bound.predicate_condition) {
+              case PredicateCondition::LessThan:
+                range_ends[chunk_offset] = std::min(range_ends[chunk_offset], lower_bound());
+                break;
+              case PredicateCondition::LessThanEquals:
+                range_ends[chunk_offset] = std::min(range_ends[chunk_offset], upper_bound());
+                break;
+              case PredicateCondition::GreaterThan:
+                range_begins[chunk_offset] = std::max(range_begins[chunk_offset], upper_bound());
+                break;
+              case PredicateCondition::GreaterThanEquals:
+                range_begins[chunk_offset] = std::max(range_begins[chunk_offset], lower_bound());
+                break;
+              default:
+                Fail("Unsupported predicate condition");
+            }
+          });
+        }
+
+        auto& sorted_pos_list = sorted_pos_lists[chunk_id];
+        auto& probe_pos_list = probe_pos_lists[chunk_id];
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+          for (auto sorted_idx = range_begins[chunk_offset]; sorted_idx < range_ends[chunk_offset]; ++sorted_idx) {
+            sorted_pos_list.emplace_back(sorted_rows[sorted_idx].first);
+            probe_pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+
+  auto output_row_count = size_t{0};
+  for (const auto& probe_pos_list : probe_pos_lists) output_row_count += probe_pos_list.size();
+
+  auto sorted_pos_list = std::make_shared<PosList>();
+  auto probe_pos_list = std::make_shared<PosList>();
+  sorted_pos_list->reserve(output_row_count);
+  probe_pos_list->reserve(output_row_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < probe_chunk_count; ++chunk_id) {
+    sorted_pos_list->insert(sorted_pos_list->end(), sorted_pos_lists[chunk_id].begin(),
+                            sorted_pos_lists[chunk_id].end());
+    probe_pos_list->insert(probe_pos_list->end(), probe_pos_lists[chunk_id].begin(), probe_pos_lists[chunk_id].end());
+  }
+
+  auto output_segments = Segments{};
+  write_output_segments(output_segments, input_table_left(), sort_left ? sorted_pos_list : probe_pos_list);
+  write_output_segments(output_segments, input_table_right(), sort_left ? probe_pos_list : sorted_pos_list);
+
+  const auto output_table = _initialize_output_table();
+  output_table->append_chunk(output_segments);
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Inner join for inequality predicates (<, <=, >, >=). A secondary inequality predicate can be added if it shares one
+ * of the columns of the primary predicate. This way, band joins such as `a.ts BETWEEN b.start AND b.end` are executed
+ * as `a.ts >= b.start AND a.ts <= b.end` without producing the cross product first.
+ *
+ * The input with the shared column (the right input if there is no secondary predicate) is materialized and sorted by
+ * that column. The matches of a row of the other input then form a contiguous range of the sorted rows, which is found
+ * by binary searches. The chunks of the other input are probed in parallel.
+ */
+class JoinRange : public AbstractJoinOperator {
+ public:
+  JoinRange(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+            const std::optional<OperatorJoinPredicate>& secondary_predicate = std::nullopt);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::optional<OperatorJoinPredicate>& secondary_predicate() const;
+
+  // Whether JoinRange can execute a join with the given predicate condition
+  static bool supports(const JoinMode mode, const PredicateCondition predicate_condition);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+  const std::optional<OperatorJoinPredicate> _secondary_predicate;
+};
+
+}  // namespace opossum
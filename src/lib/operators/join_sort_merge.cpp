@@ -13,14 +13,24 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/abstract_segment_visitor.hpp"
+#include "storage/dictionary_segment/dictionary_id_mapping.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
 
+// Upper bound for the number of clusters, each of which becomes a JobTask and an output chunk
+constexpr auto JOIN_SORT_MERGE_MAX_CLUSTER_COUNT = size_t{1'024};
+
+// Like make_unique_by_data_type(), but for joins on the ids of a DictionaryIDMapping (see JoinSortMerge::_on_execute())
+template <class Base, template <typename...> class Impl, typename... ConstructorArgs>
+std::unique_ptr<Base> make_unique_for_value_ids(ConstructorArgs&&... args) {
+  return std::make_unique<Impl<ValueID>>(std::forward<ConstructorArgs>(args)...);
+}
+
 /**
 * TODO(anyone): Outer not-equal join (outer !=)
-* TODO(anyone): Choose an appropriate number of clusters.
 **/
 
 /**
@@ -35,7 +45,8 @@ namespace opossum {
 JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
                              const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                              const ColumnIDPair& column_ids, const PredicateCondition op)
-    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, column_ids, op) {
+    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, column_ids, op,
+                           std::make_unique<JoinSortMerge::PerformanceData>()) {
   // Validate the parameters
   DebugAssert(mode != JoinMode::Cross, "This operator does not support cross joins.");
   DebugAssert(left != nullptr, "The left input operator is null.");
@@ -63,9 +74,38 @@ std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
   DebugAssert(left_column_type == input_table_right()->column_data_type(_column_ids.second),
               "Left and right column types do not match. The sort merge join requires matching column types");
 
+  auto left_input_table = input_table_left();
+  auto right_input_table = input_table_right();
+
+  // Rows without a join partner are dropped by inner equi-joins, so chunks of the larger input that contain none of
+  // the keys of the smaller one can be skipped entirely
+  if (_mode == JoinMode::Inner && _predicate_condition == PredicateCondition::Equals) {
+    if (left_input_table->row_count() < right_input_table->row_count()) {
+      right_input_table = _prune_chunks_without_join_partners(*left_input_table, _column_ids.first, right_input_table,
+                                                              _column_ids.second);
+    } else {
+      left_input_table = _prune_chunks_without_join_partners(*right_input_table, _column_ids.second, left_input_table,
+                                                             _column_ids.first);
+    }
+    _performance_data->pruned_chunk_count = input_table_left()->chunk_count() + input_table_right()->chunk_count() -
+                                            left_input_table->chunk_count() - right_input_table->chunk_count();
+  }
+
+  // If both join columns are dictionary-encoded, the values can be replaced by ids that are ordered like them (see
+  // DictionaryIDMapping). The join then sorts and merges these ids without comparing any values.
+  const auto dictionary_id_mapping =
+      DictionaryIDMapping::create({{left_input_table, _column_ids.first}, {right_input_table, _column_ids.second}});
+
   // Create implementation to compute the join result
-  _impl = make_unique_by_data_type<AbstractJoinOperatorImpl, JoinSortMergeImpl>(
-      left_column_type, *this, _column_ids.first, _column_ids.second, _predicate_condition, _mode);
+  if (dictionary_id_mapping) {
+    _impl = make_unique_for_value_ids<AbstractJoinOperatorImpl, JoinSortMergeImpl>(
+        *this, left_input_table, right_input_table, _column_ids.first, _column_ids.second, _predicate_condition, _mode,
+        dictionary_id_mapping);
+  } else {
+    _impl = make_unique_by_data_type<AbstractJoinOperatorImpl, JoinSortMergeImpl>(
+        left_column_type, *this, left_input_table, right_input_table, _column_ids.first, _column_ids.second,
+        _predicate_condition, _mode);
+  }
 
   return _impl->_on_execute();
 }
@@ -74,20 +114,33 @@ void JoinSortMerge::_on_cleanup() { _impl.reset(); }
 
 const std::string JoinSortMerge::name() const { return "JoinSortMerge"; }
 
+std::string JoinSortMerge::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += std::to_string(cluster_count) + " clusters";
+  return string;
+}
+
 /**
 ** Start of implementation.
 **/
 template <typename T>
 class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
  public:
-  JoinSortMergeImpl<T>(JoinSortMerge& sort_merge_join, ColumnID left_column_id, ColumnID right_column_id,
-                       const PredicateCondition op, JoinMode mode)
+  JoinSortMergeImpl<T>(JoinSortMerge& sort_merge_join, const std::shared_ptr<const Table>& left_input_table,
+                       const std::shared_ptr<const Table>& right_input_table, ColumnID left_column_id,
+                       ColumnID right_column_id, const PredicateCondition op, JoinMode mode,
+                       const std::shared_ptr<const DictionaryIDMapping>& dictionary_id_mapping = nullptr)
       : _sort_merge_join{sort_merge_join},
+        _left_input_table{left_input_table},
+        _right_input_table{right_input_table},
         _left_column_id{left_column_id},
         _right_column_id{right_column_id},
         _op{op},
-        _mode{mode} {
+        _mode{mode},
+        _dictionary_id_mapping{dictionary_id_mapping} {
     _cluster_count = _determine_number_of_clusters();
+    static_cast<PerformanceData&>(*_sort_merge_join._performance_data).cluster_count = _cluster_count;
     _output_pos_lists_left.resize(_cluster_count);
     _output_pos_lists_right.resize(_cluster_count);
   }
@@ -95,6 +148,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
  protected:
   JoinSortMerge& _sort_merge_join;
 
+  // The inputs of the join, without the chunks that were pruned because they cannot contain join partners
+  const std::shared_ptr<const Table> _left_input_table;
+  const std::shared_ptr<const Table> _right_input_table;
+
   // Contains the materialized sorted input tables
   std::unique_ptr<MaterializedSegmentList<T>> _sorted_left_table;
   std::unique_ptr<MaterializedSegmentList<T>> _sorted_right_table;
@@ -109,6 +166,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   const PredicateCondition _op;
   const JoinMode _mode;
 
+  // Only for joins on ids, i.e., with ValueID as T
+  const std::shared_ptr<const DictionaryIDMapping> _dictionary_id_mapping;
+
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   size_t _cluster_count;
 
@@ -161,14 +221,22 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   /**
   * Determines the number of clusters to be used for the join.
   * The number of clusters must be a power of two, i.e. 1, 2, 4, 8, 16...
-  * TODO(anyone): How should we determine the number of clusters?
+  * Each cluster is sorted and joined by its own JobTask, so there are at least about as many clusters as the bigger
+  * input has chunks. Beyond that, the clusters are made small enough for the materialized values of both inputs to
+  * fit into the L2 cache (as reported by the Topology) while they are sorted.
   **/
   size_t _determine_number_of_clusters() {
-    // Get the next lower power of two of the bigger chunk number
-    // Note: this is only provisional. There should be a reasonable calculation here based on hardware stats.
-    size_t chunk_count_left = _sort_merge_join.input_table_left()->chunk_count();
-    size_t chunk_count_right = _sort_merge_join.input_table_right()->chunk_count();
-    return static_cast<size_t>(std::pow(2, std::floor(std::log2(std::max(chunk_count_left, chunk_count_right)))));
+    const auto chunk_count = std::max(_left_input_table->chunk_count(), _right_input_table->chunk_count());
+
+    const auto materialized_size =
+        (_left_input_table->row_count() + _right_input_table->row_count()) * sizeof(MaterializedValue<T>);
+    const auto cache_cluster_count = materialized_size / Topology::get().l2_cache_size();
+
+    const auto cluster_count =
+        std::min(std::max({size_t{chunk_count}, cache_cluster_count, size_t{1}}), JOIN_SORT_MERGE_MAX_CLUSTER_COUNT);
+
+    // Get the next lower power of two
+    return size_t{1} << static_cast<size_t>(std::floor(std::log2(cluster_count)));
   }
 
   /**
@@ -645,9 +713,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   std::shared_ptr<const Table> _on_execute() override {
     bool include_null_left = (_mode == JoinMode::Left || _mode == JoinMode::Outer);
     bool include_null_right = (_mode == JoinMode::Right || _mode == JoinMode::Outer);
-    auto radix_clusterer = RadixClusterSort<T>(
-        _sort_merge_join.input_table_left(), _sort_merge_join.input_table_right(), _sort_merge_join._column_ids,
-        _op == PredicateCondition::Equals, include_null_left, include_null_right, _cluster_count);
+    auto radix_clusterer =
+        RadixClusterSort<T>(_left_input_table, _right_input_table, _sort_merge_join._column_ids,
+                            _op == PredicateCondition::Equals, include_null_left, include_null_right, _cluster_count,
+                            _dictionary_id_mapping);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
     _sorted_left_table = std::move(sort_output.clusters_left);
@@ -679,8 +748,8 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
 
     // Add the segments from both input tables to the output
     Segments output_segments;
-    _add_output_segments(output_segments, _sort_merge_join.input_table_left(), output_left);
-    _add_output_segments(output_segments, _sort_merge_join.input_table_right(), output_right);
+    _add_output_segments(output_segments, _left_input_table, output_left);
+    _add_output_segments(output_segments, _right_input_table, output_right);
 
     // Build the output_table with one Chunk
     auto output_table = _sort_merge_join._initialize_output_table();
@@ -25,6 +25,13 @@ class JoinSortMerge : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  struct PerformanceData : public OperatorPerformanceData {
+    // Number of clusters the inputs were partitioned into, which are sorted and joined independently
+    size_t cluster_count{0};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,6 +10,7 @@
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/dictionary_segment/dictionary_id_mapping.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
@@ -46,11 +48,17 @@ struct Subsample {
 /**
  * Materializes a table for a specific segment and sorts it if required. Result is a triple of
  * materialized values, positions of NULL values, and a list of samples.
+ * With ValueID as T, the ids of the given DictionaryIDMapping are materialized instead of the values.
  **/
 template <typename T>
 class ColumnMaterializer {
  public:
-  explicit ColumnMaterializer(bool sort, bool materialize_null) : _sort{sort}, _materialize_null{materialize_null} {}
+  explicit ColumnMaterializer(bool sort, bool materialize_null,
+                              const std::shared_ptr<const DictionaryIDMapping>& dictionary_id_mapping = nullptr)
+      : _sort{sort}, _materialize_null{materialize_null}, _dictionary_id_mapping{dictionary_id_mapping} {
+    DebugAssert((std::is_same_v<T, ValueID>) == (_dictionary_id_mapping != nullptr),
+                "A DictionaryIDMapping is needed to materialize ids, and only then");
+  }
 
  public:
   /**
@@ -101,13 +109,23 @@ class ColumnMaterializer {
                                                                   std::shared_ptr<const Table> input,
                                                                   const ColumnID column_id, Subsample<T>& subsample) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      auto segment = chunk->get_segment(column_id);
 
-      if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
-        (*output)[chunk_id] =
-            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample);
+      if constexpr (std::is_same_v<T, ValueID>) {
+        (*output)[chunk_id] = _materialize_ids(*segment, chunk_id, null_rows_output, subsample);
       } else {
-        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample);
+        // Chunks that are already sorted by the column do not need to be sorted again
+        const auto& ordered_by = chunk->ordered_by();
+        if (ordered_by && ordered_by->first == column_id) {
+          (*output)[chunk_id] =
+              _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample, ordered_by->second);
+        } else if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+          (*output)[chunk_id] =
+              _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample);
+        } else {
+          (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample);
+        }
       }
     });
   }
@@ -136,12 +154,12 @@ class ColumnMaterializer {
   }
 
   /**
-   * Materialization works of all types of segments
+   * Materialization works of all types of segments. If the segment is known to be sorted (see Chunk::ordered_by()),
+   * @param segment_order avoids sorting it again.
    */
-  std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(const BaseSegment& segment,
-                                                                       const ChunkID chunk_id,
-                                                                       std::unique_ptr<PosList>& null_rows_output,
-                                                                       Subsample<T>& subsample) {
+  std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(
+      const BaseSegment& segment, const ChunkID chunk_id, std::unique_ptr<PosList>& null_rows_output,
+      Subsample<T>& subsample, const std::optional<OrderByMode>& segment_order = std::nullopt) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
@@ -157,8 +175,12 @@ class ColumnMaterializer {
     });
 
     if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+      if (!segment_order) {
+        std::sort(output.begin(), output.end(),
+                  [](const auto& left, const auto& right) { return left.value < right.value; });
+      } else if (*segment_order == OrderByMode::Descending || *segment_order == OrderByMode::DescendingNullsLast) {
+        std::reverse(output.begin(), output.end());
+      }
     }
 
     _gather_samples_from_segment(output, subsample);
@@ -236,9 +258,42 @@ class ColumnMaterializer {
     return std::make_shared<MaterializedSegment<T>>(std::move(output));
   }
 
+  /**
+   * Materializes the ids of the DictionaryIDMapping. They are ordered like the values, so sorting them sorts the rows
+   * by value without comparing any values.
+   */
+  std::shared_ptr<MaterializedSegment<T>> _materialize_ids(const BaseSegment& segment, const ChunkID chunk_id,
+                                                           std::unique_ptr<PosList>& null_rows_output,
+                                                           Subsample<T>& subsample) {
+    auto output = MaterializedSegment<T>{};
+    output.reserve(segment.size());
+
+    _dictionary_id_mapping->for_each_id(segment, [&](const bool is_null, const ValueID id,
+                                                     const ChunkOffset chunk_offset) {
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      if (is_null) {
+        if (_materialize_null) {
+          null_rows_output->emplace_back(row_id);
+        }
+      } else {
+        output.emplace_back(row_id, id);
+      }
+    });
+
+    if (_sort) {
+      std::sort(output.begin(), output.end(),
+                [](const auto& left, const auto& right) { return left.value < right.value; });
+    }
+
+    _gather_samples_from_segment(output, subsample);
+
+    return std::make_shared<MaterializedSegment<T>>(std::move(output));
+  }
+
  private:
   bool _sort;
   bool _materialize_null;
+  std::shared_ptr<const DictionaryIDMapping> _dictionary_id_mapping;
 };
 
 }  // namespace opossum
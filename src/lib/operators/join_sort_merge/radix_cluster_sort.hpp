@@ -8,6 +8,7 @@
 
 #include "column_materializer.hpp"
 #include "resolve_type.hpp"
+#include "utils/write_combining_scatter.hpp"
 
 namespace opossum {
 
@@ -49,7 +50,8 @@ class RadixClusterSort {
  public:
   RadixClusterSort(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
                    const ColumnIDPair& column_ids, bool equi_case, const bool materialize_null_left,
-                   const bool materialize_null_right, size_t cluster_count)
+                   const bool materialize_null_right, size_t cluster_count,
+                   const std::shared_ptr<const DictionaryIDMapping>& dictionary_id_mapping = nullptr)
       : _input_table_left{left},
         _input_table_right{right},
         _left_column_id{column_ids.first},
@@ -57,7 +59,8 @@ class RadixClusterSort {
         _equi_case{equi_case},
         _cluster_count{cluster_count},
         _materialize_null_left{materialize_null_left},
-        _materialize_null_right{materialize_null_right} {
+        _materialize_null_right{materialize_null_right},
+        _dictionary_id_mapping{dictionary_id_mapping} {
     DebugAssert(cluster_count > 0, "cluster_count must be > 0");
     DebugAssert((cluster_count & (cluster_count - 1)) == 0, "cluster_count must be a power of two");
     DebugAssert(left != nullptr, "left input operator is null");
@@ -118,12 +121,21 @@ class RadixClusterSort {
   bool _materialize_null_left;
   bool _materialize_null_right;
 
+  // Only for joins on ids, i.e., with ValueID as T
+  std::shared_ptr<const DictionaryIDMapping> _dictionary_id_mapping;
+
   // Radix calculation for arithmetic types
   template <typename T2>
   static std::enable_if_t<std::is_arithmetic_v<T2>, uint32_t> get_radix(T2 value, size_t radix_bitmask) {
     return static_cast<uint32_t>(value) & radix_bitmask;
   }
 
+  // Radix calculation for the ids of a DictionaryIDMapping
+  template <typename T2>
+  static std::enable_if_t<std::is_same_v<T2, ValueID>, uint32_t> get_radix(T2 value, size_t radix_bitmask) {
+    return static_cast<uint32_t>(value) & radix_bitmask;
+  }
+
   // Radix calculation for non-arithmetic types
   template <typename T2>
   static std::enable_if_t<std::is_same_v<T2, pmr_string>, uint32_t> get_radix(T2 value, size_t radix_bitmask) {
@@ -214,15 +226,20 @@ class RadixClusterSort {
     std::vector<std::shared_ptr<AbstractTask>> cluster_jobs;
     for (size_t chunk_number = 0; chunk_number < input_chunks->size(); ++chunk_number) {
       auto job =
-          std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
+          std::make_shared<JobTask>([this, chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
             auto& chunk_information = table_information.chunk_information[chunk_number];
+
+            auto destinations = std::vector<MaterializedValue<T>*>(_cluster_count);
+            for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+              destinations[cluster_id] =
+                  (*output_table)[cluster_id]->data() + chunk_information.insert_position[cluster_id];
+            }
+            auto scatter = WriteCombiningScatter<MaterializedValue<T>>{std::move(destinations)};
+
             for (auto& entry : *(*input_chunks)[chunk_number]) {
-              auto cluster_id = clusterer(entry.value);
-              auto& output_cluster = *(*output_table)[cluster_id];
-              auto& insert_position = chunk_information.insert_position[cluster_id];
-              output_cluster[insert_position] = entry;
-              ++insert_position;
+              scatter.push(clusterer(entry.value), entry);
             }
+            scatter.flush();
           });
       cluster_jobs.push_back(job);
       job->schedule();
@@ -312,11 +329,29 @@ class RadixClusterSort {
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Returns whether all chunks of the table are sorted ascendingly by the column (see Chunk::ordered_by()). As
+  * clustering keeps the order of the values of each chunk, the clusters of such tables are often sorted already,
+  * e.g., if the table is sorted as a whole.
+  **/
+  static bool _is_presorted(const Table& table, const ColumnID column_id) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& ordered_by = table.get_chunk(chunk_id)->ordered_by();
+      if (!ordered_by || ordered_by->first != column_id) return false;
+      if (ordered_by->second != OrderByMode::Ascending && ordered_by->second != OrderByMode::AscendingNullsLast) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+  * Sorts all clusters of a materialized table. For presorted inputs, clusters that are already sorted are skipped.
   **/
-  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
+  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters, const bool is_presorted) {
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
     for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      if (is_presorted && std::is_sorted(cluster->begin(), cluster->end(), compare)) continue;
+      std::sort(cluster->begin(), cluster->end(), compare);
     }
   }
 
@@ -328,8 +363,8 @@ class RadixClusterSort {
     RadixClusterOutput<T> output;
 
     // Sort the chunks of the input tables in the non-equi cases
-    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
-    ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
+    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left, _dictionary_id_mapping);
+    ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right, _dictionary_id_mapping);
     auto [materialized_left_segments, null_rows_left, samples_left] =  // NOLINT
         left_column_materializer.materialize(_input_table_left, _left_column_id);
     auto [materialized_right_segments, null_rows_right, samples_right] =  // NOLINT
@@ -355,8 +390,8 @@ class RadixClusterSort {
 
     // Sort each cluster (right now std::sort -> but maybe can be replaced with
     // an more efficient algorithm, if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    _sort_clusters(output.clusters_left, _is_presorted(*_input_table_left, _left_column_id));
+    _sort_clusters(output.clusters_right, _is_presorted(*_input_table_right, _right_column_id));
 
     return output;
   }
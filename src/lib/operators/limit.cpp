@@ -1,6 +1,7 @@
 #include "limit.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -8,6 +9,9 @@
 
 #include "expression/evaluation/expression_evaluator.hpp"
 #include "expression/expression_utils.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 
@@ -48,37 +52,74 @@ std::shared_ptr<const Table> Limit::_on_execute() {
    */
   auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
 
+  // Determine the number of output rows of each chunk upfront so that the chunks can be processed independently
+  auto output_chunk_row_counts = std::vector<size_t>{};
   ChunkID chunk_id{0};
   for (size_t i = 0; i < num_rows && chunk_id < input_table->chunk_count(); chunk_id++) {
+    const auto output_chunk_row_count = std::min<size_t>(input_table->get_chunk(chunk_id)->size(), num_rows - i);
+    output_chunk_row_counts.emplace_back(output_chunk_row_count);
+    i += output_chunk_row_count;
+  }
+
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_row_counts.size());
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(output_chunk_row_counts.size());
+
+  for (chunk_id = ChunkID{0}; chunk_id < output_chunk_row_counts.size(); chunk_id++) {
     const auto input_chunk = input_table->get_chunk(chunk_id);
-    Segments output_segments;
-
-    size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), num_rows - i);
-
-    for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
-      const auto input_base_segment = input_chunk->get_segment(column_id);
-      auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
-      std::shared_ptr<const Table> referenced_table;
-      ColumnID output_column_id = column_id;
-
-      if (auto input_ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_base_segment)) {
-        output_column_id = input_ref_segment->referenced_column_id();
-        referenced_table = input_ref_segment->referenced_table();
-        // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_segment->pos_list()->begin();
-        std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
-      } else {
-        referenced_table = input_table;
-        for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
-        }
-      }
+    const auto output_chunk_row_count = output_chunk_row_counts[chunk_id];
 
-      output_segments.push_back(
-          std::make_shared<ReferenceSegment>(referenced_table, output_column_id, output_pos_list));
+    // Chunks of a reference table that are entirely part of the output are forwarded with their PosLists
+    if (input_table->type() == TableType::References && output_chunk_row_count == input_chunk->size()) {
+      output_segments_by_chunk[chunk_id] = input_chunk->segments();
+      continue;
     }
 
-    i += output_chunk_row_count;
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, input_chunk, output_chunk_row_count]() {
+      auto& output_segments = output_segments_by_chunk[chunk_id];
+
+      // Segments that share their input PosList (or, for data tables, all segments) share their output PosList, so
+      // that consumers only need to resolve each position once per chunk
+      auto output_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+      auto data_table_pos_list = std::shared_ptr<PosList>{};
+
+      for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
+        const auto input_base_segment = input_chunk->get_segment(column_id);
+        std::shared_ptr<PosList> output_pos_list;
+        std::shared_ptr<const Table> referenced_table;
+        ColumnID output_column_id = column_id;
+
+        if (auto input_ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_base_segment)) {
+          output_column_id = input_ref_segment->referenced_column_id();
+          referenced_table = input_ref_segment->referenced_table();
+
+          const auto& input_pos_list = input_ref_segment->pos_list();
+          auto& shared_output_pos_list = output_pos_lists[input_pos_list];
+          if (!shared_output_pos_list) {
+            const auto begin = input_pos_list->begin();
+            shared_output_pos_list = std::make_shared<PosList>(begin, begin + output_chunk_row_count);
+            if (input_pos_list->references_single_chunk()) shared_output_pos_list->guarantee_single_chunk();
+          }
+          output_pos_list = shared_output_pos_list;
+        } else {
+          referenced_table = input_table;
+          if (!data_table_pos_list) {
+            data_table_pos_list = std::make_shared<PosList>(
+                PosList::chunk_range(chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(output_chunk_row_count)));
+          }
+          output_pos_list = data_table_pos_list;
+        }
+
+        output_segments.push_back(
+            std::make_shared<ReferenceSegment>(referenced_table, output_column_id, output_pos_list));
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& output_segments : output_segments_by_chunk) {
     output_table->append_chunk(output_segments);
   }
 
@@ -8,10 +8,12 @@
 
 namespace opossum {
 
-CreateTable::CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions)
+CreateTable::CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+                         const ChunkOffset max_chunk_size)
     : AbstractReadOnlyOperator(OperatorType::CreateTable),
       table_name(table_name),
-      column_definitions(column_definitions) {}
+      column_definitions(column_definitions),
+      max_chunk_size(max_chunk_size) {}
 
 const std::string CreateTable::name() const { return "Create Table"; }
 
@@ -36,13 +38,14 @@ const std::string CreateTable::description(DescriptionMode description_mode) con
     }
   }
   stream << ")";
+  if (max_chunk_size != Chunk::DEFAULT_SIZE) stream << separator << "Chunk Size: " << max_chunk_size;
 
   return stream.str();
 }
 
 std::shared_ptr<const Table> CreateTable::_on_execute() {
-  // TODO(anybody) chunk size and mvcc not yet specifiable
-  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+  // TODO(anybody) mvcc not yet specifiable
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, UseMvcc::Yes);
 
   StorageManager::get().add_table(table_name, table);
 
@@ -52,7 +55,7 @@ std::shared_ptr<const Table> CreateTable::_on_execute() {
 std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<CreateTable>(table_name, column_definitions);
+  return std::make_shared<CreateTable>(table_name, column_definitions, max_chunk_size);
 }
 
 void CreateTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "operators/abstract_read_only_operator.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table_column_definition.hpp"
 
 namespace opossum {
@@ -8,13 +9,15 @@ namespace opossum {
 // maintenance operator for the "CREATE TABLE" sql statement
 class CreateTable : public AbstractReadOnlyOperator {
  public:
-  CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions);
+  CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+              const ChunkOffset max_chunk_size = Chunk::DEFAULT_SIZE);
 
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
   const std::string table_name;
   const TableColumnDefinitions column_definitions;
+  const ChunkOffset max_chunk_size;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
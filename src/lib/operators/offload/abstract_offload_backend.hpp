@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Interface of a backend that executes operators on an accelerator, e.g., a GPU. The OffloadingLQPTranslator offers
+ * it the TableScans, JoinHashes, and Aggregates whose inputs are estimated to have at least min_input_row_count() rows.
+ *
+ * An offloaded operator has the same inputs and output columns as the operator it replaces, so the rest of the plan is
+ * executed by the CPU engine as usual. It returns its output as a regular table, e.g., a reference table with the
+ * PosLists of a scan. Backends may keep immutable segments in device memory across queries, keyed by the segments.
+ */
+class AbstractOffloadBackend {
+ public:
+  virtual ~AbstractOffloadBackend() = default;
+
+  // Smaller inputs are not worth the transfer to and from the device
+  virtual size_t min_input_row_count() const = 0;
+
+  // Returns an operator that computes the output of @param cpu_operator on the device, or nullptr if the backend does
+  // not support it (e.g., because of its predicate or data types)
+  virtual std::shared_ptr<AbstractOperator> offload(const std::shared_ptr<AbstractOperator>& cpu_operator) const = 0;
+};
+
+}  // namespace opossum
@@ -1,13 +1,87 @@
 #include "operator_performance_data.hpp"
 
 #include <string>
+#include <unordered_set>
 
+#include "abstract_operator.hpp"
+#include "storage/table.hpp"
 #include "utils/format_duration.hpp"
 
 namespace opossum {
 
 std::string OperatorPerformanceData::to_string(DescriptionMode description_mode) const {
-  return format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  auto string = format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  if (hardware_counters) string += ", " + hardware_counters->to_string();
+  return string;
+}
+
+std::shared_ptr<Table> create_operator_performance_table(const std::shared_ptr<const AbstractOperator>& root) {
+  const auto column_definitions = TableColumnDefinitions{{"operator", DataType::String},
+                                                         {"walltime_ns", DataType::Long},
+                                                         {"wait_time_ns", DataType::Long},
+                                                         {"input_rows", DataType::Long},
+                                                         {"output_rows", DataType::Long, true},
+                                                         {"input_chunks", DataType::Long},
+                                                         {"pruned_chunks", DataType::Long},
+                                                         {"output_chunks", DataType::Long},
+                                                         {"output_bytes", DataType::Long, true},
+                                                         {"details", DataType::String}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+
+  const auto append_operator = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op,
+                                   const size_t depth) -> void {
+    if (!visited_operators.emplace(op).second) return;
+
+    const auto& performance_data = op->performance_data();
+    const auto output = op->get_output();
+
+    // The output of an operator executed by an OperatorTask might have been cleared already, see CleanupTemporaries
+    auto output_rows = AllTypeVariant{NullValue{}};
+    if (output) {
+      output_rows = static_cast<int64_t>(output->row_count());
+    } else if (performance_data.output_row_count) {
+      output_rows = static_cast<int64_t>(*performance_data.output_row_count);
+    }
+    const auto output_bytes =
+        output ? AllTypeVariant{static_cast<int64_t>(output->estimate_memory_usage())} : AllTypeVariant{NullValue{}};
+
+    table->append({pmr_string(depth * 2, ' ') + pmr_string{op->description(DescriptionMode::SingleLine)},
+                   static_cast<int64_t>(performance_data.walltime.count()),
+                   static_cast<int64_t>(performance_data.wait_time.count()),
+                   static_cast<int64_t>(performance_data.input_row_count), output_rows,
+                   static_cast<int64_t>(performance_data.input_chunk_count),
+                   static_cast<int64_t>(performance_data.pruned_chunk_count),
+                   static_cast<int64_t>(performance_data.output_chunk_count), output_bytes,
+                   pmr_string{performance_data.to_string(DescriptionMode::SingleLine)}});
+
+    if (op->input_left()) self(self, op->input_left(), depth + 1);
+    if (op->input_right()) self(self, op->input_right(), depth + 1);
+  };
+  append_operator(append_operator, root, 0);
+
+  return table;
+}
+
+std::optional<HardwareCounterValues> sum_hardware_counters(const std::shared_ptr<const AbstractOperator>& root) {
+  auto hardware_counters = std::optional<HardwareCounterValues>{};
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+
+  const auto visit_operator = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+    if (!visited_operators.emplace(op).second) return;
+
+    if (const auto& operator_counters = op->performance_data().hardware_counters) {
+      if (!hardware_counters) hardware_counters.emplace();
+      *hardware_counters += *operator_counters;
+    }
+
+    if (op->input_left()) self(self, op->input_left());
+    if (op->input_right()) self(self, op->input_right());
+  };
+  visit_operator(visit_operator, root);
+
+  return hardware_counters;
 }
 
 }  // namespace opossum
@@ -1,12 +1,18 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
+class AbstractOperator;
+class Table;
+
 // For an example on how this can be extended on a per-operator basis, see JoinIndex
 
 struct OperatorPerformanceData : public Noncopyable {
@@ -14,7 +20,39 @@ struct OperatorPerformanceData : public Noncopyable {
 
   std::chrono::nanoseconds walltime{0};
 
+  // Time the operator spent in CurrentScheduler::wait_for_tasks(), usually waiting for its own jobs. Tasks that the
+  // waiting worker executes in the meantime are included.
+  std::chrono::nanoseconds wait_time{0};
+
+  // Number of rows in the output. Unlike the output itself, it is kept after the operator's output is cleared and
+  // allows comparing the actual cardinality with the estimated one, e.g., for adaptive re-optimization. Only set for
+  // the last operator of a fused pipeline (see AbstractChunkwiseOperator::execute_pipeline()).
+  std::optional<uint64_t> output_row_count;
+
+  // Number of rows and chunks of both inputs and of the output, set by AbstractOperator::execute()
+  uint64_t input_row_count{0};
+  uint64_t input_chunk_count{0};
+  uint64_t output_chunk_count{0};
+
+  // Number of chunks that were skipped without being processed, e.g., by GetTable
+  uint64_t pruned_chunk_count{0};
+
+  // Hardware events counted by the thread that executed the operator, only set if HardwareCounters are enabled. Like
+  // the wait time, this includes tasks that the thread executed while waiting, but not the operator's jobs that other
+  // workers executed.
+  std::optional<HardwareCounterValues> hardware_counters;
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
+/**
+ * Creates a table with one row per operator of an executed PQP, e.g., for EXPLAIN ANALYZE. The operators are listed
+ * depth-first, starting with the root, and their descriptions are indented by their depth. Operators that are the
+ * input of multiple operators are listed once.
+ */
+std::shared_ptr<Table> create_operator_performance_table(const std::shared_ptr<const AbstractOperator>& root);
+
+// Sums up the hardware counters of the operators of an executed PQP. Returns std::nullopt if none of them has counters.
+std::optional<HardwareCounterValues> sum_hardware_counters(const std::shared_ptr<const AbstractOperator>& root);
+
 }  // namespace opossum
@@ -14,6 +14,7 @@
 #include "storage/base_value_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "type_cast.hpp"
+#include "utils/logical_data_types.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
@@ -102,15 +103,16 @@ std::shared_ptr<const Table> Print::_on_execute() {
         // well yes, we use BaseSegment::operator[] here, but since Print is not an operation that should
         // be part of a regular query plan, let's keep things simple here
         auto column_width = widths[column_id];
-        auto cell = _truncate_cell((*chunk->get_segment(column_id))[chunk_offset], column_width);
+        auto cell = _truncate_cell((*chunk->get_segment(column_id))[chunk_offset],
+                                   input_table_left()->column_data_type(column_id), column_width);
         _out << std::setw(column_width) << cell << "|" << std::setw(0);
       }
 
       if (_flags & PrintMvcc && chunk->has_mvcc_data()) {
         auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-        auto begin = mvcc_data->begin_cids[chunk_offset];
-        auto end = mvcc_data->end_cids[chunk_offset];
+        auto begin = mvcc_data->get_begin_cid(chunk_offset);
+        auto end = mvcc_data->get_end_cid(chunk_offset);
         auto tid = mvcc_data->tids[chunk_offset];
 
         auto begin_string = begin == MvccData::MAX_COMMIT_ID ? "" : std::to_string(begin);
@@ -145,8 +147,11 @@ std::vector<uint16_t> Print::_column_string_widths(uint16_t min, uint16_t max,
     auto chunk = input_table_left()->get_chunk(chunk_id);
 
     for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto data_type = table->column_data_type(column_id);
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
-        auto cell_length = static_cast<uint16_t>(to_string((*chunk->get_segment(column_id))[chunk_offset]).size());
+        const auto cell = (*chunk->get_segment(column_id))[chunk_offset];
+        const auto cell_string = is_logical_data_type(data_type) ? value_to_string(data_type, cell) : to_string(cell);
+        auto cell_length = static_cast<uint16_t>(cell_string.size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
@@ -154,9 +159,10 @@ std::vector<uint16_t> Print::_column_string_widths(uint16_t min, uint16_t max,
   return widths;
 }
 
-std::string Print::_truncate_cell(const AllTypeVariant& cell, uint16_t max_width) const {
-  // Use lexical_cast instead of type_cast here so that floats get truncated
-  auto cell_string = boost::lexical_cast<std::string>(cell);
+std::string Print::_truncate_cell(const AllTypeVariant& cell, const DataType data_type, uint16_t max_width) const {
+  // Uses lexical_cast instead of type_cast here so that floats get truncated, and formats Dates, Timestamps, and
+  // Decimals
+  auto cell_string = value_to_string(data_type, cell);
   DebugAssert(max_width > 3, "Cannot truncate string with '...' at end with max_width <= 3");
   if (cell_string.length() > max_width) {
     return cell_string.substr(0, max_width - 3) + "...";
@@ -198,6 +204,18 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) co
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::FrontCodedDictionary: {
+        segment_type += "FCD";
+        break;
+      }
+      case EncodingType::Delta: {
+        segment_type += "Dlt";
+        break;
+      }
+      case EncodingType::GlobalDictionary: {
+        segment_type += "GDic";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
@@ -217,6 +235,10 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) co
           segment_type += ":BP";
           break;
         }
+        case CompressedVectorType::BitPacking: {
+          segment_type += ":Bit";
+          break;
+        }
       }
     }
   } else {
@@ -26,7 +26,7 @@ class Print : public AbstractReadOnlyOperator {
  protected:
   std::vector<uint16_t> _column_string_widths(uint16_t min, uint16_t max,
                                               const std::shared_ptr<const Table>& table) const;
-  std::string _truncate_cell(const AllTypeVariant& cell, uint16_t max_width) const;
+  std::string _truncate_cell(const AllTypeVariant& cell, const DataType data_type, uint16_t max_width) const;
   std::string _segment_type(const std::shared_ptr<BaseSegment>& segment) const;
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -6,6 +6,9 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -30,17 +33,33 @@ std::shared_ptr<const Table> Product::_on_execute() {
 
   auto output = std::make_shared<Table>(column_definitions, TableType::References);
 
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-      _add_product_of_two_chunks(output, chunk_id_left, chunk_id_right);
+  // One job per pair of input chunks. The output chunks are appended in the order of the pairs.
+  const auto chunk_count_left = input_table_left()->chunk_count();
+  const auto chunk_count_right = input_table_right()->chunk_count();
+  auto output_segments = std::vector<Segments>(static_cast<size_t>(chunk_count_left) * chunk_count_right);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(output_segments.size());
+
+  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left, chunk_id_right]() {
+        output_segments[static_cast<size_t>(chunk_id_left) * chunk_count_right + chunk_id_right] =
+            _product_of_two_chunks(chunk_id_left, chunk_id_right);
+      }));
+      jobs.back()->schedule();
     }
   }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& segments : output_segments) {
+    output->append_chunk(segments);
+  }
 
   return output;
 }
 
-void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, ChunkID chunk_id_left,
-                                         ChunkID chunk_id_right) {
+Segments Product::_product_of_two_chunks(ChunkID chunk_id_left, ChunkID chunk_id_right) const {
   const auto chunk_left = input_table_left()->get_chunk(chunk_id_left);
   const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
 
@@ -105,7 +124,7 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
     is_left_side = false;
   }
 
-  output->append_chunk(output_segments);
+  return output_segments;
 }
 std::shared_ptr<AbstractOperator> Product::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -23,7 +23,8 @@ class Product : public AbstractReadOnlyOperator {
   const std::string name() const override;
 
  protected:
-  void _add_product_of_two_chunks(const std::shared_ptr<Table>& output, ChunkID chunk_id_left, ChunkID chunk_id_right);
+  // Returns the segments of the output chunk for a pair of input chunks. Called concurrently for different pairs.
+  Segments _product_of_two_chunks(ChunkID chunk_id_left, ChunkID chunk_id_right) const;
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -12,20 +12,23 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "storage/base_value_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 Projection::Projection(const std::shared_ptr<const AbstractOperator>& in,
                        const std::vector<std::shared_ptr<AbstractExpression>>& expressions)
-    : AbstractReadOnlyOperator(OperatorType::Projection, in), expressions(expressions) {}
+    : AbstractChunkwiseOperator(OperatorType::Projection, in), expressions(expressions) {}
 
 const std::string Projection::name() const { return "Projection"; }
 
 std::shared_ptr<AbstractOperator> Projection::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Projection>(copied_input_left, expressions_deep_copy(expressions));
+  auto copy = std::make_shared<Projection>(copied_input_left, expressions_deep_copy(expressions));
+  copy->set_row_count_hint(_row_count_hint);
+  return copy;
 }
 
 void Projection::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
@@ -36,71 +39,99 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
   expressions_set_transaction_context(expressions, transaction_context);
 }
 
-std::shared_ptr<const Table> Projection::_on_execute() {
-  /**
-   * If an expression is a PQPColumnExpression then it might be possible to forward the input column, if the
-   * input TableType (References or Data) matches the output column type.
-   */
-  const auto only_projects_columns = std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
-    return expression->type == ExpressionType::PQPColumn;
-  });
+bool Projection::_only_projects_columns() const {
+  return std::all_of(expressions.begin(), expressions.end(),
+                     [&](const auto& expression) { return expression->type == ExpressionType::PQPColumn; });
+}
 
-  const auto output_table_type = only_projects_columns ? input_table_left()->type() : TableType::Data;
-  const auto forward_columns = input_table_left()->type() == output_table_type;
+void Projection::_on_prepare_chunks(const std::shared_ptr<TransactionContext>& transaction_context) {
+  _uncorrelated_subquery_results = ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
 
-  const auto uncorrelated_subquery_results =
-      ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
+  _compiled_expressions.clear();
+  auto evaluated_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& expression : expressions) {
+    _compiled_expressions.emplace_back(CompiledExpression::compile(*expression));
+    if (!_compiled_expressions.back()) evaluated_expressions.emplace_back(expression);
+  }
 
-  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  // Subexpressions that the ExpressionEvaluator would compute multiple times per chunk, e.g., `a + b` in
+  // `CASE WHEN a + b > 0 THEN a + b ELSE 0 END`. CompiledExpressions do not share intermediate results.
+  const auto common_subexpressions = expressions_find_common_subexpressions(evaluated_expressions);
+  _common_subexpressions.reset();
+  if (!common_subexpressions.empty()) {
+    _common_subexpressions =
+        std::make_shared<ExpressionUnorderedSet>(common_subexpressions.begin(), common_subexpressions.end());
+  }
+}
 
+std::shared_ptr<Chunk> Projection::_on_execute_chunk(const std::shared_ptr<const Table>& in_table,
+                                                     const ChunkID chunk_id,
+                                                     const std::shared_ptr<TransactionContext>& transaction_context) {
   /**
-   * Perform the projection
+   * If an expression is a PQPColumnExpression then it might be possible to forward the input column, if the
+   * input TableType (References or Data) matches the output column type.
    */
-  auto output_chunk_segments = std::vector<Segments>(input_table_left()->chunk_count());
-
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
-
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
-
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_subquery_results);
-    for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
-      const auto& expression = expressions[column_id];
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table_left()->column_is_nullable(pqp_column_expression->column_id);
-      } else {
-        const auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        output_segments.emplace_back(output_segment);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-      }
+  const auto output_table_type = _only_projects_columns() ? in_table->type() : TableType::Data;
+  const auto forward_columns = in_table->type() == output_table_type;
+
+  Segments output_segments;
+  output_segments.reserve(expressions.size());
+
+  const auto input_chunk = in_table->get_chunk(chunk_id);
+
+  ExpressionEvaluator evaluator(in_table, chunk_id, _uncorrelated_subquery_results, _common_subexpressions);
+  for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+    const auto& expression = expressions[expression_idx];
+
+    // Forward input column if possible
+    if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+      const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+      output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+    } else if (_compiled_expressions[expression_idx]) {
+      output_segments.emplace_back(_compiled_expressions[expression_idx]->evaluate_to_segment(*in_table, chunk_id));
+    } else {
+      output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
     }
-
-    output_chunk_segments[chunk_id] = std::move(output_segments);
   }
 
+  const auto mvcc_data = in_table->has_mvcc() == UseMvcc::Yes ? input_chunk->mvcc_data() : nullptr;
+  return std::make_shared<Chunk>(output_segments, mvcc_data);
+}
+
+std::shared_ptr<Table> Projection::_create_output_table(
+    const Table& in_table, const std::vector<std::shared_ptr<Chunk>>& output_chunks) const {
+  const auto output_table_type = _only_projects_columns() ? in_table.type() : TableType::Data;
+  const auto forward_columns = in_table.type() == output_table_type;
+
   /**
-   * Determine the TableColumnDefinitions and build the output table
+   * Determine the TableColumnDefinitions. A forwarded column is nullable if the input column is, an evaluated column
+   * if any of its segments is.
    */
   TableColumnDefinitions column_definitions;
   for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
-    column_definitions.emplace_back(expressions[column_id]->as_column_name(), expressions[column_id]->data_type(),
-                                    column_is_nullable[column_id]);
-  }
-
-  const auto output_table =
-      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table_left()->has_mvcc());
+    const auto& expression = expressions[column_id];
+
+    auto nullable = false;
+    if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+      const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+      nullable = in_table.column_is_nullable(pqp_column_expression->column_id);
+    } else {
+      // Evaluated columns are always ValueSegments
+      nullable = std::any_of(output_chunks.begin(), output_chunks.end(), [&](const auto& output_chunk) {
+        return std::static_pointer_cast<const BaseValueSegment>(output_chunk->get_segment(column_id))->is_nullable();
+      });
+    }
 
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    output_table->append_chunk(output_chunk_segments[chunk_id]);
-    output_table->get_chunk(chunk_id)->set_mvcc_data(input_table_left()->get_chunk(chunk_id)->mvcc_data());
+    column_definitions.emplace_back(expression->as_column_name(), expression->data_type(), nullable);
   }
 
-  return output_table;
+  return std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, in_table.has_mvcc());
+}
+
+void Projection::_on_cleanup() {
+  _uncorrelated_subquery_results.reset();
+  _common_subexpressions.reset();
+  _compiled_expressions.clear();
 }
 
 // returns the singleton dummy table used for literal projections
@@ -10,15 +10,17 @@
 #include <utility>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/compiled_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
 
 namespace opossum {
 
 /**
  * Operator to evaluate Expressions (except for AggregateExpressions)
  */
-class Projection : public AbstractReadOnlyOperator {
+class Projection : public AbstractChunkwiseOperator {
  public:
   Projection(const std::shared_ptr<const AbstractOperator>& in,
              const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
@@ -46,13 +48,33 @@ class Projection : public AbstractReadOnlyOperator {
   const std::vector<std::shared_ptr<AbstractExpression>> expressions;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  void _on_prepare_chunks(const std::shared_ptr<TransactionContext>& transaction_context) override;
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) override;
+  std::shared_ptr<Table> _create_output_table(const Table& in_table,
+                                              const std::vector<std::shared_ptr<Chunk>>& output_chunks) const override;
+  void _on_cleanup() override;
+
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+  // Whether all expressions are PQPColumnExpressions, in which case the output has the TableType of the input
+  bool _only_projects_columns() const;
+
+  // Results of the uncorrelated subqueries, evaluated once before the first chunk is processed
+  std::shared_ptr<ExpressionEvaluator::UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+
+  // Subexpressions occurring multiple times in the expressions that are not compiled. The ExpressionEvaluator of each
+  // chunk evaluates each of them only once. nullptr if there are none.
+  std::shared_ptr<const ExpressionUnorderedSet> _common_subexpressions;
+
+  // For each expression, its CompiledExpression or nullptr if it is evaluated by the ExpressionEvaluator. Compiled
+  // before the first chunk is processed.
+  std::vector<std::shared_ptr<const CompiledExpression>> _compiled_expressions;
 };
 
 }  // namespace opossum
@@ -1,12 +1,26 @@
 #include "sort.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <queue>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "memory/memory_budget.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/materialize_sorted_rows.hpp"
+#include "sort/normalized_sort_key.hpp"
+#include "sort/parallel_sort.hpp"
+#include "spill/spill_file.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
@@ -16,238 +30,379 @@ namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
            const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{SortColumnDefinition{column_id, order_by_mode}}, output_chunk_size) {}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
     : AbstractReadOnlyOperator(OperatorType::Sort, in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Expected at least one column to sort by");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
-ColumnID Sort::column_id() const { return _column_id; }
+ColumnID Sort::column_id() const { return _sort_definitions.front().column; }
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+OrderByMode Sort::order_by_mode() const { return _sort_definitions.front().order_by_mode; }
 
 const std::string Sort::name() const { return "Sort"; }
 
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _column_id, _order_by_mode, _output_chunk_size);
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
-  return _impl->_on_execute();
+namespace {
+
+// Consecutive chunks are combined into runs of at least this many rows, which are sorted independently
+constexpr auto SORT_RUN_MIN_SIZE = size_t{1} << 16;
+
+// Returns the ranges [begin, end) of chunks that form the runs
+std::vector<std::pair<ChunkID, ChunkID>> split_into_runs(const Table& table,
+                                                         const size_t run_min_size = SORT_RUN_MIN_SIZE) {
+  auto runs = std::vector<std::pair<ChunkID, ChunkID>>{};
+
+  auto run_begin = ChunkID{0};
+  auto run_size = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    run_size += table.get_chunk(chunk_id)->size();
+    if (run_size >= run_min_size || chunk_id + 1 == table.chunk_count()) {
+      runs.emplace_back(run_begin, ChunkID{chunk_id + 1});
+      run_begin = ChunkID{chunk_id + 1};
+      run_size = 0;
+    }
+  }
+
+  return runs;
 }
 
-void Sort::_on_cleanup() { _impl.reset(); }
+}  // namespace
 
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
+// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
 template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
+class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
  public:
-  // creates a new table with reference segments
-  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
-                            const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+  using RowIDValuePair = std::pair<RowID, SortColumnType>;
 
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+  SortImpl(const Sort& sort, const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
+           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0,
+           const std::shared_ptr<MemoryBudget>& memory_budget = nullptr)
+      : _sort(sort),
+        _table_in(table_in),
+        _column_id(column_id),
+        _order_by_mode(order_by_mode),
+        _output_chunk_size(output_chunk_size),
+        _memory_budget(memory_budget) {}
 
-    // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    const auto descending =
+        _order_by_mode == OrderByMode::Descending || _order_by_mode == OrderByMode::DescendingNullsLast;
 
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input segment with a reference
-    // to the output segment. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
+    const auto nulls_last =
+        _order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast;
 
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+    auto row_ids = std::vector<RowID>{};
+    row_ids.reserve(_table_in->row_count());
 
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
+    // The NULL rows are kept in the order of the input
+    const auto append_null_rows = [&](const std::vector<std::vector<RowID>>& null_rows_per_run) {
+      for (const auto& null_rows : null_rows_per_run) {
+        row_ids.insert(row_ids.end(), null_rows.begin(), null_rows.end());
+      }
+    };
 
-    // Vector of segments for each chunk
-    std::vector<Segments> output_segments_by_chunk(chunk_count_out);
+    // The materialized runs and their merge take about twice the size of the sort column. If this exceeds the memory
+    // budget of the query, the runs are sorted one at a time and spilled to disk.
+    auto reservation = std::optional<MemoryReservation>{};
+    if (_memory_budget) {
+      reservation = _memory_budget->try_reserve(_table_in->row_count() * sizeof(RowIDValuePair) * 2);
+    }
 
-    // Materialize segment-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_data_type(column_id);
+    if (!_memory_budget || reservation) {
+      // 1. Materialize the sort column, sort the runs, and merge them
+      const auto run_ranges = split_into_runs(*_table_in);
+      auto null_rows_per_run = std::vector<std::vector<RowID>>(run_ranges.size());
+      auto sorted_rows = _sort_runs_in_memory(run_ranges, null_rows_per_run, descending);
 
-      resolve_data_type(column_data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
+      // 2. Insert the NULL rows
+      if (!nulls_last) append_null_rows(null_rows_per_run);
+      for (const auto& [row_id, value] : sorted_rows) {
+        row_ids.emplace_back(row_id);
+      }
+      sorted_rows = {};
+      if (nulls_last) append_null_rows(null_rows_per_run);
+    } else {
+      // 1. Sort runs that fit into the remaining budget and write them to disk
+      const auto run_min_size = std::max(_memory_budget->available_bytes() / sizeof(RowIDValuePair), size_t{1});
+      const auto run_ranges = split_into_runs(*_table_in, run_min_size);
+      auto null_rows_per_run = std::vector<std::vector<RowID>>(run_ranges.size());
+      auto spilled_runs = _spill_sorted_runs(run_ranges, null_rows_per_run, descending);
+
+      // 2. Merge the runs from disk and insert the NULL rows
+      if (!nulls_last) append_null_rows(null_rows_per_run);
+      _merge_spilled_runs(spilled_runs, descending, row_ids);
+      if (nulls_last) append_null_rows(null_rows_per_run);
+    }
 
-        auto chunk_it = output_segments_by_chunk.begin();
-        auto chunk_offset_out = 0u;
+    // 3. Materialization of the result: We take the sorted RowIDs, create chunks fill them until they are full and
+    // create the next one. Each chunk is filled row by row.
+    auto output = materialize_sorted_rows(_table_in, row_ids, _output_chunk_size);
+    for (auto& chunk : output->chunks()) {
+      chunk->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
+    }
 
-        auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-        auto value_segment_null_vector = pmr_concurrent_vector<bool>();
+    return output;
+  }
 
-        value_segment_value_vector.reserve(row_count_out);
-        value_segment_null_vector.reserve(row_count_out);
+  // Materializes the sort column and sorts the runs, each run in its own JobTask, and merges them
+  std::vector<RowIDValuePair> _sort_runs_in_memory(const std::vector<std::pair<ChunkID, ChunkID>>& run_ranges,
+                                                   std::vector<std::vector<RowID>>& null_rows_per_run,
+                                                   const bool descending) {
+    auto runs = std::vector<std::vector<RowIDValuePair>>(run_ranges.size());
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(run_ranges.size());
+
+    for (auto run_idx = size_t{0}; run_idx < run_ranges.size(); ++run_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, run_idx]() {
+        _materialize_sort_column(run_ranges[run_idx], runs[run_idx], null_rows_per_run[run_idx]);
+        _sort_run(runs[run_idx], descending);
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
 
-        auto segment_ptr_and_accessor_by_chunk_id =
-            std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
-                                                  std::shared_ptr<BaseSegmentAccessor<ColumnDataType>>>>();
-        segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
+    if (descending) {
+      return merge_sorted_runs(std::move(runs), [](const RowIDValuePair& lhs, const RowIDValuePair& rhs) {
+        return lhs.second > rhs.second;
+      });
+    }
+    return merge_sorted_runs(std::move(runs), [](const RowIDValuePair& lhs, const RowIDValuePair& rhs) {
+      return lhs.second < rhs.second;
+    });
+  }
 
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;  // NOLINT
+  // Sorts the runs one after another, so that only one of them is in memory at a time, and writes them to disk
+  std::vector<std::unique_ptr<SpillFile>> _spill_sorted_runs(
+      const std::vector<std::pair<ChunkID, ChunkID>>& run_ranges, std::vector<std::vector<RowID>>& null_rows_per_run,
+      const bool descending) {
+    auto spilled_runs = std::vector<std::unique_ptr<SpillFile>>{};
+    spilled_runs.reserve(run_ranges.size());
+
+    for (auto run_idx = size_t{0}; run_idx < run_ranges.size(); ++run_idx) {
+      auto run = std::vector<RowIDValuePair>{};
+      _materialize_sort_column(run_ranges[run_idx], run, null_rows_per_run[run_idx]);
+      _sort_run(run, descending);
+
+      auto spill_file = std::make_unique<SpillFile>();
+      for (const auto& [row_id, value] : run) {
+        spill_file->write_value(row_id);
+        spill_file->write_value(value);
+      }
+      spill_file->rewind();
+      spilled_runs.emplace_back(std::move(spill_file));
+    }
 
-          auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
-          auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
-          auto& accessor = segment_ptr_and_typed_ptr_pair.second;
+    return spilled_runs;
+  }
 
-          if (!base_segment) {
-            base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
-            accessor = create_segment_accessor<ColumnDataType>(base_segment);
-          }
+  // k-way merge of the spilled runs, which reads one row of each run at a time. Equal values keep the order of their
+  // runs.
+  void _merge_spilled_runs(std::vector<std::unique_ptr<SpillFile>>& spilled_runs, const bool descending,
+                           std::vector<RowID>& row_ids) {
+    auto heads = std::vector<RowIDValuePair>(spilled_runs.size());
+    const auto read_head = [&](const size_t run_idx) {
+      auto& head = heads[run_idx];
+      return spilled_runs[run_idx]->read_value(head.first) && spilled_runs[run_idx]->read_value(head.second);
+    };
+
+    // std::priority_queue returns the largest element first, so the comparator returns whether lhs comes after rhs
+    const auto comes_after = [&](const size_t lhs, const size_t rhs) {
+      const auto& lhs_value = heads[lhs].second;
+      const auto& rhs_value = heads[rhs].second;
+      if (descending) return lhs_value < rhs_value || (!(rhs_value < lhs_value) && lhs > rhs);
+      return rhs_value < lhs_value || (!(lhs_value < rhs_value) && lhs > rhs);
+    };
+    auto queue = std::priority_queue<size_t, std::vector<size_t>, decltype(comes_after)>{comes_after};
+
+    for (auto run_idx = size_t{0}; run_idx < spilled_runs.size(); ++run_idx) {
+      if (read_head(run_idx)) queue.push(run_idx);
+    }
 
-          // If the input segment is not a ReferenceSegment, we can take a fast(er) path
-          if (accessor) {
-            const auto typed_value = accessor->access(chunk_offset);
-            const auto is_null = !typed_value.has_value();
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-            value_segment_null_vector.push_back(is_null);
-          } else {
-            const auto value = (*base_segment)[chunk_offset];
-            const auto is_null = variant_is_null(value);
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : type_cast_variant<ColumnDataType>(value));
-            value_segment_null_vector.push_back(is_null);
-          }
+    while (!queue.empty()) {
+      const auto run_idx = queue.top();
+      queue.pop();
 
-          ++chunk_offset_out;
-
-          // Check if value segment is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                                std::move(value_segment_null_vector));
-            chunk_it->push_back(value_segment);
-            value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-            value_segment_null_vector = pmr_concurrent_vector<bool>();
-            ++chunk_it;
-          }
-        }
+      row_ids.emplace_back(heads[run_idx].first);
+      if (read_head(run_idx)) queue.push(run_idx);
+    }
+  }
+
+  // completely materializes the sort column of the run's chunks to create a vector of RowID-Value pairs
+  void _materialize_sort_column(const std::pair<ChunkID, ChunkID>& run_range, std::vector<RowIDValuePair>& run,
+                                std::vector<RowID>& null_rows) {
+    auto run_size = size_t{0};
+    for (auto chunk_id = run_range.first; chunk_id < run_range.second; ++chunk_id) {
+      run_size += _table_in->get_chunk(chunk_id)->size();
+    }
+    run.reserve(run_size);
 
-        // Last segment has not been added
-        if (chunk_offset_out > 0u) {
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
+    for (auto chunk_id = run_range.first; chunk_id < run_range.second; ++chunk_id) {
+      // The remaining chunks are left out once the statement is cancelled, see CancellationToken
+      if (_sort.is_cancelled()) return;
+
+      const auto base_segment = _table_in->get_chunk(chunk_id)->get_segment(_column_id);
+
+      segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
+        if (position.is_null()) {
+          null_rows.emplace_back(RowID{chunk_id, position.chunk_offset()});
+        } else {
+          run.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
         }
       });
     }
+  }
 
-    for (auto& segments : output_segments_by_chunk) {
-      output->append_chunk(segments);
+  void _sort_run(std::vector<RowIDValuePair>& run, const bool descending) {
+    if constexpr (std::is_arithmetic_v<SortColumnType>) {
+      if (run.size() >= RADIX_SORT_MIN_SIZE) {
+        radix_sort(run, descending);
+        return;
+      }
     }
 
-    return output;
+    if (descending) {
+      std::stable_sort(run.begin(), run.end(),
+                       [](const RowIDValuePair& lhs, const RowIDValuePair& rhs) { return lhs.second > rhs.second; });
+    } else {
+      std::stable_sort(run.begin(), run.end(),
+                       [](const RowIDValuePair& lhs, const RowIDValuePair& rhs) { return lhs.second < rhs.second; });
+    }
   }
 
- protected:
+  const Sort& _sort;
   const std::shared_ptr<const Table> _table_in;
+
+  // column to sort by
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  // chunk size of the materialized output
   const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
+  const std::shared_ptr<MemoryBudget> _memory_budget;
 };
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
+// Sorts by multiple columns in a single pass. For every row, the values of all sort columns are written into one
+// fixed-width normalized key (see normalized_sort_key.hpp), so that comparing two rows is a single memcmp() regardless
+// of the column types.
+class Sort::SortImplMultiColumn : public AbstractReadOnlyOperatorImpl {
  public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
+  SortImplMultiColumn(const Sort& sort, const std::shared_ptr<const Table>& table_in,
+                      const std::vector<SortColumnDefinition>& sort_definitions, const size_t output_chunk_size)
+      : _sort(sort), _table_in(table_in), _sort_definitions(sort_definitions), _output_chunk_size(output_chunk_size) {}
 
  protected:
   std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
+    const auto row_count = _table_in->row_count();
 
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
-    } else {
-      _sort_with_operator<std::greater<>>();
-    }
+    // 1. Determine the layout of the normalized keys
+    const auto layout = create_normalized_sort_key_layout(*_table_in, _sort_definitions);
+    const auto key_width = layout.key_width;
 
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows->empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
-      }
-    }
+    // 2. Write the keys, each run in its own JobTask. The rows of a run have consecutive row indices.
+    const auto run_ranges = split_into_runs(*_table_in);
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    auto output = materialization->execute();
-    for (auto& chunk : output->chunks()) {
-      chunk->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
+    auto chunk_begins = std::vector<size_t>(_table_in->chunk_count() + 1);
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      chunk_begins[chunk_id + 1] = chunk_begins[chunk_id] + _table_in->get_chunk(chunk_id)->size();
     }
 
-    return output;
-  }
+    auto keys = std::vector<unsigned char>(row_count * key_width);
+    auto row_ids = std::vector<RowID>(row_count);
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+    // Ties are broken by the row index, which makes the sort stable
+    const auto compare_rows = [&](const size_t lhs, const size_t rhs) {
+      const auto comparison = std::memcmp(&keys[lhs * key_width], &keys[rhs * key_width], key_width);
+      return comparison < 0 || (comparison == 0 && lhs < rhs);
+    };
 
-    auto& null_value_rows = *_null_value_rows;
+    // 3. Sort the row indices of each run by their keys, then merge the runs
+    auto runs = std::vector<std::vector<size_t>>(run_ranges.size());
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto chunk = _table_in->get_chunk(chunk_id);
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(run_ranges.size());
 
-      auto base_segment = chunk->get_segment(_column_id);
+    for (auto run_idx = size_t{0}; run_idx < run_ranges.size(); ++run_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, run_idx]() {
+        const auto [run_begin_chunk, run_end_chunk] = run_ranges[run_idx];
 
-      segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
-        if (position.is_null()) {
-          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-        } else {
-          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+        for (auto chunk_id = run_begin_chunk; chunk_id < run_end_chunk; ++chunk_id) {
+          // The run is left unsorted once the statement is cancelled, see CancellationToken
+          if (_sort.is_cancelled()) return;
+
+          const auto chunk_begin = chunk_begins[chunk_id];
+          const auto chunk_size = _table_in->get_chunk(chunk_id)->size();
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            row_ids[chunk_begin + chunk_offset] = RowID{chunk_id, chunk_offset};
+          }
+
+          write_normalized_sort_keys(*_table_in, chunk_id, _sort_definitions, layout,
+                                     keys.data() + chunk_begin * key_width);
         }
-      });
+
+        auto& run = runs[run_idx];
+        run.resize(chunk_begins[run_end_chunk] - chunk_begins[run_begin_chunk]);
+        std::iota(run.begin(), run.end(), chunk_begins[run_begin_chunk]);
+        std::sort(run.begin(), run.end(), compare_rows);
+      }));
+      jobs.back()->schedule();
     }
-  }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    if (_sort.is_cancelled()) return materialize_sorted_rows(_table_in, {}, _output_chunk_size);
+
+    const auto permutation = merge_sorted_runs(std::move(runs), compare_rows);
+    keys = {};
 
-  template <typename Comparator>
-  void _sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+    auto sorted_row_ids = std::vector<RowID>{};
+    sorted_row_ids.reserve(row_count);
+    for (const auto row_idx : permutation) {
+      sorted_row_ids.emplace_back(row_ids[row_idx]);
+    }
+
+    // 4. Materialize the result
+    auto output = materialize_sorted_rows(_table_in, sorted_row_ids, _output_chunk_size);
+
+    // Chunks only store their primary order
+    const auto& primary_definition = _sort_definitions.front();
+    for (auto& chunk : output->chunks()) {
+      chunk->set_ordered_by(std::make_pair(primary_definition.column, primary_definition.order_by_mode));
+    }
+
+    return output;
   }
 
+  const Sort& _sort;
   const std::shared_ptr<const Table> _table_in;
-
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
-
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
 };
 
+std::shared_ptr<const Table> Sort::_on_execute() {
+  if (_sort_definitions.size() == 1) {
+    _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
+        input_table_left()->column_data_type(column_id()), *this, input_table_left(), column_id(), order_by_mode(),
+        _output_chunk_size, memory_budget());
+  } else {
+    _impl = std::make_unique<SortImplMultiColumn>(*this, input_table_left(), _sort_definitions, _output_chunk_size);
+  }
+  return _impl->_on_execute();
+}
+
+void Sort::_on_cleanup() { _impl.reset(); }
+
 }  // namespace opossum
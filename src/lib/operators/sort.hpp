@@ -14,10 +14,25 @@
 
 namespace opossum {
 
+struct SortColumnDefinition final {
+  explicit SortColumnDefinition(const ColumnID& init_column, const OrderByMode init_order_by_mode = OrderByMode::Ascending)
+      : column(init_column), order_by_mode(init_order_by_mode) {}
+
+  ColumnID column;
+  OrderByMode order_by_mode;
+};
+
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Operator to sort a table by one or more columns. This implements a stable sort, i.e., rows that share the same values
+ * will maintain their relative order.
+ *
+ * Sorting by a single column uses a typed comparison of the materialized values. When sorting by multiple columns, the
+ * values of all sort columns of a row are encoded into a single normalized key, which compares byte-wise (memcmp) in
+ * the order requested by the SortColumnDefinitions. This way, ORDER BY a, b, c is handled in one pass instead of
+ * one Sort per column.
+ *
+ * The input is split into runs of consecutive chunks, which are materialized and sorted in parallel (single integer and
+ * floating point columns by an LSD radix sort) and then merged in parallel (see sort/parallel_sort.hpp).
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -25,6 +40,13 @@ class Sort : public AbstractReadOnlyOperator {
   Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
 
+  // The first definition is the primary sort criterion
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  // Of the primary sort criterion
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
 
@@ -38,17 +60,14 @@ class Sort : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
+  // SortImpl is the common templated implementation of the single-column operator, SortImplMultiColumn sorts by
+  // normalized keys. Both use materialize_sorted_rows() to write the output.
   template <typename SortColumnType>
   class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
+  class SortImplMultiColumn;
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Creates a data table that contains the rows of @param input_table identified by @param row_ids, in the order of
+ * @param row_ids. All values are copied into ValueSegments.
+ */
+std::shared_ptr<Table> materialize_sorted_rows(const std::shared_ptr<const Table>& input_table,
+                                               const std::vector<RowID>& row_ids, const size_t output_chunk_size);
+
+}  // namespace opossum
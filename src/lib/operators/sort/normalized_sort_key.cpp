@@ -0,0 +1,131 @@
+#include "normalized_sort_key.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+bool is_nulls_last(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::AscendingNullsLast || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+// Writes an unsigned integer most significant byte first, so that byte-wise comparison equals numeric comparison
+template <typename T>
+void write_big_endian(unsigned char* destination, T value) {
+  for (auto byte_index = sizeof(T); byte_index > 0; --byte_index) {
+    destination[byte_index - 1] = static_cast<unsigned char>(value & T{0xFF});
+    value >>= 8;
+  }
+}
+
+/**
+ * Encodes a value so that memcmp() on the encoded bytes orders like operator< on the values:
+ *  - Signed integers have their sign bit flipped, so that negative values come first
+ *  - For floating point numbers, all bits of negative numbers are flipped and the sign bit of positive numbers is set
+ *  - Strings are padded with zeros to the length of the longest string of the column. Their length is appended so
+ *    that "a" still comes before "a\0".
+ */
+template <typename ColumnDataType>
+void write_normalized_value(unsigned char* destination, const ColumnDataType& value, const size_t width) {
+  if constexpr (std::is_integral_v<ColumnDataType>) {
+    using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+    constexpr auto sign_bit = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+    write_big_endian(destination, static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ sign_bit));
+  } else if constexpr (std::is_floating_point_v<ColumnDataType>) {
+    using BitsType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = BitsType{1} << (sizeof(BitsType) * 8 - 1);
+    auto bits = BitsType{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    write_big_endian(destination, static_cast<BitsType>((bits & sign_bit) ? ~bits : bits | sign_bit));
+  } else {
+    static_assert(std::is_same_v<ColumnDataType, pmr_string>, "Unexpected column data type");
+    std::memcpy(destination, value.data(), value.size());
+    write_big_endian(destination + width - sizeof(uint32_t), static_cast<uint32_t>(value.size()));
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+NormalizedSortKeyLayout create_normalized_sort_key_layout(const Table& table,
+                                                          const std::vector<SortColumnDefinition>& sort_definitions) {
+  auto layout = NormalizedSortKeyLayout{};
+
+  for (const auto& sort_definition : sort_definitions) {
+    auto value_width = size_t{0};
+
+    resolve_data_type(table.column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        auto max_string_length = size_t{0};
+        for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+          const auto& segment = *table.get_chunk(chunk_id)->get_segment(sort_definition.column);
+          segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+            if (!position.is_null()) max_string_length = std::max(max_string_length, position.value().size());
+          });
+        }
+        value_width = max_string_length + sizeof(uint32_t);
+      } else {
+        value_width = sizeof(ColumnDataType);
+      }
+    });
+
+    layout.value_widths.emplace_back(value_width);
+    layout.key_width += 1 + value_width;
+  }
+
+  return layout;
+}
+
+void write_normalized_sort_keys(const Table& table, const ChunkID chunk_id,
+                                const std::vector<SortColumnDefinition>& sort_definitions,
+                                const NormalizedSortKeyLayout& layout, unsigned char* keys) {
+  const auto chunk = table.get_chunk(chunk_id);
+
+  auto column_offset = size_t{0};
+  for (auto definition_idx = size_t{0}; definition_idx < sort_definitions.size(); ++definition_idx) {
+    const auto& sort_definition = sort_definitions[definition_idx];
+    const auto value_width = layout.value_widths[definition_idx];
+    const auto descending = is_descending(sort_definition.order_by_mode);
+    const auto nulls_last = is_nulls_last(sort_definition.order_by_mode);
+
+    const auto& segment = *chunk->get_segment(sort_definition.column);
+    resolve_data_type(table.column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        auto* key = keys + position.chunk_offset() * layout.key_width + column_offset;
+
+        // NULLs keep the zero-initialized value bytes, so they compare equal to each other
+        const auto is_null = position.is_null();
+        key[0] = is_null == nulls_last ? 1 : 0;
+        if (is_null) return;
+
+        write_normalized_value(key + 1, position.value(), value_width);
+        if (descending) {
+          for (auto byte_idx = size_t{1}; byte_idx <= value_width; ++byte_idx) {
+            key[byte_idx] = static_cast<unsigned char>(~key[byte_idx]);
+          }
+        }
+      });
+    });
+
+    column_offset += 1 + value_width;
+  }
+}
+
+}  // namespace opossum
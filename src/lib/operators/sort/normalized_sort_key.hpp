@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+#include "operators/sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A normalized sort key encodes the values of all sort columns of a row into a fixed-width byte string, so that
+ * comparing two keys using memcmp() orders the rows as requested by the SortColumnDefinitions. This avoids
+ * type-dispatched (or even variant-based) comparisons when sorting by multiple columns.
+ *
+ * Each sort column contributes one byte that orders NULLs according to the OrderByMode, followed by the normalized
+ * value, whose bytes are inverted for descending columns. See write_normalized_value() for the encoding of the values.
+ */
+struct NormalizedSortKeyLayout {
+  // Number of bytes of each sort column's normalized value (without the leading NULL byte)
+  std::vector<size_t> value_widths;
+  size_t key_width{0};
+};
+
+// For string columns, this scans the column for the longest string
+NormalizedSortKeyLayout create_normalized_sort_key_layout(const Table& table,
+                                                          const std::vector<SortColumnDefinition>& sort_definitions);
+
+// Writes the keys of all rows of the chunk to @param keys, which has to hold key_width zero-initialized bytes per row
+void write_normalized_sort_keys(const Table& table, const ChunkID chunk_id,
+                                const std::vector<SortColumnDefinition>& sort_definitions,
+                                const NormalizedSortKeyLayout& layout, unsigned char* keys);
+
+}  // namespace opossum
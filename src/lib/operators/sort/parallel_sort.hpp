@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Building blocks of the parallel Sort: The input is split into runs (e.g., the rows of a few chunks), which are
+ * sorted independently - arithmetic values by an LSD radix sort - and then merged in parallel. All of them are stable.
+ */
+
+// Runs that are smaller than this are sorted with std::stable_sort, for which the radix passes do not pay off
+constexpr auto RADIX_SORT_MIN_SIZE = size_t{1'024};
+
+// A merge of two runs is split into parts of at least this many elements, which are merged in parallel
+constexpr auto PARALLEL_MERGE_MIN_PART_SIZE = size_t{1} << 16;
+
+/**
+ * Maps an arithmetic value to an unsigned integer of the same width, so that the order of the integers is the order of
+ * the values. As in radix_cluster_sort.hpp, the radix is taken from the bits of the value. Here, the sign bit is
+ * flipped (for negative floating point values, all bits are), so that negative values come first.
+ */
+template <typename T>
+auto radix_sort_key(const T value) {
+  static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be radix sorted");
+  using Key = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+  static_assert(sizeof(T) == sizeof(Key), "Unexpected width of value");
+
+  constexpr auto sign_bit = Key{1} << (sizeof(Key) * 8 - 1);
+
+  if constexpr (std::is_floating_point_v<T>) {
+    // -0.0 and 0.0 compare equal, so they need to get the same key for the sort to be stable
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto key = Key{};
+    std::memcpy(&key, &normalized_value, sizeof(Key));
+    return (key & sign_bit) ? static_cast<Key>(~key) : static_cast<Key>(key | sign_bit);
+  } else {
+    return static_cast<Key>(static_cast<Key>(value) ^ sign_bit);
+  }
+}
+
+// Sorts the value-RowID pairs by their value using an LSD radix sort with 8 bit digits. Passes in which all values
+// share the digit are skipped.
+template <typename T>
+void radix_sort(std::vector<std::pair<RowID, T>>& values, const bool descending) {
+  using Key = decltype(radix_sort_key(T{}));
+  constexpr auto digit_count = sizeof(Key);
+  constexpr auto bucket_count = size_t{256};
+
+  const auto value_count = values.size();
+
+  // Descending order is ascending order of the inverted keys, which keeps the sort stable
+  auto keys = std::vector<Key>(value_count);
+  for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+    const auto key = radix_sort_key(values[value_idx].second);
+    keys[value_idx] = descending ? static_cast<Key>(~key) : key;
+  }
+
+  // The histograms do not depend on the order of the keys, so they are built for all digits in a single scan
+  auto histograms = std::vector<std::array<size_t, bucket_count>>(digit_count);
+  for (const auto key : keys) {
+    for (auto digit = size_t{0}; digit < digit_count; ++digit) {
+      ++histograms[digit][(key >> (digit * 8)) & 0xFF];
+    }
+  }
+
+  auto values_buffer = std::vector<std::pair<RowID, T>>(value_count);
+  auto keys_buffer = std::vector<Key>(value_count);
+
+  for (auto digit = size_t{0}; digit < digit_count; ++digit) {
+    const auto shift = digit * 8;
+    const auto& histogram = histograms[digit];
+    if (histogram[(keys.front() >> shift) & 0xFF] == value_count) continue;
+
+    auto bucket_offsets = std::array<size_t, bucket_count>{};
+    auto offset = size_t{0};
+    for (auto bucket = size_t{0}; bucket < bucket_count; ++bucket) {
+      bucket_offsets[bucket] = offset;
+      offset += histogram[bucket];
+    }
+
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      const auto target_idx = bucket_offsets[(keys[value_idx] >> shift) & 0xFF]++;
+      values_buffer[target_idx] = std::move(values[value_idx]);
+      keys_buffer[target_idx] = keys[value_idx];
+    }
+
+    std::swap(values, values_buffer);
+    std::swap(keys, keys_buffer);
+  }
+}
+
+/**
+ * Returns how many elements of @param left are among the first @param output_position elements of the stable merge of
+ * @param left and @param right. Merging the runs in parts that start at such positions yields the same result as
+ * merging them at once ("merge path").
+ */
+template <typename Element, typename Comparator>
+size_t merge_split_position(const std::vector<Element>& left, const std::vector<Element>& right,
+                            const size_t output_position, const Comparator& comparator) {
+  auto low = output_position > right.size() ? output_position - right.size() : size_t{0};
+  auto high = std::min(output_position, left.size());
+
+  // Find the smallest left_count for which the next left element comes after the last right element taken
+  while (low < high) {
+    const auto left_count = low + (high - low) / 2;
+    if (comparator(right[output_position - left_count - 1], left[left_count])) {
+      high = left_count;
+    } else {
+      low = left_count + 1;
+    }
+  }
+  return low;
+}
+
+/**
+ * Merges the sorted @param runs into a single sorted vector. Neighbouring runs are merged pairwise until one run is
+ * left. Each pairwise merge is split into parts that are merged by separate JobTasks. Equal elements keep the order of
+ * their runs.
+ */
+template <typename Element, typename Comparator>
+std::vector<Element> merge_sorted_runs(std::vector<std::vector<Element>> runs, const Comparator& comparator) {
+  if (runs.empty()) return {};
+
+  while (runs.size() > 1) {
+    auto merged_runs = std::vector<std::vector<Element>>((runs.size() + 1) / 2);
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+
+    for (auto merged_run_idx = size_t{0}; merged_run_idx < merged_runs.size(); ++merged_run_idx) {
+      const auto left_run_idx = merged_run_idx * 2;
+      if (left_run_idx + 1 == runs.size()) {
+        merged_runs[merged_run_idx] = std::move(runs[left_run_idx]);
+        continue;
+      }
+
+      const auto& left = runs[left_run_idx];
+      const auto& right = runs[left_run_idx + 1];
+      auto& merged_run = merged_runs[merged_run_idx];
+      merged_run.resize(left.size() + right.size());
+
+      const auto part_count = std::max(merged_run.size() / PARALLEL_MERGE_MIN_PART_SIZE, size_t{1});
+      for (auto part_idx = size_t{0}; part_idx < part_count; ++part_idx) {
+        const auto output_begin = merged_run.size() * part_idx / part_count;
+        const auto output_end = merged_run.size() * (part_idx + 1) / part_count;
+
+        jobs.emplace_back(std::make_shared<JobTask>([&, output_begin, output_end]() {
+          const auto left_begin = merge_split_position(left, right, output_begin, comparator);
+          const auto left_end = merge_split_position(left, right, output_end, comparator);
+
+          std::merge(left.begin() + left_begin, left.begin() + left_end, right.begin() + (output_begin - left_begin),
+                     right.begin() + (output_end - left_end), merged_run.begin() + output_begin, comparator);
+        }));
+        jobs.back()->schedule();
+      }
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+    runs = std::move(merged_runs);
+  }
+
+  return std::move(runs.front());
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include "spill_file.hpp"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SpillFile::SpillFile() {
+  static auto next_file_id = std::atomic<size_t>{0};
+
+  _path = filesystem::temp_directory_path() /
+          ("hyrise_spill_" + std::to_string(getpid()) + "_" + std::to_string(next_file_id++) + ".bin");
+  _stream.open(_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+  Assert(_stream.is_open(), "Could not create spill file " + _path.string());
+}
+
+SpillFile::~SpillFile() {
+  _stream.close();
+  auto error_code = std::error_code{};
+  filesystem::remove(_path, error_code);
+}
+
+const filesystem::path& SpillFile::path() const { return _path; }
+
+size_t SpillFile::size() const { return _size; }
+
+void SpillFile::write(const void* data, const size_t bytes) {
+  _stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+  Assert(_stream.good(), "Could not write to spill file " + _path.string());
+  _size += bytes;
+}
+
+void SpillFile::rewind() {
+  _stream.flush();
+  _stream.clear();
+  _stream.seekg(0);
+}
+
+bool SpillFile::read(void* data, const size_t bytes) {
+  if (bytes == 0) return _stream.good();
+  _stream.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+  return _stream.gcount() == static_cast<std::streamsize>(bytes);
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include "types.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file for intermediate results that do not fit into the MemoryBudget of a query. The file is created in
+ * the temporary directory of the system (which should be on a local SSD) and removed when the SpillFile is destroyed.
+ *
+ * Values are first written and, after rewind(), read back in the same order. Strings are prefixed with their length.
+ */
+class SpillFile : private Noncopyable {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  const filesystem::path& path() const;
+
+  // Number of bytes written to the file
+  size_t size() const;
+
+  void write(const void* data, const size_t bytes);
+
+  // Makes everything that was written available for reading, starting at the beginning of the file
+  void rewind();
+
+  // Returns false if the end of the file was reached
+  bool read(void* data, const size_t bytes);
+
+  template <typename T>
+  void write_value(const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto length = static_cast<uint32_t>(value.size());
+      write(&length, sizeof(length));
+      write(value.data(), length);
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values and strings can be spilled");
+      write(&value, sizeof(T));
+    }
+  }
+
+  template <typename T>
+  bool read_value(T& value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      auto length = uint32_t{0};
+      if (!read(&length, sizeof(length))) return false;
+      value.resize(length);
+      return read(value.data(), length);
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values and strings can be spilled");
+      return read(&value, sizeof(T));
+    }
+  }
+
+ private:
+  filesystem::path _path;
+  std::fstream _stream;
+  size_t _size{0};
+};
+
+}  // namespace opossum
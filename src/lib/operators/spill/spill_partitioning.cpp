@@ -0,0 +1,135 @@
+#include "spill_partitioning.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+// Limits the number of open files per spilling operator
+constexpr auto MAX_SPILL_PARTITION_COUNT = size_t{256};
+
+// RowIDs are buffered per partition and written in blocks of this many rows
+constexpr auto SPILL_WRITE_BUFFER_SIZE = size_t{4'096};
+
+}  // namespace
+
+namespace opossum {
+
+size_t spill_partition_count(const size_t required_bytes, const size_t available_bytes) {
+  auto partition_count = size_t{2};
+  while (partition_count < MAX_SPILL_PARTITION_COUNT && required_bytes / partition_count > available_bytes) {
+    partition_count *= 2;
+  }
+  return partition_count;
+}
+
+std::vector<std::unique_ptr<SpillFile>> spill_partitions(const Table& table, const std::vector<ColumnID>& column_ids,
+                                                         const size_t partition_count) {
+  auto partitions = std::vector<std::unique_ptr<SpillFile>>(partition_count);
+  for (auto& partition : partitions) {
+    partition = std::make_unique<SpillFile>();
+  }
+
+  auto buffers = std::vector<std::vector<RowID>>(partition_count);
+  const auto flush_buffer = [&](const size_t partition_idx) {
+    auto& buffer = buffers[partition_idx];
+    partitions[partition_idx]->write(buffer.data(), buffer.size() * sizeof(RowID));
+    buffer.clear();
+  };
+
+  auto hashes = std::vector<size_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    hashes.assign(chunk->size(), size_t{0});
+
+    for (const auto column_id : column_ids) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          // NULLs are hashed to the same value, so that they end up in the same partition
+          const auto value_hash = position.is_null() ? size_t{0} : std::hash<ColumnDataType>{}(position.value());
+          boost::hash_combine(hashes[position.chunk_offset()], value_hash);
+        });
+      });
+    }
+
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      // std::hash is the identity for integers, so the hash is mixed before some of its bits are used
+      const auto partition_idx = ((hashes[chunk_offset] * size_t{0x9E3779B97F4A7C15}) >> 32) & (partition_count - 1);
+      buffers[partition_idx].emplace_back(chunk_id, chunk_offset);
+      if (buffers[partition_idx].size() == SPILL_WRITE_BUFFER_SIZE) flush_buffer(partition_idx);
+    }
+  }
+
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    flush_buffer(partition_idx);
+    partitions[partition_idx]->rewind();
+  }
+
+  return partitions;
+}
+
+std::shared_ptr<Table> read_partition(const std::shared_ptr<const Table>& table, SpillFile& partition) {
+  auto row_ids = std::vector<RowID>(partition.size() / sizeof(RowID));
+  partition.read(row_ids.data(), row_ids.size() * sizeof(RowID));
+
+  auto output = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  // The RowIDs were written chunk by chunk, so the rows of a chunk are consecutive
+  auto chunk_begin = row_ids.begin();
+  while (chunk_begin != row_ids.end()) {
+    const auto chunk_id = chunk_begin->chunk_id;
+    const auto chunk_end = std::find_if(chunk_begin, row_ids.end(),
+                                        [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+    const auto in_chunk = table->get_chunk(chunk_id);
+
+    Segments output_segments;
+
+    // Segments that reference the same PosList in the input share their PosList in the output (see table_scan.hpp)
+    std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>> out_pos_list_map;
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      auto out_referenced_table = table;
+      auto out_column_id = column_id;
+      std::shared_ptr<const PosList> in_pos_list;
+
+      if (const auto reference_segment =
+              std::dynamic_pointer_cast<const ReferenceSegment>(in_chunk->get_segment(column_id))) {
+        out_referenced_table = reference_segment->referenced_table();
+        out_column_id = reference_segment->referenced_column_id();
+        in_pos_list = reference_segment->pos_list();
+      }
+
+      auto& pos_list_out = out_pos_list_map[in_pos_list];
+      if (!pos_list_out) {
+        pos_list_out = std::make_shared<PosList>();
+        pos_list_out->reserve(std::distance(chunk_begin, chunk_end));
+        for (auto row_id = chunk_begin; row_id != chunk_end; ++row_id) {
+          pos_list_out->emplace_back(in_pos_list ? (*in_pos_list)[row_id->chunk_offset] : *row_id);
+        }
+        if (!in_pos_list || in_pos_list->references_single_chunk()) pos_list_out->guarantee_single_chunk();
+      }
+
+      output_segments.push_back(std::make_shared<ReferenceSegment>(out_referenced_table, out_column_id, pos_list_out));
+    }
+
+    output->append_chunk(output_segments);
+    chunk_begin = chunk_end;
+  }
+
+  return output;
+}
+
+}  // namespace opossum
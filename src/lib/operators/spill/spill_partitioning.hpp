@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "spill_file.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Grace-hash style partitioning for operators that exceed the MemoryBudget of their query: The rows of the input are
+ * distributed by the hash of their values in some columns (e.g., the group-by columns) and their RowIDs are written to
+ * one SpillFile per partition. Rows with equal values end up in the same partition, so that the partitions can be
+ * processed one at a time.
+ */
+
+// Returns a power of two of partitions so that each of them is expected to require at most @param available_bytes
+size_t spill_partition_count(const size_t required_bytes, const size_t available_bytes);
+
+std::vector<std::unique_ptr<SpillFile>> spill_partitions(const Table& table, const std::vector<ColumnID>& column_ids,
+                                                         const size_t partition_count);
+
+// Reads the RowIDs of @param partition and returns a reference table with these rows of @param table, which has to be
+// the partitioned table. References of a reference table are resolved.
+std::shared_ptr<Table> read_partition(const std::shared_ptr<const Table>& table, SpillFile& partition);
+
+}  // namespace opossum
@@ -16,23 +16,31 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "memory/arena_memory_resource.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_buffer_manager.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
+#include "table_scan/column_in_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
+#include "table_scan/logical_expression_table_scan_impl.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -41,7 +49,7 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in}, _predicate(predicate) {}
+    : AbstractChunkwiseOperator{OperatorType::TableScan, in}, _predicate(predicate) {}
 
 void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
 
@@ -57,6 +65,7 @@ const std::string TableScan::description(DescriptionMode description_mode) const
   stream << name() << separator;
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
+  if (_pruned_chunk_count > 0) stream << separator << "Pruned chunks: " << _pruned_chunk_count;
 
   return stream.str();
 }
@@ -72,99 +81,251 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
+  auto copy = std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
+  copy->set_row_count_hint(_row_count_hint);
+  return copy;
 }
 
-std::shared_ptr<const Table> TableScan::_on_execute() {
-  const auto in_table = input_table_left();
+bool TableScan::is_pipelineable() const {
+  // Excluded chunks refer to the chunk ids of the input table, which are not known for morsels. Also, the impl is
+  // created for each morsel, which would evaluate uncorrelated subqueries in the ExpressionEvaluator over and over.
+  if (!_excluded_chunk_ids.empty()) return false;
+
+  auto has_subquery = false;
+  visit_expression(_predicate, [&](const auto& sub_expression) {
+    has_subquery |= sub_expression->type == ExpressionType::PQPSubquery;
+    return ExpressionVisitation::VisitArguments;
+  });
+  return !has_subquery;
+}
+
+void TableScan::_on_prepare_chunks(const std::shared_ptr<TransactionContext>& context) {
+  _resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  _statistics_predicate = _find_statistics_predicate(_resolved_predicate);
+  _excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
+
+  // The input has not been executed if the operator is part of a pipeline. Then, an impl is created for each morsel.
+  if (const auto in_table = input_table_left()) {
+    if (in_table->type() == TableType::Data) {
+      if (_statistics_predicate) {
+        const auto prunable_chunk_ids = _find_prunable_chunk_ids(*in_table, *_statistics_predicate);
+        _pruned_chunk_count = prunable_chunk_ids.size();
+        _excluded_chunk_set.insert(prunable_chunk_ids.cbegin(), prunable_chunk_ids.cend());
+      }
 
-  const auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+      // Start loading the evicted chunks that are scanned. Pruned chunks are not loaded, as their statistics are kept.
+      const auto chunk_count = in_table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        if (_excluded_chunk_set.count(chunk_id)) continue;
+        const auto chunk = in_table->get_chunk(chunk_id);
+        if (chunk) ChunkBufferManager::get().prefetch(chunk);
+      }
+    }
 
-  _impl = create_impl();
-  _impl_description = _impl->description();
+    _impl = _create_impl(in_table, _resolved_predicate);
+    _impl->set_arena(arena());
+    _impl_description = _impl->description();
+  }
+}
+
+std::shared_ptr<Chunk> TableScan::_on_execute_chunk(const std::shared_ptr<const Table>& in_table,
+                                                    const ChunkID chunk_id,
+                                                    const std::shared_ptr<TransactionContext>& context) {
+  const auto is_input_table = in_table == input_table_left();
+  if (is_input_table && _excluded_chunk_set.count(chunk_id)) return nullptr;
+
+  auto morsel_impl = std::unique_ptr<AbstractTableScanImpl>{};
+  if (!is_input_table) {
+    morsel_impl = _create_impl(in_table, _resolved_predicate);
+    morsel_impl->set_arena(arena());
+    std::call_once(_impl_description_flag, [&]() { _impl_description = morsel_impl->description(); });
+  }
+  const auto& impl = is_input_table ? *_impl : *morsel_impl;
+
+  const auto chunk_guard = in_table->get_chunk(chunk_id);
+
+  // Chunks of which all rows match are passed on without scanning them. Besides saving the scan, this lets a Delete of
+  // all rows of a chunk invalidate the chunk as a whole.
+  if (is_input_table && _all_rows_match(*in_table, chunk_id)) {
+    auto output_chunk = std::shared_ptr<Chunk>{};
+    if (in_table->type() == TableType::References) {
+      output_chunk = std::make_shared<Chunk>(chunk_guard->segments(), nullptr, chunk_guard->get_allocator());
+    } else {
+      const auto all_rows =
+          std::make_shared<PosList>(PosList::chunk_range(chunk_id, ChunkOffset{0}, chunk_guard->size()));
+      auto out_segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < in_table->column_count(); ++column_id) {
+        out_segments.push_back(std::make_shared<ReferenceSegment>(in_table, column_id, all_rows));
+      }
+      output_chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_guard->get_allocator());
+    }
+    if (chunk_guard->ordered_by()) output_chunk->set_ordered_by(*chunk_guard->ordered_by());
+    return output_chunk;
+  }
+
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(chunk_id);
+  if (matches_out->empty()) return nullptr;
+
+  Segments out_segments;
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+   * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between segments as much as possible. Position lists can be shared between two segments iff
+   * (a) they point to the same table and
+   * (b) the reference segments of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
 
-  std::mutex output_mutex;
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+    const auto arena = this->arena();
 
-  const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto segment_in = chunk_in->get_segment(column_id);
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+      auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+      DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
 
-  for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
+      const auto pos_list_in = ref_segment_in->pos_list();
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = in_table->get_chunk(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
+      const auto table_out = ref_segment_in->referenced_table();
+      const auto column_id_out = ref_segment_in->referenced_column_id();
 
-      Segments out_segments;
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        const auto chunk_in = in_table->get_chunk(chunk_id);
+      if (!filtered_pos_list) {
+        filtered_pos_list = make_shared_in_arena<PosList>(arena, matches_out->size());
+        if (pos_list_in->references_single_chunk()) {
+          filtered_pos_list->guarantee_single_chunk();
+        }
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+        size_t offset = 0;
+        for (const auto& match : *matches_out) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          (*filtered_pos_list)[offset] = row_id;
+          ++offset;
+        }
 
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
+        if (pos_list_in->references_single_chunk()) filtered_pos_list->shrink_to_compact_representation();
+      }
 
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  } else {
+    // Scans of data tables yield ascending positions into a single chunk, which can be stored as a range, a bitmap, or
+    // as ChunkOffsets instead of as RowIDs
+    matches_out->guarantee_single_chunk();
+    matches_out->shrink_to_compact_representation();
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
 
-          const auto pos_list_in = ref_segment_in->pos_list();
+  auto output_chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_guard->get_allocator());
 
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
+  // The matches keep the order of the input rows, so the output is sorted like the input chunk
+  if (chunk_guard->ordered_by()) output_chunk->set_ordered_by(*chunk_guard->ordered_by());
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+  return output_chunk;
+}
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
-            }
+std::shared_ptr<Table> TableScan::_create_output_table(const Table& in_table,
+                                                       const std::vector<std::shared_ptr<Chunk>>& output_chunks) const {
+  return std::make_shared<Table>(in_table.column_definitions(), TableType::References);
+}
 
-            size_t offset = 0;
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
-              ++offset;
-            }
-          }
+std::optional<TableScan::StatisticsPredicate> TableScan::_find_statistics_predicate(
+    const std::shared_ptr<AbstractExpression>& resolved_predicate) {
+  // Find the column, the condition, and the value(s) of the predicate. Only predicates with non-NULL values are
+  // considered, as in the ChunkPruningRule.
+  auto column_id = std::optional<ColumnID>{};
+  auto predicate_condition = PredicateCondition::Equals;
+  auto value = std::optional<AllTypeVariant>{};
+  auto value2 = std::optional<AllTypeVariant>{};
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
-        }
-      }
+  if (const auto binary_predicate_expression =
+          std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
+    predicate_condition = binary_predicate_expression->predicate_condition;
+    if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+      return std::nullopt;
+    }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_table->append_chunk(out_segments, chunk_guard->get_allocator());
-    });
+    const auto& left_operand = *binary_predicate_expression->left_operand();
+    const auto& right_operand = *binary_predicate_expression->right_operand();
 
-    jobs.push_back(job_task);
-    job_task->schedule();
+    if (left_operand.type == ExpressionType::PQPColumn) {
+      column_id = static_cast<const PQPColumnExpression&>(left_operand).column_id;
+      value = expression_get_value_or_parameter(right_operand);
+    } else if (right_operand.type == ExpressionType::PQPColumn) {
+      column_id = static_cast<const PQPColumnExpression&>(right_operand).column_id;
+      value = expression_get_value_or_parameter(left_operand);
+      predicate_condition = flip_predicate_condition(predicate_condition);
+    }
+  } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(resolved_predicate)) {
+    if (between_expression->value()->type == ExpressionType::PQPColumn) {
+      column_id = static_cast<const PQPColumnExpression&>(*between_expression->value()).column_id;
+      predicate_condition = PredicateCondition::Between;
+      value = expression_get_value_or_parameter(*between_expression->lower_bound());
+      value2 = expression_get_value_or_parameter(*between_expression->upper_bound());
+      if (!value2 || variant_is_null(*value2)) return std::nullopt;
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  if (!column_id || !value || variant_is_null(*value)) return std::nullopt;
 
-  return output_table;
+  return StatisticsPredicate{*column_id, predicate_condition, *value, value2};
+}
+
+std::vector<ChunkID> TableScan::_find_prunable_chunk_ids(const Table& in_table,
+                                                         const StatisticsPredicate& statistics_predicate) {
+  const auto& [column_id, predicate_condition, value, value2] = statistics_predicate;
+
+  auto prunable_chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = in_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = in_table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto statistics = chunk->statistics();
+    if (statistics && statistics->can_prune(column_id, predicate_condition, value, value2)) {
+      prunable_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  return prunable_chunk_ids;
+}
+
+bool TableScan::_all_rows_match(const Table& in_table, const ChunkID chunk_id) const {
+  if (!_statistics_predicate) return false;
+  const auto& [column_id, predicate_condition, value, value2] = *_statistics_predicate;
+
+  auto chunk = in_table.get_chunk(chunk_id);
+  auto statistics_column_id = column_id;
+  auto is_nullable = in_table.column_is_nullable(column_id);
+
+  if (in_table.type() == TableType::References) {
+    const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+    const auto& pos_list = *reference_segment.pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) return false;
+
+    const auto& referenced_table = *reference_segment.referenced_table();
+    chunk = referenced_table.get_chunk(pos_list.common_chunk_id());
+    statistics_column_id = reference_segment.referenced_column_id();
+    is_nullable = referenced_table.column_is_nullable(statistics_column_id);
+  }
+
+  // Rows appended to mutable chunks are not reflected in the statistics. NULLs never match, but are ignored by them.
+  if (!chunk || chunk->is_mutable() || is_nullable) return false;
+
+  const auto statistics = chunk->statistics();
+  return statistics && statistics->all_rows_match(statistics_column_id, predicate_condition, value, value2);
 }
 
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
@@ -202,6 +363,11 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
 }
 
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+  return _create_impl(input_table_left(), _resolve_uncorrelated_subqueries(_predicate));
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate) {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -209,8 +375,6 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    * an expression.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
-
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
     const auto predicate_condition = binary_predicate_expression->predicate_condition;
@@ -247,24 +411,23 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> LIKE <non-null value>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<ColumnLikeTableScanImpl>(input_table_left(), left_column_expression->column_id,
-                                                       predicate_condition,
+      return std::make_unique<ColumnLikeTableScanImpl>(in_table, left_column_expression->column_id, predicate_condition,
                                                        type_cast_variant<pmr_string>(*right_value));
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <non-null value>
     if (left_column_expression && right_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, left_column_expression->column_id,
                                                           predicate_condition, *right_value);
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(input_table_left(), right_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, right_column_expression->column_id,
                                                           flip_predicate_condition(predicate_condition), *left_value);
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnVsColumnTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsColumnTableScanImpl>(in_table, left_column_expression->column_id,
                                                            predicate_condition, right_column_expression->column_id);
     }
   }
@@ -273,7 +436,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<ColumnIsNullTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnIsNullTableScanImpl>(in_table, left_column_expression->column_id,
                                                          is_null_expression->predicate_condition);
     }
   }
@@ -287,15 +450,73 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> BETWEEN <value-of-type-x> AND <value-of-type-x>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<ColumnBetweenTableScanImpl>(input_table_left(), left_column->column_id,
+      return std::make_unique<ColumnBetweenTableScanImpl>(in_table, left_column->column_id,
                                                           *lower_bound_value, *upper_bound_value);
     }
   }
 
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(resolved_predicate)) {
+    const auto column = std::dynamic_pointer_cast<PQPColumnExpression>(in_expression->value());
+    const auto list = std::dynamic_pointer_cast<ListExpression>(in_expression->set());
+
+    // Predicate pattern: <column> [NOT] IN (<non-null value-of-column-type>, ...). NULLs never match, but they turn
+    // the result of NOT IN into NULL, so they can only be dropped from IN lists.
+    if (column && list) {
+      auto values = std::vector<AllTypeVariant>{};
+      values.reserve(list->elements().size());
+      auto supported = true;
+      for (const auto& element : list->elements()) {
+        const auto value = expression_get_value_or_parameter(*element);
+        if (!value) {
+          supported = false;
+        } else if (variant_is_null(*value)) {
+          supported &= !in_expression->is_negated();
+        } else {
+          supported &= data_type_from_all_type_variant(*value) == column->data_type();
+          values.emplace_back(*value);
+        }
+        if (!supported) break;
+      }
+
+      if (supported && !values.empty()) {
+        return std::make_unique<ColumnInTableScanImpl>(in_table, column->column_id,
+                                                       in_expression->predicate_condition, values);
+      }
+    }
+  }
+
+  if (const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(resolved_predicate)) {
+    // Predicate pattern: <predicate> AND/OR <predicate> [AND/OR ...], where each predicate has a dedicated impl. The
+    // matches of the predicates are combined as bitmaps, see LogicalExpressionTableScanImpl. Predicates with
+    // subqueries are left to the ExpressionEvaluator, so that the subqueries are not evaluated twice.
+    auto has_subquery = false;
+    visit_expression(resolved_predicate, [&](const auto& sub_expression) {
+      has_subquery |= sub_expression->type == ExpressionType::PQPSubquery;
+      return ExpressionVisitation::VisitArguments;
+    });
+
+    const auto logical_operator = logical_expression->logical_operator;
+    const auto operands = flatten_logical_expressions(resolved_predicate, logical_operator);
+    auto operand_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+    for (auto operand_idx = size_t{0}; !has_subquery && operand_idx < operands.size(); ++operand_idx) {
+      auto operand_impl = _create_impl(in_table, operands[operand_idx]);
+      if (dynamic_cast<const ExpressionEvaluatorTableScanImpl*>(operand_impl.get())) break;
+      operand_impls.emplace_back(std::move(operand_impl));
+    }
+
+    if (operand_impls.size() == operands.size()) {
+      return std::make_unique<LogicalExpressionTableScanImpl>(in_table, logical_operator, std::move(operand_impls));
+    }
+  }
+
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), resolved_predicate);
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, resolved_predicate);
 }
 
-void TableScan::_on_cleanup() { _impl.reset(); }
+void TableScan::_on_cleanup() {
+  _impl.reset();
+  _resolved_predicate.reset();
+  _statistics_predicate.reset();
+}
 
 }  // namespace opossum
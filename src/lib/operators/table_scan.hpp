@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
@@ -16,7 +18,7 @@ namespace opossum {
 
 class Table;
 
-class TableScan : public AbstractReadOnlyOperator {
+class TableScan : public AbstractChunkwiseOperator {
   friend class LQPTranslatorTest;
 
  public:
@@ -43,13 +45,21 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  bool is_pipelineable() const override;
+
   /**
    * Create the TableScanImpl based on the predicate type. Public for testing purposes.
    */
   std::unique_ptr<AbstractTableScanImpl> create_impl() const;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  void _on_prepare_chunks(const std::shared_ptr<TransactionContext>& context) override;
+
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& context) override;
+
+  std::shared_ptr<Table> _create_output_table(const Table& in_table,
+                                              const std::vector<std::shared_ptr<Chunk>>& output_chunks) const override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -65,15 +75,50 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  static std::unique_ptr<AbstractTableScanImpl> _create_impl(
+      const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate);
+
+  // The column, the condition, and the value(s) of a predicate that can be evaluated with ChunkStatistics
+  struct StatisticsPredicate {
+    ColumnID column_id;
+    PredicateCondition predicate_condition;
+    AllTypeVariant value;
+    std::optional<AllTypeVariant> value2;
+  };
+
+  // Returns std::nullopt if the predicate does not compare a column with non-NULL values
+  static std::optional<StatisticsPredicate> _find_statistics_predicate(
+      const std::shared_ptr<AbstractExpression>& resolved_predicate);
+
+  // Uses the ChunkStatistics of a data table to find the chunks that cannot contain matches. The ChunkPruningRule
+  // does this during optimization, but only for literals. Here, the values of parameters are known as well, so that
+  // cached plans with parameters (e.g., from prepared statements) are pruned, too.
+  static std::vector<ChunkID> _find_prunable_chunk_ids(const Table& in_table,
+                                                       const StatisticsPredicate& statistics_predicate);
+
+  // Returns true if the ChunkStatistics prove that all rows of the chunk of the input table match the predicate. For
+  // reference tables, the statistics of the single chunk that the rows belong to are used.
+  bool _all_rows_match(const Table& in_table, const ChunkID chunk_id) const;
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
+  // The predicate with its uncorrelated subqueries resolved, set in _on_prepare_chunks()
+  std::shared_ptr<AbstractExpression> _resolved_predicate;
+  std::optional<StatisticsPredicate> _statistics_predicate;
+
+  // The impl for the input table. If the TableScan is part of a pipeline, an impl is created for each morsel instead.
   std::unique_ptr<AbstractTableScanImpl> _impl;
 
   // The description of the impl, so that it still available after the _impl is resetted in _on_cleanup()
   std::string _impl_description{"Unset"};
+  std::once_flag _impl_description_flag;
 
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::unordered_set<ChunkID> _excluded_chunk_set;
+
+  // Number of chunks excluded by _find_prunable_chunk_ids(), shown in the description
+  size_t _pruned_chunk_count{0};
 };
 
 }  // namespace opossum
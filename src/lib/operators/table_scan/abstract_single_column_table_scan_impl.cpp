@@ -5,6 +5,9 @@
 #include <utility>
 
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/block_min_max_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
@@ -23,10 +26,19 @@ std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk(const Chu
   const auto& chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
 
-  auto matches = std::make_shared<PosList>();
+  auto matches = _create_pos_list();
 
   if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
     _scan_reference_segment(*reference_segment, chunk_id, *matches);
+  } else if (const auto position_filter = _block_position_filter(*segment, chunk_id, *chunk)) {
+    if (position_filter->empty()) return matches;
+
+    _scan_non_reference_segment(*segment, chunk_id, *matches, position_filter);
+
+    // As for ReferenceSegments, the matches are positions in `position_filter`
+    for (auto& match : *matches) {
+      match.chunk_offset = (*position_filter)[match.chunk_offset].chunk_offset;
+    }
   } else {
     _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
   }
@@ -34,6 +46,44 @@ std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk(const Chu
   return matches;
 }
 
+std::optional<AbstractSingleColumnTableScanImpl::BlockFilterPredicate>
+AbstractSingleColumnTableScanImpl::_block_filter_predicate(const BaseSegment& segment, const ChunkID chunk_id) const {
+  return std::nullopt;
+}
+
+std::shared_ptr<const PosList> AbstractSingleColumnTableScanImpl::_block_position_filter(const BaseSegment& segment,
+                                                                                         const ChunkID chunk_id,
+                                                                                         const Chunk& chunk) const {
+  const auto chunk_statistics = chunk.statistics();
+  if (!chunk_statistics || chunk_statistics->statistics().size() <= static_cast<size_t>(_column_id)) return nullptr;
+
+  const auto& segment_statistics = chunk_statistics->statistics()[_column_id];
+  if (!segment_statistics || !segment_statistics->block_min_max_filter()) return nullptr;
+
+  const auto predicate = _block_filter_predicate(segment, chunk_id);
+  if (!predicate) return nullptr;
+
+  const auto ranges = segment_statistics->block_min_max_filter()->candidate_ranges(
+      predicate->predicate_condition, predicate->value, predicate->value2);
+
+  // Scanning through a position filter is slower than a sequential scan, so it only pays off if most rows are skipped
+  auto candidate_count = size_t{0};
+  for (const auto& [begin, end] : ranges) {
+    candidate_count += end - begin;
+  }
+  if (candidate_count * 2 > chunk.size()) return nullptr;
+
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->reserve(candidate_count);
+  for (const auto& [begin, end] : ranges) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      position_filter->emplace_back(chunk_id, chunk_offset);
+    }
+  }
+  position_filter->guarantee_single_chunk();
+  return position_filter;
+}
+
 void AbstractSingleColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id,
                                                                 PosList& matches) const {
   const auto& pos_list = segment.pos_list();
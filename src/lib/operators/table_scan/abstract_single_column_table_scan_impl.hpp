@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -8,10 +9,12 @@
 
 #include "storage/abstract_segment_visitor.hpp"
 
+#include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class Chunk;
 class Table;
 class ReferenceSegment;
 class AttributeVectorIterable;
@@ -21,6 +24,9 @@ class AttributeVectorIterable;
  *
  * Resolves reference segments. The position list of reference segments
  * is split by the referenced segments and then each is visited separately.
+ *
+ * Impls that provide a _block_filter_predicate() only scan the blocks of a segment that the BlockMinMaxFilter of its
+ * SegmentStatistics does not exclude.
  */
 class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
  public:
@@ -32,6 +38,21 @@ class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, PosList& matches) const;
 
+  struct BlockFilterPredicate {
+    PredicateCondition predicate_condition;
+    AllTypeVariant value;
+    std::optional<AllTypeVariant> value2;
+  };
+
+  // The predicate that the BlockMinMaxFilter is queried with, std::nullopt if the segment is better scanned as a whole
+  // (e.g., because the impl has a faster way to skip rows of it)
+  virtual std::optional<BlockFilterPredicate> _block_filter_predicate(const BaseSegment& segment,
+                                                                      const ChunkID chunk_id) const;
+
+  // Returns the rows of the blocks that can contain matches, or nullptr if the whole segment should be scanned
+  std::shared_ptr<const PosList> _block_position_filter(const BaseSegment& segment, const ChunkID chunk_id,
+                                                        const Chunk& chunk) const;
+
   // Implemented by the separate Impls. They do not need to deal with ReferenceSegments anymore, as this class
   // takes care of that. We take `matches` as an in/out parameter instead of returning it because scans on multiple
   // referenced segments of a single ReferenceSegment should result in only one PosList. Storing it as a member is
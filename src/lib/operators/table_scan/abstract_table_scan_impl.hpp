@@ -5,7 +5,9 @@
 #endif
 
 #include <array>
+#include <memory>
 
+#include "memory/arena_memory_resource.hpp"
 #include "storage/pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
@@ -25,7 +27,14 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  // Sets the arena from which the PosLists returned by scan_chunk() are allocated
+  void set_arena(const std::shared_ptr<ArenaMemoryResource>& arena) { _arena = arena; }
+
  protected:
+  std::shared_ptr<PosList> _create_pos_list() const { return make_shared_in_arena<PosList>(_arena); }
+
+  std::shared_ptr<ArenaMemoryResource> _arena;
+
   /**
    * @defgroup The hot loop of the table scan
    * @{
@@ -4,11 +4,15 @@
 #include <string>
 #include <type_traits>
 
+#include "simd_scan_kernels.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "utils/assert.hpp"
 
@@ -26,6 +30,11 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetween"; }
 
+std::optional<AbstractSingleColumnTableScanImpl::BlockFilterPredicate>
+ColumnBetweenTableScanImpl::_block_filter_predicate(const BaseSegment& segment, const ChunkID chunk_id) const {
+  return BlockFilterPredicate{PredicateCondition::Between, _left_value, _right_value};
+}
+
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -41,7 +50,7 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   // Select optimized or generic scanning implementation based on segment type
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
-  } else {
+  } else if (position_filter || !_scan_run_length_segment(segment, chunk_id, matches)) {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
 }
@@ -62,6 +71,32 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
   });
 }
 
+bool ColumnBetweenTableScanImpl::_scan_run_length_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                          PosList& matches) const {
+  auto scanned = false;
+
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment);
+    if (!run_length_segment) return;
+
+    const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+    const auto typed_right_value = type_cast_variant<ColumnDataType>(_right_value);
+    run_length_segment->for_each_run([&](const auto& value, const bool is_null, const ChunkOffset run_begin,
+                                         const ChunkOffset run_end) {
+      if (is_null || !(value >= typed_left_value && value <= typed_right_value)) return;
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        matches.emplace_back(chunk_id, chunk_offset);
+      }
+    });
+
+    scanned = true;
+  });
+
+  return scanned;
+}
+
 void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                           PosList& matches,
                                                           const std::shared_ptr<const PosList>& position_filter) const {
@@ -91,6 +126,14 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  const auto attribute_vector = segment.attribute_vector();
+  if (!position_filter && attribute_vector->type() == CompressedVectorType::SimdBp128) {
+    // Searches for the ValueID range without fully decompressing the attribute vector
+    simd_scan_simd_bp128_range(static_cast<const SimdBp128Vector&>(*attribute_vector), left_value_id, right_value_id,
+                               chunk_id, matches);
+    return;
+  }
+
   const auto value_id_diff = right_value_id - left_value_id;
 
   const auto comparator = [left_value_id, value_id_diff](const auto& position) {
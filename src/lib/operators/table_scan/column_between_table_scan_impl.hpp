@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "abstract_single_column_table_scan_impl.hpp"
 
@@ -32,6 +33,9 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
+  std::optional<BlockFilterPredicate> _block_filter_predicate(const BaseSegment& segment,
+                                                              const ChunkID chunk_id) const override;
+
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                              const std::shared_ptr<const PosList>& position_filter) const;
 
@@ -39,6 +43,9 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
 
+  // Evaluates the predicate once per run. Returns false if the segment is not a RunLengthSegment.
+  bool _scan_run_length_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
   const AllTypeVariant _left_value;
   const AllTypeVariant _right_value;
 };
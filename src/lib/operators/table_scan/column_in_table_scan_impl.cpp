@@ -0,0 +1,116 @@
+#include "column_in_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+
+#include "utils/assert.hpp"
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+ColumnInTableScanImpl::ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                             const PredicateCondition predicate_condition,
+                                             const std::vector<AllTypeVariant>& values)
+    : AbstractSingleColumnTableScanImpl{in_table, column_id, predicate_condition}, _values{values} {
+  Assert(predicate_condition == PredicateCondition::In || predicate_condition == PredicateCondition::NotIn,
+         "Expected IN or NOT IN");
+  Assert(!_values.empty(), "Expected at least one value");
+  Assert(std::none_of(_values.cbegin(), _values.cend(), [](const auto& value) { return variant_is_null(value); }),
+         "Expected values not to be NULL");
+}
+
+std::string ColumnInTableScanImpl::description() const { return "ColumnIn"; }
+
+void ColumnInTableScanImpl::_scan_non_reference_segment(
+    const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+    const std::shared_ptr<const PosList>& position_filter) const {
+  // Select optimized or generic scanning implementation based on segment type
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else {
+    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+  }
+}
+
+void ColumnInTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                  PosList& matches,
+                                                  const std::shared_ptr<const PosList>& position_filter) const {
+  const auto is_negated = _predicate_condition == PredicateCondition::NotIn;
+
+  segment_with_iterators_filtered(segment, position_filter, [&](auto it, const auto end) {
+    using ColumnDataType = typename decltype(it)::ValueType;
+
+    auto typed_values = std::unordered_set<ColumnDataType>{};
+    typed_values.reserve(_values.size());
+    for (const auto& value : _values) {
+      typed_values.emplace(type_cast_variant<ColumnDataType>(value));
+    }
+    const auto [min_iter, max_iter] = std::minmax_element(typed_values.cbegin(), typed_values.cend());
+    const auto& min_value = *min_iter;
+    const auto& max_value = *max_iter;
+
+    const auto comparator = [&](const auto& position) {
+      const auto& value = position.value();
+      const auto contained = value >= min_value && value <= max_value && typed_values.count(value) != 0;
+      return contained != is_negated;
+    };
+
+    _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+void ColumnInTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                                     PosList& matches,
+                                                     const std::shared_ptr<const PosList>& position_filter) const {
+  const auto is_negated = _predicate_condition == PredicateCondition::NotIn;
+  const auto unique_values_count = segment.unique_values_count();
+
+  // One entry per ValueID, plus one for NULL (represented by unique_values_count), which never matches. uint8_t is
+  // used instead of bool, so that each lookup is a plain load.
+  auto value_id_matches = std::vector<uint8_t>(unique_values_count + 1, is_negated);
+  value_id_matches.back() = false;
+
+  auto matching_value_id_count = is_negated ? unique_values_count : size_t{0};
+  for (const auto& value : _values) {
+    const auto value_id = segment.lower_bound(value);
+    if (value_id == INVALID_VALUE_ID || value_id_matches[value_id] != is_negated) continue;
+    if (segment.value_of_value_id(value_id) != value) continue;
+
+    value_id_matches[value_id] = !is_negated;
+    if (is_negated) {
+      --matching_value_id_count;
+    } else {
+      ++matching_value_id_count;
+    }
+  }
+
+  if (matching_value_id_count == 0) return;
+
+  auto iterable = create_iterable_from_attribute_vector(segment);
+
+  if (matching_value_id_count == unique_values_count) {
+    iterable.with_iterators(position_filter, [&](auto it, auto end) {
+      static const auto always_true = [](const auto&) { return true; };
+      // Matches all, so include all rows except those with NULLs in the result.
+      _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
+    });
+    return;
+  }
+
+  const auto comparator = [&value_id_matches](const auto& position) { return value_id_matches[position.value()]; };
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    // No need to check for NULL because the entry of NULL's ValueID is never set
+    _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+}  // namespace opossum
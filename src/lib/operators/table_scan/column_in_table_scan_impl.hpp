@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_single_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Checks whether a column is contained in a list of values (... WHERE col [NOT] IN (1, 2, 3))
+ *
+ * - For dictionary segments, the list is translated into a lookup table over the ValueIDs of the segment, so that
+ *   each row is checked with a single lookup
+ * - Other segments probe a hash set of the list values, which is built for each chunk. Values outside of the range
+ *   between the smallest and the largest list value are rejected without probing the hash set.
+ *
+ * The values are expected to be non-NULL and of the same data type as the column, as the IN lists generated by
+ * applications usually are. Other lists are handled by the ExpressionEvaluator (see TableScan::_create_impl).
+ */
+class ColumnInTableScanImpl : public AbstractSingleColumnTableScanImpl {
+ public:
+  ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                        const PredicateCondition predicate_condition, const std::vector<AllTypeVariant>& values);
+
+  std::string description() const override;
+
+ protected:
+  void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                                   const std::shared_ptr<const PosList>& position_filter) const override;
+
+  void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                             const std::shared_ptr<const PosList>& position_filter) const;
+
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+                                const std::shared_ptr<const PosList>& position_filter) const;
+
+  const std::vector<AllTypeVariant> _values;
+};
+
+}  // namespace opossum
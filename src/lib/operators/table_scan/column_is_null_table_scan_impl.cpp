@@ -28,7 +28,7 @@ std::shared_ptr<PosList> ColumnIsNullTableScanImpl::scan_chunk(const ChunkID chu
   const auto& chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
 
-  auto matches = std::make_shared<PosList>();
+  auto matches = _create_pos_list();
 
   if (const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment)) {
     _scan_value_segment(*value_segment, chunk_id, *matches, nullptr);
@@ -78,7 +78,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
       return false;
 
     case PredicateCondition::IsNotNull:
-      return !segment.is_nullable();
+      return !segment.is_nullable() || segment.null_values().all_valid();
 
     default:
       Fail("Unsupported comparison type encountered");
@@ -88,7 +88,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
 bool ColumnIsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::IsNull:
-      return !segment.is_nullable();
+      return !segment.is_nullable() || segment.null_values().all_valid();
 
     case PredicateCondition::IsNotNull:
       return false;
@@ -4,6 +4,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -11,6 +12,7 @@
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -61,18 +63,34 @@ void ColumnLikeTableScanImpl::_scan_generic_segment(const BaseSegment& segment,
 void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
-  std::pair<size_t, std::vector<bool>> result;
+  auto result = std::shared_ptr<const std::pair<size_t, std::vector<bool>>>{};
 
   if (segment.encoding_type() == EncodingType::Dictionary) {
     const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
-  } else {
+    result = std::make_shared<std::pair<size_t, std::vector<bool>>>(
+        _find_matches_in_dictionary(*typed_segment.dictionary()));
+  } else if (segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    result = std::make_shared<std::pair<size_t, std::vector<bool>>>(
+        _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary()));
+  } else if (segment.encoding_type() == EncodingType::GlobalDictionary) {
+    // The dictionary is shared by the chunks of the column, so that it is only matched once
+    const auto& typed_segment = static_cast<const GlobalDictionarySegment<pmr_string>&>(segment);
+    const auto lock = std::lock_guard<std::mutex>{_global_dictionary_matches_mutex};
+    auto& matches = _global_dictionary_matches[typed_segment.dictionary()];
+    if (!matches) {
+      matches = std::make_shared<std::pair<size_t, std::vector<bool>>>(
+          _find_matches_in_dictionary(*typed_segment.dictionary()));
+    }
+    result = matches;
+  } else {
+    const auto& typed_segment = static_cast<const FrontCodedDictionarySegment<pmr_string>&>(segment);
+    result = std::make_shared<std::pair<size_t, std::vector<bool>>>(
+        _find_matches_in_dictionary(*typed_segment.dictionary()));
   }
 
-  const auto& match_count = result.first;
-  const auto& dictionary_matches = result.second;
+  const auto& match_count = result->first;
+  const auto& dictionary_matches = result->second;
 
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
@@ -121,4 +139,54 @@ std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_d
   return result;
 }
 
+std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
+    const FixedStringVector& dictionary) const {
+  auto result = std::pair<size_t, std::vector<bool>>{};
+
+  auto& count = result.first;
+  auto& dictionary_matches = result.second;
+
+  const auto string_length = dictionary.string_length();
+  const auto contained_string = _matcher.contained_string();
+
+  if (contained_string && !contained_string->empty() && string_length > 0) {
+    // Search the buffer of all (zero-padded) entries at once and assign the occurrences to the entries. An occurrence
+    // that spans two entries is not a match, so the search continues behind its first character.
+    dictionary_matches.resize(dictionary.size(), _invert_results);
+
+    const auto buffer = std::string_view{dictionary.data(), dictionary.size() * string_length};
+    auto position = size_t{0};
+    while (position < buffer.size()) {
+      const auto occurrence = LikeMatcher::find_substring(buffer.substr(position), *contained_string);
+      if (occurrence == std::string_view::npos) break;
+
+      const auto begin = position + occurrence;
+      const auto entry_id = begin / string_length;
+      if ((begin + contained_string->size() - 1) / string_length != entry_id) {
+        position = begin + 1;
+        continue;
+      }
+
+      dictionary_matches[entry_id] = !_invert_results;
+      position = (entry_id + 1) * string_length;
+    }
+
+    count = static_cast<size_t>(std::count(dictionary_matches.begin(), dictionary_matches.end(), true));
+    return result;
+  }
+
+  count = 0u;
+  dictionary_matches.reserve(dictionary.size());
+
+  _matcher.resolve(_invert_results, [&](const auto& matcher) {
+    for (const auto& value : dictionary) {
+      const auto matches = matcher(value);
+      count += static_cast<size_t>(matches);
+      dictionary_matches.push_back(matches);
+    }
+  });
+
+  return result;
+}
+
 }  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <utility>
@@ -15,6 +16,7 @@
 
 namespace opossum {
 
+class FixedStringVector;
 class Table;
 
 /**
@@ -26,8 +28,11 @@ class Table;
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * - FixedStringDictionarySegments are matched on the fixed-width entries without materializing the dictionary. For
+ *   '%hello%' patterns, the contiguous buffer of all entries is searched at once.
+ * - The dictionary of GlobalDictionarySegments is matched once for all chunks that share it.
+ *
+ * Performance Notes: See LikeMatcher for the special cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractSingleColumnTableScanImpl {
  public:
@@ -50,11 +55,18 @@ class ColumnLikeTableScanImpl : public AbstractSingleColumnTableScanImpl {
    * @returns number of matches and the result of each dictionary entry
    */
   std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<pmr_string>& dictionary) const;
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const FixedStringVector& dictionary) const;
 
   const LikeMatcher _matcher;
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // The matches of the dictionaries of GlobalDictionarySegments, which are scanned by concurrent jobs
+  mutable std::mutex _global_dictionary_matches_mutex;
+  mutable std::map<std::shared_ptr<const pmr_vector<pmr_string>>,
+                   std::shared_ptr<const std::pair<size_t, std::vector<bool>>>>
+      _global_dictionary_matches;
 };
 
 }  // namespace opossum
@@ -101,7 +101,7 @@ std::shared_ptr<PosList> ColumnVsColumnTableScanImpl::_typed_scan_chunk(ChunkID
                                                                         const RightIterable& right_iterable) const {
   const auto chunk = _in_table->get_chunk(chunk_id);
 
-  auto matches_out = std::make_shared<PosList>();
+  auto matches_out = _create_pos_list();
 
   using LeftType = typename LeftIterable::ValueType;
   using RightType = typename RightIterable::ValueType;
@@ -132,18 +132,39 @@ std::shared_ptr<PosList> ColumnVsColumnTableScanImpl::_typed_scan_chunk(ChunkID
     left_iterable.with_iterators([&](auto left_it, const auto left_end) {
       right_iterable.with_iterators([&](auto right_it, const auto right_end) {
         with_comparator_light(maybe_flipped_condition, [&](auto predicate_comparator) {
-          const auto comparator = [predicate_comparator](const auto& left, const auto& right) {
-            return predicate_comparator(left.value(), right.value());
-          };
-
-          if (condition_was_flipped) {
-            const auto erased_comparator = conditionally_erase_comparator_type(comparator, right_it, left_it);
-            AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, right_it, right_end, chunk_id_copy,
-                                                              *matches_out_ref, left_it);
+          if constexpr (is_any_segment_iterator_v<decltype(left_it)> && is_any_segment_iterator_v<decltype(right_it)>) {
+            // Type-erased iterators are read in blocks, which amortizes their virtual calls. As the comparator is only
+            // instantiated for the data types (and not for the iterator types), it does not need to be erased.
+            auto left_block = SegmentPositionBlock<LeftType>{};
+            auto right_block = SegmentPositionBlock<RightType>{};
+            while (left_it.fill_block(left_block, left_end) > 0) {
+              right_it.fill_block(right_block, right_end);
+              DebugAssert(left_block.size == right_block.size, "Compared segments need to have the same size");
+
+              for (auto index = size_t{0}; index < left_block.size; ++index) {
+                if (left_block.nulls[index] || right_block.nulls[index]) continue;
+
+                const auto matches =
+                    condition_was_flipped
+                        ? predicate_comparator(right_block.values[index], left_block.values[index])
+                        : predicate_comparator(left_block.values[index], right_block.values[index]);
+                if (matches) matches_out_ref->emplace_back(RowID{chunk_id_copy, left_block.chunk_offsets[index]});
+              }
+            }
           } else {
-            const auto erased_comparator = conditionally_erase_comparator_type(comparator, left_it, right_it);
-            AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, left_it, left_end, chunk_id_copy,
-                                                              *matches_out_ref, right_it);
+            const auto comparator = [predicate_comparator](const auto& left, const auto& right) {
+              return predicate_comparator(left.value(), right.value());
+            };
+
+            if (condition_was_flipped) {
+              const auto erased_comparator = conditionally_erase_comparator_type(comparator, right_it, left_it);
+              AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, right_it, right_end, chunk_id_copy,
+                                                                *matches_out_ref, left_it);
+            } else {
+              const auto erased_comparator = conditionally_erase_comparator_type(comparator, left_it, right_it);
+              AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, left_it, left_end, chunk_id_copy,
+                                                                *matches_out_ref, right_it);
+            }
           }
         });
       });
@@ -1,19 +1,169 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "simd_scan_kernels.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/base_encoded_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+struct IsFixedSizeByteAlignedVector : std::false_type {};
+
+template <typename UnsignedIntType>
+struct IsFixedSizeByteAlignedVector<FixedSizeByteAlignedVector<UnsignedIntType>> : std::true_type {};
+
+// Removes the matches starting at first_match_index that refer to NULL values
+template <typename NullValues>
+void remove_null_matches(PosList& matches, const size_t first_match_index, const NullValues& null_values) {
+  const auto new_end = std::remove_if(matches.begin() + first_match_index, matches.end(),
+                                      [&](const auto& row_id) { return null_values[row_id.chunk_offset]; });
+  matches.erase(new_end, matches.end());
+}
+
+template <typename T>
+void scan_value_segment_with_simd(const ValueSegment<T>& segment, const PredicateCondition predicate_condition,
+                                  const T search_value, const ChunkID chunk_id, PosList& matches) {
+  // The values are stored in a tbb::concurrent_vector, which is not contiguous. Thus, we copy them in batches into a
+  // buffer that stays in the L1 cache.
+  constexpr auto BUFFER_SIZE = size_t{1024};
+  auto buffer = std::array<T, BUFFER_SIZE>{};
+
+  const auto& values = segment.values();
+  const auto size = values.size();
+  const auto first_match_index = matches.size();
+
+  auto values_iter = values.cbegin();
+  for (auto buffer_begin = size_t{0}; buffer_begin < size; buffer_begin += BUFFER_SIZE) {
+    const auto buffer_size = std::min(BUFFER_SIZE, size - buffer_begin);
+    std::copy_n(values_iter, buffer_size, buffer.begin());
+    values_iter += buffer_size;
+
+    simd_scan_values(buffer.data(), buffer_size, predicate_condition, search_value, chunk_id,
+                     static_cast<ChunkOffset>(buffer_begin), matches);
+  }
+
+  if (segment.is_nullable() && !segment.null_values().all_valid()) {
+    remove_null_matches(matches, first_match_index, segment.null_values());
+  }
+}
+
+/**
+ * The values of a block of a frame-of-reference-encoded segment are stored as unsigned offsets to the block minimum.
+ * Thus, `value <condition> search_value` is equivalent to `offset <condition> (search_value - block_minimum)`, as long
+ * as the difference is representable as an offset. If it is not, the predicate matches either all or none of the
+ * values of the block. This lets us run the SIMD kernels directly on the offsets without decompressing them.
+ */
+template <typename T>
+bool scan_frame_of_reference_segment_with_simd(const FrameOfReferenceSegment<T>& segment,
+                                               const PredicateCondition predicate_condition, const T search_value,
+                                               const ChunkID chunk_id, PosList& matches) {
+  auto scanned = false;
+
+  resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+    // Other vector compressions do not store the offsets as an array of integers
+    if constexpr (IsFixedSizeByteAlignedVector<std::decay_t<decltype(offset_values)>>::value) {
+      const auto& offsets = offset_values.data();
+      using OffsetType = typename std::decay_t<decltype(offsets)>::value_type;
+
+      const auto& block_minima = segment.block_minima();
+      const auto size = offsets.size();
+      const auto first_match_index = matches.size();
+
+      for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+        const auto block_begin = block_index * FrameOfReferenceSegment<T>::block_size;
+        const auto block_end = std::min(block_begin + FrameOfReferenceSegment<T>::block_size, size);
+        const auto block_minimum = block_minima[block_index];
+
+        // Determine whether all values of the block are greater than the search value (i.e., the search value is below
+        // the block minimum), less than it (i.e., the search value exceeds every possible offset of the block), or
+        // whether the offsets have to be compared.
+        auto all_values_greater = false;
+        auto all_values_less = false;
+        auto search_offset = OffsetType{0};
+        if (search_value < block_minimum) {
+          all_values_greater = true;
+        } else {
+          // Computed in unsigned arithmetic, as the difference might overflow T
+          const auto distance = static_cast<uint64_t>(search_value) - static_cast<uint64_t>(block_minimum);
+          if (distance > std::numeric_limits<OffsetType>::max()) {
+            all_values_less = true;
+          } else {
+            search_offset = static_cast<OffsetType>(distance);
+          }
+        }
+
+        auto matches_all = false;
+        if (all_values_greater || all_values_less) {
+          switch (predicate_condition) {
+            case PredicateCondition::NotEquals:
+              matches_all = true;
+              break;
+            case PredicateCondition::LessThan:
+            case PredicateCondition::LessThanEquals:
+              matches_all = all_values_less;
+              break;
+            case PredicateCondition::GreaterThan:
+            case PredicateCondition::GreaterThanEquals:
+              matches_all = all_values_greater;
+              break;
+            default:
+              break;
+          }
+
+          if (matches_all) {
+            for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+              matches.emplace_back(chunk_id, static_cast<ChunkOffset>(chunk_offset));
+            }
+          }
+          continue;
+        }
+
+        simd_scan_values(offsets.data() + block_begin, block_end - block_begin, predicate_condition, search_offset,
+                         chunk_id, static_cast<ChunkOffset>(block_begin), matches);
+      }
+
+      const auto& null_values = segment.null_values();
+      if (std::find(null_values.cbegin(), null_values.cend(), true) != null_values.cend()) {
+        remove_null_matches(matches, first_match_index, null_values);
+      }
+
+      scanned = true;
+    }
+  });
+
+  return scanned;
+}
+
+}  // namespace
+
 namespace opossum {
 
 ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<const Table>& in_table,
@@ -24,6 +174,20 @@ ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnVsValueTableScanImpl::description() const { return "ColumnVsValue"; }
 
+std::optional<AbstractSingleColumnTableScanImpl::BlockFilterPredicate>
+ColumnVsValueTableScanImpl::_block_filter_predicate(const BaseSegment& segment, const ChunkID chunk_id) const {
+  // Sorted segments are binary-searched, and LZ4 and Delta segments skip rows on their own (see
+  // _scan_non_reference_segment)
+  const auto ordered_by = _in_table->get_chunk(chunk_id)->ordered_by();
+  if (ordered_by && ordered_by->first == _column_id) return std::nullopt;
+  if (const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment)) {
+    const auto encoding_type = encoded_segment->encoding_type();
+    if (encoding_type == EncodingType::LZ4 || encoding_type == EncodingType::Delta) return std::nullopt;
+  }
+
+  return BlockFilterPredicate{_predicate_condition, _value, std::nullopt};
+}
+
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -36,6 +200,10 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     return;
   }
 
+  if (!position_filter && _scan_ascending_delta_segment(segment, chunk_id, matches)) return;
+  if (!position_filter && _scan_lz4_string_segment(segment, chunk_id, matches)) return;
+  if (!position_filter && _scan_run_length_segment(segment, chunk_id, matches)) return;
+
   const auto ordered_by = _in_table->get_chunk(chunk_id)->ordered_by();
   if (ordered_by && ordered_by->first == _column_id) {
     _scan_sorted_segment(segment, chunk_id, matches, position_filter, ordered_by->second);
@@ -43,7 +211,7 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     // Select optimized or generic scanning implementation based on segment type
     if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
       _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
-    } else {
+    } else if (position_filter || !_scan_segment_with_simd(segment, chunk_id, matches)) {
       _scan_generic_segment(segment, chunk_id, matches, position_filter);
     }
   }
@@ -65,6 +233,177 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
   });
 }
 
+bool ColumnVsValueTableScanImpl::_scan_segment_with_simd(const BaseSegment& segment, const ChunkID chunk_id,
+                                                         PosList& matches) const {
+  if (!simd_scan_supports_predicate_condition(_predicate_condition)) return false;
+
+  auto scanned = false;
+
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+
+      if (const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+        scan_value_segment_with_simd(*value_segment, _predicate_condition, typed_value, chunk_id, matches);
+        scanned = true;
+      } else if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+        if (const auto* frame_of_reference_segment =
+                dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&segment)) {
+          scanned = scan_frame_of_reference_segment_with_simd(*frame_of_reference_segment, _predicate_condition,
+                                                              typed_value, chunk_id, matches);
+        }
+      }
+    }
+  });
+
+  return scanned;
+}
+
+bool ColumnVsValueTableScanImpl::_scan_ascending_delta_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                               PosList& matches) const {
+  if (_predicate_condition != PredicateCondition::Equals && _predicate_condition != PredicateCondition::LessThan &&
+      _predicate_condition != PredicateCondition::LessThanEquals &&
+      _predicate_condition != PredicateCondition::GreaterThan &&
+      _predicate_condition != PredicateCondition::GreaterThanEquals) {
+    return false;
+  }
+
+  auto scanned = false;
+
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+      const auto* delta_segment = dynamic_cast<const DeltaSegment<ColumnDataType>*>(&segment);
+      if (!delta_segment || !delta_segment->is_ascending()) return;
+
+      // The matches form a single range of chunk offsets, whose bounds are found by binary search
+      const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+      auto begin = ChunkOffset{0};
+      auto end = static_cast<ChunkOffset>(delta_segment->size());
+      switch (_predicate_condition) {
+        case PredicateCondition::Equals:
+          begin = delta_segment->lower_bound(typed_value);
+          end = delta_segment->upper_bound(typed_value);
+          break;
+        case PredicateCondition::LessThan:
+          end = delta_segment->lower_bound(typed_value);
+          break;
+        case PredicateCondition::LessThanEquals:
+          end = delta_segment->upper_bound(typed_value);
+          break;
+        case PredicateCondition::GreaterThan:
+          begin = delta_segment->upper_bound(typed_value);
+          break;
+        case PredicateCondition::GreaterThanEquals:
+          begin = delta_segment->lower_bound(typed_value);
+          break;
+        default:
+          Fail("Unsupported predicate condition");
+      }
+
+      // NULLs repeat their preceding value and thus might lie within the range
+      const auto& null_values = delta_segment->null_values();
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        if (!null_values[chunk_offset]) matches.emplace_back(chunk_id, chunk_offset);
+      }
+
+      scanned = true;
+    }
+  });
+
+  return scanned;
+}
+
+bool ColumnVsValueTableScanImpl::_scan_lz4_string_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                          PosList& matches) const {
+  const auto* lz4_segment = dynamic_cast<const LZ4Segment<pmr_string>*>(&segment);
+  if (!lz4_segment || lz4_segment->block_first_rows().empty()) return false;
+
+  const auto typed_value = type_cast_variant<pmr_string>(_value);
+  const auto& null_values = lz4_segment->null_values();
+  const auto& block_first_rows = lz4_segment->block_first_rows();
+  const auto& block_min_values = lz4_segment->block_min_values();
+  const auto& block_max_values = lz4_segment->block_max_values();
+  const auto block_count = block_first_rows.size();
+
+  auto cached_block_index = std::optional<size_t>{};
+  auto cached_block = std::vector<char>{};
+
+  with_comparator(_predicate_condition, [&](auto predicate_comparator) {
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto rows_begin = block_first_rows[block_index];
+      const auto rows_end = block_index + 1 < block_count ? block_first_rows[block_index + 1]
+                                                          : static_cast<ChunkOffset>(null_values.size());
+      const auto& min_value = block_min_values[block_index];
+      const auto& max_value = block_max_values[block_index];
+
+      // Equals and NotEquals are decided by whether the search value lies within [min, max]. The other predicates
+      // hold for a prefix or a suffix of the sorted values, so that they hold for all values if they hold for both
+      // the minimum and the maximum, and for none if they hold for neither.
+      auto matches_all = false;
+      auto matches_none = false;
+      const auto value_outside_range = typed_value < min_value || typed_value > max_value;
+      const auto range_is_value = min_value == typed_value && max_value == typed_value;
+      if (_predicate_condition == PredicateCondition::Equals) {
+        matches_all = range_is_value;
+        matches_none = value_outside_range;
+      } else if (_predicate_condition == PredicateCondition::NotEquals) {
+        matches_all = value_outside_range;
+        matches_none = range_is_value;
+      } else {
+        const auto min_matches = predicate_comparator(min_value, typed_value);
+        const auto max_matches = predicate_comparator(max_value, typed_value);
+        matches_all = min_matches && max_matches;
+        matches_none = !min_matches && !max_matches;
+      }
+
+      if (matches_none) continue;
+
+      for (auto chunk_offset = rows_begin; chunk_offset < rows_end; ++chunk_offset) {
+        if (null_values[chunk_offset]) continue;
+        if (matches_all ||
+            predicate_comparator(lz4_segment->decompress(chunk_offset, cached_block_index, cached_block),
+                                 typed_value)) {
+          matches.emplace_back(chunk_id, chunk_offset);
+        }
+      }
+    }
+  });
+
+  return true;
+}
+
+bool ColumnVsValueTableScanImpl::_scan_run_length_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                          PosList& matches) const {
+  auto scanned = false;
+
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment);
+    if (!run_length_segment) return;
+
+    // The predicate is evaluated once per run, whose chunk offsets are all added if it matches
+    const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+    with_comparator(_predicate_condition, [&](auto predicate_comparator) {
+      run_length_segment->for_each_run([&](const auto& value, const bool is_null, const ChunkOffset run_begin,
+                                           const ChunkOffset run_end) {
+        if (is_null || !predicate_comparator(value, typed_value)) return;
+        for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+          matches.emplace_back(chunk_id, chunk_offset);
+        }
+      });
+    });
+
+    scanned = true;
+  });
+
+  return scanned;
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                           PosList& matches,
                                                           const std::shared_ptr<const PosList>& position_filter) const {
@@ -114,6 +453,28 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  // Except for NotEquals, the matching ValueIDs form a single range, which can be searched for in SIMD-BP128-compressed
+  // attribute vectors without fully decompressing them. The range never includes NULLs, which are represented by
+  // unique_values_count().
+  const auto attribute_vector = segment.attribute_vector();
+  if (!position_filter && attribute_vector->type() == CompressedVectorType::SimdBp128 &&
+      _predicate_condition != PredicateCondition::NotEquals) {
+    auto lower_bound = ValueID{0};
+    auto upper_bound = search_value_id;
+    if (_predicate_condition == PredicateCondition::Equals) {
+      lower_bound = search_value_id;
+      upper_bound = ValueID{search_value_id + 1};
+    } else if (_predicate_condition == PredicateCondition::GreaterThan ||
+               _predicate_condition == PredicateCondition::GreaterThanEquals) {
+      lower_bound = search_value_id;
+      upper_bound = static_cast<ValueID>(segment.unique_values_count());
+    }
+
+    simd_scan_simd_bp128_range(static_cast<const SimdBp128Vector&>(*attribute_vector), lower_bound, upper_bound,
+                               chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan(_predicate_condition, [&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -179,20 +540,36 @@ void ColumnVsValueTableScanImpl::_scan_sorted_segment(const BaseSegment& segment
 }
 
 ValueID ColumnVsValueTableScanImpl::_get_search_value_id(const BaseDictionarySegment& segment) const {
-  switch (_predicate_condition) {
-    case PredicateCondition::Equals:
-    case PredicateCondition::NotEquals:
-    case PredicateCondition::LessThan:
-    case PredicateCondition::GreaterThanEquals:
-      return segment.lower_bound(_value);
+  const auto lookup_search_value_id = [&]() {
+    switch (_predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::GreaterThanEquals:
+        return segment.lower_bound(_value);
+
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+        return segment.upper_bound(_value);
+
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+  };
 
-    case PredicateCondition::LessThanEquals:
-    case PredicateCondition::GreaterThan:
-      return segment.upper_bound(_value);
+  if (segment.encoding_type() != EncodingType::GlobalDictionary) return lookup_search_value_id();
 
-    default:
-      Fail("Unsupported comparison type encountered");
-  }
+  // The chunks that share a dictionary share the search ValueID, too
+  auto dictionary = std::shared_ptr<const void>{};
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    dictionary = static_cast<const GlobalDictionarySegment<ColumnDataType>&>(segment).dictionary();
+  });
+
+  const auto lock = std::lock_guard<std::mutex>{_global_search_value_ids_mutex};
+  const auto [search_value_id_it, inserted] = _global_search_value_ids.try_emplace(dictionary, INVALID_VALUE_ID);
+  if (inserted) search_value_id_it->second = lookup_search_value_id();
+  return search_value_id_it->second;
 }
 
 bool ColumnVsValueTableScanImpl::_value_matches_all(const BaseDictionarySegment& segment,
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -18,9 +21,17 @@ namespace opossum {
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
  * - Value segments are scanned sequentially
+ * - Unencoded and frame-of-reference-encoded segments of arithmetic types are scanned using SIMD kernels that are
+ *   selected based on the CPU at runtime (see simd_scan_kernels.hpp). For frame-of-reference segments, the search value
+ *   is translated into the offset domain of each block, so that the offsets do not need to be decompressed.
+ * - Delta-encoded segments whose values are sorted are binary-searched for the range of matching chunk offsets.
+ * - For run-length-encoded segments, the predicate is evaluated once per run.
+ * - For LZ4-encoded string segments, the minimum and maximum of each block are used to skip the block or to accept all
+ *   of its rows without decompressing it.
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. For
+ *   GlobalDictionarySegments, the value ID is looked up once for all chunks that share the dictionary.
  */
 class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
  public:
@@ -33,11 +44,26 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
+  std::optional<BlockFilterPredicate> _block_filter_predicate(const BaseSegment& segment,
+                                                              const ChunkID chunk_id) const override;
+
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                              const std::shared_ptr<const PosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
 
+  // Returns false if neither the segment type nor the predicate condition are supported by the SIMD kernels
+  bool _scan_segment_with_simd(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns false if the segment is not a sorted DeltaSegment or the predicate condition is NotEquals
+  bool _scan_ascending_delta_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns false if the segment is not an LZ4Segment of strings
+  bool _scan_lz4_string_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns false if the segment is not a RunLengthSegment
+  bool _scan_run_length_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
   void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                             const std::shared_ptr<const PosList>& position_filter,
                             const OrderByMode order_by_mode) const;
@@ -81,6 +107,10 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
   /**@}*/
 
   const AllTypeVariant _value;
+
+  // The search value ids in the dictionaries of GlobalDictionarySegments, which are scanned by concurrent jobs
+  mutable std::mutex _global_search_value_ids_mutex;
+  mutable std::map<std::shared_ptr<const void>, ValueID> _global_search_value_ids;
 };
 
 }  // namespace opossum
@@ -9,11 +9,18 @@ ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
     const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression)
     : _in_table(in_table), _expression(expression) {
   _uncorrelated_subquery_results = ExpressionEvaluator::populate_uncorrelated_subquery_results_cache({expression});
+  _compiled_expression = CompiledExpression::compile(*expression);
 }
 
-std::string ExpressionEvaluatorTableScanImpl::description() const { return "ExpressionEvaluator"; }
+std::string ExpressionEvaluatorTableScanImpl::description() const {
+  return _compiled_expression ? "CompiledExpression" : "ExpressionEvaluator";
+}
 
 std::shared_ptr<PosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) const {
+  if (_compiled_expression) {
+    return std::make_shared<PosList>(_compiled_expression->evaluate_to_pos_list(*_in_table, chunk_id));
+  }
+
   return std::make_shared<PosList>(
       ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results}.evaluate_expression_to_pos_list(
           *_expression));
@@ -2,6 +2,7 @@
 
 #include "abstract_table_scan_impl.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/compiled_expression.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
 
 namespace opossum {
@@ -11,7 +12,8 @@ class Table;
 /**
  * Uses the ExpressionEvaluator::evaluate_expression_to_pos_list() for a fallback implementation of the
  * AbstractTableScanImpl. This is likely slower than any specialized `AbstractTableScanImpl` and should thus only be
- * used if a particular expression type doesn't have a specialized `AbstractTableScanImpl`.
+ * used if a particular expression type doesn't have a specialized `AbstractTableScanImpl`. Comparisons of arithmetics
+ * (e.g., `a + b < c * 2`) are evaluated by a CompiledExpression instead.
  */
 class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  public:
@@ -25,6 +27,7 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<AbstractExpression> _expression;
   std::shared_ptr<ExpressionEvaluator::UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+  std::shared_ptr<const CompiledExpression> _compiled_expression;
 };
 
 }  // namespace opossum
@@ -0,0 +1,91 @@
+#include "logical_expression_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+using Bitmap = std::vector<uint64_t>;
+
+void set_bits(Bitmap& bitmap, const PosList& matches) {
+  for (const auto& match : matches) {
+    bitmap[match.chunk_offset / BITS_PER_WORD] |= uint64_t{1} << (match.chunk_offset % BITS_PER_WORD);
+  }
+}
+
+}  // namespace
+
+LogicalExpressionTableScanImpl::LogicalExpressionTableScanImpl(
+    const std::shared_ptr<const Table>& in_table, const LogicalOperator logical_operator,
+    std::vector<std::unique_ptr<AbstractTableScanImpl>> operand_impls)
+    : _in_table(in_table), _logical_operator(logical_operator), _operand_impls(std::move(operand_impls)) {
+  DebugAssert(_operand_impls.size() > 1, "Expected at least two operands");
+}
+
+std::string LogicalExpressionTableScanImpl::description() const {
+  std::stringstream stream;
+  stream << _logical_operator << "(";
+  for (auto operand_idx = size_t{0}; operand_idx < _operand_impls.size(); ++operand_idx) {
+    if (operand_idx > 0) stream << ", ";
+    stream << _operand_impls[operand_idx]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<PosList> LogicalExpressionTableScanImpl::scan_chunk(ChunkID chunk_id) const {
+  const auto chunk_size = _in_table->get_chunk(chunk_id)->size();
+  const auto word_count = (chunk_size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+  auto result = Bitmap(word_count);
+  auto operand_bitmap = Bitmap(word_count);
+
+  for (auto operand_idx = size_t{0}; operand_idx < _operand_impls.size(); ++operand_idx) {
+    const auto operand_matches = _operand_impls[operand_idx]->scan_chunk(chunk_id);
+
+    if (operand_idx == 0 || _logical_operator == LogicalOperator::Or) {
+      set_bits(result, *operand_matches);
+    } else {
+      std::fill(operand_bitmap.begin(), operand_bitmap.end(), uint64_t{0});
+      set_bits(operand_bitmap, *operand_matches);
+      for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+        result[word_idx] &= operand_bitmap[word_idx];
+      }
+    }
+
+    // No row can satisfy the conjunction anymore
+    if (_logical_operator == LogicalOperator::And &&
+        std::all_of(result.begin(), result.end(), [](const auto word) { return word == 0; })) {
+      break;
+    }
+  }
+
+  auto row_count = size_t{0};
+  for (const auto word : result) {
+    row_count += __builtin_popcountll(word);
+  }
+
+  auto matches = _create_pos_list();
+  matches->reserve(row_count);
+  for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+    for (auto word = result[word_idx]; word != 0; word &= word - 1) {
+      const auto chunk_offset = word_idx * BITS_PER_WORD + __builtin_ctzll(word);
+      matches->emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+    }
+  }
+
+  return matches;
+}
+
+}  // namespace opossum
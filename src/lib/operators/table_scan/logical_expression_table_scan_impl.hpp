@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+#include "expression/logical_expression.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Scans for a conjunction or disjunction of predicates (e.g., `a = 1 OR b = 2`) that each have a dedicated
+ * AbstractTableScanImpl. Without it, such predicates would be evaluated by the much slower ExpressionEvaluator.
+ *
+ * For each chunk, every operand is scanned with its own impl and its matches are turned into a bitmap with one bit per
+ * row of the chunk. The bitmaps are combined word by word (which the compiler vectorizes) and converted into a single
+ * PosList in the end. As a row matches a predicate iff the predicate is TRUE, combining the matches with AND/OR is
+ * correct also in the presence of NULLs. For conjunctions, the remaining operands are skipped once no row matches.
+ */
+class LogicalExpressionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  LogicalExpressionTableScanImpl(const std::shared_ptr<const Table>& in_table, const LogicalOperator logical_operator,
+                                 std::vector<std::unique_ptr<AbstractTableScanImpl>> operand_impls);
+
+  std::string description() const override;
+
+  std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const override;
+
+ private:
+  const std::shared_ptr<const Table> _in_table;
+  const LogicalOperator _logical_operator;
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> _operand_impls;
+};
+
+}  // namespace opossum
@@ -0,0 +1,308 @@
+#include "simd_scan_kernels.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of values whose comparison results are collected in one bit mask
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// The AVX-512 kernel writes RowIDs as 64-bit integers with the ChunkID in the lower half
+static_assert(sizeof(RowID) == sizeof(uint64_t));
+static_assert(offsetof(RowID, chunk_offset) == sizeof(ChunkID));
+
+// Comparison without short-circuiting, used for blocks that are too small for the vectorized kernels
+template <typename T, typename Comparator>
+size_t scan_values_scalar(const T* values, const size_t size, const T search_value, const Comparator& comparator,
+                          RowID* output, const ChunkID chunk_id, const ChunkOffset first_chunk_offset) {
+  auto match_count = size_t{0};
+  for (auto index = size_t{0}; index < size; ++index) {
+    // Always write the RowID and only advance the output if it matches. This avoids mispredicted branches.
+    output[match_count] = RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)};
+    match_count += comparator(values[index], search_value);
+  }
+  return match_count;
+}
+
+struct ScalarBlockScanner {
+  template <typename T, typename Comparator>
+  static size_t scan_block(const T* values, const T search_value, const Comparator& comparator, RowID* output,
+                           const ChunkID chunk_id, const ChunkOffset first_chunk_offset) {
+    return scan_values_scalar(values, BLOCK_SIZE, search_value, comparator, output, chunk_id, first_chunk_offset);
+  }
+};
+
+#if defined(__x86_64__)
+
+// Sets flags[index] to 0xFF if the value matches and to 0 otherwise. The function has no target attribute of its own
+// and is always inlined, so it is vectorized for the instruction set of the calling kernel.
+template <typename T, typename Comparator>
+__attribute__((always_inline)) inline void compare_block(const T* values, const T search_value,
+                                                         const Comparator& comparator, uint8_t* flags) {
+  // NOLINTNEXTLINE
+  ;  // clang-format off
+  #pragma omp simd safelen(BLOCK_SIZE)
+  // clang-format on
+  for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+    flags[index] = comparator(values[index], search_value) ? 0xFF : 0x00;
+  }
+}
+
+// Writes one RowID per set bit of the mask
+__attribute__((always_inline)) inline size_t write_matches_from_mask(uint64_t mask, RowID* output,
+                                                                     const ChunkID chunk_id,
+                                                                     const ChunkOffset first_chunk_offset) {
+  auto match_count = size_t{0};
+  while (mask) {
+    output[match_count++] = RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + __builtin_ctzll(mask))};
+    mask &= mask - 1;
+  }
+  return match_count;
+}
+
+struct AVX2BlockScanner {
+  template <typename T, typename Comparator>
+  __attribute__((target("avx2"))) static size_t scan_block(const T* values, const T search_value,
+                                                           const Comparator& comparator, RowID* output,
+                                                           const ChunkID chunk_id,
+                                                           const ChunkOffset first_chunk_offset) {
+    alignas(32) auto flags = std::array<uint8_t, BLOCK_SIZE>{};
+    compare_block(values, search_value, comparator, flags.data());
+
+    const auto* flag_vectors = reinterpret_cast<const __m256i*>(flags.data());
+    const auto mask = static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(flag_vectors[0]))) |
+                      static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(flag_vectors[1]))) << 32;
+
+    return write_matches_from_mask(mask, output, chunk_id, first_chunk_offset);
+  }
+};
+
+struct AVX512BlockScanner {
+  // As in AbstractTableScanImpl::_scan_with_iterators, we use 256-bit registers, because current Intel CPUs clock down
+  // when 512-bit registers are used.
+  template <typename T, typename Comparator>
+  __attribute__((target("avx2,avx512f,avx512bw,avx512vl"))) static size_t scan_block(
+      const T* values, const T search_value, const Comparator& comparator, RowID* output, const ChunkID chunk_id,
+      const ChunkOffset first_chunk_offset) {
+    alignas(32) auto flags = std::array<uint8_t, BLOCK_SIZE>{};
+    compare_block(values, search_value, comparator, flags.data());
+
+    const auto* flag_vectors = reinterpret_cast<const __m256i*>(flags.data());
+    const auto mask = static_cast<uint64_t>(_mm256_movepi8_mask(flag_vectors[0])) |
+                      static_cast<uint64_t>(_mm256_movepi8_mask(flag_vectors[1])) << 32;
+    if (!mask) return 0;
+
+    // RowIDs of the first four values, incremented by four values per step
+    const auto first_row_id = static_cast<uint64_t>(chunk_id) | static_cast<uint64_t>(first_chunk_offset) << 32;
+    auto row_ids = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<int64_t>(first_row_id)),
+                                    _mm256_set_epi64x(int64_t{3} << 32, int64_t{2} << 32, int64_t{1} << 32, 0));
+    const auto row_id_increment = _mm256_set1_epi64x(int64_t{4} << 32);
+
+    auto match_count = size_t{0};
+    for (auto shift = size_t{0}; shift < BLOCK_SIZE; shift += 4) {
+      const auto group_mask = static_cast<__mmask8>((mask >> shift) & 0b1111);
+      // Only the matching RowIDs are stored, so the output never needs more space than the number of matches
+      _mm256_mask_compressstoreu_epi64(output + match_count, group_mask, row_ids);
+      match_count += __builtin_popcount(group_mask);
+      row_ids = _mm256_add_epi64(row_ids, row_id_increment);
+    }
+    return match_count;
+  }
+};
+
+#endif
+
+template <typename BlockScanner, typename T, typename Comparator>
+void scan_values(const T* values, const size_t size, const T search_value, const Comparator& comparator,
+                 const ChunkID chunk_id, const ChunkOffset first_chunk_offset, PosList& matches) {
+  const auto max_size = matches.size() + size;
+
+  // As in AbstractTableScanImpl::_scan_with_iterators, the kernels write directly into the resized PosList. Each block
+  // requires space for BLOCK_SIZE matches. The PosList is grown aggressively, but never beyond the maximum number of
+  // matches.
+  auto matches_index = matches.size();
+  matches.resize(std::min(max_size, matches_index + BLOCK_SIZE * 4));
+
+  auto index = size_t{0};
+  for (; index + BLOCK_SIZE <= size; index += BLOCK_SIZE) {
+    if (matches_index + BLOCK_SIZE > matches.size()) {
+      matches.resize(std::min(max_size, (matches.size() + BLOCK_SIZE) * 3));
+    }
+
+    matches_index += BlockScanner::scan_block(values + index, search_value, comparator,
+                                              matches.data() + matches_index, chunk_id,
+                                              static_cast<ChunkOffset>(first_chunk_offset + index));
+  }
+
+  matches.resize(max_size);
+  matches_index += scan_values_scalar(values + index, size - index, search_value, comparator,
+                                      matches.data() + matches_index, chunk_id,
+                                      static_cast<ChunkOffset>(first_chunk_offset + index));
+  matches.resize(matches_index);
+}
+
+template <typename Functor>
+void with_simd_comparator(const PredicateCondition predicate_condition, const Functor& functor) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      functor(std::equal_to<void>{});
+      return;
+    case PredicateCondition::NotEquals:
+      functor(std::not_equal_to<void>{});
+      return;
+    case PredicateCondition::LessThan:
+      functor(std::less<void>{});
+      return;
+    case PredicateCondition::LessThanEquals:
+      functor(std::less_equal<void>{});
+      return;
+    case PredicateCondition::GreaterThan:
+      functor(std::greater<void>{});
+      return;
+    case PredicateCondition::GreaterThanEquals:
+      functor(std::greater_equal<void>{});
+      return;
+    default:
+      Fail("Unsupported predicate condition for SIMD scan");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+SimdInstructionSet detect_simd_instruction_set() {
+#if defined(__x86_64__)
+  static const auto instruction_set = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl")) {
+      return SimdInstructionSet::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) return SimdInstructionSet::AVX2;
+    return SimdInstructionSet::Scalar;
+  }();
+  return instruction_set;
+#else
+  return SimdInstructionSet::Scalar;
+#endif
+}
+
+template <typename T>
+void simd_scan_values(const T* values, const size_t size, const PredicateCondition predicate_condition,
+                      const T search_value, const ChunkID chunk_id, const ChunkOffset first_chunk_offset,
+                      PosList& matches, const SimdInstructionSet instruction_set) {
+  DebugAssert(instruction_set == SimdInstructionSet::Scalar || instruction_set <= detect_simd_instruction_set(),
+              "Instruction set is not supported by this CPU");
+
+  with_simd_comparator(predicate_condition, [&](const auto comparator) {
+    switch (instruction_set) {
+#if defined(__x86_64__)
+      case SimdInstructionSet::AVX512:
+        scan_values<AVX512BlockScanner>(values, size, search_value, comparator, chunk_id, first_chunk_offset, matches);
+        return;
+      case SimdInstructionSet::AVX2:
+        scan_values<AVX2BlockScanner>(values, size, search_value, comparator, chunk_id, first_chunk_offset, matches);
+        return;
+#endif
+      default:
+        scan_values<ScalarBlockScanner>(values, size, search_value, comparator, chunk_id, first_chunk_offset, matches);
+    }
+  });
+}
+
+bool simd_scan_supports_predicate_condition(const PredicateCondition predicate_condition) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void simd_scan_simd_bp128_range(const SimdBp128Vector& vector, const uint32_t lower_bound, const uint32_t upper_bound,
+                                const ChunkID chunk_id, PosList& matches) {
+  using Packing = SimdBp128Packing;
+
+  if (lower_bound >= upper_bound) return;
+
+  const auto* data = vector.data().data();
+  const auto size = vector.size();
+  const auto range_size = upper_bound - lower_bound;
+
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  alignas(16) auto block = std::array<uint32_t, Packing::block_size>{};
+
+  auto data_index = size_t{0};
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < size; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(data + data_index, meta_info.data());
+    ++data_index;
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      if (block_begin >= size) break;
+
+      // The last block of the vector might be padded with zeros
+      const auto block_size = std::min(size_t{Packing::block_size}, size - block_begin);
+      const auto bit_size = meta_info[block_index];
+
+      // All values of the block are within [0, max_value]
+      const auto max_value = bit_size == 32 ? std::numeric_limits<uint32_t>::max() : (uint32_t{1} << bit_size) - 1;
+
+      if (lower_bound > max_value) {
+        // No value matches
+      } else if (lower_bound == 0 && upper_bound > max_value) {
+        for (auto chunk_offset = block_begin; chunk_offset < block_begin + block_size; ++chunk_offset) {
+          matches.emplace_back(chunk_id, static_cast<ChunkOffset>(chunk_offset));
+        }
+      } else {
+        Packing::unpack_block(data + data_index, block.data(), bit_size);
+
+        // (x >= a && x < b) === ((x - a) < (b - a)), see ColumnBetweenTableScanImpl
+        for (auto& value : block) {
+          value -= lower_bound;
+        }
+        simd_scan_values(block.data(), block_size, PredicateCondition::LessThan, range_size, chunk_id,
+                         static_cast<ChunkOffset>(block_begin), matches);
+      }
+
+      data_index += bit_size;
+    }
+  }
+}
+
+template void simd_scan_values(const int32_t*, size_t, PredicateCondition, int32_t, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+template void simd_scan_values(const int64_t*, size_t, PredicateCondition, int64_t, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+template void simd_scan_values(const float*, size_t, PredicateCondition, float, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+template void simd_scan_values(const double*, size_t, PredicateCondition, double, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+template void simd_scan_values(const uint8_t*, size_t, PredicateCondition, uint8_t, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+template void simd_scan_values(const uint16_t*, size_t, PredicateCondition, uint16_t, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+template void simd_scan_values(const uint32_t*, size_t, PredicateCondition, uint32_t, ChunkID, ChunkOffset, PosList&,
+                               SimdInstructionSet);
+
+}  // namespace opossum
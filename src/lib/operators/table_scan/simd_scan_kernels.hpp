@@ -0,0 +1,68 @@
+#pragma once
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class SimdBp128Vector;
+
+/**
+ * Kernels that compare a contiguous array of values with a single search value and append the positions of all
+ * matching values to a PosList. They are used by the ColumnVsValueTableScanImpl for unencoded segments and for the
+ * offsets of frame-of-reference-encoded segments.
+ *
+ * Each kernel is compiled for multiple instruction sets. Which variant is executed is decided at runtime based on the
+ * CPU (see detect_simd_instruction_set()) so that the binary does not have to be built for the most recent ISA. The
+ * comparisons produce a bit mask per block of values. With AVX-512, the matching positions are written into the
+ * PosList using compress-store instructions. Otherwise, the set bits of the mask are converted into positions one by
+ * one.
+ */
+enum class SimdInstructionSet { Scalar, AVX2, AVX512 };
+
+// Returns the most recent instruction set supported by the current CPU. The result is cached.
+SimdInstructionSet detect_simd_instruction_set();
+
+/**
+ * Appends RowID{chunk_id, first_chunk_offset + i} to matches for each i in [0, size) where
+ * `values[i] <predicate_condition> search_value` holds. Only Equals, NotEquals, LessThan, LessThanEquals, GreaterThan,
+ * and GreaterThanEquals are supported.
+ */
+template <typename T>
+void simd_scan_values(const T* values, size_t size, PredicateCondition predicate_condition, T search_value,
+                      ChunkID chunk_id, ChunkOffset first_chunk_offset, PosList& matches,
+                      SimdInstructionSet instruction_set = detect_simd_instruction_set());
+
+// Returns true if simd_scan_values() can be used for the given predicate condition
+bool simd_scan_supports_predicate_condition(PredicateCondition predicate_condition);
+
+/**
+ * Appends RowID{chunk_id, i} to matches for each value at position i of a SIMD-BP128-compressed vector (usually the
+ * attribute vector of a dictionary segment) that lies within [lower_bound, upper_bound). Equals, LessThan, and
+ * Between predicates on ValueIDs can all be expressed as such a range.
+ *
+ * Instead of going through SimdBp128Iterator, which decompresses meta blocks of 2,048 values, the vector is processed
+ * block by block. As all values of a block fit into the bit size stored in its meta info, blocks in which all or none
+ * of the values lie within the range are detected without unpacking them. All other blocks are unpacked into a buffer
+ * of 128 values and evaluated using simd_scan_values().
+ */
+void simd_scan_simd_bp128_range(const SimdBp128Vector& vector, uint32_t lower_bound, uint32_t upper_bound,
+                                ChunkID chunk_id, PosList& matches);
+
+// Column data types and offset types used by FixedSizeByteAlignedVector
+extern template void simd_scan_values(const int32_t*, size_t, PredicateCondition, int32_t, ChunkID, ChunkOffset,
+                                      PosList&, SimdInstructionSet);
+extern template void simd_scan_values(const int64_t*, size_t, PredicateCondition, int64_t, ChunkID, ChunkOffset,
+                                      PosList&, SimdInstructionSet);
+extern template void simd_scan_values(const float*, size_t, PredicateCondition, float, ChunkID, ChunkOffset, PosList&,
+                                      SimdInstructionSet);
+extern template void simd_scan_values(const double*, size_t, PredicateCondition, double, ChunkID, ChunkOffset,
+                                      PosList&, SimdInstructionSet);
+extern template void simd_scan_values(const uint8_t*, size_t, PredicateCondition, uint8_t, ChunkID, ChunkOffset,
+                                      PosList&, SimdInstructionSet);
+extern template void simd_scan_values(const uint16_t*, size_t, PredicateCondition, uint16_t, ChunkID, ChunkOffset,
+                                      PosList&, SimdInstructionSet);
+extern template void simd_scan_values(const uint32_t*, size_t, PredicateCondition, uint32_t, ChunkID, ChunkOffset,
+                                      PosList&, SimdInstructionSet);
+
+}  // namespace opossum
@@ -0,0 +1,169 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/materialize_sorted_rows.hpp"
+#include "sort/normalized_sort_key.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The rows of one chunk that might be part of the result, together with their normalized keys
+struct TopKCandidates {
+  std::vector<unsigned char> keys;
+  std::vector<RowID> row_ids;
+};
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  Assert(!_sort_definitions.empty(), "Expected at least one column to sort by");
+}
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = input_table_left();
+
+  /**
+   * Evaluate the _row_count_expression to determine k
+   */
+  const auto num_rows_expression_result =
+      ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*_row_count_expression);
+  Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for TopK");
+  Assert(!num_rows_expression_result->is_null(0), "Expected non-null for TopK");
+
+  const auto signed_num_rows = num_rows_expression_result->value(0);
+  Assert(signed_num_rows >= 0, "Can't TopK to a negative number of Rows");
+
+  const auto num_rows = std::min(static_cast<size_t>(signed_num_rows), static_cast<size_t>(input_table->row_count()));
+
+  if (num_rows == 0) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  }
+
+  const auto layout = create_normalized_sort_key_layout(*input_table, _sort_definitions);
+  const auto key_width = layout.key_width;
+
+  /**
+   * Determine the k smallest rows of each chunk
+   */
+  const auto chunk_count = input_table->chunk_count();
+  auto candidates_by_chunk = std::vector<TopKCandidates>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+
+      auto keys = std::vector<unsigned char>(chunk_size * key_width);
+      write_normalized_sort_keys(*input_table, chunk_id, _sort_definitions, layout, keys.data());
+
+      // Later rows lose ties, which keeps the result stable
+      const auto less = [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+        const auto comparison = std::memcmp(&keys[lhs * key_width], &keys[rhs * key_width], key_width);
+        return comparison < 0 || (comparison == 0 && lhs < rhs);
+      };
+
+      // Max-heap of the smallest rows seen so far, its top is the first row to be replaced
+      auto heap = std::vector<ChunkOffset>{};
+      heap.reserve(std::min(num_rows, static_cast<size_t>(chunk_size)));
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (heap.size() < num_rows) {
+          heap.emplace_back(chunk_offset);
+          std::push_heap(heap.begin(), heap.end(), less);
+        } else if (less(chunk_offset, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), less);
+          heap.back() = chunk_offset;
+          std::push_heap(heap.begin(), heap.end(), less);
+        }
+      }
+
+      auto& candidates = candidates_by_chunk[chunk_id];
+      candidates.keys.resize(heap.size() * key_width);
+      candidates.row_ids.reserve(heap.size());
+      for (auto candidate_idx = size_t{0}; candidate_idx < heap.size(); ++candidate_idx) {
+        std::memcpy(&candidates.keys[candidate_idx * key_width], &keys[heap[candidate_idx] * key_width], key_width);
+        candidates.row_ids.emplace_back(RowID{chunk_id, heap[candidate_idx]});
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * Merge the candidates of all chunks
+   */
+  auto candidate_keys = std::vector<const unsigned char*>{};
+  auto candidate_row_ids = std::vector<RowID>{};
+  for (const auto& candidates : candidates_by_chunk) {
+    for (auto candidate_idx = size_t{0}; candidate_idx < candidates.row_ids.size(); ++candidate_idx) {
+      candidate_keys.emplace_back(&candidates.keys[candidate_idx * key_width]);
+      candidate_row_ids.emplace_back(candidates.row_ids[candidate_idx]);
+    }
+  }
+
+  // Ties are broken by the RowID, i.e., the position in the input
+  auto permutation = std::vector<size_t>(candidate_row_ids.size());
+  std::iota(permutation.begin(), permutation.end(), size_t{0});
+  std::partial_sort(permutation.begin(), permutation.begin() + num_rows, permutation.end(),
+                    [&](const size_t lhs, const size_t rhs) {
+                      const auto comparison = std::memcmp(candidate_keys[lhs], candidate_keys[rhs], key_width);
+                      return comparison < 0 || (comparison == 0 && candidate_row_ids[lhs] < candidate_row_ids[rhs]);
+                    });
+
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(num_rows);
+  for (auto row_idx = size_t{0}; row_idx < num_rows; ++row_idx) {
+    row_ids.emplace_back(candidate_row_ids[permutation[row_idx]]);
+  }
+
+  auto output = materialize_sorted_rows(input_table, row_ids, Chunk::DEFAULT_SIZE);
+
+  const auto& primary_definition = _sort_definitions.front();
+  for (auto& chunk : output->chunks()) {
+    chunk->set_ordered_by(std::make_pair(primary_definition.column, primary_definition.order_by_mode));
+  }
+
+  return output;
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+}  // namespace opossum
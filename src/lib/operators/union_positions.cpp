@@ -1,6 +1,8 @@
 #include "union_positions.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <numeric>
@@ -8,6 +10,10 @@
 #include <utility>
 #include <vector>
 
+#include "memory/arena_memory_resource.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
@@ -47,6 +53,15 @@
  *      _column_cluster_offsets = {0, 2, 3}
  *
  *
+ * ### Bitmap-based union
+ * Most inputs (e.g., the two sides of an OR predicate split up by the PredicateSplitUpRule) consist of a single
+ * ColumnCluster. In this case, no sorting is needed: For each chunk of the referenced table, a bitmap with one bit per
+ * row is set by concurrent jobs for the chunks of both inputs. Then, one job per referenced chunk turns its bitmap into
+ * the PosList of an output chunk. Thus, the output has the same order as with the sort-based union and each row is
+ * contained exactly once. NULL_ROW_IDs cannot be put into a bitmap and are emitted as often as they appear in the input
+ * that contains more of them, which matches the sort-based union.
+ *
+ *
  * ### TODO(anybody) for potential performance improvements
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
@@ -75,6 +90,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (_column_cluster_offsets.size() == 1) {
+    return _union_with_bitmaps();
+  }
+
   /**
    * For each input, create a ReferenceMatrix
    */
@@ -109,8 +128,20 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
 
   auto out_table = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
 
+  // Somewhat random way to decide on a chunk size.
+  const auto out_chunk_size = std::max(input_table_left()->max_chunk_size(), input_table_right()->max_chunk_size());
+
+  // The PosLists are allocated from the arena of the query, if there is one. As the arena does not reuse memory, they
+  // are reserved for an entire chunk right away.
+  const auto arena = this->arena();
+  const auto create_pos_list = [&]() {
+    auto pos_list = make_shared_in_arena<PosList>(arena);
+    pos_list->reserve(std::min(size_t{out_chunk_size}, num_rows_left + num_rows_right - left_idx - right_idx));
+    return pos_list;
+  };
+
   std::vector<std::shared_ptr<PosList>> pos_lists(reference_matrix_left.size());
-  std::generate(pos_lists.begin(), pos_lists.end(), [&] { return std::make_shared<PosList>(); });
+  std::generate(pos_lists.begin(), pos_lists.end(), create_pos_list);
 
   // Adds the row `row_idx` from `reference_matrix` to the pos_lists we're currently building
   const auto emit_row = [&](const ReferenceMatrix& reference_matrix, size_t row_idx) {
@@ -144,9 +175,6 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
    * time as merging the two ReferenceMatrices
    */
 
-  // Somewhat random way to decide on a chunk size.
-  const auto out_chunk_size = std::max(input_table_left()->max_chunk_size(), input_table_right()->max_chunk_size());
-
   size_t chunk_row_idx = 0;
   for (; left_idx < num_rows_left || right_idx < num_rows_right;) {
     /**
@@ -183,7 +211,7 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
       emit_chunk();
 
       chunk_row_idx = 0;
-      std::generate(pos_lists.begin(), pos_lists.end(), [&] { return std::make_shared<PosList>(); });
+      std::generate(pos_lists.begin(), pos_lists.end(), create_pos_list);
     }
   }
 
@@ -308,6 +336,96 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_with_bitmaps() const {
+  const auto& referenced_table = _referenced_tables.front();
+  const auto referenced_chunk_count = referenced_table->chunk_count();
+
+  constexpr auto BITS_PER_WORD = size_t{64};
+  using Bitmap = std::vector<std::atomic<uint64_t>>;
+
+  auto bitmaps = std::vector<Bitmap>(referenced_chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    // Chunks can be removed by the MvccDeletePlugin, but then they are not referenced anymore
+    const auto chunk = referenced_table->get_chunk(chunk_id);
+    if (chunk) bitmaps[chunk_id] = Bitmap((chunk->size() + BITS_PER_WORD - 1) / BITS_PER_WORD);
+  }
+
+  const auto input_tables = std::array<std::shared_ptr<const Table>, 2>{input_table_left(), input_table_right()};
+  auto null_row_counts = std::array<std::atomic<size_t>, 2>{};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto input_idx = size_t{0}; input_idx < input_tables.size(); ++input_idx) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_tables[input_idx]->chunk_count(); ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, input_idx, chunk_id]() {
+        const auto segment = input_tables[input_idx]->get_chunk(chunk_id)->get_segment(ColumnID{0});
+        const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+
+        auto null_row_count = size_t{0};
+        for (const auto& row_id : pos_list) {
+          if (row_id.is_null()) {
+            ++null_row_count;
+            continue;
+          }
+          bitmaps[row_id.chunk_id][row_id.chunk_offset / BITS_PER_WORD].fetch_or(
+              uint64_t{1} << (row_id.chunk_offset % BITS_PER_WORD), std::memory_order_relaxed);
+        }
+        null_row_counts[input_idx] += null_row_count;
+      }));
+      jobs.back()->schedule();
+    }
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // The PosLists are allocated from the arena of the query, if there is one
+  const auto arena = this->arena();
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>(referenced_chunk_count);
+
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& bitmap = bitmaps[chunk_id];
+
+      auto row_count = size_t{0};
+      for (const auto& word : bitmap) {
+        row_count += __builtin_popcountll(word.load(std::memory_order_relaxed));
+      }
+      if (row_count == 0) return;
+
+      auto pos_list = make_shared_in_arena<PosList>(arena);
+      pos_list->reserve(row_count);
+      for (auto word_idx = size_t{0}; word_idx < bitmap.size(); ++word_idx) {
+        for (auto word = bitmap[word_idx].load(std::memory_order_relaxed); word != 0; word &= word - 1) {
+          const auto chunk_offset = word_idx * BITS_PER_WORD + __builtin_ctzll(word);
+          pos_list->emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+        }
+      }
+      pos_list->guarantee_single_chunk();
+      pos_lists[chunk_id] = pos_list;
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  const auto null_row_count = std::max(null_row_counts[0].load(), null_row_counts[1].load());
+  if (null_row_count > 0) {
+    pos_lists.emplace_back(make_shared_in_arena<PosList>(arena, null_row_count, NULL_ROW_ID));
+  }
+
+  auto out_table = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+  for (const auto& pos_list : pos_lists) {
+    if (!pos_list) continue;
+
+    Segments output_segments;
+    for (auto column_id = ColumnID{0}; column_id < input_table_left()->column_count(); ++column_id) {
+      output_segments.push_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], pos_list));
+    }
+    out_table->append_chunk(output_segments);
+  }
+
+  return out_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
@@ -107,6 +107,12 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * If all columns reference the same table with the same PosLists (i.e., there is a single ColumnCluster), the union
+   * is computed with a bitmap over the rows of each referenced chunk instead of sorting the ReferenceMatrices.
+   */
+  std::shared_ptr<const Table> _union_with_bitmaps() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                       const ReferenceMatrix& right_matrix, size_t right_row_idx) const;
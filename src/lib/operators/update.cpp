@@ -1,6 +1,8 @@
 #include "update.hpp"
 
+#include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -8,11 +10,64 @@
 #include "concurrency/transaction_context.hpp"
 #include "delete.hpp"
 #include "insert.hpp"
+#include "resolve_type.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
 #include "table_wrapper.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns a reference table that only contains the rows at @param offsets of each chunk of @param table. Segments of
+// the same chunk that share a PosList keep sharing it, as Delete requires.
+std::shared_ptr<Table> filter_rows(const std::shared_ptr<const Table>& table,
+                                   const std::vector<std::vector<ChunkOffset>>& offsets) {
+  const auto filtered_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk_offsets = offsets[chunk_id];
+    if (chunk_offsets.empty()) continue;
+
+    const auto chunk = table->get_chunk(chunk_id);
+
+    // Maps the PosList of an input segment to the filtered one. Data segments are keyed by nullptr.
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    Segments segments;
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      const auto input_pos_list = reference_segment ? reference_segment->pos_list() : nullptr;
+
+      auto& filtered_pos_list = filtered_pos_lists[input_pos_list];
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(chunk_offsets.size());
+        for (const auto chunk_offset : chunk_offsets) {
+          filtered_pos_list->emplace_back(input_pos_list ? (*input_pos_list)[chunk_offset]
+                                                         : RowID{chunk_id, chunk_offset});
+        }
+      }
+
+      if (reference_segment) {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(
+            reference_segment->referenced_table(), reference_segment->referenced_column_id(), filtered_pos_list));
+      } else {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, filtered_pos_list));
+      }
+    }
+
+    filtered_table->append_chunk(segments);
+  }
+
+  return filtered_table;
+}
+
+}  // namespace
+
 namespace opossum {
 
 Update::Update(const std::string& table_to_update_name, const std::shared_ptr<AbstractOperator>& fields_to_update_op,
@@ -32,10 +87,26 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   DebugAssert(input_table_left()->column_data_types() == input_table_right()->column_data_types(),
               "Update required identical layouts from its input tables");
 
-  // 1. Delete obsolete data with the Delete operator.
+  // 1. Overwrite the rows that were inserted by this transaction. Only the other rows are deleted and inserted again.
+  auto fields_to_update_op = mutable_input_left();
+  auto update_values_op = mutable_input_right();
+
+  const auto remaining_offsets = _update_in_place(table_to_update, context->transaction_id());
+  const auto remaining_row_count =
+      std::accumulate(remaining_offsets.begin(), remaining_offsets.end(), size_t{0},
+                      [](const auto sum, const auto& chunk_offsets) { return sum + chunk_offsets.size(); });
+
+  if (remaining_row_count < input_table_left()->row_count()) {
+    fields_to_update_op = std::make_shared<TableWrapper>(filter_rows(input_table_left(), remaining_offsets));
+    update_values_op = std::make_shared<TableWrapper>(filter_rows(input_table_right(), remaining_offsets));
+    fields_to_update_op->execute();
+    update_values_op->execute();
+  }
+
+  // 2. Delete obsolete data with the Delete operator.
   //    Delete doesn't accept empty input data
-  if (input_table_left()->row_count() > 0) {
-    _delete = std::make_shared<Delete>(_input_left);
+  if (remaining_row_count > 0) {
+    _delete = std::make_shared<Delete>(fields_to_update_op);
     _delete->set_transaction_context(context);
     _delete->execute();
 
@@ -45,8 +116,8 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
-  // 2. Insert new data with the Insert operator.
-  _insert = std::make_shared<Insert>(_table_to_update_name, _input_right);
+  // 3. Insert new data with the Insert operator.
+  _insert = std::make_shared<Insert>(_table_to_update_name, update_values_op);
   _insert->set_transaction_context(context);
   _insert->execute();
   // Insert cannot fail in the MVCC sense, no check necessary
@@ -54,6 +125,70 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   return nullptr;
 }
 
+std::vector<std::vector<ChunkOffset>> Update::_update_in_place(const std::shared_ptr<Table>& table_to_update,
+                                                               const TransactionID transaction_id) {
+  const auto fields_to_update = input_table_left();
+  const auto update_values = input_table_right();
+  const auto column_count = fields_to_update->column_count();
+
+  auto remaining_offsets = std::vector<std::vector<ChunkOffset>>(fields_to_update->chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < fields_to_update->chunk_count(); ++chunk_id) {
+    const auto fields_chunk = fields_to_update->get_chunk(chunk_id);
+    const auto values_chunk = update_values->get_chunk(chunk_id);
+    DebugAssert(fields_chunk->size() == values_chunk->size(), "Update requires aligned chunks in its input tables");
+
+    const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(fields_chunk->get_segment(ColumnID{0}));
+    const auto& pos_list = *first_segment->pos_list();
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < fields_chunk->size(); ++chunk_offset) {
+      const auto& row_id = pos_list[chunk_offset];
+      const auto referenced_chunk = table_to_update->get_chunk(row_id.chunk_id);
+
+      // Only rows inserted (and not yet committed) by this transaction are invisible to all others
+      auto is_own_row = false;
+      {
+        const auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+        is_own_row = mvcc_data->tids[row_id.chunk_offset] == transaction_id &&
+                     mvcc_data->get_begin_cid(row_id.chunk_offset) == MvccData::MAX_COMMIT_ID;
+      }
+
+      // Collect the changed columns. If one of them cannot be overwritten, the whole row gets a new version.
+      auto changed_column_ids = std::vector<ColumnID>{};
+      auto can_update_in_place = is_own_row;
+      for (auto column_id = ColumnID{0}; column_id < column_count && can_update_in_place; ++column_id) {
+        const auto new_value = (*values_chunk->get_segment(column_id))[chunk_offset];
+        if ((*fields_chunk->get_segment(column_id))[chunk_offset] == new_value) continue;
+
+        const auto data_type = table_to_update->column_data_type(column_id);
+        const auto& segment = referenced_chunk->get_segment(column_id);
+        can_update_in_place = data_type != DataType::String && !variant_is_null(new_value) &&
+                              std::dynamic_pointer_cast<BaseValueSegment>(segment);
+        changed_column_ids.emplace_back(column_id);
+      }
+
+      if (!can_update_in_place) {
+        remaining_offsets[chunk_id].emplace_back(chunk_offset);
+        continue;
+      }
+
+      for (const auto column_id : changed_column_ids) {
+        const auto new_value = (*values_chunk->get_segment(column_id))[chunk_offset];
+        resolve_data_type(table_to_update->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          const auto value_segment =
+              std::static_pointer_cast<ValueSegment<ColumnDataType>>(referenced_chunk->get_segment(column_id));
+          value_segment->values()[row_id.chunk_offset] = type_cast_variant<ColumnDataType>(new_value);
+          // The new value is never NULL (see above), but the old one may have been
+          if (value_segment->is_nullable()) value_segment->null_values()[row_id.chunk_offset] = false;
+        });
+      }
+    }
+  }
+
+  return remaining_offsets;
+}
+
 std::shared_ptr<AbstractOperator> Update::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -22,6 +22,13 @@ class Insert;
  *
  * Assumption: The input has been validated before.
  *
+ * Generally, an updated row is deleted and inserted again with the new values, i.e., a new version of the entire row
+ * is appended to the table. Rows that were inserted by the same transaction are not visible to any other transaction,
+ * though. If only fixed-width columns of such a row change and it is still stored in ValueSegments, the new values
+ * overwrite the old ones in place. Rows committed by other transactions cannot be updated in place, as the operators
+ * read the segments directly and only Validate knows about row versions. Their versions are merged by the
+ * MvccDeletePlugin.
+ *
  * Note: Update does not support null values at the moment
  */
 class Update : public AbstractReadWriteOperator {
@@ -38,6 +45,11 @@ class Update : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
+  // Overwrites the rows that can be updated in place (see above). Returns the offsets of the other rows per chunk of
+  // the input tables.
+  std::vector<std::vector<ChunkOffset>> _update_in_place(const std::shared_ptr<Table>& table_to_update,
+                                                         const TransactionID transaction_id);
+
   // Commit happens in Insert and Delete operators
   void _on_commit_records(const CommitID cid) override {}
 
@@ -1,6 +1,9 @@
 #include "validate.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,12 +16,84 @@ namespace opossum {
 
 namespace {
 
-bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
-                    const MvccData& mvcc_data) {
-  const auto row_tid = mvcc_data.tids[chunk_offset].load();
-  const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
-  const auto end_cid = mvcc_data.end_cids[chunk_offset];
-  return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
+// Number of rows whose visibility is evaluated together
+constexpr auto BLOCK_SIZE = size_t{64};
+
+/**
+ * Evaluates the visibility of row_count rows of a chunk, whose offsets are given by chunk_offset_at(index), block by
+ * block and calls on_block(block_begin, block_size, is_visible) for each block.
+ *
+ * The MVCC vectors are concurrent_vectors that are not stored contiguously and the tids are atomics. Thus, the MVCC
+ * data of a block is first gathered into local arrays. The visibility of the entire block is then evaluated without
+ * branches, so that the comparisons are vectorized.
+ */
+template <typename ChunkOffsetAt, typename OnBlock>
+void evaluate_visibility(const size_t row_count, const ChunkOffsetAt& chunk_offset_at, const MvccData& mvcc_data,
+                         const TransactionID our_tid, const CommitID snapshot_commit_id, const OnBlock& on_block) {
+  const auto is_frozen = mvcc_data.is_frozen();
+
+  // If the chunk was locked or deleted as a whole, this replaces the tids and limits the end_cids of all rows
+  const auto chunk_tid = mvcc_data.chunk_tid.load();
+  const auto chunk_end_cid = mvcc_data.chunk_end_cid.load();
+
+  auto tids = std::array<TransactionID, BLOCK_SIZE>{};
+  auto begin_cids = std::array<CommitID, BLOCK_SIZE>{};
+  auto end_cids = std::array<CommitID, BLOCK_SIZE>{};
+  auto is_visible = std::array<uint8_t, BLOCK_SIZE>{};
+
+  for (auto block_begin = size_t{0}; block_begin < row_count; block_begin += BLOCK_SIZE) {
+    const auto block_size = std::min(BLOCK_SIZE, row_count - block_begin);
+
+    if (is_frozen) {
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        const auto chunk_offset = chunk_offset_at(block_begin + index);
+        tids[index] = mvcc_data.tids[chunk_offset].load();
+        begin_cids[index] = mvcc_data.get_begin_cid(chunk_offset);
+        end_cids[index] = mvcc_data.get_end_cid(chunk_offset);
+      }
+    } else {
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        const auto chunk_offset = chunk_offset_at(block_begin + index);
+        tids[index] = mvcc_data.tids[chunk_offset].load();
+        begin_cids[index] = mvcc_data.begin_cids[chunk_offset];
+        end_cids[index] = std::min(mvcc_data.end_cids[chunk_offset], chunk_end_cid);
+      }
+    }
+
+    if (chunk_tid != 0) std::fill(tids.begin(), tids.begin() + block_size, chunk_tid);
+
+    // The entire block is evaluated, so that the loop has a constant trip count. Entries beyond block_size are ignored.
+    // NOLINTNEXTLINE
+    ;  // clang-format off
+    #pragma omp simd safelen(BLOCK_SIZE)
+    // clang-format on
+    for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+      is_visible[index] = Validate::is_row_visible(our_tid, snapshot_commit_id, tids[index], begin_cids[index],
+                                                   end_cids[index]);
+    }
+
+    on_block(block_begin, block_size, is_visible.data());
+  }
+}
+
+// Appends row_id_at(index) to pos_list_out for all visible rows. As in the SIMD scan kernels, every RowID is written
+// and the output is only advanced for visible rows (i.e., a compress-store), which avoids mispredicted branches.
+template <typename RowIDAt>
+void append_visible_rows(const size_t row_count, const RowIDAt& row_id_at, const MvccData& mvcc_data,
+                         const TransactionID our_tid, const CommitID snapshot_commit_id, PosList& pos_list_out) {
+  auto output_index = pos_list_out.size();
+  pos_list_out.resize(output_index + row_count);
+
+  const auto chunk_offset_at = [&](const size_t index) { return row_id_at(index).chunk_offset; };
+  evaluate_visibility(row_count, chunk_offset_at, mvcc_data, our_tid, snapshot_commit_id,
+                      [&](const size_t block_begin, const size_t block_size, const uint8_t* is_visible) {
+                        for (auto index = size_t{0}; index < block_size; ++index) {
+                          pos_list_out[output_index] = row_id_at(block_begin + index);
+                          output_index += is_visible[index];
+                        }
+                      });
+
+  pos_list_out.resize(output_index);
 }
 
 }  // namespace
@@ -34,15 +109,32 @@ bool Validate::is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, con
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+bool Validate::is_entire_chunk_visible(const Chunk& chunk, const CommitID snapshot_commit_id) {
+  if (chunk.is_mutable() || !chunk.has_mvcc_data()) return false;
+
+  // If no row was ever locked or invalidated, all transaction ids are 0 and all end_cids are MAX_COMMIT_ID
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  return !mvcc_data->has_invalidated_rows && mvcc_data->max_begin_cid <= snapshot_commit_id;
+}
+
+bool Validate::is_entire_chunk_invisible(const Chunk& chunk, const CommitID snapshot_commit_id) {
+  if (!chunk.has_mvcc_data()) return false;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  return mvcc_data->chunk_end_cid <= snapshot_commit_id;
+}
+
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
-    : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
+    : AbstractChunkwiseOperator(OperatorType::Validate, in) {}
 
 const std::string Validate::name() const { return "Validate"; }
 
 std::shared_ptr<AbstractOperator> Validate::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Validate>(copied_input_left);
+  auto copy = std::make_shared<Validate>(copied_input_left);
+  copy->set_row_count_hint(_row_count_hint);
+  return copy;
 }
 
 void Validate::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -51,98 +143,166 @@ std::shared_ptr<const Table> Validate::_on_execute() {
   Fail("Validate can't be called without a transaction context.");
 }
 
-std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
-  DebugAssert(transaction_context != nullptr, "Validate requires a valid TransactionContext.");
+void Validate::_on_prepare_chunks(const std::shared_ptr<TransactionContext>& transaction_context) {
+  Assert(transaction_context, "Validate can't be called without a transaction context.");
   DebugAssert(transaction_context->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
+}
 
-  const auto in_table = input_table_left();
-  auto output = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
-
+std::shared_ptr<Chunk> Validate::_on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                                   const std::shared_ptr<TransactionContext>& transaction_context) {
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
-
-    Segments output_segments;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
-
-    // If the segments in this chunk reference a segment, build a poslist for a reference segment.
-    if (ref_segment_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+  const auto chunk_in = in_table->get_chunk(chunk_id);
+
+  Segments output_segments;
+  auto pos_list_out = std::make_shared<PosList>();
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
+
+  // Chunks that only reference visible rows are forwarded unchanged, those that only reference rows of a deleted chunk
+  // are dropped
+  if (ref_segment_in) {
+    const auto& pos_list_in = *ref_segment_in->pos_list();
+    if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
+      const auto referenced_chunk = ref_segment_in->referenced_table()->get_chunk(pos_list_in.common_chunk_id());
+      if (is_entire_chunk_invisible(*referenced_chunk, snapshot_commit_id)) return nullptr;
+
+      if (is_entire_chunk_visible(*referenced_chunk, snapshot_commit_id)) {
+        auto output_chunk = std::make_shared<Chunk>(chunk_in->segments());
+        if (chunk_in->ordered_by()) output_chunk->set_ordered_by(*chunk_in->ordered_by());
+        return output_chunk;
+      }
+    }
+  }
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_segment_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+  // If the segments in this chunk reference a segment, build a poslist for a reference segment.
+  if (ref_segment_in) {
+    DebugAssert(chunk_in->references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
 
-      const auto& pos_list_in = *ref_segment_in->pos_list();
-      if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
-        // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_segment_in->referenced_table();
+    DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
 
-        pos_list_out->guarantee_single_chunk();
+    const auto& pos_list_in = *ref_segment_in->pos_list();
+    if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
+      // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
 
-        const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      pos_list_out->guarantee_single_chunk();
 
-        for (auto row_id : pos_list_in) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            pos_list_out->emplace_back(row_id);
-          }
-        }
+      const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
+      auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
 
-      } else {
-        // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
+      append_visible_rows(
+          pos_list_in.size(), [&](const size_t index) { return pos_list_in[index]; }, *mvcc_data, our_tid,
+          snapshot_commit_id, *pos_list_out);
 
-        for (auto row_id : pos_list_in) {
-          const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+    } else {
+      // Slow path - we are looking at multiple referenced chunks. The positions are grouped by referenced chunk
+      // using a counting sort, so that the MVCC data of each chunk is locked once and its rows are evaluated block by
+      // block. The visibility is recorded per input position, so that the output keeps the order of the input.
+      const auto referenced_chunk_count = referenced_table->chunk_count();
+      const auto input_size = pos_list_in.size();
+
+      auto group_begins = std::vector<size_t>(referenced_chunk_count + 1);
+      for (const auto& row_id : pos_list_in) {
+        ++group_begins[row_id.chunk_id + 1];
+      }
+      std::partial_sum(group_begins.begin(), group_begins.end(), group_begins.begin());
 
-          auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      auto grouped_indices = std::vector<size_t>(input_size);
+      auto group_ends = std::vector<size_t>(group_begins.begin(), group_begins.end() - 1);
+      for (auto index = size_t{0}; index < input_size; ++index) {
+        grouped_indices[group_ends[pos_list_in[index].chunk_id]++] = index;
+      }
 
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            pos_list_out->emplace_back(row_id);
+      auto is_visible = std::vector<uint8_t>(input_size);
+      for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+        const auto group_begin = group_begins[chunk_id];
+        const auto group_size = group_begins[chunk_id + 1] - group_begin;
+        if (group_size == 0) continue;
+
+        const auto referenced_chunk = referenced_table->get_chunk(chunk_id);
+        if (is_entire_chunk_invisible(*referenced_chunk, snapshot_commit_id)) continue;
+        if (is_entire_chunk_visible(*referenced_chunk, snapshot_commit_id)) {
+          for (auto index = group_begin; index < group_begin + group_size; ++index) {
+            is_visible[grouped_indices[index]] = 1;
           }
+          continue;
         }
+
+        const auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+        const auto chunk_offset_at = [&](const size_t index) {
+          return pos_list_in[grouped_indices[group_begin + index]].chunk_offset;
+        };
+        evaluate_visibility(group_size, chunk_offset_at, *mvcc_data, our_tid, snapshot_commit_id,
+                            [&](const size_t block_begin, const size_t block_size, const uint8_t* block_is_visible) {
+                              for (auto index = size_t{0}; index < block_size; ++index) {
+                                is_visible[grouped_indices[group_begin + block_begin + index]] =
+                                    block_is_visible[index];
+                              }
+                            });
       }
 
-      // Construct the actual ReferenceSegment objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
-        const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+      pos_list_out->resize(input_size);
+      auto output_index = size_t{0};
+      for (auto index = size_t{0}; index < input_size; ++index) {
+        (*pos_list_out)[output_index] = pos_list_in[index];
+        output_index += is_visible[index];
       }
+      pos_list_out->resize(output_index);
+    }
 
-      // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
-      const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
-      pos_list_out->guarantee_single_chunk();
+    // Construct the actual ReferenceSegment objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      const auto reference_segment =
+          std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+      const auto referenced_column_id = reference_segment->referenced_column_id();
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
+    }
 
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
+    // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
+    if (is_entire_chunk_invisible(*chunk_in, snapshot_commit_id)) return nullptr;
+    pos_list_out->guarantee_single_chunk();
+
+    // Generate pos_list_out.
+    auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
+    if (is_entire_chunk_visible(*chunk_in, snapshot_commit_id)) {
+      pos_list_out->reserve(chunk_size);
       for (auto i = 0u; i < chunk_size; i++) {
-        if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
-        }
-      }
-
-      // Create actual ReferenceSegment objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+        pos_list_out->emplace_back(RowID{chunk_id, i});
       }
+    } else {
+      const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
+      append_visible_rows(
+          chunk_size, [&](const size_t index) { return RowID{chunk_id, static_cast<ChunkOffset>(index)}; },
+          *mvcc_data, our_tid, snapshot_commit_id, *pos_list_out);
     }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_segments);
+    // Create actual ReferenceSegment objects.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
     }
   }
-  return output;
+
+  if (pos_list_out->empty()) return nullptr;
+
+  // Removing invisible rows does not change the order of the remaining ones
+  auto output_chunk = std::make_shared<Chunk>(output_segments);
+  if (chunk_in->ordered_by()) output_chunk->set_ordered_by(*chunk_in->ordered_by());
+
+  return output_chunk;
+}
+
+std::shared_ptr<Table> Validate::_create_output_table(const Table& in_table,
+                                                      const std::vector<std::shared_ptr<Chunk>>& output_chunks) const {
+  return std::make_shared<Table>(in_table.column_definitions(), TableType::References);
 }
 
 }  // namespace opossum
@@ -4,7 +4,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -16,7 +16,7 @@ namespace opossum {
  *
  * Assumption: Validate happens before joins.
  */
-class Validate : public AbstractReadOnlyOperator {
+class Validate : public AbstractChunkwiseOperator {
  public:
   explicit Validate(const std::shared_ptr<AbstractOperator>& in);
 
@@ -26,9 +26,22 @@ class Validate : public AbstractReadOnlyOperator {
   static bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                              const CommitID begin_cid, const CommitID end_cid);
 
+  // Returns true if all rows of the chunk are visible to transactions with the given snapshot, so that they do not need
+  // to be checked one by one. This is the case for immutable chunks without deleted rows and without rows inserted
+  // after the snapshot. Chunks for which this cannot be determined cheaply are reported as not visible.
+  static bool is_entire_chunk_visible(const Chunk& chunk, const CommitID snapshot_commit_id);
+
+  // Returns true if the chunk was deleted as a whole (see MvccData::chunk_end_cid) at or before the snapshot, so that
+  // none of its rows are visible
+  static bool is_entire_chunk_invisible(const Chunk& chunk, const CommitID snapshot_commit_id);
+
  protected:
-  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
+  void _on_prepare_chunks(const std::shared_ptr<TransactionContext>& transaction_context) override;
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                           const std::shared_ptr<TransactionContext>& transaction_context) override;
+  std::shared_ptr<Table> _create_output_table(const Table& in_table,
+                                              const std::vector<std::shared_ptr<Chunk>>& output_chunks) const override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -0,0 +1,593 @@
+#include "window.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "aggregate/aggregate_traits.hpp"
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_sort_key.hpp"
+#include "sort/parallel_sort.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Partitions are processed by JobTasks that cover at least this many rows
+constexpr auto WINDOW_JOB_MIN_ROW_COUNT = size_t{1} << 14;
+
+// The rows of the input, sorted by their PARTITION BY and ORDER BY columns. Positions are indices into `row_indices`.
+struct SortedRows {
+  // For every position, the index of the row in the input (i.e., counted across all chunks)
+  std::vector<size_t> row_indices;
+
+  // The [begin, end) positions of the partitions
+  std::vector<std::pair<size_t, size_t>> partitions;
+
+  // For every position, the first and last position (exclusive) of its peers. Only set if they are needed.
+  std::vector<size_t> peer_begins;
+  std::vector<size_t> peer_ends;
+};
+
+bool is_ranking_function(const WindowFunction window_function) {
+  return window_function == WindowFunction::RowNumber || window_function == WindowFunction::Rank ||
+         window_function == WindowFunction::DenseRank;
+}
+
+DataType window_function_data_type(const WindowFunctionDefinition& definition, const Table& table) {
+  if (is_ranking_function(definition.window_function) || definition.window_function == WindowFunction::Count) {
+    return DataType::Long;
+  }
+
+  const auto argument_data_type = table.column_data_type(*definition.argument_column_id);
+  if (definition.window_function == WindowFunction::Avg) return DataType::Double;
+
+  // MIN and MAX of Dates and Timestamps as well as MIN, MAX, and SUM of Decimals keep their logical data type (see
+  // AggregateExpression::data_type())
+  if (is_logical_data_type(argument_data_type)) return argument_data_type;
+
+  auto data_type = argument_data_type;
+  resolve_data_type(argument_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (definition.window_function == WindowFunction::Sum) {
+        data_type = AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
+      }
+    }
+  });
+  return data_type;
+}
+
+// The non-NULL values of a frame, aggregated for all window aggregate functions at once
+template <typename ValueType, typename SumType>
+struct FrameAggregate {
+  void add(const ValueType& value) {
+    if constexpr (std::is_arithmetic_v<ValueType>) sum += value;
+    if (count == 0 || value < min) min = value;
+    if (count == 0 || max < value) max = value;
+    ++count;
+  }
+
+  void add(const FrameAggregate& other) {
+    if (other.count == 0) return;
+    if constexpr (std::is_arithmetic_v<ValueType>) sum += other.sum;
+    if (count == 0 || other.min < min) min = other.min;
+    if (count == 0 || max < other.max) max = other.max;
+    count += other.count;
+  }
+
+  SumType sum{};
+  int64_t count{0};
+  ValueType min{};
+  ValueType max{};
+};
+
+// A segment tree over the values of a partition, which aggregates any range of positions in O(log n)
+template <typename Aggregate>
+class SegmentTree {
+ public:
+  explicit SegmentTree(std::vector<Aggregate>&& leaves) : _leaf_count(leaves.size()), _nodes(2 * leaves.size()) {
+    std::move(leaves.begin(), leaves.end(), _nodes.begin() + _leaf_count);
+    for (auto node_idx = _leaf_count - 1; node_idx > 0; --node_idx) {
+      _nodes[node_idx] = _nodes[2 * node_idx];
+      _nodes[node_idx].add(_nodes[2 * node_idx + 1]);
+    }
+  }
+
+  // Aggregate of the leaves [begin, end)
+  Aggregate query(size_t begin, size_t end) const {
+    auto aggregate = Aggregate{};
+    for (begin += _leaf_count, end += _leaf_count; begin < end; begin /= 2, end /= 2) {
+      if (begin & 1) aggregate.add(_nodes[begin++]);
+      if (end & 1) aggregate.add(_nodes[--end]);
+    }
+    return aggregate;
+  }
+
+ private:
+  const size_t _leaf_count;
+  std::vector<Aggregate> _nodes;
+};
+
+// Sorts the rows by the partition and order columns and determines the partitions (and, if requested, the peers)
+SortedRows sort_rows(const Table& table, const std::vector<size_t>& chunk_begins,
+                     const WindowFunctionDefinition& definition, const bool determine_peers) {
+  const auto row_count = chunk_begins.back();
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (const auto column_id : definition.partition_by_column_ids) {
+    sort_definitions.emplace_back(column_id, OrderByMode::Ascending);
+  }
+  sort_definitions.insert(sort_definitions.end(), definition.order_by_definitions.begin(),
+                          definition.order_by_definitions.end());
+
+  const auto layout = create_normalized_sort_key_layout(table, sort_definitions);
+  const auto key_width = layout.key_width;
+
+  // Each sort column contributes a NULL byte and its value to the key, the partition columns come first
+  auto partition_key_width = size_t{0};
+  for (auto column_idx = size_t{0}; column_idx < definition.partition_by_column_ids.size(); ++column_idx) {
+    partition_key_width += 1 + layout.value_widths[column_idx];
+  }
+
+  auto sorted_rows = SortedRows{};
+  auto keys = std::vector<unsigned char>(row_count * key_width);
+
+  // Ties are broken by the row index, so that the rows of a partition keep their input order if there is no ORDER BY
+  const auto compare_rows = [&](const size_t lhs, const size_t rhs) {
+    if (key_width == 0) return lhs < rhs;
+    const auto comparison = std::memcmp(keys.data() + lhs * key_width, keys.data() + rhs * key_width, key_width);
+    return comparison < 0 || (comparison == 0 && lhs < rhs);
+  };
+
+  const auto chunk_count = table.chunk_count();
+  auto runs = std::vector<std::vector<size_t>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_begin = chunk_begins[chunk_id];
+      write_normalized_sort_keys(table, chunk_id, sort_definitions, layout, keys.data() + chunk_begin * key_width);
+
+      auto& run = runs[chunk_id];
+      run.resize(chunk_begins[chunk_id + 1] - chunk_begin);
+      std::iota(run.begin(), run.end(), chunk_begin);
+      if (key_width > 0) std::sort(run.begin(), run.end(), compare_rows);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  sorted_rows.row_indices = merge_sorted_runs(std::move(runs), compare_rows);
+  const auto& row_indices = sorted_rows.row_indices;
+
+  const auto keys_equal = [&](const size_t lhs_position, const size_t rhs_position, const size_t width) {
+    return width == 0 || std::memcmp(keys.data() + row_indices[lhs_position] * key_width,
+                                     keys.data() + row_indices[rhs_position] * key_width, width) == 0;
+  };
+
+  auto partition_begin = size_t{0};
+  for (auto position = size_t{1}; position <= row_count; ++position) {
+    if (position == row_count || !keys_equal(position - 1, position, partition_key_width)) {
+      sorted_rows.partitions.emplace_back(partition_begin, position);
+      partition_begin = position;
+    }
+  }
+
+  if (determine_peers) {
+    sorted_rows.peer_begins.resize(row_count);
+    sorted_rows.peer_ends.resize(row_count);
+
+    auto peer_begin = size_t{0};
+    for (auto position = size_t{1}; position <= row_count; ++position) {
+      if (position == row_count || !keys_equal(position - 1, position, key_width)) {
+        std::fill(sorted_rows.peer_begins.begin() + peer_begin, sorted_rows.peer_begins.begin() + position, peer_begin);
+        std::fill(sorted_rows.peer_ends.begin() + peer_begin, sorted_rows.peer_ends.begin() + position, position);
+        peer_begin = position;
+      }
+    }
+  }
+
+  return sorted_rows;
+}
+
+// Calls the functor for batches of partitions with at least WINDOW_JOB_MIN_ROW_COUNT rows, each in its own JobTask
+template <typename Functor>
+void for_each_partition_in_parallel(const SortedRows& sorted_rows, const Functor& functor) {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  const auto partition_count = sorted_rows.partitions.size();
+  auto batch_begin = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    const auto batch_row_count =
+        sorted_rows.partitions[partition_idx].second - sorted_rows.partitions[batch_begin].first;
+    if (batch_row_count < WINDOW_JOB_MIN_ROW_COUNT && partition_idx + 1 < partition_count) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, batch_begin, batch_end = partition_idx + 1]() {
+      for (auto batch_partition_idx = batch_begin; batch_partition_idx < batch_end; ++batch_partition_idx) {
+        const auto [partition_begin, partition_end] = sorted_rows.partitions[batch_partition_idx];
+        functor(partition_begin, partition_end);
+      }
+    }));
+    batch_begin = partition_idx + 1;
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+// Splits the results, which are indexed by the rows' positions in the input, into one segment per chunk
+template <typename ResultType>
+Segments create_segments(std::vector<ResultType>&& results, std::vector<bool>&& nulls,
+                         const std::vector<size_t>& chunk_begins) {
+  auto segments = Segments{};
+  segments.reserve(chunk_begins.size() - 1);
+
+  for (auto chunk_idx = size_t{0}; chunk_idx + 1 < chunk_begins.size(); ++chunk_idx) {
+    const auto begin = chunk_begins[chunk_idx];
+    const auto end = chunk_begins[chunk_idx + 1];
+
+    auto chunk_results = std::vector<ResultType>(std::make_move_iterator(results.begin() + begin),
+                                                 std::make_move_iterator(results.begin() + end));
+    if (nulls.empty()) {
+      segments.emplace_back(std::make_shared<ValueSegment<ResultType>>(std::move(chunk_results)));
+    } else {
+      auto chunk_nulls = std::vector<bool>(nulls.begin() + begin, nulls.begin() + end);
+      segments.emplace_back(
+          std::make_shared<ValueSegment<ResultType>>(std::move(chunk_results), std::move(chunk_nulls)));
+    }
+  }
+
+  return segments;
+}
+
+// ROW_NUMBER(), RANK(), and DENSE_RANK()
+Segments compute_ranking_function(const WindowFunction window_function, const SortedRows& sorted_rows,
+                                  const std::vector<size_t>& chunk_begins) {
+  auto results = std::vector<int64_t>(chunk_begins.back());
+
+  for_each_partition_in_parallel(sorted_rows, [&](const size_t partition_begin, const size_t partition_end) {
+    auto dense_rank = int64_t{0};
+    for (auto position = partition_begin; position < partition_end; ++position) {
+      auto& result = results[sorted_rows.row_indices[position]];
+      switch (window_function) {
+        case WindowFunction::RowNumber:
+          result = static_cast<int64_t>(position - partition_begin + 1);
+          break;
+        case WindowFunction::Rank:
+          result = static_cast<int64_t>(sorted_rows.peer_begins[position] - partition_begin + 1);
+          break;
+        case WindowFunction::DenseRank:
+          if (sorted_rows.peer_begins[position] == position) ++dense_rank;
+          result = dense_rank;
+          break;
+        default:
+          Fail("Not a ranking function");
+      }
+    }
+  });
+
+  return create_segments(std::move(results), {}, chunk_begins);
+}
+
+// SUM, AVG, COUNT, MIN, and MAX over frames
+template <typename ColumnDataType>
+Segments compute_aggregate_function(const Table& table, const WindowFunctionDefinition& definition,
+                                    const SortedRows& sorted_rows, const std::vector<size_t>& chunk_begins) {
+  using SumType = std::conditional_t<std::is_arithmetic_v<ColumnDataType>,
+                                     std::conditional_t<std::is_integral_v<ColumnDataType>, int64_t, double>, int64_t>;
+  using Aggregate = FrameAggregate<ColumnDataType, SumType>;
+
+  const auto window_function = definition.window_function;
+  const auto row_count = chunk_begins.back();
+
+  // Materialize the values of the argument, NULLs are not part of any aggregate. COUNT(*) counts all rows.
+  auto values = std::vector<ColumnDataType>{};
+  auto value_is_null = std::vector<bool>{};
+  if (definition.argument_column_id) {
+    values.resize(row_count);
+    value_is_null.resize(row_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        const auto chunk_begin = chunk_begins[chunk_id];
+        const auto& segment = *table.get_chunk(chunk_id)->get_segment(*definition.argument_column_id);
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          const auto row_idx = chunk_begin + position.chunk_offset();
+          if (position.is_null()) {
+            value_is_null[row_idx] = true;
+          } else {
+            values[row_idx] = position.value();
+          }
+        });
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  }
+
+  const auto leaf = [&](const size_t position) {
+    auto aggregate = Aggregate{};
+    if (!definition.argument_column_id) {
+      aggregate.count = 1;
+    } else if (const auto row_idx = sorted_rows.row_indices[position]; !value_is_null[row_idx]) {
+      aggregate.add(values[row_idx]);
+    }
+    return aggregate;
+  };
+
+  const auto& frame = definition.frame;
+  const auto is_rows_frame = frame.type == WindowFrameType::Rows;
+
+  // The output has the type of the AggregateTraits, but Decimal sums are stored as int64_t like their input
+  using SumResultType = std::conditional_t<std::is_arithmetic_v<ColumnDataType>, SumType, ColumnDataType>;
+  auto sums = std::vector<SumResultType>{};
+  auto averages = std::vector<double>{};
+  auto counts = std::vector<int64_t>{};
+  auto extrema = std::vector<ColumnDataType>{};
+  switch (window_function) {
+    case WindowFunction::Sum:
+      sums.resize(row_count);
+      break;
+    case WindowFunction::Avg:
+      averages.resize(row_count);
+      break;
+    case WindowFunction::Count:
+      counts.resize(row_count);
+      break;
+    default:
+      extrema.resize(row_count);
+  }
+  auto nulls = std::vector<bool>(window_function == WindowFunction::Count ? 0 : row_count);
+
+  const auto write_result = [&](const size_t position, const Aggregate& aggregate) {
+    const auto row_idx = sorted_rows.row_indices[position];
+    if (window_function == WindowFunction::Count) {
+      counts[row_idx] = aggregate.count;
+      return;
+    }
+
+    if (aggregate.count == 0) {
+      nulls[row_idx] = true;
+      return;
+    }
+
+    switch (window_function) {
+      case WindowFunction::Sum:
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) sums[row_idx] = aggregate.sum;
+        break;
+      case WindowFunction::Avg:
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          averages[row_idx] = static_cast<double>(aggregate.sum) / static_cast<double>(aggregate.count);
+        }
+        break;
+      case WindowFunction::Min:
+        extrema[row_idx] = aggregate.min;
+        break;
+      case WindowFunction::Max:
+        extrema[row_idx] = aggregate.max;
+        break;
+      default:
+        Fail("Not an aggregate window function");
+    }
+  };
+
+  for_each_partition_in_parallel(sorted_rows, [&](const size_t partition_begin, const size_t partition_end) {
+    // Returns the frame [begin, end) of the row at the position
+    const auto frame_of = [&](const size_t position) {
+      auto begin = partition_begin;
+      if (frame.preceding) {
+        const auto preceding = std::min(*frame.preceding, static_cast<uint64_t>(position - partition_begin));
+        begin = is_rows_frame ? position - preceding : sorted_rows.peer_begins[position];
+      }
+
+      auto end = partition_end;
+      if (frame.following) {
+        const auto following = std::min(*frame.following, static_cast<uint64_t>(partition_end - position - 1));
+        end = is_rows_frame ? position + 1 + following : sorted_rows.peer_ends[position];
+      }
+
+      return std::make_pair(begin, end);
+    };
+
+    if (!frame.preceding) {
+      // All frames start at the beginning of the partition and their ends never decrease, so the aggregate of the
+      // previous frame is extended by the rows that were added
+      auto aggregate = Aggregate{};
+      auto aggregated_end = partition_begin;
+      for (auto position = partition_begin; position < partition_end; ++position) {
+        const auto frame_end = frame_of(position).second;
+        for (; aggregated_end < frame_end; ++aggregated_end) {
+          aggregate.add(leaf(aggregated_end));
+        }
+        write_result(position, aggregate);
+      }
+      return;
+    }
+
+    auto leaves = std::vector<Aggregate>{};
+    leaves.reserve(partition_end - partition_begin);
+    for (auto position = partition_begin; position < partition_end; ++position) {
+      leaves.emplace_back(leaf(position));
+    }
+    const auto segment_tree = SegmentTree<Aggregate>{std::move(leaves)};
+
+    for (auto position = partition_begin; position < partition_end; ++position) {
+      const auto [frame_begin, frame_end] = frame_of(position);
+      write_result(position, segment_tree.query(frame_begin - partition_begin, frame_end - partition_begin));
+    }
+  });
+
+  switch (window_function) {
+    case WindowFunction::Sum:
+      return create_segments(std::move(sums), std::move(nulls), chunk_begins);
+    case WindowFunction::Avg:
+      return create_segments(std::move(averages), std::move(nulls), chunk_begins);
+    case WindowFunction::Count:
+      return create_segments(std::move(counts), {}, chunk_begins);
+    default:
+      return create_segments(std::move(extrema), std::move(nulls), chunk_begins);
+  }
+}
+
+// References cannot be combined with the computed ValueSegments, so referenced columns are materialized
+std::shared_ptr<BaseSegment> materialize_segment(const Table& table, const ChunkID chunk_id, const ColumnID column_id) {
+  const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+  auto materialized_segment = std::shared_ptr<BaseSegment>{};
+
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto values = std::vector<ColumnDataType>(segment.size());
+    auto nulls = std::vector<bool>(table.column_is_nullable(column_id) ? segment.size() : 0);
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        nulls[position.chunk_offset()] = true;
+      } else {
+        values[position.chunk_offset()] = position.value();
+      }
+    });
+
+    if (nulls.empty()) {
+      materialized_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    } else {
+      materialized_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls));
+    }
+  });
+
+  return materialized_segment;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Window::Window(const std::shared_ptr<const AbstractOperator>& in,
+               const std::vector<WindowFunctionDefinition>& window_function_definitions)
+    : AbstractReadOnlyOperator(OperatorType::Window, in), _window_function_definitions(window_function_definitions) {
+  for (const auto& definition : _window_function_definitions) {
+    Assert(is_ranking_function(definition.window_function) != static_cast<bool>(definition.argument_column_id) ||
+               definition.window_function == WindowFunction::Count,
+           "Only aggregate window functions have an argument");
+    Assert(definition.frame.type == WindowFrameType::Rows ||
+               ((!definition.frame.preceding || *definition.frame.preceding == 0) &&
+                (!definition.frame.following || *definition.frame.following == 0)),
+           "RANGE frames only support UNBOUNDED and CURRENT ROW bounds");
+  }
+}
+
+const std::vector<WindowFunctionDefinition>& Window::window_function_definitions() const {
+  return _window_function_definitions;
+}
+
+const std::string Window::name() const { return "Window"; }
+
+const std::string Window::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << "[Window]";
+  for (const auto& definition : _window_function_definitions) {
+    stream << separator << definition.column_name;
+  }
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> Window::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Window>(copied_input_left, _window_function_definitions);
+}
+
+void Window::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Window::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto output_column_definitions = input_table->column_definitions();
+  for (const auto& definition : _window_function_definitions) {
+    const auto nullable = !is_ranking_function(definition.window_function) &&
+                          definition.window_function != WindowFunction::Count;
+    output_column_definitions.emplace_back(definition.column_name,
+                                           window_function_data_type(definition, *input_table), nullable);
+  }
+
+  // The segments of the window functions, by window function and chunk
+  auto window_function_segments = std::vector<Segments>{};
+  window_function_segments.reserve(_window_function_definitions.size());
+  for (const auto& definition : _window_function_definitions) {
+    window_function_segments.emplace_back(_compute_window_function(*input_table, definition));
+  }
+
+  const auto output_table = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      if (input_table->type() == TableType::Data) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      } else {
+        segments.emplace_back(materialize_segment(*input_table, chunk_id, column_id));
+      }
+    }
+
+    for (const auto& segments_of_window_function : window_function_segments) {
+      segments.emplace_back(segments_of_window_function[chunk_id]);
+    }
+
+    output_table->append_chunk(segments);
+  }
+
+  return output_table;
+}
+
+Segments Window::_compute_window_function(const Table& table, const WindowFunctionDefinition& definition) const {
+  const auto chunk_count = table.chunk_count();
+
+  // The rows are identified by their index across all chunks
+  auto chunk_begins = std::vector<size_t>(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_begins[chunk_id + 1] = chunk_begins[chunk_id] + table.get_chunk(chunk_id)->size();
+  }
+
+  // Peers are needed to rank rows and for the bounds of RANGE frames
+  const auto& frame = definition.frame;
+  const auto determine_peers = definition.window_function == WindowFunction::Rank ||
+                               definition.window_function == WindowFunction::DenseRank ||
+                               (frame.type == WindowFrameType::Range && (frame.preceding || frame.following));
+  const auto sorted_rows = sort_rows(table, chunk_begins, definition, determine_peers);
+
+  if (is_ranking_function(definition.window_function)) {
+    return compute_ranking_function(definition.window_function, sorted_rows, chunk_begins);
+  }
+
+  // COUNT(*) does not read any values
+  const auto argument_data_type =
+      definition.argument_column_id ? table.column_data_type(*definition.argument_column_id) : DataType::Int;
+  Assert(definition.window_function == WindowFunction::Min || definition.window_function == WindowFunction::Max ||
+             definition.window_function == WindowFunction::Count ||
+             (definition.window_function == WindowFunction::Sum && argument_data_type == DataType::Decimal) ||
+             (!is_logical_data_type(argument_data_type) && argument_data_type != DataType::String),
+         "SUM and AVG require numeric arguments");
+
+  auto segments = Segments{};
+  resolve_data_type(physical_data_type(argument_data_type), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    segments = compute_aggregate_function<ColumnDataType>(table, definition, sorted_rows, chunk_begins);
+  });
+  return segments;
+}
+
+}  // namespace opossum
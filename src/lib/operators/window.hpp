@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+struct WindowFunctionDefinition final {
+  WindowFunction window_function;
+
+  // std::nullopt for ROW_NUMBER(), RANK(), DENSE_RANK(), and COUNT(*)
+  std::optional<ColumnID> argument_column_id;
+
+  std::vector<ColumnID> partition_by_column_ids;
+  std::vector<SortColumnDefinition> order_by_definitions;
+  WindowFrame frame;
+
+  std::string column_name;
+};
+
+/**
+ * Computes window functions (e.g., `ROW_NUMBER() OVER (PARTITION BY a ORDER BY b)` or running totals). The output
+ * contains the input columns, followed by one column per WindowFunctionDefinition. The rows keep their input order.
+ *
+ * For every window function, the input rows are sorted by their PARTITION BY and ORDER BY columns at once, using the
+ * normalized keys of the Sort (see normalized_sort_key.hpp). Partitions and peers (i.e., rows with equal ORDER BY
+ * values) are then found by comparing the key prefixes of neighbouring rows. Finally, batches of partitions are
+ * processed by parallel JobTasks in a single pass: Frames that start at the beginning of the partition are aggregated
+ * incrementally, other frames are looked up in a segment tree of the partition's values.
+ */
+class Window : public AbstractReadOnlyOperator {
+ public:
+  Window(const std::shared_ptr<const AbstractOperator>& in,
+         const std::vector<WindowFunctionDefinition>& window_function_definitions);
+
+  const std::vector<WindowFunctionDefinition>& window_function_definitions() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Returns the output segments of the window function, one per input chunk
+  Segments _compute_window_function(const Table& table, const WindowFunctionDefinition& definition) const;
+
+  const std::vector<WindowFunctionDefinition> _window_function_definitions;
+};
+
+}  // namespace opossum
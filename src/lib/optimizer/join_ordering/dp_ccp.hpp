@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 #include "abstract_join_ordering_algorithm.hpp"
 
 namespace opossum {
@@ -17,7 +19,12 @@ namespace opossum {
  */
 class DpCcp final : public AbstractJoinOrderingAlgorithm {
  public:
-  explicit DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  /**
+   * @param max_csg_cmp_pair_count  Give up on JoinGraphs with more CsgCmpPairs than this. Each CsgCmpPair is a candidate
+   *                                plan that needs to be costed, so this bounds the time spent in DpCcp.
+   */
+  explicit DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                 const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
 
   /**
    * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. DpCcp is only applied
@@ -25,8 +32,12 @@ class DpCcp final : public AbstractJoinOrderingAlgorithm {
    * @return                An LQP consisting of
    *                         * the operations from the JoinGraph in an optimal order
    *                         * the subplans from the vertices below them
+   *                        or nullptr if the JoinGraph has more than max_csg_cmp_pair_count CsgCmpPairs.
    */
   std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph);
+
+ private:
+  const size_t _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
@@ -17,8 +17,9 @@
 
 namespace opossum {
 
-EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges)
-    : _num_vertices(num_vertices), _edges(std::move(edges)) {
+EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+                           const size_t max_csg_cmp_pair_count)
+    : _num_vertices(num_vertices), _edges(std::move(edges)), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {
   // DPccp should not be used for queries with a table count on the scale of 64 because of complexity reasons
   Assert(num_vertices < sizeof(unsigned long) * 8, "Too many vertices, EnumerateCcp relies on to_ulong()");  // NOLINT
 
@@ -59,6 +60,8 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
     for (const auto& csg : csgs) {
       _enumerate_cmp(csg);
     }
+
+    if (_exceeded_max_csg_cmp_pair_count) return {};
   }
 
 #if HYRISE_DEBUG
@@ -87,6 +90,8 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
   return _csg_cmp_pairs;
 }
 
+bool EnumerateCcp::exceeded_max_csg_cmp_pair_count() const { return _exceeded_max_csg_cmp_pair_count; }
+
 void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
                                             const JoinGraphVertexSet& exclusion_set) {
   /**
@@ -94,7 +99,19 @@ void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csg
    * For each newly found connected subgraph, calls itself recursively.
    */
 
+  // Enumerating the connected subgraphs is work, too, and their number grows about as fast as that of the
+  // CsgCmpPairs. Thus, they count towards max_csg_cmp_pair_count as well. Check before materializing the subsets of
+  // the neighborhood, as there are 2^|neighborhood| of them.
+  if (_exceeded_max_csg_cmp_pair_count) return;
+
   const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+  const auto neighborhood_size = neighborhood.count();
+  if (neighborhood_size >= sizeof(size_t) * 8 - 1 ||
+      csgs.size() + (size_t{1} << neighborhood_size) - 1 > _max_csg_cmp_pair_count) {
+    _exceeded_max_csg_cmp_pair_count = true;
+    return;
+  }
+
   const auto neighborhood_subsets = _non_empty_subsets(neighborhood);
   const auto extended_exclusion_set = exclusion_set | neighborhood;
 
@@ -112,6 +129,8 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
    * Find complements to the connected subgraph `primary_vertex_set`
    */
 
+  if (_exceeded_max_csg_cmp_pair_count) return;
+
   const auto exclusion_set = _exclusion_set(primary_vertex_set.find_first()) | primary_vertex_set;
   const auto neighborhood = _neighborhood(primary_vertex_set, exclusion_set);
 
@@ -138,6 +157,11 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
     for (const auto& csg : csgs) {
       _csg_cmp_pairs.emplace_back(std::make_pair(primary_vertex_set, csg));
     }
+
+    if (_csg_cmp_pairs.size() > _max_csg_cmp_pair_count) {
+      _exceeded_max_csg_cmp_pair_count = true;
+      return;
+    }
   }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -54,11 +55,20 @@ using CsgCmpPair = std::pair<JoinGraphVertexSet, JoinGraphVertexSet>;
  */
 class EnumerateCcp final {
  public:
-  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges);
+  /**
+   * @param max_csg_cmp_pair_count    Stop the enumeration once more than this many CsgCmpPairs were found. The number
+   *                                  of CsgCmpPairs grows exponentially with the number of vertices in dense graphs,
+   *                                  so this allows for cheaply finding out whether a graph is small enough for DPccp.
+   */
+  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+               const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
 
   // Corresponds to EnumerateCsg in the paper
   std::vector<CsgCmpPair> operator()();
 
+  // Whether operator() stopped early because of max_csg_cmp_pair_count. It returned no CsgCmpPairs in that case.
+  bool exceeded_max_csg_cmp_pair_count() const;
+
  private:
   // Corresponds to EnumerateCsgRec in the paper
   void _enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
@@ -80,6 +90,8 @@ class EnumerateCcp final {
 
   const size_t _num_vertices;
   const std::vector<std::pair<size_t, size_t>> _edges;
+  const size_t _max_csg_cmp_pair_count;
+  bool _exceeded_max_csg_cmp_pair_count{false};
 
   std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
 
@@ -0,0 +1,140 @@
+#include "linearized_dp.hpp"
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "cost_model/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LinearizedDp::LinearizedDp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
+    : AbstractJoinOrderingAlgorithm(cost_estimator) {}
+
+std::shared_ptr<AbstractLQPNode> LinearizedDp::operator()(const JoinGraph& join_graph) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+
+  /**
+   * 1. Build the plans of the single vertices with their local predicates and collect the uncorrelated predicates,
+   *    which are placed on top of the final plan.
+   */
+  auto vertex_plans = std::vector<std::shared_ptr<AbstractLQPNode>>(vertex_count);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    vertex_plans[vertex_idx] =
+        _add_predicates_to_plan(join_graph.vertices[vertex_idx], join_graph.find_local_predicates(vertex_idx));
+  }
+
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (!edge.vertex_set.none()) continue;
+    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  /**
+   * 2. Linearize the vertices: Start with the vertex with the lowest cardinality and repeatedly append the connected
+   *    vertex that yields the lowest cardinality when joined with the vertices that were already ordered.
+   */
+  auto order = std::vector<size_t>{};
+  order.reserve(vertex_count);
+
+  auto first_vertex_idx = size_t{0};
+  for (auto vertex_idx = size_t{1}; vertex_idx < vertex_count; ++vertex_idx) {
+    if (vertex_plans[vertex_idx]->get_statistics()->row_count() <
+        vertex_plans[first_vertex_idx]->get_statistics()->row_count()) {
+      first_vertex_idx = vertex_idx;
+    }
+  }
+  order.emplace_back(first_vertex_idx);
+
+  auto ordered_vertex_set = JoinGraphVertexSet{vertex_count};
+  ordered_vertex_set.set(first_vertex_idx);
+  auto ordered_plan = vertex_plans[first_vertex_idx];
+
+  while (order.size() < vertex_count) {
+    auto best_vertex_idx = std::optional<size_t>{};
+    auto best_plan = std::shared_ptr<AbstractLQPNode>{};
+    auto best_cardinality = std::numeric_limits<float>::max();
+
+    for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+      if (ordered_vertex_set[vertex_idx]) continue;
+
+      auto vertex_set = JoinGraphVertexSet{vertex_count};
+      vertex_set.set(vertex_idx);
+      const auto join_predicates = join_graph.find_join_predicates(ordered_vertex_set, vertex_set);
+      if (join_predicates.empty()) continue;
+
+      const auto plan = _add_join_to_plan(ordered_plan, vertex_plans[vertex_idx], join_predicates);
+      const auto cardinality = plan->get_statistics()->row_count();
+      if (!best_vertex_idx || cardinality < best_cardinality) {
+        best_vertex_idx = vertex_idx;
+        best_plan = plan;
+        best_cardinality = cardinality;
+      }
+    }
+
+    // No vertex is connected to the ordered ones, the JoinGraph could only be joined using cross products
+    if (!best_vertex_idx) return nullptr;
+
+    order.emplace_back(*best_vertex_idx);
+    ordered_vertex_set.set(*best_vertex_idx);
+    ordered_plan = best_plan;
+  }
+
+  /**
+   * 3. Dynamic programming over the ranges of the linear order. best_plans[begin][end] holds the cheapest plan joining
+   *    the vertices order[begin] to order[end], or nullptr if these vertices can't be joined without cross products.
+   *    Each range is split into two smaller ranges at every possible position.
+   */
+  auto vertex_sets = std::vector<std::vector<JoinGraphVertexSet>>(vertex_count);
+  auto best_plans = std::vector<std::vector<std::shared_ptr<AbstractLQPNode>>>(vertex_count);
+  auto best_costs = std::vector<std::vector<Cost>>(vertex_count);
+  for (auto begin = size_t{0}; begin < vertex_count; ++begin) {
+    vertex_sets[begin].resize(vertex_count, JoinGraphVertexSet{vertex_count});
+    best_plans[begin].resize(vertex_count);
+    best_costs[begin].resize(vertex_count);
+
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    for (auto end = begin; end < vertex_count; ++end) {
+      vertex_set.set(order[end]);
+      vertex_sets[begin][end] = vertex_set;
+    }
+
+    best_plans[begin][begin] = vertex_plans[order[begin]];
+  }
+
+  for (auto range_size = size_t{2}; range_size <= vertex_count; ++range_size) {
+    for (auto begin = size_t{0}; begin + range_size <= vertex_count; ++begin) {
+      const auto end = begin + range_size - 1;
+
+      for (auto split = begin; split < end; ++split) {
+        const auto& left_plan = best_plans[begin][split];
+        const auto& right_plan = best_plans[split + 1][end];
+        if (!left_plan || !right_plan) continue;
+
+        const auto join_predicates =
+            join_graph.find_join_predicates(vertex_sets[begin][split], vertex_sets[split + 1][end]);
+        if (join_predicates.empty()) continue;
+
+        const auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates);
+        const auto candidate_cost = _cost_estimator->estimate_plan_cost(candidate_plan);
+        if (!best_plans[begin][end] || candidate_cost < best_costs[begin][end]) {
+          best_plans[begin][end] = candidate_plan;
+          best_costs[begin][end] = candidate_cost;
+        }
+      }
+    }
+  }
+
+  // The linearization appended only connected vertices, so the range of all vertices has at least the left-deep plan
+  const auto& result_plan = best_plans[0][vertex_count - 1];
+  Assert(result_plan, "No plan for all vertices generated");
+
+  return _add_predicates_to_plan(result_plan, uncorrelated_predicates);
+}
+
+}  // namespace opossum
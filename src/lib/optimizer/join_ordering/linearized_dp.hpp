@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm for JoinGraphs that are too large for DpCcp, following "Adaptive Optimization of Very Large
+ * Join Queries" (Neumann, Radke; SIGMOD 2018).
+ *
+ * The vertices are first brought into a linear order. Then, dynamic programming finds the cheapest bushy plan in which
+ * every subplan joins a contiguous range of that order. This needs O(n^3) candidate plans instead of the exponential
+ * number DpCcp might need for dense JoinGraphs, but still considers far more plans than GreedyOperatorOrdering.
+ *
+ * The paper obtains the linear order from IKKBZ, which requires a cost function with the adjacent sequence interchange
+ * property. Our cost models do not have it, so the order is built greedily instead: Starting with the vertex with the
+ * lowest cardinality, the vertex producing the lowest join cardinality with the vertices ordered so far is appended.
+ */
+class LinearizedDp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  explicit LinearizedDp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  /**
+   * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. LinearizedDp is only
+   *                        applied to this particular JoinGraph and doesn't modify the subplans in the vertices.
+   * @return                An LQP consisting of
+   *                         * the operations from the JoinGraph in the cheapest order found
+   *                         * the subplans from the vertices below them
+   *                        or nullptr if the JoinGraph can't be joined without cross products.
+   */
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph);
+};
+
+}  // namespace opossum
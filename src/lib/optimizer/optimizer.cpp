@@ -1,6 +1,8 @@
 #include "optimizer.hpp"
 
+#include <chrono>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "cost_model/cost_model_logical.hpp"
@@ -9,15 +11,24 @@
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
+#include "strategy/column_group_statistics_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
+#include "strategy/common_subexpression_elimination_rule.hpp"
+#include "strategy/eager_aggregation_rule.hpp"
 #include "strategy/exists_reformulation_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
+#include "strategy/group_by_reduction_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/insert_limit_in_exists_rule.hpp"
+#include "strategy/join_elimination_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
+#include "strategy/limit_pushdown_rule.hpp"
+#include "strategy/materialized_view_rule.hpp"
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
+#include "strategy/subquery_to_join_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 #include "utils/performance_warning.hpp"
 
 /**
@@ -50,8 +61,13 @@ using namespace opossum;  // NOLINT
 using SubqueryExpressionsByLQP =
     std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, std::vector<std::shared_ptr<LQPSubqueryExpression>>>>;
 
+// Indices into SubqueryExpressionsByLQP, grouped by the hash of the LQP. Only LQPs with the same hash need to be
+// compared, which avoids comparing every subquery LQP with every other one.
+using SubqueryLQPIndicesByHash = std::unordered_multimap<size_t, size_t>;
+
 // See comment at the top of file for the purpose of this.
 void collect_subquery_expressions_by_lqp(SubqueryExpressionsByLQP& subquery_expressions_by_lqp,
+                                         SubqueryLQPIndicesByHash& subquery_lqp_indices_by_hash,
                                          const std::shared_ptr<AbstractLQPNode>& node,
                                          std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
   if (!node) return;
@@ -62,20 +78,26 @@ void collect_subquery_expressions_by_lqp(SubqueryExpressionsByLQP& subquery_expr
       const auto subquery_expression = std::dynamic_pointer_cast<LQPSubqueryExpression>(sub_expression);
       if (!subquery_expression) return ExpressionVisitation::VisitArguments;
 
-      for (auto& [lqp, subquery_expressions] : subquery_expressions_by_lqp) {
+      const auto lqp_hash = subquery_expression->lqp->hash();
+      const auto [begin, end] = subquery_lqp_indices_by_hash.equal_range(lqp_hash);
+      for (auto iter = begin; iter != end; ++iter) {
+        auto& [lqp, subquery_expressions] = subquery_expressions_by_lqp[iter->second];
         if (*lqp == *subquery_expression->lqp) {
           subquery_expressions.emplace_back(subquery_expression);
           return ExpressionVisitation::DoNotVisitArguments;
         }
       }
+      subquery_lqp_indices_by_hash.emplace(lqp_hash, subquery_expressions_by_lqp.size());
       subquery_expressions_by_lqp.emplace_back(subquery_expression->lqp, std::vector{subquery_expression});
 
       return ExpressionVisitation::DoNotVisitArguments;
     });
   }
 
-  collect_subquery_expressions_by_lqp(subquery_expressions_by_lqp, node->left_input(), visited_nodes);
-  collect_subquery_expressions_by_lqp(subquery_expressions_by_lqp, node->right_input(), visited_nodes);
+  collect_subquery_expressions_by_lqp(subquery_expressions_by_lqp, subquery_lqp_indices_by_hash, node->left_input(),
+                                      visited_nodes);
+  collect_subquery_expressions_by_lqp(subquery_expressions_by_lqp, subquery_lqp_indices_by_hash, node->right_input(),
+                                      visited_nodes);
 }
 
 }  // namespace
@@ -85,6 +107,9 @@ namespace opossum {
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   auto optimizer = std::make_shared<Optimizer>();
 
+  // Match the views before any other rule changes the subplans
+  optimizer->add_rule(std::make_unique<MaterializedViewRule>());
+
   optimizer->add_rule(std::make_unique<ExpressionReductionRule>());
 
   optimizer->add_rule(std::make_unique<PredicateSplitUpRule>());
@@ -94,10 +119,20 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<ExistsReformulationRule>());
 
+  optimizer->add_rule(std::make_unique<SubqueryToJoinRule>());
+
   optimizer->add_rule(std::make_unique<InsertLimitInExistsRule>());
 
+  // Runs after the SubqueryToJoinRule, which creates semi joins, and before the JoinOrderingRule
+  optimizer->add_rule(std::make_unique<JoinEliminationRule>());
+
+  optimizer->add_rule(std::make_unique<GroupByReductionRule>());
+
   optimizer->add_rule(std::make_unique<ChunkPruningRule>());
 
+  // Generate the statistics of correlated columns before the JoinOrderingRule estimates the LQP
+  optimizer->add_rule(std::make_unique<ColumnGroupStatisticsRule>());
+
   optimizer->add_rule(std::make_unique<JoinOrderingRule>(std::make_unique<CostModelLogical>()));
 
   // Position the predicates after the JoinOrderingRule ran. The JOR manipulates predicate placement as well, but
@@ -109,18 +144,38 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<IndexScanRule>());
 
+  // Runs after the JoinOrderingRule, as the partial AggregateNodes would split up the join graphs
+  optimizer->add_rule(std::make_unique<EagerAggregationRule>(std::make_unique<CostModelLogical>()));
+
+  optimizer->add_rule(std::make_unique<TopKRule>());
+
+  // Runs before the LimitPushdownRule, so that the ProjectionNodes it inserts receive row count hints
+  optimizer->add_rule(std::make_unique<CommonSubexpressionEliminationRule>());
+
+  // Runs after the TopKRule, as TopK operators consume their entire input
+  optimizer->add_rule(std::make_unique<LimitPushdownRule>());
+
   return optimizer;
 }
 
 void Optimizer::add_rule(std::unique_ptr<AbstractRule> rule) { _rules.emplace_back(std::move(rule)); }
 
-std::shared_ptr<AbstractLQPNode> Optimizer::optimize(const std::shared_ptr<AbstractLQPNode>& input) const {
+std::shared_ptr<AbstractLQPNode> Optimizer::optimize(const std::shared_ptr<AbstractLQPNode>& input,
+                                                     std::vector<OptimizerRuleMetrics>* rule_metrics) const {
   // Add explicit root node, so the rules can freely change the tree below it without having to maintain a root node
   // to return to the Optimizer
   const auto root_node = LogicalPlanRootNode::make(input);
 
   for (const auto& rule : _rules) {
+    const auto started = std::chrono::high_resolution_clock::now();
+
     _apply_rule(*rule, root_node);
+
+    if (rule_metrics) {
+      const auto duration = std::chrono::high_resolution_clock::now() - started;
+      rule_metrics->emplace_back(
+          OptimizerRuleMetrics{rule->name(), std::chrono::duration_cast<std::chrono::nanoseconds>(duration)});
+    }
   }
 
   // Remove LogicalPlanRootNode
@@ -137,8 +192,10 @@ void Optimizer::_apply_rule(const AbstractRule& rule, const std::shared_ptr<Abst
    * Optimize Subqueries
    */
   auto subquery_expressions_by_lqp = SubqueryExpressionsByLQP{};
+  auto subquery_lqp_indices_by_hash = SubqueryLQPIndicesByHash{};
   auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
-  collect_subquery_expressions_by_lqp(subquery_expressions_by_lqp, root_node, visited_nodes);
+  collect_subquery_expressions_by_lqp(subquery_expressions_by_lqp, subquery_lqp_indices_by_hash, root_node,
+                                      visited_nodes);
 
   for (const auto& [lqp, subquery_expressions] : subquery_expressions_by_lqp) {
     const auto local_root_node = LogicalPlanRootNode::make(lqp);
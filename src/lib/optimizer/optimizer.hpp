@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace opossum {
@@ -8,6 +10,12 @@ namespace opossum {
 class AbstractRule;
 class AbstractLQPNode;
 
+// Time spent in a single rule (including the subqueries it optimized) during Optimizer::optimize()
+struct OptimizerRuleMetrics {
+  std::string rule_name;
+  std::chrono::nanoseconds duration{};
+};
+
 /**
  * Applies optimization rules to an LQP.
  * On each invocation of optimize(), these Batches are applied in the same order as they were added
@@ -21,7 +29,11 @@ class Optimizer final {
 
   void add_rule(std::unique_ptr<AbstractRule> rule);
 
-  std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input) const;
+  /**
+   * @param rule_metrics    if set, the duration of each rule is appended to it, in the order the rules were applied
+   */
+  std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input,
+                                            std::vector<OptimizerRuleMetrics>* rule_metrics = nullptr) const;
 
  private:
   std::vector<std::unique_ptr<AbstractRule>> _rules;
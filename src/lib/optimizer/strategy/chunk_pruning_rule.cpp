@@ -5,13 +5,18 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -58,12 +63,20 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   auto table = StorageManager::get().get_table(stored_table->table_name);
   std::vector<std::shared_ptr<ChunkStatistics>> statistics;
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    statistics.push_back(table->get_chunk(chunk_id)->statistics());
+    const auto chunk = table->get_chunk(chunk_id);
+    // Physically deleted chunks are excluded by the GetTable operator anyway
+    statistics.push_back(chunk ? chunk->statistics() : nullptr);
   }
   std::set<ChunkID> excluded_chunk_ids;
   for (auto& predicate : predicate_nodes) {
     auto new_exclusions = _compute_exclude_list(statistics, *predicate->predicate(), *stored_table);
     excluded_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
+
+    if (table->partitioning()) {
+      const auto partition_exclusions =
+          _compute_exclude_list_for_partitions(*table, *predicate->predicate(), *stored_table);
+      excluded_chunk_ids.insert(partition_exclusions.begin(), partition_exclusions.end());
+    }
   }
 
   // wanted side effect of usings sets: excluded_chunk_ids vector is sorted
@@ -81,6 +94,10 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
 std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
     const std::vector<std::shared_ptr<ChunkStatistics>>& statistics, const AbstractExpression& predicate,
     const StoredTableNode& stored_table_node) const {
+  if (const auto* in_expression = dynamic_cast<const InExpression*>(&predicate)) {
+    return _compute_exclude_list_for_in_list(statistics, *in_expression, stored_table_node);
+  }
+
   const auto operator_predicates = OperatorScanPredicate::from_expression(predicate, stored_table_node);
   if (!operator_predicates) return {};
 
@@ -105,6 +122,90 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   return result;
 }
 
+std::set<ChunkID> ChunkPruningRule::_compute_exclude_list_for_in_list(
+    const std::vector<std::shared_ptr<ChunkStatistics>>& statistics, const InExpression& in_expression,
+    const StoredTableNode& stored_table_node) const {
+  // A chunk can be pruned for `<column> IN (<values>)` if it contains no value between the smallest and the largest
+  // value of the list. NULLs in the list never match and are ignored.
+  const auto list = std::dynamic_pointer_cast<ListExpression>(in_expression.set());
+  const auto column_id = stored_table_node.find_column_id(*in_expression.value());
+  if (in_expression.is_negated() || !list || !column_id) return {};
+
+  auto min_value = std::optional<AllTypeVariant>{};
+  auto max_value = std::optional<AllTypeVariant>{};
+  for (const auto& element : list->elements()) {
+    const auto value = expression_get_value_or_parameter(*element);
+    if (!value) return {};
+    if (variant_is_null(*value)) continue;
+
+    // Values of different types cannot be ordered reliably
+    if (min_value && data_type_from_all_type_variant(*value) != data_type_from_all_type_variant(*min_value)) return {};
+    if (!min_value || *value < *min_value) min_value = *value;
+    if (!max_value || *max_value < *value) max_value = *value;
+  }
+  if (!min_value) return {};
+
+  std::set<ChunkID> result;
+  for (auto chunk_id = ChunkID{0}; chunk_id < statistics.size(); ++chunk_id) {
+    // statistics[chunk_id] can be a shared_ptr initialized with a nullptr
+    if (statistics[chunk_id] &&
+        statistics[chunk_id]->can_prune(*column_id, PredicateCondition::Between, *min_value, *max_value)) {
+      result.insert(chunk_id);
+    }
+  }
+  return result;
+}
+
+std::set<ChunkID> ChunkPruningRule::_compute_exclude_list_for_partitions(
+    const Table& table, const AbstractExpression& predicate, const StoredTableNode& stored_table_node) const {
+  const auto& partitioning = *table.partitioning();
+  auto pruned_partitions = std::vector<bool>(partitioning.partition_count(), false);
+
+  if (const auto* in_expression = dynamic_cast<const InExpression*>(&predicate)) {
+    // For `<partition column> IN (<values>)`, only the partitions of the values are kept
+    const auto list = std::dynamic_pointer_cast<ListExpression>(in_expression->set());
+    const auto column_id = stored_table_node.find_column_id(*in_expression->value());
+    if (in_expression->is_negated() || !list || column_id != partitioning.column_id()) return {};
+
+    pruned_partitions.assign(partitioning.partition_count(), true);
+    for (const auto& element : list->elements()) {
+      const auto value = expression_get_value_or_parameter(*element);
+      if (!value) return {};
+      if (variant_is_null(*value)) continue;
+      if (data_type_from_all_type_variant(*value) != partitioning.data_type()) return {};
+
+      pruned_partitions[partitioning.partition_id(*value)] = false;
+    }
+  } else {
+    const auto operator_predicates = OperatorScanPredicate::from_expression(predicate, stored_table_node);
+    if (!operator_predicates) return {};
+
+    for (const auto& operator_predicate : *operator_predicates) {
+      if (operator_predicate.column_id != partitioning.column_id() || !is_variant(operator_predicate.value) ||
+          (operator_predicate.value2 && !is_variant(*operator_predicate.value2))) {
+        continue;
+      }
+
+      const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+      std::optional<AllTypeVariant> value2;
+      if (operator_predicate.value2) value2 = boost::get<AllTypeVariant>(*operator_predicate.value2);
+
+      for (auto partition_id = PartitionID{0}; partition_id < partitioning.partition_count(); ++partition_id) {
+        if (partitioning.can_prune(partition_id, operator_predicate.predicate_condition, value, value2)) {
+          pruned_partitions[partition_id] = true;
+        }
+      }
+    }
+  }
+
+  std::set<ChunkID> result;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk && chunk->partition_id() && pruned_partitions[*chunk->partition_id()]) result.insert(chunk_id);
+  }
+  return result;
+}
+
 bool ChunkPruningRule::_is_non_filtering_node(const AbstractLQPNode& node) const {
   return node.type == LQPNodeType::Alias || node.type == LQPNodeType::Projection || node.type == LQPNodeType::Sort;
 }
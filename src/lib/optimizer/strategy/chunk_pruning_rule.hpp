@@ -14,12 +14,15 @@ namespace opossum {
 class AbstractLQPNode;
 class ChunkStatistics;
 class AbstractExpression;
+class InExpression;
 class StoredTableNode;
+class Table;
 
 /**
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
- * table nodes.
+ * table nodes. Besides the chunk statistics, the partitioning of the table is used
+ * (see TablePartitioning).
  */
 class ChunkPruningRule : public AbstractRule {
  public:
@@ -31,6 +34,14 @@ class ChunkPruningRule : public AbstractRule {
                                           const AbstractExpression& predicate,
                                           const StoredTableNode& stored_table_node) const;
 
+  std::set<ChunkID> _compute_exclude_list_for_in_list(const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
+                                                      const InExpression& in_expression,
+                                                      const StoredTableNode& stored_table_node) const;
+
+  // Excludes the chunks of partitions that have no rows satisfying a predicate on the partition column
+  std::set<ChunkID> _compute_exclude_list_for_partitions(const Table& table, const AbstractExpression& predicate,
+                                                         const StoredTableNode& stored_table_node) const;
+
   bool _is_non_filtering_node(const AbstractLQPNode& node) const;
 };
 
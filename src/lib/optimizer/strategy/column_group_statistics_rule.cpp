@@ -0,0 +1,80 @@
+#include "column_group_statistics_rule.hpp"
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+std::string ColumnGroupStatisticsRule::name() const { return "Column Group Statistics Rule"; }
+
+void ColumnGroupStatisticsRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // The columns of each stored table that are operands of predicates
+  auto predicated_column_ids = std::map<std::string, std::set<ColumnID>>{};
+
+  const auto collect_operand = [&](const std::shared_ptr<AbstractExpression>& operand) {
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(operand);
+    if (!column_expression) return;
+
+    const auto& column_reference = column_expression->column_reference;
+    const auto stored_table_node =
+        std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+    if (!stored_table_node) return;
+
+    predicated_column_ids[stored_table_node->table_name].emplace(column_reference.original_column_id());
+  };
+
+  visit_lqp(root, [&](const auto& node) {
+    auto predicate = std::shared_ptr<AbstractExpression>{};
+    if (const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node)) {
+      predicate = predicate_node->predicate();
+    } else if (const auto join_node = std::dynamic_pointer_cast<JoinNode>(node)) {
+      predicate = join_node->join_predicate();
+    }
+    if (!predicate) return LQPVisitation::VisitInputs;
+
+    // Only the kinds of predicates that TableStatistics can estimate are considered
+    for (const auto& conjunct : flatten_logical_expressions(predicate, LogicalOperator::And)) {
+      if (const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(conjunct)) {
+        collect_operand(binary_predicate->left_operand());
+        collect_operand(binary_predicate->right_operand());
+      } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(conjunct)) {
+        collect_operand(between_expression->value());
+      } else if (const auto is_null_expression = std::dynamic_pointer_cast<IsNullExpression>(conjunct)) {
+        collect_operand(is_null_expression->operand());
+      }
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& [table_name, column_id_set] : predicated_column_ids) {
+    if (column_id_set.size() < 2 || !StorageManager::get().has_table(table_name)) continue;
+
+    const auto table = StorageManager::get().get_table(table_name);
+    const auto column_ids = std::vector<ColumnID>(
+        column_id_set.begin(),
+        std::next(column_id_set.begin(), std::min(column_id_set.size(), MAX_COLUMN_COUNT_PER_TABLE)));
+
+    for (auto first_idx = size_t{0}; first_idx < column_ids.size(); ++first_idx) {
+      for (auto second_idx = first_idx + 1; second_idx < column_ids.size(); ++second_idx) {
+        add_column_group_statistics(*table, {column_ids[first_idx], column_ids[second_idx]});
+      }
+    }
+  }
+}
+
+}  // namespace opossum
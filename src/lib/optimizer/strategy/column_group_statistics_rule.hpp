@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Generates ColumnGroupStatistics on demand for the columns that the workload predicates together. For each stored
+ * table, the columns that are operands of predicates (including join predicates) in the LQP are collected, and
+ * ColumnGroupStatistics are added to the table's statistics for each pair of them that has none yet. This way,
+ * estimating the LQP (e.g., in the JoinOrderingRule) already uses them.
+ *
+ * The rule does not modify the LQP.
+ */
+class ColumnGroupStatisticsRule : public AbstractRule {
+ public:
+  // Limits the number of pairs per table, as each of them is generated from a sample of the table
+  static constexpr auto MAX_COLUMN_COUNT_PER_TABLE = size_t{4};
+
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+};
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
 #include "column_pruning_rule.hpp"
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
@@ -36,6 +38,9 @@ void ColumnPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& lqp) co
 
   // Search the plan for leaf nodes and prune all columns from them that are not referenced
   _prune_columns_from_leaves(lqp, actually_used_columns);
+
+  // Narrow the inputs of joins down to the columns that are needed by the join or above it
+  _prune_columns_below_joins(lqp);
 }
 
 ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const std::shared_ptr<AbstractLQPNode>& lqp) {
@@ -65,6 +70,7 @@ ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const s
       case LQPNodeType::DropView:
       case LQPNodeType::DropTable:
       case LQPNodeType::DummyTable:
+      case LQPNodeType::IntermediateResult:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
       case LQPNodeType::Predicate:
@@ -75,6 +81,7 @@ ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const s
       case LQPNodeType::StoredTable:
       case LQPNodeType::Union:
       case LQPNodeType::Validate:
+      case LQPNodeType::Window:
       case LQPNodeType::Mock: {
         for (const auto& expression : node->node_expressions) {
           collect_consumed_columns_from_expression(expression);
@@ -91,9 +98,12 @@ ExpressionUnorderedSet ColumnPruningRule::_collect_actually_used_columns(const s
         }
       } break;
 
-      // No pruning of the input columns to Delete, Update and Insert, they need them all.
+      // No pruning of the input columns to Delete, Update and Insert, they need them all. Except and Intersect compare
+      // whole rows, so they need all columns of both inputs.
       case LQPNodeType::Delete:
+      case LQPNodeType::Except:
       case LQPNodeType::Insert:
+      case LQPNodeType::Intersect:
       case LQPNodeType::Update: {
         const auto& left_input_expressions = node->left_input()->column_expressions();
         consumed_columns.insert(left_input_expressions.begin(), left_input_expressions.end());
@@ -151,6 +161,113 @@ void ColumnPruningRule::_prune_columns_from_leaves(const std::shared_ptr<Abstrac
   }
 }
 
+ExpressionUnorderedSet ColumnPruningRule::_collect_columns_required_above(
+    const std::shared_ptr<AbstractLQPNode>& node) {
+  auto required_columns = ExpressionUnorderedSet{};
+
+  const auto collect_required_columns_from_expression = [&](const auto& expression) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::LQPColumn) {
+        required_columns.emplace(sub_expression);
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  };
+
+  // Walk from the node towards the root(s) of the LQP. A node may have multiple outputs, so visit each node only once.
+  auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  auto pending_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{node};
+
+  while (!pending_nodes.empty()) {
+    const auto current_node = pending_nodes.back();
+    pending_nodes.pop_back();
+    if (!visited_nodes.emplace(current_node).second) continue;
+
+    switch (current_node->type) {
+      // These nodes need all columns of their inputs. Unions are included because the column layouts of both of their
+      // inputs have to match, which pruning only one of them would break.
+      case LQPNodeType::Delete:
+      case LQPNodeType::Except:
+      case LQPNodeType::Insert:
+      case LQPNodeType::Intersect:
+      case LQPNodeType::Union:
+      case LQPNodeType::Update: {
+        for (const auto input_side : {LQPInputSide::Left, LQPInputSide::Right}) {
+          const auto input = current_node->input(input_side);
+          if (!input) continue;
+          const auto& input_expressions = input->column_expressions();
+          required_columns.insert(input_expressions.begin(), input_expressions.end());
+        }
+      } break;
+
+      // Unlike in _collect_actually_used_columns(), the columns forwarded by ProjectionNodes are included here. They
+      // have already been pruned if they are not used anywhere.
+      default: {
+        for (const auto& expression : current_node->node_expressions) {
+          collect_required_columns_from_expression(expression);
+        }
+      }
+    }
+
+    const auto outputs = current_node->outputs();
+    if (outputs.empty()) {
+      // The output columns of the plan are always required
+      const auto& output_expressions = current_node->column_expressions();
+      required_columns.insert(output_expressions.begin(), output_expressions.end());
+    }
+    pending_nodes.insert(pending_nodes.end(), outputs.begin(), outputs.end());
+  }
+
+  return required_columns;
+}
+
+void ColumnPruningRule::_prune_columns_below_joins(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  /**
+   * The join operators write a ReferenceSegment for every column of their inputs, resolving the PosLists of reference
+   * inputs for each of them. Columns that are used below a join (e.g., by a predicate) but not by the join or any node
+   * above it are removed from the join's inputs so that no output segments are created for them. Pruning reference
+   * tables with a ProjectionNode only forwards segments and does not resolve PosLists.
+   */
+
+  // Collect the JoinNodes first, as visit_lqp() can't deal with nodes being inserted
+  auto join_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) join_nodes.emplace_back(node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& join_node : join_nodes) {
+    const auto required_columns = _collect_columns_required_above(join_node);
+
+    for (const auto input_side : {LQPInputSide::Left, LQPInputSide::Right}) {
+      const auto input = join_node->input(input_side);
+
+      // Only columns can be judged by required_columns, other expressions (e.g., `a + 5` computed by a ProjectionNode
+      // below the join) are kept.
+      auto required_input_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+      for (const auto& expression : input->column_expressions()) {
+        if (expression->type != ExpressionType::LQPColumn ||
+            required_columns.find(expression) != required_columns.end()) {
+          required_input_expressions.emplace_back(expression);
+        }
+      }
+
+      if (input->column_expressions().size() == required_input_expressions.size()) continue;
+
+      // We cannot have a ProjectionNode that outputs no columns
+      if (required_input_expressions.empty()) continue;
+
+      // Narrow an existing ProjectionNode instead of stacking a second one on top of it, unless it is shared with
+      // other nodes
+      if (input->type == LQPNodeType::Projection && input->output_count() == 1) {
+        input->node_expressions = required_input_expressions;
+      } else {
+        lqp_insert_node(join_node, input_side, ProjectionNode::make(required_input_expressions));
+      }
+    }
+  }
+}
+
 void ColumnPruningRule::_prune_columns_in_projections(const std::shared_ptr<AbstractLQPNode>& lqp,
                                                       const ExpressionUnorderedSet& referenced_columns) {
   /**
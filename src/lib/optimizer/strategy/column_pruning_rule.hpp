@@ -18,6 +18,9 @@ class AbstractLQPNode;
  * E.g. `SELECT * FROM t WHERE a + 5 > b AND a + 6 > c`: Here `a + 5` and `a + 6` introduce temporary columns that will
  * NOT be removed by this Rule. But it `t` contains a column "d", which is obviously never used in this query, this
  * column "d" will be pruned.
+ *
+ * Additionally, the inputs of joins are narrowed down to the columns needed by the join itself or by the nodes above
+ * it. This way, the join operators do not create output segments for columns that were only needed below the join.
  */
 class ColumnPruningRule : public AbstractRule {
  public:
@@ -30,6 +33,8 @@ class ColumnPruningRule : public AbstractRule {
                                          const ExpressionUnorderedSet& referenced_columns);
   static void _prune_columns_in_projections(const std::shared_ptr<AbstractLQPNode>& lqp,
                                             const ExpressionUnorderedSet& referenced_columns);
+  static ExpressionUnorderedSet _collect_columns_required_above(const std::shared_ptr<AbstractLQPNode>& node);
+  static void _prune_columns_below_joins(const std::shared_ptr<AbstractLQPNode>& lqp);
 };
 
 }  // namespace opossum
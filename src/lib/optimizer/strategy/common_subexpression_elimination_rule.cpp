@@ -0,0 +1,52 @@
+#include "common_subexpression_elimination_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace opossum {
+
+std::string CommonSubexpressionEliminationRule::name() const { return "Common Subexpression Elimination Rule"; }
+
+void CommonSubexpressionEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Projection) {
+    const auto& input = node->left_input();
+    const auto is_input_column = [&](const AbstractExpression& expression) {
+      return input->find_column_id(expression).has_value();
+    };
+
+    const auto common_subexpressions =
+        expressions_find_common_subexpressions(node->node_expressions, is_input_column);
+
+    if (!common_subexpressions.empty()) {
+      // Forward the input columns that the ProjectionNode uses, in the order of the input
+      auto used_column_ids = std::vector<bool>(input->column_expressions().size());
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (const auto column_id = input->find_column_id(*sub_expression)) {
+            used_column_ids[*column_id] = true;
+            return ExpressionVisitation::DoNotVisitArguments;
+          }
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+
+      auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+      for (auto column_id = ColumnID{0}; column_id < used_column_ids.size(); ++column_id) {
+        if (used_column_ids[column_id]) expressions.emplace_back(input->column_expressions()[column_id]);
+      }
+      expressions.insert(expressions.end(), common_subexpressions.begin(), common_subexpressions.end());
+
+      lqp_insert_node(node, LQPInputSide::Left, ProjectionNode::make(expressions));
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
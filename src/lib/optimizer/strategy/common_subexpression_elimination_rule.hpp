@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule finds subexpressions that a ProjectionNode computes multiple times, e.g.,
+ * `l_extendedprice * (1 - l_discount)` in the ProjectionNode below the AggregateNode of TPC-H Q1, which computes both
+ * `l_extendedprice * (1 - l_discount)` and `l_extendedprice * (1 - l_discount) * (1 + l_tax)`. For these, it inserts
+ * another ProjectionNode below the ProjectionNode that computes each of them once and forwards the input columns that
+ * the ProjectionNode uses. The LQPTranslator then resolves the occurrences of the common subexpressions in the
+ * ProjectionNode to columns of the new ProjectionNode.
+ *
+ * AggregateNodes are covered by this as well: Their arguments are computed by the ProjectionNode below them.
+ * Common subexpressions that are only found within the expressions of a single Projection operator (e.g., within
+ * CASE expressions that are not compiled) are also shared by the ExpressionEvaluator.
+ */
+class CommonSubexpressionEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
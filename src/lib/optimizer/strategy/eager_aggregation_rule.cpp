@@ -0,0 +1,107 @@
+#include "eager_aggregation_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cost_model/abstract_cost_estimator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+EagerAggregationRule::EagerAggregationRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
+    : _cost_estimator(cost_estimator) {}
+
+std::string EagerAggregationRule::name() const { return "Eager Aggregation Rule"; }
+
+void EagerAggregationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Aggregate) _aggregate_eagerly(std::static_pointer_cast<AggregateNode>(node));
+
+  _apply_to_inputs(node);
+}
+
+void EagerAggregationRule::_aggregate_eagerly(const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  if (aggregate_node->combines_partial_aggregates || aggregate_node->aggregate_expressions_begin_idx == 0) return;
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(aggregate_node->left_input());
+  if (!join_node || join_node->join_mode != JoinMode::Inner || join_node->output_count() != 1) return;
+
+  const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      aggregate_node->node_expressions.begin(),
+      aggregate_node->node_expressions.begin() + aggregate_node->aggregate_expressions_begin_idx};
+  const auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      aggregate_node->node_expressions.begin() + aggregate_node->aggregate_expressions_begin_idx,
+      aggregate_node->node_expressions.end()};
+
+  for (const auto& expression : aggregate_expressions) {
+    const auto aggregate_function = std::static_pointer_cast<AggregateExpression>(expression)->aggregate_function;
+    if (aggregate_function != AggregateFunction::Sum && aggregate_function != AggregateFunction::Min &&
+        aggregate_function != AggregateFunction::Max && aggregate_function != AggregateFunction::Count) {
+      return;
+    }
+  }
+
+  auto best_cost = _cost_estimator->estimate_plan_cost(aggregate_node);
+  auto best_input_side = std::optional<LQPInputSide>{};
+  auto best_partial_aggregate_node = std::shared_ptr<AggregateNode>{};
+
+  for (const auto input_side : {LQPInputSide::Left, LQPInputSide::Right}) {
+    const auto input = join_node->input(input_side);
+
+    // COUNT(*) has no argument and can be computed on either input
+    const auto arguments_available = std::all_of(
+        aggregate_expressions.begin(), aggregate_expressions.end(), [&](const auto& expression) {
+          const auto& argument = std::static_pointer_cast<AggregateExpression>(expression)->argument();
+          return !argument || input->find_column_id(*argument);
+        });
+    if (!arguments_available) continue;
+
+    // Group by the columns of the input that are used by the join predicate or are grouped by
+    auto partial_group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+    auto partial_group_by_expression_set = ExpressionUnorderedSet{};
+    const auto add_input_columns = [&](const auto& expression) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (!input->find_column_id(*sub_expression)) return ExpressionVisitation::VisitArguments;
+
+        if (partial_group_by_expression_set.emplace(sub_expression).second) {
+          partial_group_by_expressions.emplace_back(sub_expression);
+        }
+        return ExpressionVisitation::DoNotVisitArguments;
+      });
+    };
+
+    add_input_columns(join_node->join_predicate());
+    for (const auto& expression : group_by_expressions) {
+      add_input_columns(expression);
+    }
+
+    // Cost the plan with the partial AggregateNode and remove it again
+    const auto partial_aggregate_node = AggregateNode::make(partial_group_by_expressions, aggregate_expressions);
+    lqp_insert_node(join_node, input_side, partial_aggregate_node);
+    aggregate_node->combines_partial_aggregates = true;
+
+    const auto cost = _cost_estimator->estimate_plan_cost(aggregate_node);
+
+    lqp_remove_node(partial_aggregate_node);
+    aggregate_node->combines_partial_aggregates = false;
+
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_input_side = input_side;
+      best_partial_aggregate_node = partial_aggregate_node;
+    }
+  }
+
+  if (!best_input_side) return;
+
+  lqp_insert_node(join_node, *best_input_side, best_partial_aggregate_node);
+  aggregate_node->combines_partial_aggregates = true;
+}
+
+}  // namespace opossum
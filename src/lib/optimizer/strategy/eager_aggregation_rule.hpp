@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractCostEstimator;
+class AggregateNode;
+
+/**
+ * Eager aggregation (Yan and Larson, "Eager Aggregation and Lazy Aggregation", VLDB 1995): An AggregateNode on top of
+ * an inner join is partially computed on one input of the join before the join is executed, e.g., on the fact table
+ * of a star schema query, which then joins thousands of partial aggregates instead of billions of rows:
+ *
+ *   Aggregate [GroupBy: d.category; SUM(f.revenue), COUNT(*)] (combines partial aggregates)
+ *   |_Join [f.d_id = d.id]
+ *   | |_Aggregate [GroupBy: f.d_id; SUM(f.revenue), COUNT(*)]
+ *   |   |_f
+ *   |_d
+ *
+ * The partial AggregateNode groups by the columns of its input that are used in the join predicate or in the GROUP BY
+ * clause. As the join predicate only looks at these columns, it joins each group like it would have joined each of
+ * its rows. Thus, the original AggregateNode returns the same result if it combines the partial aggregates (see
+ * AggregateNode::combines_partial_aggregates).
+ *
+ * This is only possible if all arguments of the aggregates come from the same input and the aggregate functions are
+ * decomposable (SUM, MIN, MAX, and COUNT without DISTINCT; AVG is not supported yet). Aggregates without GROUP BY are
+ * not rewritten, as the COUNT of an empty input is 0, but the SUM of no partial COUNTs would be NULL.
+ *
+ * The partial aggregation pays off if it reduces the number of rows considerably, which depends on the number of
+ * distinct join keys. Therefore, both inputs are considered, and the plan is only rewritten if the cost estimator
+ * considers it cheaper. The rule is applied to the partial AggregateNodes as well, so that they are pushed below
+ * further joins.
+ */
+class EagerAggregationRule : public AbstractRule {
+ public:
+  explicit EagerAggregationRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  void _aggregate_eagerly(const std::shared_ptr<AggregateNode>& aggregate_node) const;
+
+  std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+};
+
+}  // namespace opossum
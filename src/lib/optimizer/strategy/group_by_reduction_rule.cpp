@@ -0,0 +1,35 @@
+#include "group_by_reduction_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace opossum {
+
+std::string GroupByReductionRule::name() const { return "Group By Reduction Rule"; }
+
+void GroupByReductionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Aggregate) {
+    const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+    const auto& group_by_expressions = aggregate_node->node_expressions;
+
+    if (aggregate_node->aggregate_expressions_begin_idx == group_by_expressions.size() &&
+        !group_by_expressions.empty() &&
+        lqp_columns_are_unique(node->left_input(),
+                               ExpressionUnorderedSet{group_by_expressions.begin(), group_by_expressions.end()})) {
+      const auto projection_node = ProjectionNode::make(group_by_expressions);
+      lqp_replace_node(node, projection_node);
+      _apply_to_inputs(projection_node);
+      return;
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule removes AggregateNodes whose groups each consist of a single input row, because the input is
+ * unique on the group-by columns according to the constraints of the stored tables (see lqp_columns_are_unique()).
+ * This is typically a DISTINCT on a key, e.g., `SELECT DISTINCT c_custkey, c_name FROM customer`. The AggregateNode is
+ * replaced by a ProjectionNode of the group-by columns.
+ *
+ * AggregateNodes that compute aggregates are kept, as their aggregate expressions cannot be computed by other nodes.
+ */
+class GroupByReductionRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -8,8 +8,12 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/aggregate_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -34,7 +38,9 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
   if (node->type == LQPNodeType::Predicate) {
     const auto& child = node->left_input();
 
-    if (child->type == LQPNodeType::StoredTable) {
+    // Index scans read the entire table and would ignore a TABLESAMPLE
+    if (child->type == LQPNodeType::StoredTable &&
+        !std::static_pointer_cast<StoredTableNode>(child)->table_sample()) {
       const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
       const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
       const auto table = StorageManager::get().get_table(stored_table_node->table_name);
@@ -45,6 +51,16 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
+
+      // Table-level indexes cover only the chunks of the stored table, not those of a pruned copy of it
+      if (stored_table_node->excluded_chunk_ids().empty() && _is_table_index_scan_applicable(*table, predicate_node)) {
+        predicate_node->scan_type = ScanType::IndexScan;
+      }
+
+      if (predicate_node->scan_type == ScanType::IndexScan && stored_table_node->excluded_chunk_ids().empty() &&
+          _is_index_only_scan_applicable(predicate_node)) {
+        predicate_node->scan_type = ScanType::IndexOnlyScan;
+      }
     }
   }
 
@@ -67,8 +83,64 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   // Currently, we do not support two-column predicates
   if (is_column_id(operator_predicate.value)) return false;
 
+  // The IndexScan does not support parameters, as it needs the value when being created
+  if (is_parameter_id(operator_predicate.value)) return false;
+
   if (index_info.column_ids[0] != operator_predicate.column_id) return false;
 
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_table_index_scan_applicable(const Table& table,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates) return false;
+  if (operator_predicates->size() != 1) return false;
+
+  const auto& operator_predicate = (*operator_predicates)[0];
+
+  // Table-level indexes only support point lookups
+  if (operator_predicate.predicate_condition != PredicateCondition::Equals) return false;
+  if (is_column_id(operator_predicate.value) || is_parameter_id(operator_predicate.value)) return false;
+
+  if (!table.get_table_index(operator_predicate.column_id)) return false;
+
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_index_only_scan_applicable(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  // The positions of the IndexScan must not be needed by any other node
+  if (predicate_node->output_count() != 1) return false;
+  const auto output = predicate_node->outputs()[0];
+  if (output->left_input() != predicate_node) return false;
+
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+  if (!predicate) return false;
+  const auto& column_expression = predicate->arguments[0];
+
+  // SELECT COUNT(*) FROM t WHERE <predicate> - as NULLs never satisfy the predicate, COUNT(<column>) is the same
+  if (const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(output)) {
+    if (aggregate_node->aggregate_expressions_begin_idx != 0 || aggregate_node->node_expressions.size() != 1) {
+      return false;
+    }
+
+    const auto aggregate_expression =
+        std::dynamic_pointer_cast<AggregateExpression>(aggregate_node->node_expressions[0]);
+    return aggregate_expression && aggregate_expression->aggregate_function == AggregateFunction::Count &&
+           (!aggregate_expression->argument() || *aggregate_expression->argument() == *column_expression);
+  }
+
+  // SELECT k FROM t WHERE k = <value> - all matching rows have the search value
+  if (const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(output)) {
+    return predicate->predicate_condition == PredicateCondition::Equals &&
+           projection_node->node_expressions.size() == 1 && *projection_node->node_expressions[0] == *column_expression;
+  }
+
+  return false;
+}
+
+bool IndexScanRule::_is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
 
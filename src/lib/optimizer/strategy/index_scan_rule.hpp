@@ -12,6 +12,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class Table;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -23,6 +24,13 @@ class PredicateNode;
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
  * Currently, only GroupKeyIndexes are supported.
+ *
+ * Equality predicates can also be executed by IndexScans if the table has a table-level index on the column (see
+ * BaseTableIndex). In this case, all chunks are handled by the IndexScan.
+ *
+ * If the only consumer of an IndexScan counts its rows (COUNT(*) without GROUP BY) or, for an equality predicate,
+ * projects to the searched column, the ScanType is set to IndexOnlyScan. The consumer is then computed from the index
+ * without building positions or accessing the base segments.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +41,9 @@ class IndexScanRule : public AbstractRule {
  protected:
   bool _is_index_scan_applicable(const IndexInfo& index_info,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_table_index_scan_applicable(const Table& table, const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_index_only_scan_applicable(const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const;
   inline bool _is_single_segment_index(const IndexInfo& index_info) const;
 };
 
@@ -0,0 +1,138 @@
+#include "join_elimination_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The StoredTableNode and ColumnID that an expression directly refers to, if any
+std::optional<std::pair<std::shared_ptr<const StoredTableNode>, ColumnID>> stored_table_column(
+    const AbstractExpression& expression) {
+  if (expression.type != ExpressionType::LQPColumn) return std::nullopt;
+
+  const auto& column_reference = static_cast<const LQPColumnExpression&>(expression).column_reference;
+  const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+  if (!stored_table_node) return std::nullopt;
+
+  return std::make_pair(stored_table_node, column_reference.original_column_id());
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string JoinEliminationRule::name() const { return "Join Elimination Rule"; }
+
+void JoinEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  auto join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) join_nodes.emplace_back(std::static_pointer_cast<JoinNode>(node));
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& join_node : join_nodes) {
+    _try_eliminate_join(root, join_node);
+  }
+}
+
+void JoinEliminationRule::_try_eliminate_join(const std::shared_ptr<AbstractLQPNode>& root,
+                                              const std::shared_ptr<JoinNode>& join_node) {
+  if (join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi) return;
+
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return;
+
+  // The right input of a semi join can be removed, both inputs of an inner join
+  auto referenced_sides = std::vector<LQPInputSide>{LQPInputSide::Right};
+  if (join_node->join_mode == JoinMode::Inner) referenced_sides.emplace_back(LQPInputSide::Left);
+
+  for (const auto referenced_side : referenced_sides) {
+    const auto referencing_side = referenced_side == LQPInputSide::Left ? LQPInputSide::Right : LQPInputSide::Left;
+    const auto referenced_input = join_node->input(referenced_side);
+    const auto referencing_input = join_node->input(referencing_side);
+
+    auto referenced_operand = predicate->right_operand();
+    auto referencing_operand = predicate->left_operand();
+    if (!referenced_input->find_column_id(*referenced_operand)) std::swap(referenced_operand, referencing_operand);
+    if (!referenced_input->find_column_id(*referenced_operand) ||
+        !referencing_input->find_column_id(*referencing_operand)) {
+      continue;
+    }
+
+    // The referenced input has to be a complete table, so that every foreign key finds its partner. A ValidateNode
+    // filters the rows that were deleted or not yet committed, and foreign keys are not enforced on DELETE. Thus, the
+    // referencing rows of deleted rows would not be removed with the join, so validated inputs are not considered.
+    if (referenced_input->type != LQPNodeType::StoredTable) continue;
+    if (std::static_pointer_cast<StoredTableNode>(referenced_input)->table_sample()) continue;
+
+    const auto referenced_column = stored_table_column(*referenced_operand);
+    const auto referencing_column = stored_table_column(*referencing_operand);
+    if (!referenced_column || !referencing_column || referenced_column->first != referenced_input) continue;
+
+    const auto& referencing_table = StorageManager::get().get_table(referencing_column->first->table_name);
+    const auto& foreign_keys = referencing_table->foreign_key_constraints();
+    const auto foreign_key_matches =
+        std::any_of(foreign_keys.begin(), foreign_keys.end(), [&](const auto& foreign_key) {
+          return foreign_key.columns == std::vector<ColumnID>{referencing_column->second} &&
+                 foreign_key.referenced_table_name == referenced_column->first->table_name &&
+                 foreign_key.referenced_columns == std::vector<ColumnID>{referenced_column->second};
+        });
+    if (!foreign_key_matches) continue;
+
+    // Otherwise, the join would duplicate the referencing rows
+    if (!lqp_columns_are_unique(referenced_input, {referenced_operand})) continue;
+
+    // The columns of the referenced table must not be used anywhere but in the join predicate
+    if (join_node->join_mode == JoinMode::Inner) {
+      auto referenced_columns_are_used = false;
+      const auto find_referenced_columns = [&](const auto& expression) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (referenced_input->find_column_id(*sub_expression)) referenced_columns_are_used = true;
+          return ExpressionVisitation::VisitArguments;
+        });
+      };
+
+      visit_lqp(root, [&](const auto& node) {
+        if (node == join_node) return LQPVisitation::VisitInputs;
+        for (const auto& expression : node->node_expressions) find_referenced_columns(expression);
+        return LQPVisitation::VisitInputs;
+      });
+      for (const auto& expression : root->column_expressions()) find_referenced_columns(expression);
+
+      if (referenced_columns_are_used) continue;
+    }
+
+    // Rows with a NULL foreign key do not have a join partner
+    auto replacement = referencing_input;
+    const auto referencing_column_id = referencing_input->get_column_id(*referencing_operand);
+    if (referencing_input->is_column_nullable(referencing_column_id)) {
+      replacement = PredicateNode::make(is_not_null_(referencing_operand), referencing_input);
+    }
+
+    join_node->set_right_input(nullptr);
+    join_node->set_left_input(replacement);
+    lqp_remove_node(join_node);
+    return;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class JoinNode;
+
+/**
+ * This optimizer rule removes inner and semi joins that neither filter nor duplicate rows, based on the constraints of
+ * the stored tables. This is the case for a join on a foreign key that references the primary key of an unfiltered
+ * table, e.g., `orders JOIN customer ON o_custkey = c_custkey` - each order has exactly one customer. If none of the
+ * columns of the referenced table are used above the join, the join is removed. Semi joins (e.g.,
+ * `o_custkey IN (SELECT c_custkey FROM customer)`) are removed independent of the used columns.
+ *
+ * The referenced table must not be validated: Foreign keys are not enforced when rows of the referenced table are
+ * deleted, so the join might filter the rows that reference deleted rows. Thus, the rule only applies to plans that are
+ * not validated, i.e., those of pipelines without MVCC.
+ *
+ * If the foreign key column is nullable, the join is replaced by a `IS NOT NULL` PredicateNode, as rows with NULL do
+ * not have a join partner.
+ *
+ * Only single-column foreign keys are considered, as JoinNodes have a single join predicate.
+ */
+class JoinEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+ private:
+  static void _try_eliminate_join(const std::shared_ptr<AbstractLQPNode>& root,
+                                  const std::shared_ptr<JoinNode>& join_node);
+};
+
+}  // namespace opossum
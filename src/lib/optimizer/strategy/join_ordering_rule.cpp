@@ -5,12 +5,14 @@
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
-    : _cost_estimator(cost_estimator) {}
+JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                   const size_t max_csg_cmp_pair_count)
+    : _cost_estimator(cost_estimator), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
 
 std::string JoinOrderingRule::name() const { return "JoinOrderingRule"; }
 
@@ -50,12 +52,21 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
     return lqp;
   }
 
-  // Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
+  // Pick the most thorough algorithm that stays within the budget, see the class comment. DpCcp and LinearizedDp
+  // return nullptr if they can't handle the JoinGraph.
+  const auto vertex_count = join_graph->vertices.size();
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  if (join_graph->vertices.size() < 9) {
-    result_lqp = DpCcp{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
-  } else {
+
+  // EnumerateCcp represents vertex sets as unsigned longs
+  if (vertex_count < sizeof(unsigned long) * 8) {  // NOLINT
+    result_lqp = DpCcp{_cost_estimator, _max_csg_cmp_pair_count}(*join_graph);  // NOLINT - doesn't like `{}()`
+  }
+
+  if (!result_lqp && (vertex_count * vertex_count * vertex_count - vertex_count) / 6 <= _max_csg_cmp_pair_count) {
+    result_lqp = LinearizedDp{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
+  }
+
+  if (!result_lqp) {
     result_lqp = GreedyOperatorOrdering{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
   }
 
@@ -10,14 +10,22 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * Currently only the order of inner joins is modified.
  *
- * TODO(anybody) Use a different join ordering algorithm, such as GreedyOperatorOrdering, if there are too many join
- *               operations for DPccp to handle efficiently.
+ * The algorithm is chosen by the number of candidate plans it would have to cost, which dominates the optimization
+ * time. The budget for this is max_csg_cmp_pair_count:
+ *    -> DpCcp (optimal), if the JoinGraph has at most max_csg_cmp_pair_count CsgCmpPairs. Counting them stops once
+ *       the budget is exceeded, so this is cheap even for JoinGraphs that are much too large.
+ *    -> LinearizedDp, which costs (n^3 - n) / 6 candidates for n vertices, if that is within the budget
+ *    -> GreedyOperatorOrdering otherwise
  */
 class JoinOrderingRule : public AbstractRule {
  public:
-  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  // About the number of CsgCmpPairs of a clique of eight vertices
+  static constexpr size_t DEFAULT_MAX_CSG_CMP_PAIR_COUNT = 4'000;
+
+  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                            const size_t max_csg_cmp_pair_count = DEFAULT_MAX_CSG_CMP_PAIR_COUNT);
 
   std::string name() const override;
 
@@ -29,6 +37,7 @@ class JoinOrderingRule : public AbstractRule {
   void _recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp) const;
 
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+  const size_t _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
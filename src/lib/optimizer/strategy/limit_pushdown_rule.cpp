@@ -0,0 +1,50 @@
+#include "limit_pushdown_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+std::string LimitPushdownRule::name() const { return "Limit Pushdown Rule"; }
+
+void LimitPushdownRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Limit) {
+    const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+    const auto num_rows_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+
+    // TopK operators consume their entire input
+    const auto has_constant_row_count = num_rows_expression && !variant_is_null(num_rows_expression->value);
+    if (limit_node->limit_type == LimitType::Limit && has_constant_row_count &&
+        type_cast_variant<int64_t>(num_rows_expression->value) >= 0) {
+      const auto num_rows = static_cast<size_t>(type_cast_variant<int64_t>(num_rows_expression->value));
+
+      auto current_node = node->left_input();
+      while (current_node && current_node->output_count() == 1) {
+        const auto is_table_scan =
+            current_node->type == LQPNodeType::Predicate &&
+            std::static_pointer_cast<PredicateNode>(current_node)->scan_type == ScanType::TableScan;
+        if (current_node->type != LQPNodeType::Projection && current_node->type != LQPNodeType::Alias &&
+            current_node->type != LQPNodeType::Validate && current_node->type != LQPNodeType::StoredTable &&
+            !is_table_scan) {
+          break;
+        }
+
+        current_node->row_count_hint = num_rows;
+
+        // Only ProjectionNodes and AliasNodes output as many rows as they get from their input
+        if (current_node->type != LQPNodeType::Projection && current_node->type != LQPNodeType::Alias) break;
+        current_node = current_node->left_input();
+      }
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule finds LimitNodes with a constant number of rows k and passes k as a row_count_hint to the nodes
+ * below them. The operators of these nodes process their input chunks in order and stop once they have produced k
+ * rows, so that, e.g., `SELECT * FROM t WHERE a = 1 LIMIT 10` does not scan the entire table. The LimitNode itself is
+ * kept, as the operators may produce more rows than hinted.
+ *
+ * The hint is passed down through nodes that preserve the number and the order of their input rows (ProjectionNodes
+ * and AliasNodes). Filtering nodes (PredicateNodes and ValidateNodes) and StoredTableNodes receive the hint, too, but
+ * the nodes below them need to produce more rows than the hint, so the rule stops there. It also stops at nodes with
+ * multiple outputs, as the other outputs may need the entire result.
+ */
+class LimitPushdownRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
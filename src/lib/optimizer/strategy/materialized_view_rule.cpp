@@ -0,0 +1,49 @@
+#include "materialized_view_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/lqp_view.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::string MaterializedViewRule::name() const { return "Materialized View Rule"; }
+
+void MaterializedViewRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto& materialized_views = StorageManager::get().materialized_views();
+  if (materialized_views.empty()) return;
+
+  // The root node of the LQP is never replaced
+  if (node->type != LQPNodeType::Root) {
+    const auto node_hash = node->hash();
+
+    for (const auto& [name, materialized_view] : materialized_views) {
+      if (materialized_view->lqp_hash != node_hash || *node != *materialized_view->view->lqp) continue;
+
+      // A view that is outdated would return wrong results, the subplan has to be executed instead
+      if (!materialized_view->is_up_to_date()) continue;
+
+      const auto table = materialized_view->table();
+      const auto intermediate_result_node = IntermediateResultNode::make(
+          node, table, std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+
+      const auto outputs = node->outputs();
+      const auto input_sides = node->get_input_sides();
+      for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+        outputs[output_idx]->set_input(input_sides[output_idx], intermediate_result_node);
+      }
+      return;
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Replaces subplans that are equal to the LQP of an up-to-date MaterializedView (see StorageManager) with an
+ * IntermediateResultNode holding the view's result. This covers queries that refer to the view by name, as the
+ * SQLTranslator inserts a copy of the view's LQP, as well as queries that contain the view's definition.
+ *
+ * The rule runs first, as other rules would change the subplans so that they do not match the views anymore.
+ */
+class MaterializedViewRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
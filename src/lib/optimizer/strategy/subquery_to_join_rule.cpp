@@ -0,0 +1,229 @@
+#include "subquery_to_join_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_comparison(const PredicateCondition predicate_condition) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether the expression computed on top of the aggregates is NULL if one of them is NULL and thus NULL for outer rows
+// without matching inner rows
+bool propagates_null_aggregates(const std::shared_ptr<AbstractExpression>& expression) {
+  auto contains_aggregate = false;
+  auto propagates_null = true;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    switch (sub_expression->type) {
+      case ExpressionType::Aggregate: {
+        const auto aggregate_function =
+            std::static_pointer_cast<AggregateExpression>(sub_expression)->aggregate_function;
+        if (aggregate_function == AggregateFunction::Count || aggregate_function == AggregateFunction::CountDistinct ||
+            aggregate_function == AggregateFunction::ApproxCountDistinct) {
+          propagates_null = false;
+        }
+        contains_aggregate = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      case ExpressionType::Arithmetic:
+      case ExpressionType::Cast:
+      case ExpressionType::UnaryMinus:
+      case ExpressionType::Value:
+        return ExpressionVisitation::VisitArguments;
+
+      default:
+        propagates_null = false;
+        return ExpressionVisitation::DoNotVisitArguments;
+    }
+  });
+
+  return contains_aggregate && propagates_null;
+}
+
+// If the predicate is `column = parameter` or `parameter = column`, returns the column
+std::shared_ptr<LQPColumnExpression> get_correlated_column(const std::shared_ptr<AbstractLQPNode>& node,
+                                                           const ParameterID parameter_id) {
+  if (node->type != LQPNodeType::Predicate) return nullptr;
+
+  const auto predicate_expression =
+      std::dynamic_pointer_cast<BinaryPredicateExpression>(std::static_pointer_cast<PredicateNode>(node)->predicate());
+  if (!predicate_expression || predicate_expression->predicate_condition != PredicateCondition::Equals) {
+    return nullptr;
+  }
+
+  for (auto argument_idx = size_t{0}; argument_idx < 2; ++argument_idx) {
+    const auto& column = predicate_expression->arguments[argument_idx];
+    const auto parameter =
+        std::dynamic_pointer_cast<CorrelatedParameterExpression>(predicate_expression->arguments[1 - argument_idx]);
+    if (column->type == ExpressionType::LQPColumn && parameter && parameter->parameter_id == parameter_id) {
+      return std::static_pointer_cast<LQPColumnExpression>(column);
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string SubqueryToJoinRule::name() const { return "Correlated Subquery to Join Rule"; }
+
+void SubqueryToJoinRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Find a PredicateNode that compares a value to a subquery
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+  const auto predicate_expression =
+      predicate_node ? std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate()) : nullptr;
+  if (!predicate_expression || !is_comparison(predicate_expression->predicate_condition)) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto subquery_argument_idx = predicate_expression->arguments[0]->type == ExpressionType::LQPSubquery ? 0 : 1;
+  const auto subquery_expression =
+      std::dynamic_pointer_cast<LQPSubqueryExpression>(predicate_expression->arguments[subquery_argument_idx]);
+  const auto& other_argument = predicate_expression->arguments[1 - subquery_argument_idx];
+
+  // We only unnest subqueries with exactly one parameter, which has to be a column of the outer query
+  if (!subquery_expression || other_argument->type == ExpressionType::LQPSubquery ||
+      subquery_expression->parameter_count() != 1 ||
+      subquery_expression->parameter_expression(0)->type != ExpressionType::LQPColumn) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto correlated_parameter_id = subquery_expression->parameter_ids[0];
+  const auto outer_column = subquery_expression->parameter_expression(0);
+
+  // The subquery LQP might be used elsewhere, so it is not modified in place
+  const auto subquery_lqp = subquery_expression->lqp->deep_copy();
+
+  // First pass over the subquery LQP
+  // Check whether the one correlated parameter is only used exactly once, in the predicate that we turn into the join
+  // predicate
+  auto correlated_parameter_usage_count = 0;
+  visit_lqp(subquery_lqp, [&](const auto& subquery_node) {
+    for (const auto& expression : subquery_node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        const auto parameter_expression = std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression);
+        if (parameter_expression && parameter_expression->parameter_id == correlated_parameter_id) {
+          ++correlated_parameter_usage_count;
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  if (correlated_parameter_usage_count != 1) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // Second pass over the subquery LQP
+  // Check that it is an optional ProjectionNode on top of an AggregateNode without GROUP BY, and find the correlated
+  // predicate below the AggregateNode
+  const auto projection_node =
+      subquery_lqp->type == LQPNodeType::Projection ? std::static_pointer_cast<ProjectionNode>(subquery_lqp) : nullptr;
+  const auto aggregate_node =
+      std::dynamic_pointer_cast<AggregateNode>(projection_node ? projection_node->left_input() : subquery_lqp);
+  if (!aggregate_node || aggregate_node->aggregate_expressions_begin_idx != 0 ||
+      subquery_lqp->column_expressions().size() != 1 ||
+      !propagates_null_aggregates(subquery_lqp->column_expressions().front())) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  auto correlated_predicate_node = std::shared_ptr<AbstractLQPNode>{};
+  auto inner_column = std::shared_ptr<LQPColumnExpression>{};
+  auto nodes_above_correlated_predicate = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+
+  for (auto subquery_node = aggregate_node->left_input(); subquery_node; subquery_node = subquery_node->left_input()) {
+    inner_column = get_correlated_column(subquery_node, correlated_parameter_id);
+    if (inner_column) {
+      correlated_predicate_node = subquery_node;
+      break;
+    }
+
+    // These nodes forward the inner column from the correlated predicate to the aggregate, unless a Projection
+    // removes it
+    if (subquery_node->type != LQPNodeType::Predicate && subquery_node->type != LQPNodeType::Validate &&
+        subquery_node->type != LQPNodeType::Sort && subquery_node->type != LQPNodeType::Projection) {
+      break;
+    }
+    nodes_above_correlated_predicate.emplace_back(subquery_node);
+  }
+
+  const auto inner_column_is_forwarded = [&](const auto& node_above_correlated_predicate) {
+    const auto& column_expressions = node_above_correlated_predicate->column_expressions();
+    return std::any_of(column_expressions.begin(), column_expressions.end(),
+                       [&](const auto& column_expression) { return *column_expression == *inner_column; });
+  };
+
+  if (!correlated_predicate_node || !std::all_of(nodes_above_correlated_predicate.begin(),
+                                                 nodes_above_correlated_predicate.end(), inner_column_is_forwarded)) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // Remove the correlated predicate from the subquery (because it is now handled by the join) and aggregate the
+  // subquery for each value of the inner column instead
+  lqp_remove_node(correlated_predicate_node);
+
+  const auto aggregate_input = aggregate_node->left_input();
+  aggregate_node->set_left_input(nullptr);
+
+  const auto scalar_expression = subquery_lqp->column_expressions().front();
+  const auto unnested_subquery_lqp = ProjectionNode::make(
+      expression_vector(inner_column, scalar_expression),
+      AggregateNode::make(expression_vector(inner_column), aggregate_node->node_expressions, aggregate_input));
+
+  // Join the outer query with the unnested subquery, filter by the original comparison, and remove the columns of the
+  // subquery again
+  auto unnested_predicate_arguments = predicate_expression->arguments;
+  unnested_predicate_arguments[subquery_argument_idx] = scalar_expression;
+
+  const auto output_projection_node = ProjectionNode::make(predicate_node->column_expressions());
+  const auto unnested_predicate_node = PredicateNode::make(std::make_shared<BinaryPredicateExpression>(
+      predicate_expression->predicate_condition, unnested_predicate_arguments[0], unnested_predicate_arguments[1]));
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(outer_column, inner_column));
+
+  lqp_replace_node(predicate_node, output_projection_node);
+  lqp_insert_node(output_projection_node, LQPInputSide::Left, unnested_predicate_node);
+  lqp_insert_node(unnested_predicate_node, LQPInputSide::Left, join_node);
+  join_node->set_right_input(unnested_subquery_lqp);
+
+  _apply_to_inputs(join_node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+// Unnests correlated scalar aggregate subqueries that are compared to a value of the outer query, e.g., TPC-H Q17's
+//   `SELECT ... FROM lineitem, part WHERE ... AND l_quantity < (SELECT 0.2 * AVG(l_quantity) FROM lineitem
+//    WHERE l_partkey = p_partkey)`
+// The subquery is aggregated once for all values of the correlated column and inner-joined with the outer query:
+//   Projection[outer columns]
+//     Predicate[l_quantity < 0.2 * AVG(l_quantity)]
+//       Join[p_partkey = l_partkey]
+//         <outer query>
+//         Projection[l_partkey, 0.2 * AVG(l_quantity)]
+//           Aggregate[GROUP BY l_partkey: AVG(l_quantity)]
+//             <subquery without the correlated predicate>
+// As outer rows without a matching group are dropped by the join, the rewrite is only correct if the subquery is
+// NULL for them (i.e., the predicate is not true). Thus, it does not cover
+//                - COUNT aggregates (because they are 0, not NULL, for empty inputs)
+//                - projections that might turn NULL into a value (e.g., COALESCE or CASE)
+// Similar to the ExistsReformulationRule, it does also not cover
+//                - cases where the correlated predicate is not `=`, or the outer value is not a column
+//                - cases where the subquery uses multiple external parameters, or uses one twice
+//                - subqueries with a GROUP BY clause or nodes other than Predicates, Validates, Sorts, and Projections
+//                    between the aggregate and the correlated predicate
+// The ExpressionEvaluator executes the remaining correlated subqueries once per distinct parameter value.
+
+class SubqueryToJoinRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "expression/abstract_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+
+namespace opossum {
+
+std::string TopKRule::name() const { return "TopK Rule"; }
+
+void TopKRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Limit) {
+    const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+    const auto& input_node = node->left_input();
+
+    if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1 &&
+        limit_node->num_rows_expression()->type == ExpressionType::Value) {
+      limit_node->limit_type = LimitType::TopK;
+    }
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule finds LimitNodes with a constant number of rows whose input is a SortNode. Instead of sorting the
+ * entire input and discarding all but the first rows afterwards, such a pair can be executed by the TopK operator,
+ * which only keeps the best k rows of each chunk. The LimitType of the LimitNode is set to TopK in that case and the
+ * LQPTranslator fuses the SortNode(s) below it into the TopK operator.
+ *
+ * If the SortNode has further outputs, its sorted result is needed anyway and the rule is not applied.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -245,7 +245,8 @@ std::enable_if_t<std::is_same_v<BaseSegment, std::remove_const_t<BaseSegmentType
 }
 
 /**
- * This function returns the DataType of a data type based on the definition in data_type_pairs.
+ * This function returns the DataType of a data type based on the definition in data_type_pairs. The logical data types
+ * Date and Timestamp share their types with Int and Long, so the first matching pair wins.
  */
 template <typename T>
 constexpr DataType data_type_from_type() {
@@ -253,7 +254,7 @@ constexpr DataType data_type_from_type() {
 
   return hana::fold_left(data_type_pairs, DataType{}, [](auto data_type, auto type_tuple) {
     // check whether T is one of the column types
-    if (hana::type_c<T> == hana::second(type_tuple)) {
+    if (data_type == DataType{} && hana::type_c<T> == hana::second(type_tuple)) {
       return hana::first(type_tuple);
     }
 
@@ -27,6 +27,10 @@ bool AbstractTask::is_done() const { return _done; }
 
 bool AbstractTask::is_stealable() const { return _stealable; }
 
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
+SchedulePriority AbstractTask::current_priority() { return _current_priority; }
+
 bool AbstractTask::is_scheduled() const { return _is_scheduled; }
 
 std::string AbstractTask::description() const {
@@ -59,6 +63,7 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 
 void AbstractTask::schedule(NodeID preferred_node_id) {
   _mark_as_scheduled();
+  DTRACE_PROBE3(HYRISE, JOB_SCHEDULED, _id.load(), preferred_node_id, reinterpret_cast<uintptr_t>(this));
 
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, _priority);
@@ -75,12 +80,28 @@ void AbstractTask::_join() {
   _done_condition_variable.wait(lock, [&]() { return static_cast<bool>(_done); });
 }
 
+bool AbstractTask::_join_for(const std::chrono::microseconds timeout) {
+  DebugAssert((_is_scheduled), "Task must be scheduled before it can be waited for");
+
+  std::unique_lock<std::mutex> lock(_done_mutex);
+  return _done_condition_variable.wait_for(lock, timeout, [&]() { return static_cast<bool>(_done); });
+}
+
 void AbstractTask::execute() {
   DTRACE_PROBE3(HYRISE, JOB_START, _id.load(), _description.c_str(), reinterpret_cast<uintptr_t>(this));
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  // Tasks created by _on_execute() inherit this task's priority. The previous priority is restored even if
+  // _on_execute() throws, which is possible if the task is executed without a Scheduler.
+  const auto previous_priority = std::exchange(_current_priority, _priority);
+  try {
+    _on_execute();
+  } catch (...) {
+    _current_priority = previous_priority;
+    throw;
+  }
+  _current_priority = previous_priority;
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -109,7 +130,7 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      worker->enqueue(shared_from_this(), SchedulePriority::High);
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
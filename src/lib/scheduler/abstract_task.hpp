@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -21,11 +22,22 @@ class Worker;
  */
 class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   friend class CurrentScheduler;
+  friend class Worker;
 
  public:
-  explicit AbstractTask(SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
+  /**
+   * By default, a task inherits the priority of the task that is executed by the creating thread, so that the jobs
+   * spawned by a high priority query are high priority as well (see current_priority()).
+   */
+  explicit AbstractTask(SchedulePriority priority = current_priority(), bool stealable = true);
   virtual ~AbstractTask() = default;
 
+  /**
+   * @return The priority of the task that the calling thread currently executes, SchedulePriority::Default if it
+   *         executes none
+   */
+  static SchedulePriority current_priority();
+
   /**
    * Unique ID of a task. Currently not in use, but really helpful for debugging.
    */
@@ -47,6 +59,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  SchedulePriority priority() const;
+
   /**
    * Description for debugging purposes
    */
@@ -127,6 +141,14 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _join();
 
+  /**
+   * Like _join(), but returns after @param timeout at the latest. Used by Workers that wait for their jobs but found
+   * no other task to execute in the meantime. Returns whether the Task finished executing.
+   */
+  bool _join_for(const std::chrono::microseconds timeout);
+
+  inline static thread_local SchedulePriority _current_priority = SchedulePriority::Default;
+
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
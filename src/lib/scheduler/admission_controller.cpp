@@ -0,0 +1,90 @@
+#include "admission_controller.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "memory/memory_budget.hpp"
+#include "scheduler/worker.hpp"
+
+namespace opossum {
+
+AdmissionController::Admission::Admission(const std::shared_ptr<MemoryBudget>& memory_budget)
+    : _memory_budget(memory_budget) {}
+
+AdmissionController::Admission::Admission(Admission&& other) noexcept
+    : _memory_budget(std::move(other._memory_budget)) {}
+
+AdmissionController::Admission::~Admission() {
+  if (_memory_budget) AdmissionController::get()._release(_memory_budget);
+}
+
+void AdmissionController::set_global_budget(const std::optional<size_t>& bytes) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _global_budget = bytes;
+  }
+  _statement_finished.notify_all();
+}
+
+std::optional<size_t> AdmissionController::global_budget() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _global_budget;
+}
+
+AdmissionController::Admission AdmissionController::admit(const std::shared_ptr<MemoryBudget>& memory_budget) {
+  std::unique_lock<std::mutex> lock{_mutex};
+
+  if (!Worker::get_this_thread_worker()) {
+    ++_waiting_statement_count;
+    while (!_may_admit(*memory_budget)) {
+      _statement_finished.wait_for(lock, RECHECK_INTERVAL);
+    }
+    --_waiting_statement_count;
+  }
+
+  _running_statement_budgets.emplace_back(memory_budget);
+  return Admission{memory_budget};
+}
+
+size_t AdmissionController::running_statement_count() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _running_statement_budgets.size();
+}
+
+size_t AdmissionController::waiting_statement_count() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _waiting_statement_count;
+}
+
+size_t AdmissionController::used_bytes() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _used_bytes();
+}
+
+bool AdmissionController::_may_admit(const MemoryBudget& memory_budget) const {
+  if (!_global_budget || _running_statement_budgets.empty()) return true;
+
+  const auto requested_bytes = memory_budget.limit() == MemoryBudget::UNLIMITED ? size_t{0} : memory_budget.limit();
+  const auto used_bytes = _used_bytes();
+  return used_bytes < *_global_budget && requested_bytes <= *_global_budget - used_bytes;
+}
+
+size_t AdmissionController::_used_bytes() const {
+  auto used_bytes = size_t{0};
+  for (const auto& memory_budget : _running_statement_budgets) {
+    used_bytes += memory_budget->used_bytes();
+  }
+  return used_bytes;
+}
+
+void AdmissionController::_release(const std::shared_ptr<MemoryBudget>& memory_budget) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    const auto iter = std::find(_running_statement_budgets.begin(), _running_statement_budgets.end(), memory_budget);
+    if (iter != _running_statement_budgets.end()) _running_statement_budgets.erase(iter);
+  }
+  _statement_finished.notify_all();
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class MemoryBudget;
+
+/**
+ * Limits the memory of all concurrently executed SQLPipelineStatements to a global budget. Before a statement is
+ * executed, it has to be admitted. It is admitted if the memory currently used by the running statements (see
+ * MemoryBudget) plus the limit of its own budget - if it has one - fits into the global budget. Otherwise, it is
+ * queued until running statements have finished or released memory.
+ *
+ * A statement is always admitted if no other statement is running, so that statements that exceed the global budget
+ * on their own do not wait forever. Statements that are executed by a Worker of the scheduler (e.g., by the server)
+ * are admitted without waiting, as blocking the Worker could keep the running statements from finishing.
+ *
+ * By default, there is no global budget and all statements are admitted right away.
+ */
+class AdmissionController : public Singleton<AdmissionController> {
+ public:
+  // Counts a statement as running until it is destroyed
+  class Admission : private Noncopyable {
+   public:
+    Admission(Admission&& other) noexcept;
+    ~Admission();
+
+   private:
+    friend class AdmissionController;
+
+    explicit Admission(const std::shared_ptr<MemoryBudget>& memory_budget);
+
+    std::shared_ptr<MemoryBudget> _memory_budget;
+  };
+
+  // Running statements are not affected when the global budget is changed
+  void set_global_budget(const std::optional<size_t>& bytes);
+  std::optional<size_t> global_budget() const;
+
+  // Blocks until the statement that uses @param memory_budget is admitted
+  Admission admit(const std::shared_ptr<MemoryBudget>& memory_budget);
+
+  size_t running_statement_count() const;
+  size_t waiting_statement_count() const;
+
+  // Memory used by the running statements
+  size_t used_bytes() const;
+
+ protected:
+  friend class Singleton;
+
+  AdmissionController() = default;
+
+  // Memory is released by running statements without a notification, so waiting statements check it periodically
+  static constexpr auto RECHECK_INTERVAL = std::chrono::milliseconds{10};
+
+  bool _may_admit(const MemoryBudget& memory_budget) const;
+  size_t _used_bytes() const;
+  void _release(const std::shared_ptr<MemoryBudget>& memory_budget);
+
+  mutable std::mutex _mutex;
+  std::condition_variable _statement_finished;
+  std::optional<size_t> _global_budget;
+  std::vector<std::shared_ptr<MemoryBudget>> _running_statement_budgets;
+  size_t _waiting_statement_count{0};
+};
+
+}  // namespace opossum
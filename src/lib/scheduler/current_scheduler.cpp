@@ -1,6 +1,8 @@
 #include "current_scheduler.hpp"
 
+#include <chrono>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
@@ -17,4 +19,8 @@ void CurrentScheduler::set(const std::shared_ptr<AbstractScheduler>& instance) {
 
 bool CurrentScheduler::is_set() { return !!_instance; }
 
+std::chrono::nanoseconds* CurrentScheduler::set_wait_time_of_this_thread(std::chrono::nanoseconds* wait_time) {
+  return std::exchange(_wait_time_of_this_thread, wait_time);
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -38,8 +39,17 @@ class CurrentScheduler {
   template <typename TaskType>
   static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * The time that the calling thread spends in wait_for_tasks() is added to @param wait_time (unless it is nullptr)
+   * until another one is set. Returns the previously set one so that it can be restored. AbstractOperator::execute()
+   * uses this to measure how long an operator waits for its jobs.
+   */
+  static std::chrono::nanoseconds* set_wait_time_of_this_thread(std::chrono::nanoseconds* wait_time);
+
  private:
   static std::shared_ptr<AbstractScheduler> _instance;
+
+  inline static thread_local std::chrono::nanoseconds* _wait_time_of_this_thread = nullptr;
 };
 
 template <typename TaskType>
@@ -58,12 +68,17 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
    * In case wait_for_tasks() is called from a Task being executed in a Worker, let the Worker handle the join()-ing,
    * otherwise join right here
    */
+  auto* const wait_time = _wait_time_of_this_thread;
+  const auto wait_started = wait_time ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
   auto worker = Worker::get_this_thread_worker();
   if (worker) {
     worker->_wait_for_tasks(tasks);
   } else {
     for (auto& task : tasks) task->_join();
   }
+
+  if (wait_time) *wait_time += std::chrono::steady_clock::now() - wait_started;
 }
 
 template <typename TaskType>
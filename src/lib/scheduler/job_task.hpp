@@ -28,7 +28,7 @@ namespace opossum {
  */
 class JobTask : public AbstractTask {
  public:
-  explicit JobTask(const std::function<void()>& fn, SchedulePriority priority = SchedulePriority::Default,
+  explicit JobTask(const std::function<void()>& fn, SchedulePriority priority = current_priority(),
                    bool stealable = true)
       : AbstractTask(priority, stealable), _fn(fn) {}
 
@@ -2,7 +2,9 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -17,7 +19,13 @@
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler() { _worker_id_allocator = std::make_shared<UidAllocator>(); }
+NodeQueueScheduler::NodeQueueScheduler(bool use_local_deques, bool one_worker_per_physical_core,
+                                       bool use_cache_domain_queues)
+    : _use_local_deques(use_local_deques),
+      _one_worker_per_physical_core(one_worker_per_physical_core),
+      _use_cache_domain_queues(use_cache_domain_queues) {
+  _worker_id_allocator = std::make_shared<UidAllocator>();
+}
 
 NodeQueueScheduler::~NodeQueueScheduler() {
   if (HYRISE_DEBUG && _active) {
@@ -31,16 +39,37 @@ void NodeQueueScheduler::begin() {
   _workers.reserve(Topology::get().num_cpus());
   _queues.reserve(Topology::get().nodes().size());
 
-  for (auto node_id = NodeID{0}; node_id < Topology::get().nodes().size(); node_id++) {
-    auto queue = std::make_shared<TaskQueue>(node_id);
+  _queues_per_node.resize(Topology::get().nodes().size());
 
-    _queues.emplace_back(queue);
+  auto used_core_ids = std::set<CpuID>{};
+
+  for (auto node_id = NodeID{0}; node_id < Topology::get().nodes().size(); node_id++) {
+    auto& node_queues = _queues_per_node[node_id];
+
+    // Without cache domain queues, all CPUs of the node use the same queue
+    auto queue_per_cache_domain = std::map<uint32_t, std::shared_ptr<TaskQueue>>{};
+    const auto get_queue = [&](const uint32_t cache_domain_id) {
+      auto& queue = queue_per_cache_domain[_use_cache_domain_queues ? cache_domain_id : 0];
+      if (!queue) {
+        queue = std::make_shared<TaskQueue>(node_id);
+        _queues.emplace_back(queue);
+        node_queues.emplace_back(queue);
+      }
+      return queue;
+    };
 
     auto& topology_node = Topology::get().nodes()[node_id];
 
     for (auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      if (_one_worker_per_physical_core && !used_core_ids.emplace(topology_cpu.core_id).second) continue;
+
+      _workers.emplace_back(std::make_shared<Worker>(get_queue(topology_cpu.cache_domain_id),
+                                                     _worker_id_allocator->allocate(), topology_cpu.cpu_id,
+                                                     _use_local_deques));
     }
+
+    // Nodes without Workers still accept tasks, which are then stolen by other nodes
+    if (node_queues.empty()) get_queue(0);
   }
 
   _active = true;
@@ -71,16 +100,25 @@ void NodeQueueScheduler::finish() {
     for ([[maybe_unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[maybe_unused]] auto& worker : _workers) {
+      DebugAssert(!worker->steal_from_local_deque(),
+                  "NodeQueueScheduler bug: Deque wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
 
+  for (auto& queue : _queues) {
+    queue->notify_all_workers();
+  }
+
   for (auto& worker : _workers) {
     worker->join();
   }
 
   _workers = {};
   _queues = {};
+  _queues_per_node = {};
   _task_counter = 0;
 }
 
@@ -88,6 +126,8 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -105,17 +145,21 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
-      preferred_node_id = worker->queue()->node_id();
+      // Lets the worker decide between its local deque (if any) and the TaskQueue of its node
+      worker->enqueue(task, priority);
+      return;
     } else {
       // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
       preferred_node_id = NodeID{0};
     }
   }
 
-  DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
+  DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues_per_node.size()),
               "preferred_node_id is not within range of available nodes");
 
-  auto queue = _queues[preferred_node_id];
+  const auto& node_queues = _queues_per_node[preferred_node_id];
+  const auto& queue = node_queues.size() == 1 ? node_queues.front()
+                                              : node_queues[_next_queue_idx++ % node_queues.size()];
   queue->push(task, static_cast<uint32_t>(priority));
 }
 }  // namespace opossum
@@ -34,11 +34,10 @@ namespace opossum {
  *
  * JobTasks can be used from anywhere to parallelize parts of their work.
  * If a task spawns jobs to be executed, the worker executing the main task waits for the jobs to complete.
- * Since the CPU to which the worker is pinned shall not be blocked, a new worker is (re-)activated temporarily.
- * The worker executing the main task is hibernated and will be re-activated once the jobs have completed.
- * There is only one active worker per CPU, which is allowed to pull new tasks from the queue.
- * Thus, while it is possible that two workers are executing a task at the same time, this is only until the non-active
- * worker finished its task. It will then be hibernated.
+ * Since the CPU to which the worker is pinned shall not be blocked, the worker executes other ready tasks while it
+ * waits (help-first), preferring the jobs in its own local deque. Only if there is no ready task at all, it sleeps
+ * until one of the jobs it waits for is done. No additional threads are created for waiting, so even deeply nested
+ * parallelism (e.g., subqueries or joins below aggregates) runs with one thread per worker.
  *
  *
  * SCHEDULER AND TOPOLOGY
@@ -53,21 +52,51 @@ namespace opossum {
  * with multiple nodes (queues) and worker and should mainly be used for testing NUMA-concepts
  * on non-NUMA development machines.
  *
+ * SMT siblings (hyperthreads) compete for the execution units and caches of their physical core, which slows down
+ * scan-heavy workloads. With one_worker_per_physical_core, only one Worker is started per physical core. On CPUs with
+ * multiple last level caches per node (e.g., the CCXs of AMD EPYC), use_cache_domain_queues creates one TaskQueue per
+ * cache domain instead of one per node, so that tasks of a Worker stay in its cache domain.
+ *
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
+ * Work stealing is useful to avoid idle workers (and therefore idle CPUs) while there are still tasks in the system
+ * that need to be processed. A worker gets idle if it can not pull a ready task. This occurs in two cases:
  *  1) all tasks in the queue are not ready
  *  2) the queue is empty
  * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
  * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
  * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * By default, all workers of a node share the node's TaskQueue and an idle worker simply pulls a stealable task from
+ * the queue of a remote node. Afterwards, the current worker is checking its local queue again. With cache domain
+ * queues, the queues of the other cache domains of the same node are checked before those of remote nodes.
+ *
+ *
+ * WORKER-LOCAL DEQUES
+ *
+ * With many small JobTasks, the single TaskQueue per node becomes a point of contention. If the NodeQueueScheduler is
+ * created with use_local_deques, every Worker additionally owns a lock-free WorkStealingDeque. Stealable tasks that
+ * are scheduled (or become ready) on a worker thread are pushed to that worker's deque, which the worker itself
+ * processes in LIFO order. An idle worker first looks at its own deque and the TaskQueue of its node, then steals
+ * (FIFO) from the deques of the other workers on the same node, and only then crosses node boundaries, first to the
+ * remote TaskQueues and then to the remote deques. Tasks scheduled from outside of a worker as well as non-stealable
+ * tasks still go through the TaskQueues.
+ *
+ *
+ * PRIORITIES
+ *
+ * Tasks are scheduled with SchedulePriority::High, Default, or Low, e.g., per SQLPipeline (see
+ * SQLPipelineBuilder::with_priority()). Tasks inherit the priority of the task that created them, so the jobs spawned
+ * by an operator have the priority of its query. Workers prefer high priority tasks of their TaskQueue over the tasks
+ * in their local deque, and the TaskQueue prefers high priority tasks except for every LOW_PRIORITY_PULL_INTERVAL-th
+ * pull. Thus, short queries overtake long-running ones, which still keep progressing.
+ *
+ *
+ * STATISTICS
+ *
+ * Every Worker counts its busy and idle time, its finished and stolen tasks, and how often it went to sleep because it
+ * found no task (see Worker::statistics()). Every TaskQueue counts its tasks per priority. To tune the number of
+ * workers, create_scheduler_statistics_table() (or `scheduler_info` in the console) lists these values per Worker.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -81,7 +110,13 @@ class UidAllocator;
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  NodeQueueScheduler();
+  /**
+   * @param use_local_deques              Give each Worker its own work-stealing deque for tasks spawned on it
+   * @param one_worker_per_physical_core  Do not start Workers on the SMT siblings of a core
+   * @param use_cache_domain_queues       Create a TaskQueue per cache domain (see Topology) instead of per node
+   */
+  explicit NodeQueueScheduler(bool use_local_deques = false, bool one_worker_per_physical_core = false,
+                              bool use_cache_domain_queues = false);
   ~NodeQueueScheduler() override;
 
   /**
@@ -96,6 +131,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -105,9 +142,16 @@ class NodeQueueScheduler : public AbstractScheduler {
                 SchedulePriority priority = SchedulePriority::Default) override;
 
  private:
+  const bool _use_local_deques;
+  const bool _one_worker_per_physical_core;
+  const bool _use_cache_domain_queues;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
+
+  // The TaskQueues of each node. Tasks scheduled for a node with multiple queues are distributed round-robin.
+  std::vector<std::vector<std::shared_ptr<TaskQueue>>> _queues_per_node;
+  std::atomic<size_t> _next_queue_idx{0};
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _active{false};
 };
@@ -1,19 +1,41 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_manager.hpp"
 
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "storage/table.hpp"
 
 #include "scheduler/job_task.hpp"
 #include "scheduler/worker.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
+
+namespace {
+
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts,
+                     std::unordered_set<std::shared_ptr<AbstractOperator>>& visited_operators) {
+  if (!visited_operators.emplace(op).second) return;
+
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+    ++consumer_counts[input];
+    count_consumers(input, consumer_counts, visited_operators);
+  }
+}
+
+}  // namespace
+
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
                            SchedulePriority priority, bool stealable)
     : AbstractTask(priority, stealable), _op(std::move(op)), _cleanup_temporaries(cleanup_temporaries) {}
@@ -23,30 +45,71 @@ std::string OperatorTask::description() const {
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
+    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+    FusePipelines fuse_pipelines, SchedulePriority priority) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_counts;
+  if (fuse_pipelines == FusePipelines::Yes) {
+    std::unordered_set<std::shared_ptr<AbstractOperator>> visited_operators;
+    count_consumers(op, consumer_counts, visited_operators);
+    // The result operator is consumed by the caller
+    ++consumer_counts[op];
+  }
+
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries, priority, consumer_counts);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-    CleanupTemporaries cleanup_temporaries) {
+    CleanupTemporaries cleanup_temporaries, SchedulePriority priority,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
-  const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
+  const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries, priority);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
+  // consumer_counts is only set if pipelines are fused. Walk down the chain of pipelineable chunkwise operators that
+  // are the only consumer of their input. All of them are executed by this task.
+  auto pipeline_begin = op;
+  if (!consumer_counts.empty()) {
+    const auto is_pipelineable = [](const auto& chunkwise_operator) {
+      return chunkwise_operator && chunkwise_operator->is_pipelineable();
+    };
+
+    auto chunkwise_operator = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(op);
+    if (is_pipelineable(chunkwise_operator)) {
+      task->_pipeline.emplace_back(chunkwise_operator);
+
+      while (true) {
+        const auto input = pipeline_begin->mutable_input_left();
+        if (!input || consumer_counts.at(input) != 1 || task_by_op.count(input)) break;
+
+        chunkwise_operator = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(input);
+        if (!is_pipelineable(chunkwise_operator)) break;
+
+        task->_pipeline.emplace_back(chunkwise_operator);
+        task_by_op.emplace(input, task);
+        pipeline_begin = input;
+      }
+
+      std::reverse(task->_pipeline.begin(), task->_pipeline.end());
+    }
+  }
+
+  if (auto left = pipeline_begin->mutable_input_left()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries, priority,
+                                                               consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
+  if (auto right = pipeline_begin->mutable_input_right()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries, priority,
+                                                               consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
@@ -82,8 +145,16 @@ void OperatorTask::_on_execute() {
     }
   }
 
+  // The operators of a cancelled statement that have not started yet are skipped. Their successors are skipped as
+  // well, as cancellation cannot be undone, and the statement discards the incomplete results.
+  if (_op->is_cancelled()) return;
+
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  if (_pipeline.size() > 1) {
+    AbstractChunkwiseOperator::execute_pipeline(_pipeline);
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
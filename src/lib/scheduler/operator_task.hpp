@@ -8,6 +8,7 @@
 
 namespace opossum {
 
+class AbstractChunkwiseOperator;
 class AbstractOperator;
 
 /**
@@ -17,13 +18,17 @@ class OperatorTask : public AbstractTask {
  public:
   // We don't like abbreviations, but "operator" is a keyword
   OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
-               SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
+               SchedulePriority priority = current_priority(), bool stealable = true);
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   * With FusePipelines::Yes, chains of pipelineable AbstractChunkwiseOperators are executed by a single task, where
+   * only the last operator of the chain has an output. An operator is only fused with its input if it is the only
+   * consumer of that input. All tasks are scheduled with @param priority.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
+      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+      FusePipelines fuse_pipelines = FusePipelines::No, SchedulePriority priority = current_priority());
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
@@ -35,14 +40,21 @@ class OperatorTask : public AbstractTask {
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
    * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param consumer_counts  Number of consumers of each operator, only set if pipelines are fused
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-      CleanupTemporaries cleanup_temporaries);
+      CleanupTemporaries cleanup_temporaries, SchedulePriority priority,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+
+  // If the task executes a fused pipeline, the operators of the pipeline, ending with _op
+  std::vector<std::shared_ptr<AbstractChunkwiseOperator>> _pipeline;
+
+  friend class OperatorTaskGraph;
 };
 }  // namespace opossum
@@ -0,0 +1,105 @@
+#include "operator_task_graph.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_chunkwise_operator.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/operator_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Post-order, so that inputs are numbered before the operators that consume them
+size_t number_operators(const AbstractOperator* op, std::unordered_map<const AbstractOperator*, size_t>& index_by_op) {
+  const auto index_by_op_iter = index_by_op.find(op);
+  if (index_by_op_iter != index_by_op.end()) return index_by_op_iter->second;
+
+  if (op->input_left()) number_operators(op->input_left().get(), index_by_op);
+  if (op->input_right()) number_operators(op->input_right().get(), index_by_op);
+
+  const auto index = index_by_op.size();
+  index_by_op.emplace(op, index);
+  return index;
+}
+
+}  // namespace
+
+namespace opossum {
+
+OperatorTaskGraph::OperatorTaskGraph(const std::shared_ptr<AbstractOperator>& root, const FusePipelines fuse_pipelines)
+    : _fuse_pipelines(fuse_pipelines) {
+  auto index_by_op = std::unordered_map<const AbstractOperator*, size_t>{};
+  number_operators(root.get(), index_by_op);
+
+  _operators.resize(index_by_op.size());
+  for (const auto& [op, index] : index_by_op) {
+    auto& node = _operators[index];
+    node.op = op;
+    if (op->input_left()) node.input_left = index_by_op.at(op->input_left().get());
+    if (op->input_right()) node.input_right = index_by_op.at(op->input_right().get());
+  }
+
+  // The tasks are only created to record their structure, so that the graph is guaranteed to match the tasks of
+  // make_tasks_from_operator()
+  const auto tasks = OperatorTask::make_tasks_from_operator(root, CleanupTemporaries::No, fuse_pipelines);
+
+  auto index_by_task = std::unordered_map<const AbstractTask*, size_t>{};
+  _tasks.resize(tasks.size());
+  for (auto task_index = size_t{0}; task_index < tasks.size(); ++task_index) {
+    const auto& task = tasks[task_index];
+    index_by_task.emplace(task.get(), task_index);
+
+    auto& node = _tasks[task_index];
+    node.operator_index = index_by_op.at(task->get_operator().get());
+    for (const auto& op : task->_pipeline) {
+      node.pipeline.emplace_back(index_by_op.at(op.get()));
+    }
+    for (const auto& predecessor : task->predecessors()) {
+      // make_tasks_from_operator() adds the predecessors of a task to the result before the task itself
+      node.predecessors.emplace_back(index_by_task.at(predecessor.lock().get()));
+    }
+  }
+}
+
+OperatorTaskGraph::Instance OperatorTaskGraph::instantiate(const CleanupTemporaries cleanup_temporaries,
+                                                           const SchedulePriority priority) const {
+  auto operators = std::vector<std::shared_ptr<AbstractOperator>>(_operators.size());
+  for (auto operator_index = size_t{0}; operator_index < _operators.size(); ++operator_index) {
+    const auto& node = _operators[operator_index];
+    const auto& copied_input_left = node.input_left ? operators[*node.input_left] : nullptr;
+    const auto& copied_input_right = node.input_right ? operators[*node.input_right] : nullptr;
+    operators[operator_index] = node.op->_copy_with_inputs(copied_input_left, copied_input_right);
+  }
+
+  auto tasks = std::vector<std::shared_ptr<OperatorTask>>{};
+  tasks.reserve(_tasks.size());
+  for (const auto& node : _tasks) {
+    const auto task = std::make_shared<OperatorTask>(operators[node.operator_index], cleanup_temporaries, priority);
+
+    task->_pipeline.reserve(node.pipeline.size());
+    for (const auto operator_index : node.pipeline) {
+      task->_pipeline.emplace_back(std::static_pointer_cast<AbstractChunkwiseOperator>(operators[operator_index]));
+    }
+
+    for (const auto predecessor_index : node.predecessors) {
+      tasks[predecessor_index]->set_as_predecessor_of(task);
+    }
+
+    tasks.emplace_back(task);
+  }
+
+  DebugAssert(tasks.back()->get_operator() == operators.back(), "The root's task should be the last task");
+  return {operators.back(), std::move(tasks)};
+}
+
+FusePipelines OperatorTaskGraph::fuse_pipelines() const { return _fuse_pipelines; }
+
+size_t OperatorTaskGraph::operator_count() const { return _operators.size(); }
+
+size_t OperatorTaskGraph::task_count() const { return _tasks.size(); }
+
+}  // namespace opossum
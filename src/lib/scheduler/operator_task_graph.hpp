@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class OperatorTask;
+
+/**
+ * Template of the OperatorTasks of a PQP, used to execute cached PQPs (see SQLPhysicalPlanCache) without walking them.
+ *
+ * A cached PQP is never executed itself. Instead, each execution needs a copy of it and the tasks of that copy.
+ * AbstractOperator::deep_copy() and OperatorTask::make_tasks_from_operator() both walk the PQP recursively and look up
+ * every operator in a hash map to support diamond shapes, which is a notable part of the latency of short queries.
+ * The graph does this once: It records the operators in topological order, the indices of their inputs, and the
+ * tasks that make_tasks_from_operator() creates for them (including fused pipelines and the dependencies between the
+ * tasks). instantiate() then copies the operators and creates their tasks in a single pass over these vectors.
+ *
+ * The graph refers to the operators of the PQP without owning them, as it is owned by the root of the PQP (see
+ * AbstractOperator::task_graph()). Thus, it may only be used while the PQP is alive.
+ */
+class OperatorTaskGraph : private Noncopyable {
+ public:
+  OperatorTaskGraph(const std::shared_ptr<AbstractOperator>& root, const FusePipelines fuse_pipelines);
+
+  struct Instance {
+    std::shared_ptr<AbstractOperator> root;
+    // Ordered like the tasks returned by OperatorTask::make_tasks_from_operator(), i.e., the root's task is the last
+    std::vector<std::shared_ptr<OperatorTask>> tasks;
+  };
+
+  // Copies the operators like AbstractOperator::deep_copy() and creates their tasks
+  Instance instantiate(const CleanupTemporaries cleanup_temporaries, const SchedulePriority priority) const;
+
+  FusePipelines fuse_pipelines() const;
+  size_t operator_count() const;
+  size_t task_count() const;
+
+ private:
+  struct OperatorNode {
+    const AbstractOperator* op;
+    std::optional<size_t> input_left;
+    std::optional<size_t> input_right;
+  };
+
+  struct TaskNode {
+    size_t operator_index;
+    // If the task executes a pipeline, the indices of its operators, ending with operator_index
+    std::vector<size_t> pipeline;
+    std::vector<size_t> predecessors;
+  };
+
+  const FusePipelines _fuse_pipelines;
+
+  // Inputs precede the operators that consume them, and predecessors precede their successors
+  std::vector<OperatorNode> _operators;
+  std::vector<TaskNode> _tasks;
+};
+
+}  // namespace opossum
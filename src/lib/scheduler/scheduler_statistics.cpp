@@ -0,0 +1,47 @@
+#include "scheduler_statistics.hpp"
+
+#include <memory>
+
+#include "abstract_scheduler.hpp"
+#include "current_scheduler.hpp"
+#include "storage/table.hpp"
+#include "task_queue.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Table> create_scheduler_statistics_table() {
+  const auto column_definitions = TableColumnDefinitions{{"worker_id", DataType::Long},
+                                                         {"node_id", DataType::Long},
+                                                         {"cpu_id", DataType::Long},
+                                                         {"busy_time_ns", DataType::Long},
+                                                         {"idle_time_ns", DataType::Long},
+                                                         {"finished_tasks", DataType::Long},
+                                                         {"stolen_local_tasks", DataType::Long},
+                                                         {"stolen_remote_tasks", DataType::Long},
+                                                         {"hibernations", DataType::Long},
+                                                         {"queued_high_priority_tasks", DataType::Long},
+                                                         {"queued_default_priority_tasks", DataType::Long},
+                                                         {"queued_low_priority_tasks", DataType::Long}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  if (!CurrentScheduler::is_set()) return table;
+
+  for (const auto& worker : CurrentScheduler::get()->workers()) {
+    const auto statistics = worker->statistics();
+    const auto& queue = worker->queue();
+
+    table->append({static_cast<int64_t>(worker->id()), static_cast<int64_t>(queue->node_id()),
+                   static_cast<int64_t>(worker->cpu_id()), static_cast<int64_t>(statistics.busy_time.count()),
+                   static_cast<int64_t>(statistics.idle_time.count()), static_cast<int64_t>(statistics.finished_tasks),
+                   static_cast<int64_t>(statistics.stolen_local_tasks),
+                   static_cast<int64_t>(statistics.stolen_remote_tasks), static_cast<int64_t>(statistics.hibernations),
+                   static_cast<int64_t>(queue->estimate_size(static_cast<uint32_t>(SchedulePriority::High))),
+                   static_cast<int64_t>(queue->estimate_size(static_cast<uint32_t>(SchedulePriority::Default))),
+                   static_cast<int64_t>(queue->estimate_size(static_cast<uint32_t>(SchedulePriority::Low)))});
+  }
+
+  return table;
+}
+
+}  // namespace opossum
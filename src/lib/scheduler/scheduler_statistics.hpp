@@ -0,0 +1,16 @@
+#pragma once
+
+#include <memory>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Creates a table with one row per Worker of the current Scheduler, holding the Worker's counters (see
+ * Worker::statistics()) and the number of tasks per priority in the TaskQueue of its node. This shows whether the
+ * Workers are starving, oversubscribed, or stealing across nodes a lot. The table is empty if no Scheduler is set.
+ */
+std::shared_ptr<Table> create_scheduler_statistics_table();
+
+}  // namespace opossum
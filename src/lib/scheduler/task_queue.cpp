@@ -19,6 +19,11 @@ bool TaskQueue::empty() const {
 
 NodeID TaskQueue::node_id() const { return _node_id; }
 
+size_t TaskQueue::estimate_size(uint32_t priority) const {
+  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
+  return _sizes[priority].load(std::memory_order_relaxed);
+}
+
 void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
   DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
 
@@ -26,15 +31,47 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
+  _sizes[priority].fetch_add(1, std::memory_order_relaxed);
   _queues[priority].push(task);
 
-  new_task.notify_one();
+  notify_new_task();
+}
+
+void TaskQueue::notify_new_task() {
+  // Either a Worker that is about to sleep sees the new epoch, or it is counted as sleeping here. In the latter case,
+  // taking the mutex ensures that it actually waits on the condition variable before it is notified.
+  _new_task_epoch.fetch_add(1);
+  if (_num_sleeping_workers.load() == 0) return;
+
+  { const auto lock_guard = std::lock_guard<std::mutex>{_new_task_mutex}; }
+  _new_task.notify_one();
+}
+
+void TaskQueue::notify_all_workers() {
+  _new_task_epoch.fetch_add(1);
+  { const auto lock_guard = std::lock_guard<std::mutex>{_new_task_mutex}; }
+  _new_task.notify_all();
+}
+
+uint64_t TaskQueue::new_task_epoch() const { return _new_task_epoch.load(); }
+
+void TaskQueue::wait_for_new_task(const uint64_t observed_epoch, const std::chrono::microseconds timeout) {
+  auto unique_lock = std::unique_lock<std::mutex>{_new_task_mutex};
+  _num_sleeping_workers.fetch_add(1);
+  if (_new_task_epoch.load() == observed_epoch) _new_task.wait_for(unique_lock, timeout);
+  _num_sleeping_workers.fetch_sub(1);
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
+  const auto prefer_low_priority =
+      _pull_count.load(std::memory_order_relaxed) % LOW_PRIORITY_PULL_INTERVAL == LOW_PRIORITY_PULL_INTERVAL - 1;
+
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
+  for (auto index = uint32_t{0}; index < NUM_PRIORITY_LEVELS; ++index) {
+    const auto priority = prefer_low_priority ? NUM_PRIORITY_LEVELS - 1 - index : index;
+    if (_queues[priority].try_pop(task)) {
+      _sizes[priority].fetch_sub(1, std::memory_order_relaxed);
+      _pull_count.fetch_add(1, std::memory_order_relaxed);
       return task;
     }
   }
@@ -43,9 +80,11 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
+  for (auto priority = uint32_t{0}; priority < NUM_PRIORITY_LEVELS; ++priority) {
+    auto& queue = _queues[priority];
     if (queue.try_pop(task)) {
       if (task->is_stealable()) {
+        _sizes[priority].fetch_sub(1, std::memory_order_relaxed);
         return task;
       } else {
         queue.push(task);
@@ -4,8 +4,10 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "types.hpp"
 
@@ -18,7 +20,10 @@ class AbstractTask;
  */
 class TaskQueue {
  public:
-  static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
+
+  // Every LOW_PRIORITY_PULL_INTERVAL-th task pulled from the queue is taken from the lowest non-empty priority level
+  static constexpr uint32_t LOW_PRIORITY_PULL_INTERVAL = 8;
 
   explicit TaskQueue(NodeID node_id);
 
@@ -26,10 +31,18 @@ class TaskQueue {
 
   NodeID node_id() const;
 
+  /**
+   * Number of tasks with the given priority that are currently in the queue. Only an estimate while other threads
+   * push or pull tasks.
+   */
+  size_t estimate_size(uint32_t priority) const;
+
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Returns a Tasks that is ready to be executed and removes it from the queue. Higher priorities are pulled first,
+   * except for every LOW_PRIORITY_PULL_INTERVAL-th task. Thus, a steady stream of high priority tasks (e.g., of short
+   * transactional queries) bounds the progress of default priority tasks (e.g., of long scans) but cannot stop it.
    */
   std::shared_ptr<AbstractTask> pull();
 
@@ -39,18 +52,38 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> steal();
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Wakes up one Worker that sleeps in wait_for_new_task(). Called by push() and whenever a task becomes available to
+   * the Workers of this queue in another way (e.g., in the local deque of one of them).
    */
-  std::condition_variable new_task;
+  void notify_new_task();
+
+  // Wakes up all sleeping Workers, e.g., when the scheduler shuts down
+  void notify_all_workers();
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Lets an idle Worker sleep until a task is announced by notify_new_task() or the timeout expires. A Worker reads
+   * new_task_epoch() before looking for tasks and passes it here, so that announcements made in the meantime are not
+   * lost: Then, the Worker does not sleep at all.
    */
-  std::mutex lock;
+  uint64_t new_task_epoch() const;
+  void wait_for_new_task(uint64_t observed_epoch, std::chrono::microseconds timeout);
 
  private:
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // Incremented before a task is pushed and decremented after it was popped, so the counts never underflow
+  std::array<std::atomic<size_t>, NUM_PRIORITY_LEVELS> _sizes{};
+
+  // Number of tasks pulled so far, only approximate under contention
+  std::atomic<uint32_t> _pull_count{0};
+
+  // Incremented by every notify_new_task(). Announcements only take the mutex if a Worker sleeps, see
+  // wait_for_new_task().
+  std::atomic<uint64_t> _new_task_epoch{0};
+  std::atomic<uint32_t> _num_sleeping_workers{0};
+  std::mutex _new_task_mutex;
+  std::condition_variable _new_task;
 };
 
 }  // namespace opossum
@@ -4,15 +4,37 @@
 #include <numa.h>
 #endif
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "memory/numa_memory_resource.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Reads the first CPU of a sysfs CPU list such as "0-3,64-67" or "5", std::nullopt if the file cannot be read
+std::optional<CpuID> read_first_cpu_of_list(const std::string& path) {
+  auto stream = std::ifstream{path};
+  auto cpu_id = CpuID::base_type{0};
+  if (!(stream >> cpu_id)) return std::nullopt;
+  return CpuID{cpu_id};
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -22,14 +44,17 @@ const int Topology::_number_of_hardware_nodes = numa_num_configured_nodes();  //
 const int Topology::_number_of_hardware_nodes = 1;  // NOLINT
 #endif
 
-Topology::Topology() { _init_default_topology(); }
+Topology::Topology() {
+  _init_cache_sizes();
+  _init_default_topology();
+}
 
 void TopologyNode::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
-  stream << "Number of Node CPUs: " << cpus.size() << ", CPUIDs: [";
+  stream << "Number of Node CPUs: " << cpus.size() << ", CPUIDs (core, cache domain): [";
   for (size_t cpu_idx = 0; cpu_idx < cpus.size(); ++cpu_idx) {
     for (size_t i = 0; i < indent; ++i) stream << " ";
-    stream << cpus[cpu_idx].cpu_id;
+    stream << cpus[cpu_idx].cpu_id << " (" << cpus[cpu_idx].core_id << ", " << cpus[cpu_idx].cache_domain_id << ")";
     if (cpu_idx + 1 < cpus.size()) {
       stream << ", ";
     }
@@ -47,6 +72,18 @@ void Topology::use_fake_numa_topology(uint32_t max_num_workers, uint32_t workers
   Topology::get()._init_fake_numa_topology(max_num_workers, workers_per_node);
 }
 
+void Topology::use_custom_topology(std::vector<TopologyNode>&& nodes) {
+  auto& topology = Topology::get();
+  topology._clear();
+  topology._fake_numa_topology = true;
+  topology._nodes = std::move(nodes);
+  for (const auto& node : topology._nodes) {
+    topology._num_cpus += static_cast<uint32_t>(node.cpus.size());
+  }
+  topology._count_cores_and_cache_domains();
+  topology._create_memory_resources();
+}
+
 void Topology::_init_default_topology(uint32_t max_num_cores) {
 #if !HYRISE_NUMA_SUPPORT
   _init_non_numa_topology(max_num_cores);
@@ -93,6 +130,7 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
     }
   }
 
+  _init_cores_and_cache_domains();
   _create_memory_resources();
 
   numa_free_cpumask(cpu_bitmask);
@@ -117,6 +155,7 @@ void Topology::_init_non_numa_topology(uint32_t max_num_cores) {
   auto node = TopologyNode(std::move(cpus));
   _nodes.emplace_back(std::move(node));
 
+  _init_cores_and_cache_domains();
   _create_memory_resources();
 }
 
@@ -150,6 +189,7 @@ void Topology::_init_fake_numa_topology(uint32_t max_num_workers, uint32_t worke
   }
 
   _num_cpus = num_workers;
+  _init_cores_and_cache_domains();
   _create_memory_resources();
 }
 
@@ -157,14 +197,28 @@ const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+size_t Topology::num_physical_cores() const { return _num_physical_cores; }
+
+size_t Topology::num_cache_domains() const { return _num_cache_domains; }
+
+size_t Topology::l2_cache_size() const { return _l2_cache_size; }
+
+size_t Topology::last_level_cache_size() const { return _last_level_cache_size; }
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
 }
 
+boost::container::pmr::memory_resource* Topology::get_huge_page_memory_resource(int node_id) {
+  DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
+  return _huge_page_memory_resources[static_cast<size_t>(node_id)].get();
+}
+
 void Topology::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
-  stream << "Number of CPUs: " << _num_cpus << std::endl;
+  stream << "Number of CPUs: " << _num_cpus << ", physical cores: " << _num_physical_cores
+         << ", cache domains: " << _num_cache_domains << std::endl;
   for (size_t node_idx = 0; node_idx < _nodes.size(); ++node_idx) {
     for (size_t i = 0; i < indent; ++i) stream << " ";
     stream << "Node #" << node_idx << " - ";
@@ -175,8 +229,61 @@ void Topology::print(std::ostream& stream, size_t indent) const {
 
 void Topology::_clear() {
   _nodes.clear();
+  _huge_page_memory_resources.clear();
   _memory_resources.clear();
   _num_cpus = 0;
+  _num_physical_cores = 0;
+  _num_cache_domains = 0;
+}
+
+void Topology::_init_cache_sizes() {
+  // sysconf() reports 0 or -1 for caches it does not know about. The parameters are not available on all platforms.
+#if defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+  const auto l2_cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  const auto l3_cache_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (l2_cache_size <= 0) return;
+
+  _l2_cache_size = static_cast<size_t>(l2_cache_size);
+  _last_level_cache_size = l3_cache_size > 0 ? static_cast<size_t>(l3_cache_size) : _l2_cache_size;
+#endif
+}
+
+void Topology::_init_cores_and_cache_domains() {
+  // Linux lists the SMT siblings of a CPU and the CPUs sharing its caches in sysfs. All CPUs of a core (or a cache)
+  // list the same CPUs, so the first of them identifies the core (or the cache). On x86, index3 is the L3 cache, which
+  // AMD's Zen CPUs have per CCX. Without this information, every CPU is its own core and every node a cache domain.
+  // The domains are also split by node, as fake NUMA nodes might share a cache.
+  auto cache_domain_ids = std::map<std::pair<size_t, CpuID>, uint32_t>{};
+
+  for (auto node_idx = size_t{0}; node_idx < _nodes.size(); ++node_idx) {
+    for (auto& cpu : _nodes[node_idx].cpus) {
+      const auto cpu_path = "/sys/devices/system/cpu/cpu" + std::to_string(CpuID::base_type{cpu.cpu_id}) + "/";
+      cpu.core_id = read_first_cpu_of_list(cpu_path + "topology/thread_siblings_list").value_or(cpu.cpu_id);
+
+      const auto first_cache_cpu = read_first_cpu_of_list(cpu_path + "cache/index3/shared_cpu_list");
+      const auto domain_key = std::make_pair(node_idx, first_cache_cpu.value_or(INVALID_CPU_ID));
+      const auto next_cache_domain_id = static_cast<uint32_t>(cache_domain_ids.size());
+      cpu.cache_domain_id = cache_domain_ids.emplace(domain_key, next_cache_domain_id).first->second;
+    }
+  }
+
+  _count_cores_and_cache_domains();
+}
+
+void Topology::_count_cores_and_cache_domains() {
+  auto core_ids = std::set<CpuID>{};
+  auto cache_domain_ids = std::set<uint32_t>{};
+  for (const auto& node : _nodes) {
+    for (const auto& cpu : node.cpus) {
+      core_ids.emplace(cpu.core_id);
+      cache_domain_ids.emplace(cpu.cache_domain_id);
+    }
+  }
+
+  _num_physical_cores = core_ids.size();
+  _num_cache_domains = cache_domain_ids.size();
+  Assert(cache_domain_ids.empty() || *cache_domain_ids.rbegin() + 1 == _num_cache_domains,
+         "cache_domain_ids have to be dense");
 }
 
 void Topology::_create_memory_resources() {
@@ -189,6 +296,15 @@ void Topology::_create_memory_resources() {
     auto system_node_id = _fake_numa_topology ? node_id % _number_of_hardware_nodes : node_id;
     _memory_resources.emplace_back(NUMAMemoryResource(system_node_id, memsource_name.str()));
   }
+
+  // Created once _memory_resources does not grow anymore, as they use its elements as upstream resources. Binding the
+  // huge pages to a node is pointless on machines with a single node.
+  for (auto node_id = int{0}; node_id < static_cast<int>(_nodes.size()); ++node_id) {
+    auto system_node_id = _fake_numa_topology ? node_id % _number_of_hardware_nodes : node_id;
+    if (_number_of_hardware_nodes <= 1) system_node_id = NUMAMemoryResource::UNDEFINED_NODE_ID;
+    _huge_page_memory_resources.emplace_back(std::make_unique<HugePageMemoryResource>(
+        system_node_id, HugePageMemoryResource::DEFAULT_THRESHOLD, &_memory_resources[static_cast<size_t>(node_id)]));
+  }
 }
 
 }  // namespace opossum
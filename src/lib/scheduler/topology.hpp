@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "memory/huge_page_memory_resource.hpp"
 #include "memory/numa_memory_resource.hpp"
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -20,9 +21,18 @@ class memory_resource;
 namespace opossum {
 
 struct TopologyCpu final {
-  explicit TopologyCpu(CpuID cpu_id) : cpu_id(cpu_id) {}
+  explicit TopologyCpu(CpuID cpu_id) : cpu_id(cpu_id), core_id(cpu_id) {}
+  TopologyCpu(CpuID cpu_id, CpuID core_id, uint32_t cache_domain_id)
+      : cpu_id(cpu_id), core_id(core_id), cache_domain_id(cache_domain_id) {}
 
   CpuID cpu_id = INVALID_CPU_ID;
+
+  // The lowest CpuID of the SMT siblings (hyperthreads) that share the physical core of this CPU
+  CpuID core_id = INVALID_CPU_ID;
+
+  // Index of the last level cache (e.g., the L3 cache of an AMD CCX) that this CPU shares with others, in
+  // [0, Topology::num_cache_domains()). A cache domain never spans multiple nodes.
+  uint32_t cache_domain_id{0};
 };
 
 struct TopologyNode final {
@@ -79,12 +89,38 @@ class Topology final : public Singleton<Topology> {
    */
   static void use_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
+  /**
+   * Use the given nodes and CPUs, including their physical cores and cache domains, e.g., for testing the placement
+   * of Workers. The cache_domain_ids have to be in [0, number of cache domains).
+   */
+  static void use_custom_topology(std::vector<TopologyNode>&& nodes);
+
   const std::vector<TopologyNode>& nodes();
 
   size_t num_cpus() const;
 
+  /**
+   * Number of physical cores (i.e., CPUs without their SMT siblings) and of cache domains among the CPUs of the
+   * Topology. On Linux, both are read from sysfs. Otherwise, every CPU is assumed to be a physical core and every node
+   * to be a cache domain.
+   */
+  size_t num_physical_cores() const;
+  size_t num_cache_domains() const;
+
+  /**
+   * Sizes of the L2 cache and of the last level cache (L3, or L2 if there is none) of a CPU in bytes. They are read
+   * from the system when the Topology is created. Where they cannot be determined, typical sizes are assumed.
+   * Operators use them to size their partitions, e.g., JoinHash and JoinSortMerge.
+   */
+  size_t l2_cache_size() const;
+  size_t last_level_cache_size() const;
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
+  // Serves large allocations from huge pages bound to the node and all others from get_memory_resource(node_id), see
+  // HugePageMemoryResource. Like the latter, it is replaced when the topology changes.
+  boost::container::pmr::memory_resource* get_huge_page_memory_resource(int node_id);
+
   void print(std::ostream& stream = std::cout, size_t indent = 0) const;
 
  private:
@@ -99,13 +135,22 @@ class Topology final : public Singleton<Topology> {
 
   void _clear();
   void _create_memory_resources();
+  void _init_cache_sizes();
+  void _init_cores_and_cache_domains();
+  void _count_cores_and_cache_domains();
 
   std::vector<TopologyNode> _nodes;
   uint32_t _num_cpus{0};
+  size_t _num_physical_cores{0};
+  size_t _num_cache_domains{0};
   bool _fake_numa_topology{false};
 
+  size_t _l2_cache_size{256 * 1024};
+  size_t _last_level_cache_size{8 * 1024 * 1024};
+
   static const int _number_of_hardware_nodes;
 
   std::vector<NUMAMemoryResource> _memory_resources;
+  std::vector<std::unique_ptr<HugePageMemoryResource>> _huge_page_memory_resources;
 };
 }  // namespace opossum
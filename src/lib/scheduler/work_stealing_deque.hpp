@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Lock-free, single-owner/multi-thief deque as described by Chase and Lev [1], using the memory orderings of the
+ * C11 formulation by Lê et al. [2].
+ *
+ * The owning thread push()es and pop()s at the bottom (LIFO, which keeps recently spawned - and thus likely cache-hot -
+ * work local), while any other thread may steal() from the top (FIFO, which hands out the oldest and usually largest
+ * pieces of work). Only the owner may call push() and pop().
+ *
+ * When the ring buffer is full, it is replaced by one of twice the size. Thieves might still read from the old buffer,
+ * so retired buffers are kept alive until the deque is destroyed. Since the deque only grows, this is bounded by twice
+ * the maximum capacity ever needed.
+ *
+ * T has to be trivially copyable, as items are read speculatively by thieves that might lose the race for them.
+ *
+ * [1] Chase, Lev: Dynamic Circular Work-Stealing Deque, SPAA 2005
+ * [2] Lê, Pop, Cohen, Zappa Nardelli: Correct and Efficient Work-Stealing for Weak Memory Models, PPoPP 2013
+ */
+template <typename T>
+class WorkStealingDeque : private Noncopyable {
+  static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque items must be trivially copyable");
+
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 64) {
+    DebugAssert(initial_capacity > 0 && (initial_capacity & (initial_capacity - 1)) == 0,
+                "Capacity must be a power of two");
+    _retired_buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+    _buffer.store(_retired_buffers.back().get(), std::memory_order_relaxed);
+  }
+
+  /**
+   * Owner only. Adds an item to the bottom of the deque.
+   */
+  void push(const T item) {
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_acquire);
+    auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+      buffer = _grow(buffer, bottom, top);
+    }
+
+    buffer->put(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  /**
+   * Owner only. Removes and returns the item at the bottom of the deque, or std::nullopt if the deque is empty.
+   */
+  std::optional<T> pop() {
+    const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    auto* buffer = _buffer.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+      // Deque was empty
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    auto item = buffer->get(bottom);
+    if (top == bottom) {
+      // Last item - race against thieves for it
+      const auto won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      if (!won) return std::nullopt;
+    }
+    return item;
+  }
+
+  /**
+   * Any thread. Removes and returns the item at the top of the deque, or std::nullopt if the deque is empty or another
+   * thread won the race for the item.
+   */
+  std::optional<T> steal() {
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) return std::nullopt;
+
+    const auto* buffer = _buffer.load(std::memory_order_acquire);
+    auto item = buffer->get(top);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+    return item;
+  }
+
+  /**
+   * Any thread. Only a snapshot, the result might be outdated by the time the caller looks at it.
+   */
+  bool empty() const { return size() == 0; }
+
+  size_t size() const {
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_t>(bottom - top) : size_t{0};
+  }
+
+ private:
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity)
+        : capacity(init_capacity), mask(init_capacity - 1), items(std::make_unique<std::atomic<T>[]>(init_capacity)) {}
+
+    T get(const int64_t index) const { return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed); }
+
+    void put(const int64_t index, const T item) {
+      items[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+    }
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<std::atomic<T>[]> items;
+  };
+
+  Buffer* _grow(const Buffer* old_buffer, const int64_t bottom, const int64_t top) {
+    auto new_buffer = std::make_unique<Buffer>(old_buffer->capacity * 2);
+    for (auto index = top; index < bottom; ++index) {
+      new_buffer->put(index, old_buffer->get(index));
+    }
+
+    auto* new_buffer_ptr = new_buffer.get();
+    _retired_buffers.emplace_back(std::move(new_buffer));
+    _buffer.store(new_buffer_ptr, std::memory_order_release);
+    return new_buffer_ptr;
+  }
+
+  // top and bottom are modified by different threads, keep them on separate cache lines
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer{nullptr};
+
+  // Owner only. Contains the current buffer as well as all buffers that were replaced by _grow()
+  std::vector<std::unique_ptr<Buffer>> _retired_buffers;
+};
+
+}  // namespace opossum
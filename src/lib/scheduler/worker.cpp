@@ -7,14 +7,15 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
-#include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace {
 
@@ -23,6 +24,16 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
+
+// Counters written by a single thread do not need an atomic read-modify-write
+void add_to_counter(std::atomic<uint64_t>& counter, const uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+uint64_t nanoseconds_since(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
 }  // namespace
 
 // The sleep time was determined experimentally
@@ -32,8 +43,19 @@ namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, bool use_local_deque)
+    : _queue(queue), _id(id), _cpu_id(cpu_id) {
+  if (use_local_deque) _local_deque = std::make_unique<WorkStealingDeque<std::shared_ptr<AbstractTask>*>>();
+}
+
+Worker::~Worker() {
+  if (!_local_deque) return;
+
+  // The scheduler only shuts down once all tasks are done, but free the boxes nevertheless
+  while (auto box = _local_deque->pop()) {
+    delete *box;  // NOLINT
+  }
+}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -53,43 +75,156 @@ void Worker::operator()() {
   }
 }
 
-void Worker::_work() {
-  auto task = _queue->pull();
+void Worker::_work(AbstractTask* awaited_task) {
+  // Read before looking for tasks, so that tasks announced while we are looking do not let us sleep
+  const auto new_task_epoch = _queue->new_task_epoch();
 
-  if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (auto& queue : CurrentScheduler::get()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
+  auto task = std::shared_ptr<AbstractTask>{};
 
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
-      }
+  // High priority tasks in the TaskQueue (e.g., of short queries) overtake the local tasks, which might belong to a
+  // long-running query
+  if (_local_deque && _queue->estimate_size(static_cast<uint32_t>(SchedulePriority::High)) > 0) {
+    task = _queue->pull();
+  }
+
+  // Newest local tasks first, as their input is most likely still in the cache
+  if (!task && _local_deque) {
+    if (auto box = _local_deque->pop()) {
+      task = std::move(**box);
+      delete *box;  // NOLINT
     }
+  }
 
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
-    if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
-      }
-      return;
+  if (!task) task = _queue->pull();
+  if (!task) task = _steal();
+
+  // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be announced by
+  // our TaskQueue (i.e., pushed to it or to the deque of a Worker sharing it), for the awaited task to finish, or
+  // until the timer exceeded (whatever occurs first). The timer is still needed, as tasks of other TaskQueues are
+  // only found by stealing.
+  if (!task) {
+    const auto idle_started = std::chrono::steady_clock::now();
+    if (awaited_task) {
+      // The awaited task is executed by another Worker. Continue as soon as it is done.
+      awaited_task->_join_for(WORKER_SLEEP_TIME);
+    } else {
+      _queue->wait_for_new_task(new_task_epoch, WORKER_SLEEP_TIME);
     }
+    add_to_counter(_idle_time_ns, nanoseconds_since(idle_started));
+    add_to_counter(_num_hibernations, 1);
+    return;
   }
 
+  // Tasks executed while an outer task waits for its jobs are part of the outer task's busy time. The idle time in
+  // between is not.
+  const auto is_outermost_task = _num_executing_tasks++ == 0;
+  const auto busy_started = std::chrono::steady_clock::now();
+  const auto idle_time_before = _idle_time_ns.load(std::memory_order_relaxed);
+
+  DTRACE_PROBE3(HYRISE, WORKER_JOB_START, _id, task->id(), _queue->node_id());
   task->execute();
+  DTRACE_PROBE3(HYRISE, WORKER_JOB_END, _id, task->id(), _queue->node_id());
+
+  --_num_executing_tasks;
+  if (is_outermost_task) {
+    const auto idle_time = _idle_time_ns.load(std::memory_order_relaxed) - idle_time_before;
+    add_to_counter(_busy_time_ns, nanoseconds_since(busy_started) - idle_time);
+  }
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
   // Scheduler to determine whether all tasks finished
   _num_finished_tasks++;
 }
 
+std::shared_ptr<AbstractTask> Worker::_steal() {
+  const auto& workers = CurrentScheduler::get()->workers();
+
+  // Victims are visited from near to far: Workers sharing our TaskQueue (i.e., our node or, with cache domain queues,
+  // our cache domain), then the rest of our node, then remote nodes
+  enum class Distance { SameQueue, SameNode, RemoteNode };
+  const auto distance_to = [&](const std::shared_ptr<TaskQueue>& queue) {
+    if (queue == _queue) return Distance::SameQueue;
+    return queue->node_id() == _queue->node_id() ? Distance::SameNode : Distance::RemoteNode;
+  };
+
+  // Start at a different victim for every Worker so that idle Workers do not all fight over the same deque
+  const auto try_steal_from_deques = [&](const Distance distance) -> std::shared_ptr<AbstractTask> {
+    if (!_local_deque) return nullptr;
+
+    for (auto offset = size_t{1}; offset < workers.size(); ++offset) {
+      const auto& victim = workers[(_id + offset) % workers.size()];
+      if (distance_to(victim->_queue) != distance) continue;
+
+      auto task = victim->steal_from_local_deque();
+      if (task) {
+        DTRACE_PROBE4(HYRISE, WORK_STOLEN, _id, task->id(), victim->_queue->node_id(), _queue->node_id());
+        add_to_counter(distance == Distance::RemoteNode ? _num_stolen_remote_tasks : _num_stolen_local_tasks, 1);
+        return task;
+      }
+    }
+    return nullptr;
+  };
+
+  // Simple work stealing without explicitly transferring data between nodes.
+  const auto try_steal_from_queues = [&](const Distance distance) -> std::shared_ptr<AbstractTask> {
+    for (auto& queue : CurrentScheduler::get()->queues()) {
+      if (distance_to(queue) != distance) continue;
+
+      auto task = queue->steal();
+      if (task) {
+        DTRACE_PROBE4(HYRISE, WORK_STOLEN, _id, task->id(), queue->node_id(), _queue->node_id());
+        add_to_counter(distance == Distance::RemoteNode ? _num_stolen_remote_tasks : _num_stolen_local_tasks, 1);
+        task->set_node_id(_queue->node_id());
+        return task;
+      }
+    }
+    return nullptr;
+  };
+
+  auto task = try_steal_from_deques(Distance::SameQueue);
+  if (!task) task = try_steal_from_queues(Distance::SameNode);
+  if (!task) task = try_steal_from_deques(Distance::SameNode);
+  if (!task) task = try_steal_from_queues(Distance::RemoteNode);
+  if (!task) task = try_steal_from_deques(Distance::RemoteNode);
+  if (task) task->set_node_id(_queue->node_id());
+  return task;
+}
+
+void Worker::enqueue(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  DebugAssert(get_this_thread_worker().get() == this, "Tasks can only be enqueued by the Worker's own thread");
+
+  // Non-stealable tasks have to stay on this node. As stealing from another node's TaskQueue respects that but
+  // stealing from a deque does not, these tasks are put into the TaskQueue. The deque has no priority levels either,
+  // so high priority tasks (which would wait behind the local tasks otherwise) and low priority tasks (which would
+  // overtake the default priority tasks of the TaskQueue) go there as well.
+  if (!_local_deque || !task->is_stealable() || priority != SchedulePriority::Default) {
+    _queue->push(task, static_cast<uint32_t>(priority));
+    return;
+  }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _local_deque->push(new std::shared_ptr<AbstractTask>(task));  // NOLINT
+
+  // Wake up an idle Worker sharing our TaskQueue so that it can steal the task if this Worker is busy
+  _queue->notify_new_task();
+}
+
+bool Worker::has_local_deque() const { return static_cast<bool>(_local_deque); }
+
+std::shared_ptr<AbstractTask> Worker::steal_from_local_deque() {
+  if (!_local_deque) return nullptr;
+
+  const auto box = _local_deque->steal();
+  if (!box) return nullptr;
+
+  auto task = std::move(**box);
+  delete *box;  // NOLINT
+  return task;
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -99,6 +234,17 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+WorkerStatistics Worker::statistics() const {
+  auto statistics = WorkerStatistics{};
+  statistics.busy_time = std::chrono::nanoseconds{_busy_time_ns.load(std::memory_order_relaxed)};
+  statistics.idle_time = std::chrono::nanoseconds{_idle_time_ns.load(std::memory_order_relaxed)};
+  statistics.finished_tasks = _num_finished_tasks.load(std::memory_order_relaxed);
+  statistics.stolen_local_tasks = _num_stolen_local_tasks.load(std::memory_order_relaxed);
+  statistics.stolen_remote_tasks = _num_stolen_remote_tasks.load(std::memory_order_relaxed);
+  statistics.hibernations = _num_hibernations.load(std::memory_order_relaxed);
+  return statistics;
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
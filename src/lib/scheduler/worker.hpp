@@ -1,17 +1,38 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <vector>
 
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
 
+// Snapshot of the counters of a Worker, see Worker::statistics()
+struct WorkerStatistics {
+  // Time spent executing tasks, excluding the idle time while waiting for spawned jobs
+  std::chrono::nanoseconds busy_time{0};
+
+  // Time spent waiting for new tasks
+  std::chrono::nanoseconds idle_time{0};
+
+  uint64_t finished_tasks{0};
+
+  // Tasks stolen from the Workers of the same node and from other nodes
+  uint64_t stolen_local_tasks{0};
+  uint64_t stolen_remote_tasks{0};
+
+  // Number of times the Worker went to sleep because it found no task
+  uint64_t hibernations{0};
+};
+
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
@@ -22,7 +43,12 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  /**
+   * @param use_local_deque   If set, tasks spawned by this Worker are put into a Worker-local work-stealing deque
+   *                          instead of the node's TaskQueue (see NodeQueueScheduler)
+   */
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, bool use_local_deque = false);
+  ~Worker();
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -36,27 +62,51 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   uint64_t num_finished_tasks() const;
 
+  /**
+   * The counters are only written by the Worker's own thread, so reading them does not slow the Worker down. The
+   * values of a busy Worker might be slightly outdated.
+   */
+  WorkerStatistics statistics() const;
+
+  /**
+   * Enqueues a ready task. This goes into the local deque if this Worker has one, the task may be stolen, and it has
+   * the default priority, otherwise into the TaskQueue of the Worker's node. Must only be called from this Worker's
+   * thread.
+   */
+  void enqueue(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
+
+  bool has_local_deque() const;
+
+  /**
+   * Called by other Workers that became idle. Returns nullptr if the local deque is empty or the race for its top task
+   * was lost.
+   */
+  std::shared_ptr<AbstractTask> steal_from_local_deque();
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
  protected:
   void operator()();
-  void _work();
 
+  /**
+   * Executes one ready task. If there is none, the Worker sleeps until its TaskQueue announces a new task or, if
+   * @param awaited_task is set, until that task is done - but for WORKER_SLEEP_TIME at most.
+   */
+  void _work(AbstractTask* awaited_task = nullptr);
+
+  /**
+   * Instead of blocking its thread (and requiring another thread to keep the CPU busy), a Worker that waits for the
+   * jobs spawned by its current task executes other ready tasks in the meantime (help-first). Thus, the number of
+   * threads always equals the number of Workers, no matter how deeply the jobs are nested.
+   */
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
-    auto tasks_completed = [&tasks]() {
-      // Reversely iterate through the list of tasks, because unfinished tasks are likely at the end of the list.
-      for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
-        if (!(*it)->is_done()) {
-          return false;
-        }
+    // Reversely iterate through the list of tasks, because unfinished tasks are likely at the end of the list.
+    for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+      while (!(*it)->is_done()) {
+        _work(it->get());
       }
-      return true;
-    };
-
-    while (!tasks_completed()) {
-      _work();
     }
   }
 
@@ -67,11 +117,32 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  /**
+   * Looks for a ready task outside of the own queues: first in the local deques of the Workers sharing the TaskQueue,
+   * then in the other TaskQueues and deques of the same node (if it has multiple cache domain queues), and finally in
+   * the TaskQueues and deques of other nodes.
+   */
+  std::shared_ptr<AbstractTask> _steal();
+
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+
+  // Counters for statistics(). They are only written by this Worker's thread and thus need no atomic increments.
+  std::atomic<uint64_t> _busy_time_ns{0};
+  std::atomic<uint64_t> _idle_time_ns{0};
+  std::atomic<uint64_t> _num_stolen_local_tasks{0};
+  std::atomic<uint64_t> _num_stolen_remote_tasks{0};
+  std::atomic<uint64_t> _num_hibernations{0};
+
+  // Number of tasks currently executed by this Worker. Greater than one while a task waits for the jobs it spawned.
+  uint32_t _num_executing_tasks{0};
+
+  // The shared_ptrs are boxed because the deque only holds trivially copyable items. Whoever successfully removes a
+  // box from the deque takes ownership of it.
+  std::unique_ptr<WorkStealingDeque<std::shared_ptr<AbstractTask>*>> _local_deque;
 };
 
 }  // namespace opossum
@@ -0,0 +1,38 @@
+#include "cancellation_registry.hpp"
+
+#include "concurrency/cancellation_token.hpp"
+
+namespace opossum {
+
+CancellationRegistry::CancellationRegistry() : _random_engine(std::random_device{}()) {}
+
+BackendKeyData CancellationRegistry::register_session() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto backend_key_data = BackendKeyData{_next_process_id++, static_cast<uint32_t>(_random_engine())};
+  _sessions.emplace(backend_key_data.process_id, Session{backend_key_data.secret_key, {}});
+  return backend_key_data;
+}
+
+void CancellationRegistry::unregister_session(const uint32_t process_id) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _sessions.erase(process_id);
+}
+
+void CancellationRegistry::set_statement_cancellation_token(
+    const uint32_t process_id, const std::shared_ptr<CancellationToken>& cancellation_token) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto session_it = _sessions.find(process_id);
+  if (session_it != _sessions.end()) session_it->second.cancellation_token = cancellation_token;
+}
+
+bool CancellationRegistry::cancel(const BackendKeyData& backend_key_data) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto session_it = _sessions.find(backend_key_data.process_id);
+  if (session_it == _sessions.end() || session_it->second.secret_key != backend_key_data.secret_key) return false;
+
+  // The session might be idle, in which case there is nothing to cancel
+  if (const auto cancellation_token = session_it->second.cancellation_token.lock()) cancellation_token->cancel();
+  return true;
+}
+
+}  // namespace opossum
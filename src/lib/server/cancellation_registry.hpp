@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class CancellationToken;
+
+/**
+ * Keeps track of the sessions of the server and the statements they are executing, so that a CancelRequest, which a
+ * client sends on a new connection, can cancel the statement of another session. Each session is identified by the
+ * BackendKeyData that it sends to its client during the startup. As in PostgreSQL, the secret key prevents other
+ * clients from cancelling statements by guessing process ids.
+ */
+class CancellationRegistry : public Singleton<CancellationRegistry> {
+ public:
+  BackendKeyData register_session();
+  void unregister_session(const uint32_t process_id);
+
+  // The token of the statement that the session is executing, replaces the token of its previous statement
+  void set_statement_cancellation_token(const uint32_t process_id,
+                                        const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  // Returns false if there is no session with this key, e.g., because its client disconnected in the meantime
+  bool cancel(const BackendKeyData& backend_key_data);
+
+ protected:
+  CancellationRegistry();
+  friend class Singleton;
+
+  struct Session {
+    uint32_t secret_key;
+    std::weak_ptr<CancellationToken> cancellation_token;
+  };
+
+  std::mutex _mutex;
+  std::mt19937 _random_engine;
+  uint32_t _next_process_id = 1;
+  std::unordered_map<uint32_t, Session> _sessions;
+};
+
+}  // namespace opossum
@@ -2,6 +2,8 @@
 
 #include <boost/asio.hpp>
 
+#include <algorithm>
+
 #include "postgres_wire_handler.hpp"
 #include "then_operator.hpp"
 #include "use_boost_future.hpp"
@@ -12,11 +14,10 @@ using opossum::then_operator::then;
 
 const auto ignore_sent_bytes = [](uint64_t sent_bytes) {};
 
-ClientConnection::ClientConnection(boost::asio::ip::tcp::socket socket) : _socket(std::move(socket)) {
-  _response_buffer.reserve(_max_response_size);
-}
+ClientConnection::ClientConnection(boost::asio::ip::tcp::socket socket)
+    : _socket(std::move(socket)), _read_buffer(READ_BUFFER_SIZE) {}
 
-boost::future<uint32_t> ClientConnection::receive_startup_packet_header() {
+boost::future<StartupPacketHeader> ClientConnection::receive_startup_packet_header() {
   constexpr uint32_t STARTUP_HEADER_LENGTH = 8u;
 
   return _receive_bytes_async(STARTUP_HEADER_LENGTH) >> then >> PostgresWireHandler::handle_startup_package;
@@ -29,6 +30,10 @@ boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size)
   };
 }
 
+boost::future<BackendKeyData> ClientConnection::receive_cancel_request_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_cancel_request_packet;
+}
+
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
   constexpr uint32_t HEADER_LENGTH = 5u;
 
@@ -61,10 +66,23 @@ boost::future<void> ClientConnection::receive_flush_packet_body(uint32_t size) {
   return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
 }
 
-boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_t size) {
+boost::future<ExecutePacket> ClientConnection::receive_execute_packet_body(uint32_t size) {
   return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
 }
 
+boost::future<std::string> ClientConnection::receive_copy_data_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_data_packet;
+}
+
+boost::future<void> ClientConnection::receive_copy_done_packet_body(uint32_t size) {
+  // Packet has no content, we'll make the receive call anyways, just in case size > 0
+  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+}
+
+boost::future<std::string> ClientConnection::receive_copy_fail_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_copy_fail_packet;
+}
+
 boost::future<void> ClientConnection::send_ssl_denied() {
   // Don't use new_output_packet here, because this packet has special size requirements (only contains N, no size)
   auto output_packet = std::make_shared<OutputPacket>();
@@ -80,6 +98,14 @@ boost::future<void> ClientConnection::send_auth() {
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
+boost::future<void> ClientConnection::send_backend_key_data(uint32_t process_id, uint32_t secret_key) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::BackendKeyData);
+  PostgresWireHandler::write_value(*output_packet, htonl(process_id));
+  PostgresWireHandler::write_value(*output_packet, htonl(secret_key));
+
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
 boost::future<void> ClientConnection::send_parameter_status(const std::string& key, const std::string& value) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ParameterStatus);
   PostgresWireHandler::write_string(*output_packet, key);
@@ -168,13 +194,14 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet,
                                      htons(static_cast<uint16_t>(column_description.type_width)));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                                    // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                                    // text format
+    PostgresWireHandler::write_value(*output_packet,
+                                     htons(static_cast<uint16_t>(column_description.format_code)));  // format code
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
+boost::future<void> ClientConnection::send_data_row(const std::vector<std::optional<std::string>>& row_values) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
 
   /*
@@ -199,37 +226,150 @@ boost::future<void> ClientConnection::send_data_row(const std::vector<std::strin
   */
 
   // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
+  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_values.size())));
+
+  for (const auto& value : row_values) {
+    if (!value) {
+      PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(-1)));
+      continue;
+    }
 
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
+    // Size of the serialized value (i.e., of the string representation in text mode), NOT of value type's size
+    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value->length())));
 
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
+    // Values are sent as non-terminated byte sequences
+    PostgresWireHandler::write_string(*output_packet, *value, false);
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
+boost::future<void> ClientConnection::send_copy_in_response(FormatCode format_code, uint16_t column_count) {
+  return _send_copy_response(NetworkMessageType::CopyInResponse, format_code, column_count);
+}
+
+boost::future<void> ClientConnection::send_copy_out_response(FormatCode format_code, uint16_t column_count) {
+  return _send_copy_response(NetworkMessageType::CopyOutResponse, format_code, column_count);
+}
+
+boost::future<void> ClientConnection::_send_copy_response(NetworkMessageType type, FormatCode format_code,
+                                                          uint16_t column_count) {
+  auto output_packet = PostgresWireHandler::new_output_packet(type);
+
+  /*
+  CopyInResponse (B) / CopyOutResponse (B)
+  Int8
+  0 indicates the overall COPY format is textual (rows separated by newlines, columns separated by separator
+  characters, etc). 1 indicates the overall copy format is binary (similar to DataRow format).
+
+  Int16
+  The number of columns in the data to be copied.
+
+  Int16[N]
+  The format codes to be used for each column. Currently each must be zero (text) or one (binary). All must be
+  zero if the overall copy format is textual.
+  */
+
+  PostgresWireHandler::write_value(*output_packet, static_cast<int8_t>(format_code));
+  PostgresWireHandler::write_value(*output_packet, htons(column_count));
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(format_code)));
+  }
+
+  // The client only starts sending the data once it has received the CopyInResponse
+  const auto flush = type == NetworkMessageType::CopyInResponse;
+  return _send_bytes_async(output_packet, flush) >> then >> ignore_sent_bytes;
+}
+
+boost::future<void> ClientConnection::send_copy_data(const std::string& data) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CopyData);
+  PostgresWireHandler::write_string(*output_packet, data, false);
+
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
 boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
   PostgresWireHandler::write_string(*output_packet, message);
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  // Not flushed, the ReadyForQuery or the client's Sync / Flush follows
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
+boost::future<void> ClientConnection::flush() { return _flush_async() >> then >> ignore_sent_bytes; }
+
+void ClientConnection::watch_for_disconnect(const std::function<void()>& on_disconnect) {
+  const auto watch_id = ++_disconnect_watch_id;
+
+  // The client has pipelined further messages, so it has not closed the connection before sending them
+  if (_read_buffer_begin != _read_buffer_end) return;
+
+  auto self = shared_from_this();
+  _socket.async_wait(boost::asio::ip::tcp::socket::wait_read, [self, watch_id, on_disconnect](const auto& error) {
+    if (watch_id != self->_disconnect_watch_id) return;
+
+    if (error) {
+      if (error != boost::asio::error::operation_aborted) on_disconnect();
+      return;
+    }
+
+    // The socket is readable either because the client sent another message (e.g., a Terminate), which is left in the
+    // socket for the session, or because it closed the connection
+    auto byte = char{};
+    auto peek_error = boost::system::error_code{};
+    self->_socket.receive(boost::asio::buffer(&byte, 1), boost::asio::socket_base::message_peek, peek_error);
+    if (peek_error == boost::asio::error::eof || peek_error == boost::asio::error::connection_reset) on_disconnect();
+  });
 }
 
+void ClientConnection::stop_watching_for_disconnect() { ++_disconnect_watch_id; }
+
 boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
   auto result = std::make_shared<InputPacket>();
   result->data.resize(size);
 
+  // Bytes that were read ahead are used first. If they contain the entire message, which is the common case for small
+  // messages, it is returned without another read from the socket.
+  const auto buffered_size = std::min(size, _read_buffer_end - _read_buffer_begin);
+  std::copy_n(_read_buffer.begin() + _read_buffer_begin, buffered_size, result->data.begin());
+  _read_buffer_begin += buffered_size;
+  if (buffered_size == size) {
+    result->offset = result->data.begin();
+    return boost::make_ready_future(std::move(*result));
+  }
+
+  const auto missing_size = size - buffered_size;
+  _read_buffer_begin = 0;
+  _read_buffer_end = 0;
+
   // We need a copy of this client connection to outlive the async operation
   auto self = shared_from_this();
-  return _socket.async_read_some(boost::asio::buffer(result->data, size), boost::asio::use_boost_future) >> then >>
-         [self, result, size](uint64_t received_size) {
-           // If this assertion should fail, we will end up in either the error handler for the current command or
-           // the entire session. The connection may be closed but the server will keep running either way.
-           Assert(received_size == size, "Client sent less data than expected.");
+
+  if (missing_size > READ_BUFFER_SIZE) {
+    // Large messages (e.g., CopyData) may arrive in several TCP segments, so we read until the packet is complete
+    // instead of using async_read_some
+    return boost::asio::async_read(_socket, boost::asio::buffer(result->data.data() + buffered_size, missing_size),
+                                   boost::asio::use_boost_future) >>
+           then >> [self, result, missing_size](uint64_t received_size) {
+             // If this assertion should fail, we will end up in either the error handler for the current command or
+             // the entire session. The connection may be closed but the server will keep running either way.
+             Assert(received_size == missing_size, "Client sent less data than expected.");
+
+             result->offset = result->data.begin();
+             return std::move(*result);
+           };
+  }
+
+  // Smaller messages are read into the read buffer, together with whatever the client has sent after them, e.g., the
+  // body of a message along with its header or the Bind, Execute, and Sync messages following a Parse message
+  return boost::asio::async_read(_socket, boost::asio::buffer(_read_buffer),
+                                 boost::asio::transfer_at_least(missing_size), boost::asio::use_boost_future) >>
+         then >> [self, result, buffered_size, missing_size](uint64_t received_size) {
+           Assert(received_size >= missing_size, "Client sent less data than expected.");
+
+           std::copy_n(self->_read_buffer.begin(), missing_size, result->data.begin() + buffered_size);
+           self->_read_buffer_begin = missing_size;
+           self->_read_buffer_end = received_size;
 
            result->offset = result->data.begin();
            return std::move(*result);
@@ -244,18 +384,20 @@ boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_pt
     PostgresWireHandler::write_output_packet_size(*packet);
   }
 
-  // If this fails, the connection may be closed but the server will keep running.
-  Assert(packet_size <= _max_response_size,
-         "The output packet is too big and cannot be sent. This should never happen!");
-
-  if (_response_buffer.size() + packet_size > _max_response_size) {
-    // We have to flush before we can actually process the data
-    return _flush_async() >> then >> [=](uint64_t) { return _send_bytes_async(packet, flush); };
+  // Small packets are appended to the last buffer, larger ones are moved into a buffer of their own
+  if (!_response_buffers.empty() && _response_buffers.back().size() + packet_size <= RESPONSE_BUFFER_SIZE) {
+    auto& response_buffer = _response_buffers.back();
+    response_buffer.insert(response_buffer.end(), packet->data.begin(), packet->data.end());
+  } else if (packet_size < RESPONSE_BUFFER_SIZE) {
+    auto& response_buffer = _response_buffers.emplace_back();
+    response_buffer.reserve(RESPONSE_BUFFER_SIZE);
+    response_buffer.insert(response_buffer.end(), packet->data.begin(), packet->data.end());
+  } else {
+    _response_buffers.emplace_back(std::move(packet->data));
   }
+  _pending_response_size += packet_size;
 
-  _response_buffer.insert(_response_buffer.end(), packet->data.begin(), packet->data.end());
-
-  if (flush) {
+  if (flush || _pending_response_size > MAX_PENDING_RESPONSE_SIZE) {
     return _flush_async() >> then >> [=](uint64_t) { return static_cast<uint64_t>(packet_size); };
   } else {
     // Return an already resolved future (we have just written data to the buffer)
@@ -264,12 +406,29 @@ boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_pt
 }
 
 boost::future<uint64_t> ClientConnection::_flush_async() {
-  return _socket.async_send(boost::asio::buffer(_response_buffer), boost::asio::use_boost_future) >> then >>
-         [=](uint64_t sent_bytes) {
+  if (_response_buffers.empty()) return boost::make_ready_future<uint64_t>(0);
+
+  // The buffers have to outlive the write. The next messages go into new buffers, as the session might continue to send
+  // before the write has completed.
+  auto response_buffers = std::make_shared<std::vector<ByteBuffer>>(std::move(_response_buffers));
+  const auto response_size = _pending_response_size;
+  _response_buffers.clear();
+  _pending_response_size = 0;
+
+  auto buffer_sequence = std::vector<boost::asio::const_buffer>{};
+  buffer_sequence.reserve(response_buffers->size());
+  for (const auto& response_buffer : *response_buffers) {
+    buffer_sequence.emplace_back(boost::asio::buffer(response_buffer));
+  }
+
+  // Unlike async_send, async_write only completes once all buffers have been written
+  auto self = shared_from_this();
+  return boost::asio::async_write(_socket, buffer_sequence, boost::asio::use_boost_future) >> then >>
+         [self, response_buffers, response_size](uint64_t sent_bytes) {
            // If this fails, the connection may be closed but the server will keep running.
-           Assert(sent_bytes == _response_buffer.size(), "Could not send all data");
-           _response_buffer.clear();
+           Assert(sent_bytes == response_size, "Could not send all data");
            return static_cast<uint64_t>(sent_bytes);
          };
 }
+
 }  // namespace opossum
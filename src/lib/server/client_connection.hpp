@@ -3,7 +3,11 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace opossum {
 
@@ -11,25 +15,43 @@ using ByteBuffer = std::vector<char>;
 struct InputPacket;
 struct OutputPacket;
 struct RequestHeader;
+struct StartupPacketHeader;
+struct BackendKeyData;
 struct ParsePacket;
 struct BindPacket;
+struct ExecutePacket;
 enum class NetworkMessageType : unsigned char;
+enum class FormatCode : int16_t;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  FormatCode format_code;
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
 // network messages using the PostgresWireHandler. It's a very thin wrapper
-// because the ASIO socket is hard to mock, so there are no tests for this class
+// because the ASIO socket is hard to mock, so there are no tests for this class.
+//
+// Incoming messages are read ahead into a buffer, so that a message header and its body, as well as the messages that
+// a client sends in a batch (e.g., Parse, Bind, Execute, and Sync), usually take a single read from the socket. The
+// futures of messages that are already buffered are ready, so that the session handles them without waiting.
+//
+// Outgoing messages are buffered and written with a single vectored write once the response is complete, i.e., on
+// ReadyForQuery, errors, notices, CopyInResponse, and explicit calls to flush(). Thus, the RowDescription, the DataRows,
+// the CommandComplete, and the ReadyForQuery of a query are usually sent together.
+//
+// While a statement is executed, the session does not read from the socket. watch_for_disconnect() waits for the socket
+// to become readable in the meantime and notifies the session if the client has closed the connection, so that the
+// statement can be cancelled.
 class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
  public:
   explicit ClientConnection(boost::asio::ip::tcp::socket socket);
 
-  boost::future<uint32_t> receive_startup_packet_header();
+  boost::future<StartupPacketHeader> receive_startup_packet_header();
   boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<BackendKeyData> receive_cancel_request_packet_body(uint32_t size);
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
@@ -38,30 +60,65 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<std::string> receive_describe_packet_body(uint32_t size);
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
-  boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  boost::future<ExecutePacket> receive_execute_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_data_packet_body(uint32_t size);
+  boost::future<void> receive_copy_done_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_fail_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
+  boost::future<void> send_backend_key_data(uint32_t process_id, uint32_t secret_key);
   boost::future<void> send_parameter_status(const std::string& key, const std::string& value);
   boost::future<void> send_ready_for_query();
   boost::future<void> send_error(const std::string& message);
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  // Values are sent in the format announced in the row description. std::nullopt denotes a NULL value.
+  boost::future<void> send_data_row(const std::vector<std::optional<std::string>>& row_values);
+  boost::future<void> send_copy_in_response(FormatCode format_code, uint16_t column_count);
+  boost::future<void> send_copy_out_response(FormatCode format_code, uint16_t column_count);
+  boost::future<void> send_copy_data(const std::string& data);
   boost::future<void> send_command_complete(const std::string& message);
 
+  // Writes all buffered messages to the socket
+  boost::future<void> flush();
+
+  // Calls @param on_disconnect if the client closes the connection before stop_watching_for_disconnect() is called or
+  // the connection is watched again. Does nothing if the client has already sent further messages, which are buffered.
+  void watch_for_disconnect(const std::function<void()>& on_disconnect);
+  void stop_watching_for_disconnect();
+
  protected:
   boost::future<InputPacket> _receive_bytes_async(size_t size);
 
+  // CopyInResponse and CopyOutResponse share the same format
+  boost::future<void> _send_copy_response(NetworkMessageType type, FormatCode format_code, uint16_t column_count);
+
   boost::future<uint64_t> _send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush = false);
   boost::future<uint64_t> _flush_async();
 
   boost::asio::ip::tcp::socket _socket;
 
-  // Max 2048 bytes per IP packet sent
-  uint32_t _max_response_size = 2048;
-  ByteBuffer _response_buffer;
+  // Incoming bytes that have not been consumed yet are in [_read_buffer_begin, _read_buffer_end). Messages that are
+  // larger than the buffer are read directly into their packet.
+  static constexpr auto READ_BUFFER_SIZE = size_t{16'384};
+  ByteBuffer _read_buffer;
+  size_t _read_buffer_begin = 0;
+  size_t _read_buffer_end = 0;
+
+  // Messages are copied into buffers of this size. Larger messages get a buffer of their own.
+  static constexpr auto RESPONSE_BUFFER_SIZE = size_t{16'384};
+
+  // Pending messages are written even if the response is incomplete once they exceed this size, so that large results
+  // are streamed to the client
+  static constexpr auto MAX_PENDING_RESPONSE_SIZE = size_t{262'144};
+
+  std::vector<ByteBuffer> _response_buffers;
+  size_t _pending_response_size = 0;
+
+  // Incremented by every (stop_)watch_for_disconnect(), so that outdated waits are ignored
+  std::atomic<uint64_t> _disconnect_watch_id{0};
 };
 
 }  // namespace opossum
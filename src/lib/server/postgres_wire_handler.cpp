@@ -9,7 +9,7 @@
 
 namespace opossum {
 
-uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
+StartupPacketHeader PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
   auto network_length = read_value<uint32_t>(packet);
   // We ALWAYS need to convert from network endianess to host endianess with these fancy macros
   // ntohl = network to host long and htonl = host to network long (where long = uint32)
@@ -23,13 +23,13 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   // Reset data buffer
   packet.offset = packet.data.cbegin();
 
-  // Special SSL version number that we catch to deny SSL support
-  if (version == 80877103) {
-    return 0;
-  } else {
-    // Subtract read bytes from total length
-    return length - (2 * sizeof(uint32_t));
-  }
+  // Subtract read bytes from total length
+  const auto payload_length = static_cast<uint32_t>(length - (2 * sizeof(uint32_t)));
+
+  // Special version numbers that we catch to deny SSL support and to handle CancelRequests
+  if (version == 80877103) return {StartupPacketType::SslRequest, 0};
+  if (version == 80877102) return {StartupPacketType::CancelRequest, payload_length};
+  return {StartupPacketType::Startup, payload_length};
 }
 
 void PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
@@ -37,6 +37,12 @@ void PostgresWireHandler::handle_startup_package_content(const InputPacket& pack
   read_values<char>(packet, packet.data.size());
 }
 
+BackendKeyData PostgresWireHandler::handle_cancel_request_packet(const InputPacket& packet) {
+  const auto process_id = ntohl(read_value<uint32_t>(packet));
+  const auto secret_key = ntohl(read_value<uint32_t>(packet));
+  return {process_id, secret_key};
+}
+
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
   auto tag = read_value<NetworkMessageType>(packet);
 
@@ -83,17 +89,30 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
   }
 
   auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
-  auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  std::vector<FormatCode> result_column_format_codes;
+  for (const auto network_format_code : read_values<int16_t>(packet, num_result_column_format_codes)) {
+    const auto format_code = static_cast<FormatCode>(ntohs(network_format_code));
+    // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+    if (format_code != FormatCode::Text && format_code != FormatCode::Binary) Fail("Unsupported result format code.");
+    result_column_format_codes.emplace_back(format_code);
+  }
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(result_column_format_codes)};
 }
 
-std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
+ExecutePacket PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
   const auto portal = read_string(packet);
-  /*const auto max_rows = */ read_value<int32_t>(packet);
-  return portal;
+  const auto max_rows = ntohl(read_value<int32_t>(packet));
+  return ExecutePacket{portal, max_rows};
+}
+
+std::string PostgresWireHandler::handle_copy_data_packet(const InputPacket& packet) {
+  // The payload is a part of the copied data, the boundaries of messages and rows need not coincide
+  return std::string{packet.offset, packet.data.cend()};
 }
 
+std::string PostgresWireHandler::handle_copy_fail_packet(const InputPacket& packet) { return read_string(packet); }
+
 std::string PostgresWireHandler::handle_describe_packet(const InputPacket& packet) {
   read_value<char>(packet);
   const auto portal = read_string(packet);
@@ -29,6 +29,14 @@ struct OutputPacket {
   ByteBuffer data;
 };
 
+// The first packet of a connection either starts a session, asks for SSL, or cancels the statement of another session
+enum class StartupPacketType { Startup, SslRequest, CancelRequest };
+
+struct StartupPacketHeader {
+  StartupPacketType type;
+  uint32_t payload_length;
+};
+
 struct RequestHeader {
   NetworkMessageType message_type;
   uint32_t payload_length;
@@ -43,6 +51,15 @@ struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
   std::vector<AllTypeVariant> params;
+  // Either empty (all result columns use the text format), a single format code for all result columns, or one format
+  // code per result column
+  std::vector<FormatCode> result_format_codes;
+};
+
+struct ExecutePacket {
+  std::string portal;
+  // Maximum number of rows to return; 0 denotes "no limit"
+  uint32_t max_rows;
 };
 
 class PostgresWireHandler {
@@ -50,8 +67,9 @@ class PostgresWireHandler {
   static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
   static void write_output_packet_size(OutputPacket& packet);
 
-  static uint32_t handle_startup_package(const InputPacket& packet);
+  static StartupPacketHeader handle_startup_package(const InputPacket& packet);
   static void handle_startup_package_content(const InputPacket& packet);
+  static BackendKeyData handle_cancel_request_packet(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
@@ -59,7 +77,9 @@ class PostgresWireHandler {
   static ParsePacket handle_parse_packet(const InputPacket& packet);
   static BindPacket handle_bind_packet(const InputPacket& packet);
   static std::string handle_describe_packet(const InputPacket& packet);
-  static std::string handle_execute_packet(const InputPacket& packet);
+  static ExecutePacket handle_execute_packet(const InputPacket& packet);
+  static std::string handle_copy_data_packet(const InputPacket& packet);
+  static std::string handle_copy_fail_packet(const InputPacket& packet);
 
   template <typename T>
   static T read_value(const InputPacket& packet);
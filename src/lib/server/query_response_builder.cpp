@@ -1,19 +1,151 @@
 #include "query_response_builder.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "resolve_type.hpp"
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/decimal_utils.hpp"
+#include "utils/logical_data_types.hpp"
 
 #include "SQLParserResult.h"
 
 #include "then_operator.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The binary format of PostgreSQL sends integers and IEEE 754 floating point numbers in network byte order and
+// strings as their raw bytes.
+template <typename T>
+void append_binary(std::string& output, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    output.append(value.cbegin(), value.cend());
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint16_t), uint16_t,
+                                    std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>>;
+    static_assert(sizeof(T) == sizeof(Bits), "Unexpected size of numeric data type");
+
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    for (auto byte_idx = size_t{0}; byte_idx < sizeof(T); ++byte_idx) {
+      output.push_back(static_cast<char>(bits >> (8 * (sizeof(T) - 1 - byte_idx))));
+    }
+  }
+}
+
+void append_binary_length(std::string& output, const int32_t length) { append_binary(output, length); }
+
+template <typename T>
+void append_text(std::string& output, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    output.append(value.cbegin(), value.cend());
+  } else {
+    output.append(std::to_string(value));
+  }
+}
+
+// PostgreSQL sends numerics as base-10000 digits, preceded by their count, the weight (i.e., the base-10000 exponent of
+// the first digit), the sign, and the number of fractional decimal digits. Leading and trailing zero digits are omitted.
+void append_binary_numeric(std::string& output, const int64_t decimal) {
+  static_assert(DECIMAL_FACTOR == 10'000, "Expected the fraction of a Decimal to be a single base-10000 digit");
+
+  const auto magnitude = decimal < 0 ? -static_cast<uint64_t>(decimal) : static_cast<uint64_t>(decimal);
+
+  auto digits = std::vector<int16_t>{};
+  for (auto integer_part = magnitude / 10'000; integer_part > 0; integer_part /= 10'000) {
+    digits.insert(digits.begin(), static_cast<int16_t>(integer_part % 10'000));
+  }
+  const auto weight = static_cast<int16_t>(static_cast<int16_t>(digits.size()) - 1);
+  digits.emplace_back(static_cast<int16_t>(magnitude % 10'000));
+  while (!digits.empty() && digits.back() == 0) digits.pop_back();
+
+  append_binary(output, static_cast<int16_t>(digits.size()));
+  append_binary(output, digits.empty() ? int16_t{0} : weight);
+  append_binary(output, static_cast<uint16_t>(decimal < 0 ? 0x4000 : 0x0000));
+  append_binary(output, static_cast<int16_t>(DECIMAL_SCALE));
+  for (const auto digit : digits) append_binary(output, digit);
+}
+
+// PostgreSQL counts dates and timestamps from 2000-01-01 instead of 1970-01-01
+constexpr auto POSTGRES_EPOCH_DAYS = int32_t{10'957};
+constexpr auto POSTGRES_EPOCH_MICROSECONDS = int64_t{POSTGRES_EPOCH_DAYS} * 86'400'000'000;
+
+template <typename T>
+void append_binary_value(std::string& output, const DataType data_type, const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    if (data_type == DataType::Date) {
+      append_binary(output, static_cast<T>(value - POSTGRES_EPOCH_DAYS));
+      return;
+    }
+    if (data_type == DataType::Timestamp) {
+      append_binary(output, static_cast<T>(value - POSTGRES_EPOCH_MICROSECONDS));
+      return;
+    }
+    if (data_type == DataType::Decimal) {
+      append_binary_numeric(output, static_cast<int64_t>(value));
+      return;
+    }
+  }
+  append_binary(output, value);
+}
+
+template <typename T>
+void append_text_value(std::string& output, const DataType data_type, const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    if (is_logical_data_type(data_type)) {
+      output.append(value_to_string(data_type, value));
+      return;
+    }
+  }
+  append_text(output, value);
+}
+
+// In the text format of COPY, backslashes and the delimiter characters have to be escaped
+void append_copy_text(std::string& output, const pmr_string& value) {
+  for (const auto character : value) {
+    switch (character) {
+      case '\\':
+        output.append("\\\\");
+        break;
+      case '\t':
+        output.append("\\t");
+        break;
+      case '\n':
+        output.append("\\n");
+        break;
+      case '\r':
+        output.append("\\r");
+        break;
+      default:
+        output.push_back(character);
+    }
+  }
+}
+
+// Signature, flags field, and header extension length of the binary COPY format
+const auto copy_binary_header = std::string{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19};
+
+// A field count of -1 marks the end of the binary COPY data
+const auto copy_binary_trailer = std::string{"\377\377", 2};
+
+}  // namespace
+
 namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& format_codes) {
   std::vector<ColumnDescription> result;
 
+  const auto column_format_codes = resolve_format_codes(format_codes, table->column_count());
+
   const auto& column_names = table->column_names();
   const auto& column_types = table->column_data_types();
 
@@ -42,16 +174,39 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
         object_id = 25;
         type_id = -1;
         break;
+      case DataType::Date:
+        object_id = 1082;
+        type_id = 4;
+        break;
+      case DataType::Timestamp:
+        object_id = 1114;
+        type_id = 8;
+        break;
+      case DataType::Decimal:
+        object_id = 1700;
+        type_id = -1;
+        break;
       default:
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    result.emplace_back(
+        ColumnDescription{column_names[column_id], object_id, type_id, column_format_codes[column_id]});
   }
 
   return result;
 }
 
+std::vector<FormatCode> QueryResponseBuilder::resolve_format_codes(const std::vector<FormatCode>& format_codes,
+                                                                   const size_t column_count) {
+  if (format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (format_codes.size() == 1) return std::vector<FormatCode>(column_count, format_codes.front());
+
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (format_codes.size() != column_count) Fail("The number of result format codes does not match the result.");
+  return format_codes;
+}
+
 std::string QueryResponseBuilder::build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count) {
   switch (root_op.type()) {
     case OperatorType::Insert: {
@@ -77,37 +232,197 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
 }
 
 boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
+  return send_query_response(send_row, table, std::make_shared<ResultCursor>(), 0);
+}
+
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table,
+                                                                  const std::shared_ptr<ResultCursor>& cursor,
+                                                                  const uint64_t max_rows,
+                                                                  const std::vector<FormatCode>& format_codes) {
   // Essentially we're iterating over every row in every chunk in the table, generating and sending
   // its string representation. However, because of the asynchronous send_row call, we have to
   // use this two-level recursion instead of two nested for-loops
-
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
+  return _send_query_response_chunks(send_row, table, cursor, max_rows,
+                                     resolve_format_codes(format_codes, table.column_count()), 0);
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+boost::future<uint64_t> QueryResponseBuilder::send_copy_response(const send_copy_data_t& send_copy_data,
+                                                                 const Table& table, const FormatCode format_code) {
+  const auto row_count = table.row_count();
 
-  const auto& chunk = table.get_chunk(current_chunk_id);
+  auto send_header = [&]() {
+    if (format_code == FormatCode::Text) return boost::make_ready_future();
+    return send_copy_data(copy_binary_header);
+  };
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
+  auto send_trailer = [=]() {
+    if (format_code == FormatCode::Text) return boost::make_ready_future();
+    return send_copy_data(copy_binary_trailer);
+  };
+
+  return send_header() >> then >>
+         std::bind(QueryResponseBuilder::_send_copy_chunks, send_copy_data, std::ref(table), format_code,
+                   ChunkID{0}) >>
+         then >> send_trailer >> then >> [=]() { return static_cast<uint64_t>(row_count); };
 }
 
-boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+bool QueryResponseBuilder::is_exhausted(const ResultCursor& cursor, const Table& table) {
+  return cursor.chunk_id >= table.chunk_count();
+}
 
-  std::vector<std::string> row_strings(chunk.column_count());
+QueryResponseBuilder::Rows QueryResponseBuilder::_materialize_rows(const Chunk& chunk, const ChunkOffset begin_offset,
+                                                                   const ChunkOffset end_offset,
+                                                                   const std::vector<DataType>& column_data_types,
+                                                                   const std::vector<FormatCode>& format_codes) {
+  auto rows = Rows(end_offset - begin_offset, std::vector<std::optional<std::string>>(chunk.column_count()));
 
   for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& segment = chunk.get_segment(column_id);
-    row_strings[column_id] = type_cast_variant<pmr_string>((*segment)[current_chunk_offset]);
+    const auto segment = chunk.get_segment(column_id);
+    const auto data_type = column_data_types[column_id];
+    const auto format_code = format_codes[column_id];
+
+    resolve_data_type(segment->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // Accessing the rows through a typed accessor avoids the virtual operator[] and the AllTypeVariant per value
+      const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+      for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+        const auto value = accessor->access(chunk_offset);
+        auto& row_value = rows[chunk_offset - begin_offset][column_id];
+
+        if (format_code == FormatCode::Binary) {
+          // The binary format has a dedicated representation of NULL, i.e., std::nullopt
+          if (!value) continue;
+          row_value.emplace();
+          append_binary_value(*row_value, data_type, *value);
+        } else {
+          if (!value) {
+            row_value = "NULL";
+            continue;
+          }
+          row_value.emplace();
+          append_text_value(*row_value, data_type, *value);
+        }
+      }
+    });
   }
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+  return rows;
+}
+
+std::vector<std::string> QueryResponseBuilder::_materialize_copy_rows(const Chunk& chunk,
+                                                                      const std::vector<DataType>& column_data_types,
+                                                                      const FormatCode format_code) {
+  const auto column_count = chunk.column_count();
+  auto rows = std::vector<std::string>(chunk.size());
+
+  if (format_code == FormatCode::Binary) {
+    for (auto& row : rows) append_binary(row, static_cast<int16_t>(column_count));
+  }
+
+  for (ColumnID column_id{0}; column_id < ColumnID{column_count}; ++column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+    const auto data_type = column_data_types[column_id];
+    const auto is_last_column = column_id + 1 == column_count;
+
+    resolve_data_type(segment.data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // segment_iterate resolves the segment type (e.g., Value- or DictionarySegment) once, so that the values are
+      // serialized straight from the segment's iterators, without any virtual call or AllTypeVariant per value
+      auto row_iter = rows.begin();
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        auto& row = *row_iter++;
+
+        if (format_code == FormatCode::Binary) {
+          if (position.is_null()) {
+            append_binary_length(row, -1);
+          } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            append_binary_length(row, static_cast<int32_t>(position.value().size()));
+            append_binary(row, position.value());
+          } else if (data_type == DataType::Decimal) {
+            // Numerics have a variable length, so they are serialized before their length is known
+            auto numeric = std::string{};
+            append_binary_value(numeric, data_type, position.value());
+            append_binary_length(row, static_cast<int32_t>(numeric.size()));
+            row.append(numeric);
+          } else {
+            append_binary_length(row, static_cast<int32_t>(sizeof(ColumnDataType)));
+            append_binary_value(row, data_type, position.value());
+          }
+          return;
+        }
+
+        if (position.is_null()) {
+          row.append("\\N");
+        } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          append_copy_text(row, position.value());
+        } else {
+          append_text_value(row, data_type, position.value());
+        }
+        row.push_back(is_last_column ? '\n' : '\t');
+      });
+    });
+  }
+
+  return rows;
+}
+
+boost::future<uint64_t> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row,
+                                                                          const Table& table,
+                                                                          const std::shared_ptr<ResultCursor>& cursor,
+                                                                          const uint64_t max_rows,
+                                                                          const std::vector<FormatCode>& format_codes,
+                                                                          const uint64_t sent_row_count) {
+  if (is_exhausted(*cursor, table) || (max_rows > 0 && sent_row_count == max_rows)) {
+    return boost::make_ready_future(sent_row_count);
+  }
+
+  const auto& chunk = *table.get_chunk(cursor->chunk_id);
+
+  auto end_offset = static_cast<uint64_t>(chunk.size());
+  if (max_rows > 0) end_offset = std::min(end_offset, cursor->chunk_offset + (max_rows - sent_row_count));
+
+  // The rows are converted one chunk at a time. This way, only the string representation of a single chunk is held in
+  // memory, and the first rows are sent before the entire table is converted.
+  const auto rows = std::make_shared<const Rows>(
+      _materialize_rows(chunk, cursor->chunk_offset, static_cast<ChunkOffset>(end_offset), table.column_data_types(),
+                        format_codes));
+
+  if (end_offset == chunk.size()) {
+    ++cursor->chunk_id;
+    cursor->chunk_offset = 0;
+  } else {
+    cursor->chunk_offset = static_cast<ChunkOffset>(end_offset);
+  }
+
+  // Each send_row call only completes once the row has been written to the send buffer, which is flushed to the
+  // socket when it is full. Hence, the rows are not converted faster than the client consumes them.
+  return _send_rows<Rows::value_type>(send_row, rows, 0) >> then >>
+         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table), cursor, max_rows,
+                   format_codes, sent_row_count + rows->size());
+}
+
+boost::future<void> QueryResponseBuilder::_send_copy_chunks(const send_copy_data_t& send_copy_data, const Table& table,
+                                                            const FormatCode format_code, const ChunkID chunk_id) {
+  if (chunk_id == table.chunk_count()) return boost::make_ready_future();
+
+  const auto rows = std::make_shared<const std::vector<std::string>>(
+      _materialize_copy_rows(*table.get_chunk(chunk_id), table.column_data_types(), format_code));
+
+  return _send_rows<std::string>(send_copy_data, rows, 0) >> then >>
+         std::bind(QueryResponseBuilder::_send_copy_chunks, send_copy_data, std::ref(table), format_code,
+                   ChunkID{chunk_id + 1});
+}
+
+template <typename Row>
+boost::future<void> QueryResponseBuilder::_send_rows(const std::function<boost::future<void>(const Row&)>& send_row,
+                                                     const std::shared_ptr<const std::vector<Row>>& rows,
+                                                     const size_t row_idx) {
+  if (row_idx == rows->size()) return boost::make_ready_future();
+
+  return send_row((*rows)[row_idx]) >> then >>
+         std::bind(QueryResponseBuilder::_send_rows<Row>, send_row, rows, row_idx + 1);
 }
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include "sql/SQLStatement.h"
 
 #include "server/client_connection.hpp"
+#include "server/types.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -12,19 +13,68 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // The format codes are those of the Bind message, i.e., either none (text for all columns), a single one for all
+  // columns, or one per column
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<FormatCode>& format_codes = {});
   static std::string build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
+  // Returns one format code per column
+  static std::vector<FormatCode> resolve_format_codes(const std::vector<FormatCode>& format_codes,
+                                                      const size_t column_count);
+
+  using send_row_t = std::function<boost::future<void>(const std::vector<std::optional<std::string>>&)>;
+  using send_copy_data_t = std::function<boost::future<void>(const std::string&)>;
+
+  // The position of the next row to be sent. It allows sending the rows of a table in several batches, e.g., for
+  // Execute messages with a row limit.
+  struct ResultCursor {
+    ChunkID chunk_id{0};
+    ChunkOffset chunk_offset{0};
+  };
 
   static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
 
+  // Sends up to max_rows rows (all remaining rows if max_rows is 0), starting at the cursor, and advances the cursor.
+  // Returns the number of rows sent.
+  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table,
+                                                     const std::shared_ptr<ResultCursor>& cursor,
+                                                     const uint64_t max_rows,
+                                                     const std::vector<FormatCode>& format_codes = {});
+
+  // Sends the table in the format of a COPY ... TO STDOUT command, i.e., as a sequence of CopyData messages (one per
+  // row, plus header and trailer in the binary format). Returns the number of rows sent.
+  static boost::future<uint64_t> send_copy_response(const send_copy_data_t& send_copy_data, const Table& table,
+                                                    const FormatCode format_code);
+
+  static bool is_exhausted(const ResultCursor& cursor, const Table& table);
+
  protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                         ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
+  using Rows = std::vector<std::vector<std::optional<std::string>>>;
+
+  // Serializes the rows [begin_offset, end_offset) of a chunk in the given per-column formats. The column data types
+  // are needed for Dates and Timestamps, whose segments store integers.
+  static Rows _materialize_rows(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                const std::vector<DataType>& column_data_types,
+                                const std::vector<FormatCode>& format_codes);
+
+  // Serializes the rows of a chunk as the payload of CopyData messages
+  static std::vector<std::string> _materialize_copy_rows(const Chunk& chunk,
+                                                         const std::vector<DataType>& column_data_types,
+                                                         const FormatCode format_code);
+
+  static boost::future<uint64_t> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
+                                                             const std::shared_ptr<ResultCursor>& cursor,
+                                                             const uint64_t max_rows,
+                                                             const std::vector<FormatCode>& format_codes,
+                                                             const uint64_t sent_row_count);
+  static boost::future<void> _send_copy_chunks(const send_copy_data_t& send_copy_data, const Table& table,
+                                               const FormatCode format_code, const ChunkID chunk_id);
+
+  template <typename Row>
+  static boost::future<void> _send_rows(const std::function<boost::future<void>(const Row&)>& send_row,
+                                        const std::shared_ptr<const std::vector<Row>>& rows, const size_t row_idx);
 };
 
 }  // namespace opossum
@@ -3,13 +3,22 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "server_session.hpp"
 
 namespace opossum {
 
+// Accepts connections on the given io_service. If io_thread_count is larger than zero, the server starts that many
+// threads, each running an io_service of its own. New sessions are assigned to these io_services round-robin and stay
+// on them for their lifetime, so that the I/O of a session is never handled by two threads at once. Otherwise, the
+// sessions run on the io_service of the acceptor.
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  Server(boost::asio::io_service& io_service, uint16_t port, size_t io_thread_count = 0);
+  ~Server();
 
   uint16_t get_port_number();
 
@@ -17,9 +26,20 @@ class Server {
   void _accept_next_connection();
   void _start_session(boost::system::error_code error);
 
+  boost::asio::io_service& _next_session_io_service();
+
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
+
+  // The socket of the next connection, created on the io_service of the next session
+  std::unique_ptr<boost::asio::ip::tcp::socket> _socket;
+  boost::asio::io_service* _socket_io_service = nullptr;
+
+  std::vector<std::unique_ptr<boost::asio::io_service>> _session_io_services;
+  // Keeps the session io_services running while they have no connections
+  std::vector<std::unique_ptr<boost::asio::io_service::work>> _session_io_service_works;
+  std::vector<std::thread> _io_threads;
+  size_t _next_session_io_service_id = 0;
 };
 
 }  // namespace opossum
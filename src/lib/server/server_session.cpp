@@ -11,17 +11,21 @@
 
 #include "SQLParserResult.h"
 
+#include "concurrency/cancellation_token.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
+#include "storage/prepared_plan.hpp"
 #include "storage/storage_manager.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/copy_from_stdin_server_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
 
+#include "cancellation_registry.hpp"
 #include "client_connection.hpp"
 #include "query_response_builder.hpp"
 #include "then_operator.hpp"
@@ -38,9 +42,16 @@ template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
   // We need a copy of this session to outlive the async operation
   auto self = this->shared_from_this();
-  return (_perform_session_startup() >> then >> [this, self]() { return _handle_client_requests(); })
+  return (_perform_session_startup() >> then >> [this, self](bool session_started) {
+           if (!session_started) return boost::make_ready_future();
+           return _handle_client_requests();
+         })
       // Use .then instead of >> then >> to be able to handle exceptions
       .then(boost::launch::sync, [self](boost::future<void> f) {
+        if (self->_backend_key_data) {
+          CancellationRegistry::get().unregister_session(self->_backend_key_data->process_id);
+        }
+
         try {
           f.get();
         } catch (const std::exception& e) {
@@ -50,24 +61,77 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
 }
 
 template <typename TConnection, typename TTaskRunner>
-boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
-  return _connection->receive_startup_packet_header() >> then >> [=](uint32_t startup_packet_length) {
-    if (startup_packet_length == 0) {
+boost::future<bool> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
+  return _connection->receive_startup_packet_header() >> then >> [=](StartupPacketHeader startup_packet_header) {
+    if (startup_packet_header.type == StartupPacketType::SslRequest) {
       // This is a request for SSL, deny it and wait for the next startup packet
       return _connection->send_ssl_denied() >> then >> [=]() { return _perform_session_startup(); };
     }
 
-    return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
+    if (startup_packet_header.type == StartupPacketType::CancelRequest) {
+      // The server does not respond to a CancelRequest, the client learns about the cancellation from the cancelled
+      // statement. The connection is closed afterwards.
+      return _connection->receive_cancel_request_packet_body(startup_packet_header.payload_length) >> then >>
+             [=](BackendKeyData backend_key_data) {
+               CancellationRegistry::get().cancel(backend_key_data);
+               return false;
+             };
+    }
+
+    _backend_key_data = CancellationRegistry::get().register_session();
+
+    return _connection->receive_startup_packet_body(startup_packet_header.payload_length) >> then >>
            [=]() { return _connection->send_auth(); } >> then >>
+           [=]() {
+             return _connection->send_backend_key_data(_backend_key_data->process_id, _backend_key_data->secret_key);
+           } >>
+           then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_parameter_status("client_encoding", "UTF8"); } >> then >>
-           [=]() { return _connection->send_ready_for_query(); };
+           [=]() { return _connection->send_ready_for_query(); } >> then >> []() { return true; };
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+std::shared_ptr<CancellationToken> ServerSessionImpl<TConnection, TTaskRunner>::_create_statement_cancellation_token() {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  if (_statement_timeout) cancellation_token->set_timeout(*_statement_timeout);
+
+  if (_backend_key_data) {
+    CancellationRegistry::get().set_statement_cancellation_token(_backend_key_data->process_id, cancellation_token);
+  }
+
+  // The session does not read from the connection while the statement is executed, see ClientConnection
+  _connection->watch_for_disconnect([cancellation_token]() { cancellation_token->cancel(); });
+
+  return cancellation_token;
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_requests() {
+  // Messages that were read ahead are handled synchronously, i.e., their futures are ready. If each of them continued
+  // with the next message through a continuation, every buffered message would add stack frames. Thus, they are handled
+  // in a loop, and only a message that has to be awaited continues the loop in a continuation.
+  auto self = this->shared_from_this();
+  while (true) {
+    auto request_handled = _handle_client_request();
+    if (!request_handled.is_ready() || request_handled.has_exception()) {
+      return std::move(request_handled) >> then >> [this, self](bool proceed) {
+        if (!proceed) return boost::make_ready_future();
+        return _handle_client_requests();
+      };
+    }
+
+    if (!request_handled.get()) return boost::make_ready_future();
+  }
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<bool> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_request() {
+  // The previous statement has completed, the client might close the connection now
+  _connection->stop_watching_for_disconnect();
+
   auto process_command = [=](RequestHeader request) {
     switch (request.message_type) {
       case NetworkMessageType::SimpleQueryCommand: {
@@ -104,7 +168,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
 
       case NetworkMessageType::ExecuteCommand: {
         return _connection->receive_execute_packet_body(request.payload_length) >> then >>
-               [=](std::string portal) { return _handle_execute_command(portal); };
+               [=](ExecutePacket packet) { return _handle_execute_command(packet); };
       }
 
       default:
@@ -116,7 +180,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
   auto self = this->shared_from_this();
   return _connection->receive_packet_header() >> then >> [this, self, process_command](RequestHeader request) {
     if (request.message_type == NetworkMessageType::TerminateCommand) {
-      return boost::make_ready_future();
+      return boost::make_ready_future(false);
     }
 
     // Handle any exceptions that have occurred during process_command. For this, we need to call .then() explicitly,
@@ -139,8 +203,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                        }
                      })
                .unwrap()
-           // Proceed with the next incoming message
-           >> then >> [this, self]() { return _handle_client_requests(); };
+           // Proceed with the next incoming message, see _handle_client_requests()
+           >> then >> []() { return true; };
   };
 }
 
@@ -157,7 +221,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 
     return _connection->send_row_description(row_description) >> then >> [=]() {
       return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
+          [=](const std::vector<std::optional<std::string>>& row) { return _connection->send_data_row(row); },
+          *result_table);
     };
   };
 
@@ -173,10 +238,80 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_copy_response(
+    const std::shared_ptr<SQLPipeline>& sql_pipeline, const FormatCode format_code) {
+  const auto result_table = sql_pipeline->get_result_table();
+  Assert(result_table, "COPY requires a query that returns a table.");
+
+  // The COPY fast path serializes the result straight from the segments into CopyData messages, without building
+  // a DataRow message per row
+  return _connection->send_copy_out_response(format_code, static_cast<uint16_t>(result_table->column_count())) >>
+         then >>
+         [=]() {
+           return QueryResponseBuilder::send_copy_response(
+               [=](const std::string& data) { return _connection->send_copy_data(data); }, *result_table,
+               format_code);
+         } >>
+         then >> [=](uint64_t row_count) {
+           return _connection->send_status_message(NetworkMessageType::CopyDone) >> then >>
+                  [=]() { return _connection->send_command_complete("COPY " + std::to_string(row_count)); };
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_copy_from_stdin(
+    const std::string& table_name) {
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (!StorageManager::get().has_table(table_name)) Fail("The specified table does not exist.");
+  const auto column_count = StorageManager::get().get_table(table_name)->column_count();
+
+  // CSV is a textual format, so all columns use the text format
+  return _connection->send_copy_in_response(FormatCode::Text, static_cast<uint16_t>(column_count)) >> then >>
+         [=]() { return _receive_copy_data(std::make_shared<std::string>()); } >> then >>
+         [=](std::shared_ptr<std::string> data) {
+           auto task = std::make_shared<CopyFromStdinServerTask>(table_name, std::move(*data));
+           return _task_runner->dispatch_server_task(task);
+         } >>
+         then >> [=](uint64_t row_count) {
+           return _connection->send_command_complete("COPY " + std::to_string(row_count));
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<std::shared_ptr<std::string>> ServerSessionImpl<TConnection, TTaskRunner>::_receive_copy_data(
+    const std::shared_ptr<std::string>& data) {
+  return _connection->receive_packet_header() >> then >> [=](RequestHeader request) {
+    switch (request.message_type) {
+      case NetworkMessageType::CopyData: {
+        return _connection->receive_copy_data_packet_body(request.payload_length) >> then >>
+               [=](std::string copy_data) {
+                 data->append(copy_data);
+                 return _receive_copy_data(data);
+               };
+      }
+
+      case NetworkMessageType::CopyDone: {
+        return _connection->receive_copy_done_packet_body(request.payload_length) >> then >> [=]() { return data; };
+      }
+
+      case NetworkMessageType::CopyFail: {
+        return _connection->receive_copy_fail_packet_body(request.payload_length) >> then >>
+               [=](std::string message) -> std::shared_ptr<std::string> { Fail("COPY failed: " + message); };
+      }
+
+      default:
+        Fail("Unexpected message during COPY FROM STDIN.");
+    }
+  };
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
+  const auto cancellation_token = _create_statement_cancellation_token();
+
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, cancellation_token));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -191,12 +326,22 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   };
 
   // A simple query command invalidates unnamed statements and portals
-  if (StorageManager::get().has_prepared_plan("")) StorageManager::get().drop_prepared_plan("");
+  _prepared_statements.erase("");
   _portals.erase("");
 
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
     if (result->load_table.has_value()) {
       return load_table_file(result->load_table->first, result->load_table->second);
+    } else if (result->copy_from_stdin_table) {
+      return _handle_copy_from_stdin(*result->copy_from_stdin_table);
+    } else if (result->statement_timeout) {
+      _statement_timeout = result->statement_timeout->count() > 0 ? result->statement_timeout : std::nullopt;
+      return _connection->send_command_complete("SET");
+    } else if (result->copy_to_stdout_format) {
+      const auto format_code = *result->copy_to_stdout_format;
+      return execute_sql_pipeline(result->sql_pipeline) >> then >> [=](std::shared_ptr<SQLPipeline> sql_pipeline) {
+        return _send_copy_response(sql_pipeline, format_code);
+      };
     } else {
       return execute_sql_pipeline(result->sql_pipeline) >> then >>
              [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_simple_query_response(sql_pipeline); };
@@ -206,37 +351,52 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_command(const ParsePacket& parse_info) {
+  const auto statement_name = parse_info.statement_name;
+
   // Named prepared statements must be explicitly closed before they can be redefined by another Parse message
   // https://www.postgresql.org/docs/10/static/protocol-flow.html
-  if (StorageManager::get().has_prepared_plan(parse_info.statement_name)) {
+  auto statement_it = _prepared_statements.find(statement_name);
+  if (statement_it != _prepared_statements.end()) {
     // Not using Assert() since it includes file:line info that we don't want to hard code in tests
-    if (!parse_info.statement_name.empty()) {
+    if (!statement_name.empty()) {
       Fail("Named prepared statements must be explicitly closed before they can be redefined.");
     }
-    StorageManager::get().drop_prepared_plan(parse_info.statement_name);
+    _prepared_statements.erase(statement_it);
+  }
+
+  if (statement_name.empty()) {
+    const auto cached_statement_it = _unnamed_statements_by_sql.find(parse_info.query);
+    if (cached_statement_it != _unnamed_statements_by_sql.end()) {
+      _prepared_statements.emplace(statement_name, cached_statement_it->second);
+      return _connection->send_status_message(NetworkMessageType::ParseComplete);
+    }
   }
 
   auto task = std::make_shared<ParseServerPreparedStatementTask>(parse_info.query);
   return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<PreparedPlan> prepared_plan) {
-           // We know that SQLPipeline is set because the load table command is not allowed in this context
-           StorageManager::get().add_prepared_plan(parse_info.statement_name, std::move(prepared_plan));
+           auto statement = std::make_shared<PreparedStatement>();
+           statement->prepared_plan = std::move(prepared_plan);
+           _prepared_statements.emplace(statement_name, statement);
+
+           if (statement_name.empty()) {
+             if (_unnamed_statements_by_sql.size() >= MAX_CACHED_UNNAMED_STATEMENTS) _unnamed_statements_by_sql.clear();
+             _unnamed_statements_by_sql.emplace(parse_info.query, statement);
+           }
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_command(const BindPacket& packet) {
+  const auto statement_it = _prepared_statements.find(packet.statement_name);
   // Not using Assert() since it includes file:line info that we don't want to hard code in tests
-  if (!StorageManager::get().has_prepared_plan(packet.statement_name)) {
-    Fail("The specified statement does not exist.");
-  }
+  if (statement_it == _prepared_statements.end()) Fail("The specified statement does not exist.");
 
-  const auto prepared_plan = StorageManager::get().get_prepared_plan(packet.statement_name);
-
-  if (packet.statement_name.empty()) StorageManager::get().drop_prepared_plan(packet.statement_name);
+  const auto statement = statement_it->second;
 
   auto portal_name = packet.destination_portal;
+  auto result_format_codes = packet.result_format_codes;
 
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
@@ -248,10 +408,27 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
     _portals.erase(portal_it);
   }
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
+  // The cached plan must not be executed, each portal gets its own copy
+  auto bind_physical_plan = [=](const std::shared_ptr<AbstractOperator>& cached_physical_plan) {
+    const auto physical_plan = cached_physical_plan->deep_copy();
+    physical_plan->set_parameters(
+        BindServerPreparedStatementTask::parameters_by_id(*statement->prepared_plan, packet.params));
+
+    const auto portal = Portal{physical_plan, result_format_codes, nullptr, nullptr};
+    _portals.emplace(portal_name, std::make_shared<Portal>(portal));
+    return _connection->send_status_message(NetworkMessageType::BindComplete);
+  };
+
+  const auto parameter_data_types = BindServerPreparedStatementTask::parameter_data_types(packet.params);
+  const auto physical_plan_it = statement->physical_plans.find(parameter_data_types);
+  if (physical_plan_it != statement->physical_plans.end()) return bind_physical_plan(physical_plan_it->second);
+
+  auto task = std::make_shared<BindServerPreparedStatementTask>(statement->prepared_plan, packet.params);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
-         then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
+         [=](std::shared_ptr<AbstractOperator> physical_plan) {
+           statement->physical_plans.emplace(parameter_data_types, physical_plan);
+           return bind_physical_plan(physical_plan);
+         };
 }
 
 template <typename TConnection, typename TTaskRunner>
@@ -273,42 +450,66 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_co
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_flush_command() {
-  // Ignore this because this message is received in a batch with other commands that handle the response.
-  return boost::make_ready_future();
+  // The client expects the responses to all previous messages, which the connection might still buffer
+  return _connection->flush();
 }
 
 template <typename TConnection, typename TTaskRunner>
-boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(
-    const std::string& portal_name) {
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(const ExecutePacket& packet) {
+  const auto portal_name = packet.portal;
   auto portal_it = _portals.find(portal_name);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  const auto portal = portal_it->second;
+  const auto physical_plan = portal->physical_plan;
+
+  auto send_row = [=](const std::vector<std::optional<std::string>>& row) { return _connection->send_data_row(row); };
 
-  if (portal_name.empty()) _portals.erase(portal_it);
+  // Sends the next rows of the result. If the row limit is reached before all rows were sent, the portal is suspended
+  // and the client may request the remaining rows with another Execute message. The rows are converted and written to
+  // the send buffer chunk by chunk, so that the client receives the first rows before the entire result is converted.
+  auto send_rows = [=]() {
+    return QueryResponseBuilder::send_query_response(send_row, *portal->result_table, portal->cursor,
+                                                     packet.max_rows, portal->result_format_codes) >>
+           then >> [=](uint64_t row_count) {
+             if (!QueryResponseBuilder::is_exhausted(*portal->cursor, *portal->result_table)) {
+               return _connection->send_status_message(NetworkMessageType::PortalSuspended);
+             }
+
+             // The unnamed portal is closed once it has been completed
+             if (portal_name.empty()) _portals.erase(portal_name);
+
+             auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
+             return _connection->send_command_complete(complete_message);
+           };
+  };
+
+  // A suspended portal continues where the last Execute message stopped
+  if (portal->cursor) return send_rows();
 
   if (!_transaction) _transaction = TransactionManager::get().new_transaction_context();
 
   physical_plan->set_transaction_context_recursively(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
-         [=](std::shared_ptr<const Table> result_table) {
+  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(
+                                                    physical_plan, _create_statement_cancellation_token())) >>
+         then >> [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table) {
-             return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
-                    []() { return uint64_t(0); };
+             if (portal_name.empty()) _portals.erase(portal_name);
+
+             return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >> [=]() {
+               auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, 0);
+               return _connection->send_command_complete(complete_message);
+             };
            }
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
-           return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-           };
-         } >>
-         then >> [=](uint64_t row_count) {
-           auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
-           return _connection->send_command_complete(complete_message);
+           portal->result_table = result_table;
+           portal->cursor = std::make_shared<QueryResponseBuilder::ResultCursor>();
+
+           const auto row_description =
+               QueryResponseBuilder::build_row_description(result_table, portal->result_format_codes);
+           return _connection->send_row_description(row_description) >> then >> send_rows;
          };
 }
 
@@ -4,16 +4,33 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
+#include "query_response_builder.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class CancellationToken;
+class PreparedPlan;
+
+/**
+ * Handles the PostgreSQL wire protocol of a client connection.
+ *
+ * Each statement gets a CancellationToken, which is cancelled if the client sends a CancelRequest with the
+ * BackendKeyData of the session (see CancellationRegistry), if the client disconnects while the statement is executed,
+ * or if the timeout set by SET statement_timeout has passed.
+ */
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
@@ -23,25 +40,66 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   boost::future<void> start();
 
  protected:
-  boost::future<void> _perform_session_startup();
+  // Returns false if the connection only carried a CancelRequest, which does not start a session
+  boost::future<bool> _perform_session_startup();
+
+  // Creates the token of the next statement, see CancellationToken
+  std::shared_ptr<CancellationToken> _create_statement_cancellation_token();
 
   boost::future<void> _handle_client_requests();
+  // Handles the next message and returns false if the client terminated the session
+  boost::future<bool> _handle_client_request();
   boost::future<void> _handle_simple_query_command(const std::string& sql);
   boost::future<void> _handle_parse_command(const ParsePacket& parse_info);
   boost::future<void> _handle_bind_command(const BindPacket& packet);
   boost::future<void> _handle_describe_command(const std::string& portal_name);
-  boost::future<void> _handle_execute_command(const std::string& portal_name);
+  boost::future<void> _handle_execute_command(const ExecutePacket& packet);
   boost::future<void> _handle_sync_command();
   boost::future<void> _handle_flush_command();
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
+  boost::future<void> _send_copy_response(const std::shared_ptr<SQLPipeline>& sql_pipeline,
+                                          const FormatCode format_code);
+
+  boost::future<void> _handle_copy_from_stdin(const std::string& table_name);
+  // Receives CopyData messages until the client sends CopyDone and returns the concatenated data
+  boost::future<std::shared_ptr<std::string>> _receive_copy_data(const std::shared_ptr<std::string>& data);
 
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::optional<BackendKeyData> _backend_key_data;
+  std::optional<std::chrono::milliseconds> _statement_timeout;
+
+  // A bound statement. Once it has been executed, it holds the result and the position of the next row to be sent, so
+  // that an Execute message with a row limit can be continued by the next Execute message for the same portal.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_format_codes;
+    std::shared_ptr<const Table> result_table;
+    std::shared_ptr<QueryResponseBuilder::ResultCursor> cursor;
+  };
+
+  std::unordered_map<std::string, std::shared_ptr<Portal>> _portals;
+
+  // A statement created by a Parse message. Bind messages reuse its physical plans (see
+  // BindServerPreparedStatementTask) for parameters of the same data types, so that a statement is only optimized and
+  // translated once.
+  struct PreparedStatement {
+    std::shared_ptr<PreparedPlan> prepared_plan;
+    std::map<std::vector<DataType>, std::shared_ptr<AbstractOperator>> physical_plans;
+  };
+
+  // The prepared statements of this session by name. The unnamed statement ("") is replaced by every Parse message
+  // without a name and removed by simple query commands.
+  std::unordered_map<std::string, std::shared_ptr<PreparedStatement>> _prepared_statements;
+
+  // Clients like JDBC send a Parse message for the unnamed statement before each query. The unnamed statements are kept
+  // by their SQL string, so that a query that is sent again reuses the plans of the previous statement.
+  static constexpr auto MAX_CACHED_UNNAMED_STATEMENTS = size_t{1'000};
+  std::unordered_map<std::string, std::shared_ptr<PreparedStatement>> _unnamed_statements_by_sql;
 };
 
 // The corresponding template instantiation takes place in the .cpp
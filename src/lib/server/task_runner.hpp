@@ -32,7 +32,12 @@ auto TaskRunner::dispatch_server_task(std::shared_ptr<TResult> task) -> decltype
 
   CurrentScheduler::schedule_tasks(TaskList({task}));
 
-  return task->get_future()
+  // If the task has already been executed, e.g., by schedule_tasks() itself when no scheduler is active, we are still
+  // on the io_service's thread and there is no need to dispatch the result back to it
+  auto future = task->get_future();
+  if (future.is_ready()) return future;
+
+  return future
       .then(boost::launch::sync,
             [=](auto result) {
               // This result comes in on the scheduler thread, so we want to dispatch it back to the io_service
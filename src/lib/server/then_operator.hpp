@@ -13,6 +13,8 @@
 //    which avoids additional threads to be spawned to execute the continuations
 // 3. It automatically unwraps future<future<*>> objects in case that the continuation
 //    returns another future
+// 4. It calls the continuation right away if the incoming future is already ready, without allocating the
+//    shared states of boost::future::then() (see invoke_ready())
 
 // Example:
 // Given the following methods:
@@ -67,9 +69,55 @@ struct is_future<boost::future<T>> : public std::true_type {};
 template <typename T>
 inline constexpr bool is_future_v = is_future<T>::value;
 
+template <typename T>
+struct future_value {};
+
+template <typename T>
+struct future_value<boost::future<T>> {
+  using type = T;
+};
+
+// Most futures in the server are already ready when a continuation is attached, e.g., those of buffered sends and of
+// messages that were read ahead. For these, boost::future::then() would still allocate the shared state of the
+// continuation (and, with unwrap(), another one for the unwrapped future). Instead, the continuation is called directly
+// and an exception is stored in the returned future, as then() would do.
+template <class T, class F, class R>
+auto invoke_ready(boost::future<T>&& lhs, F&& f) {
+  try {
+    if constexpr (std::is_void_v<T>) {
+      lhs.get();
+      if constexpr (is_future_v<R>) {
+        return std::forward<F>(f)();
+      } else if constexpr (std::is_void_v<R>) {
+        std::forward<F>(f)();
+        return boost::make_ready_future();
+      } else {
+        return boost::make_ready_future(std::forward<F>(f)());
+      }
+    } else {
+      if constexpr (is_future_v<R>) {
+        return std::forward<F>(f)(lhs.get());
+      } else if constexpr (std::is_void_v<R>) {
+        std::forward<F>(f)(lhs.get());
+        return boost::make_ready_future();
+      } else {
+        return boost::make_ready_future(std::forward<F>(f)(lhs.get()));
+      }
+    }
+  } catch (...) {
+    if constexpr (is_future_v<R>) {
+      return boost::make_exceptional_future<typename future_value<R>::type>(boost::current_exception());
+    } else {
+      return boost::make_exceptional_future<R>(boost::current_exception());
+    }
+  }
+}
+
 // handle future<void> inputs with lambdas producing future<*> outputs
 template <class F, class R = std::result_of_t<std::decay_t<F>()>>
 auto invoke(boost::future<void>&& lhs, then_t, F&& f) -> std::enable_if_t<is_future_v<R>, R> {
+  if (lhs.is_ready()) return invoke_ready<void, F, R>(std::move(lhs), std::forward<F>(f));
+
   return lhs
       .then(boost::launch::sync,
             [f = std::forward<F>(f)](boost::future<void> fut) mutable -> R {
@@ -82,6 +130,8 @@ auto invoke(boost::future<void>&& lhs, then_t, F&& f) -> std::enable_if_t<is_fut
 // handle future<T> inputs with lambdas producing future<*> outputs
 template <class T, class F, class R = std::result_of_t<std::decay_t<F>(T)>>
 auto invoke(boost::future<T>&& lhs, then_t, F&& f) -> std::enable_if_t<is_future_v<R>, R> {
+  if (lhs.is_ready()) return invoke_ready<T, F, R>(std::move(lhs), std::forward<F>(f));
+
   return lhs
       .then(boost::launch::sync,
             [f = std::forward<F>(f)](boost::future<T> fut) mutable -> R {
@@ -93,6 +143,8 @@ auto invoke(boost::future<T>&& lhs, then_t, F&& f) -> std::enable_if_t<is_future
 // handle future<void> inputs
 template <class F, class R = std::result_of_t<std::decay_t<F>()>>
 auto invoke(boost::future<void>&& lhs, then_t, F&& f) -> std::enable_if_t<!is_future_v<R>, boost::future<R>> {
+  if (lhs.is_ready()) return invoke_ready<void, F, R>(std::move(lhs), std::forward<F>(f));
+
   return lhs.then(boost::launch::sync, [f = std::forward<F>(f)](boost::future<void> fut) mutable -> R {
     fut.get();
     return std::move(f)();
@@ -102,6 +154,8 @@ auto invoke(boost::future<void>&& lhs, then_t, F&& f) -> std::enable_if_t<!is_fu
 // handle future<T> inputs
 template <class T, class F, class R = std::result_of_t<std::decay_t<F>(T)>>
 auto invoke(boost::future<T>&& lhs, then_t, F&& f) -> std::enable_if_t<!is_future_v<R>, boost::future<R>> {
+  if (lhs.is_ready()) return invoke_ready<T, F, R>(std::move(lhs), std::forward<F>(f));
+
   return lhs.then(boost::launch::sync, [f = std::forward<F>(f)](boost::future<T> fut) mutable -> R {
     return std::move(f)(std::forward<T>(fut.get()));
   });
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 enum class NetworkMessageType : unsigned char {
@@ -20,6 +22,13 @@ enum class NetworkMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  PortalSuspended = 's',
+  CopyOutResponse = 'H',
+  CopyData = 'd',
+  CopyDone = 'c',
+  CopyInResponse = 'G',
+  CopyFail = 'f',
+  BackendKeyData = 'K',
 
   // Errors
   HumanReadableError = 'M',
@@ -42,6 +51,15 @@ enum class NetworkMessageType : unsigned char {
   Notice = 'N',
 };
 
+// Identifies a session in a CancelRequest, which the client sends on a new connection
+struct BackendKeyData {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
+// Format of the values in DataRow and CopyData messages
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 enum class TransactionStatusIndicator : unsigned char {
   Idle = 'I',
   InTransactionBlock = 'T',
@@ -1,13 +1,15 @@
 #include "create_sql_parser_error_message.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 #include "boost/algorithm/string/classification.hpp"
 #include "boost/algorithm/string/split.hpp"
 
-namespace opossum {
+namespace {
 
-std::string create_sql_parser_error_message(const std::string& sql, const hsql::SQLParserResult& result) {
+std::string create_error_message(const std::string& sql, const uint32_t error_line, const uint32_t error_column,
+                                 const char* message) {
   std::stringstream error_msg;
   error_msg << "SQL query not valid.\n";
 
@@ -15,31 +17,70 @@ std::string create_sql_parser_error_message(const std::string& sql, const hsql::
   boost::algorithm::split(sql_lines, sql, boost::is_any_of("\n"));
 
   error_msg << "SQL query:\n==========\n";
-  const uint32_t error_line = result.errorLine();
   for (auto line_number = 0u; line_number < sql_lines.size(); ++line_number) {
     error_msg << sql_lines[line_number] << '\n';
 
     // Add indicator to where the error is
     if (line_number == error_line) {
-      const uint32_t error_column = result.errorColumn();
       const auto& line = sql_lines[line_number];
+      const auto column = std::min(static_cast<size_t>(error_column), line.size());
 
       // Keep indentation of tab characters
-      auto num_tabs = std::count(line.begin(), line.begin() + error_column, '\t');
+      auto num_tabs = std::count(line.begin(), line.begin() + column, '\t');
       error_msg << std::string(num_tabs, '\t');
 
       // Use some color to highlight the error
       const auto color_red = "\x1B[31m";
       const auto color_reset = "\x1B[0m";
-      error_msg << std::string(error_column - num_tabs, ' ') << color_red << "^=== ERROR HERE!" << color_reset << "\n";
+      error_msg << std::string(column - num_tabs, ' ') << color_red << "^=== ERROR HERE!" << color_reset << "\n";
     }
   }
 
   error_msg << "=========="
-            << "\nError line: " << result.errorLine() << "\nError column: " << result.errorColumn()
-            << "\nError message: " << result.errorMsg();
+            << "\nError line: " << error_line << "\nError column: " << error_column << "\nError message: " << message;
 
   return error_msg.str();
 }
 
+}  // namespace
+
+namespace opossum {
+
+std::string create_sql_parser_error_message(const std::string& sql, const hsql::SQLParserResult& result) {
+  return create_error_message(sql, result.errorLine(), result.errorColumn(), result.errorMsg());
+}
+
+std::string create_sql_parser_error_message(const std::string& sql, const std::string& parsed_sql,
+                                            const hsql::SQLParserResult& result) {
+  // Find the position of the error in the parsed SQL
+  auto parsed_offset = size_t{0};
+  for (auto line = 0u; line < result.errorLine() && parsed_offset < parsed_sql.size(); ++line) {
+    const auto line_end = parsed_sql.find('\n', parsed_offset);
+    parsed_offset = line_end == std::string::npos ? parsed_sql.size() : line_end + 1;
+  }
+  parsed_offset = std::min(parsed_offset + result.errorColumn(), parsed_sql.size());
+
+  // The rewrites only replace parts of the SQL. Positions before the first and after the last replaced part are the
+  // same in both strings, errors inside the replaced parts are reported at their beginning.
+  const auto mismatch = std::mismatch(sql.begin(), sql.end(), parsed_sql.begin(), parsed_sql.end());
+  const auto prefix_length = static_cast<size_t>(std::distance(sql.begin(), mismatch.first));
+  const auto reverse_mismatch = std::mismatch(sql.rbegin(), sql.rend(), parsed_sql.rbegin(), parsed_sql.rend());
+  const auto suffix_length = std::min(static_cast<size_t>(std::distance(sql.rbegin(), reverse_mismatch.first)),
+                                      std::min(sql.size(), parsed_sql.size()) - prefix_length);
+
+  auto offset = prefix_length;
+  if (parsed_offset <= prefix_length) {
+    offset = parsed_offset;
+  } else if (parsed_offset >= parsed_sql.size() - suffix_length) {
+    offset = sql.size() - (parsed_sql.size() - parsed_offset);
+  }
+
+  const auto line_begin = sql.rfind('\n', offset == 0 ? 0 : offset - 1);
+  const auto error_line = static_cast<uint32_t>(std::count(sql.begin(), sql.begin() + offset, '\n'));
+  const auto error_column =
+      static_cast<uint32_t>(line_begin == std::string::npos || offset == 0 ? offset : offset - line_begin - 1);
+
+  return create_error_message(sql, error_line, error_column, result.errorMsg());
+}
+
 }  // namespace opossum
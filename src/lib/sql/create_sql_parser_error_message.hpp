@@ -8,4 +8,9 @@ namespace opossum {
 
 std::string create_sql_parser_error_message(const std::string& sql, const hsql::SQLParserResult& result);
 
+// For errors in @param parsed_sql, which was rewritten from @param sql (see rewrite_sql_for_parser()). The error is
+// reported for the SQL as the user wrote it.
+std::string create_sql_parser_error_message(const std::string& sql, const std::string& parsed_sql,
+                                            const hsql::SQLParserResult& result);
+
 }  // namespace opossum
@@ -0,0 +1,212 @@
+#include "normalize_sql_literals.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// ValuePlaceholderIDs are 16 bit wide. Statements with more literals than this are not normalized.
+constexpr auto MAX_LITERAL_COUNT = size_t{1024};
+
+// Keywords that start a clause in which literals are replaced
+const auto parameterizing_keywords = std::unordered_set<std::string>{"WHERE", "HAVING", "VALUES", "SET"};
+
+// Keywords that start a clause in which literals are kept
+const auto non_parameterizing_keywords = std::unordered_set<std::string>{
+    "SELECT", "FROM", "JOIN", "ON", "GROUP", "ORDER", "LIMIT", "OFFSET", "UNION", "INTERSECT", "EXCEPT"};
+
+// Keywords whose parenthesized arguments are part of a type, e.g., `CAST(a AS CHAR(10))`
+const auto type_keywords = std::unordered_set<std::string>{"CHAR", "VARCHAR", "DECIMAL", "NUMERIC", "FLOAT"};
+
+bool is_identifier_start(const char character) {
+  return std::isalpha(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+// Parses a number literal the same way the SQLTranslator would type it
+std::optional<AllTypeVariant> parse_number_literal(const std::string& literal) {
+  try {
+    if (literal.find('.') != std::string::npos) return AllTypeVariant{std::stod(literal)};
+
+    const auto value = std::stoll(literal);
+    if (static_cast<int32_t>(value) == value) return AllTypeVariant{static_cast<int32_t>(value)};
+    return AllTypeVariant{static_cast<int64_t>(value)};
+  } catch (const std::out_of_range&) {
+    // Leave literals that do not fit into an int64_t or double to the parser
+    return std::nullopt;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string NormalizedSQL::cache_key() const {
+  auto cache_key = sql + "\n-- literal types:";
+  for (const auto& value : literal_values) {
+    cache_key += " " + data_type_to_string.left.at(data_type_from_all_type_variant(value));
+  }
+  return cache_key;
+}
+
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  normalized_sql.sql.reserve(sql.size());
+
+  // Whether literals are replaced in the current clause. Parentheses (e.g., subqueries) get a clause of their own,
+  // which starts out like the surrounding one.
+  auto parameterize_stack = std::vector<bool>{false};
+
+  // The last keyword or identifier, if it directly precedes the current token
+  auto previous_word = std::string{};
+
+  const auto add_literal = [&](const std::string& literal, const AllTypeVariant& value) {
+    if (!parameterize_stack.back() || previous_word == "INTERVAL" ||
+        normalized_sql.literal_values.size() == MAX_LITERAL_COUNT) {
+      normalized_sql.sql += literal;
+      return;
+    }
+
+    normalized_sql.sql += '?';
+    normalized_sql.literal_values.emplace_back(value);
+  };
+
+  auto position = size_t{0};
+  while (position < sql.size()) {
+    const auto character = sql[position];
+    const auto next_character = position + 1 < sql.size() ? sql[position + 1] : '\0';
+
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      normalized_sql.sql += character;
+      ++position;
+      continue;
+    }
+
+    // Comments and quoted identifiers are copied verbatim
+    auto verbatim_end = std::string::npos;
+    if (character == '-' && next_character == '-') {
+      verbatim_end = sql.find('\n', position);
+      if (verbatim_end == std::string::npos) verbatim_end = sql.size();
+    } else if (character == '/' && next_character == '*') {
+      verbatim_end = sql.find("*/", position + 2);
+      verbatim_end = verbatim_end == std::string::npos ? sql.size() : verbatim_end + 2;
+    } else if (character == '"' || character == '`') {
+      verbatim_end = sql.find(character, position + 1);
+      verbatim_end = verbatim_end == std::string::npos ? sql.size() : verbatim_end + 1;
+    }
+
+    if (verbatim_end != std::string::npos) {
+      normalized_sql.sql += sql.substr(position, verbatim_end - position);
+      position = verbatim_end;
+      previous_word.clear();
+      continue;
+    }
+
+    if (character == '\'') {
+      auto end = sql.find('\'', position + 1);
+      // Leave unterminated strings to the parser
+      if (end == std::string::npos) return std::nullopt;
+
+      // Strings with escaped quotes ('') are kept, including all of their parts
+      auto has_escaped_quotes = false;
+      while (end + 1 < sql.size() && sql[end + 1] == '\'') {
+        has_escaped_quotes = true;
+        end = sql.find('\'', end + 2);
+        if (end == std::string::npos) return std::nullopt;
+      }
+
+      const auto literal = sql.substr(position, end + 1 - position);
+      if (has_escaped_quotes) {
+        normalized_sql.sql += literal;
+      } else {
+        add_literal(literal, pmr_string{literal.substr(1, literal.size() - 2)});
+      }
+
+      position = end + 1;
+      previous_word.clear();
+      continue;
+    }
+
+    if (is_digit(character) || (character == '.' && is_digit(next_character))) {
+      auto end = position;
+      while (end < sql.size() && is_digit(sql[end])) ++end;
+      if (end < sql.size() && sql[end] == '.') {
+        ++end;
+        while (end < sql.size() && is_digit(sql[end])) ++end;
+      }
+
+      // Things like `1e5` or `1.2.3` are copied verbatim - the parser will deal with them
+      if (end < sql.size() && (is_identifier_character(sql[end]) || sql[end] == '.')) {
+        while (end < sql.size() && (is_identifier_character(sql[end]) || sql[end] == '.')) ++end;
+        normalized_sql.sql += sql.substr(position, end - position);
+      } else {
+        const auto literal = sql.substr(position, end - position);
+        const auto value = parse_number_literal(literal);
+        if (value) {
+          add_literal(literal, *value);
+        } else {
+          normalized_sql.sql += literal;
+        }
+      }
+
+      position = end;
+      previous_word.clear();
+      continue;
+    }
+
+    if (is_identifier_start(character)) {
+      auto end = position;
+      while (end < sql.size() && is_identifier_character(sql[end])) ++end;
+
+      const auto word = sql.substr(position, end - position);
+      normalized_sql.sql += word;
+
+      previous_word = boost::to_upper_copy(word);
+      if (parameterizing_keywords.count(previous_word)) {
+        parameterize_stack.back() = true;
+      } else if (non_parameterizing_keywords.count(previous_word)) {
+        parameterize_stack.back() = false;
+      }
+
+      position = end;
+      continue;
+    }
+
+    // Statements that already contain value placeholders (e.g., PREPAREd ones) are not normalized
+    if (character == '?') return std::nullopt;
+
+    if (character == '(') {
+      parameterize_stack.emplace_back(!type_keywords.count(previous_word) && parameterize_stack.back());
+    } else if (character == ')' && parameterize_stack.size() > 1) {
+      parameterize_stack.pop_back();
+    }
+
+    normalized_sql.sql += character;
+    ++position;
+    previous_word.clear();
+  }
+
+  if (normalized_sql.literal_values.empty()) return std::nullopt;
+
+  return normalized_sql;
+}
+
+ParameterID literal_parameter_id(const size_t literal_idx) {
+  return ParameterID{std::numeric_limits<ParameterID::base_type>::max() - literal_idx};
+}
+
+}  // namespace opossum
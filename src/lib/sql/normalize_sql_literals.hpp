@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * SQL string in which literals were replaced by value placeholders ('?'), together with the values of the replaced
+ * literals in the order of their appearance
+ */
+struct NormalizedSQL {
+  // Key under which plans for the normalized SQL are cached. As the plans depend on the data types of the literals
+  // (e.g., for `a + 1` vs. `a + 1.5`), these are part of the key.
+  std::string cache_key() const;
+
+  std::string sql;
+  std::vector<AllTypeVariant> literal_values;
+};
+
+/**
+ * Replaces the number and string literals of an SQL statement with value placeholders, so that statements that only
+ * differ in their literals, e.g., `SELECT * FROM t WHERE id = 17` and `SELECT * FROM t WHERE id = 18`, share the same
+ * normalized SQL and can share a cached plan.
+ *
+ * Only literals in WHERE, HAVING, VALUES, and SET clauses are replaced. Literals in other clauses (e.g., in the
+ * SELECT list, LIMIT, or type definitions) often influence the structure of the plan or its output columns.
+ *
+ * Returns std::nullopt if nothing was replaced, or if the statement already contains value placeholders.
+ */
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql);
+
+/**
+ * ParameterIDs used to bind the literal values of a NormalizedSQL. They are taken from the top of the ParameterID
+ * range so that they do not collide with the ParameterIDs the SQLTranslator allocates for correlated subqueries.
+ */
+ParameterID literal_parameter_id(const size_t literal_idx);
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "rewrite_set_operations.hpp"
+
+#include <vector>
+
+#include "sql_tokenizer.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+const auto SET_OPERATION_MARKER_PREFIX = std::string{"hyrise_set_operation:"};
+
+}  // namespace
+
+namespace opossum {
+
+std::string rewrite_set_operations(const std::string& sql) {
+  const auto tokens = tokenize_sql(sql);
+
+  const auto token_is_word = [&](const size_t idx, const std::string& text) {
+    return idx < tokens.size() && tokens[idx].type == SQLTokenType::Word && tokens[idx].text == text;
+  };
+
+  auto rewritten_sql = std::string{};
+  // Everything before this position has been copied to the rewritten SQL already
+  auto copied_until = size_t{0};
+
+  for (auto token_idx = size_t{0}; token_idx < tokens.size(); ++token_idx) {
+    // The SQLTranslator could not tell a string of the user from a marker
+    AssertInput(tokens[token_idx].type != SQLTokenType::String ||
+                    tokens[token_idx].text.compare(1, SET_OPERATION_MARKER_PREFIX.size(),
+                                                   SET_OPERATION_MARKER_PREFIX) != 0,
+                "Strings starting with '" + SET_OPERATION_MARKER_PREFIX + "' are reserved");
+
+    if (!token_is_word(token_idx, "INTERSECT") && !token_is_word(token_idx, "EXCEPT")) continue;
+
+    const auto operator_begin = tokens[token_idx].begin;
+    auto set_operation = tokens[token_idx].text;
+    if (token_is_word(token_idx + 1, "ALL")) {
+      set_operation += " ALL";
+      ++token_idx;
+    }
+    const auto operator_end = tokens[token_idx].end;
+
+    // The right input may be parenthesized
+    ++token_idx;
+    while (token_idx < tokens.size() && tokens[token_idx].type == SQLTokenType::Symbol &&
+           tokens[token_idx].text == "(") {
+      ++token_idx;
+    }
+    AssertInput(token_is_word(token_idx, "SELECT"), "Expected SELECT after " + set_operation);
+    if (token_is_word(token_idx + 1, "DISTINCT")) ++token_idx;
+
+    rewritten_sql += sql.substr(copied_until, operator_begin - copied_until);
+    rewritten_sql += "UNION";
+    rewritten_sql += sql.substr(operator_end, tokens[token_idx].end - operator_end);
+    rewritten_sql += " '" + SET_OPERATION_MARKER_PREFIX + set_operation + "',";
+    copied_until = tokens[token_idx].end;
+  }
+
+  rewritten_sql += sql.substr(copied_until);
+  return rewritten_sql;
+}
+
+std::optional<SetOperation> parse_set_operation_marker(const std::string& string) {
+  if (string.compare(0, SET_OPERATION_MARKER_PREFIX.size(), SET_OPERATION_MARKER_PREFIX) != 0) return std::nullopt;
+
+  const auto set_operation = string.substr(SET_OPERATION_MARKER_PREFIX.size());
+  if (set_operation == "INTERSECT") return SetOperation{SetOperationType::Intersect, SetOperationMode::Unique};
+  if (set_operation == "INTERSECT ALL") return SetOperation{SetOperationType::Intersect, SetOperationMode::All};
+  if (set_operation == "EXCEPT") return SetOperation{SetOperationType::Except, SetOperationMode::Unique};
+  if (set_operation == "EXCEPT ALL") return SetOperation{SetOperationType::Except, SetOperationMode::All};
+  return std::nullopt;
+}
+
+}  // namespace opossum
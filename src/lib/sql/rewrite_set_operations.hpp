@@ -0,0 +1,36 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class SetOperationType { Intersect, Except };
+
+struct SetOperation {
+  SetOperationType type;
+  SetOperationMode mode;
+};
+
+/**
+ * The SQL parser accepts UNION, INTERSECT, and EXCEPT [ALL], but it does not record which of them was used: The right
+ * input of each is stored as the unionSelect of the left one. To tell them apart, INTERSECT and EXCEPT are rewritten
+ * into UNION before parsing, and a marker is added as the first SELECT list item of the right input:
+ *   SELECT a FROM t EXCEPT ALL (SELECT DISTINCT b FROM u)
+ * becomes
+ *   SELECT a FROM t UNION (SELECT DISTINCT 'hyrise_set_operation:EXCEPT ALL', b FROM u)
+ * The SQLTranslator reads the marker using parse_set_operation_marker() and skips it when translating the right input.
+ * Set operations without a marker are UNIONs, which are not supported yet.
+ *
+ * Comments, strings, and quoted identifiers are left alone. Strings that start like a marker would be mistaken for one,
+ * so they are rejected with an InvalidInputException, as are INTERSECT and EXCEPT that are not followed by a SELECT.
+ * The rewritten SQL is only parsed, statement strings stay as the user wrote them (see rewrite_sql_for_parser()).
+ */
+std::string rewrite_set_operations(const std::string& sql);
+
+// Parses a marker added by rewrite_set_operations(). Other strings yield std::nullopt.
+std::optional<SetOperation> parse_set_operation_marker(const std::string& string);
+
+}  // namespace opossum
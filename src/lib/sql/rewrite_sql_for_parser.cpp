@@ -0,0 +1,13 @@
+#include "rewrite_sql_for_parser.hpp"
+
+#include "rewrite_set_operations.hpp"
+#include "rewrite_table_samples.hpp"
+#include "rewrite_window_functions.hpp"
+
+namespace opossum {
+
+std::string rewrite_sql_for_parser(const std::string& sql) {
+  return rewrite_set_operations(rewrite_window_functions(rewrite_table_samples(sql)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+namespace opossum {
+
+/**
+ * Rewrites the syntax that the SQL parser does not know (see rewrite_table_samples(), rewrite_window_functions(), and
+ * rewrite_set_operations()) into syntax that it does know. The result is only meant to be parsed: Statement strings,
+ * cache keys, and error messages use the SQL as the user wrote it.
+ */
+std::string rewrite_sql_for_parser(const std::string& sql);
+
+}  // namespace opossum
@@ -0,0 +1,151 @@
+#include "rewrite_table_samples.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <vector>
+
+#include "sql_tokenizer.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto TABLESAMPLE_INFIX = std::string{" TABLESAMPLE "};
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+// Parses `SYSTEM|BERNOULLI (<percentage>) [REPEATABLE (<seed>)]`, starting at token_idx, which is advanced past the
+// clause. Returns the sample and the clause in the normalized form used inside of table names.
+std::pair<TableSample, std::string> parse_table_sample(const std::vector<SQLToken>& tokens, size_t& token_idx) {
+  const auto token_is = [&](const size_t idx, const SQLTokenType type, const std::string& text = "") {
+    return idx < tokens.size() && tokens[idx].type == type && (text.empty() || tokens[idx].text == text);
+  };
+
+  // Parses `(<number>)` and returns the number as written
+  const auto parse_parenthesized_number = [&](const std::string& context) {
+    AssertInput(token_is(token_idx, SQLTokenType::Symbol, "(") && token_is(token_idx + 1, SQLTokenType::Number) &&
+                    token_is(token_idx + 2, SQLTokenType::Symbol, ")"),
+                "Expected a number in parentheses after " + context);
+    const auto& number = tokens[token_idx + 1].text;
+    token_idx += 3;
+    return number;
+  };
+
+  AssertInput(token_is(token_idx, SQLTokenType::Word, "SYSTEM") || token_is(token_idx, SQLTokenType::Word, "BERNOULLI"),
+              "Expected SYSTEM or BERNOULLI after TABLESAMPLE");
+  const auto& method = tokens[token_idx].text;
+  ++token_idx;
+
+  auto table_sample = TableSample{method == "SYSTEM" ? TableSampleMethod::System : TableSampleMethod::Bernoulli, 0.0,
+                                  std::nullopt};
+
+  const auto percentage = parse_parenthesized_number(method);
+  auto clause = method + " (" + percentage + ")";
+  try {
+    auto parsed_characters = size_t{0};
+    table_sample.percentage = std::stod(percentage, &parsed_characters);
+    AssertInput(parsed_characters == percentage.size(), "Invalid TABLESAMPLE percentage '" + percentage + "'");
+  } catch (const std::logic_error&) {
+    FailInput("Invalid TABLESAMPLE percentage '" + percentage + "'");
+  }
+  AssertInput(table_sample.percentage >= 0.0 && table_sample.percentage <= 100.0,
+              "TABLESAMPLE percentage must be between 0 and 100");
+
+  if (token_is(token_idx, SQLTokenType::Word, "REPEATABLE")) {
+    ++token_idx;
+    const auto seed = parse_parenthesized_number("REPEATABLE");
+    clause += " REPEATABLE (" + seed + ")";
+    AssertInput(std::all_of(seed.begin(), seed.end(), is_digit), "TABLESAMPLE seed must be a non-negative integer");
+    try {
+      table_sample.seed = std::stoull(seed);
+    } catch (const std::out_of_range&) {
+      FailInput("TABLESAMPLE seed '" + seed + "' is out of range");
+    }
+  }
+
+  return {table_sample, clause};
+}
+
+bool is_identifier(const SQLToken& token) {
+  return token.type == SQLTokenType::Word || token.type == SQLTokenType::QuotedIdentifier;
+}
+
+// The name of a table as written in the SQL string, without quotes
+std::string unquoted_name(const std::string& sql, const SQLToken& token) {
+  if (token.type == SQLTokenType::QuotedIdentifier) return sql.substr(token.begin + 1, token.end - token.begin - 2);
+  return sql.substr(token.begin, token.end - token.begin);
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string rewrite_table_samples(const std::string& sql) {
+  const auto tokens = tokenize_sql(sql);
+
+  auto rewritten_sql = std::string{};
+  // Everything before this position has been copied to the rewritten SQL already
+  auto copied_until = size_t{0};
+
+  for (auto token_idx = size_t{0}; token_idx < tokens.size(); ++token_idx) {
+    // The SQLTranslator could not tell a quoted name of the user from a rewritten sample
+    AssertInput(tokens[token_idx].type != SQLTokenType::QuotedIdentifier ||
+                    tokens[token_idx].text.find(TABLESAMPLE_INFIX) == std::string::npos,
+                "Quoted names containing '" + TABLESAMPLE_INFIX + "' are reserved");
+
+    if (tokens[token_idx].type != SQLTokenType::Word || tokens[token_idx].text != "TABLESAMPLE") continue;
+
+    // The sample follows either the table (`FROM t TABLESAMPLE ...`) or its alias (`FROM t [AS] x TABLESAMPLE ...`)
+    const auto tablesample_idx = token_idx;
+    AssertInput(tablesample_idx > 0 && is_identifier(tokens[tablesample_idx - 1]),
+                "TABLESAMPLE has to follow a table name");
+
+    auto table_idx = tablesample_idx - 1;
+    auto alias_idx = std::optional<size_t>{};
+    if (table_idx > 0) {
+      const auto& previous_token = tokens[table_idx - 1];
+      const auto previous_is_table_keyword = previous_token.type == SQLTokenType::Word
+                                                 ? previous_token.text == "FROM" || previous_token.text == "JOIN"
+                                                 : previous_token.text == ",";
+      if (!previous_is_table_keyword) {
+        alias_idx = table_idx;
+        table_idx -= previous_token.type == SQLTokenType::Word && previous_token.text == "AS" ? 2 : 1;
+        AssertInput(table_idx < tokens.size() && is_identifier(tokens[table_idx]),
+                    "TABLESAMPLE is only supported for stored tables");
+      }
+    }
+
+    ++token_idx;
+    const auto clause = parse_table_sample(tokens, token_idx).second;
+    const auto& table_token = tokens[table_idx];
+    const auto& alias_token = alias_idx ? tokens[*alias_idx] : table_token;
+
+    rewritten_sql += sql.substr(copied_until, table_token.begin - copied_until);
+    rewritten_sql += '"' + unquoted_name(sql, table_token) + TABLESAMPLE_INFIX + clause + "\" AS ";
+    rewritten_sql += sql.substr(alias_token.begin, alias_token.end - alias_token.begin);
+    copied_until = tokens[token_idx - 1].end;
+
+    // Continue with the token that follows the clause
+    --token_idx;
+  }
+
+  rewritten_sql += sql.substr(copied_until);
+  return rewritten_sql;
+}
+
+std::pair<std::string, std::optional<TableSample>> split_table_sample(const std::string& table_name) {
+  const auto infix_position = table_name.find(TABLESAMPLE_INFIX);
+  if (infix_position == std::string::npos) return {table_name, std::nullopt};
+
+  const auto clause = table_name.substr(infix_position + TABLESAMPLE_INFIX.size());
+  const auto tokens = tokenize_sql(clause);
+  auto token_idx = size_t{0};
+  const auto table_sample = parse_table_sample(tokens, token_idx).first;
+  AssertInput(token_idx == tokens.size(), "Unexpected input after TABLESAMPLE clause in '" + table_name + "'");
+
+  return {table_name.substr(0, infix_position), table_sample};
+}
+
+}  // namespace opossum
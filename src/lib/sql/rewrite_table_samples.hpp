@@ -0,0 +1,32 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The SQL parser does not know the TABLESAMPLE clause. To support
+ *   SELECT * FROM t AS x TABLESAMPLE BERNOULLI (1) REPEATABLE (42)
+ * the clause is moved into a quoted table name before parsing:
+ *   SELECT * FROM "t TABLESAMPLE BERNOULLI (1) REPEATABLE (42)" AS x
+ * A table without an alias is aliased with its own name, so that qualified column references (`t.a`) still resolve.
+ * The SQLTranslator splits the sample from the table name again (see split_table_sample()). The rewritten SQL is only
+ * parsed; as the sample is part of the original statement string, statements with different samples do not share
+ * cached plans or results.
+ *
+ * Comments, strings, and quoted identifiers are left alone. Quoted names that contain " TABLESAMPLE " would be split
+ * like a rewritten sample, so they are rejected with an InvalidInputException, as are malformed TABLESAMPLE clauses.
+ */
+std::string rewrite_table_samples(const std::string& sql);
+
+/**
+ * Splits a table name produced by rewrite_table_samples() into the name of the stored table and its sample. Names
+ * without a sample are returned as they are.
+ */
+std::pair<std::string, std::optional<TableSample>> split_table_sample(const std::string& table_name);
+
+}  // namespace opossum
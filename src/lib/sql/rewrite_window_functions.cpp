@@ -0,0 +1,298 @@
+#include "rewrite_window_functions.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sql_tokenizer.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Placeholder for the expressions in the rewritten specification
+const auto EXPRESSION_PLACEHOLDER = std::string{"?"};
+const auto WINDOW_FUNCTION_NAME = std::string{"WINDOW_FUNCTION"};
+
+struct ParsedWindowSpecification {
+  // [begin, end) token indices of the expressions
+  std::vector<std::pair<size_t, size_t>> partition_by_expressions;
+  std::vector<std::pair<size_t, size_t>> order_by_expressions;
+
+  WindowSpecification specification;
+};
+
+bool token_is(const std::vector<SQLToken>& tokens, const size_t idx, const SQLTokenType type,
+              const std::string& text) {
+  return idx < tokens.size() && tokens[idx].type == type && tokens[idx].text == text;
+}
+
+bool is_keyword(const std::vector<SQLToken>& tokens, const size_t idx, const std::string& keyword) {
+  return token_is(tokens, idx, SQLTokenType::Word, keyword);
+}
+
+bool is_symbol(const std::vector<SQLToken>& tokens, const size_t idx, const std::string& symbol) {
+  return token_is(tokens, idx, SQLTokenType::Symbol, symbol);
+}
+
+// Returns the index of the parenthesis that closes the one at open_idx
+size_t find_closing_parenthesis(const std::vector<SQLToken>& tokens, const size_t open_idx) {
+  auto depth = size_t{0};
+  for (auto token_idx = open_idx; token_idx < tokens.size(); ++token_idx) {
+    if (is_symbol(tokens, token_idx, "(")) ++depth;
+    if (is_symbol(tokens, token_idx, ")") && --depth == 0) return token_idx;
+  }
+  FailInput("Unbalanced parentheses in OVER clause");
+}
+
+// Returns the index of the parenthesis that opens the one at close_idx
+size_t find_opening_parenthesis(const std::vector<SQLToken>& tokens, const size_t close_idx) {
+  auto depth = size_t{0};
+  for (auto token_idx = close_idx + 1; token_idx > 0; --token_idx) {
+    if (is_symbol(tokens, token_idx - 1, ")")) ++depth;
+    if (is_symbol(tokens, token_idx - 1, "(") && --depth == 0) return token_idx - 1;
+  }
+  FailInput("Unbalanced parentheses before OVER clause");
+}
+
+// Parses a frame bound. The start of the frame has to be before or at the current row, the end has to be at or after
+// the current row. Returns the number of rows between the bound and the current row, std::nullopt for UNBOUNDED.
+std::optional<uint64_t> parse_frame_bound(const std::vector<SQLToken>& tokens, size_t& token_idx, const size_t end_idx,
+                                          const std::string& direction) {
+  if (token_idx + 1 < end_idx && is_keyword(tokens, token_idx, "CURRENT") && is_keyword(tokens, token_idx + 1, "ROW")) {
+    token_idx += 2;
+    return 0;
+  }
+
+  if (token_idx + 1 < end_idx && is_keyword(tokens, token_idx, "UNBOUNDED") &&
+      is_keyword(tokens, token_idx + 1, direction)) {
+    token_idx += 2;
+    return std::nullopt;
+  }
+
+  AssertInput(token_idx + 1 < end_idx && tokens[token_idx].type == SQLTokenType::Number &&
+                  is_keyword(tokens, token_idx + 1, direction),
+              "Expected CURRENT ROW, UNBOUNDED " + direction + ", or <offset> " + direction + " in window frame");
+  const auto& offset = tokens[token_idx].text;
+  token_idx += 2;
+
+  AssertInput(offset.find_first_not_of("0123456789") == std::string::npos,
+              "Window frame offsets must be non-negative integers");
+  try {
+    return std::stoull(offset);
+  } catch (const std::out_of_range&) {
+    FailInput("Window frame offset '" + offset + "' is out of range");
+  }
+}
+
+// Parses the window specification in the tokens [begin_idx, end_idx), i.e., the part in parentheses after OVER
+ParsedWindowSpecification parse_specification(const std::vector<SQLToken>& tokens, const size_t begin_idx,
+                                              const size_t end_idx) {
+  auto parsed_specification = ParsedWindowSpecification{};
+  auto& specification = parsed_specification.specification;
+  auto token_idx = begin_idx;
+
+  // Expressions end at the next comma or keyword of the specification that is not nested in parentheses
+  const auto parse_expression = [&]() {
+    const auto expression_begin_idx = token_idx;
+    auto depth = size_t{0};
+    for (; token_idx < end_idx; ++token_idx) {
+      if (depth == 0 && (is_symbol(tokens, token_idx, ",") || is_keyword(tokens, token_idx, "ORDER") ||
+                         is_keyword(tokens, token_idx, "ROWS") || is_keyword(tokens, token_idx, "RANGE") ||
+                         is_keyword(tokens, token_idx, "GROUPS") ||
+                         is_keyword(tokens, token_idx, "ASC") || is_keyword(tokens, token_idx, "DESC") ||
+                         is_keyword(tokens, token_idx, "NULLS"))) {
+        break;
+      }
+      if (is_symbol(tokens, token_idx, "(")) ++depth;
+      if (is_symbol(tokens, token_idx, ")")) --depth;
+    }
+    AssertInput(token_idx > expression_begin_idx, "Expected an expression in window specification");
+    return std::make_pair(expression_begin_idx, token_idx);
+  };
+
+  if (is_keyword(tokens, token_idx, "PARTITION")) {
+    AssertInput(is_keyword(tokens, token_idx + 1, "BY"), "Expected BY after PARTITION");
+    token_idx += 2;
+    parsed_specification.partition_by_expressions.emplace_back(parse_expression());
+    while (token_idx < end_idx && is_symbol(tokens, token_idx, ",")) {
+      ++token_idx;
+      parsed_specification.partition_by_expressions.emplace_back(parse_expression());
+    }
+  }
+  specification.partition_by_count = parsed_specification.partition_by_expressions.size();
+
+  if (is_keyword(tokens, token_idx, "ORDER")) {
+    AssertInput(is_keyword(tokens, token_idx + 1, "BY"), "Expected BY after ORDER");
+    ++token_idx;
+    do {
+      ++token_idx;
+      parsed_specification.order_by_expressions.emplace_back(parse_expression());
+
+      auto descending = false;
+      if (is_keyword(tokens, token_idx, "ASC") || is_keyword(tokens, token_idx, "DESC")) {
+        descending = tokens[token_idx].text == "DESC";
+        ++token_idx;
+      }
+
+      auto nulls_last = false;
+      if (is_keyword(tokens, token_idx, "NULLS")) {
+        AssertInput(is_keyword(tokens, token_idx + 1, "FIRST") || is_keyword(tokens, token_idx + 1, "LAST"),
+                    "Expected FIRST or LAST after NULLS");
+        nulls_last = tokens[token_idx + 1].text == "LAST";
+        token_idx += 2;
+      }
+
+      if (descending) {
+        specification.order_by_modes.emplace_back(nulls_last ? OrderByMode::DescendingNullsLast
+                                                             : OrderByMode::Descending);
+      } else {
+        specification.order_by_modes.emplace_back(nulls_last ? OrderByMode::AscendingNullsLast
+                                                             : OrderByMode::Ascending);
+      }
+    } while (token_idx < end_idx && is_symbol(tokens, token_idx, ","));
+  }
+
+  if (is_keyword(tokens, token_idx, "ROWS") || is_keyword(tokens, token_idx, "RANGE")) {
+    auto& frame = specification.frame;
+    frame.type = tokens[token_idx].text == "ROWS" ? WindowFrameType::Rows : WindowFrameType::Range;
+    ++token_idx;
+
+    // `ROWS <start>` is short for `ROWS BETWEEN <start> AND CURRENT ROW`
+    if (is_keyword(tokens, token_idx, "BETWEEN")) {
+      ++token_idx;
+      frame.preceding = parse_frame_bound(tokens, token_idx, end_idx, "PRECEDING");
+      AssertInput(is_keyword(tokens, token_idx, "AND"), "Expected AND in window frame");
+      ++token_idx;
+      frame.following = parse_frame_bound(tokens, token_idx, end_idx, "FOLLOWING");
+    } else {
+      frame.preceding = parse_frame_bound(tokens, token_idx, end_idx, "PRECEDING");
+      frame.following = 0;
+    }
+
+    AssertInput(frame.type == WindowFrameType::Rows ||
+                    ((!frame.preceding || *frame.preceding == 0) && (!frame.following || *frame.following == 0)),
+                "RANGE frames only support UNBOUNDED and CURRENT ROW bounds");
+  }
+
+  AssertInput(token_idx == end_idx, "Unexpected input in window specification");
+  return parsed_specification;
+}
+
+std::string frame_bound_to_string(const std::optional<uint64_t>& offset, const std::string& direction) {
+  if (!offset) return "UNBOUNDED " + direction;
+  if (*offset == 0) return "CURRENT ROW";
+  return std::to_string(*offset) + " " + direction;
+}
+
+// The specification with all expressions replaced by the placeholder
+std::string specification_to_string(const WindowSpecification& specification) {
+  auto stream = std::stringstream{};
+  auto separator = "";
+
+  for (auto partition_by_idx = size_t{0}; partition_by_idx < specification.partition_by_count; ++partition_by_idx) {
+    stream << (partition_by_idx == 0 ? "PARTITION BY " : ", ") << EXPRESSION_PLACEHOLDER;
+    separator = " ";
+  }
+
+  for (auto order_by_idx = size_t{0}; order_by_idx < specification.order_by_modes.size(); ++order_by_idx) {
+    stream << (order_by_idx == 0 ? std::string{separator} + "ORDER BY " : ", ") << EXPRESSION_PLACEHOLDER;
+
+    const auto order_by_mode = specification.order_by_modes[order_by_idx];
+    if (order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast) {
+      stream << " DESC";
+    }
+    if (order_by_mode == OrderByMode::AscendingNullsLast || order_by_mode == OrderByMode::DescendingNullsLast) {
+      stream << " NULLS LAST";
+    }
+    separator = " ";
+  }
+
+  const auto& frame = specification.frame;
+  if (!(frame == WindowFrame{})) {
+    stream << separator << (frame.type == WindowFrameType::Rows ? "ROWS" : "RANGE") << " BETWEEN "
+           << frame_bound_to_string(frame.preceding, "PRECEDING") << " AND "
+           << frame_bound_to_string(frame.following, "FOLLOWING");
+  }
+
+  return stream.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string rewrite_window_functions(const std::string& sql) {
+  const auto tokens = tokenize_sql(sql);
+
+  auto rewritten_sql = std::string{};
+  // Everything before this position has been copied to the rewritten SQL already
+  auto copied_until = size_t{0};
+
+  const auto token_text = [&](const size_t begin_idx, const size_t end_idx) {
+    return sql.substr(tokens[begin_idx].begin, tokens[end_idx - 1].end - tokens[begin_idx].begin);
+  };
+
+  // The SQLTranslator could not tell a call of the user from a rewritten window function
+  AssertInput(std::none_of(tokens.begin(), tokens.end(),
+                           [](const auto& token) {
+                             return token.type == SQLTokenType::Word && token.text == WINDOW_FUNCTION_NAME;
+                           }),
+              WINDOW_FUNCTION_NAME + " is reserved");
+
+  for (auto token_idx = size_t{0}; token_idx < tokens.size(); ++token_idx) {
+    // OVER follows the closing parenthesis of the window function's arguments
+    if (!is_keyword(tokens, token_idx, "OVER") || token_idx == 0 || !is_symbol(tokens, token_idx - 1, ")")) continue;
+
+    const auto function_close_idx = token_idx - 1;
+    const auto function_open_idx = find_opening_parenthesis(tokens, function_close_idx);
+    AssertInput(function_open_idx > 0 && tokens[function_open_idx - 1].type == SQLTokenType::Word,
+                "OVER has to follow a function call");
+    const auto function_name_idx = function_open_idx - 1;
+    AssertInput(tokens[function_name_idx].begin >= copied_until, "Window functions cannot be nested");
+
+    AssertInput(is_symbol(tokens, token_idx + 1, "("), "Expected a window specification in parentheses after OVER");
+    const auto specification_close_idx = find_closing_parenthesis(tokens, token_idx + 1);
+    const auto parsed_specification = parse_specification(tokens, token_idx + 2, specification_close_idx);
+
+    rewritten_sql += sql.substr(copied_until, tokens[function_name_idx].begin - copied_until);
+    rewritten_sql += WINDOW_FUNCTION_NAME + "(" + token_text(function_name_idx, function_close_idx + 1) + ", '" +
+                     specification_to_string(parsed_specification.specification) + "'";
+    for (const auto& [begin_idx, end_idx] : parsed_specification.partition_by_expressions) {
+      rewritten_sql += ", " + token_text(begin_idx, end_idx);
+    }
+    for (const auto& [begin_idx, end_idx] : parsed_specification.order_by_expressions) {
+      rewritten_sql += ", " + token_text(begin_idx, end_idx);
+    }
+    rewritten_sql += ")";
+
+    copied_until = tokens[specification_close_idx].end;
+    token_idx = specification_close_idx;
+  }
+
+  rewritten_sql += sql.substr(copied_until);
+  return rewritten_sql;
+}
+
+WindowSpecification parse_window_specification(const std::string& specification) {
+  const auto tokens = tokenize_sql(specification);
+  const auto parsed_specification = parse_specification(tokens, 0, tokens.size());
+
+  const auto is_placeholder = [&](const auto& expression) {
+    return expression.second == expression.first + 1 && is_symbol(tokens, expression.first, EXPRESSION_PLACEHOLDER);
+  };
+  AssertInput(std::all_of(parsed_specification.partition_by_expressions.begin(),
+                          parsed_specification.partition_by_expressions.end(), is_placeholder) &&
+                  std::all_of(parsed_specification.order_by_expressions.begin(),
+                              parsed_specification.order_by_expressions.end(), is_placeholder),
+              "Invalid window specification '" + specification + "'");
+
+  return parsed_specification.specification;
+}
+
+}  // namespace opossum
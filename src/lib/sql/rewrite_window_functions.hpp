@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "expression/window_function_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The SQL parser does not know the OVER clause of window functions. To support
+ *   SELECT SUM(a) OVER (PARTITION BY b ORDER BY c DESC ROWS BETWEEN 2 PRECEDING AND CURRENT ROW) FROM t
+ * each window function is wrapped into a call to the pseudo function WINDOW_FUNCTION() before parsing. Its arguments
+ * are the window function, its specification with all expressions replaced by `?`, and the PARTITION BY and ORDER BY
+ * expressions:
+ *   SELECT WINDOW_FUNCTION(SUM(a), 'PARTITION BY ? ORDER BY ? DESC ROWS BETWEEN 2 PRECEDING AND CURRENT ROW', b, c)
+ *     FROM t
+ * Thus, the parser still parses all expressions and the SQLTranslator resolves them like any other expression. It
+ * reads the specification using parse_window_specification().
+ *
+ * The rewritten SQL is only parsed, statement strings, cache keys, and error messages use the original SQL.
+ *
+ * Comments, strings, and quoted identifiers are left alone. Malformed OVER clauses, named windows (`OVER w`), frames
+ * that are not supported by WindowFrame, and calls of WINDOW_FUNCTION() itself are rejected with an
+ * InvalidInputException.
+ */
+std::string rewrite_window_functions(const std::string& sql);
+
+struct WindowSpecification {
+  size_t partition_by_count{0};
+  std::vector<OrderByMode> order_by_modes;
+  WindowFrame frame;
+};
+
+// Parses the specification passed to WINDOW_FUNCTION() by rewrite_window_functions()
+WindowSpecification parse_window_specification(const std::string& specification);
+
+}  // namespace opossum
@@ -3,38 +3,84 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <cctype>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "rewrite_sql_for_parser.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sql_tokenizer.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+constexpr auto EXPLAIN_ANALYZE_PREFIX = std::string_view{"EXPLAIN ANALYZE"};
+
+// Returns the end of each of the @param statement_count statements in @param sql, i.e., the end of the semicolon that
+// terminates it or, for the last statement, the end of its last token. Semicolons in strings and comments are skipped.
+std::vector<size_t> find_statement_ends(const std::string& sql, const size_t statement_count) {
+  const auto tokens = opossum::tokenize_sql(sql);
+
+  auto statement_ends = std::vector<size_t>{};
+  statement_ends.reserve(statement_count);
+
+  for (const auto& token : tokens) {
+    if (statement_ends.size() + 1 == statement_count) break;
+    if (token.type == opossum::SQLTokenType::Symbol && token.text == ";") statement_ends.emplace_back(token.end);
+  }
+  statement_ends.emplace_back(tokens.empty() ? sql.size() : tokens.back().end);
+
+  return statement_ends;
+}
+
+}  // namespace
+
 namespace opossum {
 
-SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
-                         const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
-    : _sql(sql), _transaction_context(transaction_context), _optimizer(optimizer) {
+SQLPipeline::SQLPipeline(const std::string& sql, const SQLPipelineOptions& options)
+    : _sql(sql), _transaction_context(options.transaction_context), _optimizer(options.optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
-  DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
+  DebugAssert(!_transaction_context || options.use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
 
+  // The SQL parser does not know EXPLAIN ANALYZE, so the prefix is removed before parsing
+  auto statement_options = options;
+  auto statements_sql = sql;
+  const auto trimmed_sql = boost::trim_left_copy(sql);
+  if (boost::istarts_with(trimmed_sql, EXPLAIN_ANALYZE_PREFIX) && trimmed_sql.size() > EXPLAIN_ANALYZE_PREFIX.size() &&
+      std::isspace(trimmed_sql[EXPLAIN_ANALYZE_PREFIX.size()])) {
+    statement_options.explain_analyze = ExplainAnalyze::Yes;
+    statements_sql = trimmed_sql.substr(EXPLAIN_ANALYZE_PREFIX.size());
+  }
+
+  // Neither does it know TABLESAMPLE, OVER clauses, or which set operation was used. The rewritten SQL is only parsed,
+  // the statements keep their original text.
+  const auto parsed_sql = rewrite_sql_for_parser(statements_sql);
+
   hsql::SQLParserResult parse_result;
 
   const auto start = std::chrono::high_resolution_clock::now();
-  hsql::SQLParser::parse(sql, &parse_result);
+  hsql::SQLParser::parse(parsed_sql, &parse_result);
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics.parse_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - start);
   DTRACE_PROBE2(HYRISE, SQL_PARSING, sql.c_str(), _metrics.parse_time_nanos.count());
 
-  AssertInput(parse_result.isValid(), create_sql_parser_error_message(sql, parse_result));
+  AssertInput(parse_result.isValid(), create_sql_parser_error_message(statements_sql, parsed_sql, parse_result));
   DebugAssert(parse_result.size() > 0, "Cannot create empty SQLPipeline.");
+  AssertInput(statement_options.explain_analyze == ExplainAnalyze::No || parse_result.size() == 1,
+              "EXPLAIN ANALYZE is only supported for a single statement");
 
   _sql_pipeline_statements.reserve(parse_result.size());
+  _alters_structure.reserve(parse_result.size());
 
   std::vector<std::shared_ptr<hsql::SQLParserResult>> parsed_statements;
   for (auto* statement : parse_result.releaseStatements()) {
@@ -45,8 +91,11 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
   // We want to split the (multi-) statement SQL string into the strings for each statement. We can then use those
   // statement strings to cache query plans.
-  // The sql parser only offers us the length of the string, so we need to split it manually.
-  auto sql_string_offset = 0u;
+  // The sql parser only offers us the length of the rewritten statements, so we split the original string at the
+  // semicolons that separate the statements.
+  const auto statement_ends = find_statement_ends(statements_sql, parsed_statements.size());
+  auto statement_idx = size_t{0};
+  auto sql_string_offset = size_t{0};
 
   for (auto& parsed_statement : parsed_statements) {
     parsed_statement->setIsValid(true);
@@ -62,20 +111,26 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
       case hsql::StatementType::kStmtAlter:
       case hsql::StatementType::kStmtRename: {
         seen_altering_statement = true;
+        _alters_structure.emplace_back(true);
         break;
       }
-      default: { /* do nothing */
+      case hsql::StatementType::kStmtPrepare: {
+        _alters_structure.emplace_back(true);
+        break;
+      }
+      default: {
+        _alters_structure.emplace_back(false);
       }
     }
 
     // Get the statement string from the original query string, so we can pass it to the SQLPipelineStatement
-    const auto statement_string_length = statement->stringLength;
-    const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
-    sql_string_offset += statement_string_length;
+    const auto statement_end = statement_ends[statement_idx++];
+    const auto statement_string =
+        boost::trim_copy(statements_sql.substr(sql_string_offset, statement_end - sql_string_offset));
+    sql_string_offset = statement_end;
 
     auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), statement_options);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -198,9 +253,42 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   _result_tables.reserve(_sql_pipeline_statements.size());
 
-  for (auto& pipeline_statement : _sql_pipeline_statements) {
-    pipeline_statement->get_result_table();
+  // The translation and optimization of the next statement, which overlaps with the execution of the current one. An
+  // exception thrown by it is rethrown once the next statement is executed, as it would have been without the overlap.
+  auto next_statement_preparation = std::vector<std::shared_ptr<JobTask>>{};
+  auto next_statement_exception = std::make_shared<std::exception_ptr>();
+
+  for (auto statement_id = size_t{0}; statement_id < statement_count(); ++statement_id) {
+    const auto& pipeline_statement = _sql_pipeline_statements[statement_id];
+
+    if (!next_statement_preparation.empty()) {
+      CurrentScheduler::wait_for_tasks(next_statement_preparation);
+      next_statement_preparation.clear();
+      if (*next_statement_exception) std::rethrow_exception(*next_statement_exception);
+    }
+
+    if (statement_id + 1 < statement_count() && !_alters_structure[statement_id]) {
+      const auto next_statement = _sql_pipeline_statements[statement_id + 1];
+      next_statement_preparation.emplace_back(std::make_shared<JobTask>([next_statement, next_statement_exception]() {
+        try {
+          next_statement->get_optimized_logical_plan();
+        } catch (...) {
+          *next_statement_exception = std::current_exception();
+        }
+      }));
+      CurrentScheduler::schedule_tasks(next_statement_preparation);
+    }
+
+    // The next statement must not be modified by the preparation once this method has returned
+    try {
+      pipeline_statement->get_result_table();
+    } catch (...) {
+      CurrentScheduler::wait_for_tasks(next_statement_preparation);
+      throw;
+    }
+
     if (_transaction_context && _transaction_context->aborted()) {
+      CurrentScheduler::wait_for_tasks(next_statement_preparation);
       _failed_pipeline_statement = pipeline_statement;
       _result_tables.clear();
       return _result_tables;
@@ -240,6 +328,8 @@ std::string SQLPipelineMetrics::to_string() const {
   auto total_optimize_nanos = std::chrono::nanoseconds::zero();
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
+  auto total_admission_wait_nanos = std::chrono::nanoseconds::zero();
+  auto peak_memory_bytes = size_t{0};
   std::vector<bool> query_plan_cache_hits;
 
   for (const auto& statement_metric : statement_metrics) {
@@ -247,6 +337,8 @@ std::string SQLPipelineMetrics::to_string() const {
     total_optimize_nanos += statement_metric->optimization_duration;
     total_lqp_translate_nanos += statement_metric->lqp_translation_duration;
     total_execute_nanos += statement_metric->plan_execution_duration;
+    total_admission_wait_nanos += statement_metric->admission_wait_duration;
+    peak_memory_bytes = std::max(peak_memory_bytes, statement_metric->peak_memory_bytes);
 
     query_plan_cache_hits.push_back(statement_metric->query_plan_cache_hit);
   }
@@ -259,7 +351,9 @@ std::string SQLPipelineMetrics::to_string() const {
   info_string << "SQL TRANSLATE: " << format_duration(total_sql_translate_nanos) << ", ";
   info_string << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
-  info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
+  info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time), ";
+  info_string << "ADMISSION WAIT: " << format_duration(total_admission_wait_nanos) << " | ";
+  info_string << "PEAK MEMORY: " << format_bytes(peak_memory_bytes) << " | ";
   info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
   info_string << "]\n";
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -29,13 +30,21 @@ struct SQLPipelineMetrics {
  *
  * The SQLPipeline splits a given SQL string into its single SQL statements and wraps each statement in an
  * SQLPipelineStatement.
+ *
+ * A single statement can be prefixed with EXPLAIN ANALYZE. It is executed as usual, but its result table lists the
+ * performance data of its operators (see ExplainAnalyze in SQLPipelineStatement). As the SQL parser does not know
+ * EXPLAIN ANALYZE, the prefix is removed before the statement is parsed.
+ *
+ * get_result_tables() executes the statements one after another. While a statement is executed, the next one is
+ * translated and optimized by a JobTask, unless the executed statement alters the structure of the database (e.g.,
+ * CREATE VIEW) or prepares a statement, which the next statement might depend on. This hides the translation costs of
+ * batches with many statements. The physical plan of the next statement is only created once the executed statement
+ * has completed, as it might need a new transaction context that sees the changes of the executed statement.
  */
 class SQLPipeline : public Noncopyable {
  public:
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
-  SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
-              const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const CleanupTemporaries cleanup_temporaries);
+  SQLPipeline(const std::string& sql, const SQLPipelineOptions& options);
 
   // Returns the original SQL string
   const std::string get_sql() const;
@@ -104,6 +113,11 @@ class SQLPipeline : public Noncopyable {
   // --> requires execution of first statement before the second one can be translated
   bool _requires_execution{false};
 
+  // Indicates for each statement whether the translation of the following statements might depend on its execution,
+  // see _requires_execution. Unlike for _requires_execution, PREPARE statements are included, as EXECUTE statements
+  // need the prepared plan.
+  std::vector<bool> _alters_structure;
+
   SQLPipelineMetrics _metrics{};
 
   std::shared_ptr<SQLPipelineStatement> _failed_pipeline_statement;
@@ -6,24 +6,24 @@ namespace opossum {
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql) : _sql(sql) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
-  _use_mvcc = use_mvcc;
+  _options.use_mvcc = use_mvcc;
   return *this;
 }
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_translator(const std::shared_ptr<LQPTranslator>& lqp_translator) {
-  _lqp_translator = lqp_translator;
+  _options.lqp_translator = lqp_translator;
   return *this;
 }
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_optimizer(const std::shared_ptr<Optimizer>& optimizer) {
-  _optimizer = optimizer;
+  _options.optimizer = optimizer;
   return *this;
 }
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
     const std::shared_ptr<TransactionContext>& transaction_context) {
-  _transaction_context = transaction_context;
-  _use_mvcc = UseMvcc::Yes;
+  _options.transaction_context = transaction_context;
+  _options.use_mvcc = UseMvcc::Yes;
 
   return *this;
 }
@@ -31,15 +31,54 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
-  _cleanup_temporaries = CleanupTemporaries::No;
+  _options.cleanup_temporaries = CleanupTemporaries::No;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelined_execution() {
+  _options.fuse_pipelines = FusePipelines::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_parameterized_plan_caching() {
+  _options.parameterize_literals = ParameterizeLiterals::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_adaptive_reoptimization() {
+  _options.adaptive_reoptimization = AdaptiveReoptimization::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_subplan_result_caching() {
+  _cache_subplan_results = CacheSubplanResults::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_query_result_caching() {
+  _options.cache_query_results = CacheQueryResults::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_budget(const size_t bytes) {
+  _options.memory_budget_bytes = bytes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_priority(const SchedulePriority priority) {
+  _options.priority = priority;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_cancellation_token(
+    const std::shared_ptr<CancellationToken>& cancellation_token) {
+  _options.cancellation_token = cancellation_token;
   return *this;
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
-  auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
-  auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries);
+  auto pipeline = SQLPipeline(_sql, _options_with_defaults());
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -47,11 +86,14 @@ SQLPipeline SQLPipelineBuilder::create_pipeline() const {
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
-  auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
-  auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
+  return {_sql, std::move(parsed_sql), _options_with_defaults()};
+}
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator,
-          optimizer, _cleanup_temporaries};
+SQLPipelineOptions SQLPipelineBuilder::_options_with_defaults() const {
+  auto options = _options;
+  if (!options.lqp_translator) options.lqp_translator = std::make_shared<LQPTranslator>(_cache_subplan_results);
+  if (!options.optimizer) options.optimizer = Optimizer::create_default_optimizer();
+  return options;
 }
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -28,8 +29,11 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - No pipelined execution
+ *  - Plans are cached under the exact SQL string
+ *  - Results of subplans are not cached
  *
- * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
+ * Favour this interface over calling the SQLPipeline[Statement] constructors with SQLPipelineOptions directly.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
  * SQLPipelineStatement for single statement queries.
  */
@@ -52,6 +56,55 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Fuse chains of non-blocking operators (e.g., Validate, TableScan, Projection) so that each chunk passes through
+   * the whole chain within one task, see AbstractChunkwiseOperator
+   */
+  SQLPipelineBuilder& with_pipelined_execution();
+
+  /*
+   * Replace the literals in WHERE, HAVING, VALUES, and SET clauses with parameters, so that statements that only
+   * differ in these literals share their cached plans, see normalize_sql_literals()
+   */
+  SQLPipelineBuilder& with_parameterized_plan_caching();
+
+  /*
+   * Execute the joins of SELECT statements one at a time and re-optimize the join order of the remaining plan if the
+   * actual cardinality of a join deviates too much from the estimated one, see SQLPipelineStatement
+   */
+  SQLPipelineBuilder& with_adaptive_reoptimization();
+
+  /*
+   * Limit the memory of each statement to @param bytes. Sort, Aggregate, and JoinHash spill their intermediate results
+   * to disk if they would exceed it, see MemoryBudget. The AdmissionController only admits the statements once the
+   * limit fits into the global budget.
+   */
+  SQLPipelineBuilder& with_memory_budget(const size_t bytes);
+
+  /*
+   * Reuse the results of uncorrelated subqueries and small aggregates across statements as long as the tables they
+   * read are not modified, see SubplanResultCache. Has no effect if a custom LQPTranslator is used.
+   */
+  SQLPipelineBuilder& with_subplan_result_caching();
+
+  /*
+   * Return the results of earlier executions of read-only statements with the same SQL (and, with parameterized plan
+   * caching, the same literal values) as long as the tables they read are not modified, see QueryResultCache
+   */
+  SQLPipelineBuilder& with_query_result_caching();
+
+  /*
+   * Schedule the tasks of the statements with @param priority. High priority tasks are preferred by the Workers, e.g.,
+   * to keep the latency of short transactional queries low while long analytical queries are running, see TaskQueue.
+   */
+  SQLPipelineBuilder& with_priority(const SchedulePriority priority);
+
+  /*
+   * Stop the execution of the statements once @param cancellation_token is cancelled or its timeout passed. The
+   * cancelled statement rolls back its transaction and throws a QueryCancelledException, see CancellationToken.
+   */
+  SQLPipelineBuilder& with_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token);
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -61,13 +114,14 @@ class SQLPipelineBuilder final {
   SQLPipelineStatement create_pipeline_statement(std::shared_ptr<hsql::SQLParserResult> parsed_sql = nullptr) const;
 
  private:
+  // Fills in the default LQPTranslator and Optimizer unless custom ones were set
+  SQLPipelineOptions _options_with_defaults() const;
+
   const std::string _sql;
 
-  UseMvcc _use_mvcc{UseMvcc::Yes};
-  std::shared_ptr<TransactionContext> _transaction_context;
-  std::shared_ptr<LQPTranslator> _lqp_translator;
-  std::shared_ptr<Optimizer> _optimizer;
-  CleanupTemporaries _cleanup_temporaries{true};
+  SQLPipelineOptions _options;
+  // Only used for the default LQPTranslator
+  CacheSubplanResults _cache_subplan_results{CacheSubplanResults::No};
 };
 
 }  // namespace opossum
@@ -2,46 +2,78 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <iomanip>
+#include <unordered_map>
 #include <utility>
 
 #include "SQLParser.h"
+#include "cache/query_result_cache.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "create_sql_parser_error_message.hpp"
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "cost_model/cost_model_logical.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "operators/operator_performance_data.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "resolve_type.hpp"
+#include "rewrite_sql_for_parser.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/operator_task_graph.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/prepared_plan.hpp"
 #include "utils/assert.hpp"
+#include "utils/execution_hooks.hpp"
+#include "utils/invalid_input_exception.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                                           const UseMvcc use_mvcc,
-                                           const std::shared_ptr<TransactionContext>& transaction_context,
-                                           const std::shared_ptr<LQPTranslator>& lqp_translator,
-                                           const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const SQLPipelineOptions& options)
     : _sql_string(sql),
-      _use_mvcc(use_mvcc),
-      _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
-      _transaction_context(transaction_context),
-      _lqp_translator(lqp_translator),
-      _optimizer(optimizer),
+      _use_mvcc(options.use_mvcc),
+      _auto_commit(_use_mvcc == UseMvcc::Yes && !options.transaction_context),
+      _transaction_context(options.transaction_context),
+      _lqp_translator(options.lqp_translator),
+      _optimizer(options.optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(options.cleanup_temporaries),
+      _fuse_pipelines(options.fuse_pipelines),
+      _adaptive_reoptimization(options.adaptive_reoptimization),
+      _memory_budget(std::make_shared<MemoryBudget>(options.memory_budget_bytes.value_or(MemoryBudget::UNLIMITED))),
+      _explain_analyze(options.explain_analyze),
+      _priority(options.priority),
+      _plan_cache_key(sql),
+      _cache_query_results(options.cache_query_results),
+      _cancellation_token(options.cancellation_token) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
-  DebugAssert(!_transaction_context || transaction_context->phase() == TransactionPhase::Active,
+  DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
-  DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
+  DebugAssert(!_transaction_context || _use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
+  DebugAssert(_lqp_translator && _optimizer, "SQLPipelineStatement needs an LQPTranslator and an Optimizer");
+
+  if (options.parameterize_literals == ParameterizeLiterals::Yes) {
+    _normalized_sql = normalize_sql_literals(_sql_string);
+    if (_normalized_sql) _plan_cache_key = _normalized_sql->cache_key();
+  }
+
+  // Determined before the translation, which might fall back to the original SQL string
+  if (_cache_query_results == CacheQueryResults::Yes) {
+    _query_result_cache_key = QueryResultCache::key(_sql_string, _normalized_sql);
+  }
 }
 
 const std::string& SQLPipelineStatement::get_sql_string() { return _sql_string; }
@@ -55,9 +87,11 @@ const std::shared_ptr<hsql::SQLParserResult>& SQLPipelineStatement::get_parsed_s
 
   _parsed_sql_statement = std::make_shared<hsql::SQLParserResult>();
 
-  hsql::SQLParser::parse(_sql_string, _parsed_sql_statement.get());
+  const auto parsed_sql = rewrite_sql_for_parser(_sql_string);
+  hsql::SQLParser::parse(parsed_sql, _parsed_sql_statement.get());
 
-  AssertInput(_parsed_sql_statement->isValid(), create_sql_parser_error_message(_sql_string, *_parsed_sql_statement));
+  AssertInput(_parsed_sql_statement->isValid(),
+              create_sql_parser_error_message(_sql_string, parsed_sql, *_parsed_sql_statement));
 
   Assert(_parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one statement. "
@@ -71,17 +105,27 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_unoptimized_lo
     return _unoptimized_logical_plan;
   }
 
-  auto parsed_sql = get_parsed_sql_statement();
-
   const auto started = std::chrono::high_resolution_clock::now();
 
-  SQLTranslator sql_translator{_use_mvcc};
+  if (_normalized_sql) {
+    _unoptimized_logical_plan = _translate_normalized_sql();
+    if (!_unoptimized_logical_plan) {
+      _normalized_sql.reset();
+      _plan_cache_key = _sql_string;
+    }
+  }
+
+  if (!_unoptimized_logical_plan) {
+    auto parsed_sql = get_parsed_sql_statement();
 
-  std::vector<std::shared_ptr<AbstractLQPNode>> lqp_roots;
-  lqp_roots = sql_translator.translate_parser_result(*parsed_sql);
+    SQLTranslator sql_translator{_use_mvcc};
 
-  DebugAssert(lqp_roots.size() == 1, "LQP translation returned no or more than one LQP root for a single statement.");
-  _unoptimized_logical_plan = lqp_roots.front();
+    std::vector<std::shared_ptr<AbstractLQPNode>> lqp_roots;
+    lqp_roots = sql_translator.translate_parser_result(*parsed_sql);
+
+    DebugAssert(lqp_roots.size() == 1, "LQP translation returned no or more than one LQP root for a single statement.");
+    _unoptimized_logical_plan = lqp_roots.front();
+  }
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->sql_translation_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
@@ -95,21 +139,17 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   }
 
   // Handle logical query plan if statement has been cached
-  if (const auto cached_plan = SQLLogicalPlanCache::get().try_get(_sql_string)) {
-    const auto plan = *cached_plan;
-    DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
-    // MVCC-enabled and MVCC-disabled LQPs will evict each other
-    if (lqp_is_validated(plan) == (_use_mvcc == UseMvcc::Yes)) {
-      _optimized_logical_plan = plan;
-      return _optimized_logical_plan;
-    }
-  }
+  if (_use_cached_optimized_logical_plan()) return _optimized_logical_plan;
 
+  const auto is_normalized = static_cast<bool>(_normalized_sql);
   const auto& unoptimized_lqp = get_unoptimized_logical_plan();
 
+  // If the statement fell back to the original SQL string, its plan might have been cached under that string
+  if (is_normalized && !_normalized_sql && _use_cached_optimized_logical_plan()) return _optimized_logical_plan;
+
   const auto started = std::chrono::high_resolution_clock::now();
 
-  _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp);
+  _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp, &_metrics->optimizer_rule_metrics);
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->optimization_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
@@ -120,7 +160,7 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   _unoptimized_logical_plan = nullptr;
 
   // Cache newly created plan for the according sql statement
-  SQLLogicalPlanCache::get().set(_sql_string, _optimized_logical_plan);
+  SQLLogicalPlanCache::get().set(_plan_cache_key, _optimized_logical_plan);
 
   return _optimized_logical_plan;
 }
@@ -139,14 +179,36 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
-  if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string)) {
+  auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_plan_cache_key);
+  if (!cached_physical_plan && _normalized_sql) {
+    // Translating the normalized SQL might fail. In that case, the statement falls back to the original SQL string,
+    // whose plan might have been cached.
+    get_optimized_logical_plan();
+    if (!_normalized_sql) cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_plan_cache_key);
+  }
+
+  if (cached_physical_plan) {
     if ((*cached_physical_plan)->transaction_context_is_set()) {
       Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
     } else {
       Assert(_use_mvcc == UseMvcc::No, "Trying to use non-MVCC cached query with a transaction context.");
     }
 
-    _physical_plan = (*cached_physical_plan)->deep_copy();
+    // The copies of a cached plan are created from its task graph, which is built when the plan is taken from the
+    // cache for the first time (see OperatorTaskGraph)
+    auto task_graph = (*cached_physical_plan)->task_graph();
+    if (!task_graph) {
+      task_graph = std::make_shared<OperatorTaskGraph>(*cached_physical_plan, _fuse_pipelines);
+      (*cached_physical_plan)->set_task_graph(task_graph);
+    }
+
+    if (task_graph->fuse_pipelines() == _fuse_pipelines) {
+      auto instance = task_graph->instantiate(_cleanup_temporaries, _priority);
+      _physical_plan = std::move(instance.root);
+      _cached_plan_tasks = std::move(instance.tasks);
+    } else {
+      _physical_plan = (*cached_physical_plan)->deep_copy();
+    }
     _metrics->query_plan_cache_hit = true;
 
   } else {
@@ -160,11 +222,11 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   done = std::chrono::high_resolution_clock::now();
 
-  if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+  _prepare_physical_plan(_physical_plan);
 
   // Cache newly created plan for the according sql statement (only if not already cached)
   if (!_metrics->query_plan_cache_hit) {
-    SQLPhysicalPlanCache::get().set(_sql_string, _physical_plan);
+    SQLPhysicalPlanCache::get().set(_plan_cache_key, _physical_plan);
   }
 
   _metrics->lqp_translation_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
@@ -177,7 +239,15 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
     return _tasks;
   }
 
-  _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan(), _cleanup_temporaries);
+  const auto& physical_plan = get_physical_plan();
+
+  // The tasks of a cached plan's copy are not used if the plan was replaced, see _execute_joins_adaptively()
+  if (!_cached_plan_tasks.empty() && _cached_plan_tasks.back()->get_operator() == physical_plan) {
+    _tasks = std::move(_cached_plan_tasks);
+  } else {
+    _tasks = OperatorTask::make_tasks_from_operator(physical_plan, _cleanup_temporaries, _fuse_pipelines, _priority);
+  }
+  _cached_plan_tasks.clear();
   return _tasks;
 }
 
@@ -186,24 +256,68 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
+  if (_use_cached_query_result()) return _result_table;
+
+  ExecutionHooks::get().statement_started.fire(_sql_string);
+
+  // The statement may have to wait until other statements have finished, see AdmissionController
+  const auto admission_started = std::chrono::high_resolution_clock::now();
+  const auto admission = AdmissionController::get().admit(_memory_budget);
+  _metrics->admission_wait_duration = std::chrono::high_resolution_clock::now() - admission_started;
+
+  // The statement might have been cancelled or timed out while it was waiting
+  _throw_if_cancelled();
+
+  // Joins executed adaptively are included in the execution duration
+  auto adaptive_execution_duration = std::chrono::nanoseconds{0};
+  if (_adaptive_reoptimization == AdaptiveReoptimization::Yes && _tasks.empty() &&
+      lqp_find_modified_tables(get_optimized_logical_plan()).empty()) {
+    const auto adaptive_execution_started = std::chrono::high_resolution_clock::now();
+    _execute_joins_adaptively();
+    adaptive_execution_duration = std::chrono::high_resolution_clock::now() - adaptive_execution_started;
+  }
+
   const auto& tasks = get_tasks();
 
+  // A transaction that modified data itself might see its own uncommitted changes, which must not be cached
+  const auto cache_result = _cache_query_results == CacheQueryResults::Yes && _explain_analyze == ExplainAnalyze::No &&
+                            _transaction_context && !_transaction_context->has_read_write_operators();
+
   const auto started = std::chrono::high_resolution_clock::now();
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
 
+  // The operators of a cancelled statement stop early, so that their outputs are incomplete
+  _throw_if_cancelled();
+
   if (_auto_commit) {
     _transaction_context->commit();
   }
 
   const auto done = std::chrono::high_resolution_clock::now();
-  _metrics->plan_execution_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  _metrics->plan_execution_duration =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(done - started) + adaptive_execution_duration;
+  _metrics->peak_memory_bytes = _memory_budget->peak_bytes();
+  if (HardwareCounters::is_enabled()) _metrics->hardware_counters = sum_hardware_counters(_physical_plan);
+
+  ExecutionHooks::get().statement_finished.fire(_sql_string, tasks.back()->get_operator(), *_metrics);
 
   // Get output from the last task
-  _result_table = tasks.back()->get_operator()->get_output();
-  if (_result_table == nullptr) _query_has_output = false;
+  if (_explain_analyze == ExplainAnalyze::Yes) {
+    _result_table = create_operator_performance_table(tasks.back()->get_operator());
+  } else {
+    _result_table = tasks.back()->get_operator()->get_output();
+    if (_result_table == nullptr) _query_has_output = false;
+  }
+
+  // The result might keep the arena alive, which is thus charged to the cache as well
+  if (cache_result && _result_table) {
+    const auto result_bytes = std::max(_result_table->estimate_memory_usage(), _arena ? _arena->allocated_bytes() : 0);
+    QueryResultCache::get().set(_query_result_cache_key, get_optimized_logical_plan(),
+                                _transaction_context->snapshot_commit_id(), _result_table, result_bytes);
+  }
 
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translation_duration.count(),
                 _metrics->optimization_duration.count(), _metrics->lqp_translation_duration.count(),
@@ -217,4 +331,188 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+const std::shared_ptr<MemoryBudget>& SQLPipelineStatement::memory_budget() const { return _memory_budget; }
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_translate_normalized_sql() const {
+  // Invalid input is reported for the original SQL string, which the caller falls back to
+  auto rewritten_sql = std::string{};
+  try {
+    rewritten_sql = rewrite_sql_for_parser(_normalized_sql->sql);
+  } catch (const InvalidInputException&) {
+    return nullptr;
+  }
+
+  auto parsed_sql = hsql::SQLParserResult{};
+  hsql::SQLParser::parse(rewritten_sql, &parsed_sql);
+  if (!parsed_sql.isValid() || parsed_sql.size() != 1) return nullptr;
+
+  // Only these statements are executed through an LQP that does not store the literals, e.g., in a view
+  switch (parsed_sql.getStatement(0)->type()) {
+    case hsql::kStmtSelect:
+    case hsql::kStmtInsert:
+    case hsql::kStmtUpdate:
+    case hsql::kStmtDelete:
+      break;
+    default:
+      return nullptr;
+  }
+
+  try {
+    SQLTranslator sql_translator{_use_mvcc};
+    const auto lqp_roots = sql_translator.translate_parser_result(parsed_sql);
+    const auto parameter_ids = sql_translator.parameter_ids_of_value_placeholders();
+    if (lqp_roots.size() != 1 || parameter_ids.size() != _normalized_sql->literal_values.size()) return nullptr;
+
+    // Unlike PlaceholderExpressions, CorrelatedParameterExpressions are typed and can be set in the PQP
+    auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+    parameters.reserve(parameter_ids.size());
+    for (auto literal_idx = size_t{0}; literal_idx < parameter_ids.size(); ++literal_idx) {
+      const auto data_type = data_type_from_all_type_variant(_normalized_sql->literal_values[literal_idx]);
+      parameters.emplace_back(std::make_shared<CorrelatedParameterExpression>(
+          literal_parameter_id(literal_idx),
+          CorrelatedParameterExpression::ReferencedExpressionInfo{data_type, "literal"}));
+    }
+
+    return PreparedPlan{lqp_roots.front(), parameter_ids}.instantiate(parameters);
+  } catch (const std::exception&) {
+    // Some parts of the translation require actual values (e.g., the number of an INTERVAL)
+    return nullptr;
+  }
+}
+
+void SQLPipelineStatement::_prepare_physical_plan(const std::shared_ptr<AbstractOperator>& physical_plan) {
+  if (_normalized_sql) {
+    auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+    for (auto literal_idx = size_t{0}; literal_idx < _normalized_sql->literal_values.size(); ++literal_idx) {
+      parameters.emplace(literal_parameter_id(literal_idx), _normalized_sql->literal_values[literal_idx]);
+    }
+    physical_plan->set_parameters(parameters);
+  }
+
+  if (_use_mvcc == UseMvcc::Yes) physical_plan->set_transaction_context_recursively(_transaction_context);
+
+  if (!_arena) _arena = std::make_shared<ArenaMemoryResource>(_memory_budget);
+  physical_plan->set_arena_recursively(_arena);
+
+  if (_cancellation_token) physical_plan->set_cancellation_token_recursively(_cancellation_token);
+}
+
+void SQLPipelineStatement::_throw_if_cancelled() {
+  const auto transaction_cancelled = _transaction_context && _transaction_context->cancellation_token().is_cancelled();
+  if (!transaction_cancelled && !(_cancellation_token && _cancellation_token->is_cancelled())) return;
+
+  if (_transaction_context) _transaction_context->rollback();
+
+  if (_cancellation_token) _cancellation_token->throw_if_cancelled();
+  _transaction_context->cancellation_token().throw_if_cancelled();
+}
+
+bool SQLPipelineStatement::_use_cached_query_result() {
+  if (_cache_query_results == CacheQueryResults::No || _explain_analyze == ExplainAnalyze::Yes ||
+      _use_mvcc == UseMvcc::No) {
+    return false;
+  }
+
+  if (!_transaction_context) _transaction_context = TransactionManager::get().new_transaction_context();
+  if (_transaction_context->has_read_write_operators()) return false;
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  const auto cached_result =
+      QueryResultCache::get().try_get(_query_result_cache_key, _transaction_context->snapshot_commit_id());
+  if (!cached_result) return false;
+
+  _result_table = cached_result;
+  _metrics->query_result_cache_hit = true;
+
+  if (_auto_commit) {
+    _transaction_context->commit();
+  }
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->plan_execution_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  return true;
+}
+
+void SQLPipelineStatement::_execute_joins_adaptively() {
+  const auto contains_join = [](const auto& lqp) {
+    auto found_join = false;
+    if (!lqp) return found_join;
+    visit_lqp(lqp, [&](const auto& node) {
+      found_join |= node->type == LQPNodeType::Join;
+      return found_join ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+    });
+    return found_join;
+  };
+
+  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
+    _transaction_context = TransactionManager::get().new_transaction_context();
+  }
+
+  // The optimized LQP might be cached, so the executed subplans are replaced in a copy
+  auto lqp = get_optimized_logical_plan()->deep_copy();
+
+  // All other rules have already been applied to the LQP and are not affected by the actual row counts
+  auto reoptimizer = Optimizer{};
+  reoptimizer.add_rule(std::make_unique<JoinOrderingRule>(std::make_shared<CostModelLogical>()));
+
+  while (true) {
+    // A new translator is needed for each version of the LQP, as it caches the operator of each node
+    const auto lqp_translator = LQPTranslator{};
+    _physical_plan = lqp_translator.translate_node(lqp);
+    _prepare_physical_plan(_physical_plan);
+
+    // Find a join without joins below it. If it is the root, the remaining plan can be executed as a whole.
+    auto join_node = std::shared_ptr<AbstractLQPNode>{};
+    visit_lqp(lqp, [&](const auto& node) {
+      if (join_node) return LQPVisitation::DoNotVisitInputs;
+      if (node->type != LQPNodeType::Join) return LQPVisitation::VisitInputs;
+      if (!contains_join(node->left_input()) && !contains_join(node->right_input())) join_node = node;
+      return LQPVisitation::VisitInputs;
+    });
+    if (!join_node || join_node == lqp) return;
+
+    const auto join_operator = lqp_translator.translate_node(join_node);
+    if (_cancellation_token) join_operator->set_cancellation_token_recursively(_cancellation_token);
+    CurrentScheduler::schedule_and_wait_for_tasks(
+        OperatorTask::make_tasks_from_operator(join_operator, _cleanup_temporaries, _fuse_pipelines, _priority));
+
+    // The transaction was aborted or the statement cancelled, the remaining operators will not be executed either
+    if (!join_operator->get_output() || join_operator->is_cancelled()) return;
+
+    const auto estimated_statistics = join_node->get_statistics();
+    const auto estimated_row_count = std::max(estimated_statistics->row_count(), 1.0f);
+    const auto actual_row_count = static_cast<float>(*join_operator->performance_data().output_row_count);
+
+    const auto intermediate_result_node = IntermediateResultNode::make(
+        join_node, join_operator->get_output(),
+        std::make_shared<TableStatistics>(TableType::References, actual_row_count,
+                                          estimated_statistics->column_statistics()));
+    const auto outputs = join_node->outputs();
+    const auto input_sides = join_node->get_input_sides();
+    for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+      outputs[output_idx]->set_input(input_sides[output_idx], intermediate_result_node);
+    }
+
+    const auto deviation = std::max(actual_row_count, 1.0f) / estimated_row_count;
+    if (deviation > REOPTIMIZATION_THRESHOLD || deviation < 1.0f / REOPTIMIZATION_THRESHOLD) {
+      lqp = reoptimizer.optimize(lqp);
+      ++_metrics->reoptimization_count;
+    }
+  }
+}
+
+bool SQLPipelineStatement::_use_cached_optimized_logical_plan() {
+  const auto cached_plan = SQLLogicalPlanCache::get().try_get(_plan_cache_key);
+  if (!cached_plan) return false;
+
+  const auto plan = *cached_plan;
+  DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
+  // MVCC-enabled and MVCC-disabled LQPs will evict each other
+  if (lqp_is_validated(plan) != (_use_mvcc == UseMvcc::Yes)) return false;
+
+  _optimized_logical_plan = plan;
+  return true;
+}
 }  // namespace opossum
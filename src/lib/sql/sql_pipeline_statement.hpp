@@ -1,13 +1,18 @@
 #pragma once
 
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "SQLParserResult.h"
 #include "cache/cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "memory/arena_memory_resource.hpp"
+#include "normalize_sql_literals.hpp"
 #include "optimizer/optimizer.hpp"
 #include "storage/table.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
@@ -15,10 +20,46 @@ namespace opossum {
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
   std::chrono::nanoseconds optimization_duration{};
+  // Breakdown of optimization_duration by optimizer rule
+  std::vector<OptimizerRuleMetrics> optimizer_rule_metrics;
   std::chrono::nanoseconds lqp_translation_duration{};
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+
+  // Whether the result was taken from the QueryResultCache, in which case no plan was executed
+  bool query_result_cache_hit = false;
+
+  // Number of times the remaining plan was re-optimized during adaptive execution
+  size_t reoptimization_count = 0;
+
+  // Time spent waiting for the AdmissionController and the peak memory of the execution, see MemoryBudget
+  std::chrono::nanoseconds admission_wait_duration{};
+  size_t peak_memory_bytes = 0;
+
+  // Sum of the hardware counters of the executed operators, only set if HardwareCounters are enabled
+  std::optional<HardwareCounterValues> hardware_counters;
+};
+
+/**
+ * The options of an SQLPipeline and its SQLPipelineStatements as configured by the SQLPipelineBuilder, which documents
+ * them. Bundling them keeps the constructors from growing with every new option.
+ */
+struct SQLPipelineOptions {
+  UseMvcc use_mvcc{UseMvcc::Yes};
+  std::shared_ptr<TransactionContext> transaction_context;
+  std::shared_ptr<LQPTranslator> lqp_translator;
+  std::shared_ptr<Optimizer> optimizer;
+  CleanupTemporaries cleanup_temporaries{CleanupTemporaries::Yes};
+  FusePipelines fuse_pipelines{FusePipelines::No};
+  ParameterizeLiterals parameterize_literals{ParameterizeLiterals::No};
+  AdaptiveReoptimization adaptive_reoptimization{AdaptiveReoptimization::No};
+  std::optional<size_t> memory_budget_bytes;
+  // Set by the SQLPipeline for statements prefixed with EXPLAIN ANALYZE
+  ExplainAnalyze explain_analyze{ExplainAnalyze::No};
+  SchedulePriority priority{SchedulePriority::Default};
+  CacheQueryResults cache_query_results{CacheQueryResults::No};
+  std::shared_ptr<CancellationToken> cancellation_token;
 };
 
 /**
@@ -33,14 +74,46 @@ struct SQLPipelineStatementMetrics {
  * NOTE:
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the optimized
  *  LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be different.
+ *
+ * NOTE:
+ *  With ParameterizeLiterals::Yes, literals in WHERE, HAVING, VALUES, and SET clauses are replaced with
+ *  CorrelatedParameterExpressions (see normalize_sql_literals()). The plans are cached under the normalized SQL and the
+ *  values of the literals are only set in the PQP. If the normalized SQL cannot be translated (e.g., because a literal
+ *  is required to be a value), the statement falls back to the original SQL string.
+ *
+ * NOTE:
+ *  With AdaptiveReoptimization::Yes, get_result_table() executes the joins of statements that do not modify tables one
+ *  at a time, starting with a lowest one. The executed join is then replaced by an IntermediateResultNode holding its
+ *  result and actual row count. If the actual row count deviates from the estimated one by more than a factor of
+ *  REOPTIMIZATION_THRESHOLD, the join order of the remaining LQP is re-optimized with this knowledge. The plans
+ *  executed this way are not cached.
+ *
+ * NOTE:
+ *  With CacheQueryResults::Yes, the results of read-only statements executed with MVCC are stored in the
+ *  QueryResultCache. If the result of an earlier execution of the same statement is valid for the snapshot of the
+ *  transaction, get_result_table() returns it without executing the statement.
+ *
+ * NOTE:
+ *  get_result_table() fires ExecutionHooks::statement_started and statement_finished, e.g., for plugins. Statements
+ *  answered from the QueryResultCache are not executed and do not fire them.
+ *
+ * NOTE:
+ *  If the statement is cancelled through its CancellationToken or that of its transaction context, e.g., because a
+ *  client sent a CancelRequest or its timeout passed, get_result_table() rolls back the transaction and throws a
+ *  QueryCancelledException.
+ *
+ * NOTE:
+ *  With ExplainAnalyze::Yes, get_result_table() executes the statement as usual, but returns the performance data of
+ *  the executed operators (see create_operator_performance_table()) instead of the statement's result.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
   // Prefer using the SQLPipelineBuilder for constructing SQLPipelineStatements conveniently
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                       const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
-                       const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const SQLPipelineOptions& options);
+
+  // Factor between the actual and the estimated row count of a join above which the remaining plan is re-optimized
+  static constexpr auto REOPTIMIZATION_THRESHOLD = 10.0f;
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -71,7 +144,28 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  const std::shared_ptr<MemoryBudget>& memory_budget() const;
+
  private:
+  // Translates the normalized SQL and binds its placeholders to parameters, returns nullptr if that is not possible
+  std::shared_ptr<AbstractLQPNode> _translate_normalized_sql() const;
+
+  // Looks up the optimized LQP in the SQLLogicalPlanCache, returns whether it was found
+  bool _use_cached_optimized_logical_plan();
+
+  // Sets the parameters, the transaction context, and the arena of a newly created PQP
+  void _prepare_physical_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
+
+  // Looks up the result in the QueryResultCache, returns whether it was found
+  bool _use_cached_query_result();
+
+  // Rolls back the transaction and throws a QueryCancelledException if the statement was cancelled
+  void _throw_if_cancelled();
+
+  // Executes the joins of the optimized LQP adaptively (see AdaptiveReoptimization above) and sets _physical_plan to
+  // the plan of the remaining operators
+  void _execute_joins_adaptively();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -89,7 +183,11 @@ class SQLPipelineStatement : public Noncopyable {
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
   std::shared_ptr<AbstractLQPNode> _optimized_logical_plan;
   std::shared_ptr<AbstractOperator> _physical_plan;
+  // Memory for the intermediate results of the statement, released once they and the statement are gone
+  std::shared_ptr<ArenaMemoryResource> _arena;
   std::vector<std::shared_ptr<OperatorTask>> _tasks;
+  // If the physical plan is a copy of a cached plan, its tasks were created along with it (see OperatorTaskGraph)
+  std::vector<std::shared_ptr<OperatorTask>> _cached_plan_tasks;
   std::shared_ptr<const Table> _result_table;
   // Assume there is an output table. Only change if nullptr is returned from execution.
   bool _query_has_output = true;
@@ -98,6 +196,33 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Execute chains of chunkwise operators morsel by morsel, see AbstractChunkwiseOperator
+  const FusePipelines _fuse_pipelines;
+
+  const AdaptiveReoptimization _adaptive_reoptimization;
+
+  // Tracks the memory of the arena and the operators' reservations, see MemoryBudget
+  const std::shared_ptr<MemoryBudget> _memory_budget;
+
+  const ExplainAnalyze _explain_analyze;
+
+  // Priority of the statement's OperatorTasks and, as they inherit it, of the JobTasks spawned by its operators
+  const SchedulePriority _priority;
+
+  // Only set if the statement's literals are replaced with parameters
+  std::optional<NormalizedSQL> _normalized_sql;
+
+  // Key for the SQLLogicalPlanCache and SQLPhysicalPlanCache - the normalized or the original SQL string
+  std::string _plan_cache_key;
+
+  const CacheQueryResults _cache_query_results;
+
+  // Key for the QueryResultCache, see QueryResultCache::key()
+  std::string _query_result_cache_key;
+
+  // Set on the operators of the statement, might be nullptr
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
@@ -0,0 +1,71 @@
+#include "sql_tokenizer.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <cctype>
+
+namespace {
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+}  // namespace
+
+namespace opossum {
+
+std::vector<SQLToken> tokenize_sql(const std::string& sql) {
+  auto tokens = std::vector<SQLToken>{};
+
+  auto position = size_t{0};
+  while (position < sql.size()) {
+    const auto character = sql[position];
+    const auto next_character = position + 1 < sql.size() ? sql[position + 1] : '\0';
+
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      ++position;
+      continue;
+    }
+
+    if (character == '-' && next_character == '-') {
+      position = sql.find('\n', position);
+      if (position == std::string::npos) position = sql.size();
+      continue;
+    }
+
+    if (character == '/' && next_character == '*') {
+      position = sql.find("*/", position + 2);
+      position = position == std::string::npos ? sql.size() : position + 2;
+      continue;
+    }
+
+    auto end = position + 1;
+    auto type = SQLTokenType::Symbol;
+    if (character == '"' || character == '`' || character == '\'') {
+      // Escaped quotes ('') simply continue the string
+      end = sql.find(character, position + 1);
+      while (end != std::string::npos && end + 1 < sql.size() && sql[end + 1] == character) {
+        end = sql.find(character, end + 2);
+      }
+      end = end == std::string::npos ? sql.size() : end + 1;
+      type = character == '\'' ? SQLTokenType::String : SQLTokenType::QuotedIdentifier;
+    } else if (is_digit(character) || (character == '.' && is_digit(next_character))) {
+      while (end < sql.size() && (is_identifier_character(sql[end]) || sql[end] == '.')) ++end;
+      type = SQLTokenType::Number;
+    } else if (is_identifier_character(character)) {
+      while (end < sql.size() && is_identifier_character(sql[end])) ++end;
+      type = SQLTokenType::Word;
+    }
+
+    auto text = sql.substr(position, end - position);
+    if (type == SQLTokenType::Word) boost::to_upper(text);
+    tokens.emplace_back(SQLToken{type, position, end, std::move(text)});
+    position = end;
+  }
+
+  return tokens;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+enum class SQLTokenType { Word, QuotedIdentifier, Number, Symbol, String };
+
+struct SQLToken {
+  SQLTokenType type;
+  size_t begin;
+  size_t end;
+  // Upper case for words, the character for symbols
+  std::string text;
+};
+
+/**
+ * Splits a SQL string into tokens, skipping whitespace and comments. This is not a parser: It is only used to rewrite
+ * syntax that the SQL parser does not know (see rewrite_table_samples() and rewrite_window_functions()) into syntax
+ * that it does know, without touching strings, quoted identifiers, and comments.
+ */
+std::vector<SQLToken> tokenize_sql(const std::string& sql);
+
+}  // namespace opossum
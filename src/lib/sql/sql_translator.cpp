@@ -29,6 +29,7 @@
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/unary_minus_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/alias_node.hpp"
@@ -39,7 +40,9 @@
 #include "logical_query_plan/drop_table_node.hpp"
 #include "logical_query_plan/drop_view_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "logical_query_plan/except_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -51,9 +54,18 @@
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "logical_query_plan/window_node.hpp"
+#include "rewrite_set_operations.hpp"
+#include "rewrite_sql_for_parser.hpp"
+#include "rewrite_table_samples.hpp"
+#include "rewrite_window_functions.hpp"
 #include "storage/lqp_view.hpp"
+#include "storage/meta_tables.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/decimal_utils.hpp"
+#include "utils/logical_data_types.hpp"
 
 #include "SQLParser.h"
 
@@ -120,6 +132,73 @@ bool is_trivial_join_predicate(const AbstractExpression& expression, const Abstr
 
   return (left_in_left && right_in_right) || (right_in_left && left_in_right);
 }
+
+/**
+ * Date, Timestamp, and Decimal columns are compared with the integers they are stored as. Literals compared with such
+ * columns are thus converted to these integers here, so that the scans and the chunk pruning work on integers:
+ *   - String literals compared with Dates and Timestamps (e.g., `l_shipdate < '1995-03-15'`) are parsed.
+ *   - Literals compared with Decimals (e.g., `l_discount BETWEEN 0.05 AND 0.07`) are scaled.
+ * Other integer expressions compared with Decimals are cast to Decimals. Decimals compared with other floating point
+ * expressions are cast to Doubles.
+ */
+std::shared_ptr<AbstractExpression> coerce_compared_operand(const AbstractExpression& compared_expression,
+                                                            const std::shared_ptr<AbstractExpression>& expression) {
+  const auto compared_data_type = compared_expression.data_type();
+  const auto data_type = expression->data_type();
+  const auto is_literal = expression->type == ExpressionType::Value;
+
+  if (is_date_time_data_type(compared_data_type) && is_literal && data_type == DataType::String) {
+    const auto& value = static_cast<const ValueExpression&>(*expression).value;
+    return std::make_shared<ValueExpression>(
+        logical_value_from_string(compared_data_type, std::string{boost::get<pmr_string>(value)}));
+  }
+
+  if (compared_data_type == DataType::Decimal && data_type != DataType::Decimal && data_type != DataType::Null) {
+    if (is_literal) {
+      const auto& value = static_cast<const ValueExpression&>(*expression).value;
+      if (data_type == DataType::String) {
+        return std::make_shared<ValueExpression>(
+            logical_value_from_string(DataType::Decimal, std::string{boost::get<pmr_string>(value)}));
+      }
+      if (is_floating_point_data_type(data_type)) {
+        return std::make_shared<ValueExpression>(decimal_from_double(type_cast_variant<double>(value)));
+      }
+      return std::make_shared<ValueExpression>(type_cast_variant<int64_t>(value) * DECIMAL_FACTOR);
+    }
+
+    if (data_type == DataType::Int || data_type == DataType::Long) return cast_(expression, DataType::Decimal);
+  }
+
+  if (data_type == DataType::Decimal && is_floating_point_data_type(compared_data_type) &&
+      compared_expression.type != ExpressionType::Value) {
+    return cast_(expression, DataType::Double);
+  }
+
+  return expression;
+}
+
+/**
+ * Integers combined with Decimals are scaled by the ExpressionEvaluator. Floating point literals combined with Decimals
+ * (e.g., `0.2 * l_quantity`) are cast to Decimals, so that the result remains exact. Decimals combined with other
+ * floating point expressions are cast to Doubles.
+ */
+std::shared_ptr<AbstractExpression> coerce_arithmetic_operand(const AbstractExpression& other_operand,
+                                                              const std::shared_ptr<AbstractExpression>& operand) {
+  const auto other_data_type = other_operand.data_type();
+  const auto data_type = operand->data_type();
+
+  if (other_data_type == DataType::Decimal && is_floating_point_data_type(data_type) &&
+      operand->type == ExpressionType::Value) {
+    return cast_(operand, DataType::Decimal);
+  }
+
+  if (data_type == DataType::Decimal && is_floating_point_data_type(other_data_type) &&
+      other_operand.type != ExpressionType::Value) {
+    return cast_(operand, DataType::Double);
+  }
+
+  return operand;
+}
 }  // namespace
 
 namespace opossum {
@@ -191,13 +270,12 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select_statement(cons
   // 3. GROUP BY clause
   // 4. HAVING clause
   // 5. SELECT clause (incl. DISTINCT)
-  // 6. UNION clause
+  // 6. Set operations (INTERSECT/EXCEPT [ALL])
   // 7. ORDER BY clause
   // 8. LIMIT clause
 
   AssertInput(select.selectList != nullptr, "SELECT list needs to exist");
   AssertInput(!select.selectList->empty(), "SELECT list needs to have entries");
-  AssertInput(select.unionSelect == nullptr, "Set operations (UNION/INTERSECT/...) are not supported yet");
 
   // Translate FROM
   if (select.fromTable) {
@@ -218,9 +296,12 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select_statement(cons
   // Translate SELECT, HAVING, GROUP BY in one go, as they are interdependent
   _translate_select_list_groupby_having(select);
 
-  // Translate ORDER BY and LIMIT
-  if (select.order) _translate_order_by(*select.order);
-  if (select.limit) _translate_limit(*select.limit);
+  // Translate ORDER BY and LIMIT. The parser attaches those that follow a set operation to its left input, but they
+  // apply to the result of the set operation (see below).
+  if (!select.unionSelect) {
+    if (select.order) _translate_order_by(*select.order);
+    if (select.limit) _translate_limit(*select.limit);
+  }
 
   /**
    * Name, select and arrange the Columns as specified in the SELECT clause
@@ -252,9 +333,52 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select_statement(cons
     _current_lqp = AliasNode::make(_inflated_select_list_expressions, aliases, _current_lqp);
   }
 
+  // Translate set operations. The parser stores the right input of each as the unionSelect of the left input.
+  if (select.unionSelect) {
+    _translate_set_operation(*select.unionSelect);
+
+    if (select.order) _translate_order_by(*select.order);
+    if (select.limit) _translate_limit(*select.limit);
+  }
+
   return _current_lqp;
 }
 
+void SQLTranslator::_translate_set_operation(const hsql::SelectStatement& right_select) {
+  // The parser does not record the kind of a set operation, so rewrite_set_operations() marks INTERSECT and EXCEPT in
+  // the SELECT list of their right input. Unmarked set operations are UNIONs.
+  AssertInput(right_select.selectList && !right_select.selectList->empty(), "SELECT list needs to have entries");
+  const auto* marker_expr = right_select.selectList->front();
+  const auto set_operation = marker_expr->type == hsql::kExprLiteralString && marker_expr->name && !marker_expr->alias
+                                 ? parse_set_operation_marker(marker_expr->name)
+                                 : std::nullopt;
+  AssertInput(set_operation, "UNION is not supported yet");
+
+  // The right input is translated independently. The output columns (and their names) are those of the left input.
+  auto nested_select_translator =
+      SQLTranslator{_use_mvcc, _external_sql_identifier_resolver_proxy, _parameter_id_allocator};
+  nested_select_translator._skip_set_operation_marker = true;
+  const auto right_input_lqp = nested_select_translator._translate_select_statement(right_select);
+
+  const auto& left_column_expressions = _current_lqp->column_expressions();
+  const auto& right_column_expressions = right_input_lqp->column_expressions();
+  AssertInput(left_column_expressions.size() == right_column_expressions.size(),
+              "Inputs of a set operation must have the same number of columns");
+  for (auto column_id = size_t{0}; column_id < left_column_expressions.size(); ++column_id) {
+    AssertInput(left_column_expressions[column_id]->data_type() == right_column_expressions[column_id]->data_type(),
+                "Inputs of a set operation must have the same column data types");
+  }
+
+  switch (set_operation->type) {
+    case SetOperationType::Intersect:
+      _current_lqp = IntersectNode::make(set_operation->mode, _current_lqp, right_input_lqp);
+      break;
+    case SetOperationType::Except:
+      _current_lqp = ExceptNode::make(set_operation->mode, _current_lqp, right_input_lqp);
+      break;
+  }
+}
+
 std::shared_ptr<AbstractExpression> SQLTranslator::translate_hsql_expr(const hsql::Expr& hsql_expr,
                                                                        const UseMvcc use_mvcc) {
   // Create an empty SQLIdentifier context - thus the expression cannot refer to any external columns
@@ -263,6 +387,7 @@ std::shared_ptr<AbstractExpression> SQLTranslator::translate_hsql_expr(const hsq
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::InsertStatement& insert) {
   const auto table_name = std::string{insert.tableName};
+  AssertInput(!is_meta_table_name(table_name), "Cannot insert into meta table " + table_name);
   const auto target_table = StorageManager::get().get_table(table_name);
   auto insert_data_node = std::shared_ptr<AbstractLQPNode>{};
   auto column_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
@@ -363,6 +488,8 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::In
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_delete(const hsql::DeleteStatement& delete_statement) {
+  AssertInput(!is_meta_table_name(delete_statement.tableName),
+              std::string{"Cannot delete from meta table "} + delete_statement.tableName);
   const auto sql_identifier_resolver = std::make_shared<SQLIdentifierResolver>();
   auto data_to_delete_node = _translate_stored_table(delete_statement.tableName, sql_identifier_resolver);
 
@@ -380,6 +507,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_update(const hsql::Up
   AssertInput(update.table->type == hsql::kTableName, "UPDATE can only reference table by name");
 
   const auto table_name = std::string{update.table->name};
+  AssertInput(!is_meta_table_name(table_name), "Cannot update meta table " + table_name);
 
   auto translation_state = _translate_table_ref(*update.table);
 
@@ -454,7 +582,14 @@ SQLTranslator::TableSourceState SQLTranslator::_translate_table_origin(const hsq
 
   switch (hsql_table_ref.type) {
     case hsql::kTableName: {
-      if (StorageManager::get().has_table(hsql_table_ref.name)) {
+      // rewrite_table_samples() moved TABLESAMPLE clauses into the table name
+      const auto [stored_table_name, table_sample] = split_table_sample(hsql_table_ref.name);
+      if (table_sample) {
+        AssertInput(StorageManager::get().has_table(stored_table_name),
+                    "TABLESAMPLE is only supported for stored tables, not for '" + stored_table_name + "'");
+        lqp = _translate_stored_table(stored_table_name, sql_identifier_resolver, table_sample);
+
+      } else if (StorageManager::get().has_table(hsql_table_ref.name)) {
         lqp = _translate_stored_table(hsql_table_ref.name, sql_identifier_resolver);
 
       } else if (StorageManager::get().has_view(hsql_table_ref.name)) {
@@ -534,8 +669,10 @@ SQLTranslator::TableSourceState SQLTranslator::_translate_table_origin(const hsq
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_stored_table(
-    const std::string& name, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver) {
+    const std::string& name, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver,
+    const std::optional<TableSample>& table_sample) {
   const auto stored_table_node = StoredTableNode::make(name);
+  stored_table_node->set_table_sample(table_sample);
   const auto validated_stored_table_node = _validate_if_active(stored_table_node);
 
   const auto table = StorageManager::get().get_table(name);
@@ -762,7 +899,9 @@ void SQLTranslator::_translate_select_list_groupby_having(const hsql::SelectStat
   // Each select_list_element is either an Expression or nullptr if the element is a Wildcard
   std::vector<std::shared_ptr<AbstractExpression>> select_list_elements;
   auto post_select_sql_identifier_resolver = std::make_shared<SQLIdentifierResolver>(*_sql_identifier_resolver);
-  for (const auto& hsql_select_expr : *select.selectList) {
+  const auto select_list_begin = _skip_set_operation_marker ? size_t{1} : size_t{0};
+  for (auto select_list_idx = select_list_begin; select_list_idx < select.selectList->size(); ++select_list_idx) {
+    const auto* hsql_select_expr = (*select.selectList)[select_list_idx];
     if (hsql_select_expr->type == hsql::kExprStar) {
       select_list_elements.emplace_back(nullptr);
     } else {
@@ -823,10 +962,55 @@ void SQLTranslator::_translate_select_list_groupby_having(const hsql::SelectStat
     _current_lqp = _translate_predicate_expression(having_expression, _current_lqp);
   }
 
+  // Build Window. Window functions are computed after the aggregation, so their arguments may contain aggregates.
+  auto window_function_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto window_function_expression_set = ExpressionUnorderedSet{};
+  for (const auto& select_list_element : select_list_elements) {
+    if (!select_list_element) continue;
+    visit_expression(select_list_element, [&](const auto& sub_expression) {
+      if (sub_expression->type != ExpressionType::WindowFunction) return ExpressionVisitation::VisitArguments;
+      if (window_function_expression_set.emplace(sub_expression).second) {
+        window_function_expressions.emplace_back(sub_expression);
+      }
+      return ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+
+  if (!window_function_expressions.empty()) {
+    // The Window operator only takes columns as arguments, so even literals are projected
+    const auto pre_window_lqp = _current_lqp;
+    auto projection_expressions = pre_window_lqp->column_expressions();
+    auto projected_arguments = ExpressionUnorderedSet{};
+    for (const auto& window_function_expression : window_function_expressions) {
+      for (const auto& argument : window_function_expression->arguments) {
+        AssertInput(expression_evaluable_on_lqp(argument, *pre_window_lqp),
+                    "Window function '" + window_function_expression->as_column_name() +
+                        "' references columns not accessible after Aggregation");
+        if (!pre_window_lqp->find_column_id(*argument) && projected_arguments.emplace(argument).second) {
+          projection_expressions.emplace_back(argument);
+        }
+      }
+    }
+
+    if (projection_expressions.size() != pre_window_lqp->column_expressions().size()) {
+      _current_lqp = ProjectionNode::make(projection_expressions, _current_lqp);
+    }
+    _current_lqp = WindowNode::make(window_function_expressions, _current_lqp);
+
+    // If any Expressions were added to compute the window functions, remove them again
+    if (pre_window_lqp->column_expressions().size() + window_function_expressions.size() !=
+        _current_lqp->column_expressions().size()) {
+      auto output_expressions = pre_window_lqp->column_expressions();
+      output_expressions.insert(output_expressions.end(), window_function_expressions.begin(),
+                                window_function_expressions.end());
+      _current_lqp = ProjectionNode::make(output_expressions, _current_lqp);
+    }
+  }
+
   // Create output_expressions from SELECT list, including column wildcards
   std::unordered_map<std::shared_ptr<AbstractExpression>, std::string> column_aliases;
 
-  for (auto select_list_idx = size_t{0}; select_list_idx < select.selectList->size(); ++select_list_idx) {
+  for (auto select_list_idx = select_list_begin; select_list_idx < select.selectList->size(); ++select_list_idx) {
     const auto* hsql_expr = (*select.selectList)[select_list_idx];
 
     if (hsql_expr->type == hsql::kExprStar) {
@@ -885,7 +1069,7 @@ void SQLTranslator::_translate_select_list_groupby_having(const hsql::SelectStat
         }
       }
     } else {
-      auto output_expression = select_list_elements[select_list_idx];
+      auto output_expression = select_list_elements[select_list_idx - select_list_begin];
       _inflated_select_list_expressions.emplace_back(output_expression);
 
       if (hsql_expr->alias) {
@@ -1030,6 +1214,8 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_drop(const hsql::Drop
     case hsql::DropType::kDropView:
       return DropViewNode::make(drop_statement.name);
     case hsql::DropType::kDropTable:
+      AssertInput(!is_meta_table_name(drop_statement.name),
+                  std::string{"Cannot drop meta table "} + drop_statement.name);
       return DropTableNode::make(drop_statement.name);
 
     default:
@@ -1038,10 +1224,13 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_drop(const hsql::Drop
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_prepare(const hsql::PrepareStatement& prepare_statement) {
+  // The prepared statement is a string literal, which the SQLPipeline did not rewrite
+  const auto query = rewrite_sql_for_parser(prepare_statement.query);
+
   hsql::SQLParserResult parse_result;
-  hsql::SQLParser::parse(prepare_statement.query, &parse_result);
+  hsql::SQLParser::parse(query, &parse_result);
 
-  AssertInput(parse_result.isValid(), create_sql_parser_error_message(prepare_statement.query, parse_result));
+  AssertInput(parse_result.isValid(), create_sql_parser_error_message(prepare_statement.query, query, parse_result));
   AssertInput(parse_result.size() == 1u, "PREPAREd statement can only contain a single SQL statement");
 
   auto prepared_plan_translator = SQLTranslator{_use_mvcc};
@@ -1201,6 +1390,8 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
         name = found_alias->second;
       }
 
+      if (name == "WINDOW_FUNCTION"s) return _translate_window_function(expr, sql_identifier_resolver);
+
       if (name == "EXTRACT"s) {
         Assert(expr.datetimeField != hsql::kDatetimeNone, "No DatetimeField specified in EXTRACT. Bug in sqlparser?");
 
@@ -1229,6 +1420,7 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
           case AggregateFunction::Max:
           case AggregateFunction::Sum:
           case AggregateFunction::Avg:
+          case AggregateFunction::ApproxCountDistinct:
             return std::make_shared<AggregateExpression>(
                 aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
 
@@ -1268,7 +1460,9 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
       const auto arithmetic_operators_iter = hsql_arithmetic_operators.find(expr.opType);
       if (arithmetic_operators_iter != hsql_arithmetic_operators.end()) {
         Assert(left && right, "Unexpected SQLParserResult. Didn't receive two arguments for binary expression.");
-        return std::make_shared<ArithmeticExpression>(arithmetic_operators_iter->second, left, right);
+        return std::make_shared<ArithmeticExpression>(arithmetic_operators_iter->second,
+                                                      coerce_arithmetic_operand(*right, left),
+                                                      coerce_arithmetic_operand(*left, right));
       }
 
       // Translate PredicateExpression
@@ -1278,12 +1472,14 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
 
         if (is_binary_predicate_condition(predicate_condition)) {
           Assert(left && right, "Unexpected SQLParserResult. Didn't receive two arguments for binary_expression");
-          return std::make_shared<BinaryPredicateExpression>(predicate_condition, left, right);
+          return std::make_shared<BinaryPredicateExpression>(
+              predicate_condition, coerce_compared_operand(*right, left), coerce_compared_operand(*left, right));
         } else if (predicate_condition == PredicateCondition::Between) {
           Assert(expr.exprList && expr.exprList->size() == 2, "Expected two arguments for BETWEEN");
           return std::make_shared<BetweenExpression>(
-              left, _translate_hsql_expr(*(*expr.exprList)[0], sql_identifier_resolver),
-              _translate_hsql_expr(*(*expr.exprList)[1], sql_identifier_resolver));
+              left,
+              coerce_compared_operand(*left, _translate_hsql_expr(*(*expr.exprList)[0], sql_identifier_resolver)),
+              coerce_compared_operand(*left, _translate_hsql_expr(*(*expr.exprList)[1], sql_identifier_resolver)));
         }
       }
 
@@ -1311,7 +1507,8 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
 
             arguments.reserve(expr.exprList->size());
             for (const auto* hsql_argument : *expr.exprList) {
-              arguments.emplace_back(_translate_hsql_expr(*hsql_argument, sql_identifier_resolver));
+              arguments.emplace_back(
+                  coerce_compared_operand(*left, _translate_hsql_expr(*hsql_argument, sql_identifier_resolver)));
             }
 
             const auto array = std::make_shared<ListExpression>(arguments);
@@ -1414,6 +1611,65 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_case(
   return current_case_expression;
 }
 
+std::shared_ptr<AbstractExpression> SQLTranslator::_translate_window_function(
+    const hsql::Expr& expr, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver) const {
+  // WINDOW_FUNCTION(<function>(<argument>), '<specification>', <PARTITION BY expressions>, <ORDER BY expressions>)
+  AssertInput(expr.exprList && expr.exprList->size() >= 2 && (*expr.exprList)[0]->type == hsql::kExprFunctionRef &&
+                  (*expr.exprList)[1]->type == hsql::kExprLiteralString,
+              "WINDOW_FUNCTION() is reserved for window functions with an OVER clause");
+  const auto& hsql_function = *(*expr.exprList)[0];
+  const auto specification = parse_window_specification((*expr.exprList)[1]->name);
+
+  const auto partition_by_begin = expr.exprList->begin() + 2;
+  const auto order_by_begin = partition_by_begin + specification.partition_by_count;
+  AssertInput(expr.exprList->end() - order_by_begin == static_cast<std::ptrdiff_t>(specification.order_by_modes.size()),
+              "Expected one argument of WINDOW_FUNCTION() per PARTITION BY and ORDER BY expression");
+
+  auto function_name = std::string{hsql_function.name};
+  std::transform(function_name.begin(), function_name.end(), function_name.begin(),
+                 [](const auto c) { return std::toupper(c); });
+  const auto window_function_iter = window_function_to_string.right.find(function_name);
+  AssertInput(window_function_iter != window_function_to_string.right.end(),
+              "'"s + function_name + "' is not a supported window function");
+  const auto window_function = window_function_iter->second;
+  AssertInput(!hsql_function.distinct, "DISTINCT is not supported in window functions");
+
+  // Ranking functions have no argument, COUNT(*) counts all rows of the frame
+  const auto argument_count = hsql_function.exprList ? hsql_function.exprList->size() : size_t{0};
+  auto argument = std::shared_ptr<AbstractExpression>{};
+  if (window_function == WindowFunction::RowNumber || window_function == WindowFunction::Rank ||
+      window_function == WindowFunction::DenseRank) {
+    AssertInput(argument_count == 0, "'"s + function_name + "' does not take arguments");
+  } else {
+    AssertInput(argument_count == 1, "Expected exactly one argument for window function '"s + function_name + "'");
+    const auto& hsql_argument = *hsql_function.exprList->front();
+    if (window_function == WindowFunction::Count && hsql_argument.type == hsql::kExprStar) {
+      AssertInput(!hsql_argument.name, "Illegal <t>.* in COUNT()");
+    } else {
+      argument = _translate_hsql_expr(hsql_argument, sql_identifier_resolver);
+      AssertInput(window_function == WindowFunction::Count || window_function == WindowFunction::Min ||
+                      window_function == WindowFunction::Max ||
+                      (argument->data_type() != DataType::String && !is_date_time_data_type(argument->data_type()) &&
+                       (window_function == WindowFunction::Sum || argument->data_type() != DataType::Decimal)),
+                  "Window function '"s + function_name + "' requires a numeric argument");
+    }
+  }
+
+  auto partition_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto hsql_expr_iter = partition_by_begin; hsql_expr_iter != order_by_begin; ++hsql_expr_iter) {
+    partition_by_expressions.emplace_back(_translate_hsql_expr(**hsql_expr_iter, sql_identifier_resolver));
+  }
+
+  auto order_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto hsql_expr_iter = order_by_begin; hsql_expr_iter != expr.exprList->end(); ++hsql_expr_iter) {
+    order_by_expressions.emplace_back(_translate_hsql_expr(**hsql_expr_iter, sql_identifier_resolver));
+  }
+
+  return std::make_shared<WindowFunctionExpression>(window_function, argument, partition_by_expressions,
+                                                    order_by_expressions, specification.order_by_modes,
+                                                    specification.frame);
+}
+
 std::shared_ptr<AbstractExpression> SQLTranslator::_inverse_predicate(const AbstractExpression& expression) const {
   /**
    * Inverse a boolean expression
@@ -100,7 +100,8 @@ class SQLTranslator final {
   TableSourceState _translate_table_ref(const hsql::TableRef& hsql_table_ref);
   TableSourceState _translate_table_origin(const hsql::TableRef& hsql_table_ref);
   std::shared_ptr<AbstractLQPNode> _translate_stored_table(
-      const std::string& name, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver);
+      const std::string& name, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver,
+      const std::optional<TableSample>& table_sample = std::nullopt);
   TableSourceState _translate_predicated_join(const hsql::JoinDefinition& join);
   TableSourceState _translate_natural_join(const hsql::JoinDefinition& join);
   TableSourceState _translate_cross_product(const std::vector<hsql::TableRef*>& tables);
@@ -110,6 +111,9 @@ class SQLTranslator final {
   void _translate_order_by(const std::vector<hsql::OrderDescription*>& order_list);
   void _translate_limit(const hsql::LimitDescription& limit);
 
+  // Translates the set operation whose right input is right_select, using the marker of rewrite_set_operations()
+  void _translate_set_operation(const hsql::SelectStatement& right_select);
+
   std::shared_ptr<AbstractLQPNode> _translate_insert(const hsql::InsertStatement& insert);
   std::shared_ptr<AbstractLQPNode> _translate_delete(const hsql::DeleteStatement& delete_statement);
   std::shared_ptr<AbstractLQPNode> _translate_update(const hsql::UpdateStatement& update);
@@ -145,6 +149,10 @@ class SQLTranslator final {
   std::shared_ptr<AbstractExpression> _translate_hsql_case(
       const hsql::Expr& expr, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver) const;
 
+  // Translates the WINDOW_FUNCTION() calls created by rewrite_window_functions()
+  std::shared_ptr<AbstractExpression> _translate_window_function(
+      const hsql::Expr& expr, const std::shared_ptr<SQLIdentifierResolver>& sql_identifier_resolver) const;
+
   std::shared_ptr<AbstractExpression> _inverse_predicate(const AbstractExpression& expression) const;
 
  private:
@@ -156,6 +164,10 @@ class SQLTranslator final {
   std::shared_ptr<ParameterIDAllocator> _parameter_id_allocator;
   std::optional<TableSourceState> _from_clause_result;
 
+  // Set when translating the right input of a set operation, whose first SELECT list item is the marker added by
+  // rewrite_set_operations()
+  bool _skip_set_operation_marker{false};
+
   // "Inflated" because all wildcards will be inflated to the expressions they actually represent
   std::vector<std::shared_ptr<AbstractExpression>> _inflated_select_list_expressions;
 };
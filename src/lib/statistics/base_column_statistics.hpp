@@ -58,6 +58,11 @@ class BaseColumnStatistics {
    */
   std::shared_ptr<BaseColumnStatistics> only_null_values() const;
 
+  /**
+   * @return statistics of the column with each of its distinct values occurring once, e.g., after a GROUP BY
+   */
+  virtual std::shared_ptr<BaseColumnStatistics> without_duplicates() const = 0;
+
   /**
    * @defgroup Cardinality estimation
    * @{
@@ -0,0 +1,68 @@
+#include "cardinality_estimation_errors.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+double cardinality_q_error(const float estimated_row_count, const uint64_t actual_row_count) {
+  const auto estimated = std::max(static_cast<double>(estimated_row_count), 1.0);
+  const auto actual = std::max(static_cast<double>(actual_row_count), 1.0);
+  return std::max(estimated / actual, actual / estimated);
+}
+
+std::vector<CardinalityEstimationError> collect_cardinality_estimation_errors(
+    const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto errors = std::vector<CardinalityEstimationError>{};
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+
+  const auto visit_operator = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+    if (!visited_operators.emplace(op).second) return;
+
+    if (op->input_left()) self(self, op->input_left());
+    if (op->input_right()) self(self, op->input_right());
+
+    // Operators that were fused into a pipeline (except for its last one) or not executed have no row count
+    const auto& actual_row_count = op->performance_data().output_row_count;
+    if (!op->lqp_node || !actual_row_count) return;
+
+    const auto estimated_row_count = op->lqp_node->get_statistics()->row_count();
+    errors.emplace_back(CardinalityEstimationError{op->lqp_node->type, op->lqp_node->description(),
+                                                   estimated_row_count, *actual_row_count,
+                                                   cardinality_q_error(estimated_row_count, *actual_row_count)});
+  };
+  visit_operator(visit_operator, pqp);
+
+  return errors;
+}
+
+QErrorDistribution summarize_q_errors(std::vector<double> q_errors) {
+  auto distribution = QErrorDistribution{};
+  if (q_errors.empty()) return distribution;
+
+  std::sort(q_errors.begin(), q_errors.end());
+
+  // Nearest-rank percentiles, as for the latencies of the benchmarks
+  const auto percentile = [&](const double percent) {
+    const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(q_errors.size())));
+    return q_errors[std::max(rank, size_t{1}) - 1];
+  };
+
+  auto log_sum = 0.0;
+  for (const auto q_error : q_errors) {
+    log_sum += std::log(q_error);
+  }
+
+  distribution.count = q_errors.size();
+  distribution.geometric_mean = std::exp(log_sum / static_cast<double>(q_errors.size()));
+  distribution.median = percentile(50.0);
+  distribution.percentile_90 = percentile(90.0);
+  distribution.max = q_errors.back();
+  return distribution;
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Estimated and actual output row count of an LQP node, used to judge whether changes to the statistics or the join
+ * ordering improve the estimates rather than only the runtime. The quality of an estimate is given by its q-error
+ * max(estimated / actual, actual / estimated), which is at least one and treats over- and underestimation alike (see
+ * Moerkotte et al.: Preventing Bad Plans by Bounding the Impact of Cardinality Estimation Errors). Both row counts are
+ * taken to be at least one, so that empty results have a finite q-error.
+ */
+struct CardinalityEstimationError {
+  LQPNodeType node_type;
+  std::string node_description;
+  float estimated_row_count;
+  uint64_t actual_row_count;
+  double q_error;
+};
+
+double cardinality_q_error(const float estimated_row_count, const uint64_t actual_row_count);
+
+// Returns an entry for each executed operator of @param pqp that has an LQP node (see AbstractOperator::lqp_node),
+// inputs before outputs. The estimate is the row count of the node's TableStatistics. Operators of subqueries are
+// not included.
+std::vector<CardinalityEstimationError> collect_cardinality_estimation_errors(
+    const std::shared_ptr<const AbstractOperator>& pqp);
+
+// Distribution of the q-errors of multiple estimates, e.g., of all joins of a benchmark
+struct QErrorDistribution {
+  size_t count{0};
+  double geometric_mean{1.0};
+  double median{1.0};
+  double percentile_90{1.0};
+  double max{1.0};
+};
+
+QErrorDistribution summarize_q_errors(std::vector<double> q_errors);
+
+}  // namespace opossum
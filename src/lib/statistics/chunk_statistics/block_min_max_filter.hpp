@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "min_max_filter.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Filter that stores the minimum and maximum of each block of BLOCK_SIZE consecutive rows of a segment (a zone map).
+ * While the other filters can only prune a whole chunk, it tells a scan which blocks of the segment can contain
+ * matches, so that the other blocks are skipped. This pays off if the values are clustered, e.g., by the time of their
+ * insertion.
+ *
+ * It is part of SegmentStatistics, but not one of its filters: Chunks are pruned as before.
+ */
+class BaseBlockMinMaxFilter : public AbstractFilter {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{4'096};
+
+  // Returns the ranges [begin, end) of the chunk offsets of the blocks that can contain matches. Adjacent blocks form
+  // a single range.
+  virtual std::vector<std::pair<ChunkOffset, ChunkOffset>> candidate_ranges(
+      const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const = 0;
+
+  bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+                 const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const final {
+    return candidate_ranges(predicate_type, variant_value, variant_value2).empty();
+  }
+};
+
+template <typename T>
+class BlockMinMaxFilter : public BaseBlockMinMaxFilter {
+ public:
+  // The minimum and maximum of each block, std::nullopt for blocks that only contain NULLs
+  using BlockRanges = std::vector<std::optional<std::pair<T, T>>>;
+
+  BlockMinMaxFilter(const ChunkOffset segment_size, BlockRanges block_ranges)
+      : _segment_size(segment_size), _block_ranges(std::move(block_ranges)) {}
+
+  std::vector<std::pair<ChunkOffset, ChunkOffset>> candidate_ranges(
+      const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const final {
+    auto ranges = std::vector<std::pair<ChunkOffset, ChunkOffset>>{};
+
+    // As in MinMaxFilter, nothing is pruned for NULL values
+    if (variant_is_null(variant_value)) {
+      ranges.emplace_back(ChunkOffset{0}, _segment_size);
+      return ranges;
+    }
+
+    const auto value = type_cast_variant<T>(variant_value);
+    auto value2 = std::optional<T>{};
+    if (predicate_type == PredicateCondition::Between) {
+      Assert(static_cast<bool>(variant_value2), "Between operator needs two values.");
+      value2 = type_cast_variant<T>(*variant_value2);
+    }
+
+    for (auto block_index = size_t{0}; block_index < _block_ranges.size(); ++block_index) {
+      // Comparisons with NULL never match
+      const auto& block_range = _block_ranges[block_index];
+      if (!block_range) continue;
+
+      const auto& [min, max] = *block_range;
+      if (MinMaxFilter<T>::can_prune_min_max(min, max, predicate_type, value, value2)) continue;
+
+      const auto begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+      const auto end = std::min(static_cast<ChunkOffset>(begin + BLOCK_SIZE), _segment_size);
+      if (!ranges.empty() && ranges.back().second == begin) {
+        ranges.back().second = end;
+      } else {
+        ranges.emplace_back(begin, end);
+      }
+    }
+
+    return ranges;
+  }
+
+  ChunkOffset segment_size() const { return _segment_size; }
+  const BlockRanges& block_ranges() const { return _block_ranges; }
+
+ protected:
+  const ChunkOffset _segment_size;
+  const BlockRanges _block_ranges;
+};
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include "blocked_bloom_filter.hpp"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "operators/table_scan/simd_scan_kernels.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Block = BaseBlockedBloomFilter::Block;
+
+// Odd constants used to derive the bit positions of the eight words from a single hash, taken from Impala
+alignas(32) constexpr std::array<uint32_t, BaseBlockedBloomFilter::WORDS_PER_BLOCK> SALTS = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// std::hash is the identity for integers, so the bits are spread before being used. The upper half selects the block,
+// the lower half the bits within the block.
+uint64_t mix(const size_t hash) { return static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL; }
+
+size_t block_index(const uint64_t mixed_hash, const size_t block_count) {
+  // Maps the upper 32 bits to [0, block_count) without a modulo, see Lemire: A fast alternative to the modulo reduction
+  return static_cast<size_t>(((mixed_hash >> 32) * static_cast<uint64_t>(block_count)) >> 32);
+}
+
+uint32_t bit_mask(const uint32_t key, const size_t word_id) { return uint32_t{1} << ((key * SALTS[word_id]) >> 27); }
+
+bool block_contains_scalar(const Block& block, const uint32_t key) {
+  auto matches = true;
+  for (auto word_id = size_t{0}; word_id < BaseBlockedBloomFilter::WORDS_PER_BLOCK; ++word_id) {
+    matches &= (block.words[word_id] & bit_mask(key, word_id)) != 0;
+  }
+  return matches;
+}
+
+__attribute__((target("avx2"))) bool block_contains_avx2(const Block& block, const uint32_t key) {
+  const auto salts = _mm256_load_si256(reinterpret_cast<const __m256i*>(SALTS.data()));
+  const auto bit_positions = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)), salts), 27);
+  const auto masks = _mm256_sllv_epi32(_mm256_set1_epi32(1), bit_positions);
+  const auto words = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words.data()));
+
+  // Returns 1 if all bits of the masks are set in the words
+  return _mm256_testc_si256(words, masks) != 0;
+}
+
+}  // namespace
+
+namespace opossum {
+
+double BaseBlockedBloomFilter::false_positive_rate(const double bits_per_value) {
+  DebugAssert(bits_per_value > 0.0, "Expected a positive number of bits per value");
+
+  // The number of values per block is approximately Poisson-distributed. A block with x values has a false-positive
+  // rate of (1 - (1 - 1/32)^x)^8, see Putze, Sanders, Singler: Cache-, Hash- and Space-Efficient Bloom Filters.
+  const auto mean_values_per_block = static_cast<double>(BITS_PER_BLOCK) / bits_per_value;
+  const auto max_values_per_block =
+      static_cast<size_t>(mean_values_per_block + 10.0 * std::sqrt(mean_values_per_block) + 20.0);
+
+  auto rate = 0.0;
+  auto probability = std::exp(-mean_values_per_block);
+  for (auto values_per_block = size_t{0}; values_per_block <= max_values_per_block; ++values_per_block) {
+    const auto word_rate = 1.0 - std::pow(1.0 - 1.0 / 32.0, static_cast<double>(values_per_block));
+    rate += probability * std::pow(word_rate, static_cast<double>(WORDS_PER_BLOCK));
+    probability *= mean_values_per_block / static_cast<double>(values_per_block + 1);
+  }
+  return rate;
+}
+
+double BaseBlockedBloomFilter::bits_per_value_for_false_positive_rate(const double target_false_positive_rate) {
+  DebugAssert(target_false_positive_rate > 0.0 && target_false_positive_rate < 1.0,
+              "Expected a false-positive rate in (0, 1)");
+
+  auto bits_per_value = 1.0;
+  while (bits_per_value < 64.0 && false_positive_rate(bits_per_value) > target_false_positive_rate) {
+    bits_per_value += 0.5;
+  }
+  return bits_per_value;
+}
+
+BaseBlockedBloomFilter::BaseBlockedBloomFilter(const size_t distinct_count, const double bits_per_value)
+    : _blocks(std::max(size_t{1}, static_cast<size_t>(std::ceil(static_cast<double>(distinct_count) * bits_per_value /
+                                                                   static_cast<double>(BITS_PER_BLOCK))))) {}
+
+BaseBlockedBloomFilter::BaseBlockedBloomFilter(std::vector<Block> blocks) : _blocks(std::move(blocks)) {
+  Assert(!_blocks.empty(), "BlockedBloomFilter needs at least one block");
+}
+
+const std::vector<BaseBlockedBloomFilter::Block>& BaseBlockedBloomFilter::blocks() const { return _blocks; }
+
+size_t BaseBlockedBloomFilter::memory_usage() const { return sizeof(*this) + _blocks.size() * sizeof(Block); }
+
+void BaseBlockedBloomFilter::_insert_hash(const size_t hash) {
+  const auto mixed_hash = mix(hash);
+  auto& block = _blocks[block_index(mixed_hash, _blocks.size())];
+  const auto key = static_cast<uint32_t>(mixed_hash);
+  for (auto word_id = size_t{0}; word_id < WORDS_PER_BLOCK; ++word_id) {
+    block.words[word_id] |= bit_mask(key, word_id);
+  }
+}
+
+bool BaseBlockedBloomFilter::_may_contain_hash(const size_t hash) const {
+  static const auto use_avx2 = detect_simd_instruction_set() >= SimdInstructionSet::AVX2;
+
+  const auto mixed_hash = mix(hash);
+  const auto& block = _blocks[block_index(mixed_hash, _blocks.size())];
+  const auto key = static_cast<uint32_t>(mixed_hash);
+  return use_avx2 ? block_contains_avx2(block, key) : block_contains_scalar(block, key);
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Type-independent part of BlockedBloomFilter<T>, which works on the hashes of the values.
+ *
+ * The filter is a split block Bloom filter like the BloomFilter that JoinHash uses for its probe side: each hash
+ * selects one 32-byte block and sets one bit in each of the block's eight 32-bit words. A lookup thus touches a single
+ * block. If the CPU supports AVX2 (see detect_simd_instruction_set()), the eight bit positions are computed and tested
+ * with a handful of vector instructions. Unlike the JoinHash BloomFilter, it is immutable once built and sized for a
+ * false-positive rate. There are no false negatives.
+ */
+class BaseBlockedBloomFilter : public AbstractFilter {
+ public:
+  static constexpr auto WORDS_PER_BLOCK = size_t{8};
+  static constexpr auto BITS_PER_BLOCK = WORDS_PER_BLOCK * 32;
+
+  struct alignas(32) Block {
+    std::array<uint32_t, WORDS_PER_BLOCK> words{};
+  };
+
+  // Expected false-positive rate of a filter with the given number of bits per inserted distinct value
+  static double false_positive_rate(const double bits_per_value);
+
+  // Smallest number of bits per distinct value (in steps of 0.5) for which false_positive_rate() is below the target
+  static double bits_per_value_for_false_positive_rate(const double target_false_positive_rate);
+
+  BaseBlockedBloomFilter(const size_t distinct_count, const double bits_per_value);
+  explicit BaseBlockedBloomFilter(std::vector<Block> blocks);
+
+  const std::vector<Block>& blocks() const;
+
+  size_t memory_usage() const;
+
+ protected:
+  void _insert_hash(const size_t hash);
+  bool _may_contain_hash(const size_t hash) const;
+
+  std::vector<Block> _blocks;
+};
+
+/**
+ * Filter that prunes equality predicates on values that do not occur in the segment. Other predicates are never
+ * pruned, as the filter knows nothing about the order of the values. SegmentStatistics::build_statistics() adds it
+ * to segments with too many distinct values for the RangeFilter or MinMaxFilter to be exact, see
+ * SegmentStatistics::MembershipFilterSettings.
+ */
+template <typename T>
+class BlockedBloomFilter : public BaseBlockedBloomFilter {
+ public:
+  using BaseBlockedBloomFilter::BaseBlockedBloomFilter;
+
+  // Builds the filter from the (distinct) values of a segment
+  static std::unique_ptr<BlockedBloomFilter<T>> build_filter(const pmr_vector<T>& dictionary,
+                                                             const double bits_per_value) {
+    auto filter = std::make_unique<BlockedBloomFilter<T>>(dictionary.size(), bits_per_value);
+    for (const auto& value : dictionary) {
+      filter->insert(value);
+    }
+    return filter;
+  }
+
+  void insert(const T& value) { _insert_hash(std::hash<T>{}(value)); }
+
+  // Returns false if the value was definitely not inserted
+  bool may_contain(const T& value) const { return _may_contain_hash(std::hash<T>{}(value)); }
+
+  bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+                 const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
+    if (predicate_type != PredicateCondition::Equals || variant_is_null(variant_value)) return false;
+    return !may_contain(type_cast_variant<T>(variant_value));
+  }
+};
+
+}  // namespace opossum
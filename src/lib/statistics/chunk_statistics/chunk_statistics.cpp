@@ -12,4 +12,28 @@ bool ChunkStatistics::can_prune(const ColumnID column_id, const PredicateConditi
   return _statistics[column_id]->can_prune(predicate_condition, variant_value, variant_value2);
 }
 
+bool ChunkStatistics::all_rows_match(const ColumnID column_id, const PredicateCondition predicate_condition,
+                                     const AllTypeVariant& variant_value,
+                                     const std::optional<AllTypeVariant>& variant_value2) const {
+  DebugAssert(column_id < _statistics.size(), "The passed column ID should fit in the bounds of the statistics.");
+  DebugAssert(_statistics[column_id], "The statistics should not contain any empty shared_ptrs.");
+  const auto& segment_statistics = *_statistics[column_id];
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return segment_statistics.can_prune(inverse_predicate_condition(predicate_condition), variant_value);
+    case PredicateCondition::Between:
+      Assert(variant_value2, "Between operator needs two values.");
+      return segment_statistics.can_prune(PredicateCondition::LessThan, variant_value) &&
+             segment_statistics.can_prune(PredicateCondition::GreaterThan, *variant_value2);
+    default:
+      return false;
+  }
+}
+
 }  // namespace opossum
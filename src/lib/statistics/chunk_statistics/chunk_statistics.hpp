@@ -26,6 +26,14 @@ class ChunkStatistics final : public std::enable_shared_from_this<ChunkStatistic
                  const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Returns true if the filters prove that all values of the column satisfy the predicate, i.e., that the inverse
+   * predicate can be pruned. The filters ignore NULLs, so this only holds if the segment does not contain any.
+   */
+  bool all_rows_match(const ColumnID column_id, const PredicateCondition predicate_condition,
+                      const AllTypeVariant& variant_value,
+                      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
  protected:
   std::vector<std::shared_ptr<SegmentStatistics>> _statistics;
 };
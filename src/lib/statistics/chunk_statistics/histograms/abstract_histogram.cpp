@@ -12,7 +12,43 @@
 
 #include "expression/evaluation/like_matcher.hpp"
 #include "histogram_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Counts the occurrences of each ValueID in the attribute vector of a dictionary segment, ignoring nulls
+std::vector<HistogramCountType> count_value_ids(const BaseDictionarySegment& segment) {
+  auto value_id_counts = std::vector<HistogramCountType>(segment.unique_values_count());
+  const auto null_value_id = segment.null_value_id();
+  resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend(); ++value_id_it) {
+      const auto value_id = ValueID{*value_id_it};
+      if (value_id != null_value_id) ++value_id_counts[value_id];
+    }
+  });
+  return value_id_counts;
+}
+
+// The dictionary is sorted, so the distribution is sorted without comparing any values
+template <typename T, typename GetValue>
+std::vector<std::pair<T, HistogramCountType>> value_distribution_from_dictionary(const BaseDictionarySegment& segment,
+                                                                                 const GetValue& get_value) {
+  const auto value_id_counts = count_value_ids(segment);
+
+  auto result = std::vector<std::pair<T, HistogramCountType>>{};
+  result.reserve(value_id_counts.size());
+  for (auto value_id = size_t{0}; value_id < value_id_counts.size(); ++value_id) {
+    if (value_id_counts[value_id] > 0) result.emplace_back(get_value(value_id), value_id_counts[value_id]);
+  }
+  return result;
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -58,6 +94,22 @@ std::string AbstractHistogram<T>::description() const {
 template <typename T>
 std::vector<std::pair<T, HistogramCountType>> AbstractHistogram<T>::_gather_value_distribution(
     const std::shared_ptr<const BaseSegment>& segment) {
+  // Dictionary segments already store their distinct values in sorted order, so one pass over the attribute vector
+  // suffices to count them
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    return value_distribution_from_dictionary<T>(*dictionary_segment,
+                                                 [&](const size_t value_id) { return dictionary[value_id]; });
+  }
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const FixedStringDictionarySegment<T>>(segment)) {
+      // Avoid materializing the whole dictionary via dictionary()
+      const auto& dictionary = *dictionary_segment->fixed_string_dictionary();
+      return value_distribution_from_dictionary<T>(
+          *dictionary_segment, [&](const size_t value_id) { return dictionary.get_string_at(value_id); });
+    }
+  }
+
   std::map<T, HistogramCountType> value_counts;
 
   segment_iterate<T>(*segment, [&](const auto& position) {
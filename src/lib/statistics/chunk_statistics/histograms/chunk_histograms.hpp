@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Builds a histogram of HistogramType (e.g., EqualDistinctCountHistogram<T>) for the segment of the column in each
+ * chunk of the table, passing the remaining arguments to HistogramType::from_segment(). Each chunk is processed by its
+ * own JobTask, so that building histograms for large tables is not limited to a single core. The entries for chunks
+ * without any non-null values are nullptr.
+ */
+template <typename HistogramType, typename... Args>
+std::vector<std::shared_ptr<HistogramType>> build_chunk_histograms(const Table& table, const ColumnID column_id,
+                                                                   const Args&... args) {
+  const auto chunk_count = table.chunk_count();
+  auto histograms = std::vector<std::shared_ptr<HistogramType>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+      histograms[chunk_id] = HistogramType::from_segment(segment, args...);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return histograms;
+}
+
+}  // namespace opossum
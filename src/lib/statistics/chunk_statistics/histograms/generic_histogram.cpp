@@ -0,0 +1,475 @@
+#include "generic_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "histogram_utils.hpp"
+#include "type_cast.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A part of the value range, with the number of values and distinct values that fall into it
+template <typename T>
+struct WeightedInterval {
+  T minimum;
+  T maximum;
+  double height;
+  double distinct_count;
+};
+
+// Width of [minimum, maximum], over which the values of a bin are assumed to be uniformly distributed
+template <typename T>
+double interval_width(const T minimum, const T maximum) {
+  if constexpr (std::is_integral_v<T>) {
+    return static_cast<double>(maximum) - static_cast<double>(minimum) + 1.0;
+  } else {
+    return static_cast<double>(maximum) - static_cast<double>(minimum);
+  }
+}
+
+/**
+ * Splits the value range of the given histograms into intervals that do not cross the edges of any of their bins.
+ * Returns the intervals covered by any bin, with the share of the height and distinct count of each histogram's bin
+ * that falls into the interval (indexed like bin_data).
+ */
+template <typename T>
+std::vector<std::pair<WeightedInterval<T>, std::vector<WeightedInterval<T>>>> split_into_intervals(
+    const std::vector<const GenericBinData<T>*>& bin_data) {
+  // Intervals begin where a bin begins or right after a bin ends
+  auto interval_minima = std::vector<T>{};
+  for (const auto* histogram_bin_data : bin_data) {
+    for (auto bin_id = BinID{0}; bin_id < histogram_bin_data->bin_minima.size(); ++bin_id) {
+      interval_minima.emplace_back(histogram_bin_data->bin_minima[bin_id]);
+      const auto bin_maximum = histogram_bin_data->bin_maxima[bin_id];
+      if (bin_maximum < std::numeric_limits<T>::max()) interval_minima.emplace_back(next_value(bin_maximum));
+    }
+  }
+  std::sort(interval_minima.begin(), interval_minima.end());
+  interval_minima.erase(std::unique(interval_minima.begin(), interval_minima.end()), interval_minima.end());
+
+  auto intervals = std::vector<std::pair<WeightedInterval<T>, std::vector<WeightedInterval<T>>>>{};
+  intervals.reserve(interval_minima.size());
+  for (auto interval_id = size_t{0}; interval_id < interval_minima.size(); ++interval_id) {
+    const auto maximum = interval_id + 1 < interval_minima.size() ? previous_value(interval_minima[interval_id + 1])
+                                                                  : std::numeric_limits<T>::max();
+    const auto interval = WeightedInterval<T>{interval_minima[interval_id], maximum, 0.0, 0.0};
+    intervals.emplace_back(interval, std::vector<WeightedInterval<T>>(bin_data.size(), interval));
+  }
+
+  for (auto histogram_id = size_t{0}; histogram_id < bin_data.size(); ++histogram_id) {
+    const auto& histogram_bin_data = *bin_data[histogram_id];
+    for (auto bin_id = BinID{0}; bin_id < histogram_bin_data.bin_minima.size(); ++bin_id) {
+      const auto bin_minimum = histogram_bin_data.bin_minima[bin_id];
+      const auto bin_maximum = histogram_bin_data.bin_maxima[bin_id];
+      const auto bin_width = interval_width(bin_minimum, bin_maximum);
+
+      auto interval_id = static_cast<size_t>(std::distance(
+          interval_minima.cbegin(), std::lower_bound(interval_minima.cbegin(), interval_minima.cend(), bin_minimum)));
+      for (; interval_id < intervals.size() && intervals[interval_id].first.minimum <= bin_maximum; ++interval_id) {
+        auto& interval = intervals[interval_id];
+        const auto share =
+            bin_width > 0.0 ? interval_width(interval.first.minimum, interval.first.maximum) / bin_width : 1.0;
+        interval.second[histogram_id].height = share * histogram_bin_data.bin_heights[bin_id];
+        interval.second[histogram_id].distinct_count = share * histogram_bin_data.bin_distinct_counts[bin_id];
+      }
+    }
+  }
+
+  return intervals;
+}
+
+/**
+ * Groups consecutive intervals into bins with about the same number of distinct values. If the total height exceeds
+ * what HistogramCountType can hold, all heights are scaled down.
+ */
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> histogram_from_intervals(const std::vector<WeightedInterval<T>>& intervals,
+                                                              const BinID max_bin_count) {
+  auto total_height = 0.0;
+  auto total_distinct_count = 0.0;
+  for (const auto& interval : intervals) {
+    if (interval.height <= 0.0) continue;
+    total_height += interval.height;
+    total_distinct_count += interval.distinct_count;
+  }
+
+  if (total_height == 0.0) return nullptr;
+
+  const auto height_factor =
+      std::min(1.0, static_cast<double>(std::numeric_limits<HistogramCountType>::max()) / 2.0 / total_height);
+  const auto distinct_count_per_bin = std::max(1.0, total_distinct_count / static_cast<double>(max_bin_count));
+
+  auto bin_minima = std::vector<T>{};
+  auto bin_maxima = std::vector<T>{};
+  auto bin_heights = std::vector<HistogramCountType>{};
+  auto bin_distinct_counts = std::vector<HistogramCountType>{};
+
+  auto bin_height = 0.0;
+  auto bin_distinct_count = 0.0;
+  const auto close_bin = [&](const T maximum) {
+    bin_maxima.emplace_back(maximum);
+    bin_heights.emplace_back(static_cast<HistogramCountType>(std::max(1.0, std::round(bin_height * height_factor))));
+    bin_distinct_counts.emplace_back(static_cast<HistogramCountType>(std::max(1.0, std::round(bin_distinct_count))));
+    bin_height = 0.0;
+    bin_distinct_count = 0.0;
+  };
+
+  for (const auto& interval : intervals) {
+    if (interval.height <= 0.0) continue;
+
+    if (bin_minima.size() == bin_maxima.size()) bin_minima.emplace_back(interval.minimum);
+    bin_height += interval.height;
+    bin_distinct_count += interval.distinct_count;
+
+    if (bin_distinct_count >= distinct_count_per_bin) close_bin(interval.maximum);
+  }
+
+  if (bin_minima.size() > bin_maxima.size()) {
+    const auto last_interval = std::find_if(intervals.crbegin(), intervals.crend(),
+                                            [](const auto& interval) { return interval.height > 0.0; });
+    close_bin(last_interval->maximum);
+  }
+
+  return std::make_shared<GenericHistogram<T>>(std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+                                               std::move(bin_distinct_counts));
+}
+
+}  // namespace
+
+namespace opossum {
+
+using namespace opossum::histogram;  // NOLINT
+
+template <typename T>
+GenericHistogram<T>::GenericHistogram(std::vector<T>&& bin_minima, std::vector<T>&& bin_maxima,
+                                      std::vector<HistogramCountType>&& bin_heights,
+                                      std::vector<HistogramCountType>&& bin_distinct_counts)
+    : AbstractHistogram<T>(),
+      _bin_data(
+          {std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights), std::move(bin_distinct_counts)}) {
+  Assert(!_bin_data.bin_minima.empty(), "Cannot have histogram without any bins.");
+  Assert(_bin_data.bin_minima.size() == _bin_data.bin_maxima.size(),
+         "Must have the same number of lower as upper bin edges.");
+  Assert(_bin_data.bin_minima.size() == _bin_data.bin_heights.size(),
+         "Must have the same number of edges and heights.");
+  Assert(_bin_data.bin_minima.size() == _bin_data.bin_distinct_counts.size(),
+         "Must have the same number of edges and distinct counts.");
+
+  for (BinID bin_id = 0; bin_id < _bin_data.bin_minima.size(); bin_id++) {
+    Assert(_bin_data.bin_heights[bin_id] > 0, "Cannot have empty bins.");
+    Assert(_bin_data.bin_distinct_counts[bin_id] > 0, "Cannot have bins with no distinct values.");
+    Assert(_bin_data.bin_minima[bin_id] <= _bin_data.bin_maxima[bin_id], "Cannot have overlapping bins.");
+
+    if (bin_id < _bin_data.bin_maxima.size() - 1) {
+      Assert(_bin_data.bin_maxima[bin_id] < _bin_data.bin_minima[bin_id + 1],
+             "Bins must be sorted and cannot overlap.");
+    }
+  }
+}
+
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::from_value_distribution(
+    const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count) {
+  const auto value_count = std::accumulate(value_counts.cbegin(), value_counts.cend(), 0.0,
+                                           [](const double sum, const auto& value_count) {
+                                             return sum + value_count.second;
+                                           });
+  return from_sample(value_counts, max_bin_count, value_count, static_cast<double>(value_counts.size()));
+}
+
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::from_sample(
+    const std::vector<std::pair<T, HistogramCountType>>& sampled_value_counts, const BinID max_bin_count,
+    const double value_count, const double distinct_count) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    Fail("GenericHistograms are not yet supported for strings.");
+  } else {
+    if (sampled_value_counts.empty()) return nullptr;
+
+    auto sampled_value_count = 0.0;
+    for (const auto& value_count_pair : sampled_value_counts) {
+      sampled_value_count += value_count_pair.second;
+    }
+
+    // Each sampled value stands for height_factor values and distinct_count_factor distinct values
+    const auto height_factor = value_count / sampled_value_count;
+    const auto distinct_count_factor =
+        std::max(1.0, distinct_count / static_cast<double>(sampled_value_counts.size()));
+
+    auto intervals = std::vector<WeightedInterval<T>>{};
+    intervals.reserve(sampled_value_counts.size());
+    for (const auto& [value, count] : sampled_value_counts) {
+      intervals.emplace_back(WeightedInterval<T>{value, value, count * height_factor, distinct_count_factor});
+    }
+
+    auto histogram = histogram_from_intervals(intervals, max_bin_count);
+    if (value_count <= sampled_value_count) return histogram;
+
+    auto bin_data = histogram->_bin_data;
+    for (auto bin_id = BinID{0}; bin_id < bin_data.bin_minima.size(); ++bin_id) {
+      if (bin_id + 1 < bin_data.bin_minima.size()) {
+        bin_data.bin_maxima[bin_id] = previous_value(bin_data.bin_minima[bin_id + 1]);
+      }
+
+      // An integer range cannot hold more distinct values than its width
+      if constexpr (std::is_integral_v<T>) {
+        const auto width = interval_width(bin_data.bin_minima[bin_id], bin_data.bin_maxima[bin_id]);
+        if (width < bin_data.bin_distinct_counts[bin_id]) {
+          bin_data.bin_distinct_counts[bin_id] = static_cast<HistogramCountType>(width);
+        }
+      }
+    }
+
+    return std::make_shared<GenericHistogram<T>>(std::move(bin_data.bin_minima), std::move(bin_data.bin_maxima),
+                                                 std::move(bin_data.bin_heights),
+                                                 std::move(bin_data.bin_distinct_counts));
+  }
+}
+
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::merge(
+    const std::vector<std::shared_ptr<const GenericHistogram<T>>>& histograms, const BinID max_bin_count) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    Fail("GenericHistograms are not yet supported for strings.");
+  } else {
+    auto bin_data = std::vector<const GenericBinData<T>*>{};
+    for (const auto& histogram : histograms) {
+      if (histogram) bin_data.emplace_back(&histogram->_bin_data);
+    }
+
+    auto merged_intervals = std::vector<WeightedInterval<T>>{};
+    for (const auto& [interval, histogram_intervals] : split_into_intervals(bin_data)) {
+      auto merged_interval = interval;
+      for (const auto& histogram_interval : histogram_intervals) {
+        merged_interval.height += histogram_interval.height;
+        merged_interval.distinct_count = std::max(merged_interval.distinct_count, histogram_interval.distinct_count);
+      }
+      merged_intervals.emplace_back(merged_interval);
+    }
+
+    return histogram_from_intervals(merged_intervals, max_bin_count);
+  }
+}
+
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::sliced(
+    const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    Fail("GenericHistograms are not yet supported for strings.");
+  } else {
+    if (AbstractHistogram<T>::can_prune(predicate_type, variant_value, variant_value2)) return nullptr;
+
+    const auto value = type_cast_variant<T>(variant_value);
+    auto bin_data = GenericBinData<T>{};
+
+    // Adds the part of the bin bin_id within [minimum, maximum], which contains the given share of its values
+    const auto add_bin = [&](const BinID bin_id, const T minimum, const T maximum, const double share) {
+      auto distinct_count = std::max(1.0, std::round(share * _bin_data.bin_distinct_counts[bin_id]));
+      if constexpr (std::is_integral_v<T>) distinct_count = std::min(distinct_count, interval_width(minimum, maximum));
+
+      bin_data.bin_minima.emplace_back(minimum);
+      bin_data.bin_maxima.emplace_back(maximum);
+      bin_data.bin_heights.emplace_back(
+          static_cast<HistogramCountType>(std::max(1.0, std::round(share * _bin_data.bin_heights[bin_id]))));
+      bin_data.bin_distinct_counts.emplace_back(static_cast<HistogramCountType>(distinct_count));
+    };
+
+    switch (predicate_type) {
+      case PredicateCondition::Equals: {
+        const auto bin_id = _bin_for_value(value);
+        add_bin(bin_id, value, value, 1.0 / _bin_data.bin_distinct_counts[bin_id]);
+      } break;
+
+      case PredicateCondition::NotEquals: {
+        const auto value_bin_id = _bin_for_value(value);
+        for (auto bin_id = BinID{0}; bin_id < bin_count(); ++bin_id) {
+          const auto bin_distinct_count = _bin_data.bin_distinct_counts[bin_id];
+          if (bin_id != value_bin_id) {
+            add_bin(bin_id, _bin_data.bin_minima[bin_id], _bin_data.bin_maxima[bin_id], 1.0);
+          } else if (bin_distinct_count > 1) {
+            add_bin(bin_id, _bin_data.bin_minima[bin_id], _bin_data.bin_maxima[bin_id],
+                    1.0 - 1.0 / bin_distinct_count);
+          }
+        }
+      } break;
+
+      case PredicateCondition::LessThan:
+        // can_prune() returned false, so value is greater than the minimum of the histogram
+        return sliced(PredicateCondition::LessThanEquals, previous_value(value));
+
+      case PredicateCondition::LessThanEquals:
+        for (auto bin_id = BinID{0}; bin_id < bin_count() && _bin_data.bin_minima[bin_id] <= value; ++bin_id) {
+          if (_bin_data.bin_maxima[bin_id] <= value) {
+            add_bin(bin_id, _bin_data.bin_minima[bin_id], _bin_data.bin_maxima[bin_id], 1.0);
+          } else {
+            add_bin(bin_id, _bin_data.bin_minima[bin_id], value,
+                    AbstractHistogram<T>::_share_of_bin_less_than_value(bin_id, next_value(value)));
+          }
+        }
+        break;
+
+      case PredicateCondition::GreaterThan:
+        // can_prune() returned false, so value is smaller than the maximum of the histogram
+        return sliced(PredicateCondition::GreaterThanEquals, next_value(value));
+
+      case PredicateCondition::GreaterThanEquals:
+        for (auto bin_id = BinID{0}; bin_id < bin_count(); ++bin_id) {
+          if (_bin_data.bin_maxima[bin_id] < value) continue;
+
+          if (_bin_data.bin_minima[bin_id] >= value) {
+            add_bin(bin_id, _bin_data.bin_minima[bin_id], _bin_data.bin_maxima[bin_id], 1.0);
+          } else {
+            add_bin(bin_id, value, _bin_data.bin_maxima[bin_id],
+                    1.0 - AbstractHistogram<T>::_share_of_bin_less_than_value(bin_id, value));
+          }
+        }
+        break;
+
+      case PredicateCondition::Between: {
+        Assert(static_cast<bool>(variant_value2), "Between operator needs two values.");
+        const auto lower_sliced_histogram = sliced(PredicateCondition::GreaterThanEquals, variant_value);
+        return lower_sliced_histogram
+                   ? lower_sliced_histogram->sliced(PredicateCondition::LessThanEquals, *variant_value2)
+                   : nullptr;
+      }
+
+      default:
+        Fail("Predicate type not supported for slicing histograms.");
+    }
+
+    if (bin_data.bin_minima.empty()) return nullptr;
+
+    return std::make_shared<GenericHistogram<T>>(std::move(bin_data.bin_minima), std::move(bin_data.bin_maxima),
+                                                 std::move(bin_data.bin_heights),
+                                                 std::move(bin_data.bin_distinct_counts));
+  }
+}
+
+template <typename T>
+std::pair<float, std::shared_ptr<GenericHistogram<T>>> GenericHistogram<T>::estimate_equi_join(
+    const GenericHistogram<T>& right) const {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    Fail("GenericHistograms are not yet supported for strings.");
+  } else {
+    auto cardinality = 0.0;
+    auto joined_intervals = std::vector<WeightedInterval<T>>{};
+
+    for (const auto& [interval, histogram_intervals] : split_into_intervals<T>({&_bin_data, &right._bin_data})) {
+      const auto& left_interval = histogram_intervals[0];
+      const auto& right_interval = histogram_intervals[1];
+      if (left_interval.height <= 0.0 || right_interval.height <= 0.0) continue;
+
+      const auto max_distinct_count = std::max({1.0, left_interval.distinct_count, right_interval.distinct_count});
+      const auto joined_height = left_interval.height * right_interval.height / max_distinct_count;
+      const auto joined_distinct_count = std::min(left_interval.distinct_count, right_interval.distinct_count);
+
+      joined_intervals.emplace_back(
+          WeightedInterval<T>{interval.minimum, interval.maximum, joined_height, joined_distinct_count});
+      cardinality += joined_height;
+    }
+
+    return {static_cast<float>(cardinality),
+            histogram_from_intervals(joined_intervals, std::max(bin_count(), right.bin_count()))};
+  }
+}
+
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> GenericHistogram<T>::without_duplicates() const {
+  auto bin_minima = _bin_data.bin_minima;
+  auto bin_maxima = _bin_data.bin_maxima;
+  auto bin_heights = _bin_data.bin_distinct_counts;
+  auto bin_distinct_counts = _bin_data.bin_distinct_counts;
+  return std::make_shared<GenericHistogram<T>>(std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+                                               std::move(bin_distinct_counts));
+}
+
+template <typename T>
+HistogramType GenericHistogram<T>::histogram_type() const {
+  return HistogramType::Generic;
+}
+
+template <typename T>
+std::string GenericHistogram<T>::histogram_name() const {
+  return "Generic";
+}
+
+template <typename T>
+BinID GenericHistogram<T>::bin_count() const {
+  return _bin_data.bin_heights.size();
+}
+
+template <typename T>
+const GenericBinData<T>& GenericHistogram<T>::bin_data() const {
+  return _bin_data;
+}
+
+template <typename T>
+BinID GenericHistogram<T>::_bin_for_value(const T& value) const {
+  const auto it = std::lower_bound(_bin_data.bin_maxima.cbegin(), _bin_data.bin_maxima.cend(), value);
+  const auto index = static_cast<BinID>(std::distance(_bin_data.bin_maxima.cbegin(), it));
+
+  if (it == _bin_data.bin_maxima.cend() || value < _bin_minimum(index) || value > _bin_maximum(index)) {
+    return INVALID_BIN_ID;
+  }
+
+  return index;
+}
+
+template <typename T>
+BinID GenericHistogram<T>::_next_bin_for_value(const T& value) const {
+  const auto it = std::upper_bound(_bin_data.bin_maxima.cbegin(), _bin_data.bin_maxima.cend(), value);
+
+  if (it == _bin_data.bin_maxima.cend()) {
+    return INVALID_BIN_ID;
+  }
+
+  return static_cast<BinID>(std::distance(_bin_data.bin_maxima.cbegin(), it));
+}
+
+template <typename T>
+T GenericHistogram<T>::_bin_minimum(const BinID index) const {
+  DebugAssert(index < _bin_data.bin_minima.size(), "Index is not a valid bin.");
+  return _bin_data.bin_minima[index];
+}
+
+template <typename T>
+T GenericHistogram<T>::_bin_maximum(const BinID index) const {
+  DebugAssert(index < _bin_data.bin_maxima.size(), "Index is not a valid bin.");
+  return _bin_data.bin_maxima[index];
+}
+
+template <typename T>
+HistogramCountType GenericHistogram<T>::_bin_height(const BinID index) const {
+  DebugAssert(index < _bin_data.bin_heights.size(), "Index is not a valid bin.");
+  return _bin_data.bin_heights[index];
+}
+
+template <typename T>
+HistogramCountType GenericHistogram<T>::_bin_distinct_count(const BinID index) const {
+  DebugAssert(index < _bin_data.bin_distinct_counts.size(), "Index is not a valid bin.");
+  return _bin_data.bin_distinct_counts[index];
+}
+
+template <typename T>
+HistogramCountType GenericHistogram<T>::total_count() const {
+  return std::accumulate(_bin_data.bin_heights.cbegin(), _bin_data.bin_heights.cend(), HistogramCountType{0});
+}
+
+template <typename T>
+HistogramCountType GenericHistogram<T>::total_distinct_count() const {
+  return std::accumulate(_bin_data.bin_distinct_counts.cbegin(), _bin_data.bin_distinct_counts.cend(),
+                         HistogramCountType{0});
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(GenericHistogram);
+
+}  // namespace opossum
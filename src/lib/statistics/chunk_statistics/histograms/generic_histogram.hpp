@@ -0,0 +1,116 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_histogram.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * We use multiple vectors rather than a vector of structs for ease-of-use with STL library functions.
+ */
+template <typename T>
+struct GenericBinData {
+  // Min values on a per-bin basis.
+  std::vector<T> bin_minima;
+
+  // Max values on a per-bin basis.
+  std::vector<T> bin_maxima;
+
+  // Number of values on a per-bin basis.
+  std::vector<HistogramCountType> bin_heights;
+
+  // Number of distinct values on a per-bin basis.
+  std::vector<HistogramCountType> bin_distinct_counts;
+};
+
+/**
+ * Histogram with arbitrary bins, each with its own height and distinct count. It is the table-level histogram of
+ * ColumnStatistics: every chunk (or a sample of it) is summarized in a GenericHistogram, and these per-chunk histograms
+ * are merged into one for the table. During cardinality estimation, predicates slice the histogram and joins combine
+ * the histograms of both join columns, so that the distribution of the values is known in later estimations as well.
+ *
+ * There might be gaps between bins. Merging, slicing, and joining are not yet supported for strings.
+ */
+template <typename T>
+class GenericHistogram : public AbstractHistogram<T> {
+ public:
+  using AbstractHistogram<T>::AbstractHistogram;
+  GenericHistogram(std::vector<T>&& bin_minima, std::vector<T>&& bin_maxima,
+                   std::vector<HistogramCountType>&& bin_heights,
+                   std::vector<HistogramCountType>&& bin_distinct_counts);
+
+  /**
+   * Create a histogram with bins that contain roughly the same number of distinct values, given a list of pairs of
+   * distinct values and their respective number of occurrences, sorted by value.
+   */
+  static std::shared_ptr<GenericHistogram<T>> from_value_distribution(
+      const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count);
+
+  /**
+   * Like from_value_distribution(), but the value counts stem from a sample of value_count values with an estimated
+   * distinct_count distinct values. The heights and distinct counts of the bins are scaled up accordingly. If the
+   * sample does not contain all values, the bins are widened to close the gaps between them, as values that were not
+   * sampled may lie there.
+   */
+  static std::shared_ptr<GenericHistogram<T>> from_sample(
+      const std::vector<std::pair<T, HistogramCountType>>& sampled_value_counts, const BinID max_bin_count,
+      const double value_count, const double distinct_count);
+
+  /**
+   * Merge histograms of disjoint sets of rows (e.g., of different chunks) into a histogram of all of them with at most
+   * about max_bin_count bins. Bins are split where the bins of the other histograms begin or end, assuming that the
+   * values are uniformly distributed within each bin. Where bins of different histograms overlap, the histogram with
+   * more distinct values is assumed to contain the distinct values of the others.
+   */
+  static std::shared_ptr<GenericHistogram<T>> merge(
+      const std::vector<std::shared_ptr<const GenericHistogram<T>>>& histograms, const BinID max_bin_count);
+
+  /**
+   * Returns the histogram of the values that satisfy the predicate, or nullptr if no values are expected to satisfy
+   * it. Supports (Not)Equals, LessThan(Equals), GreaterThan(Equals), and Between.
+   */
+  std::shared_ptr<GenericHistogram<T>> sliced(const PredicateCondition predicate_type,
+                                              const AllTypeVariant& variant_value,
+                                              const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  /**
+   * Estimates the number of rows of an equi-join between the values of this histogram and those of right. Within
+   * overlapping parts of bins, each distinct value of the side with fewer distinct values is assumed to find its
+   * partners on the other side. Also returns the histogram of the join column in the result, or nullptr if no rows are
+   * expected. If necessary, its heights are scaled down so that they do not overflow HistogramCountType.
+   */
+  std::pair<float, std::shared_ptr<GenericHistogram<T>>> estimate_equi_join(const GenericHistogram<T>& right) const;
+
+  /**
+   * Returns the histogram of the distinct values, i.e., with each value occurring once (e.g., after a GROUP BY).
+   */
+  std::shared_ptr<GenericHistogram<T>> without_duplicates() const;
+
+  HistogramType histogram_type() const override;
+  std::string histogram_name() const override;
+  HistogramCountType total_distinct_count() const override;
+  HistogramCountType total_count() const override;
+  BinID bin_count() const override;
+
+  const GenericBinData<T>& bin_data() const;
+
+ protected:
+  BinID _bin_for_value(const T& value) const override;
+  BinID _next_bin_for_value(const T& value) const override;
+
+  T _bin_minimum(const BinID index) const override;
+  T _bin_maximum(const BinID index) const override;
+  HistogramCountType _bin_height(const BinID index) const override;
+  HistogramCountType _bin_distinct_count(const BinID index) const override;
+
+ private:
+  const GenericBinData<T> _bin_data;
+};
+
+}  // namespace opossum
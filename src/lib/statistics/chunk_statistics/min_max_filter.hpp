@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "abstract_filter.hpp"
 #include "all_type_variant.hpp"
 #include "type_cast.hpp"
@@ -16,6 +18,9 @@ class MinMaxFilter : public AbstractFilter {
   explicit MinMaxFilter(T min, T max) : _min(min), _max(max) {}
   ~MinMaxFilter() override = default;
 
+  const T& min() const { return _min; }
+  const T& max() const { return _max; }
+
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
     // Early exit for NULL variants.
@@ -24,28 +29,36 @@ class MinMaxFilter : public AbstractFilter {
     }
 
     const auto value = type_cast_variant<T>(variant_value);
+    auto value2 = std::optional<T>{};
+    if (predicate_type == PredicateCondition::Between) {
+      Assert(static_cast<bool>(variant_value2), "Between operator needs two values.");
+      value2 = type_cast_variant<T>(*variant_value2);
+    }
+
+    return can_prune_min_max(_min, _max, predicate_type, value, value2);
+  }
 
+  // Returns true if no value between min and max can satisfy the predicate. Also used by BlockMinMaxFilter.
+  static bool can_prune_min_max(const T& min, const T& max, const PredicateCondition predicate_type, const T& value,
+                                const std::optional<T>& value2) {
     // Operators work as follows: value_from_table <operator> value
     // e.g. OpGreaterThan: value_from_table > value
-    // thus we can exclude chunk if value >= _max since then no value from the table can be greater than value
+    // thus we can exclude chunk if value >= max since then no value from the table can be greater than value
     switch (predicate_type) {
       case PredicateCondition::GreaterThan:
-        return value >= _max;
+        return value >= max;
       case PredicateCondition::GreaterThanEquals:
-        return value > _max;
+        return value > max;
       case PredicateCondition::LessThan:
-        return value <= _min;
+        return value <= min;
       case PredicateCondition::LessThanEquals:
-        return value < _min;
+        return value < min;
       case PredicateCondition::Equals:
-        return value < _min || value > _max;
+        return value < min || value > max;
       case PredicateCondition::NotEquals:
-        return value == _min && value == _max;
-      case PredicateCondition::Between: {
-        Assert(static_cast<bool>(variant_value2), "Between operator needs two values.");
-        const auto value2 = type_cast_variant<T>(*variant_value2);
-        return value > _max || value2 < _min;
-      }
+        return value == min && value == max;
+      case PredicateCondition::Between:
+        return value > max || *value2 < min;
       default:
         return false;
     }
@@ -29,6 +29,8 @@ class RangeFilter : public AbstractFilter {
   static std::unique_ptr<RangeFilter<T>> build_filter(const pmr_vector<T>& dictionary,
                                                       uint32_t max_ranges_count = MAX_RANGES_COUNT);
 
+  const std::vector<std::pair<T, T>>& ranges() const { return _ranges; }
+
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
     /*
@@ -8,20 +8,49 @@
 #include "resolve_type.hpp"
 
 #include "abstract_filter.hpp"
+#include "block_min_max_filter.hpp"
+#include "blocked_bloom_filter.hpp"
 #include "min_max_filter.hpp"
 #include "range_filter.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+static SegmentStatistics::MembershipFilterSettings membership_filter_settings_instance;
+
+// Adds a BlockedBloomFilter if the other filters cannot prune all values that do not occur in the segment and if the
+// filter is small enough, see SegmentStatistics::MembershipFilterSettings
+template <typename T>
+static void add_membership_filter(SegmentStatistics& statistics, const pmr_vector<T>& dictionary,
+                                  const size_t row_count) {
+  const auto& settings = SegmentStatistics::membership_filter_settings();
+  if (settings.false_positive_rate <= 0.0) return;
+
+  // A RangeFilter with one range per value and a MinMaxFilter with the only two values are exact
+  const auto exactly_filtered_value_count = std::is_arithmetic_v<T> ? size_t{MAX_RANGES_COUNT} : size_t{2};
+  if (dictionary.size() <= exactly_filtered_value_count) return;
+
+  const auto bits_per_value = BaseBlockedBloomFilter::bits_per_value_for_false_positive_rate(
+      std::min(settings.false_positive_rate, 0.5));
+  if (bits_per_value * static_cast<double>(dictionary.size()) >
+      settings.max_bits_per_row * static_cast<double>(row_count)) {
+    return;
+  }
+
+  statistics.add_filter(BlockedBloomFilter<T>::build_filter(dictionary, bits_per_value));
+}
+
 template <typename T>
-static std::shared_ptr<SegmentStatistics> build_statistics_from_dictionary(const pmr_vector<T>& dictionary) {
+static std::shared_ptr<SegmentStatistics> build_statistics_from_dictionary(const pmr_vector<T>& dictionary,
+                                                                           const size_t row_count) {
   auto statistics = std::make_shared<SegmentStatistics>();
   // only create statistics when the compressed dictionary is not empty
   if (!dictionary.empty()) {
@@ -36,10 +65,65 @@ static std::shared_ptr<SegmentStatistics> build_statistics_from_dictionary(const
       statistics->add_filter(std::move(min_max_filter));
     }
     // clang-format on
+    add_membership_filter(*statistics, dictionary, row_count);
   }
   return statistics;
 }
 
+// Extends the range of the block of chunk_offset by value
+template <typename T>
+static void add_to_block_ranges(typename BlockMinMaxFilter<T>::BlockRanges& block_ranges,
+                                const ChunkOffset chunk_offset, const T& value) {
+  auto& block_range = block_ranges[chunk_offset / BaseBlockMinMaxFilter::BLOCK_SIZE];
+  if (!block_range) {
+    block_range.emplace(value, value);
+  } else if (value < block_range->first) {
+    block_range->first = value;
+  } else if (value > block_range->second) {
+    block_range->second = value;
+  }
+}
+
+// Builds the ranges of the blocks on the ValueIDs, which are ordered like the values, and looks up the values once
+template <typename T>
+static std::shared_ptr<BlockMinMaxFilter<T>> build_block_min_max_filter(const DictionarySegment<T>& segment) {
+  const auto block_count = (segment.size() + BaseBlockMinMaxFilter::BLOCK_SIZE - 1) / BaseBlockMinMaxFilter::BLOCK_SIZE;
+  auto value_id_ranges = typename BlockMinMaxFilter<ValueID>::BlockRanges(block_count);
+  const auto null_value_id = segment.null_value_id();
+  resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    auto chunk_offset = ChunkOffset{0};
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+         ++value_id_it, ++chunk_offset) {
+      const auto value_id = ValueID{*value_id_it};
+      if (value_id != null_value_id) add_to_block_ranges(value_id_ranges, chunk_offset, value_id);
+    }
+  });
+
+  const auto& dictionary = *segment.dictionary();
+  auto block_ranges = typename BlockMinMaxFilter<T>::BlockRanges(block_count);
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto& value_id_range = value_id_ranges[block_index];
+    if (value_id_range) block_ranges[block_index].emplace(dictionary[value_id_range->first],
+                                                          dictionary[value_id_range->second]);
+  }
+  return std::make_shared<BlockMinMaxFilter<T>>(static_cast<ChunkOffset>(segment.size()), std::move(block_ranges));
+}
+
+template <typename SegmentType>
+struct IsDeltaSegment : std::false_type {};
+
+template <typename T>
+struct IsDeltaSegment<DeltaSegment<T>> : std::true_type {};
+
+// Delta segments know whether their values are sorted
+template <typename SegmentType>
+static bool segment_is_ascending(const SegmentType& segment) {
+  if constexpr (IsDeltaSegment<SegmentType>::value) {
+    return segment.is_ascending();
+  }
+  return false;
+}
+
 std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
     DataType data_type, const std::shared_ptr<const BaseSegment>& segment) {
   std::shared_ptr<SegmentStatistics> statistics;
@@ -48,32 +132,79 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
     using SegmentType = std::decay_t<decltype(typed_segment)>;
     using DataTypeT = typename decltype(type)::type;
 
+    const auto has_blocks = typed_segment.size() > BaseBlockMinMaxFilter::BLOCK_SIZE;
+
     // clang-format off
     if constexpr(std::is_same_v<SegmentType, DictionarySegment<DataTypeT>>) {
         // we can use the fact that dictionary segments have an accessor for the dictionary
         const auto& dictionary = *typed_segment.dictionary();
-        statistics = build_statistics_from_dictionary(dictionary);
+        statistics = build_statistics_from_dictionary(dictionary, typed_segment.size());
+        if (has_blocks) statistics->set_block_min_max_filter(build_block_min_max_filter(typed_segment));
     } else {
       // if we have a generic segment we create the dictionary ourselves
       auto iterable = create_iterable_from_segment<DataTypeT>(typed_segment);
-      std::unordered_set<DataTypeT> values;
-      iterable.for_each([&](const auto& position) {
-        // we are only interested in non-null values
-        if (!position.is_null()) {
-          values.insert(position.value());
-        }
-      });
-      pmr_vector<DataTypeT> dictionary{values.cbegin(), values.cend()};
-      std::sort(dictionary.begin(), dictionary.end());
-      statistics = build_statistics_from_dictionary(dictionary);
+      pmr_vector<DataTypeT> dictionary;
+
+      // the ranges of the blocks are collected in the same pass
+      auto block_ranges = typename BlockMinMaxFilter<DataTypeT>::BlockRanges{};
+      if (has_blocks) {
+        block_ranges.resize((typed_segment.size() + BaseBlockMinMaxFilter::BLOCK_SIZE - 1) /
+                            BaseBlockMinMaxFilter::BLOCK_SIZE);
+      }
+
+      if (segment_is_ascending(typed_segment)) {
+        // equal values are adjacent in sorted segments, so that they need neither hashing nor sorting
+        iterable.for_each([&](const auto& position) {
+          if (position.is_null()) return;
+          if (has_blocks) add_to_block_ranges(block_ranges, position.chunk_offset(), position.value());
+          if (dictionary.empty() || dictionary.back() != position.value()) {
+            dictionary.push_back(position.value());
+          }
+        });
+      } else {
+        std::unordered_set<DataTypeT> values;
+        iterable.for_each([&](const auto& position) {
+          // we are only interested in non-null values
+          if (!position.is_null()) {
+            values.insert(position.value());
+            if (has_blocks) add_to_block_ranges(block_ranges, position.chunk_offset(), position.value());
+          }
+        });
+        dictionary = pmr_vector<DataTypeT>{values.cbegin(), values.cend()};
+        std::sort(dictionary.begin(), dictionary.end());
+      }
+      statistics = build_statistics_from_dictionary(dictionary, typed_segment.size());
+      if (has_blocks) {
+        statistics->set_block_min_max_filter(std::make_shared<BlockMinMaxFilter<DataTypeT>>(
+            static_cast<ChunkOffset>(typed_segment.size()), std::move(block_ranges)));
+      }
     }
     // clang-format on
   });
   return statistics;
 }
 
+void SegmentStatistics::set_membership_filter_settings(const MembershipFilterSettings& settings) {
+  membership_filter_settings_instance = settings;
+}
+
+const SegmentStatistics::MembershipFilterSettings& SegmentStatistics::membership_filter_settings() {
+  return membership_filter_settings_instance;
+}
+
 void SegmentStatistics::add_filter(std::shared_ptr<AbstractFilter> filter) { _filters.emplace_back(filter); }
 
+const std::vector<std::shared_ptr<AbstractFilter>>& SegmentStatistics::filters() const { return _filters; }
+
+void SegmentStatistics::set_block_min_max_filter(
+    const std::shared_ptr<const BaseBlockMinMaxFilter>& block_min_max_filter) {
+  _block_min_max_filter = block_min_max_filter;
+}
+
+const std::shared_ptr<const BaseBlockMinMaxFilter>& SegmentStatistics::block_min_max_filter() const {
+  return _block_min_max_filter;
+}
+
 bool SegmentStatistics::can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) const {
   for (const auto& filter : _filters) {
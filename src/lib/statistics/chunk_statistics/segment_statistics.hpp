@@ -10,6 +10,7 @@
 
 namespace opossum {
 
+class BaseBlockMinMaxFilter;
 class BaseSegment;
 
 /**
@@ -18,10 +19,26 @@ class BaseSegment;
  */
 class SegmentStatistics final {
  public:
+  /**
+   * Equality predicates on values that lie within the range of a segment but do not occur in it are pruned by a
+   * BlockedBloomFilter. It is sized for the false_positive_rate, but only built if it needs at most max_bits_per_row
+   * bits per row of the segment. Thus, segments with mostly distinct values, for which the filter would be almost as
+   * large as the data, do not get one. A false_positive_rate of 0 disables the filter. The settings must not be
+   * changed while statistics are built.
+   */
+  struct MembershipFilterSettings {
+    double false_positive_rate{0.01};
+    double max_bits_per_row{2.0};
+  };
+
+  static void set_membership_filter_settings(const MembershipFilterSettings& settings);
+  static const MembershipFilterSettings& membership_filter_settings();
+
   static std::shared_ptr<SegmentStatistics> build_statistics(DataType data_type,
                                                              const std::shared_ptr<const BaseSegment>& segment);
 
   void add_filter(std::shared_ptr<AbstractFilter> filter);
+  const std::vector<std::shared_ptr<AbstractFilter>>& filters() const;
 
   /**
    * calls can_prune on each filter in this object
@@ -29,7 +46,15 @@ class SegmentStatistics final {
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * The minimum and maximum of each block of the segment, which scans use to skip blocks. Only built for segments with
+   * more than one block, nullptr otherwise. It is not used by can_prune().
+   */
+  void set_block_min_max_filter(const std::shared_ptr<const BaseBlockMinMaxFilter>& block_min_max_filter);
+  const std::shared_ptr<const BaseBlockMinMaxFilter>& block_min_max_filter() const;
+
  protected:
   std::vector<std::shared_ptr<AbstractFilter>> _filters;
+  std::shared_ptr<const BaseBlockMinMaxFilter> _block_min_max_filter;
 };
 }  // namespace opossum
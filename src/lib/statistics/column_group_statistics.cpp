@@ -0,0 +1,262 @@
+#include "column_group_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The conditions of ColumnGroupPredicates on a single column, aggregated into the range of values they accept
+struct ColumnFilter {
+  double lower{-std::numeric_limits<double>::infinity()};
+  double upper{std::numeric_limits<double>::infinity()};
+  std::optional<double> equals;
+  size_t not_equals_count{0};
+
+  // Whether the predicates only accept NULL or only non-NULL values, respectively
+  bool is_null{false};
+  bool is_not_null{false};
+
+  bool is_empty{false};
+};
+
+// Returns false if the predicate is not supported
+bool add_to_filter(ColumnFilter& filter, const ColumnGroupPredicate& predicate) {
+  const auto condition = predicate.predicate_condition;
+  if (condition == PredicateCondition::IsNull) {
+    filter.is_null = true;
+    return true;
+  }
+
+  filter.is_not_null = true;
+  if (condition == PredicateCondition::IsNotNull) return true;
+
+  const auto value = ColumnGroupStatistics::to_numeric(predicate.value);
+  const auto value2 = predicate.value2 ? ColumnGroupStatistics::to_numeric(*predicate.value2) : std::nullopt;
+
+  // Comparisons with NULL never match
+  if (!value || (predicate.value2 && !value2)) {
+    filter.is_empty = true;
+    return true;
+  }
+
+  switch (condition) {
+    case PredicateCondition::Equals:
+      if (filter.equals && *filter.equals != *value) filter.is_empty = true;
+      filter.equals = *value;
+      return true;
+    case PredicateCondition::NotEquals:
+      ++filter.not_equals_count;
+      return true;
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      filter.upper = std::min(filter.upper, *value);
+      return true;
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      filter.lower = std::max(filter.lower, *value);
+      return true;
+    case PredicateCondition::Between:
+      if (!value2) return false;
+      filter.lower = std::max(filter.lower, *value);
+      filter.upper = std::min(filter.upper, *value2);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Fraction of the rows in [lower_bound, upper_bound] with distinct_count distinct values that the filter accepts
+float filter_fraction(const ColumnFilter& filter, const double lower_bound, const double upper_bound,
+                      const float distinct_count) {
+  auto fraction = 0.0;
+  if (filter.equals) {
+    const auto value = *filter.equals;
+    const auto in_bucket = value >= lower_bound && value <= upper_bound;
+    const auto in_range = value >= filter.lower && value <= filter.upper;
+    fraction = in_bucket && in_range ? 1.0 / distinct_count : 0.0;
+  } else if (upper_bound == lower_bound) {
+    fraction = lower_bound >= filter.lower && lower_bound <= filter.upper ? 1.0 : 0.0;
+  } else {
+    const auto overlap = std::min(upper_bound, filter.upper) - std::max(lower_bound, filter.lower);
+    fraction = std::clamp(overlap / (upper_bound - lower_bound), 0.0, 1.0);
+  }
+
+  fraction *= std::pow(std::max(0.0, 1.0 - 1.0 / distinct_count), filter.not_equals_count);
+  return static_cast<float>(fraction);
+}
+
+// Fraction of the combinations of values from [lower_bound_a, upper_bound_a] and [lower_bound_b, upper_bound_b] for
+// which `a <predicate_condition> b` holds
+float comparison_fraction(const PredicateCondition predicate_condition, const double lower_bound_a,
+                          const double upper_bound_a, const float distinct_count_a, const double lower_bound_b,
+                          const double upper_bound_b, const float distinct_count_b) {
+  const auto overlaps = std::max(lower_bound_a, lower_bound_b) <= std::min(upper_bound_a, upper_bound_b);
+  const auto equals_fraction = overlaps ? 1.0f / std::max(distinct_count_a, distinct_count_b) : 0.0f;
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return equals_fraction;
+    case PredicateCondition::NotEquals:
+      return 1.0f - equals_fraction;
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals: {
+      if (upper_bound_a < lower_bound_b) return 1.0f;
+      if (lower_bound_a > upper_bound_b) return 0.0f;
+      const auto is_single_value = lower_bound_a == upper_bound_a && lower_bound_b == upper_bound_b;
+      if (is_single_value) return predicate_condition == PredicateCondition::LessThanEquals ? 1.0f : 0.0f;
+      return 0.5f;
+    }
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return comparison_fraction(flip_predicate_condition(predicate_condition), lower_bound_b, upper_bound_b,
+                                 distinct_count_b, lower_bound_a, upper_bound_a, distinct_count_a);
+    default:
+      Fail("Unsupported comparison of columns");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+ColumnGroupStatistics::ColumnGroupStatistics(const float row_count, const float distinct_count,
+                                             const std::array<std::vector<double>, 2>& bucket_bounds,
+                                             const std::array<std::vector<float>, 2>& bucket_distinct_counts,
+                                             const std::vector<float>& cell_row_counts)
+    : _row_count(row_count),
+      _distinct_count(distinct_count),
+      _bucket_bounds(bucket_bounds),
+      _bucket_distinct_counts(bucket_distinct_counts),
+      _cell_row_counts(cell_row_counts) {
+  for (auto column_index = size_t{0}; column_index < 2; ++column_index) {
+    Assert(_bucket_distinct_counts[column_index].size() == _bucket_count(column_index),
+           "Expected a distinct count for each bucket");
+  }
+  Assert(_cell_row_counts.size() == (_bucket_count(0) + 1) * (_bucket_count(1) + 1),
+         "Expected a row count for each combination of buckets, including the NULL buckets");
+}
+
+float ColumnGroupStatistics::row_count() const { return _row_count; }
+
+float ColumnGroupStatistics::distinct_count() const { return _distinct_count; }
+
+std::optional<float> ColumnGroupStatistics::estimate_selectivity(
+    const std::vector<ColumnGroupPredicate>& predicates) const {
+  if (_row_count == 0.0f) return 0.0f;
+
+  auto filters = std::array<ColumnFilter, 2>{};
+  auto comparisons = std::vector<PredicateCondition>{};
+
+  for (const auto& predicate : predicates) {
+    DebugAssert(predicate.column_index < 2, "Invalid column index");
+
+    if (!predicate.compares_columns) {
+      if (!add_to_filter(filters[predicate.column_index], predicate)) return std::nullopt;
+      continue;
+    }
+
+    switch (predicate.predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        break;
+      default:
+        return std::nullopt;
+    }
+
+    // Comparisons are stored as `first column <predicate_condition> second column`
+    comparisons.emplace_back(predicate.column_index == 0 ? predicate.predicate_condition
+                                                         : flip_predicate_condition(predicate.predicate_condition));
+    filters[0].is_not_null = true;
+    filters[1].is_not_null = true;
+  }
+
+  for (const auto& filter : filters) {
+    if (filter.is_empty || (filter.is_null && filter.is_not_null)) return 0.0f;
+  }
+
+  // Fraction of each bucket (including the NULL bucket) that the filter on the respective column accepts
+  auto bucket_fractions = std::array<std::vector<float>, 2>{};
+  for (auto column_index = size_t{0}; column_index < 2; ++column_index) {
+    const auto& filter = filters[column_index];
+    const auto bucket_count = _bucket_count(column_index);
+    auto& fractions = bucket_fractions[column_index];
+    fractions.resize(bucket_count + 1);
+
+    for (auto bucket_id = size_t{0}; bucket_id < bucket_count; ++bucket_id) {
+      if (filter.is_null) continue;
+      fractions[bucket_id] =
+          filter_fraction(filter, _bucket_bounds[column_index][bucket_id], _bucket_bounds[column_index][bucket_id + 1],
+                          std::max(1.0f, _bucket_distinct_counts[column_index][bucket_id]));
+    }
+    fractions[bucket_count] = filter.is_not_null ? 0.0f : 1.0f;
+  }
+
+  const auto bucket_count_a = _bucket_count(0);
+  const auto bucket_count_b = _bucket_count(1);
+  auto matching_row_count = 0.0f;
+
+  for (auto bucket_id_a = size_t{0}; bucket_id_a <= bucket_count_a; ++bucket_id_a) {
+    if (bucket_fractions[0][bucket_id_a] == 0.0f) continue;
+
+    for (auto bucket_id_b = size_t{0}; bucket_id_b <= bucket_count_b; ++bucket_id_b) {
+      const auto cell_row_count = _cell_row_counts[bucket_id_a * (bucket_count_b + 1) + bucket_id_b];
+      auto fraction = bucket_fractions[0][bucket_id_a] * bucket_fractions[1][bucket_id_b];
+      if (cell_row_count == 0.0f || fraction == 0.0f) continue;
+
+      // Comparisons exclude the NULL buckets via the filters, so both buckets contain values here
+      for (const auto predicate_condition : comparisons) {
+        fraction *= comparison_fraction(
+            predicate_condition, _bucket_bounds[0][bucket_id_a], _bucket_bounds[0][bucket_id_a + 1],
+            std::max(1.0f, _bucket_distinct_counts[0][bucket_id_a]), _bucket_bounds[1][bucket_id_b],
+            _bucket_bounds[1][bucket_id_b + 1], std::max(1.0f, _bucket_distinct_counts[1][bucket_id_b]));
+      }
+
+      matching_row_count += cell_row_count * fraction;
+    }
+  }
+
+  return std::clamp(matching_row_count / _row_count, 0.0f, 1.0f);
+}
+
+std::optional<double> ColumnGroupStatistics::to_numeric(const AllTypeVariant& value) {
+  if (variant_is_null(value)) return std::nullopt;
+
+  if (const auto string = boost::get<pmr_string>(&value)) {
+    // Interpret the first seven characters as a base-128 number. With 49 bits, the result is exactly representable
+    // by a double, which would not be the case for eight base-256 digits. Non-ASCII characters are clamped to 127.
+    auto numeric = 0.0;
+    for (auto character_idx = size_t{0}; character_idx < 7; ++character_idx) {
+      const auto character =
+          character_idx < string->size() ? std::min(static_cast<uint8_t>((*string)[character_idx]), uint8_t{127}) : 0;
+      numeric = numeric * 128.0 + character;
+    }
+    return numeric;
+  }
+
+  return boost::apply_visitor(
+      [](const auto& typed_value) {
+        using ValueDataType = std::decay_t<decltype(typed_value)>;
+        if constexpr (std::is_arithmetic_v<ValueDataType>) {
+          return static_cast<double>(typed_value);
+        } else {
+          return 0.0;
+        }
+      },
+      value);
+}
+
+size_t ColumnGroupStatistics::_bucket_count(const size_t column_index) const {
+  return _bucket_bounds[column_index].empty() ? 0 : _bucket_bounds[column_index].size() - 1;
+}
+
+}  // namespace opossum
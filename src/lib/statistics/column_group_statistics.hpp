@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A predicate on one or both columns of a ColumnGroupStatistics. column_index (0 or 1) selects the column the
+ * predicate is on. If compares_columns is set, it compares that column with the other one of the group (e.g.,
+ * `l_commitdate < l_receiptdate`), otherwise with value (and value2 for BETWEEN).
+ */
+struct ColumnGroupPredicate {
+  size_t column_index{0};
+  PredicateCondition predicate_condition{PredicateCondition::Equals};
+  AllTypeVariant value{};
+  std::optional<AllTypeVariant> value2{};
+  bool compares_columns{false};
+};
+
+/**
+ * Statistics about the joint distribution of the values of two columns of a table. TableStatistics assume that
+ * predicates on different columns are independent, which badly underestimates, e.g., `l_shipdate < x AND
+ * l_commitdate < y` as both dates are close to each other. Where ColumnGroupStatistics exist for the predicated
+ * columns, TableStatistics use them instead (see TableStatistics::ColumnGroup).
+ *
+ * The statistics consist of
+ *  - a two-dimensional equi-depth histogram. Each column's values are split into up to BUCKET_COUNT buckets with about
+ *    the same number of (sampled) values, and the histogram stores the number of rows in each combination of buckets.
+ *    NULLs are kept in an additional bucket per column. Values are mapped to doubles by to_numeric(), which preserves
+ *    their order, so that strings (e.g., dates in TPC-H) are supported as well.
+ *  - the number of distinct combinations of values, which estimates equi-joins on both columns.
+ */
+class ColumnGroupStatistics final {
+ public:
+  static constexpr auto BUCKET_COUNT = size_t{32};
+
+  /**
+   * @param bucket_bounds       Per column, the sorted bounds of its buckets. Bucket i contains the values in
+   *                            [bucket_bounds[i], bucket_bounds[i + 1]].
+   * @param bucket_distinct_counts Per column, the number of distinct values in each bucket
+   * @param cell_row_counts     Number of rows for each combination of buckets, row-major with the first column's
+   *                            bucket as row. The last bucket of each column holds the NULLs.
+   */
+  ColumnGroupStatistics(const float row_count, const float distinct_count,
+                        const std::array<std::vector<double>, 2>& bucket_bounds,
+                        const std::array<std::vector<float>, 2>& bucket_distinct_counts,
+                        const std::vector<float>& cell_row_counts);
+
+  float row_count() const;
+
+  // Number of distinct combinations of values in rows where neither column is NULL
+  float distinct_count() const;
+
+  /**
+   * The fraction of rows that satisfies all predicates, or std::nullopt if a predicate is not supported (e.g., LIKE).
+   * Within a combination of buckets, the values are assumed to be uniformly distributed and independent.
+   */
+  std::optional<float> estimate_selectivity(const std::vector<ColumnGroupPredicate>& predicates) const;
+
+  // Maps a value to a double, preserving the order of values of the same type. Strings are mapped by their first
+  // seven characters. Returns std::nullopt for NULL.
+  static std::optional<double> to_numeric(const AllTypeVariant& value);
+
+ private:
+  size_t _bucket_count(const size_t column_index) const;
+
+  float _row_count;
+  float _distinct_count;
+  std::array<std::vector<double>, 2> _bucket_bounds;
+  std::array<std::vector<float>, 2> _bucket_distinct_counts;
+  std::vector<float> _cell_row_counts;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "column_statistics.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 #include "resolve_type.hpp"
@@ -18,15 +19,44 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+const std::shared_ptr<const GenericHistogram<ColumnDataType>>& ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
+template <typename ColumnDataType>
+void ColumnStatistics<ColumnDataType>::set_histogram(
+    const std::shared_ptr<const GenericHistogram<ColumnDataType>>& histogram) {
+  _histogram = histogram;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  column_statistics->_histogram = _histogram;
+  return column_statistics;
+}
+
+template <typename ColumnDataType>
+std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::without_duplicates() const {
+  // All NULLs form a single group
+  const auto null_value_ratio = _null_value_ratio > 0.0f ? 1.0f / (distinct_count() + 1.0f) : 0.0f;
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count(), _min, _max);
+  if (_histogram) column_statistics->_histogram = _histogram->without_duplicates();
+  return column_statistics;
 }
 
 template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_value(
     const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
     const std::optional<AllTypeVariant>& value2) const {
+  if (_histogram) {
+    const auto estimate = _estimate_predicate_with_histogram(predicate_condition, variant_value, value2);
+    if (estimate) return *estimate;
+  }
+
   const auto value = type_cast_variant<ColumnDataType>(variant_value);
 
   switch (predicate_condition) {
@@ -210,6 +240,26 @@ FilterByColumnComparisonEstimate ColumnStatistics<ColumnDataType>::estimate_pred
     return {0.f, without_null_values(), right_column_statistics.without_null_values()};
   }
 
+  // With histograms on both columns, equi-joins are estimated per range of values, which captures skewed data
+  if (predicate_condition == PredicateCondition::Equals && _histogram && right_column_statistics._histogram) {
+    const auto [cardinality, joined_histogram] = _histogram->estimate_equi_join(*right_column_statistics._histogram);
+    if (!joined_histogram) {
+      const auto empty_column_statistics = std::make_shared<ColumnStatistics>(0.0f, 0.0f, _min, _max);
+      return {0.0f, empty_column_statistics, empty_column_statistics->clone()};
+    }
+
+    const auto selectivity = cardinality / (static_cast<float>(_histogram->total_count()) *
+                                            static_cast<float>(right_column_statistics._histogram->total_count()));
+    const auto joined_distinct_count = std::min({static_cast<float>(joined_histogram->total_distinct_count()),
+                                                 distinct_count(), right_column_statistics.distinct_count()});
+
+    const auto joined_column_statistics = std::make_shared<ColumnStatistics>(
+        0.0f, joined_distinct_count, joined_histogram->minimum(), joined_histogram->maximum());
+    joined_column_statistics->_histogram = joined_histogram;
+    return {non_null_value_ratio() * right_column_statistics.non_null_value_ratio() * selectivity,
+            joined_column_statistics, joined_column_statistics->clone()};
+  }
+
   const auto overlapping_range_min = std::max(_min, right_column_statistics.min());
   const auto overlapping_range_max = std::min(_max, right_column_statistics.max());
 
@@ -354,9 +404,50 @@ std::string ColumnStatistics<ColumnDataType>::description() const {
   stream << "     min      " << _min << std::endl;
   stream << "     max      " << _max << std::endl;
   stream << "     non-null " << non_null_value_ratio() << std::endl;
+  if (_histogram) {
+    stream << "     bins     " << _histogram->bin_count() << std::endl;
+  }
   return stream.str();
 }
 
+template <typename ColumnDataType>
+std::optional<FilterByValueEstimate> ColumnStatistics<ColumnDataType>::_estimate_predicate_with_histogram(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& value2) const {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      break;
+    default:
+      return std::nullopt;
+  }
+
+  DebugAssert(predicate_condition != PredicateCondition::Between || value2,
+              "Operator BETWEEN should get two parameters, second is missing!");
+
+  const auto sliced_histogram = _histogram->sliced(predicate_condition, variant_value, value2);
+  if (!sliced_histogram) {
+    return FilterByValueEstimate{0.0f, std::make_shared<ColumnStatistics<ColumnDataType>>(0.0f, 0.0f, _min, _max)};
+  }
+
+  const auto selectivity = _histogram->estimate_cardinality(predicate_condition, variant_value, value2) /
+                           static_cast<float>(_histogram->total_count());
+
+  // The distinct counts of the histogram may differ from the column's, so only their ratio is used
+  const auto distinct_count_ratio = static_cast<float>(sliced_histogram->total_distinct_count()) /
+                                    static_cast<float>(_histogram->total_distinct_count());
+
+  const auto column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(
+      0.0f, distinct_count() * distinct_count_ratio, sliced_histogram->minimum(), sliced_histogram->maximum());
+  column_statistics->_histogram = sliced_histogram;
+  return FilterByValueEstimate{non_null_value_ratio() * selectivity, column_statistics};
+}
+
 template <typename ColumnDataType>
 float ColumnStatistics<ColumnDataType>::estimate_range_selectivity(const ColumnDataType minimum,
                                                                    const ColumnDataType maximum) const {
@@ -8,6 +8,7 @@
 #include "all_type_variant.hpp"
 #include "base_column_statistics.hpp"
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/histograms/generic_histogram.hpp"
 
 namespace opossum {
 
@@ -40,6 +41,13 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+
+  /**
+   * The distribution of the non-NULL values of the column, if known. Only its shape is relevant: the total count of
+   * the histogram does not have to match the number of rows, e.g., after predicates on other columns.
+   */
+  const std::shared_ptr<const GenericHistogram<ColumnDataType>>& histogram() const;
+  void set_histogram(const std::shared_ptr<const GenericHistogram<ColumnDataType>>& histogram);
   /** @} */
 
   /**
@@ -47,6 +55,7 @@ class ColumnStatistics : public BaseColumnStatistics {
    * @{
    */
   std::shared_ptr<BaseColumnStatistics> clone() const override;
+  std::shared_ptr<BaseColumnStatistics> without_duplicates() const override;
   FilterByValueEstimate estimate_predicate_with_value(
       const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& value2 = std::nullopt) const override;
@@ -89,8 +98,14 @@ class ColumnStatistics : public BaseColumnStatistics {
   /** @} */
 
  private:
+  // Estimates predicates that the histogram supports, returns std::nullopt for the others
+  std::optional<FilterByValueEstimate> _estimate_predicate_with_histogram(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& value2) const;
+
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const GenericHistogram<ColumnDataType>> _histogram;
 };
 
 }  // namespace opossum
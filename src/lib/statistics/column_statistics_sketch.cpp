@@ -0,0 +1,177 @@
+#include "column_statistics_sketch.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <unordered_map>
+
+#include "column_statistics.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+void ColumnStatisticsSketch<T>::add(const std::shared_ptr<const BaseSegment>& segment, const ChunkOffset begin_offset,
+                                    const ChunkOffset end_offset, const size_t sample_row_count) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= segment->size(), "Invalid range of rows");
+  const auto row_count = static_cast<size_t>(end_offset - begin_offset);
+  if (row_count == 0) return;
+
+  // Number of occurrences of each sampled value, identified by its hash
+  auto value_counts = std::unordered_map<size_t, uint32_t>{};
+  auto sampled_row_count = size_t{0};
+  auto sampled_null_count = size_t{0};
+
+  // Sampled values for the histogram, which is only built for numeric columns
+  auto sampled_value_counts = std::map<T, HistogramCountType>{};
+
+  const auto add_value = [&](const bool is_null, const T& value) {
+    ++sampled_row_count;
+    if (is_null) {
+      ++sampled_null_count;
+      return;
+    }
+
+    const auto hash = std::hash<T>{}(value);
+    ++value_counts[hash];
+    _add_hash(hash);
+    if constexpr (std::is_arithmetic_v<T>) ++sampled_value_counts[value];
+
+    if (!_min || value < *_min) _min = value;
+    if (!_max || value > *_max) _max = value;
+  };
+
+  if (row_count <= sample_row_count && begin_offset == 0 && end_offset == segment->size()) {
+    segment_iterate<T>(*segment, [&](const auto& position) { add_value(position.is_null(), position.value()); });
+  } else {
+    // Evenly spaced rows are accessed individually, so that the rest of the segment is not decoded
+    const auto accessor = create_segment_accessor<T>(segment);
+    const auto step = std::max(1.0, static_cast<double>(row_count) / static_cast<double>(sample_row_count));
+    for (auto sample_position = 0.0; sample_position < static_cast<double>(row_count); sample_position += step) {
+      const auto value = accessor->access(begin_offset + static_cast<ChunkOffset>(sample_position));
+      add_value(!value, value ? *value : T{});
+    }
+  }
+
+  const auto sampled_value_count = static_cast<double>(sampled_row_count - sampled_null_count);
+  const auto sampled_distinct_count = static_cast<double>(value_counts.size());
+  auto estimated_distinct_count = sampled_distinct_count;
+  if (sampled_row_count < row_count && sampled_value_count > 0.0) {
+    const auto value_count = sampled_value_count * static_cast<double>(row_count) / sampled_row_count;
+    const auto singleton_count = static_cast<double>(
+        std::count_if(value_counts.cbegin(), value_counts.cend(), [](const auto& entry) { return entry.second == 1; }));
+    estimated_distinct_count =
+        estimate_distinct_count_from_sample(value_count, sampled_value_count, sampled_distinct_count, singleton_count);
+  }
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (!sampled_value_counts.empty()) {
+      const auto value_count = sampled_value_count * static_cast<double>(row_count) / sampled_row_count;
+      const auto histogram =
+          GenericHistogram<T>::from_sample({sampled_value_counts.cbegin(), sampled_value_counts.cend()},
+                                           HISTOGRAM_BIN_COUNT, value_count, estimated_distinct_count);
+      _histogram = _histogram ? GenericHistogram<T>::merge({_histogram, histogram}, HISTOGRAM_BIN_COUNT) : histogram;
+    }
+  }
+
+  _row_count += row_count;
+  _sampled_row_count += sampled_row_count;
+  _sampled_null_count += sampled_null_count;
+  _sampled_distinct_count_sum += sampled_distinct_count;
+  _estimated_distinct_count_sum += estimated_distinct_count;
+}
+
+template <typename T>
+void ColumnStatisticsSketch<T>::merge(const BaseColumnStatisticsSketch& base_other) {
+  const auto& other = static_cast<const ColumnStatisticsSketch<T>&>(base_other);
+
+  for (const auto hash : other._exact_hashes) {
+    _add_hash(hash);
+  }
+  if (other._hyper_log_log) {
+    if (!_hyper_log_log) _switch_to_hyper_log_log();
+    _hyper_log_log->merge(*other._hyper_log_log);
+  }
+
+  _row_count += other._row_count;
+  _sampled_row_count += other._sampled_row_count;
+  _sampled_null_count += other._sampled_null_count;
+  _sampled_distinct_count_sum += other._sampled_distinct_count_sum;
+  _estimated_distinct_count_sum += other._estimated_distinct_count_sum;
+
+  if (other._min && (!_min || *other._min < *_min)) _min = other._min;
+  if (other._max && (!_max || *other._max > *_max)) _max = other._max;
+
+  if (other._histogram) {
+    _histogram = _histogram ? GenericHistogram<T>::merge({_histogram, other._histogram}, HISTOGRAM_BIN_COUNT)
+                            : other._histogram;
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseColumnStatistics> ColumnStatisticsSketch<T>::column_statistics() const {
+  const auto null_value_ratio =
+      _sampled_row_count > 0 ? static_cast<float>(_sampled_null_count) / static_cast<float>(_sampled_row_count) : 0.0f;
+
+  // Values that occur in several ranges are counted once in the sampled hashes, but in each range's estimate
+  auto distinct_count = _sampled_value_distinct_count();
+  if (_sampled_distinct_count_sum > 0.0) {
+    const auto unique_across_ranges_ratio = std::min(1.0, distinct_count / _sampled_distinct_count_sum);
+    distinct_count = std::max(distinct_count, _estimated_distinct_count_sum * unique_across_ranges_ratio);
+  }
+  distinct_count = std::min(distinct_count, static_cast<double>(_row_count) * (1.0 - null_value_ratio));
+
+  if (!_min) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return std::make_shared<ColumnStatistics<T>>(null_value_ratio, 0.0f, T{}, T{});
+    } else {
+      return std::make_shared<ColumnStatistics<T>>(null_value_ratio, 0.0f, std::numeric_limits<T>::min(),
+                                                   std::numeric_limits<T>::max());
+    }
+  }
+
+  const auto column_statistics =
+      std::make_shared<ColumnStatistics<T>>(null_value_ratio, static_cast<float>(distinct_count), *_min, *_max);
+  column_statistics->set_histogram(_histogram);
+  return column_statistics;
+}
+
+template <typename T>
+void ColumnStatisticsSketch<T>::_add_hash(const size_t hash) {
+  if (_hyper_log_log) {
+    _hyper_log_log->insert(hash);
+    return;
+  }
+
+  _exact_hashes.emplace(hash);
+  if (_exact_hashes.size() > EXACT_HASH_LIMIT) _switch_to_hyper_log_log();
+}
+
+template <typename T>
+void ColumnStatisticsSketch<T>::_switch_to_hyper_log_log() {
+  _hyper_log_log.emplace();
+  for (const auto hash : _exact_hashes) {
+    _hyper_log_log->insert(hash);
+  }
+  _exact_hashes = {};
+}
+
+template <typename T>
+double ColumnStatisticsSketch<T>::_sampled_value_distinct_count() const {
+  if (_hyper_log_log) return static_cast<double>(_hyper_log_log->estimate());
+  return static_cast<double>(_exact_hashes.size());
+}
+
+double estimate_distinct_count_from_sample(const double value_count, const double sampled_value_count,
+                                           const double sampled_distinct_count, const double singleton_count) {
+  if (sampled_value_count == 0.0) return 0.0;
+  return sampled_value_count * sampled_distinct_count /
+         (sampled_value_count - singleton_count + singleton_count * sampled_value_count / value_count);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatisticsSketch);
+
+}  // namespace opossum
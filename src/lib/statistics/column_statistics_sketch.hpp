@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "operators/aggregate/hyper_log_log.hpp"
+#include "statistics/chunk_statistics/histograms/generic_histogram.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnStatistics;
+class BaseSegment;
+
+/**
+ * Mergeable summary of (a sample of) the values of a column, from which ColumnStatistics are derived. Sketches are
+ * built per chunk, possibly in parallel, and merged into a sketch of the table. A chunk that is added to a table
+ * later (see refresh_table_statistics()) is merged into the existing sketch, so the table is not scanned again.
+ *
+ * For the distinct count, each range of rows estimates its own distinct count from its sample with the Duj1
+ * estimator (Haas et al., Sampling-Based Estimation of the Number of Distinct Values of an Attribute, VLDB 1995).
+ * The hashes of all sampled values tell which fraction of these distinct values also occurs in other ranges. They are
+ * kept exactly up to EXACT_HASH_LIMIT distinct hashes and summarized by a HyperLogLog beyond that.
+ *
+ * For numeric columns, each range of rows also builds a GenericHistogram from its sample. These are merged into the
+ * histogram of the table, which the ColumnStatistics use for cardinality estimation.
+ */
+class BaseColumnStatisticsSketch : private Noncopyable {
+ public:
+  virtual ~BaseColumnStatisticsSketch() = default;
+
+  /**
+   * Adds the rows [begin_offset, end_offset) of the segment. If there are more than sample_row_count of them, only
+   * sample_row_count evenly spaced rows are read.
+   */
+  virtual void add(const std::shared_ptr<const BaseSegment>& segment, const ChunkOffset begin_offset,
+                   const ChunkOffset end_offset, const size_t sample_row_count) = 0;
+
+  // Adds the rows summarized by other, which must be of the same type and cover different rows
+  virtual void merge(const BaseColumnStatisticsSketch& other) = 0;
+
+  virtual std::shared_ptr<BaseColumnStatistics> column_statistics() const = 0;
+};
+
+template <typename T>
+class ColumnStatisticsSketch : public BaseColumnStatisticsSketch {
+ public:
+  static constexpr auto EXACT_HASH_LIMIT = size_t{4096};
+  static constexpr auto HISTOGRAM_BIN_COUNT = BinID{100};
+
+  void add(const std::shared_ptr<const BaseSegment>& segment, const ChunkOffset begin_offset,
+           const ChunkOffset end_offset, const size_t sample_row_count) final;
+
+  void merge(const BaseColumnStatisticsSketch& other) final;
+
+  std::shared_ptr<BaseColumnStatistics> column_statistics() const final;
+
+ private:
+  void _add_hash(const size_t hash);
+  void _switch_to_hyper_log_log();
+  double _sampled_value_distinct_count() const;
+
+  // Hashes of the sampled values. Once there are more than EXACT_HASH_LIMIT, they are moved to the HyperLogLog.
+  std::unordered_set<size_t> _exact_hashes;
+  std::optional<HyperLogLog> _hyper_log_log;
+
+  size_t _row_count{0};
+  size_t _sampled_row_count{0};
+  size_t _sampled_null_count{0};
+
+  // Sums over the added ranges of rows of the distinct counts in their samples and of their estimated distinct counts
+  double _sampled_distinct_count_sum{0.0};
+  double _estimated_distinct_count_sum{0.0};
+
+  std::optional<T> _min;
+  std::optional<T> _max;
+
+  std::shared_ptr<const GenericHistogram<T>> _histogram;
+};
+
+/**
+ * Duj1 estimator for the number of distinct values among value_count values, from a sample of sampled_value_count of
+ * them with sampled_distinct_count distinct values, singleton_count of which occurred only once in the sample. It
+ * scales the number of distinct sampled values up by how many of them were seen only once.
+ */
+double estimate_distinct_count_from_sample(const double value_count, const double sampled_value_count,
+                                           const double sampled_distinct_count, const double singleton_count);
+
+/**
+ * The sketches of all columns of a table, see generate_table_statistics_sampled(). Stored in the TableStatistics.
+ */
+struct TableStatisticsSketch {
+  std::vector<std::shared_ptr<BaseColumnStatisticsSketch>> column_sketches;
+
+  // Number of rows of each chunk that were added to the sketches
+  std::vector<ChunkOffset> sketched_row_counts;
+
+  size_t sample_row_count{0};
+
+  // Serializes refreshes of the sketches
+  std::mutex mutex;
+};
+
+}  // namespace opossum
@@ -1,14 +1,67 @@
 #include "generate_table_statistics.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "base_column_statistics.hpp"
+#include "column_group_statistics.hpp"
 #include "column_statistics.hpp"
+#include "column_statistics_sketch.hpp"
 #include "generate_column_statistics.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/table.hpp"
 #include "table_statistics.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<BaseColumnStatisticsSketch>> create_column_sketches(const Table& table) {
+  auto column_sketches = std::vector<std::shared_ptr<BaseColumnStatisticsSketch>>{};
+  column_sketches.reserve(table.column_count());
+  for (const auto data_type : table.column_data_types()) {
+    column_sketches.emplace_back(
+        make_shared_by_data_type<BaseColumnStatisticsSketch, ColumnStatisticsSketch>(data_type));
+  }
+  return column_sketches;
+}
+
+// Creates sketches of the rows [begin_offset, end_offset) of the chunk
+std::vector<std::shared_ptr<BaseColumnStatisticsSketch>> sketch_chunk(const Table& table, const Chunk& chunk,
+                                                                      const ChunkOffset begin_offset,
+                                                                      const ChunkOffset end_offset,
+                                                                      const size_t sample_row_count) {
+  auto column_sketches = create_column_sketches(table);
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    column_sketches[column_id]->add(chunk.get_segment(column_id), begin_offset, end_offset, sample_row_count);
+  }
+  return column_sketches;
+}
+
+std::shared_ptr<TableStatistics> create_statistics_from_sketch(const Table& table,
+                                                               const std::shared_ptr<TableStatisticsSketch>& sketch) {
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.reserve(sketch->column_sketches.size());
+  for (const auto& column_sketch : sketch->column_sketches) {
+    column_statistics.emplace_back(column_sketch->column_statistics());
+  }
+
+  auto table_statistics =
+      std::make_shared<TableStatistics>(table.type(), static_cast<float>(table.row_count()), column_statistics);
+  table_statistics->set_sketch(sketch);
+  return table_statistics;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TableStatistics generate_table_statistics(const Table& table) {
@@ -27,4 +80,203 @@ TableStatistics generate_table_statistics(const Table& table) {
   return {table.type(), static_cast<float>(table.row_count()), column_statistics};
 }
 
+std::shared_ptr<TableStatistics> generate_table_statistics_sampled(const Table& table, const size_t sample_row_count) {
+  const auto chunk_count = table.chunk_count();
+
+  auto sketch = std::make_shared<TableStatisticsSketch>();
+  sketch->column_sketches = create_column_sketches(table);
+  sketch->sketched_row_counts.resize(chunk_count);
+  sketch->sample_row_count = sample_row_count;
+
+  // Each job sketches one chunk. The chunk sketches are merged afterwards.
+  auto chunk_sketches = std::vector<std::vector<std::shared_ptr<BaseColumnStatisticsSketch>>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    // The chunk might grow while it is sketched, so only the rows that exist now are added
+    sketch->sketched_row_counts[chunk_id] = chunk->size();
+    const auto end_offset = sketch->sketched_row_counts[chunk_id];
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id, end_offset]() {
+      chunk_sketches[chunk_id] = sketch_chunk(table, *chunk, 0, end_offset, sample_row_count);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& column_sketches : chunk_sketches) {
+    for (auto column_id = size_t{0}; column_id < column_sketches.size(); ++column_id) {
+      sketch->column_sketches[column_id]->merge(*column_sketches[column_id]);
+    }
+  }
+
+  return create_statistics_from_sketch(table, sketch);
+}
+
+void refresh_table_statistics(Table& table, const ChunkID chunk_id) {
+  const auto table_statistics = table.table_statistics();
+  if (!table_statistics || !table_statistics->sketch()) return;
+
+  const auto chunk = table.get_chunk(chunk_id);
+  if (!chunk) return;
+
+  const auto& sketch = table_statistics->sketch();
+  std::lock_guard<std::mutex> lock(sketch->mutex);
+
+  if (sketch->sketched_row_counts.size() <= static_cast<size_t>(chunk_id)) {
+    sketch->sketched_row_counts.resize(chunk_id + 1);
+  }
+  auto& sketched_row_count = sketch->sketched_row_counts[chunk_id];
+  if (sketched_row_count >= chunk->size()) return;
+
+  const auto end_offset = static_cast<ChunkOffset>(chunk->size());
+  const auto chunk_sketches = sketch_chunk(table, *chunk, sketched_row_count, end_offset, sketch->sample_row_count);
+  for (auto column_id = size_t{0}; column_id < chunk_sketches.size(); ++column_id) {
+    sketch->column_sketches[column_id]->merge(*chunk_sketches[column_id]);
+  }
+  sketched_row_count = end_offset;
+
+  auto refreshed_statistics = create_statistics_from_sketch(table, sketch);
+  refreshed_statistics->increase_invalid_row_count(static_cast<uint64_t>(table_statistics->row_count()) -
+                                                   table_statistics->approx_valid_row_count());
+
+  // The column groups are not refreshed, as they only serve to correct the estimates of correlated predicates
+  refreshed_statistics->set_column_groups(table_statistics->column_groups());
+  table.set_table_statistics(refreshed_statistics);
+}
+
+std::shared_ptr<ColumnGroupStatistics> generate_column_group_statistics(const Table& table,
+                                                                        const ColumnIDPair& column_ids,
+                                                                        const size_t sample_row_count) {
+  const auto row_count = table.row_count();
+  const auto is_sampled = row_count > sample_row_count;
+
+  // The sampled rows' values as numbers for the histogram and their hash for the distinct count of combinations
+  auto sampled_values = std::array<std::vector<std::optional<double>>, 2>{};
+  auto combination_counts = std::unordered_map<size_t, uint32_t>{};
+  auto sampled_row_count = size_t{0};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    const auto chunk_size = static_cast<double>(chunk->size());
+    const auto chunk_sample_row_count =
+        is_sampled ? std::ceil(chunk_size * static_cast<double>(sample_row_count) / static_cast<double>(row_count))
+                   : chunk_size;
+    const auto step = chunk_size / chunk_sample_row_count;
+
+    const auto& segment_a = *chunk->get_segment(column_ids.first);
+    const auto& segment_b = *chunk->get_segment(column_ids.second);
+
+    for (auto position = 0.0; position < chunk_size; position += step) {
+      const auto chunk_offset = static_cast<ChunkOffset>(position);
+      const auto value_a = segment_a[chunk_offset];
+      const auto value_b = segment_b[chunk_offset];
+
+      sampled_values[0].emplace_back(ColumnGroupStatistics::to_numeric(value_a));
+      sampled_values[1].emplace_back(ColumnGroupStatistics::to_numeric(value_b));
+      ++sampled_row_count;
+
+      if (variant_is_null(value_a) || variant_is_null(value_b)) continue;
+      auto combination_hash = std::hash<AllTypeVariant>{}(value_a);
+      boost::hash_combine(combination_hash, std::hash<AllTypeVariant>{}(value_b));
+      ++combination_counts[combination_hash];
+    }
+  }
+
+  // Equi-depth bounds of the buckets of each column
+  auto bucket_bounds = std::array<std::vector<double>, 2>{};
+  auto sorted_values = std::array<std::vector<double>, 2>{};
+  for (auto column_index = size_t{0}; column_index < 2; ++column_index) {
+    auto& values = sorted_values[column_index];
+    for (const auto& value : sampled_values[column_index]) {
+      if (value) values.emplace_back(*value);
+    }
+    if (values.empty()) continue;
+    std::sort(values.begin(), values.end());
+
+    auto& bounds = bucket_bounds[column_index];
+    const auto bucket_count = std::min(ColumnGroupStatistics::BUCKET_COUNT, values.size());
+    for (auto bucket_id = size_t{0}; bucket_id < bucket_count; ++bucket_id) {
+      bounds.emplace_back(values[bucket_id * values.size() / bucket_count]);
+    }
+    bounds.emplace_back(values.back());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    if (bounds.size() == 1) bounds.emplace_back(bounds.front());
+  }
+
+  const auto bucket_counts =
+      std::array<size_t, 2>{bucket_bounds[0].empty() ? size_t{0} : bucket_bounds[0].size() - 1,
+                            bucket_bounds[1].empty() ? size_t{0} : bucket_bounds[1].size() - 1};
+
+  // Values on the bound between two buckets belong to the upper one, NULLs to the additional last bucket
+  const auto bucket_id = [&](const size_t column_index, const std::optional<double>& value) {
+    if (!value) return bucket_counts[column_index];
+    const auto& bounds = bucket_bounds[column_index];
+    const auto upper_bound = std::upper_bound(bounds.cbegin(), bounds.cend() - 1, *value);
+    return static_cast<size_t>(std::max(std::distance(bounds.cbegin(), upper_bound) - 1, std::ptrdiff_t{0}));
+  };
+
+  auto bucket_distinct_counts = std::array<std::vector<float>, 2>{};
+  for (auto column_index = size_t{0}; column_index < 2; ++column_index) {
+    const auto& values = sorted_values[column_index];
+    bucket_distinct_counts[column_index].resize(bucket_counts[column_index]);
+    for (auto value_it = values.cbegin(); value_it != values.cend();
+         value_it = std::upper_bound(value_it, values.cend(), *value_it)) {
+      ++bucket_distinct_counts[column_index][bucket_id(column_index, *value_it)];
+    }
+  }
+
+  // Row counts of each combination of buckets, scaled up from the sample
+  const auto scale =
+      sampled_row_count > 0 ? static_cast<float>(row_count) / static_cast<float>(sampled_row_count) : 0.0f;
+  auto cell_row_counts = std::vector<float>((bucket_counts[0] + 1) * (bucket_counts[1] + 1));
+  for (auto row_idx = size_t{0}; row_idx < sampled_row_count; ++row_idx) {
+    const auto bucket_id_a = bucket_id(0, sampled_values[0][row_idx]);
+    const auto bucket_id_b = bucket_id(1, sampled_values[1][row_idx]);
+    cell_row_counts[bucket_id_a * (bucket_counts[1] + 1) + bucket_id_b] += scale;
+  }
+
+  auto sampled_combination_count = size_t{0};
+  auto singleton_count = size_t{0};
+  for (const auto& [hash, count] : combination_counts) {
+    sampled_combination_count += count;
+    if (count == 1) ++singleton_count;
+  }
+
+  auto distinct_count = static_cast<double>(combination_counts.size());
+  if (is_sampled) {
+    distinct_count = estimate_distinct_count_from_sample(
+        static_cast<double>(sampled_combination_count) * scale, static_cast<double>(sampled_combination_count),
+        distinct_count, static_cast<double>(singleton_count));
+  }
+
+  return std::make_shared<ColumnGroupStatistics>(static_cast<float>(row_count), static_cast<float>(distinct_count),
+                                                 bucket_bounds, bucket_distinct_counts, cell_row_counts);
+}
+
+void add_column_group_statistics(Table& table, const ColumnIDPair& column_ids) {
+  // Serializes adding column groups, so that concurrently optimized queries do not add the same group twice
+  static auto mutex = std::mutex{};
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto table_statistics = table.table_statistics();
+  if (!table_statistics) return;
+
+  for (const auto& column_group : table_statistics->column_groups()) {
+    if (column_group.column_ids == column_ids ||
+        column_group.column_ids == ColumnIDPair{column_ids.second, column_ids.first}) {
+      return;
+    }
+  }
+
+  auto extended_statistics = std::make_shared<TableStatistics>(*table_statistics);
+  extended_statistics->add_column_group(column_ids, generate_column_group_statistics(table, column_ids));
+  table.set_table_statistics(extended_statistics);
+}
+
 }  // namespace opossum
@@ -4,14 +4,48 @@
 #include <unordered_set>
 
 #include "table_statistics.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
+class ColumnGroupStatistics;
 class Table;
 
+// Number of rows per chunk that generate_table_statistics_sampled() reads by default
+constexpr auto DEFAULT_STATISTICS_SAMPLE_ROW_COUNT = size_t{10'000};
+
 /**
  * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution.
  */
 TableStatistics generate_table_statistics(const Table& table);
 
+/**
+ * Generate statistics about a Table from a sample of at most sample_row_count rows per chunk. The chunks are
+ * processed in parallel by the scheduler, each into a ColumnStatisticsSketch per column. The merged sketches are kept
+ * in the returned TableStatistics, so that refresh_table_statistics() can add new data to them.
+ */
+std::shared_ptr<TableStatistics> generate_table_statistics_sampled(
+    const Table& table, const size_t sample_row_count = DEFAULT_STATISTICS_SAMPLE_ROW_COUNT);
+
+/**
+ * Adds the rows of the chunk that are not yet part of the sketches of the table's statistics (e.g., because the chunk
+ * was still being filled when the statistics were generated) and replaces the statistics by ones derived from the
+ * updated sketches. Does nothing if the statistics were not generated by generate_table_statistics_sampled().
+ */
+void refresh_table_statistics(Table& table, const ChunkID chunk_id);
+
+/**
+ * Generate statistics about the joint distribution of two columns of a Table from a sample of about
+ * sample_row_count rows spread over all chunks.
+ */
+std::shared_ptr<ColumnGroupStatistics> generate_column_group_statistics(
+    const Table& table, const ColumnIDPair& column_ids,
+    const size_t sample_row_count = DEFAULT_STATISTICS_SAMPLE_ROW_COUNT);
+
+/**
+ * Generates ColumnGroupStatistics for the two columns and adds them to the table's statistics, unless they already
+ * exist. Used by the ColumnGroupStatisticsRule for columns that queries predicate together.
+ */
+void add_column_group_statistics(Table& table, const ColumnIDPair& column_ids);
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 #include "all_parameter_variant.hpp"
@@ -46,7 +47,9 @@ TableStatistics TableStatistics::estimate_predicate(const ColumnID column_id,
   if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
     const auto selectivity =
         predicate_condition == PredicateCondition::Like ? DEFAULT_LIKE_SELECTIVITY : 1.0f - DEFAULT_LIKE_SELECTIVITY;
-    return {TableType::References, _row_count * selectivity, _column_statistics};
+    auto output_statistics = TableStatistics{TableType::References, _row_count * selectivity, _column_statistics};
+    output_statistics._column_groups = _column_groups;
+    return output_statistics;
   }
 
   // Create copies to modify below and insert into result
@@ -86,7 +89,10 @@ TableStatistics TableStatistics::estimate_predicate(const ColumnID column_id,
     predicated_row_count *= estimate.selectivity;
   }
 
-  return {TableType::References, predicated_row_count, predicated_column_statistics};
+  auto output_statistics = TableStatistics{TableType::References, predicated_row_count, predicated_column_statistics};
+  output_statistics._column_groups = _column_groups;
+  output_statistics._apply_predicate_to_column_groups(_row_count, column_id, predicate_condition, value);
+  return output_statistics;
 }
 
 TableStatistics TableStatistics::estimate_cross_join(const TableStatistics& right_table_statistics) const {
@@ -108,7 +114,23 @@ TableStatistics TableStatistics::estimate_cross_join(const TableStatistics& righ
 
   auto cross_joined_row_count = _row_count * right_table_statistics._row_count;
 
-  return {TableType::References, cross_joined_row_count, cross_joined_column_statistics};
+  auto output_statistics =
+      TableStatistics{TableType::References, cross_joined_row_count, cross_joined_column_statistics};
+
+  // The column groups of the right table refer to its columns by their position in the cross join result
+  output_statistics._column_groups = _column_groups;
+  const auto column_offset = static_cast<ColumnID::base_type>(_column_statistics.size());
+  for (auto column_group : right_table_statistics._column_groups) {
+    column_group.column_ids.first += column_offset;
+    column_group.column_ids.second += column_offset;
+    if (column_group.join_column_ids) {
+      column_group.join_column_ids->first += column_offset;
+      column_group.join_column_ids->second += column_offset;
+    }
+    output_statistics._column_groups.emplace_back(column_group);
+  }
+
+  return output_statistics;
 }
 
 TableStatistics TableStatistics::estimate_predicated_join(const TableStatistics& right_table_statistics,
@@ -245,6 +267,7 @@ TableStatistics TableStatistics::estimate_predicated_join(const TableStatistics&
       join_table_stats._column_statistics[column_ids.first] = stats_container.left_column_statistics;
       // remove column statistics from right table
       join_table_stats._column_statistics.resize(_column_statistics.size());
+      join_table_stats._column_groups = _column_groups;
 
       // Simple heuristic: we assume that three quarters of the elements in the smaller relation
       // (we are upper-bound by number of non-null values in both relations) will match.
@@ -265,6 +288,10 @@ TableStatistics TableStatistics::estimate_predicated_join(const TableStatistics&
     case JoinMode::Inner: {
       join_table_stats._column_statistics[column_ids.first] = stats_container.left_column_statistics;
       join_table_stats._column_statistics[new_right_column_id] = stats_container.right_column_statistics;
+      if (predicate_condition == PredicateCondition::Equals) {
+        join_table_stats._apply_equi_join_to_column_groups(_row_count * right_table_statistics._row_count,
+                                                           column_ids.first, new_right_column_id);
+      }
       break;
     }
     case JoinMode::Left: {
@@ -302,6 +329,113 @@ TableStatistics TableStatistics::estimate_disjunction(const TableStatistics& rig
           column_statistics()};
 }
 
+const std::vector<TableStatistics::ColumnGroup>& TableStatistics::column_groups() const { return _column_groups; }
+
+void TableStatistics::set_column_groups(const std::vector<ColumnGroup>& column_groups) {
+  _column_groups = column_groups;
+}
+
+void TableStatistics::add_column_group(const ColumnIDPair& column_ids,
+                                       const std::shared_ptr<const ColumnGroupStatistics>& statistics) {
+  auto column_group = ColumnGroup{};
+  column_group.column_ids = column_ids;
+  column_group.statistics = statistics;
+  _column_groups.emplace_back(column_group);
+}
+
+const std::shared_ptr<TableStatisticsSketch>& TableStatistics::sketch() const { return _sketch; }
+
+void TableStatistics::set_sketch(const std::shared_ptr<TableStatisticsSketch>& sketch) { _sketch = sketch; }
+
+void TableStatistics::_apply_predicate_to_column_groups(const float input_row_count, const ColumnID column_id,
+                                                        const PredicateCondition predicate_condition,
+                                                        const AllParameterVariant& value) {
+  // Placeholders have no value to estimate with
+  if (is_parameter_id(value)) return;
+
+  const auto value_column_id =
+      is_column_id(value) ? std::optional<ColumnID>{boost::get<ColumnID>(value)} : std::nullopt;
+  auto row_count_corrected = false;
+
+  for (auto& column_group : _column_groups) {
+    const auto& [first_column_id, second_column_id] = column_group.column_ids;
+    if (column_id != first_column_id && column_id != second_column_id) continue;
+
+    auto predicate = ColumnGroupPredicate{};
+    predicate.column_index = column_id == first_column_id ? 0 : 1;
+    predicate.predicate_condition = predicate_condition;
+    if (value_column_id) {
+      // Only comparisons between the two columns of the group can be estimated with it
+      if (*value_column_id != (column_id == first_column_id ? second_column_id : first_column_id)) continue;
+      predicate.compares_columns = true;
+    } else {
+      predicate.value = boost::get<AllTypeVariant>(value);
+    }
+
+    auto predicates = column_group.predicates;
+    predicates.emplace_back(predicate);
+    const auto selectivity = column_group.statistics->estimate_selectivity(predicates);
+    if (!selectivity) continue;
+
+    // Replace the selectivity of the predicate, which assumed independence from the previous predicates on the
+    // group's columns, with its selectivity given these predicates
+    if (!row_count_corrected && column_group.selectivity > 0.0f) {
+      _row_count = input_row_count * *selectivity / column_group.selectivity;
+      row_count_corrected = true;
+    }
+
+    column_group.predicates = std::move(predicates);
+    column_group.selectivity = *selectivity;
+  }
+
+  if (!row_count_corrected && value_column_id && predicate_condition == PredicateCondition::Equals) {
+    _apply_equi_join_to_column_groups(input_row_count, column_id, *value_column_id);
+  }
+}
+
+void TableStatistics::_apply_equi_join_to_column_groups(const float input_row_count, const ColumnID left_column_id,
+                                                        const ColumnID right_column_id) {
+  if (input_row_count == 0.0f) return;
+
+  const auto contains = [](const ColumnGroup& column_group, const ColumnID column_id) {
+    return column_group.column_ids.first == column_id || column_group.column_ids.second == column_id;
+  };
+  const auto other_column_id = [](const ColumnGroup& column_group, const ColumnID column_id) {
+    return column_group.column_ids.first == column_id ? column_group.column_ids.second : column_group.column_ids.first;
+  };
+
+  const auto left_group = std::find_if(_column_groups.begin(), _column_groups.end(), [&](const auto& column_group) {
+    return contains(column_group, left_column_id) && !contains(column_group, right_column_id);
+  });
+  const auto right_group = std::find_if(_column_groups.begin(), _column_groups.end(), [&](const auto& column_group) {
+    return contains(column_group, right_column_id) && !contains(column_group, left_column_id);
+  });
+  if (left_group == _column_groups.end() || right_group == _column_groups.end()) return;
+
+  const auto other_left_column_id = other_column_id(*left_group, left_column_id);
+  const auto other_right_column_id = other_column_id(*right_group, right_column_id);
+
+  if (left_group->join_column_ids == ColumnIDPair{other_left_column_id, other_right_column_id} &&
+      right_group->join_column_ids == ColumnIDPair{other_right_column_id, other_left_column_id}) {
+    // Both columns of both groups are joined. Each combination of values of the group with fewer distinct
+    // combinations is expected to find its partners in the other group.
+    const auto distinct_count =
+        std::max(left_group->statistics->distinct_count(), right_group->statistics->distinct_count());
+    if (distinct_count > 0.0f && left_group->join_selectivity > 0.0f) {
+      _row_count = input_row_count / left_group->join_selectivity / distinct_count;
+    }
+    left_group->join_column_ids.reset();
+    right_group->join_column_ids.reset();
+    return;
+  }
+
+  const auto selectivity = _row_count / input_row_count;
+  left_group->join_column_ids = ColumnIDPair{left_column_id, right_column_id};
+  left_group->join_selectivity = selectivity;
+  right_group->join_column_ids = ColumnIDPair{right_column_id, left_column_id};
+  right_group->join_selectivity = selectivity;
+}
+
 std::string TableStatistics::description() const {
   std::stringstream stream;
 
@@ -1,15 +1,18 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
+#include "column_group_statistics.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class BaseColumnStatistics;
+struct TableStatisticsSketch;
 
 /**
  * Statistics about a table, with algorithms to perform cardinality estimations.
@@ -23,6 +26,25 @@ class TableStatistics final {
   // Made up magic number
   static constexpr auto DEFAULT_DISJUNCTION_SELECTIVITY = 0.2f;
 
+  /**
+   * Two columns with ColumnGroupStatistics. Predicates on these columns are estimated from the ColumnGroupStatistics
+   * instead of assuming them to be independent. For this, the group tracks the predicates on its columns that were
+   * applied so far, so that the row count can be scaled by how much a new predicate reduces their joint selectivity.
+   */
+  struct ColumnGroup {
+    ColumnIDPair column_ids;
+    std::shared_ptr<const ColumnGroupStatistics> statistics;
+
+    std::vector<ColumnGroupPredicate> predicates;
+    float selectivity{1.0f};
+
+    // The first equi-join predicate between a column of this group (first) and one of another group (second), and the
+    // selectivity it was estimated with. Once the remaining columns of both groups are joined as well, the selectivity
+    // of both predicates together is estimated from the groups' distinct counts.
+    std::optional<ColumnIDPair> join_column_ids;
+    float join_selectivity{1.0f};
+  };
+
   TableStatistics(const TableType table_type, const float row_count,
                   const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics);
   TableStatistics(const TableStatistics& table_statistics) = default;
@@ -59,9 +81,24 @@ class TableStatistics final {
   // Decreases the (approximate) count of invalid rows in the table (caused by deleted chunks).
   void decrease_invalid_row_count(uint64_t count);
 
+  const std::vector<ColumnGroup>& column_groups() const;
+  void set_column_groups(const std::vector<ColumnGroup>& column_groups);
+  void add_column_group(const ColumnIDPair& column_ids, const std::shared_ptr<const ColumnGroupStatistics>& statistics);
+
+  // The sketches the statistics were derived from, if they were sampled (see generate_table_statistics_sampled())
+  const std::shared_ptr<TableStatisticsSketch>& sketch() const;
+  void set_sketch(const std::shared_ptr<TableStatisticsSketch>& sketch);
+
   std::string description() const;
 
  private:
+  // Corrects the row count of the statistics, which the predicate was just applied to, with the column groups
+  void _apply_predicate_to_column_groups(const float input_row_count, const ColumnID column_id,
+                                         const PredicateCondition predicate_condition,
+                                         const AllParameterVariant& value);
+  void _apply_equi_join_to_column_groups(const float input_row_count, const ColumnID left_column_id,
+                                         const ColumnID right_column_id);
+
   TableType _table_type;
   float _row_count;
   std::vector<std::shared_ptr<const BaseColumnStatistics>> _column_statistics;
@@ -70,6 +107,10 @@ class TableStatistics final {
   // This is currently not an atomic due to performance considerations.
   // It is simply used as an estimate for the optimizer, and therefore does not need to be exact.
   uint64_t _approx_invalid_row_count{0};
+
+  std::vector<ColumnGroup> _column_groups;
+
+  std::shared_ptr<TableStatisticsSketch> _sketch;
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <utility>
 
 #include "resolve_type.hpp"
 #include "types.hpp"
@@ -11,7 +12,8 @@ namespace opossum {
 
 /**
  * This is the base class for all SegmentAccessor types.
- * It provides the common interface to access individual values of a segment.
+ * It provides the common interface to access individual values of a segment, either one by one (access()) or in
+ * batches (gather()).
  */
 template <typename T>
 class BaseSegmentAccessor {
@@ -23,6 +25,27 @@ class BaseSegmentAccessor {
   virtual ~BaseSegmentAccessor() {}
 
   virtual const std::optional<T> access(ChunkOffset offset) const = 0;
+
+  /**
+   * Writes the values at chunk_offsets[0, count) to values[0, count) and whether they are NULL to
+   * null_values[0, count). The values of NULL rows are unspecified. Compared to calling access() per row, this
+   * takes a single virtual call and lets the accessor decode the segment in bulk. This default implementation calls
+   * access() for each offset.
+   */
+  virtual void gather(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const {
+    for (auto index = size_t{0}; index < count; ++index) {
+      auto value = access(chunk_offsets[index]);
+      null_values[index] = !value;
+      if (value) values[index] = std::move(*value);
+    }
+  }
+
+  /**
+   * Hints the CPU to load the data that access(offset) reads, so that accessing it later does not stall on a cache
+   * miss. Used when gathering rows that are scattered across many chunks (see
+   * MultipleChunkReferenceSegmentAccessor::gather()). This default implementation does nothing.
+   */
+  virtual void prefetch(const ChunkOffset offset) const {}
 };
 
 }  // namespace opossum
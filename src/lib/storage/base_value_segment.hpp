@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base_segment.hpp"
+#include "null_value_vector.hpp"
 
 namespace opossum {
 
@@ -20,13 +21,17 @@ class BaseValueSegment : public BaseSegment {
   virtual void append(const AllTypeVariant& val) = 0;
 
   /**
-   * @brief Returns null array
+   * @brief Returns null bitmap
    *
    * Throws exception if is_nullable() returns false
    */
-  virtual const pmr_concurrent_vector<bool>& null_values() const = 0;
-  virtual pmr_concurrent_vector<bool>& null_values() = 0;
+  virtual const NullValueVector& null_values() const = 0;
+  virtual NullValueVector& null_values() = 0;
 
   virtual void reserve(const size_t capacity) = 0;
+
+  // Grows the segment to the given size by appending default values (non-NULL). Existing rows remain accessible
+  // concurrently, which allows Insert to write reserved rows while another Insert grows the segment.
+  virtual void grow_to(const size_t size) = 0;
 };
 }  // namespace opossum
@@ -3,13 +3,16 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
 #include "index/base_index.hpp"
+#include "index/mutable_index/mutable_index.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
@@ -29,11 +32,26 @@ Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_dat
 #endif
 
   if (alloc) _alloc = *alloc;
+
+  const auto row_count = size();
+  _reserved_row_count = row_count;
+  _grown_row_count = row_count;
 }
 
 bool Chunk::is_mutable() const { return _is_mutable; }
 
-void Chunk::mark_immutable() { _is_mutable = false; }
+void Chunk::mark_immutable() {
+  _is_mutable = false;
+
+  // No more rows are added from now on. Rows of pending inserts keep the highest begin_cid at MAX_COMMIT_ID, so that
+  // Validate does not skip the chunk even after they were committed.
+  // Frozen MvccData already know their highest begin_cid
+  if (has_mvcc_data() && !_mvcc_data->is_frozen()) {
+    auto mvcc_data = get_scoped_mvcc_data_lock();
+    const auto max_begin_cid = std::max_element(mvcc_data->begin_cids.begin(), mvcc_data->begin_cids.end());
+    mvcc_data->max_begin_cid = max_begin_cid != mvcc_data->begin_cids.end() ? *max_begin_cid : CommitID{0};
+  }
+}
 
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment) {
   std::atomic_store(&_segments.at(column_id), segment);
@@ -57,19 +75,116 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  for (const auto& mutable_index : _mutable_indexes) {
+    mutable_index->insert(*get_segment(mutable_index->column_id()), chunk_offset, chunk_offset + 1);
+  }
+
+  ++_reserved_row_count;
+  ++_grown_row_count;
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count, const ChunkOffset max_size) {
+  DebugAssert(is_mutable(), "Can't reserve rows in immutable Chunk");
+
+  auto begin = _reserved_row_count.load();
+  auto reserved_row_count = ChunkOffset{0};
+  do {
+    if (begin >= max_size) return {begin, ChunkOffset{0}};
+    reserved_row_count = std::min(row_count, max_size - begin);
+  } while (!_reserved_row_count.compare_exchange_weak(begin, begin + reserved_row_count));
+
+  // tbb::concurrent_vector::grow_to_at_least() might return before the elements added by a concurrent call are
+  // constructed. Thus, we wait until the rows reserved before ours were added. This only takes as long as growing the
+  // vectors, the preceding caller writes its values afterwards.
+  while (_grown_row_count.load(std::memory_order_acquire) != begin) {
+    std::this_thread::yield();
+  }
+
+  // Grow the MvccData first and the first segment last, so that rows counted by size() are complete
+  if (has_mvcc_data()) get_scoped_mvcc_data_lock()->grow_by(reserved_row_count, MvccData::MAX_COMMIT_ID);
+  for (auto segment_it = _segments.crbegin(); segment_it != _segments.crend(); ++segment_it) {
+    const auto& base_value_segment = std::dynamic_pointer_cast<BaseValueSegment>(*segment_it);
+    DebugAssert(base_value_segment, "Can't reserve rows in segment that is not a ValueSegment");
+    base_value_segment->grow_to(begin + reserved_row_count);
+  }
+
+  _grown_row_count.store(begin + reserved_row_count, std::memory_order_release);
+  return {begin, reserved_row_count};
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
-  return std::atomic_load(&_segments.at(column_id));
+  _access_count.fetch_add(1, std::memory_order_relaxed);
+
+  auto segment = std::atomic_load(&_segments.at(column_id));
+  // The chunk might be evicted again right after loading it
+  while (!segment) {
+    load_segments();
+    segment = std::atomic_load(&_segments.at(column_id));
+  }
+  return segment;
+}
+
+const BaseSegment& Chunk::get_segment_view(ColumnID column_id) const {
+  load_segments();
+  const auto& segment = _segments.at(column_id);
+  DebugAssert(segment, "Segment was released by an eviction of the chunk");
+  return *segment;
+}
+
+const Segments& Chunk::segments() const {
+  load_segments();
+  return _segments;
+}
+
+void Chunk::evict(const SegmentLoader& segment_loader) {
+  Assert(!is_mutable(), "Only immutable chunks can be evicted");
+  Assert(_indices.empty() && _mutable_indexes.empty(), "Chunks with indexes cannot be evicted");
+
+  std::lock_guard<std::mutex> lock(_eviction_mutex);
+  if (_is_evicted) return;
+
+  _evicted_size = size();
+  _segment_loader = segment_loader;
+  _is_evicted = true;
+
+  // Operators that already hold a segment keep it alive until they are done
+  for (auto& segment : _segments) {
+    std::atomic_store(&segment, std::shared_ptr<BaseSegment>{});
+  }
 }
 
-const Segments& Chunk::segments() const { return _segments; }
+bool Chunk::is_evicted() const { return _is_evicted; }
+
+void Chunk::load_segments() const {
+  if (!_is_evicted) return;
+
+  std::lock_guard<std::mutex> lock(_eviction_mutex);
+  // Another thread might have loaded the segments while we were waiting for the lock
+  if (!_is_evicted) return;
+
+  const auto segments = _segment_loader();
+  Assert(segments.size() == _segments.size(), "Loaded segments do not match the chunk");
+
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    std::atomic_store(&_segments[column_id], segments[column_id]);
+  }
+  _segment_loader = nullptr;
+  _is_evicted = false;
+}
+
+uint64_t Chunk::access_count() const { return _access_count.load(std::memory_order_relaxed); }
+
+void Chunk::decay_access_count() { _access_count.store(access_count() / 2, std::memory_order_relaxed); }
 
 uint16_t Chunk::column_count() const { return static_cast<uint16_t>(_segments.size()); }
 
 uint32_t Chunk::size() const {
   if (_segments.empty()) return 0;
-  auto first_segment = get_segment(ColumnID{0});
+  // Determining the size does not load evicted chunks
+  const auto first_segment = std::atomic_load(&_segments[0]);
+  if (!first_segment) return _evicted_size;
   return static_cast<uint32_t>(first_segment->size());
 }
 
@@ -88,6 +203,7 @@ void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) { _mvcc_da
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
   std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
@@ -98,8 +214,14 @@ std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<Col
   return get_indices(segments);
 }
 
+bool Chunk::has_indices() const {
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  return !_indices.empty();
+}
+
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
   auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
@@ -114,11 +236,36 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
 }
 
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  std::unique_lock<std::shared_mutex> lock(_indices_mutex);
   auto it = std::find(_indices.cbegin(), _indices.cend(), index);
   DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
   _indices.erase(it);
 }
 
+std::shared_ptr<BaseMutableIndex> Chunk::create_mutable_index(const ColumnID column_id,
+                                                              const SegmentIndexType finalized_index_type) {
+  Assert(is_mutable(), "Mutable indexes can only be created on mutable chunks");
+  DebugAssert(!get_mutable_index(column_id), "Column already has a mutable index");
+
+  const auto segment = get_segment(column_id);
+  const auto mutable_index = make_shared_by_data_type<BaseMutableIndex, MutableIndex>(
+      segment->data_type(), column_id, finalized_index_type);
+  mutable_index->insert(*segment, ChunkOffset{0}, static_cast<ChunkOffset>(segment->size()));
+
+  _mutable_indexes.emplace_back(mutable_index);
+  return mutable_index;
+}
+
+std::shared_ptr<BaseMutableIndex> Chunk::get_mutable_index(const ColumnID column_id) const {
+  const auto index_it = std::find_if(_mutable_indexes.cbegin(), _mutable_indexes.cend(),
+                                     [&](const auto& mutable_index) { return mutable_index->column_id() == column_id; });
+  return index_it != _mutable_indexes.cend() ? *index_it : nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseMutableIndex>>& Chunk::mutable_indexes() const { return _mutable_indexes; }
+
+void Chunk::remove_mutable_indexes() { _mutable_indexes.clear(); }
+
 bool Chunk::references_exactly_one_table() const {
   if (column_count() == 0) return false;
 
@@ -145,6 +292,8 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
     Fail("Cannot migrate Chunk with Indices.");
   }
 
+  load_segments();
+
   _alloc = PolymorphicAllocator<size_t>(memory_source);
   Segments new_segments(_alloc);
   for (const auto& segment : _segments) {
@@ -153,22 +302,25 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   _segments = std::move(new_segments);
 }
 
+NodeID Chunk::numa_node_id() const { return _numa_node_id; }
+
+void Chunk::set_numa_node_id(const NodeID numa_node_id) { _numa_node_id = numa_node_id; }
+
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
 size_t Chunk::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
-  for (const auto& segment : _segments) {
-    bytes += segment->estimate_memory_usage();
+  // Evicted segments do not use any memory
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    const auto segment = std::atomic_load(&_segments[column_id]);
+    if (segment) bytes += segment->estimate_memory_usage();
   }
 
   // TODO(anybody) Index memory usage missing
 
   if (_mvcc_data) {
-    bytes += sizeof(_mvcc_data->tids) + sizeof(_mvcc_data->begin_cids) + sizeof(_mvcc_data->end_cids);
-    bytes += _mvcc_data->tids.size() * sizeof(decltype(_mvcc_data->tids)::value_type);
-    bytes += _mvcc_data->begin_cids.size() * sizeof(decltype(_mvcc_data->begin_cids)::value_type);
-    bytes += _mvcc_data->end_cids.size() * sizeof(decltype(_mvcc_data->end_cids)::value_type);
+    bytes += _mvcc_data->estimate_memory_usage();
   }
 
   return bytes;
@@ -209,4 +361,8 @@ const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const
 
 void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) { _ordered_by.emplace(ordered_by); }
 
+const std::optional<PartitionID>& Chunk::partition_id() const { return _partition_id; }
+
+void Chunk::set_partition_id(const PartitionID partition_id) { _partition_id = partition_id; }
+
 }  // namespace opossum
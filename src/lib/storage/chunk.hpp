@@ -8,9 +8,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -24,6 +27,7 @@
 namespace opossum {
 
 class BaseIndex;
+class BaseMutableIndex;
 class BaseSegment;
 class ChunkStatistics;
 
@@ -67,6 +71,15 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Reserves up to row_count rows at the end of the mutable chunk, which holds at most max_size rows. Returns the
+   * offset of the first reserved row and the number of reserved rows, which is 0 if the chunk is full. The MvccData and the
+   * ValueSegments are grown to include the reserved rows, whose values are then written by the caller.
+   * Concurrent callers (i.e., Inserts) reserve disjoint rows with an atomic counter instead of locking the table. The
+   * vectors are grown in the order of the reservations, so that each row is constructed by exactly one caller.
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(const ChunkOffset row_count, const ChunkOffset max_size);
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -76,11 +89,42 @@ class Chunk : private Noncopyable {
    *       continue to use it without any inconsistencies.
    *       However, if you call get_segment again, be aware that
    *       the return type might have changed.
+   *
+   * If the chunk is evicted, its segments are loaded first.
    */
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Returns the segment without the atomic load and reference counting of get_segment(), see Table::get_chunk_view().
+  // It does not count as an access either. Like the entries of segments(), the view is released if the chunk is evicted
+  // while it is being used. Thus, it must only be used for chunks that are never evicted, i.e., those of intermediate
+  // tables (see ChunkBufferManager). Chunks of stored tables, e.g., those referenced by ReferenceSegments, are read
+  // through get_segment(), keeping the returned segment for as long as it is used.
+  const BaseSegment& get_segment_view(ColumnID column_id) const;
+
+  // Loads the segments first if the chunk is evicted. The entries of the returned vector are released again if the
+  // chunk is evicted while it is being used, so callers that run concurrently with evictions must use get_segment().
   const Segments& segments() const;
 
+  /**
+   * @defgroup Eviction of immutable chunks to secondary storage (see ChunkBufferManager)
+   *
+   * An evicted chunk releases its segments, but keeps its size, MvccData, and statistics, so that it can still be
+   * pruned and validated without loading it. Accessing a segment loads all segments back using the SegmentLoader passed
+   * to evict(), blocking until they are available. load_segments() is used to load them ahead of time.
+   * @{
+   */
+  using SegmentLoader = std::function<Segments()>;
+
+  void evict(const SegmentLoader& segment_loader);
+  bool is_evicted() const;
+  void load_segments() const;
+
+  // The number of get_segment() calls, used to find cold chunks. decay_access_count() halves it, so that chunks that
+  // are not accessed anymore cool down.
+  uint64_t access_count() const;
+  void decay_access_count();
+  /** @} */
+
   bool has_mvcc_data() const;
 
   /**
@@ -100,6 +144,7 @@ class Chunk : private Noncopyable {
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID>& column_ids) const;
+  bool has_indices() const;
 
   std::shared_ptr<BaseIndex> get_index(const SegmentIndexType index_type,
                                        const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
@@ -118,6 +163,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
+    std::unique_lock<std::shared_mutex> lock(_indices_mutex);
     _indices.emplace_back(index);
     return index;
   }
@@ -130,8 +176,33 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<BaseIndex>& index);
 
+  /**
+   * @defgroup Indexes that are maintained while the chunk is mutable (see BaseMutableIndex)
+   * @{
+   */
+
+  // Creates a mutable index on the given column and adds all existing rows to it
+  std::shared_ptr<BaseMutableIndex> create_mutable_index(const ColumnID column_id,
+                                                         const SegmentIndexType finalized_index_type);
+
+  // Returns the mutable index of the given column or nullptr, if there is none
+  std::shared_ptr<BaseMutableIndex> get_mutable_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseMutableIndex>>& mutable_indexes() const;
+
+  void remove_mutable_indexes();
+
+  /** @} */
+
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
+  /**
+   * The NUMA node the chunk was placed on (see place_chunks_on_numa_nodes()), INVALID_NODE_ID if the chunk was not
+   * explicitly placed. Jobs that process the chunk are scheduled on this node.
+   */
+  NodeID numa_node_id() const;
+  void set_numa_node_id(const NodeID numa_node_id);
+
   bool references_exactly_one_table() const;
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
@@ -153,6 +224,13 @@ class Chunk : private Noncopyable {
   const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
   void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
 
+  /**
+   * The partition of its table that all rows of this chunk belong to, if the table is partitioned (see
+   * TablePartitioning). Set before the chunk is appended to the table.
+   */
+  const std::optional<PartitionID>& partition_id() const;
+  void set_partition_id(const PartitionID partition_id);
+
   /**
    * Returns the count of deleted/invalidated rows within this chunk resulting from already committed transactions.
    */
@@ -180,14 +258,31 @@ class Chunk : private Noncopyable {
 
  private:
   PolymorphicAllocator<Chunk> _alloc;
-  Segments _segments;
+  // Mutable, as the segments of evicted chunks are loaded in const accessors
+  mutable Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  // Indexes are created and removed while queries use the chunk, e.g., by the TuningPlugin
+  mutable std::shared_mutex _indices_mutex;
+  std::vector<std::shared_ptr<BaseMutableIndex>> _mutable_indexes;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
   std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
+  std::optional<PartitionID> _partition_id;
   mutable std::atomic_uint64_t _invalid_row_count = 0;
   std::optional<CommitID> _cleanup_commit_id;
+  NodeID _numa_node_id{INVALID_NODE_ID};
+
+  // See reserve_rows()
+  std::atomic<ChunkOffset> _reserved_row_count{0};
+  std::atomic<ChunkOffset> _grown_row_count{0};
+
+  // See evict()
+  mutable std::atomic_bool _is_evicted{false};
+  mutable std::mutex _eviction_mutex;
+  mutable SegmentLoader _segment_loader;
+  ChunkOffset _evicted_size{0};
+  mutable std::atomic<uint64_t> _access_count{0};
 };
 
 }  // namespace opossum
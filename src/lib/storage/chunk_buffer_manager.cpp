@@ -0,0 +1,135 @@
+#include "chunk_buffer_manager.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "import_export/mapped_file_reader.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkBufferManager::ChunkBufferManager()
+    : _spill_directory(filesystem::temp_directory_path()),
+      _loaded_chunk_count(std::make_shared<std::atomic<size_t>>(0)) {}
+
+void ChunkBufferManager::set_spill_directory(const filesystem::path& spill_directory) {
+  std::lock_guard<std::mutex> lock{_mutex};
+  _spill_directory = spill_directory;
+}
+
+filesystem::path ChunkBufferManager::spill_directory() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _spill_directory;
+}
+
+bool ChunkBufferManager::evict_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+  const auto chunk = table->get_chunk(chunk_id);
+  if (!chunk || chunk->is_mutable() || chunk->is_evicted() || chunk->has_indices() ||
+      !chunk->mutable_indexes().empty()) {
+    return false;
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    if (!ExportBinary::supports_segment(*chunk->get_segment(column_id))) return false;
+  }
+
+  static auto next_file_id = std::atomic<size_t>{0};
+  const auto path = spill_directory() / ("hyrise_chunk_" + std::to_string(getpid()) + "_" +
+                                         std::to_string(next_file_id++) + ".bin");
+  {
+    auto stream = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    Assert(stream.is_open(), "Could not create file " + path.string());
+    ExportBinary::write_chunk(*chunk, table->column_definitions(), stream);
+    Assert(stream.good(), "Could not write to file " + path.string());
+  }
+
+  // The file is removed when the last copy of the loader is gone, i.e., when the chunk was loaded or destroyed
+  const auto file = std::shared_ptr<const filesystem::path>(new filesystem::path(path), [](auto* file_path) {
+    auto error_code = std::error_code{};
+    filesystem::remove(*file_path, error_code);
+    delete file_path;
+  });
+
+  chunk->evict([file, column_definitions = table->column_definitions(), loaded_chunk_count = _loaded_chunk_count]() {
+    auto reader = MappedFileReader{file->string()};
+    auto segments = ImportBinary::read_chunk(reader, column_definitions);
+    ++*loaded_chunk_count;
+    return segments;
+  });
+
+  ++_evicted_chunk_count;
+  return true;
+}
+
+size_t ChunkBufferManager::evict_cold_chunks(const size_t memory_budget) {
+  struct Candidate {
+    std::shared_ptr<Table> table;
+    ChunkID chunk_id;
+    uint64_t access_count;
+    size_t memory_usage;
+  };
+
+  auto memory_usage = size_t{0};
+  auto candidates = std::vector<Candidate>{};
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+      chunks.emplace_back(chunk);
+
+      const auto chunk_memory_usage = chunk->estimate_memory_usage();
+      memory_usage += chunk_memory_usage;
+      if (!chunk->is_mutable() && !chunk->is_evicted()) {
+        candidates.push_back({table, chunk_id, chunk->access_count(), chunk_memory_usage});
+      }
+    }
+  }
+
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.access_count < rhs.access_count; });
+
+  auto evicted_chunk_count = size_t{0};
+  for (const auto& candidate : candidates) {
+    if (memory_usage <= memory_budget) break;
+    if (!evict_chunk(candidate.table, candidate.chunk_id)) continue;
+
+    // The MvccData and statistics of the chunk stay in memory
+    const auto remaining_memory_usage = candidate.table->get_chunk(candidate.chunk_id)->estimate_memory_usage();
+    memory_usage -= candidate.memory_usage - std::min(candidate.memory_usage, remaining_memory_usage);
+    ++evicted_chunk_count;
+  }
+
+  for (const auto& chunk : chunks) {
+    chunk->decay_access_count();
+  }
+
+  return evicted_chunk_count;
+}
+
+void ChunkBufferManager::prefetch(const std::shared_ptr<const Chunk>& chunk) const {
+  // Without a scheduler, the task would be executed right away and block the caller
+  if (!chunk->is_evicted() || !CurrentScheduler::is_set()) return;
+
+  const auto task = std::make_shared<JobTask>([chunk]() { chunk->load_segments(); });
+  task->schedule();
+}
+
+size_t ChunkBufferManager::evicted_chunk_count() const { return _evicted_chunk_count; }
+
+size_t ChunkBufferManager::loaded_chunk_count() const { return *_loaded_chunk_count; }
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Moves cold immutable chunks of the tables in the StorageManager to secondary storage (ideally a local SSD) and
+ * loads them back when they are accessed.
+ *
+ * An evicted chunk keeps its MvccData and statistics in memory, so that it can still be pruned without touching the
+ * disk. Its segments are written in the format of ExportBinary to a file in the spill directory, which is removed once
+ * the segments are loaded again or the chunk is destroyed. Only chunks whose segments are supported by ExportBinary and
+ * that have no indexes are evicted.
+ *
+ * Chunks are not evicted automatically. evict_cold_chunks() is meant to be called periodically (e.g., by a plugin)
+ * with the memory that the tables may use. Operators, as well as the accessors and iterables of ReferenceSegments,
+ * keep the segments of stored chunks alive while they read them (see Chunk::get_segment()), so that evictions do not
+ * affect running queries. Only the chunks of intermediate tables, which are never evicted, are read through views
+ * (see Chunk::get_segment_view()).
+ */
+class ChunkBufferManager : public Singleton<ChunkBufferManager> {
+ public:
+  // Defaults to the temporary directory of the system
+  void set_spill_directory(const filesystem::path& spill_directory);
+  filesystem::path spill_directory() const;
+
+  // Returns false if the chunk cannot be evicted or is already evicted
+  bool evict_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  // Evicts the least accessed chunks until the estimated memory usage of all tables fits into @param memory_budget (in
+  // bytes) and halves the access counts of all chunks afterwards. Returns the number of evicted chunks.
+  size_t evict_cold_chunks(const size_t memory_budget);
+
+  // Loads the segments of an evicted chunk in a JobTask, so that they are (hopefully) available when accessed
+  void prefetch(const std::shared_ptr<const Chunk>& chunk) const;
+
+  size_t evicted_chunk_count() const;
+  size_t loaded_chunk_count() const;
+
+ protected:
+  friend class Singleton;
+
+  ChunkBufferManager();
+
+  mutable std::mutex _mutex;
+  filesystem::path _spill_directory;
+
+  // Shared with the SegmentLoaders, which might outlive the ChunkBufferManager
+  std::shared_ptr<std::atomic<size_t>> _loaded_chunk_count;
+  std::atomic<size_t> _evicted_chunk_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include "chunk_compression_service.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+void ChunkCompressionService::start(const std::chrono::milliseconds check_interval) {
+  if (_loop_thread) {
+    _loop_thread->set_loop_sleep_time(check_interval);
+    return;
+  }
+
+  _loop_thread = std::make_unique<PausableLoopThread>(check_interval, [&](size_t) { compress_completed_chunks(); });
+}
+
+void ChunkCompressionService::stop() { _loop_thread.reset(); }
+
+bool ChunkCompressionService::is_running() const { return _loop_thread != nullptr; }
+
+void ChunkCompressionService::set_auto_encoding_spec(const std::optional<AutoEncodingSpec>& auto_encoding_spec) {
+  std::lock_guard<std::mutex> lock{_mutex};
+  _auto_encoding_spec = auto_encoding_spec;
+}
+
+std::optional<AutoEncodingSpec> ChunkCompressionService::auto_encoding_spec() const {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _auto_encoding_spec;
+}
+
+size_t ChunkCompressionService::compress_completed_chunks() {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto tasks = std::vector<std::shared_ptr<ChunkCompressionTask>>{};
+  auto compressed_chunk_count = size_t{0};
+
+  // Copied, as tables might be added or dropped concurrently
+  const auto tables = StorageManager::get().tables();
+  for (const auto& [table_name, table] : tables) {
+    auto chunk_ids = std::vector<ChunkID>{};
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || !chunk->is_mutable()) continue;
+
+      // Chunks that are full, but still have uncommitted rows, are compressed by a later call
+      if (ChunkCompressionTask::chunk_is_completed(*chunk, table->max_chunk_size())) chunk_ids.emplace_back(chunk_id);
+    }
+
+    if (chunk_ids.empty()) continue;
+    compressed_chunk_count += chunk_ids.size();
+    tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, chunk_ids, _auto_encoding_spec));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  return compressed_chunk_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Compresses the chunks of the tables in the StorageManager in the background once they are completed, so that
+ * tables that grow by inserts do not accumulate unencoded chunks. A chunk is completed when it is full (i.e., a new
+ * mutable chunk was appended after it) and all of its rows are committed or rolled back (see ChunkCompressionTask).
+ *
+ * While running, a PausableLoopThread looks for completed chunks that are still mutable every check interval and
+ * compresses them with ChunkCompressionTasks, which are executed by the scheduler if one is set. The tasks encode the
+ * segments (dictionary encoding by default, otherwise chosen by an AutoEncodingSpec), generate the ChunkStatistics,
+ * and mark the chunk as immutable.
+ *
+ * The service does not run by default.
+ */
+class ChunkCompressionService : public Singleton<ChunkCompressionService> {
+ public:
+  static constexpr auto DEFAULT_CHECK_INTERVAL = std::chrono::milliseconds{1000};
+
+  void start(const std::chrono::milliseconds check_interval = DEFAULT_CHECK_INTERVAL);
+
+  // Blocks until a running compression is finished
+  void stop();
+
+  bool is_running() const;
+
+  // std::nullopt (the default) dictionary-encodes all segments
+  void set_auto_encoding_spec(const std::optional<AutoEncodingSpec>& auto_encoding_spec);
+  std::optional<AutoEncodingSpec> auto_encoding_spec() const;
+
+  // Compresses all completed chunks that are still mutable and returns their number. Called by the loop thread, but
+  // can also be called directly.
+  size_t compress_completed_chunks();
+
+ protected:
+  friend class Singleton;
+
+  ChunkCompressionService() = default;
+
+  // Protects the settings and makes sure that only one compress_completed_chunks() runs at a time
+  mutable std::mutex _mutex;
+  std::optional<AutoEncodingSpec> _auto_encoding_spec;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -1,21 +1,535 @@
 #include "chunk_encoder.hpp"
 
+#include <lz4.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "resolve_type.hpp"
 #include "table.hpp"
 #include "types.hpp"
 
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "statistics/chunk_statistics/segment_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/front_coded_dictionary_segment/front_coded_string_vector.hpp"
+#include "storage/global_dictionary_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/assert.hpp"
+#include "utils/timer.hpp"
+#include "utils/tracing/probes.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Rows are sampled in contiguous blocks so that runs of equal values can be counted
+constexpr auto SAMPLE_BLOCK_SIZE = size_t{64};
+
+// Properties of a value segment, extrapolated from a sample
+struct SegmentProperties {
+  size_t row_count{0};
+  bool nullable{false};
+  float null_count{0.0f};
+  float distinct_count{0.0f};
+  float run_count{0.0f};
+
+  // Bytes per value in a ValueSegment and in a contiguous buffer (e.g., of LZ4 or RunLength)
+  float value_size{0.0f};
+  float raw_value_size{0.0f};
+
+  // max - min, only for integral types
+  uint64_t value_range{std::numeric_limits<uint64_t>::max()};
+
+  // Largest distance between consecutive non-NULL values and whether they are sorted, only for integral types. These
+  // are determined from the entire segment, as a single large distance prevents delta encoding.
+  uint64_t max_delta{std::numeric_limits<uint64_t>::max()};
+  bool ascending{false};
+
+  float max_string_length{0.0f};
+  // Average length of the prefix each distinct string shares with its predecessor
+  float shared_prefix_length{0.0f};
+
+  // Size of the LZ4-compressed sample relative to its raw size
+  float lz4_ratio{1.0f};
+};
+
+template <typename T>
+SegmentProperties sample_value_segment(const ValueSegment<T>& segment, const size_t sample_size) {
+  auto properties = SegmentProperties{};
+  properties.row_count = segment.size();
+  properties.nullable = segment.is_nullable();
+  properties.value_size = static_cast<float>(sizeof(T));
+  properties.raw_value_size = static_cast<float>(sizeof(T));
+  if (properties.row_count == 0) return properties;
+
+  const auto row_count = properties.row_count;
+  const auto& values = segment.values();
+  const auto is_null = [&](const size_t offset) { return properties.nullable && segment.null_values()[offset]; };
+
+  // Small segments are looked at completely, larger ones in evenly spaced blocks
+  const auto block_length = row_count <= sample_size ? row_count : SAMPLE_BLOCK_SIZE;
+  const auto block_count = row_count <= sample_size ? size_t{1} : std::max(size_t{1}, sample_size / SAMPLE_BLOCK_SIZE);
+
+  auto value_frequencies = std::map<T, size_t>{};
+  auto sampled_count = size_t{0};
+  auto sampled_null_count = size_t{0};
+  auto adjacent_pair_count = size_t{0};
+  auto value_change_count = size_t{0};
+  auto string_length_sum = size_t{0};
+  auto raw_sample = std::vector<char>{};
+
+  for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+    const auto block_begin = block_id * row_count / block_count;
+    const auto block_end = std::min(row_count, block_begin + block_length);
+
+    for (auto offset = block_begin; offset < block_end; ++offset) {
+      ++sampled_count;
+
+      if (offset > block_begin) {
+        ++adjacent_pair_count;
+        if (is_null(offset) != is_null(offset - 1) ||
+            (!is_null(offset) && !(values[offset] == values[offset - 1]))) {
+          ++value_change_count;
+        }
+      }
+
+      if (is_null(offset)) {
+        ++sampled_null_count;
+        continue;
+      }
+
+      const auto& value = values[offset];
+      ++value_frequencies[value];
+
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        string_length_sum += value.size();
+        raw_sample.insert(raw_sample.end(), value.cbegin(), value.cend());
+      } else {
+        const auto* value_bytes = reinterpret_cast<const char*>(&value);
+        raw_sample.insert(raw_sample.end(), value_bytes, value_bytes + sizeof(T));
+      }
+    }
+  }
+
+  const auto scale = static_cast<float>(row_count) / static_cast<float>(sampled_count);
+  properties.null_count = static_cast<float>(sampled_null_count) * scale;
+
+  // Guaranteed-error estimator (Charikar et al.): values seen once in the sample stand for sqrt(scale) values each
+  auto singleton_count = size_t{0};
+  for (const auto& [value, frequency] : value_frequencies) {
+    if (frequency == 1) ++singleton_count;
+  }
+  const auto estimated_distinct_count = std::sqrt(scale) * static_cast<float>(singleton_count) +
+                                        static_cast<float>(value_frequencies.size() - singleton_count);
+  properties.distinct_count = std::clamp(estimated_distinct_count, static_cast<float>(value_frequencies.size()),
+                                         std::max(static_cast<float>(row_count) - properties.null_count, 1.0f));
+
+  properties.run_count = 1.0f;
+  if (adjacent_pair_count > 0) {
+    properties.run_count += static_cast<float>(value_change_count) / static_cast<float>(adjacent_pair_count) *
+                            static_cast<float>(row_count - 1);
+  }
+
+  if (!value_frequencies.empty()) {
+    const auto& min = value_frequencies.cbegin()->first;
+    const auto& max = value_frequencies.crbegin()->first;
+
+    if constexpr (std::is_integral_v<T>) {
+      properties.value_range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+    }
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto non_null_count = sampled_count - sampled_null_count;
+      const auto average_length = static_cast<float>(string_length_sum) / static_cast<float>(non_null_count);
+      properties.value_size = static_cast<float>(sizeof(pmr_string)) + average_length;
+      properties.raw_value_size = average_length;
+
+      auto shared_prefix_length_sum = size_t{0};
+      auto max_length = size_t{0};
+      const auto* previous = static_cast<const pmr_string*>(nullptr);
+      for (const auto& [value, frequency] : value_frequencies) {
+        max_length = std::max(max_length, value.size());
+        if (previous) {
+          const auto mismatch = std::mismatch(value.cbegin(), value.cend(), previous->cbegin(), previous->cend());
+          shared_prefix_length_sum += static_cast<size_t>(std::distance(value.cbegin(), mismatch.first));
+        }
+        previous = &value;
+      }
+      properties.max_string_length = static_cast<float>(max_length);
+      properties.shared_prefix_length =
+          static_cast<float>(shared_prefix_length_sum) / static_cast<float>(value_frequencies.size());
+    }
+  }
+
+  if constexpr (std::is_integral_v<T>) {
+    properties.max_delta = 0;
+    properties.ascending = true;
+    auto previous_offset = std::optional<size_t>{};
+    for (auto offset = size_t{0}; offset < row_count; ++offset) {
+      if (is_null(offset)) continue;
+      if (previous_offset) {
+        const auto value = values[offset];
+        const auto previous_value = values[*previous_offset];
+        // Computed in unsigned arithmetic, as the difference might overflow T
+        const auto distance = value >= previous_value
+                                  ? static_cast<uint64_t>(value) - static_cast<uint64_t>(previous_value)
+                                  : static_cast<uint64_t>(previous_value) - static_cast<uint64_t>(value);
+        properties.max_delta = std::max(properties.max_delta, distance);
+        properties.ascending &= value >= previous_value;
+      }
+      previous_offset = offset;
+    }
+  }
+
+  if (!raw_sample.empty()) {
+    const auto raw_sample_size = static_cast<int>(raw_sample.size());
+    auto compressed_sample = std::vector<char>(static_cast<size_t>(LZ4_compressBound(raw_sample_size)));
+    const auto compressed_size = LZ4_compress_default(raw_sample.data(), compressed_sample.data(), raw_sample_size,
+                                                      static_cast<int>(compressed_sample.size()));
+    if (compressed_size > 0) {
+      properties.lz4_ratio = static_cast<float>(compressed_size) / static_cast<float>(raw_sample.size());
+    }
+  }
+
+  return properties;
+}
+
+// Bytes per entry of a compressed vector whose largest value is max_value
+float compressed_vector_value_size(const VectorCompressionType vector_compression_type, const uint64_t max_value) {
+  if (vector_compression_type == VectorCompressionType::BitPacking) {
+    auto bit_width = 1u;
+    while (bit_width < 32u && (max_value >> bit_width) > 0) ++bit_width;
+    return static_cast<float>(bit_width) / 8.0f;
+  }
+
+  if (max_value <= std::numeric_limits<uint8_t>::max()) return 1.0f;
+  if (max_value <= std::numeric_limits<uint16_t>::max()) return 2.0f;
+  return 4.0f;
+}
+
+/**
+ * Estimates the size in bytes of the encoded segment and the cost of scanning it relative to scanning the
+ * ValueSegment. The cost factors are coarse: they reflect that dictionary-encoded strings are compared as value ids,
+ * that run-length encoding scans each run only once, that bit-packed and frame-of-reference vectors need some more
+ * work per value to decode, that sorted delta-encoded segments are binary-searched and that LZ4 has to decompress the
+ * entire segment.
+ */
+std::pair<float, float> estimate_encoding(const SegmentEncodingSpec& spec, const SegmentProperties& properties,
+                                          const bool is_string) {
+  const auto row_count = static_cast<float>(properties.row_count);
+  const auto null_vector_size = row_count / 8.0f;
+
+  const auto vector_compression_type =
+      spec.vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned);
+  const auto decompression_cost = vector_compression_type == VectorCompressionType::BitPacking ? 0.2f : 0.0f;
+
+  // The value id distinct_count represents NULL
+  const auto max_value_id = static_cast<uint64_t>(properties.distinct_count);
+  const auto attribute_vector_size = row_count * compressed_vector_value_size(vector_compression_type, max_value_id);
+  const auto value_id_scan_cost = (is_string ? 0.4f : 1.1f) + decompression_cost;
+
+  switch (spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return {row_count * properties.value_size + (properties.nullable ? null_vector_size : 0.0f), 1.0f};
+
+    case EncodingType::Dictionary:
+      return {properties.distinct_count * properties.value_size + attribute_vector_size, value_id_scan_cost};
+
+    case EncodingType::FixedStringDictionary:
+      return {properties.distinct_count * properties.max_string_length + attribute_vector_size,
+              value_id_scan_cost + 0.05f};
+
+    case EncodingType::FrontCodedDictionary: {
+      // Each entry stores the length of its shared prefix and of its suffix in one byte each
+      const auto entry_size = properties.raw_value_size - properties.shared_prefix_length + 2.0f;
+      const auto block_offsets_size =
+          properties.distinct_count / static_cast<float>(FrontCodedStringVector::BLOCK_SIZE) * sizeof(size_t);
+      return {properties.distinct_count * entry_size + block_offsets_size + attribute_vector_size,
+              value_id_scan_cost + 0.15f};
+    }
+
+    case EncodingType::FrameOfReference: {
+      const auto block_count = std::ceil(row_count / FrameOfReferenceSegment<int64_t>::block_size);
+      const auto offset_size = compressed_vector_value_size(vector_compression_type, properties.value_range);
+      return {row_count * offset_size + block_count * properties.raw_value_size + null_vector_size,
+              1.3f + decompression_cost};
+    }
+
+    case EncodingType::Delta: {
+      // Consecutive values must not differ by more than the range of int32_t
+      if (properties.max_delta > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+        return {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+      }
+      const auto block_count = std::ceil(row_count / DeltaSegment<int64_t>::block_size);
+      // Zigzag encoding doubles the distances
+      const auto delta_size = compressed_vector_value_size(vector_compression_type, properties.max_delta * 2);
+      return {row_count * delta_size + block_count * properties.raw_value_size + null_vector_size,
+              (properties.ascending ? 0.2f : 1.4f) + decompression_cost};
+    }
+
+    case EncodingType::RunLength:
+      return {properties.run_count * (properties.value_size + sizeof(ChunkOffset) + 1.0f / 8.0f),
+              0.1f + 1.5f * properties.run_count / row_count};
+
+    case EncodingType::LZ4: {
+      const auto offsets_size = is_string ? row_count * sizeof(size_t) : 0.0f;
+      return {row_count * properties.raw_value_size * properties.lz4_ratio + offsets_size + null_vector_size, 4.0f};
+    }
+
+    case EncodingType::GlobalDictionary:
+      // The dictionary is shared by the chunks of a table, so it is chosen for entire columns instead
+      return {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  }
+  Fail("Unexpected encoding type");
+}
+
+VectorCompressionType vector_compression_type_of(const CompressedVectorType compressed_vector_type) {
+  switch (compressed_vector_type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+    case CompressedVectorType::FixedSize2ByteAligned:
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return VectorCompressionType::FixedSizeByteAligned;
+    case CompressedVectorType::SimdBp128:
+      return VectorCompressionType::SimdBp128;
+    case CompressedVectorType::BitPacking:
+      return VectorCompressionType::BitPacking;
+  }
+  Fail("Unexpected compressed vector type");
+}
+
+template <typename T>
+std::shared_ptr<GlobalDictionarySegment<T>> create_global_dictionary_segment(
+    const std::shared_ptr<const pmr_vector<T>>& dictionary, const pmr_vector<uint32_t>& attribute_vector,
+    const VectorCompressionType vector_compression_type) {
+  // The largest ValueID is the null_value_id, i.e., the dictionary size
+  auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+      compress_vector(attribute_vector, vector_compression_type, PolymorphicAllocator<size_t>{},
+                      {static_cast<uint32_t>(dictionary->size())}));
+  return std::make_shared<GlobalDictionarySegment<T>>(dictionary, compressed_attribute_vector);
+}
+
+/**
+ * Encodes a column of the given chunks with the dictionary that the GlobalDictionarySegments in the other chunks of the
+ * table share. If it does not contain all values of the given chunks, they are merged into a new sorted dictionary. The
+ * ValueIDs of the existing segments are then remapped to it, which only needs one lookup per dictionary entry.
+ */
+template <typename T>
+void encode_with_global_dictionary(Table& table, const ColumnID column_id, const std::vector<ChunkID>& chunk_ids,
+                                   const VectorCompressionType vector_compression_type) {
+  const auto chunk_id_set = std::unordered_set<ChunkID>{chunk_ids.cbegin(), chunk_ids.cend()};
+
+  auto dictionary = std::shared_ptr<const pmr_vector<T>>{};
+  auto encoded_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk_id_set.count(chunk_id)) continue;
+
+    const auto segment = std::dynamic_pointer_cast<const GlobalDictionarySegment<T>>(chunk->get_segment(column_id));
+    if (!segment) continue;
+
+    Assert(!dictionary || segment->dictionary() == dictionary,
+           "The GlobalDictionarySegments of a column must share their dictionary");
+    dictionary = segment->dictionary();
+    encoded_chunk_ids.emplace_back(chunk_id);
+  }
+
+  auto value_segments = std::vector<std::shared_ptr<const ValueSegment<T>>>{};
+  auto new_values = std::vector<T>{};
+  for (const auto chunk_id : chunk_ids) {
+    const auto value_segment =
+        std::dynamic_pointer_cast<const ValueSegment<T>>(table.get_chunk(chunk_id)->get_segment(column_id));
+    Assert(value_segment != nullptr, "All segments of the chunk need to be of type ValueSegment<T>");
+    value_segments.emplace_back(value_segment);
+
+    if (value_segment->is_nullable()) {
+      auto null_value_it = value_segment->null_values().cbegin();
+      for (const auto& value : value_segment->values()) {
+        if (!*null_value_it++) new_values.emplace_back(value);
+      }
+    } else {
+      new_values.insert(new_values.end(), value_segment->values().cbegin(), value_segment->values().cend());
+    }
+  }
+  std::sort(new_values.begin(), new_values.end());
+  new_values.erase(std::unique(new_values.begin(), new_values.end()), new_values.end());
+
+  if (!dictionary || !std::includes(dictionary->cbegin(), dictionary->cend(), new_values.cbegin(), new_values.cend())) {
+    auto merged_dictionary = std::make_shared<pmr_vector<T>>();
+    if (!dictionary) {
+      merged_dictionary->assign(new_values.cbegin(), new_values.cend());
+    } else {
+      merged_dictionary->reserve(dictionary->size() + new_values.size());
+      std::set_union(dictionary->cbegin(), dictionary->cend(), new_values.cbegin(), new_values.cend(),
+                     std::back_inserter(*merged_dictionary));
+
+      // The old ValueIDs are mapped to the new ones, including the null_value_id
+      auto value_id_mapping = std::vector<uint32_t>(dictionary->size() + 1);
+      auto merged_it = merged_dictionary->cbegin();
+      for (auto value_id = size_t{0}; value_id < dictionary->size(); ++value_id) {
+        merged_it = std::lower_bound(merged_it, merged_dictionary->cend(), (*dictionary)[value_id]);
+        value_id_mapping[value_id] = static_cast<uint32_t>(std::distance(merged_dictionary->cbegin(), merged_it));
+      }
+      value_id_mapping.back() = static_cast<uint32_t>(merged_dictionary->size());
+
+      for (const auto chunk_id : encoded_chunk_ids) {
+        const auto chunk = table.get_chunk(chunk_id);
+        const auto& segment = static_cast<const GlobalDictionarySegment<T>&>(*chunk->get_segment(column_id));
+
+        auto attribute_vector = pmr_vector<uint32_t>{};
+        attribute_vector.reserve(segment.size());
+        resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& vector) {
+          for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it) {
+            attribute_vector.emplace_back(value_id_mapping[*value_id_it]);
+          }
+        });
+        chunk->replace_segment(column_id, create_global_dictionary_segment<T>(
+                                              merged_dictionary, attribute_vector,
+                                              vector_compression_type_of(*segment.compressed_vector_type())));
+      }
+    }
+    dictionary = merged_dictionary;
+  }
+
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+  for (auto index = size_t{0}; index < chunk_ids.size(); ++index) {
+    const auto& value_segment = *value_segments[index];
+
+    auto attribute_vector = pmr_vector<uint32_t>{};
+    attribute_vector.reserve(value_segment.size());
+    for (const auto& value : value_segment.values()) {
+      const auto value_it = std::lower_bound(dictionary->cbegin(), dictionary->cend(), value);
+      attribute_vector.emplace_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), value_it)));
+    }
+    if (value_segment.is_nullable()) {
+      auto value_id_it = attribute_vector.begin();
+      for (const auto is_null : value_segment.null_values()) {
+        if (is_null) *value_id_it = null_value_id;
+        ++value_id_it;
+      }
+    }
+
+    table.get_chunk(chunk_ids[index])
+        ->replace_segment(column_id,
+                          create_global_dictionary_segment<T>(dictionary, attribute_vector, vector_compression_type));
+  }
+}
+
+// Encodes the segments that are to be encoded with EncodingType::GlobalDictionary, see encode_with_global_dictionary()
+void encode_global_dictionary_columns(Table& table, const std::vector<ChunkID>& chunk_ids,
+                                      const std::vector<ChunkEncodingSpec>& chunk_encoding_specs) {
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto global_dictionary_chunk_ids = std::vector<ChunkID>{};
+    auto vector_compression_type = std::optional<VectorCompressionType>{};
+    for (auto index = size_t{0}; index < chunk_ids.size(); ++index) {
+      const auto& spec = chunk_encoding_specs[index][column_id];
+      if (spec.encoding_type != EncodingType::GlobalDictionary) continue;
+
+      global_dictionary_chunk_ids.emplace_back(chunk_ids[index]);
+      if (!vector_compression_type) vector_compression_type = spec.vector_compression_type;
+    }
+    if (global_dictionary_chunk_ids.empty()) continue;
+
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      encode_with_global_dictionary<ColumnDataType>(
+          table, column_id, global_dictionary_chunk_ids,
+          vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned));
+    });
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 
+SegmentEncodingSpec ChunkEncoder::select_segment_encoding(const DataType data_type,
+                                                          const std::shared_ptr<const BaseValueSegment>& value_segment,
+                                                          const AutoEncodingSpec& auto_encoding_spec) {
+  Assert(auto_encoding_spec.memory_weight >= 0.0f && auto_encoding_spec.memory_weight <= 1.0f,
+         "Memory weight must be between 0 and 1");
+  Assert(value_segment, "Encodings can only be selected for value segments");
+
+  auto properties = SegmentProperties{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto& typed_segment = static_cast<const ValueSegment<ColumnDataType>&>(*value_segment);
+    properties = sample_value_segment(typed_segment, auto_encoding_spec.sample_size);
+  });
+
+  if (properties.row_count == 0) return SegmentEncodingSpec{};
+
+  const auto is_string = data_type == DataType::String;
+  const auto unencoded_size = estimate_encoding({EncodingType::Unencoded}, properties, is_string).first;
+
+  auto best_spec = SegmentEncodingSpec{EncodingType::Unencoded};
+  auto best_score = std::numeric_limits<float>::max();
+
+  const auto consider = [&](const SegmentEncodingSpec& spec) {
+    const auto [size, scan_cost] = estimate_encoding(spec, properties, is_string);
+    const auto score = auto_encoding_spec.memory_weight * size / unencoded_size +
+                       (1.0f - auto_encoding_spec.memory_weight) * scan_cost;
+    if (score < best_score) {
+      best_score = score;
+      best_spec = spec;
+    }
+  };
+
+  for (const auto encoding_type : encoding_type_enum_values) {
+    if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+
+    if (encoding_type == EncodingType::Unencoded || !create_encoder(encoding_type)->uses_vector_compression()) {
+      consider({encoding_type});
+      continue;
+    }
+
+    for (const auto vector_compression_type :
+         {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::BitPacking}) {
+      consider({encoding_type, vector_compression_type});
+    }
+  }
+
+  return best_spec;
+}
+
+ChunkEncodingSpec ChunkEncoder::select_chunk_encoding(const std::shared_ptr<const Chunk>& chunk,
+                                                      const std::vector<DataType>& column_data_types,
+                                                      const AutoEncodingSpec& auto_encoding_spec) {
+  Assert((column_data_types.size() == chunk->column_count()),
+         "Number of column types must match the chunk’s column count.");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(chunk->column_count());
+
+  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_id));
+    Assert(value_segment != nullptr, "All segments of the chunk need to be of type ValueSegment<T>");
+
+    chunk_encoding_spec.push_back(
+        select_segment_encoding(column_data_types[column_id], value_segment, auto_encoding_spec));
+  }
+
+  return chunk_encoding_spec;
+}
+
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
                                 const ChunkEncodingSpec& chunk_encoding_spec) {
   Assert((column_data_types.size() == chunk->column_count()),
@@ -23,24 +537,48 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   Assert((chunk_encoding_spec.size() == chunk->column_count()),
          "Number of column encoding specs must match the chunk’s column count.");
 
-  std::vector<std::shared_ptr<SegmentStatistics>> column_statistics;
-  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+  Timer timer;
+
+  // The segments are encoded concurrently. Replacing them in the chunk is left to this thread.
+  const auto column_count = chunk->column_count();
+  auto encoded_segments = std::vector<std::shared_ptr<BaseEncodedSegment>>(column_count);
+  auto column_statistics = std::vector<std::shared_ptr<SegmentStatistics>>(column_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(column_count);
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
     const auto spec = chunk_encoding_spec[column_id];
 
     const auto data_type = column_data_types[column_id];
     const auto base_segment = chunk->get_segment(column_id);
     const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(base_segment);
 
+    // Segments that share the dictionary of their column have already been encoded with the table, see
+    // encode_global_dictionary_columns()
+    if (!value_segment && spec.encoding_type == EncodingType::GlobalDictionary) {
+      column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, base_segment);
+      continue;
+    }
+
     Assert(value_segment != nullptr, "All segments of the chunk need to be of type ValueSegment<T>");
 
     if (spec.encoding_type == EncodingType::Unencoded) {
       // No need to encode, but we still want to have statistics for the now immutable value segment
-      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, value_segment));
-    } else {
-      auto encoded_segment = encode_segment(spec.encoding_type, data_type, value_segment, spec.vector_compression_type);
-      chunk->replace_segment(column_id, encoded_segment);
-      column_statistics.push_back(SegmentStatistics::build_statistics(data_type, encoded_segment));
+      column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, value_segment);
+      continue;
     }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id, spec, data_type, value_segment]() {
+      encoded_segments[column_id] =
+          encode_segment(spec.encoding_type, data_type, value_segment, spec.vector_compression_type);
+      column_statistics[column_id] = SegmentStatistics::build_statistics(data_type, encoded_segments[column_id]);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    if (encoded_segments[column_id]) chunk->replace_segment(column_id, encoded_segments[column_id]);
   }
 
   chunk->mark_immutable();
@@ -49,6 +587,9 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   if (chunk->has_mvcc_data()) {
     chunk->get_scoped_mvcc_data_lock()->shrink();
   }
+
+  DTRACE_PROBE4(HYRISE, CHUNK_ENCODED, reinterpret_cast<uintptr_t>(chunk.get()), chunk->size(), chunk->column_count(),
+                timer.lap().count());
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
@@ -57,67 +598,69 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   encode_chunk(chunk, column_data_types, chunk_encoding_spec);
 }
 
+void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
+                                const AutoEncodingSpec& auto_encoding_spec) {
+  encode_chunk(chunk, column_data_types, select_chunk_encoding(chunk, column_data_types, auto_encoding_spec));
+}
+
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                                  const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs) {
-  const auto column_data_types = table->column_data_types();
-
-  for (auto chunk_id : chunk_ids) {
-    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-
-    auto chunk = table->get_chunk(chunk_id);
-    const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
-
-    encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+  auto specs = std::vector<ChunkEncodingSpec>{};
+  specs.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    specs.emplace_back(chunk_encoding_specs.at(chunk_id));
   }
+
+  _encode_chunks(table, chunk_ids, specs);
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                                  const SegmentEncodingSpec& segment_encoding_spec) {
-  const auto column_data_types = table->column_data_types();
-
-  for (auto chunk_id : chunk_ids) {
-    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
-    auto chunk = table->get_chunk(chunk_id);
-
-    encode_chunk(chunk, column_data_types, segment_encoding_spec);
-  }
+  const auto chunk_encoding_spec = ChunkEncodingSpec{table->column_count(), segment_encoding_spec};
+  _encode_chunks(table, chunk_ids, std::vector<ChunkEncodingSpec>(chunk_ids.size(), chunk_encoding_spec));
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const std::vector<ChunkEncodingSpec>& chunk_encoding_specs) {
-  const auto column_types = table->column_data_types();
   const auto chunk_count = static_cast<size_t>(table->chunk_count());
   Assert(chunk_encoding_specs.size() == chunk_count, "Number of encoding specs must match table’s chunk count.");
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
-
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
-  }
+  _encode_chunks(table, _all_chunk_ids(*table), chunk_encoding_specs);
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const ChunkEncodingSpec& chunk_encoding_spec) {
   Assert(chunk_encoding_spec.size() == table->column_count(),
          "Number of encoding specs must match table’s column count.");
-  const auto column_types = table->column_data_types();
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
-    encode_chunk(chunk, column_types, chunk_encoding_spec);
-  }
+  const auto chunk_ids = _all_chunk_ids(*table);
+  _encode_chunks(table, chunk_ids, std::vector<ChunkEncodingSpec>(chunk_ids.size(), chunk_encoding_spec));
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
                                      const SegmentEncodingSpec& segment_encoding_spec) {
-  const auto column_types = table->column_data_types();
+  encode_chunks(table, _all_chunk_ids(*table), segment_encoding_spec);
+}
+
+void ChunkEncoder::_encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                                  const std::vector<ChunkEncodingSpec>& chunk_encoding_specs) {
+  const auto column_data_types = table->column_data_types();
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    auto chunk = table->get_chunk(chunk_id);
+  for (const auto chunk_id : chunk_ids) {
+    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+  }
+
+  encode_global_dictionary_columns(*table, chunk_ids, chunk_encoding_specs);
 
-    encode_chunk(chunk, column_types, segment_encoding_spec);
+  for (auto index = size_t{0}; index < chunk_ids.size(); ++index) {
+    encode_chunk(table->get_chunk(chunk_ids[index]), column_data_types, chunk_encoding_specs[index]);
   }
 }
 
+std::vector<ChunkID> ChunkEncoder::_all_chunk_ids(const Table& table) {
+  auto chunk_ids = std::vector<ChunkID>(table.chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+  return chunk_ids;
+}
+
 }  // namespace opossum
@@ -14,6 +14,7 @@
 
 namespace opossum {
 
+class BaseValueSegment;
 class Chunk;
 class Table;
 
@@ -29,6 +30,17 @@ struct SegmentEncodingSpec {
 
 using ChunkEncodingSpec = std::vector<SegmentEncodingSpec>;
 
+/**
+ * @brief Parameters for choosing the encoding of each segment automatically
+ *
+ * memory_weight trades scan speed (0.0) against memory footprint (1.0).
+ * sample_size is the number of rows per segment that are looked at to estimate its properties.
+ */
+struct AutoEncodingSpec {
+  float memory_weight{0.5f};
+  size_t sample_size{4096};
+};
+
 /**
  * @brief Interface for encoding chunks
  *
@@ -40,7 +52,7 @@ class ChunkEncoder {
   /**
    * @brief Encodes a chunk
    *
-   * Encodes a chunk using the passed encoding specifications.
+   * Encodes a chunk using the passed encoding specifications. Its segments are encoded concurrently as JobTasks.
    * Reduces also the fragmentation of the chunk’s MVCC data.
    * All segments of the chunk need to be of type ValueSegment<T>,
    * i.e., recompression is not yet supported.
@@ -48,6 +60,9 @@ class ChunkEncoder {
    * Note: In some cases, it might be beneficial to
    *       leave certain segments of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
+   *
+   * Note: EncodingType::GlobalDictionary needs the table to share the dictionary between its chunks. Encoded with
+   *       this method, the dictionary only holds the values of the segment, see encode_chunks().
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
                            const ChunkEncodingSpec& chunk_encoding_spec);
@@ -58,10 +73,39 @@ class ChunkEncoder {
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
                            const SegmentEncodingSpec& segment_encoding_spec = {});
 
+  /**
+   * @brief Encodes a chunk choosing the encoding of each segment automatically
+   *
+   * See select_segment_encoding()
+   */
+  static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
+                           const AutoEncodingSpec& auto_encoding_spec);
+
+  /**
+   * @brief Chooses an encoding for a value segment
+   *
+   * Samples the segment (distinct values, runs, value range, string lengths) and estimates for each encoding that
+   * supports the data type how large the encoded segment will be and how expensive it is to scan compared to the
+   * unencoded segment. The spec with the lowest score, weighted by auto_encoding_spec.memory_weight, is returned.
+   */
+  static SegmentEncodingSpec select_segment_encoding(const DataType data_type,
+                                                     const std::shared_ptr<const BaseValueSegment>& value_segment,
+                                                     const AutoEncodingSpec& auto_encoding_spec = {});
+
+  /**
+   * @brief Chooses an encoding for each segment of a chunk
+   *
+   * All segments of the chunk need to be of type ValueSegment<T>.
+   */
+  static ChunkEncodingSpec select_chunk_encoding(const std::shared_ptr<const Chunk>& chunk,
+                                                 const std::vector<DataType>& column_data_types,
+                                                 const AutoEncodingSpec& auto_encoding_spec = {});
+
   /**
    * @brief Encodes the specified chunks of the passed table
    *
-   * The encoding is specified per segment for each chunk.
+   * The encoding is specified per segment for each chunk. Segments with EncodingType::GlobalDictionary share a
+   * dictionary with the GlobalDictionarySegments of their column in all chunks of the table.
    */
   static void encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
                             const std::map<ChunkID, ChunkEncodingSpec>& chunk_encoding_specs);
@@ -92,6 +136,14 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+ private:
+  // Encodes the segments with EncodingType::GlobalDictionary column by column first, as they share the dictionary of
+  // their column (see GlobalDictionarySegment), and then each chunk
+  static void _encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
+                             const std::vector<ChunkEncodingSpec>& chunk_encoding_specs);
+
+  static std::vector<ChunkID> _all_chunk_ids(const Table& table);
 };
 
 }  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "memory/huge_page_memory_resource.hpp"
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DeltaEncoder : public SegmentEncoder<DeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Delta>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = with_huge_pages(value_segment->values().get_allocator());
+
+    static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+    const auto size = value_segment->size();
+
+    // holds the first value of each block
+    auto block_checkpoints = pmr_vector<T>{alloc};
+    block_checkpoints.reserve((size + block_size - 1u) / block_size);
+
+    // holds the uncompressed, zigzag-encoded deltas
+    auto deltas = pmr_vector<uint32_t>{alloc};
+    deltas.reserve(size);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // used as optional input for the compression of the deltas
+    auto max_delta = uint32_t{0u};
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      // NULLs repeat the preceding value. Leading NULLs repeat the first non-NULL value, so that the first delta is 0.
+      auto previous_value = T{0};
+      for (auto it = segment_it; it != segment_end; ++it) {
+        const auto segment_value = *it;
+        if (!segment_value.is_null()) {
+          previous_value = segment_value.value();
+          break;
+        }
+      }
+
+      for (auto chunk_offset = size_t{0}; segment_it != segment_end; ++segment_it, ++chunk_offset) {
+        const auto segment_value = *segment_it;
+        const auto value = segment_value.is_null() ? previous_value : segment_value.value();
+        null_values.push_back(segment_value.is_null());
+
+        if (chunk_offset % block_size == 0) block_checkpoints.push_back(value);
+
+        // The distance is computed in unsigned arithmetic, as the difference might overflow T
+        using UnsignedT = std::make_unsigned_t<T>;
+        const auto distance = value >= previous_value
+                                  ? static_cast<UnsignedT>(value) - static_cast<UnsignedT>(previous_value)
+                                  : static_cast<UnsignedT>(previous_value) - static_cast<UnsignedT>(value);
+        Assert(distance <= static_cast<UnsignedT>(std::numeric_limits<int32_t>::max()),
+               "Difference between consecutive values must fit into int32_t.");
+        const auto delta = value >= previous_value ? static_cast<int64_t>(distance) : -static_cast<int64_t>(distance);
+
+        const auto encoded_delta = DeltaSegment<T>::encode_delta(delta);
+        deltas.push_back(encoded_delta);
+        max_delta = std::max(max_delta, encoded_delta);
+
+        previous_value = value;
+      }
+    });
+
+    auto compressed_deltas = compress_vector(deltas, vector_compression_type(), alloc, {max_delta});
+
+    return std::allocate_shared<DeltaSegment<T>>(alloc, std::move(block_checkpoints), std::move(null_values),
+                                                 std::move(compressed_deltas));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DeltaIterable : public PointAccessibleSegmentIterable<DeltaIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit DeltaIterable(const DeltaSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.deltas(), [&](const auto& deltas) {
+      using DeltaIteratorT = decltype(deltas.cbegin());
+
+      const auto& block_checkpoints = _segment.block_checkpoints();
+      const auto size = static_cast<ChunkOffset>(_segment.size());
+
+      // The end iterator holds the last value, so that it can be decremented
+      auto first_value = T{0};
+      auto last_value = T{0};
+      if (size > 0) {
+        first_value = block_checkpoints.front();
+        last_value = block_checkpoints.back();
+        auto decompressor = deltas.create_decompressor();
+        const auto last_block_begin = (size - 1) / DeltaSegment<T>::block_size * DeltaSegment<T>::block_size;
+        for (auto chunk_offset = last_block_begin + 1; chunk_offset < size; ++chunk_offset) {
+          last_value = static_cast<T>(last_value + DeltaSegment<T>::decode_delta(decompressor->get(chunk_offset)));
+        }
+      }
+
+      auto begin = Iterator<DeltaIteratorT>{first_value, deltas.cbegin(), _segment.null_values().cbegin(),
+                                            ChunkOffset{0}, size};
+
+      auto end = Iterator<DeltaIteratorT>{last_value, deltas.cend(), _segment.null_values().cend(), size, size};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    resolve_compressed_vector_type(_segment.deltas(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using DeltaDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto begin = PointAccessIterator<DeltaDecompressorT>{&_segment.block_checkpoints(), &_segment.null_values(),
+                                                           std::move(decompressor), position_filter->cbegin(),
+                                                           position_filter->cbegin()};
+
+      auto end = PointAccessIterator<DeltaDecompressorT>{position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const DeltaSegment<T>& _segment;
+
+ private:
+  // Decodes the values by summing up the deltas. The current value is kept when moving past the last position, so
+  // that the iterator can be decremented from the end.
+  template <typename DeltaIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<DeltaIteratorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaIterable<T>;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // value is the value at chunk_offset or, for the end iterator, the last value
+    explicit Iterator(const T value, DeltaIteratorT delta_it, NullValueIterator null_value_it,
+                      const ChunkOffset chunk_offset, const ChunkOffset size)
+        : _value{value},
+          _delta_it{delta_it},
+          _null_value_it{null_value_it},
+          _chunk_offset{chunk_offset},
+          _size{size} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_delta_it;
+      ++_null_value_it;
+      ++_chunk_offset;
+
+      if (_chunk_offset < _size) {
+        _value = static_cast<T>(_value + DeltaSegment<T>::decode_delta(*_delta_it));
+      }
+    }
+
+    void decrement() {
+      if (_chunk_offset < _size) {
+        _value = static_cast<T>(_value - DeltaSegment<T>::decode_delta(*_delta_it));
+      }
+
+      --_delta_it;
+      --_null_value_it;
+      --_chunk_offset;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      // Every value depends on its predecessor, so there is no shortcut
+      if (n < 0) {
+        for (std::ptrdiff_t i = n; i < 0; ++i) {
+          decrement();
+        }
+      } else {
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+          increment();
+        }
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _delta_it == other._delta_it; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const { return other._delta_it - _delta_it; }
+
+    SegmentPosition<T> dereference() const { return SegmentPosition<T>{_value, *_null_value_it, _chunk_offset}; }
+
+   private:
+    T _value;
+    DeltaIteratorT _delta_it;
+    NullValueIterator _null_value_it;
+    ChunkOffset _chunk_offset;
+    ChunkOffset _size;
+  };
+
+  template <typename DeltaDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<DeltaDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaIterable<T>;
+
+    // Begin Iterator
+    PointAccessIterator(const pmr_vector<T>* block_checkpoints, const pmr_vector<bool>* null_values,
+                        const std::shared_ptr<DeltaDecompressorT>& delta_decompressor,
+                        const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<DeltaDecompressorT>,
+                                         SegmentPosition<T>>{std::move(position_filter_begin),
+                                                             std::move(position_filter_it)},
+          _block_checkpoints{block_checkpoints},
+          _null_values{null_values},
+          _delta_decompressor{delta_decompressor} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, nullptr, nullptr, std::move(position_filter_begin),
+                              std::move(position_filter_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+      // Position lists are often sorted. If the previously decoded position lies in the same block before this one,
+      // decoding continues from there instead of from the block's checkpoint.
+      const auto block_begin = static_cast<ChunkOffset>(chunk_offset - chunk_offset % block_size);
+      auto decoded_offset = block_begin;
+      auto value = (*_block_checkpoints)[chunk_offset / block_size];
+      if (_cached_offset != INVALID_CHUNK_OFFSET && _cached_offset >= block_begin && _cached_offset <= chunk_offset) {
+        decoded_offset = _cached_offset;
+        value = _cached_value;
+      }
+
+      for (auto offset = decoded_offset + 1; offset <= chunk_offset; ++offset) {
+        value = static_cast<T>(value + DeltaSegment<T>::decode_delta(_delta_decompressor->get(offset)));
+      }
+
+      _cached_offset = chunk_offset;
+      _cached_value = value;
+
+      const auto is_null = (*_null_values)[chunk_offset];
+      return SegmentPosition<T>{value, is_null, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const pmr_vector<T>* _block_checkpoints;
+    const pmr_vector<bool>* _null_values;
+    std::shared_ptr<DeltaDecompressorT> _delta_decompressor;
+    mutable ChunkOffset _cached_offset{INVALID_CHUNK_OFFSET};
+    mutable T _cached_value{};
+  };
+};
+
+}  // namespace opossum
@@ -0,0 +1,162 @@
+#include "delta_segment.hpp"
+
+#include <algorithm>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Zigzag-encoded deltas are even iff they are non-negative
+bool deltas_are_non_negative(const BaseCompressedVector& deltas) {
+  if (deltas.size() == 0) return true;
+
+  auto non_negative = true;
+  resolve_compressed_vector_type(deltas, [&](const auto& typed_deltas) {
+    non_negative = std::all_of(typed_deltas.cbegin(), typed_deltas.cend(),
+                               [](const auto encoded_delta) { return (encoded_delta & 1u) == 0u; });
+  });
+  return non_negative;
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T, typename U>
+DeltaSegment<T, U>::DeltaSegment(pmr_vector<T> block_checkpoints, pmr_vector<bool> null_values,
+                                 std::unique_ptr<const BaseCompressedVector> deltas)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _block_checkpoints{std::move(block_checkpoints)},
+      _null_values{std::move(null_values)},
+      _deltas{std::move(deltas)},
+      _decompressor{_deltas->create_base_decompressor()},
+      _is_ascending{deltas_are_non_negative(*_deltas)} {}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaSegment<T, U>::block_checkpoints() const {
+  return _block_checkpoints;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& DeltaSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& DeltaSegment<T, U>::deltas() const {
+  return *_deltas;
+}
+
+template <typename T, typename U>
+bool DeltaSegment<T, U>::is_ascending() const {
+  return _is_ascending;
+}
+
+template <typename T, typename U>
+ChunkOffset DeltaSegment<T, U>::lower_bound(const T value) const {
+  return _partition_point(value,
+                          [](const T segment_value, const T search_value) { return segment_value < search_value; });
+}
+
+template <typename T, typename U>
+ChunkOffset DeltaSegment<T, U>::upper_bound(const T value) const {
+  return _partition_point(value,
+                          [](const T segment_value, const T search_value) { return segment_value <= search_value; });
+}
+
+template <typename T, typename U>
+template <typename Predicate>
+ChunkOffset DeltaSegment<T, U>::_partition_point(const T search_value, const Predicate& is_before) const {
+  DebugAssert(_is_ascending, "Binary search requires the segment to be sorted in ascending order");
+
+  // Find the first block whose checkpoint is not before the search value. The partition point is either the first
+  // position of that block or lies within the preceding block, which is the only one that has to be decoded.
+  const auto block_it = std::partition_point(_block_checkpoints.cbegin(), _block_checkpoints.cend(),
+                                             [&](const T checkpoint) { return is_before(checkpoint, search_value); });
+  const auto block_index = static_cast<size_t>(std::distance(_block_checkpoints.cbegin(), block_it));
+  if (block_index == 0) return ChunkOffset{0};
+
+  const auto block_end = std::min(block_index * block_size, size());
+  auto chunk_offset = (block_index - 1) * block_size;
+  auto value = _block_checkpoints[block_index - 1];
+  for (++chunk_offset; chunk_offset < block_end; ++chunk_offset) {
+    value = static_cast<T>(value + decode_delta(_decompressor->get(chunk_offset)));
+    if (!is_before(value, search_value)) break;
+  }
+
+  return static_cast<ChunkOffset>(chunk_offset);
+}
+
+template <typename T, typename U>
+const AllTypeVariant DeltaSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> DeltaSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+  return _decode(chunk_offset);
+}
+
+template <typename T, typename U>
+T DeltaSegment<T, U>::_decode(const ChunkOffset chunk_offset) const {
+  const auto block_begin = chunk_offset - chunk_offset % block_size;
+  auto value = _block_checkpoints[chunk_offset / block_size];
+  for (auto offset = block_begin + 1; offset <= chunk_offset; ++offset) {
+    value = static_cast<T>(value + decode_delta(_decompressor->get(offset)));
+  }
+  return value;
+}
+
+template <typename T, typename U>
+size_t DeltaSegment<T, U>::size() const {
+  return _deltas->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> DeltaSegment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_checkpoints = pmr_vector<T>{_block_checkpoints, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_deltas = _deltas->copy_using_allocator(alloc);
+
+  return std::allocate_shared<DeltaSegment>(alloc, std::move(new_block_checkpoints), std::move(new_null_values),
+                                            std::move(new_deltas));
+}
+
+template <typename T, typename U>
+size_t DeltaSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(T) * _block_checkpoints.size() + _deltas->data_size() +
+         _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType DeltaSegment<T, U>::encoding_type() const {
+  return EncodingType::Delta;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> DeltaSegment<T, U>::compressed_vector_type() const {
+  return _deltas->type();
+}
+
+template class DeltaSegment<int32_t>;
+template class DeltaSegment<int64_t>;
+
+}  // namespace opossum
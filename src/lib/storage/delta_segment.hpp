@@ -0,0 +1,111 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+#include <memory>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing delta encoding
+ *
+ * Each value is stored as the difference to its predecessor. The differences are
+ * zigzag-encoded so that small negative differences also become small unsigned
+ * integers, which are then compressed using vector compression. Columns that are
+ * (mostly) sorted, such as IDs or timestamps, need only a few bits per value.
+ *
+ * To avoid summing up all differences from the beginning of the segment, the
+ * segment is divided into fixed-size blocks and the first value of each block is
+ * stored as a checkpoint. NULLs repeat the preceding value (leading NULLs the first
+ * non-NULL value), so that they do not interrupt an otherwise sorted segment. If
+ * all differences are non-negative, the checkpoints are the block minima and
+ * lower_bound()/upper_bound() binary-search them before decoding a single block.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::Delta>, hana::type_c<T>)>>
+class DeltaSegment : public BaseEncodedSegment {
+ public:
+  /**
+   * Accessing a single value decodes up to block_size differences, while each
+   * checkpoint costs sizeof(T) bytes. The block size trades off between both.
+   */
+  static constexpr auto block_size = 128u;
+
+  explicit DeltaSegment(pmr_vector<T> block_checkpoints, pmr_vector<bool> null_values,
+                        std::unique_ptr<const BaseCompressedVector> deltas);
+
+  const pmr_vector<T>& block_checkpoints() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& deltas() const;
+
+  // Returns true if the (NULL-filled) values are sorted in ascending order
+  bool is_ascending() const;
+
+  // Return the first chunk offset whose value is not less than (lower_bound) or greater than (upper_bound) the given
+  // value. Only valid for ascending segments. As NULLs repeat their preceding value, the range between the two bounds
+  // might contain NULLs.
+  ChunkOffset lower_bound(const T value) const;
+  ChunkOffset upper_bound(const T value) const;
+
+  // Zigzag encoding maps 0, -1, 1, -2, 2, ... to 0, 1, 2, 3, 4, ...
+  static uint32_t encode_delta(const int64_t delta) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(delta) << 1u) ^ static_cast<uint64_t>(delta >> 63u));
+  }
+
+  static int64_t decode_delta(const uint32_t encoded_delta) {
+    return static_cast<int64_t>(encoded_delta >> 1u) ^ -static_cast<int64_t>(encoded_delta & 1u);
+  }
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  // Decodes the value at chunk_offset, including the values repeated for NULLs
+  T _decode(const ChunkOffset chunk_offset) const;
+
+  // Returns the first chunk offset whose value does not satisfy is_before(value, search_value)
+  template <typename Predicate>
+  ChunkOffset _partition_point(const T search_value, const Predicate& is_before) const;
+
+  const pmr_vector<T> _block_checkpoints;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _deltas;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+  const bool _is_ascending;
+};
+
+}  // namespace opossum
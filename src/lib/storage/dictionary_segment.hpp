@@ -37,9 +37,9 @@ class DictionarySegment : public BaseDictionarySegment {
 
   size_t size() const final;
 
-  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const override;
 
-  size_t estimate_memory_usage() const final;
+  size_t estimate_memory_usage() const override;
   /**@}*/
 
   /**
@@ -53,7 +53,7 @@ class DictionarySegment : public BaseDictionarySegment {
    * @defgroup BaseDictionarySegment interface
    * @{
    */
-  EncodingType encoding_type() const final;
+  EncodingType encoding_type() const override;
 
   ValueID lower_bound(const AllTypeVariant& value) const final;
   ValueID upper_bound(const AllTypeVariant& value) const final;
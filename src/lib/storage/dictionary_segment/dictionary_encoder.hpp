@@ -3,10 +3,15 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
+#include "memory/huge_page_memory_resource.hpp"
 #include "storage/base_segment_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
+#include "storage/global_dictionary_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
@@ -19,7 +24,7 @@ namespace opossum {
  * @brief Encodes a segment using dictionary encoding and compresses its attribute vector using vector compression.
  *
  * The algorithm first creates an attribute vector of standard size (uint32_t) and then compresses it
- * using fixed-size byte-aligned encoding.
+ * using fixed-size byte-aligned encoding. Only the distinct values are sorted, see _on_encode().
  */
 template <auto Encoding>
 class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
@@ -29,60 +34,23 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
 
   template <typename T>
   std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
-    // See: https://goo.gl/MCM5rr
-    // Create dictionary (enforce uniqueness and sorting)
     const auto& values = value_segment->values();
+    const auto alloc = with_huge_pages(values.get_allocator());
 
-    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
-      // Encode a segment with a FixedStringVector as dictionary. pmr_string is the only supported type
-      return _encode_dictionary_segment(
-          FixedStringVector{values.cbegin(), values.cend(), _calculate_fixed_string_length(values), values.size()},
-          value_segment);
-    } else {
-      // Encode a segment with a pmr_vector<T> as dictionary
-      return _encode_dictionary_segment(pmr_vector<T>{values.cbegin(), values.cend(), values.get_allocator()},
-                                        value_segment);
-    }
-  }
-
- private:
-  template <typename U, typename T>
-  static ValueID _get_value_id(const U& dictionary, const T& value) {
-    return ValueID{static_cast<ValueID::base_type>(
-        std::distance(dictionary.cbegin(), std::lower_bound(dictionary.cbegin(), dictionary.cend(), value)))};
-  }
-
-  template <typename U, typename T>
-  std::shared_ptr<BaseEncodedSegment> _encode_dictionary_segment(
-      U dictionary, const std::shared_ptr<const ValueSegment<T>>& value_segment) {
-    const auto& values = value_segment->values();
-    const auto alloc = values.get_allocator();
-
-    // Remove null values from value vector
-    if (value_segment->is_nullable()) {
-      const auto& null_values = value_segment->null_values();
-
-      // Swap values to back if value is null
-      auto erase_from_here_it = dictionary.end();
-      auto null_it = null_values.crbegin();
-      for (auto dict_it = dictionary.rbegin(); dict_it != dictionary.rend(); ++dict_it, ++null_it) {
-        if (*null_it) {
-          std::iter_swap(dict_it, --erase_from_here_it);
-        }
-      }
-
-      // Erase null values
-      dictionary.erase(erase_from_here_it, dictionary.end());
-    }
+    // Instead of sorting all values and searching the ValueID of each row in the dictionary, the distinct values are
+    // collected in a hash map, which assigns preliminary ids in order of appearance. Only the distinct values are
+    // sorted, and the preliminary ids are then translated to their rank in the sorted dictionary.
+    auto preliminary_ids = std::unordered_map<T, uint32_t>{};
+    auto distinct_values = pmr_vector<T>{};
 
-    std::sort(dictionary.begin(), dictionary.end());
-    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
-    dictionary.shrink_to_fit();
-
-    auto attribute_vector = pmr_vector<uint32_t>{values.get_allocator()};
+    auto attribute_vector = pmr_vector<uint32_t>{alloc};
     attribute_vector.reserve(values.size());
 
-    const auto null_value_id = static_cast<uint32_t>(dictionary.size());
+    const auto add_value = [&](const T& value) {
+      const auto [iter, inserted] = preliminary_ids.try_emplace(value, static_cast<uint32_t>(distinct_values.size()));
+      if (inserted) distinct_values.emplace_back(value);
+      attribute_vector.push_back(iter->second);
+    };
 
     if (value_segment->is_nullable()) {
       const auto& null_values = value_segment->null_values();
@@ -95,39 +63,79 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
       auto null_value_it = null_values.cbegin();
       for (; value_it != values.cend(); ++value_it, ++null_value_it) {
         if (*null_value_it) {
-          attribute_vector.push_back(null_value_id);
+          attribute_vector.push_back(NULL_MARKER);
           continue;
         }
-
-        const auto value_id = _get_value_id(dictionary, *value_it);
-        attribute_vector.push_back(value_id);
+        add_value(*value_it);
       }
     } else {
-      auto value_it = values.cbegin();
-      for (; value_it != values.cend(); ++value_it) {
-        const auto value_id = _get_value_id(dictionary, *value_it);
-        attribute_vector.push_back(value_id);
+      for (const auto& value : values) {
+        add_value(value);
       }
     }
 
+    auto sorted_values = pmr_vector<T>{distinct_values, alloc};
+    std::sort(sorted_values.begin(), sorted_values.end());
+
+    auto ranks = std::vector<uint32_t>(distinct_values.size());
+    for (auto preliminary_id = size_t{0}; preliminary_id < distinct_values.size(); ++preliminary_id) {
+      const auto& value = distinct_values[preliminary_id];
+      ranks[preliminary_id] = static_cast<uint32_t>(
+          std::distance(sorted_values.cbegin(), std::lower_bound(sorted_values.cbegin(), sorted_values.cend(), value)));
+    }
+
+    const auto null_value_id = static_cast<uint32_t>(sorted_values.size());
+    for (auto& value_id : attribute_vector) {
+      value_id = value_id == NULL_MARKER ? null_value_id : ranks[value_id];
+    }
+
+    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+      // Encode a segment with a FixedStringVector as dictionary. pmr_string is the only supported type
+      auto dictionary = FixedStringVector{sorted_values.cbegin(), sorted_values.cend(),
+                                          _calculate_fixed_string_length(sorted_values), sorted_values.size()};
+      return _create_segment<T>(std::move(dictionary), attribute_vector, null_value_id, alloc);
+    } else {
+      // Encode a segment with a pmr_vector<T> as dictionary. For FrontCodedDictionary, the sorted dictionary is
+      // front-coded once the attribute vector has been built.
+      return _create_segment<T>(std::move(sorted_values), attribute_vector, null_value_id, alloc);
+    }
+  }
+
+ private:
+  // Marks NULLs in the attribute vector until the null_value_id is known
+  static constexpr auto NULL_MARKER = std::numeric_limits<uint32_t>::max();
+
+  template <typename T, typename U>
+  std::shared_ptr<BaseEncodedSegment> _create_segment(U dictionary, const pmr_vector<uint32_t>& attribute_vector,
+                                                      const uint32_t null_value_id,
+                                                      const PolymorphicAllocator<T>& alloc) {
     // We need to increment the dictionary size here because of possible null values.
     const auto max_value = dictionary.size() + 1u;
 
     auto encoded_attribute_vector = compress_vector(
         attribute_vector, SegmentEncoder<DictionaryEncoder<Encoding>>::vector_compression_type(), alloc, {max_value});
-    auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
     auto attribute_vector_sptr = std::shared_ptr<const BaseCompressedVector>(std::move(encoded_attribute_vector));
 
-    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+    if constexpr (Encoding == EncodingType::FrontCodedDictionary) {
+      auto dictionary_sptr = std::allocate_shared<FrontCodedStringVector>(alloc, dictionary, alloc);
+      return std::allocate_shared<FrontCodedDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
+                                                                  ValueID{null_value_id});
+    } else if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<FixedStringDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                                    ValueID{null_value_id});
+    } else if constexpr (Encoding == EncodingType::GlobalDictionary) {
+      // Without the table, the dictionary only holds the values of this segment, see GlobalDictionarySegment
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
+      return std::allocate_shared<GlobalDictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr);
     } else {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<DictionarySegment<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                         ValueID{null_value_id});
     }
   }
 
-  size_t _calculate_fixed_string_length(const pmr_concurrent_vector<pmr_string>& values) const {
+  size_t _calculate_fixed_string_length(const pmr_vector<pmr_string>& values) const {
     size_t max_string_length = 0;
     for (const auto& value : values) {
       if (value.size() > max_string_length) max_string_length = value.size();
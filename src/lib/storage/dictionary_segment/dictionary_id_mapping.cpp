@@ -0,0 +1,130 @@
+#include "dictionary_id_mapping.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+std::shared_ptr<const DictionaryIDMapping> DictionaryIDMapping::create(
+    const std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>& columns) {
+  Assert(!columns.empty(), "Expected at least one column");
+  const auto data_type = columns.front().first->column_data_type(columns.front().second);
+
+  // Collect the segments of the columns and of the columns that their ReferenceSegments reference
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  auto segments_by_column = decltype(_segments_by_column){};
+  auto row_count = size_t{0};
+  const auto collect_segments = [&](const Table& table, const ColumnID column_id, const auto& collect) -> bool {
+    if (table.column_data_type(column_id) != data_type) return false;
+    const auto [column_it, inserted] = segments_by_column.try_emplace({&table, column_id});
+    if (!inserted) return true;
+
+    const auto chunk_count = table.chunk_count();
+    column_it->second.resize(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+      if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+        if (!collect(*reference_segment->referenced_table(), reference_segment->referenced_column_id(), collect)) {
+          return false;
+        }
+      } else {
+        segments.emplace_back(segment);
+        column_it->second[chunk_id] = segment;
+      }
+    }
+    return true;
+  };
+  for (const auto& [table, column_id] : columns) {
+    if (!collect_segments(*table, column_id, collect_segments)) return nullptr;
+    row_count += table->row_count();
+  }
+
+  auto mapping = std::make_shared<DictionaryIDMapping>();
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Segments that share a dictionary share its translation
+    auto dictionaries = std::vector<std::shared_ptr<const pmr_vector<ColumnDataType>>>{};
+    auto dictionary_indices = std::unordered_map<const pmr_vector<ColumnDataType>*, size_t>{};
+    auto dictionary_index_of_segment = std::vector<size_t>{};
+    dictionary_index_of_segment.reserve(segments.size());
+    for (const auto& segment : segments) {
+      const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment);
+      if (!dictionary_segment) {
+        mapping = nullptr;
+        return;
+      }
+
+      const auto& dictionary = dictionary_segment->dictionary();
+      const auto [index_it, inserted] = dictionary_indices.try_emplace(dictionary.get(), dictionaries.size());
+      if (inserted) dictionaries.emplace_back(dictionary);
+      dictionary_index_of_segment.emplace_back(index_it->second);
+    }
+
+    const auto all_equal =
+        std::all_of(dictionaries.cbegin(), dictionaries.cend(), [&](const auto& dictionary) {
+          return *dictionary == *dictionaries.front();
+        });
+    if (all_equal) return;
+
+    auto entry_count = size_t{0};
+    for (const auto& dictionary : dictionaries) {
+      entry_count += dictionary->size();
+    }
+    if (!std::is_same_v<ColumnDataType, pmr_string> || entry_count * 2 > row_count) {
+      mapping = nullptr;
+      return;
+    }
+
+    auto merged_dictionary = std::vector<ColumnDataType>{};
+    merged_dictionary.reserve(entry_count);
+    for (const auto& dictionary : dictionaries) {
+      merged_dictionary.insert(merged_dictionary.end(), dictionary->cbegin(), dictionary->cend());
+    }
+    std::sort(merged_dictionary.begin(), merged_dictionary.end());
+    merged_dictionary.erase(std::unique(merged_dictionary.begin(), merged_dictionary.end()), merged_dictionary.end());
+
+    // As the dictionaries are sorted, the position of each entry in the merged dictionary is searched for starting at
+    // the position of the previous entry
+    auto translations = std::vector<std::shared_ptr<const std::vector<ValueID>>>{};
+    translations.reserve(dictionaries.size());
+    for (const auto& dictionary : dictionaries) {
+      auto translation = std::vector<ValueID>(dictionary->size());
+      auto merged_it = merged_dictionary.cbegin();
+      for (auto value_id = size_t{0}; value_id < dictionary->size(); ++value_id) {
+        merged_it = std::lower_bound(merged_it, merged_dictionary.cend(), (*dictionary)[value_id]);
+        translation[value_id] = ValueID{static_cast<ValueID::base_type>(merged_it - merged_dictionary.cbegin())};
+      }
+      translations.emplace_back(std::make_shared<const std::vector<ValueID>>(std::move(translation)));
+    }
+
+    for (auto segment_idx = size_t{0}; segment_idx < segments.size(); ++segment_idx) {
+      mapping->_translations.emplace(segments[segment_idx].get(),
+                                     translations[dictionary_index_of_segment[segment_idx]]);
+    }
+  });
+
+  if (mapping) mapping->_segments_by_column = std::move(segments_by_column);
+
+  return mapping;
+}
+
+bool DictionaryIDMapping::is_identity() const { return _translations.empty(); }
+
+const std::vector<ValueID>* DictionaryIDMapping::_translation(const BaseSegment& segment) const {
+  if (_translations.empty()) return nullptr;
+
+  const auto translation_it = _translations.find(&segment);
+  DebugAssert(translation_it != _translations.cend(), "Segment is not part of the mapped columns");
+  return translation_it->second.get();
+}
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Maps the ValueIDs of the DictionarySegments of one or more columns to ids that are comparable across all of them:
+ * Equal values get equal ids, and the ids are ordered like the values. Operators that only compare values (e.g., the
+ * joins) can work on these ids instead of decoding, hashing, and comparing the values.
+ *
+ * If all segments share one dictionary (see GlobalDictionarySegment) or their dictionaries are equal, the ValueIDs are
+ * the ids. Otherwise, the dictionaries are merged into one sorted dictionary and the ValueIDs of each dictionary are
+ * translated to positions in it. The merge compares the values once per dictionary entry instead of once per row. It
+ * is therefore only done for strings, and only if the dictionaries have at most half as many entries as the columns
+ * have rows.
+ */
+class DictionaryIDMapping {
+ public:
+  // Returns nullptr if the columns have different data types, if a segment (for ReferenceSegments, a referenced one)
+  // is not a DictionarySegment, or if the dictionaries differ and are not worth merging (see above)
+  static std::shared_ptr<const DictionaryIDMapping> create(
+      const std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>& columns);
+
+  // True if the ValueIDs are used as they are
+  bool is_identity() const;
+
+  /**
+   * Calls functor(is_null, id, chunk_offset) for each row of a segment of one of the columns. As in the joins, the
+   * chunk_offset of a row of a ReferenceSegment is its position in the ReferenceSegment, not in the referenced segment.
+   */
+  template <typename Functor>
+  void for_each_id(const BaseSegment& segment, const Functor& functor) const {
+    if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+      const auto& referenced_segments = _segments_by_column.at(
+          {reference_segment->referenced_table().get(), reference_segment->referenced_column_id()});
+
+      // PosLists mostly reference one chunk after another, so the decompressor of the last chunk is kept
+      auto last_chunk_id = INVALID_CHUNK_ID;
+      auto decompressor = std::unique_ptr<BaseVectorDecompressor>{};
+      auto null_value_id = INVALID_VALUE_ID;
+      auto translation = static_cast<const std::vector<ValueID>*>(nullptr);
+
+      auto chunk_offset = ChunkOffset{0};
+      for (const auto& row_id : *reference_segment->pos_list()) {
+        if (row_id.is_null()) {
+          functor(true, ValueID{0}, chunk_offset++);
+          continue;
+        }
+
+        if (row_id.chunk_id != last_chunk_id) {
+          last_chunk_id = row_id.chunk_id;
+          const auto& referenced_segment =
+              static_cast<const BaseDictionarySegment&>(*referenced_segments.at(row_id.chunk_id));
+          decompressor = referenced_segment.attribute_vector()->create_base_decompressor();
+          null_value_id = referenced_segment.null_value_id();
+          translation = _translation(referenced_segment);
+        }
+
+        const auto value_id = ValueID{decompressor->get(row_id.chunk_offset)};
+        if (value_id == null_value_id) {
+          functor(true, ValueID{0}, chunk_offset++);
+        } else {
+          functor(false, translation ? (*translation)[value_id] : value_id, chunk_offset++);
+        }
+      }
+      return;
+    }
+
+    const auto& dictionary_segment = static_cast<const BaseDictionarySegment&>(segment);
+    const auto null_value_id = dictionary_segment.null_value_id();
+    const auto* translation = _translation(dictionary_segment);
+    resolve_compressed_vector_type(*dictionary_segment.attribute_vector(), [&](const auto& vector) {
+      auto chunk_offset = ChunkOffset{0};
+      for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it, ++chunk_offset) {
+        const auto value_id = ValueID{*value_id_it};
+        if (value_id == null_value_id) {
+          functor(true, ValueID{0}, chunk_offset);
+        } else {
+          functor(false, translation ? (*translation)[value_id] : value_id, chunk_offset);
+        }
+      }
+    });
+  }
+
+ private:
+  const std::vector<ValueID>* _translation(const BaseSegment& segment) const;
+
+  // The translated ValueIDs of the dictionary of each segment. Empty if the ValueIDs are used as they are.
+  std::unordered_map<const BaseSegment*, std::shared_ptr<const std::vector<ValueID>>> _translations;
+
+  // The non-reference segments of the mapped columns and of the columns referenced by them, by column and ChunkID.
+  // for_each_id() resolves ReferenceSegments through them instead of the referenced tables, as the referenced chunks
+  // might be evicted (and loaded into new segments) while the mapping is used. Keeping the segments alive also ensures
+  // that the addresses in _translations are not reused.
+  std::map<std::pair<const Table*, ColumnID>, std::vector<std::shared_ptr<const BaseSegment>>> _segments_by_column;
+};
+
+}  // namespace opossum
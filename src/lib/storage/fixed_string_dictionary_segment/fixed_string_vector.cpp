@@ -69,6 +69,10 @@ const pmr_string FixedStringVector::get_string_at(const size_t pos) const {
 
 char* FixedStringVector::data() { return _chars.data(); }
 
+const char* FixedStringVector::data() const { return _chars.data(); }
+
+size_t FixedStringVector::string_length() const { return _string_length; }
+
 size_t FixedStringVector::size() const {
   // If the string length is zero, `_chars` has always the size 0. Thus, we don't know
   // how many empty strings were added to the FixedStringVector. So the FixedStringVector size is
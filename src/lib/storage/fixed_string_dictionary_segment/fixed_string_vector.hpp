@@ -58,6 +58,10 @@ class FixedStringVector {
 
   // Return a pointer to the underlying memory
   char* data();
+  const char* data() const;
+
+  // Return the number of characters reserved for each string. Shorter strings are padded with '\0'.
+  size_t string_length() const;
 
   // Return the number of entries in the vector.
   size_t size() const;
@@ -5,6 +5,7 @@
 #include <limits>
 #include <memory>
 
+#include "memory/huge_page_memory_resource.hpp"
 #include "storage/base_segment_encoder.hpp"
 
 #include "storage/frame_of_reference_segment.hpp"
@@ -23,7 +24,7 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
 
   template <typename T>
   std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
-    const auto alloc = value_segment->values().get_allocator();
+    const auto alloc = with_huge_pages(value_segment->values().get_allocator());
 
     static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
 
@@ -0,0 +1,163 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+void write_length(opossum::pmr_vector<char>& chars, size_t length) {
+  // LEB128: seven bits per byte, the highest bit marks that another byte follows
+  while (length >= 0x80) {
+    chars.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  chars.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& data) {
+  auto length = size_t{0};
+  auto shift = 0u;
+  while (true) {
+    const auto byte = static_cast<unsigned char>(*data++);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return length;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+FrontCodedStringVector::FrontCodedStringVector(const pmr_vector<pmr_string>& sorted_strings,
+                                               const PolymorphicAllocator<size_t>& alloc)
+    : _chars(alloc), _block_offsets(alloc), _size(sorted_strings.size()) {
+  DebugAssert(std::is_sorted(sorted_strings.cbegin(), sorted_strings.cend()), "Strings must be sorted");
+
+  _block_offsets.reserve((_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  for (auto pos = size_t{0}; pos < _size; ++pos) {
+    const auto& string = sorted_strings[pos];
+
+    if (pos % BLOCK_SIZE == 0) {
+      _block_offsets.push_back(_chars.size());
+      write_length(_chars, string.size());
+      _chars.insert(_chars.end(), string.cbegin(), string.cend());
+      continue;
+    }
+
+    const auto& previous = sorted_strings[pos - 1];
+    const auto max_prefix_length = std::min(previous.size(), string.size());
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(string.cbegin(), string.cbegin() + max_prefix_length, previous.cbegin()).first -
+        string.cbegin());
+
+    write_length(_chars, prefix_length);
+    write_length(_chars, string.size() - prefix_length);
+    _chars.insert(_chars.end(), string.cbegin() + prefix_length, string.cend());
+  }
+  _chars.shrink_to_fit();
+}
+
+FrontCodedStringVector::FrontCodedStringVector(const FrontCodedStringVector& other,
+                                               const PolymorphicAllocator<size_t>& alloc)
+    : _chars(other._chars, alloc), _block_offsets(other._block_offsets, alloc), _size(other._size) {}
+
+template <typename Functor>
+void FrontCodedStringVector::_decode_block(const size_t block_id, const Functor& functor) const {
+  const auto* data = _chars.data() + _block_offsets[block_id];
+  const auto block_begin = block_id * BLOCK_SIZE;
+  const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+
+  auto string = pmr_string{};
+  for (auto pos = block_begin; pos < block_end; ++pos) {
+    const auto prefix_length = pos == block_begin ? size_t{0} : read_length(data);
+    const auto suffix_length = read_length(data);
+    string.resize(prefix_length);
+    string.append(data, suffix_length);
+    data += suffix_length;
+
+    if (!functor(pos, string)) return;
+  }
+}
+
+std::string_view FrontCodedStringVector::_block_head(const size_t block_id) const {
+  const auto* data = _chars.data() + _block_offsets[block_id];
+  const auto length = read_length(data);
+  return std::string_view{data, length};
+}
+
+pmr_string FrontCodedStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < _size, "Position out of bounds");
+
+  auto result = pmr_string{};
+  _decode_block(pos / BLOCK_SIZE, [&](const size_t decoded_pos, const pmr_string& string) {
+    if (decoded_pos < pos) return true;
+    result = string;
+    return false;
+  });
+  return result;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string_view value) const { return _bound(value, false); }
+
+size_t FrontCodedStringVector::upper_bound(const std::string_view value) const { return _bound(value, true); }
+
+size_t FrontCodedStringVector::_bound(const std::string_view value, const bool upper) const {
+  const auto belongs_before = [&](const std::string_view string) { return upper ? string <= value : string < value; };
+
+  // Find the first block whose head does not belong before the value. The result is either in the preceding block or
+  // it is that block's head.
+  auto block_begin = size_t{0};
+  auto block_end = _block_offsets.size();
+  while (block_begin < block_end) {
+    const auto block_mid = block_begin + (block_end - block_begin) / 2;
+    if (belongs_before(_block_head(block_mid))) {
+      block_begin = block_mid + 1;
+    } else {
+      block_end = block_mid;
+    }
+  }
+  if (block_begin == 0) return 0;
+
+  auto result = std::min(block_begin * BLOCK_SIZE, _size);
+  _decode_block(block_begin - 1, [&](const size_t pos, const pmr_string& string) {
+    if (belongs_before(string)) return true;
+    result = pos;
+    return false;
+  });
+  return result;
+}
+
+FrontCodedStringIterator FrontCodedStringVector::begin() const noexcept { return FrontCodedStringIterator(*this, 0); }
+
+FrontCodedStringIterator FrontCodedStringVector::end() const noexcept {
+  return FrontCodedStringIterator(*this, _size);
+}
+
+FrontCodedStringIterator FrontCodedStringVector::cbegin() const noexcept { return begin(); }
+
+FrontCodedStringIterator FrontCodedStringVector::cend() const noexcept { return end(); }
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+size_t FrontCodedStringVector::data_size() const {
+  return sizeof(*this) + _chars.capacity() + _block_offsets.capacity() * sizeof(size_t);
+}
+
+std::shared_ptr<const pmr_vector<pmr_string>> FrontCodedStringVector::dictionary() const {
+  pmr_vector<pmr_string> string_values;
+  string_values.reserve(_size);
+  for (auto block_id = size_t{0}; block_id < _block_offsets.size(); ++block_id) {
+    _decode_block(block_id, [&](const size_t, const pmr_string& string) {
+      string_values.emplace_back(string);
+      return true;
+    });
+  }
+  return std::make_shared<pmr_vector<pmr_string>>(std::move(string_values));
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class FrontCodedStringIterator;
+
+/**
+ * FrontCodedStringVector stores a sorted list of strings using front coding (incremental encoding): The strings are
+ * grouped into blocks of BLOCK_SIZE. The first string of each block is stored completely, every following string only
+ * stores the length of the prefix that it shares with its predecessor and the remaining suffix. Both lengths are
+ * stored as variable-length integers. For dictionaries of strings with long common prefixes (URLs, product names),
+ * this is much smaller than storing each string separately.
+ *
+ * Accessing a single string decodes its block up to that string. lower_bound() and upper_bound() first run a binary
+ * search on the block heads, which can be compared without decoding, and then decode a single block.
+ */
+class FrontCodedStringVector {
+ public:
+  static constexpr size_t BLOCK_SIZE = 16;
+
+  // The strings must be sorted and unique
+  explicit FrontCodedStringVector(const pmr_vector<pmr_string>& sorted_strings,
+                                  const PolymorphicAllocator<size_t>& alloc = {});
+
+  FrontCodedStringVector(const FrontCodedStringVector& other, const PolymorphicAllocator<size_t>& alloc);
+
+  pmr_string get_string_at(const size_t pos) const;
+
+  // Return the position of the first string that is not less than (lower_bound) or greater than (upper_bound) the
+  // given value, or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+  size_t upper_bound(const std::string_view value) const;
+
+  FrontCodedStringIterator begin() const noexcept;
+  FrontCodedStringIterator end() const noexcept;
+  FrontCodedStringIterator cbegin() const noexcept;
+  FrontCodedStringIterator cend() const noexcept;
+
+  // Return the number of strings in the vector
+  size_t size() const;
+
+  // Return the calculated size of FrontCodedStringVector in main memory
+  size_t data_size() const;
+
+  // Return the decoded strings as a vector of strings
+  std::shared_ptr<const pmr_vector<pmr_string>> dictionary() const;
+
+ protected:
+  // Position of the first string that does not belong before the value, where `upper` decides whether equal strings
+  // belong before it
+  size_t _bound(const std::string_view value, const bool upper) const;
+
+  // Calls functor(position, string) for the strings of a block until it returns false
+  template <typename Functor>
+  void _decode_block(const size_t block_id, const Functor& functor) const;
+
+  // The head of a block is stored completely and can be returned without decoding
+  std::string_view _block_head(const size_t block_id) const;
+
+  pmr_vector<char> _chars;
+  pmr_vector<size_t> _block_offsets;
+  size_t _size;
+};
+
+// Random access iterator that decodes the strings of a FrontCodedStringVector. It returns strings by value.
+class FrontCodedStringIterator
+    : public boost::iterator_facade<FrontCodedStringIterator, pmr_string, std::random_access_iterator_tag, pmr_string> {
+ public:
+  FrontCodedStringIterator(const FrontCodedStringVector& vector, size_t pos) : _vector(&vector), _pos(pos) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  // We have a couple of NOLINTs here because the facade expects these method names:
+
+  bool equal(const FrontCodedStringIterator& other) const {  // NOLINT
+    return _vector == other._vector && _pos == other._pos;
+  }
+
+  std::ptrdiff_t distance_to(const FrontCodedStringIterator& other) const {  // NOLINT
+    return static_cast<std::ptrdiff_t>(other._pos) - static_cast<std::ptrdiff_t>(_pos);
+  }
+
+  void advance(std::ptrdiff_t n) {  // NOLINT
+    _pos += n;
+  }
+
+  void increment() {  // NOLINT
+    ++_pos;
+  }
+
+  void decrement() {  // NOLINT
+    --_pos;
+  }
+
+  pmr_string dereference() const {  // NOLINT
+    return _vector->get_string_at(_pos);
+  }
+
+  const FrontCodedStringVector* _vector;
+  size_t _pos;
+};
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * 16-byte string representation for operator intermediates (also known as "German string", see the Umbra paper by
+ * Neumann and Freitag). The first four characters are stored inline as a prefix. Strings of up to INLINE_SIZE
+ * characters are stored inline completely, longer ones point to a copy in a memory resource, usually an arena that
+ * lives as long as the intermediate. Most comparisons are decided by the size and the prefix without following the
+ * pointer.
+ *
+ * GermanStrings do not own their memory and are trivially copyable. They are not part of the AllTypeVariant.
+ */
+class GermanString {
+ public:
+  static constexpr auto PREFIX_SIZE = size_t{4};
+  static constexpr auto INLINE_SIZE = size_t{12};
+
+  GermanString() = default;
+
+  // Strings longer than INLINE_SIZE are copied into memory_resource
+  GermanString(const std::string_view string, boost::container::pmr::memory_resource& memory_resource)
+      : _size{static_cast<uint32_t>(string.size())} {
+    DebugAssert(string.size() <= std::numeric_limits<uint32_t>::max(), "String too long for GermanString");
+    if (string.size() <= INLINE_SIZE) {
+      std::memcpy(_inline_data(), string.data(), string.size());
+    } else {
+      std::memcpy(_prefix, string.data(), PREFIX_SIZE);
+      auto* copy = static_cast<char*>(memory_resource.allocate(string.size(), 1));
+      std::memcpy(copy, string.data(), string.size());
+      _pointer = copy;
+    }
+  }
+
+  size_t size() const { return _size; }
+
+  bool is_inline() const { return _size <= INLINE_SIZE; }
+
+  std::string_view view() const {
+    return is_inline() ? std::string_view{_inline_data(), _size} : std::string_view{_pointer, _size};
+  }
+
+  friend bool operator==(const GermanString& lhs, const GermanString& rhs) {
+    // Size and prefix are compared in one step
+    if (lhs._size_and_prefix() != rhs._size_and_prefix()) return false;
+    if (lhs.is_inline()) return lhs._suffix() == rhs._suffix();
+    return std::memcmp(lhs._pointer + PREFIX_SIZE, rhs._pointer + PREFIX_SIZE, lhs._size - PREFIX_SIZE) == 0;
+  }
+
+  friend bool operator!=(const GermanString& lhs, const GermanString& rhs) { return !(lhs == rhs); }
+
+  friend bool operator<(const GermanString& lhs, const GermanString& rhs) {
+    // Unused prefix characters are zero. Thus, the prefixes only decide if they differ.
+    const auto prefix_comparison = std::memcmp(lhs._prefix, rhs._prefix, PREFIX_SIZE);
+    if (prefix_comparison != 0) return prefix_comparison < 0;
+    return lhs.view() < rhs.view();
+  }
+
+ private:
+  uint64_t _size_and_prefix() const {
+    auto size_and_prefix = uint64_t{};
+    std::memcpy(&size_and_prefix, this, sizeof(size_and_prefix));
+    return size_and_prefix;
+  }
+
+  uint64_t _suffix() const {
+    auto suffix = uint64_t{};
+    std::memcpy(&suffix, _inline_suffix, sizeof(suffix));
+    return suffix;
+  }
+
+  // Inline strings occupy _prefix and _inline_suffix, which are adjacent
+  char* _inline_data() { return reinterpret_cast<char*>(this) + sizeof(_size); }
+  const char* _inline_data() const { return reinterpret_cast<const char*>(this) + sizeof(_size); }
+
+  uint32_t _size{0};
+  char _prefix[PREFIX_SIZE]{};
+  union {
+    char _inline_suffix[INLINE_SIZE - PREFIX_SIZE]{};
+    const char* _pointer;
+  };
+};
+
+static_assert(sizeof(GermanString) == 16, "GermanString should fit into 16 bytes");
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::GermanString> {
+  size_t operator()(const opossum::GermanString& string) const { return std::hash<std::string_view>{}(string.view()); }
+};
+
+}  // namespace std
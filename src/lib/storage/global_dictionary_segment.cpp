@@ -0,0 +1,36 @@
+#include "global_dictionary_segment.hpp"
+
+#include <memory>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+
+namespace opossum {
+
+template <typename T>
+GlobalDictionarySegment<T>::GlobalDictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+                                                    const std::shared_ptr<const BaseCompressedVector>& attribute_vector)
+    : DictionarySegment<T>(dictionary, attribute_vector, ValueID{static_cast<ValueID::base_type>(dictionary->size())}) {
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> GlobalDictionarySegment<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+      this->_attribute_vector->copy_using_allocator(alloc));
+  return std::allocate_shared<GlobalDictionarySegment<T>>(alloc, this->_dictionary, new_attribute_vector);
+}
+
+template <typename T>
+size_t GlobalDictionarySegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + this->_attribute_vector->data_size();
+}
+
+template <typename T>
+EncodingType GlobalDictionarySegment<T>::encoding_type() const {
+  return EncodingType::GlobalDictionary;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(GlobalDictionarySegment);
+
+}  // namespace opossum
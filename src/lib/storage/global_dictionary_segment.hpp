@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "dictionary_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Segment implementing dictionary encoding with a dictionary that is shared by all chunks of a column
+ *
+ * The sorted dictionary holds the values of all GlobalDictionarySegments of the column, so that the segments only
+ * store their attribute vectors. Equal values have the same ValueID in all chunks: Scans look up the search value once
+ * per dictionary instead of once per chunk, and Aggregate and JoinHash can work on ValueIDs across chunks (and across
+ * columns that share the dictionary). The null_value_id is the size of the shared dictionary.
+ *
+ * The dictionary is built by ChunkEncoder::encode_chunks() and ChunkEncoder::encode_all_chunks(). Chunks that are
+ * encoded later reuse it if it contains all of their values. Otherwise, the new values are merged into a new sorted
+ * dictionary and the attribute vectors of the existing segments are remapped to it. A segment encoded without its
+ * table (e.g., by encode_segment()) gets a dictionary of its own values.
+ */
+template <typename T>
+class GlobalDictionarySegment : public DictionarySegment<T> {
+ public:
+  explicit GlobalDictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+                                   const std::shared_ptr<const BaseCompressedVector>& attribute_vector);
+
+  // The copy shares the dictionary, only the attribute vector is copied
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  // The shared dictionary is not included, as it does not belong to a single segment
+  size_t estimate_memory_usage() const final;
+
+  EncodingType encoding_type() const final;
+};
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -18,7 +19,9 @@ namespace opossum {
 
 size_t AdaptiveRadixTreeIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
                                                            uint32_t value_bytes) {
-  Fail("AdaptiveRadixTreeIndex::estimate_memory_consumption() is not implemented yet");
+  // The chunk offsets, one leaf per distinct value, and about one ARTNode256 per 256 leaves, as the ValueIDs are dense
+  return row_count * sizeof(ChunkOffset) + distinct_count * sizeof(Leaf) +
+         (distinct_count / 256 + 1) * sizeof(ARTNode256);
 }
 
 AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
@@ -27,22 +30,32 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr
   Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
   Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
 
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
-  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_indexed_segment->attribute_vector()->size());
+  // Sort the chunk offsets by their value ID. As the value IDs are dense (NULL has the largest one), a counting sort
+  // does this in linear time.
+  const auto value_id_count = static_cast<size_t>(_indexed_segment->null_value_id()) + 1;
+  std::vector<std::pair<ValueID, ChunkOffset>> pairs_to_insert(_indexed_segment->attribute_vector()->size());
 
   resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
+    auto value_id_offsets = std::vector<size_t>(value_id_count + 1);
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend(); ++value_id_it) {
+      ++value_id_offsets[*value_id_it + 1];
+    }
+    std::partial_sum(value_id_offsets.begin(), value_id_offsets.end(), value_id_offsets.begin());
+
     auto chunk_offset = ChunkOffset{0u};
     auto value_id_it = attribute_vector.cbegin();
     for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
-      pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_it}), chunk_offset);
+      pairs_to_insert[value_id_offsets[*value_id_it]++] = {ValueID{*value_id_it}, chunk_offset};
     }
   });
 
   _root = _bulk_insert(pairs_to_insert);
 }
 
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(AdaptiveRadixTreeIndex&&) = default;
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
   assert(values.size() == 1);
   ValueID value_id = _indexed_segment->lower_bound(values[0]);
@@ -66,62 +79,60 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offs
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
 
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values) {
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
+    const std::vector<std::pair<ValueID, ChunkOffset>>& values) {
   DebugAssert(!(values.empty()), "Index on empty segment is not defined");
-  _chunk_offsets.reserve(values.size());
-  auto begin = _chunk_offsets.cbegin();
-  return _bulk_insert(values, static_cast<size_t>(0u), begin);
+  DebugAssert(std::is_sorted(values.begin(), values.end(),
+                             [](const auto& left, const auto& right) { return left.first < right.first; }),
+              "Values have to be sorted by ValueID");
+
+  // The leaves point into _chunk_offsets, which must thus not be reallocated afterwards
+  _chunk_offsets.resize(values.size());
+  std::transform(values.begin(), values.end(), _chunk_offsets.begin(), [](const auto& pair) { return pair.second; });
+
+  return _bulk_insert(values, 0u, values.size(), 0u);
 }
 
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values, size_t depth, BaseIndex::Iterator& it) {
-  // This is the anchor of the recursion: if all values have the same key, create a leaf.
-  if (std::all_of(values.begin(), values.end(), [&values](const std::pair<BinaryComparable, ChunkOffset>& pair) {
-        return values.front().first == pair.first;
-      })) {
-    // copy the Iterator in the _chunk_offsets - vector --> this is the lower_bound of the leaf
-    auto lower = it;
-    // insert the ChunkOffsets into the vector and push the Iterator further
-    auto old_capacity = _chunk_offsets.capacity();
-    for (const auto& pair : values) {
-      _chunk_offsets.emplace_back(pair.second);
-    }
-    std::advance(it, values.size());
-    auto new_capacity = _chunk_offsets.capacity();
-    // we are not allowed to change the size of the vector as it would invalidate all our Iterators
-    Assert(old_capacity == new_capacity, "_chunk_offsets capacity changes, all Iterators are invalidated");
-
-    // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
-    auto upper = it;
-    return std::make_shared<Leaf>(lower, upper);
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
+    const std::vector<std::pair<ValueID, ChunkOffset>>& values, const size_t begin, const size_t end, size_t depth) {
+  // This is the anchor of the recursion: if all values have the same key, create a leaf. As the values are sorted,
+  // this is the case if the first and the last one have the same key.
+  if (values[begin].first == values[end - 1].first) {
+    return std::make_unique<Leaf>(values[begin].first, _chunk_offsets.cbegin() + begin, _chunk_offsets.cbegin() + end);
   }
 
-  // radix-partition on the depths-byte into 256 partitions
-  std::array<std::vector<std::pair<BinaryComparable, ChunkOffset>>, std::numeric_limits<uint8_t>::max() + 1> partitions;
-  for (const auto& pair : values) {
-    partitions[pair.first[depth]].emplace_back(pair);
+  // Path compression: the bytes that all keys share are stored as the prefix of the node
+  const auto first_key = BinaryComparable(values[begin].first);
+  const auto last_key = BinaryComparable(values[end - 1].first);
+  auto prefix = std::vector<uint8_t>{};
+  while (first_key[depth] == last_key[depth]) {
+    prefix.emplace_back(first_key[depth]);
+    ++depth;
   }
 
-  // call recursively for each non-empty partition and gather the children
-  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children;
-
-  for (uint16_t partition_id = 0; partition_id < partitions.size(); ++partition_id) {
-    if (!partitions[partition_id].empty()) {
-      auto child =
-          std::make_pair(static_cast<uint8_t>(partition_id), _bulk_insert(partitions[partition_id], depth + 1, it));
-      children.emplace_back(std::move(child));
-    }
+  // The values with the same byte at depth form consecutive ranges. Call recursively for each of them and gather the
+  // children.
+  ARTNodeChildren children;
+  for (auto range_begin = begin; range_begin < end;) {
+    const auto partial_key = BinaryComparable(values[range_begin].first)[depth];
+    const auto range_end = static_cast<size_t>(std::distance(
+        values.begin(),
+        std::partition_point(values.begin() + range_begin, values.begin() + end, [&](const auto& pair) {
+          return BinaryComparable(pair.first)[depth] == partial_key;
+        })));
+    children.emplace_back(partial_key, _bulk_insert(values, range_begin, range_end, depth + 1));
+    range_begin = range_end;
   }
+
   // finally create the appropriate ARTNode according to the size of the children
   if (children.size() <= 4) {
-    return std::make_shared<ARTNode4>(children);
+    return std::make_unique<ARTNode4>(children, prefix);
   } else if (children.size() <= 16) {
-    return std::make_shared<ARTNode16>(children);
+    return std::make_unique<ARTNode16>(children, prefix);
   } else if (children.size() <= 48) {
-    return std::make_shared<ARTNode48>(children);
+    return std::make_unique<ARTNode48>(children, prefix);
   } else {
-    return std::make_shared<ARTNode256>(children);
+    return std::make_unique<ARTNode256>(children, prefix);
   }
 }
 
@@ -130,11 +141,10 @@ std::vector<std::shared_ptr<const BaseSegment>> AdaptiveRadixTreeIndex::_get_ind
 }
 
 size_t AdaptiveRadixTreeIndex::_memory_consumption() const {
-  // ToDo(anyone): If you use this index in combination with the Tuning subsystem, you need to properly implement this.
-  Fail("AdaptiveRadixTreeIndex::_memory_consumption() is not implemented yet");
+  return sizeof(*this) + _chunk_offsets.capacity() * sizeof(ChunkOffset) + _root->memory_consumption();
 }
 
-AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) : _parts(sizeof(value)) {
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) {
   for (size_t byte_id = 1; byte_id <= _parts.size(); ++byte_id) {
     // grab the 8 least significant bits and put them at the front of the vector
     _parts[_parts.size() - byte_id] = static_cast<uint8_t>(value) & 0xFFu;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -24,6 +25,10 @@ class BaseDictionarySegment;
  * Each node has an array which contains pointers to its children and (if needed) an index array in order to map
  * partial keys to positions in the array of the child-pointers
  *
+ * As the keys are the ValueIDs of the dictionary segment, the index is bulk-built from the chunk offsets sorted by
+ * ValueID: Consecutive chunk offsets with the same ValueID form a leaf, and each inner node covers a contiguous range
+ * of them.
+ *
  * The full specification of an ART can be found in the following paper: https://db.in.tum.de/~leis/papers/ART.pdf
  *
  * Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/AdaptiveRadixTree-(ART)-Index
@@ -36,6 +41,8 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   friend class AdaptiveRadixTreeIndexTest_BinaryComparableFromChunkOffset_Test;
 
+  friend class AdaptiveRadixTreeIndexTest_PathCompression_Test;
+
  public:
   /**
    * Predicts the memory consumption in bytes of creating this index.
@@ -45,11 +52,12 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
-  AdaptiveRadixTreeIndex(AdaptiveRadixTreeIndex&&) = default;
+  // Defined in the .cpp, where ARTNode is a complete type
+  AdaptiveRadixTreeIndex(AdaptiveRadixTreeIndex&&);
 
   AdaptiveRadixTreeIndex& operator=(AdaptiveRadixTreeIndex&&) = default;
 
-  virtual ~AdaptiveRadixTreeIndex() = default;
+  virtual ~AdaptiveRadixTreeIndex();
 
   /**
    *All keys in the ART have to be binary comparable in the sense that if the most significant differing bit between
@@ -68,7 +76,7 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
     uint8_t operator[](size_t position) const;
 
    private:
-    std::vector<uint8_t> _parts;
+    std::array<uint8_t, sizeof(ValueID)> _parts;
   };
 
  private:
@@ -80,10 +88,11 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   Iterator _cend() const final;
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values);
+  // Builds the tree from (ValueID, ChunkOffset) pairs, which have to be sorted by ValueID
+  std::unique_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<ValueID, ChunkOffset>>& values);
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values,
-                                        size_t depth, Iterator& it);
+  std::unique_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<ValueID, ChunkOffset>>& values,
+                                        const size_t begin, const size_t end, size_t depth);
 
   std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const;
 
@@ -91,7 +100,7 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
   std::vector<ChunkOffset> _chunk_offsets;
-  std::shared_ptr<ARTNode> _root;
+  std::unique_ptr<ARTNode> _root;
 };
 
 bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
@@ -1,5 +1,9 @@
 #include "adaptive_radix_tree_nodes.hpp"
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
@@ -15,6 +19,22 @@ namespace opossum {
 
 constexpr uint8_t INVALID_INDEX = 255u;
 
+ARTNode::ARTNode(const std::vector<uint8_t>& prefix) {
+  DebugAssert(prefix.size() <= MAX_PREFIX_LENGTH, "Prefix is longer than any key");
+  std::copy(prefix.begin(), prefix.end(), _prefix.begin());
+  _prefix_length = static_cast<uint8_t>(prefix.size());
+}
+
+int ARTNode::_compare_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t& depth) const {
+  for (auto prefix_id = size_t{0}; prefix_id < _prefix_length; ++prefix_id) {
+    const auto partial_key = key[depth + prefix_id];
+    if (partial_key < _prefix[prefix_id]) return -1;
+    if (partial_key > _prefix[prefix_id]) return 1;
+  }
+  depth += _prefix_length;
+  return 0;
+}
+
 /**
  *
  * ARTNode4 has two arrays of length 4:
@@ -24,14 +44,14 @@ constexpr uint8_t INVALID_INDEX = 255u;
  * default value of the _partial_keys array is 255u
  */
 
-ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode4::ARTNode4(ARTNodeChildren& children, const std::vector<uint8_t>& prefix) : ARTNode{prefix} {
   std::sort(children.begin(), children.end(),
-            [](const std::pair<uint8_t, std::shared_ptr<ARTNode>>& left,
-               const std::pair<uint8_t, std::shared_ptr<ARTNode>>& right) { return left.first < right.first; });
+            [](const auto& left, const auto& right) { return left.first < right.first; });
   _partial_keys.fill(INVALID_INDEX);
+  _child_count = static_cast<uint8_t>(children.size());
   for (uint8_t i = 0u; i < children.size(); ++i) {
     _partial_keys[i] = children[i].first;
-    _children[i] = children[i].second;
+    _children[i] = std::move(children[i].second);
   }
 }
 
@@ -61,14 +81,17 @@ ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& ch
 
 BaseIndex::Iterator ARTNode4::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                                                  const std::function<Iterator(size_t, size_t)>& function) const {
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+
   auto partial_key = key[depth];
-  for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
+  for (uint8_t partial_key_id = 0; partial_key_id < _child_count; ++partial_key_id) {
     if (_partial_keys[partial_key_id] < partial_key) continue;                                   // key not found yet
     if (_partial_keys[partial_key_id] == partial_key) return function(partial_key_id, ++depth);  // case0
-    if (_children[partial_key_id] == nullptr) return end();  // no more keys available, case1b
-    return _children[partial_key_id]->begin();               // case2
+    return _children[partial_key_id]->begin();                                                   // case2
   }
-  return end();  // case1a
+  return end();  // case1a, case1b
 }
 
 BaseIndex::Iterator ARTNode4::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
@@ -83,13 +106,14 @@ BaseIndex::Iterator ARTNode4::upper_bound(const AdaptiveRadixTreeIndex::BinaryCo
 
 BaseIndex::Iterator ARTNode4::begin() const { return _children[0]->begin(); }
 
-BaseIndex::Iterator ARTNode4::end() const {
-  for (uint8_t i = 4; i > 0; --i) {
-    if (_children[i - 1] != nullptr) {
-      return _children[i - 1]->end();
-    }
+BaseIndex::Iterator ARTNode4::end() const { return _children[_child_count - 1]->end(); }
+
+size_t ARTNode4::memory_consumption() const {
+  auto memory_consumption = sizeof(*this);
+  for (auto child_id = size_t{0}; child_id < _child_count; ++child_id) {
+    memory_consumption += _children[child_id]->memory_consumption();
   }
-  Fail("Empty _children array in ARTNode4 should never happen");
+  return memory_consumption;
 }
 
 /**
@@ -102,14 +126,14 @@ BaseIndex::Iterator ARTNode4::end() const {
  *
  */
 
-ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode16::ARTNode16(ARTNodeChildren& children, const std::vector<uint8_t>& prefix) : ARTNode{prefix} {
   std::sort(children.begin(), children.end(),
-            [](const std::pair<uint8_t, std::shared_ptr<ARTNode>>& left,
-               const std::pair<uint8_t, std::shared_ptr<ARTNode>>& right) { return left.first < right.first; });
+            [](const auto& left, const auto& right) { return left.first < right.first; });
   _partial_keys.fill(INVALID_INDEX);
+  _child_count = static_cast<uint8_t>(children.size());
   for (uint8_t i = 0u; i < children.size(); ++i) {
     _partial_keys[i] = children[i].first;
-    _children[i] = children[i].second;
+    _children[i] = std::move(children[i].second);
   }
 }
 
@@ -136,59 +160,63 @@ ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>&
  *           call begin() on the next larger child (e.g. 06)
  **/
 
-BaseIndex::Iterator ARTNode16::_delegate_to_child(
-    const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-    const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type, size_t)>&
-        function) const {
+size_t ARTNode16::_count_smaller_partial_keys(const uint8_t partial_key) const {
+#if defined(__x86_64__)
+  // SSE2 only compares signed bytes, flipping their sign bits turns this into an unsigned comparison
+  const auto sign_bits = _mm_set1_epi8(static_cast<char>(0x80));
+  const auto partial_keys =
+      _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(_partial_keys.data())), sign_bits);
+  const auto search_key = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(partial_key)), sign_bits);
+  const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(partial_keys, search_key)));
+
+  // The partial keys are sorted, so the smaller ones are the first ones. Unused slots are ignored.
+  return static_cast<size_t>(__builtin_popcount(mask & ((1u << _child_count) - 1u)));
+#else
+  return std::distance(_partial_keys.begin(),
+                       std::lower_bound(_partial_keys.begin(), _partial_keys.begin() + _child_count, partial_key));
+#endif
+}
+
+BaseIndex::Iterator ARTNode16::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
+                                                  const std::function<Iterator(size_t, size_t)>& function) const {
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+
   auto partial_key = key[depth];
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
+  auto partial_key_pos = _count_smaller_partial_keys(partial_key);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, ++depth);  // case0
-  }
-  if (partial_key_pos >= 16) {
-    return end();  // case 1a
+  if (partial_key_pos == _child_count) {
+    return end();  // case1a, case1b
   }
-  if (_children[partial_key_pos] != nullptr) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (_partial_keys[partial_key_pos] == partial_key) {
+    return function(partial_key_pos, ++depth);  // case0
   }
-  return end();  // case1b
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(
-      key, depth,
-      [&key, this](std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type partial_key_pos,
-                   size_t new_depth) { return _children[partial_key_pos]->lower_bound(key, new_depth); });
+  return _delegate_to_child(key, depth, [&key, this](size_t partial_key_pos, size_t new_depth) {
+    return _children[partial_key_pos]->lower_bound(key, new_depth);
+  });
 }
 
 BaseIndex::Iterator ARTNode16::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(
-      key, depth,
-      [&key, this](std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type partial_key_pos,
-                   size_t new_depth) { return _children[partial_key_pos]->upper_bound(key, new_depth); });
+  return _delegate_to_child(key, depth, [&key, this](size_t partial_key_pos, size_t new_depth) {
+    return _children[partial_key_pos]->upper_bound(key, new_depth);
+  });
 }
 
 BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
 
-/**
- * _end searches the child with the largest partial key == the last child in the _children array.
- * As the _partial_keys array is filled with 255u per default, we expect the largest child at the index right in front
- * of the first entry with 255u. But 255u can also be a valid partial_key: In this case the _children array contains a
- * pointer at this index as a means to differentiate the two cases.
- */
+BaseIndex::Iterator ARTNode16::end() const { return _children[_child_count - 1]->end(); }
 
-BaseIndex::Iterator ARTNode16::end() const {
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), INVALID_INDEX);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-  if (_children[partial_key_pos] == nullptr) {
-    // there does not exist a child with partial_key 255u, we take the partial_key in front of it
-    return _children[partial_key_pos - 1]->end();
-  } else {
-    // there exists a child with partial_key 255u
-    return _children[partial_key_pos]->end();
+size_t ARTNode16::memory_consumption() const {
+  auto memory_consumption = sizeof(*this);
+  for (auto child_id = size_t{0}; child_id < _child_count; ++child_id) {
+    memory_consumption += _children[child_id]->memory_consumption();
   }
+  return memory_consumption;
 }
 
 /**
@@ -201,11 +229,11 @@ BaseIndex::Iterator ARTNode16::end() const {
  * 47 as this is the maximum index for _children.
  */
 
-ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
+ARTNode48::ARTNode48(ARTNodeChildren& children, const std::vector<uint8_t>& prefix) : ARTNode{prefix} {
   _index_to_child.fill(INVALID_INDEX);
   for (uint8_t i = 0u; i < children.size(); ++i) {
     _index_to_child[children[i].first] = i;
-    _children[i] = children[i].second;
+    _children[i] = std::move(children[i].second);
   }
 }
 
@@ -231,7 +259,8 @@ ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNod
  *           call begin() on the next larger child (e.g. 05)
  *
  * In order to find the next larger/ last child, we have to iterate through the _index_to_child array
- * This is expensive as the array is sparsely populated (at max 48 entries).
+ * This is expensive as the array is sparsely populated (at max 48 entries). The search for the next larger child thus
+ * checks 16 entries at a time using SSE.
  * For the moment, all entries in _children are sorted, as we only bulk_insert records, so we could just iterate through
  * _children instead.
  * But this sorting is not necessarily the case when inserting is allowed (_index_to_child[new_partial_key] would get
@@ -240,18 +269,40 @@ ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNod
  *
  **/
 
+uint16_t ARTNode48::_next_partial_key(const uint16_t first_partial_key) const {
+#if defined(__x86_64__)
+  const auto invalid_indexes = _mm_set1_epi8(static_cast<char>(INVALID_INDEX));
+  for (auto block_begin = static_cast<uint16_t>(first_partial_key & ~uint16_t{15}); block_begin < 256u;
+       block_begin += 16) {
+    const auto block = _mm_load_si128(reinterpret_cast<const __m128i*>(_index_to_child.data() + block_begin));
+    auto mask = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, invalid_indexes))) & 0xFFFFu;
+    // Ignore the partial keys in front of first_partial_key
+    if (block_begin < first_partial_key) mask &= 0xFFFFu << (first_partial_key - block_begin);
+    if (mask) return static_cast<uint16_t>(block_begin + __builtin_ctz(mask));
+  }
+#else
+  for (auto partial_key = first_partial_key; partial_key < 256u; ++partial_key) {
+    if (_index_to_child[partial_key] != INVALID_INDEX) return partial_key;
+  }
+#endif
+  return 256u;
+}
+
 BaseIndex::Iterator ARTNode48::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                                                   const std::function<Iterator(uint8_t, size_t)>& function) const {
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+
   auto partial_key = key[depth];
   if (_index_to_child[partial_key] != INVALID_INDEX) {
     // case0
     return function(partial_key, ++depth);
   }
-  for (uint16_t i = partial_key + 1; i < 256u; ++i) {
-    if (_index_to_child[i] != INVALID_INDEX) {
-      // case2
-      return _children[_index_to_child[i]]->begin();
-    }
+  const auto next_partial_key = _next_partial_key(partial_key + 1);
+  if (next_partial_key < 256u) {
+    // case2
+    return _children[_index_to_child[next_partial_key]]->begin();
   }
   // case1
   return end();
@@ -270,32 +321,37 @@ BaseIndex::Iterator ARTNode48::upper_bound(const AdaptiveRadixTreeIndex::BinaryC
 }
 
 BaseIndex::Iterator ARTNode48::begin() const {
-  for (auto index : _index_to_child) {
-    if (index != INVALID_INDEX) {
-      return _children[index]->begin();
-    }
-  }
-  Fail("Empty _index_to_child array in ARTNode48 should never happen");
+  const auto first_partial_key = _next_partial_key(0);
+  Assert(first_partial_key < 256u, "Empty _index_to_child array in ARTNode48 should never happen");
+  return _children[_index_to_child[first_partial_key]]->begin();
 }
 
 BaseIndex::Iterator ARTNode48::end() const {
-  for (uint8_t i = static_cast<uint8_t>(_index_to_child.size()) - 1; i > 0; --i) {
-    if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
+  for (auto partial_key = static_cast<int16_t>(_index_to_child.size()) - 1; partial_key >= 0; --partial_key) {
+    if (_index_to_child[partial_key] != INVALID_INDEX) {
+      return _children[_index_to_child[partial_key]]->end();
     }
   }
   Fail("Empty _index_to_child array in ARTNode48 should never happen");
 }
 
+size_t ARTNode48::memory_consumption() const {
+  auto memory_consumption = sizeof(*this);
+  for (const auto& child : _children) {
+    if (child) memory_consumption += child->memory_consumption();
+  }
+  return memory_consumption;
+}
+
 /**
  *
  * ARTNode256 has only one array: _children; which stores pointers to the children and can be directly addressed.
  *
  */
 
-ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
-  for (const auto& child : children) {
-    _children[child.first] = child.second;
+ARTNode256::ARTNode256(ARTNodeChildren& children, const std::vector<uint8_t>& prefix) : ARTNode{prefix} {
+  for (auto& child : children) {
+    _children[child.first] = std::move(child.second);
   }
 }
 
@@ -324,6 +380,10 @@ ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTN
 
 BaseIndex::Iterator ARTNode256::_delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                                                    const std::function<Iterator(uint8_t, size_t)>& function) const {
+  const auto prefix_comparison = _compare_prefix(key, depth);
+  if (prefix_comparison < 0) return begin();
+  if (prefix_comparison > 0) return end();
+
   auto partial_key = key[depth];
   if (_children[partial_key] != nullptr) {
     // case0
@@ -363,20 +423,44 @@ BaseIndex::Iterator ARTNode256::begin() const {
 BaseIndex::Iterator ARTNode256::end() const {
   for (int16_t i = static_cast<int16_t>(_children.size()) - 1; i >= 0; --i) {
     if (_children[i] != nullptr) {
-      return _children[i]->begin();
+      return _children[i]->end();
     }
   }
   Fail("Empty _children array in ARTNode256 should never happen");
 }
 
-Leaf::Leaf(BaseIndex::Iterator& lower, BaseIndex::Iterator& upper) : _begin(lower), _end(upper) {}
+size_t ARTNode256::memory_consumption() const {
+  auto memory_consumption = sizeof(*this);
+  for (const auto& child : _children) {
+    if (child) memory_consumption += child->memory_consumption();
+  }
+  return memory_consumption;
+}
+
+Leaf::Leaf(const ValueID key, const Iterator begin, const Iterator end)
+    : _key(key), _size(static_cast<ChunkOffset>(std::distance(begin, end))), _begin(begin) {}
 
-BaseIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const { return _begin; }
+int Leaf::_compare_key(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
+  const auto leaf_key = AdaptiveRadixTreeIndex::BinaryComparable(_key);
+  for (; depth < key.size(); ++depth) {
+    if (key[depth] < leaf_key[depth]) return -1;
+    if (key[depth] > leaf_key[depth]) return 1;
+  }
+  return 0;
+}
+
+BaseIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
+  return _compare_key(key, depth) <= 0 ? begin() : end();
+}
 
-BaseIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const { return _end; }
+BaseIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
+  return _compare_key(key, depth) < 0 ? begin() : end();
+}
 
 BaseIndex::Iterator Leaf::begin() const { return _begin; }
 
-BaseIndex::Iterator Leaf::end() const { return _end; }
+BaseIndex::Iterator Leaf::end() const { return _begin + _size; }
+
+size_t Leaf::memory_consumption() const { return sizeof(*this); }
 
 }  // namespace opossum
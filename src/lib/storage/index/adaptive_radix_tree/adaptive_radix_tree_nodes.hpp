@@ -22,11 +22,15 @@ using Iterator = std::vector<ChunkOffset>::const_iterator;
  * Each node has an array which contains pointers to its children and (if needed) an index array in order to map
  * partial keys to positions in the array of the child-pointers
  *
+ * Inner nodes use path compression: If all keys below a node share the same bytes, these bytes are stored as the
+ * node's prefix instead of in a chain of nodes with a single child each.
  */
 
 class ARTNode : private Noncopyable {
  public:
-  ARTNode() = default;
+  static constexpr auto MAX_PREFIX_LENGTH = sizeof(ValueID) - 1;
+
+  explicit ARTNode(const std::vector<uint8_t>& prefix = {});
 
   virtual ~ARTNode() = default;
 
@@ -34,8 +38,24 @@ class ARTNode : private Noncopyable {
   virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
   virtual Iterator begin() const = 0;
   virtual Iterator end() const = 0;
+
+  // Returns the memory consumed by this node and its children, without the chunk offsets of the leaves
+  virtual size_t memory_consumption() const = 0;
+
+ protected:
+  /**
+   * Compares the prefix of this node with the bytes of the key starting at depth. Returns a negative value if the key
+   * is smaller than all keys below this node, a positive one if it is larger, and 0 if the prefix matches. In that
+   * case, depth is advanced past the prefix.
+   */
+  int _compare_prefix(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t& depth) const;
+
+  std::array<uint8_t, MAX_PREFIX_LENGTH> _prefix{};
+  uint8_t _prefix_length{0};
 };
 
+using ARTNodeChildren = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>;
+
 /**
  *
  * ARTNode4 has two arrays of length 4:
@@ -48,14 +68,16 @@ class ARTNode : private Noncopyable {
  */
 class ARTNode4 final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
+  friend class AdaptiveRadixTreeIndexTest_PathCompression_Test;
 
  public:
-  explicit ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode4(ARTNodeChildren& children, const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  size_t memory_consumption() const override;
 
  private:
   /**
@@ -66,7 +88,8 @@ class ARTNode4 final : public ARTNode {
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                               const std::function<Iterator(size_t, size_t)>& function) const;
   std::array<uint8_t, 4> _partial_keys{};
-  std::array<std::shared_ptr<ARTNode>, 4> _children{};
+  uint8_t _child_count{0};
+  std::array<std::unique_ptr<ARTNode>, 4> _children{};
 };
 
 /**
@@ -77,26 +100,31 @@ class ARTNode4 final : public ARTNode {
  *
  * _partial_key[i] is the partial_key for child _children[i]
  *
- * The default value of the _partial_keys array is 255u
+ * The default value of the _partial_keys array is 255u. The partial keys are compared to the searched one with a
+ * single SSE instruction.
  *
  */
 
 class ARTNode16 final : public ARTNode {
  public:
-  explicit ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode16(ARTNodeChildren& children, const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  size_t memory_consumption() const override;
 
  private:
-  Iterator _delegate_to_child(
-      const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-      const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type, size_t)>&
-          function) const;
-  std::array<uint8_t, 16> _partial_keys{};
-  std::array<std::shared_ptr<ARTNode>, 16> _children{};
+  Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
+                              const std::function<Iterator(size_t, size_t)>& function) const;
+
+  // Returns the number of partial keys that are smaller than the given one
+  size_t _count_smaller_partial_keys(const uint8_t partial_key) const;
+
+  alignas(16) std::array<uint8_t, 16> _partial_keys{};
+  uint8_t _child_count{0};
+  std::array<std::unique_ptr<ARTNode>, 16> _children{};
 };
 
 /**
@@ -114,19 +142,23 @@ class ARTNode16 final : public ARTNode {
  */
 class ARTNode48 final : public ARTNode {
  public:
-  explicit ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode48(ARTNodeChildren& children, const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  size_t memory_consumption() const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                               const std::function<Iterator(uint8_t, size_t)>& function) const;
 
-  std::array<uint8_t, 256> _index_to_child{};
-  std::array<std::shared_ptr<ARTNode>, 48> _children{};
+  // Returns the smallest partial key >= first_partial_key that has a child, or 256 if there is none
+  uint16_t _next_partial_key(const uint16_t first_partial_key) const;
+
+  alignas(16) std::array<uint8_t, 256> _index_to_child{};
+  std::array<std::unique_ptr<ARTNode>, 48> _children{};
 };
 
 /**
@@ -136,60 +168,68 @@ class ARTNode48 final : public ARTNode {
  */
 class ARTNode256 final : public ARTNode {
  public:
-  explicit ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  explicit ARTNode256(ARTNodeChildren& children, const std::vector<uint8_t>& prefix = {});
 
   Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  size_t memory_consumption() const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
                               const std::function<Iterator(uint8_t, size_t)>& function) const;
 
-  std::array<std::shared_ptr<ARTNode>, 256> _children{};
+  std::array<std::unique_ptr<ARTNode>, 256> _children{};
 };
 
 /**
  *
- * leaves contain two std::vector<ChunkOffset>::const_iterator: _lower_bound and _upper_bound.
+ * A leaf stores the key it represents, an iterator to the first ChunkOffset in _chunk_offsets with that key and the
+ * number of ChunkOffsets with that key.
  *
  * Consider the following example tree showing only its leaves:
  *
  *           Leaf(0x00000000) Leaf(0x00000001) ... Leaf(0xa101fe07) Leaf(0xa101feaf) ... Leaf(0xfebb34f1)
- *         _lower_ |  | _upper_     |       | _upper_    | |             |       |           |          |
- *           bound |  | bound   |---|       | bound      | |         |---|       |           |          |
- *                 |  |--------|| _lower_   |--|      |--| |--------||           |      |----|          |
- *                 |           || bound        |      |             ||           |      |               |
+ *           begin |  | end         |       | end        | |             |       |           |          |
+ *                 |  |        |---|       |            | |         |---|       |           |          |
+ *                 |  |--------||  begin   |--|      |--| |--------||           |      |----|          |
+ *                 |           ||              |      |             ||           |      |               |
  * _chunk_offsets: |17|a2|a4|b4|fe|02|03|04|a1|a3|...|12|c1|f3|1a|4f|6d|...|92|9a|27|...|00|13|aa|ab|f1|
  *
  *
- * _lower_bound points to the first ChunkOffset in _chunk_offsets that belongs to the value in the attribute vector
+ * begin() points to the first ChunkOffset in _chunk_offsets that belongs to the value in the attribute vector
  * that
  * the leaf represents.
  *     eg: on ChunkOffset 17 the value is 0x00000000, on ChunkOffset f3 the value is 0xa101fe07
  *
- * _upper_bound points to the first ChunkOffset in _chunk_offsets that does not contain the value that the leaf
+ * end() points to the first ChunkOffset in _chunk_offsets that does not contain the value that the leaf
  * represents.
  *     eg: at ChunkOffset fe, the value is 0x00000001, not 0x00000000
- *     for the last leaf, _upper_bound = _chunk_offsets.end()
+ *     for the last leaf, end() = _chunk_offsets.end()
  *
- * lower_bound() nets the same as begin(), upper_bound the same as end()
+ * As a leaf can be reached before all bytes of a key have been compared (e.g., if it is the only child of its parent),
+ * lower_bound() and upper_bound() compare the remaining bytes with the stored key.
  */
 class Leaf final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
 
  public:
-  explicit Leaf(Iterator& lower, Iterator& upper);
+  Leaf(const ValueID key, const Iterator begin, const Iterator end);
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
+  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
+  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  size_t memory_consumption() const override;
 
  private:
-  Iterator _begin;
-  Iterator _end;
+  // Compares the bytes of the given key starting at depth with the ones of the stored key
+  int _compare_key(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const;
+
+  const ValueID _key;
+  const ChunkOffset _size;
+  const Iterator _begin;
 };
 
 }  // namespace opossum
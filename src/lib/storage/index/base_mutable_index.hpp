@@ -0,0 +1,58 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "segment_index_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * BaseMutableIndex is the abstract super class of indexes on mutable chunks. The chunk-level indexes (see BaseIndex)
+ * are built once from immutable segments. The mutable chunk that receives new rows would thus never be indexed.
+ * Mutable indexes instead grow with the chunk: the Insert operator (and Table::append) adds each new row to them.
+ *
+ * When the chunk is compressed by the ChunkCompressionTask, the mutable index is replaced by a compact index of
+ * finalized_index_type() on the encoded segment.
+ *
+ * As with the other indexes, lookups return rows independent of their MVCC visibility. Lookups and insertions may
+ * run concurrently. As insertions can invalidate any iterator, lookups return copies of the matching chunk offsets
+ * instead of ranges of iterators.
+ */
+class BaseMutableIndex : private Noncopyable {
+ public:
+  BaseMutableIndex(const ColumnID column_id, const SegmentIndexType finalized_index_type)
+      : _column_id{column_id}, _finalized_index_type{finalized_index_type} {}
+  virtual ~BaseMutableIndex() = default;
+
+  ColumnID column_id() const { return _column_id; }
+
+  // Type of the index that replaces this one once the chunk is immutable
+  SegmentIndexType finalized_index_type() const { return _finalized_index_type; }
+
+  // Adds the non-NULL values at [begin_offset, end_offset) of the given ValueSegment
+  virtual void insert(const BaseSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset) = 0;
+
+  /**
+   * Appends the offsets of all rows whose value satisfies `value <predicate_condition> search_value` to chunk_offsets,
+   * ordered by value. For PredicateCondition::Between, search_value2 is the (inclusive) upper bound.
+   */
+  virtual void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                              const std::optional<AllTypeVariant>& search_value2,
+                              std::vector<ChunkOffset>& chunk_offsets) const = 0;
+
+  // Returns the number of indexed rows
+  virtual size_t size() const = 0;
+
+  virtual size_t memory_consumption() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+  const SegmentIndexType _finalized_index_type;
+};
+
+}  // namespace opossum
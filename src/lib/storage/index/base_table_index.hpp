@@ -0,0 +1,46 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * BaseTableIndex is the abstract super class of table-level indexes. In contrast to the chunk-level indexes (see
+ * BaseIndex), a table-level index covers a single column across all chunks of a table and maps each value directly to
+ * the RowIDs that hold it. Point lookups thus do not have to visit every chunk.
+ *
+ * The index only ever grows: rows are added when they are appended to the table (by Table::append, Table::append_chunk
+ * or the Insert operator) and are never removed. Deleted rows and rows of rolled back inserts remain in the index, and
+ * lookups return them together with uncommitted rows - just like a scan of the table would, they have to be filtered
+ * by the Validate operator. As Update is implemented as a Delete followed by an Insert, it is covered as well.
+ *
+ * Adding rows is safe while other threads add rows or perform lookups.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  explicit BaseTableIndex(const ColumnID column_id) : _column_id{column_id} {}
+  virtual ~BaseTableIndex() = default;
+
+  ColumnID column_id() const { return _column_id; }
+
+  // Adds the non-NULL values at [begin_offset, end_offset) of the given segment, which belongs to the chunk chunk_id
+  virtual void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+
+  // Appends the RowIDs of all rows whose value equals the given one to row_ids. The order of the RowIDs is unspecified.
+  virtual void append_equal_rows(const AllTypeVariant& value, PosList& row_ids) const = 0;
+
+  // Returns the number of indexed rows
+  virtual size_t size() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+}  // namespace opossum
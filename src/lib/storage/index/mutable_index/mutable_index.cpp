@@ -0,0 +1,102 @@
+#include "mutable_index.hpp"
+
+#include <mutex>
+
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+MutableIndex<T>::MutableIndex(const ColumnID column_id, const SegmentIndexType finalized_index_type)
+    : BaseMutableIndex{column_id, finalized_index_type} {}
+
+template <typename T>
+void MutableIndex<T>::insert(const BaseSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+  Assert(value_segment, "MutableIndex can only index ValueSegments");
+
+  const auto& values = value_segment->values();
+  const auto is_nullable = value_segment->is_nullable();
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    if (is_nullable && value_segment->null_values()[chunk_offset]) continue;
+
+    // Equal values are inserted after the existing ones, so that their offsets stay (mostly) in ascending order
+    _chunk_offsets.emplace(values[chunk_offset], chunk_offset);
+  }
+}
+
+template <typename T>
+void MutableIndex<T>::append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                                     const std::optional<AllTypeVariant>& search_value2,
+                                     std::vector<ChunkOffset>& chunk_offsets) const {
+  if (variant_is_null(search_value)) return;
+
+  const auto typed_search_value = type_cast_variant<T>(search_value);
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  const auto append_range = [&](const auto range_begin, const auto range_end) {
+    for (auto it = range_begin; it != range_end; ++it) {
+      chunk_offsets.emplace_back(it->second);
+    }
+  };
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals: {
+      const auto [range_begin, range_end] = _chunk_offsets.equal_range(typed_search_value);
+      append_range(range_begin, range_end);
+      break;
+    }
+    case PredicateCondition::NotEquals: {
+      const auto [range_begin, range_end] = _chunk_offsets.equal_range(typed_search_value);
+      append_range(_chunk_offsets.cbegin(), range_begin);
+      append_range(range_end, _chunk_offsets.cend());
+      break;
+    }
+    case PredicateCondition::LessThan:
+      append_range(_chunk_offsets.cbegin(), _chunk_offsets.lower_bound(typed_search_value));
+      break;
+    case PredicateCondition::LessThanEquals:
+      append_range(_chunk_offsets.cbegin(), _chunk_offsets.upper_bound(typed_search_value));
+      break;
+    case PredicateCondition::GreaterThan:
+      append_range(_chunk_offsets.upper_bound(typed_search_value), _chunk_offsets.cend());
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      append_range(_chunk_offsets.lower_bound(typed_search_value), _chunk_offsets.cend());
+      break;
+    case PredicateCondition::Between: {
+      Assert(search_value2, "Between requires an upper bound");
+      if (variant_is_null(*search_value2)) return;
+
+      const auto typed_search_value2 = type_cast_variant<T>(*search_value2);
+      if (typed_search_value2 < typed_search_value) return;
+      append_range(_chunk_offsets.lower_bound(typed_search_value), _chunk_offsets.upper_bound(typed_search_value2));
+      break;
+    }
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
+template <typename T>
+size_t MutableIndex<T>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _chunk_offsets.size();
+}
+
+template <typename T>
+size_t MutableIndex<T>::memory_consumption() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  // Each entry is a tree node with three pointers and a color
+  return sizeof(*this) + _chunk_offsets.size() * (sizeof(T) + sizeof(ChunkOffset) + 4 * sizeof(void*));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(MutableIndex);
+
+}  // namespace opossum
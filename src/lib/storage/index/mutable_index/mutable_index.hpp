@@ -0,0 +1,37 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "storage/index/base_mutable_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Mutable index that keeps the chunk offsets of a column's values in an ordered multimap. Insertions take an exclusive
+ * lock, lookups a shared one. Both are logarithmic in the size of the chunk, so that single-row inserts stay cheap.
+ */
+template <typename T>
+class MutableIndex : public BaseMutableIndex {
+ public:
+  MutableIndex(const ColumnID column_id, const SegmentIndexType finalized_index_type);
+
+  void insert(const BaseSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset) final;
+
+  void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                      const std::optional<AllTypeVariant>& search_value2,
+                      std::vector<ChunkOffset>& chunk_offsets) const final;
+
+  size_t size() const final;
+
+  size_t memory_consumption() const final;
+
+ private:
+  std::multimap<T, ChunkOffset> _chunk_offsets;
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
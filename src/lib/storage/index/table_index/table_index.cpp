@@ -0,0 +1,92 @@
+#include "table_index.hpp"
+
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Casts the search value to the type of the indexed column. Returns std::nullopt if no value of that type can be equal
+// to the search value, e.g., when searching for 1.5 in an int column.
+template <typename T>
+std::optional<T> cast_search_value(const AllTypeVariant& value) {
+  if (variant_is_null(value)) return std::nullopt;
+
+  auto typed_value = std::optional<T>{};
+  resolve_data_type(data_type_from_all_type_variant(value), [&](auto type) {
+    using SearchValueType = typename decltype(type)::type;
+    const auto& search_value = get<SearchValueType>(value);
+
+    if constexpr (std::is_same_v<T, SearchValueType>) {
+      typed_value = search_value;
+    } else if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<SearchValueType>) {
+      if (search_value < std::numeric_limits<T>::lowest() || search_value > std::numeric_limits<T>::max()) return;
+      const auto converted_value = static_cast<T>(search_value);
+      if (static_cast<SearchValueType>(converted_value) == search_value) typed_value = converted_value;
+    } else {
+      typed_value = type_cast_variant<T>(value);
+    }
+  });
+  return typed_value;
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+TableIndex<T>::TableIndex(const ColumnID column_id) : BaseTableIndex{column_id} {}
+
+template <typename T>
+void TableIndex<T>::insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+                           const ChunkOffset end_offset) {
+  // Rows are added to mutable chunks one by one (or in small batches), so ValueSegments are accessed directly
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& values = value_segment->values();
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      if (value_segment->is_nullable() && value_segment->null_values()[chunk_offset]) continue;
+      _row_ids.emplace(values[chunk_offset], RowID{chunk_id, chunk_offset});
+    }
+    return;
+  }
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    const auto chunk_offset = position.chunk_offset();
+    if (position.is_null() || chunk_offset < begin_offset || chunk_offset >= end_offset) return;
+    _row_ids.emplace(position.value(), RowID{chunk_id, chunk_offset});
+  });
+}
+
+template <typename T>
+void TableIndex<T>::append_equal_rows(const AllTypeVariant& value, PosList& row_ids) const {
+  const auto typed_value = cast_search_value<T>(value);
+  if (!typed_value) return;
+
+  const auto [range_begin, range_end] = _row_ids.equal_range(*typed_value);
+  for (auto it = range_begin; it != range_end; ++it) {
+    row_ids.emplace_back(it->second);
+  }
+}
+
+template <typename T>
+size_t TableIndex<T>::size() const {
+  return _row_ids.size();
+}
+
+template <typename T>
+size_t TableIndex<T>::estimate_memory_usage() const {
+  // Each entry is a node in a linked list, the buckets hold pointers into that list
+  return sizeof(*this) + _row_ids.size() * (sizeof(T) + sizeof(RowID) + 2 * sizeof(void*)) +
+         _row_ids.unsafe_bucket_count() * sizeof(void*);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndex);
+
+}  // namespace opossum
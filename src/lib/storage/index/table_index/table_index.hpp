@@ -0,0 +1,35 @@
+#pragma once
+
+#include <tbb/concurrent_unordered_map.h>
+
+#include <functional>
+
+#include "storage/index/base_table_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Table-level index that keeps the RowIDs of a column's values in a concurrent hash multimap. It supports equality
+ * lookups only, but answers them without visiting the chunks of the table. Insertions and lookups may run
+ * concurrently (see BaseTableIndex for how the index interacts with MVCC).
+ */
+template <typename T>
+class TableIndex : public BaseTableIndex {
+ public:
+  explicit TableIndex(const ColumnID column_id);
+
+  void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) final;
+
+  void append_equal_rows(const AllTypeVariant& value, PosList& row_ids) const final;
+
+  size_t size() const final;
+
+  size_t estimate_memory_usage() const final;
+
+ private:
+  tbb::concurrent_unordered_multimap<T, RowID, std::hash<T>> _row_ids;
+};
+
+}  // namespace opossum
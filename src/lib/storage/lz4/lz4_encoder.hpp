@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 
+#include "memory/huge_page_memory_resource.hpp"
 #include "storage/base_segment_encoder.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/value_segment.hpp"
@@ -24,9 +25,16 @@ class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
   static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::LZ4>;
   static constexpr auto _uses_vector_compression = false;
 
+  // Decompressed size of each block. It is a multiple of the size of all numerical data types.
+  static constexpr auto _block_size = size_t{16'384};
+
+  // Size of the dictionary used for string segments that consist of more than one block
+  static constexpr auto _dictionary_size = size_t{4'096};
+  static constexpr auto _dictionary_sample_count = size_t{64};
+
   template <typename T>
   std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
-    const auto alloc = value_segment->values().get_allocator();
+    const auto alloc = with_huge_pages(value_segment->values().get_allocator());
     const auto num_elements = value_segment->size();
 
     // TODO(anyone): when value segments switch to using pmr_vectors, the data can be copied directly instead of
@@ -48,35 +56,20 @@ class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
       }
     });
 
-    /**
-     * Use the LZ4 high compression API to compress the copied values. As C-library LZ4 needs raw pointers as input
-     * and output. To avoid directly handling raw pointers we use std::vectors as input and output. The input vector
-     * contains the data that needs to be compressed and the output vector is allocated enough memory to contain
-     * the compression result. Via the .data() call we can supply LZ4 with raw pointers to the memory the vectors use.
-     * These are cast to char-pointers since LZ4 expects char pointers.
-     */
     DebugAssert(values.size() * sizeof(T) <= std::numeric_limits<int>::max(),
                 "Input of LZ4 encoder contains too many bytes to fit into a 32-bit signed integer sized vector that is"
                 " used by the LZ4 library.");
 
     const auto input_size = values.size() * sizeof(T);
-    // estimate the (maximum) output size
-    const auto output_size = LZ4_compressBound(static_cast<int>(input_size));
-    auto compressed_data = pmr_vector<char>{alloc};
-    compressed_data.resize(static_cast<size_t>(output_size));
-    const int compression_result = LZ4_compress_HC(reinterpret_cast<char*>(values.data()), compressed_data.data(),
-                                                   static_cast<int>(input_size), output_size, LZ4HC_CLEVEL_MAX);
-    Assert(compression_result > 0, "LZ4 compression failed");
-
-    // shrink the vector to the actual size of the compressed result
-    compressed_data.resize(static_cast<size_t>(compression_result));
-    compressed_data.shrink_to_fit();
-
-    return std::allocate_shared<LZ4Segment<T>>(alloc, std::move(compressed_data), std::move(null_values), input_size);
+    auto lz4_blocks = _compress_blocks(reinterpret_cast<const char*>(values.data()), input_size, {}, alloc);
+    const auto last_block_size = input_size - (lz4_blocks.empty() ? 0u : (lz4_blocks.size() - 1) * _block_size);
+
+    return std::allocate_shared<LZ4Segment<T>>(alloc, std::move(lz4_blocks), std::move(null_values), _block_size,
+                                               last_block_size);
   }
 
   std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<pmr_string>>& value_segment) {
-    const auto alloc = value_segment->values().get_allocator();
+    const auto alloc = with_huge_pages(value_segment->values().get_allocator());
     const auto num_elements = value_segment->size();
 
     /**
@@ -135,35 +128,120 @@ class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
      * cause an error). Therefore we can return the encoded segment already.
      */
     if (!num_chars) {
-      return std::allocate_shared<LZ4Segment<pmr_string>>(alloc, pmr_vector<char>{alloc}, std::move(null_values),
-                                                          std::move(offsets), 0u);
+      return std::allocate_shared<LZ4Segment<pmr_string>>(
+          alloc, pmr_vector<pmr_vector<char>>{alloc}, std::move(null_values), pmr_vector<char>{alloc},
+          std::move(offsets), _block_size, 0u, pmr_vector<ChunkOffset>{alloc}, pmr_vector<pmr_string>{alloc},
+          pmr_vector<pmr_string>{alloc});
     }
 
-    /**
-     * Use the LZ4 high compression API to compress the copied values. As C-library LZ4 needs raw pointers as input
-     * and output. To avoid directly handling raw pointers we use std::vectors as input and output. The input vector
-     * contains the data that needs to be compressed and the output vector is allocated enough memory to contain
-     * the compression result. Via the .data() call we can supply LZ4 with raw pointers to the memory the vectors use.
-     * These are cast to char-pointers since LZ4 expects char pointers.
-     */
     DebugAssert(values.size() <= std::numeric_limits<int>::max(),
                 "String input of LZ4 encoder contains too many characters to fit into a 32-bit signed integer sized "
                 "vector that is used by the LZ4 library.");
     const auto input_size = values.size();
-    // estimate the (maximum) output size
-    const auto output_size = LZ4_compressBound(static_cast<int>(input_size));
-    auto compressed_data = pmr_vector<char>{alloc};
-    compressed_data.resize(static_cast<size_t>(output_size));
-    const int compression_result = LZ4_compress_HC(values.data(), compressed_data.data(), static_cast<int>(input_size),
-                                                   output_size, LZ4HC_CLEVEL_MAX);
-    Assert(compression_result > 0, "LZ4 compression failed");
-
-    // shrink the vector to the actual size of the compressed result
-    compressed_data.resize(static_cast<size_t>(compression_result));
-    compressed_data.shrink_to_fit();
-
-    return std::allocate_shared<LZ4Segment<pmr_string>>(alloc, std::move(compressed_data), std::move(null_values),
-                                                        std::move(offsets), input_size);
+
+    // Strings that fit into a single block are compressed with the full context anyway
+    auto dictionary = input_size > _block_size ? _build_dictionary(values) : pmr_vector<char>{alloc};
+    auto lz4_blocks = _compress_blocks(values.data(), input_size, dictionary, alloc);
+    const auto last_block_size = input_size - (lz4_blocks.size() - 1) * _block_size;
+
+    /**
+     * Summarize the strings that begin in each block, so that scans can skip blocks without decompressing them (see
+     * LZ4Segment::block_first_rows). Strings that begin at the very end of the data (i.e., empty strings) are assigned
+     * to the last block.
+     */
+    const auto block_count = lz4_blocks.size();
+    auto block_first_rows = pmr_vector<ChunkOffset>(block_count, alloc);
+    auto block_min_values = pmr_vector<pmr_string>(block_count, alloc);
+    auto block_max_values = pmr_vector<pmr_string>(block_count, alloc);
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto first_row = std::lower_bound(offsets.cbegin(), offsets.cend(), block_index * _block_size);
+      block_first_rows[block_index] = static_cast<ChunkOffset>(std::distance(offsets.cbegin(), first_row));
+    }
+
+    const auto& segment_values = value_segment->values();
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto rows_end = block_index + 1 < block_count ? block_first_rows[block_index + 1] : num_elements;
+      auto has_value = false;
+      for (auto row_index = size_t{block_first_rows[block_index]}; row_index < rows_end; ++row_index) {
+        if (null_values[row_index]) continue;
+
+        const auto& value = segment_values[row_index];
+        if (!has_value || value < block_min_values[block_index]) block_min_values[block_index] = value;
+        if (!has_value || value > block_max_values[block_index]) block_max_values[block_index] = value;
+        has_value = true;
+      }
+    }
+
+    return std::allocate_shared<LZ4Segment<pmr_string>>(
+        alloc, std::move(lz4_blocks), std::move(null_values), std::move(dictionary), std::move(offsets), _block_size,
+        last_block_size, std::move(block_first_rows), std::move(block_min_values), std::move(block_max_values));
+  }
+
+ private:
+  /**
+   * Builds a dictionary from byte ranges sampled evenly across the string data. Unlike zstd, LZ4 cannot train a
+   * dictionary, but it can reference any content of one. Substrings that are frequent in the segment are thus likely
+   * to be found in the dictionary, even at the beginning of a block.
+   */
+  static pmr_vector<char> _build_dictionary(const pmr_vector<char>& values) {
+    auto dictionary = pmr_vector<char>{values.get_allocator()};
+    dictionary.reserve(_dictionary_size);
+
+    const auto sample_size = _dictionary_size / _dictionary_sample_count;
+    for (auto sample_index = size_t{0}; sample_index < _dictionary_sample_count; ++sample_index) {
+      const auto sample_begin = sample_index * (values.size() - sample_size) / (_dictionary_sample_count - 1);
+      const auto sample_begin_it = values.cbegin() + static_cast<std::ptrdiff_t>(sample_begin);
+      dictionary.insert(dictionary.cend(), sample_begin_it, sample_begin_it + static_cast<std::ptrdiff_t>(sample_size));
+    }
+
+    return dictionary;
+  }
+
+  /**
+   * Uses the LZ4 high compression API to compress the data in independent blocks of _block_size bytes. As C-library
+   * LZ4 needs raw pointers as input and output, the data is passed as a char pointer and each block is compressed
+   * into a vector that is allocated enough memory to contain the compression result and shrunk afterwards.
+   */
+  template <typename T>
+  static pmr_vector<pmr_vector<char>> _compress_blocks(const char* data, const size_t size,
+                                                       const pmr_vector<char>& dictionary,
+                                                       const PolymorphicAllocator<T>& alloc) {
+    auto lz4_blocks = pmr_vector<pmr_vector<char>>{alloc};
+    lz4_blocks.reserve((size + _block_size - 1) / _block_size);
+
+    auto stream = std::unique_ptr<LZ4_streamHC_t, decltype(&LZ4_freeStreamHC)>{nullptr, &LZ4_freeStreamHC};
+    if (!dictionary.empty()) {
+      stream.reset(LZ4_createStreamHC());
+      Assert(stream, "Could not create LZ4 stream");
+      LZ4_resetStreamHC(stream.get(), LZ4HC_CLEVEL_MAX);
+    }
+
+    for (auto block_begin = size_t{0}; block_begin < size; block_begin += _block_size) {
+      const auto input_size = static_cast<int>(std::min(_block_size, size - block_begin));
+      // estimate the (maximum) output size
+      const auto output_size = LZ4_compressBound(input_size);
+      auto compressed_block = pmr_vector<char>(static_cast<size_t>(output_size), alloc);
+
+      auto compression_result = 0;
+      if (stream) {
+        // Loading the dictionary resets the stream (but not its compression level), so that the block does not
+        // reference the previous one
+        LZ4_loadDictHC(stream.get(), dictionary.data(), static_cast<int>(dictionary.size()));
+        compression_result = LZ4_compress_HC_continue(stream.get(), data + block_begin, compressed_block.data(),
+                                                      input_size, output_size);
+      } else {
+        compression_result =
+            LZ4_compress_HC(data + block_begin, compressed_block.data(), input_size, output_size, LZ4HC_CLEVEL_MAX);
+      }
+      Assert(compression_result > 0, "LZ4 compression failed");
+
+      // shrink the vector to the actual size of the compressed result
+      compressed_block.resize(static_cast<size_t>(compression_result));
+      compressed_block.shrink_to_fit();
+      lz4_blocks.emplace_back(std::move(compressed_block));
+    }
+
+    return lz4_blocks;
   }
 };
 
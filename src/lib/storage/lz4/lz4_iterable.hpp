@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <type_traits>
+#include <vector>
 
 #include "storage/segment_iterables.hpp"
 
@@ -29,18 +32,15 @@ class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
   }
 
   /**
-   * For now this point access iterator decompresses the whole segment.
+   * The point access iterator decompresses only the blocks that contain the values of the position filter. The last
+   * decompressed block is cached, so that each block is decompressed only once if the positions are sorted.
    */
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
-    using ValueIterator = typename std::vector<T>::const_iterator;
-
-    const auto decompressed_segment = std::make_shared<std::vector<T>>(_segment.decompress());
+    const auto cached_block = std::make_shared<CachedBlock>();
 
-    auto begin = PointAccessIterator<ValueIterator>{decompressed_segment, &_segment.null_values(),
-                                                    position_filter->cbegin(), position_filter->cbegin()};
-    auto end = PointAccessIterator<ValueIterator>{decompressed_segment, &_segment.null_values(),
-                                                  position_filter->cbegin(), position_filter->cend()};
+    auto begin = PointAccessIterator{&_segment, cached_block, position_filter->cbegin(), position_filter->cbegin()};
+    auto end = PointAccessIterator{&_segment, cached_block, position_filter->cbegin(), position_filter->cend()};
 
     functor(begin, end);
   }
@@ -105,37 +105,42 @@ class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
     NullValueIterator _null_value_it;
   };
 
-  template <typename ValueIterator>
-  class PointAccessIterator
-      : public BasePointAccessSegmentIterator<PointAccessIterator<ValueIterator>, SegmentPosition<T>> {
+  struct CachedBlock {
+    std::optional<size_t> index;
+    std::vector<char> data;
+  };
+
+  class PointAccessIterator : public BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>> {
    public:
     using ValueType = T;
     using IterableType = LZ4Iterable<T>;
 
     // Begin Iterator
-    PointAccessIterator(const std::shared_ptr<std::vector<T>>& data, const pmr_vector<bool>* null_values,
+    PointAccessIterator(const LZ4Segment<T>* segment, const std::shared_ptr<CachedBlock>& cached_block,
                         const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
-        : BasePointAccessSegmentIterator<PointAccessIterator<ValueIterator>,
-                                         SegmentPosition<T>>{std::move(position_filter_begin),
-                                                             std::move(position_filter_it)},
-          _data{data},
-          _null_values{null_values} {}
+        : BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>>{std::move(position_filter_begin),
+                                                                                  std::move(position_filter_it)},
+          _segment{segment},
+          _cached_block{cached_block} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
     SegmentPosition<T> dereference() const {
       const auto& chunk_offsets = this->chunk_offsets();
-      const auto value = (*_data)[chunk_offsets.offset_in_referenced_chunk];
-      const auto is_null = (*_null_values)[chunk_offsets.offset_in_referenced_chunk];
-      return SegmentPosition<T>{value, is_null, chunk_offsets.offset_in_poslist};
+      const auto is_null = _segment->null_values()[chunk_offsets.offset_in_referenced_chunk];
+      if (is_null) return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+
+      const auto value =
+          _segment->decompress(chunk_offsets.offset_in_referenced_chunk, _cached_block->index, _cached_block->data);
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
     }
 
    private:
-    // LZ4 PointAccessIterators share the materialized segment
-    std::shared_ptr<std::vector<T>> _data;
+    const LZ4Segment<T>* _segment;
 
-    const pmr_vector<bool>* _null_values;
+    // LZ4 PointAccessIterators share the last decompressed block
+    std::shared_ptr<CachedBlock> _cached_block;
   };
 };
 
@@ -2,6 +2,12 @@
 
 #include <lz4.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "resolve_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "utils/assert.hpp"
@@ -10,22 +16,38 @@
 namespace opossum {
 
 template <typename T>
-LZ4Segment<T>::LZ4Segment(pmr_vector<char>&& compressed_data, pmr_vector<bool>&& null_values,
-                          pmr_vector<size_t>&& offsets, const size_t decompressed_size)
+LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, pmr_vector<bool>&& null_values,
+                          pmr_vector<char>&& dictionary, pmr_vector<size_t>&& offsets, const size_t block_size,
+                          const size_t last_block_size, pmr_vector<ChunkOffset>&& block_first_rows,
+                          pmr_vector<pmr_string>&& block_min_values, pmr_vector<pmr_string>&& block_max_values)
     : BaseEncodedSegment{data_type_from_type<T>()},
-      _compressed_data{std::move(compressed_data)},
+      _lz4_blocks{std::move(lz4_blocks)},
       _null_values{std::move(null_values)},
+      _dictionary{std::move(dictionary)},
       _offsets{std::move(offsets)},
-      _decompressed_size{decompressed_size} {}
+      _block_size{block_size},
+      _last_block_size{last_block_size},
+      _block_first_rows{std::move(block_first_rows)},
+      _block_min_values{std::move(block_min_values)},
+      _block_max_values{std::move(block_max_values)} {
+  DebugAssert(_block_first_rows.size() == _lz4_blocks.size() && _block_min_values.size() == _lz4_blocks.size() &&
+                  _block_max_values.size() == _lz4_blocks.size(),
+              "Expected one block summary per block");
+}
 
 template <typename T>
-LZ4Segment<T>::LZ4Segment(pmr_vector<char>&& compressed_data, pmr_vector<bool>&& null_values,
-                          const size_t decompressed_size)
+LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, pmr_vector<bool>&& null_values,
+                          const size_t block_size, const size_t last_block_size)
     : BaseEncodedSegment{data_type_from_type<T>()},
-      _compressed_data{std::move(compressed_data)},
+      _lz4_blocks{std::move(lz4_blocks)},
       _null_values{std::move(null_values)},
+      _dictionary{_null_values.get_allocator()},
       _offsets{std::nullopt},
-      _decompressed_size{decompressed_size} {}
+      _block_size{block_size},
+      _last_block_size{last_block_size},
+      _block_first_rows{_null_values.get_allocator()},
+      _block_min_values{_null_values.get_allocator()},
+      _block_max_values{_null_values.get_allocator()} {}
 
 template <typename T>
 const AllTypeVariant LZ4Segment<T>::operator[](const ChunkOffset chunk_offset) const {
@@ -41,15 +63,13 @@ const AllTypeVariant LZ4Segment<T>::operator[](const ChunkOffset chunk_offset) c
 
 template <typename T>
 const std::optional<T> LZ4Segment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
-  PerformanceWarning("LZ4::get_typed_value: decompressing the whole LZ4 segment");
-  auto decompressed_segment = decompress();
-
-  const auto is_null = _null_values[chunk_offset];
-  if (is_null) {
+  if (_null_values[chunk_offset]) {
     return std::nullopt;
   }
 
-  return decompressed_segment[chunk_offset];
+  auto cached_block_index = std::optional<size_t>{};
+  auto cached_block = std::vector<char>{};
+  return decompress(chunk_offset, cached_block_index, cached_block);
 }
 
 template <typename T>
@@ -62,19 +82,75 @@ const std::optional<const pmr_vector<size_t>> LZ4Segment<T>::offsets() const {
   return _offsets;
 }
 
+template <typename T>
+const pmr_vector<pmr_vector<char>>& LZ4Segment<T>::lz4_blocks() const {
+  return _lz4_blocks;
+}
+
+template <typename T>
+const pmr_vector<char>& LZ4Segment<T>::dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+size_t LZ4Segment<T>::block_size() const {
+  return _block_size;
+}
+
+template <typename T>
+const pmr_vector<ChunkOffset>& LZ4Segment<T>::block_first_rows() const {
+  return _block_first_rows;
+}
+
+template <typename T>
+const pmr_vector<pmr_string>& LZ4Segment<T>::block_min_values() const {
+  return _block_min_values;
+}
+
+template <typename T>
+const pmr_vector<pmr_string>& LZ4Segment<T>::block_max_values() const {
+  return _block_max_values;
+}
+
 template <typename T>
 size_t LZ4Segment<T>::size() const {
   return _null_values.size();
 }
 
+template <typename T>
+size_t LZ4Segment<T>::_decompressed_size() const {
+  return _lz4_blocks.empty() ? 0u : (_lz4_blocks.size() - 1) * _block_size + _last_block_size;
+}
+
+template <typename T>
+void LZ4Segment<T>::_decompress_block(const size_t block_index, std::vector<char>& decompressed_block) const {
+  const auto& compressed_block = _lz4_blocks[block_index];
+  const auto decompressed_block_size = block_index + 1 == _lz4_blocks.size() ? _last_block_size : _block_size;
+  decompressed_block.resize(decompressed_block_size);
+
+  auto decompressed_result = 0;
+  if (_dictionary.empty()) {
+    decompressed_result =
+        LZ4_decompress_safe(compressed_block.data(), decompressed_block.data(),
+                            static_cast<int>(compressed_block.size()), static_cast<int>(decompressed_block_size));
+  } else {
+    decompressed_result = LZ4_decompress_safe_usingDict(
+        compressed_block.data(), decompressed_block.data(), static_cast<int>(compressed_block.size()),
+        static_cast<int>(decompressed_block_size), _dictionary.data(), static_cast<int>(_dictionary.size()));
+  }
+  Assert(decompressed_result == static_cast<int>(decompressed_block_size), "LZ4 decompression failed");
+}
+
 template <typename T>
 std::vector<T> LZ4Segment<T>::decompress() const {
-  auto decompressed_data = std::vector<T>(_decompressed_size / sizeof(T));
-  auto compressed_size = static_cast<int>(_compressed_data.size());
-  const int decompressed_result =
-      LZ4_decompress_safe(_compressed_data.data(), reinterpret_cast<char*>(decompressed_data.data()), compressed_size,
-                          static_cast<int>(_decompressed_size));
-  Assert(decompressed_result > 0, "LZ4 decompression failed");
+  auto decompressed_data = std::vector<T>(_decompressed_size() / sizeof(T));
+  auto decompressed_block = std::vector<char>{};
+
+  for (auto block_index = size_t{0}; block_index < _lz4_blocks.size(); ++block_index) {
+    _decompress_block(block_index, decompressed_block);
+    std::memcpy(reinterpret_cast<char*>(decompressed_data.data()) + block_index * _block_size,
+                decompressed_block.data(), decompressed_block.size());
+  }
 
   return decompressed_data;
 }
@@ -85,15 +161,18 @@ std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const {
    * If the input segment only contained empty strings the original size is 0. That can't be decompressed and instead
    * we can just return as many empty strings as the input contained.
    */
-  if (!_decompressed_size) {
+  const auto decompressed_size = _decompressed_size();
+  if (!decompressed_size) {
     return std::vector<pmr_string>(_null_values.size());
   }
 
-  auto decompressed_data = std::vector<char>(_decompressed_size);
-  auto compressed_size = static_cast<int>(_compressed_data.size());
-  const int decompressed_result = LZ4_decompress_safe(_compressed_data.data(), decompressed_data.data(),
-                                                      compressed_size, static_cast<int>(_decompressed_size));
-  Assert(decompressed_result > 0, "LZ4 decompression failed");
+  auto decompressed_data = std::vector<char>(decompressed_size);
+  auto decompressed_block = std::vector<char>{};
+  for (auto block_index = size_t{0}; block_index < _lz4_blocks.size(); ++block_index) {
+    _decompress_block(block_index, decompressed_block);
+    std::copy(decompressed_block.cbegin(), decompressed_block.cend(),
+              decompressed_data.begin() + static_cast<std::ptrdiff_t>(block_index * _block_size));
+  }
 
   /**
    * Decode the previously encoded string data. These strings are all appended and separated along the stored offsets.
@@ -107,7 +186,7 @@ std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const {
     auto start_char_offset = *it;
     size_t end_char_offset;
     if (it + 1 == _offsets->cend()) {
-      end_char_offset = _decompressed_size;
+      end_char_offset = decompressed_size;
     } else {
       end_char_offset = *(it + 1);
     }
@@ -120,18 +199,66 @@ std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const {
   return decompressed_strings;
 }
 
+template <typename T>
+T LZ4Segment<T>::decompress(const ChunkOffset chunk_offset, std::optional<size_t>& cached_block_index,
+                            std::vector<char>& cached_block) const {
+  const auto byte_offset = static_cast<size_t>(chunk_offset) * sizeof(T);
+  const auto block_index = byte_offset / _block_size;
+  if (cached_block_index != block_index) {
+    _decompress_block(block_index, cached_block);
+    cached_block_index = block_index;
+  }
+
+  auto value = T{};
+  std::memcpy(&value, cached_block.data() + byte_offset % _block_size, sizeof(T));
+  return value;
+}
+
+template <>
+pmr_string LZ4Segment<pmr_string>::decompress(const ChunkOffset chunk_offset,
+                                              std::optional<size_t>& cached_block_index,
+                                              std::vector<char>& cached_block) const {
+  const auto begin = (*_offsets)[chunk_offset];
+  const auto end = chunk_offset + size_t{1} < _offsets->size() ? (*_offsets)[chunk_offset + 1] : _decompressed_size();
+
+  auto value = pmr_string{};
+  value.reserve(end - begin);
+
+  // A string may span multiple blocks. In that case, the last of them is kept in the cache.
+  for (auto position = begin; position < end;) {
+    const auto block_index = position / _block_size;
+    if (cached_block_index != block_index) {
+      _decompress_block(block_index, cached_block);
+      cached_block_index = block_index;
+    }
+
+    const auto block_begin = block_index * _block_size;
+    const auto copy_end = std::min(end, block_begin + cached_block.size());
+    value.append(cached_block.data() + (position - block_begin), copy_end - position);
+    position = copy_end;
+  }
+
+  return value;
+}
+
 template <typename T>
 std::shared_ptr<BaseSegment> LZ4Segment<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
-  auto new_compressed_data = pmr_vector<char>{_compressed_data, alloc};
+  auto new_lz4_blocks = pmr_vector<pmr_vector<char>>{_lz4_blocks, alloc};
   auto new_null_values = pmr_vector<bool>{_null_values, alloc};
 
   if (_offsets.has_value()) {
+    auto new_dictionary = pmr_vector<char>{_dictionary, alloc};
     auto new_offsets = pmr_vector<size_t>(*_offsets, alloc);
-    return std::allocate_shared<LZ4Segment>(alloc, std::move(new_compressed_data), std::move(new_null_values),
-                                            std::move(new_offsets), _decompressed_size);
+    auto new_block_first_rows = pmr_vector<ChunkOffset>{_block_first_rows, alloc};
+    auto new_block_min_values = pmr_vector<pmr_string>{_block_min_values, alloc};
+    auto new_block_max_values = pmr_vector<pmr_string>{_block_max_values, alloc};
+    return std::allocate_shared<LZ4Segment>(alloc, std::move(new_lz4_blocks), std::move(new_null_values),
+                                            std::move(new_dictionary), std::move(new_offsets), _block_size,
+                                            _last_block_size, std::move(new_block_first_rows),
+                                            std::move(new_block_min_values), std::move(new_block_max_values));
   } else {
-    return std::allocate_shared<LZ4Segment>(alloc, std::move(new_compressed_data), std::move(new_null_values),
-                                            _decompressed_size);
+    return std::allocate_shared<LZ4Segment>(alloc, std::move(new_lz4_blocks), std::move(new_null_values),
+                                            _block_size, _last_block_size);
   }
 }
 
@@ -140,7 +267,15 @@ size_t LZ4Segment<T>::estimate_memory_usage() const {
   auto bool_size = _null_values.size() * sizeof(bool);
   // _offsets is used only for strings
   auto offset_size = (_offsets.has_value() ? _offsets->size() * sizeof(size_t) : 0u);
-  return sizeof(*this) + _compressed_data.size() + bool_size + offset_size;
+  auto block_size = _lz4_blocks.size() * sizeof(pmr_vector<char>);
+  for (const auto& lz4_block : _lz4_blocks) {
+    block_size += lz4_block.size();
+  }
+  auto block_summary_size = _block_first_rows.size() * (sizeof(ChunkOffset) + 2 * sizeof(pmr_string));
+  for (auto block_index = size_t{0}; block_index < _block_min_values.size(); ++block_index) {
+    block_summary_size += _block_min_values[block_index].size() + _block_max_values[block_index].size();
+  }
+  return sizeof(*this) + block_size + _dictionary.size() + bool_size + offset_size + block_summary_size;
 }
 
 template <typename T>
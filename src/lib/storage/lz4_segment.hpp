@@ -8,6 +8,8 @@
 
 #include <array>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "base_encoded_segment.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -17,6 +19,13 @@ namespace opossum {
 
 class BaseCompressedVector;
 
+/**
+ * LZ4Segments compress their values in independent blocks of block_size bytes, so that a single value can be accessed
+ * by decompressing only the block that contains it. Numerical values never span two blocks because the block size is
+ * a multiple of their size. Strings are concatenated before they are split into blocks and may thus span multiple
+ * blocks. For string segments that consist of more than one block, the blocks are compressed using a dictionary
+ * built from values sampled across the segment, which makes up for the context LZ4 loses at each block boundary.
+ */
 template <typename T>
 class LZ4Segment : public BaseEncodedSegment {
  public:
@@ -24,25 +33,42 @@ class LZ4Segment : public BaseEncodedSegment {
    * This is a container for an LZ4 compressed segment. It contains the compressed data, the necessary
    * metadata and the ability to decompress the data again.
    *
-   * @param compressed_data The char vector that contains the LZ4 compressed segment data as binary blob.
+   * @param lz4_blocks The LZ4 compressed blocks. Each one can be decompressed on its own (using the dictionary).
    * @param null_values Boolean vector that contains the information which row is null and which is not null.
+   * @param dictionary The dictionary used to compress the blocks. It is empty if no dictionary is used.
    * @param offsets If this segment is not a pmr_string segment this will be a std::nullopt (see the other constructor).
    *                Otherwise it contains the offsets for the compressed strings. The offset at position 0 is the
    *                character index of the string at index 0. Its (exclusive) end is at the offset at position 1. The
-   *                last string ends at the end of the compressed data (since there is offset after it that specifies
-   *                the end offset). Since these offsets are used the stored strings are not null-terminated
-   *                (and may contain null bytes).
-   * @param compressed_size The size of the compressed data vector (the return value of LZ4)
-   * @param decompressed_size The size in bytes of the decompressed data vector.
+   *                last string ends at the end of the decompressed data (since there is offset after it that
+   *                specifies the end offset). Since these offsets are used the stored strings are not
+   *                null-terminated (and may contain null bytes).
+   * @param block_size The decompressed size in bytes of each block but the last one
+   * @param last_block_size The decompressed size in bytes of the last block
+   * @param block_first_rows, block_min_values, block_max_values One entry per block, see block_first_rows()
    */
-  explicit LZ4Segment(pmr_vector<char>&& compressed_data, pmr_vector<bool>&& null_values, pmr_vector<size_t>&& offsets,
-                      const size_t decompressed_size);
+  explicit LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, pmr_vector<bool>&& null_values,
+                      pmr_vector<char>&& dictionary, pmr_vector<size_t>&& offsets, const size_t block_size,
+                      const size_t last_block_size, pmr_vector<ChunkOffset>&& block_first_rows,
+                      pmr_vector<pmr_string>&& block_min_values, pmr_vector<pmr_string>&& block_max_values);
 
-  explicit LZ4Segment(pmr_vector<char>&& compressed_data, pmr_vector<bool>&& null_values,
-                      const size_t decompressed_size);
+  explicit LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, pmr_vector<bool>&& null_values,
+                      const size_t block_size, const size_t last_block_size);
 
   const pmr_vector<bool>& null_values() const;
   const std::optional<const pmr_vector<size_t>> offsets() const;
+  const pmr_vector<pmr_vector<char>>& lz4_blocks() const;
+  const pmr_vector<char>& dictionary() const;
+  size_t block_size() const;
+
+  /**
+   * Summaries of the string blocks, which let scans skip blocks without decompressing them. The strings of the rows
+   * [block_first_rows()[i], block_first_rows()[i + 1]) begin in block i. block_min_values()[i] and
+   * block_max_values()[i] are the smallest and largest of these strings that are not NULL (both empty if there are
+   * none). The vectors are empty for numerical segments and for string segments without blocks.
+   */
+  const pmr_vector<ChunkOffset>& block_first_rows() const;
+  const pmr_vector<pmr_string>& block_min_values() const;
+  const pmr_vector<pmr_string>& block_max_values() const;
 
   /**
    * @defgroup BaseSegment interface
@@ -57,6 +83,15 @@ class LZ4Segment : public BaseEncodedSegment {
 
   std::vector<T> decompress() const;
 
+  /**
+   * Decompresses the value at chunk_offset (which must not be NULL). Only the blocks the value is stored in are
+   * decompressed. cached_block holds the decompressed block with the index cached_block_index. It is reused if the
+   * value is stored in it and otherwise replaced by the (last) block the value is stored in, so that accessing
+   * ascending chunk offsets decompresses each block only once.
+   */
+  T decompress(const ChunkOffset chunk_offset, std::optional<size_t>& cached_block_index,
+               std::vector<char>& cached_block) const;
+
   std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
 
   size_t estimate_memory_usage() const final;
@@ -74,10 +109,19 @@ class LZ4Segment : public BaseEncodedSegment {
   /**@}*/
 
  private:
-  const pmr_vector<char> _compressed_data;
+  void _decompress_block(const size_t block_index, std::vector<char>& decompressed_block) const;
+
+  size_t _decompressed_size() const;
+
+  const pmr_vector<pmr_vector<char>> _lz4_blocks;
   const pmr_vector<bool> _null_values;
+  const pmr_vector<char> _dictionary;
   const std::optional<const pmr_vector<size_t>> _offsets;
-  const size_t _decompressed_size;
+  const size_t _block_size;
+  const size_t _last_block_size;
+  const pmr_vector<ChunkOffset> _block_first_rows;
+  const pmr_vector<pmr_string> _block_min_values;
+  const pmr_vector<pmr_string> _block_max_values;
 };
 
 }  // namespace opossum
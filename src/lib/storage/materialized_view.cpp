@@ -0,0 +1,396 @@
+#include "materialized_view.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "lqp_view.hpp"
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using GroupKey = std::vector<AllTypeVariant>;
+
+struct GroupKeyHash {
+  size_t operator()(const GroupKey& group_key) const {
+    auto hash = size_t{0};
+    for (const auto& value : group_key) {
+      boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+    }
+    return hash;
+  }
+};
+
+// NULL == NULL is false for AllTypeVariants, but NULLs form a single group when aggregating
+struct GroupKeyEqual {
+  bool operator()(const GroupKey& lhs, const GroupKey& rhs) const {
+    const auto values_equal = [](const auto& lhs_value, const auto& rhs_value) {
+      if (variant_is_null(lhs_value) || variant_is_null(rhs_value)) {
+        return variant_is_null(lhs_value) && variant_is_null(rhs_value);
+      }
+      return lhs_value == rhs_value;
+    };
+    return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), values_equal);
+  }
+};
+
+std::vector<AllTypeVariant> get_row(const Chunk& chunk, const ChunkOffset chunk_offset) {
+  auto row = std::vector<AllTypeVariant>(chunk.column_count());
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    row[column_id] = (*chunk.get_segment(column_id))[chunk_offset];
+  }
+  return row;
+}
+
+// Combines two values of an aggregate that were computed on disjoint sets of rows
+void combine_aggregate_values(AllTypeVariant& aggregate_value, const AllTypeVariant& value,
+                              const AggregateFunction aggregate_function, const DataType data_type) {
+  if (variant_is_null(value)) return;
+  if (variant_is_null(aggregate_value)) {
+    aggregate_value = value;
+    return;
+  }
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto lhs = boost::get<ColumnDataType>(aggregate_value);
+    const auto& rhs = boost::get<ColumnDataType>(value);
+
+    switch (aggregate_function) {
+      case AggregateFunction::Min:
+        if (rhs < lhs) aggregate_value = rhs;
+        break;
+      case AggregateFunction::Max:
+        if (lhs < rhs) aggregate_value = rhs;
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Count:
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          aggregate_value = static_cast<ColumnDataType>(lhs + rhs);
+        } else {
+          Fail("Cannot add non-arithmetic aggregates");
+        }
+        break;
+      default:
+        Fail("Aggregate function cannot be combined");
+    }
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+MaterializedView::MaterializedView(const std::shared_ptr<LQPView>& view) : view(view), lqp_hash(view->lqp->hash()) {
+  // Check whether the view can be refreshed incrementally, see the class comment for the supported LQPs
+  auto aggregate_node = view->lqp;
+  while (aggregate_node->type == LQPNodeType::Projection || aggregate_node->type == LQPNodeType::Alias) {
+    aggregate_node = aggregate_node->left_input();
+  }
+
+  if (aggregate_node->type == LQPNodeType::Aggregate) {
+    const auto group_by_expression_count =
+        std::static_pointer_cast<AggregateNode>(aggregate_node)->aggregate_expressions_begin_idx;
+    const auto group_by_expressions_end = aggregate_node->node_expressions.cbegin() + group_by_expression_count;
+
+    auto incrementally_refreshable = true;
+    auto column_aggregate_functions = std::vector<std::optional<AggregateFunction>>{};
+
+    // Merging the results requires all group by columns in the output and only aggregates that can be combined
+    for (const auto& column_expression : view->lqp->column_expressions()) {
+      if (column_expression->type == ExpressionType::Aggregate) {
+        const auto aggregate_function = static_cast<const AggregateExpression&>(*column_expression).aggregate_function;
+        if (aggregate_function != AggregateFunction::Sum && aggregate_function != AggregateFunction::Count &&
+            aggregate_function != AggregateFunction::Min && aggregate_function != AggregateFunction::Max) {
+          incrementally_refreshable = false;
+        }
+        column_aggregate_functions.emplace_back(aggregate_function);
+      } else {
+        column_aggregate_functions.emplace_back(std::nullopt);
+      }
+
+      if (!aggregate_node->find_column_id(*column_expression)) incrementally_refreshable = false;
+    }
+
+    for (auto iter = aggregate_node->node_expressions.cbegin(); iter != group_by_expressions_end; ++iter) {
+      if (!view->lqp->find_column_id(**iter)) incrementally_refreshable = false;
+    }
+
+    // Below the aggregate, only a chain of nodes that filter the rows of a single table is allowed
+    auto node = aggregate_node->left_input();
+    while (incrementally_refreshable && node->type != LQPNodeType::StoredTable) {
+      if ((node->type != LQPNodeType::Predicate && node->type != LQPNodeType::Validate &&
+           node->type != LQPNodeType::Projection) ||
+          node->right_input()) {
+        incrementally_refreshable = false;
+        break;
+      }
+
+      for (const auto& node_expression : node->node_expressions) {
+        visit_expression(node_expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::LQPSubquery) incrementally_refreshable = false;
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+
+      node = node->left_input();
+    }
+
+    if (incrementally_refreshable) {
+      _incremental_base_table_name = std::static_pointer_cast<StoredTableNode>(node)->table_name;
+      _column_aggregate_functions = std::move(column_aggregate_functions);
+    }
+  }
+
+  refresh();
+}
+
+void MaterializedView::refresh() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  // Remember the state of the base tables before executing the view, so that rows added concurrently make the view
+  // outdated.
+  _base_table_states.clear();
+  _has_uncommitted_rows = false;
+  visit_lqp(view->lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::StoredTable) return LQPVisitation::VisitInputs;
+
+    const auto& table_name = std::static_pointer_cast<StoredTableNode>(node)->table_name;
+    const auto table = StorageManager::get().get_table(table_name);
+    _base_table_states.emplace_back(BaseTableState{table_name, table, table->row_count()});
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk && !_is_committed(*chunk, snapshot_commit_id)) _has_uncommitted_rows = true;
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  if (_incremental_base_table_name) {
+    _refresh_incrementally(transaction_context);
+  } else {
+    _refresh_entirely(transaction_context);
+  }
+
+  // The view only reads, so committing cannot fail
+  transaction_context->commit();
+}
+
+bool MaterializedView::is_incrementally_refreshable() const { return _incremental_base_table_name.has_value(); }
+
+bool MaterializedView::is_up_to_date() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (_has_uncommitted_rows) return false;
+
+  const auto& storage_manager = StorageManager::get();
+  return std::all_of(_base_table_states.cbegin(), _base_table_states.cend(), [&](const auto& base_table_state) {
+    if (!storage_manager.has_table(base_table_state.table_name)) return false;
+
+    const auto table = storage_manager.get_table(base_table_state.table_name);
+    return table == base_table_state.table.lock() && table->row_count() == base_table_state.row_count;
+  });
+}
+
+std::shared_ptr<const Table> MaterializedView::table() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _table;
+}
+
+void MaterializedView::_refresh_entirely(const std::shared_ptr<TransactionContext>& transaction_context) {
+  _table = _materialize(*_execute(view->lqp->deep_copy(), transaction_context));
+}
+
+void MaterializedView::_refresh_incrementally(const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto base_table = StorageManager::get().get_table(*_incremental_base_table_name);
+
+  // A table that was replaced has to be aggregated from scratch
+  if (base_table != _aggregated_base_table) {
+    _aggregated_base_table = base_table;
+    _aggregated_chunk_count = ChunkID{0};
+    _aggregated_chunks_result = nullptr;
+  }
+
+  // Chunks are complete once no more rows can be added to them and all their rows are committed. Their aggregates
+  // do not change anymore, so they are kept for the next refresh. The remaining chunks are aggregated on every refresh.
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  const auto chunk_count = base_table->chunk_count();
+  auto complete_chunk_count = _aggregated_chunk_count;
+  while (complete_chunk_count < chunk_count) {
+    const auto chunk = base_table->get_chunk(complete_chunk_count);
+    if (!chunk || (chunk->is_mutable() && chunk->size() < base_table->max_chunk_size()) ||
+        !_is_committed(*chunk, snapshot_commit_id)) {
+      break;
+    }
+    ++complete_chunk_count;
+  }
+
+  if (complete_chunk_count > _aggregated_chunk_count || !_aggregated_chunks_result) {
+    const auto new_chunks_result =
+        _execute_on_chunks(base_table, _aggregated_chunk_count, complete_chunk_count, transaction_context);
+    _aggregated_chunks_result = _aggregated_chunks_result ? _merge(*_aggregated_chunks_result, *new_chunks_result)
+                                                          : _materialize(*new_chunks_result);
+    _aggregated_chunk_count = complete_chunk_count;
+  }
+
+  if (complete_chunk_count == chunk_count) {
+    _table = _aggregated_chunks_result;
+    return;
+  }
+
+  const auto incomplete_chunks_result =
+      _execute_on_chunks(base_table, complete_chunk_count, chunk_count, transaction_context);
+  _table = _merge(*_aggregated_chunks_result, *incomplete_chunks_result);
+}
+
+std::shared_ptr<const Table> MaterializedView::_execute_on_chunks(
+    const std::shared_ptr<const Table>& base_table, const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+    const std::shared_ptr<TransactionContext>& transaction_context) const {
+  // GetTable would also read chunks that are appended concurrently, so the selected chunks are put into a separate
+  // table, which replaces the StoredTableNode. As the chunks are shared, their MVCC data is still used by Validate.
+  auto chunks_table = std::make_shared<Table>(base_table->column_definitions(), TableType::Data,
+                                              base_table->max_chunk_size(), base_table->has_mvcc());
+  for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+    chunks_table->append_chunk(std::const_pointer_cast<Chunk>(base_table->get_chunk(chunk_id)));
+  }
+
+  const auto lqp = view->lqp->deep_copy();
+
+  auto stored_table_node = std::shared_ptr<AbstractLQPNode>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) stored_table_node = node;
+    return LQPVisitation::VisitInputs;
+  });
+  DebugAssert(stored_table_node, "Incrementally refreshable views read exactly one table");
+
+  const auto chunks_node =
+      IntermediateResultNode::make(stored_table_node, chunks_table, stored_table_node->get_statistics());
+  const auto outputs = stored_table_node->outputs();
+  const auto input_sides = stored_table_node->get_input_sides();
+  for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], chunks_node);
+  }
+
+  return _execute(lqp, transaction_context);
+}
+
+std::shared_ptr<Table> MaterializedView::_merge(const Table& lhs, const Table& rhs) const {
+  DebugAssert(lhs.column_definitions() == rhs.column_definitions(), "Results of the view do not match");
+
+  const auto column_count = lhs.column_count();
+
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  auto row_idx_by_group_key = std::unordered_map<GroupKey, size_t, GroupKeyHash, GroupKeyEqual>{};
+
+  for (const auto* table : {&lhs, &rhs}) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        auto row = get_row(*chunk, chunk_offset);
+
+        auto group_key = GroupKey{};
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          if (!_column_aggregate_functions[column_id]) group_key.emplace_back(row[column_id]);
+        }
+
+        const auto [iter, inserted] = row_idx_by_group_key.try_emplace(std::move(group_key), rows.size());
+        if (inserted) {
+          rows.emplace_back(std::move(row));
+          continue;
+        }
+
+        auto& merged_row = rows[iter->second];
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          if (!_column_aggregate_functions[column_id]) continue;
+          combine_aggregate_values(merged_row[column_id], row[column_id], *_column_aggregate_functions[column_id],
+                                   lhs.column_data_type(column_id));
+        }
+      }
+    }
+  }
+
+  auto merged_table = std::make_shared<Table>(lhs.column_definitions(), TableType::Data);
+  for (const auto& row : rows) {
+    merged_table->append(row);
+  }
+
+  return merged_table;
+}
+
+std::shared_ptr<const Table> MaterializedView::_execute(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  pqp->set_transaction_context_recursively(transaction_context);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes));
+
+  const auto result = pqp->get_output();
+  Assert(result, "Executing the materialized view failed");
+  return result;
+}
+
+std::shared_ptr<Table> MaterializedView::_materialize(const Table& table) {
+  // The result of the view might reference the base tables, but it has to remain valid when they change
+  auto materialized_table = std::make_shared<Table>(table.column_definitions(), TableType::Data);
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      materialized_table->append(get_row(*chunk, chunk_offset));
+    }
+  }
+
+  return materialized_table;
+}
+
+bool MaterializedView::_is_committed(const Chunk& chunk, const CommitID snapshot_commit_id) {
+  if (!chunk.has_mvcc_data()) return true;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  if (mvcc_data->max_begin_cid <= snapshot_commit_id) return true;
+
+  // max_begin_cid is only determined for immutable chunks. Rows of rolled back inserts have a begin_cid of 0.
+  const auto chunk_size = chunk.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (mvcc_data->get_begin_cid(chunk_offset) > snapshot_commit_id) return false;
+  }
+  return true;
+}
+
+}  // namespace opossum
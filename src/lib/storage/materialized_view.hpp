@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Chunk;
+class LQPView;
+class Table;
+class TransactionContext;
+
+/**
+ * A view whose result is kept as a Table. The MaterializedViewRule replaces subplans that are equal to the view's LQP
+ * with this table, as long as the view is up to date, i.e., no rows were added to its base tables since the last
+ * refresh(). The view is executed once on construction.
+ *
+ * Views of the form [Projection/Alias ->] Aggregate -> [Predicate/Validate/Projection ->] StoredTable with only SUM,
+ * COUNT, MIN, and MAX aggregates are refreshed incrementally: The aggregates of chunks that are complete (i.e., full
+ * and without uncommitted rows) are kept and only chunks added since the last refresh are aggregated and merged into
+ * them. This assumes that the base table is insert-only - deleted or updated rows in already aggregated chunks are
+ * not noticed. All other views are re-executed entirely on refresh().
+ */
+class MaterializedView final {
+ public:
+  explicit MaterializedView(const std::shared_ptr<LQPView>& view);
+
+  void refresh();
+
+  bool is_incrementally_refreshable() const;
+
+  // Returns false if rows were added to any of the base tables or if uncommitted rows were seen during the last refresh
+  bool is_up_to_date() const;
+
+  // The result of the last refresh(), a data table with the columns of the view's LQP
+  std::shared_ptr<const Table> table() const;
+
+  const std::shared_ptr<LQPView> view;
+
+  // The hash of view->lqp, used to skip subplans that are definitely not equal to it
+  const size_t lqp_hash;
+
+ private:
+  struct BaseTableState {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    uint64_t row_count;
+  };
+
+  void _refresh_entirely(const std::shared_ptr<TransactionContext>& transaction_context);
+  void _refresh_incrementally(const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Executes view->lqp on the chunks [begin_chunk_id, end_chunk_id) of the base table only
+  std::shared_ptr<const Table> _execute_on_chunks(const std::shared_ptr<const Table>& base_table,
+                                                  const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+                                                  const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  // Merges the rows of two results of the view's aggregate that belong to the same group
+  std::shared_ptr<Table> _merge(const Table& lhs, const Table& rhs) const;
+
+  static std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                               const std::shared_ptr<TransactionContext>& transaction_context);
+  static std::shared_ptr<Table> _materialize(const Table& table);
+  static bool _is_committed(const Chunk& chunk, const CommitID snapshot_commit_id);
+
+  // For incrementally refreshable views, the name of the single base table and, per output column, the function of
+  // the aggregate or std::nullopt for group by columns.
+  std::optional<std::string> _incremental_base_table_name;
+  std::vector<std::optional<AggregateFunction>> _column_aggregate_functions;
+
+  mutable std::mutex _mutex;
+
+  std::shared_ptr<const Table> _table;
+  std::vector<BaseTableState> _base_table_states;
+  bool _has_uncommitted_rows{false};
+
+  // The merged aggregates of the complete chunks [0, _aggregated_chunk_count) of _aggregated_base_table
+  std::shared_ptr<const Table> _aggregated_base_table;
+  ChunkID _aggregated_chunk_count{0};
+  std::shared_ptr<const Table> _aggregated_chunks_result;
+};
+
+}  // namespace opossum
@@ -0,0 +1,183 @@
+#include "meta_tables.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/base_mutable_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The meta tables are filled row by row and get their MvccData afterwards, so that their rows are visible to all
+// transactions (Chunk::append() adds rows that are not committed yet)
+std::shared_ptr<Table> make_visible(const std::shared_ptr<Table>& rows) {
+  const auto table = std::make_shared<Table>(rows->column_definitions(), TableType::Data, rows->max_chunk_size(),
+                                             UseMvcc::Yes);
+  for (auto chunk_id = ChunkID{0}; chunk_id < rows->chunk_count(); ++chunk_id) {
+    table->append_chunk(rows->get_chunk(chunk_id)->segments());
+  }
+  return table;
+}
+
+// The indexes on exactly the given column of the chunk
+size_t estimate_index_memory_usage(const Chunk& chunk, const ColumnID column_id) {
+  auto bytes = size_t{0};
+  for (const auto& index : chunk.get_indices(std::vector<ColumnID>{column_id})) {
+    bytes += index->memory_consumption();
+  }
+  if (const auto mutable_index = chunk.get_mutable_index(column_id)) bytes += mutable_index->memory_consumption();
+  return bytes;
+}
+
+size_t estimate_index_memory_usage(const Chunk& chunk) {
+  // Evicted chunks do not have indexes, see Chunk::evict()
+  if (chunk.is_evicted()) return 0;
+
+  auto bytes = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    bytes += estimate_index_memory_usage(chunk, column_id);
+  }
+  return bytes;
+}
+
+std::shared_ptr<Table> generate_tables_table() {
+  const auto rows = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String},
+                                                                   {"column_count", DataType::Int},
+                                                                   {"chunk_count", DataType::Int},
+                                                                   {"row_count", DataType::Long},
+                                                                   {"max_chunk_size", DataType::Int},
+                                                                   {"estimated_size_in_bytes", DataType::Long},
+                                                                   {"index_size_in_bytes", DataType::Long}},
+                                            TableType::Data);
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    auto index_bytes = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk) index_bytes += estimate_index_memory_usage(*chunk);
+    }
+    for (const auto& table_index : table->table_indexes()) {
+      index_bytes += table_index->estimate_memory_usage();
+    }
+
+    rows->append({pmr_string{table_name}, static_cast<int32_t>(table->column_count()),
+                  static_cast<int32_t>(table->chunk_count()), static_cast<int64_t>(table->row_count()),
+                  static_cast<int32_t>(table->max_chunk_size()), static_cast<int64_t>(table->estimate_memory_usage()),
+                  static_cast<int64_t>(index_bytes)});
+  }
+
+  return make_visible(rows);
+}
+
+std::shared_ptr<Table> generate_chunks_table() {
+  const auto rows = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String},
+                                                                   {"chunk_id", DataType::Int},
+                                                                   {"row_count", DataType::Long},
+                                                                   {"invalid_row_count", DataType::Long},
+                                                                   {"is_mutable", DataType::Int},
+                                                                   {"is_evicted", DataType::Int},
+                                                                   {"estimated_size_in_bytes", DataType::Long},
+                                                                   {"index_size_in_bytes", DataType::Long}},
+                                            TableType::Data);
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      // Chunks can be removed concurrently by the MvccDeletePlugin
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      rows->append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), static_cast<int64_t>(chunk->size()),
+                    static_cast<int64_t>(chunk->invalid_row_count()), static_cast<int32_t>(chunk->is_mutable()),
+                    static_cast<int32_t>(chunk->is_evicted()), static_cast<int64_t>(chunk->estimate_memory_usage()),
+                    static_cast<int64_t>(estimate_index_memory_usage(*chunk))});
+    }
+  }
+
+  return make_visible(rows);
+}
+
+std::shared_ptr<Table> generate_segments_table() {
+  const auto rows = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String},
+                                                                   {"chunk_id", DataType::Int},
+                                                                   {"column_id", DataType::Int},
+                                                                   {"column_name", DataType::String},
+                                                                   {"column_data_type", DataType::String},
+                                                                   {"encoding_type", DataType::String},
+                                                                   {"vector_compression_type", DataType::String, true},
+                                                                   {"row_count", DataType::Long},
+                                                                   {"distinct_count", DataType::Long, true},
+                                                                   {"estimated_size_in_bytes", DataType::Long},
+                                                                   {"index_size_in_bytes", DataType::Long}},
+                                            TableType::Data);
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_evicted()) continue;
+
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        const auto segment = chunk->get_segment(column_id);
+
+        auto encoding_type = EncodingType::Unencoded;
+        auto vector_compression_type = AllTypeVariant{NULL_VALUE};
+        if (const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment)) {
+          encoding_type = encoded_segment->encoding_type();
+          if (const auto compressed_vector_type = encoded_segment->compressed_vector_type()) {
+            vector_compression_type = pmr_string{compressed_vector_type_to_string.left.at(*compressed_vector_type)};
+          }
+        }
+
+        auto distinct_count = AllTypeVariant{NULL_VALUE};
+        if (const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+          distinct_count = static_cast<int64_t>(dictionary_segment->unique_values_count());
+        }
+
+        rows->append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), static_cast<int32_t>(column_id),
+                      pmr_string{table->column_name(column_id)},
+                      pmr_string{data_type_to_string.left.at(table->column_data_type(column_id))},
+                      pmr_string{encoding_type_to_string.left.at(encoding_type)}, vector_compression_type,
+                      static_cast<int64_t>(segment->size()), distinct_count,
+                      static_cast<int64_t>(segment->estimate_memory_usage()),
+                      static_cast<int64_t>(estimate_index_memory_usage(*chunk, column_id))});
+      }
+    }
+  }
+
+  return make_visible(rows);
+}
+
+const auto meta_table_generators = std::map<std::string, std::shared_ptr<Table> (*)()>{
+    {"meta_chunks", &generate_chunks_table},
+    {"meta_segments", &generate_segments_table},
+    {"meta_tables", &generate_tables_table}};
+
+}  // namespace
+
+namespace opossum {
+
+bool is_meta_table_name(const std::string& name) { return meta_table_generators.count(name); }
+
+std::vector<std::string> meta_table_names() {
+  auto names = std::vector<std::string>{};
+  for (const auto& [name, generator] : meta_table_generators) names.emplace_back(name);
+  return names;
+}
+
+std::shared_ptr<Table> generate_meta_table(const std::string& name) {
+  const auto generator_iter = meta_table_generators.find(name);
+  Assert(generator_iter != meta_table_generators.end(), "No such meta table named '" + name + "'");
+  return generator_iter->second();
+}
+
+}  // namespace opossum
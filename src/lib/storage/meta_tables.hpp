@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Meta tables describe the tables of the StorageManager and can be queried with SQL like any stored table, e.g.,
+ *   SELECT table_name, SUM(estimated_size_in_bytes) FROM meta_segments WHERE encoding_type = 'Unencoded'
+ *     GROUP BY table_name
+ * They are read-only and are generated from the current state of the stored tables whenever they are accessed by a
+ * GetTable operator (see StorageManager::generate_meta_table()).
+ *
+ *   meta_tables     One row per stored table with its column, chunk, and row counts as well as its estimated size
+ *                   and that of its indexes (including table-level indexes)
+ *   meta_chunks     One row per chunk with its row count, invalidated rows, whether it is mutable or evicted to
+ *                   secondary storage, and its estimated size and that of its indexes
+ *   meta_segments   One row per segment with its column, data type, encoding, vector compression (if any), row count,
+ *                   distinct count (for dictionary-encoded segments), and its estimated size and that of the indexes
+ *                   on its column. Segments of evicted chunks are not listed, as that would load them.
+ *
+ * As the sizes are the estimates of the segments, indexes, and MvccData (see BaseSegment::estimate_memory_usage()),
+ * generating the tables costs constant time per segment and does not access the values. Thus, they can be polled for
+ * monitoring.
+ */
+bool is_meta_table_name(const std::string& name);
+
+std::vector<std::string> meta_table_names();
+
+std::shared_ptr<Table> generate_meta_table(const std::string& name);
+
+}  // namespace opossum
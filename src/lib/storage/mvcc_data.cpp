@@ -1,5 +1,7 @@
 #include "mvcc_data.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <shared_mutex>
 
 #include "utils/assert.hpp"
@@ -10,6 +12,80 @@ MvccData::MvccData(const size_t size) { grow_by(size, 0); }
 
 size_t MvccData::size() const { return _size; }
 
+TransactionID MvccData::get_tid(const ChunkOffset offset) const {
+  DebugAssert(offset < _size, "Offset out of range");
+  const auto tid = chunk_tid.load();
+  return tid != 0 ? tid : tids[offset].load();
+}
+
+CommitID MvccData::get_begin_cid(const ChunkOffset offset) const {
+  DebugAssert(offset < _size, "Offset out of range");
+  if (_is_frozen) return _frozen_begin_cid;
+  return begin_cids[offset];
+}
+
+void MvccData::set_begin_cid(const ChunkOffset offset, const CommitID begin_cid) {
+  DebugAssert(!_is_frozen, "The begin_cids of frozen MvccData cannot be changed");
+  begin_cids[offset] = begin_cid;
+}
+
+CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
+  DebugAssert(offset < _size, "Offset out of range");
+  const auto chunk_end_cid_value = chunk_end_cid.load();
+  if (!_is_frozen) return std::min(end_cids[offset], chunk_end_cid_value);
+
+  // Most rows of frozen chunks are never deleted
+  if (_frozen_end_cids.empty()) return chunk_end_cid_value;
+  const auto iter = _frozen_end_cids.find(offset);
+  return iter != _frozen_end_cids.end() ? std::min(iter->second, chunk_end_cid_value) : chunk_end_cid_value;
+}
+
+void MvccData::set_end_cid(const ChunkOffset offset, const CommitID end_cid) {
+  DebugAssert(offset < _size, "Offset out of range");
+  if (!_is_frozen) {
+    end_cids[offset] = end_cid;
+    return;
+  }
+
+  // A row is deleted only once, so that there are no concurrent writes to the same entry. Unlike operator[], emplace()
+  // does not publish a default-constructed end_cid, which would make the row invisible to concurrent readers.
+  [[maybe_unused]] const auto inserted = _frozen_end_cids.emplace(offset, end_cid).second;
+  DebugAssert(inserted, "End commit id of a frozen row was set twice");
+}
+
+void MvccData::freeze(const CommitID begin_cid) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (_is_frozen) return;
+
+  DebugAssert(std::all_of(begin_cids.begin(), begin_cids.end(),
+                          [&](const auto row_begin_cid) { return row_begin_cid <= begin_cid; }),
+              "Cannot freeze MvccData with rows that were committed after the begin_cid");
+
+  for (auto offset = ChunkOffset{0}; offset < _size; ++offset) {
+    if (end_cids[offset] != MAX_COMMIT_ID) _frozen_end_cids.emplace(offset, end_cids[offset]);
+  }
+
+  _frozen_begin_cid = begin_cid;
+  max_begin_cid = begin_cid;
+  _is_frozen = true;
+
+  begin_cids.clear();
+  begin_cids.shrink_to_fit();
+  end_cids.clear();
+  end_cids.shrink_to_fit();
+}
+
+bool MvccData::is_frozen() const { return _is_frozen; }
+
+size_t MvccData::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+  bytes += tids.size() * sizeof(decltype(tids)::value_type);
+  bytes += begin_cids.size() * sizeof(decltype(begin_cids)::value_type);
+  bytes += end_cids.size() * sizeof(decltype(end_cids)::value_type);
+  bytes += _frozen_end_cids.size() * sizeof(decltype(_frozen_end_cids)::value_type);
+  return bytes;
+}
+
 void MvccData::shrink() {
   tids.shrink_to_fit();
   begin_cids.shrink_to_fit();
@@ -17,6 +93,7 @@ void MvccData::shrink() {
 }
 
 void MvccData::grow_by(size_t delta, CommitID begin_cid) {
+  DebugAssert(!_is_frozen, "Cannot add rows to frozen MvccData");
   _size += delta;
   tids.grow_to_at_least(_size);
   begin_cids.grow_to_at_least(_size, begin_cid);
@@ -29,11 +106,11 @@ void MvccData::print(std::ostream& stream) const {
   stream << std::endl;
 
   stream << "BeginCIDs: ";
-  for (const auto& begin_cid : begin_cids) stream << begin_cid << ", ";
+  for (auto offset = ChunkOffset{0}; offset < _size; ++offset) stream << get_begin_cid(offset) << ", ";
   stream << std::endl;
 
   stream << "EndCIDs: ";
-  for (const auto& end_cid : end_cids) stream << end_cid << ", ";
+  for (auto offset = ChunkOffset{0}; offset < _size; ++offset) stream << get_end_cid(offset) << ", ";
   stream << std::endl;
 }
 
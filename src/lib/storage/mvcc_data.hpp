@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tbb/concurrent_unordered_map.h>
+
 #include <atomic>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 
@@ -10,6 +12,14 @@ namespace opossum {
 
 /**
  * Stores visibility information for multiversion concurrency control
+ *
+ * Initially, a begin_cid and an end_cid is stored for every row. Chunks that do not receive any more rows can be
+ * frozen (see freeze()), which replaces both vectors by a single begin_cid for all rows and a sparse map of the rows
+ * that have an end_cid. Thus, begin_cids and end_cids should only be accessed directly for chunks that are not frozen,
+ * all other code should use the accessors below. The tids are kept in any case, as they serve as row locks.
+ *
+ * A Delete of all rows of an immutable chunk locks and invalidates the chunk as a whole instead of row by row (see
+ * chunk_tid and chunk_end_cid). The accessors take this into account as well.
  */
 struct MvccData {
   friend class Chunk;
@@ -22,10 +32,47 @@ struct MvccData {
   pmr_concurrent_vector<CommitID> begin_cids;                  ///< commit id when record was added
   pmr_concurrent_vector<CommitID> end_cids;                    ///< commit id when record was deleted
 
+  // Conservative summaries of the MVCC data, which allow Validate to skip chunks in which all rows are visible (see
+  // Validate::is_entire_chunk_visible()).
+  // The highest begin_cid of all rows. It is only determined once the chunk becomes immutable, up to then it is
+  // MAX_COMMIT_ID.
+  std::atomic<CommitID> max_begin_cid{MAX_COMMIT_ID};
+  // Set as soon as a row gets locked by a Delete or invalidated by a rolled back Insert. Never reset.
+  std::atomic_bool has_invalidated_rows{false};
+
+  // Lock and end commit id of the chunk as a whole, which take precedence over those of the rows. A transaction that
+  // locks rows checks chunk_tid after setting their tids, while a transaction that locks the chunk checks the rows
+  // after setting chunk_tid, so that at least one of two conflicting transactions notices the other. Like the row
+  // locks, the chunk lock is kept after the commit. Once chunk_end_cid is visible to all transactions, the chunk can be
+  // removed.
+  std::atomic<TransactionID> chunk_tid{0};
+  std::atomic<CommitID> chunk_end_cid{MAX_COMMIT_ID};
+
   explicit MvccData(const size_t size);
 
   size_t size() const;
 
+  // Returns chunk_tid if the chunk is locked as a whole, the tid of the row otherwise
+  TransactionID get_tid(const ChunkOffset offset) const;
+
+  CommitID get_begin_cid(const ChunkOffset offset) const;
+  void set_begin_cid(const ChunkOffset offset, const CommitID begin_cid);
+
+  CommitID get_end_cid(const ChunkOffset offset) const;
+  void set_end_cid(const ChunkOffset offset, const CommitID end_cid);
+
+  /**
+   * Switches to the compact representation, using begin_cid for every row. This is only correct if all rows were
+   * committed and begin_cid is at most the snapshot of any active transaction, so that no transaction can tell the
+   * difference. Rows cannot be added to frozen MvccData anymore.
+   * Locks the MVCC data exclusively, so the calling thread must not hold a scoped lock on it.
+   */
+  void freeze(const CommitID begin_cid);
+
+  bool is_frozen() const;
+
+  size_t estimate_memory_usage() const;
+
   /**
    * Compacts the internal representation of
    * the mvcc data in order to reduce fragmentation
@@ -53,6 +100,11 @@ struct MvccData {
   std::shared_mutex _mutex;
 
   size_t _size{0};
+
+  // Compact representation of frozen MvccData. Rows are deleted concurrently, hence the concurrent map.
+  std::atomic_bool _is_frozen{false};
+  CommitID _frozen_begin_cid{0};
+  tbb::concurrent_unordered_map<ChunkOffset, CommitID> _frozen_end_cids;
 };
 
 }  // namespace opossum
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
+
+namespace opossum {
+
+/**
+ * NULL flags of a ValueSegment, stored as a bitmap of 64-bit words.
+ *
+ * Compared to one bool per row, this needs an eighth of the memory, and 64 rows can be checked at once via word().
+ * Like the values of a ValueSegment, the words are kept in a pmr_concurrent_vector, so that they are not moved when
+ * the segment grows while it is read. Bits are set with atomic operations on their words, because concurrent Inserts
+ * write neighbouring rows.
+ *
+ * all_valid() returns true as long as no bit has ever been set. Iterables and the ExpressionEvaluator use it to skip
+ * the NULL handling of nullable segments that do not contain NULLs.
+ */
+class NullValueVector {
+ public:
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  using Word = uint64_t;
+  using allocator_type = PolymorphicAllocator<copyable_atomic<Word>>;
+
+  // Proxy for an assignable bit, as in std::vector<bool>
+  class Reference {
+   public:
+    Reference(NullValueVector& null_values, const size_t index) : _null_values{null_values}, _index{index} {}
+
+    Reference& operator=(const bool value) {
+      _null_values.set(_index, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other) { return *this = static_cast<bool>(other); }
+
+    operator bool() const { return static_cast<const NullValueVector&>(_null_values)[_index]; }  // NOLINT
+
+   private:
+    NullValueVector& _null_values;
+    const size_t _index;
+  };
+
+  template <typename NullValueVectorType, typename ReferenceType>
+  class IteratorBase;
+
+  using iterator = IteratorBase<NullValueVector, Reference>;
+  using const_iterator = IteratorBase<const NullValueVector, bool>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using value_type = bool;
+  using reference = Reference;
+  using const_reference = bool;
+  using size_type = size_t;
+
+  NullValueVector() = default;
+  explicit NullValueVector(const allocator_type& alloc) : _words(alloc) {}
+  explicit NullValueVector(const size_t size, const bool value = false, const allocator_type& alloc = {})
+      : _words(_word_count(size), value ? ~Word{0} : Word{0}, alloc), _size{size}, _has_nulls{value && size > 0} {
+    _clear_unused_bits();
+  }
+  NullValueVector(std::initializer_list<bool> values, const allocator_type& alloc = {})
+      : NullValueVector(values.begin(), values.end(), alloc) {}
+
+  template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  NullValueVector(InputIt first, InputIt last, const allocator_type& alloc = {}) : _words(alloc) {
+    for (; first != last; ++first) push_back(static_cast<bool>(*first));
+  }
+
+  NullValueVector(const NullValueVector& other, const allocator_type& alloc)
+      : _words(other._words, alloc), _size{other.size()}, _has_nulls{other._has_nulls.load()} {}
+  NullValueVector(NullValueVector&& other, const allocator_type& alloc)
+      : _words(std::move(other._words), alloc), _size{other.size()}, _has_nulls{other._has_nulls.load()} {}
+
+  NullValueVector(const NullValueVector& other) = default;
+  NullValueVector(NullValueVector&& other) = default;
+  NullValueVector& operator=(const NullValueVector& other) = default;
+  NullValueVector& operator=(NullValueVector&& other) = default;
+
+  bool operator[](const size_t index) const {
+    return (_words[index / BITS_PER_WORD].load(std::memory_order_relaxed) >> (index % BITS_PER_WORD)) & Word{1};
+  }
+  Reference operator[](const size_t index) { return Reference{*this, index}; }
+
+  bool at(const size_t index) const {
+    Assert(index < size(), "NullValueVector index out of range");
+    return (*this)[index];
+  }
+
+  bool front() const { return (*this)[0]; }
+  bool back() const { return (*this)[size() - 1]; }
+
+  void set(const size_t index, const bool value) {
+    const auto mask = Word{1} << (index % BITS_PER_WORD);
+    auto& word = _words[index / BITS_PER_WORD];
+    if (value) {
+      word.fetch_or(mask, std::memory_order_relaxed);
+      _has_nulls = true;
+    } else {
+      word.fetch_and(~mask, std::memory_order_relaxed);
+    }
+  }
+
+  // The word that holds the bits of the rows [word_index * 64, word_index * 64 + 64)
+  Word word(const size_t word_index) const { return _words[word_index].load(std::memory_order_relaxed); }
+  size_t word_count() const { return _word_count(size()); }
+
+  // True if no row is NULL. Bits that were set and cleared again are not tracked, so a false result is not exact.
+  bool all_valid() const { return !_has_nulls.load(); }
+
+  size_t size() const { return _size.load(); }
+  bool empty() const { return size() == 0; }
+
+  void push_back(const bool value) {
+    const auto index = size();
+    if (index % BITS_PER_WORD == 0) _words.push_back(Word{0});
+    if (value) set(index, true);
+    _size = index + 1;
+  }
+
+  void reserve(const size_t capacity) { _words.reserve(_word_count(capacity)); }
+
+  // New rows are not NULL. Safe to call concurrently with readers and with other calls of grow_to_at_least().
+  void grow_to_at_least(const size_t size) {
+    _words.grow_to_at_least(_word_count(size), Word{0});
+    auto current_size = _size.load();
+    while (current_size < size && !_size.compare_exchange_weak(current_size, size)) {
+    }
+  }
+
+  void resize(const size_t size) {
+    DebugAssert(size >= this->size(), "NullValueVector can only grow");
+    grow_to_at_least(size);
+  }
+
+  // Memory used by the words
+  size_t memory_usage() const { return _words.size() * sizeof(Word); }
+
+  const allocator_type& get_allocator() const { return _words.get_allocator(); }
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+  const_reverse_iterator crbegin() const;
+  const_reverse_iterator crend() const;
+
+ private:
+  static size_t _word_count(const size_t size) { return (size + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+  // Bits beyond size() have to be zero, so that grow_to_at_least() adds non-NULL rows
+  void _clear_unused_bits() {
+    if (_size.load() % BITS_PER_WORD == 0) return;
+    const auto used_bits = _size.load() % BITS_PER_WORD;
+    _words[_words.size() - 1].fetch_and((Word{1} << used_bits) - 1, std::memory_order_relaxed);
+  }
+
+  pmr_concurrent_vector<copyable_atomic<Word>> _words;
+  copyable_atomic<size_t> _size{0};
+  copyable_atomic<bool> _has_nulls{false};
+};
+
+// Random access iterator over the bits. Dereferencing the iterator of a non-const NullValueVector returns a Reference.
+template <typename NullValueVectorType, typename ReferenceType>
+class NullValueVector::IteratorBase {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using reference = ReferenceType;
+  using pointer = void;
+
+  IteratorBase() = default;
+  IteratorBase(NullValueVectorType* null_values, const size_t index) : _null_values{null_values}, _index{index} {}
+
+  ReferenceType operator*() const { return (*_null_values)[_index]; }
+  ReferenceType operator[](const difference_type offset) const { return (*_null_values)[_index + offset]; }
+
+  IteratorBase& operator++() {
+    ++_index;
+    return *this;
+  }
+  IteratorBase operator++(int) {
+    auto copy = *this;
+    ++_index;
+    return copy;
+  }
+  IteratorBase& operator--() {
+    --_index;
+    return *this;
+  }
+  IteratorBase operator--(int) {
+    auto copy = *this;
+    --_index;
+    return copy;
+  }
+  IteratorBase& operator+=(const difference_type offset) {
+    _index += offset;
+    return *this;
+  }
+  IteratorBase& operator-=(const difference_type offset) {
+    _index -= offset;
+    return *this;
+  }
+
+  friend IteratorBase operator+(IteratorBase iterator, const difference_type offset) { return iterator += offset; }
+  friend IteratorBase operator+(const difference_type offset, IteratorBase iterator) { return iterator += offset; }
+  friend IteratorBase operator-(IteratorBase iterator, const difference_type offset) { return iterator -= offset; }
+  friend difference_type operator-(const IteratorBase& lhs, const IteratorBase& rhs) {
+    return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+  }
+
+  friend bool operator==(const IteratorBase& lhs, const IteratorBase& rhs) { return lhs._index == rhs._index; }
+  friend bool operator!=(const IteratorBase& lhs, const IteratorBase& rhs) { return lhs._index != rhs._index; }
+  friend bool operator<(const IteratorBase& lhs, const IteratorBase& rhs) { return lhs._index < rhs._index; }
+  friend bool operator>(const IteratorBase& lhs, const IteratorBase& rhs) { return lhs._index > rhs._index; }
+  friend bool operator<=(const IteratorBase& lhs, const IteratorBase& rhs) { return lhs._index <= rhs._index; }
+  friend bool operator>=(const IteratorBase& lhs, const IteratorBase& rhs) { return lhs._index >= rhs._index; }
+
+ private:
+  NullValueVectorType* _null_values{nullptr};
+  size_t _index{0};
+};
+
+inline NullValueVector::iterator NullValueVector::begin() { return iterator{this, 0}; }
+inline NullValueVector::iterator NullValueVector::end() { return iterator{this, size()}; }
+inline NullValueVector::const_iterator NullValueVector::begin() const { return const_iterator{this, 0}; }
+inline NullValueVector::const_iterator NullValueVector::end() const { return const_iterator{this, size()}; }
+inline NullValueVector::const_iterator NullValueVector::cbegin() const { return begin(); }
+inline NullValueVector::const_iterator NullValueVector::cend() const { return end(); }
+inline NullValueVector::const_reverse_iterator NullValueVector::crbegin() const {
+  return const_reverse_iterator{cend()};
+}
+inline NullValueVector::const_reverse_iterator NullValueVector::crend() const {
+  return const_reverse_iterator{cbegin()};
+}
+
+inline bool operator==(const NullValueVector& lhs, const NullValueVector& rhs) {
+  return lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include "numa_placement.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <memory>
+#include <string>
+
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NodeID numa_node_for_chunk(const NUMAPlacementPolicy policy, const std::string& table_name, const ChunkID chunk_id,
+                           const size_t node_count) {
+  DebugAssert(node_count > 0, "Expected at least one node");
+
+  auto hash = std::hash<std::string>{}(table_name);
+  switch (policy) {
+    case NUMAPlacementPolicy::RoundRobin:
+      return NodeID{static_cast<NodeID::base_type>((hash + chunk_id) % node_count)};
+    case NUMAPlacementPolicy::Hash:
+      boost::hash_combine(hash, static_cast<ChunkID::base_type>(chunk_id));
+      return NodeID{static_cast<NodeID::base_type>(hash % node_count)};
+  }
+  Fail("Unknown NUMAPlacementPolicy");
+}
+
+void place_chunks_on_numa_nodes(Table& table, const std::string& table_name, const NUMAPlacementPolicy policy) {
+  auto& topology = Topology::get();
+  const auto node_count = topology.nodes().size();
+  if (node_count < 2) return;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->has_indices()) continue;
+
+    const auto node_id = numa_node_for_chunk(policy, table_name, chunk_id, node_count);
+    if (chunk->numa_node_id() == node_id) continue;
+
+#if HYRISE_NUMA_SUPPORT
+    chunk->migrate(topology.get_memory_resource(static_cast<int>(node_id)));
+#endif
+
+    chunk->set_numa_node_id(node_id);
+  }
+}
+
+NodeID preferred_node_for_chunk(const Table& table, const ChunkID chunk_id) {
+  auto chunk = table.get_chunk(chunk_id);
+  if (!chunk) return CURRENT_NODE_ID;
+
+  if (table.type() == TableType::References && chunk->column_count() > 0) {
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    const auto& pos_list = *reference_segment->pos_list();
+    if (!pos_list.references_single_chunk() || pos_list.empty()) return CURRENT_NODE_ID;
+
+    chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+    if (!chunk) return CURRENT_NODE_ID;
+  }
+
+  // The Topology might have been changed since the chunk was placed
+  const auto node_id = chunk->numa_node_id();
+  if (node_id == INVALID_NODE_ID || static_cast<size_t>(node_id) >= Topology::get().nodes().size()) {
+    return CURRENT_NODE_ID;
+  }
+
+  return node_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class NUMAPlacementPolicy {
+  // Consecutive chunks are placed on consecutive nodes. The first chunk of a table is placed on a node derived from the
+  // table name, so that the first chunks of small tables are not all placed on the same node.
+  RoundRobin,
+  // Each chunk is placed on a node derived from the table name and the chunk id. Other than for RoundRobin, runs of
+  // chunks might end up on the same node, but the node of a chunk does not depend on the number of chunks before it.
+  Hash
+};
+
+/**
+ * Returns the node a chunk is placed on, given the number of NUMA nodes
+ */
+NodeID numa_node_for_chunk(const NUMAPlacementPolicy policy, const std::string& table_name, const ChunkID chunk_id,
+                           const size_t node_count);
+
+/**
+ * Distributes the chunks of a table over the nodes of the current Topology and records the node on each chunk. With
+ * NUMA support, the chunks are also migrated to the memory of their node. Chunks with indices are skipped, as
+ * Chunk::migrate() does not support them.
+ * Must not be called while the table is accessed concurrently.
+ */
+void place_chunks_on_numa_nodes(Table& table, const std::string& table_name, const NUMAPlacementPolicy policy);
+
+/**
+ * Returns the node on which jobs that process the given chunk should be scheduled: the node of the chunk or, if the
+ * chunk references a single chunk of another table, the node of that chunk. Returns CURRENT_NODE_ID if the chunk was
+ * not placed on a node of the current Topology.
+ */
+NodeID preferred_node_for_chunk(const Table& table, const ChunkID chunk_id);
+
+}  // namespace opossum
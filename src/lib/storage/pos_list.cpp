@@ -0,0 +1,150 @@
+#include "pos_list.hpp"
+
+namespace opossum {
+
+PosList PosList::chunk_range(const ChunkID chunk_id, const ChunkOffset range_begin, const ChunkOffset range_end,
+                             const allocator_type& alloc) {
+  DebugAssert(range_begin <= range_end, "Invalid ChunkOffset range");
+  auto pos_list = PosList{alloc};
+  pos_list._representation = PosListRepresentation::ChunkRange;
+  pos_list._common_chunk_id = chunk_id;
+  pos_list._range_begin = range_begin;
+  pos_list._range_end = range_end;
+  pos_list.guarantee_single_chunk();
+  return pos_list;
+}
+
+PosList PosList::chunk_offsets(const ChunkID chunk_id, pmr_vector<ChunkOffset>&& chunk_offsets) {
+  auto pos_list = PosList{chunk_offsets.get_allocator()};
+  pos_list._representation = PosListRepresentation::ChunkOffsets;
+  pos_list._common_chunk_id = chunk_id;
+  pos_list._chunk_offsets = std::move(chunk_offsets);
+  pos_list.guarantee_single_chunk();
+  return pos_list;
+}
+
+bool PosList::shrink_to_compact_representation() {
+  if (_representation != PosListRepresentation::RowIDs || !_references_single_chunk || Vector::empty()) return false;
+
+  const auto& row_ids = static_cast<const Vector&>(*this);
+  const auto chunk_id = row_ids.front().chunk_id;
+  if (row_ids.front().is_null()) return false;
+
+  for (auto index = size_t{1}; index < row_ids.size(); ++index) {
+    if (row_ids[index].chunk_offset <= row_ids[index - 1].chunk_offset) return false;
+  }
+
+  const auto first_offset = row_ids.front().chunk_offset;
+  const auto last_offset = row_ids.back().chunk_offset;
+  const auto row_count = row_ids.size();
+  const auto alloc = get_allocator();
+
+  if (static_cast<size_t>(last_offset - first_offset) + 1 == row_count) {
+    *this = chunk_range(chunk_id, first_offset, last_offset + 1, alloc);
+    return true;
+  }
+
+  // A bitmap costs 12 bytes per 64 ChunkOffsets up to the last entry (word plus rank), a ChunkOffset list 4 bytes per
+  // entry. Pick the smaller one.
+  const auto word_count = static_cast<size_t>(last_offset) / 64 + 1;
+  if (word_count * (sizeof(uint64_t) + sizeof(uint32_t)) < row_count * sizeof(ChunkOffset)) {
+    auto bitmap_words = pmr_vector<uint64_t>(word_count, uint64_t{0}, alloc);
+    for (const auto& row_id : row_ids) {
+      bitmap_words[row_id.chunk_offset / 64] |= uint64_t{1} << (row_id.chunk_offset % 64);
+    }
+
+    auto bitmap_ranks = pmr_vector<uint32_t>(word_count, alloc);
+    auto rank = uint32_t{0};
+    for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+      bitmap_ranks[word_id] = rank;
+      rank += __builtin_popcountll(bitmap_words[word_id]);
+    }
+
+    auto pos_list = PosList{alloc};
+    pos_list._representation = PosListRepresentation::ChunkBitmap;
+    pos_list._common_chunk_id = chunk_id;
+    pos_list._bitmap_words = std::move(bitmap_words);
+    pos_list._bitmap_ranks = std::move(bitmap_ranks);
+    pos_list._bitmap_size = row_count;
+    pos_list.guarantee_single_chunk();
+    *this = std::move(pos_list);
+    return true;
+  }
+
+  auto offsets = pmr_vector<ChunkOffset>(alloc);
+  offsets.reserve(row_count);
+  for (const auto& row_id : row_ids) {
+    offsets.emplace_back(row_id.chunk_offset);
+  }
+  *this = chunk_offsets(chunk_id, std::move(offsets));
+  return true;
+}
+
+size_t PosList::memory_usage() const {
+  switch (_representation) {
+    case PosListRepresentation::RowIDs:
+      return Vector::size() * sizeof(RowID);
+    case PosListRepresentation::ChunkRange:
+      return 0;
+    case PosListRepresentation::ChunkBitmap:
+      return _bitmap_words.size() * sizeof(uint64_t) + _bitmap_ranks.size() * sizeof(uint32_t);
+    case PosListRepresentation::ChunkOffsets:
+      return _chunk_offsets.size() * sizeof(ChunkOffset);
+  }
+  Fail("Invalid PosListRepresentation");
+}
+
+void PosList::_materialize_compact() {
+  auto row_ids = Vector(get_allocator());
+  row_ids.reserve(size());
+  for_each_chunk_offset([&](const auto chunk_offset) { row_ids.emplace_back(_common_chunk_id, chunk_offset); });
+
+  static_cast<Vector&>(*this) = std::move(row_ids);
+  _representation = PosListRepresentation::RowIDs;
+  _bitmap_words = pmr_vector<uint64_t>{};
+  _bitmap_ranks = pmr_vector<uint32_t>{};
+  _bitmap_size = 0;
+  _chunk_offsets = pmr_vector<ChunkOffset>{};
+}
+
+RowID PosList::_compact_row_id(const size_type index) const {
+  switch (_representation) {
+    case PosListRepresentation::RowIDs:
+      return Vector::operator[](index);
+    case PosListRepresentation::ChunkRange:
+      return RowID{_common_chunk_id, static_cast<ChunkOffset>(_range_begin + index)};
+    case PosListRepresentation::ChunkBitmap:
+      return RowID{_common_chunk_id, _bitmap_select(index)};
+    case PosListRepresentation::ChunkOffsets:
+      return RowID{_common_chunk_id, _chunk_offsets[index]};
+  }
+  Fail("Invalid PosListRepresentation");
+}
+
+ChunkOffset PosList::_bitmap_select(const size_type index) const {
+  DebugAssert(index < _bitmap_size, "Bitmap index out of range");
+
+  // Find the last word whose rank is not larger than index, then the bit within that word
+  const auto rank_it = std::upper_bound(_bitmap_ranks.cbegin(), _bitmap_ranks.cend(), index) - 1;
+  const auto word_id = static_cast<size_t>(std::distance(_bitmap_ranks.cbegin(), rank_it));
+  auto word = _bitmap_words[word_id];
+  for (auto remaining = index - *rank_it; remaining > 0; --remaining) {
+    word &= word - 1;
+  }
+  return static_cast<ChunkOffset>(word_id * 64 + __builtin_ctzll(word));
+}
+
+ChunkOffset PosList::_bitmap_next(const ChunkOffset chunk_offset) const {
+  auto word_id = static_cast<size_t>(chunk_offset) / 64;
+  if (word_id >= _bitmap_words.size()) return static_cast<ChunkOffset>(_bitmap_words.size() * 64);
+
+  auto word = _bitmap_words[word_id] & (~uint64_t{0} << (chunk_offset % 64));
+  while (!word) {
+    ++word_id;
+    if (word_id == _bitmap_words.size()) return static_cast<ChunkOffset>(word_id * 64);
+    word = _bitmap_words[word_id];
+  }
+  return static_cast<ChunkOffset>(word_id * 64 + __builtin_ctzll(word));
+}
+
+}  // namespace opossum
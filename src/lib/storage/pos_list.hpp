@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -15,22 +17,37 @@ namespace opossum {
 // inheritance. By making the inheritance private and this class final, we can assure that the problems that come with
 // a non-virtual destructor do not occur.
 
+// Besides the plain vector of RowIDs, a PosList that references a single chunk can use a compact representation that
+// stores ChunkOffsets only (see PosListRepresentation). Such PosLists are built by the compact() factory methods or by
+// shrink_to_compact_representation(). Read access through the const interface works for all representations, and
+// hot loops (ReferenceSegmentIterable, SegmentAccessor, the joins) can switch on representation() to avoid building
+// RowIDs. The non-const interface turns a compact PosList back into a vector of RowIDs first.
+
+enum class PosListRepresentation {
+  RowIDs,        // A pmr_vector<RowID>, 8 bytes per entry
+  ChunkRange,    // All ChunkOffsets in [range_begin, range_end) of a single chunk, no per-entry memory
+  ChunkBitmap,   // One bit per ChunkOffset of a single chunk (plus a rank per 64 bits), ascending
+  ChunkOffsets,  // A pmr_vector<ChunkOffset> with a single ChunkID, 4 bytes per entry
+};
+
 struct PosList final : private pmr_vector<RowID> {
  public:
   using Vector = pmr_vector<RowID>;
 
+  class ConstIterator;
+
   using value_type = Vector::value_type;
   using allocator_type = Vector::allocator_type;
   using size_type = Vector::size_type;
   using difference_type = Vector::difference_type;
   using reference = Vector::reference;
-  using const_reference = Vector::const_reference;
+  using const_reference = RowID;
   using pointer = Vector::pointer;
   using const_pointer = Vector::const_pointer;
   using iterator = Vector::iterator;
-  using const_iterator = Vector::const_iterator;
+  using const_iterator = ConstIterator;
   using reverse_iterator = Vector::reverse_iterator;
-  using const_reverse_iterator = Vector::const_reverse_iterator;
+  using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
 
   /* (1 ) */ PosList() noexcept(noexcept(allocator_type())) {}
   /* (1 ) */ explicit PosList(const allocator_type& allocator) noexcept : Vector(allocator) {}
@@ -42,29 +59,41 @@ struct PosList final : private pmr_vector<RowID> {
       : Vector(std::move(first), std::move(last)) {}
   /* (5 ) */  // PosList(const Vector& other) : Vector(other); - Oh no, you don't.
   /* (5 ) */  // PosList(const Vector& other, const allocator_type& alloc) : Vector(other, alloc);
-  /* (6 ) */ PosList(PosList&& other) noexcept
-      : Vector(std::move(other)), _references_single_chunk{other._references_single_chunk} {}
+  /* (6 ) */ PosList(PosList&& other) noexcept = default;
   /* (6+) */ explicit PosList(Vector&& other) noexcept : Vector(std::move(other)) {}
   /* (7 ) */ PosList(PosList&& other, const allocator_type& alloc)
-      : Vector(std::move(other), alloc), _references_single_chunk{other._references_single_chunk} {}
+      : Vector(std::move(other), alloc),
+        _references_single_chunk{other._references_single_chunk},
+        _representation{other._representation},
+        _common_chunk_id{other._common_chunk_id},
+        _range_begin{other._range_begin},
+        _range_end{other._range_end},
+        _bitmap_words{std::move(other._bitmap_words), alloc},
+        _bitmap_ranks{std::move(other._bitmap_ranks), alloc},
+        _chunk_offsets{std::move(other._chunk_offsets), alloc} {}
   /* (7+) */ PosList(Vector&& other, const allocator_type& alloc) : Vector(std::move(other), alloc) {}
   /* (8 ) */ PosList(std::initializer_list<RowID> init, const allocator_type& alloc = allocator_type())
       : Vector(std::move(init), alloc) {}
 
   PosList& operator=(PosList&& other) = default;
 
+  // Factory methods for the compact representations. All of them reference a single chunk.
+  static PosList chunk_range(const ChunkID chunk_id, const ChunkOffset range_begin, const ChunkOffset range_end,
+                             const allocator_type& alloc = allocator_type());
+  static PosList chunk_offsets(const ChunkID chunk_id, pmr_vector<ChunkOffset>&& chunk_offsets);
+
   // If all entries in the PosList shares a single ChunkID, it makes sense to explicitly give this guarantee in order
   // to enable some optimizations.
   void guarantee_single_chunk() { _references_single_chunk = true; }
 
   // Returns whether the single ChunkID has been given (not necessarily, if it has been met)
   bool references_single_chunk() const {
-    if (_references_single_chunk) {
+    if (_references_single_chunk && _representation == PosListRepresentation::RowIDs) {
       DebugAssert(
           [&]() {
-            if (size() == 0) return true;
-            const auto& common_chunk_id = (*this)[0].chunk_id;
-            return std::all_of(cbegin(), cend(),
+            if (Vector::empty()) return true;
+            const auto& common_chunk_id = Vector::front().chunk_id;
+            return std::all_of(Vector::cbegin(), Vector::cend(),
                                [&](const auto& row_id) { return row_id.chunk_id == common_chunk_id; });
           }(),
           "Chunk was marked as referencing only a single chunk, but references more");
@@ -77,66 +106,342 @@ struct PosList final : private pmr_vector<RowID> {
     DebugAssert(references_single_chunk(),
                 "Can only retrieve the common_chunk_id if the PosList is guaranteed to reference a single chunk.");
     Assert(!empty(), "Cannot retrieve common_chunk_id of an empty chunk");
-    return (*this)[0].chunk_id;
+    if (_representation != PosListRepresentation::RowIDs) return _common_chunk_id;
+    return Vector::front().chunk_id;
+  }
+
+  PosListRepresentation representation() const { return _representation; }
+
+  // Access to the compact representations. Only valid if representation() matches.
+  ChunkOffset range_begin() const {
+    DebugAssert(_representation == PosListRepresentation::ChunkRange, "PosList is not a ChunkRange");
+    return _range_begin;
+  }
+  ChunkOffset range_end() const {
+    DebugAssert(_representation == PosListRepresentation::ChunkRange, "PosList is not a ChunkRange");
+    return _range_end;
+  }
+  const pmr_vector<uint64_t>& bitmap_words() const {
+    DebugAssert(_representation == PosListRepresentation::ChunkBitmap, "PosList is not a ChunkBitmap");
+    return _bitmap_words;
+  }
+  const pmr_vector<ChunkOffset>& chunk_offsets() const {
+    DebugAssert(_representation == PosListRepresentation::ChunkOffsets, "PosList is not a ChunkOffsets list");
+    return _chunk_offsets;
   }
 
-  using Vector::assign;
+  // Calls functor(chunk_offset) for each entry of a single-chunk PosList in order, without building RowIDs.
+  template <typename Functor>
+  void for_each_chunk_offset(const Functor& functor) const;
+
+  // Switches a PosList that references a single chunk in ascending order of ChunkOffsets without NULLs to the compact
+  // representation that uses the least memory. Other PosLists are left unchanged. Returns whether it was switched.
+  bool shrink_to_compact_representation();
+
+  // Bytes used by the entries, for the memory estimation of ReferenceSegments
+  size_t memory_usage() const;
+
   using Vector::get_allocator;
 
+  void assign(size_type count, const RowID& value) {
+    _materialize();
+    Vector::assign(count, value);
+  }
+
+  template <class InputIt>
+  void assign(InputIt first, InputIt last) {
+    _materialize();
+    Vector::assign(std::move(first), std::move(last));
+  }
+
   // Element access
   // using Vector::at; - Oh no. People have misused this in the past.
-  using Vector::operator[];
-  using Vector::back;
-  using Vector::data;
-  using Vector::front;
+  reference operator[](const size_type index) {
+    _materialize();
+    return Vector::operator[](index);
+  }
+  RowID operator[](const size_type index) const {
+    if (_representation == PosListRepresentation::RowIDs) return Vector::operator[](index);
+    return _compact_row_id(index);
+  }
+  reference front() { return (*this)[0]; }
+  RowID front() const { return (*this)[0]; }
+  reference back() { return (*this)[size() - 1]; }
+  RowID back() const { return (*this)[size() - 1]; }
+  pointer data() {
+    _materialize();
+    return Vector::data();
+  }
+  const_pointer data() const {
+    DebugAssert(_representation == PosListRepresentation::RowIDs, "Compact PosLists have no RowIDs");
+    return Vector::data();
+  }
 
   // Iterators
-  using Vector::begin;
-  using Vector::cbegin;
-  using Vector::cend;
-  using Vector::crbegin;
-  using Vector::crend;
-  using Vector::end;
-  using Vector::rbegin;
-  using Vector::rend;
+  iterator begin() {
+    _materialize();
+    return Vector::begin();
+  }
+  iterator end() {
+    _materialize();
+    return Vector::end();
+  }
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+  reverse_iterator rbegin() {
+    _materialize();
+    return Vector::rbegin();
+  }
+  reverse_iterator rend() {
+    _materialize();
+    return Vector::rend();
+  }
+  const_reverse_iterator rbegin() const;
+  const_reverse_iterator rend() const;
+  const_reverse_iterator crbegin() const;
+  const_reverse_iterator crend() const;
 
   // Capacity
+  size_type size() const {
+    switch (_representation) {
+      case PosListRepresentation::RowIDs:
+        return Vector::size();
+      case PosListRepresentation::ChunkRange:
+        return _range_end - _range_begin;
+      case PosListRepresentation::ChunkBitmap:
+        return _bitmap_size;
+      case PosListRepresentation::ChunkOffsets:
+        return _chunk_offsets.size();
+    }
+    Fail("Invalid PosListRepresentation");
+  }
+  bool empty() const { return size() == 0; }
   using Vector::capacity;
-  using Vector::empty;
   using Vector::max_size;
-  using Vector::reserve;
+  void reserve(const size_type new_capacity) {
+    _materialize();
+    Vector::reserve(new_capacity);
+  }
   using Vector::shrink_to_fit;
-  using Vector::size;
 
   // Modifiers
-  using Vector::clear;
-  using Vector::emplace;
-  using Vector::emplace_back;
-  using Vector::erase;
-  using Vector::insert;
-  using Vector::pop_back;
-  using Vector::push_back;
-  using Vector::resize;
-  using Vector::swap;
+  void clear() {
+    _materialize();
+    Vector::clear();
+  }
+  template <typename... Args>
+  iterator emplace(const Vector::const_iterator position, Args&&... args) {
+    _materialize();
+    return Vector::emplace(position, std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    _materialize();
+    return Vector::emplace_back(std::forward<Args>(args)...);
+  }
+  iterator erase(const Vector::const_iterator first, const Vector::const_iterator last) {
+    _materialize();
+    return Vector::erase(first, last);
+  }
+  iterator erase(const Vector::const_iterator position) {
+    _materialize();
+    return Vector::erase(position);
+  }
+  template <typename... Args>
+  iterator insert(const Vector::const_iterator position, Args&&... args) {
+    _materialize();
+    return Vector::insert(position, std::forward<Args>(args)...);
+  }
+  void pop_back() {
+    _materialize();
+    Vector::pop_back();
+  }
+  void push_back(const RowID& row_id) {
+    _materialize();
+    Vector::push_back(row_id);
+  }
+  void resize(const size_type count) {
+    _materialize();
+    Vector::resize(count);
+  }
+  void resize(const size_type count, const RowID& value) {
+    _materialize();
+    Vector::resize(count, value);
+  }
+  void swap(PosList& other) noexcept { std::swap(*this, other); }
 
   friend bool operator==(const PosList& lhs, const PosList& rhs);
   friend bool operator==(const PosList& lhs, const pmr_vector<RowID>& rhs);
   friend bool operator==(const pmr_vector<RowID>& lhs, const PosList& rhs);
 
  private:
+  // Turns a compact PosList back into a vector of RowIDs
+  void _materialize() {
+    if (_representation != PosListRepresentation::RowIDs) _materialize_compact();
+  }
+  void _materialize_compact();
+
+  RowID _compact_row_id(const size_type index) const;
+
+  // ChunkOffset of the index-th set bit of the bitmap
+  ChunkOffset _bitmap_select(const size_type index) const;
+
+  // ChunkOffset of the first set bit at or after chunk_offset, or the end of the bitmap
+  ChunkOffset _bitmap_next(const ChunkOffset chunk_offset) const;
+
   bool _references_single_chunk = false;
+
+  PosListRepresentation _representation = PosListRepresentation::RowIDs;
+  ChunkID _common_chunk_id{INVALID_CHUNK_ID};
+  ChunkOffset _range_begin{0};
+  ChunkOffset _range_end{0};
+  // Bit i of _bitmap_words stands for ChunkOffset i. _bitmap_ranks[w] is the number of set bits in the words before w.
+  pmr_vector<uint64_t> _bitmap_words;
+  pmr_vector<uint32_t> _bitmap_ranks;
+  size_type _bitmap_size{0};
+  pmr_vector<ChunkOffset> _chunk_offsets;
 };
 
+// Random access iterator over the RowIDs of a const PosList of any representation. It returns RowIDs by value. For
+// bitmaps, it keeps the current ChunkOffset so that sequential iteration does not need to search the bitmap.
+class PosList::ConstIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = RowID;
+  using difference_type = std::ptrdiff_t;
+  using reference = RowID;
+
+  // Allows it->chunk_offset although dereferencing returns a value
+  struct pointer {
+    RowID row_id;
+    const RowID* operator->() const { return &row_id; }
+  };
+
+  ConstIterator() = default;
+
+  ConstIterator(const PosList* pos_list, const size_type index) : _pos_list{pos_list}, _index{index} {
+    _update_bitmap_offset();
+  }
+
+  RowID operator*() const {
+    switch (_pos_list->_representation) {
+      case PosListRepresentation::RowIDs:
+        return _pos_list->Vector::operator[](_index);
+      case PosListRepresentation::ChunkRange:
+        return RowID{_pos_list->_common_chunk_id, static_cast<ChunkOffset>(_pos_list->_range_begin + _index)};
+      case PosListRepresentation::ChunkBitmap:
+        return RowID{_pos_list->_common_chunk_id, _bitmap_offset};
+      case PosListRepresentation::ChunkOffsets:
+        return RowID{_pos_list->_common_chunk_id, _pos_list->_chunk_offsets[_index]};
+    }
+    Fail("Invalid PosListRepresentation");
+  }
+
+  pointer operator->() const { return pointer{**this}; }
+
+  RowID operator[](const difference_type offset) const { return *(*this + offset); }
+
+  ConstIterator& operator++() {
+    ++_index;
+    if (_pos_list->_representation == PosListRepresentation::ChunkBitmap && _index < _pos_list->_bitmap_size) {
+      _bitmap_offset = _pos_list->_bitmap_next(_bitmap_offset + 1);
+    }
+    return *this;
+  }
+
+  ConstIterator operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  ConstIterator& operator--() { return *this -= 1; }
+
+  ConstIterator operator--(int) {
+    auto copy = *this;
+    --*this;
+    return copy;
+  }
+
+  ConstIterator& operator+=(const difference_type offset) {
+    _index += offset;
+    _update_bitmap_offset();
+    return *this;
+  }
+
+  ConstIterator& operator-=(const difference_type offset) { return *this += -offset; }
+
+  friend ConstIterator operator+(ConstIterator iterator, const difference_type offset) { return iterator += offset; }
+  friend ConstIterator operator+(const difference_type offset, ConstIterator iterator) { return iterator += offset; }
+  friend ConstIterator operator-(ConstIterator iterator, const difference_type offset) { return iterator -= offset; }
+
+  friend difference_type operator-(const ConstIterator& lhs, const ConstIterator& rhs) {
+    return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+  }
+
+  friend bool operator==(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs._index == rhs._index; }
+  friend bool operator!=(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs._index != rhs._index; }
+  friend bool operator<(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs._index < rhs._index; }
+  friend bool operator>(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs._index > rhs._index; }
+  friend bool operator<=(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs._index <= rhs._index; }
+  friend bool operator>=(const ConstIterator& lhs, const ConstIterator& rhs) { return lhs._index >= rhs._index; }
+
+ private:
+  void _update_bitmap_offset() {
+    if (_pos_list->_representation == PosListRepresentation::ChunkBitmap && _index < _pos_list->_bitmap_size) {
+      _bitmap_offset = _pos_list->_bitmap_select(_index);
+    }
+  }
+
+  const PosList* _pos_list{nullptr};
+  size_type _index{0};
+  ChunkOffset _bitmap_offset{0};
+};
+
+inline PosList::const_iterator PosList::begin() const { return ConstIterator{this, 0}; }
+inline PosList::const_iterator PosList::end() const { return ConstIterator{this, size()}; }
+inline PosList::const_iterator PosList::cbegin() const { return begin(); }
+inline PosList::const_iterator PosList::cend() const { return end(); }
+inline PosList::const_reverse_iterator PosList::rbegin() const { return const_reverse_iterator{end()}; }
+inline PosList::const_reverse_iterator PosList::rend() const { return const_reverse_iterator{begin()}; }
+inline PosList::const_reverse_iterator PosList::crbegin() const { return rbegin(); }
+inline PosList::const_reverse_iterator PosList::crend() const { return rend(); }
+
+template <typename Functor>
+void PosList::for_each_chunk_offset(const Functor& functor) const {
+  DebugAssert(references_single_chunk(), "for_each_chunk_offset() requires a PosList that references a single chunk");
+  switch (_representation) {
+    case PosListRepresentation::RowIDs:
+      for (const auto& row_id : static_cast<const Vector&>(*this)) functor(row_id.chunk_offset);
+      return;
+    case PosListRepresentation::ChunkRange:
+      for (auto chunk_offset = _range_begin; chunk_offset < _range_end; ++chunk_offset) functor(chunk_offset);
+      return;
+    case PosListRepresentation::ChunkBitmap:
+      for (auto word_id = size_t{0}; word_id < _bitmap_words.size(); ++word_id) {
+        auto word = _bitmap_words[word_id];
+        while (word) {
+          functor(static_cast<ChunkOffset>(word_id * 64 + __builtin_ctzll(word)));
+          word &= word - 1;
+        }
+      }
+      return;
+    case PosListRepresentation::ChunkOffsets:
+      for (const auto chunk_offset : _chunk_offsets) functor(chunk_offset);
+      return;
+  }
+}
+
 inline bool operator==(const PosList& lhs, const PosList& rhs) {
-  return static_cast<const pmr_vector<RowID>&>(lhs) == static_cast<const pmr_vector<RowID>&>(rhs);
+  return lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
 inline bool operator==(const PosList& lhs, const pmr_vector<RowID>& rhs) {
-  return static_cast<const pmr_vector<RowID>&>(lhs) == rhs;
+  return lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
-inline bool operator==(const pmr_vector<RowID>& lhs, const PosList& rhs) {
-  return lhs == static_cast<const pmr_vector<RowID>&>(rhs);
-}
+inline bool operator==(const pmr_vector<RowID>& lhs, const PosList& rhs) { return rhs == lhs; }
 
 }  // namespace opossum
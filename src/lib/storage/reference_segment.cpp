@@ -52,7 +52,7 @@ std::shared_ptr<BaseSegment> ReferenceSegment::copy_using_allocator(const Polymo
 }
 
 size_t ReferenceSegment::estimate_memory_usage() const {
-  return sizeof(*this) + _pos_list->size() * sizeof(decltype(_pos_list)::element_type::value_type);
+  return sizeof(*this) + _pos_list->memory_usage();
 }
 
 }  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,7 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     // virtual method calls. If begin_it is NULL, chunk_id will be INVALID_CHUNK_ID. Therefore, we skip this case.
 
     if (pos_list.references_single_chunk() && pos_list.size() > 0 && !begin_it->is_null()) {
+      // The segment is kept alive in case the referenced chunk is evicted during the iteration
       auto referenced_segment = referenced_table->get_chunk(begin_it->chunk_id)->get_segment(referenced_column_id);
       resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_segment) {
         using SegmentType = std::decay_t<decltype(typed_segment)>;
@@ -40,6 +42,16 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
         if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
           auto accessor = std::make_shared<SegmentAccessor<T, SegmentType>>(typed_segment);
 
+          // A ChunkRange needs neither RowIDs nor a lookup per position
+          if (pos_list.representation() == PosListRepresentation::ChunkRange) {
+            auto begin = ChunkRangeIterator<SegmentAccessor<T, SegmentType>>{accessor, pos_list.range_begin(),
+                                                                             ChunkOffset{0}};
+            auto end = ChunkRangeIterator<SegmentAccessor<T, SegmentType>>{
+                accessor, pos_list.range_begin(), static_cast<ChunkOffset>(pos_list.size())};
+            functor(begin, end);
+            return;
+          }
+
           auto begin = SingleChunkIterator<SegmentAccessor<T, SegmentType>>{accessor, begin_it, begin_it};
           auto end = SingleChunkIterator<SegmentAccessor<T, SegmentType>>{accessor, begin_it, end_it};
 
@@ -49,12 +61,18 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
         }
       });
     } else {
-      using Accessors = std::vector<std::shared_ptr<BaseSegmentAccessor<T>>>;
-
-      auto accessors = std::make_shared<Accessors>(referenced_table->chunk_count());
-
-      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, begin_it};
-      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, end_it};
+      // The values are gathered up front, so that each run of positions that reference the same chunk costs a single
+      // virtual call into the accessor of that chunk (see MultipleChunkReferenceSegmentAccessor::gather) instead of
+      // two virtual calls per position.
+      auto gathered_values = std::make_shared<GatheredValues>(pos_list.size());
+      auto chunk_offsets = std::vector<ChunkOffset>(pos_list.size());
+      std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+      MultipleChunkReferenceSegmentAccessor<T>{_segment}.gather(chunk_offsets.data(), chunk_offsets.size(),
+                                                                 gathered_values->values.data(),
+                                                                 gathered_values->null_values.get());
+
+      auto begin = MultipleChunkIterator{gathered_values, ChunkOffset{0}};
+      auto end = MultipleChunkIterator{gathered_values, static_cast<ChunkOffset>(pos_list.size())};
 
       functor(begin, end);
     }
@@ -114,73 +132,91 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     std::shared_ptr<Accessor> _accessor;
   };
 
-  // The iterator for cases where we potentially iterate over multiple referenced chunks
-  class MultipleChunkIterator : public BaseSegmentIterator<MultipleChunkIterator, SegmentPosition<T>> {
+  // The iterator for PosLists that reference a contiguous range of a single chunk
+  template <typename Accessor>
+  class ChunkRangeIterator : public BaseSegmentIterator<ChunkRangeIterator<Accessor>, SegmentPosition<T>> {
    public:
     using ValueType = T;
     using IterableType = ReferenceSegmentIterable<T>;
-    using PosListIterator = PosList::const_iterator;
 
    public:
-    explicit MultipleChunkIterator(
-        const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
-        const std::shared_ptr<std::vector<std::shared_ptr<BaseSegmentAccessor<T>>>>& accessors,
-        const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
-        : _referenced_table{referenced_table},
-          _referenced_column_id{referenced_column_id},
-          _begin_pos_list_it{begin_pos_list_it},
-          _pos_list_it{pos_list_it},
-          _accessors{accessors} {}
+    explicit ChunkRangeIterator(const std::shared_ptr<Accessor>& accessor, const ChunkOffset range_begin,
+                                const ChunkOffset pos_list_offset)
+        : _accessor{accessor}, _range_begin{range_begin}, _pos_list_offset{pos_list_offset} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
+    void increment() { ++_pos_list_offset; }
 
-    void decrement() { --_pos_list_it; }
+    void decrement() { --_pos_list_offset; }
 
-    void advance(std::ptrdiff_t n) { _pos_list_it += n; }
+    void advance(std::ptrdiff_t n) { _pos_list_offset += n; }
 
-    bool equal(const MultipleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
+    bool equal(const ChunkRangeIterator& other) const { return _pos_list_offset == other._pos_list_offset; }
 
-    std::ptrdiff_t distance_to(const MultipleChunkIterator& other) const { return other._pos_list_it - _pos_list_it; }
+    std::ptrdiff_t distance_to(const ChunkRangeIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._pos_list_offset) - _pos_list_offset;
+    }
 
-    // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
     SegmentPosition<T> dereference() const {
-      const auto pos_list_offset = static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-
-      if (_pos_list_it->is_null()) return SegmentPosition<T>{T{}, true, pos_list_offset};
-
-      const auto chunk_id = _pos_list_it->chunk_id;
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
-
-      if (!(*_accessors)[chunk_id]) {
-        _create_accessor(chunk_id);
-      }
-      const auto typed_value = (*_accessors)[chunk_id]->access(chunk_offset);
+      const auto typed_value = _accessor->access(_range_begin + _pos_list_offset);
 
       if (typed_value) {
-        return SegmentPosition<T>{std::move(*typed_value), false, pos_list_offset};
+        return SegmentPosition<T>{std::move(*typed_value), false, _pos_list_offset};
       } else {
-        return SegmentPosition<T>{T{}, true, pos_list_offset};
+        return SegmentPosition<T>{T{}, true, _pos_list_offset};
       }
     }
 
-    void _create_accessor(const ChunkID chunk_id) const {
-      auto segment = _referenced_table->get_chunk(chunk_id)->get_segment(_referenced_column_id);
-      auto accessor = std::move(create_segment_accessor<T>(segment));
-      (*_accessors)[chunk_id] = std::move(accessor);
-    }
+   private:
+    std::shared_ptr<Accessor> _accessor;
+    ChunkOffset _range_begin;
+    ChunkOffset _pos_list_offset;
+  };
+
+  struct GatheredValues {
+    explicit GatheredValues(const size_t size) : values(size), null_values(std::make_unique<bool[]>(size)) {}
+
+    std::vector<T> values;
+    std::unique_ptr<bool[]> null_values;
+  };
+
+  // The iterator for cases where we potentially iterate over multiple referenced chunks. It iterates over the values
+  // gathered in _on_with_iterators().
+  class MultipleChunkIterator : public BaseSegmentIterator<MultipleChunkIterator, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ReferenceSegmentIterable<T>;
+
+   public:
+    explicit MultipleChunkIterator(const std::shared_ptr<const GatheredValues>& gathered_values,
+                                   const ChunkOffset pos_list_offset)
+        : _gathered_values{gathered_values}, _pos_list_offset{pos_list_offset} {}
 
    private:
-    std::shared_ptr<const Table> _referenced_table;
-    ColumnID _referenced_column_id;
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    PosListIterator _begin_pos_list_it;
-    PosListIterator _pos_list_it;
+    void increment() { ++_pos_list_offset; }
+
+    void decrement() { --_pos_list_offset; }
 
-    // PointAccessIterators share vector with one Accessor per Chunk
-    std::shared_ptr<std::vector<std::shared_ptr<BaseSegmentAccessor<T>>>> _accessors;
+    void advance(std::ptrdiff_t n) { _pos_list_offset += n; }
+
+    bool equal(const MultipleChunkIterator& other) const { return _pos_list_offset == other._pos_list_offset; }
+
+    std::ptrdiff_t distance_to(const MultipleChunkIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._pos_list_offset) - _pos_list_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      if (_gathered_values->null_values[_pos_list_offset]) return SegmentPosition<T>{T{}, true, _pos_list_offset};
+      return SegmentPosition<T>{_gathered_values->values[_pos_list_offset], false, _pos_list_offset};
+    }
+
+   private:
+    std::shared_ptr<const GatheredValues> _gathered_values;
+    ChunkOffset _pos_list_offset;
   };
 };
 
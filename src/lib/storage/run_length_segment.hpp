@@ -36,6 +36,24 @@ class RunLengthSegment : public BaseEncodedSegment {
   std::shared_ptr<const pmr_vector<bool>> null_values() const;
   std::shared_ptr<const pmr_vector<ChunkOffset>> end_positions() const;
 
+  /**
+   * Calls functor(value, is_null, begin, end) for each run, where [begin, end) are the chunk offsets of the run, so
+   * that scans and aggregates can process whole runs instead of single rows
+   */
+  template <typename Functor>
+  void for_each_run(const Functor& functor) const {
+    const auto& values = *_values;
+    const auto& null_values = *_null_values;
+    const auto& end_positions = *_end_positions;
+
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+      functor(values[run_index], static_cast<bool>(null_values[run_index]), run_begin, run_end);
+      run_begin = run_end;
+    }
+  }
+
   /**
    * @defgroup BaseSegment interface
    * @{
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "memory/huge_page_memory_resource.hpp"
 #include "storage/base_segment_encoder.hpp"
 
 #include "storage/run_length_segment.hpp"
@@ -19,7 +20,7 @@ class RunLengthEncoder : public SegmentEncoder<RunLengthEncoder> {
 
   template <typename T>
   std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
-    const auto alloc = value_segment->values().get_allocator();
+    const auto alloc = with_huge_pages(value_segment->values().get_allocator());
 
     auto values = pmr_vector<T>{alloc};
     auto null_values = pmr_vector<bool>{alloc};
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 #include "resolve_type.hpp"
 #include "storage/base_segment_accessor.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -19,19 +27,140 @@ namespace detail {
 template <typename T>
 class CreateSegmentAccessor {
  public:
-  static std::unique_ptr<BaseSegmentAccessor<T>> create(const std::shared_ptr<const BaseSegment>& segment);
+  static std::unique_ptr<BaseSegmentAccessor<T>> create(const BaseSegment& segment);
 };
 
+/**
+ * Implementations of BaseSegmentAccessor::gather() for SegmentAccessor. The generic one calls the segment's
+ * non-virtual get_typed_value() for each offset. The encoding-specific ones resolve the type of the compressed vector
+ * only once and decode it with a typed decompressor, which, for SimdBp128, decodes each block only once when the
+ * offsets are ascending.
+ */
+template <typename T, typename SegmentType>
+void gather_segment_values(const SegmentType& segment, const ChunkOffset* chunk_offsets, const size_t count,
+                           T* values, bool* null_values) {
+  for (auto index = size_t{0}; index < count; ++index) {
+    auto value = segment.get_typed_value(chunk_offsets[index]);
+    null_values[index] = !value;
+    if (value) values[index] = std::move(*value);
+  }
+}
+
+template <typename T>
+void gather_segment_values(const DictionarySegment<T>& segment, const ChunkOffset* chunk_offsets, const size_t count,
+                           T* values, bool* null_values) {
+  const auto& dictionary = *segment.dictionary();
+  const auto null_value_id = static_cast<uint32_t>(segment.null_value_id());
+
+  resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    auto decompressor = attribute_vector.create_decompressor();
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto value_id = decompressor->get(chunk_offsets[index]);
+      null_values[index] = value_id == null_value_id;
+      if (value_id != null_value_id) values[index] = dictionary[value_id];
+    }
+  });
+}
+
+template <typename T>
+void gather_segment_values(const FrameOfReferenceSegment<T>& segment, const ChunkOffset* chunk_offsets,
+                           const size_t count, T* values, bool* null_values) {
+  const auto& block_minima = segment.block_minima();
+  const auto& segment_null_values = segment.null_values();
+
+  resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+    auto decompressor = offset_values.create_decompressor();
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto chunk_offset = chunk_offsets[index];
+      null_values[index] = segment_null_values[chunk_offset];
+      values[index] = static_cast<T>(decompressor->get(chunk_offset)) +
+                      block_minima[chunk_offset / FrameOfReferenceSegment<T>::block_size];
+    }
+  });
+}
+
+// Instead of binary-searching each offset, the run of the previous offset is reused if it contains the current one.
+// Otherwise, only the runs after (or before) it are searched, so that ascending offsets are found in passing.
+template <typename T>
+void gather_segment_values(const RunLengthSegment<T>& segment, const ChunkOffset* chunk_offsets, const size_t count,
+                           T* values, bool* null_values) {
+  const auto& run_values = *segment.values();
+  const auto& run_null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+  if (end_positions.empty()) return;
+
+  auto run_it = end_positions.cbegin();
+  for (auto index = size_t{0}; index < count; ++index) {
+    const auto chunk_offset = chunk_offsets[index];
+    if (*run_it < chunk_offset) {
+      run_it = std::lower_bound(run_it, end_positions.cend(), chunk_offset);
+    } else if (run_it != end_positions.cbegin() && *(run_it - 1) >= chunk_offset) {
+      run_it = std::lower_bound(end_positions.cbegin(), run_it, chunk_offset);
+    }
+
+    const auto run_index = std::distance(end_positions.cbegin(), run_it);
+
+    null_values[index] = run_null_values[run_index];
+    values[index] = run_values[run_index];
+  }
+}
+
+/**
+ * Implementations of BaseSegmentAccessor::prefetch() for SegmentAccessor. Values can only be prefetched if their
+ * address follows from the chunk offset, i.e., the values of ValueSegments and the entries of attribute or offset
+ * vectors with fixed-size byte-aligned compression. For the other segments and vector compressions, nothing is done.
+ */
+template <typename SegmentType>
+void prefetch_segment_value(const SegmentType& segment, const ChunkOffset chunk_offset) {}
+
+inline void prefetch_compressed_vector_entry(const BaseCompressedVector& vector, const ChunkOffset chunk_offset) {
+  switch (vector.type()) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      __builtin_prefetch(&static_cast<const FixedSizeByteAlignedVector<uint32_t>&>(vector).data()[chunk_offset]);
+      break;
+    case CompressedVectorType::FixedSize2ByteAligned:
+      __builtin_prefetch(&static_cast<const FixedSizeByteAlignedVector<uint16_t>&>(vector).data()[chunk_offset]);
+      break;
+    case CompressedVectorType::FixedSize1ByteAligned:
+      __builtin_prefetch(&static_cast<const FixedSizeByteAlignedVector<uint8_t>&>(vector).data()[chunk_offset]);
+      break;
+    default:
+      break;
+  }
+}
+
+template <typename T>
+void prefetch_segment_value(const ValueSegment<T>& segment, const ChunkOffset chunk_offset) {
+  __builtin_prefetch(&segment.values()[chunk_offset]);
+}
+
+// The dictionary entry depends on the prefetched ValueID, so only the attribute vector is prefetched
+template <typename T>
+void prefetch_segment_value(const DictionarySegment<T>& segment, const ChunkOffset chunk_offset) {
+  prefetch_compressed_vector_entry(*segment.attribute_vector(), chunk_offset);
+}
+
+template <typename T>
+void prefetch_segment_value(const FrameOfReferenceSegment<T>& segment, const ChunkOffset chunk_offset) {
+  prefetch_compressed_vector_entry(segment.offset_values(), chunk_offset);
+}
+
 }  // namespace detail
 
 /**
- * Utility method to create a SegmentAccessor for a given BaseSegment.
+ * Utility method to create a SegmentAccessor for a given BaseSegment. The accessor references the segment without
+ * owning it, so the caller has to keep the segment alive.
  */
 template <typename T>
-std::unique_ptr<BaseSegmentAccessor<T>> create_segment_accessor(const std::shared_ptr<const BaseSegment>& segment) {
+std::unique_ptr<BaseSegmentAccessor<T>> create_segment_accessor(const BaseSegment& segment) {
   return opossum::detail::CreateSegmentAccessor<T>::create(segment);
 }
 
+template <typename T>
+std::unique_ptr<BaseSegmentAccessor<T>> create_segment_accessor(const std::shared_ptr<const BaseSegment>& segment) {
+  return create_segment_accessor<T>(*segment);
+}
+
 /**
  * A SegmentAccessor is templated per SegmentType and DataType (T).
  * It requires that the underlying segment implements an implicit interface:
@@ -46,16 +175,51 @@ class SegmentAccessor : public BaseSegmentAccessor<T> {
 
   const std::optional<T> access(ChunkOffset offset) const final { return _segment.get_typed_value(offset); }
 
+  void gather(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    opossum::detail::gather_segment_values(_segment, chunk_offsets, count, values, null_values);
+  }
+
+  void prefetch(const ChunkOffset offset) const final { opossum::detail::prefetch_segment_value(_segment, offset); }
+
  protected:
   const SegmentType& _segment;
 };
 
+/**
+ * LZ4Segments decompress the block that contains the accessed value. The accessor keeps the last decompressed block,
+ * so that consecutive accesses to the same block decompress it only once.
+ */
+template <typename T>
+class SegmentAccessor<T, LZ4Segment<T>> : public BaseSegmentAccessor<T> {
+ public:
+  explicit SegmentAccessor(const LZ4Segment<T>& segment) : BaseSegmentAccessor<T>{}, _segment{segment} {}
+
+  const std::optional<T> access(ChunkOffset offset) const final {
+    if (_segment.null_values()[offset]) return std::nullopt;
+    return _segment.decompress(offset, _cached_block_index, _cached_block);
+  }
+
+  void gather(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    const auto& segment_null_values = _segment.null_values();
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto chunk_offset = chunk_offsets[index];
+      null_values[index] = segment_null_values[chunk_offset];
+      if (!null_values[index]) values[index] = _segment.decompress(chunk_offset, _cached_block_index, _cached_block);
+    }
+  }
+
+ protected:
+  const LZ4Segment<T>& _segment;
+  mutable std::optional<size_t> _cached_block_index;
+  mutable std::vector<char> _cached_block;
+};
+
 /**
  * For ReferenceSegments, we don't use the SegmentAccessor but either the MultipleChunkReferenceSegmentAccessor or the.
- * SingleChunkReferenceSegmentAccessor. The first one is generally applicable. For each offset that is accessed, a new
- * accessor has to be created. This is because we cannot be sure that two consecutive offsets reference the same chunk.
- * In the SingleChunkReferenceSegmentAccessor, we know that the same chunk is referenced, so we create the accessor
- * only once.
+ * SingleChunkReferenceSegmentAccessor. The first one is generally applicable. As we cannot be sure that two consecutive
+ * offsets reference the same chunk, it creates an accessor for each referenced chunk when that chunk is first
+ * accessed. In the SingleChunkReferenceSegmentAccessor, we know that the same chunk is referenced, so we create the
+ * accessor only once.
  */
 template <typename T>
 class MultipleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
@@ -66,18 +230,79 @@ class MultipleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
     const auto& referenced_row_id = (*_segment.pos_list())[offset];
     if (referenced_row_id.is_null()) return std::nullopt;
 
-    const auto& table = _segment.referenced_table();
-    const auto referenced_column_id = _segment.referenced_column_id();
-    const auto referenced_chunk_id = referenced_row_id.chunk_id;
-    const auto referenced_chunk_offset = referenced_row_id.chunk_offset;
+    return _accessor(referenced_row_id.chunk_id).access(referenced_row_id.chunk_offset);
+  }
+
+  // Consecutive offsets that reference the same chunk are gathered with a single call to that chunk's accessor.
+  //
+  // PosLists that reference the rows of many chunks in random order (e.g., the output of JoinHash) end a run at almost
+  // every offset. Then, each offset costs a cache miss on the referenced value, which can only be loaded once the
+  // RowID is known. Thus, the first values of the runs that begin up to PREFETCH_DISTANCE offsets after the current
+  // run are prefetched. The values within runs are left to the accessors of the referenced chunks.
+  void gather(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    const auto& pos_list = *_segment.pos_list();
+    _referenced_chunk_offsets.resize(count);
+
+    auto prefetch_index = size_t{1};
+    auto run_begin = size_t{0};
+    while (run_begin < count) {
+      const auto& first_row_id = pos_list[chunk_offsets[run_begin]];
+      if (first_row_id.is_null()) {
+        null_values[run_begin] = true;
+        ++run_begin;
+        continue;
+      }
+
+      // NULL RowIDs reference INVALID_CHUNK_ID and thus end the run
+      auto run_end = run_begin;
+      for (; run_end < count && pos_list[chunk_offsets[run_end]].chunk_id == first_row_id.chunk_id; ++run_end) {
+        _referenced_chunk_offsets[run_end - run_begin] = pos_list[chunk_offsets[run_end]].chunk_offset;
+      }
+
+      const auto prefetch_end = std::min(run_end + PREFETCH_DISTANCE, count);
+      for (prefetch_index = std::max(prefetch_index, run_end); prefetch_index < prefetch_end; ++prefetch_index) {
+        const auto& row_id = pos_list[chunk_offsets[prefetch_index]];
+        if (row_id.is_null() || row_id.chunk_id == pos_list[chunk_offsets[prefetch_index - 1]].chunk_id) continue;
+        _accessor(row_id.chunk_id).prefetch(row_id.chunk_offset);
+      }
 
-    const auto accessor =
-        create_segment_accessor<T>(table->get_chunk(referenced_chunk_id)->get_segment(referenced_column_id));
-    return accessor->access(referenced_chunk_offset);
+      _accessor(first_row_id.chunk_id)
+          .gather(_referenced_chunk_offsets.data(), run_end - run_begin, values + run_begin, null_values + run_begin);
+      run_begin = run_end;
+    }
   }
 
  protected:
+  const BaseSegmentAccessor<T>& _accessor(const ChunkID referenced_chunk_id) const {
+    if (static_cast<size_t>(referenced_chunk_id) >= _accessors.size()) {
+      _accessors.resize(referenced_chunk_id + 1);
+      _referenced_segments.resize(referenced_chunk_id + 1);
+    }
+
+    auto& accessor = _accessors[referenced_chunk_id];
+    if (!accessor) {
+      // The referenced chunk might be evicted while the accessor is used, so the segment is kept alive
+      auto& referenced_segment = _referenced_segments[referenced_chunk_id];
+      referenced_segment =
+          _segment.referenced_table()->get_chunk(referenced_chunk_id)->get_segment(_segment.referenced_column_id());
+      accessor = create_segment_accessor<T>(*referenced_segment);
+    }
+    return *accessor;
+  }
+
+  // Number of offsets after the current run in which the beginnings of runs are prefetched, see gather()
+  static constexpr auto PREFETCH_DISTANCE = size_t{16};
+
   const ReferenceSegment& _segment;
+
+  // Accessors of the referenced chunks, created on first access. Like the other accessors, this one is not meant to be
+  // used by multiple threads at the same time.
+  mutable std::vector<std::unique_ptr<BaseSegmentAccessor<T>>> _accessors;
+  // The segments referenced by the accessors, see _accessor()
+  mutable std::vector<std::shared_ptr<const BaseSegment>> _referenced_segments;
+
+  // Buffer for the chunk offsets of a run of offsets that reference the same chunk, see gather()
+  mutable std::vector<ChunkOffset> _referenced_chunk_offsets;
 };
 
 // Accessor for ReferenceSegments that reference single chunks - see comment above
@@ -90,16 +315,42 @@ class SingleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
         // If *_segment.pos_list()[ChunkOffset{0}] is NULL, its chunk_id is INVALID_CHUNK_OFFSET. When the
         // SingleChunkReferenceSegmentAccessor is used, all entries reference the same chunk_id (INVALID_CHUNK_OFFSET).
         // Therefore, we can safely assume that all other entries are also NULL and always return std::nullopt.
-        _accessor((*_segment.pos_list())[ChunkOffset{0}].is_null()
-                      ? std::make_unique<NullAccessor>()
-                      : create_segment_accessor<T>(segment.referenced_table()->get_chunk(_chunk_id)->get_segment(
-                            _segment.referenced_column_id()))) {}
+        _referenced_segment((*_segment.pos_list())[ChunkOffset{0}].is_null()
+                                ? nullptr
+                                : segment.referenced_table()->get_chunk(_chunk_id)->get_segment(
+                                      _segment.referenced_column_id())),
+        _accessor(_referenced_segment ? create_segment_accessor<T>(*_referenced_segment)
+                                      : std::make_unique<NullAccessor>()) {}
 
   const std::optional<T> access(ChunkOffset offset) const final {
     const auto referenced_chunk_offset = (*_segment.pos_list())[offset].chunk_offset;
     return _accessor->access(referenced_chunk_offset);
   }
 
+  void gather(const ChunkOffset* chunk_offsets, const size_t count, T* values, bool* null_values) const final {
+    const auto& pos_list = *_segment.pos_list();
+    _referenced_chunk_offsets.resize(count);
+    switch (pos_list.representation()) {
+      case PosListRepresentation::ChunkRange: {
+        const auto range_begin = pos_list.range_begin();
+        for (auto index = size_t{0}; index < count; ++index) {
+          _referenced_chunk_offsets[index] = range_begin + chunk_offsets[index];
+        }
+      } break;
+      case PosListRepresentation::ChunkOffsets: {
+        const auto& referenced_chunk_offsets = pos_list.chunk_offsets();
+        for (auto index = size_t{0}; index < count; ++index) {
+          _referenced_chunk_offsets[index] = referenced_chunk_offsets[chunk_offsets[index]];
+        }
+      } break;
+      default:
+        for (auto index = size_t{0}; index < count; ++index) {
+          _referenced_chunk_offsets[index] = pos_list[chunk_offsets[index]].chunk_offset;
+        }
+    }
+    _accessor->gather(_referenced_chunk_offsets.data(), count, values, null_values);
+  }
+
  protected:
   class NullAccessor : public BaseSegmentAccessor<T> {
     const std::optional<T> access(ChunkOffset offset) const final { return std::nullopt; }
@@ -107,7 +358,10 @@ class SingleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
 
   const ReferenceSegment& _segment;
   const ChunkID _chunk_id;
+  // Kept alive in case the referenced chunk is evicted while the accessor is used
+  const std::shared_ptr<const BaseSegment> _referenced_segment;
   const std::unique_ptr<BaseSegmentAccessor<T>> _accessor;
+  mutable std::vector<ChunkOffset> _referenced_chunk_offsets;
 };
 
 }  // namespace opossum
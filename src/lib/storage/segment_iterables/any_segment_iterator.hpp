@@ -1,11 +1,34 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "storage/segment_iterables/base_segment_iterators.hpp"
 
 namespace opossum {
 
+/**
+ * A block of consecutive segment positions, as filled by AnySegmentIterator::fill_block(). Consumers loop over the
+ * plain arrays, so that the virtual call of the type-erased iterator is amortized over up to SIZE positions.
+ */
+template <typename T>
+struct SegmentPositionBlock {
+  static constexpr auto SIZE = size_t{1'024};
+
+  SegmentPositionBlock() : values(SIZE) {}
+
+  SegmentPosition<T> position(const size_t index) const {
+    return {values[index], nulls[index], chunk_offsets[index]};
+  }
+
+  std::vector<T> values;
+  std::array<bool, SIZE> nulls{};
+  std::array<ChunkOffset, SIZE> chunk_offsets{};
+  size_t size{0};
+};
+
 namespace detail {
 
 /**
@@ -25,6 +48,9 @@ class AnySegmentIteratorWrapperBase {
   virtual std::ptrdiff_t distance_to(const AnySegmentIteratorWrapperBase<T>* other) const = 0;
   virtual SegmentPosition<T> dereference() const = 0;
 
+  // Copies the positions up to `end` (but at most SegmentPositionBlock::SIZE) into the block and advances past them
+  virtual void fill_block(SegmentPositionBlock<T>& block, const AnySegmentIteratorWrapperBase<T>* end) = 0;
+
   /**
    * Segment iterators need to be copyable so we need a way
    * to copy the iterator within the wrapper.
@@ -68,6 +94,19 @@ class AnySegmentIteratorWrapper : public AnySegmentIteratorWrapperBase<T> {
     return {value.value(), value.is_null(), value.chunk_offset()};
   }
 
+  void fill_block(SegmentPositionBlock<T>& block, const AnySegmentIteratorWrapperBase<T>* end) final {
+    const auto& end_iterator = static_cast<const AnySegmentIteratorWrapper<T, Iterator>*>(end)->_iterator;
+
+    auto size = size_t{0};
+    for (; size < SegmentPositionBlock<T>::SIZE && _iterator != end_iterator; ++size, ++_iterator) {
+      const auto position = *_iterator;
+      block.values[size] = position.value();
+      block.nulls[size] = position.is_null();
+      block.chunk_offsets[size] = position.chunk_offset();
+    }
+    block.size = size;
+  }
+
   std::unique_ptr<AnySegmentIteratorWrapperBase<T>> clone() const final {
     return std::make_unique<AnySegmentIteratorWrapper<T, Iterator>>(_iterator);
   }
@@ -95,6 +134,9 @@ class AnySegmentIterable;
  * AnySegmentIterator exists only to improve compile times and should
  * not be used outside of AnySegmentIterable.
  *
+ * Dereferencing an AnySegmentIterator and advancing it are virtual calls. Loops over many positions should use
+ * fill_block() instead, which costs one virtual call per SegmentPositionBlock.
+ *
  * For another example for type erasure see: https://en.wikibooks.org/wiki/More_C%2B%2B_Idioms/Type_Erasure
  */
 template <typename T>
@@ -125,6 +167,12 @@ class AnySegmentIterator : public BaseSegmentIterator<AnySegmentIterator<T>, Seg
     return *this;
   }
 
+  // Fills the block with the next positions before `end` and returns their number, which is zero once `end` is reached
+  size_t fill_block(SegmentPositionBlock<T>& block, const AnySegmentIterator& end) {
+    _wrapper->fill_block(block, end._wrapper.get());
+    return block.size;
+  }
+
  private:
   friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
@@ -146,4 +194,13 @@ class AnySegmentIterator : public BaseSegmentIterator<AnySegmentIterator<T>, Seg
   std::unique_ptr<opossum::detail::AnySegmentIteratorWrapperBase<T>> _wrapper;
 };
 
+template <typename T>
+struct is_any_segment_iterator : std::false_type {};
+
+template <typename T>
+struct is_any_segment_iterator<AnySegmentIterator<T>> : std::true_type {};
+
+template <typename IteratorT>
+constexpr auto is_any_segment_iterator_v = is_any_segment_iterator<IteratorT>::value;
+
 }  // namespace opossum
@@ -5,7 +5,11 @@
 #include <utility>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/export_binary.hpp"
 #include "operators/export_csv.hpp"
 #include "operators/table_wrapper.hpp"
 #include "scheduler/current_scheduler.hpp"
@@ -19,28 +23,48 @@ namespace opossum {
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
   Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
   Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
+  Assert(!is_meta_table_name(name), "Cannot add table " + name + " - a meta table with the same name exists");
 
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
-  table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
-  _tables.emplace(name, std::move(table));
+  if (!table->table_statistics()) table->set_table_statistics(generate_table_statistics_sampled(*table));
+
+  if (_numa_placement_policy) {
+    place_chunks_on_numa_nodes(*table, name, *_numa_placement_policy);
+  }
+
+  const auto& added_table = _tables.emplace(name, std::move(table)).first->second;
+
+  // Logged after the table was added, see WriteAheadLog::checkpoint()
+  if (WriteAheadLog::get().is_enabled()) WriteAheadLog::get().log_create_table(name, *added_table);
 }
 
 void StorageManager::drop_table(const std::string& name) {
   const auto num_deleted = _tables.erase(name);
   Assert(num_deleted == 1, "Error deleting table " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
+
+  if (WriteAheadLog::get().is_enabled()) WriteAheadLog::get().log_drop_table(name);
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  const auto meta_table_iter = _meta_tables.find(name);
+  if (meta_table_iter != _meta_tables.end()) {
+    const auto meta_table = std::atomic_load(&meta_table_iter->second);
+    if (meta_table) return meta_table;
+    return generate_meta_table(name);
+  }
+
   const auto iter = _tables.find(name);
   Assert(iter != _tables.end(), "No such table named '" + name + "'");
 
   return iter->second;
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const {
+  return _tables.count(name) || _meta_tables.count(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
   std::vector<std::string> table_names;
@@ -55,9 +79,19 @@ std::vector<std::string> StorageManager::table_names() const {
 
 const std::map<std::string, std::shared_ptr<Table>>& StorageManager::tables() const { return _tables; }
 
+std::shared_ptr<Table> StorageManager::generate_meta_table(const std::string& name) const {
+  const auto meta_table_iter = _meta_tables.find(name);
+  Assert(meta_table_iter != _meta_tables.end(), "No such meta table named '" + name + "'");
+
+  const auto meta_table = opossum::generate_meta_table(name);
+  meta_table->set_table_statistics(generate_table_statistics_sampled(*meta_table));
+  std::atomic_store(&meta_table_iter->second, meta_table);
+
+  return meta_table;
+}
+
 void StorageManager::add_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
-  Assert(_tables.find(name) == _tables.end(),
-         "Cannot add view " + name + " - a table with the same name already exists");
+  Assert(!has_table(name), "Cannot add view " + name + " - a table with the same name already exists");
   Assert(_views.find(name) == _views.end(), "A view with the name " + name + " already exists");
 
   _views.emplace(name, view);
@@ -88,6 +122,34 @@ std::vector<std::string> StorageManager::view_names() const {
   return view_names;
 }
 
+void StorageManager::add_materialized_view(const std::string& name,
+                                           const std::shared_ptr<MaterializedView>& materialized_view) {
+  add_view(name, materialized_view->view);
+
+  _materialized_views.emplace(name, materialized_view);
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  const auto num_deleted = _materialized_views.erase(name);
+  Assert(num_deleted == 1, "Error deleting materialized view " + name + ": _erase() returned " +
+                               std::to_string(num_deleted) + ".");
+
+  drop_view(name);
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto iter = _materialized_views.find(name);
+  Assert(iter != _materialized_views.end(), "No such materialized view named '" + name + "'");
+
+  return iter->second;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const { return _materialized_views.count(name); }
+
+const std::map<std::string, std::shared_ptr<MaterializedView>>& StorageManager::materialized_views() const {
+  return _materialized_views;
+}
+
 void StorageManager::add_prepared_plan(const std::string& name, const std::shared_ptr<PreparedPlan>& prepared_plan) {
   Assert(_prepared_plans.find(name) == _prepared_plans.end(),
          "Cannot add prepared plan " + name + " - a prepared plan with the same name already exists");
@@ -113,6 +175,12 @@ void StorageManager::drop_prepared_plan(const std::string& name) {
   _prepared_plans.erase(iter);
 }
 
+void StorageManager::set_numa_placement_policy(const std::optional<NUMAPlacementPolicy> numa_placement_policy) {
+  _numa_placement_policy = numa_placement_policy;
+}
+
+std::optional<NUMAPlacementPolicy> StorageManager::numa_placement_policy() const { return _numa_placement_policy; }
+
 void StorageManager::print(std::ostream& out) const {
   out << "==================" << std::endl;
   out << "===== Tables =====" << std::endl << std::endl;
@@ -165,4 +233,28 @@ void StorageManager::export_all_tables_as_csv(const std::string& path) {
   CurrentScheduler::wait_for_tasks(tasks);
 }
 
+CommitID StorageManager::export_all_tables_as_binary_snapshot(const std::string& path) {
+  // The transaction only reads, its snapshot keeps the rows it sees from being cleaned up while they are exported
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(_tables.size());
+
+  for (auto& pair : _tables) {
+    auto job_task = std::make_shared<JobTask>([pair, &path, &transaction_context]() {
+      const auto& name = pair.first;
+      const auto& table = pair.second;
+
+      ExportBinary::write_binary_snapshot(*table, path + "/" + name + ".bin", *transaction_context);  // NOLINT
+    });
+    tasks.push_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  transaction_context->commit();
+  return transaction_context->snapshot_commit_id();
+}
+
 }  // namespace opossum
@@ -3,10 +3,14 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "lqp_view.hpp"
+#include "materialized_view.hpp"
+#include "meta_tables.hpp"
+#include "numa_placement.hpp"
 #include "prepared_plan.hpp"
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -24,6 +28,7 @@ class StorageManager : public Singleton<StorageManager> {
    * @defgroup Manage Tables
    * @{
    */
+  // Generates the TableStatistics of the table, unless it already has some (e.g., imported by ImportBinary)
   void add_table(const std::string& name, std::shared_ptr<Table> table);
   void drop_table(const std::string& name);
   std::shared_ptr<Table> get_table(const std::string& name) const;
@@ -32,6 +37,17 @@ class StorageManager : public Singleton<StorageManager> {
   const std::map<std::string, std::shared_ptr<Table>>& tables() const;
   /** @} */
 
+  /**
+   * @defgroup Meta tables (see meta_tables.hpp)
+   *
+   * has_table() and get_table() know the meta tables, but table_names() and tables() only list the stored tables.
+   * get_table() returns the most recently generated version of a meta table, which suffices for translating and
+   * optimizing queries. GetTable generates the current version.
+   * @{
+   */
+  std::shared_ptr<Table> generate_meta_table(const std::string& name) const;
+  /** @} */
+
   /**
    * @defgroup Manage SQL VIEWs
    * @{
@@ -43,6 +59,20 @@ class StorageManager : public Singleton<StorageManager> {
   std::vector<std::string> view_names() const;
   /** @} */
 
+  /**
+   * @defgroup Manage materialized views
+   *
+   * A materialized view is added as a view as well, so that queries can refer to it by name. The MaterializedViewRule
+   * then replaces it with its result.
+   * @{
+   */
+  void add_materialized_view(const std::string& name, const std::shared_ptr<MaterializedView>& materialized_view);
+  void drop_materialized_view(const std::string& name);
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+  bool has_materialized_view(const std::string& name) const;
+  const std::map<std::string, std::shared_ptr<MaterializedView>>& materialized_views() const;
+  /** @} */
+
   /**
    * @defgroup Manage prepared plans - comparable to SQL PREPAREd statements
    * @{
@@ -53,6 +83,11 @@ class StorageManager : public Singleton<StorageManager> {
   void drop_prepared_plan(const std::string& name);
   /** @} */
 
+  // If a policy is set and the Topology has more than one node, the chunks of added tables are distributed over the
+  // NUMA nodes according to it. std::nullopt disables the placement.
+  void set_numa_placement_policy(const std::optional<NUMAPlacementPolicy> numa_placement_policy);
+  std::optional<NUMAPlacementPolicy> numa_placement_policy() const;
+
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
@@ -65,6 +100,11 @@ class StorageManager : public Singleton<StorageManager> {
   // For debugging purposes mostly, dump all tables as csv
   void export_all_tables_as_csv(const std::string& path);
 
+  // Backs up all tables as binary files (<path>/<name>.bin) while writers keep running. All tables are exported as of
+  // the snapshot of a single transaction (see ExportBinary::write_binary_snapshot()), so that the files are
+  // transactionally consistent with each other. Returns the snapshot's CommitID.
+  CommitID export_all_tables_as_binary_snapshot(const std::string& path);
+
   StorageManager(StorageManager&&) = delete;
 
  protected:
@@ -77,6 +117,16 @@ class StorageManager : public Singleton<StorageManager> {
 
   std::map<std::string, std::shared_ptr<Table>> _tables;
   std::map<std::string, std::shared_ptr<LQPView>> _views;
+  std::map<std::string, std::shared_ptr<MaterializedView>> _materialized_views;
   std::map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans;
+
+  // Holds an entry for each meta table from the start, which is accessed with std::atomic_load/store only
+  mutable std::map<std::string, std::shared_ptr<Table>> _meta_tables{[]() {
+    auto meta_tables = std::map<std::string, std::shared_ptr<Table>>{};
+    for (const auto& name : meta_table_names()) meta_tables.emplace(name, nullptr);
+    return meta_tables;
+  }()};
+
+  std::optional<NUMAPlacementPolicy> _numa_placement_policy{NUMAPlacementPolicy::RoundRobin};
 };
 }  // namespace opossum
@@ -10,6 +10,8 @@
 
 #include "resolve_type.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index/table_index.hpp"
+#include "storage/table_partitioning.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -89,14 +91,31 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
-    append_mutable_chunk();
+  auto chunk_id = ChunkID{};
+  if (_partitioning) {
+    const auto partition_id = _partitioning->partition_id(values[_partitioning->column_id()]);
+    if (last_chunk_id(partition_id) == INVALID_CHUNK_ID ||
+        _chunks[last_chunk_id(partition_id)]->size() >= _max_chunk_size) {
+      append_mutable_chunk(partition_id);
+    }
+    chunk_id = last_chunk_id(partition_id);
+  } else {
+    if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
+      append_mutable_chunk();
+    }
+    chunk_id = ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)};
   }
 
-  _chunks.back()->append(values);
+  const auto& chunk = _chunks[chunk_id];
+  chunk->append(values);
+
+  const auto chunk_offset = static_cast<ChunkOffset>(chunk->size() - 1);
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(chunk_id, *chunk->get_segment(table_index->column_id()), chunk_offset, chunk_offset + 1);
+  }
 }
 
-void Table::append_mutable_chunk() {
+void Table::append_mutable_chunk(const std::optional<PartitionID>& partition_id) {
   Segments segments;
   for (const auto& column_definition : _column_definitions) {
     resolve_data_type(column_definition.data_type, [&](auto type) {
@@ -104,12 +123,24 @@ void Table::append_mutable_chunk() {
       segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
     });
   }
-  append_chunk(segments);
+
+  const auto mvcc_data = _use_mvcc == UseMvcc::Yes ? std::make_shared<MvccData>(0) : nullptr;
+  const auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+
+  // Rows inserted into the chunk are indexed right away, the final indexes are built when the chunk is compressed
+  for (const auto& index_info : get_indexes()) {
+    if (index_info.column_ids.size() == 1) chunk->create_mutable_index(index_info.column_ids[0], index_info.type);
+  }
+
+  if (partition_id) chunk->set_partition_id(*partition_id);
+  append_chunk(chunk);
 }
 
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
-  for (const auto& chunk : _chunks) {
+  for (const auto& chunk_ptr : _chunks) {
+    // Chunks can be removed concurrently by the MvccDeletePlugin
+    const auto chunk = std::atomic_load(&chunk_ptr);
     if (chunk) ret += chunk->size();
   }
   return ret;
@@ -119,29 +150,47 @@ bool Table::empty() const { return row_count() == 0u; }
 
 ChunkID Table::chunk_count() const { return ChunkID{static_cast<ChunkID::base_type>(_chunks.size())}; }
 
+ChunkID Table::appended_chunk_count() const { return ChunkID{_appended_chunk_count.load()}; }
+
 const tbb::concurrent_vector<std::shared_ptr<Chunk>>& Table::chunks() const { return _chunks; }
 
 uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
 
+void Table::set_max_chunk_size(const uint32_t max_chunk_size) {
+  Assert(_type == TableType::Data, "Cannot set max_chunk_size for reference tables");
+  Assert(max_chunk_size > 0, "Table must have a chunk size greater than 0.");
+  _max_chunk_size = max_chunk_size;
+}
+
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
+}
+
+const Chunk& Table::get_chunk_view(ChunkID chunk_id) const {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  const auto& chunk = _chunks[chunk_id];
+  DebugAssert(chunk, "Chunk " + std::to_string(chunk_id) + " was removed");
+  return *chunk;
 }
 
 void Table::remove_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  DebugAssert(_chunks[chunk_id]->invalid_row_count() == _chunks[chunk_id]->size(),
+  const auto chunk = get_chunk(chunk_id);
+  DebugAssert(chunk, "Chunk " + std::to_string(chunk_id) + " was already removed");
+  DebugAssert(chunk->invalid_row_count() == chunk->size(),
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   if (_table_statistics) {
-    auto invalidated_rows_count = _chunks[chunk_id]->size();
+    auto invalidated_rows_count = chunk->size();
     _table_statistics->decrease_invalid_row_count(invalidated_rows_count);
   }
-  _chunks[chunk_id] = nullptr;
+  // Concurrent readers either get the chunk or a nullptr, never a partially written shared_ptr
+  std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>{});
 }
 
 void Table::append_chunk(const Segments& segments, const std::optional<PolymorphicAllocator<Chunk>>& alloc) {
@@ -168,7 +217,7 @@ void Table::append_chunk(const Segments& segments, const std::optional<Polymorph
     mvcc_data = std::make_shared<MvccData>(chunk_size);
   }
 
-  _chunks.push_back(std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  append_chunk(std::make_shared<Chunk>(segments, mvcc_data, alloc));
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -189,24 +238,159 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
   DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
               "Chunk does not have the same MVCC setting as the table.");
 
-  _chunks.push_back(chunk);
+  const auto chunk_it = _chunks.push_back(chunk);
+
+  const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(std::distance(_chunks.begin(), chunk_it))};
+
+  // tbb::concurrent_vector already counts the chunk while it is being constructed, so it is only announced to
+  // appended_chunk_count() now. Concurrent appends might finish out of order, the count only ever grows.
+  const auto new_appended_chunk_count = static_cast<ChunkID::base_type>(chunk_id + 1);
+  auto appended_chunk_count = _appended_chunk_count.load();
+  while (appended_chunk_count < new_appended_chunk_count &&
+         !_appended_chunk_count.compare_exchange_weak(appended_chunk_count, new_appended_chunk_count)) {
+  }
+
+  if (_partitioning) {
+    Assert(chunk->partition_id() && *chunk->partition_id() < _partitioning->partition_count(),
+           "The chunks of a partitioned table must belong to one of its partitions");
+    auto& last_chunk_id = _last_chunk_ids[*chunk->partition_id()];
+    auto expected_chunk_id = last_chunk_id.load();
+    while ((expected_chunk_id == INVALID_CHUNK_ID || expected_chunk_id < chunk_id) &&
+           !last_chunk_id.compare_exchange_weak(expected_chunk_id, chunk_id)) {
+    }
+  }
+
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(chunk_id, *chunk->get_segment(table_index->column_id()), ChunkOffset{0},
+                        static_cast<ChunkOffset>(chunk->size()));
+  }
+}
+
+void Table::set_partitioning(const std::shared_ptr<const TablePartitioning>& partitioning) {
+  Assert(_type == TableType::Data, "Only data tables can be partitioned");
+  Assert(_chunks.empty(), "Tables can only be partitioned before chunks are appended");
+  Assert(partitioning->column_id() < column_count() &&
+             column_data_type(partitioning->column_id()) == partitioning->data_type(),
+         "The partitioning does not match the partition column");
+
+  _partitioning = partitioning;
+  _last_chunk_ids = std::vector<std::atomic<ChunkID::base_type>>(partitioning->partition_count());
+  for (auto& last_chunk_id : _last_chunk_ids) {
+    last_chunk_id = INVALID_CHUNK_ID;
+  }
+}
+
+std::shared_ptr<const TablePartitioning> Table::partitioning() const { return _partitioning; }
+
+ChunkID Table::last_chunk_id(const PartitionID partition_id) const {
+  DebugAssert(_partitioning && partition_id < _last_chunk_ids.size(), "PartitionID out of range");
+  return ChunkID{_last_chunk_ids[partition_id].load()};
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::lock_guard<std::mutex> lock(_indexes_mutex);
+  return _indexes;
+}
+
+void Table::add_index_info(const IndexInfo& index_info) {
+  std::lock_guard<std::mutex> lock(_indexes_mutex);
+  _indexes.emplace_back(index_info);
+}
+
+void Table::remove_index_info(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type) {
+  std::lock_guard<std::mutex> lock(_indexes_mutex);
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& index_info) {
+                                  return index_info.column_ids == column_ids && index_info.type == index_type;
+                                }),
+                 _indexes.end());
+}
+
+void Table::create_table_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "Table-level indexes can only be created on data tables");
+  Assert(column_id < column_count(), "column_id invalid");
+  Assert(!get_table_index(column_id), "Column already has a table-level index");
+
+  const auto table_index = make_shared_by_data_type<BaseTableIndex, TableIndex>(column_data_type(column_id), column_id);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    table_index->insert(chunk_id, *chunk->get_segment(column_id), ChunkOffset{0},
+                        static_cast<ChunkOffset>(chunk->size()));
+  }
+
+  _table_indexes.emplace_back(table_index);
+}
+
+std::shared_ptr<BaseTableIndex> Table::get_table_index(const ColumnID column_id) const {
+  const auto iter = std::find_if(_table_indexes.cbegin(), _table_indexes.cend(),
+                                 [&](const auto& table_index) { return table_index->column_id() == column_id; });
+  return iter != _table_indexes.cend() ? *iter : nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseTableIndex>>& Table::table_indexes() const { return _table_indexes; }
+
+void Table::add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key) {
+  Assert(!column_ids.empty(), "Constraint needs at least one column");
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "column_id invalid");
+    Assert(is_primary_key == IsPrimaryKey::No || !column_is_nullable(column_id),
+           "Columns of a primary key must not be nullable");
+  }
+  Assert(is_primary_key == IsPrimaryKey::No ||
+             std::none_of(_unique_constraints.begin(), _unique_constraints.end(),
+                          [](const auto& constraint) { return constraint.is_primary_key == IsPrimaryKey::Yes; }),
+         "Table already has a primary key");
+
+  _unique_constraints.emplace_back(TableConstraintDefinition{column_ids, is_primary_key});
+}
+
+const TableConstraintDefinitions& Table::get_unique_constraints() const { return _unique_constraints; }
+
+void Table::add_foreign_key_constraint(const std::vector<ColumnID>& column_ids,
+                                       const std::string& referenced_table_name,
+                                       const std::vector<ColumnID>& referenced_column_ids) {
+  Assert(!column_ids.empty() && column_ids.size() == referenced_column_ids.size(),
+         "Foreign key needs as many columns as it references");
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "column_id invalid");
+  }
+
+  _foreign_key_constraints.emplace_back(
+      ForeignKeyConstraintDefinition{column_ids, referenced_table_name, referenced_column_ids});
+}
+
+const ForeignKeyConstraintDefinitions& Table::foreign_key_constraints() const { return _foreign_key_constraints; }
+
+CommitID Table::last_modification_commit_id() const { return _last_modification_commit_id.load(); }
+
+void Table::update_last_modification_commit_id(const CommitID commit_id) const {
+  // Transactions might commit their records concurrently, so only move the commit ID forward
+  auto last_modification_commit_id = _last_modification_commit_id.load();
+  while (last_modification_commit_id < commit_id &&
+         !_last_modification_commit_id.compare_exchange_weak(last_modification_commit_id, commit_id)) {
+  }
+}
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
-  for (const auto& chunk : _chunks) {
-    bytes += chunk->estimate_memory_usage();
+  for (const auto& chunk_ptr : _chunks) {
+    const auto chunk = std::atomic_load(&chunk_ptr);
+    if (chunk) bytes += chunk->estimate_memory_usage();
   }
 
   for (const auto& column_definition : _column_definitions) {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_index : _table_indexes) {
+    bytes += table_index->estimate_memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indices missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
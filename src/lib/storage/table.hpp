@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -8,8 +9,10 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "storage/index/base_table_index.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -17,6 +20,7 @@
 
 namespace opossum {
 
+class TablePartitioning;
 class TableStatistics;
 
 /**
@@ -61,6 +65,10 @@ class Table : private Noncopyable {
   // return the maximum chunk size (cannot exceed ChunkOffset (uint32_t))
   uint32_t max_chunk_size() const;
 
+  // Changes the size of the chunks that are appended from now on. Existing chunks keep their size until the
+  // MvccDeletePlugin re-inserts their rows, which merges them into (or splits them up into) chunks of the new size.
+  void set_max_chunk_size(const uint32_t max_chunk_size);
+
   // Returns the number of rows.
   // This number includes invalidated (deleted) rows.
   // Use approx_valid_row_count() for an approximate count of valid rows instead.
@@ -78,6 +86,11 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
+  // Returns the number of chunks that were completely appended. In contrast to chunk_count(), it never includes a chunk
+  // that is concurrently being appended and not yet accessible. Used by Insert to find the last chunk without locking
+  // the table.
+  ChunkID appended_chunk_count() const;
+
   // Returns all Chunks
   const tbb::concurrent_vector<std::shared_ptr<Chunk>>& chunks() const;
 
@@ -85,6 +98,14 @@ class Table : private Noncopyable {
   std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
   std::shared_ptr<const Chunk> get_chunk(ChunkID chunk_id) const;
 
+  // Returns the chunk without the atomic load and reference counting of get_chunk(). When many threads access the
+  // same chunks, these cause contention on the shared reference counts, so that hot loops of operators use views
+  // instead. The view is valid as long as the caller keeps the table alive and the chunk is not removed. This holds
+  // for the chunks of intermediate tables and for those referenced by the PosLists of an operator's inputs, as the
+  // MvccDeletePlugin only removes chunks that no active transaction can see. The segments of chunks of stored tables
+  // might be evicted, though, so get_segment() has to be used for them (see Chunk::get_segment_view()).
+  const Chunk& get_chunk_view(ChunkID chunk_id) const;
+
   /*
    * Removes the chunk with the given id.
    * Makes sure that the the chunk was fully invalidated by the logical delete before deleting it physically.
@@ -106,8 +127,26 @@ class Table : private Noncopyable {
    */
   void append_chunk(const std::shared_ptr<Chunk>& chunk);
 
-  // Create and append a Chunk consisting of ValueSegments.
-  void append_mutable_chunk();
+  // Create and append a Chunk consisting of ValueSegments. Chunks of partitioned tables need a partition.
+  void append_mutable_chunk(const std::optional<PartitionID>& partition_id = std::nullopt);
+
+  /** @} */
+
+  /**
+   * @defgroup Partitioning (see TablePartitioning)
+   * @{
+   */
+
+  // Partitions the table by a column. Must be called before the first chunk is appended. Afterwards, append() and
+  // Insert add rows to the chunks of their partition, and all appended chunks must belong to a partition.
+  void set_partitioning(const std::shared_ptr<const TablePartitioning>& partitioning);
+
+  // Returns nullptr if the table is not partitioned
+  std::shared_ptr<const TablePartitioning> partitioning() const;
+
+  // Returns the last chunk that was appended for the given partition, or INVALID_CHUNK_ID if there is none. Rows of the
+  // partition are appended to this chunk.
+  ChunkID last_chunk_id(const PartitionID partition_id) const;
 
   /** @} */
 
@@ -146,23 +185,78 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
-  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
+  // The statistics are replaced when a finalized chunk is added to them (see refresh_table_statistics()) while
+  // concurrent queries read them, so they are accessed atomically
+  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) {
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
 
-  std::shared_ptr<TableStatistics> table_statistics() const { return _table_statistics; }
+  std::shared_ptr<TableStatistics> table_statistics() const { return std::atomic_load(&_table_statistics); }
 
   std::vector<IndexInfo> get_indexes() const;
 
+  // Registers an index whose chunk indexes are created separately (e.g., chunk by chunk by the TuningPlugin), so that
+  // the optimizer considers it (see IndexScanRule). Chunks without the index are still scanned without it.
+  void add_index_info(const IndexInfo& index_info);
+
+  // Unregisters the indexes of the given type on the given columns. The indexes of the chunks are not removed.
+  void remove_index_info(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type);
+
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     SegmentIndexType index_type = get_index_type_of<Index>();
 
     for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
+      // Mutable chunks get a mutable index, which is replaced by an Index once the chunk is compressed
+      if (chunk->is_mutable() && column_ids.size() == 1) {
+        chunk->create_mutable_index(column_ids[0], index_type);
+      } else {
+        chunk->create_index<Index>(column_ids);
+      }
     }
-    IndexInfo i = {column_ids, name, index_type};
-    _indexes.emplace_back(i);
+    add_index_info({column_ids, name, index_type});
   }
 
+  /**
+   * @defgroup Table-level indexes (see BaseTableIndex)
+   * @{
+   */
+
+  // Creates a table-level index on the given column and adds all existing rows to it. Rows that are appended later
+  // are added automatically. Must not be called while rows are being appended.
+  void create_table_index(const ColumnID column_id);
+
+  // Returns the table-level index of the given column or nullptr, if there is none
+  std::shared_ptr<BaseTableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseTableIndex>>& table_indexes() const;
+
+  /** @} */
+
+  /**
+   * @defgroup Constraints (see TableConstraintDefinition and ForeignKeyConstraintDefinition)
+   * Constraints are declarative and not checked when rows are added. The optimizer relies on them, e.g., to eliminate
+   * joins.
+   * @{
+   */
+
+  // A table has at most one primary key, whose columns must not be nullable
+  void add_unique_constraint(const std::vector<ColumnID>& column_ids,
+                             const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+  const TableConstraintDefinitions& get_unique_constraints() const;
+
+  void add_foreign_key_constraint(const std::vector<ColumnID>& column_ids, const std::string& referenced_table_name,
+                                  const std::vector<ColumnID>& referenced_column_ids);
+  const ForeignKeyConstraintDefinitions& foreign_key_constraints() const;
+
+  /** @} */
+
+  // The commit ID of the last transaction that inserted or deleted rows of this table, see SubplanResultCache and
+  // QueryResultCache. It is updated when Insert and Delete commit their records. As Delete only holds a const pointer
+  // to the table, the setter is const as well.
+  CommitID last_modification_commit_id() const;
+  void update_last_modification_commit_id(const CommitID commit_id) const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -172,10 +266,18 @@ class Table : private Noncopyable {
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
-  const uint32_t _max_chunk_size;
+  std::atomic<uint32_t> _max_chunk_size;
   tbb::concurrent_vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  mutable std::mutex _indexes_mutex;
+  std::vector<std::shared_ptr<BaseTableIndex>> _table_indexes;
+  TableConstraintDefinitions _unique_constraints;
+  ForeignKeyConstraintDefinitions _foreign_key_constraints;
+  mutable std::atomic<CommitID> _last_modification_commit_id{0};
+  std::atomic<ChunkID::base_type> _appended_chunk_count{0};
+  std::shared_ptr<const TablePartitioning> _partitioning;
+  std::vector<std::atomic<ChunkID::base_type>> _last_chunk_ids;
 };
 }  // namespace opossum
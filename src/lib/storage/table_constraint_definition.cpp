@@ -0,0 +1,14 @@
+#include "table_constraint_definition.hpp"
+
+namespace opossum {
+
+bool TableConstraintDefinition::operator==(const TableConstraintDefinition& rhs) const {
+  return columns == rhs.columns && is_primary_key == rhs.is_primary_key;
+}
+
+bool ForeignKeyConstraintDefinition::operator==(const ForeignKeyConstraintDefinition& rhs) const {
+  return columns == rhs.columns && referenced_table_name == rhs.referenced_table_name &&
+         referenced_columns == rhs.referenced_columns;
+}
+
+}  // namespace opossum
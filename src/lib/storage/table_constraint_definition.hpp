@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class IsPrimaryKey : bool { Yes = true, No = false };
+
+/**
+ * A PRIMARY KEY or UNIQUE constraint: No two rows of the table have the same values in all of the columns. Columns of
+ * a primary key are not nullable. Rows with a NULL in one of the columns of a UNIQUE constraint are not considered.
+ */
+struct TableConstraintDefinition final {
+  bool operator==(const TableConstraintDefinition& rhs) const;
+
+  std::vector<ColumnID> columns;
+  IsPrimaryKey is_primary_key{IsPrimaryKey::No};
+};
+
+using TableConstraintDefinitions = std::vector<TableConstraintDefinition>;
+
+/**
+ * A FOREIGN KEY constraint: For each row of the table that has no NULL in the columns, the referenced table contains a
+ * row with the same values in the referenced columns, which are unique.
+ */
+struct ForeignKeyConstraintDefinition final {
+  bool operator==(const ForeignKeyConstraintDefinition& rhs) const;
+
+  std::vector<ColumnID> columns;
+  std::string referenced_table_name;
+  std::vector<ColumnID> referenced_columns;
+};
+
+using ForeignKeyConstraintDefinitions = std::vector<ForeignKeyConstraintDefinition>;
+
+}  // namespace opossum
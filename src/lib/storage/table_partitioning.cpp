@@ -0,0 +1,298 @@
+#include "table_partitioning.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+std::vector<T> typed_bounds(const std::vector<AllTypeVariant>& bounds) {
+  auto typed_bounds = std::vector<T>{};
+  typed_bounds.reserve(bounds.size());
+  for (const auto& bound : bounds) {
+    typed_bounds.emplace_back(boost::get<T>(bound));
+  }
+  return typed_bounds;
+}
+
+template <typename T>
+PartitionID partition_of(const PartitioningType type, const PartitionID partition_count,
+                         const std::vector<T>& bounds, const T& value) {
+  if (type == PartitioningType::Hash) {
+    return static_cast<PartitionID>(std::hash<T>{}(value) % partition_count);
+  }
+  const auto bound = std::upper_bound(bounds.cbegin(), bounds.cend(), value);
+  return static_cast<PartitionID>(std::distance(bounds.cbegin(), bound));
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<TablePartitioning> TablePartitioning::create_hash_partitioning(const ColumnID column_id,
+                                                                               const DataType data_type,
+                                                                               const PartitionID partition_count) {
+  return std::make_shared<TablePartitioning>(PartitioningType::Hash, column_id, data_type, partition_count,
+                                             std::vector<AllTypeVariant>{});
+}
+
+std::shared_ptr<TablePartitioning> TablePartitioning::create_range_partitioning(
+    const ColumnID column_id, const DataType data_type, const std::vector<AllTypeVariant>& bounds) {
+  return std::make_shared<TablePartitioning>(PartitioningType::Range, column_id, data_type,
+                                             static_cast<PartitionID>(bounds.size() + 1), bounds);
+}
+
+TablePartitioning::TablePartitioning(const PartitioningType type, const ColumnID column_id, const DataType data_type,
+                                     const PartitionID partition_count, const std::vector<AllTypeVariant>& bounds)
+    : _type(type), _column_id(column_id), _data_type(data_type), _partition_count(partition_count), _bounds(bounds) {
+  Assert(_data_type != DataType::Null, "Cannot partition by a column of type NULL");
+  Assert(_partition_count > 0, "A partitioned table needs at least one partition");
+
+  if (_type == PartitioningType::Hash) {
+    Assert(_bounds.empty(), "Hash partitionings have no bounds");
+    return;
+  }
+
+  Assert(_partition_count == _bounds.size() + 1, "A range partitioning has one partition more than bounds");
+  for (auto bound_idx = size_t{0}; bound_idx < _bounds.size(); ++bound_idx) {
+    Assert(data_type_from_all_type_variant(_bounds[bound_idx]) == _data_type,
+           "The bounds must have the data type of the partition column");
+    Assert(bound_idx == 0 || _bounds[bound_idx - 1] < _bounds[bound_idx], "The bounds must be strictly ascending");
+  }
+}
+
+PartitioningType TablePartitioning::type() const { return _type; }
+
+ColumnID TablePartitioning::column_id() const { return _column_id; }
+
+DataType TablePartitioning::data_type() const { return _data_type; }
+
+PartitionID TablePartitioning::partition_count() const { return _partition_count; }
+
+const std::vector<AllTypeVariant>& TablePartitioning::bounds() const { return _bounds; }
+
+PartitionID TablePartitioning::partition_id(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) return PartitionID{0};
+
+  auto partition_id = PartitionID{0};
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    partition_id = partition_of(_type, _partition_count, typed_bounds<ColumnDataType>(_bounds),
+                                type_cast_variant<ColumnDataType>(value));
+  });
+  return partition_id;
+}
+
+std::vector<PartitionID> TablePartitioning::partition_ids(const BaseSegment& segment) const {
+  auto partition_ids = std::vector<PartitionID>(segment.size(), PartitionID{0});
+
+  // Values of other types (e.g., from the input of an Insert) are cast to the type of the partition column one by one
+  if (segment.data_type() != _data_type) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      partition_ids[chunk_offset] = partition_id(segment[chunk_offset]);
+    }
+    return partition_ids;
+  }
+
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto bounds = typed_bounds<ColumnDataType>(_bounds);
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) return;
+      partition_ids[position.chunk_offset()] = partition_of(_type, _partition_count, bounds, position.value());
+    });
+  });
+  return partition_ids;
+}
+
+bool TablePartitioning::can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                                  const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) const {
+  // Values of other types are not cast, as, e.g., `a < 2.5` on an integer column must not become `a < 2`
+  const auto is_comparable = [&](const AllTypeVariant& variant) {
+    return !variant_is_null(variant) && data_type_from_all_type_variant(variant) == _data_type;
+  };
+  if (!is_comparable(value) || (value2 && !is_comparable(*value2))) return false;
+
+  if (predicate_condition == PredicateCondition::Equals) return this->partition_id(value) != partition_id;
+  if (_type == PartitioningType::Hash) return false;
+
+  // The values of the partition are in [lower_bound, upper_bound)
+  const auto lower_bound = partition_id > 0 ? std::optional<AllTypeVariant>{_bounds[partition_id - 1]} : std::nullopt;
+  const auto upper_bound =
+      partition_id < _bounds.size() ? std::optional<AllTypeVariant>{_bounds[partition_id]} : std::nullopt;
+
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+      return lower_bound && !(*lower_bound < value);
+    case PredicateCondition::LessThanEquals:
+      return lower_bound && value < *lower_bound;
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return upper_bound && !(value < *upper_bound);
+    case PredicateCondition::Between:
+      return value2 && ((upper_bound && !(value < *upper_bound)) || (lower_bound && *value2 < *lower_bound));
+    default:
+      return false;
+  }
+}
+
+bool TablePartitioning::is_compatible_with(const TablePartitioning& other) const {
+  return _type == other._type && _data_type == other._data_type && _partition_count == other._partition_count &&
+         _bounds == other._bounds;
+}
+
+std::optional<PartitionedChunks> partition_chunks(const Table& table, const ColumnID column_id) {
+  auto partitioned_chunks = PartitionedChunks{};
+
+  const auto add_chunk = [&](const ChunkID chunk_id, const std::shared_ptr<const TablePartitioning>& partitioning,
+                             const Chunk& chunk) {
+    if (!chunk.partition_id()) return false;
+
+    if (!partitioned_chunks.partitioning) {
+      partitioned_chunks.partitioning = partitioning;
+      partitioned_chunks.chunk_ids_by_partition.resize(partitioning->partition_count());
+    } else if (!partitioned_chunks.partitioning->is_compatible_with(*partitioning)) {
+      return false;
+    }
+
+    partitioned_chunks.chunk_ids_by_partition[*chunk.partition_id()].emplace_back(chunk_id);
+    return true;
+  };
+
+  if (table.type() == TableType::Data) {
+    const auto partitioning = table.partitioning();
+    if (!partitioning || partitioning->column_id() != column_id) return std::nullopt;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk || chunk->size() == 0) continue;
+      if (!add_chunk(chunk_id, partitioning, *chunk)) return std::nullopt;
+    }
+  } else {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk || chunk->size() == 0) continue;
+
+      // The rows of a reference chunk belong to a single partition if they all reference the same chunk
+      const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      const auto& pos_list = *reference_segment->pos_list();
+      if (!pos_list.references_single_chunk() || pos_list.common_chunk_id() == INVALID_CHUNK_ID) return std::nullopt;
+
+      const auto referenced_table = reference_segment->referenced_table();
+      const auto partitioning = referenced_table->partitioning();
+      if (!partitioning || partitioning->column_id() != reference_segment->referenced_column_id()) return std::nullopt;
+
+      const auto referenced_chunk = referenced_table->get_chunk(pos_list.common_chunk_id());
+      if (!referenced_chunk || !add_chunk(chunk_id, partitioning, *referenced_chunk)) return std::nullopt;
+    }
+  }
+
+  if (!partitioned_chunks.partitioning) return std::nullopt;
+  return partitioned_chunks;
+}
+
+std::shared_ptr<Table> table_of_chunks(const std::shared_ptr<const Table>& table,
+                                       const std::vector<ChunkID>& chunk_ids) {
+  auto output = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (table->type() == TableType::References) {
+      output->append_chunk(chunk->segments());
+      continue;
+    }
+
+    const auto chunk_size = chunk->size();
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    pos_list->guarantee_single_chunk();
+
+    Segments output_segments;
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      output_segments.push_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    output->append_chunk(output_segments);
+  }
+
+  return output;
+}
+
+std::vector<std::shared_ptr<Table>> split_by_partition(const std::shared_ptr<const Table>& table,
+                                                       const ColumnID column_id,
+                                                       const TablePartitioning& partitioning) {
+  auto outputs = std::vector<std::shared_ptr<Table>>(partitioning.partition_count());
+  for (auto& output : outputs) {
+    output = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  }
+
+  auto chunk_offsets_by_partition = std::vector<std::vector<ChunkOffset>>(partitioning.partition_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    for (auto& chunk_offsets : chunk_offsets_by_partition) chunk_offsets.clear();
+    const auto partition_ids = partitioning.partition_ids(*chunk->get_segment(column_id));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < partition_ids.size(); ++chunk_offset) {
+      chunk_offsets_by_partition[partition_ids[chunk_offset]].emplace_back(chunk_offset);
+    }
+
+    for (auto partition_id = PartitionID{0}; partition_id < partitioning.partition_count(); ++partition_id) {
+      const auto& chunk_offsets = chunk_offsets_by_partition[partition_id];
+      if (chunk_offsets.empty()) continue;
+
+      Segments output_segments;
+
+      // Segments that reference the same PosList in the input share their PosList in the output (see table_scan.hpp)
+      std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>> out_pos_list_map;
+
+      for (auto output_column_id = ColumnID{0}; output_column_id < table->column_count(); ++output_column_id) {
+        auto out_referenced_table = table;
+        auto out_column_id = output_column_id;
+        std::shared_ptr<const PosList> in_pos_list;
+
+        if (const auto reference_segment =
+                std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(output_column_id))) {
+          out_referenced_table = reference_segment->referenced_table();
+          out_column_id = reference_segment->referenced_column_id();
+          in_pos_list = reference_segment->pos_list();
+        }
+
+        auto& pos_list_out = out_pos_list_map[in_pos_list];
+        if (!pos_list_out) {
+          pos_list_out = std::make_shared<PosList>();
+          pos_list_out->reserve(chunk_offsets.size());
+          for (const auto chunk_offset : chunk_offsets) {
+            pos_list_out->emplace_back(in_pos_list ? (*in_pos_list)[chunk_offset] : RowID{chunk_id, chunk_offset});
+          }
+          if (!in_pos_list || in_pos_list->references_single_chunk()) pos_list_out->guarantee_single_chunk();
+        }
+
+        output_segments.push_back(
+            std::make_shared<ReferenceSegment>(out_referenced_table, out_column_id, pos_list_out));
+      }
+
+      outputs[partition_id]->append_chunk(output_segments);
+    }
+  }
+
+  return outputs;
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+enum class PartitioningType { Hash, Range };
+
+/**
+ * Describes how the rows of a table are distributed among its partitions by the value of one column, see
+ * Table::set_partitioning(). Each chunk of a partitioned table holds the rows of a single partition. Thus, the
+ * ChunkPruningRule excludes the chunks of partitions that cannot satisfy a predicate on the partition column, and
+ * JoinHash and Aggregate process the partitions of inputs that are partitioned by their join or group-by column
+ * independently and in parallel, instead of partitioning the rows themselves.
+ *
+ * Hash:  A row belongs to partition std::hash(value) % partition_count.
+ * Range: The sorted bounds b_0 < ... < b_n-1 split the values into n + 1 partitions. Partition 0 holds the values
+ *        below b_0, partition i the values in [b_i-1, b_i), and partition n the values from b_n-1 on.
+ * NULLs belong to partition 0.
+ */
+class TablePartitioning {
+ public:
+  static std::shared_ptr<TablePartitioning> create_hash_partitioning(const ColumnID column_id, const DataType data_type,
+                                                                     const PartitionID partition_count);
+  static std::shared_ptr<TablePartitioning> create_range_partitioning(const ColumnID column_id,
+                                                                      const DataType data_type,
+                                                                      const std::vector<AllTypeVariant>& bounds);
+
+  TablePartitioning(const PartitioningType type, const ColumnID column_id, const DataType data_type,
+                    const PartitionID partition_count, const std::vector<AllTypeVariant>& bounds);
+
+  PartitioningType type() const;
+  ColumnID column_id() const;
+  DataType data_type() const;
+  PartitionID partition_count() const;
+  const std::vector<AllTypeVariant>& bounds() const;
+
+  PartitionID partition_id(const AllTypeVariant& value) const;
+
+  // Returns the partition of each row of a segment of the partition column
+  std::vector<PartitionID> partition_ids(const BaseSegment& segment) const;
+
+  // Returns true if no row of the partition satisfies `<partition column> <predicate_condition> value [AND value2]`
+  bool can_prune(const PartitionID partition_id, const PredicateCondition predicate_condition,
+                 const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  // Returns true if equal values of the partition columns of both partitionings belong to the same partition, i.e.,
+  // if tables partitioned this way are co-partitioned
+  bool is_compatible_with(const TablePartitioning& other) const;
+
+ protected:
+  const PartitioningType _type;
+  const ColumnID _column_id;
+  const DataType _data_type;
+  const PartitionID _partition_count;
+  const std::vector<AllTypeVariant> _bounds;
+};
+
+// The non-empty chunks of a table, grouped by the partition that their rows belong to. For reference tables, the
+// partitioning is that of the referenced table.
+struct PartitionedChunks {
+  std::shared_ptr<const TablePartitioning> partitioning;
+  std::vector<std::vector<ChunkID>> chunk_ids_by_partition;
+};
+
+/**
+ * Returns the chunks of @param table grouped by partition if the table is partitioned by @param column_id. This is the
+ * case for data tables with that partition column, and for reference tables whose chunks each reference a single
+ * chunk of a table with a compatible partitioning, through that table's partition column. Otherwise, std::nullopt is
+ * returned.
+ */
+std::optional<PartitionedChunks> partition_chunks(const Table& table, const ColumnID column_id);
+
+// Returns a reference table with the given chunks of @param table. References of a reference table are forwarded.
+std::shared_ptr<Table> table_of_chunks(const std::shared_ptr<const Table>& table,
+                                       const std::vector<ChunkID>& chunk_ids);
+
+// Distributes the rows of @param table by the partition of their value in @param column_id and returns a reference
+// table with the rows of each partition. References of a reference table are resolved.
+std::vector<std::shared_ptr<Table>> split_by_partition(const std::shared_ptr<const Table>& table,
+                                                       const ColumnID column_id,
+                                                       const TablePartitioning& partitioning);
+
+}  // namespace opossum
@@ -17,13 +17,13 @@ namespace opossum {
 
 template <typename T>
 ValueSegment<T>::ValueSegment(bool nullable) : BaseValueSegment(data_type_from_type<T>()) {
-  if (nullable) _null_values = pmr_concurrent_vector<bool>();
+  if (nullable) _null_values = NullValueVector();
 }
 
 template <typename T>
 ValueSegment<T>::ValueSegment(const PolymorphicAllocator<T>& alloc, bool nullable)
     : BaseValueSegment(data_type_from_type<T>()), _values(alloc) {
-  if (nullable) _null_values = pmr_concurrent_vector<bool>(alloc);
+  if (nullable) _null_values = NullValueVector(alloc);
 }
 
 template <typename T>
@@ -31,11 +31,11 @@ ValueSegment<T>::ValueSegment(pmr_concurrent_vector<T>&& values, const Polymorph
     : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values), alloc) {}
 
 template <typename T>
-ValueSegment<T>::ValueSegment(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values,
+ValueSegment<T>::ValueSegment(pmr_concurrent_vector<T>&& values, NullValueVector&& null_values,
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values({std::move(null_values), alloc}) {
+      _null_values(NullValueVector(std::move(null_values), alloc)) {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
 }
 
@@ -52,7 +52,7 @@ ValueSegment<T>::ValueSegment(const std::vector<T>& values, std::vector<bool>& n
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(values, alloc),
-      _null_values(pmr_concurrent_vector<bool>(null_values, alloc)) {
+      _null_values(NullValueVector(null_values.cbegin(), null_values.cend(), alloc)) {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
 }
 
@@ -61,7 +61,7 @@ ValueSegment<T>::ValueSegment(std::vector<T>&& values, std::vector<bool>&& null_
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values(pmr_concurrent_vector<bool>(std::move(null_values), alloc)) {
+      _null_values(NullValueVector(null_values.cbegin(), null_values.cend(), alloc)) {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
 }
 
@@ -121,6 +121,13 @@ void ValueSegment<T>::reserve(const size_t capacity) {
   if (_null_values) _null_values->reserve(capacity);
 }
 
+template <typename T>
+void ValueSegment<T>::grow_to(const size_t size) {
+  // Grow the NULL values first, so that they cover all rows visible through size()
+  if (_null_values) _null_values->grow_to_at_least(size);
+  _values.grow_to_at_least(size);
+}
+
 template <typename T>
 const pmr_concurrent_vector<T>& ValueSegment<T>::values() const {
   return _values;
@@ -137,14 +144,14 @@ bool ValueSegment<T>::is_nullable() const {
 }
 
 template <typename T>
-const pmr_concurrent_vector<bool>& ValueSegment<T>::null_values() const {
+const NullValueVector& ValueSegment<T>::null_values() const {
   DebugAssert(is_nullable(), "This ValueSegment does not support null values.");
 
   return *_null_values;
 }
 
 template <typename T>
-pmr_concurrent_vector<bool>& ValueSegment<T>::null_values() {
+NullValueVector& ValueSegment<T>::null_values() {
   DebugAssert(is_nullable(), "This ValueSegment does not support null values.");
 
   return *_null_values;
@@ -160,7 +167,7 @@ std::shared_ptr<BaseSegment> ValueSegment<T>::copy_using_allocator(const Polymor
   pmr_concurrent_vector<T> new_values(_values, alloc);  // NOLINT(cppcoreguidelines-slicing)
                                                         // (clang-tidy reports slicing that comes from tbb)
   if (is_nullable()) {
-    pmr_concurrent_vector<bool> new_null_values(*_null_values, alloc);  // NOLINT(cppcoreguidelines-slicing) (see above)
+    NullValueVector new_null_values(*_null_values, alloc);
     return std::allocate_shared<ValueSegment<T>>(alloc, std::move(new_values), std::move(new_null_values));
   } else {
     return std::allocate_shared<ValueSegment<T>>(alloc, std::move(new_values));
@@ -169,7 +176,7 @@ std::shared_ptr<BaseSegment> ValueSegment<T>::copy_using_allocator(const Polymor
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  return sizeof(*this) + _values.size() * sizeof(T) + (_null_values ? _null_values->size() * sizeof(bool) : 0u);
+  return sizeof(*this) + _values.size() * sizeof(T) + (_null_values ? _null_values->memory_usage() : 0u);
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
@@ -19,7 +19,7 @@ class ValueSegment : public BaseValueSegment {
 
   // Create a ValueSegment with the given values.
   explicit ValueSegment(pmr_concurrent_vector<T>&& values, const PolymorphicAllocator<T>& alloc = {});
-  explicit ValueSegment(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values,
+  explicit ValueSegment(pmr_concurrent_vector<T>&& values, NullValueVector&& null_values,
                         const PolymorphicAllocator<T>& alloc = {});
   explicit ValueSegment(const std::vector<T>& values, const PolymorphicAllocator<T>& alloc = {});
   explicit ValueSegment(std::vector<T>&& values, const PolymorphicAllocator<T>& alloc = {});
@@ -48,6 +48,8 @@ class ValueSegment : public BaseValueSegment {
   // Allocate enough space to hold at least @param capacity entries
   void reserve(const size_t capacity) final;
 
+  void grow_to(const size_t size) final;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = segment.values(); and then: values.at(i); in your loop.
@@ -61,8 +63,9 @@ class ValueSegment : public BaseValueSegment {
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
   // Usually you need to access more than a single value anyway.
-  const pmr_concurrent_vector<bool>& null_values() const final;
-  pmr_concurrent_vector<bool>& null_values() final;
+  // Check null_values().all_valid() first to skip the NULL handling if the segment contains no NULLs.
+  const NullValueVector& null_values() const final;
+  NullValueVector& null_values() final;
 
   // Return the number of entries in the segment.
   size_t size() const final;
@@ -78,7 +81,7 @@ class ValueSegment : public BaseValueSegment {
   // While a ValueSegment knows if it is nullable or not by looking at this optional, most other segment types
   // (e.g. DictionarySegment) do not. For this reason, we need to store the nullable information separately
   // in the table's definition.
-  std::optional<pmr_concurrent_vector<bool>> _null_values;
+  std::optional<NullValueVector> _null_values;
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <iterator>
 #include <utility>
 
+#include "storage/null_value_vector.hpp"
 #include "storage/segment_iterables.hpp"
 #include "types.hpp"
 
@@ -16,7 +17,7 @@ class NullValueVectorIterable : public PointAccessibleSegmentIterable<NullValueV
  public:
   using ValueType = bool;
 
-  explicit NullValueVectorIterable(const pmr_concurrent_vector<bool>& null_values) : _null_values{null_values} {}
+  explicit NullValueVectorIterable(const NullValueVector& null_values) : _null_values{null_values} {}
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
@@ -33,13 +34,13 @@ class NullValueVectorIterable : public PointAccessibleSegmentIterable<NullValueV
   }
 
  private:
-  const pmr_concurrent_vector<bool>& _null_values;
+  const NullValueVector& _null_values;
 
  private:
   class Iterator : public BaseSegmentIterator<Iterator, IsNullSegmentPosition> {
    public:
     using ValueType = bool;
-    using NullValueIterator = pmr_concurrent_vector<bool>::const_iterator;
+    using NullValueIterator = NullValueVector::const_iterator;
 
    public:
     explicit Iterator(const NullValueIterator& begin_null_value_it, const NullValueIterator& null_value_it)
@@ -67,7 +68,6 @@ class NullValueVectorIterable : public PointAccessibleSegmentIterable<NullValueV
   class PointAccessIterator : public BasePointAccessSegmentIterator<PointAccessIterator, IsNullSegmentPosition> {
    public:
     using ValueType = bool;
-    using NullValueVector = pmr_concurrent_vector<bool>;
 
    public:
     explicit PointAccessIterator(const NullValueVector& null_values,
@@ -15,9 +15,10 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
   explicit ValueSegmentIterable(const ValueSegment<T>& segment) : _segment{segment} {}
 
+  // Nullable segments without NULLs take the same path as non-nullable ones, see NullValueVector::all_valid()
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
-    if (_segment.is_nullable()) {
+    if (_segment.is_nullable() && !_segment.null_values().all_valid()) {
       auto begin = Iterator{_segment.values().cbegin(), _segment.values().cbegin(), _segment.null_values().cbegin()};
       auto end = Iterator{_segment.values().cbegin(), _segment.values().cend(), _segment.null_values().cend()};
       functor(begin, end);
@@ -30,7 +31,7 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
-    if (_segment.is_nullable()) {
+    if (_segment.is_nullable() && !_segment.null_values().all_valid()) {
       auto begin = PointAccessIterator{_segment.values().cbegin(), _segment.null_values().cbegin(),
                                        position_filter->cbegin(), position_filter->cbegin()};
       auto end = PointAccessIterator{_segment.values().cbegin(), _segment.null_values().cbegin(),
@@ -95,7 +96,7 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     using ValueType = T;
     using IterableType = ValueSegmentIterable<T>;
     using ValueIterator = typename pmr_concurrent_vector<T>::const_iterator;
-    using NullValueIterator = pmr_concurrent_vector<bool>::const_iterator;
+    using NullValueIterator = NullValueVector::const_iterator;
 
    public:
     explicit Iterator(const ValueIterator begin_value_it, const ValueIterator value_it,
@@ -172,7 +173,7 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
     using ValueType = T;
     using IterableType = ValueSegmentIterable<T>;
     using ValueVectorIterator = typename pmr_concurrent_vector<T>::const_iterator;
-    using NullValueVectorIterator = typename pmr_concurrent_vector<bool>::const_iterator;
+    using NullValueVectorIterator = NullValueVector::const_iterator;
 
    public:
     explicit PointAccessIterator(ValueVectorIterator values_begin_it, NullValueVectorIterator null_values_begin_it,
@@ -0,0 +1,89 @@
+#include "bit_packing_compressor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace opossum {
+
+std::unique_ptr<const BaseCompressedVector> BitPackingCompressor::compress(const pmr_vector<uint32_t>& vector,
+                                                                           const PolymorphicAllocator<size_t>& alloc,
+                                                                           const UncompressedVectorInfo& meta_info) {
+  const auto bit_width = meta_info.max_value ? _bit_width(*meta_info.max_value) : _choose_bit_width(vector);
+
+  auto data = pmr_vector<uint64_t>((vector.size() * bit_width + 63) / 64, alloc);
+  auto exception_positions = pmr_vector<uint32_t>{alloc};
+  auto exception_values = pmr_vector<uint32_t>{alloc};
+
+  // With a bit width of 32, every value fits and the largest value does not need to serve as exception marker
+  const auto exception_marker = (uint64_t{1} << bit_width) - 1;
+  const auto may_have_exceptions = !meta_info.max_value && bit_width < 32;
+
+  for (auto index = size_t{0}; index < vector.size(); ++index) {
+    auto value = uint64_t{vector[index]};
+    if (may_have_exceptions && value >= exception_marker) {
+      exception_positions.push_back(static_cast<uint32_t>(index));
+      exception_values.push_back(vector[index]);
+      value = exception_marker;
+    }
+    if (bit_width == 0) continue;
+
+    const auto bit_index = index * bit_width;
+    const auto word_index = bit_index / 64;
+    const auto bit_offset = bit_index % 64;
+    data[word_index] |= value << bit_offset;
+    if (bit_offset + bit_width > 64) data[word_index + 1] |= value >> (64 - bit_offset);
+  }
+
+  // Values equal to the marker are only stored as exceptions if there are actual outliers. Otherwise, they are
+  // unambiguous and the exceptions are dropped.
+  const auto has_outliers = std::any_of(exception_values.cbegin(), exception_values.cend(),
+                                        [&](const auto value) { return value > exception_marker; });
+  if (!has_outliers) {
+    exception_positions.clear();
+    exception_values.clear();
+  }
+
+  return std::make_unique<BitPackingVector>(std::move(data), bit_width, vector.size(), std::move(exception_positions),
+                                            std::move(exception_values));
+}
+
+std::unique_ptr<BaseVectorCompressor> BitPackingCompressor::create_new() const {
+  return std::make_unique<BitPackingCompressor>();
+}
+
+uint8_t BitPackingCompressor::_bit_width(uint32_t value) {
+  return value == 0 ? uint8_t{0} : static_cast<uint8_t>(32 - __builtin_clz(value));
+}
+
+uint8_t BitPackingCompressor::_choose_bit_width(const pmr_vector<uint32_t>& vector) {
+  auto value_count_per_bit_width = std::array<size_t, 33>{};
+  for (const auto value : vector) {
+    ++value_count_per_bit_width[_bit_width(value)];
+  }
+
+  auto max_bit_width = uint8_t{32};
+  while (max_bit_width > 0 && value_count_per_bit_width[max_bit_width] == 0) --max_bit_width;
+
+  // An exception costs its position and its value. The values that need exactly bit_width bits and are equal to the
+  // exception marker also become exceptions, which is ignored here. A bit width of zero leaves no room for a marker.
+  static constexpr auto exception_bits = size_t{64};
+
+  auto best_bit_width = max_bit_width;
+  auto best_size = vector.size() * max_bit_width;
+  auto exception_count = size_t{0};
+  for (auto bit_width = static_cast<int>(max_bit_width) - 1; bit_width >= 1; --bit_width) {
+    exception_count += value_count_per_bit_width[bit_width + 1];
+    const auto size = vector.size() * bit_width + exception_count * exception_bits;
+    if (size < best_size) {
+      best_size = size;
+      best_bit_width = static_cast<uint8_t>(bit_width);
+    }
+  }
+
+  return best_bit_width;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+
+#include "storage/vector_compression/base_vector_compressor.hpp"
+
+#include "bit_packing_vector.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Compresses a vector using bit-packing, optionally with exceptions for outliers (PFOR)
+ *
+ * If the maximum value is passed via UncompressedVectorInfo (as done by the dictionary encoder, whose value ids are
+ * dense), its bit width is used. Otherwise, the compressor computes the number of values per bit width and picks the
+ * width that minimizes the size of the packed values plus that of the exceptions.
+ */
+class BitPackingCompressor : public BaseVectorCompressor {
+ public:
+  std::unique_ptr<const BaseCompressedVector> compress(const pmr_vector<uint32_t>& vector,
+                                                       const PolymorphicAllocator<size_t>& alloc,
+                                                       const UncompressedVectorInfo& meta_info = {}) final;
+
+  std::unique_ptr<BaseVectorCompressor> create_new() const final;
+
+ private:
+  static uint8_t _bit_width(uint32_t value);
+  static uint8_t _choose_bit_width(const pmr_vector<uint32_t>& vector);
+};
+
+}  // namespace opossum
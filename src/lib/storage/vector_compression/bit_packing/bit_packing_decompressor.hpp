@@ -0,0 +1,28 @@
+#pragma once
+
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BitPackingVector;
+
+/**
+ * @brief Implements point-access into a BitPackingVector
+ *
+ * As the values of a BitPackingVector can be accessed in constant time, no state needs to be cached.
+ */
+class BitPackingDecompressor : public BaseVectorDecompressor {
+ public:
+  explicit BitPackingDecompressor(const BitPackingVector& vector) : _vector{vector} {}
+  ~BitPackingDecompressor() final = default;
+
+  uint32_t get(size_t i) final;
+  size_t size() const final;
+
+ private:
+  const BitPackingVector& _vector;
+};
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "storage/vector_compression/base_compressed_vector.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BitPackingVector;
+
+class BitPackingIterator : public BaseCompressedVectorIterator<BitPackingIterator> {
+ public:
+  BitPackingIterator(const BitPackingVector& vector, size_t index) : _vector{&vector}, _index{index} {}
+
+ private:
+  friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+  void increment() { ++_index; }
+
+  void decrement() { --_index; }
+
+  void advance(std::ptrdiff_t n) { _index += n; }
+
+  bool equal(const BitPackingIterator& other) const { return _index == other._index; }
+
+  std::ptrdiff_t distance_to(const BitPackingIterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+  }
+
+  uint32_t dereference() const;
+
+ private:
+  const BitPackingVector* _vector;
+  size_t _index;
+};
+
+}  // namespace opossum
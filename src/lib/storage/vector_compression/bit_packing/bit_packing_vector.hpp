@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "bit_packing_decompressor.hpp"
+#include "bit_packing_iterator.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Stores values with an arbitrary bit width between 0 and 32
+ *
+ * The values are packed back to back into 64-bit words, so that every value can be read in constant time with at
+ * most two word accesses. Unlike FixedSizeByteAlignedVector, no bits are wasted by rounding up to full bytes, and
+ * unlike SimdBp128Vector, point access does not need to decode a block.
+ *
+ * Patched frame of reference (PFOR): If a few large values would force a large bit width for all others, the compressor
+ * may choose a smaller width and store these outliers as exceptions. Their packed value is the largest value that the
+ * bit width can represent (the exception marker), and the actual value is found via a binary search on the exception
+ * positions. Vectors without exceptions never look at them.
+ */
+class BitPackingVector : public CompressedVector<BitPackingVector> {
+ public:
+  BitPackingVector(pmr_vector<uint64_t> data, uint8_t bit_width, size_t size, pmr_vector<uint32_t> exception_positions,
+                   pmr_vector<uint32_t> exception_values)
+      : _data{std::move(data)},
+        _bit_width{bit_width},
+        _mask{(uint64_t{1} << bit_width) - 1},
+        _size{size},
+        _exception_positions{std::move(exception_positions)},
+        _exception_values{std::move(exception_values)} {
+    DebugAssert(bit_width <= 32, "Bit width must not exceed 32");
+    DebugAssert(_exception_positions.size() == _exception_values.size(), "Each exception needs a value");
+  }
+
+  const pmr_vector<uint64_t>& data() const { return _data; }
+  uint8_t bit_width() const { return _bit_width; }
+  size_t exception_count() const { return _exception_positions.size(); }
+
+  uint32_t get(const size_t i) const {
+    DebugAssert(i < _size, "Index out of bounds");
+    if (_bit_width == 0) return 0u;
+
+    const auto bit_index = i * _bit_width;
+    const auto word_index = bit_index / 64;
+    const auto bit_offset = bit_index % 64;
+
+    auto value = _data[word_index] >> bit_offset;
+    if (bit_offset + _bit_width > 64) value |= _data[word_index + 1] << (64 - bit_offset);
+    value &= _mask;
+
+    if (value != _mask || _exception_positions.empty()) return static_cast<uint32_t>(value);
+    return _get_exception(i);
+  }
+
+ public:
+  size_t on_size() const { return _size; }
+  size_t on_data_size() const {
+    return sizeof(uint64_t) * _data.size() + sizeof(uint32_t) * (_exception_positions.size() + _exception_values.size());
+  }
+
+  auto on_create_decompressor() const { return std::make_unique<BitPackingDecompressor>(*this); }
+
+  auto on_create_base_decompressor() const { return std::unique_ptr<BaseVectorDecompressor>{on_create_decompressor()}; }
+
+  auto on_begin() const { return BitPackingIterator{*this, 0u}; }
+
+  auto on_end() const { return BitPackingIterator{*this, _size}; }
+
+  std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+    return std::make_unique<BitPackingVector>(pmr_vector<uint64_t>{_data, alloc}, _bit_width, _size,
+                                              pmr_vector<uint32_t>{_exception_positions, alloc},
+                                              pmr_vector<uint32_t>{_exception_values, alloc});
+  }
+
+ private:
+  uint32_t _get_exception(const size_t i) const {
+    const auto it = std::lower_bound(_exception_positions.cbegin(), _exception_positions.cend(), i);
+    DebugAssert(it != _exception_positions.cend() && *it == i, "Exception marker without exception");
+    return _exception_values[std::distance(_exception_positions.cbegin(), it)];
+  }
+
+  const pmr_vector<uint64_t> _data;
+  const uint8_t _bit_width;
+  const uint64_t _mask;
+  const size_t _size;
+  const pmr_vector<uint32_t> _exception_positions;
+  const pmr_vector<uint32_t> _exception_values;
+};
+
+// These are defined here, where BitPackingVector is complete, so that they can be inlined
+inline uint32_t BitPackingIterator::dereference() const { return _vector->get(_index); }
+
+inline uint32_t BitPackingDecompressor::get(size_t i) { return _vector.get(i); }
+
+inline size_t BitPackingDecompressor::size() const { return _vector.size(); }
+
+}  // namespace opossum
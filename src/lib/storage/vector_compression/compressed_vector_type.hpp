@@ -26,12 +26,14 @@ enum class CompressedVectorType : uint8_t {
   FixedSize4ByteAligned,  // uncompressed
   FixedSize2ByteAligned,
   FixedSize1ByteAligned,
-  SimdBp128
+  SimdBp128,
+  BitPacking
 };
 
 template <typename T>
 class FixedSizeByteAlignedVector;
 class SimdBp128Vector;
+class BitPackingVector;
 
 /**
  * Mapping of compressed vector types to compressed vectors
@@ -45,7 +47,8 @@ constexpr auto compressed_vector_for_type = hana::make_map(
                     hana::type_c<FixedSizeByteAlignedVector<uint16_t>>),
     hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::FixedSize1ByteAligned>,
                     hana::type_c<FixedSizeByteAlignedVector<uint8_t>>),
-    hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::SimdBp128>, hana::type_c<SimdBp128Vector>));
+    hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::SimdBp128>, hana::type_c<SimdBp128Vector>),
+    hana::make_pair(enum_c<CompressedVectorType, CompressedVectorType::BitPacking>, hana::type_c<BitPackingVector>));
 
 /**
  * @brief Returns the CompressedVectorType of a given compressed vector
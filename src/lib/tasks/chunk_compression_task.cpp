@@ -3,21 +3,33 @@
 #include <string>
 #include <vector>
 
+#include "concurrency/transaction_manager.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/base_mutable_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
-    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           const std::optional<AutoEncodingSpec>& auto_encoding_spec)
+    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}, auto_encoding_spec} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<AutoEncodingSpec>& auto_encoding_spec)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _auto_encoding_spec{auto_encoding_spec} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
@@ -29,20 +41,131 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(*chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    // Sortedness is cheaper to detect on the unencoded segments
+    if (!chunk->ordered_by()) {
+      const auto ordered_by = _detect_ordered_by(*chunk);
+      if (ordered_by) chunk->set_ordered_by(*ordered_by);
+    }
+
+    if (_auto_encoding_spec) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), *_auto_encoding_spec);
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    }
+
+    _finalize_mutable_indexes(chunk);
+    _try_freeze_mvcc_data(*chunk);
+
+    // Rows that were appended to the chunk after the statistics were generated are added to them now
+    refresh_table_statistics(*table, chunk_id);
+  }
+}
+
+void ChunkCompressionTask::_finalize_mutable_indexes(const std::shared_ptr<Chunk>& chunk) {
+  // The final index is created before the mutable one is removed, so that lookups always find one of them
+  for (const auto& mutable_index : chunk->mutable_indexes()) {
+    const auto column_ids = std::vector<ColumnID>{mutable_index->column_id()};
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(mutable_index->column_id()));
+
+    // All indexes but the B-tree require dictionary segments, which the chosen encoding might not produce. The
+    // CompositeGroupKeyIndex additionally requires fixed-size byte-aligned attribute vectors.
+    auto index_type = mutable_index->finalized_index_type();
+    const auto is_supported =
+        dictionary_segment && (index_type != SegmentIndexType::CompositeGroupKey ||
+                               (dictionary_segment->compressed_vector_type() &&
+                                is_fixed_size_byte_aligned(*dictionary_segment->compressed_vector_type())));
+    if (!is_supported) index_type = SegmentIndexType::BTree;
+
+    switch (index_type) {
+      case SegmentIndexType::GroupKey:
+        chunk->create_index<GroupKeyIndex>(column_ids);
+        break;
+      case SegmentIndexType::AdaptiveRadixTree:
+        chunk->create_index<AdaptiveRadixTreeIndex>(column_ids);
+        break;
+      case SegmentIndexType::CompositeGroupKey:
+        chunk->create_index<CompositeGroupKeyIndex>(column_ids);
+        break;
+      case SegmentIndexType::BTree:
+        chunk->create_index<BTreeIndex>(column_ids);
+        break;
+      default:
+        Fail("Unknown index type");
+    }
+  }
+
+  chunk->remove_mutable_indexes();
+}
+
+void ChunkCompressionTask::_try_freeze_mvcc_data(const Chunk& chunk) {
+  if (!chunk.has_mvcc_data()) return;
+
+  // Determined by ChunkEncoder::encode_chunk() when the chunk became immutable
+  const auto mvcc_data = chunk.mvcc_data();
+  const auto max_begin_cid = mvcc_data->max_begin_cid.load();
+  if (max_begin_cid == MvccData::MAX_COMMIT_ID) return;
+
+  // All rows can share the highest begin_cid if all current and future snapshots see all of them anyway
+  auto& transaction_manager = TransactionManager::get();
+  if (transaction_manager.last_commit_id() < max_begin_cid) return;
+  const auto lowest_snapshot_commit_id = transaction_manager.get_lowest_active_snapshot_commit_id();
+  if (lowest_snapshot_commit_id && *lowest_snapshot_commit_id < max_begin_cid) return;
+
+  mvcc_data->freeze(max_begin_cid);
+}
+
+std::optional<std::pair<ColumnID, OrderByMode>> ChunkCompressionTask::_detect_ordered_by(const Chunk& chunk) {
+  if (chunk.size() < 2) return std::nullopt;
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+
+    auto is_ascending = true;
+    auto is_descending = true;
+
+    segment_with_iterators(segment, [&](auto it, const auto end) {
+      // NULLs are only allowed before the first value
+      while (it != end && it->is_null()) ++it;
+      if (it == end) {
+        is_ascending = false;
+        is_descending = false;
+        return;
+      }
+
+      auto previous_value = it->value();
+      for (++it; it != end && (is_ascending || is_descending); ++it) {
+        if (it->is_null()) {
+          is_ascending = false;
+          is_descending = false;
+          return;
+        }
+
+        const auto value = it->value();
+        if (value < previous_value) is_ascending = false;
+        if (value > previous_value) is_descending = false;
+        previous_value = value;
+      }
+    });
+
+    if (is_ascending) return std::make_pair(column_id, OrderByMode::Ascending);
+    if (is_descending) return std::make_pair(column_id, OrderByMode::Descending);
   }
+
+  return std::nullopt;
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
-  if (chunk->size() != max_chunk_size) return false;
+bool ChunkCompressionTask::chunk_is_completed(const Chunk& chunk, const uint32_t max_chunk_size) {
+  if (chunk.size() != max_chunk_size) return false;
+  if (!chunk.has_mvcc_data()) return true;
 
-  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
 
-  for (const auto begin_cid : mvcc_data->begin_cids) {
-    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
   }
 
   return true;
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -29,25 +32,53 @@ class Chunk;
  *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
+ *
+ * If no active transaction has a snapshot from before the last insert into the chunk, the task also freezes the MVCC
+ * data of the chunk (see MvccData::freeze()).
+ *
+ * Before encoding, the task checks whether the values of a column are sorted and, if so, stores this in
+ * Chunk::ordered_by(), so that scans can binary-search the encoded segment.
+ *
+ * Mutable indexes on the chunk (see BaseMutableIndex) are replaced by regular chunk indexes on the encoded segments.
+ *
+ * By default, all segments are dictionary-encoded. If an AutoEncodingSpec is passed, the encoding of each segment is
+ * chosen by ChunkEncoder::select_segment_encoding() instead.
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
-  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                const std::optional<AutoEncodingSpec>& auto_encoding_spec = std::nullopt);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const std::optional<AutoEncodingSpec>& auto_encoding_spec = std::nullopt);
+
+  /**
+   * @brief Checks if a chunks is completed
+   *
+   * See class comment for further explanation
+   */
+  static bool chunk_is_completed(const Chunk& chunk, const uint32_t max_chunk_size);
 
  protected:
   void _on_execute() override;
 
  private:
+
+  void _try_freeze_mvcc_data(const Chunk& chunk);
+
   /**
-   * @brief Checks if a chunks is completed
-   *
-   * See class comment for further explanation
+   * Replaces the mutable indexes of the chunk by indexes of their finalized_index_type() on the encoded segments. If
+   * the encoded segment does not support that type, a BTreeIndex is created instead.
+   */
+  void _finalize_mutable_indexes(const std::shared_ptr<Chunk>& chunk);
+
+  /**
+   * Finds the first column whose values (with NULLs first) are sorted in ascending or descending order
    */
-  bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static std::optional<std::pair<ColumnID, OrderByMode>> _detect_ordered_by(const Chunk& chunk);
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<AutoEncodingSpec> _auto_encoding_spec;
 };
 }  // namespace opossum
@@ -1,27 +1,63 @@
 #include "bind_server_prepared_statement_task.hpp"
 
 #include "concurrency/transaction_manager.hpp"
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "optimizer/optimizer.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "storage/prepared_plan.hpp"
 
 namespace opossum {
 
+std::vector<DataType> BindServerPreparedStatementTask::parameter_data_types(
+    const std::vector<AllTypeVariant>& params) {
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(params.size());
+  for (const auto& param : params) {
+    data_types.emplace_back(data_type_from_all_type_variant(param));
+  }
+  return data_types;
+}
+
+std::unordered_map<ParameterID, AllTypeVariant> BindServerPreparedStatementTask::parameters_by_id(
+    const PreparedPlan& prepared_plan, const std::vector<AllTypeVariant>& params) {
+  Assert(params.size() == prepared_plan.parameter_ids.size(), "Prepared statement parameter count mismatch");
+
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < params.size(); ++parameter_idx) {
+    if (variant_is_null(params[parameter_idx])) continue;
+    parameters.emplace(prepared_plan.parameter_ids[parameter_idx], params[parameter_idx]);
+  }
+  return parameters;
+}
+
 void BindServerPreparedStatementTask::_on_execute() {
   try {
     Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
 
+    // Like the placeholders, the CorrelatedParameterExpressions use the ParameterIDs of the prepared plan, which are
+    // unique within the statement
     auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
     for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
-      parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
+      const auto& param = _params[parameter_idx];
+      if (variant_is_null(param)) {
+        parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(param);
+      } else {
+        parameter_expressions[parameter_idx] = std::make_shared<CorrelatedParameterExpression>(
+            _prepared_plan->parameter_ids[parameter_idx],
+            CorrelatedParameterExpression::ReferencedExpressionInfo{data_type_from_all_type_variant(param),
+                                                                    "parameter"});
+      }
     }
 
     const auto lqp = _prepared_plan->instantiate(parameter_expressions);
-    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(lqp);
+    const auto pqp = LQPTranslator{}.translate_node(optimized_lqp);
 
     _promise.set_value(pqp);
   } catch (const std::exception&) {
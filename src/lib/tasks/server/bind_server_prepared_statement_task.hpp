@@ -1,5 +1,8 @@
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "abstract_server_task.hpp"
 
 #include "all_parameter_variant.hpp"
@@ -10,12 +13,24 @@ class AbstractOperator;
 class PreparedPlan;
 
 // This task is used to bind the actual variables of a prepared statements and return the corresponding query plan.
+//
+// The returned plan is optimized and translated from the prepared plan, but it does not contain the parameter values:
+// instead, the placeholders are replaced by CorrelatedParameterExpressions of the parameters' data types (NULLs are
+// bound directly). Thus, the plan can be reused for all parameters with the same data types (see
+// parameter_data_types()). Each use has to deep_copy() it and set the parameters (see parameters_by_id()).
 class BindServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<AbstractOperator>> {
  public:
   BindServerPreparedStatementTask(const std::shared_ptr<PreparedPlan>& prepared_plan,
                                   std::vector<AllTypeVariant> params)
       : _prepared_plan(prepared_plan), _params(std::move(params)) {}
 
+  // The data types that a plan returned by this task was created for
+  static std::vector<DataType> parameter_data_types(const std::vector<AllTypeVariant>& params);
+
+  // The parameters for AbstractOperator::set_parameters() on a plan returned by this task
+  static std::unordered_map<ParameterID, AllTypeVariant> parameters_by_id(const PreparedPlan& prepared_plan,
+                                                                           const std::vector<AllTypeVariant>& params);
+
  protected:
   void _on_execute() override;
 
@@ -0,0 +1,49 @@
+#include "copy_from_stdin_server_task.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "constant_mappings.hpp"
+#include "import_export/csv_parser.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void CopyFromStdinServerTask::_on_execute() {
+  try {
+    // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+    if (!StorageManager::get().has_table(_table_name)) Fail("The specified table does not exist.");
+    const auto target_table = StorageManager::get().get_table(_table_name);
+
+    // The CSV data has no meta file, its columns are those of the target table
+    auto csv_meta = CsvMeta{};
+    for (auto column_id = ColumnID{0}; column_id < target_table->column_count(); ++column_id) {
+      csv_meta.columns.emplace_back(ColumnMeta{target_table->column_name(column_id),
+                                               data_type_to_string.left.at(target_table->column_data_type(column_id)),
+                                               target_table->column_is_nullable(column_id)});
+    }
+
+    const auto data_table = CsvParser{}.parse_content(std::move(_data), csv_meta, target_table->max_chunk_size());
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(data_table);
+    table_wrapper->execute();
+
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+
+    if (insert->execute_failed()) {
+      transaction_context->rollback();
+      Fail("The data could not be inserted.");
+    }
+    transaction_context->commit();
+
+    _promise.set_value(data_table->row_count());
+  } catch (...) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
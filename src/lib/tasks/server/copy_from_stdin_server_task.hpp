@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+// This task appends the CSV data received by a COPY <table-name> FROM STDIN command to a table. The data is parsed
+// chunk-wise in parallel by the CsvParser into ValueSegments, which the Insert operator copies into the table as a
+// whole, so no value is converted to an AllTypeVariant. All rows are inserted within a single transaction. The result
+// is the number of inserted rows.
+class CopyFromStdinServerTask : public AbstractServerTask<uint64_t> {
+ public:
+  CopyFromStdinServerTask(std::string table_name, std::string data)
+      : _table_name(std::move(table_name)), _data(std::move(data)) {}
+
+ protected:
+  void _on_execute() override;
+
+  const std::string _table_name;
+  std::string _data;
+};
+
+}  // namespace opossum
@@ -2,7 +2,10 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <regex>
+
 #include "sql/sql_pipeline_builder.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -13,8 +16,17 @@ void CreatePipelineTask::_on_execute() {
     if (_allow_load_table && _is_load_table()) {
       // Try LOAD file_name table_name
       result->load_table = std::make_pair(_file_name, _table_name);
+    } else if (_is_copy_to_stdout()) {
+      result->sql_pipeline = std::make_shared<SQLPipeline>(
+          SQLPipelineBuilder{_copy_query}.with_cancellation_token(_cancellation_token).create_pipeline());
+      result->copy_to_stdout_format = _copy_format;
+    } else if (_is_copy_from_stdin()) {
+      result->copy_from_stdin_table = _copy_table_name;
+    } else if (_is_set_statement_timeout()) {
+      result->statement_timeout = _statement_timeout;
     } else {
-      result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+      result->sql_pipeline = std::make_shared<SQLPipeline>(
+          SQLPipelineBuilder{_sql}.with_cancellation_token(_cancellation_token).create_pipeline());
     }
   } catch (...) {
     // Setting the exception this way ensures that the details are preserved in the futures
@@ -47,4 +59,75 @@ bool CreatePipelineTask::_is_load_table() {
   return true;
 }
 
+bool CreatePipelineTask::_is_copy_to_stdout() {
+  static const auto copy_regex = std::regex{
+      R"(^\s*COPY\s+(\(([\s\S]*)\)|[\w.]+)\s+TO\s+STDOUT(\s+BINARY|\s+(WITH\s*)?\(\s*FORMAT\s+(\w+)\s*\))?\s*;?\s*$)",
+      std::regex::icase};
+
+  // The last character might be a \0-byte
+  const auto sql = std::string{_sql.c_str()};
+
+  std::smatch match;
+  if (!std::regex_match(sql, match, copy_regex)) return false;
+
+  _copy_query = match[2].matched ? match[2].str() : "SELECT * FROM " + match[1].str();
+
+  // Either the argument of FORMAT or the BINARY keyword
+  const auto format =
+      boost::algorithm::to_lower_copy(match[5].matched ? match[5].str() : boost::algorithm::trim_copy(match[3].str()));
+  if (format.empty() || format == "text") {
+    _copy_format = FormatCode::Text;
+  } else if (format == "binary") {
+    _copy_format = FormatCode::Binary;
+  } else {
+    Fail("COPY only supports the text and binary formats.");
+  }
+
+  return true;
+}
+
+bool CreatePipelineTask::_is_copy_from_stdin() {
+  static const auto copy_regex =
+      std::regex{R"(^\s*COPY\s+([\w.]+)\s+FROM\s+STDIN(\s+CSV|\s+(WITH\s*)?\(\s*FORMAT\s+(\w+)\s*\))?\s*;?\s*$)",
+                 std::regex::icase};
+
+  // The last character might be a \0-byte
+  const auto sql = std::string{_sql.c_str()};
+
+  std::smatch match;
+  if (!std::regex_match(sql, match, copy_regex)) return false;
+
+  // Either the argument of FORMAT or the CSV keyword
+  const auto format =
+      boost::algorithm::to_lower_copy(match[4].matched ? match[4].str() : boost::algorithm::trim_copy(match[2].str()));
+  if (format != "csv") Fail("COPY FROM STDIN only supports the CSV format.");
+
+  _copy_table_name = match[1].str();
+  return true;
+}
+
+bool CreatePipelineTask::_is_set_statement_timeout() {
+  static const auto set_regex = std::regex{
+      R"(^\s*SET\s+(SESSION\s+)?statement_timeout\s*(=|\s+TO)\s*'?\s*(\d+)\s*(ms|s|min)?\s*'?\s*;?\s*$)",
+      std::regex::icase};
+
+  // The last character might be a \0-byte
+  const auto sql = std::string{_sql.c_str()};
+
+  std::smatch match;
+  if (!std::regex_match(sql, match, set_regex)) return false;
+
+  const auto value = std::stoll(match[3].str());
+  const auto unit = boost::algorithm::to_lower_copy(match[4].str());
+  if (unit.empty() || unit == "ms") {
+    _statement_timeout = std::chrono::milliseconds{value};
+  } else if (unit == "s") {
+    _statement_timeout = std::chrono::seconds{value};
+  } else {
+    _statement_timeout = std::chrono::minutes{value};
+  }
+
+  return true;
+}
+
 }  // namespace opossum
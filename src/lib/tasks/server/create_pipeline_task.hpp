@@ -2,15 +2,25 @@
 
 #include <boost/thread/future.hpp>
 
+#include <chrono>
+
 #include "abstract_server_task.hpp"
+#include "server/types.hpp"
 
 namespace opossum {
 
+class CancellationToken;
 class SQLPipeline;
 
 struct CreatePipelineResult {
   std::shared_ptr<SQLPipeline> sql_pipeline;
   std::optional<std::pair<std::string, std::string>> load_table;
+  // Set for COPY ... TO STDOUT commands, whose query is held by the sql_pipeline
+  std::optional<FormatCode> copy_to_stdout_format;
+  // Set for COPY <table-name> FROM STDIN commands, which do not need an SQLPipeline
+  std::optional<std::string> copy_from_stdin_table;
+  // Set for SET statement_timeout commands, zero disables the timeout
+  std::optional<std::chrono::milliseconds> statement_timeout;
 };
 
 // This task is used to parse an SQL string from a client and wrap it in an SQLPipeline. It is a separate task and not
@@ -18,8 +28,9 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::shared_ptr<CancellationToken> cancellation_token = nullptr)
+      : _sql(sql), _allow_load_table(allow_load_table), _cancellation_token(std::move(cancellation_token)) {}
 
  protected:
   void _on_execute() override;
@@ -29,11 +40,29 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   // interpret it as a LOAD <file-name> <table-name> command. If this doesn't work, we pass on the parse error.
   bool _is_load_table();
 
+  // The SQL parser does not support COPY, so we recognize COPY <table-name> TO STDOUT and COPY (<query>) TO STDOUT,
+  // optionally followed by BINARY or [WITH] (FORMAT text|binary), ourselves. The query is passed on to the SQLPipeline.
+  bool _is_copy_to_stdout();
+
+  // Recognizes COPY <table-name> FROM STDIN followed by CSV or [WITH] (FORMAT csv). Other formats are not supported.
+  bool _is_copy_from_stdin();
+
+  // Recognizes SET statement_timeout [=|TO] <value>, where the value is in milliseconds unless it has the unit ms, s,
+  // or min, as in PostgreSQL. The timeout is kept by the session, see ServerSession.
+  bool _is_set_statement_timeout();
+
   const std::string _sql;
   const bool _allow_load_table;
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 
   std::string _file_name;
   std::string _table_name;
+
+  std::string _copy_table_name;
+  std::string _copy_query;
+  FormatCode _copy_format;
+
+  std::chrono::milliseconds _statement_timeout;
 };
 
 }  // namespace opossum
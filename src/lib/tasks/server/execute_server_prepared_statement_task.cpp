@@ -1,5 +1,6 @@
 #include "execute_server_prepared_statement_task.hpp"
 
+#include "concurrency/cancellation_token.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_operator.hpp"
@@ -10,8 +11,14 @@ namespace opossum {
 
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
+    if (_cancellation_token) _prepared_plan->set_cancellation_token_recursively(_cancellation_token);
+
     const auto tasks = OperatorTask::make_tasks_from_operator(_prepared_plan, CleanupTemporaries::Yes);
     CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+    // The operators of a cancelled statement stop early, so that their outputs are incomplete
+    if (_cancellation_token) _cancellation_token->throw_if_cancelled();
+
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
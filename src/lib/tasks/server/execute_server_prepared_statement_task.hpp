@@ -5,19 +5,24 @@
 namespace opossum {
 
 class AbstractOperator;
+class CancellationToken;
 class TransactionContext;
 class Table;
 
-// This task takes a query plan of a prepared statement and executes it.
+// This task takes a query plan of a prepared statement and executes it. If the plan is cancelled through
+// @param cancellation_token, the task fails with a QueryCancelledException.
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan,
+                                              std::shared_ptr<CancellationToken> cancellation_token = nullptr)
+      : _prepared_plan(std::move(prepared_plan)), _cancellation_token(std::move(cancellation_token)) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<AbstractOperator> _prepared_plan;
+  // The operators only hold a weak pointer to the token
+  std::shared_ptr<CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
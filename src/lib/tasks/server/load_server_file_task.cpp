@@ -15,8 +15,11 @@ void LoadServerFileTask::_on_execute() {
     std::vector<std::string> file_parts;
     boost::algorithm::split(file_parts, _file_name, boost::is_any_of("."));
     const std::string& extension = file_parts.back();
+    // Compressed csv files (e.g., table.csv.gz) are decompressed while being parsed, see StreamingFileReader
+    const auto is_compressed_csv = (extension == "gz" || extension == "zst") && file_parts.size() > 2 &&
+                                   file_parts[file_parts.size() - 2] == "csv";
 
-    if (extension == "csv") {
+    if (extension == "csv" || is_compressed_csv) {
       auto importer = std::make_shared<ImportCsv>(_file_name, Chunk::MAX_SIZE, _table_name);
       importer->execute();
     } else if (extension == "tbl") {
@@ -26,7 +29,8 @@ void LoadServerFileTask::_on_execute() {
       auto importer = std::make_shared<ImportBinary>(_file_name, _table_name);
       importer->execute();
     } else {
-      Fail("Unsupported file type could not be loaded. Only csv, tbl, and bin are supported.");
+      Fail("Unsupported file type could not be loaded. Only csv (also compressed as csv.gz or csv.zst), tbl, and bin "
+           "are supported.");
     }
 
     _promise.set_value();
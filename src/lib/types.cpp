@@ -71,4 +71,15 @@ PredicateCondition inverse_predicate_condition(const PredicateCondition predicat
   }
 }
 
+bool operator==(const TableSample& lhs, const TableSample& rhs) {
+  return lhs.method == rhs.method && lhs.percentage == rhs.percentage && lhs.seed == rhs.seed;
+}
+
+std::ostream& operator<<(std::ostream& stream, const TableSample& table_sample) {
+  stream << (table_sample.method == TableSampleMethod::System ? "SYSTEM" : "BERNOULLI") << " ("
+         << table_sample.percentage << ")";
+  if (table_sample.seed) stream << " REPEATABLE (" << *table_sample.seed << ")";
+  return stream;
+}
+
 }  // namespace opossum
@@ -110,6 +110,9 @@ using pmr_ring_buffer = boost::circular_buffer<T, PolymorphicAllocator<T>>;
 using ChunkOffset = uint32_t;
 
 constexpr ChunkOffset INVALID_CHUNK_OFFSET{std::numeric_limits<ChunkOffset>::max()};
+
+// Identifies a partition of a partitioned table, see TablePartitioning
+using PartitionID = uint32_t;
 constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
 
 struct RowID {
@@ -172,6 +175,7 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 // The Scheduler currently supports just these 3 priorities, subject to change.
 enum class SchedulePriority {
+  Low = 2,      // Schedule task behind all others, e.g., for background maintenance such as the TuningPlugin
   Default = 1,  // Schedule task at the end of the queue
   High = 0      // Schedule task at the beginning of the queue
 };
@@ -204,11 +208,30 @@ enum class JoinMode { Inner, Left, Right, Outer, Cross, Semi, Anti };
 
 enum class UnionMode { Positions };
 
+// Unique removes duplicates from the result (SQL's INTERSECT/EXCEPT), All keeps them (INTERSECT ALL/EXCEPT ALL)
+enum class SetOperationMode { Unique, All };
+
 enum class OrderByMode { Ascending, Descending, AscendingNullsLast, DescendingNullsLast };
 
 enum class TableType { References, Data };
 
-enum class HistogramType { EqualWidth, EqualHeight, EqualDistinctCount };
+enum class HistogramType { EqualWidth, EqualHeight, EqualDistinctCount, Generic };
+
+// TABLESAMPLE of a stored table: SYSTEM keeps entire chunks, BERNOULLI individual rows, each with the given
+// probability in percent. Samples of the same data with the same seed are identical. Without a seed, a random one is
+// chosen for every execution.
+enum class TableSampleMethod { System, Bernoulli };
+
+struct TableSample {
+  TableSampleMethod method;
+  double percentage;
+  std::optional<uint64_t> seed;
+};
+
+bool operator==(const TableSample& lhs, const TableSample& rhs);
+
+// Prints the sample in SQL syntax, e.g., "BERNOULLI (1) REPEATABLE (42)"
+std::ostream& operator<<(std::ostream& stream, const TableSample& table_sample);
 
 enum class DescriptionMode { SingleLine, MultiLine };
 
@@ -216,6 +239,18 @@ enum class UseMvcc : bool { Yes = true, No = false };
 
 enum class CleanupTemporaries : bool { Yes = true, No = false };
 
+enum class FusePipelines : bool { Yes = true, No = false };
+
+enum class ParameterizeLiterals : bool { Yes = true, No = false };
+
+enum class AdaptiveReoptimization : bool { Yes = true, No = false };
+
+enum class ExplainAnalyze : bool { Yes = true, No = false };
+
+enum class CacheSubplanResults : bool { Yes = true, No = false };
+
+enum class CacheQueryResults : bool { Yes = true, No = false };
+
 // Used as a template parameter that is passed whenever we conditionally erase the type of a template. This is done to
 // reduce the compile time at the cost of the runtime performance. Examples are iterators, which are replaced by
 // AnySegmentIterators that use virtual method calls.
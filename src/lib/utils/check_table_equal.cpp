@@ -3,6 +3,9 @@
 #include <iomanip>
 #include <iostream>
 
+#include "utils/decimal_utils.hpp"
+#include "utils/logical_data_types.hpp"
+
 #define ANSI_COLOR_RED "\x1B[31m"
 #define ANSI_COLOR_GREEN "\x1B[32m"
 #define ANSI_COLOR_BG_RED "\x1B[41m"
@@ -37,9 +40,18 @@ Matrix table_to_matrix(const std::shared_ptr<const Table>& table) {
 
     for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
       const auto segment = chunk->get_segment(column_id);
+      const auto data_type = table->column_data_type(column_id);
 
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
-        matrix[row_offset + chunk_offset + 2][column_id] = (*segment)[chunk_offset];
+        auto value = (*segment)[chunk_offset];
+        // Dates and Timestamps are compared as strings and Decimals as floating point numbers, as SQLite returns them
+        // as such
+        if (data_type == DataType::Decimal && !variant_is_null(value)) {
+          value = decimal_to_double(boost::get<int64_t>(value));
+        } else if (is_date_time_data_type(data_type) && !variant_is_null(value)) {
+          value = pmr_string{value_to_string(data_type, value)};
+        }
+        matrix[row_offset + chunk_offset + 2][column_id] = value;
       }
     }
     row_offset += chunk->size();
@@ -143,16 +155,20 @@ bool check_table_equal(const std::shared_ptr<const Table>& opossum_table,
     right_column_type = expected_table->column_data_type(column_id);
     // This is needed for the SQLiteTestrunner, since SQLite does not differentiate between float/double, and int/long.
     if (type_cmp_mode == TypeCmpMode::Lenient) {
-      if (left_column_type == DataType::Double) {
+      if (left_column_type == DataType::Double || left_column_type == DataType::Decimal) {
         left_column_type = DataType::Float;
       } else if (left_column_type == DataType::Long) {
         left_column_type = DataType::Int;
+      } else if (is_date_time_data_type(left_column_type)) {
+        left_column_type = DataType::String;
       }
 
-      if (right_column_type == DataType::Double) {
+      if (right_column_type == DataType::Double || right_column_type == DataType::Decimal) {
         right_column_type = DataType::Float;
       } else if (right_column_type == DataType::Long) {
         right_column_type = DataType::Int;
+      } else if (is_date_time_data_type(right_column_type)) {
+        right_column_type = DataType::String;
       }
     }
 
@@ -57,6 +57,16 @@ class copyable_atomic {
     return _atomic.operator--(std::forward<Args>(args)...);
   }
 
+  template <typename... Args>
+  decltype(auto) fetch_or(Args&&... args) {
+    return _atomic.fetch_or(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  decltype(auto) fetch_and(Args&&... args) {
+    return _atomic.fetch_and(std::forward<Args>(args)...);
+  }
+
   template <typename... Args>
   bool exchange(Args&&... args) {
     return _atomic.exchange(std::forward<Args>(args)...);
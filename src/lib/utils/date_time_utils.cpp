@@ -0,0 +1,146 @@
+#include "date_time_utils.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto MICROSECONDS_PER_SECOND = int64_t{1'000'000};
+constexpr auto MICROSECONDS_PER_DAY = int64_t{86'400} * MICROSECONDS_PER_SECOND;
+
+bool is_leap_year(const int32_t year) { return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0; }
+
+uint32_t days_in_month(const int32_t year, const uint32_t month) {
+  static constexpr uint32_t DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return month == 2 && is_leap_year(year) ? 29 : DAYS_IN_MONTH[month - 1];
+}
+
+// Parses `count` digits starting at `offset`
+std::optional<uint32_t> parse_digits(const std::string& string, const size_t offset, const size_t count) {
+  if (offset + count > string.size()) return std::nullopt;
+
+  auto value = uint32_t{0};
+  for (auto index = offset; index < offset + count; ++index) {
+    if (string[index] < '0' || string[index] > '9') return std::nullopt;
+    value = value * 10 + static_cast<uint32_t>(string[index] - '0');
+  }
+  return value;
+}
+
+// Floor division, so that times before 1970 belong to the previous day
+int64_t floor_divide(const int64_t dividend, const int64_t divisor) {
+  return dividend / divisor - (dividend % divisor != 0 && (dividend < 0) != (divisor < 0));
+}
+
+}  // namespace
+
+namespace opossum {
+
+int32_t days_from_civil(const CivilDate& civil_date) {
+  const auto year = civil_date.month <= 2 ? civil_date.year - 1 : civil_date.year;
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto year_of_era = static_cast<uint32_t>(year - era * 400);
+  const auto day_of_year = (153 * (civil_date.month + (civil_date.month > 2 ? -3 : 9)) + 2) / 5 + civil_date.day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<int32_t>(day_of_era) - 719468;
+}
+
+CivilDate civil_from_days(const int32_t days) {
+  const auto shifted_days = days + 719468;
+  const auto era = (shifted_days >= 0 ? shifted_days : shifted_days - 146096) / 146097;
+  const auto day_of_era = static_cast<uint32_t>(shifted_days - era * 146097);
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto month_index = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * month_index + 2) / 5 + 1;
+  const auto month = month_index < 10 ? month_index + 3 : month_index - 9;
+  const auto year = static_cast<int32_t>(year_of_era) + era * 400 + (month <= 2 ? 1 : 0);
+  return CivilDate{year, month, day};
+}
+
+std::optional<int32_t> string_to_date(const std::string& string) {
+  if (string.size() < 10 || string[4] != '-' || string[7] != '-') return std::nullopt;
+
+  const auto year = parse_digits(string, 0, 4);
+  const auto month = parse_digits(string, 5, 2);
+  const auto day = parse_digits(string, 8, 2);
+  if (!year || !month || !day || *month < 1 || *month > 12) return std::nullopt;
+  if (*day < 1 || *day > days_in_month(static_cast<int32_t>(*year), *month)) return std::nullopt;
+
+  // Only accept trailing characters that belong to a timestamp
+  if (string.size() > 10 && string[10] != ' ' && string[10] != 'T') return std::nullopt;
+
+  return days_from_civil(CivilDate{static_cast<int32_t>(*year), *month, *day});
+}
+
+std::optional<int64_t> string_to_timestamp(const std::string& string) {
+  const auto days = string_to_date(string);
+  if (!days) return std::nullopt;
+
+  auto microseconds = int64_t{*days} * MICROSECONDS_PER_DAY;
+  if (string.size() == 10) return microseconds;
+
+  const auto hour = parse_digits(string, 11, 2);
+  const auto minute = parse_digits(string, 14, 2);
+  const auto second = parse_digits(string, 17, 2);
+  if (!hour || !minute || !second || string[13] != ':' || string[16] != ':') return std::nullopt;
+  if (*hour > 23 || *minute > 59 || *second > 59) return std::nullopt;
+
+  microseconds += ((int64_t{*hour} * 60 + *minute) * 60 + *second) * MICROSECONDS_PER_SECOND;
+  if (string.size() == 19) return microseconds;
+
+  // Fractions of a second with up to six digits
+  const auto fraction_digits = string.size() - 20;
+  if (string[19] != '.' || fraction_digits == 0 || fraction_digits > 6) return std::nullopt;
+  const auto fraction = parse_digits(string, 20, fraction_digits);
+  if (!fraction) return std::nullopt;
+
+  auto fraction_microseconds = int64_t{*fraction};
+  for (auto digit = fraction_digits; digit < 6; ++digit) fraction_microseconds *= 10;
+  return microseconds + fraction_microseconds;
+}
+
+std::string date_to_string(const int32_t days) {
+  const auto civil_date = civil_from_days(days);
+
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", civil_date.year, civil_date.month, civil_date.day);
+  return buffer;
+}
+
+std::string timestamp_to_string(const int64_t microseconds) {
+  const auto days = floor_divide(microseconds, MICROSECONDS_PER_DAY);
+  const auto microseconds_of_day = microseconds - days * MICROSECONDS_PER_DAY;
+  const auto seconds_of_day = microseconds_of_day / MICROSECONDS_PER_SECOND;
+  const auto fraction = microseconds_of_day % MICROSECONDS_PER_SECOND;
+
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), " %02d:%02d:%02d", static_cast<int>(seconds_of_day / 3600),
+                static_cast<int>(seconds_of_day / 60 % 60), static_cast<int>(seconds_of_day % 60));
+  auto result = date_to_string(static_cast<int32_t>(days)) + buffer;
+
+  if (fraction != 0) {
+    std::snprintf(buffer, sizeof(buffer), ".%06d", static_cast<int>(fraction));
+    result += buffer;
+  }
+  return result;
+}
+
+AllTypeVariant date_time_from_string(const DataType data_type, const std::string& string) {
+  if (data_type == DataType::Date) {
+    const auto days = string_to_date(string);
+    AssertInput(days && string.size() == 10, "'" + string + "' is not a valid date (YYYY-MM-DD)");
+    return *days;
+  }
+
+  Assert(data_type == DataType::Timestamp, "Expected a Date or Timestamp");
+  const auto microseconds = string_to_timestamp(string);
+  AssertInput(microseconds, "'" + string + "' is not a valid timestamp (YYYY-MM-DD HH:MM:SS)");
+  return *microseconds;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * Conversions for the logical data types Date and Timestamp (see all_type_variant.hpp). Dates are stored as the number
+ * of days since 1970-01-01 (int32_t), timestamps as the number of microseconds since 1970-01-01 00:00:00 (int64_t).
+ * Both use the proleptic Gregorian calendar and no time zones. As the integers grow with time, comparisons, ranges, and
+ * the min/max statistics of Date and Timestamp columns work on the stored values.
+ */
+
+struct CivilDate {
+  int32_t year;
+  uint32_t month;  // [1, 12]
+  uint32_t day;    // [1, 31]
+};
+
+// Days since 1970-01-01, see http://howardhinnant.github.io/date_algorithms.html
+int32_t days_from_civil(const CivilDate& civil_date);
+CivilDate civil_from_days(const int32_t days);
+
+// "YYYY-MM-DD", std::nullopt if the string is not a valid date
+std::optional<int32_t> string_to_date(const std::string& string);
+
+// "YYYY-MM-DD[ HH:MM:SS[.ffffff]]" (or with a 'T' as separator), std::nullopt if the string is not a valid timestamp
+std::optional<int64_t> string_to_timestamp(const std::string& string);
+
+std::string date_to_string(const int32_t days);
+
+// "YYYY-MM-DD HH:MM:SS", followed by the fraction of the second if it is not zero
+std::string timestamp_to_string(const int64_t microseconds);
+
+// The stored value of a Date or Timestamp string. Throws an InvalidInputException if the string cannot be parsed.
+AllTypeVariant date_time_from_string(const DataType data_type, const std::string& string);
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#include "decimal_utils.hpp"
+
+#include <limits>
+#include <string>
+
+namespace opossum {
+
+std::optional<int64_t> string_to_decimal(const std::string& string) {
+  auto index = size_t{0};
+  const auto negative = !string.empty() && string[0] == '-';
+  if (!string.empty() && (string[0] == '-' || string[0] == '+')) ++index;
+
+  auto magnitude = DecimalIntermediate{0};
+  auto digit_count = size_t{0};
+  for (; index < string.size() && string[index] >= '0' && string[index] <= '9'; ++index, ++digit_count) {
+    magnitude = magnitude * 10 + (string[index] - '0');
+    if (magnitude > std::numeric_limits<int64_t>::max()) return std::nullopt;
+  }
+  magnitude *= DECIMAL_FACTOR;
+
+  if (index < string.size() && string[index] == '.') {
+    ++index;
+    auto place_value = DECIMAL_FACTOR;
+    for (; index < string.size() && string[index] >= '0' && string[index] <= '9'; ++index, ++digit_count) {
+      const auto digit = string[index] - '0';
+      if (place_value > 1) {
+        place_value /= 10;
+        magnitude += digit * place_value;
+      } else if (place_value == 1) {
+        // The first digit beyond the scale decides the rounding, all further digits are ignored
+        if (digit >= 5) ++magnitude;
+        place_value = 0;
+      }
+    }
+  }
+
+  if (digit_count == 0 || index != string.size() || magnitude > std::numeric_limits<int64_t>::max()) {
+    return std::nullopt;
+  }
+
+  return static_cast<int64_t>(negative ? -magnitude : magnitude);
+}
+
+std::string decimal_to_string(const int64_t decimal) {
+  // Negating INT64_MIN would overflow, so the magnitude is computed with 128 bits
+  const auto magnitude = decimal < 0 ? -DecimalIntermediate{decimal} : DecimalIntermediate{decimal};
+  const auto fraction = std::to_string(static_cast<int64_t>(magnitude % DECIMAL_FACTOR));
+
+  auto result = decimal < 0 ? std::string{"-"} : std::string{};
+  result += std::to_string(static_cast<uint64_t>(magnitude / DECIMAL_FACTOR));
+  result += '.';
+  result.append(DECIMAL_SCALE - fraction.size(), '0');
+  result += fraction;
+  return result;
+}
+
+}  // namespace opossum
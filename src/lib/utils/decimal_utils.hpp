@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace opossum {
+
+/**
+ * Decimal is a logical data type (see all_type_variant.hpp) for exact fixed-point numbers, e.g., prices. Its values are
+ * stored as int64_t, scaled by 10^DECIMAL_SCALE, i.e., 12.34 is stored as 123'400. Thus, Decimal columns use the
+ * segments, encodings (e.g., frame-of-reference), scans, and statistics of Long columns, and additions, subtractions,
+ * and comparisons of Decimals are plain integer operations.
+ *
+ * The scale is fixed for all Decimals. Four fractional digits hold the result of multiplying two values with two
+ * fractional digits (e.g., a price and a discount) exactly and leave room for values of up to ±922'337'203'685.
+ */
+constexpr auto DECIMAL_SCALE = uint32_t{4};
+constexpr auto DECIMAL_FACTOR = int64_t{10'000};
+
+__extension__ using DecimalIntermediate = __int128;
+
+// Divides and rounds half away from zero, as PostgreSQL does for numerics
+inline int64_t decimal_round_divide(const DecimalIntermediate dividend, const DecimalIntermediate divisor) {
+  auto quotient = dividend / divisor;
+  const auto remainder = dividend % divisor;
+  if (2 * (remainder < 0 ? -remainder : remainder) >= (divisor < 0 ? -divisor : divisor)) {
+    quotient += (dividend < 0) == (divisor < 0) ? 1 : -1;
+  }
+  return static_cast<int64_t>(quotient);
+}
+
+// The products and quotients of Decimals are computed with 128 bits, so that only the result has to fit into 64 bits
+inline int64_t decimal_multiply(const int64_t lhs, const int64_t rhs) {
+  return decimal_round_divide(DecimalIntermediate{lhs} * rhs, DECIMAL_FACTOR);
+}
+
+// The caller has to check for division by zero
+inline int64_t decimal_divide(const int64_t lhs, const int64_t rhs) {
+  return decimal_round_divide(DecimalIntermediate{lhs} * DECIMAL_FACTOR, rhs);
+}
+
+inline int64_t decimal_from_double(const double value) {
+  return static_cast<int64_t>(std::round(value * static_cast<double>(DECIMAL_FACTOR)));
+}
+
+inline double decimal_to_double(const int64_t decimal) {
+  return static_cast<double>(decimal) / static_cast<double>(DECIMAL_FACTOR);
+}
+
+// "[+-]digits[.digits]", std::nullopt if the string is not a valid number. Further fractional digits are rounded.
+std::optional<int64_t> string_to_decimal(const std::string& string);
+
+// Always prints DECIMAL_SCALE fractional digits, e.g., "-12.3400"
+std::string decimal_to_string(const int64_t decimal);
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+struct SQLPipelineStatementMetrics;
+
+/**
+ * A hook that calls the subscribed callbacks with the given arguments whenever an event is fired. Firing does not take
+ * any locks: The callbacks are held in a fixed number of atomic slots, and without subscribers, firing only reads a
+ * counter. Callbacks are called by the thread that fires the event and must be thread-safe.
+ *
+ * Subscribing and unsubscribing are rare (e.g., when a plugin is started or stopped) and serialized by a mutex.
+ * unsubscribe() waits for the running calls of the callback to finish, so that its code (e.g., of a plugin) can be
+ * unloaded afterwards. For this, firing threads count themselves in one of two counters, selected by the current
+ * epoch. unsubscribe() removes the callback from its slot, then twice flips the epoch and waits for the counter of the
+ * previous epoch to become zero. Calls that started after the removal do not see the callback anymore. As new calls
+ * are counted in the other counter, the waiting cannot be starved by a stream of new calls.
+ */
+template <typename... Arguments>
+class ExecutionHook : public Noncopyable {
+ public:
+  using Callback = std::function<void(Arguments...)>;
+
+  static constexpr auto MAX_SUBSCRIBER_COUNT = size_t{16};
+
+  ExecutionHook() = default;
+
+  ~ExecutionHook() {
+    for (auto& slot : _slots) delete slot.load();
+  }
+
+  // Returns the ID of the subscription, which is needed to unsubscribe
+  size_t subscribe(const Callback& callback) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto subscription_id = size_t{0}; subscription_id < MAX_SUBSCRIBER_COUNT; ++subscription_id) {
+      if (_slots[subscription_id].load()) continue;
+
+      _slots[subscription_id] = new Callback(callback);
+      ++_subscriber_count;
+      return subscription_id;
+    }
+    Fail("Too many subscribers for this hook");
+  }
+
+  void unsubscribe(const size_t subscription_id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Assert(subscription_id < MAX_SUBSCRIBER_COUNT, "Invalid subscription ID");
+    auto* const callback = _slots[subscription_id].exchange(nullptr);
+    Assert(callback, "Subscription does not exist");
+    --_subscriber_count;
+
+    for (auto flip = 0; flip < 2; ++flip) {
+      const auto previous_epoch = _epoch.fetch_xor(1);
+      while (_running_call_counts[previous_epoch].load() > 0) std::this_thread::yield();
+    }
+    delete callback;
+  }
+
+  bool has_subscribers() const { return _subscriber_count.load(std::memory_order_relaxed) > 0; }
+
+  void fire(Arguments... arguments) const {
+    if (!has_subscribers()) return;
+
+    const auto epoch = _epoch.load();
+    ++_running_call_counts[epoch];
+    for (const auto& slot : _slots) {
+      if (const auto* const callback = slot.load()) (*callback)(arguments...);
+    }
+    --_running_call_counts[epoch];
+  }
+
+ private:
+  std::array<std::atomic<Callback*>, MAX_SUBSCRIBER_COUNT> _slots{};
+  std::atomic<size_t> _subscriber_count{0};
+
+  std::atomic<uint32_t> _epoch{0};
+  mutable std::array<std::atomic<size_t>, 2> _running_call_counts{};
+
+  std::mutex _mutex;
+};
+
+/**
+ * Events in the execution of queries and transactions, e.g., for plugins that tune the database or monitor it (see
+ * TuningPlugin). Unlike polling the state of the database, subscribers see every event, and without subscribers, the
+ * hooks cost a single atomic load.
+ */
+class ExecutionHooks : public Singleton<ExecutionHooks> {
+ public:
+  // Called with the SQL string when SQLPipelineStatement::get_result_table() starts the execution of the statement
+  ExecutionHook<const std::string&> statement_started;
+
+  // Called with the SQL string, the root of the executed PQP, and the metrics after the statement was executed (and
+  // committed, if it is auto-committed). The operators of the PQP hold their OperatorPerformanceData.
+  ExecutionHook<const std::string&, const std::shared_ptr<const AbstractOperator>&, const SQLPipelineStatementMetrics&>
+      statement_finished;
+
+  // Called by the executing thread after an operator was executed, including the operators of fused pipelines
+  ExecutionHook<const AbstractOperator&> operator_finished;
+
+  // Called once a transaction is committed with its transaction ID and the commit ID at which its changes became
+  // visible. For read-only transactions, this is their snapshot commit ID.
+  ExecutionHook<TransactionID, CommitID> transaction_committed;
+
+ protected:
+  friend class Singleton<ExecutionHooks>;
+
+  ExecutionHooks() = default;
+};
+
+}  // namespace opossum
@@ -0,0 +1,194 @@
+#include "hardware_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::atomic_bool counting_enabled{false};
+
+// Formats large counts like 1.2G, as the exact numbers are not meaningful
+std::string format_count(const uint64_t count) {
+  auto stream = std::stringstream{};
+  stream.precision(3);
+  if (count >= 1'000'000'000) {
+    stream << static_cast<double>(count) / 1e9 << "G";
+  } else if (count >= 1'000'000) {
+    stream << static_cast<double>(count) / 1e6 << "M";
+  } else if (count >= 1'000) {
+    stream << static_cast<double>(count) / 1e3 << "K";
+  } else {
+    stream << count;
+  }
+  return stream.str();
+}
+
+#ifdef __linux__
+
+uint64_t cache_event(const uint64_t cache, const uint64_t operation, const uint64_t result) {
+  return cache | (operation << 8) | (result << 16);
+}
+
+// The perf event group of a thread. The first counter (cycles) leads the group, so that all counters are scheduled
+// together and can be read with a single read().
+class ThreadCounterGroup : private Noncopyable {
+ public:
+  ThreadCounterGroup() {
+    const auto events = std::array<std::pair<uint32_t, uint64_t>, HardwareCounterValues::COUNTER_COUNT>{
+        {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+         {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+         {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+         {PERF_TYPE_HW_CACHE,
+          cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+         {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}}};
+
+    for (auto counter_id = size_t{0}; counter_id < events.size(); ++counter_id) {
+      auto attributes = perf_event_attr{};
+      attributes.size = sizeof(perf_event_attr);
+      attributes.type = events[counter_id].first;
+      attributes.config = events[counter_id].second;
+      attributes.disabled = _group_fd == -1 ? 1 : 0;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      // Counts the calling thread on any CPU
+      const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, _group_fd, 0));
+      if (fd == -1) {
+        // Without the group leader, nothing can be counted. Other counters might be missing on some CPUs.
+        if (_group_fd == -1) return;
+        continue;
+      }
+
+      if (_group_fd == -1) _group_fd = fd;
+      _fds.emplace_back(fd);
+      _counter_ids.emplace_back(counter_id);
+    }
+
+    ioctl(_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  ~ThreadCounterGroup() {
+    for (const auto fd : _fds) close(fd);
+  }
+
+  std::optional<HardwareCounterValues> read() const {
+    if (_group_fd == -1) return std::nullopt;
+
+    // Layout of PERF_FORMAT_GROUP: number of counters, time enabled, time running, one value per counter
+    auto buffer = std::array<uint64_t, 3 + HardwareCounterValues::COUNTER_COUNT>{};
+    const auto expected_size = static_cast<ssize_t>((3 + _counter_ids.size()) * sizeof(uint64_t));
+    if (::read(_group_fd, buffer.data(), sizeof(buffer)) != expected_size) return std::nullopt;
+
+    const auto time_enabled = buffer[1];
+    const auto time_running = buffer[2];
+
+    // If there are more counters than hardware registers, the kernel multiplexes them and the counts are extrapolated
+    const auto scale = time_running > 0 ? static_cast<double>(time_enabled) / static_cast<double>(time_running) : 0.0;
+
+    auto values = HardwareCounterValues{};
+    for (auto index = size_t{0}; index < _counter_ids.size(); ++index) {
+      values.values[_counter_ids[index]] = static_cast<uint64_t>(std::llround(static_cast<double>(buffer[3 + index]) *
+                                                                              scale));
+    }
+    return values;
+  }
+
+ private:
+  int _group_fd = -1;
+  std::vector<int> _fds;
+  // Indices into HardwareCounterValues::values of the counters that could be opened, in the order they are read
+  std::vector<size_t> _counter_ids;
+};
+
+#endif
+
+}  // namespace
+
+namespace opossum {
+
+const std::array<const char*, HardwareCounterValues::COUNTER_COUNT> HardwareCounterValues::COUNTER_NAMES = {
+    "cycles", "instructions", "llc_misses", "dtlb_misses", "branch_misses"};
+
+HardwareCounterValues& HardwareCounterValues::operator+=(const HardwareCounterValues& rhs) {
+  for (auto counter_id = size_t{0}; counter_id < COUNTER_COUNT; ++counter_id) {
+    values[counter_id] += rhs.values[counter_id];
+  }
+  return *this;
+}
+
+std::string HardwareCounterValues::to_string() const {
+  auto stream = std::stringstream{};
+  stream << format_count((*this)[HardwareCounter::Cycles]) << " cycles, "
+         << format_count((*this)[HardwareCounter::Instructions]) << " instructions";
+  if ((*this)[HardwareCounter::Cycles] > 0) {
+    stream.precision(3);
+    stream << " (IPC "
+           << static_cast<double>((*this)[HardwareCounter::Instructions]) /
+                  static_cast<double>((*this)[HardwareCounter::Cycles])
+           << ")";
+  }
+  stream << ", " << format_count((*this)[HardwareCounter::LlcMisses]) << " LLC misses, "
+         << format_count((*this)[HardwareCounter::DtlbMisses]) << " dTLB misses, "
+         << format_count((*this)[HardwareCounter::BranchMisses]) << " branch misses";
+  return stream.str();
+}
+
+void HardwareCounters::enable(const bool enabled) { counting_enabled = enabled; }
+
+bool HardwareCounters::is_enabled() { return counting_enabled; }
+
+std::optional<HardwareCounterValues> HardwareCounters::read_this_thread() {
+  if (!counting_enabled) return std::nullopt;
+
+#ifdef __linux__
+  static thread_local const auto thread_counter_group = ThreadCounterGroup{};
+
+  const auto values = thread_counter_group.read();
+  if (!values) {
+    static auto warning_printed = std::atomic_bool{false};
+    if (!warning_printed.exchange(true)) {
+      std::cerr << "Hardware counters are not available, check /proc/sys/kernel/perf_event_paranoid" << std::endl;
+    }
+  }
+  return values;
+#else
+  return std::nullopt;
+#endif
+}
+
+HardwareCounterScope::HardwareCounterScope(std::optional<HardwareCounterValues>& values)
+    : _values(values), _begin(HardwareCounters::read_this_thread()) {}
+
+HardwareCounterScope::~HardwareCounterScope() {
+  if (!_begin) return;
+
+  const auto end = HardwareCounters::read_this_thread();
+  if (!end) return;
+
+  auto difference = HardwareCounterValues{};
+  for (auto counter_id = size_t{0}; counter_id < HardwareCounterValues::COUNTER_COUNT; ++counter_id) {
+    // Extrapolated counts of multiplexed counters might decrease slightly
+    const auto begin_value = std::min(end->values[counter_id], _begin->values[counter_id]);
+    difference.values[counter_id] = end->values[counter_id] - begin_value;
+  }
+
+  if (!_values) _values.emplace();
+  *_values += difference;
+}
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Hardware events counted by HardwareCounters, in the order of HardwareCounterValues::values
+enum class HardwareCounter : uint8_t { Cycles, Instructions, LlcMisses, DtlbMisses, BranchMisses };
+
+struct HardwareCounterValues {
+  static constexpr auto COUNTER_COUNT = size_t{5};
+  static const std::array<const char*, COUNTER_COUNT> COUNTER_NAMES;
+
+  uint64_t operator[](const HardwareCounter counter) const { return values[static_cast<size_t>(counter)]; }
+
+  HardwareCounterValues& operator+=(const HardwareCounterValues& rhs);
+
+  // E.g., "1.2G cycles, 2.3G instructions (IPC 1.92), 4M LLC misses, 10K dTLB misses, 1M branch misses"
+  std::string to_string() const;
+
+  // Counters that are not supported by the CPU (e.g., in virtual machines) remain zero
+  std::array<uint64_t, COUNTER_COUNT> values{};
+};
+
+/**
+ * Counts hardware events (cycles, instructions, last-level cache misses, dTLB misses, and branch misses) with
+ * perf_event_open(), so that we can tell whether a regression comes from cache misses, branch mispredictions, or more
+ * instructions. Counting is disabled by default. If enabled, each thread opens a group of counters for itself on its
+ * first read, which then counts in user space until the thread exits. Reading the counters of the own thread is a
+ * single read() system call.
+ *
+ * AbstractOperator::execute() reads the counters of its thread before and after the operator is executed and stores
+ * the difference in its OperatorPerformanceData. Jobs that the operator schedules and that other workers execute are
+ * not included. SQLPipelineStatement sums up the counters of the operators in SQLPipelineStatementMetrics.
+ *
+ * Counters are only available on Linux and if perf events are permitted (see /proc/sys/kernel/perf_event_paranoid).
+ * Otherwise, read_this_thread() returns std::nullopt.
+ */
+class HardwareCounters {
+ public:
+  static void enable(const bool enabled = true);
+  static bool is_enabled();
+
+  // Returns the counts of this thread since it opened its counters, or std::nullopt if counting is disabled or not
+  // available. The counts are scaled up if the kernel had to multiplex the counters.
+  static std::optional<HardwareCounterValues> read_this_thread();
+};
+
+// Adds the events counted by this thread during the lifetime of the scope to @param values, if counting is enabled
+class HardwareCounterScope : private Noncopyable {
+ public:
+  explicit HardwareCounterScope(std::optional<HardwareCounterValues>& values);
+  ~HardwareCounterScope();
+
+ private:
+  std::optional<HardwareCounterValues>& _values;
+  const std::optional<HardwareCounterValues> _begin;
+};
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 #include "storage/table.hpp"
 
 #include "constant_mappings.hpp"
+#include "logical_data_types.hpp"
 #include "string_utils.hpp"
 
 namespace opossum {
@@ -57,8 +58,11 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     auto variant_values = std::vector<AllTypeVariant>(string_values.size());
 
     for (auto column_id = ColumnID{0}; column_id < string_values.size(); ++column_id) {
+      const auto column_data_type = table->column_data_type(column_id);
       if (table->column_is_nullable(column_id) && string_values[column_id] == "null") {
         variant_values[column_id] = NULL_VALUE;
+      } else if (is_logical_data_type(column_data_type)) {
+        variant_values[column_id] = logical_value_from_string(column_data_type, string_values[column_id]);
       } else {
         variant_values[column_id] = AllTypeVariant{pmr_string{string_values[column_id]}};
       }
@@ -0,0 +1,32 @@
+#include "logical_data_types.hpp"
+
+#include <string>
+
+#include "boost/lexical_cast.hpp"
+
+#include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
+#include "utils/decimal_utils.hpp"
+
+namespace opossum {
+
+AllTypeVariant logical_value_from_string(const DataType data_type, const std::string& string) {
+  if (is_date_time_data_type(data_type)) return date_time_from_string(data_type, string);
+
+  Assert(data_type == DataType::Decimal, "Expected a logical data type");
+  const auto decimal = string_to_decimal(string);
+  AssertInput(decimal, "'" + string + "' is not a valid decimal");
+  return *decimal;
+}
+
+std::string value_to_string(const DataType data_type, const AllTypeVariant& value) {
+  if (!variant_is_null(value)) {
+    if (data_type == DataType::Date) return date_to_string(boost::get<int32_t>(value));
+    if (data_type == DataType::Timestamp) return timestamp_to_string(boost::get<int64_t>(value));
+    if (data_type == DataType::Decimal) return decimal_to_string(boost::get<int64_t>(value));
+  }
+
+  return boost::lexical_cast<std::string>(value);
+}
+
+}  // namespace opossum
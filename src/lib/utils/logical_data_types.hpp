@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * Conversions between strings and the stored values of the logical data types Date, Timestamp, and Decimal (see
+ * all_type_variant.hpp), e.g., for importing and printing tables. Values of other data types are passed through.
+ */
+
+// The stored value of the string. Throws an InvalidInputException if the string cannot be parsed.
+AllTypeVariant logical_value_from_string(const DataType data_type, const std::string& string);
+
+// Formats values of Date, Timestamp, and Decimal columns. Values of other data types are converted with lexical_cast.
+std::string value_to_string(const DataType data_type, const AllTypeVariant& value);
+
+}  // namespace opossum
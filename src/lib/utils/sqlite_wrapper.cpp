@@ -13,6 +13,8 @@
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/table.hpp"
+#include "utils/decimal_utils.hpp"
+#include "utils/logical_data_types.hpp"
 #include "utils/load_table.hpp"
 #include "utils/string_utils.hpp"
 
@@ -45,9 +47,13 @@ void SQLiteWrapper::create_table(const Table& table, const std::string& table_na
         break;
       case DataType::Float:
       case DataType::Double:
+      case DataType::Decimal:
         column_types.emplace_back("REAL");
         break;
       case DataType::String:
+      case DataType::Date:
+      case DataType::Timestamp:
+        // SQLite has no date type, but the formatted dates and timestamps compare like the values
         column_types.emplace_back("TEXT");
         break;
       case DataType::Null:
@@ -126,6 +132,17 @@ void SQLiteWrapper::create_table(const Table& table, const std::string& table_na
               sqlite3_bind_return_code = sqlite3_bind_text(insert_into_statement, sqlite_column_id, string_value.c_str(), static_cast<int>(string_value.size()), SQLITE_TRANSIENT);  // NOLINT
               // clang-format on
             } break;
+            case DataType::Date:
+            case DataType::Timestamp: {
+              const auto string_value = value_to_string(table.column_data_type(column_id), value);
+              // clang-format off
+              sqlite3_bind_return_code = sqlite3_bind_text(insert_into_statement, sqlite_column_id, string_value.c_str(), static_cast<int>(string_value.size()), SQLITE_TRANSIENT);  // NOLINT
+              // clang-format on
+            } break;
+            case DataType::Decimal:
+              sqlite3_bind_return_code = sqlite3_bind_double(insert_into_statement, sqlite_column_id,
+                                                             decimal_to_double(boost::get<int64_t>(value)));
+              break;
             case DataType::Null:
             case DataType::Bool:
               Fail("SQLiteWrapper: column type not supported.");
@@ -0,0 +1,116 @@
+#pragma once
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Scatters values into the partitions of a radix partitioning, as done by partition_radix_parallel() in JoinHash (and
+ * Aggregate, which uses it) and by the radix clustering of JoinSortMerge. Writing each value directly to its partition
+ * touches a different cache line, and with many partitions a different page, for almost every value. Instead, the
+ * values are collected in a cache-line-sized buffer per partition, which is written to the partition once it is full
+ * (software write-combining). On x86, full buffers are written with non-temporal stores if the destination is aligned
+ * to a cache line, which bypass the caches and save reading the destination before it is overwritten.
+ *
+ * Each thread uses its own instance. The destination of a partition is a contiguous range that is filled from the
+ * given pointer on. The values are only guaranteed to be written after flush(). Types that are not trivially copyable
+ * (e.g., strings) and types that fill half a cache line are written directly.
+ */
+template <typename T>
+class WriteCombiningScatter {
+ public:
+  static constexpr auto CACHE_LINE_SIZE = size_t{64};
+
+  explicit WriteCombiningScatter(std::vector<T*> destinations) : _destinations(std::move(destinations)) {
+    if constexpr (BUFFERED) {
+      _buffers.resize(_destinations.size());
+      _fill_counts.resize(_destinations.size());
+      _capacities.resize(_destinations.size(), VALUES_PER_BUFFER);
+
+      // Fill the first buffer of a partition only up to the next cache line boundary of its destination, so that all
+      // further buffers can be streamed to aligned cache lines
+      if constexpr (STREAMABLE) {
+        for (auto partition_id = size_t{0}; partition_id < _destinations.size(); ++partition_id) {
+          const auto misalignment = reinterpret_cast<uintptr_t>(_destinations[partition_id]) % CACHE_LINE_SIZE;
+          if (misalignment != 0 && misalignment % sizeof(T) == 0) {
+            _capacities[partition_id] = (CACHE_LINE_SIZE - misalignment) / sizeof(T);
+          }
+        }
+      }
+    }
+  }
+
+  void push(const size_t partition_id, const T& value) {
+    if constexpr (BUFFERED) {
+      auto& fill_count = _fill_counts[partition_id];
+      std::memcpy(_buffers[partition_id].bytes + fill_count * sizeof(T), &value, sizeof(T));
+      if (++fill_count == _capacities[partition_id]) _write_buffer(partition_id);
+    } else {
+      *_destinations[partition_id]++ = value;
+    }
+  }
+
+  // Writes the partially filled buffers to their partitions
+  void flush() {
+    if constexpr (BUFFERED) {
+      for (auto partition_id = size_t{0}; partition_id < _destinations.size(); ++partition_id) {
+        if (_fill_counts[partition_id] > 0) _write_buffer(partition_id);
+      }
+
+#if defined(__x86_64__)
+      // Non-temporal stores are weakly ordered, make them visible before other threads read the partitions
+      if constexpr (STREAMABLE) _mm_sfence();
+#endif
+    }
+  }
+
+ private:
+  static constexpr auto BUFFERED = std::is_trivially_copyable_v<T> && sizeof(T) <= CACHE_LINE_SIZE / 2;
+  static constexpr auto STREAMABLE = BUFFERED && CACHE_LINE_SIZE % sizeof(T) == 0;
+  static constexpr auto VALUES_PER_BUFFER = CACHE_LINE_SIZE / sizeof(T);
+
+  struct alignas(CACHE_LINE_SIZE) Buffer {
+    std::byte bytes[CACHE_LINE_SIZE];
+  };
+
+  void _write_buffer(const size_t partition_id) {
+    auto& destination = _destinations[partition_id];
+    const auto fill_count = _fill_counts[partition_id];
+    const auto& buffer = _buffers[partition_id];
+
+    auto streamed = false;
+#if defined(__x86_64__)
+    if constexpr (STREAMABLE) {
+      if (fill_count == VALUES_PER_BUFFER && reinterpret_cast<uintptr_t>(destination) % CACHE_LINE_SIZE == 0) {
+        auto* const target = reinterpret_cast<__m128i*>(destination);
+        const auto* const source = reinterpret_cast<const __m128i*>(buffer.bytes);
+        for (auto index = size_t{0}; index < CACHE_LINE_SIZE / sizeof(__m128i); ++index) {
+          _mm_stream_si128(target + index, _mm_load_si128(source + index));
+        }
+        streamed = true;
+      }
+    }
+#endif
+    if (!streamed) std::memcpy(static_cast<void*>(destination), buffer.bytes, fill_count * sizeof(T));
+
+    destination += fill_count;
+    _fill_counts[partition_id] = 0;
+    _capacities[partition_id] = VALUES_PER_BUFFER;
+  }
+
+  std::vector<T*> _destinations;
+  std::vector<Buffer> _buffers;
+  std::vector<size_t> _fill_counts;
+  std::vector<size_t> _capacities;
+};
+
+}  // namespace opossum
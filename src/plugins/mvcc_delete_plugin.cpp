@@ -0,0 +1,158 @@
+#include "mvcc_delete_plugin.hpp"
+
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const std::string MvccDeletePlugin::description() const {
+  return "Removes chunks whose rows were mostly invalidated by deletes and updates";
+}
+
+void MvccDeletePlugin::start() {
+  _loop_thread_logical_delete =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_LOGICAL_DELETE, [&](size_t) { _logical_delete_loop(); });
+  _loop_thread_physical_delete =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_PHYSICAL_DELETE, [&](size_t) { _physical_delete_loop(); });
+}
+
+void MvccDeletePlugin::stop() {
+  // The destructors of the PausableLoopThreads wait for the current iteration to finish
+  _loop_thread_logical_delete.reset();
+  _loop_thread_physical_delete.reset();
+
+  std::lock_guard<std::mutex> lock(_physical_delete_queue_mutex);
+  _physical_delete_queue = {};
+}
+
+void MvccDeletePlugin::_logical_delete_loop() {
+  // Rows with an end commit ID below or at the horizon are invisible to all active and future transactions
+  const auto lowest_snapshot_commit_id = TransactionManager::get().get_lowest_active_snapshot_commit_id();
+  const auto visibility_horizon =
+      lowest_snapshot_commit_id ? *lowest_snapshot_commit_id : TransactionManager::get().last_commit_id();
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    // The table might have been dropped in the meantime
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (table->has_mvcc() != UseMvcc::Yes) continue;
+
+    // The last chunk is still receiving inserts
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id + 1 < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->get_cleanup_commit_id()) continue;
+
+      // Chunks that were deleted as a whole (see Delete) have no visible rows to re-insert and are only removed
+      const auto chunk_end_cid = chunk->get_scoped_mvcc_data_lock()->chunk_end_cid.load();
+      if (chunk_end_cid != MvccData::MAX_COMMIT_ID) {
+        chunk->set_cleanup_commit_id(chunk_end_cid);
+        std::lock_guard<std::mutex> lock(_physical_delete_queue_mutex);
+        _physical_delete_queue.emplace(table, chunk_id);
+        continue;
+      }
+
+      if (!_chunk_qualifies_for_cleanup(*chunk, table->max_chunk_size(), visibility_horizon)) continue;
+
+      if (_try_logical_delete(table_name, chunk_id)) {
+        std::lock_guard<std::mutex> lock(_physical_delete_queue_mutex);
+        _physical_delete_queue.emplace(table, chunk_id);
+      }
+    }
+  }
+}
+
+void MvccDeletePlugin::_physical_delete_loop() {
+  std::lock_guard<std::mutex> lock(_physical_delete_queue_mutex);
+
+  while (!_physical_delete_queue.empty()) {
+    const auto& [table, chunk_id] = _physical_delete_queue.front();
+    const auto chunk = table->get_chunk(chunk_id);
+    DebugAssert(chunk && chunk->get_cleanup_commit_id(),
+                "Chunk scheduled for physical delete was not logically deleted");
+
+    // Transactions with a snapshot older than the cleanup commit ID might still access the chunk. As the queue is
+    // mostly ordered by the cleanup commit IDs (chunks deleted as a whole are queued later), the following chunks wait
+    // as well.
+    const auto lowest_snapshot_commit_id = TransactionManager::get().get_lowest_active_snapshot_commit_id();
+    if (lowest_snapshot_commit_id && *lowest_snapshot_commit_id < *chunk->get_cleanup_commit_id()) return;
+
+    table->remove_chunk(chunk_id);
+    _physical_delete_queue.pop();
+  }
+}
+
+bool MvccDeletePlugin::_chunk_qualifies_for_cleanup(const Chunk& chunk, const uint32_t max_chunk_size,
+                                                    const CommitID visibility_horizon) {
+  // Chunks of a different size are re-chunked. Those without rows are skipped, e.g., the empty chunk that an Insert
+  // appends before filling it.
+  const auto needs_rechunking = chunk.size() != max_chunk_size;
+  if (needs_rechunking && chunk.size() == 0) return false;
+
+  // Checking the invalid row count first avoids looking at the MVCC data of most chunks. It is an upper bound for the
+  // number of invisible rows, as it includes those that are still visible to older snapshots.
+  const auto threshold = needs_rechunking ? 0.0 : DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS * chunk.size();
+  if (chunk.invalid_row_count() < threshold) return false;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+
+  // Rows inserted by uncommitted transactions would be lost, as they are neither visible to the logical delete nor
+  // would later transactions look at the chunk anymore
+  auto invisible_row_count = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
+    if (mvcc_data->get_end_cid(chunk_offset) <= visibility_horizon) ++invisible_row_count;
+  }
+  return invisible_row_count >= threshold;
+}
+
+bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const ChunkID chunk_id) {
+  const auto table = StorageManager::get().get_table(table_name);
+  const auto chunk = table->get_chunk(chunk_id);
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  // Only look at the rows of the chunk
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  excluded_chunk_ids.reserve(table->chunk_count() - 1);
+  for (auto excluded_chunk_id = ChunkID{0}; excluded_chunk_id < table->chunk_count(); ++excluded_chunk_id) {
+    if (excluded_chunk_id != chunk_id) excluded_chunk_ids.emplace_back(excluded_chunk_id);
+  }
+
+  const auto get_table = std::make_shared<GetTable>(table_name);
+  get_table->set_excluded_chunk_ids(excluded_chunk_ids);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  // Updating the visible rows with their own values invalidates them in the chunk and appends them to the table
+  const auto update = std::make_shared<Update>(table_name, validate, validate);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+
+  if (update->execute_failed()) {
+    // A concurrent transaction modified one of the rows, the chunk is tried again in a later iteration
+    transaction_context->rollback();
+    return false;
+  }
+
+  transaction_context->commit();
+
+  // All rows of the chunk are now invalidated for transactions with a snapshot of at least the commit ID
+  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+  return true;
+}
+
+EXPORT_PLUGIN(MvccDeletePlugin)
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <utility>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Garbage collection for MVCC-invalidated rows. Deleted and updated rows stay in their chunk so that transactions with
+ * an older snapshot can still see them. Once most rows of a chunk are invisible to all transactions, cleaning the
+ * chunk happens in two steps:
+ *
+ *  1. Logical delete: Within a transaction, the rows of the chunk that are still visible are re-inserted at the end of
+ *     the table (i.e., updated with their own values). Then, the commit ID of that transaction is stored as the
+ *     cleanup commit ID of the chunk, from which on the GetTable operator skips the chunk.
+ *  2. Physical delete: As soon as no active transaction has a snapshot older than the cleanup commit ID, the chunk is
+ *     removed from the table, releasing its memory.
+ *
+ * Both steps run periodically in their own background thread. Rows are not compacted within their chunk, because this
+ * would change the RowIDs that concurrent transactions and their MVCC locks refer to.
+ *
+ * Chunks whose size differs from the max_chunk_size of their table (see Table::set_max_chunk_size()) are cleaned up
+ * regardless of their invalidated rows. Re-inserting their rows merges them into chunks of the configured size.
+ */
+class MvccDeletePlugin : public AbstractPlugin, public Singleton<MvccDeletePlugin> {
+ public:
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // A chunk is cleaned up once at least this share of its rows is invisible to all transactions
+  static constexpr auto DELETE_THRESHOLD_PERCENTAGE_INVALIDATED_ROWS = 0.9;
+
+  static constexpr auto IDLE_DELAY_LOGICAL_DELETE = std::chrono::milliseconds{1000};
+  static constexpr auto IDLE_DELAY_PHYSICAL_DELETE = std::chrono::milliseconds{1000};
+
+ protected:
+  friend class Singleton<MvccDeletePlugin>;
+  friend class MvccDeletePluginTest;
+
+  MvccDeletePlugin() = default;
+
+  // Looks for chunks that qualify for a cleanup and deletes them logically
+  void _logical_delete_loop();
+
+  // Physically deletes the logically deleted chunks that no active transaction can see anymore
+  void _physical_delete_loop();
+
+  // Returns whether enough rows of the chunk are invisible to all transactions with a snapshot of at least
+  // visibility_horizon or whether the chunk does not have the table's max_chunk_size. Only chunks that do not receive
+  // inserts anymore are considered.
+  static bool _chunk_qualifies_for_cleanup(const Chunk& chunk, uint32_t max_chunk_size,
+                                           CommitID visibility_horizon);
+
+  // Re-inserts the visible rows of the chunk at the end of the table and sets the cleanup commit ID of the chunk.
+  // Returns false if a concurrent transaction modified the chunk, in which case the attempt is rolled back.
+  static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete;
+  std::unique_ptr<PausableLoopThread> _loop_thread_physical_delete;
+
+  // Logically deleted chunks, waiting for their physical delete, in the order of their cleanup commit IDs
+  std::queue<std::pair<std::shared_ptr<Table>, ChunkID>> _physical_delete_queue;
+  std::mutex _physical_delete_queue_mutex;
+};
+
+}  // namespace opossum
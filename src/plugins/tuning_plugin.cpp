@@ -0,0 +1,460 @@
+#include "tuning_plugin.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "expression/pqp_column_expression.hpp"
+#include "operators/abstract_join_operator.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/execution_hooks.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::optional<uint64_t> output_row_count(const AbstractOperator& op) {
+  // The output of an operator executed by an OperatorTask might have been cleared already, see CleanupTemporaries
+  if (const auto output = op.get_output()) return output->row_count();
+  return op.performance_data().output_row_count;
+}
+
+// Returns the column of a predicate that compares a single column with values, e.g., `a < 5` or `a BETWEEN 3 AND 7`
+std::optional<ColumnID> scanned_column_id(const AbstractExpression& predicate) {
+  if (predicate.type != ExpressionType::Predicate) return std::nullopt;
+
+  auto column_id = std::optional<ColumnID>{};
+  for (const auto& argument : predicate.arguments) {
+    if (argument->type != ExpressionType::PQPColumn) continue;
+    if (column_id) return std::nullopt;
+    column_id = static_cast<const PQPColumnExpression&>(*argument).column_id;
+  }
+  return column_id;
+}
+
+std::shared_ptr<BaseValueSegment> to_value_segment(const DataType data_type, const bool nullable,
+                                                   const BaseSegment& segment) {
+  auto value_segment = std::shared_ptr<BaseValueSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = std::vector<ColumnDataType>{};
+    auto null_values = std::vector<bool>{};
+    values.reserve(segment.size());
+    if (nullable) null_values.reserve(segment.size());
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+      if (nullable) null_values.emplace_back(position.is_null());
+    });
+
+    if (nullable) {
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+  return value_segment;
+}
+
+EncodingType encoding_type_of(const BaseSegment& segment) {
+  const auto encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+  return encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+}
+
+size_t index_memory_usage(const Chunk& chunk) {
+  auto bytes = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    for (const auto& index : chunk.get_indices(std::vector<ColumnID>{column_id})) {
+      bytes += index->memory_consumption();
+    }
+  }
+  return bytes;
+}
+
+}  // namespace
+
+namespace opossum {
+
+const std::string TuningPlugin::description() const {
+  return "Creates indexes and re-encodes segments based on the executed queries";
+}
+
+void TuningPlugin::start() {
+  _subscription_id = ExecutionHooks::get().statement_finished.subscribe(
+      [&](const std::string&, const std::shared_ptr<const AbstractOperator>& root,
+          const SQLPipelineStatementMetrics&) { _observe_plan(root); });
+  _loop_thread_tuning = std::make_unique<PausableLoopThread>(IDLE_DELAY_TUNING, [&](size_t) { _tune(); });
+}
+
+void TuningPlugin::stop() {
+  // Waits for running calls of the callback to finish
+  if (_subscription_id) ExecutionHooks::get().statement_finished.unsubscribe(*_subscription_id);
+  _subscription_id.reset();
+
+  // The destructor of the PausableLoopThread waits for the current iteration to finish
+  _loop_thread_tuning.reset();
+
+  // The indexes that are still registered stay in place and are used by the queries as any other index
+  _remove_dropped_indexes();
+  _indexed_columns.clear();
+  _segment_memory_weights.clear();
+
+  std::lock_guard<std::mutex> lock(_column_usages_mutex);
+  _column_usages.clear();
+}
+
+void TuningPlugin::set_memory_budget(const size_t memory_budget_bytes) { _memory_budget_bytes = memory_budget_bytes; }
+
+size_t TuningPlugin::memory_budget() const { return _memory_budget_bytes; }
+
+std::optional<float> TuningPlugin::ColumnUsage::selectivity() const {
+  if (selectivity_sample_count == 0.0f) return std::nullopt;
+  return selectivity_sum / selectivity_sample_count;
+}
+
+void TuningPlugin::_observe_plan(const std::shared_ptr<const AbstractOperator>& root) {
+  auto scans = std::vector<std::pair<ColumnKey, std::optional<float>>>{};
+  auto joined_columns = std::vector<ColumnKey>{};
+
+  const auto record_scan = [&](const TableScan& table_scan, const std::optional<uint64_t>& output_rows) {
+    const auto column_id = scanned_column_id(*table_scan.predicate());
+    if (!column_id) return;
+
+    const auto column = _find_stored_column(table_scan.input_left(), *column_id);
+    if (!column) return;
+
+    const auto input_rows = table_scan.performance_data().input_row_count;
+    auto selectivity = std::optional<float>{};
+    if (output_rows && input_rows > 0) selectivity = static_cast<float>(*output_rows) / input_rows;
+    scans.emplace_back(*column, selectivity);
+  };
+
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  const auto visit = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+    if (!op || !visited_operators.emplace(op).second) return;
+
+    if (op->type() == OperatorType::UnionPositions && op->input_left()->type() == OperatorType::IndexScan &&
+        op->input_right()->type() == OperatorType::TableScan) {
+      // A predicate on an indexed column: The LQPTranslator executes it with an IndexScan on the indexed chunks and
+      // a TableScan on all other chunks. Their union holds the result of the predicate.
+      record_scan(static_cast<const TableScan&>(*op->input_right()), output_row_count(*op));
+      visited_operators.emplace(op->input_right());
+    } else if (op->type() == OperatorType::TableScan) {
+      record_scan(static_cast<const TableScan&>(*op), output_row_count(*op));
+    } else if (const auto join = std::dynamic_pointer_cast<const AbstractJoinOperator>(op)) {
+      if (const auto column = _find_stored_column(join->input_left(), join->column_ids().first)) {
+        joined_columns.emplace_back(*column);
+      }
+      if (const auto column = _find_stored_column(join->input_right(), join->column_ids().second)) {
+        joined_columns.emplace_back(*column);
+      }
+    }
+
+    self(self, op->input_left());
+    self(self, op->input_right());
+  };
+  visit(visit, root);
+
+  if (scans.empty() && joined_columns.empty()) return;
+
+  std::lock_guard<std::mutex> lock(_column_usages_mutex);
+  for (const auto& [column, selectivity] : scans) {
+    auto& column_usage = _column_usages[column];
+    ++column_usage.scan_count;
+    if (selectivity) {
+      column_usage.selectivity_sum += *selectivity;
+      ++column_usage.selectivity_sample_count;
+    }
+  }
+  for (const auto& column : joined_columns) {
+    ++_column_usages[column].join_count;
+  }
+}
+
+std::optional<TuningPlugin::ColumnKey> TuningPlugin::_find_stored_column(
+    const std::shared_ptr<const AbstractOperator>& op, const ColumnID column_id) {
+  auto current_op = op;
+  while (current_op) {
+    switch (current_op->type()) {
+      case OperatorType::GetTable:
+        return ColumnKey{static_cast<const GetTable&>(*current_op).table_name(), column_id};
+
+      // These operators output the columns of their (left) input
+      case OperatorType::TableScan:
+      case OperatorType::IndexScan:
+      case OperatorType::UnionPositions:
+      case OperatorType::Validate:
+        current_op = current_op->input_left();
+        break;
+
+      default:
+        return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
+void TuningPlugin::_tune() {
+  _remove_dropped_indexes();
+
+  auto column_usages = std::map<ColumnKey, ColumnUsage>{};
+  {
+    std::lock_guard<std::mutex> lock(_column_usages_mutex);
+    column_usages = _column_usages;
+
+    for (auto column_usage_it = _column_usages.begin(); column_usage_it != _column_usages.end();) {
+      auto& column_usage = column_usage_it->second;
+      column_usage.scan_count *= USAGE_DECAY;
+      column_usage.join_count *= USAGE_DECAY;
+      column_usage.selectivity_sum *= USAGE_DECAY;
+      column_usage.selectivity_sample_count *= USAGE_DECAY;
+
+      // Forget columns that have not been used for a long time
+      if (column_usage.scan_count + column_usage.join_count < 0.01f) {
+        column_usage_it = _column_usages.erase(column_usage_it);
+      } else {
+        ++column_usage_it;
+      }
+    }
+  }
+
+  // Unregister the indexes that are not selected anymore. The indexes of the chunks are removed in the next round.
+  const auto indexed_columns = _select_indexed_columns(column_usages);
+  auto& storage_manager = StorageManager::get();
+  auto changed_indexes = false;
+  for (auto column_it = _indexed_columns.begin(); column_it != _indexed_columns.end();) {
+    const auto& [table_name, column_id] = *column_it;
+    if (std::find(indexed_columns.cbegin(), indexed_columns.cend(), *column_it) != indexed_columns.cend()) {
+      ++column_it;
+      continue;
+    }
+
+    if (storage_manager.has_table(table_name)) {
+      storage_manager.get_table(table_name)->remove_index_info({column_id}, SegmentIndexType::GroupKey);
+      _dropped_indexed_columns.emplace_back(*column_it);
+    }
+    changed_indexes = true;
+    column_it = _indexed_columns.erase(column_it);
+  }
+
+  // Index and re-encode the immutable chunks
+  const auto exceeds_memory_budget = _estimate_memory_usage() > _memory_budget_bytes;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& table_name : storage_manager.table_names()) {
+    // The table might have been dropped in the meantime
+    if (!storage_manager.has_table(table_name)) continue;
+    const auto table = storage_manager.get_table(table_name);
+
+    auto indexed_column_ids = std::set<ColumnID>{};
+    for (const auto& column : indexed_columns) {
+      if (column.first == table_name) indexed_column_ids.emplace(column.second);
+    }
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable() || chunk->is_evicted()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>(
+          [&, table_name, table, chunk_id, indexed_column_ids]() {
+            _tune_chunk(table_name, table, chunk_id, column_usages, indexed_column_ids, exceeds_memory_budget);
+          },
+          SchedulePriority::Low));
+      jobs.back()->schedule();
+    }
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Register the new indexes once the chunks are indexed, so that the IndexScans of new plans find them
+  for (const auto& column : indexed_columns) {
+    if (_indexed_columns.count(column) || !storage_manager.has_table(column.first)) continue;
+
+    storage_manager.get_table(column.first)->add_index_info({{column.second}, INDEX_NAME, SegmentIndexType::GroupKey});
+    _indexed_columns.emplace(column);
+    changed_indexes = true;
+  }
+
+  // Cached plans were optimized and translated with the previous indexes
+  if (changed_indexes) {
+    SQLLogicalPlanCache::get().clear();
+    SQLPhysicalPlanCache::get().clear();
+  }
+}
+
+std::vector<TuningPlugin::ColumnKey> TuningPlugin::_select_indexed_columns(
+    const std::map<ColumnKey, ColumnUsage>& column_usages) const {
+  auto candidates = std::vector<std::pair<float, ColumnKey>>{};
+  for (const auto& [column, column_usage] : column_usages) {
+    const auto selectivity = column_usage.selectivity();
+    if (column_usage.scan_count < MIN_SCAN_COUNT_FOR_INDEX || !selectivity ||
+        *selectivity > MAX_SELECTIVITY_FOR_INDEX) {
+      continue;
+    }
+
+    // The benefit is approximated by the share of rows that the scans of the column skip
+    candidates.emplace_back(column_usage.scan_count * (1.0f - *selectivity), column);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  auto& storage_manager = StorageManager::get();
+
+  // The memory of the indexes of the plugin is assigned to the columns in the order of their benefit. Thus, columns
+  // indexed before might lose their index to more beneficial ones.
+  auto memory_usage = _estimate_memory_usage();
+  for (const auto& [table_name, column_id] : _indexed_columns) {
+    if (!storage_manager.has_table(table_name)) continue;
+    const auto table = storage_manager.get_table(table_name);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+      const auto index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id});
+      if (index) memory_usage -= std::min(memory_usage, index->memory_consumption());
+    }
+  }
+
+  auto indexed_columns = std::vector<ColumnKey>{};
+  for (const auto& [benefit, column] : candidates) {
+    const auto& [table_name, column_id] = column;
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (column_id >= table->column_count()) continue;
+
+    const auto index_memory = _estimate_index_memory(*table, column_id);
+    if (memory_usage + index_memory > _memory_budget_bytes) continue;
+
+    memory_usage += index_memory;
+    indexed_columns.emplace_back(column);
+  }
+
+  return indexed_columns;
+}
+
+void TuningPlugin::_tune_chunk(const std::string& table_name, const std::shared_ptr<Table>& table,
+                               const ChunkID chunk_id, const std::map<ColumnKey, ColumnUsage>& column_usages,
+                               const std::set<ColumnID>& indexed_column_ids, const bool exceeds_memory_budget) {
+  const auto chunk = table->get_chunk(chunk_id);
+  if (!chunk) return;
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto column_usage_it = column_usages.find({table_name, column_id});
+    const auto column_usage = column_usage_it != column_usages.cend() ? column_usage_it->second : ColumnUsage{};
+    const auto data_type = table->column_data_type(column_id);
+    const auto nullable = table->column_is_nullable(column_id);
+    const auto segment = chunk->get_segment(column_id);
+    const auto column_ids = std::vector<ColumnID>{column_id};
+
+    if (indexed_column_ids.count(column_id)) {
+      if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) continue;
+
+      // GroupKeyIndexes require dictionary segments. Other indexes would not match a re-encoded segment anymore.
+      if (!std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+        if (!chunk->get_indices(column_ids).empty()) continue;
+        chunk->replace_segment(column_id, encode_segment(EncodingType::Dictionary, data_type,
+                                                         to_value_segment(data_type, nullable, *segment)));
+      }
+      chunk->create_index<GroupKeyIndex>(column_ids);
+      continue;
+    }
+
+    const auto encoding_type = encoding_type_of(*segment);
+    if (encoding_type == EncodingType::GlobalDictionary || !chunk->get_indices(column_ids).empty()) continue;
+
+    const auto is_hot_column =
+        column_usage.scan_count + column_usage.join_count >= MIN_ACCESS_COUNT_FOR_HOT_COLUMN && !exceeds_memory_budget;
+    const auto memory_weight = is_hot_column ? HOT_COLUMN_MEMORY_WEIGHT : COLD_COLUMN_MEMORY_WEIGHT;
+
+    // Segments are only re-encoded when their column changes between hot and cold
+    const auto segment_key = std::make_tuple(table_name, chunk_id, column_id);
+    {
+      std::lock_guard<std::mutex> lock(_segment_memory_weights_mutex);
+      const auto memory_weight_it = _segment_memory_weights.find(segment_key);
+      if (memory_weight_it != _segment_memory_weights.cend() && memory_weight_it->second == memory_weight) continue;
+      _segment_memory_weights[segment_key] = memory_weight;
+    }
+
+    auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(segment);
+    if (!value_segment) value_segment = to_value_segment(data_type, nullable, *segment);
+
+    const auto encoding_spec = ChunkEncoder::select_segment_encoding(data_type, value_segment, {memory_weight});
+    if (encoding_spec.encoding_type == encoding_type) continue;
+
+    if (encoding_spec.encoding_type == EncodingType::Unencoded) {
+      chunk->replace_segment(column_id, std::const_pointer_cast<BaseValueSegment>(value_segment));
+    } else {
+      chunk->replace_segment(column_id, encode_segment(encoding_spec.encoding_type, data_type, value_segment,
+                                                       encoding_spec.vector_compression_type));
+    }
+  }
+}
+
+void TuningPlugin::_remove_dropped_indexes() {
+  auto& storage_manager = StorageManager::get();
+  for (const auto& [table_name, column_id] : _dropped_indexed_columns) {
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      const auto index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id});
+      if (index) chunk->remove_index(index);
+    }
+  }
+  _dropped_indexed_columns.clear();
+}
+
+size_t TuningPlugin::_estimate_index_memory(const Table& table, const ColumnID column_id) {
+  auto bytes = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->is_evicted()) continue;
+    if (chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id})) continue;
+
+    // Without a dictionary, every value is assumed to be distinct
+    const auto segment = chunk->get_segment(column_id);
+    const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+    const auto distinct_count = dictionary_segment ? dictionary_segment->unique_values_count() : segment->size();
+    bytes += BaseIndex::estimate_memory_consumption(SegmentIndexType::GroupKey, segment->size(),
+                                                    static_cast<ChunkOffset>(distinct_count), 0);
+  }
+  return bytes;
+}
+
+size_t TuningPlugin::_estimate_memory_usage() {
+  auto& storage_manager = StorageManager::get();
+  auto bytes = size_t{0};
+  for (const auto& table_name : storage_manager.table_names()) {
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    bytes += table->estimate_memory_usage();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk) bytes += index_memory_usage(*chunk);
+    }
+  }
+  return bytes;
+}
+
+EXPORT_PLUGIN(TuningPlugin)
+
+}  // namespace opossum
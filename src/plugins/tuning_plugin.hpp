@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Tunes the physical design of the stored tables to the executed workload. Every PQP executed by an
+ * SQLPipelineStatement is observed (see ExecutionHooks::statement_finished): for each column of a
+ * stored table, the plugin counts how often it is scanned and joined, and it averages the selectivity of the scans
+ * from the OperatorPerformanceData of the TableScans. The counts decay with every tuning round, so that the tuning
+ * follows changes of the workload.
+ *
+ * Periodically, a tuning round adapts the immutable chunks in the background:
+ *
+ *  - Indexes: Columns that are scanned frequently and selectively enough for an IndexScan get a GroupKeyIndex in every
+ *    chunk, their segments are dictionary-encoded if necessary. The index is also registered with the table, so that
+ *    the IndexScanRule considers it and newly added chunks are indexed as well. Columns are indexed in the order of
+ *    their benefit, as long as the memory of the tables and indexes stays within the memory budget. Indexes of
+ *    columns that lost their benefit (or the memory for it) are unregistered and the plan caches are cleared. As
+ *    plans that were translated before might still use them, the indexes are removed from the chunks one round later.
+ *  - Encodings: All other segments are re-encoded with the encoding chosen by ChunkEncoder::select_segment_encoding().
+ *    For columns that are scanned or joined frequently, scan speed is weighted higher than memory. For all other
+ *    columns, and for all columns while the tables exceed the memory budget, the smallest encoding is chosen.
+ *
+ * Only GroupKeyIndexes are created, as they are the only indexes used by IndexScans. Segments that are indexed by
+ * indexes not created by the plugin and segments of GlobalDictionary-encoded columns are not changed. The chunks are
+ * tuned by JobTasks with SchedulePriority::Low, so that they do not delay queries.
+ */
+class TuningPlugin : public AbstractPlugin, public Singleton<TuningPlugin> {
+ public:
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // The memory that the stored tables, including the indexes of their chunks, should not exceed. Unlimited by default.
+  void set_memory_budget(const size_t memory_budget_bytes);
+  size_t memory_budget() const;
+
+  static constexpr auto IDLE_DELAY_TUNING = std::chrono::milliseconds{10'000};
+
+  // Factor by which the usage counts of all columns are multiplied after each tuning round
+  static constexpr auto USAGE_DECAY = 0.5f;
+
+  // A column is indexed if it was scanned this often (after decay) with at most this average selectivity, which is
+  // the selectivity up to which the IndexScanRule chooses IndexScans
+  static constexpr auto MIN_SCAN_COUNT_FOR_INDEX = 10.0f;
+  static constexpr auto MAX_SELECTIVITY_FOR_INDEX = 0.01f;
+
+  // Segments of columns that are scanned or joined this often are encoded for scan speed
+  static constexpr auto MIN_ACCESS_COUNT_FOR_HOT_COLUMN = 2.0f;
+
+  // AutoEncodingSpec::memory_weight for the segments of frequently and of rarely used columns
+  static constexpr auto HOT_COLUMN_MEMORY_WEIGHT = 0.2f;
+  static constexpr auto COLD_COLUMN_MEMORY_WEIGHT = 1.0f;
+
+  static constexpr auto INDEX_NAME = "tuning_plugin";
+
+ protected:
+  friend class Singleton<TuningPlugin>;
+  friend class TuningPluginTest;
+
+  using ColumnKey = std::pair<std::string, ColumnID>;
+
+  struct ColumnUsage {
+    float scan_count{0.0f};
+    float join_count{0.0f};
+
+    // For the average selectivity of the scans whose performance data has row counts
+    float selectivity_sum{0.0f};
+    float selectivity_sample_count{0.0f};
+
+    std::optional<float> selectivity() const;
+  };
+
+  TuningPlugin() = default;
+
+  // Records the scans and joins of an executed PQP
+  void _observe_plan(const std::shared_ptr<const AbstractOperator>& root);
+
+  // Returns the stored column that the given column of an operator's output refers to, if the operators between it and
+  // the GetTable do not change the columns (i.e., are scans or Validates)
+  static std::optional<ColumnKey> _find_stored_column(const std::shared_ptr<const AbstractOperator>& op,
+                                                      const ColumnID column_id);
+
+  // Runs a tuning round
+  void _tune();
+
+  // Returns the columns to be indexed in the order of their benefit, as far as they fit into the memory budget
+  std::vector<ColumnKey> _select_indexed_columns(const std::map<ColumnKey, ColumnUsage>& column_usages) const;
+
+  // Creates the missing indexes and re-encodes the segments of an immutable chunk
+  void _tune_chunk(const std::string& table_name, const std::shared_ptr<Table>& table, const ChunkID chunk_id,
+                   const std::map<ColumnKey, ColumnUsage>& column_usages, const std::set<ColumnID>& indexed_column_ids,
+                   const bool exceeds_memory_budget);
+
+  // Removes the chunk indexes of columns that were unregistered in the previous round
+  void _remove_dropped_indexes();
+
+  // Estimated memory of a GroupKeyIndex on the column in all immutable chunks
+  static size_t _estimate_index_memory(const Table& table, const ColumnID column_id);
+
+  // Memory of the stored tables including the indexes of their chunks
+  static size_t _estimate_memory_usage();
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_tuning;
+  std::optional<size_t> _subscription_id;
+
+  std::map<ColumnKey, ColumnUsage> _column_usages;
+  std::mutex _column_usages_mutex;
+
+  // Columns whose indexes were created and registered by the plugin
+  std::set<ColumnKey> _indexed_columns;
+
+  // Columns whose indexes were unregistered, but not yet removed from the chunks
+  std::vector<ColumnKey> _dropped_indexed_columns;
+
+  // Memory weight that each re-encoded segment was last encoded with, to avoid re-encoding it in every round
+  std::map<std::tuple<std::string, ChunkID, ColumnID>, float> _segment_memory_weights;
+  std::mutex _segment_memory_weights_mutex;
+
+  std::atomic<size_t> _memory_budget_bytes{std::numeric_limits<size_t>::max()};
+};
+
+}  // namespace opossum
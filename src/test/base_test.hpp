@@ -6,13 +6,18 @@
 #include <vector>
 
 #include "cache/cache.hpp"
+#include "cache/query_result_cache.hpp"
+#include "cache/subplan_result_cache.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "expression/expression_functional.hpp"
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
 #include "operators/table_scan.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_compression_service.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
@@ -63,7 +68,11 @@ class BaseTestWithParam
    * GTest runs the destructor right after TearDown(): https://github.com/abseil/googletest/blob/master/googletest/docs/faq.md#should-i-use-the-constructordestructor-of-the-test-fixture-or-setupteardown
    */
   ~BaseTestWithParam() {
-    // Reset scheduler first so that all tasks are done before we kill the StorageManager
+    // Stop the background compression and reset scheduler first so that all tasks are done before we kill the
+    // StorageManager
+    ChunkCompressionService::get().stop();
+    ChunkCompressionService::get().set_auto_encoding_spec(std::nullopt);
+    WriteAheadLog::get().disable();
     CurrentScheduler::set(nullptr);
 
     PluginManager::reset();
@@ -72,6 +81,10 @@ class BaseTestWithParam
 
     SQLPhysicalPlanCache::get().clear();
     SQLLogicalPlanCache::get().clear();
+    SubplanResultCache::get().clear();
+    QueryResultCache::get().clear();
+    QueryResultCache::get().set_memory_budget(QueryResultCache::DEFAULT_MEMORY_BUDGET);
+    AdmissionController::get().set_global_budget(std::nullopt);
   }
 
   static std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
@@ -1,11 +1,17 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
+#include "cache/clock_cache.hpp"
+#include "cache/frequency_sketch.hpp"
 #include "cache/gdfs_cache.hpp"
 #include "cache/gds_cache.hpp"
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
 #include "cache/random_cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace opossum {
 
@@ -187,6 +193,33 @@ TEST(CachePolicyTest, GDFSCacheTest) {
   ASSERT_TRUE(cache.has(3));
 }
 
+TEST(CachePolicyTest, GDFSCacheTotalSize) {
+  GDFSCache<int, int> cache(10);
+
+  cache.set(1, 2, 1.0, 4.0);  // Fr=1, priority 0.25
+  cache.set(2, 4, 1.0, 1.0);  // Fr=1, priority 1
+  cache.set(3, 6, 1.0, 2.0);  // Fr=1, priority 0.5
+  ASSERT_EQ(7.0, cache.total_size());
+
+  cache.set(3, 6, 1.0, 3.0);  // Hit, size changes, Fr=2
+  ASSERT_EQ(8.0, cache.total_size());
+
+  cache.erase(2);
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_EQ(7.0, cache.total_size());
+  ASSERT_EQ(0.0, cache.inflation());
+
+  // Evicts 1 with the lowest priority
+  cache.evict_until_total_size(5.0);
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(3.0, cache.total_size());
+  ASSERT_EQ(0.25, cache.inflation());
+
+  cache.clear();
+  ASSERT_EQ(0.0, cache.total_size());
+}
+
 // Random Replacement Strategy
 TEST(CachePolicyTest, RandomCacheTest) {
   RandomCache<int, int> cache(3);
@@ -231,6 +264,146 @@ TEST(CachePolicyTest, RandomCacheTest) {
   ASSERT_EQ(53, cache.get(6));  // Hit.
 }
 
+// CLOCK Strategy
+TEST(CachePolicyTest, ClockCacheTest) {
+  ClockCache<int, int> cache(2);
+
+  cache.set(1, 2);  // Miss, insert 1.
+  cache.set(2, 4);  // Miss, insert 2.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_EQ(2, cache.get(1));  // Hit, reference 1.
+
+  cache.set(3, 6);  // Miss, clear the reference of 1 and evict 2.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  cache.set(4, 8);  // Miss, evict 1, which has not been referenced since.
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_TRUE(cache.has(4));
+
+  ASSERT_EQ(6, cache.get(3));  // Hit, reference 3.
+  ASSERT_EQ(8, cache.get(4));  // Hit, reference 4.
+
+  cache.set(5, 10);  // Miss, clear all references and evict 3.
+
+  ASSERT_FALSE(cache.has(3));
+  ASSERT_TRUE(cache.has(4));
+  ASSERT_TRUE(cache.has(5));
+}
+
+// Sharded Strategy
+TEST(CachePolicyTest, ShardedCacheTest) {
+  // Small caches use a single shard so that frequently used entries are not evicted from tiny shards
+  EXPECT_EQ((ShardedCache<int, int>{3}.shard_count()), 1u);
+
+  using ShardedIntCache = ShardedCache<int, int>;
+  ShardedIntCache cache(1024);
+  EXPECT_EQ(cache.shard_count(), ShardedIntCache::MaxShardCount);
+
+  for (auto key = 0; key < 1000; ++key) {
+    cache.set(key, 2 * key);
+  }
+  ASSERT_EQ(cache.size(), 1000u);
+  ASSERT_EQ(cache.try_get(17), 34);
+  ASSERT_EQ(cache.try_get(1001), std::nullopt);
+
+  // Shrinking redistributes the entries over fewer shards
+  cache.resize(64);
+  EXPECT_EQ(cache.shard_count(), 2u);
+  EXPECT_EQ(cache.capacity(), 64u);
+  EXPECT_EQ(cache.size(), 64u);
+}
+
+TEST(CachePolicyTest, ShardedCacheConcurrentAccess) {
+  Cache<int, int> cache;
+  cache.replace_cache_impl<ShardedCache<int, int>>(256);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto iteration = 0; iteration < 10'000; ++iteration) {
+        const auto key = (iteration * 7 + thread_id) % 512;
+        if (const auto value = cache.try_get(key)) {
+          ASSERT_EQ(*value, key + 1);
+        } else {
+          cache.set(key, key + 1);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_LE(cache.size(), 256u);
+}
+
+TEST(CachePolicyTest, FrequencySketch) {
+  FrequencySketch<int> sketch(4);
+
+  for (auto access = 0; access < 5; ++access) sketch.record(1);
+  sketch.record(2);
+
+  // The count-min sketch may overestimate, but never underestimates the frequencies
+  EXPECT_GE(sketch.estimate(1), 5u);
+  EXPECT_GE(sketch.estimate(2), 1u);
+  EXPECT_LT(sketch.estimate(2), sketch.estimate(1));
+
+  // After a sample of ten accesses per entry, the frequencies are halved
+  for (auto access = 0; access < 34; ++access) sketch.record(3);
+  EXPECT_LE(sketch.estimate(1), 3u);
+  EXPECT_EQ(sketch.estimate(3), FrequencySketch<int>::MaxFrequency / 2);
+
+  sketch.clear();
+  EXPECT_EQ(sketch.estimate(3), 0u);
+}
+
+TEST(CachePolicyTest, AdmissionFilterAndMetrics) {
+  Cache<int, int> cache(2);
+
+  cache.set(1, 10);
+  cache.set(2, 20);
+  for (auto lookup = 0; lookup < 3; ++lookup) {
+    EXPECT_EQ(cache.try_get(1), 10);
+    EXPECT_EQ(cache.try_get(2), 20);
+  }
+
+  // 3 was looked up less often than the entry that would be evicted
+  EXPECT_EQ(cache.try_get(3), std::nullopt);
+  cache.set(3, 30);
+  EXPECT_FALSE(cache.has(3));
+
+  // Updates of cached entries are not subject to the admission filter
+  cache.set(1, 11);
+  EXPECT_EQ(cache.get_entry(1), 11);
+
+  auto metrics = cache.metrics();
+  EXPECT_EQ(metrics.hits, 7u);
+  EXPECT_EQ(metrics.misses, 1u);
+  EXPECT_EQ(metrics.rejected_admissions, 1u);
+  EXPECT_EQ(metrics.evictions, 0u);
+
+  // Without the admission filter, the policy evicts an entry
+  cache.set_admission_filter_enabled(false);
+  cache.set(3, 30);
+  EXPECT_TRUE(cache.has(3));
+  EXPECT_EQ(cache.metrics().evictions, 1u);
+
+  cache.resize(1);
+  EXPECT_EQ(cache.metrics().evictions, 2u);
+
+  cache.reset_metrics();
+  metrics = cache.metrics();
+  EXPECT_EQ(metrics.hits + metrics.misses + metrics.rejected_admissions + metrics.evictions, 0u);
+}
+
 // Test the default cache (uses GDFS).
 TEST(CachePolicyTest, Iterators) {
   Cache<int, int> cache(2);
@@ -258,7 +431,7 @@ class CacheTest : public BaseTest {};
 
 // Here, all cache types are defined.
 using CacheTypes = ::testing::Types<LRUCache<int, int>, LRUKCache<2, int, int>, GDSCache<int, int>, GDFSCache<int, int>,
-                                    RandomCache<int, int>>;
+                                    RandomCache<int, int>, ClockCache<int, int>, ShardedCache<int, int>>;
 TYPED_TEST_CASE(CacheTest, CacheTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(CacheTest, Size) {
@@ -0,0 +1,157 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+
+#include "cache/query_result_cache.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class QueryResultCacheTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::String);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 8, UseMvcc::Yes);
+    for (auto a = int32_t{0}; a < 20; ++a) table->append({a, pmr_string{a % 2 == 0 ? "even" : "odd"}});
+    StorageManager::get().add_table("t", table);
+
+    const auto other_table = std::make_shared<Table>(column_definitions, TableType::Data, 8, UseMvcc::Yes);
+    StorageManager::get().add_table("other", other_table);
+  }
+
+  // Executes the statement with query result caching and returns its result and whether it was taken from the cache
+  std::pair<std::shared_ptr<const Table>, bool> execute(
+      const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql}.with_query_result_caching();
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    auto statement = builder.create_pipeline_statement();
+    const auto result = statement.get_result_table();
+    return {result, statement.metrics()->query_result_cache_hit};
+  }
+
+  const std::string sql = "SELECT a FROM t WHERE b = 'even' AND a > 5";
+};
+
+TEST_F(QueryResultCacheTest, RepeatedQueryIsAnsweredFromCache) {
+  auto& cache = QueryResultCache::get();
+
+  const auto [result, cache_hit] = execute(sql);
+  EXPECT_FALSE(cache_hit);
+  EXPECT_EQ(result->row_count(), 7u);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_GT(cache.memory_usage(), 0u);
+
+  const auto [cached_result, second_cache_hit] = execute(sql);
+  EXPECT_TRUE(second_cache_hit);
+  EXPECT_EQ(cached_result, result);
+  EXPECT_EQ(cache.hit_count(), 1u);
+
+  // Other statements are executed
+  const auto [other_result, other_cache_hit] = execute("SELECT a FROM t WHERE b = 'odd'");
+  EXPECT_FALSE(other_cache_hit);
+  EXPECT_EQ(other_result->row_count(), 10u);
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_F(QueryResultCacheTest, KeyContainsLiteralValues) {
+  const auto normalized_sql = normalize_sql_literals(sql);
+  ASSERT_TRUE(normalized_sql);
+
+  const auto other_normalized_sql = normalize_sql_literals("SELECT a FROM t WHERE b = 'even' AND a > 6");
+  EXPECT_EQ(normalized_sql->cache_key(), other_normalized_sql->cache_key());
+  EXPECT_NE(QueryResultCache::key(sql, normalized_sql),
+            QueryResultCache::key("SELECT a FROM t WHERE b = 'even' AND a > 6", other_normalized_sql));
+
+  // Statements that only differ in their literals share their plans, but not their results
+  auto execute_parameterized = [](const std::string& parameterized_sql) {
+    auto statement = SQLPipelineBuilder{parameterized_sql}
+                         .with_parameterized_plan_caching()
+                         .with_query_result_caching()
+                         .create_pipeline_statement();
+    const auto row_count = statement.get_result_table()->row_count();
+    return std::make_pair(row_count, statement.metrics()->query_result_cache_hit);
+  };
+
+  EXPECT_EQ(execute_parameterized(sql), std::make_pair(size_t{7}, false));
+  EXPECT_EQ(execute_parameterized("SELECT a FROM t WHERE b = 'even' AND a > 6"), std::make_pair(size_t{6}, false));
+  EXPECT_EQ(execute_parameterized(sql), std::make_pair(size_t{7}, true));
+}
+
+TEST_F(QueryResultCacheTest, ModificationsInvalidateResults) {
+  auto& cache = QueryResultCache::get();
+  execute(sql);
+
+  // A transaction that started before the modification still sees the old version of the table
+  const auto old_transaction_context = TransactionManager::get().new_transaction_context();
+
+  execute("INSERT INTO t VALUES (20, 'even')");
+  EXPECT_EQ(cache.size(), 1u);
+
+  const auto [result, cache_hit] = execute(sql);
+  EXPECT_FALSE(cache_hit);
+  EXPECT_EQ(result->row_count(), 8u);
+
+  EXPECT_TRUE(execute(sql).second);
+
+  const auto [old_result, old_cache_hit] = execute(sql, old_transaction_context);
+  EXPECT_FALSE(old_cache_hit);
+  EXPECT_EQ(old_result->row_count(), 7u);
+  old_transaction_context->commit();
+
+  // Modifications of tables that are not read by the statement do not invalidate its result
+  execute("INSERT INTO other VALUES (1, 'odd')");
+  EXPECT_TRUE(execute(sql).second);
+
+  // Neither do modifications that were not committed
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  execute("DELETE FROM t WHERE a = 20", transaction_context);
+  EXPECT_TRUE(execute(sql).second);
+
+  // The transaction sees its own delete, which is neither taken from nor put into the cache
+  const auto [own_result, own_cache_hit] = execute(sql, transaction_context);
+  EXPECT_FALSE(own_cache_hit);
+  EXPECT_EQ(own_result->row_count(), 7u);
+  transaction_context->rollback();
+
+  EXPECT_TRUE(execute(sql).second);
+}
+
+TEST_F(QueryResultCacheTest, ModifyingAndNonMvccStatementsAreNotCached) {
+  auto& cache = QueryResultCache::get();
+
+  execute("INSERT INTO other VALUES (1, 'odd')");
+  EXPECT_EQ(cache.size(), 0u);
+
+  SQLPipelineBuilder{sql}.disable_mvcc().with_query_result_caching().create_pipeline().get_result_table();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(QueryResultCacheTest, MemoryBudget) {
+  auto& cache = QueryResultCache::get();
+
+  execute(sql);
+  const auto result_bytes = cache.memory_usage();
+
+  // The results of both statements do not fit into the budget, so the one with the lower GDFS priority is evicted
+  cache.set_memory_budget(result_bytes + result_bytes / 2);
+  execute(sql);
+  execute("SELECT a FROM t WHERE b = 'odd' AND a > 5");
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_LE(cache.memory_usage(), cache.memory_budget());
+  EXPECT_TRUE(execute(sql).second);
+
+  // Results larger than the budget are not cached
+  cache.set_memory_budget(0);
+  EXPECT_EQ(cache.size(), 0u);
+  execute(sql);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+}  // namespace opossum
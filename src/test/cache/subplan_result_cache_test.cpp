@@ -0,0 +1,130 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "cache/subplan_result_cache.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class SubplanResultCacheTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto dim_column_definitions = TableColumnDefinitions{};
+    dim_column_definitions.emplace_back("id", DataType::Int);
+    dim_column_definitions.emplace_back("region", DataType::Int);
+    const auto dim = std::make_shared<Table>(dim_column_definitions, TableType::Data, 4, UseMvcc::Yes);
+    for (auto id = int32_t{0}; id < 10; ++id) dim->append({id, id % 2});
+    StorageManager::get().add_table("dim", dim);
+
+    auto fact_column_definitions = TableColumnDefinitions{};
+    fact_column_definitions.emplace_back("a", DataType::Int);
+    fact_column_definitions.emplace_back("dim_id", DataType::Int);
+    const auto fact = std::make_shared<Table>(fact_column_definitions, TableType::Data, 32, UseMvcc::Yes);
+    for (auto a = int32_t{0}; a < 110; ++a) fact->append({a, a % 11});
+    StorageManager::get().add_table("fact", fact);
+  }
+
+  // Executes the query with subplan result caching, without reusing the plans of earlier executions
+  std::shared_ptr<const Table> execute(const std::string& sql,
+                                       const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    SQLPhysicalPlanCache::get().clear();
+    SQLLogicalPlanCache::get().clear();
+
+    auto builder = SQLPipelineBuilder{sql}.with_subplan_result_caching();
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    return builder.create_pipeline().get_result_table();
+  }
+
+  const std::string subquery_sql = "SELECT * FROM fact WHERE dim_id IN (SELECT id FROM dim WHERE region = 1)";
+};
+
+TEST_F(SubplanResultCacheTest, UncorrelatedSubqueryResultIsReused) {
+  auto& cache = SubplanResultCache::get();
+
+  EXPECT_EQ(execute(subquery_sql)->row_count(), 50u);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+
+  // The LQP of the second execution is equal to, but not the same as, that of the first one
+  EXPECT_EQ(execute(subquery_sql)->row_count(), 50u);
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+
+  EXPECT_EQ(execute("SELECT * FROM fact WHERE dim_id IN (SELECT id FROM dim WHERE region = 0)")->row_count(), 50u);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+}
+
+TEST_F(SubplanResultCacheTest, SmallAggregateResultIsReused) {
+  const auto sql = std::string{"SELECT region, COUNT(*) FROM dim GROUP BY region"};
+
+  const auto result = execute(sql);
+  EXPECT_EQ(SubplanResultCache::get().hit_count(), 0u);
+
+  EXPECT_TABLE_EQ_UNORDERED(execute(sql), result);
+  EXPECT_EQ(SubplanResultCache::get().hit_count(), 1u);
+}
+
+TEST_F(SubplanResultCacheTest, ModificationsInvalidateResults) {
+  auto& cache = SubplanResultCache::get();
+  execute(subquery_sql);
+
+  // A transaction that started before the modification still sees the old version of the table
+  const auto old_transaction_context = TransactionManager::get().new_transaction_context();
+
+  execute("INSERT INTO dim VALUES (10, 1)");
+
+  EXPECT_EQ(execute(subquery_sql)->row_count(), 60u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+
+  EXPECT_EQ(execute(subquery_sql)->row_count(), 60u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+
+  EXPECT_EQ(execute(subquery_sql, old_transaction_context)->row_count(), 50u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+  old_transaction_context->commit();
+
+  // Modifications of tables that are not read by the subquery do not invalidate its result
+  execute("INSERT INTO fact VALUES (110, 1)");
+  EXPECT_EQ(execute(subquery_sql)->row_count(), 61u);
+  EXPECT_EQ(cache.hit_count(), 2u);
+}
+
+TEST_F(SubplanResultCacheTest, OwnModificationsAreNotCached) {
+  auto& cache = SubplanResultCache::get();
+  execute(subquery_sql);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  execute("INSERT INTO dim VALUES (10, 1)", transaction_context);
+
+  // The transaction sees its own insert, which is neither taken from nor put into the cache
+  EXPECT_EQ(execute(subquery_sql, transaction_context)->row_count(), 60u);
+  EXPECT_EQ(cache.hit_count(), 0u);
+  EXPECT_EQ(cache.size(), 1u);
+
+  transaction_context->rollback();
+
+  EXPECT_EQ(execute(subquery_sql)->row_count(), 50u);
+  EXPECT_EQ(cache.hit_count(), 1u);
+}
+
+TEST_F(SubplanResultCacheTest, LeastRecentlyUsedEntriesAreEvicted) {
+  auto& cache = SubplanResultCache::get();
+  cache.resize(1);
+
+  execute(subquery_sql);
+  execute("SELECT * FROM fact WHERE dim_id IN (SELECT id FROM dim WHERE region = 0)");
+  EXPECT_EQ(cache.size(), 1u);
+
+  execute(subquery_sql);
+  EXPECT_EQ(cache.hit_count(), 0u);
+
+  cache.resize(DefaultCacheCapacity);
+}
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/active_snapshot_commit_ids.hpp"
+
+namespace opossum {
+
+class ActiveSnapshotCommitIdsTest : public BaseTest {
+ protected:
+  void SetUp() override { _commit_ids = std::make_unique<ActiveSnapshotCommitIds>(); }
+
+  std::vector<CommitID> _sorted_commit_ids() const {
+    auto commit_ids = _commit_ids->commit_ids();
+    std::sort(commit_ids.begin(), commit_ids.end());
+    return commit_ids;
+  }
+
+  std::unique_ptr<ActiveSnapshotCommitIds> _commit_ids;
+};
+
+TEST_F(ActiveSnapshotCommitIdsTest, InsertAndErase) {
+  EXPECT_EQ(_commit_ids->lowest(), std::nullopt);
+
+  _commit_ids->insert(CommitID{7});
+  _commit_ids->insert(CommitID{5});
+  _commit_ids->insert(CommitID{7});
+  EXPECT_EQ(_commit_ids->lowest(), CommitID{5});
+  EXPECT_EQ(_sorted_commit_ids(), (std::vector<CommitID>{5, 7, 7}));
+
+  _commit_ids->erase(CommitID{5});
+  EXPECT_EQ(_commit_ids->lowest(), CommitID{7});
+
+  _commit_ids->erase(CommitID{7});
+  EXPECT_EQ(_commit_ids->lowest(), CommitID{7});
+
+  _commit_ids->erase(CommitID{7});
+  EXPECT_EQ(_commit_ids->lowest(), std::nullopt);
+  EXPECT_TRUE(_commit_ids->commit_ids().empty());
+
+  EXPECT_THROW(_commit_ids->erase(CommitID{7}), std::logic_error);
+}
+
+TEST_F(ActiveSnapshotCommitIdsTest, SharedSlots) {
+  // Commit ids that are SLOT_COUNT apart share a slot, so that the older one is stored in the overflow set
+  const auto slot_count = static_cast<CommitID>(ActiveSnapshotCommitIds::SLOT_COUNT);
+  const auto old_commit_id = CommitID{3};
+  const auto new_commit_id = old_commit_id + slot_count;
+  const auto newest_commit_id = old_commit_id + 2 * slot_count;
+
+  _commit_ids->insert(new_commit_id);
+  _commit_ids->insert(old_commit_id);
+  _commit_ids->insert(newest_commit_id);
+  EXPECT_EQ(_commit_ids->lowest(), old_commit_id);
+  EXPECT_EQ(_sorted_commit_ids(), (std::vector<CommitID>{old_commit_id, new_commit_id, newest_commit_id}));
+
+  // Once the slot is free, the next commit id takes it, even if the same id is in the overflow set
+  _commit_ids->erase(new_commit_id);
+  _commit_ids->insert(old_commit_id);
+  _commit_ids->erase(old_commit_id);
+  EXPECT_EQ(_commit_ids->lowest(), old_commit_id);
+
+  _commit_ids->erase(old_commit_id);
+  EXPECT_EQ(_commit_ids->lowest(), newest_commit_id);
+
+  _commit_ids->erase(newest_commit_id);
+  EXPECT_EQ(_commit_ids->lowest(), std::nullopt);
+}
+
+TEST_F(ActiveSnapshotCommitIdsTest, ConcurrentInsertAndErase) {
+  const auto thread_count = 8u;
+  const auto iteration_count = 10'000u;
+
+  // Each thread keeps its first commit id active and repeatedly inserts and erases others, some of which share slots
+  _commit_ids->insert(CommitID{1});
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      _commit_ids->insert(CommitID{10 + thread_id});
+      for (auto iteration = 0u; iteration < iteration_count; ++iteration) {
+        const auto commit_id = CommitID{2 + (iteration * 97 + thread_id) % 3'000};
+        _commit_ids->insert(commit_id);
+        EXPECT_EQ(_commit_ids->lowest(), CommitID{1});
+        _commit_ids->erase(commit_id);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  _commit_ids->erase(CommitID{1});
+  EXPECT_EQ(_commit_ids->lowest(), CommitID{10});
+  EXPECT_EQ(_commit_ids->commit_ids().size(), thread_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/cancellation_token.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/sort.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class CancellationTokenTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+};
+
+TEST_F(CancellationTokenTest, Cancel) {
+  auto token = CancellationToken{};
+  EXPECT_FALSE(token.is_cancelled());
+  EXPECT_NO_THROW(token.throw_if_cancelled());
+
+  token.cancel();
+  EXPECT_TRUE(token.is_cancelled());
+  EXPECT_THROW(token.throw_if_cancelled(), QueryCancelledException);
+}
+
+TEST_F(CancellationTokenTest, Timeout) {
+  auto token = CancellationToken{};
+  token.set_timeout(std::chrono::hours{1});
+  EXPECT_FALSE(token.is_cancelled());
+
+  token.set_timeout(std::chrono::milliseconds{1});
+  std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  EXPECT_TRUE(token.is_cancelled());
+  EXPECT_THROW(token.throw_if_cancelled(), QueryCancelledException);
+}
+
+TEST_F(CancellationTokenTest, CancelledOperatorsAreSkipped) {
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  const auto sort = std::make_shared<Sort>(get_table, ColumnID{0});
+
+  const auto token = std::make_shared<CancellationToken>();
+  sort->set_cancellation_token_recursively(token);
+  EXPECT_EQ(get_table->cancellation_token(), token);
+  EXPECT_FALSE(sort->is_cancelled());
+
+  token->cancel();
+  EXPECT_TRUE(get_table->is_cancelled());
+
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(sort, CleanupTemporaries::No));
+  EXPECT_FALSE(get_table->get_output());
+  EXPECT_FALSE(sort->get_output());
+}
+
+TEST_F(CancellationTokenTest, CancelledPipelineThrows) {
+  const auto token = std::make_shared<CancellationToken>();
+  token->cancel();
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM int_float ORDER BY a"}.with_cancellation_token(token)
+                          .create_pipeline_statement();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  // The statement rolled back its transaction
+  EXPECT_EQ(sql_pipeline.transaction_context()->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(CancellationTokenTest, CancelledTransactionThrows) {
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  transaction_context->cancellation_token().cancel();
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM int_float"}
+                          .with_transaction_context(transaction_context)
+                          .create_pipeline_statement();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+  EXPECT_EQ(transaction_context->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(CancellationTokenTest, UncancelledPipelineSucceeds) {
+  const auto token = std::make_shared<CancellationToken>();
+  token->set_timeout(std::chrono::hours{1});
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM int_float ORDER BY a"}.with_cancellation_token(token)
+                          .create_pipeline_statement();
+  EXPECT_TABLE_EQ_ORDERED(sql_pipeline.get_result_table(),
+                          load_table("resources/test_data/tbl/int_float_sorted.tbl", 2));
+}
+
+}  // namespace opossum
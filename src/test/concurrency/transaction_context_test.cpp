@@ -108,4 +108,40 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, ReadOnlyTransactionDoesNotGetCommitID) {
+  auto context = manager().new_transaction_context();
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto committed = false;
+  EXPECT_TRUE(context->commit_async([&committed](TransactionID) { committed = true; }));
+
+  EXPECT_TRUE(committed);
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+  EXPECT_THROW(context->commit_id(), std::logic_error);
+}
+
+TEST_F(TransactionContextTest, ReadOnlyTransactionDoesNotWaitForPendingTransactions) {
+  auto context_1 = manager().new_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+
+  auto context_2_committed = false;
+  auto commit_context_2 = [&]() {
+    context_2->commit_async([&context_2_committed](TransactionID) { context_2_committed = true; });
+
+    // context_1 has a commit ID but is not committed yet
+    EXPECT_TRUE(context_2_committed);
+    EXPECT_EQ(context_1->phase(), TransactionPhase::Committing);
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(commit_context_2);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  context_1->commit_async([](TransactionID) {});
+
+  EXPECT_EQ(context_1->commit_id(), manager().last_commit_id());
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+}
+
 }  // namespace opossum
@@ -1,20 +1,59 @@
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/commit_context.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "operators/abstract_read_write_operator.hpp"
 
 namespace opossum {
 
+class NoOpReadWriteOperator : public AbstractReadWriteOperator {
+ public:
+  NoOpReadWriteOperator() : AbstractReadWriteOperator(OperatorType::Mock) {}
+
+  const std::string name() const override { return "NoOpReadWriteOperator"; }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override {
+    context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
+    return nullptr;
+  }
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override {
+    Fail("Unexpected function call");
+  }
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override {}
+
+  void _on_commit_records(const CommitID cid) override {}
+
+  void _on_rollback_records() override {}
+};
+
 class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return TransactionManager::get()._active_snapshot_commit_ids;
+  static std::vector<CommitID> get_active_snapshot_commit_ids() {
+    return TransactionManager::get()._active_snapshot_commit_ids.commit_ids();
+  }
+
+  static bool is_active(const CommitID snapshot_commit_id) {
+    const auto active_snapshot_commit_ids = get_active_snapshot_commit_ids();
+    return std::find(active_snapshot_commit_ids.cbegin(), active_snapshot_commit_ids.cend(), snapshot_commit_id) !=
+           active_snapshot_commit_ids.cend();
   }
 
   static void register_transaction(CommitID snapshot_commit_id) {
@@ -23,6 +62,12 @@ class TransactionManagerTest : public BaseTest {
   static void deregister_transaction(CommitID snapshot_commit_id) {
     TransactionManager::get()._deregister_transaction(snapshot_commit_id);
   }
+
+  static std::shared_ptr<CommitContext> new_commit_context() { return TransactionManager::get()._new_commit_context(); }
+
+  static void try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
+    TransactionManager::get()._try_increment_last_commit_id(context);
+  }
 };
 
 /** Check if all active snapshot commit ids of uncommitted
@@ -47,30 +92,24 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(is_active(t1_snapshot_commit_id));
+  EXPECT_TRUE(is_active(t2_snapshot_commit_id));
+  EXPECT_TRUE(is_active(t3_snapshot_commit_id));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
 
   t1_context->commit();
   deregister_transaction(t1_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(is_active(t1_context->snapshot_commit_id()));
+  EXPECT_TRUE(is_active(t3_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t3_context->commit();
   deregister_transaction(t3_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(is_active(t2_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t2_context->commit();
@@ -85,4 +124,108 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   register_transaction(t3_snapshot_commit_id);
 }
 
+TEST_F(TransactionManagerTest, GroupCommit) {
+  auto& manager = TransactionManager::get();
+  const auto initial_last_commit_id = manager.last_commit_id();
+
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  const auto callback = [&](TransactionID transaction_id) { committed_transaction_ids.emplace_back(transaction_id); };
+
+  const auto first_context = new_commit_context();
+  const auto second_context = new_commit_context();
+  const auto third_context = new_commit_context();
+
+  // The later contexts cannot be committed before the first one
+  second_context->make_pending(TransactionID{2}, callback);
+  try_increment_last_commit_id(second_context);
+  third_context->make_pending(TransactionID{3}, callback);
+  try_increment_last_commit_id(third_context);
+
+  EXPECT_EQ(manager.last_commit_id(), initial_last_commit_id);
+  EXPECT_TRUE(committed_transaction_ids.empty());
+
+  // Committing the first context commits the waiting ones as well
+  first_context->make_pending(TransactionID{1}, callback);
+  try_increment_last_commit_id(first_context);
+
+  EXPECT_EQ(manager.last_commit_id(), third_context->commit_id());
+  const auto expected_transaction_ids =
+      std::vector<TransactionID>{TransactionID{1}, TransactionID{2}, TransactionID{3}};
+  EXPECT_EQ(committed_transaction_ids, expected_transaction_ids);
+}
+
+TEST_F(TransactionManagerTest, GroupCommitMaxGroupSize) {
+  auto& manager = TransactionManager::get();
+  manager.set_group_commit(2, std::chrono::microseconds{0});
+  EXPECT_EQ(manager.max_commit_group_size(), 2u);
+
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  const auto callback = [&](TransactionID transaction_id) { committed_transaction_ids.emplace_back(transaction_id); };
+
+  auto contexts = std::vector<std::shared_ptr<CommitContext>>{};
+  for (auto transaction_idx = size_t{0}; transaction_idx < 5; ++transaction_idx) {
+    contexts.emplace_back(new_commit_context());
+    if (transaction_idx > 0) contexts.back()->make_pending(TransactionID{transaction_idx + 1}, callback);
+  }
+
+  contexts.front()->make_pending(TransactionID{1}, callback);
+  try_increment_last_commit_id(contexts.front());
+
+  // All contexts are committed, even though they are split into multiple groups
+  EXPECT_EQ(manager.last_commit_id(), contexts.back()->commit_id());
+  EXPECT_EQ(committed_transaction_ids.size(), 5u);
+  EXPECT_TRUE(std::is_sorted(committed_transaction_ids.begin(), committed_transaction_ids.end()));
+}
+
+TEST_F(TransactionManagerTest, GroupCommitWindow) {
+  auto& manager = TransactionManager::get();
+  // Long enough to never pass in this test - the group is complete once the second context is pending
+  manager.set_group_commit(2, std::chrono::seconds{60});
+  EXPECT_EQ(manager.group_commit_window(), std::chrono::seconds{60});
+
+  const auto first_context = new_commit_context();
+  const auto second_context = new_commit_context();
+
+  auto second_committed = std::atomic<bool>{false};
+  first_context->make_pending(TransactionID{1});
+
+  auto second_thread = std::thread([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    second_context->make_pending(TransactionID{2}, [&](TransactionID) { second_committed = true; });
+    try_increment_last_commit_id(second_context);
+  });
+
+  // Waits for the second context and commits both
+  try_increment_last_commit_id(first_context);
+  second_thread.join();
+
+  EXPECT_EQ(manager.last_commit_id(), second_context->commit_id());
+  EXPECT_TRUE(second_committed);
+}
+
+TEST_F(TransactionManagerTest, GroupCommitWithTransactionContexts) {
+  auto& manager = TransactionManager::get();
+  manager.set_group_commit(4, std::chrono::microseconds{100});
+  const auto initial_last_commit_id = manager.last_commit_id();
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([]() {
+      for (auto transaction_idx = 0; transaction_idx < 10; ++transaction_idx) {
+        // Read-only transactions do not get a commit id, so each transaction registers an operator
+        auto context = TransactionManager::get().new_transaction_context();
+        auto read_write_operator = std::make_shared<NoOpReadWriteOperator>();
+        read_write_operator->set_transaction_context(context);
+        read_write_operator->execute();
+
+        EXPECT_TRUE(context->commit());
+      }
+    });
+  }
+
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(manager.last_commit_id(), initial_last_commit_id + 80);
+}
+
 }  // namespace opossum
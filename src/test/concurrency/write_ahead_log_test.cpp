@@ -0,0 +1,216 @@
+#include <unistd.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _directory = filesystem::temp_directory_path() / ("hyrise_write_ahead_log_test_" + std::to_string(getpid()));
+    filesystem::remove_all(_directory);
+
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+  }
+
+  void TearDown() override {
+    WriteAheadLog::get().disable();
+    filesystem::remove_all(_directory);
+  }
+
+  void _insert(const int32_t begin, const int32_t end) {
+    const auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    for (auto value = begin; value < end; ++value) {
+      values->append({value, value % 2 ? AllTypeVariant{pmr_string{"v" + std::to_string(value)}} : NULL_VALUE});
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>("t", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  void _delete_less_than(const int32_t value) {
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto get_table = std::make_shared<GetTable>("t");
+    get_table->set_transaction_context(context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    const auto a = get_column_expression(validate, ColumnID{0});
+    const auto table_scan = std::make_shared<TableScan>(validate, less_than_(a, value));
+    table_scan->set_transaction_context(context);
+    table_scan->execute();
+
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    context->commit();
+  }
+
+  std::shared_ptr<const Table> _visible_rows() {
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto get_table = std::make_shared<GetTable>("t");
+    get_table->set_transaction_context(context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  // Simulates a restart
+  void _restart() {
+    WriteAheadLog::get().disable();
+    StorageManager::reset();
+    TransactionManager::reset();
+  }
+
+  filesystem::path _directory;
+  TableColumnDefinitions _column_definitions;
+};
+
+TEST_F(WriteAheadLogTest, RecoverFromLog) {
+  WriteAheadLog::get().enable(_directory);
+  StorageManager::get().add_table("t", std::make_shared<Table>(_column_definitions, TableType::Data, 3, UseMvcc::Yes));
+
+  _insert(0, 10);
+  _insert(10, 12);
+  _delete_less_than(4);
+  EXPECT_GT(WriteAheadLog::get().flush_count(), 0u);
+
+  const auto expected_rows = _visible_rows();
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::get().recover(_directory), 3u);
+
+  ASSERT_TRUE(StorageManager::get().has_table("t"));
+  EXPECT_EQ(StorageManager::get().get_table("t")->max_chunk_size(), 3u);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+
+  // Rows inserted after the recovery are appended to the recovered table
+  WriteAheadLog::get().enable(_directory);
+  _insert(12, 13);
+  EXPECT_EQ(_visible_rows()->row_count(), expected_rows->row_count() + 1);
+}
+
+TEST_F(WriteAheadLogTest, RecoverFromCheckpointAndLog) {
+  WriteAheadLog::get().enable(_directory);
+  StorageManager::get().add_table("t", std::make_shared<Table>(_column_definitions, TableType::Data, 4, UseMvcc::Yes));
+  StorageManager::get().add_table("dropped",
+                                  std::make_shared<Table>(_column_definitions, TableType::Data, 4, UseMvcc::Yes));
+
+  _insert(0, 10);
+  _delete_less_than(2);
+  const auto checkpoint_commit_id = WriteAheadLog::get().checkpoint();
+  EXPECT_EQ(checkpoint_commit_id, TransactionManager::get().last_commit_id());
+
+  // Changes after the checkpoint, including the deletion of rows that are part of the checkpoint
+  _insert(10, 15);
+  _delete_less_than(5);
+  StorageManager::get().drop_table("dropped");
+
+  const auto expected_rows = _visible_rows();
+
+  _restart();
+  EXPECT_EQ(WriteAheadLog::get().recover(_directory), 2u);
+
+  EXPECT_FALSE(StorageManager::get().has_table("dropped"));
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+TEST_F(WriteAheadLogTest, CheckpointRemovesCoveredLogFiles) {
+  WriteAheadLog::get().enable(_directory);
+  StorageManager::get().add_table("t", std::make_shared<Table>(_column_definitions, TableType::Data, 4, UseMvcc::Yes));
+  _insert(0, 10);
+
+  WriteAheadLog::get().checkpoint();
+  WriteAheadLog::get().checkpoint();
+
+  // Only the latest checkpoint and the log file that was started with it remain
+  auto file_count = 0;
+  for ([[maybe_unused]] const auto& entry : filesystem::directory_iterator(_directory)) ++file_count;
+  EXPECT_EQ(file_count, 2);
+
+  const auto expected_rows = _visible_rows();
+  _restart();
+  EXPECT_EQ(WriteAheadLog::get().recover(_directory), 0u);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+TEST_F(WriteAheadLogTest, IgnoreIncompleteRecord) {
+  WriteAheadLog::get().enable(_directory);
+  StorageManager::get().add_table("t", std::make_shared<Table>(_column_definitions, TableType::Data, 4, UseMvcc::Yes));
+  _insert(0, 5);
+
+  const auto expected_rows = _visible_rows();
+  _restart();
+
+  // Simulate a crash while a record was written
+  for (const auto& entry : filesystem::directory_iterator(_directory)) {
+    auto stream = std::ofstream{entry.path(), std::ios::binary | std::ios::app};
+    stream << "incomplete record";
+  }
+
+  EXPECT_EQ(WriteAheadLog::get().recover(_directory), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+TEST_F(WriteAheadLogTest, RolledBackTransactionsAreNotRecovered) {
+  WriteAheadLog::get().enable(_directory);
+  StorageManager::get().add_table("t", std::make_shared<Table>(_column_definitions, TableType::Data, 4, UseMvcc::Yes));
+
+  {
+    const auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    values->append({1, NULL_VALUE});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>("t", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->rollback();
+  }
+  _insert(2, 4);
+
+  const auto expected_rows = _visible_rows();
+  _restart();
+  EXPECT_EQ(WriteAheadLog::get().recover(_directory), 1u);
+
+  // The rolled back row keeps its RowID as an invisible placeholder
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_rows);
+}
+
+}  // namespace opossum
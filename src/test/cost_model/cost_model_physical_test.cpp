@@ -0,0 +1,149 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_physical.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class CostModelPhysicalTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    Topology::use_non_numa_topology();
+
+    join_features.left.row_count = 100'000.0f;
+    join_features.right.row_count = 100'000.0f;
+    join_features.output_row_count = 100'000.0f;
+  }
+
+  void TearDown() override { Topology::use_default_topology(); }
+
+  CostModelPhysical cost_model;
+  JoinFeatures join_features;
+};
+
+TEST_F(CostModelPhysicalTest, UnsupportedJoins) {
+  join_features.predicate_condition = PredicateCondition::LessThan;
+  EXPECT_FALSE(cost_model.estimate_join_cost(JoinImplementation::Hash, join_features));
+  EXPECT_TRUE(cost_model.estimate_join_cost(JoinImplementation::MPSM, join_features));
+  EXPECT_TRUE(cost_model.estimate_join_cost(JoinImplementation::SortMerge, join_features));
+
+  // Without index on the right input, JoinIndex is not considered
+  EXPECT_FALSE(cost_model.estimate_join_cost(JoinImplementation::Index, join_features));
+
+  join_features.predicate_condition = PredicateCondition::Equals;
+  join_features.mode = JoinMode::Outer;
+  EXPECT_FALSE(cost_model.estimate_join_cost(JoinImplementation::Hash, join_features));
+
+  join_features.mode = JoinMode::Semi;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Hash);
+
+  // Non-equi semi joins are only supported by JoinMPSM
+  join_features.predicate_condition = PredicateCondition::LessThan;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::MPSM);
+
+  join_features.mode = JoinMode::Cross;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), std::nullopt);
+
+  join_features.mode = JoinMode::Inner;
+  join_features.data_types_match = false;
+  EXPECT_FALSE(cost_model.estimate_join_cost(JoinImplementation::SortMerge, join_features));
+}
+
+TEST_F(CostModelPhysicalTest, PreferHashJoinForEquiJoins) {
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Hash);
+
+  // Even if the inputs need not be sorted
+  join_features.left.presorted_share = 1.0f;
+  join_features.right.presorted_share = 1.0f;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Hash);
+}
+
+TEST_F(CostModelPhysicalTest, PresortedInputsAreCheaperToSortMergeJoin) {
+  join_features.predicate_condition = PredicateCondition::LessThan;
+  const auto unsorted_cost = cost_model.estimate_join_cost(JoinImplementation::SortMerge, join_features);
+
+  join_features.left.presorted_share = 0.5f;
+  const auto half_sorted_cost = cost_model.estimate_join_cost(JoinImplementation::SortMerge, join_features);
+
+  join_features.left.presorted_share = 1.0f;
+  join_features.right.presorted_share = 1.0f;
+  const auto sorted_cost = cost_model.estimate_join_cost(JoinImplementation::SortMerge, join_features);
+
+  EXPECT_LT(*half_sorted_cost, *unsorted_cost);
+  EXPECT_LT(*sorted_cost, *half_sorted_cost);
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::SortMerge);
+}
+
+TEST_F(CostModelPhysicalTest, PreferRangeJoinForUnsortedInequalityJoins) {
+  join_features.predicate_condition = PredicateCondition::LessThan;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Range);
+
+  // Only inner joins are supported
+  join_features.mode = JoinMode::Left;
+  EXPECT_FALSE(cost_model.estimate_join_cost(JoinImplementation::Range, join_features));
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::SortMerge);
+
+  join_features.mode = JoinMode::Inner;
+  join_features.predicate_condition = PredicateCondition::Equals;
+  EXPECT_FALSE(cost_model.estimate_join_cost(JoinImplementation::Range, join_features));
+}
+
+TEST_F(CostModelPhysicalTest, MPSMJoinOnlyPaysOffWithMultipleNumaNodes) {
+  join_features.mode = JoinMode::Outer;
+  const auto sort_merge_cost = cost_model.estimate_join_cost(JoinImplementation::SortMerge, join_features);
+  const auto mpsm_cost = cost_model.estimate_join_cost(JoinImplementation::MPSM, join_features);
+  EXPECT_LT(*sort_merge_cost, *mpsm_cost);
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::SortMerge);
+}
+
+TEST_F(CostModelPhysicalTest, PreferMPSMJoinForLargeInputsOnNumaMachines) {
+  auto nodes = std::vector<TopologyNode>{};
+  for (auto node_id = uint32_t{0}; node_id < 4; ++node_id) {
+    nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{node_id}}});
+  }
+  Topology::use_custom_topology(std::move(nodes));
+
+  join_features.mode = JoinMode::Outer;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::MPSM);
+
+  join_features.mode = JoinMode::Inner;
+  join_features.predicate_condition = PredicateCondition::LessThan;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::MPSM);
+
+  // Equi joins are still cheaper with JoinHash
+  join_features.predicate_condition = PredicateCondition::Equals;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Hash);
+
+  // For small inputs, the parallelization does not pay off
+  join_features.mode = JoinMode::Outer;
+  join_features.left.row_count = 1'000.0f;
+  join_features.right.row_count = 1'000.0f;
+  join_features.output_row_count = 1'000.0f;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::SortMerge);
+}
+
+TEST_F(CostModelPhysicalTest, PreferIndexJoinForSmallProbeSide) {
+  join_features.right.indexed_share = 1.0f;
+  join_features.right.indexed_chunk_count = 10.0f;
+
+  // Probing all indexes is more expensive than hashing when both inputs are large
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Hash);
+
+  join_features.left.row_count = 100.0f;
+  join_features.output_row_count = 100.0f;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Index);
+
+  // Chunks without index are joined with a nested loop
+  join_features.right.indexed_share = 0.5f;
+  join_features.right.indexed_chunk_count = 5.0f;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Hash);
+
+  // A table index is probed once per value, regardless of the number of chunks
+  join_features.right.has_table_index = true;
+  join_features.left.row_count = 10'000.0f;
+  EXPECT_EQ(cost_model.cheapest_join_implementation(join_features), JoinImplementation::Index);
+}
+
+}  // namespace opossum
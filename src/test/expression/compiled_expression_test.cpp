@@ -0,0 +1,119 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "expression/evaluation/compiled_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CompiledExpressionTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/expression_evaluator/input_a.tbl", 2);
+    a = PQPColumnExpression::from_table(*table, "a");
+    b = PQPColumnExpression::from_table(*table, "b");
+    c = PQPColumnExpression::from_table(*table, "c");
+    e = PQPColumnExpression::from_table(*table, "e");
+    f = PQPColumnExpression::from_table(*table, "f");
+    s1 = PQPColumnExpression::from_table(*table, "s1");
+  }
+
+  // Checks that the CompiledExpression computes the same segments as the ExpressionEvaluator
+  void test_segments(const std::shared_ptr<AbstractExpression>& expression) {
+    const auto compiled_expression = CompiledExpression::compile(*expression);
+    ASSERT_TRUE(compiled_expression) << expression->as_column_name();
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto expected_segment = ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_segment(*expression);
+      const auto actual_segment = compiled_expression->evaluate_to_segment(*table, chunk_id);
+
+      ASSERT_EQ(actual_segment->data_type(), expected_segment->data_type());
+      EXPECT_EQ(actual_segment->is_nullable(), expected_segment->is_nullable()) << expression->as_column_name();
+      ASSERT_EQ(actual_segment->size(), expected_segment->size());
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < actual_segment->size(); ++chunk_offset) {
+        const auto actual_value = (*actual_segment)[chunk_offset];
+        const auto expected_value = (*expected_segment)[chunk_offset];
+        EXPECT_EQ(variant_is_null(actual_value), variant_is_null(expected_value)) << expression->as_column_name();
+        if (!variant_is_null(expected_value)) {
+          EXPECT_EQ(actual_value, expected_value) << expression->as_column_name();
+        }
+      }
+    }
+  }
+
+  // Checks that the CompiledExpression finds the same rows as the ExpressionEvaluator
+  void test_pos_lists(const std::shared_ptr<AbstractExpression>& expression) {
+    const auto compiled_expression = CompiledExpression::compile(*expression);
+    ASSERT_TRUE(compiled_expression) << expression->as_column_name();
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto expected_pos_list = ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_pos_list(*expression);
+      EXPECT_EQ(compiled_expression->evaluate_to_pos_list(*table, chunk_id), expected_pos_list)
+          << expression->as_column_name();
+    }
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<PQPColumnExpression> a, b, c, e, f, s1;
+};
+
+TEST_F(CompiledExpressionTest, Arithmetics) {
+  test_segments(add_(a, b));
+  test_segments(sub_(a, 1));
+  test_segments(mul_(2, b));
+  test_segments(mul_(mul_(e, sub_(1, f)), add_(1, a)));
+  test_segments(add_(a, int64_t{5'000'000'000}));
+  test_segments(sub_(e, 0.5));
+}
+
+TEST_F(CompiledExpressionTest, NullableArithmetics) {
+  test_segments(add_(c, a));
+  test_segments(mul_(c, c));
+  test_segments(sub_(e, c));
+}
+
+TEST_F(CompiledExpressionTest, DivisionByZeroIsNull) {
+  test_segments(div_(a, b));
+  test_segments(div_(b, sub_(a, 1)));
+  test_segments(div_(e, sub_(a, 1)));
+  test_segments(mod_(b, sub_(a, 1)));
+  test_segments(mod_(f, 2));
+  test_segments(div_(c, 0));
+}
+
+TEST_F(CompiledExpressionTest, Comparisons) {
+  test_pos_lists(less_than_(add_(a, b), 6));
+  test_pos_lists(less_than_equals_(mul_(a, 2), b));
+  test_pos_lists(greater_than_(mul_(e, 2), f));
+  test_pos_lists(greater_than_equals_(7, add_(a, b)));
+  test_pos_lists(equals_(sub_(b, a), 1));
+  test_pos_lists(not_equals_(add_(a, 1), b));
+
+  // Rows in which c is NULL never match
+  test_pos_lists(less_than_(add_(c, a), 40));
+  test_pos_lists(not_equals_(c, mul_(a, 11)));
+  test_pos_lists(equals_(div_(b, sub_(a, 1)), 2));
+}
+
+TEST_F(CompiledExpressionTest, UnsupportedExpressions) {
+  EXPECT_FALSE(CompiledExpression::compile(*a));
+  EXPECT_FALSE(CompiledExpression::compile(*add_(1, 2)));
+  EXPECT_FALSE(CompiledExpression::compile(*add_(a, null_())));
+  EXPECT_FALSE(CompiledExpression::compile(*add_(s1, s1)));
+  EXPECT_FALSE(CompiledExpression::compile(*add_(a, case_(equals_(a, 1), b, 2))));
+  EXPECT_FALSE(CompiledExpression::compile(*between_(add_(a, 1), 2, 3)));
+  EXPECT_FALSE(CompiledExpression::compile(*equals_(s1, "a")));
+  EXPECT_FALSE(CompiledExpression::compile(*and_(less_than_(a, 2), less_than_(add_(a, b), 6))));
+}
+
+}  // namespace opossum
@@ -134,6 +134,12 @@ TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithoutNulls) {
 TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithNulls) {
   EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(is_not_null_(c), equals_(c, 33)), {0}));
   EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(c), equals_(c, 33)), {0, 1, 3}));
+
+  // Nested operands are evaluated on the rows that the enclosing left operands have not decided
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(is_not_null_(c), or_(equals_(c, 33), greater_than_(c, 33))),
+                              {0, 2}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(c), and_(greater_than_(c, 0), less_than_(c, 34))),
+                              {0, 1, 3}));
 }
 
 TEST_F(ExpressionEvaluatorToPosListTest, ExistsCorrelated) {
@@ -22,6 +22,8 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "testing_assert.hpp"
@@ -74,7 +76,7 @@ class ExpressionEvaluatorToValuesTest : public ::testing::Test {
     Segments segments;
     segments.emplace_back(std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{}));
     segments.emplace_back(
-        std::make_shared<ValueSegment<float>>(pmr_concurrent_vector<float>{}, pmr_concurrent_vector<bool>{}));
+        std::make_shared<ValueSegment<float>>(pmr_concurrent_vector<float>{}, NullValueVector{}));
     segments.emplace_back(std::make_shared<ValueSegment<pmr_string>>(pmr_concurrent_vector<pmr_string>{}));
     table_empty->append_chunk(segments);
 
@@ -200,6 +202,16 @@ TEST_F(ExpressionEvaluatorToValuesTest, TernaryAndSeries) {
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, TernaryLogicalSeriesShortCircuit) {
+  // The right operands are only evaluated on the rows that the left operands do not decide
+  // clang-format off
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *and_(greater_than_(a, 1), less_than_(add_(c, a), 100)), {0, std::nullopt, 1, std::nullopt}));  // NOLINT
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *or_(greater_than_(a, 2), less_than_(add_(c, a), 100)), {1, std::nullopt, 1, 1}));  // NOLINT
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *or_(greater_than_(a, 0), less_than_(add_(c, a), 100)), {1, 1, 1, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *and_(greater_than_(a, 0), or_(is_null_(c), equals_(add_(a, 1), b))), {1, 1, 1, 1}));  // NOLINT
+  // clang-format on
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, ValueLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*value_(5), {5}));
   EXPECT_TRUE(test_expression<float>(*value_(5.0f), {5.0f}));
@@ -311,9 +323,77 @@ TEST_F(ExpressionEvaluatorToValuesTest, CaseSeries) {
   EXPECT_TRUE(test_expression<int32_t>(table_empty, *case_(greater_than_(empty_a, 3), 1, 2), {}));
   EXPECT_TRUE(test_expression<int32_t>(table_empty, *case_(1, empty_a, empty_a), {}));
   EXPECT_TRUE(test_expression<int32_t>(table_empty, *case_(greater_than_(empty_a, 3), empty_a, empty_a), {}));
+
+  // Branches that are evaluated only on the rows taking them
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(c, a), add_(b, 100), case_(is_null_(c), mul_(a, 10), sub_(a, 1))), {102, 20, 104, 40}));  // NOLINT
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_(greater_than_(a, 2), add_(c, a), b), {2, 3, 37, std::nullopt}));  // NOLINT
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, EncodedSegments) {
+  // Expressions on a single dictionary- or run-length-encoded column are evaluated once per dictionary entry or run.
+  // Their results have to match those on unencoded segments, also when reading through a ReferenceSegment.
+  const auto column_definitions =
+      TableColumnDefinitions{{"i", DataType::Int, true}, {"r", DataType::Int, false}, {"s", DataType::String, false}};
+  const auto create_table = [&]() {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+    for (auto row_idx = int32_t{0}; row_idx < 100; ++row_idx) {
+      const auto i = row_idx % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_idx % 5};
+      table->append({i, row_idx / 20, pmr_string{"value" + std::to_string(row_idx % 3)}});
+    }
+    return table;
+  };
+
+  const auto unencoded_table = create_table();
+  const auto dictionary_table = create_table();
+  ChunkEncoder::encode_all_chunks(dictionary_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto run_length_table = create_table();
+  ChunkEncoder::encode_all_chunks(run_length_table, SegmentEncodingSpec{EncodingType::RunLength});
+
+  auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 100; chunk_offset += 2) {
+    pos_list->emplace_back(ChunkID{0}, chunk_offset);
+  }
+  pos_list->guarantee_single_chunk();
+  const auto reference_table = std::make_shared<Table>(column_definitions, TableType::References);
+  auto reference_segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < 3; ++column_id) {
+    reference_segments.emplace_back(std::make_shared<ReferenceSegment>(dictionary_table, column_id, pos_list));
+  }
+  reference_table->append_chunk(reference_segments);
+
+  const auto i = PQPColumnExpression::from_table(*unencoded_table, "i");
+  const auto r = PQPColumnExpression::from_table(*unencoded_table, "r");
+  const auto s = PQPColumnExpression::from_table(*unencoded_table, "s");
+
+  const auto evaluate = [&](const std::shared_ptr<Table>& table, const auto& expression, const auto result_type_t) {
+    using ResultType = typename decltype(result_type_t)::type;
+    const auto result = ExpressionEvaluator{table, ChunkID{0}}.evaluate_expression_to_result<ResultType>(*expression);
+    return normalize_expression_result(*result);
+  };
+
+  const auto test = [&](const auto& expression, const auto result_type_t) {
+    const auto expected = evaluate(unencoded_table, expression, result_type_t);
+    EXPECT_EQ(evaluate(dictionary_table, expression, result_type_t), expected);
+    EXPECT_EQ(evaluate(run_length_table, expression, result_type_t), expected);
+
+    auto expected_referenced = expected;
+    expected_referenced.clear();
+    for (auto row_idx = size_t{0}; row_idx < expected.size(); row_idx += 2) {
+      expected_referenced.emplace_back(expected[row_idx]);
+    }
+    EXPECT_EQ(evaluate(reference_table, expression, result_type_t), expected_referenced);
+  };
+
+  test(add_(i, 1), hana::type_c<int32_t>);
+  test(is_null_(i), hana::type_c<int32_t>);
+  test(case_(greater_than_(i, 2), mul_(i, 10), 0), hana::type_c<int32_t>);
+  test(sub_(r, 3), hana::type_c<int32_t>);
+  test(cast_(r, DataType::Float), hana::type_c<float>);
+  test(substr_(s, 1, 3), hana::type_c<pmr_string>);
+  test(equals_(substr_(s, 6, 1), "1"), hana::type_c<int32_t>);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, IsNullLiteral) {
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(0), {0}));
   EXPECT_TRUE(test_expression<int32_t>(*is_null_(1), {0}));
@@ -714,6 +794,21 @@ TEST_F(ExpressionEvaluatorToValuesTest, ExtractLiterals) {
   EXPECT_EQ(extract_(DatetimeComponent::Year, "1993-08-01")->data_type(), DataType::String);
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, ExtractDateTimeLiterals) {
+  const auto date = cast_("1992-09-30", DataType::Date);
+  const auto timestamp = cast_("1992-09-30 13:14:15.5", DataType::Timestamp);
+
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Year, date), {1992}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Month, date), {9}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Day, date), {30}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Hour, date), {0}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Hour, timestamp), {13}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Minute, timestamp), {14}));
+  EXPECT_TRUE(test_expression<int32_t>(*extract_(DatetimeComponent::Second, timestamp), {15}));
+
+  EXPECT_EQ(extract_(DatetimeComponent::Year, date)->data_type(), DataType::Int);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, ExtractSeries) {
   EXPECT_TRUE(test_expression<pmr_string>(table_a, *extract_(DatetimeComponent::Year, dates),
                                           {"2017", "2014", "2011", "2010"}));
@@ -741,6 +836,37 @@ TEST_F(ExpressionEvaluatorToValuesTest, CastLiterals) {
   EXPECT_TRUE(test_expression<float>(*cast_("Hello", DataType::Float), {0.0f}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CastDateTimeLiterals) {
+  EXPECT_TRUE(test_expression<int32_t>(*cast_("2000-01-01", DataType::Date), {10957}));
+  EXPECT_TRUE(test_expression<int64_t>(*cast_("1970-01-01 00:00:01", DataType::Timestamp), {1'000'000}));
+  EXPECT_TRUE(test_expression<int32_t>(*cast_("Hello", DataType::Date), {0}));
+  EXPECT_TRUE(test_expression<pmr_string>(*cast_(cast_("2000-01-01", DataType::Date), DataType::String),
+                                          {"2000-01-01"}));
+}
+
+TEST_F(ExpressionEvaluatorToValuesTest, DecimalLiterals) {
+  const auto price = cast_("12.34", DataType::Decimal);
+  const auto discount = cast_("0.05", DataType::Decimal);
+
+  EXPECT_TRUE(test_expression<int64_t>(*price, {123'400}));
+  EXPECT_TRUE(test_expression<int64_t>(*add_(price, discount), {123'900}));
+  EXPECT_TRUE(test_expression<int64_t>(*mul_(price, sub_(1, discount)), {117'230}));
+  EXPECT_TRUE(test_expression<int64_t>(*div_(price, 3), {41'133}));
+  EXPECT_TRUE(test_expression<int64_t>(*mod_(price, 5), {23'400}));
+  EXPECT_TRUE(test_expression<int64_t>(*div_(price, sub_(discount, discount)), {std::nullopt}));
+  EXPECT_TRUE(test_expression<int64_t>(*add_(price, null_()), {std::nullopt}));
+
+  EXPECT_TRUE(test_expression<int64_t>(*cast_(5, DataType::Decimal), {50'000}));
+  EXPECT_TRUE(test_expression<int64_t>(*cast_(0.07, DataType::Decimal), {700}));
+  EXPECT_TRUE(test_expression<int64_t>(*cast_("Hello", DataType::Decimal), {0}));
+  EXPECT_TRUE(test_expression<double>(*cast_(price, DataType::Double), {12.34}));
+  EXPECT_TRUE(test_expression<int32_t>(*cast_(price, DataType::Int), {12}));
+  EXPECT_TRUE(test_expression<pmr_string>(*cast_(price, DataType::String), {"12.3400"}));
+
+  EXPECT_EQ(add_(price, 1)->data_type(), DataType::Decimal);
+  EXPECT_EQ(add_(price, 1.5)->data_type(), DataType::Double);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, CastSeries) {
   EXPECT_TRUE(test_expression<int32_t>(table_a, *cast_(a, DataType::Int), {1, 2, 3, 4}));
   EXPECT_TRUE(test_expression<float>(table_a, *cast_(a, DataType::Float), {1.0f, 2.0f, 3.0f, 4.0f}));
@@ -750,4 +876,19 @@ TEST_F(ExpressionEvaluatorToValuesTest, CastSeries) {
       test_expression<pmr_string>(table_a, *cast_(c, DataType::String), {"33", std::nullopt, "34", std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CommonSubexpressionsAreEvaluatedOnce) {
+  const auto common_subexpressions = std::make_shared<ExpressionUnorderedSet>(ExpressionUnorderedSet{a_plus_b});
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}, nullptr, common_subexpressions};
+
+  // Equal expressions share the result, too
+  const auto a_plus_b_result = evaluator.evaluate_expression_to_result<int32_t>(*a_plus_b);
+  EXPECT_EQ(evaluator.evaluate_expression_to_result<int32_t>(*add_(a, b)), a_plus_b_result);
+
+  const auto case_expression = case_(greater_than_(a_plus_b, 5), a_plus_b, mul_(a_plus_b, 2));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *case_expression, {6, 10, 7, 9}));
+  EXPECT_EQ(normalize_expression_result(*evaluator.evaluate_expression_to_result<int32_t>(*case_expression)),
+            (std::vector<std::optional<int32_t>>{6, 10, 7, 9}));
+  EXPECT_EQ(normalize_expression_result(*a_plus_b_result), (std::vector<std::optional<int32_t>>{3, 5, 7, 9}));
+}
+
 }  // namespace opossum
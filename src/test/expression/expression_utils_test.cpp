@@ -50,4 +50,21 @@ TEST_F(ExpressionUtilsTest, ExpressionCommonType) {
   EXPECT_EQ(expression_common_type(DataType::String, DataType::String), DataType::String);
 }
 
+TEST_F(ExpressionUtilsTest, ExpressionsFindCommonSubexpressions) {
+  const auto a_plus_b = add_(a_a, a_b);
+
+  // (a + b) * c occurs twice. a + b is computed within the first (a + b) * c and by a + b - 1. Its occurrence within
+  // the second (a + b) * c is not counted, as that one is not computed again.
+  const auto expressions = expression_vector(mul_(a_plus_b, a_c), mul_(a_plus_b, a_c), sub_(a_plus_b, 1), a_a, a_a);
+  const auto common_subexpressions = expressions_find_common_subexpressions(expressions);
+  ASSERT_EQ(common_subexpressions.size(), 2u);
+  EXPECT_EQ(*common_subexpressions.at(0), *mul_(a_plus_b, a_c));
+  EXPECT_EQ(*common_subexpressions.at(1), *a_plus_b);
+
+  // Inputs are not looked into
+  const auto is_input = [&](const AbstractExpression& expression) { return expression == *a_plus_b; };
+  EXPECT_TRUE(expressions_find_common_subexpressions(expression_vector(mul_(a_plus_b, 2), sub_(a_plus_b, 1)), is_input)
+                  .empty());
+}
+
 }  // namespace opossum
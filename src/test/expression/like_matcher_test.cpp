@@ -54,4 +54,32 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, WildcardPatterns) {
+  EXPECT_TRUE(match("", ""));
+  EXPECT_FALSE(match("Hello", ""));
+  EXPECT_TRUE(match("Hello World", "H_llo%W_rld"));
+  EXPECT_TRUE(match("Hello World", "%l_o%o%"));
+  EXPECT_FALSE(match("Hello World", "%l_o%o"));
+  EXPECT_TRUE(match("abab", "%a_%b"));
+  EXPECT_FALSE(match("ab", "a%%b_"));
+  EXPECT_TRUE(match("abcabd", "a%b_%"));
+
+  // Patterns that start with '%' but do not end with it are no MultipleContainsPatterns
+  EXPECT_FALSE(match("abbaa", "%b%bab"));
+  EXPECT_TRUE(match("abbab", "%b%bab"));
+}
+
+TEST_F(LikeMatcherTest, FindSubstring) {
+  // Long enough for the vectorized search, with candidates that only match the first and last character
+  const auto haystack = std::string(100, 'a') + "axxb" + std::string(50, 'a') + "axyb" + std::string(10, 'c');
+
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "axyb"), 154u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "xxb"), 101u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "cc"), 158u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "b"), 103u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, ""), 0u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "axzb"), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find_substring("abc", "abcd"), std::string_view::npos);
+}
+
 }  // namespace opossum
@@ -18,6 +18,27 @@ TEST_F(CsvMetaTest, ProcessCsvMetaFile) {
   EXPECT_EQ(meta_expected, meta);
 }
 
+TEST_F(CsvMetaTest, ChunkSize) {
+  auto json_meta = nlohmann::json::parse(R"(
+    {
+      "columns": [
+        {
+          "name": "a",
+          "type": "int"
+        }
+      ],
+      "chunk_size": 1000
+    }
+  )");
+
+  const auto meta = static_cast<CsvMeta>(json_meta);
+  EXPECT_EQ(meta.chunk_size, ChunkOffset{1000});
+  EXPECT_EQ(static_cast<CsvMeta>(nlohmann::json(meta)), meta);
+
+  auto invalid_meta = CsvMeta{};
+  EXPECT_THROW(from_json(nlohmann::json::parse(R"({"chunk_size": 0})"), invalid_meta), std::logic_error);
+}
+
 TEST_F(CsvMetaTest, ProcessCsvMetaFileMissing) {
   EXPECT_THROW(process_csv_meta_file("resources/test_data/csv/missing_file.csv.json"), std::logic_error);
 }
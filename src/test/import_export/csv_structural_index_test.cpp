@@ -0,0 +1,37 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/csv_structural_index.hpp"
+
+namespace opossum {
+
+class CsvStructuralIndexTest : public BaseTest {};
+
+TEST_F(CsvStructuralIndexTest, FindsCharactersAcrossBlocks) {
+  // Place structural characters at the beginning and end of blocks and in an incomplete last block
+  auto content = std::string(150, 'x');
+  const auto expected_positions = std::vector<size_t>{0, 5, 63, 64, 100, 127, 128, 149};
+  const auto characters = std::string{",\n\""};
+  for (auto index = size_t{0}; index < expected_positions.size(); ++index) {
+    content[expected_positions[index]] = characters[index % characters.size()];
+  }
+
+  auto structural_index = CsvStructuralIndex{content, {',', '\n', '"'}};
+  auto positions = std::vector<size_t>{};
+  for (auto position = structural_index.next(); position != std::string::npos; position = structural_index.next()) {
+    positions.emplace_back(position);
+  }
+
+  EXPECT_EQ(positions, expected_positions);
+  EXPECT_EQ(structural_index.next(), std::string::npos);
+}
+
+TEST_F(CsvStructuralIndexTest, EmptyContent) {
+  auto structural_index = CsvStructuralIndex{std::string_view{}, {',', '\n', '"'}};
+  EXPECT_EQ(structural_index.next(), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/mapped_file_reader.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class MappedFileReaderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto file = std::ofstream{filename, std::ios::binary};
+    const auto value = uint32_t{0x01020304};
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    file << "hyrise";
+  }
+
+  void TearDown() override { filesystem::remove(filename); }
+
+  const std::string filename = test_data_path + "mapped_file_reader_test";
+};
+
+TEST_F(MappedFileReaderTest, ReadValuesAndBytes) {
+  auto reader = MappedFileReader{filename};
+  EXPECT_EQ(reader.size(), 10u);
+  EXPECT_EQ(reader.position(), 0u);
+
+  EXPECT_EQ(reader.read_value<uint32_t>(), uint32_t{0x01020304});
+  EXPECT_EQ(reader.position(), 4u);
+  EXPECT_EQ(std::string(reader.read_bytes(6), 6), "hyrise");
+  EXPECT_EQ(reader.position(), 10u);
+
+  // Reading nothing at the end of the file is fine
+  reader.read_bytes(0);
+}
+
+TEST_F(MappedFileReaderTest, ReadBeyondEndOfFile) {
+  auto reader = MappedFileReader{filename};
+  reader.seek(8);
+  EXPECT_THROW(reader.read_value<uint32_t>(), std::exception);
+  EXPECT_EQ(reader.position(), 8u);
+
+  EXPECT_THROW(reader.seek(11), std::exception);
+  EXPECT_THROW(MappedFileReader{"not_existing_file"}, std::exception);
+}
+
+TEST_F(MappedFileReaderTest, CopiesHaveTheirOwnPosition) {
+  auto reader = MappedFileReader{filename};
+  reader.seek(4);
+
+  auto copy = reader;
+  EXPECT_EQ(copy.position(), 4u);
+  EXPECT_EQ(std::string(copy.read_bytes(2), 2), "hy");
+  EXPECT_EQ(reader.position(), 4u);
+
+  // The mapping outlives the reader it was created by
+  reader = MappedFileReader{filename};
+  EXPECT_EQ(std::string(copy.read_bytes(4), 4), "rise");
+}
+
+TEST_F(MappedFileReaderTest, EmptyFile) {
+  { auto file = std::ofstream{filename, std::ios::binary}; }
+
+  auto reader = MappedFileReader{filename};
+  EXPECT_EQ(reader.size(), 0u);
+  EXPECT_THROW(reader.read_bytes(1), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include <fstream>
+#include <string>
+
+#if HYRISE_GZIP_SUPPORT
+#include <zlib.h>
+#endif
+
+#if HYRISE_ZSTD_SUPPORT
+#include <zstd.h>
+#endif
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/streaming_file_reader.hpp"
+
+namespace opossum {
+
+class StreamingFileReaderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Longer than a few blocks, so that the reader has to wait for the consumer
+    for (auto row = 0; row < 1'000; ++row) content += std::to_string(row) + ",row " + std::to_string(row) + "\n";
+  }
+
+  std::string read_all(const std::string& filename, const size_t block_size) {
+    auto reader = StreamingFileReader{filename, block_size};
+    auto result = std::string{};
+    while (const auto block = reader.next_block()) {
+      EXPECT_FALSE(block->empty());
+      EXPECT_LE(block->size(), block_size);
+      result += *block;
+    }
+    return result;
+  }
+
+  void write_file(const std::string& filename, const std::string& data) {
+    auto file = std::ofstream{filename, std::ios::binary};
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+  }
+
+  std::string content;
+  const std::string filename = test_data_path + "streaming_file_reader_test";
+};
+
+TEST_F(StreamingFileReaderTest, ReadUncompressed) {
+  write_file(filename, content);
+
+  EXPECT_EQ(StreamingFileReader::detect_compression(filename), FileCompression::None);
+  EXPECT_EQ(read_all(filename, 100), content);
+  EXPECT_EQ(read_all(filename, content.size() * 2), content);
+}
+
+TEST_F(StreamingFileReaderTest, ReadEmptyFile) {
+  write_file(filename, "");
+
+  auto reader = StreamingFileReader{filename};
+  EXPECT_FALSE(reader.next_block());
+}
+
+TEST_F(StreamingFileReaderTest, StopBeforeEndOfFile) {
+  write_file(filename, content);
+
+  // The destructor stops the reader, which is blocked because the consumer did not consume its blocks
+  auto reader = StreamingFileReader{filename, 10};
+  EXPECT_EQ(*reader.next_block(), content.substr(0, 10));
+}
+
+TEST_F(StreamingFileReaderTest, MissingFile) {
+  auto reader = StreamingFileReader{test_data_path + "does_not_exist"};
+  EXPECT_THROW(reader.next_block(), std::logic_error);
+}
+
+#if HYRISE_GZIP_SUPPORT
+TEST_F(StreamingFileReaderTest, ReadGzip) {
+  // Two members, as written by parallel compressors such as pigz
+  for (const auto& half : {content.substr(0, content.size() / 2), content.substr(content.size() / 2)}) {
+    const auto file = gzopen(filename.c_str(), "ab");
+    gzwrite(file, half.data(), static_cast<unsigned>(half.size()));
+    gzclose(file);
+  }
+
+  EXPECT_EQ(StreamingFileReader::detect_compression(filename), FileCompression::Gzip);
+  EXPECT_EQ(read_all(filename, 100), content);
+
+  // Truncated files are detected
+  auto compressed = std::string{};
+  {
+    auto file = std::ifstream{filename, std::ios::binary};
+    compressed = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+  write_file(filename, compressed.substr(0, compressed.size() - 20));
+  EXPECT_THROW(read_all(filename, 100), std::logic_error);
+}
+#endif
+
+#if HYRISE_ZSTD_SUPPORT
+TEST_F(StreamingFileReaderTest, ReadZstd) {
+  // Multiple frames with a known decompressed size (as written by pzstd) are decompressed in parallel
+  auto compressed = std::string{};
+  const auto frame_size = content.size() / 4 + 1;
+  for (auto offset = size_t{0}; offset < content.size(); offset += frame_size) {
+    const auto frame = content.substr(offset, frame_size);
+    auto compressed_frame = std::string(ZSTD_compressBound(frame.size()), '\0');
+    const auto compressed_size =
+        ZSTD_compress(compressed_frame.data(), compressed_frame.size(), frame.data(), frame.size(), 3);
+    ASSERT_FALSE(ZSTD_isError(compressed_size));
+    compressed += compressed_frame.substr(0, compressed_size);
+  }
+  write_file(filename, compressed);
+
+  EXPECT_EQ(StreamingFileReader::detect_compression(filename), FileCompression::Zstd);
+  EXPECT_EQ(read_all(filename, 100), content);
+  EXPECT_EQ(read_all(filename, content.size() * 2), content);
+
+  write_file(filename, compressed.substr(0, compressed.size() - 20));
+  EXPECT_THROW(read_all(filename, 100), std::logic_error);
+}
+#endif
+
+}  // namespace opossum
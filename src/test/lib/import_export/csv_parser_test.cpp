@@ -1,8 +1,17 @@
+#include <fstream>
+#include <string>
+
+#if HYRISE_GZIP_SUPPORT
+#include <zlib.h>
+#endif
+
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "import_export/csv_parser.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -18,4 +27,75 @@ TEST_F(CsvParserTest, EmptyTableFromMetaFile) {
   EXPECT_TABLE_EQ_UNORDERED(csv_meta_table, expected_table);
 }
 
+TEST_F(CsvParserTest, EncodeChunksWhileParsing) {
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Unencoded}, SegmentEncodingSpec{EncodingType::Dictionary}};
+  const auto table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt, ChunkOffset{20},
+                                       chunk_encoding_spec);
+  const auto expected_table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt,
+                                                ChunkOffset{20});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  ASSERT_GT(table->chunk_count(), 1u);
+  for (const auto& chunk : table->chunks()) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<float>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+  }
+}
+
+TEST_F(CsvParserTest, ParseInSmallBlocks) {
+  // Rows span the block boundaries and chunks end within blocks
+  const auto table = CsvParser{7}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt, ChunkOffset{20});
+  const auto expected_table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt,
+                                                ChunkOffset{20});
+
+  EXPECT_EQ(table->chunk_count(), expected_table->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Quoted fields span the block boundaries
+  const auto quoted_table =
+      CsvParser{3}.parse("resources/test_data/csv/with_and_without_quotes.csv", std::nullopt, ChunkOffset{1});
+  const auto expected_quoted_table = CsvParser{}.parse("resources/test_data/csv/with_and_without_quotes.csv");
+  EXPECT_TABLE_EQ_ORDERED(quoted_table, expected_quoted_table);
+}
+
+#if HYRISE_GZIP_SUPPORT
+TEST_F(CsvParserTest, ParseGzip) {
+  auto content = std::string{};
+  {
+    auto file = std::ifstream{"resources/test_data/csv/float_int_large.csv", std::ios::binary};
+    content = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+
+  const auto filename = test_data_path + "float_int_large.csv.gz";
+  const auto file = gzopen(filename.c_str(), "wb");
+  gzwrite(file, content.data(), static_cast<unsigned>(content.size()));
+  gzclose(file);
+
+  const auto csv_meta = process_csv_meta_file("resources/test_data/csv/float_int_large.csv.json");
+  const auto table = CsvParser{64}.parse(filename, csv_meta, ChunkOffset{20});
+  const auto expected_table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt,
+                                                ChunkOffset{20});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+#endif
+
+TEST_F(CsvParserTest, ParseContent) {
+  auto csv_meta = CsvMeta{};
+  csv_meta.columns = {{"a", "int", true}, {"b", "string", false}};
+
+  // The last row does not need to be terminated
+  const auto table = CsvParser{}.parse_content("1,foo\n,\"bar, baz\"\n3,qux", csv_meta, ChunkOffset{2});
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String}}, TableType::Data);
+  expected_table->append({1, "foo"});
+  expected_table->append({NullValue{}, "bar, baz"});
+  expected_table->append({3, "qux"});
+
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
 }  // namespace opossum
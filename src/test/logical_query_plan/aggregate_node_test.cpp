@@ -8,6 +8,8 @@
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
@@ -88,4 +90,26 @@ TEST_F(AggregateNodeTest, Copy) {
   EXPECT_EQ(*_aggregate_node->deep_copy(), *same_aggregate_node);
 }
 
+TEST_F(AggregateNodeTest, DeriveStatistics) {
+  // a has 10 distinct values, c has 20 distinct values and NULLs, which form a group of their own
+  const auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+      std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 10),
+      std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000.0f, 1, 1'000),
+      std::make_shared<ColumnStatistics<int32_t>>(0.5f, 20.0f, 1, 20)};
+  _mock_node->set_statistics(std::make_shared<TableStatistics>(TableType::Data, 1'000.0f, column_statistics));
+
+  const auto statistics = _aggregate_node->get_statistics();
+  EXPECT_FLOAT_EQ(statistics->row_count(), 210.0f);
+  EXPECT_FLOAT_EQ(statistics->column_statistics().at(0)->distinct_count(), 10.0f);
+  EXPECT_FLOAT_EQ(statistics->column_statistics().at(1)->null_value_ratio(), 1.0f / 21.0f);
+
+  // The number of groups is bounded by the number of input rows
+  const auto aggregate_node_a_b = AggregateNode::make(expression_vector(_a, _b), expression_vector(), _mock_node);
+  EXPECT_FLOAT_EQ(aggregate_node_a_b->get_statistics()->row_count(), 1'000.0f);
+
+  // Without GROUP BY, there is a single row
+  const auto aggregate_node_sum = AggregateNode::make(expression_vector(), expression_vector(sum_(_b)), _mock_node);
+  EXPECT_FLOAT_EQ(aggregate_node_sum->get_statistics()->row_count(), 1.0f);
+}
+
 }  // namespace opossum
@@ -0,0 +1,48 @@
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+
+#include "logical_query_plan/except_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+
+namespace opossum {
+
+class ExceptNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node1 = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Int, "c"}}, "t_a");
+    _mock_node2 = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "u"}, {DataType::Int, "v"}, {DataType::Int, "w"}}, "t_b");
+
+    _except_node = ExceptNode::make(SetOperationMode::Unique, _mock_node1, _mock_node2);
+  }
+
+  std::shared_ptr<MockNode> _mock_node1, _mock_node2;
+  std::shared_ptr<ExceptNode> _except_node;
+};
+
+TEST_F(ExceptNodeTest, Description) { EXPECT_EQ(_except_node->description(), "[ExceptNode] Mode: Unique"); }
+
+TEST_F(ExceptNodeTest, OutputColumnExpressions) {
+  ASSERT_EQ(_except_node->column_expressions().size(), 3u);
+  EXPECT_EQ(*_except_node->column_expressions().at(0), *_mock_node1->column_expressions().at(0));
+  EXPECT_EQ(*_except_node->column_expressions().at(1), *_mock_node1->column_expressions().at(1));
+  EXPECT_EQ(*_except_node->column_expressions().at(2), *_mock_node1->column_expressions().at(2));
+}
+
+TEST_F(ExceptNodeTest, Equals) {
+  EXPECT_EQ(*_except_node, *_except_node);
+
+  const auto other_except_node = ExceptNode::make(SetOperationMode::All, _mock_node1, _mock_node2);
+  EXPECT_NE(*_except_node, *other_except_node);
+}
+
+TEST_F(ExceptNodeTest, Copy) { EXPECT_EQ(*_except_node->deep_copy(), *_except_node); }
+
+TEST_F(ExceptNodeTest, NodeExpressions) { ASSERT_EQ(_except_node->node_expressions.size(), 0u); }
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+
+#include "logical_query_plan/intersect_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+
+namespace opossum {
+
+class IntersectNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node1 = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Int, "c"}}, "t_a");
+    _mock_node2 = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "u"}, {DataType::Int, "v"}, {DataType::Int, "w"}}, "t_b");
+
+    _intersect_node = IntersectNode::make(SetOperationMode::Unique, _mock_node1, _mock_node2);
+  }
+
+  std::shared_ptr<MockNode> _mock_node1, _mock_node2;
+  std::shared_ptr<IntersectNode> _intersect_node;
+};
+
+TEST_F(IntersectNodeTest, Description) { EXPECT_EQ(_intersect_node->description(), "[IntersectNode] Mode: Unique"); }
+
+TEST_F(IntersectNodeTest, OutputColumnExpressions) {
+  ASSERT_EQ(_intersect_node->column_expressions().size(), 3u);
+  EXPECT_EQ(*_intersect_node->column_expressions().at(0), *_mock_node1->column_expressions().at(0));
+  EXPECT_EQ(*_intersect_node->column_expressions().at(1), *_mock_node1->column_expressions().at(1));
+  EXPECT_EQ(*_intersect_node->column_expressions().at(2), *_mock_node1->column_expressions().at(2));
+}
+
+TEST_F(IntersectNodeTest, Equals) {
+  EXPECT_EQ(*_intersect_node, *_intersect_node);
+
+  const auto other_intersect_node = IntersectNode::make(SetOperationMode::All, _mock_node1, _mock_node2);
+  EXPECT_NE(*_intersect_node, *other_intersect_node);
+}
+
+TEST_F(IntersectNodeTest, Copy) { EXPECT_EQ(*_intersect_node->deep_copy(), *_intersect_node); }
+
+TEST_F(IntersectNodeTest, NodeExpressions) { ASSERT_EQ(_intersect_node->node_expressions.size(), 0u); }
+
+}  // namespace opossum
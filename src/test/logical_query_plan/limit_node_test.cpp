@@ -25,6 +25,12 @@ TEST_F(LimitNodeTest, Equals) {
   EXPECT_EQ(*_limit_node, *_limit_node);
   EXPECT_EQ(*LimitNode::make(value_(10)), *_limit_node);
   EXPECT_NE(*LimitNode::make(value_(11)), *_limit_node);
+
+  const auto top_k_node = LimitNode::make(value_(10));
+  top_k_node->limit_type = LimitType::TopK;
+  EXPECT_NE(*top_k_node, *_limit_node);
+  EXPECT_NE(top_k_node->hash(), _limit_node->hash());
+  EXPECT_EQ(*top_k_node->deep_copy(), *top_k_node);
 }
 
 TEST_F(LimitNodeTest, Copy) { EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node); }
@@ -420,6 +420,30 @@ TEST_F(LogicalQueryPlanTest, DeepCopySubqueries) {
   EXPECT_NE(copied_subquery_b->lqp, subquery->lqp);
 }
 
+TEST_F(LogicalQueryPlanTest, HashOfCopiedLQPIsEqual) {
+  const auto subquery = lqp_subquery_(ProjectionNode::make(expression_vector(a2), node_int_int_int));
+
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a1, subquery),
+    ProjectionNode::make(expression_vector(a1, b1),
+      node_int_int));
+
+  const auto different_lqp =
+  PredicateNode::make(greater_than_(a1, subquery),
+    node_int_int);
+  // clang-format on
+
+  const auto copied_lqp = lqp->deep_copy();
+  EXPECT_EQ(copied_lqp->hash(), lqp->hash());
+  EXPECT_NE(different_lqp->hash(), lqp->hash());
+
+  // Subqueries with equal LQPs hash to the same value, so that they can be found in ExpressionUnorderedSets
+  const auto copied_subquery = lqp_subquery_(subquery->lqp->deep_copy());
+  EXPECT_EQ(*copied_subquery, *subquery);
+  EXPECT_EQ(copied_subquery->hash(), subquery->hash());
+}
+
 TEST_F(LogicalQueryPlanTest, OutputResetOnNodeDelete) {
   auto mock_node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}});
   auto mock_node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "y"}});
@@ -17,6 +17,8 @@
 #include "logical_query_plan/create_table_node.hpp"
 #include "logical_query_plan/drop_table_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "logical_query_plan/except_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
@@ -28,9 +30,14 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "operators/aggregate.hpp"
+#include "operators/alias_operator.hpp"
+#include "operators/difference.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
+#include "operators/intersect.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_range.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -42,7 +49,10 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -326,28 +336,44 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
-
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
-
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  ASSERT_EQ(sort->sort_definitions().size(), 3u);
+  EXPECT_EQ(sort->sort_definitions()[0].column, ColumnID{1});
+  EXPECT_EQ(sort->sort_definitions()[0].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(sort->sort_definitions()[1].column, ColumnID{0});
+  EXPECT_EQ(sort->sort_definitions()[1].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort->sort_definitions()[2].column, ColumnID{2});
+  EXPECT_EQ(sort->sort_definitions()[2].order_by_mode, OrderByMode::AscendingNullsLast);
+
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
   ASSERT_TRUE(get_table);
 }
 
+TEST_F(LQPTranslatorTest, SortChainIsMerged) {
+  // clang-format off
+  const auto lqp =
+  SortNode::make(expression_vector(int_float_b), std::vector<OrderByMode>{OrderByMode::Descending},
+    SortNode::make(expression_vector(int_float_a), std::vector<OrderByMode>{OrderByMode::Ascending},
+      int_float_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp);
+  ASSERT_TRUE(sort);
+  ASSERT_EQ(sort->sort_definitions().size(), 2u);
+  EXPECT_EQ(sort->sort_definitions()[0].column, ColumnID{1});
+  EXPECT_EQ(sort->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort->sort_definitions()[1].column, ColumnID{0});
+  EXPECT_EQ(sort->sort_definitions()[1].order_by_mode, OrderByMode::Ascending);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(sort->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, JoinNonEqui) {
   /**
    * Build LQP and translate to PQP
@@ -380,6 +406,70 @@ TEST_F(LQPTranslatorTest, JoinNonEqui) {
   EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, BetweenOnCrossJoinToJoinRange) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float, int_float2 WHERE int_float2.b BETWEEN int_float.b AND int_float.b
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(between_(int_float2_b, int_float_b, int_float_b),
+    JoinNode::make(JoinMode::Cross,
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto join_range = std::dynamic_pointer_cast<JoinRange>(pqp);
+  ASSERT_TRUE(join_range);
+  EXPECT_EQ(join_range->mode(), JoinMode::Inner);
+  EXPECT_EQ(join_range->column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_range->predicate_condition(), PredicateCondition::LessThanEquals);
+  ASSERT_TRUE(join_range->secondary_predicate());
+  EXPECT_EQ(join_range->secondary_predicate()->column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_range->secondary_predicate()->predicate_condition, PredicateCondition::GreaterThanEquals);
+
+  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_range->input_left());
+  ASSERT_TRUE(get_table_int_float);
+  EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, PredicatesOnHashJoinToSecondaryPredicates) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float JOIN int_float2 ON int_float.a = int_float2.a AND int_float.b = int_float2.b
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(int_float_b, int_float2_b),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto join_hash = std::dynamic_pointer_cast<JoinHash>(pqp);
+  ASSERT_TRUE(join_hash);
+  EXPECT_EQ(join_hash->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  ASSERT_EQ(join_hash->secondary_predicates().size(), 1u);
+  EXPECT_EQ(join_hash->secondary_predicates()[0].column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_hash->secondary_predicates()[0].predicate_condition, PredicateCondition::Equals);
+
+  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_hash->input_left());
+  ASSERT_TRUE(get_table_int_float);
+  EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -404,6 +494,35 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitTopK) {
+  /**
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 5
+   * with the LimitNode marked as TopK by the TopKRule
+   */
+  // clang-format off
+  const auto limit_node =
+  LimitNode::make(value_(int64_t{5}),
+    SortNode::make(expression_vector(int_float_b), std::vector<OrderByMode>{OrderByMode::Descending},
+      SortNode::make(expression_vector(int_float_a), std::vector<OrderByMode>{OrderByMode::Ascending},
+        int_float_node)));
+  // clang-format on
+  limit_node->limit_type = LimitType::TopK;
+
+  const auto pqp = LQPTranslator{}.translate_node(limit_node);
+
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  ASSERT_EQ(top_k->sort_definitions().size(), 2u);
+  EXPECT_EQ(top_k->sort_definitions()[0].column, ColumnID{1});
+  EXPECT_EQ(top_k->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(top_k->sort_definitions()[1].column, ColumnID{0});
+  EXPECT_EQ(top_k->sort_definitions()[1].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{5}));
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(top_k->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -563,6 +682,36 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeWithIndex) {
+  // The right input is much larger than the left one and has an index on the join column in each chunk, so that
+  // probing the indexes is cheaper than hashing the right input
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 100,
+                                             UseMvcc::Yes);
+  for (auto value = 0; value < 1'000; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  StorageManager::get().add_table("indexed_table", table);
+
+  const auto indexed_node = StoredTableNode::make("indexed_table");
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, indexed_node->get_column("a")), int_float_node, indexed_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
+
+  // JoinIndex can only use indexes of the right input, so the hash join is used if the indexed table is on the left
+  const auto swapped_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, indexed_node->get_column("a")), indexed_node, int_float_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(swapped_join_node)));
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
@@ -619,6 +768,34 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(aggregate_definition.function, AggregateFunction::Sum);
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeCombiningPartialAggregates) {
+  // clang-format off
+  const auto partial_aggregate_node =
+  AggregateNode::make(expression_vector(int_float_a, int_float_b), expression_vector(min_(int_float_b), count_star_()),  // NOLINT
+    int_float_node);
+  const auto aggregate_node =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(min_(int_float_b), count_star_()),
+    partial_aggregate_node);
+  // clang-format on
+  aggregate_node->combines_partial_aggregates = true;
+
+  const auto op = LQPTranslator{}.translate_node(aggregate_node);
+
+  // The partial COUNTs are summed up, and the columns are named after the aggregate expressions
+  const auto alias_op = std::dynamic_pointer_cast<AliasOperator>(op);
+  ASSERT_TRUE(alias_op);
+  const auto aggregate_op = std::dynamic_pointer_cast<const Aggregate>(alias_op->input_left());
+  ASSERT_TRUE(aggregate_op);
+  ASSERT_EQ(aggregate_op->aggregates().size(), 2u);
+  EXPECT_EQ(aggregate_op->aggregates()[0].column, ColumnID{2});
+  EXPECT_EQ(aggregate_op->aggregates()[0].function, AggregateFunction::Min);
+  EXPECT_EQ(aggregate_op->aggregates()[1].column, ColumnID{3});
+  EXPECT_EQ(aggregate_op->aggregates()[1].function, AggregateFunction::Sum);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(op, CleanupTemporaries::Yes));
+  EXPECT_EQ(op->get_output()->column_names(), (std::vector<std::string>{"a", "MIN(b)", "COUNT(*)"}));
+}
+
 TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   /**
    * Build LQP and translate to PQP
@@ -676,6 +853,26 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, IntersectNode) {
+  const auto intersect_node = IntersectNode::make(SetOperationMode::All, int_float_node, int_float2_node);
+  const auto op = LQPTranslator{}.translate_node(intersect_node);
+
+  const auto intersect_op = std::dynamic_pointer_cast<Intersect>(op);
+  ASSERT_TRUE(intersect_op);
+  EXPECT_EQ(intersect_op->mode(), SetOperationMode::All);
+  EXPECT_EQ(intersect_op->input_left()->type(), OperatorType::GetTable);
+  EXPECT_EQ(intersect_op->input_right()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, ExceptNode) {
+  const auto except_node = ExceptNode::make(SetOperationMode::Unique, int_float_node, int_float2_node);
+  const auto op = LQPTranslator{}.translate_node(except_node);
+
+  const auto difference_op = std::dynamic_pointer_cast<Difference>(op);
+  ASSERT_TRUE(difference_op);
+  EXPECT_EQ(difference_op->mode(), SetOperationMode::Unique);
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
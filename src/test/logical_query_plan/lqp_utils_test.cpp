@@ -13,7 +13,11 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -189,4 +193,45 @@ TEST_F(LQPUtilsTest, LQPFindModifiedTables) {
   EXPECT_NE(delete_tables.find("node_a"), delete_tables.end());
 }
 
+TEST_F(LQPUtilsTest, LQPColumnsAreUnique) {
+  const auto customer_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"c_id", DataType::Int, false}, {"c_name", DataType::String, false}}, TableType::Data);
+  customer_table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  StorageManager::get().add_table("customer", customer_table);
+
+  const auto orders_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"o_id", DataType::Int, false}, {"o_c_id", DataType::Int, false}}, TableType::Data);
+  orders_table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  StorageManager::get().add_table("orders", orders_table);
+
+  const auto customer = StoredTableNode::make("customer");
+  const auto orders = StoredTableNode::make("orders");
+  const auto c_id = lqp_column_(customer->get_column("c_id"));
+  const auto c_name = lqp_column_(customer->get_column("c_name"));
+  const auto o_id = lqp_column_(orders->get_column("o_id"));
+  const auto o_c_id = lqp_column_(orders->get_column("o_c_id"));
+
+  EXPECT_TRUE(lqp_columns_are_unique(customer, {c_id}));
+  EXPECT_TRUE(lqp_columns_are_unique(customer, {c_id, c_name}));
+  EXPECT_FALSE(lqp_columns_are_unique(customer, {c_name}));
+  EXPECT_TRUE(lqp_columns_are_unique(PredicateNode::make(equals_(c_name, "a"), ValidateNode::make(customer)), {c_id}));
+
+  // Each order has at most one customer, but a customer can have many orders
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(o_c_id, c_id), orders, customer);
+  EXPECT_TRUE(lqp_columns_are_unique(join_node, {o_id}));
+  EXPECT_FALSE(lqp_columns_are_unique(join_node, {c_id}));
+  EXPECT_FALSE(lqp_columns_are_unique(JoinNode::make(JoinMode::Cross, orders, customer), {o_id}));
+  EXPECT_FALSE(lqp_columns_are_unique(JoinNode::make(JoinMode::Left, equals_(c_id, o_c_id), customer, orders), {c_id}));
+  EXPECT_TRUE(lqp_columns_are_unique(JoinNode::make(JoinMode::Semi, equals_(c_id, o_c_id), customer, orders), {c_id}));
+
+  // Each group is a single row. Grouping by a superset of a key yields the same groups as the key.
+  const auto aggregate_node = AggregateNode::make(expression_vector(o_c_id), expression_vector(count_star_()), orders);
+  EXPECT_TRUE(lqp_columns_are_unique(aggregate_node, {o_c_id}));
+  const auto no_aggregates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  EXPECT_TRUE(
+      lqp_columns_are_unique(AggregateNode::make(expression_vector(o_id, o_c_id), no_aggregates, orders), {o_id}));
+  EXPECT_FALSE(lqp_columns_are_unique(AggregateNode::make(expression_vector(o_c_id, c_name), no_aggregates, join_node),
+                                      {o_c_id}));
+}
+
 }  // namespace opossum
@@ -0,0 +1,108 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/offloading_lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/offload/abstract_offload_backend.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+namespace {
+
+// Offloads TableScans by putting a Limit without effect on top, so that the offloaded operators can be recognized
+class ScanOffloadBackend : public AbstractOffloadBackend {
+ public:
+  explicit ScanOffloadBackend(const size_t min_input_row_count) : _min_input_row_count(min_input_row_count) {}
+
+  size_t min_input_row_count() const override { return _min_input_row_count; }
+
+  std::shared_ptr<AbstractOperator> offload(const std::shared_ptr<AbstractOperator>& cpu_operator) const override {
+    offered_types.emplace_back(cpu_operator->type());
+    if (cpu_operator->type() != OperatorType::TableScan) return nullptr;
+    return std::make_shared<Limit>(cpu_operator, value_(std::numeric_limits<int64_t>::max()));
+  }
+
+  mutable std::vector<OperatorType> offered_types;
+
+ private:
+  const size_t _min_input_row_count;
+};
+
+}  // namespace
+
+class OffloadingLQPTranslatorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table_int_float = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    StorageManager::get().add_table("table_int_float", table_int_float);
+    StorageManager::get().add_table("table_int_float2", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+    int_float_node = StoredTableNode::make("table_int_float");
+    int_float_a = int_float_node->get_column("a");
+    int_float_b = int_float_node->get_column("b");
+    int_float2_node = StoredTableNode::make("table_int_float2");
+    int_float2_a = int_float2_node->get_column("a");
+    int_float2_b = int_float2_node->get_column("b");
+  }
+
+  std::shared_ptr<Table> table_int_float;
+  std::shared_ptr<StoredTableNode> int_float_node, int_float2_node;
+  LQPColumnReference int_float_a, int_float_b, int_float2_a, int_float2_b;
+};
+
+TEST_F(OffloadingLQPTranslatorTest, OffloadsSupportedOperators) {
+  const auto backend = std::make_shared<ScanOffloadBackend>(0);
+  const auto lqp = PredicateNode::make(greater_than_(int_float_a, 1000), int_float_node);
+  const auto pqp = OffloadingLQPTranslator{backend}.translate_node(lqp);
+
+  ASSERT_EQ(pqp->type(), OperatorType::Limit);
+  EXPECT_EQ(pqp->input_left()->type(), OperatorType::TableScan);
+  EXPECT_EQ(pqp->lqp_node, lqp);
+  EXPECT_EQ(backend->offered_types, std::vector<OperatorType>{OperatorType::TableScan});
+
+  _execute_all({pqp->mutable_input_left()->mutable_input_left(), pqp->mutable_input_left(), pqp});
+  const auto cpu_pqp = LQPTranslator{}.translate_node(lqp);
+  _execute_all({cpu_pqp->mutable_input_left(), cpu_pqp});
+  EXPECT_TABLE_EQ_ORDERED(pqp->get_output(), cpu_pqp->get_output());
+}
+
+TEST_F(OffloadingLQPTranslatorTest, KeepsDeclinedOperators) {
+  const auto backend = std::make_shared<ScanOffloadBackend>(0);
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(int_float_b, int_float2_b),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      PredicateNode::make(greater_than_(int_float_a, 0), int_float_node),
+      int_float2_node));
+  // clang-format on
+  const auto pqp = OffloadingLQPTranslator{backend}.translate_node(lqp);
+
+  // The JoinHash is offered but declined, the scan of its input is offloaded
+  ASSERT_EQ(pqp->type(), OperatorType::JoinHash);
+  EXPECT_EQ(pqp->input_left()->type(), OperatorType::Limit);
+  EXPECT_EQ(backend->offered_types, (std::vector<OperatorType>{OperatorType::TableScan, OperatorType::JoinHash}));
+}
+
+TEST_F(OffloadingLQPTranslatorTest, KeepsSmallInputsOnTheCPU) {
+  const auto backend = std::make_shared<ScanOffloadBackend>(std::numeric_limits<size_t>::max());
+  const auto lqp = PredicateNode::make(greater_than_(int_float_a, 1000), int_float_node);
+  const auto pqp = OffloadingLQPTranslator{backend}.translate_node(lqp);
+
+  EXPECT_EQ(pqp->type(), OperatorType::TableScan);
+  EXPECT_TRUE(backend->offered_types.empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/arena_memory_resource.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ArenaMemoryResourceTest : public BaseTest {};
+
+TEST_F(ArenaMemoryResourceTest, AllocationsAreAlignedAndDisjoint) {
+  auto arena = ArenaMemoryResource{};
+
+  const auto first = static_cast<char*>(arena.allocate(3, 1));
+  const auto second = static_cast<char*>(arena.allocate(8, 8));
+  const auto third = static_cast<char*>(arena.allocate(16, 16));
+
+  EXPECT_GE(second, first + 3);
+  EXPECT_GE(third, second + 8);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % 8, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(third) % 16, 0u);
+  EXPECT_EQ(arena.allocated_bytes(), ArenaMemoryResource::INITIAL_BLOCK_SIZE);
+
+  // Allocations with larger alignments are passed to the upstream resource
+  arena.allocate(64, 64);
+  EXPECT_EQ(arena.allocated_bytes(), ArenaMemoryResource::INITIAL_BLOCK_SIZE + 64);
+}
+
+TEST_F(ArenaMemoryResourceTest, GrowsByAddingBlocks) {
+  auto arena = ArenaMemoryResource{};
+
+  auto vector = pmr_vector<int32_t>{PolymorphicAllocator<int32_t>{&arena}};
+  for (auto value = int32_t{0}; value < 1'000'000; ++value) {
+    vector.emplace_back(value);
+  }
+
+  for (auto value = int32_t{0}; value < 1'000'000; ++value) {
+    ASSERT_EQ(vector[value], value);
+  }
+  EXPECT_GT(arena.allocated_bytes(), ArenaMemoryResource::INITIAL_BLOCK_SIZE);
+}
+
+TEST_F(ArenaMemoryResourceTest, ConcurrentAllocations) {
+  auto arena = ArenaMemoryResource{};
+  const auto thread_count = 4;
+  const auto allocations_per_thread = 10'000;
+
+  auto pointers = std::vector<std::vector<size_t*>>(thread_count);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto allocation_id = 0; allocation_id < allocations_per_thread; ++allocation_id) {
+        auto pointer = static_cast<size_t*>(arena.allocate(sizeof(size_t), alignof(size_t)));
+        *pointer = thread_id * allocations_per_thread + allocation_id;
+        pointers[thread_id].emplace_back(pointer);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // No allocation was handed out twice
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    for (auto allocation_id = 0; allocation_id < allocations_per_thread; ++allocation_id) {
+      EXPECT_EQ(*pointers[thread_id][allocation_id], thread_id * allocations_per_thread + allocation_id);
+    }
+  }
+}
+
+TEST_F(ArenaMemoryResourceTest, MakeSharedInArenaKeepsArenaAlive) {
+  auto arena = std::make_shared<ArenaMemoryResource>();
+  auto weak_arena = std::weak_ptr<ArenaMemoryResource>{arena};
+
+  auto pos_list = make_shared_in_arena<PosList>(arena, 3, RowID{ChunkID{1}, ChunkOffset{2}});
+  EXPECT_EQ(pos_list->get_allocator().resource(), arena.get());
+
+  arena.reset();
+  EXPECT_FALSE(weak_arena.expired());
+  EXPECT_EQ((*pos_list)[2], (RowID{ChunkID{1}, ChunkOffset{2}}));
+
+  pos_list.reset();
+  EXPECT_TRUE(weak_arena.expired());
+}
+
+TEST_F(ArenaMemoryResourceTest, MakeSharedWithoutArena) {
+  const auto pos_list = make_shared_in_arena<PosList>(nullptr, 3);
+  EXPECT_EQ(pos_list->size(), 3u);
+  EXPECT_EQ(pos_list->get_allocator().resource(), PolymorphicAllocator<RowID>{}.resource());
+}
+
+}  // namespace opossum
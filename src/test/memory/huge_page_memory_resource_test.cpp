@@ -0,0 +1,61 @@
+#include <memory>
+#include <numeric>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/huge_page_memory_resource.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HugePageMemoryResourceTest : public BaseTest {};
+
+TEST_F(HugePageMemoryResourceTest, MappingSize) {
+  EXPECT_EQ(HugePageMemoryResource::mapping_size(1), HugePageMemoryResource::HUGE_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapping_size(HugePageMemoryResource::HUGE_PAGE_SIZE),
+            HugePageMemoryResource::HUGE_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapping_size(HugePageMemoryResource::HUGE_PAGE_SIZE + 1),
+            2 * HugePageMemoryResource::HUGE_PAGE_SIZE);
+  EXPECT_EQ(HugePageMemoryResource::mapping_size(HugePageMemoryResource::GIGANTIC_PAGE_SIZE + 1),
+            2 * HugePageMemoryResource::GIGANTIC_PAGE_SIZE);
+}
+
+TEST_F(HugePageMemoryResourceTest, SmallAllocationsGoUpstream) {
+  auto resource = HugePageMemoryResource{};
+
+  auto vector = pmr_vector<int32_t>(1'000, PolymorphicAllocator<int32_t>{&resource});
+  EXPECT_EQ(resource.mapped_bytes(), 0u);
+}
+
+TEST_F(HugePageMemoryResourceTest, LargeAllocations) {
+  // A low threshold and a node id must not change the behavior, even on machines without huge pages or NUMA
+  auto resource = HugePageMemoryResource{0, 1'000};
+
+  {
+    auto vector = pmr_vector<int32_t>(1'000'000, PolymorphicAllocator<int32_t>{&resource});
+    std::iota(vector.begin(), vector.end(), 0);
+    EXPECT_EQ(vector[999'999], 999'999);
+
+#ifdef __linux__
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(vector.data()) % HugePageMemoryResource::HUGE_PAGE_SIZE, 0u);
+    EXPECT_EQ(resource.mapped_bytes(), HugePageMemoryResource::mapping_size(1'000'000 * sizeof(int32_t)));
+#endif
+  }
+
+  EXPECT_EQ(resource.mapped_bytes(), 0u);
+}
+
+TEST_F(HugePageMemoryResourceTest, EncodedSegmentsUseHugePages) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{1, 2, 1});
+  const auto encoded_segment = encode_segment(EncodingType::Dictionary, DataType::Int, value_segment);
+
+  const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(encoded_segment);
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_EQ(dictionary_segment->dictionary()->get_allocator().resource(), HugePageMemoryResource::get_default());
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/arena_memory_resource.hpp"
+#include "memory/memory_budget.hpp"
+
+namespace opossum {
+
+class MemoryBudgetTest : public BaseTest {};
+
+TEST_F(MemoryBudgetTest, ReservationsAreReleased) {
+  auto budget = MemoryBudget{1'000};
+
+  {
+    auto reservation = budget.try_reserve(600);
+    ASSERT_TRUE(reservation);
+    EXPECT_EQ(reservation->bytes(), 600u);
+    EXPECT_EQ(budget.used_bytes(), 600u);
+    EXPECT_EQ(budget.available_bytes(), 400u);
+
+    // The second reservation exceeds the budget
+    EXPECT_FALSE(budget.try_reserve(600));
+    EXPECT_EQ(budget.used_bytes(), 600u);
+
+    const auto moved_reservation = std::move(reservation);
+    EXPECT_EQ(budget.used_bytes(), 600u);
+  }
+
+  EXPECT_EQ(budget.used_bytes(), 0u);
+  EXPECT_TRUE(budget.try_reserve(1'000));
+}
+
+TEST_F(MemoryBudgetTest, PeakBytes) {
+  auto budget = MemoryBudget{};
+  EXPECT_EQ(budget.limit(), MemoryBudget::UNLIMITED);
+
+  budget.track(100);
+  {
+    const auto reservation = budget.try_reserve(500);
+    EXPECT_TRUE(reservation);
+  }
+  budget.track(100);
+
+  EXPECT_EQ(budget.used_bytes(), 200u);
+  EXPECT_EQ(budget.peak_bytes(), 600u);
+}
+
+TEST_F(MemoryBudgetTest, TrackedMemoryCanExceedTheLimit) {
+  auto budget = MemoryBudget{1'000};
+
+  budget.track(1'500);
+  EXPECT_EQ(budget.used_bytes(), 1'500u);
+  EXPECT_EQ(budget.available_bytes(), 0u);
+  EXPECT_FALSE(budget.try_reserve(1));
+}
+
+TEST_F(MemoryBudgetTest, ArenaChargesItsBlocks) {
+  const auto budget = std::make_shared<MemoryBudget>(1'000'000);
+  auto arena = ArenaMemoryResource{budget};
+  EXPECT_EQ(arena.memory_budget(), budget);
+
+  arena.allocate(16, 8);
+  EXPECT_EQ(budget->used_bytes(), ArenaMemoryResource::INITIAL_BLOCK_SIZE);
+
+  // Large allocations are passed to the upstream resource
+  arena.allocate(ArenaMemoryResource::MAX_BLOCK_SIZE, 8);
+  EXPECT_EQ(budget->used_bytes(), arena.allocated_bytes());
+  EXPECT_EQ(budget->available_bytes(), 0u);
+}
+
+}  // namespace opossum
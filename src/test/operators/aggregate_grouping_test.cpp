@@ -0,0 +1,124 @@
+#include <array>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate/aggregate_grouping.hpp"
+
+namespace opossum {
+
+/*
+  Tests the grouping step of the Aggregate operator, both with and without radix partitioning.
+*/
+
+class AggregateGroupingTest : public BaseTest {
+ protected:
+  // Creates 7 chunks of 3'000 keys each
+  template <typename AggregateKey, typename KeyFunction>
+  KeysPerChunk<AggregateKey> create_keys(const KeyFunction& key_function) {
+    auto keys_per_chunk = KeysPerChunk<AggregateKey>{};
+    auto row_index = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < 7; ++chunk_id) {
+      keys_per_chunk.emplace_back();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 3'000; ++chunk_offset) {
+        keys_per_chunk.back().emplace_back(key_function(row_index++));
+      }
+    }
+    return keys_per_chunk;
+  }
+
+  // Checks that equal keys (and only those) have the same group id, that group ids are dense, and that each group
+  // references the first row with its key.
+  template <typename AggregateKey>
+  void check_groups(const KeysPerChunk<AggregateKey>& keys_per_chunk, const AggregateGroups& groups) {
+    auto group_id_by_key = std::map<AggregateKey, AggregateResultId>{};
+    auto group_ids = std::set<AggregateResultId>{};
+
+    ASSERT_EQ(groups.group_ids_per_chunk.size(), keys_per_chunk.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < keys_per_chunk.size(); ++chunk_id) {
+      ASSERT_EQ(groups.group_ids_per_chunk[chunk_id].size(), keys_per_chunk[chunk_id].size());
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys_per_chunk[chunk_id].size(); ++chunk_offset) {
+        const auto group_id = groups.group_ids_per_chunk[chunk_id][chunk_offset];
+        ASSERT_LT(group_id, groups.row_ids.size());
+
+        const auto [iter, inserted] = group_id_by_key.emplace(keys_per_chunk[chunk_id][chunk_offset], group_id);
+        if (inserted) {
+          EXPECT_TRUE(group_ids.emplace(group_id).second);
+          EXPECT_EQ(groups.row_ids[group_id], (RowID{chunk_id, chunk_offset}));
+        } else {
+          EXPECT_EQ(iter->second, group_id);
+        }
+      }
+    }
+
+    EXPECT_EQ(group_ids.size(), groups.row_ids.size());
+  }
+};
+
+TEST_F(AggregateGroupingTest, SingleKeyEntry) {
+  const auto keys_per_chunk =
+      create_keys<AggregateKeyEntry>([](const auto row_index) { return AggregateKeyEntry{(row_index * 7919) % 5003}; });
+
+  for (const auto radix_bits : {size_t{0}, size_t{1}, size_t{4}}) {
+    // The estimated group count is deliberately too low, the tables have to grow
+    const auto groups = group_aggregate_keys(keys_per_chunk, 100, radix_bits);
+    check_groups(keys_per_chunk, groups);
+    EXPECT_EQ(groups.row_ids.size(), 5003);
+  }
+}
+
+TEST_F(AggregateGroupingTest, ArrayKey) {
+  using AggregateKey = std::array<AggregateKeyEntry, 2>;
+  const auto keys_per_chunk = create_keys<AggregateKey>(
+      [](const auto row_index) { return AggregateKey{row_index % 13, (row_index * 31) % 977}; });
+
+  for (const auto radix_bits : {size_t{0}, size_t{3}}) {
+    check_groups(keys_per_chunk, group_aggregate_keys(keys_per_chunk, 12'701, radix_bits));
+  }
+}
+
+TEST_F(AggregateGroupingTest, VectorKey) {
+  using AggregateKey = std::vector<AggregateKeyEntry>;
+  const auto keys_per_chunk = create_keys<AggregateKey>(
+      [](const auto row_index) { return AggregateKey{row_index % 3, row_index % 5, row_index % 101}; });
+
+  for (const auto radix_bits : {size_t{0}, size_t{3}}) {
+    check_groups(keys_per_chunk, group_aggregate_keys(keys_per_chunk, 1'515, radix_bits));
+  }
+}
+
+TEST_F(AggregateGroupingTest, FirstOccurrenceOrderWithoutPartitioning) {
+  const auto keys_per_chunk = create_keys<AggregateKeyEntry>(
+      [](const auto row_index) { return AggregateKeyEntry{row_index % 10}; });
+  const auto groups = group_aggregate_keys(keys_per_chunk, 10, 0);
+
+  ASSERT_EQ(groups.row_ids.size(), 10);
+  for (auto group_id = AggregateResultId{0}; group_id < 10; ++group_id) {
+    EXPECT_EQ(groups.row_ids[group_id], (RowID{ChunkID{0}, static_cast<ChunkOffset>(group_id)}));
+  }
+}
+
+TEST_F(AggregateGroupingTest, DenseKeys) {
+  // Packed keys, e.g., built from the ValueIDs of two dictionary-encoded columns with 4 bits each
+  const auto keys_per_chunk = create_keys<AggregateKeyEntry>(
+      [](const auto row_index) { return AggregateKeyEntry{((row_index % 13) << 4) | (row_index % 3)}; });
+  const auto groups = group_dense_aggregate_keys(keys_per_chunk, 1 << 8);
+
+  check_groups(keys_per_chunk, groups);
+  EXPECT_EQ(groups.row_ids.size(), 39);
+  for (auto group_id = AggregateResultId{0}; group_id < 39; ++group_id) {
+    EXPECT_EQ(groups.row_ids[group_id], (RowID{ChunkID{0}, static_cast<ChunkOffset>(group_id)}));
+  }
+}
+
+TEST_F(AggregateGroupingTest, RadixBits) {
+  // Few groups fit into the cache without partitioning
+  EXPECT_EQ(calculate_aggregate_radix_bits<AggregateKeyEntry>(100), 0);
+  EXPECT_GT(calculate_aggregate_radix_bits<AggregateKeyEntry>(10'000'000), 0);
+}
+
+}  // namespace opossum
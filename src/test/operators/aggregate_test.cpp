@@ -10,6 +10,8 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "memory/arena_memory_resource.hpp"
+#include "memory/memory_budget.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/join_hash.hpp"
@@ -17,9 +19,13 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -592,4 +598,349 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, ApproxCountDistinct) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_id = 0; row_id < 1'000; ++row_id) {
+    table->append({0, row_id % 10});
+  }
+  for (auto row_id = 0; row_id < 40'000; ++row_id) {
+    table->append({1, row_id % 20'000});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::CountDistinct},
+                                             {ColumnID{1}, AggregateFunction::ApproxCountDistinct}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto& output = aggregate->get_output();
+  ASSERT_EQ(output->row_count(), 2);
+  EXPECT_EQ(output->column_name(ColumnID{2}), "APPROX_COUNT_DISTINCT(b)");
+  EXPECT_FALSE(output->column_is_nullable(ColumnID{2}));
+
+  for (auto row_id = size_t{0}; row_id < 2; ++row_id) {
+    const auto exact_count = output->get_value<int64_t>(ColumnID{1}, row_id);
+    EXPECT_EQ(exact_count, output->get_value<int>(ColumnID{0}, row_id) == 0 ? 10 : 20'000);
+
+    // The estimate of the HyperLogLog sketch has a standard error of 1.6%
+    EXPECT_NEAR(output->get_value<int64_t>(ColumnID{2}, row_id), exact_count, 0.07 * exact_count);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, HighCardinalityGroupBy) {
+  // With that many groups, the keys are radix partitioned before grouping (see aggregate_grouping.hpp)
+  const auto group_count = 20'000;
+  const auto rows_per_group = 3;
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+  column_definitions.emplace_back("c", DataType::Int);
+  column_definitions.emplace_back("d", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_id = 0; row_id < group_count * rows_per_group; ++row_id) {
+    table->append({row_id % group_count, (row_id % group_count) / 100, row_id, (row_id % group_count) % 7});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // One, two, and three group-by columns use different AggregateKey types
+  const auto groupby_column_id_lists = std::vector<std::vector<ColumnID>>{
+      {ColumnID{0}}, {ColumnID{0}, ColumnID{1}}, {ColumnID{3}, ColumnID{0}, ColumnID{1}}};
+
+  for (const auto& groupby_column_ids : groupby_column_id_lists) {
+    const auto aggregate = std::make_shared<Aggregate>(
+        table_wrapper,
+        std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Min},
+                                               {std::nullopt, AggregateFunction::Count}},
+        groupby_column_ids);
+    aggregate->execute();
+
+    const auto& output = aggregate->get_output();
+    ASSERT_EQ(output->row_count(), group_count);
+
+    const auto a_column_id = groupby_column_ids[0] == ColumnID{0} ? ColumnID{0} : ColumnID{1};
+    const auto min_column_id = static_cast<ColumnID>(groupby_column_ids.size());
+    const auto count_column_id = static_cast<ColumnID>(groupby_column_ids.size() + 1);
+    auto seen_groups = std::set<int>{};
+    for (auto row_id = size_t{0}; row_id < output->row_count(); ++row_id) {
+      const auto a = output->get_value<int>(a_column_id, row_id);
+      seen_groups.emplace(a);
+
+      // The first row of each group has c == a
+      EXPECT_EQ(output->get_value<int>(min_column_id, row_id), a);
+      EXPECT_EQ(output->get_value<int64_t>(count_column_id, row_id), rows_per_group);
+    }
+    EXPECT_EQ(seen_groups.size(), group_count);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryValueIDGroupBy) {
+  // Group-bys on dictionary-encoded columns build the keys from the ValueIDs. As each chunk has its own dictionary, the
+  // ValueIDs have to be mapped to column-wide ids. The result has to equal that of the unencoded table.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+  column_definitions.emplace_back("c", DataType::Int);
+
+  const auto unencoded_table = std::make_shared<Table>(column_definitions, TableType::Data, 7);
+  const auto dictionary_table = std::make_shared<Table>(column_definitions, TableType::Data, 7);
+  for (auto row_id = 0; row_id < 100; ++row_id) {
+    const auto a = row_id % 11 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(row_id * 3) % 5};
+    const auto b = AllTypeVariant{pmr_string{"s"} + pmr_string{std::to_string((row_id / 13) % 4)}};
+    unencoded_table->append({a, b, row_id});
+    dictionary_table->append({a, b, row_id});
+  }
+  ChunkEncoder::encode_all_chunks(dictionary_table);
+
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(unencoded_table);
+  unencoded_table_wrapper->execute();
+  const auto dictionary_table_wrapper = std::make_shared<TableWrapper>(dictionary_table);
+  dictionary_table_wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Min},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+  const auto groupby_column_id_lists = std::vector<std::vector<ColumnID>>{
+      {ColumnID{0}}, {ColumnID{1}}, {ColumnID{0}, ColumnID{1}}, {ColumnID{1}, ColumnID{0}, ColumnID{2}}};
+
+  for (const auto& groupby_column_ids : groupby_column_id_lists) {
+    const auto expected_aggregate =
+        std::make_shared<Aggregate>(unencoded_table_wrapper, aggregates, groupby_column_ids);
+    expected_aggregate->execute();
+
+    const auto aggregate = std::make_shared<Aggregate>(dictionary_table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
+TEST_F(OperatorsAggregateTest, PackedGroupByKeys) {
+  // The ids of the group-by columns are packed into a 64-bit key, a 128-bit key, or, if they need more bits, stored in
+  // a vector. Each unencoded chunk of 64 rows can hold up to 64 distinct values, so that each column needs 8 bits for
+  // the 200 rows. Column 0 is dictionary-encoded and needs only 6 bits, shifting the following columns so that the
+  // ninth column straddles both entries of the 128-bit key.
+  const auto column_count = 17;
+  const auto group_count = 10;
+  const auto row_count = 200;
+
+  TableColumnDefinitions column_definitions;
+  for (auto column_id = 0; column_id < column_count; ++column_id) {
+    column_definitions.emplace_back("c" + std::to_string(column_id), DataType::Int, column_id == 1);
+  }
+  column_definitions.emplace_back("v", DataType::Int);
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 64);
+  for (auto row_id = 0; row_id < row_count; ++row_id) {
+    const auto group = row_id % group_count;
+    auto row = std::vector<AllTypeVariant>{};
+    for (auto column_id = 0; column_id < column_count; ++column_id) {
+      row.emplace_back(column_id == 1 && group == 3 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{group + column_id});
+    }
+    row.emplace_back(row_id);
+    table->append(row);
+  }
+
+  auto chunk_encoding_spec = ChunkEncodingSpec(column_count + 1, SegmentEncodingSpec{EncodingType::Unencoded});
+  chunk_encoding_spec[0] = SegmentEncodingSpec{EncodingType::Dictionary};
+  ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // 6 + 3 * 8 = 30 bits, 6 + 8 * 8 = 70 bits, and 6 + 16 * 8 = 134 bits
+  for (const auto groupby_column_count : {4, 9, column_count}) {
+    auto groupby_column_ids = std::vector<ColumnID>{};
+    for (auto column_id = ColumnID{0}; column_id < groupby_column_count; ++column_id) {
+      groupby_column_ids.emplace_back(column_id);
+    }
+
+    const auto aggregate = std::make_shared<Aggregate>(
+        table_wrapper,
+        std::vector<AggregateColumnDefinition>{{ColumnID{column_count}, AggregateFunction::Min},
+                                               {std::nullopt, AggregateFunction::Count}},
+        groupby_column_ids);
+    aggregate->execute();
+
+    const auto& output = aggregate->get_output();
+    ASSERT_EQ(output->row_count(), group_count);
+    ASSERT_EQ(output->chunk_count(), 1u);
+
+    const auto chunk = output->get_chunk(ChunkID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < group_count; ++chunk_offset) {
+      const auto value = [&](const int column_id) {
+        return (*chunk->get_segment(static_cast<ColumnID>(column_id)))[chunk_offset];
+      };
+
+      const auto group = get<int>(value(0));
+      for (auto column_id = 1; column_id < groupby_column_count; ++column_id) {
+        if (column_id == 1 && group == 3) {
+          EXPECT_TRUE(variant_is_null(value(column_id)));
+        } else {
+          EXPECT_EQ(get<int>(value(column_id)), group + column_id);
+        }
+      }
+      EXPECT_EQ(get<int>(value(groupby_column_count)), group);
+      EXPECT_EQ(get<int64_t>(value(groupby_column_count + 1)), row_count / group_count);
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateTest, ParallelPartialAggregates) {
+  // With few groups, ranges of chunks are grouped and aggregated in parallel and merged afterwards. The result,
+  // including the order of the groups, has to equal that of the sequential aggregation.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int, true);
+  column_definitions.emplace_back("c", DataType::String);
+
+  const auto unencoded_table = std::make_shared<Table>(column_definitions, TableType::Data, 500);
+  const auto dictionary_table = std::make_shared<Table>(column_definitions, TableType::Data, 500);
+  for (auto row_id = 0; row_id < 5'000; ++row_id) {
+    // The groups with a >= 5 only appear in later chunks
+    const auto a = row_id < 2'500 ? row_id % 5 : row_id % 7;
+    const auto b = row_id % 13 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_id % 101};
+    const auto c = AllTypeVariant{pmr_string{"s"} + pmr_string{std::to_string(row_id % 37)}};
+    unencoded_table->append({a, b, c});
+    dictionary_table->append({a, b, c});
+  }
+  ChunkEncoder::encode_all_chunks(dictionary_table);
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{
+      {ColumnID{1}, AggregateFunction::Min},           {ColumnID{1}, AggregateFunction::Max},
+      {ColumnID{1}, AggregateFunction::Sum},           {ColumnID{1}, AggregateFunction::Avg},
+      {ColumnID{1}, AggregateFunction::Count},         {std::nullopt, AggregateFunction::Count},
+      {ColumnID{1}, AggregateFunction::CountDistinct}, {ColumnID{1}, AggregateFunction::ApproxCountDistinct},
+      {ColumnID{2}, AggregateFunction::Min},           {ColumnID{2}, AggregateFunction::CountDistinct}};
+
+  for (const auto& table : {unencoded_table, dictionary_table}) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    for (const auto& groupby_column_ids : std::vector<std::vector<ColumnID>>{{}, {ColumnID{0}}}) {
+      const auto expected_aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+      expected_aggregate->execute();
+
+      Topology::use_fake_numa_topology(8, 4);
+      CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+      const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+      aggregate->execute();
+
+      CurrentScheduler::get()->finish();
+      CurrentScheduler::set(nullptr);
+
+      EXPECT_TABLE_EQ_ORDERED(aggregate->get_output(), expected_aggregate->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateTest, RunLengthEncodedSegments) {
+  // RunLengthSegments are aggregated and grouped run by run. The runs of b span several groups of a and contain NULLs.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int, true);
+  column_definitions.emplace_back("c", DataType::Float);
+  column_definitions.emplace_back("d", DataType::String);
+
+  const auto unencoded_table = std::make_shared<Table>(column_definitions, TableType::Data, 40);
+  const auto run_length_table = std::make_shared<Table>(column_definitions, TableType::Data, 40);
+  for (auto row_id = 0; row_id < 200; ++row_id) {
+    const auto a = row_id / 7;
+    const auto b = row_id % 50 >= 40 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_id / 15};
+    const auto c = static_cast<float>(row_id / 12) + 0.5f;
+    const auto d = AllTypeVariant{pmr_string{"s"} + pmr_string{std::to_string(row_id / 30)}};
+    unencoded_table->append({a, b, c, d});
+    run_length_table->append({a, b, c, d});
+  }
+  ChunkEncoder::encode_all_chunks(run_length_table, SegmentEncodingSpec{EncodingType::RunLength});
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{
+      {ColumnID{1}, AggregateFunction::Min},           {ColumnID{1}, AggregateFunction::Max},
+      {ColumnID{1}, AggregateFunction::Sum},           {ColumnID{1}, AggregateFunction::Avg},
+      {ColumnID{1}, AggregateFunction::Count},         {std::nullopt, AggregateFunction::Count},
+      {ColumnID{1}, AggregateFunction::CountDistinct}, {ColumnID{2}, AggregateFunction::Sum},
+      {ColumnID{3}, AggregateFunction::Max},           {ColumnID{3}, AggregateFunction::CountDistinct}};
+
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(unencoded_table);
+  unencoded_table_wrapper->execute();
+  const auto run_length_table_wrapper = std::make_shared<TableWrapper>(run_length_table);
+  run_length_table_wrapper->execute();
+
+  for (const auto& groupby_column_ids :
+       std::vector<std::vector<ColumnID>>{{}, {ColumnID{0}}, {ColumnID{1}}, {ColumnID{3}, ColumnID{1}}}) {
+    const auto expected_aggregate =
+        std::make_shared<Aggregate>(unencoded_table_wrapper, aggregates, groupby_column_ids);
+    expected_aggregate->execute();
+
+    const auto aggregate = std::make_shared<Aggregate>(run_length_table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
+TEST_F(OperatorsAggregateTest, AggregateWithSpilling) {
+  // With a budget of a single byte, the input is partitioned by the group-by values and spilled to disk
+  const auto arena = std::make_shared<ArenaMemoryResource>(std::make_shared<MemoryBudget>(1));
+
+  const auto test_spilled_output = [&](const std::shared_ptr<AbstractOperator>& in,
+                                       const std::vector<AggregateColumnDefinition>& aggregates,
+                                       const std::vector<ColumnID>& groupby_column_ids, const std::string& file_name) {
+    const auto aggregate = std::make_shared<Aggregate>(in, aggregates, groupby_column_ids);
+    aggregate->set_arena_recursively(arena);
+    aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), load_table(file_name, 1));
+  };
+
+  test_spilled_output(_table_wrapper_1_2,
+                      {{ColumnID{1}, AggregateFunction::Sum}, {ColumnID{2}, AggregateFunction::Avg}}, {ColumnID{0}},
+                      "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_2agg/sum_avg.tbl");
+  test_spilled_output(_table_wrapper_2_1, {{ColumnID{2}, AggregateFunction::Max}}, {ColumnID{0}, ColumnID{1}},
+                      "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_1agg/max.tbl");
+  test_spilled_output(_table_wrapper_1_1_string, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{0}},
+                      "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str.tbl");
+}
+
+TEST_F(OperatorsAggregateTest, PartitionWiseAggregate) {
+  // The input is range-partitioned by a group-by column, so the partitions are aggregated independently
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  table->set_partitioning(TablePartitioning::create_range_partitioning(ColumnID{0}, DataType::Int, {5, 10}));
+  const auto table_unpartitioned = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  for (auto row = 0; row < 30; ++row) {
+    const auto value = row % 9 == 0 ? NULL_VALUE : AllTypeVariant{row % 13};
+    table->append({value, row % 4});
+    table_unpartitioned->append({value, row % 4});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto table_wrapper_unpartitioned = std::make_shared<TableWrapper>(table_unpartitioned);
+  table_wrapper_unpartitioned->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                                                 {ColumnID{1}, AggregateFunction::Count}};
+  const auto groupby_column_id_lists =
+      std::vector<std::vector<ColumnID>>{{ColumnID{0}}, {ColumnID{1}, ColumnID{0}}};
+  for (const auto& groupby_column_ids : groupby_column_id_lists) {
+    const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    const auto expected_aggregate = std::make_shared<Aggregate>(table_wrapper_unpartitioned, aggregates,
+                                                                groupby_column_ids);
+    expected_aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+    const auto& performance_data = static_cast<const Aggregate::PerformanceData&>(aggregate->performance_data());
+    EXPECT_EQ(performance_data.table_partition_count, 3u);
+  }
+}
+
 }  // namespace opossum
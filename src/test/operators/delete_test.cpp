@@ -17,6 +17,7 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -141,6 +142,45 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result->get_output());
 }
 
+TEST_F(OperatorsDeleteTest, RollbackUnlocksRowsOfAllChunks) {
+  // table_b has three chunks. Its first row is locked by t1, so the Delete of t2 fails. Rows in other chunks might
+  // have been locked by t2 in the meantime and have to be unlocked by the rollback.
+  auto t1_context = TransactionManager::get().new_transaction_context();
+  auto t2_context = TransactionManager::get().new_transaction_context();
+
+  auto gt = std::make_shared<GetTable>(_table2_name);
+  gt->execute();
+
+  auto table_scan1 = create_table_scan(gt, ColumnID{1}, PredicateCondition::Equals, 10);
+  auto table_scan2 = create_table_scan(gt, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  table_scan1->execute();
+  table_scan2->execute();
+
+  auto delete_op1 = std::make_shared<Delete>(table_scan1);
+  delete_op1->set_transaction_context(t1_context);
+  delete_op1->execute();
+
+  auto delete_op2 = std::make_shared<Delete>(table_scan2);
+  delete_op2->set_transaction_context(t2_context);
+  delete_op2->execute();
+
+  EXPECT_FALSE(delete_op1->execute_failed());
+  EXPECT_TRUE(delete_op2->execute_failed());
+
+  t2_context->rollback();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table2->chunk_count(); ++chunk_id) {
+    const auto chunk = _table2->get_chunk(chunk_id);
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto expected_tid = chunk_id == ChunkID{0} && chunk_offset == 0 ? t1_context->transaction_id() : 0u;
+      EXPECT_EQ(mvcc_data->tids[chunk_offset], expected_tid);
+    }
+  }
+
+  t1_context->commit();
+}
+
 TEST_F(OperatorsDeleteTest, EmptyDelete) {
   auto tx_context_modification = TransactionManager::get().new_transaction_context();
 
@@ -349,4 +389,102 @@ TEST_F(OperatorsDeleteTest, PrunedInputTable) {
   EXPECT_EQ(_table2->get_chunk(ChunkID{2})->get_scoped_mvcc_data_lock()->end_cids.at(1u), expected_end_cid);
 }
 
+TEST_F(OperatorsDeleteTest, DeleteEntireChunks) {
+  // table_b has the chunks {4, 1, 13}, {6, 4, 8}, and {7, 0}. Once they are encoded, their statistics prove that all
+  // rows of the second chunk match `a >= 4`, so that it is deleted as a whole.
+  ChunkEncoder::encode_all_chunks(_table2);
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto gt = std::make_shared<GetTable>(_table2_name);
+  gt->execute();
+  const auto validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::GreaterThanEquals, 4);
+  table_scan->execute();
+
+  const auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  EXPECT_FALSE(delete_op->execute_failed());
+  transaction_context->commit();
+
+  const auto commit_id = transaction_context->commit_id();
+  {
+    const auto mvcc_data = _table2->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+    EXPECT_EQ(mvcc_data->chunk_tid.load(), transaction_context->transaction_id());
+    EXPECT_EQ(mvcc_data->chunk_end_cid.load(), commit_id);
+    EXPECT_EQ(mvcc_data->end_cids.at(0u), MvccData::MAX_COMMIT_ID);
+    EXPECT_EQ(mvcc_data->get_end_cid(0u), commit_id);
+  }
+  {
+    const auto mvcc_data = _table2->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock();
+    EXPECT_EQ(mvcc_data->chunk_end_cid.load(), MvccData::MAX_COMMIT_ID);
+    EXPECT_EQ(mvcc_data->end_cids.at(0u), commit_id);
+    EXPECT_EQ(mvcc_data->end_cids.at(1u), MvccData::MAX_COMMIT_ID);
+  }
+  EXPECT_EQ(_table2->get_chunk(ChunkID{1})->invalid_row_count(), 3u);
+
+  // The deleted chunk is skipped by later transactions
+  auto verification_context = TransactionManager::get().new_transaction_context();
+  const auto verification_validate = std::make_shared<Validate>(gt);
+  verification_validate->set_transaction_context(verification_context);
+  verification_validate->execute();
+
+  auto expected_result = std::make_shared<Table>(_table2->column_definitions(), TableType::Data);
+  expected_result->append({1, 3});
+  expected_result->append({0, 18});
+  EXPECT_TABLE_EQ_UNORDERED(verification_validate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsDeleteTest, ChunkDeleteConflictsWithRowDelete) {
+  ChunkEncoder::encode_all_chunks(_table2);
+
+  const auto gt = std::make_shared<GetTable>(_table2_name);
+  gt->execute();
+
+  // Deletes the rows of the second chunk that match the predicate
+  const auto delete_rows = [&](const auto& transaction_context, const PredicateCondition predicate_condition,
+                               const int32_t value) {
+    const auto table_scan = create_table_scan(gt, ColumnID{0}, predicate_condition, value);
+    table_scan->execute();
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+    return !delete_op->execute_failed();
+  };
+
+  // A row lock prevents the chunk lock
+  {
+    auto t1_context = TransactionManager::get().new_transaction_context();
+    auto t2_context = TransactionManager::get().new_transaction_context();
+
+    EXPECT_TRUE(delete_rows(t1_context, PredicateCondition::Equals, 6));
+    EXPECT_FALSE(delete_rows(t2_context, PredicateCondition::GreaterThanEquals, 4));
+    t2_context->rollback();
+    t1_context->rollback();
+  }
+
+  // A chunk lock prevents the row lock. The rollback unlocks the chunk and the row.
+  {
+    auto t1_context = TransactionManager::get().new_transaction_context();
+    auto t2_context = TransactionManager::get().new_transaction_context();
+
+    EXPECT_TRUE(delete_rows(t1_context, PredicateCondition::GreaterThanEquals, 4));
+    const auto chunk_tid = _table2->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->chunk_tid.load();
+    EXPECT_EQ(chunk_tid, t1_context->transaction_id());
+    EXPECT_FALSE(delete_rows(t2_context, PredicateCondition::Equals, 6));
+    t2_context->rollback();
+    t1_context->rollback();
+  }
+
+  const auto mvcc_data = _table2->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+  EXPECT_EQ(mvcc_data->chunk_tid.load(), 0u);
+  EXPECT_EQ(mvcc_data->chunk_end_cid.load(), MvccData::MAX_COMMIT_ID);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 3; ++chunk_offset) {
+    EXPECT_EQ(mvcc_data->tids[chunk_offset], 0u);
+  }
+}
+
 }  // namespace opossum
@@ -60,6 +60,31 @@ TEST_F(OperatorsDifferenceTest, DifferneceOnReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
 }
 
+TEST_F(OperatorsDifferenceTest, DuplicatesAndNulls) {
+  auto table_wrapper_left =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/set_operation_left.tbl", 2));
+  table_wrapper_left->execute();
+  auto table_wrapper_right =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/set_operation_right.tbl", 3));
+  table_wrapper_right->execute();
+
+  auto difference_unique =
+      std::make_shared<Difference>(table_wrapper_left, table_wrapper_right, SetOperationMode::Unique);
+  difference_unique->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference_unique->get_output(),
+                            load_table("resources/test_data/tbl/set_operation_except.tbl"));
+
+  auto difference_all = std::make_shared<Difference>(table_wrapper_left, table_wrapper_right, SetOperationMode::All);
+  difference_all->execute();
+  EXPECT_TABLE_EQ_UNORDERED(difference_all->get_output(),
+                            load_table("resources/test_data/tbl/set_operation_except_all.tbl"));
+}
+
+TEST_F(OperatorsDifferenceTest, Description) {
+  auto difference = std::make_shared<Difference>(_table_wrapper_a, _table_wrapper_b, SetOperationMode::Unique);
+  EXPECT_EQ(difference->description(DescriptionMode::SingleLine), "Difference (Unique)");
+}
+
 TEST_F(OperatorsDifferenceTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
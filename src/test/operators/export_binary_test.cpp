@@ -2,17 +2,31 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/transaction_context.hpp"
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/block_min_max_filter.hpp"
+#include "statistics/chunk_statistics/blocked_bloom_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -371,4 +385,236 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("resources/test_data/bin/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, DeltaSegmentRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Long);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 300);
+  for (auto index = 0; index < 500; ++index) {
+    const auto timestamp = int64_t{1'577'836'800'000} + index * 1'000;
+    if (index % 7 == 3) {
+      table->append({opossum::NULL_VALUE, timestamp});
+    } else {
+      table->append({(index * 37) % 1'000 - 500, timestamp});
+    }
+  }
+
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::BitPacking});
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto segment = imported_table->get_chunk(chunk_id)->get_segment(ColumnID{1});
+    const auto delta_segment = std::dynamic_pointer_cast<const DeltaSegment<int64_t>>(segment);
+    ASSERT_NE(delta_segment, nullptr);
+    EXPECT_TRUE(delta_segment->is_ascending());
+  }
+}
+
+TEST_F(OperatorsExportBinaryTest, MixedEncodingsRoundTripWithScheduler) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, true);
+  column_definitions.emplace_back("c", DataType::Long);
+  column_definitions.emplace_back("d", DataType::Double);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto index = 0; index < 5'000; ++index) {
+    const auto a = index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(index * 37) % 1'000};
+    const auto b = index % 5 == 0 ? AllTypeVariant{NULL_VALUE}
+                                  : AllTypeVariant{pmr_string{"value" + std::to_string(index % 300)}};
+    table->append({a, b, int64_t{index} * 1'000, index * 0.5});
+  }
+
+  // The encodings alternate between the chunks, so that all of them are written and read by concurrent jobs
+  const auto dictionary = SegmentEncodingSpec{EncodingType::Dictionary};
+  const auto delta = SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::BitPacking};
+  const auto unencoded = SegmentEncodingSpec{EncodingType::Unencoded};
+  auto chunk_encoding_specs = std::vector<ChunkEncodingSpec>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (chunk_id % 3 == 0) {
+      chunk_encoding_specs.emplace_back(ChunkEncodingSpec{dictionary, dictionary, dictionary, dictionary});
+    } else if (chunk_id % 3 == 1) {
+      chunk_encoding_specs.emplace_back(ChunkEncodingSpec{delta, unencoded, delta, unencoded});
+    } else {
+      chunk_encoding_specs.emplace_back(ChunkEncodingSpec{unencoded, dictionary, unencoded, dictionary});
+    }
+  }
+  ChunkEncoder::encode_all_chunks(table, chunk_encoding_specs);
+
+  // 32 CPUs, so that the 50 chunks are exported in two batches
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  ASSERT_EQ(imported_table->chunk_count(), 50u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(imported_table->get_chunk(chunk_id)->size(), 100u);
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto& segment = *table->get_chunk(chunk_id)->get_segment(column_id);
+      const auto& imported_segment = *imported_table->get_chunk(chunk_id)->get_segment(column_id);
+      EXPECT_EQ(typeid(imported_segment), typeid(segment));
+    }
+  }
+
+  // The file ends with the chunk index
+  auto file = std::ifstream{filename, std::ios::binary};
+  file.seekg(-static_cast<std::streamoff>(sizeof(uint64_t)), std::ios::end);
+  auto magic = uint64_t{0};
+  file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+  EXPECT_EQ(magic, BINARY_CHUNK_INDEX_MAGIC);
+}
+
+TEST_F(OperatorsExportBinaryTest, StatisticsRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+  for (auto index = 0; index < 15'000; ++index) {
+    const auto a = index % 11 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index / 3};
+    table->append({a, pmr_string{"value" + std::to_string(index % 50)}});
+  }
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  table->set_table_statistics(generate_table_statistics_sampled(*table));
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  const auto table_statistics = table->table_statistics();
+  const auto imported_table_statistics = imported_table->table_statistics();
+  ASSERT_TRUE(imported_table_statistics);
+  EXPECT_EQ(imported_table_statistics->row_count(), table_statistics->row_count());
+
+  const auto& column_statistics_a =
+      static_cast<const ColumnStatistics<int32_t>&>(*table_statistics->column_statistics()[0]);
+  const auto& imported_column_statistics_a =
+      static_cast<const ColumnStatistics<int32_t>&>(*imported_table_statistics->column_statistics()[0]);
+  EXPECT_EQ(imported_column_statistics_a.null_value_ratio(), column_statistics_a.null_value_ratio());
+  EXPECT_EQ(imported_column_statistics_a.distinct_count(), column_statistics_a.distinct_count());
+  EXPECT_EQ(imported_column_statistics_a.min(), column_statistics_a.min());
+  EXPECT_EQ(imported_column_statistics_a.max(), column_statistics_a.max());
+  ASSERT_TRUE(column_statistics_a.histogram());
+  ASSERT_TRUE(imported_column_statistics_a.histogram());
+  EXPECT_EQ(imported_column_statistics_a.histogram()->bin_data().bin_minima,
+            column_statistics_a.histogram()->bin_data().bin_minima);
+  EXPECT_EQ(imported_column_statistics_a.histogram()->bin_data().bin_heights,
+            column_statistics_a.histogram()->bin_data().bin_heights);
+
+  const auto& imported_column_statistics_b =
+      static_cast<const ColumnStatistics<pmr_string>&>(*imported_table_statistics->column_statistics()[1]);
+  EXPECT_EQ(imported_column_statistics_b.min(), "value0");
+  EXPECT_EQ(imported_column_statistics_b.max(), "value9");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk_statistics = imported_table->get_chunk(chunk_id)->statistics();
+    ASSERT_TRUE(chunk_statistics);
+    EXPECT_TRUE(chunk_statistics->can_prune(ColumnID{0}, PredicateCondition::GreaterThan, 5'000));
+    EXPECT_FALSE(chunk_statistics->can_prune(ColumnID{0}, PredicateCondition::LessThanEquals, 5'000));
+    EXPECT_TRUE(chunk_statistics->can_prune(ColumnID{1}, PredicateCondition::Equals, "other"));
+    EXPECT_FALSE(chunk_statistics->can_prune(ColumnID{1}, PredicateCondition::Equals, "value7"));
+  }
+
+  // The first chunk is larger than a block and has BlockMinMaxFilters
+  const auto& segment_statistics = imported_table->get_chunk(ChunkID{0})->statistics()->statistics()[0];
+  const auto block_min_max_filter =
+      std::dynamic_pointer_cast<const BlockMinMaxFilter<int32_t>>(segment_statistics->block_min_max_filter());
+  ASSERT_TRUE(block_min_max_filter);
+  EXPECT_EQ(block_min_max_filter->segment_size(), 10'000u);
+  const auto candidate_ranges = block_min_max_filter->candidate_ranges(PredicateCondition::LessThan, 1'000);
+  ASSERT_EQ(candidate_ranges.size(), 1u);
+  EXPECT_EQ(candidate_ranges[0], std::make_pair(ChunkOffset{0}, ChunkOffset{4'096}));
+
+  // Column b has few distinct values per chunk and a BlockedBloomFilter
+  const auto find_bloom_filter = [](const Table& table_with_filter) {
+    auto bloom_filter = std::shared_ptr<const BlockedBloomFilter<pmr_string>>{};
+    const auto& filters = table_with_filter.get_chunk(ChunkID{0})->statistics()->statistics()[1]->filters();
+    for (const auto& filter : filters) {
+      if (!bloom_filter) bloom_filter = std::dynamic_pointer_cast<const BlockedBloomFilter<pmr_string>>(filter);
+    }
+    return bloom_filter;
+  };
+  const auto bloom_filter = find_bloom_filter(*table);
+  const auto imported_bloom_filter = find_bloom_filter(*imported_table);
+  ASSERT_TRUE(bloom_filter);
+  ASSERT_TRUE(imported_bloom_filter);
+  ASSERT_EQ(imported_bloom_filter->blocks().size(), bloom_filter->blocks().size());
+  for (auto block_index = size_t{0}; block_index < bloom_filter->blocks().size(); ++block_index) {
+    EXPECT_EQ(imported_bloom_filter->blocks()[block_index].words, bloom_filter->blocks()[block_index].words);
+  }
+
+  // The StorageManager keeps the imported statistics instead of generating new ones
+  StorageManager::get().add_table("statistics_round_trip", imported_table);
+  EXPECT_EQ(imported_table->table_statistics(), imported_table_statistics);
+}
+
+TEST_F(OperatorsExportBinaryTest, SnapshotOfModifiedTable) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+  for (auto index = 0; index < 10; ++index) {
+    const auto a = index % 4 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index};
+    table->append({a, pmr_string{"value" + std::to_string(index)}});
+  }
+
+  // All rows were inserted by CommitID 1, the snapshot is taken at CommitID 3
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{1});
+    }
+  }
+
+  // Chunk 0 is entirely visible and written as it is
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  table->get_chunk(ChunkID{0})->mark_immutable();
+
+  // Chunk 1: Row 1 was deleted before the snapshot, row 2 is deleted by a transaction committed after the snapshot
+  {
+    auto mvcc_data = table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+    mvcc_data->set_end_cid(1, CommitID{2});
+    mvcc_data->tids[2] = TransactionID{7};
+    mvcc_data->set_end_cid(2, CommitID{5});
+  }
+
+  // Chunk 2: Row 1 was inserted after the snapshot, row 2 by a transaction that has not committed yet
+  {
+    auto mvcc_data = table->get_chunk(ChunkID{2})->get_scoped_mvcc_data_lock();
+    mvcc_data->set_begin_cid(1, CommitID{4});
+    mvcc_data->tids[2] = TransactionID{7};
+    mvcc_data->set_begin_cid(2, MvccData::MAX_COMMIT_ID);
+  }
+
+  // Chunk 3 has no visible rows and is skipped
+  table->get_chunk(ChunkID{3})->get_scoped_mvcc_data_lock()->set_begin_cid(0, CommitID{4});
+
+  const auto transaction_context = TransactionContext{TransactionID{1}, CommitID{3}};
+  ExportBinary::write_binary_snapshot(*table, filename, transaction_context);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  for (const auto index : {0, 1, 2, 3, 5, 6}) {
+    const auto a = index % 4 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index};
+    expected_table->append({a, pmr_string{"value" + std::to_string(index)}});
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, expected_table);
+  EXPECT_EQ(imported_table->max_chunk_size(), 3u);
+  ASSERT_EQ(imported_table->chunk_count(), 3u);
+  EXPECT_EQ(imported_table->get_chunk(ChunkID{1})->size(), 2u);
+  EXPECT_EQ(imported_table->get_chunk(ChunkID{2})->size(), 1u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+      imported_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+}
+
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #include <cstdio>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -210,6 +212,30 @@ TEST_F(OperatorsExportCsvTest, ExportAllTypes) {
   EXPECT_TRUE(compare_file(test_filename, "1,\"Hallo\",3.5,12,2.333\n"));
 }
 
+TEST_F(OperatorsExportCsvTest, ManyChunksInOrder) {
+  // More chunks than are formatted ahead of the written chunk, numbers at the limits of the formatting
+  auto expected_content = std::string{};
+  for (auto row = 0; row < 1'000; ++row) {
+    table->append({row - 500, "row " + std::to_string(row), static_cast<float>(row) / 3});
+  }
+  table->append({std::numeric_limits<int32_t>::min(), "\"", 1e-20f});
+  table->append({std::numeric_limits<int32_t>::max(), "", 123456789.0f});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+  auto ex = std::make_shared<opossum::ExportCsv>(table_wrapper, test_filename);
+  ex->execute();
+
+  for (auto row = 0; row < 1'000; ++row) {
+    auto stream = std::ostringstream{};
+    stream << row - 500 << ",\"row " << row << "\"," << static_cast<float>(row) / 3 << "\n";
+    expected_content += stream.str();
+  }
+  expected_content += "-2147483648,\"\"\"\",1e-20\n2147483647,\"\",1.23457e+08\n";
+
+  EXPECT_TRUE(compare_file(test_filename, expected_content));
+}
+
 TEST_F(OperatorsExportCsvTest, NonsensePath) {
   table->append({1, "hello", 3.5f});
   auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
@@ -1,4 +1,6 @@
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -54,6 +56,26 @@ TEST_F(OperatorsGetTableTest, ExcludedChunks) {
   EXPECT_EQ(table->chunk_count(), ChunkID(2));
   EXPECT_EQ(table->get_value<int>(ColumnID(0), 0u), original_table->get_value<int>(ColumnID(0), 1u));
   EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 3u));
+
+  const auto& performance_data = gt->performance_data();
+  EXPECT_EQ(performance_data.pruned_chunk_count, 2u);
+  EXPECT_EQ(performance_data.output_chunk_count, 2u);
+  EXPECT_EQ(performance_data.output_row_count, 2u);
+}
+
+TEST_F(OperatorsGetTableTest, RowCountHint) {
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+
+  // The excluded chunk does not count towards the hint
+  gt->set_excluded_chunk_ids({ChunkID(0)});
+  gt->set_row_count_hint(2);
+  gt->execute();
+
+  auto original_table = StorageManager::get().get_table("tableWithValues");
+  auto table = gt->get_output();
+  EXPECT_EQ(table->chunk_count(), ChunkID(2));
+  EXPECT_EQ(table->get_value<int>(ColumnID(0), 0u), original_table->get_value<int>(ColumnID(0), 1u));
+  EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 2u));
 }
 
 TEST_F(OperatorsGetTableTest, ExcludeCleanedUpChunk) {
@@ -162,4 +184,49 @@ TEST_F(OperatorsGetTableTest, ExcludedChunksCombined) {
   gt2->execute();
   EXPECT_EQ(gt2->get_output()->chunk_count(), 1);
 }
+
+TEST_F(OperatorsGetTableTest, TableSample) {
+  // 100 chunks of 100 rows each
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto value = int32_t{0}; value < 10'000; ++value) table->append({value});
+  StorageManager::get().add_table("tableToSample", table);
+
+  const auto sample = [&](const TableSampleMethod method, const double percentage, const std::optional<uint64_t> seed) {
+    const auto get_table = std::make_shared<GetTable>("tableToSample");
+    get_table->set_table_sample(TableSample{method, percentage, seed});
+    get_table->execute();
+    return get_table->get_output();
+  };
+
+  // SYSTEM samples keep entire data chunks
+  const auto system_sample = sample(TableSampleMethod::System, 30, 42);
+  EXPECT_EQ(system_sample->type(), TableType::Data);
+  EXPECT_GT(system_sample->chunk_count(), 10);
+  EXPECT_LT(system_sample->chunk_count(), 50);
+  for (auto chunk_id = ChunkID{0}; chunk_id < system_sample->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(system_sample->get_chunk(chunk_id)->size(), 100u);
+  }
+  EXPECT_TABLE_EQ_ORDERED(sample(TableSampleMethod::System, 30, 42), system_sample);
+
+  // BERNOULLI samples reference individual rows
+  const auto bernoulli_sample = sample(TableSampleMethod::Bernoulli, 10, 7);
+  EXPECT_EQ(bernoulli_sample->type(), TableType::References);
+  EXPECT_GT(bernoulli_sample->row_count(), 700u);
+  EXPECT_LT(bernoulli_sample->row_count(), 1'300u);
+  EXPECT_TABLE_EQ_ORDERED(sample(TableSampleMethod::Bernoulli, 10, 7), bernoulli_sample);
+
+  const auto sampled_values = [](const std::shared_ptr<const Table>& sampled_table) {
+    auto values = std::vector<int32_t>{};
+    for (auto row_idx = size_t{0}; row_idx < sampled_table->row_count(); ++row_idx) {
+      values.emplace_back(sampled_table->get_value<int32_t>(ColumnID{0}, row_idx));
+    }
+    return values;
+  };
+  EXPECT_NE(sampled_values(sample(TableSampleMethod::Bernoulli, 10, 8)), sampled_values(bernoulli_sample));
+
+  EXPECT_EQ(sample(TableSampleMethod::Bernoulli, 100, std::nullopt)->row_count(), 10'000u);
+  EXPECT_EQ(sample(TableSampleMethod::Bernoulli, 0, std::nullopt)->row_count(), 0u);
+  EXPECT_EQ(sample(TableSampleMethod::System, 0, std::nullopt)->row_count(), 0u);
+}
+
 }  // namespace opossum
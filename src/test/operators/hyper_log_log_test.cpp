@@ -0,0 +1,73 @@
+#include <cmath>
+#include <functional>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public BaseTest {
+ protected:
+  static void insert_range(HyperLogLog& sketch, const int begin, const int end) {
+    for (auto value = begin; value < end; ++value) {
+      sketch.insert(std::hash<int>{}(value));
+    }
+  }
+
+  // Allow for four times the standard error of the sketch
+  static void expect_estimate_near(const HyperLogLog& sketch, const uint64_t distinct_count) {
+    const auto relative_error = 4 * 1.04 / std::sqrt(static_cast<double>(HyperLogLog::REGISTER_COUNT));
+    EXPECT_NEAR(static_cast<double>(sketch.estimate()), static_cast<double>(distinct_count),
+                relative_error * static_cast<double>(distinct_count));
+  }
+};
+
+TEST_F(HyperLogLogTest, Empty) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0);
+}
+
+TEST_F(HyperLogLogTest, SmallCardinalities) {
+  // Linear counting is (almost) exact for few values
+  auto sketch = HyperLogLog{};
+  insert_range(sketch, 0, 10);
+  EXPECT_EQ(sketch.estimate(), 10);
+
+  insert_range(sketch, 0, 100);
+  EXPECT_NEAR(sketch.estimate(), 100, 2);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinalities) {
+  auto sketch = HyperLogLog{};
+  insert_range(sketch, 0, 1'000'000);
+  expect_estimate_near(sketch, 1'000'000);
+}
+
+TEST_F(HyperLogLogTest, DuplicatesDoNotChangeEstimate) {
+  auto sketch = HyperLogLog{};
+  insert_range(sketch, 0, 50'000);
+  const auto estimate = sketch.estimate();
+
+  insert_range(sketch, 0, 50'000);
+  EXPECT_EQ(sketch.estimate(), estimate);
+  expect_estimate_near(sketch, 50'000);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch_a = HyperLogLog{};
+  auto sketch_b = HyperLogLog{};
+  insert_range(sketch_a, 0, 60'000);
+  insert_range(sketch_b, 40'000, 100'000);
+
+  sketch_a.merge(sketch_b);
+  expect_estimate_near(sketch_a, 100'000);
+
+  // Merging an empty sketch has no effect
+  const auto estimate = sketch_a.estimate();
+  sketch_a.merge(HyperLogLog{});
+  EXPECT_EQ(sketch_a.estimate(), estimate);
+}
+
+}  // namespace opossum
@@ -1,3 +1,7 @@
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,10 +12,26 @@
 #include "operators/import_binary.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
 
 namespace opossum {
 
-class OperatorsImportBinaryTest : public BaseTest {};
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  // Writes a copy of @param source to @param target after passing its content to @param modify
+  void write_modified_copy(const std::string& source, const std::string& target,
+                           const std::function<void(std::string&)>& modify) {
+    auto input = std::ifstream{source, std::ios::binary};
+    auto content = std::string{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+    modify(content);
+    auto output = std::ofstream{target, std::ios::binary};
+    output << content;
+  }
+
+  // The two chunks of this file end at byte 55, followed by the chunk index (three offsets and the magic number)
+  const std::string multiple_chunk_file = "resources/test_data/bin/MultipleChunkSingleFloatColumn.bin";
+  const size_t multiple_chunk_file_chunks_end = 55;
+};
 
 TEST_F(OperatorsImportBinaryTest, SingleChunkSingleFloatColumn) {
   auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float}}, TableType::Data, 5);
@@ -147,6 +167,54 @@ TEST_F(OperatorsImportBinaryTest, FileDoesNotExist) {
   EXPECT_THROW(importer->execute(), std::exception);
 }
 
+TEST_F(OperatorsImportBinaryTest, TruncatedFile) {
+  const auto filename = test_data_path + "TruncatedFile.bin";
+  // Without the chunk index, the chunks are scanned and the last one lacks a byte
+  write_modified_copy(multiple_chunk_file, filename,
+                      [&](auto& content) { content.resize(multiple_chunk_file_chunks_end - 1); });
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  EXPECT_THROW(importer->execute(), std::exception);
+  filesystem::remove(filename);
+}
+
+TEST_F(OperatorsImportBinaryTest, FileWithoutChunkIndex) {
+  const auto filename = test_data_path + "FileWithoutChunkIndex.bin";
+  write_modified_copy(multiple_chunk_file, filename,
+                      [&](auto& content) { content.resize(multiple_chunk_file_chunks_end); });
+
+  auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float}}, TableType::Data, 2);
+  expected_table->append({5.5f});
+  expected_table->append({13.0f});
+  expected_table->append({16.2f});
+
+  const auto table = ImportBinary::read_binary(filename);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  filesystem::remove(filename);
+}
+
+TEST_F(OperatorsImportBinaryTest, InvalidChunkIndex) {
+  const auto filename = test_data_path + "InvalidChunkIndex.bin";
+
+  // The beginning of the second chunk is off by one, which is only noticed by the job decoding the first chunk
+  write_modified_copy(multiple_chunk_file, filename, [&](auto& content) {
+    auto second_chunk_offset = uint64_t{0};
+    const auto position = multiple_chunk_file_chunks_end + sizeof(uint64_t);
+    std::memcpy(&second_chunk_offset, content.data() + position, sizeof(uint64_t));
+    ++second_chunk_offset;
+    std::memcpy(content.data() + position, &second_chunk_offset, sizeof(uint64_t));
+  });
+  EXPECT_THROW(ImportBinary::read_binary(filename), std::exception);
+
+  // Offsets that do not begin behind the header are rejected right away
+  write_modified_copy(multiple_chunk_file, filename,
+                      [&](auto& content) { content[multiple_chunk_file_chunks_end] = 0; });
+  EXPECT_THROW(ImportBinary::read_binary(filename), std::exception);
+  filesystem::remove(filename);
+}
+
 TEST_F(OperatorsImportBinaryTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int);
@@ -214,6 +214,40 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyOutput) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::NotEquals,
+                                         PredicateCondition::LessThan, PredicateCondition::Between}) {
+    auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids, predicate_condition,
+                                            right_values, right_values2);
+    scan->execute();
+
+    auto count_scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                                  predicate_condition, right_values, right_values2);
+    count_scan->set_index_only_output(IndexScanOutput::Count, "COUNT(*)");
+    count_scan->execute();
+
+    const auto& count_output = count_scan->get_output();
+    EXPECT_EQ(count_output->column_name(ColumnID{0}), "COUNT(*)");
+    EXPECT_EQ(count_output->column_data_type(ColumnID{0}), DataType::Long);
+    EXPECT_EQ(count_output->get_value<int64_t>(ColumnID{0}, 0u),
+              static_cast<int64_t>(scan->get_output()->row_count()));
+  }
+
+  auto values_scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                                 PredicateCondition::Equals, right_values);
+  values_scan->set_index_only_output(IndexScanOutput::Values, "a");
+  values_scan->execute();
+  this->ASSERT_COLUMN_EQ(values_scan->get_output(), ColumnID{0u}, {4, 4});
+
+  // Only equality predicates determine the values of the matching rows
+  auto range_scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                                PredicateCondition::LessThan, right_values);
+  EXPECT_THROW(range_scan->set_index_only_output(IndexScanOutput::Values, "a"), std::logic_error);
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
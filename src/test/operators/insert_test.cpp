@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -283,4 +284,80 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float)
 }
 
+TEST_F(OperatorsInsertTest, InsertFromEncodedAndReferenceSegments) {
+  // The values are read through the typed segment iterators, including NULLs
+  const auto source_table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2u);
+  ChunkEncoder::encode_all_chunks(source_table);
+  StorageManager::get().add_table("source_table", source_table);
+
+  const auto target_table = std::make_shared<Table>(source_table->column_definitions(), TableType::Data, 3u,
+                                                    UseMvcc::Yes);
+  StorageManager::get().add_table("target_table", target_table);
+
+  auto context = TransactionManager::get().new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("source_table");
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(context);
+  get_table->execute();
+  validate->execute();
+  ASSERT_EQ(validate->get_output()->type(), TableType::References);
+
+  const auto insert = std::make_shared<Insert>("target_table", validate);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_TABLE_EQ_ORDERED(target_table, source_table);
+}
+
+TEST_F(OperatorsInsertTest, ConcurrentInserts) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Float, false);
+
+  // The chunk size does not divide the size of the inserted table, so that inserts span multiple chunks
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, 4, UseMvcc::Yes);
+  StorageManager::get().add_table("target_table", target_table);
+
+  const auto table_int_float = load_table("resources/test_data/tbl/int_float.tbl");
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_int_float);
+  table_wrapper->execute();
+
+  const auto thread_count = 8u;
+  const auto inserts_per_thread = 20u;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto insert_idx = 0u; insert_idx < inserts_per_thread; ++insert_idx) {
+        const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+        auto context = TransactionManager::get().new_transaction_context();
+        insert->set_transaction_context(context);
+        insert->execute();
+        context->commit();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  const auto expected_row_count = thread_count * inserts_per_thread * table_int_float->row_count();
+  EXPECT_EQ(target_table->row_count(), expected_row_count);
+  EXPECT_EQ(target_table->chunk_count(), (expected_row_count + 3) / 4);
+
+  // Every row was written exactly once and committed
+  auto value_sum = int64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < target_table->chunk_count(); ++chunk_id) {
+    const auto chunk = target_table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->get_scoped_mvcc_data_lock()->size(), chunk->size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_NE(chunk->get_scoped_mvcc_data_lock()->get_begin_cid(chunk_offset), MvccData::MAX_COMMIT_ID);
+      value_sum += type_cast_variant<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]);
+    }
+  }
+  auto expected_value_sum = int64_t{0};
+  for (auto row_idx = size_t{0}; row_idx < table_int_float->row_count(); ++row_idx) {
+    expected_value_sum += table_int_float->get_value<int32_t>(ColumnID{0}, row_idx);
+  }
+  EXPECT_EQ(value_sum, expected_value_sum * thread_count * inserts_per_thread);
+}
+
 }  // namespace opossum
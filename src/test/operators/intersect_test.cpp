@@ -0,0 +1,85 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/intersect.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+class OperatorsIntersectTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/set_operation_left.tbl", 2));
+    _table_wrapper_right =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/set_operation_right.tbl", 3));
+
+    _table_wrapper_left->execute();
+    _table_wrapper_right->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left;
+  std::shared_ptr<TableWrapper> _table_wrapper_right;
+};
+
+TEST_F(OperatorsIntersectTest, IntersectUnique) {
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_left, _table_wrapper_right, SetOperationMode::Unique);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(),
+                            load_table("resources/test_data/tbl/set_operation_intersect.tbl"));
+}
+
+TEST_F(OperatorsIntersectTest, IntersectAll) {
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_left, _table_wrapper_right, SetOperationMode::All);
+  intersect->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(),
+                            load_table("resources/test_data/tbl/set_operation_intersect_all.tbl"));
+}
+
+TEST_F(OperatorsIntersectTest, IntersectReferenceTables) {
+  // Filter out the row (3, 'w') of the left input, which is not part of the intersection anyway
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_left->get_output(), "a");
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper_left, not_equals_(a, 3));
+  table_scan->execute();
+
+  auto intersect = std::make_shared<Intersect>(table_scan, _table_wrapper_right, SetOperationMode::All);
+  intersect->execute();
+
+  EXPECT_EQ(intersect->get_output()->type(), TableType::References);
+  EXPECT_TABLE_EQ_UNORDERED(intersect->get_output(),
+                            load_table("resources/test_data/tbl/set_operation_intersect_all.tbl"));
+}
+
+TEST_F(OperatorsIntersectTest, EmptyRightInput) {
+  const auto a = PQPColumnExpression::from_table(*_table_wrapper_right->get_output(), "a");
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper_right, equals_(a, 42));
+  table_scan->execute();
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_left, table_scan, SetOperationMode::Unique);
+  intersect->execute();
+
+  EXPECT_EQ(intersect->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsIntersectTest, ThrowWrongColumnTypesException) {
+  if (!HYRISE_DEBUG) GTEST_SKIP();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  auto intersect = std::make_shared<Intersect>(_table_wrapper_left, table_wrapper, SetOperationMode::Unique);
+
+  EXPECT_THROW(intersect->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -246,6 +246,61 @@ TEST_F(JitAggregateTest, CorrectlyComputesAggregates) {
                                 FloatComparisonMode::AbsoluteDifference));
 }
 
+// Check that the contexts of chunks that are processed in parallel are merged correctly.
+TEST_F(JitAggregateTest, MergesChunkContexts) {
+  const auto tuple_entry_a = JitTupleEntry(DataType::Int, true, 0);
+  const auto tuple_entry_b = JitTupleEntry(DataType::Int, true, 1);
+
+  _aggregate->add_groupby_column("groupby", tuple_entry_a);
+  _aggregate->add_aggregate_column("count", tuple_entry_b, AggregateFunction::Count);
+  _aggregate->add_aggregate_column("sum", tuple_entry_b, AggregateFunction::Sum);
+  _aggregate->add_aggregate_column("max", tuple_entry_b, AggregateFunction::Max);
+  _aggregate->add_aggregate_column("min", tuple_entry_b, AggregateFunction::Min);
+  _aggregate->add_aggregate_column("avg", tuple_entry_b, AggregateFunction::Avg);
+
+  auto output_table = _aggregate->create_output_table(Table{TableColumnDefinitions{}, TableType::Data});
+
+  JitRuntimeContext context;
+  _aggregate->before_query(*output_table, context);
+
+  // Emits (a, b) tuples into a new chunk context, where a value of std::nullopt stands for NULL
+  const auto emit_chunk = [&](const std::vector<std::pair<std::optional<int32_t>, std::optional<int32_t>>>& tuples) {
+    JitRuntimeContext chunk_context;
+    chunk_context.tuple.resize(2);
+    _aggregate->before_query(*output_table, chunk_context);
+    for (const auto& [a, b] : tuples) {
+      tuple_entry_a.set_is_null(!a, chunk_context);
+      if (a) tuple_entry_a.set<int32_t>(*a, chunk_context);
+      tuple_entry_b.set_is_null(!b, chunk_context);
+      if (b) tuple_entry_b.set<int32_t>(*b, chunk_context);
+      _source->emit(chunk_context);
+    }
+    _aggregate->merge_context(context, chunk_context);
+  };
+
+  // Group 1 has values in both chunks, group 2 only NULLs in the first chunk, and the NULL group only exists in the
+  // second chunk
+  emit_chunk({{1, 4}, {2, std::nullopt}, {1, 2}});
+  emit_chunk({{2, 7}, {std::nullopt, 3}, {1, 9}, {2, std::nullopt}});
+
+  _aggregate->after_query(*output_table, context);
+
+  const auto expected_column_definitions = TableColumnDefinitions({{"groupby", DataType::Int, true},
+                                                                   {"count", DataType::Long, false},
+                                                                   {"sum", DataType::Long, true},
+                                                                   {"max", DataType::Int, true},
+                                                                   {"min", DataType::Int, true},
+                                                                   {"avg", DataType::Double, true}});
+
+  auto expected_output_table = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  expected_output_table->append({1, 3, 15, 9, 2, 5.0});
+  expected_output_table->append({2, 1, 7, 7, 7, 7.0});
+  expected_output_table->append({NullValue{}, 1, 3, 3, 3, 3.0});
+
+  EXPECT_TRUE(check_table_equal(output_table, expected_output_table, OrderSensitivity::Yes, TypeCmpMode::Strict,
+                                FloatComparisonMode::AbsoluteDifference));
+}
+
 // Check the computation of aggregate values when there are no groupby columns.
 TEST_F(JitAggregateTest, NoGroupByColumns) {
   JitRuntimeContext context;
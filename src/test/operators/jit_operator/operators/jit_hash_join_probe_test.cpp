@@ -0,0 +1,106 @@
+#include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Mock JitOperator that records the build values of all tuples passed to it
+class MockSink : public AbstractJittable {
+ public:
+  explicit MockSink(const JitTupleEntry& build_value) : _build_value{build_value} {}
+
+  std::string description() const final { return "MockSink"; }
+
+  void reset() const { _build_values.clear(); }
+
+  const std::vector<int64_t>& build_values() const { return _build_values; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {
+    _build_values.emplace_back(_build_value.get<int64_t>(context));
+  }
+
+  const JitTupleEntry _build_value;
+
+  // Must be static, since _consume is const
+  static std::vector<int64_t> _build_values;
+};
+
+std::vector<int64_t> MockSink::_build_values;
+
+// Mock JitOperator that passes on individual tuples
+class MockSource : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockSource"; }
+
+  void emit(JitRuntimeContext& context) { _emit(context); }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {}
+};
+
+}  // namespace
+
+class JitHashJoinProbeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions{{"key", DataType::Int, true}, {"value", DataType::Long, false}};
+    _build_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+    _build_table->append({1, int64_t{10}});
+    _build_table->append({2, int64_t{20}});
+    _build_table->append({NullValue{}, int64_t{30}});
+    _build_table->append({2, int64_t{21}});
+  }
+
+  std::shared_ptr<Table> _build_table;
+};
+
+TEST_F(JitHashJoinProbeTest, EmitsTupleForEachJoinPartner) {
+  JitReadTuples read_tuples;
+  const auto probe_key = JitTupleEntry{DataType::Int, true, read_tuples.add_temporary_value()};
+
+  auto source = std::make_shared<MockSource>();
+  auto probe = std::make_shared<JitHashJoinProbe>(size_t{0}, probe_key, ColumnID{0});
+  const auto build_value = probe->add_build_column(ColumnID{1}, DataType::Long, false, read_tuples);
+  auto sink = std::make_shared<MockSink>(build_value);
+
+  // Requesting the same build column twice returns the same tuple entry
+  EXPECT_EQ(probe->add_build_column(ColumnID{1}, DataType::Long, false, read_tuples), build_value);
+
+  // Link operators to pipeline
+  source->set_next_operator(probe);
+  probe->set_next_operator(sink);
+
+  JitRuntimeContext context;
+  context.tuple.resize(read_tuples.add_temporary_value());
+  probe->before_query(*_build_table, context);
+
+  // A single join partner
+  probe_key.set_is_null(false, context);
+  probe_key.set<int32_t>(1, context);
+  sink->reset();
+  source->emit(context);
+  EXPECT_EQ(sink->build_values(), std::vector<int64_t>({10}));
+
+  // Multiple join partners
+  probe_key.set<int32_t>(2, context);
+  sink->reset();
+  source->emit(context);
+  EXPECT_EQ(sink->build_values(), std::vector<int64_t>({20, 21}));
+
+  // No join partner
+  probe_key.set<int32_t>(3, context);
+  sink->reset();
+  source->emit(context);
+  EXPECT_TRUE(sink->build_values().empty());
+
+  // NULL keys never find a join partner
+  probe_key.set_is_null(true, context);
+  sink->reset();
+  source->emit(context);
+  EXPECT_TRUE(sink->build_values().empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_expression.hpp"
+#include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_read_tuples.hpp"
+#include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "operators/jit_operator/specialization/jit_code_cache.hpp"
+#include "operators/jit_operator_wrapper.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class JitCodeCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    JitCodeCache::get().clear();
+
+    _int_table = load_table("resources/test_data/tbl/10_ints.tbl", 5);
+    _int_table_wrapper = std::make_shared<TableWrapper>(_int_table);
+    _int_table_wrapper->execute();
+  }
+
+  void TearDown() override { JitCodeCache::get().clear(); }
+
+  // Creates the pipeline for SELECT a FROM 10_ints WHERE a > <literal>
+  std::vector<std::shared_ptr<AbstractJittable>> _make_pipeline(const AllTypeVariant& literal) const {
+    auto read_tuples = std::make_shared<JitReadTuples>();
+    const auto a_tuple_entry = read_tuples->add_input_column(DataType::Int, false, ColumnID{0});
+    const auto literal_tuple_entry = read_tuples->add_literal_value(literal);
+
+    const auto expression = std::make_shared<JitExpression>(
+        std::make_shared<JitExpression>(a_tuple_entry), JitExpressionType::GreaterThan,
+        std::make_shared<JitExpression>(literal_tuple_entry), read_tuples->add_temporary_value());
+    const auto filter = std::make_shared<JitFilter>(expression);
+
+    auto write_tuples = std::make_shared<JitWriteTuples>();
+    write_tuples->add_output_column_definition("a", a_tuple_entry);
+
+    return {read_tuples, filter, write_tuples};
+  }
+
+  std::shared_ptr<const Table> _execute_pipeline(const AllTypeVariant& literal) const {
+    auto jit_operator_wrapper = std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Compile);
+    for (const auto& jit_operator : _make_pipeline(literal)) {
+      jit_operator_wrapper->add_jit_operator(jit_operator);
+    }
+    jit_operator_wrapper->execute();
+    return jit_operator_wrapper->get_output();
+  }
+
+  std::shared_ptr<Table> _int_table;
+  std::shared_ptr<TableWrapper> _int_table_wrapper;
+};
+
+TEST_F(JitCodeCacheTest, KeyIgnoresLiteralValues) {
+  const auto key = JitCodeCache::key(_make_pipeline(20), TableType::Data);
+
+  EXPECT_EQ(JitCodeCache::key(_make_pipeline(100), TableType::Data), key);
+  EXPECT_NE(JitCodeCache::key(_make_pipeline(int64_t{100}), TableType::Data), key);
+  EXPECT_NE(JitCodeCache::key(_make_pipeline(20), TableType::References), key);
+}
+
+TEST_F(JitCodeCacheTest, PipelinesWithDifferentLiteralsShareCode) {
+  const auto result_20 = _execute_pipeline(20);
+  EXPECT_EQ(JitCodeCache::get().size(), 1u);
+
+  const auto result_100 = _execute_pipeline(100);
+  EXPECT_EQ(JitCodeCache::get().size(), 1u);
+
+  EXPECT_EQ(result_20->row_count(), 6u);
+  EXPECT_EQ(result_100->row_count(), 3u);
+
+  // The cached code remains valid after the pipeline it was specialized for is gone
+  EXPECT_EQ(_execute_pipeline(4)->row_count(), 7u);
+  EXPECT_EQ(JitCodeCache::get().size(), 1u);
+}
+
+}  // namespace opossum
@@ -9,6 +9,9 @@
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 
 namespace opossum {
 
@@ -277,4 +280,38 @@ TEST_F(JitOperatorWrapperTest, JitOperatorsSpecializedWithMultipleInliningOfSame
   ASSERT_EQ(result->get_value<int>(ColumnID(0), 1), 48);
 }
 
+TEST_F(JitOperatorWrapperTest, TieredExecutionSwitchesToCompiledCode) {
+  // SELECT a FROM 10_ints WHERE a > 20, with one row per chunk so that the pipeline switches to the compiled code
+  // after a number of interpreted chunks
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto input_table = load_table("resources/test_data/tbl/10_ints.tbl", 1);
+  auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  auto read_tuples = std::make_shared<JitReadTuples>();
+  auto a_tuple_entry = read_tuples->add_input_column(DataType::Int, false, ColumnID{0});
+  auto literal_tuple_entry = read_tuples->add_literal_value(20);
+  auto expression = std::make_shared<JitExpression>(std::make_shared<JitExpression>(a_tuple_entry),
+                                                    JitExpressionType::GreaterThan,
+                                                    std::make_shared<JitExpression>(literal_tuple_entry),
+                                                    read_tuples->add_temporary_value());
+  auto write_tuples = std::make_shared<JitWriteTuples>();
+  write_tuples->add_output_column_definition("a", a_tuple_entry);
+
+  JitOperatorWrapper jit_operator_wrapper(table_wrapper, JitExecutionMode::Tiered);
+  jit_operator_wrapper.add_jit_operator(read_tuples);
+  jit_operator_wrapper.add_jit_operator(std::make_shared<JitFilter>(expression));
+  jit_operator_wrapper.add_jit_operator(write_tuples);
+  jit_operator_wrapper.execute();
+
+  CurrentScheduler::get()->finish();
+
+  const auto result = jit_operator_wrapper.get_output();
+  ASSERT_EQ(result->row_count(), 6u);
+  EXPECT_EQ(result->get_value<int32_t>(ColumnID{0}, 0), 24);
+  EXPECT_EQ(result->get_value<int32_t>(ColumnID{0}, 5), 234);
+}
+
 }  // namespace opossum
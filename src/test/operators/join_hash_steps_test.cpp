@@ -1,8 +1,13 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "../base_test.hpp"
 
 #include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
 
 namespace opossum {
 
@@ -63,6 +68,20 @@ TEST_F(JoinHashStepsTest, MaterializeInput) {
   EXPECT_EQ(radix_container.elements->size(), _table_with_nulls_and_zeros_scanned->get_output()->row_count());
 }
 
+TEST_F(JoinHashStepsTest, MaterializeInputAsGermanStrings) {
+  const auto table = load_table("resources/test_data/tbl/int_string_like_containing.tbl", 2);
+  std::vector<std::vector<size_t>> histograms;
+  const auto radix_container =
+      materialize_input<GermanString, GermanString, false>(table, ColumnID{1}, histograms, 0);
+
+  ASSERT_TRUE(radix_container.string_arena);
+  ASSERT_EQ(radix_container.elements->size(), table->row_count());
+  for (const auto& element : *radix_container.elements) {
+    const auto& expected = table->get_value<pmr_string>(ColumnID{1}, element.row_index);
+    EXPECT_EQ(element.value.view(), std::string_view(expected));
+  }
+}
+
 TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   size_t radix_bit_count = 0;
   std::vector<std::vector<size_t>> histograms;
@@ -123,6 +142,148 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
       table_without_nulls_scanned->get_output()->row_count());
 }
 
+TEST_F(JoinHashStepsTest, BuildKeysOnly) {
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(_table_int_with_nulls->get_output(), ColumnID{0},
+                                                               histograms, 0);
+
+  // Only the distinct non-NULL keys are stored
+  const auto hash_sets = build<int, int, HashSet<int>>(materialized);
+  ASSERT_EQ(hash_sets.size(), 1u);
+  ASSERT_TRUE(hash_sets[0]);
+
+  const auto hash_tables = build<int, int>(materialized);
+  EXPECT_EQ(hash_sets[0]->size(), hash_tables[0]->size());
+  for (const auto& entry : *hash_tables[0]) {
+    EXPECT_TRUE(hash_sets[0]->count(entry.first));
+  }
+}
+
+TEST_F(JoinHashStepsTest, UniqueHashTable) {
+  auto hash_table = UniqueHashTable<int>{1'000};
+  for (auto key = 0; key < 1'000; ++key) {
+    EXPECT_TRUE(hash_table.insert(key * 7, static_cast<RowIndex>(key + 1)));
+  }
+
+  // Duplicates are rejected
+  EXPECT_FALSE(hash_table.insert(7, RowIndex{2'000}));
+  EXPECT_EQ(hash_table.size(), 1'000u);
+
+  for (auto key = 0; key < 1'000; ++key) {
+    const auto* row_index = hash_table.find(key * 7);
+    ASSERT_NE(row_index, nullptr);
+    EXPECT_EQ(*row_index, static_cast<RowIndex>(key + 1));
+    EXPECT_EQ(hash_table.find(key * 7 + 1), nullptr);
+  }
+}
+
+TEST_F(JoinHashStepsTest, BuildUnique) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto unique_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = 0; value < 1'000; ++value) {
+    unique_table->append({value});
+  }
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(unique_table, ColumnID{0}, histograms, 2);
+  const auto chunk_offsets = determine_chunk_offsets(unique_table);
+  const auto radix_container = partition_radix_parallel<int, int, false>(materialized, chunk_offsets, histograms, 2);
+  const auto unique_hash_tables = build_unique<int, int>(radix_container);
+  ASSERT_TRUE(unique_hash_tables);
+
+  auto row_count = size_t{0};
+  for (const auto& hash_table : *unique_hash_tables) {
+    if (hash_table) row_count += hash_table->size();
+  }
+  EXPECT_EQ(row_count, 1'000u);
+
+  // Probing yields the same pairs as with the general hash tables, with and without prefetching
+  for (const auto use_prefetching : {false, true}) {
+    auto pos_lists_left = std::vector<PosList>{};
+    auto pos_lists_right = std::vector<PosList>{};
+    probe<int, int, false>(radix_container, *unique_hash_tables, pos_lists_left, pos_lists_right, chunk_offsets,
+                           chunk_offsets, JoinMode::Inner, nullptr, use_prefetching);
+    auto match_count = size_t{0};
+    for (auto pos_list_id = size_t{0}; pos_list_id < pos_lists_left.size(); ++pos_list_id) {
+      EXPECT_EQ(pos_lists_left[pos_list_id], pos_lists_right[pos_list_id]);
+      match_count += pos_lists_left[pos_list_id].size();
+    }
+    EXPECT_EQ(match_count, 1'000u);
+  }
+
+  // _table_zero_one has duplicate keys
+  std::vector<std::vector<size_t>> histograms_duplicates;
+  const auto materialized_duplicates =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms_duplicates, 0);
+  EXPECT_FALSE((build_unique<int, int>(materialized_duplicates)));
+}
+
+TEST_F(JoinHashStepsTest, RowIDDecoder) {
+  // The second chunk is empty
+  const auto chunk_offsets = std::vector<size_t>{0, 3, 3, 10};
+  auto row_id_decoder = RowIDDecoder{chunk_offsets};
+
+  EXPECT_EQ(row_id_decoder.decode(RowIndex{0}), RowID(ChunkID{0}, ChunkOffset{0}));
+  EXPECT_EQ(row_id_decoder.decode(RowIndex{2}), RowID(ChunkID{0}, ChunkOffset{2}));
+  EXPECT_EQ(row_id_decoder.decode(RowIndex{3}), RowID(ChunkID{2}, ChunkOffset{0}));
+  EXPECT_EQ(row_id_decoder.decode(RowIndex{11}), RowID(ChunkID{3}, ChunkOffset{1}));
+  EXPECT_EQ(row_id_decoder.decode(RowIndex{1}), RowID(ChunkID{0}, ChunkOffset{1}));
+  EXPECT_EQ(row_id_decoder.decode(RowIndex{9}), RowID(ChunkID{2}, ChunkOffset{6}));
+  EXPECT_EQ(row_id_decoder.decode(INVALID_ROW_INDEX), NULL_ROW_ID);
+}
+
+TEST_F(JoinHashStepsTest, NUMAPlacementOfPartitions) {
+  // Without multiple nodes, the jobs stay on the current node
+  Topology::use_non_numa_topology();
+  EXPECT_EQ(numa_node_for_partition(3), CURRENT_NODE_ID);
+
+  Topology::use_fake_numa_topology(8, 1);
+  const auto node_count = Topology::get().nodes().size();
+  if (node_count > 1) {
+    EXPECT_EQ(numa_node_for_partition(0), NodeID{0});
+    EXPECT_EQ(numa_node_for_partition(node_count + 1), NodeID{1});
+  }
+
+  // The hash tables are built with the memory resources of their nodes and hold the same rows as without NUMA
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 2);
+  const auto radix_container = partition_radix_parallel<int, int, false>(
+      materialized, determine_chunk_offsets(_table_zero_one), histograms, 2);
+  const auto hash_tables = build<int, int>(radix_container);
+
+  auto row_count = size_t{0};
+  for (const auto& hash_table : hash_tables) {
+    if (!hash_table) continue;
+    row_count += get_row_count(hash_table->begin(), hash_table->end());
+  }
+  EXPECT_EQ(row_count, _table_size_zero_one);
+
+  Topology::use_default_topology();
+}
+
+TEST_F(JoinHashStepsTest, ProbeRangesSplitHeavyPartitions) {
+  // The third partition holds almost all rows, e.g., because of a single hot join key
+  const auto partition_offsets = std::vector<size_t>{10, 10, 1'000'000, 1'000'010};
+  const auto probe_ranges = determine_probe_ranges(partition_offsets);
+
+  // The empty partition has no range, the heavy one is split into ranges of at most PROBE_RANGE_MAX_SIZE rows
+  ASSERT_EQ(probe_ranges.size(), 10u);
+  EXPECT_EQ(probe_ranges.front().partition_id, 0u);
+  EXPECT_EQ(probe_ranges.back().partition_id, 3u);
+
+  auto expected_begin = size_t{0};
+  for (const auto& probe_range : probe_ranges) {
+    EXPECT_EQ(probe_range.begin, expected_begin);
+    EXPECT_LE(probe_range.end - probe_range.begin, PROBE_RANGE_MAX_SIZE);
+    expected_begin = probe_range.end;
+  }
+  EXPECT_EQ(expected_begin, partition_offsets.back());
+
+  // Without skew, each partition is a single range
+  EXPECT_EQ(determine_probe_ranges(std::vector<size_t>{100, 200, 300, 400}).size(), 4u);
+}
+
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   std::vector<std::vector<size_t>> histograms;
 
@@ -191,6 +352,62 @@ TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   EXPECT_EQ(chunk_offsets_nulls[1], 10);
 }
 
+TEST_F(JoinHashStepsTest, BloomFilter) {
+  auto bloom_filter = BloomFilter{1'000};
+
+  for (auto value = size_t{0}; value < 1'000; ++value) {
+    bloom_filter.insert(std::hash<int>{}(static_cast<int>(value)));
+  }
+
+  // No false negatives
+  for (auto value = size_t{0}; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(std::hash<int>{}(static_cast<int>(value))));
+  }
+
+  // Few false positives
+  auto false_positive_count = size_t{0};
+  for (auto value = size_t{1'000}; value < 11'000; ++value) {
+    if (bloom_filter.may_contain(std::hash<int>{}(static_cast<int>(value)))) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 200);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputWithBloomFilter) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = 0; value < 1'000; ++value) {
+    probe_table->append({value});
+  }
+
+  // The build side only contains zeros and ones
+  std::vector<std::vector<size_t>> histograms;
+  const auto build_radix_container = materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 0);
+  auto bloom_filter = BloomFilter{_table_zero_one->row_count()};
+  build<int, int>(build_radix_container, &bloom_filter);
+
+  histograms.clear();
+  const auto probe_radix_container =
+      materialize_input<int, int, false>(probe_table, ColumnID{0}, histograms, 0, &bloom_filter);
+
+  auto materialized_values = std::vector<int>{};
+  for (const auto& element : *probe_radix_container.elements) {
+    if (element.row_index != INVALID_ROW_INDEX) materialized_values.emplace_back(element.value);
+  }
+
+  // The matching values are always kept, almost all others are dropped
+  EXPECT_NE(std::find(materialized_values.begin(), materialized_values.end(), 0), materialized_values.end());
+  EXPECT_NE(std::find(materialized_values.begin(), materialized_values.end(), 1), materialized_values.end());
+  EXPECT_LT(materialized_values.size(), 50);
+
+  // Histograms only count the materialized values
+  auto histogram_sum = size_t{0};
+  for (const auto& histogram : histograms) {
+    histogram_sum += std::accumulate(histogram.begin(), histogram.end(), size_t{0});
+  }
+  EXPECT_EQ(histogram_sum, materialized_values.size());
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
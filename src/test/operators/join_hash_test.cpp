@@ -1,7 +1,15 @@
 #include "../base_test.hpp"
 
+#include "memory/arena_memory_resource.hpp"
+#include "memory/memory_budget.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table_partitioning.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -77,6 +85,76 @@ TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
 }
 
+TEST_F(JoinHashTest, SelectiveJoinWithBloomFilter) {
+  // The probe side (lineitems) is much larger than the filtered build side (orders), so that most probe rows are
+  // dropped by the BloomFilter during materialization. This must not change the result.
+  const auto orders_filtered = create_table_scan(_table_tpch_orders, ColumnID{0}, PredicateCondition::LessThan, 100);
+  orders_filtered->execute();
+
+  for (const auto radix_bits : {size_t{0}, size_t{2}}) {
+    auto join_hash = std::make_shared<JoinHash>(orders_filtered, _table_tpch_lineitems, JoinMode::Inner,
+                                                ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                                radix_bits);
+    join_hash->execute();
+
+    auto join_sort_merge =
+        std::make_shared<JoinSortMerge>(orders_filtered, _table_tpch_lineitems, JoinMode::Inner,
+                                        ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    join_sort_merge->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_hash->get_output(), join_sort_merge->get_output());
+
+    // Semi joins can use the BloomFilter as well
+    auto semi_join = std::make_shared<JoinHash>(_table_tpch_lineitems, orders_filtered, JoinMode::Semi,
+                                                ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                                                radix_bits);
+    semi_join->execute();
+
+    const auto lineitems_filtered =
+        create_table_scan(_table_tpch_lineitems, ColumnID{0}, PredicateCondition::LessThan, 100);
+    lineitems_filtered->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(semi_join->get_output(), lineitems_filtered->get_output());
+  }
+}
+
+TEST_F(JoinHashTest, RuntimeChunkPruning) {
+  // The lineitems are ordered by their order key. Thus, the statistics of most of their chunks show that they do not
+  // contain any of the few order keys of the build side.
+  const auto lineitems = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", 10);
+  ChunkEncoder::encode_all_chunks(lineitems);
+  const auto lineitems_wrapper = std::make_shared<TableWrapper>(lineitems);
+  lineitems_wrapper->execute();
+
+  const auto orders_filtered = create_table_scan(_table_tpch_orders, ColumnID{0}, PredicateCondition::LessThan, 10);
+  orders_filtered->execute();
+
+  auto join_nested_loop =
+      std::make_shared<JoinNestedLoop>(orders_filtered, lineitems_wrapper, JoinMode::Inner,
+                                       ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join_nested_loop->execute();
+
+  auto join_hash = std::make_shared<JoinHash>(orders_filtered, lineitems_wrapper, JoinMode::Inner,
+                                              ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join_hash->execute();
+
+  auto join_sort_merge =
+      std::make_shared<JoinSortMerge>(orders_filtered, lineitems_wrapper, JoinMode::Inner,
+                                      ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join_sort_merge->execute();
+
+  for (const auto& join : {std::static_pointer_cast<AbstractOperator>(join_hash),
+                           std::static_pointer_cast<AbstractOperator>(join_sort_merge)}) {
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_nested_loop->get_output());
+
+    // The output references the pruned copy of the lineitems
+    const auto lineitem_column_id = static_cast<ColumnID>(orders_filtered->get_output()->column_count());
+    const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(
+        join->get_output()->get_chunk(ChunkID{0})->get_segment(lineitem_column_id));
+    EXPECT_LT(reference_segment->referenced_table()->chunk_count(), lineitems->chunk_count());
+  }
+}
+
 TEST_F(JoinHashTest, HashJoinNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -98,4 +176,226 @@ TEST_F(JoinHashTest, HashJoinNotApplicable) {
   EXPECT_THROW(execute_hash_join(JoinMode::Left, PredicateCondition::GreaterThan), std::logic_error);
 }
 
+TEST_F(JoinHashTest, RadixBitsInPerformanceData) {
+  const auto join_with_radix_bits =
+      std::make_shared<JoinHash>(_table_wrapper_small, _table_wrapper_small, JoinMode::Inner,
+                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, size_t{2});
+  join_with_radix_bits->execute();
+
+  const auto& performance_data =
+      static_cast<const JoinHash::PerformanceData&>(join_with_radix_bits->performance_data());
+  EXPECT_EQ(performance_data.radix_bits, 2u);
+  EXPECT_NE(performance_data.to_string().find("4 radix partitions"), std::string::npos);
+
+  // A small build relation fits into the L2 cache without partitioning
+  const auto join = std::make_shared<JoinHash>(_table_wrapper_small, _table_tpch_lineitems, JoinMode::Inner,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+  EXPECT_EQ(static_cast<const JoinHash::PerformanceData&>(join->performance_data()).radix_bits, 0u);
+}
+
+TEST_F(JoinHashTest, SkewedProbeSide) {
+  // All probe rows share a single key, so that they end up in the same partition, which is probed in several ranges
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto build_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  build_table->append({1});
+  build_table->append({2});
+  const auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+  for (auto row_idx = 0; row_idx < 50'000; ++row_idx) probe_table->append({row_idx % 1'000 == 0 ? 3 : 1});
+
+  const auto build = std::make_shared<TableWrapper>(build_table);
+  const auto probe = std::make_shared<TableWrapper>(probe_table);
+  build->execute();
+  probe->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Right}) {
+    const auto join = std::make_shared<JoinHash>(build, probe, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                 PredicateCondition::Equals, size_t{0});
+    join->execute();
+
+    const auto expected_row_count = mode == JoinMode::Inner ? 49'950u : 50'000u;
+    EXPECT_EQ(join->get_output()->row_count(), expected_row_count);
+  }
+}
+
+TEST_F(JoinHashTest, SemiAntiJoinBuildingOutputSide) {
+  // The output side is much smaller than the other input, so that its rows are held in the hash tables and the other
+  // input is streamed through them
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto small_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  for (const auto value : {1, 2, 2, 3}) small_table->append({value});
+  const auto large_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto row_idx = 0; row_idx < 100; ++row_idx) large_table->append({row_idx % 2 == 0 ? 2 : 4});
+
+  const auto small = std::make_shared<TableWrapper>(small_table);
+  const auto large = std::make_shared<TableWrapper>(large_table);
+  small->execute();
+  large->execute();
+
+  for (const auto radix_bits : {size_t{0}, size_t{2}}) {
+    const auto semi_join =
+        std::make_shared<JoinHash>(small, large, JoinMode::Semi, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                   PredicateCondition::Equals, radix_bits);
+    semi_join->execute();
+
+    const auto expected_semi = std::make_shared<Table>(column_definitions, TableType::Data);
+    expected_semi->append({2});
+    expected_semi->append({2});
+    EXPECT_TABLE_EQ_UNORDERED(semi_join->get_output(), expected_semi);
+
+    const auto anti_join =
+        std::make_shared<JoinHash>(small, large, JoinMode::Anti, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                   PredicateCondition::Equals, radix_bits);
+    anti_join->execute();
+
+    const auto expected_anti = std::make_shared<Table>(column_definitions, TableType::Data);
+    expected_anti->append({1});
+    expected_anti->append({3});
+    EXPECT_TABLE_EQ_UNORDERED(anti_join->get_output(), expected_anti);
+  }
+}
+
+TEST_F(JoinHashTest, SecondaryPredicates) {
+  // Joins on the composite key (a, b), where a is hashed and b is compared while probing
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  left_table->append({1, 1});
+  left_table->append({1, 2});
+  left_table->append({2, 1});
+  left_table->append({3, NullValue{}});
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  right_table->append({1, 2});
+  right_table->append({1, 3});
+  right_table->append({2, 1});
+  right_table->append({2, 1});
+  right_table->append({3, NullValue{}});
+
+  const auto left = std::make_shared<TableWrapper>(left_table);
+  const auto right = std::make_shared<TableWrapper>(right_table);
+  left->execute();
+  right->execute();
+
+  const auto execute_join = [&](const JoinMode mode) {
+    const auto join = std::make_shared<JoinHash>(
+        left, right, mode, ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals, std::nullopt,
+        std::vector<OperatorJoinPredicate>{{ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}});
+    join->execute();
+    return join->get_output();
+  };
+
+  auto joined_column_definitions = column_definitions;
+  joined_column_definitions.insert(joined_column_definitions.end(), column_definitions.begin(),
+                                   column_definitions.end());
+
+  const auto expected_inner = std::make_shared<Table>(joined_column_definitions, TableType::Data);
+  expected_inner->append({1, 2, 1, 2});
+  expected_inner->append({2, 1, 2, 1});
+  expected_inner->append({2, 1, 2, 1});
+  EXPECT_TABLE_EQ_UNORDERED(execute_join(JoinMode::Inner), expected_inner);
+
+  joined_column_definitions[2].nullable = true;
+  const auto expected_left = std::make_shared<Table>(joined_column_definitions, TableType::Data);
+  expected_left->append({1, 1, NullValue{}, NullValue{}});
+  expected_left->append({1, 2, 1, 2});
+  expected_left->append({2, 1, 2, 1});
+  expected_left->append({2, 1, 2, 1});
+  expected_left->append({3, NullValue{}, NullValue{}, NullValue{}});
+  EXPECT_TABLE_EQ_UNORDERED(execute_join(JoinMode::Left), expected_left);
+
+  const auto expected_semi = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_semi->append({1, 2});
+  expected_semi->append({2, 1});
+  EXPECT_TABLE_EQ_UNORDERED(execute_join(JoinMode::Semi), expected_semi);
+
+  const auto expected_anti = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_anti->append({1, 1});
+  expected_anti->append({3, NullValue{}});
+  EXPECT_TABLE_EQ_UNORDERED(execute_join(JoinMode::Anti), expected_anti);
+}
+
+TEST_F(JoinHashTest, SecondaryPredicatesDescription) {
+  const auto join = std::make_shared<JoinHash>(
+      _table_with_nulls, _table_with_nulls, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::Equals, std::nullopt,
+      std::vector<OperatorJoinPredicate>{{ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan}});
+
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine), "JoinHash (Inner Join where a = a AND b < b)");
+}
+
+TEST_F(JoinHashTest, JoinWithSpilling) {
+  // With a budget of a single byte, both inputs are partitioned by their join keys and spilled to disk
+  const auto arena = std::make_shared<ArenaMemoryResource>(std::make_shared<MemoryBudget>(1));
+
+  const auto test_spilled_join = [&](const std::shared_ptr<const AbstractOperator>& left,
+                                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode) {
+    const auto join_in_memory = std::make_shared<JoinHash>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                           PredicateCondition::Equals);
+    join_in_memory->execute();
+
+    const auto join_spilled = std::make_shared<JoinHash>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                         PredicateCondition::Equals);
+    join_spilled->set_arena_recursively(arena);
+    join_spilled->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_spilled->get_output(), join_in_memory->get_output());
+  };
+
+  // Rows with NULLs as their join key are written to the same partition
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer, JoinMode::Semi}) {
+    test_spilled_join(_table_with_nulls, _table_with_nulls, mode);
+  }
+
+  // The references of reference tables are resolved
+  test_spilled_join(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner);
+}
+
+TEST_F(JoinHashTest, PartitionWiseJoin) {
+  // Both inputs are hash-partitioned by their join column, so JoinHash joins their partitions independently
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto create_table = [&](const bool partitioned) {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    if (partitioned) {
+      table->set_partitioning(TablePartitioning::create_hash_partitioning(ColumnID{0}, DataType::Int, 4));
+    }
+    return table;
+  };
+
+  const auto left = create_table(true);
+  const auto right = create_table(true);
+  const auto left_unpartitioned = create_table(false);
+  const auto right_unpartitioned = create_table(false);
+  for (auto row = 0; row < 20; ++row) {
+    const auto left_value = row % 7 == 0 ? NULL_VALUE : AllTypeVariant{row % 10};
+    left->append({left_value, row});
+    left_unpartitioned->append({left_value, row});
+    right->append({row % 12, row});
+    right_unpartitioned->append({row % 12, row});
+  }
+
+  const auto wrap = [](const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  // The partitions of the scanned right input are found through the references of its chunks
+  const auto right_scanned = create_table_scan(wrap(right), ColumnID{1}, PredicateCondition::GreaterThanEquals, 0);
+  right_scanned->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer, JoinMode::Semi}) {
+    const auto join = std::make_shared<JoinHash>(wrap(left), right_scanned, mode,
+                                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    join->execute();
+
+    const auto expected_join =
+        std::make_shared<JoinHash>(wrap(left_unpartitioned), wrap(right_unpartitioned), mode,
+                                   ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    expected_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+    EXPECT_GT(performance_data.table_partition_count, 1u);
+  }
+}
+
 }  // namespace opossum
@@ -17,8 +17,7 @@ template <typename T, typename HashType>
 void test_hash_map(const std::vector<T>& values) {
   Partition<T> elements;
   for (ChunkOffset i = ChunkOffset{0}; i < values.size(); ++i) {
-    RowID row_id{ChunkID{17}, i};
-    elements.emplace_back(PartitionedElement<T>{row_id, static_cast<T>(values.at(i))});
+    elements.emplace_back(PartitionedElement<T>{static_cast<RowIndex>(i + 17), static_cast<T>(values.at(i))});
   }
 
   auto hash_map = build<T, HashType>(RadixContainer<T>{std::make_shared<Partition<T>>(elements),
@@ -41,8 +40,8 @@ void test_hash_map(const std::vector<T>& values) {
     const auto probe_value = element.value;
 
     const auto result_list = hash_map.at(0).value().at(probe_value);
-    const RowID probe_row_id{ChunkID{17}, offset};
-    EXPECT_TRUE(std::find(result_list.begin(), result_list.end(), probe_row_id) != result_list.end());
+    const auto probe_row_index = static_cast<RowIndex>(offset + 17);
+    EXPECT_TRUE(std::find(result_list.begin(), result_list.end(), probe_row_index) != result_list.end());
     ++offset;
   }
 }
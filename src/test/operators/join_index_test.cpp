@@ -11,6 +11,9 @@
 #include "operators/join_index.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
@@ -551,4 +554,63 @@ TYPED_TEST(JoinIndexTest, LeftJoinEmptyRefSegment) {
                          "resources/test_data/tbl/joinoperators/int_join_empty_left.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, ProbeChunksConcurrently) {
+  // The 100 left chunks are probed by separate jobs
+  auto table_left = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String}}, TableType::Data, 10);
+  for (auto index = 0; index < 1'000; ++index) {
+    const auto a = index % 13 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(index * 7) % 120};
+    table_left->append({a, pmr_string{"left" + std::to_string(index)}});
+  }
+  ChunkEncoder::encode_all_chunks(table_left, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto table_wrapper_left = std::make_shared<TableWrapper>(table_left);
+  table_wrapper_left->execute();
+
+  const auto create_right_table = [](const bool with_index) {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"c", DataType::Int}}, TableType::Data, 20);
+    for (auto index = 0; index < 100; ++index) {
+      table->append({index % 50});
+    }
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    if (with_index) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->get_chunk(chunk_id)->create_index<TypeParam>(std::vector<ColumnID>{ColumnID{0}});
+      }
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  // Right and outer joins track the matches of the right rows and probe the left chunks one after another
+  const auto table_wrappers_right = {create_right_table(true), create_right_table(false)};
+  const auto create_joins = [&]() {
+    auto joins = std::vector<std::shared_ptr<JoinIndex>>{};
+    for (const auto& table_wrapper_right : table_wrappers_right) {
+      for (const auto mode : {JoinMode::Inner, JoinMode::Left}) {
+        for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+          joins.emplace_back(std::make_shared<JoinIndex>(table_wrapper_left, table_wrapper_right, mode,
+                                                         std::pair<ColumnID, ColumnID>{ColumnID{0}, ColumnID{0}},
+                                                         predicate_condition));
+        }
+      }
+    }
+    return joins;
+  };
+
+  const auto joins = create_joins();
+  for (const auto& join : joins) {
+    join->execute();
+  }
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto concurrent_joins = create_joins();
+  for (auto join_id = size_t{0}; join_id < joins.size(); ++join_id) {
+    concurrent_joins[join_id]->execute();
+    EXPECT_TABLE_EQ_ORDERED(concurrent_joins[join_id]->get_output(), joins[join_id]->get_output());
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+#include "join_test.hpp"
+
+#include "operators/join_mpsm.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinMPSMTest : public JoinTest {
+ protected:
+  void SetUp() override {
+    JoinTest::SetUp();
+
+    auto left = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 2);
+    for (const auto& value : std::vector<AllTypeVariant>{1, 3, 5, NullValue{}, 7}) left->append({value});
+
+    auto right = std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, false}}, TableType::Data, 2);
+    for (const auto value : {2, 3, 3, 6}) right->append({value});
+
+    _left_wrapper = std::make_shared<TableWrapper>(left);
+    _right_wrapper = std::make_shared<TableWrapper>(right);
+    _left_wrapper->execute();
+    _right_wrapper->execute();
+  }
+
+  void TearDown() override { Topology::use_default_topology(); }
+
+  // Executes a semi or anti join of the left and right table and returns the sorted values of the output rows
+  std::vector<int32_t> semi_anti_join_values(const JoinMode mode, const PredicateCondition predicate_condition) {
+    const auto join = std::make_shared<JoinMPSM>(_left_wrapper, _right_wrapper, mode,
+                                                 ColumnIDPair(ColumnID{0}, ColumnID{0}), predicate_condition);
+    join->execute();
+
+    const auto output = join->get_output();
+    EXPECT_EQ(output->column_count(), 1u);
+
+    auto values = std::vector<int32_t>{};
+    for (auto row_id = size_t{0}; row_id < output->row_count(); ++row_id) {
+      values.emplace_back(output->get_value<int32_t>(ColumnID{0}, row_id));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  // Four nodes, so that the inputs are split into four clusters
+  static void use_four_node_topology() {
+    auto nodes = std::vector<TopologyNode>{};
+    for (auto node_id = uint32_t{0}; node_id < 4; ++node_id) {
+      nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{node_id}}});
+    }
+    Topology::use_custom_topology(std::move(nodes));
+  }
+
+  std::shared_ptr<TableWrapper> _left_wrapper, _right_wrapper;
+};
+
+TEST_F(JoinMPSMTest, SemiAndAntiJoin) {
+  test_join_output<JoinMPSM>(_table_wrapper_k, _table_wrapper_a, {ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                             JoinMode::Semi, "resources/test_data/tbl/int.tbl", 1);
+  test_join_output<JoinMPSM>(_table_wrapper_k, _table_wrapper_a, {ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                             JoinMode::Anti, "resources/test_data/tbl/joinoperators/anti_int4.tbl", 1);
+}
+
+TEST_F(JoinMPSMTest, NonEquiSemiAndAntiJoin) {
+  // As in JoinHash, rows with a NULL value find no join partner and are dropped by anti joins as well
+  for (const auto use_multiple_nodes : {false, true}) {
+    if (use_multiple_nodes) use_four_node_topology();
+
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Semi, PredicateCondition::Equals), std::vector<int32_t>({3}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Anti, PredicateCondition::Equals), std::vector<int32_t>({1, 5, 7}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Semi, PredicateCondition::LessThan), std::vector<int32_t>({1, 3, 5}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Anti, PredicateCondition::LessThan), std::vector<int32_t>({7}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Semi, PredicateCondition::GreaterThanEquals),
+              std::vector<int32_t>({3, 5, 7}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Anti, PredicateCondition::GreaterThanEquals), std::vector<int32_t>({1}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Semi, PredicateCondition::NotEquals),
+              std::vector<int32_t>({1, 3, 5, 7}));
+    EXPECT_EQ(semi_anti_join_values(JoinMode::Anti, PredicateCondition::NotEquals), std::vector<int32_t>{});
+  }
+}
+
+TEST_F(JoinMPSMTest, MultipleNumaNodes) {
+  use_four_node_topology();
+
+  // The results must not depend on the clustering, so they are compared to those of JoinNestedLoop
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer}) {
+    for (const auto predicate_condition :
+         {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+          PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+      for (const auto& [left, right] : {std::make_pair(_table_wrapper_a, _table_wrapper_b),
+                                        std::make_pair(_table_wrapper_m, _table_wrapper_n)}) {
+        const auto column_ids = ColumnIDPair(ColumnID{0}, ColumnID{0});
+        const auto mpsm_join = std::make_shared<JoinMPSM>(left, right, mode, column_ids, predicate_condition);
+        const auto nested_loop_join = std::make_shared<JoinNestedLoop>(left, right, mode, column_ids,
+                                                                       predicate_condition);
+        mpsm_join->execute();
+        nested_loop_join->execute();
+
+        EXPECT_TABLE_EQ_UNORDERED(mpsm_join->get_output(), nested_loop_join->get_output());
+      }
+    }
+  }
+}
+
+}  // namespace opossum
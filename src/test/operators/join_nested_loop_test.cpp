@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "type_comparison.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinNestedLoopTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The right table has more values per chunk than fit into a single block of the blocked join
+    _left_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 100);
+    for (auto row_id = 0; row_id < 300; ++row_id) {
+      _left_values.emplace_back(row_id % 37 == 0 ? std::nullopt : std::optional<int32_t>{(row_id * 7) % 400});
+      _left_table->append({_left_values.back() ? AllTypeVariant{*_left_values.back()} : AllTypeVariant{NULL_VALUE}});
+    }
+
+    _right_table = std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, true}}, TableType::Data, 2500);
+    for (auto row_id = 0; row_id < 6000; ++row_id) {
+      _right_values.emplace_back(row_id % 41 == 0 ? std::nullopt : std::optional<int32_t>{(row_id * 13) % 500});
+      _right_table->append(
+          {_right_values.back() ? AllTypeVariant{*_right_values.back()} : AllTypeVariant{NULL_VALUE}});
+    }
+    ChunkEncoder::encode_chunks(_right_table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+    _left_wrapper = std::make_shared<TableWrapper>(_left_table);
+    _left_wrapper->execute();
+    _right_wrapper = std::make_shared<TableWrapper>(_right_table);
+    _right_wrapper->execute();
+  }
+
+  void TearDown() override { Topology::use_default_topology(); }
+
+  // Counts the rows of a join of the left and right values by comparing all pairs
+  size_t expected_row_count(const JoinMode mode, const PredicateCondition predicate_condition) const {
+    auto row_count = size_t{0};
+    auto right_matched = std::vector<bool>(_right_values.size());
+
+    with_comparator(predicate_condition, [&](auto comparator) {
+      for (const auto& left_value : _left_values) {
+        auto left_matched = false;
+        for (auto right_index = size_t{0}; right_index < _right_values.size(); ++right_index) {
+          const auto& right_value = _right_values[right_index];
+          if (!left_value || !right_value || !comparator(*left_value, *right_value)) continue;
+          ++row_count;
+          left_matched = true;
+          right_matched[right_index] = true;
+        }
+        if (!left_matched && (mode == JoinMode::Left || mode == JoinMode::Outer)) ++row_count;
+      }
+    });
+
+    if (mode == JoinMode::Outer) {
+      row_count += std::count(right_matched.begin(), right_matched.end(), false);
+    }
+    return row_count;
+  }
+
+  std::shared_ptr<Table> _left_table;
+  std::shared_ptr<Table> _right_table;
+  std::vector<std::optional<int32_t>> _left_values;
+  std::vector<std::optional<int32_t>> _right_values;
+  std::shared_ptr<TableWrapper> _left_wrapper;
+  std::shared_ptr<TableWrapper> _right_wrapper;
+  const ColumnIDPair _column_ids{ColumnID{0}, ColumnID{0}};
+};
+
+TEST_F(JoinNestedLoopTest, BlockedJoin) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Outer}) {
+    for (const auto predicate_condition :
+         {PredicateCondition::Equals, PredicateCondition::LessThan, PredicateCondition::GreaterThanEquals}) {
+      const auto join =
+          std::make_shared<JoinNestedLoop>(_left_wrapper, _right_wrapper, mode, _column_ids, predicate_condition);
+      join->execute();
+
+      EXPECT_EQ(join->get_output()->row_count(), expected_row_count(mode, predicate_condition));
+    }
+  }
+}
+
+TEST_F(JoinNestedLoopTest, DifferentDataTypes) {
+  // Columns of different data types are not materialized, but joined through their iterables
+  const auto right_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Long, true}}, TableType::Data, 2500);
+  for (const auto& right_value : _right_values) {
+    right_table->append(
+        {right_value ? AllTypeVariant{static_cast<int64_t>(*right_value)} : AllTypeVariant{NULL_VALUE}});
+  }
+  const auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  const auto join = std::make_shared<JoinNestedLoop>(_left_wrapper, right_wrapper, JoinMode::Outer, _column_ids,
+                                                     PredicateCondition::Equals);
+  join->execute();
+
+  EXPECT_EQ(join->get_output()->row_count(), expected_row_count(JoinMode::Outer, PredicateCondition::Equals));
+}
+
+TEST_F(JoinNestedLoopTest, ParallelJoin) {
+  // The chunks of the left input are joined by concurrent jobs, whose outputs are concatenated in the order of the
+  // chunks. Thus, the output equals that of the join without a scheduler.
+  const auto expected_join = std::make_shared<JoinNestedLoop>(_left_wrapper, _right_wrapper, JoinMode::Outer,
+                                                              _column_ids, PredicateCondition::Equals);
+  expected_join->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto join = std::make_shared<JoinNestedLoop>(_left_wrapper, _right_wrapper, JoinMode::Outer, _column_ids,
+                                                     PredicateCondition::Equals);
+  join->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_TABLE_EQ_ORDERED(join->get_output(), expected_join->get_output());
+}
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+#include "join_test.hpp"
+
+#include "operators/join_range.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinRangeTest : public JoinTest {
+ protected:
+  void SetUp() override {
+    JoinTest::SetUp();
+
+    auto points_definitions = TableColumnDefinitions{{"ts", DataType::Int, true}};
+    _points = std::make_shared<Table>(points_definitions, TableType::Data, 2);
+    _points->append({1});
+    _points->append({5});
+    _points->append({10});
+    _points->append({15});
+    _points->append({NullValue{}});
+
+    auto intervals_definitions =
+        TableColumnDefinitions{{"start", DataType::Int, true}, {"end", DataType::Int, true}};
+    _intervals = std::make_shared<Table>(intervals_definitions, TableType::Data, 2);
+    _intervals->append({0, 5});
+    _intervals->append({5, 12});
+    _intervals->append({20, 30});
+    _intervals->append({NullValue{}, 3});
+
+    _points_wrapper = std::make_shared<TableWrapper>(_points);
+    _intervals_wrapper = std::make_shared<TableWrapper>(_intervals);
+    _points_wrapper->execute();
+    _intervals_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _points, _intervals;
+  std::shared_ptr<TableWrapper> _points_wrapper, _intervals_wrapper;
+};
+
+TEST_F(JoinRangeTest, SmallerInnerJoin) {
+  test_join_output<JoinRange>(_table_wrapper_a, _table_wrapper_b, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                              PredicateCondition::LessThan, JoinMode::Inner,
+                              "resources/test_data/tbl/joinoperators/int_smaller_inner_join.tbl", 1);
+  test_join_output<JoinRange>(_table_wrapper_a_dict, _table_wrapper_b_dict, ColumnIDPair(ColumnID{1}, ColumnID{1}),
+                              PredicateCondition::LessThan, JoinMode::Inner,
+                              "resources/test_data/tbl/joinoperators/float_smaller_inner_join.tbl", 1);
+}
+
+TEST_F(JoinRangeTest, SmallerEqualInnerJoin) {
+  test_join_output<JoinRange>(_table_wrapper_a, _table_wrapper_b, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                              PredicateCondition::LessThanEquals, JoinMode::Inner,
+                              "resources/test_data/tbl/joinoperators/int_smallerequal_inner_join.tbl", 1);
+}
+
+TEST_F(JoinRangeTest, GreaterInnerJoin) {
+  test_join_output<JoinRange>(_table_wrapper_a, _table_wrapper_b, ColumnIDPair(ColumnID{1}, ColumnID{1}),
+                              PredicateCondition::GreaterThan, JoinMode::Inner,
+                              "resources/test_data/tbl/joinoperators/float_greater_inner_join.tbl", 1);
+}
+
+TEST_F(JoinRangeTest, GreaterEqualInnerJoin) {
+  test_join_output<JoinRange>(_table_wrapper_a, _table_wrapper_b, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                              PredicateCondition::GreaterThanEquals, JoinMode::Inner,
+                              "resources/test_data/tbl/joinoperators/int_greaterequal_inner_join.tbl", 1);
+}
+
+TEST_F(JoinRangeTest, BandJoinSortingLeftInput) {
+  // ts BETWEEN start AND end, i.e., ts >= start AND ts <= end
+  const auto join = std::make_shared<JoinRange>(
+      _points_wrapper, _intervals_wrapper, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::GreaterThanEquals,
+      OperatorJoinPredicate{ColumnIDPair{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThanEquals});
+  join->execute();
+
+  auto expected_definitions = _points->column_definitions();
+  expected_definitions.insert(expected_definitions.end(), _intervals->column_definitions().begin(),
+                              _intervals->column_definitions().end());
+  const auto expected_result = std::make_shared<Table>(expected_definitions, TableType::Data);
+  expected_result->append({1, 0, 5});
+  expected_result->append({5, 0, 5});
+  expected_result->append({5, 5, 12});
+  expected_result->append({10, 5, 12});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
+TEST_F(JoinRangeTest, BandJoinSortingRightInput) {
+  // start <= ts AND end >= ts
+  const auto join = std::make_shared<JoinRange>(
+      _intervals_wrapper, _points_wrapper, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::LessThanEquals,
+      OperatorJoinPredicate{ColumnIDPair{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThanEquals});
+  join->execute();
+
+  auto expected_definitions = _intervals->column_definitions();
+  expected_definitions.insert(expected_definitions.end(), _points->column_definitions().begin(),
+                              _points->column_definitions().end());
+  const auto expected_result = std::make_shared<Table>(expected_definitions, TableType::Data);
+  expected_result->append({0, 5, 1});
+  expected_result->append({0, 5, 5});
+  expected_result->append({5, 12, 5});
+  expected_result->append({5, 12, 10});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
+TEST_F(JoinRangeTest, BandJoinOnReferenceSegments) {
+  const auto scan = create_table_scan(_points_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan->execute();
+
+  const auto join = std::make_shared<JoinRange>(
+      scan, _intervals_wrapper, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::GreaterThan,
+      OperatorJoinPredicate{ColumnIDPair{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThan});
+  join->execute();
+
+  auto expected_definitions = _points->column_definitions();
+  expected_definitions.insert(expected_definitions.end(), _intervals->column_definitions().begin(),
+                              _intervals->column_definitions().end());
+  const auto expected_result = std::make_shared<Table>(expected_definitions, TableType::Data);
+  expected_result->append({10, 5, 12});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
+TEST_F(JoinRangeTest, Description) {
+  const auto join = std::make_shared<JoinRange>(
+      _points_wrapper, _intervals_wrapper, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::GreaterThanEquals,
+      OperatorJoinPredicate{ColumnIDPair{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThanEquals});
+
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine),
+            "JoinRange (Inner Join where ts >= start AND ts <= end)");
+}
+
+}  // namespace opossum
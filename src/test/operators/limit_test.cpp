@@ -11,6 +11,10 @@
 #include "operators/limit.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/reference_segment.hpp"
 #include "types.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -118,4 +122,45 @@ TEST_F(OperatorsLimitTest, Limit10ReferenceSegment) {
   test_limit_10();
 }
 
+TEST_F(OperatorsLimitTest, Limit4Parallel) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  _input_operator = _table_wrapper;
+  test_limit_4();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(OperatorsLimitTest, SegmentsSharePosLists) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, to_expression(int64_t{4}));
+  limit->execute();
+
+  const auto& output_table = *limit->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table.chunk_count(); ++chunk_id) {
+    const auto chunk = output_table.get_chunk(chunk_id);
+    const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    const auto second_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+    EXPECT_EQ(first_segment->pos_list(), second_segment->pos_list());
+    EXPECT_TRUE(first_segment->pos_list()->references_single_chunk());
+  }
+}
+
+TEST_F(OperatorsLimitTest, ForwardsEntireReferenceChunks) {
+  auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, -1);
+  table_scan->execute();
+
+  auto limit = std::make_shared<Limit>(table_scan, to_expression(int64_t{4}));
+  limit->execute();
+
+  // The first chunk (three rows) is forwarded, the second one is cut off after one row
+  const auto& input_table = *table_scan->get_output();
+  const auto& output_table = *limit->get_output();
+  ASSERT_EQ(output_table.chunk_count(), 2u);
+  EXPECT_EQ(output_table.get_chunk(ChunkID{0})->get_segment(ColumnID{0}),
+            input_table.get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_EQ(output_table.get_chunk(ChunkID{1})->size(), 1u);
+}
+
 }  // namespace opossum
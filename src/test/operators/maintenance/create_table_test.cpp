@@ -43,6 +43,16 @@ TEST_F(CreateTableTest, Execute) {
 
   EXPECT_EQ(table->row_count(), 0);
   EXPECT_EQ(table->column_definitions(), column_definitions);
+  EXPECT_EQ(table->max_chunk_size(), Chunk::DEFAULT_SIZE);
+}
+
+TEST_F(CreateTableTest, ChunkSize) {
+  const auto create_small_table = std::make_shared<CreateTable>("t", column_definitions, 1000);
+  EXPECT_EQ(create_small_table->description(DescriptionMode::SingleLine),
+            "Create Table 't' ('a' int NOT NULL, 'b' float NULL), Chunk Size: 1000");
+
+  create_small_table->execute();
+  EXPECT_EQ(StorageManager::get().get_table("t")->max_chunk_size(), 1000u);
 }
 
 TEST_F(CreateTableTest, TableAlreadyExists) {
@@ -0,0 +1,61 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_parquet.hpp"
+#include "operators/import_parquet.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class OperatorsParquetTest : public BaseTest {
+ protected:
+  void TearDown() override { filesystem::remove(filename); }
+
+  const std::string filename = test_data_path + "parquet_test.parquet";
+};
+
+TEST_F(OperatorsParquetTest, RoundTripKeepsChunksAndNulls) {
+  const auto table = load_table("resources/test_data/tbl/string_int_double_with_null.tbl", 3);
+  ExportParquet::write_parquet(*table, filename);
+
+  auto importer = std::make_shared<ImportParquet>(filename);
+  importer->execute();
+  const auto imported_table = importer->get_output();
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+  ASSERT_EQ(imported_table->chunk_count(), table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto string_segment = imported_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<pmr_string>>(string_segment));
+  }
+}
+
+TEST_F(OperatorsParquetTest, ColumnProjection) {
+  const auto table = load_table("resources/test_data/tbl/string_int_double_with_null.tbl", 3);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto exporter = std::make_shared<ExportParquet>(table_wrapper, filename);
+  exporter->execute();
+
+  auto importer = std::make_shared<ImportParquet>(filename, std::nullopt, std::vector<std::string>{"c", "a"});
+  importer->execute();
+  const auto imported_table = importer->get_output();
+
+  ASSERT_EQ(imported_table->column_count(), 2u);
+  EXPECT_EQ(imported_table->column_name(ColumnID{0}), "c");
+  EXPECT_EQ(imported_table->column_name(ColumnID{1}), "a");
+  EXPECT_EQ(imported_table->row_count(), table->row_count());
+  EXPECT_EQ(imported_table->get_value<double>(ColumnID{0}, 2u), -1.0);
+  EXPECT_EQ(imported_table->get_value<pmr_string>(ColumnID{1}, 2u), "ab");
+
+  EXPECT_THROW(ImportParquet::read_parquet(filename, std::vector<std::string>{"d"}), std::exception);
+}
+
+}  // namespace opossum
@@ -10,6 +10,9 @@
 #include "operators/product.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -57,4 +60,23 @@ TEST_F(OperatorsProductTest, SelfProduct) {
   EXPECT_TABLE_EQ_UNORDERED(product->get_output(), expected_result);
 }
 
+TEST_F(OperatorsProductTest, Parallel) {
+  const auto sequential_product = std::make_shared<Product>(_table_wrapper_a, _table_wrapper_b);
+  sequential_product->execute();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto parallel_product = std::make_shared<Product>(_table_wrapper_a, _table_wrapper_b);
+  parallel_product->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  // One output chunk per pair of input chunks, in the same order as without a scheduler
+  EXPECT_EQ(parallel_product->get_output()->chunk_count(),
+            _table_wrapper_a->get_output()->chunk_count() * _table_wrapper_b->get_output()->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(parallel_product->get_output(), sequential_product->get_output());
+}
+
 }  // namespace opossum
@@ -5,6 +5,8 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "memory/arena_memory_resource.hpp"
+#include "memory/memory_budget.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/print.hpp"
@@ -149,6 +151,57 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultipleColumnSortInOnePass) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+  EXPECT_EQ(sort->get_output()->get_chunk(ChunkID{0})->ordered_by(),
+            std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortInOnePassMixedOrder) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted_mixed.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortWithStringsAndNulls) {
+  auto table = load_table("resources/test_data/tbl/string_int_double_with_null.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result =
+      load_table("resources/test_data/tbl/string_int_double_with_null_sorted.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                       SortColumnDefinition{ColumnID{1}, OrderByMode::DescendingNullsLast},
+                                                       SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
@@ -236,4 +289,96 @@ TEST_P(OperatorsSortTest, SortAfterOuterJoin) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, SortOfMultipleRuns) {
+  // Large enough to be sorted in several runs, which use the radix sort and are merged in several parts
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Float);
+  column_definitions.emplace_back("c", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+  for (auto row_idx = 0; row_idx < 150'000; ++row_idx) {
+    const auto a = (row_idx * 7'919) % 2'001 - 1'000;
+    const auto b = static_cast<float>((int64_t{row_idx} * 104'729) % 4'001 - 2'000) / 4.0f;
+    table->append({a, b, row_idx});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Checks that each row is ordered after its predecessor, where column c (the row index in the input) breaks ties
+  const auto check_order = [](const std::shared_ptr<const Table>& output, const auto& compare) {
+    ASSERT_EQ(output->row_count(), 150'000u);
+    for (auto row_idx = size_t{1}; row_idx < output->row_count(); ++row_idx) {
+      const auto previous_a = output->get_value<int32_t>(ColumnID{0}, row_idx - 1);
+      const auto previous_b = output->get_value<float>(ColumnID{1}, row_idx - 1);
+      const auto a = output->get_value<int32_t>(ColumnID{0}, row_idx);
+      const auto b = output->get_value<float>(ColumnID{1}, row_idx);
+      const auto order = compare(previous_a, previous_b, a, b);
+      ASSERT_TRUE(order < 0 || (order == 0 && output->get_value<int32_t>(ColumnID{2}, row_idx - 1) <
+                                                  output->get_value<int32_t>(ColumnID{2}, row_idx)));
+    }
+  };
+
+  const auto compare_values = [](const auto lhs, const auto rhs) { return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0); };
+
+  auto sort_ascending = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, 10'000);
+  sort_ascending->execute();
+  check_order(sort_ascending->get_output(),
+              [&](const auto previous_a, const auto previous_b, const auto a, const auto b) {
+                return compare_values(previous_a, a);
+              });
+
+  auto sort_descending = std::make_shared<Sort>(table_wrapper, ColumnID{1}, OrderByMode::Descending, 10'000);
+  sort_descending->execute();
+  check_order(sort_descending->get_output(),
+              [&](const auto previous_a, const auto previous_b, const auto a, const auto b) {
+                return compare_values(b, previous_b);
+              });
+
+  auto sort_multiple_columns = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+      10'000);
+  sort_multiple_columns->execute();
+  check_order(sort_multiple_columns->get_output(),
+              [&](const auto previous_a, const auto previous_b, const auto a, const auto b) {
+                const auto order = compare_values(a, previous_a);
+                return order != 0 ? order : compare_values(previous_b, b);
+              });
+}
+
+TEST_P(OperatorsSortTest, SortWithSpilling) {
+  // With a budget of a single byte, each chunk is sorted as a run of its own and spilled to disk
+  const auto arena = std::make_shared<ArenaMemoryResource>(std::make_shared<MemoryBudget>(1));
+
+  auto sort_ascending = std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sort_ascending->set_arena_recursively(arena);
+  sort_ascending->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_ascending->get_output(),
+                          load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2));
+
+  auto sort_descending =
+      std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{0}, OrderByMode::DescendingNullsLast, 2u);
+  sort_descending->set_arena_recursively(arena);
+  sort_descending->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_descending->get_output(),
+                          load_table("resources/test_data/tbl/int_float_null_sorted_desc_nulls_last.tbl", 2));
+
+  // Strings are spilled with their length
+  auto table = load_table("resources/test_data/tbl/string_int_double_with_null.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort_in_memory = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Descending, 2u);
+  sort_in_memory->execute();
+
+  auto sort_spilled = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Descending, 2u);
+  sort_spilled->set_arena_recursively(arena);
+  sort_spilled->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_spilled->get_output(), sort_in_memory->get_output());
+}
+
 }  // namespace opossum
@@ -0,0 +1,114 @@
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan/simd_scan_kernels.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "type_comparison.hpp"
+
+namespace opossum {
+
+template <typename T>
+class TableScanSimdKernelsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Enough values for several blocks and a remainder. The pattern ensures that blocks with varying numbers of
+    // matches are tested.
+    for (auto index = size_t{0}; index < 1'000; ++index) {
+      _values.emplace_back(static_cast<T>((index * 37) % 101));
+    }
+  }
+
+  std::vector<SimdInstructionSet> supported_instruction_sets() const {
+    auto instruction_sets = std::vector<SimdInstructionSet>{SimdInstructionSet::Scalar};
+    for (const auto instruction_set : {SimdInstructionSet::AVX2, SimdInstructionSet::AVX512}) {
+      if (instruction_set <= detect_simd_instruction_set()) instruction_sets.emplace_back(instruction_set);
+    }
+    return instruction_sets;
+  }
+
+  std::vector<T> _values;
+};
+
+using SimdKernelDataTypes = ::testing::Types<int32_t, int64_t, float, double, uint8_t, uint16_t, uint32_t>;
+TYPED_TEST_CASE(TableScanSimdKernelsTest, SimdKernelDataTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(TableScanSimdKernelsTest, MatchesScalarComparison) {
+  const auto predicate_conditions = {PredicateCondition::Equals,        PredicateCondition::NotEquals,
+                                     PredicateCondition::LessThan,      PredicateCondition::LessThanEquals,
+                                     PredicateCondition::GreaterThan,   PredicateCondition::GreaterThanEquals};
+  const auto& values = this->_values;
+
+  for (const auto predicate_condition : predicate_conditions) {
+    for (const auto search_value : {TypeParam{0}, TypeParam{50}, TypeParam{100}, TypeParam{101}}) {
+      // Odd sizes leave a remainder that is not a multiple of the block size
+      for (const auto size : {size_t{0}, size_t{63}, size_t{64}, size_t{1'000}}) {
+        auto expected_matches = PosList{{RowID{ChunkID{3}, ChunkOffset{7}}}};
+        with_comparator(predicate_condition, [&](const auto comparator) {
+          for (auto index = size_t{0}; index < size; ++index) {
+            if (comparator(values[index], search_value)) {
+              expected_matches.emplace_back(ChunkID{5}, static_cast<ChunkOffset>(100 + index));
+            }
+          }
+        });
+
+        for (const auto instruction_set : this->supported_instruction_sets()) {
+          // Existing entries of the PosList must be preserved
+          auto matches = PosList{{RowID{ChunkID{3}, ChunkOffset{7}}}};
+          simd_scan_values(values.data(), size, predicate_condition, search_value, ChunkID{5}, ChunkOffset{100},
+                           matches, instruction_set);
+          EXPECT_EQ(matches, expected_matches);
+        }
+      }
+    }
+  }
+}
+
+TEST(TableScanSimdKernelsFloatTest, NaN) {
+  const auto values = std::vector<float>(100, std::numeric_limits<float>::quiet_NaN());
+
+  auto matches = PosList{};
+  simd_scan_values(values.data(), values.size(), PredicateCondition::NotEquals, 1.0f, ChunkID{0}, ChunkOffset{0},
+                   matches);
+  EXPECT_EQ(matches.size(), 100);
+
+  matches.clear();
+  simd_scan_values(values.data(), values.size(), PredicateCondition::LessThanEquals, 1.0f, ChunkID{0}, ChunkOffset{0},
+                   matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST(TableScanSimdKernelsSimdBp128Test, Range) {
+  // Blocks of 128 values with varying bit sizes, including blocks with only zeros. The last meta block and the last
+  // block are incomplete.
+  auto values = pmr_vector<uint32_t>(5'000);
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    const auto block_index = index / 128;
+    const auto max_value = uint32_t{1} << (block_index % 20);
+    values[index] = block_index % 4 == 0 ? 0 : static_cast<uint32_t>((index * 7919) % max_value);
+  }
+
+  const auto compressed_vector = compress_vector(values, VectorCompressionType::SimdBp128, {});
+  const auto& simd_bp128_vector = static_cast<const SimdBp128Vector&>(*compressed_vector);
+
+  const auto ranges = std::vector<std::pair<uint32_t, uint32_t>>{
+      {0, 1}, {3, 10}, {5, 6}, {0, 1 << 10}, {1'000, 70'000}, {0, std::numeric_limits<uint32_t>::max()}, {7, 7}};
+  for (const auto& [lower_bound, upper_bound] : ranges) {
+    auto expected_matches = PosList{};
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      if (values[index] >= lower_bound && values[index] < upper_bound) {
+        expected_matches.emplace_back(ChunkID{2}, static_cast<ChunkOffset>(index));
+      }
+    }
+
+    auto matches = PosList{};
+    simd_scan_simd_bp128_range(simd_bp128_vector, lower_bound, upper_bound, ChunkID{2}, matches);
+    EXPECT_EQ(matches, expected_matches) << "Range [" << lower_bound << ", " << upper_bound << ")";
+  }
+}
+
+}  // namespace opossum
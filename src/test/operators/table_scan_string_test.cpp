@@ -4,6 +4,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -13,7 +14,9 @@
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -68,7 +71,8 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanStringTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                          EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                          EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                          EncodingType::FrontCodedDictionary, EncodingType::LZ4),
                         formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
@@ -315,4 +319,63 @@ TEST_P(OperatorsTableScanStringTest, ScanNotLikeUnderscoreWildcardOnDict) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_F(OperatorsTableScanStringTest, ScanContainsOnFixedStringDictionary) {
+  // The fixed-width dictionary is searched as a whole, so that hits which span two entries have to be discarded
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data);
+  for (const auto& value : {"ab", "cd", "e", "cd"}) {
+    table->append({pmr_string{value}});
+  }
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::FixedStringDictionary});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_row_counts = std::vector<std::pair<pmr_string, size_t>>{
+      {"%bc%", 0u}, {"%b%", 1u}, {"%d%", 2u}, {"%de%", 0u}, {"%e%", 1u}, {"%cd%", 2u}, {"%abcd%", 0u}};
+  for (const auto& [pattern, expected_row_count] : expected_row_counts) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::Like, pattern);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count) << pattern;
+  }
+}
+
+TEST_F(OperatorsTableScanStringTest, ScanLZ4BlocksUsingMinMax) {
+  // The strings are sorted, so that most blocks of the LZ4 segment are skipped or accepted as a whole
+  const auto create_table = [] {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data);
+    for (auto index = 0; index < 3'000; ++index) {
+      if (index % 100 == 0) {
+        table->append({NullValue{}});
+      } else {
+        table->append({pmr_string{"customer#" + std::to_string(10'000 + index)}});
+      }
+    }
+    return table;
+  };
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(create_table());
+  unencoded_table_wrapper->execute();
+
+  const auto lz4_table = create_table();
+  ChunkEncoder::encode_all_chunks(lz4_table, SegmentEncodingSpec{EncodingType::LZ4});
+  const auto lz4_segment = std::dynamic_pointer_cast<const LZ4Segment<pmr_string>>(
+      lz4_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(lz4_segment);
+  EXPECT_GT(lz4_segment->block_first_rows().size(), 1u);
+  const auto lz4_table_wrapper = std::make_shared<TableWrapper>(lz4_table);
+  lz4_table_wrapper->execute();
+
+  const auto predicate_conditions =
+      std::vector<PredicateCondition>{PredicateCondition::Equals,      PredicateCondition::NotEquals,
+                                      PredicateCondition::LessThan,    PredicateCondition::LessThanEquals,
+                                      PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+  for (const auto predicate_condition : predicate_conditions) {
+    for (const auto& value : {"customer#11500", "customer#11500a", "a", "z"}) {
+      const auto expected = create_table_scan(unencoded_table_wrapper, ColumnID{0}, predicate_condition, value);
+      expected->execute();
+      const auto scan = create_table_scan(lz4_table_wrapper, ColumnID{0}, predicate_condition, value);
+      scan->execute();
+      EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected->get_output());
+    }
+  }
+}
+
 }  // namespace opossum
@@ -17,12 +17,15 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_in_table_scan_impl.hpp"
 #include "operators/table_scan/column_is_null_table_scan_impl.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
+#include "operators/table_scan/logical_expression_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -178,7 +181,7 @@ class OperatorsTableScanTest : public BaseTest, public ::testing::WithParamInter
     const auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
 
     if (references_dict_segment) {
-      ChunkEncoder::encode_all_chunks(table, _encoding_type);
+      ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
     }
 
     auto pos_list_a = std::make_shared<PosList>(
@@ -304,6 +307,23 @@ TEST_P(OperatorsTableScanTest, SingleScanWithSortedSegmentNotEquals) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, ScanOfSortedSegmentKeepsOrder) {
+  auto scan = create_table_scan(get_int_sorted_op(), ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan->execute();
+
+  const auto& output = scan->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->ordered_by(), std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+  }
+
+  // Scanning the output again uses the sortedness of the referenced rows
+  auto scan_2 = create_table_scan(scan, ColumnID{0}, PredicateCondition::LessThan, 3);
+  scan_2->execute();
+  auto scan_expected = create_table_scan(get_int_sorted_op(), ColumnID{0}, PredicateCondition::Equals, 2);
+  scan_expected->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_2->get_output(), scan_expected->get_output());
+}
+
 TEST_P(OperatorsTableScanTest, SingleScanWithSubquery) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 1);
 
@@ -496,7 +516,7 @@ TEST_P(OperatorsTableScanTest, ScanOnReferencedIntValueSegmentWithFloatColumnWit
 
 TEST_P(OperatorsTableScanTest, ScanOnIntCompressedSegmentsWithFloatColumnWithNullValues) {
   auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
-  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
 
   auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
   table_wrapper->execute();
@@ -512,7 +532,7 @@ TEST_P(OperatorsTableScanTest, ScanOnIntCompressedSegmentsWithFloatColumnWithNul
 
 TEST_P(OperatorsTableScanTest, ScanOnReferencedIntCompressedSegmentsWithFloatColumnWithNullValues) {
   auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
-  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
 
   auto table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(table));
   table_wrapper->execute();
@@ -603,7 +623,7 @@ TEST_P(OperatorsTableScanTest, ScanForNullValuesOnValueSegment) {
 
 TEST_P(OperatorsTableScanTest, ScanForNullValuesOnCompressedSegments) {
   auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
-  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
 
   auto table_wrapper = std::make_shared<TableWrapper>(table);
   table_wrapper->execute();
@@ -654,7 +674,7 @@ TEST_P(OperatorsTableScanTest, ScanForNullValuesOnReferencedValueSegment) {
 
 TEST_P(OperatorsTableScanTest, ScanForNullValuesOnReferencedCompressedSegments) {
   auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
-  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
 
   auto table_wrapper = std::make_shared<TableWrapper>(to_referencing_table(table));
   table_wrapper->execute();
@@ -809,6 +829,52 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksUsingParameters) {
+  // int_float.tbl has the chunks {12345, 123} and {1234}. Once the value of the parameter is known, the second chunk
+  // can be pruned using its statistics.
+  const auto table_wrapper = get_int_float_op();
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto predicate = less_than_(column, correlated_parameter_(ParameterID{0}, column));
+
+  const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{200}}});
+  scan->execute();
+
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {123});
+  EXPECT_NE(scan->description(DescriptionMode::SingleLine).find("Pruned chunks: 1"), std::string::npos);
+
+  // Reference tables are not pruned, but the scan still produces the correct result
+  const auto scan_on_references = std::make_shared<TableScan>(scan, predicate->deep_copy());
+  scan_on_references->set_parameters({{ParameterID{0}, AllTypeVariant{124}}});
+  scan_on_references->execute();
+
+  ASSERT_COLUMN_EQ(scan_on_references->get_output(), ColumnID{0}, {123});
+  EXPECT_EQ(scan_on_references->description(DescriptionMode::SingleLine).find("Pruned chunks"), std::string::npos);
+}
+
+TEST_P(OperatorsTableScanTest, ForwardChunksInWhichAllRowsMatch) {
+  // int_float.tbl has the chunks {12345, 123} and {1234}. The statistics prove that all rows of the second chunk match.
+  const auto table_wrapper = get_int_float_op();
+
+  const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1000);
+  scan->execute();
+
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {12345, 1234});
+  const auto& pos_list =
+      *static_cast<const ReferenceSegment&>(*scan->get_output()->get_chunk(ChunkID{1})->get_segment(ColumnID{0}))
+           .pos_list();
+  EXPECT_EQ(pos_list.representation(), PosListRepresentation::ChunkRange);
+
+  // On reference tables, chunks that only reference rows of a single chunk of which all match are passed on as they are
+  const auto scan_on_references = create_table_scan(scan, ColumnID{0}, PredicateCondition::LessThan, 20000);
+  scan_on_references->execute();
+
+  ASSERT_COLUMN_EQ(scan_on_references->get_output(), ColumnID{0}, {12345, 1234});
+  EXPECT_EQ(scan_on_references->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}),
+            scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -831,18 +897,92 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
       TableScan{get_int_string_op(), like_(column_s, "%s%")}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
       TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(
       TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(
+      TableScan{get_int_float_op(), not_in_(column_a, list_(1, 2, 3))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
-      TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+      TableScan{get_int_float_op(), in_(column_a, list_(1, 2.5, 3))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), not_in_(column_a, list_(1, NullValue{}))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<LogicalExpressionTableScanImpl*>(
       TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));
+  const auto nested_predicate = or_(equals_(column_a, 5), and_(greater_than_(column_a, 5), less_than_(column_b, 6)));
+  EXPECT_TRUE(dynamic_cast<LogicalExpressionTableScanImpl*>(
+      TableScan{get_int_float_op(), nested_predicate}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<LogicalExpressionTableScanImpl*>(
+      TableScan{get_int_float_op(), or_(equals_(column_a, 5), in_(column_a, list_(1, 2, 3)))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), or_(equals_(column_a, 5), in_(column_a, list_(1, 2.5)))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
       TableScan{get_int_float_with_null_op(), is_null_(column_an)}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
       TableScan{get_int_float_with_null_op(), is_not_null_(column_an)}.create_impl().get()));
 }
 
+TEST_P(OperatorsTableScanTest, ScanWithLogicalExpressions) {
+  // Conjunctions and disjunctions of predicates with dedicated impls are scanned by the LogicalExpressionTableScanImpl.
+  // Rows for which a predicate is NULL do not match.
+  const auto table_wrapper = load_and_encode_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
+  const auto column_a = get_column_expression(table_wrapper, ColumnID{0});
+  const auto column_b = get_column_expression(table_wrapper, ColumnID{1});
+
+  const auto tests = std::vector<std::pair<std::shared_ptr<AbstractExpression>, std::vector<AllTypeVariant>>>{
+      {or_(less_than_(column_a, 1000), equals_(column_b, 458)), {12345, 123, 1234, 12, 12}},
+      {and_(greater_than_(column_a, 1000), less_than_(column_b, 458)), {12345, 1234}},
+      {or_(and_(greater_than_(column_a, 1000), less_than_(column_b, 458)), is_null_(column_a)),
+       {12345, 1234, NULL_VALUE}},
+      {and_(is_null_(column_b), greater_than_(column_a, 1000)), {}}};
+
+  for (const auto& [predicate, expected] : tests) {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    EXPECT_TRUE(dynamic_cast<LogicalExpressionTableScanImpl*>(scan->create_impl().get()));
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, expected);
+
+    // The same on a reference table
+    const auto not_null_scan = std::make_shared<TableScan>(table_wrapper, is_not_null_(column_a));
+    not_null_scan->execute();
+    const auto reference_scan = std::make_shared<TableScan>(not_null_scan, predicate);
+    reference_scan->execute();
+    auto expected_not_null = expected;
+    expected_not_null.erase(std::remove_if(expected_not_null.begin(), expected_not_null.end(),
+                                           [](const auto& value) { return variant_is_null(value); }),
+                            expected_not_null.end());
+    ASSERT_COLUMN_EQ(reference_scan->get_output(), ColumnID{0}, expected_not_null);
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanWithInList) {
+  const auto table_wrapper = load_and_encode_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 4);
+  const auto column_a = get_column_expression(table_wrapper, ColumnID{0});
+
+  // NULLs in IN lists never match, NULLs in NOT IN lists turn every result into NULL (handled by the
+  // ExpressionEvaluator)
+  const auto tests = std::vector<std::pair<std::shared_ptr<AbstractExpression>, std::vector<AllTypeVariant>>>{
+      {in_(column_a, list_(12, 1234, 99)), {1234, 12, 1234, 12}},
+      {not_in_(column_a, list_(12, 1234)), {12345, 123, 12345}},
+      {in_(column_a, list_(12345, NullValue{})), {12345, 12345}},
+      {not_in_(column_a, list_(12, NullValue{})), {}},
+      {in_(column_a, list_(1, 2)), {}},
+      {not_in_(column_a, list_(1, 2)), {12345, 123, 1234, 12345, 12, 1234, 12}},
+      {in_(column_a, list_(12, 123, 1234, 12345)), {12345, 123, 1234, 12345, 12, 1234, 12}},
+      {not_in_(column_a, list_(12, 123, 1234, 12345)), {}}};
+
+  for (const auto& [predicate, expected] : tests) {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, expected);
+
+    // The same on a reference table, from which the NULLs were removed anyway
+    const auto not_null_scan = std::make_shared<TableScan>(table_wrapper, is_not_null_(column_a));
+    not_null_scan->execute();
+    const auto reference_scan = std::make_shared<TableScan>(not_null_scan, predicate);
+    reference_scan->execute();
+    ASSERT_COLUMN_EQ(reference_scan->get_output(), ColumnID{0}, expected);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, TwoBigScans) {
   // To stress-test the SIMD scan, which only operates on bigger tables, the generated table holds 1'000 rows.
   // For each fifth row, column a is NULL. Otherwise, a is 100'000 + i, b is the index in the list of non-NULL values.
@@ -891,4 +1031,38 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, RowCountHintStopsAfterEnoughMatches) {
+  // One row per chunk, so that every scanned chunk produces one match
+  const auto batch_size = std::max(size_t{1}, Topology::get().num_cpus());
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{1});
+  for (auto row_id = size_t{0}; row_id < 4 * batch_size; ++row_id) {
+    table->append({static_cast<int32_t>(row_id)});
+  }
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The first batch holds one chunk per CPU
+  const auto scan_a = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan_a->set_row_count_hint(1);
+  scan_a->execute();
+  EXPECT_EQ(scan_a->get_output()->row_count(), batch_size);
+  EXPECT_EQ(scan_a->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 0);
+
+  // The second batch is twice as large
+  const auto scan_b = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan_b->set_row_count_hint(batch_size + 1);
+  scan_b->execute();
+  EXPECT_EQ(scan_b->get_output()->row_count(), 3 * batch_size);
+
+  // Without matches, all chunks are scanned
+  const auto scan_c = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 0);
+  scan_c->set_row_count_hint(1);
+  scan_c->execute();
+  EXPECT_EQ(scan_c->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan_c->get_output()->column_count(), 1u);
+}
+
 }  // namespace opossum
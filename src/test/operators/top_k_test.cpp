@@ -0,0 +1,115 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+    _table_wrapper->execute();
+
+    _table_wrapper_null =
+        std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/string_int_double_with_null.tbl", 2));
+    _table_wrapper_null->execute();
+  }
+
+  // TopK has to produce exactly the same rows in the same order as a (stable) Sort followed by a Limit
+  void _test_against_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                    const std::vector<SortColumnDefinition>& sort_definitions, const int64_t k) {
+    auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, value_(k));
+    limit->execute();
+
+    auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(k));
+    top_k->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_null;
+};
+
+TEST_F(OperatorsTopKTest, Description) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{3}));
+  EXPECT_EQ(top_k->name(), "TopK");
+  EXPECT_EQ(top_k->sort_definitions().size(), 1u);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{3}));
+}
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  for (const auto k : {int64_t{1}, int64_t{2}, int64_t{3}, int64_t{5}}) {
+    _test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, k);
+    _test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}}, k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  for (const auto k : {int64_t{1}, int64_t{3}, int64_t{4}}) {
+    _test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                                  SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+                                 k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, TiesAreResolvedStably) {
+  // Many rows share the same value in column a. Only the input order decides which of them are part of the result.
+  for (const auto k : {int64_t{1}, int64_t{2}, int64_t{3}, int64_t{4}, int64_t{5}, int64_t{6}}) {
+    _test_against_sort_and_limit(_table_wrapper_null, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, NullsFirstAndLast) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    _test_against_sort_and_limit(_table_wrapper_null,
+                                 {SortColumnDefinition{ColumnID{1}, order_by_mode},
+                                  SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}},
+                                 int64_t{3});
+  }
+}
+
+TEST_F(OperatorsTopKTest, EncodedInput) {
+  auto table = load_table("resources/test_data/tbl/string_int_double_with_null.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  _test_against_sort_and_limit(table_wrapper, {SortColumnDefinition{ColumnID{2}, OrderByMode::Descending},
+                                               SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast}},
+                               int64_t{4});
+}
+
+TEST_F(OperatorsTopKTest, KIsZero) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{0}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_count(), _table_wrapper->get_output()->column_count());
+}
+
+TEST_F(OperatorsTopKTest, KExceedsRowCount) {
+  const auto row_count = static_cast<int64_t>(_table_wrapper->get_output()->row_count());
+  _test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}},
+                               row_count + 10);
+}
+
+}  // namespace opossum
@@ -146,6 +146,47 @@ TEST_F(UnionPositionsTest, SelfUnionOverlappingRangesMultipleSegments) {
                             load_table("resources/test_data/tbl/int_float4_overlapping_ranges.tbl"));
 }
 
+TEST_F(UnionPositionsTest, SingleColumnClusterWithNullRowIDs) {
+  /**
+   * Both inputs reference only int_float4 (3 rows per chunk) with a single PosList, so that the union is computed with
+   * bitmaps. The output is sorted by RowID and contains one chunk per referenced chunk. NULL_ROW_IDs are emitted as
+   * often as they appear in the input containing more of them.
+   */
+  const auto make_table = [&](const std::vector<std::vector<RowID>>& pos_lists) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::Float, true);
+    auto table = std::make_shared<Table>(column_definitions, TableType::References);
+    for (const auto& pos_list : pos_lists) {
+      const auto shared_pos_list = std::make_shared<PosList>(pos_list.begin(), pos_list.end());
+      const auto segment_a = std::make_shared<ReferenceSegment>(_table_int_float4, ColumnID{0}, shared_pos_list);
+      const auto segment_b = std::make_shared<ReferenceSegment>(_table_int_float4, ColumnID{1}, shared_pos_list);
+      table->append_chunk(Segments({segment_a, segment_b}));
+    }
+    return table;
+  };
+
+  const auto table_left =
+      make_table({{RowID{ChunkID{2}, 0}, RowID{ChunkID{0}, 2}, NULL_ROW_ID, NULL_ROW_ID}, {RowID{ChunkID{0}, 1}}});
+  const auto table_right = make_table({{RowID{ChunkID{0}, 2}, NULL_ROW_ID, RowID{ChunkID{0}, 2}}});
+
+  auto table_wrapper_left_op = std::make_shared<TableWrapper>(table_left);
+  auto table_wrapper_right_op = std::make_shared<TableWrapper>(table_right);
+  auto union_positions_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op);
+  _execute_all({table_wrapper_left_op, table_wrapper_right_op, union_positions_op});
+
+  const auto& output = union_positions_op->get_output();
+  ASSERT_EQ(output->chunk_count(), 3u);
+
+  const auto get_pos_list = [&](const ChunkID chunk_id) {
+    const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{1});
+    return std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  };
+  EXPECT_EQ(*get_pos_list(ChunkID{0}), PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(*get_pos_list(ChunkID{1}), PosList({RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(*get_pos_list(ChunkID{2}), PosList({NULL_ROW_ID, NULL_ROW_ID}));
+}
+
 TEST_F(UnionPositionsTest, MultipleReferencedTables) {
   /**
    * Join int_float4 and int_int on their respective "a" column. Scan the result once for int_int.b >= 2 and for
@@ -9,8 +9,10 @@
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -82,4 +84,95 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, UpdateOwnInsertInPlace) {
+  const auto table_to_update = StorageManager::get().get_table(table_to_update_name);
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto values_to_insert = std::make_shared<Table>(table_to_update->column_definitions(), TableType::Data);
+  values_to_insert->append({1, 1.5f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>(table_to_update_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  const auto where_scan = std::make_shared<TableScan>(validate, equals_(column_a, 1));
+  const auto updated_values_projection = std::make_shared<Projection>(where_scan, expression_vector(column_a, 2.5f));
+  get_table->execute();
+  validate->execute();
+  where_scan->execute();
+  updated_values_projection->execute();
+
+  const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+  transaction_context->commit();
+
+  // The row was not visible to other transactions, so it was overwritten instead of being inserted again
+  EXPECT_EQ(table_to_update->row_count(), 5u);
+
+  const auto expected_table = load_table("resources/test_data/tbl/int_float2.tbl");
+  expected_table->append({1, 2.5f});
+
+  const auto post_update_get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto post_update_validate = std::make_shared<Validate>(post_update_get_table);
+  post_update_validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  post_update_get_table->execute();
+  post_update_validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(post_update_validate->get_output(), expected_table);
+}
+
+TEST_F(OperatorsUpdateTest, UpdateOwnInsertInPlaceFromNull) {
+  const auto nullable_table_name = std::string{"updateTestTableNullable"};
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Float, true);
+  const auto table_to_update = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  StorageManager::get().add_table(nullable_table_name, table_to_update);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({1, NULL_VALUE});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>(nullable_table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  const auto nullable_column_b = pqp_column_(ColumnID{1}, DataType::Float, true, "b");
+  const auto get_table = std::make_shared<GetTable>(nullable_table_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  const auto where_scan = std::make_shared<TableScan>(validate, is_null_(nullable_column_b));
+  const auto updated_values_projection = std::make_shared<Projection>(where_scan, expression_vector(column_a, 2.5f));
+  get_table->execute();
+  validate->execute();
+  where_scan->execute();
+  updated_values_projection->execute();
+
+  const auto update = std::make_shared<Update>(nullable_table_name, where_scan, updated_values_projection);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+  transaction_context->commit();
+
+  // The row was overwritten, including its NULL flag
+  EXPECT_EQ(table_to_update->row_count(), 1u);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({1, 2.5f});
+
+  const auto post_update_get_table = std::make_shared<GetTable>(nullable_table_name);
+  const auto post_update_validate = std::make_shared<Validate>(post_update_get_table);
+  post_update_validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  post_update_get_table->execute();
+  post_update_validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(post_update_validate->get_output(), expected_table);
+}
+
 }  // namespace opossum
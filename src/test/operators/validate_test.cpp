@@ -13,6 +13,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -122,4 +123,102 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateKeepsOrderAcrossBlocksAndChunks) {
+  // Visibility is evaluated in blocks of rows and the rows of a PosList referencing multiple chunks are grouped by
+  // chunk. Use chunks that are larger than a block and a PosList that alternates between them in reverse order.
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{150}, UseMvcc::Yes);
+  for (auto value = 0; value < 300; ++value) {
+    table->append({value});
+  }
+  set_all_records_visible(*table);
+
+  // Every third row was deleted, every fifth row was inserted after the snapshot
+  for (auto value = 0; value < 300; ++value) {
+    const auto row_id = RowID{ChunkID{static_cast<uint32_t>(value / 150)}, static_cast<ChunkOffset>(value % 150)};
+    auto mvcc_data = table->get_chunk(row_id.chunk_id)->get_scoped_mvcc_data_lock();
+    if (value % 3 == 0) mvcc_data->end_cids[row_id.chunk_offset] = 2u;
+    if (value % 5 == 0) mvcc_data->begin_cids[row_id.chunk_offset] = 4u;
+  }
+
+  auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{150}; chunk_offset > 0; --chunk_offset) {
+    pos_list->emplace_back(ChunkID{1}, chunk_offset - 1);
+    pos_list->emplace_back(ChunkID{0}, chunk_offset - 1);
+  }
+
+  auto reference_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  reference_table->append_chunk({std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  auto expected_result = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  for (auto chunk_offset = 149; chunk_offset >= 0; --chunk_offset) {
+    for (const auto value : {150 + chunk_offset, chunk_offset}) {
+      if (value % 3 != 0 && value % 5 != 0) expected_result->append({value});
+    }
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(validate->get_output(), expected_result);
+
+  // The same rows are visible when validating the data table directly
+  auto data_table_wrapper = std::make_shared<TableWrapper>(table);
+  data_table_wrapper->execute();
+
+  auto data_validate = std::make_shared<Validate>(data_table_wrapper);
+  data_validate->set_transaction_context(context);
+  data_validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(data_validate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsValidateTest, EntireChunkVisible) {
+  const auto chunk = _test_table->get_chunk(ChunkID{0});
+  chunk->get_scoped_mvcc_data_lock()->begin_cids[1] = 2u;
+
+  // Mutable chunks might still receive rows and are always validated row by row
+  EXPECT_FALSE(Validate::is_entire_chunk_visible(*chunk, 3u));
+
+  ChunkEncoder::encode_all_chunks(_test_table);
+  EXPECT_FALSE(Validate::is_entire_chunk_visible(*chunk, 1u));
+  EXPECT_TRUE(Validate::is_entire_chunk_visible(*chunk, 2u));
+
+  chunk->get_scoped_mvcc_data_lock()->has_invalidated_rows = true;
+  EXPECT_FALSE(Validate::is_entire_chunk_visible(*chunk, 3u));
+}
+
+TEST_F(OperatorsValidateTest, ForwardEntirelyVisibleChunks) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  const auto table = load_table("resources/test_data/tbl/validate_input.tbl", 2u);
+  ChunkEncoder::encode_all_chunks(table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto a = PQPColumnExpression::from_table(*table, "a");
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 4));
+  table_scan->execute();
+
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), table_scan->get_output());
+
+  // The chunks only reference visible rows and are forwarded without building new PosLists
+  ASSERT_EQ(validate->get_output()->chunk_count(), table_scan->get_output()->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < validate->get_output()->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(validate->get_output()->get_chunk(chunk_id)->get_segment(ColumnID{0}),
+              table_scan->get_output()->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,133 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsWindowTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("p", DataType::Int);
+    column_definitions.emplace_back("o", DataType::Int);
+    column_definitions.emplace_back("v", DataType::Int, true);
+
+    // Partition p = 1 is ordered (by o and then by input position) as rows 2, 3, 0, 5, partition p = 2 as rows 1, 4
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    table->append({1, 3, 10});
+    table->append({2, 1, 5});
+    table->append({1, 1, NULL_VALUE});
+    table->append({1, 1, 30});
+    table->append({2, 1, 7});
+    table->append({1, 3, 20});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  WindowFunctionDefinition _definition(const WindowFunction window_function, const std::optional<ColumnID> argument,
+                                       const WindowFrame& frame = {}) {
+    return WindowFunctionDefinition{window_function,
+                                    argument,
+                                    {ColumnID{0}},
+                                    {SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+                                    frame,
+                                    "w"};
+  }
+
+  template <typename T>
+  std::vector<std::optional<T>> _execute(const std::shared_ptr<AbstractOperator>& input,
+                                         const WindowFunctionDefinition& definition) {
+    const auto window = std::make_shared<Window>(input, std::vector<WindowFunctionDefinition>{definition});
+    window->execute();
+
+    const auto& output = window->get_output();
+    EXPECT_EQ(output->column_count(), 4u);
+
+    auto values = std::vector<std::optional<T>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto& segment = *output->get_chunk(chunk_id)->get_segment(ColumnID{3});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        const auto value = segment[chunk_offset];
+        values.emplace_back(variant_is_null(value) ? std::nullopt : std::optional<T>{get<T>(value)});
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsWindowTest, Description) {
+  const auto window = std::make_shared<Window>(
+      _table_wrapper, std::vector<WindowFunctionDefinition>{_definition(WindowFunction::RowNumber, std::nullopt)});
+  EXPECT_EQ(window->name(), "Window");
+  EXPECT_EQ(window->description(DescriptionMode::SingleLine), "[Window] w");
+}
+
+TEST_F(OperatorsWindowTest, RankingFunctions) {
+  using Values = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(_execute<int64_t>(_table_wrapper, _definition(WindowFunction::RowNumber, std::nullopt)),
+            (Values{3, 1, 1, 2, 2, 4}));
+  EXPECT_EQ(_execute<int64_t>(_table_wrapper, _definition(WindowFunction::Rank, std::nullopt)),
+            (Values{3, 1, 1, 1, 1, 3}));
+  EXPECT_EQ(_execute<int64_t>(_table_wrapper, _definition(WindowFunction::DenseRank, std::nullopt)),
+            (Values{2, 1, 1, 1, 1, 2}));
+}
+
+TEST_F(OperatorsWindowTest, RunningSum) {
+  // The default frame includes the peers of the current row
+  EXPECT_EQ(_execute<int64_t>(_table_wrapper, _definition(WindowFunction::Sum, ColumnID{2})),
+            (std::vector<std::optional<int64_t>>{60, 12, 30, 30, 12, 60}));
+}
+
+TEST_F(OperatorsWindowTest, SlidingFrames) {
+  const auto preceding_frame = WindowFrame{WindowFrameType::Rows, 1, 0};
+  EXPECT_EQ(_execute<int64_t>(_table_wrapper, _definition(WindowFunction::Sum, ColumnID{2}, preceding_frame)),
+            (std::vector<std::optional<int64_t>>{40, 5, std::nullopt, 30, 12, 30}));
+
+  const auto centered_frame = WindowFrame{WindowFrameType::Rows, 1, 1};
+  EXPECT_EQ(_execute<int32_t>(_table_wrapper, _definition(WindowFunction::Min, ColumnID{2}, centered_frame)),
+            (std::vector<std::optional<int32_t>>{10, 5, 30, 10, 5, 10}));
+}
+
+TEST_F(OperatorsWindowTest, EntirePartition) {
+  // Without ORDER BY, all rows of a partition are peers
+  auto count_definition = _definition(WindowFunction::Count, std::nullopt);
+  count_definition.order_by_definitions.clear();
+  EXPECT_EQ(_execute<int64_t>(_table_wrapper, count_definition),
+            (std::vector<std::optional<int64_t>>{4, 2, 4, 4, 2, 4}));
+
+  auto average_definition = _definition(WindowFunction::Avg, ColumnID{2});
+  average_definition.partition_by_column_ids.clear();
+  average_definition.order_by_definitions.clear();
+  const auto averages = _execute<double>(_table_wrapper, average_definition);
+  ASSERT_EQ(averages.size(), 6u);
+  for (const auto& average : averages) {
+    ASSERT_TRUE(average);
+    EXPECT_DOUBLE_EQ(*average, 14.4);
+  }
+}
+
+TEST_F(OperatorsWindowTest, ReferenceInput) {
+  const auto v = pqp_column_(ColumnID{2}, DataType::Int, true, "v");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_equals_(v, 7));
+  table_scan->execute();
+
+  // Rows 0, 3, 4, and 5 remain
+  EXPECT_EQ(_execute<int64_t>(table_scan, _definition(WindowFunction::RowNumber, std::nullopt)),
+            (std::vector<std::optional<int64_t>>{2, 1, 1, 3}));
+}
+
+}  // namespace opossum
@@ -97,6 +97,22 @@ TEST_F(DpCcpTest, JoinOrdering) {
   EXPECT_LQP_EQ(expected_lqp, actual_lqp);
 }
 
+TEST_F(DpCcpTest, MaxCsgCmpPairCount) {
+  /**
+   * Test that DpCcp gives up on JoinGraphs with more CsgCmpPairs than allowed. The triangle below has six of them.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+
+  EXPECT_FALSE(DpCcp(cost_estimator, 5)(join_graph));
+  EXPECT_TRUE(DpCcp(cost_estimator, 6)(join_graph));
+}
+
 TEST_F(DpCcpTest, CrossJoin) {
   /**
    * Test that if there is a non-predicated edge, a cross join is created
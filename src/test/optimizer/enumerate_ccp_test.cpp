@@ -120,6 +120,30 @@ TEST(EnumerateCcpTest, Clique) {
   EXPECT_TRUE(equals(pairs[24], std::make_pair(0b1101ul, 0b0010ul)));
 }
 
+TEST(EnumerateCcpTest, MaxCsgCmpPairCount) {
+  std::vector<std::pair<size_t, size_t>> edges{{0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 3}, {1, 3}};
+
+  // The clique has exactly 25 CsgCmpPairs, see above
+  auto enumerate_ccp = EnumerateCcp{4, edges, 25};
+  EXPECT_EQ(enumerate_ccp().size(), 25u);
+  EXPECT_FALSE(enumerate_ccp.exceeded_max_csg_cmp_pair_count());
+
+  auto limited_enumerate_ccp = EnumerateCcp{4, edges, 24};
+  EXPECT_TRUE(limited_enumerate_ccp().empty());
+  EXPECT_TRUE(limited_enumerate_ccp.exceeded_max_csg_cmp_pair_count());
+
+  // A clique of 40 vertices has more than 10^18 CsgCmpPairs, the enumeration needs to stop right away
+  std::vector<std::pair<size_t, size_t>> large_clique_edges;
+  for (auto vertex_idx = size_t{0}; vertex_idx < 40; ++vertex_idx) {
+    for (auto other_vertex_idx = vertex_idx + 1; other_vertex_idx < 40; ++other_vertex_idx) {
+      large_clique_edges.emplace_back(vertex_idx, other_vertex_idx);
+    }
+  }
+  auto large_clique_enumerate_ccp = EnumerateCcp{40, large_clique_edges, 1'000};
+  EXPECT_TRUE(large_clique_enumerate_ccp().empty());
+  EXPECT_TRUE(large_clique_enumerate_ccp.exceeded_max_csg_cmp_pair_count());
+}
+
 TEST(EnumerateCcpTest, RandomJoinGraphShape) {
   /**
    *    0
@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LinearizedDpTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    cost_estimator = std::make_shared<CostModelLogical>();
+
+    const auto column_statistics_a_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 50);
+    const auto column_statistics_b_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 40, 100);
+    const auto column_statistics_c_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 100);
+
+    const auto table_statistics_a = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_a_a});
+    const auto table_statistics_b = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_b_a});
+    const auto table_statistics_c = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_c_a});
+
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "a");
+    node_a->set_statistics(table_statistics_a);
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "b");
+    node_b->set_statistics(table_statistics_b);
+    node_c = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "c");
+    node_c->set_statistics(table_statistics_c);
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+    c_a = node_c->get_column("a");
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  LQPColumnReference a_a, b_a, c_a;
+};
+
+TEST_F(LinearizedDpTest, JoinOrdering) {
+  /**
+   * Same JoinGraph as in DpCcpTest.JoinOrdering: Joining A and B first is the best option. The linearization starts
+   * with A and appends B, as their join has the lowest cardinality, so LinearizedDp finds the optimal plan, too.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+  LinearizedDp linearized_dp{cost_estimator};
+
+  const auto actual_lqp = linearized_dp(join_graph);
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(equals_(b_a, c_a),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, c_a),
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        node_a,
+        node_b),
+      node_c));
+  // clang-format on
+
+  EXPECT_LQP_EQ(expected_lqp, actual_lqp);
+}
+
+TEST_F(LinearizedDpTest, LocalAndUncorrelatedPredicates) {
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{2, 0b11}, expression_vector(equals_(a_a, b_a))};
+  const auto self_edge_b = JoinGraphEdge{JoinGraphVertexSet{2, 0b10}, expression_vector(greater_than_(b_a, 5))};
+  const auto uncorrelated_edge = JoinGraphEdge{JoinGraphVertexSet{2, 0b00}, expression_vector(greater_than_(6, 4))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, self_edge_b, uncorrelated_edge}));
+  LinearizedDp linearized_dp{cost_estimator};
+
+  const auto actual_lqp = linearized_dp(join_graph);
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(greater_than_(6, 4),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      node_a,
+      PredicateNode::make(greater_than_(b_a, 5),
+        node_b)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(expected_lqp, actual_lqp);
+}
+
+TEST_F(LinearizedDpTest, DisconnectedJoinGraph) {
+  // Vertex C could only be joined using a cross product, which LinearizedDp doesn't consider
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b}));
+  LinearizedDp linearized_dp{cost_estimator};
+
+  EXPECT_FALSE(linearized_dp(join_graph));
+}
+
+}  // namespace opossum
@@ -169,4 +169,30 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   EXPECT_LQP_EQ(subquery_b_a->lqp, subquery_lqp_b);
 }
 
+TEST_F(OptimizerTest, ReportsRuleMetrics) {
+  class MockRule : public AbstractRule {
+   public:
+    explicit MockRule(const std::string& name) : _name(name) {}
+    std::string name() const override { return _name; }
+
+    void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {}
+
+   private:
+    const std::string _name;
+  };
+
+  Optimizer optimizer{};
+  optimizer.add_rule(std::make_unique<MockRule>("RuleA"));
+  optimizer.add_rule(std::make_unique<MockRule>("RuleB"));
+
+  auto rule_metrics = std::vector<OptimizerRuleMetrics>{};
+  optimizer.optimize(PredicateNode::make(greater_than_(a, subquery_a), node_a), &rule_metrics);
+
+  // One entry per rule, the time spent in subqueries is included
+  ASSERT_EQ(rule_metrics.size(), 2u);
+  EXPECT_EQ(rule_metrics[0].rule_name, "RuleA");
+  EXPECT_EQ(rule_metrics[1].rule_name, "RuleB");
+  EXPECT_GE(rule_metrics[0].duration.count(), 0);
+}
+
 }  // namespace opossum
@@ -22,6 +22,7 @@
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table_partitioning.hpp"
 
 #include "utils/assert.hpp"
 
@@ -85,6 +86,37 @@ TEST_F(ChunkPruningTest, BetweenPruningTest) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, InListPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  // Chunks are pruned if they contain no value between the smallest and the largest list value
+  auto predicate_node = std::make_shared<PredicateNode>(
+      in_(LQPColumnReference(stored_table_node, ColumnID{0}), list_(200, 100, NullValue{})));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected = {ChunkID{0}};
+  std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+  EXPECT_EQ(excluded, expected);
+}
+
+TEST_F(ChunkPruningTest, InListSpanningAllChunksPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  auto predicate_node = std::make_shared<PredicateNode>(
+      in_(LQPColumnReference(stored_table_node, ColumnID{0}), list_(1, 20'000)));
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  std::vector<ChunkID> expected = {};
+  std::vector<ChunkID> excluded = stored_table_node->excluded_chunk_ids();
+  EXPECT_EQ(excluded, expected);
+}
+
 TEST_F(ChunkPruningTest, NoStatisticsAvailable) {
   auto table = StorageManager::get().get_table("uncompressed");
   auto chunk = table->get_chunk(ChunkID(0));
@@ -299,4 +331,30 @@ TEST_F(ChunkPruningTest, PrunePastNonFilteringNodes) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, PartitionPruning) {
+  // The chunks of partitions 0, 1, and 2 hold the values below 10, from 10 to 19, and from 20 on
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  table->set_partitioning(TablePartitioning::create_range_partitioning(ColumnID{0}, DataType::Int, {10, 20}));
+  for (const auto value : {1, 12, 25, 2, 13, 26}) table->append({value});
+  StorageManager::get().add_table("partitioned", table);
+
+  const auto test_pruning = [&](const std::shared_ptr<AbstractExpression>& predicate,
+                                const std::shared_ptr<StoredTableNode>& stored_table_node,
+                                const std::vector<ChunkID>& expected) {
+    const auto predicate_node = std::make_shared<PredicateNode>(predicate);
+    predicate_node->set_left_input(stored_table_node);
+
+    StrategyBaseTest::apply_rule(_rule, predicate_node);
+    EXPECT_EQ(stored_table_node->excluded_chunk_ids(), expected);
+  };
+
+  auto stored_table_node = std::make_shared<StoredTableNode>("partitioned");
+  auto a = LQPColumnReference(stored_table_node, ColumnID{0});
+  test_pruning(less_than_(a, 12), stored_table_node, {ChunkID{2}});
+
+  stored_table_node = std::make_shared<StoredTableNode>("partitioned");
+  a = LQPColumnReference(stored_table_node, ColumnID{0});
+  test_pruning(in_(a, list_(1, 26)), stored_table_node, {ChunkID{1}});
+}
+
 }  // namespace opossum
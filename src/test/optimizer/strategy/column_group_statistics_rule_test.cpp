@@ -0,0 +1,92 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/column_group_statistics_rule.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ColumnGroupStatisticsRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("int_int_int", load_table("resources/test_data/tbl/int_int_int.tbl", 2));
+    StorageManager::get().add_table("int_int", load_table("resources/test_data/tbl/int_int.tbl", 2));
+
+    node_a = StoredTableNode::make("int_int_int");
+    a_a = node_a->get_column("a");
+    a_b = node_a->get_column("b");
+    a_c = node_a->get_column("c");
+
+    node_b = StoredTableNode::make("int_int");
+    b_a = node_b->get_column("a");
+    b_b = node_b->get_column("b");
+
+    rule = std::make_shared<ColumnGroupStatisticsRule>();
+  }
+
+  static const std::vector<TableStatistics::ColumnGroup>& column_groups(const std::string& table_name) {
+    return StorageManager::get().get_table(table_name)->table_statistics()->column_groups();
+  }
+
+  std::shared_ptr<StoredTableNode> node_a, node_b;
+  LQPColumnReference a_a, a_b, a_c, b_a, b_b;
+  std::shared_ptr<ColumnGroupStatisticsRule> rule;
+};
+
+TEST_F(ColumnGroupStatisticsRuleTest, PredicatesOnSameTable) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a_c, 5),
+    PredicateNode::make(less_than_(a_a, 3),
+      node_a));
+  // clang-format on
+
+  apply_rule(rule, lqp);
+
+  ASSERT_EQ(column_groups("int_int_int").size(), 1u);
+  EXPECT_EQ(column_groups("int_int_int").at(0).column_ids, ColumnIDPair(ColumnID{0}, ColumnID{2}));
+
+  // The statistics are generated only once
+  apply_rule(rule, lqp);
+  EXPECT_EQ(column_groups("int_int_int").size(), 1u);
+}
+
+TEST_F(ColumnGroupStatisticsRuleTest, JoinOnTwoColumns) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(a_b, b_b),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      node_a,
+      node_b));
+  // clang-format on
+
+  apply_rule(rule, lqp);
+
+  ASSERT_EQ(column_groups("int_int_int").size(), 1u);
+  EXPECT_EQ(column_groups("int_int_int").at(0).column_ids, ColumnIDPair(ColumnID{0}, ColumnID{1}));
+  ASSERT_EQ(column_groups("int_int").size(), 1u);
+  EXPECT_EQ(column_groups("int_int").at(0).column_ids, ColumnIDPair(ColumnID{0}, ColumnID{1}));
+}
+
+TEST_F(ColumnGroupStatisticsRuleTest, SingleColumn) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a_a, 5),
+    PredicateNode::make(less_than_(a_a, 30),
+      node_a));
+  // clang-format on
+
+  apply_rule(rule, lqp);
+
+  EXPECT_TRUE(column_groups("int_int_int").empty());
+}
+
+}  // namespace opossum
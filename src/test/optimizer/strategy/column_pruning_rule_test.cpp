@@ -63,8 +63,9 @@ TEST_F(ColumnPruningRuleTest, NoUnion) {
       JoinNode::make(JoinMode::Inner, greater_than_(v, a),
         ProjectionNode::make(expression_vector(a, c),
           node_a),
-        SortNode::make(expression_vector(w), std::vector<OrderByMode>{OrderByMode::Ascending},  // NOLINT
-          node_b))));
+        ProjectionNode::make(expression_vector(u, v),
+          SortNode::make(expression_vector(w), std::vector<OrderByMode>{OrderByMode::Ascending},  // NOLINT
+            node_b)))));
   // clang-format on
 
   const auto actual_lqp = apply_rule(rule, lqp);
@@ -125,6 +126,103 @@ TEST_F(ColumnPruningRuleTest, WithMultipleProjections) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(ColumnPruningRuleTest, PruneColumnsUsedOnlyBelowJoin) {
+  // b is needed by the predicate below the join, but not by the join or above it
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a, u),
+    JoinNode::make(JoinMode::Inner, equals_(a, u),
+      PredicateNode::make(greater_than_(b, 5),
+        node_a),
+      node_b));
+  // clang-format on
+
+  // clang-format off
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a, u),
+    JoinNode::make(JoinMode::Inner, equals_(a, u),
+      ProjectionNode::make(expression_vector(a),
+        PredicateNode::make(greater_than_(b, 5),
+          ProjectionNode::make(expression_vector(a, b),
+            node_a))),
+      ProjectionNode::make(expression_vector(u),
+        node_b)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ColumnPruningRuleTest, NarrowProjectionBelowJoin) {
+  // The ProjectionNode below the join is narrowed instead of inserting another one. b is only needed to compute b + 1,
+  // which itself is kept, as only columns are pruned below joins.
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a, u),
+    JoinNode::make(JoinMode::Inner, equals_(a, u),
+      ProjectionNode::make(expression_vector(a, b, add_(b, 1)),
+        node_a),
+      node_b));
+  // clang-format on
+
+  // clang-format off
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a, u),
+    JoinNode::make(JoinMode::Inner, equals_(a, u),
+      ProjectionNode::make(expression_vector(a, add_(b, 1)),
+        ProjectionNode::make(expression_vector(a, b),
+          node_a)),
+      ProjectionNode::make(expression_vector(u),
+        node_b)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(ColumnPruningRuleTest, DoNotPruneBelowJoinsInUnion) {
+  // The inputs of a UnionNode need to have the same columns, so the join in one of them is not pruned
+
+  // clang-format off
+  const auto join_node =
+  JoinNode::make(JoinMode::Semi, equals_(a, u),
+    PredicateNode::make(greater_than_(b, 5),
+      node_a),
+    node_b);
+
+  const auto lqp =
+  ProjectionNode::make(expression_vector(a),
+    UnionNode::make(UnionMode::Positions,
+      join_node,
+      PredicateNode::make(greater_than_(c, 5),
+        join_node)));
+  // clang-format on
+
+  // clang-format off
+  const auto expected_join_node =
+  JoinNode::make(JoinMode::Semi, equals_(a, u),
+    PredicateNode::make(greater_than_(b, 5),
+      node_a),
+    ProjectionNode::make(expression_vector(u),
+      node_b));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a),
+    UnionNode::make(UnionMode::Positions,
+      expected_join_node,
+      PredicateNode::make(greater_than_(c, 5),
+        expected_join_node)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(ColumnPruningRuleTest, DoNotPruneUpdateInputs) {
   // Do not prune away input columns to Update, Update needs them all
 
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/strategy/common_subexpression_elimination_rule.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CommonSubexpressionEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{
+        {DataType::Float, "price"}, {DataType::Float, "discount"}, {DataType::Float, "tax"}, {DataType::Int, "flag"}});
+
+    price = node->get_column("price");
+    discount = node->get_column("discount");
+    tax = node->get_column("tax");
+    flag = node->get_column("flag");
+
+    rule = std::make_shared<CommonSubexpressionEliminationRule>();
+  }
+
+  std::shared_ptr<CommonSubexpressionEliminationRule> rule;
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference price, discount, tax, flag;
+};
+
+TEST_F(CommonSubexpressionEliminationRuleTest, TPCHQ1Aggregates) {
+  const auto disc_price = mul_(price, sub_(1, discount));
+
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(flag), expression_vector(sum_(disc_price), sum_(mul_(disc_price, add_(1, tax)))),  // NOLINT
+    ProjectionNode::make(expression_vector(flag, disc_price, mul_(disc_price, add_(1, tax))),
+      node));
+
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(flag), expression_vector(sum_(disc_price), sum_(mul_(disc_price, add_(1, tax)))),  // NOLINT
+    ProjectionNode::make(expression_vector(flag, disc_price, mul_(disc_price, add_(1, tax))),
+      ProjectionNode::make(expression_vector(price, discount, tax, flag, disc_price),
+        node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, NestedCommonSubexpressions) {
+  const auto sum = add_(price, tax);
+
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(sum, 1), add_(sum, 1), mul_(sum, 2), mul_(sum, 2)),
+    node);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(add_(sum, 1), add_(sum, 1), mul_(sum, 2), mul_(sum, 2)),
+    ProjectionNode::make(expression_vector(price, tax, add_(sum, 1), sum, mul_(sum, 2)),
+      ProjectionNode::make(expression_vector(price, tax, sum),
+        node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, NoCommonSubexpressions) {
+  // Columns and values are not computed, so they are no common subexpressions
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(price, 1), mul_(price, 1), flag, flag),
+    node);
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, InputColumnsAreNoCommonSubexpressions) {
+  const auto disc_price = mul_(price, sub_(1, discount));
+
+  // disc_price is computed by the lower ProjectionNode already
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(disc_price, 1), sub_(disc_price, 1)),
+    ProjectionNode::make(expression_vector(disc_price),
+      node));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
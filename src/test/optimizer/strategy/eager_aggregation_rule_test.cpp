@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "optimizer/strategy/eager_aggregation_rule.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class EagerAggregationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // A fact table with one million rows referencing 100 dimension rows
+    fact_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "d_id"}, {DataType::Int, "revenue"}}, "f");
+    fact_node->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 1'000'000,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 1, 100),
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 1, 1'000)}));
+
+    dimension_node =
+        MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "id"}, {DataType::Int, "category"}}, "d");
+    dimension_node->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 100,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 1, 100),
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 1, 10)}));
+
+    f_d_id = fact_node->get_column("d_id");
+    f_revenue = fact_node->get_column("revenue");
+    d_id = dimension_node->get_column("id");
+    d_category = dimension_node->get_column("category");
+
+    rule = std::make_shared<EagerAggregationRule>(std::make_shared<CostModelLogical>());
+  }
+
+  std::shared_ptr<MockNode> fact_node, dimension_node;
+  LQPColumnReference f_d_id, f_revenue, d_id, d_category;
+  std::shared_ptr<EagerAggregationRule> rule;
+};
+
+TEST_F(EagerAggregationRuleTest, AggregateFactTableBeforeJoin) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(d_category), expression_vector(sum_(f_revenue), max_(f_revenue), count_star_()),  // NOLINT
+    JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+      fact_node,
+      dimension_node));
+
+  const auto expected_aggregate_node =
+  AggregateNode::make(expression_vector(d_category), expression_vector(sum_(f_revenue), max_(f_revenue), count_star_()),  // NOLINT
+    JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+      AggregateNode::make(expression_vector(f_d_id), expression_vector(sum_(f_revenue), max_(f_revenue), count_star_()),  // NOLINT
+        fact_node),
+      dimension_node));
+  // clang-format on
+  expected_aggregate_node->combines_partial_aggregates = true;
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_aggregate_node);
+}
+
+TEST_F(EagerAggregationRuleTest, GroupByColumnsOfAggregatedInput) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(d_category, f_revenue), expression_vector(count_(f_d_id)),
+    JoinNode::make(JoinMode::Inner, equals_(d_id, f_d_id),
+      dimension_node,
+      fact_node));
+
+  const auto expected_aggregate_node =
+  AggregateNode::make(expression_vector(d_category, f_revenue), expression_vector(count_(f_d_id)),
+    JoinNode::make(JoinMode::Inner, equals_(d_id, f_d_id),
+      dimension_node,
+      AggregateNode::make(expression_vector(f_d_id, f_revenue), expression_vector(count_(f_d_id)),
+        fact_node)));
+  // clang-format on
+  expected_aggregate_node->combines_partial_aggregates = true;
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_aggregate_node);
+}
+
+TEST_F(EagerAggregationRuleTest, NoRewriteIfNotCheaper) {
+  // Grouping the fact table by its revenue does not reduce the number of rows enough
+  fact_node->set_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 1'000'000,
+      std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100, 1, 100),
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000'000, 1, 1'000'000)}));
+
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(d_category, f_revenue), expression_vector(count_star_()),
+    JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+      fact_node,
+      dimension_node));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(EagerAggregationRuleTest, NoRewriteOfUnsupportedAggregates) {
+  const auto test_no_rewrite = [&](const std::vector<std::shared_ptr<AbstractExpression>>& group_by_expressions,
+                                   const std::vector<std::shared_ptr<AbstractExpression>>& aggregate_expressions) {
+    // clang-format off
+    const auto lqp =
+    AggregateNode::make(group_by_expressions, aggregate_expressions,
+      JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+        fact_node,
+        dimension_node));
+    // clang-format on
+
+    const auto expected_lqp = lqp->deep_copy();
+    const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  };
+
+  // AVG is not decomposable without rewriting it into SUM and COUNT
+  test_no_rewrite(expression_vector(d_category), expression_vector(avg_(f_revenue)));
+
+  // Aggregates without GROUP BY
+  test_no_rewrite(std::vector<std::shared_ptr<AbstractExpression>>{}, expression_vector(sum_(f_revenue)));
+
+  // Arguments from both inputs
+  test_no_rewrite(expression_vector(d_category), expression_vector(sum_(f_revenue), max_(d_category)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/group_by_reduction_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class GroupByReductionRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"id", DataType::Int, false}, {"name", DataType::String, false}}, TableType::Data);
+    table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("customer", table);
+
+    customer = StoredTableNode::make("customer");
+    id = customer->get_column("id");
+    name = customer->get_column("name");
+
+    rule = std::make_shared<GroupByReductionRule>();
+  }
+
+  std::shared_ptr<StoredTableNode> customer;
+  LQPColumnReference id, name;
+  std::shared_ptr<GroupByReductionRule> rule;
+  const std::vector<std::shared_ptr<AbstractExpression>> no_aggregates{};
+};
+
+TEST_F(GroupByReductionRuleTest, RemoveDistinctOnKey) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(name, id), no_aggregates,
+    PredicateNode::make(greater_than_(id, 5),
+      customer));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(name, id),
+    PredicateNode::make(greater_than_(id, 5),
+      customer));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(GroupByReductionRuleTest, KeepAggregatesAndDistinctOnNonKey) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(name), no_aggregates,
+    AggregateNode::make(expression_vector(id, name), expression_vector(count_star_()),
+      customer));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -9,8 +9,10 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
@@ -168,4 +170,35 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexOnlyScanForCountAndProjectionOfSearchValue) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  // SELECT COUNT(*) FROM a WHERE c > 19900
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_0->set_left_input(stored_table_node);
+  auto aggregate_node = AggregateNode::make(expression_vector(), expression_vector(count_star_()), predicate_node_0);
+
+  StrategyBaseTest::apply_rule(rule, aggregate_node);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexOnlyScan);
+
+  // SELECT c FROM a WHERE c = 19950
+  auto predicate_node_1 = PredicateNode::make(equals_(c, 19'950));
+  predicate_node_1->set_left_input(stored_table_node);
+  auto projection_node = ProjectionNode::make(expression_vector(c), predicate_node_1);
+
+  StrategyBaseTest::apply_rule(rule, projection_node);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexOnlyScan);
+
+  // SELECT b FROM a WHERE c = 19950 needs the positions to access b
+  auto predicate_node_2 = PredicateNode::make(equals_(c, 19'950));
+  predicate_node_2->set_left_input(stored_table_node);
+  auto projection_node_b = ProjectionNode::make(expression_vector(b), predicate_node_2);
+
+  StrategyBaseTest::apply_rule(rule, projection_node_b);
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::IndexScan);
+}
+
 }  // namespace opossum
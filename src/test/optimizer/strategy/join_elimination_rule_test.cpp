@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/join_elimination_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    const auto customer_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_id", DataType::Int, false}, {"c_name", DataType::String, false}}, TableType::Data);
+    customer_table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("customer", customer_table);
+
+    const auto orders_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"o_id", DataType::Int, false},
+                                                       {"o_c_id", DataType::Int, false},
+                                                       {"o_referrer_c_id", DataType::Int, true}},
+                                TableType::Data);
+    orders_table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    orders_table->add_foreign_key_constraint({ColumnID{1}}, "customer", {ColumnID{0}});
+    orders_table->add_foreign_key_constraint({ColumnID{2}}, "customer", {ColumnID{0}});
+    StorageManager::get().add_table("orders", orders_table);
+
+    customer = StoredTableNode::make("customer");
+    orders = StoredTableNode::make("orders");
+    c_id = customer->get_column("c_id");
+    c_name = customer->get_column("c_name");
+    o_id = orders->get_column("o_id");
+    o_c_id = orders->get_column("o_c_id");
+    o_referrer_c_id = orders->get_column("o_referrer_c_id");
+
+    rule = std::make_shared<JoinEliminationRule>();
+  }
+
+  std::shared_ptr<StoredTableNode> customer, orders;
+  LQPColumnReference c_id, c_name, o_id, o_c_id, o_referrer_c_id;
+  std::shared_ptr<JoinEliminationRule> rule;
+};
+
+TEST_F(JoinEliminationRuleTest, RemoveInnerJoinOnForeignKey) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(o_id),
+    JoinNode::make(JoinMode::Inner, equals_(c_id, o_c_id),
+      customer,
+      ValidateNode::make(orders)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(o_id),
+    ValidateNode::make(orders));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, RemoveSemiJoinOnForeignKey) {
+  // A nullable foreign key is only known to have a join partner if it is not NULL
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Semi, equals_(o_referrer_c_id, c_id),
+    JoinNode::make(JoinMode::Semi, equals_(o_c_id, c_id),
+      orders,
+      customer),
+    customer);
+
+  const auto expected_lqp =
+  PredicateNode::make(is_not_null_(o_referrer_c_id),
+    orders);
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepJoinWhoseColumnsAreUsed) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(o_id, c_name),
+    JoinNode::make(JoinMode::Inner, equals_(o_c_id, c_id),
+      orders,
+      customer));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepJoinOnValidatedTable) {
+  // Deleting a customer does not delete its orders, which the join filters
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(o_id),
+    JoinNode::make(JoinMode::Inner, equals_(c_id, o_c_id),
+      ValidateNode::make(customer),
+      ValidateNode::make(orders)));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepJoinThatFilters) {
+  // Not every order finds a customer named "Alice"
+  // clang-format off
+  const auto filtered_lqp =
+  ProjectionNode::make(expression_vector(o_id),
+    JoinNode::make(JoinMode::Inner, equals_(o_c_id, c_id),
+      orders,
+      PredicateNode::make(equals_(c_name, "Alice"),
+        customer)));
+  // clang-format on
+
+  const auto expected_filtered_lqp = filtered_lqp->deep_copy();
+  EXPECT_LQP_EQ(apply_rule(rule, filtered_lqp), expected_filtered_lqp);
+
+  // Without a foreign key, o_id does not necessarily find a partner
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Semi, equals_(o_id, c_id),
+    orders,
+    customer);
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  EXPECT_LQP_EQ(apply_rule(rule, lqp), expected_lqp);
+}
+
+}  // namespace opossum
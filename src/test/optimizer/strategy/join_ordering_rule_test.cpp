@@ -87,4 +87,31 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, OptimizationBudget) {
+  // The JoinGraph has a single CsgCmpPair, so DpCcp is used for a budget of one. Without any budget, the rule falls back
+  // to GreedyOperatorOrdering. Both have to produce the same plan.
+
+  // clang-format off
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+    node_a,
+    node_b);
+  // clang-format on
+
+  for (const auto max_csg_cmp_pair_count : {size_t{0}, size_t{1}, JoinOrderingRule::DEFAULT_MAX_CSG_CMP_PAIR_COUNT}) {
+    // clang-format off
+    const auto input_lqp =
+    PredicateNode::make(equals_(a_a, b_a),
+      JoinNode::make(JoinMode::Cross,
+        node_a,
+        node_b));
+    // clang-format on
+
+    const auto budget_rule = std::make_shared<JoinOrderingRule>(cost_estimator, max_csg_cmp_pair_count);
+    const auto actual_lqp = apply_rule(budget_rule, input_lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,93 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/limit_pushdown_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LimitPushdownRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    _rule = std::make_shared<LimitPushdownRule>();
+  }
+
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference a, b;
+  std::shared_ptr<LimitPushdownRule> _rule;
+};
+
+TEST_F(LimitPushdownRuleTest, HintPassesThroughProjections) {
+  const auto validate_node = ValidateNode::make(node);
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 5), validate_node);
+  const auto projection_node = ProjectionNode::make(expression_vector(b), predicate_node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}), projection_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(projection_node->row_count_hint, size_t{10});
+  EXPECT_EQ(predicate_node->row_count_hint, size_t{10});
+
+  // The PredicateNode needs more than ten rows from its input
+  EXPECT_EQ(validate_node->row_count_hint, std::nullopt);
+  EXPECT_EQ(node->row_count_hint, std::nullopt);
+}
+
+TEST_F(LimitPushdownRuleTest, NoHintBelowOrderChangingNodes) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 5), node);
+  const auto sort_node =
+      SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending}, predicate_node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}), sort_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(sort_node->row_count_hint, std::nullopt);
+  EXPECT_EQ(predicate_node->row_count_hint, std::nullopt);
+}
+
+TEST_F(LimitPushdownRuleTest, NoHintWithNonConstantLimit) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 5), node);
+  const auto limit_node = LimitNode::make(placeholder_(ParameterID{0}), predicate_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(predicate_node->row_count_hint, std::nullopt);
+}
+
+TEST_F(LimitPushdownRuleTest, NoHintForNodesWithMultipleOutputs) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 5), node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}), predicate_node);
+  const auto projection_node = ProjectionNode::make(expression_vector(b), predicate_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(predicate_node->row_count_hint, std::nullopt);
+}
+
+TEST_F(LimitPushdownRuleTest, HintIsCopied) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 5), node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}), predicate_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  const auto copied_lqp = limit_node->deep_copy();
+  EXPECT_EQ(copied_lqp->left_input()->row_count_hint, size_t{10});
+}
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
+#include "storage/lqp_view.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int.tbl", 2);
+    StorageManager::get().add_table("t", _table);
+
+    const auto stored_table_node = StoredTableNode::make("t");
+    const auto a = stored_table_node->get_column("a");
+    const auto b = stored_table_node->get_column("b");
+
+    _view_lqp = AggregateNode::make(expression_vector(a), expression_vector(sum_(b)), stored_table_node);
+    _materialized_view = std::make_shared<MaterializedView>(
+        std::make_shared<LQPView>(_view_lqp, std::unordered_map<ColumnID, std::string>{}));
+    StorageManager::get().add_materialized_view("v", _materialized_view);
+
+    _rule = std::make_shared<MaterializedViewRule>();
+  }
+
+  std::shared_ptr<AbstractLQPNode> query_lqp() const {
+    const auto view_lqp = _view_lqp->deep_copy();
+    return ProjectionNode::make(expression_vector(view_lqp->column_expressions()[1]), view_lqp);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<AbstractLQPNode> _view_lqp;
+  std::shared_ptr<MaterializedView> _materialized_view;
+  std::shared_ptr<MaterializedViewRule> _rule;
+};
+
+TEST_F(MaterializedViewRuleTest, ReplacesViewWithResult) {
+  const auto lqp = query_lqp();
+  const auto actual_lqp = apply_rule(_rule, lqp);
+
+  ASSERT_EQ(actual_lqp, lqp);
+  ASSERT_EQ(actual_lqp->left_input()->type, LQPNodeType::IntermediateResult);
+  const auto intermediate_result_node = std::static_pointer_cast<IntermediateResultNode>(actual_lqp->left_input());
+  EXPECT_EQ(intermediate_result_node->table, _materialized_view->table());
+
+  // The expressions of the ProjectionNode still refer to the columns of the replaced subplan
+  EXPECT_EQ(actual_lqp->find_column_id(*actual_lqp->column_expressions()[0]), ColumnID{0});
+  EXPECT_EQ(intermediate_result_node->find_column_id(*actual_lqp->column_expressions()[0]), ColumnID{1});
+
+  // The LQP can still be copied, e.g., for adaptive re-optimization
+  const auto copied_lqp = actual_lqp->deep_copy();
+  EXPECT_EQ(copied_lqp->left_input()->type, LQPNodeType::IntermediateResult);
+  EXPECT_EQ(copied_lqp->find_column_id(*actual_lqp->column_expressions()[0]), ColumnID{0});
+}
+
+TEST_F(MaterializedViewRuleTest, IgnoresOutdatedView) {
+  _table->append({1, 2});
+  _table->get_chunk(ChunkID{_table->chunk_count() - 1})->get_scoped_mvcc_data_lock()->begin_cids.back() = 0;
+
+  const auto lqp = query_lqp();
+  const auto actual_lqp = apply_rule(_rule, lqp);
+  EXPECT_EQ(actual_lqp->left_input()->type, LQPNodeType::Aggregate);
+
+  _materialized_view->refresh();
+  const auto refreshed_lqp = apply_rule(_rule, query_lqp());
+  EXPECT_EQ(refreshed_lqp->left_input()->type, LQPNodeType::IntermediateResult);
+}
+
+}  // namespace opossum
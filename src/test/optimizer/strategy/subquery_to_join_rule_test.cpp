@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/subquery_to_join_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SubqueryToJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl"));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_int3.tbl"));
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    node_table_b = StoredTableNode::make("table_b");
+    node_table_b_col_a = node_table_b->get_column("a");
+    node_table_b_col_b = node_table_b->get_column("b");
+
+    parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+    _rule = std::make_shared<SubqueryToJoinRule>();
+  }
+
+  std::shared_ptr<SubqueryToJoinRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a, node_table_b;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b, node_table_b_col_a, node_table_b_col_b;
+  std::shared_ptr<AbstractExpression> parameter;
+};
+
+TEST_F(SubqueryToJoinRuleTest, ScalarAggregateSubqueryToJoin) {
+  // SELECT * FROM table_a WHERE b < (SELECT 0.2 * AVG(table_b.b) FROM table_b WHERE table_b.a = table_a.a)
+
+  // clang-format off
+  const auto subquery_lqp =
+  ProjectionNode::make(expression_vector(mul_(0.2, avg_(node_table_b_col_b))),
+    AggregateNode::make(expression_vector(), expression_vector(avg_(node_table_b_col_b)),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        ValidateNode::make(
+          node_table_b))));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(less_than_(node_table_a_col_b, mul_(0.2, avg_(node_table_b_col_b))),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        ProjectionNode::make(expression_vector(node_table_b_col_a, mul_(0.2, avg_(node_table_b_col_b))),
+          AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(avg_(node_table_b_col_b)),
+            ValidateNode::make(
+              node_table_b))))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubqueryToJoinRuleTest, AggregateWithoutProjection) {
+  // SELECT * FROM table_a WHERE (SELECT MAX(table_b.b) FROM table_b WHERE table_a.a = table_b.a) > b
+
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(node_table_b_col_b)),
+    PredicateNode::make(equals_(parameter, node_table_b_col_a),
+      node_table_b));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(greater_than_(subquery, node_table_a_col_b),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(greater_than_(max_(node_table_b_col_b), node_table_a_col_b),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        ProjectionNode::make(expression_vector(node_table_b_col_a, max_(node_table_b_col_b)),
+          AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(max_(node_table_b_col_b)),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubqueryToJoinRuleTest, NoRewriteOfUnsupportedSubqueries) {
+  // Outer rows without matching inner rows would be lost, although COUNT is 0 for them
+  // clang-format off
+  const auto count_subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  // The correlated predicate is not an equality
+  const auto non_equals_subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(sum_(node_table_b_col_b)),
+    PredicateNode::make(less_than_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  // The correlated parameter is used twice
+  const auto twice_correlated_subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(sum_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_b, parameter),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+
+  // The subquery is grouped, so that it might return more than one row
+  const auto grouped_subquery_lqp =
+  AggregateNode::make(expression_vector(node_table_b_col_b), expression_vector(sum_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+  // clang-format on
+
+  for (const auto& subquery_lqp :
+       {count_subquery_lqp, non_equals_subquery_lqp, twice_correlated_subquery_lqp, grouped_subquery_lqp}) {
+    const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+    const auto input_lqp = PredicateNode::make(less_than_(node_table_a_col_b, subquery), node_table_a);
+    const auto expected_lqp = input_lqp->deep_copy();
+
+    const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TopKRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    _rule = std::make_shared<TopKRule>();
+  }
+
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference a, b;
+  std::shared_ptr<TopKRule> _rule;
+};
+
+TEST_F(TopKRuleTest, LimitAboveSortBecomesTopK) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending}, node);
+  const auto limit_node = LimitNode::make(value_(int64_t{5}), sort_node);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(actual_lqp, limit_node);
+  EXPECT_EQ(limit_node->limit_type, LimitType::TopK);
+}
+
+TEST_F(TopKRuleTest, NoTopKWithoutSort) {
+  const auto projection_node = ProjectionNode::make(expression_vector(a), node);
+  const auto limit_node = LimitNode::make(value_(int64_t{5}), projection_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(limit_node->limit_type, LimitType::Limit);
+}
+
+TEST_F(TopKRuleTest, NoTopKWithNonConstantLimit) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending}, node);
+  const auto limit_node = LimitNode::make(placeholder_(ParameterID{0}), sort_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(limit_node->limit_type, LimitType::Limit);
+}
+
+TEST_F(TopKRuleTest, NoTopKIfSortHasMultipleOutputs) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending}, node);
+  const auto limit_node = LimitNode::make(value_(int64_t{5}), sort_node);
+  const auto projection_node = ProjectionNode::make(expression_vector(b), sort_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+
+  EXPECT_EQ(limit_node->limit_type, LimitType::Limit);
+}
+
+}  // namespace opossum
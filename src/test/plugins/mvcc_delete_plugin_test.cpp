@@ -0,0 +1,191 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../plugins/mvcc_delete_plugin.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MvccDeletePluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 10, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 30; ++value) {
+      _table->append({value});
+
+      // Make the row visible, just like load_table() does
+      const auto chunk = _table->get_chunk(static_cast<ChunkID>(_table->chunk_count() - 1));
+      chunk->get_scoped_mvcc_data_lock()->begin_cids.back() = 0;
+    }
+    StorageManager::get().add_table(_table_name, _table);
+  }
+
+  void TearDown() override { MvccDeletePlugin::get().stop(); }
+
+  static void _logical_delete() { MvccDeletePlugin::get()._logical_delete_loop(); }
+
+  static void _physical_delete() { MvccDeletePlugin::get()._physical_delete_loop(); }
+
+  // Deletes all rows with a value below the given one
+  void _delete_rows_below(const int32_t value) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::LessThan, value);
+    table_scan->execute();
+
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+
+    transaction_context->commit();
+  }
+
+  size_t _visible_row_count() const {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    return validate->get_output()->row_count();
+  }
+
+  const std::string _table_name{"table_a"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MvccDeletePluginTest, LogicalDeleteMovesVisibleRows) {
+  // Nine of the ten rows of the first chunk are invalidated
+  _delete_rows_below(9);
+  EXPECT_EQ(_visible_row_count(), 21u);
+
+  _logical_delete();
+
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(chunk->get_cleanup_commit_id());
+  EXPECT_EQ(chunk->invalid_row_count(), chunk->size());
+
+  // The remaining row was moved to a new chunk at the end of the table
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  const auto last_chunk = _table->get_chunk(ChunkID{3});
+  ASSERT_EQ(last_chunk->size(), 1u);
+  EXPECT_EQ((*last_chunk->get_segment(ColumnID{0}))[0], AllTypeVariant{9});
+  EXPECT_EQ(_visible_row_count(), 21u);
+
+  _physical_delete();
+
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}), nullptr);
+  EXPECT_EQ(_table->row_count(), 21u);
+  EXPECT_EQ(_visible_row_count(), 21u);
+}
+
+TEST_F(MvccDeletePluginTest, LogicalDeleteSkipsChunksBelowThreshold) {
+  _delete_rows_below(8);
+
+  _logical_delete();
+
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->chunk_count(), 3u);
+}
+
+TEST_F(MvccDeletePluginTest, LogicalDeleteMergesChunksAfterChangingMaxChunkSize) {
+  _table->set_max_chunk_size(15);
+
+  // The first two chunks are re-inserted, filling up the last chunk and a new one
+  _logical_delete();
+
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->size(), 15u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 15u);
+
+  _physical_delete();
+
+  EXPECT_EQ(_table->row_count(), 30u);
+  EXPECT_EQ(_visible_row_count(), 30u);
+
+  // Chunks of the configured size are not touched again
+  _logical_delete();
+  EXPECT_EQ(_table->chunk_count(), 4u);
+}
+
+TEST_F(MvccDeletePluginTest, LogicalDeleteSkipsRowsVisibleToActiveTransactions) {
+  // This transaction still sees the deleted rows
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  _delete_rows_below(9);
+
+  _logical_delete();
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  transaction_context.reset();
+
+  _logical_delete();
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+}
+
+TEST_F(MvccDeletePluginTest, PhysicalDeleteWaitsForActiveTransactions) {
+  _delete_rows_below(9);
+
+  // This transaction starts before the logical delete and might still look at the chunk
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  _logical_delete();
+  ASSERT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  _physical_delete();
+  EXPECT_NE(_table->get_chunk(ChunkID{0}), nullptr);
+
+  const auto get_table = std::make_shared<GetTable>(_table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 4u);
+
+  transaction_context.reset();
+
+  _physical_delete();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}), nullptr);
+}
+
+TEST_F(MvccDeletePluginTest, RemovesChunksDeletedAsAWhole) {
+  // The statistics of the encoded first chunk prove that all of its rows are deleted, so that the Delete invalidates
+  // the chunk as a whole. It has no visible rows to move and is removed right away.
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}});
+  _delete_rows_below(10);
+
+  const auto chunk_end_cid = _table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->chunk_end_cid.load();
+  ASSERT_NE(chunk_end_cid, MvccData::MAX_COMMIT_ID);
+
+  _logical_delete();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id(), chunk_end_cid);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->chunk_count(), 3u);
+
+  _physical_delete();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}), nullptr);
+  EXPECT_EQ(_visible_row_count(), 20u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,143 @@
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../plugins/tuning_plugin.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TuningPluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+    for (auto value = int32_t{0}; value < 3'000; ++value) {
+      _table->append({value, value % 3});
+    }
+
+    // Leave the segments unencoded, but make the chunks immutable
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Unencoded});
+    StorageManager::get().add_table(_table_name, _table);
+  }
+
+  void TearDown() override {
+    auto& plugin = TuningPlugin::get();
+    plugin.stop();
+    plugin.set_memory_budget(std::numeric_limits<size_t>::max());
+  }
+
+  void _execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.disable_mvcc().create_pipeline();
+    pipeline.get_result_table();
+  }
+
+  float _scan_count(const ColumnID column_id) const { return _column_usage(column_id).scan_count; }
+
+  float _join_count(const ColumnID column_id) const { return _column_usage(column_id).join_count; }
+
+  std::optional<float> _selectivity(const ColumnID column_id) const { return _column_usage(column_id).selectivity(); }
+
+  // Pretends that the column was scanned often with the given selectivity
+  void _set_scans(const ColumnID column_id, const float selectivity) {
+    auto& column_usage = TuningPlugin::get()._column_usages[{_table_name, column_id}];
+    column_usage.scan_count = 100.0f;
+    column_usage.selectivity_sum = 100.0f * selectivity;
+    column_usage.selectivity_sample_count = 100.0f;
+  }
+
+  static void _tune() { TuningPlugin::get()._tune(); }
+
+  static size_t _estimate_memory_usage() { return TuningPlugin::_estimate_memory_usage(); }
+
+  size_t _indexed_chunk_count(const ColumnID column_id) const {
+    auto indexed_chunk_count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      if (_table->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{column_id})) {
+        ++indexed_chunk_count;
+      }
+    }
+    return indexed_chunk_count;
+  }
+
+  const std::string _table_name{"tuning_table"};
+  std::shared_ptr<Table> _table;
+
+ private:
+  TuningPlugin::ColumnUsage _column_usage(const ColumnID column_id) const {
+    auto& plugin = TuningPlugin::get();
+    std::lock_guard<std::mutex> lock(plugin._column_usages_mutex);
+    const auto column_usage_it = plugin._column_usages.find({_table_name, column_id});
+    return column_usage_it != plugin._column_usages.cend() ? column_usage_it->second : TuningPlugin::ColumnUsage{};
+  }
+};
+
+TEST_F(TuningPluginTest, ObservesScansAndJoins) {
+  TuningPlugin::get().start();
+
+  _execute("SELECT * FROM tuning_table WHERE a = 5");
+  _execute("SELECT * FROM tuning_table WHERE a < 20 AND b = 1");
+  _execute("SELECT * FROM tuning_table t1 JOIN tuning_table t2 ON t1.a = t2.b");
+
+  EXPECT_EQ(_scan_count(ColumnID{0}), 2.0f);
+  EXPECT_EQ(_scan_count(ColumnID{1}), 1.0f);
+  EXPECT_EQ(_join_count(ColumnID{0}), 1.0f);
+  EXPECT_EQ(_join_count(ColumnID{1}), 1.0f);
+
+  ASSERT_TRUE(_selectivity(ColumnID{0}));
+  EXPECT_LT(*_selectivity(ColumnID{0}), 0.05f);
+
+  // No plans are observed after the plugin was stopped
+  TuningPlugin::get().stop();
+  _execute("SELECT * FROM tuning_table WHERE a = 5");
+  EXPECT_EQ(_scan_count(ColumnID{0}), 0.0f);
+}
+
+TEST_F(TuningPluginTest, CreatesAndDropsIndexes) {
+  _set_scans(ColumnID{0}, 0.001f);
+  _set_scans(ColumnID{1}, 0.3f);
+  _tune();
+
+  // Only the selectively scanned column is indexed, in all chunks
+  EXPECT_EQ(_indexed_chunk_count(ColumnID{0}), 3u);
+  EXPECT_EQ(_indexed_chunk_count(ColumnID{1}), 0u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<const BaseDictionarySegment>(
+        _table->get_chunk(chunk_id)->get_segment(ColumnID{0})));
+  }
+
+  const auto indexes = _table->get_indexes();
+  ASSERT_EQ(indexes.size(), 1u);
+  EXPECT_EQ(indexes[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(indexes[0].type, SegmentIndexType::GroupKey);
+
+  // Once the usage decayed, the index is unregistered and, one round later, removed from the chunks
+  for (auto round = 0; round < 5; ++round) _tune();
+  EXPECT_TRUE(_table->get_indexes().empty());
+  EXPECT_EQ(_indexed_chunk_count(ColumnID{0}), 0u);
+
+  // The results of queries do not change
+  _execute("SELECT * FROM tuning_table WHERE a = 5");
+}
+
+TEST_F(TuningPluginTest, RespectsMemoryBudget) {
+  TuningPlugin::get().set_memory_budget(_estimate_memory_usage());
+
+  _set_scans(ColumnID{0}, 0.001f);
+  _tune();
+
+  EXPECT_EQ(_indexed_chunk_count(ColumnID{0}), 0u);
+  EXPECT_TRUE(_table->get_indexes().empty());
+
+  // The cold segments are encoded with the smallest encoding, which frees memory for the index
+  EXPECT_LT(_estimate_memory_usage(), TuningPlugin::get().memory_budget());
+}
+
+}  // namespace opossum
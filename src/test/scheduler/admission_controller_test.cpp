@@ -0,0 +1,88 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/memory_budget.hpp"
+#include "scheduler/admission_controller.hpp"
+
+namespace opossum {
+
+class AdmissionControllerTest : public BaseTest {};
+
+TEST_F(AdmissionControllerTest, AdmitsRightAwayWithoutGlobalBudget) {
+  auto& admission_controller = AdmissionController::get();
+  EXPECT_FALSE(admission_controller.global_budget());
+
+  const auto budget_a = std::make_shared<MemoryBudget>();
+  const auto budget_b = std::make_shared<MemoryBudget>();
+  budget_a->track(1'000'000);
+
+  {
+    const auto admission_a = admission_controller.admit(budget_a);
+    const auto admission_b = admission_controller.admit(budget_b);
+    EXPECT_EQ(admission_controller.running_statement_count(), 2u);
+    EXPECT_EQ(admission_controller.used_bytes(), 1'000'000u);
+  }
+
+  EXPECT_EQ(admission_controller.running_statement_count(), 0u);
+}
+
+TEST_F(AdmissionControllerTest, QueuesStatementsWhenGlobalBudgetIsExhausted) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_global_budget(1'000);
+
+  // The first statement is admitted although it exceeds the global budget, as no other statement is running
+  const auto budget_a = std::make_shared<MemoryBudget>();
+  auto admission_a = std::optional<AdmissionController::Admission>{admission_controller.admit(budget_a)};
+  budget_a->track(2'000);
+
+  auto admitted_b = std::atomic_bool{false};
+  auto thread = std::thread{[&]() {
+    const auto admission_b = admission_controller.admit(std::make_shared<MemoryBudget>());
+    admitted_b = true;
+  }};
+
+  while (admission_controller.waiting_statement_count() == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_FALSE(admitted_b);
+
+  admission_a.reset();
+  thread.join();
+  EXPECT_TRUE(admitted_b);
+  EXPECT_EQ(admission_controller.waiting_statement_count(), 0u);
+  EXPECT_EQ(admission_controller.running_statement_count(), 0u);
+}
+
+TEST_F(AdmissionControllerTest, RequestsTheLimitOfTheStatementBudget) {
+  auto& admission_controller = AdmissionController::get();
+  admission_controller.set_global_budget(1'000);
+
+  const auto budget_a = std::make_shared<MemoryBudget>(600);
+  auto admission_a = std::optional<AdmissionController::Admission>{admission_controller.admit(budget_a)};
+  budget_a->track(500);
+
+  // The second statement might use up to 600 bytes, which do not fit into the remaining budget
+  auto admitted_b = std::atomic_bool{false};
+  auto thread = std::thread{[&]() {
+    const auto admission_b = admission_controller.admit(std::make_shared<MemoryBudget>(600));
+    admitted_b = true;
+  }};
+
+  // Increasing the global budget admits the waiting statement
+  while (admission_controller.waiting_statement_count() == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_FALSE(admitted_b);
+  admission_controller.set_global_budget(2'000);
+
+  thread.join();
+  EXPECT_TRUE(admitted_b);
+}
+
+}  // namespace opossum
@@ -1,4 +1,8 @@
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -12,8 +16,12 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler_statistics.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -126,6 +134,150 @@ TEST_F(SchedulerTest, BasicTest) {
   CurrentScheduler::set(nullptr);
 }
 
+TEST_F(SchedulerTest, BasicTestWithLocalDeques) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(true));
+
+  std::atomic_uint counter{0};
+
+  increment_counter_in_subtasks(counter);
+
+  CurrentScheduler::get()->finish();
+
+  ASSERT_EQ(counter, 30u);
+
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, WorkerStatistics) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(true));
+
+  std::atomic_uint counter{0};
+
+  increment_counter_in_subtasks(counter);
+
+  CurrentScheduler::get()->finish();
+
+  auto finished_tasks = uint64_t{0};
+  auto busy_time = std::chrono::nanoseconds{0};
+  for (const auto& worker : CurrentScheduler::get()->workers()) {
+    const auto statistics = worker->statistics();
+    finished_tasks += statistics.finished_tasks;
+    busy_time += statistics.busy_time;
+  }
+  EXPECT_EQ(finished_tasks, 40u);
+  EXPECT_GT(busy_time, std::chrono::nanoseconds{0});
+
+  const auto statistics_table = create_scheduler_statistics_table();
+  EXPECT_EQ(statistics_table->row_count(), CurrentScheduler::get()->workers().size());
+  EXPECT_EQ(statistics_table->get_value<int64_t>(ColumnID{9}, 0), 0);
+  EXPECT_EQ(statistics_table->get_value<int64_t>(ColumnID{10}, 0), 0);
+
+  CurrentScheduler::set(nullptr);
+  EXPECT_EQ(create_scheduler_statistics_table()->row_count(), 0u);
+}
+
+TEST_F(SchedulerTest, TaskQueueSize) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto high_priority = static_cast<uint32_t>(SchedulePriority::High);
+  const auto default_priority = static_cast<uint32_t>(SchedulePriority::Default);
+  const auto low_priority = static_cast<uint32_t>(SchedulePriority::Low);
+
+  queue.push(std::make_shared<JobTask>([]() {}), low_priority);
+  queue.push(std::make_shared<JobTask>([]() {}), high_priority);
+  queue.push(std::make_shared<JobTask>([]() {}), default_priority);
+  queue.push(std::make_shared<JobTask>([]() {}), default_priority);
+  EXPECT_EQ(queue.estimate_size(high_priority), 1u);
+  EXPECT_EQ(queue.estimate_size(default_priority), 2u);
+  EXPECT_EQ(queue.estimate_size(low_priority), 1u);
+
+  // High priority tasks are pulled first
+  EXPECT_NE(queue.pull(), nullptr);
+  EXPECT_EQ(queue.estimate_size(high_priority), 0u);
+  EXPECT_EQ(queue.estimate_size(default_priority), 2u);
+
+  EXPECT_NE(queue.steal(), nullptr);
+  EXPECT_EQ(queue.estimate_size(default_priority), 1u);
+}
+
+TEST_F(SchedulerTest, TaskQueueDoesNotStarveLowPriority) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto high_priority = static_cast<uint32_t>(SchedulePriority::High);
+  const auto default_priority = static_cast<uint32_t>(SchedulePriority::Default);
+
+  for (auto task_index = uint32_t{0}; task_index < 2 * TaskQueue::LOW_PRIORITY_PULL_INTERVAL; ++task_index) {
+    queue.push(std::make_shared<JobTask>([]() {}, SchedulePriority::High), high_priority);
+  }
+  queue.push(std::make_shared<JobTask>([]() {}, SchedulePriority::Default), default_priority);
+
+  for (auto pull_index = uint32_t{1}; pull_index < TaskQueue::LOW_PRIORITY_PULL_INTERVAL; ++pull_index) {
+    EXPECT_EQ(queue.pull()->priority(), SchedulePriority::High);
+  }
+  EXPECT_EQ(queue.pull()->priority(), SchedulePriority::Default);
+  EXPECT_EQ(queue.pull()->priority(), SchedulePriority::High);
+}
+
+TEST_F(SchedulerTest, TaskQueueAnnouncesNewTasks) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto default_priority = static_cast<uint32_t>(SchedulePriority::Default);
+
+  // The task is pushed after the epoch was read, so that waiting returns right away
+  auto epoch = queue.new_task_epoch();
+  queue.push(std::make_shared<JobTask>([]() {}), default_priority);
+  auto wait_started = std::chrono::steady_clock::now();
+  queue.wait_for_new_task(epoch, std::chrono::seconds{10});
+  EXPECT_LT(std::chrono::steady_clock::now() - wait_started, std::chrono::seconds{5});
+
+  // A sleeping Worker is woken up by the next push
+  epoch = queue.new_task_epoch();
+  wait_started = std::chrono::steady_clock::now();
+  auto sleeping_thread = std::thread{[&]() { queue.wait_for_new_task(epoch, std::chrono::seconds{10}); }};
+  queue.push(std::make_shared<JobTask>([]() {}), default_priority);
+  sleeping_thread.join();
+  EXPECT_LT(std::chrono::steady_clock::now() - wait_started, std::chrono::seconds{5});
+}
+
+TEST_F(SchedulerTest, LocalDequesOnlyTakeDefaultPriorityTasks) {
+  // The only Worker executes the outer task, so that the jobs stay where they were enqueued until it waits for them
+  Topology::use_default_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(true));
+
+  auto task = std::make_shared<JobTask>([]() {
+    const auto& queue = Worker::get_this_thread_worker()->queue();
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (const auto priority : {SchedulePriority::High, SchedulePriority::Default, SchedulePriority::Low}) {
+      jobs.emplace_back(std::make_shared<JobTask>([]() {}, priority));
+      jobs.back()->schedule();
+    }
+
+    EXPECT_EQ(queue->estimate_size(static_cast<uint32_t>(SchedulePriority::High)), 1u);
+    EXPECT_EQ(queue->estimate_size(static_cast<uint32_t>(SchedulePriority::Default)), 0u);
+    EXPECT_EQ(queue->estimate_size(static_cast<uint32_t>(SchedulePriority::Low)), 1u);
+    CurrentScheduler::wait_for_tasks(jobs);
+  });
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, TasksInheritPriority) {
+  EXPECT_EQ(AbstractTask::current_priority(), SchedulePriority::Default);
+
+  auto job_priority = SchedulePriority::Default;
+  auto task = std::make_shared<JobTask>(
+      [&]() {
+        auto job = std::make_shared<JobTask>([]() {});
+        job_priority = job->priority();
+      },
+      SchedulePriority::High);
+  task->schedule();
+
+  EXPECT_EQ(job_priority, SchedulePriority::High);
+  EXPECT_EQ(AbstractTask::current_priority(), SchedulePriority::Default);
+}
+
 TEST_F(SchedulerTest, BasicTestWithoutScheduler) {
   std::atomic_uint counter{0};
   increment_counter_in_subtasks(counter);
@@ -171,6 +323,22 @@ TEST_F(SchedulerTest, DiamondDependenciesWithScheduler) {
   ASSERT_EQ(counter, 7u);
 }
 
+TEST_F(SchedulerTest, DependenciesWithLocalDeques) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(true));
+
+  std::atomic_uint linear_counter{0u};
+  std::atomic_uint diamond_counter{0u};
+
+  stress_linear_dependencies(linear_counter);
+  stress_diamond_dependencies(diamond_counter);
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(linear_counter, 3u);
+  EXPECT_EQ(diamond_counter, 7u);
+}
+
 TEST_F(SchedulerTest, LinearDependenciesWithoutScheduler) {
   std::atomic_uint counter{0u};
   stress_linear_dependencies(counter);
@@ -239,6 +407,43 @@ TEST_F(SchedulerTest, VerifyTaskQueueSetup) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, PhysicalCoresAndCacheDomains) {
+  if (std::thread::hardware_concurrency() < 4) {
+    // Workers are pinned to the CPUs 0 to 3 of the custom topology below
+    GTEST_SKIP();
+  }
+
+  // Node 0 has one core with two SMT siblings, node 1 has two cores with one cache domain each
+  const auto use_topology = [] {
+    auto nodes = std::vector<TopologyNode>{};
+    nodes.emplace_back(std::vector<TopologyCpu>{{CpuID{0}, CpuID{0}, 0}, {CpuID{1}, CpuID{0}, 0}});
+    nodes.emplace_back(std::vector<TopologyCpu>{{CpuID{2}, CpuID{2}, 1}, {CpuID{3}, CpuID{3}, 2}});
+    Topology::use_custom_topology(std::move(nodes));
+  };
+
+  use_topology();
+  EXPECT_EQ(Topology::get().num_cpus(), 4);
+  EXPECT_EQ(Topology::get().num_physical_cores(), 3);
+  EXPECT_EQ(Topology::get().num_cache_domains(), 3);
+
+  for (const auto one_worker_per_physical_core : {false, true}) {
+    for (const auto use_cache_domain_queues : {false, true}) {
+      use_topology();
+      CurrentScheduler::set(
+          std::make_shared<NodeQueueScheduler>(true, one_worker_per_physical_core, use_cache_domain_queues));
+      EXPECT_EQ(CurrentScheduler::get()->workers().size(), one_worker_per_physical_core ? 3 : 4);
+      EXPECT_EQ(CurrentScheduler::get()->queues().size(), use_cache_domain_queues ? 3 : 2);
+
+      std::atomic_uint counter{0};
+      increment_counter_in_subtasks(counter);
+      CurrentScheduler::get()->finish();
+      EXPECT_EQ(counter, 30u);
+    }
+  }
+
+  CurrentScheduler::set(nullptr);
+}
+
 TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Topology::use_default_topology(1);
   CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
@@ -258,4 +463,63 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, DeeplyNestedJobsUseNoAdditionalThreads) {
+  for (const auto use_local_deques : {false, true}) {
+    Topology::use_fake_numa_topology(4, 2);
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(use_local_deques));
+
+    auto thread_ids_mutex = std::mutex{};
+    auto thread_ids = std::set<std::thread::id>{};
+    auto leaf_count = std::atomic_uint{0};
+
+    // Every job waits for the three jobs it spawns, down to a depth of five
+    const auto spawn_jobs = [&](const auto& self, const size_t depth) -> void {
+      {
+        const auto lock = std::lock_guard<std::mutex>{thread_ids_mutex};
+        thread_ids.emplace(std::this_thread::get_id());
+      }
+
+      if (depth == 0) {
+        ++leaf_count;
+        return;
+      }
+
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto job_index = 0; job_index < 3; ++job_index) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, depth]() { self(self, depth - 1); }));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+    };
+
+    auto task = std::make_shared<JobTask>([&]() { spawn_jobs(spawn_jobs, 5); });
+    task->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+    EXPECT_EQ(leaf_count, 243u);
+    EXPECT_LE(thread_ids.size(), CurrentScheduler::get()->workers().size());
+
+    CurrentScheduler::get()->finish();
+  }
+}
+
+TEST_F(SchedulerTest, SingleWorkerGuaranteeProgressWithLocalDeques) {
+  Topology::use_default_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(true));
+
+  auto task_done = false;
+  auto task = std::make_shared<JobTask>([&task_done]() {
+    auto subtask = std::make_shared<JobTask>([&task_done]() { task_done = true; });
+
+    subtask->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{subtask});
+  });
+
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(task_done);
+
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
@@ -0,0 +1,81 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoStealIsFifo) {
+  auto deque = WorkStealingDeque<int>{4};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+
+  for (auto i = 0; i < 4; ++i) deque.push(i);
+  EXPECT_EQ(deque.size(), 4u);
+
+  EXPECT_EQ(deque.pop(), 3);
+  EXPECT_EQ(deque.steal(), 0);
+  EXPECT_EQ(deque.pop(), 2);
+  EXPECT_EQ(deque.steal(), 1);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque<int>{2};
+  for (auto i = 0; i < 100; ++i) deque.push(i);
+  EXPECT_EQ(deque.size(), 100u);
+
+  for (auto i = 0; i < 50; ++i) EXPECT_EQ(deque.steal(), i);
+  for (auto i = 99; i >= 50; --i) EXPECT_EQ(deque.pop(), i);
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealing) {
+  // Every item must be handed out exactly once, no matter whether it was popped by the owner or stolen by a thief
+  constexpr auto NUM_ITEMS = 100'000;
+  constexpr auto NUM_THIEVES = 3;
+
+  auto deque = WorkStealingDeque<int>{};
+  auto seen = std::vector<std::atomic_uint>(NUM_ITEMS);
+  auto num_taken = std::atomic_int{0};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < NUM_THIEVES; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (num_taken < NUM_ITEMS) {
+        if (const auto item = deque.steal()) {
+          ++seen[*item];
+          ++num_taken;
+        }
+      }
+    });
+  }
+
+  for (auto i = 0; i < NUM_ITEMS; ++i) {
+    deque.push(i);
+    if (i % 3 == 0) {
+      if (const auto item = deque.pop()) {
+        ++seen[*item];
+        ++num_taken;
+      }
+    }
+  }
+  while (const auto item = deque.pop()) {
+    ++seen[*item];
+    ++num_taken;
+  }
+
+  for (auto& thief : thieves) thief.join();
+
+  EXPECT_EQ(num_taken, NUM_ITEMS);
+  for (const auto& count : seen) EXPECT_EQ(count, 1u);
+}
+
+}  // namespace opossum
@@ -7,8 +7,9 @@ namespace opossum {
 
 class MockConnection {
  public:
-  MOCK_METHOD0(receive_startup_packet_header, boost::future<uint32_t>());
+  MOCK_METHOD0(receive_startup_packet_header, boost::future<StartupPacketHeader>());
   MOCK_METHOD1(receive_startup_packet_body, boost::future<void>(uint32_t size));
+  MOCK_METHOD1(receive_cancel_request_packet_body, boost::future<BackendKeyData>(uint32_t size));
 
   MOCK_METHOD0(receive_packet_header, boost::future<RequestHeader>());
   MOCK_METHOD1(receive_simple_query_packet_body, boost::future<std::string>(uint32_t size));
@@ -17,18 +18,29 @@ class MockConnection {
   MOCK_METHOD1(receive_describe_packet_body, boost::future<std::string>(uint32_t size));
   MOCK_METHOD1(receive_sync_packet_body, boost::future<void>(uint32_t size));
   MOCK_METHOD1(receive_flush_packet_body, boost::future<void>(uint32_t size));
-  MOCK_METHOD1(receive_execute_packet_body, boost::future<std::string>(uint32_t size));
+  MOCK_METHOD1(receive_execute_packet_body, boost::future<ExecutePacket>(uint32_t size));
+  MOCK_METHOD1(receive_copy_data_packet_body, boost::future<std::string>(uint32_t size));
+  MOCK_METHOD1(receive_copy_done_packet_body, boost::future<void>(uint32_t size));
+  MOCK_METHOD1(receive_copy_fail_packet_body, boost::future<std::string>(uint32_t size));
 
   MOCK_METHOD0(send_ssl_denied, boost::future<void>());
   MOCK_METHOD0(send_auth, boost::future<void>());
+  MOCK_METHOD2(send_backend_key_data, boost::future<void>(uint32_t process_id, uint32_t secret_key));
   MOCK_METHOD2(send_parameter_status, boost::future<void>(const std::string& key, const std::string& value));
   MOCK_METHOD0(send_ready_for_query, boost::future<void>());
   MOCK_METHOD1(send_error, boost::future<void>(const std::string& message));
   MOCK_METHOD1(send_notice, boost::future<void>(const std::string& notice));
   MOCK_METHOD1(send_status_message, boost::future<void>(const NetworkMessageType& type));
   MOCK_METHOD1(send_row_description, boost::future<void>(const std::vector<ColumnDescription>& row_description));
-  MOCK_METHOD1(send_data_row, boost::future<void>(const std::vector<std::string>& row_strings));
+  MOCK_METHOD1(send_data_row, boost::future<void>(const std::vector<std::optional<std::string>>& row_values));
+  MOCK_METHOD2(send_copy_in_response, boost::future<void>(FormatCode format_code, uint16_t column_count));
+  MOCK_METHOD2(send_copy_out_response, boost::future<void>(FormatCode format_code, uint16_t column_count));
+  MOCK_METHOD1(send_copy_data, boost::future<void>(const std::string& data));
   MOCK_METHOD1(send_command_complete, boost::future<void>(const std::string& message));
+  MOCK_METHOD0(flush, boost::future<void>());
+
+  MOCK_METHOD1(watch_for_disconnect, void(const std::function<void()>& on_disconnect));
+  MOCK_METHOD0(stop_watching_for_disconnect, void());
 };
 
 }  // namespace opossum
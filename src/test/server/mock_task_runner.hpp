@@ -8,6 +8,7 @@
 
 #include "storage/prepared_plan.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/copy_from_stdin_server_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
@@ -28,6 +29,7 @@ class MockTaskRunner {
                boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<ExecuteServerQueryTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<LoadServerFileTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<uint64_t>(std::shared_ptr<CopyFromStdinServerTask>));
 };
 
 }  // namespace opossum
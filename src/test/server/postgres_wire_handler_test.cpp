@@ -54,8 +54,31 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   _input_packet.data = buffer;
   _input_packet.offset = _input_packet.data.cbegin();
 
-  uint32_t result = postgres_wire_handler.handle_startup_package(_input_packet);
-  ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
+  const auto result = postgres_wire_handler.handle_startup_package(_input_packet);
+  EXPECT_EQ(result.type, StartupPacketType::Startup);
+  ASSERT_EQ(result.payload_length, 92ul);  // 100 - 2 * sizeof(uint32_t)
+}
+
+TEST_F(PostgresWireHandlerTest, HandleCancelRequest) {
+  // A CancelRequest consists of the length, the magic version 80877102, the process id, and the secret key
+  ByteBuffer buffer = {};
+  for (const auto value : {uint32_t{16}, uint32_t{80877102}, uint32_t{42}, uint32_t{17}}) {
+    const auto network_value = htonl(value);
+    const auto chars = reinterpret_cast<const char*>(&network_value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+  }
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto header = postgres_wire_handler.handle_startup_package(_input_packet);
+  EXPECT_EQ(header.type, StartupPacketType::CancelRequest);
+  ASSERT_EQ(header.payload_length, 8ul);
+
+  // handle_startup_package() resets the offset, the body follows the header
+  _input_packet.offset += 2 * sizeof(uint32_t);
+  const auto backend_key_data = postgres_wire_handler.handle_cancel_request_packet(_input_packet);
+  EXPECT_EQ(backend_key_data.process_id, 42u);
+  EXPECT_EQ(backend_key_data.secret_key, 17u);
 }
 
 TEST_F(PostgresWireHandlerTest, WriteString) {
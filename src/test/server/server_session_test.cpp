@@ -45,7 +45,7 @@ class ServerSessionTest : public BaseTest {
 
   void _configure_startup() {
     ON_CALL(*_connection, receive_startup_packet_header())
-        .WillByDefault(Return(ByMove(boost::make_ready_future(uint32_t(32)))));
+        .WillByDefault(Return(ByMove(boost::make_ready_future(StartupPacketHeader{StartupPacketType::Startup, 32}))));
     ON_CALL(*_connection, receive_startup_packet_body(_)).WillByDefault(Return(ByMove(boost::make_ready_future())));
   }
 
@@ -60,6 +60,9 @@ class ServerSessionTest : public BaseTest {
     // (i.e. don't throw an exception)
     ON_CALL(*_connection, send_ssl_denied()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
     ON_CALL(*_connection, send_auth()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, send_backend_key_data(_, _)).WillByDefault(Invoke([](uint32_t, uint32_t) {
+      return boost::make_ready_future();
+    }));
     ON_CALL(*_connection, send_parameter_status(_, _)).WillByDefault(Invoke([](const std::string&, const std::string&) {
       return boost::make_ready_future();
     }));
@@ -76,12 +79,22 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::optional<std::string>>&) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_in_response(_, _)).WillByDefault(Invoke([](FormatCode, uint16_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_out_response(_, _)).WillByDefault(Invoke([](FormatCode, uint16_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_data(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
+    ON_CALL(*_connection, flush()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
   }
 
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
@@ -98,7 +111,7 @@ class ServerSessionTest : public BaseTest {
 
 TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Use this magic value to check if the session performs the correct calls
-  uint32_t startup_packet_header_length(42);
+  const auto startup_packet_header = StartupPacketHeader{StartupPacketType::Startup, 42};
 
   // This tells googlemock to check that the calls to the session are being made
   // in the same order that we specify below
@@ -107,13 +120,15 @@ TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Override the default mock implementation defined in _configure_startup by returning the magic value
   // as the header length.
   EXPECT_CALL(*_connection, receive_startup_packet_header())
-      .WillOnce(Return(ByMove(boost::make_ready_future(startup_packet_header_length))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(startup_packet_header))));
 
   // Make sure receive_startup_packet_body is called with the magic value defined above
-  EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header_length));
+  EXPECT_CALL(*_connection, receive_startup_packet_body(42u));
 
-  // Expect that the session sends out an authentication response and an initial ReadyForQuery
+  // Expect that the session sends out an authentication response, its key for CancelRequests, and an initial
+  // ReadyForQuery
   EXPECT_CALL(*_connection, send_auth());
+  EXPECT_CALL(*_connection, send_backend_key_data(_, _));
   EXPECT_CALL(*_connection, send_parameter_status(_, _)).Times(2);
   EXPECT_CALL(*_connection, send_ready_for_query());
 
@@ -136,13 +151,12 @@ TEST_F(ServerSessionTest, SessionHandlesConnectionErrorsDuringStartup) {
 }
 
 TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
-  // 0 is what the connection reports as the header size when it receives an SSL request
-  uint32_t ssl_startup_packet_header_length(0);
+  const auto ssl_startup_packet_header = StartupPacketHeader{StartupPacketType::SslRequest, 0};
 
   InSequence s;
 
   EXPECT_CALL(*_connection, receive_startup_packet_header())
-      .WillOnce(Return(ByMove(boost::make_ready_future(ssl_startup_packet_header_length))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(ssl_startup_packet_header))));
   EXPECT_CALL(*_connection, send_ssl_denied());
 
   EXPECT_CALL(*_connection, receive_startup_packet_header());
@@ -155,6 +169,22 @@ TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionHandlesCancelRequestDuringStartup) {
+  const auto cancel_request_header = StartupPacketHeader{StartupPacketType::CancelRequest, 8};
+
+  EXPECT_CALL(*_connection, receive_startup_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(cancel_request_header))));
+  EXPECT_CALL(*_connection, receive_cancel_request_packet_body(8u))
+      .WillOnce(Return(ByMove(boost::make_ready_future(BackendKeyData{42, 17}))));
+
+  // A connection that carries a CancelRequest does not start a session
+  EXPECT_CALL(*_connection, receive_startup_packet_body(_)).Times(0);
+  EXPECT_CALL(*_connection, send_auth()).Times(0);
+  EXPECT_CALL(*_connection, receive_packet_header()).Times(0);
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionShutsDownOnTerminationPacket) {
   InSequence s;
 
@@ -245,6 +275,35 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionSetsStatementTimeoutInSimpleQueryCommand) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SET statement_timeout = '5s';")))));
+
+  // The statement is watched for a disconnect of the client while it is executed
+  EXPECT_CALL(*_connection, watch_for_disconnect(_));
+
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->statement_timeout = std::chrono::seconds{5};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  // The timeout is kept by the session, no SQLPipeline is executed
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>())).Times(0);
+  EXPECT_CALL(*_connection, send_command_complete("SET"));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  EXPECT_CALL(*_connection, stop_watching_for_disconnect());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   InSequence s;
 
@@ -290,7 +349,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
       .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
 
   EXPECT_CALL(*_connection, receive_execute_packet_body(42))
-      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("")))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 0}))));
 
   // The session executes the SQLPipeline using another scheduled task
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
@@ -316,6 +375,174 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionFlushesConnectionOnFlushCommand) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader flush_request{NetworkMessageType::FlushCommand, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(flush_request))));
+
+  EXPECT_CALL(*_connection, receive_flush_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // Buffered responses are sent, but unlike Sync, Flush is not answered with ReadyForQuery
+  EXPECT_CALL(*_connection, flush());
+
+  // Session accepts the next query
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionHandlesManyPipelinedMessages) {
+  // Messages that were read ahead are ready right away. Handling them must not nest a stack frame per message.
+  constexpr auto SYNC_COUNT = size_t{100'000};
+
+  auto received_header_count = size_t{0};
+  EXPECT_CALL(*_connection, receive_packet_header()).Times(SYNC_COUNT + 1).WillRepeatedly(Invoke([&]() {
+    const auto message_type =
+        received_header_count++ < SYNC_COUNT ? NetworkMessageType::SyncCommand : NetworkMessageType::TerminateCommand;
+    return boost::make_ready_future(RequestHeader{message_type, 0});
+  }));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(0)).Times(SYNC_COUNT).WillRepeatedly(Invoke([](uint32_t) {
+    return boost::make_ready_future();
+  }));
+
+  // One ReadyForQuery after the startup and one per Sync
+  EXPECT_CALL(*_connection, send_ready_for_query()).Times(SYNC_COUNT + 1);
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionReusesPlansOfRepeatedUnnamedStatements) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  ParsePacket parse_packet = {"", "SELECT * FROM foo;"};
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  BindPacket bind_packet = {"", "", {}};
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  const auto placeholder_plan = sql_pipeline->get_physical_plans().front();
+
+  // The first Parse and Bind commands create the prepared plan and the physical plan
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+  auto parse_server_prepared_plan_result =
+      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(placeholder_plan->deep_copy()))));
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+
+  // The same SQL string is parsed and bound again without dispatching any tasks
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionHandlesCopyToStdoutInSimpleQueryCommand) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY foo TO STDOUT BINARY;")))));
+
+  // The CreatePipelineTask detects the COPY command and creates a pipeline for its query
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline = _create_working_sql_pipeline();
+  create_pipeline_result->copy_to_stdout_format = FormatCode::Binary;
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // The result is sent as CopyData messages: the binary header, one per row, and the binary trailer
+  EXPECT_CALL(*_connection, send_copy_out_response(FormatCode::Binary, 1));
+  EXPECT_CALL(*_connection, send_copy_data(_)).Times(5);
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::CopyDone));
+  EXPECT_CALL(*_connection, send_command_complete("COPY 3"));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionHandlesCopyFromStdinInSimpleQueryCommand) {
+  InSequence s;
+
+  // Creates the table foo
+  _create_working_sql_pipeline();
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY foo FROM STDIN CSV;")))));
+
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy_from_stdin_table = "foo";
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  EXPECT_CALL(*_connection, send_copy_in_response(FormatCode::Text, 1));
+
+  // The client sends the data in two CopyData messages, followed by CopyDone
+  RequestHeader copy_data_request{NetworkMessageType::CopyData, 4};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+  EXPECT_CALL(*_connection, receive_copy_data_packet_body(4))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("1\n2\n")))));
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+  EXPECT_CALL(*_connection, receive_copy_data_packet_body(4))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("3\n4\n")))));
+
+  RequestHeader copy_done_request{NetworkMessageType::CopyDone, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_done_request))));
+  EXPECT_CALL(*_connection, receive_copy_done_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // The session appends the data using a scheduled task
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CopyFromStdinServerTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(uint64_t{4}))));
+
+  EXPECT_CALL(*_connection, send_command_complete("COPY 4"));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   InSequence s;
 
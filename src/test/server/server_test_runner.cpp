@@ -29,7 +29,8 @@ class /* #1357 */ DISABLED_ServerTestRunner : public BaseTest {
     auto cv = std::make_shared<std::condition_variable>();
 
     auto server_runner = [&, cv](boost::asio::io_service& io_service) {
-      Server server{io_service, /* port = */ 0};  // run on port 0 so the server can pick a free one
+      // Run on port 0 so the server can pick a free one. Two I/O threads, so that concurrent sessions are spread.
+      Server server{io_service, /* port = */ 0, /* io_thread_count = */ 2};
 
       {
         std::unique_lock<std::mutex> lock{mutex};
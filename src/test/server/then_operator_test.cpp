@@ -0,0 +1,59 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/then_operator.hpp"
+
+namespace opossum {
+
+using opossum::then_operator::then;
+
+class ThenOperatorTest : public BaseTest {};
+
+TEST_F(ThenOperatorTest, ReadyFutures) {
+  // Continuations of ready futures are called right away
+  auto called = false;
+  auto future = boost::make_ready_future(3) >> then >> [&](int value) {
+    called = true;
+    return value * 2;
+  };
+  EXPECT_TRUE(called);
+  EXPECT_EQ(future.get(), 6);
+
+  auto nested_future =
+      boost::make_ready_future() >> then >> []() { return boost::make_ready_future(std::string{"value"}); };
+  EXPECT_EQ(nested_future.get(), "value");
+
+  auto move_only_future =
+      boost::make_ready_future(std::make_unique<int>(5)) >> then >> [](std::unique_ptr<int> value) { return *value; };
+  EXPECT_EQ(move_only_future.get(), 5);
+}
+
+TEST_F(ThenOperatorTest, PendingFutures) {
+  auto promise = boost::promise<int>{};
+  auto future = promise.get_future() >> then >> [](int value) { return boost::make_ready_future(value + 1); };
+  EXPECT_FALSE(future.is_ready());
+
+  promise.set_value(4);
+  EXPECT_EQ(future.get(), 5);
+}
+
+TEST_F(ThenOperatorTest, Exceptions) {
+  // Exceptions of the incoming future skip the continuation
+  auto called = false;
+  auto failed_future =
+      boost::make_exceptional_future<int>(std::runtime_error("incoming")) >> then >> [&](int) { called = true; };
+  EXPECT_THROW(failed_future.get(), std::runtime_error);
+  EXPECT_FALSE(called);
+
+  // Exceptions of the continuation are stored in the resulting future
+  auto throwing_future = boost::make_ready_future() >> then >> []() -> boost::future<int> {
+    throw std::runtime_error("continuation");
+  };
+  EXPECT_THROW(throwing_future.get(), std::runtime_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#include <string>
+
+#include "base_test.hpp"
+
+#include "sql/normalize_sql_literals.hpp"
+
+namespace opossum {
+
+class NormalizeSQLLiteralsTest : public BaseTest {};
+
+TEST_F(NormalizeSQLLiteralsTest, ReplacesLiteralsInWhereClause) {
+  const auto normalized_sql = normalize_sql_literals("SELECT a FROM t WHERE a = 17 AND b > 1.5 AND c LIKE 'x%'");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT a FROM t WHERE a = ? AND b > ? AND c LIKE ?");
+  ASSERT_EQ(normalized_sql->literal_values.size(), 3u);
+  EXPECT_EQ(normalized_sql->literal_values[0], AllTypeVariant{int32_t{17}});
+  EXPECT_EQ(normalized_sql->literal_values[1], AllTypeVariant{1.5});
+  EXPECT_EQ(normalized_sql->literal_values[2], AllTypeVariant{pmr_string{"x%"}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, SameNormalizedSQLForDifferentValues) {
+  const auto normalized_sql_a = normalize_sql_literals("SELECT * FROM t WHERE id = 17");
+  const auto normalized_sql_b = normalize_sql_literals("SELECT * FROM t WHERE id = 18");
+  ASSERT_TRUE(normalized_sql_a && normalized_sql_b);
+
+  EXPECT_EQ(normalized_sql_a->cache_key(), normalized_sql_b->cache_key());
+  EXPECT_NE(normalized_sql_a->literal_values, normalized_sql_b->literal_values);
+}
+
+TEST_F(NormalizeSQLLiteralsTest, DataTypesArePartOfTheCacheKey) {
+  const auto normalized_sql_int = normalize_sql_literals("SELECT * FROM t WHERE id = 17");
+  const auto normalized_sql_long = normalize_sql_literals("SELECT * FROM t WHERE id = 17179869184");
+  const auto normalized_sql_double = normalize_sql_literals("SELECT * FROM t WHERE id = 17.0");
+  ASSERT_TRUE(normalized_sql_int && normalized_sql_long && normalized_sql_double);
+
+  EXPECT_EQ(normalized_sql_long->literal_values[0], AllTypeVariant{int64_t{17179869184}});
+  EXPECT_EQ(normalized_sql_int->sql, normalized_sql_long->sql);
+  EXPECT_NE(normalized_sql_int->cache_key(), normalized_sql_long->cache_key());
+  EXPECT_NE(normalized_sql_int->cache_key(), normalized_sql_double->cache_key());
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsLiteralsOutsideOfPredicates) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT a + 1, 'x' FROM t WHERE a = 2 GROUP BY a HAVING COUNT(*) > 3 ORDER BY 1 LIMIT 4");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql,
+            "SELECT a + 1, 'x' FROM t WHERE a = ? GROUP BY a HAVING COUNT(*) > ? ORDER BY 1 LIMIT 4");
+  EXPECT_EQ(normalized_sql->literal_values, (std::vector<AllTypeVariant>{int32_t{2}, int32_t{3}}));
+
+  EXPECT_FALSE(normalize_sql_literals("SELECT 1, 'x' FROM t LIMIT 10"));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, Subqueries) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT * FROM t WHERE a IN (SELECT b + 1 FROM u WHERE c = 2 LIMIT 3) AND d < 4");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a IN (SELECT b + 1 FROM u WHERE c = ? LIMIT 3) AND d < ?");
+  EXPECT_EQ(normalized_sql->literal_values, (std::vector<AllTypeVariant>{int32_t{2}, int32_t{4}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, InsertAndUpdate) {
+  const auto normalized_insert = normalize_sql_literals("INSERT INTO t (a, b) VALUES (1, 'one')");
+  ASSERT_TRUE(normalized_insert);
+  EXPECT_EQ(normalized_insert->sql, "INSERT INTO t (a, b) VALUES (?, ?)");
+
+  const auto normalized_update = normalize_sql_literals("UPDATE t SET b = 'two' WHERE a = 2");
+  ASSERT_TRUE(normalized_update);
+  EXPECT_EQ(normalized_update->sql, "UPDATE t SET b = ? WHERE a = ?");
+  EXPECT_EQ(normalized_update->literal_values, (std::vector<AllTypeVariant>{pmr_string{"two"}, int32_t{2}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, IgnoresIdentifiersCommentsAndQuotedNames) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT * FROM t1 WHERE \"col 1\" = 5 -- a = 6\n AND /* 7 */ col2 = 't''s' AND x2 = 8");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql,
+            "SELECT * FROM t1 WHERE \"col 1\" = ? -- a = 6\n AND /* 7 */ col2 = 't''s' AND x2 = ?");
+  EXPECT_EQ(normalized_sql->literal_values, (std::vector<AllTypeVariant>{int32_t{5}, int32_t{8}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsTypeArguments) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE CAST(a AS CHAR(10)) = '5'");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE CAST(a AS CHAR(10)) = ?");
+}
+
+TEST_F(NormalizeSQLLiteralsTest, DoesNotNormalizeStatementsWithPlaceholders) {
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = ? AND b = 5"));
+  EXPECT_TRUE(normalize_sql_literals("SELECT * FROM t WHERE a = '?' AND b = 5"));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, LiteralParameterIDs) {
+  EXPECT_NE(literal_parameter_id(0), literal_parameter_id(1));
+  EXPECT_GT(literal_parameter_id(1023), ParameterID{1'000'000});
+}
+
+}  // namespace opossum
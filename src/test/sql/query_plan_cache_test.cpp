@@ -8,6 +8,7 @@
 #include "cache/gdfs_cache.hpp"
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -29,6 +30,12 @@ class QueryPlanCacheTest : public BaseTest {
     SQLPhysicalPlanCache::get().clear();
   }
 
+  void TearDown() override {
+    SQLPhysicalPlanCache::get().replace_cache_impl<GDFSCache<std::string, std::shared_ptr<AbstractOperator>>>(
+        DefaultCacheCapacity);
+    SQLPhysicalPlanCache::get().set_admission_filter_enabled(true);
+  }
+
   void execute_query(const std::string& query) {
     auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
     pipeline_statement.get_result_table();
@@ -68,6 +75,7 @@ TEST_F(QueryPlanCacheTest, QueryPlanCacheTest) {
 TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRU) {
   auto& cache = SQLPhysicalPlanCache::get();
   cache.replace_cache_impl<LRUCache<std::string, std::shared_ptr<AbstractOperator>>>(2);
+  cache.set_admission_filter_enabled(false);
 
   // Execute the queries in arbitrary order.
   execute_query(Q1);  // Miss.
@@ -94,6 +102,7 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRU) {
 TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheGDFS) {
   auto& cache = SQLPhysicalPlanCache::get();
   cache.replace_cache_impl<GDFSCache<std::string, std::shared_ptr<AbstractOperator>>>(2);
+  cache.set_admission_filter_enabled(false);
 
   // Execute the queries in arbitrary order.
   execute_query(Q1);  // Miss.
@@ -124,6 +133,7 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheGDFS) {
 TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
   auto& cache = SQLPhysicalPlanCache::get();
   cache.replace_cache_impl<LRUKCache<2, std::string, std::shared_ptr<AbstractOperator>>>(2);
+  cache.set_admission_filter_enabled(false);
 
   // Execute the queries in arbitrary order.
   execute_query(Q1);  // Miss.
@@ -147,4 +157,61 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
   EXPECT_EQ(5u, _query_plan_cache_hits);
 }
 
+// Test that one-off queries do not evict the plans of frequent queries from a full cache.
+TEST_F(QueryPlanCacheTest, AdmissionFilter) {
+  auto& cache = SQLPhysicalPlanCache::get();
+  cache.replace_cache_impl<GDFSCache<std::string, std::shared_ptr<AbstractOperator>>>(2);
+  cache.reset_metrics();
+
+  for (auto iteration = 0; iteration < 3; ++iteration) {
+    execute_query(Q1);
+    execute_query(Q2);
+  }
+  EXPECT_EQ(4u, _query_plan_cache_hits);
+
+  execute_query(Q3);  // Miss, rejected.
+  EXPECT_FALSE(cache.has(Q3));
+  execute_query(Q1);  // Hit.
+  execute_query(Q2);  // Hit.
+  EXPECT_EQ(6u, _query_plan_cache_hits);
+
+  const auto metrics = cache.metrics();
+  EXPECT_EQ(metrics.hits, 6u);
+  EXPECT_EQ(metrics.misses, 3u);
+  EXPECT_EQ(metrics.rejected_admissions, 1u);
+  EXPECT_EQ(metrics.evictions, 0u);
+
+  // Once it was executed more often than the plan the policy would evict, Q3's plan is admitted
+  for (auto iteration = 0; iteration < 5; ++iteration) {
+    execute_query(Q3);
+  }
+  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_EQ(cache.metrics().evictions, 1u);
+}
+
+// Test query plan caches with sharded implementation.
+TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheSharded) {
+  auto& physical_plan_cache = SQLPhysicalPlanCache::get();
+  physical_plan_cache.replace_cache_impl<ShardedCache<std::string, std::shared_ptr<AbstractOperator>>>(128);
+  auto& logical_plan_cache = SQLLogicalPlanCache::get();
+  logical_plan_cache.replace_cache_impl<ShardedCache<std::string, std::shared_ptr<AbstractLQPNode>>>(128);
+
+  execute_query(Q1);  // Miss.
+  execute_query(Q2);  // Miss.
+  execute_query(Q1);  // Hit.
+  execute_query(Q3);  // Miss.
+  execute_query(Q2);  // Hit.
+
+  EXPECT_TRUE(physical_plan_cache.has(Q1));
+  EXPECT_TRUE(physical_plan_cache.has(Q2));
+  EXPECT_TRUE(physical_plan_cache.has(Q3));
+  EXPECT_TRUE(logical_plan_cache.has(Q1));
+  EXPECT_EQ(physical_plan_cache.size(), 3u);
+
+  EXPECT_EQ(2u, _query_plan_cache_hits);
+
+  logical_plan_cache.replace_cache_impl<GDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>>(
+      DefaultCacheCapacity);
+}
+
 }  // namespace opossum
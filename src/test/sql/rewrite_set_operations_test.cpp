@@ -0,0 +1,48 @@
+#include <string>
+
+#include "base_test.hpp"
+
+#include "sql/rewrite_set_operations.hpp"
+#include "utils/invalid_input_exception.hpp"
+
+namespace opossum {
+
+class RewriteSetOperationsTest : public BaseTest {};
+
+TEST_F(RewriteSetOperationsTest, MarksRightInput) {
+  EXPECT_EQ(rewrite_set_operations("SELECT a FROM t INTERSECT SELECT b FROM u"),
+            "SELECT a FROM t UNION SELECT 'hyrise_set_operation:INTERSECT', b FROM u");
+  EXPECT_EQ(rewrite_set_operations("SELECT a FROM t except all (select distinct * FROM u) ORDER BY a"),
+            "SELECT a FROM t UNION (select distinct 'hyrise_set_operation:EXCEPT ALL', * FROM u) ORDER BY a");
+}
+
+TEST_F(RewriteSetOperationsTest, LeavesOtherStatementsAlone) {
+  const auto sql = std::string{"SELECT 'EXCEPT' FROM t UNION SELECT \"INTERSECT\" FROM u -- EXCEPT"};
+  EXPECT_EQ(rewrite_set_operations(sql), sql);
+}
+
+TEST_F(RewriteSetOperationsTest, RejectsMarkers) {
+  // Strings of the user cannot be mistaken for markers, so rewritten statements are not rewritten again
+  const auto rewritten_sql = rewrite_set_operations("SELECT a FROM t INTERSECT ALL SELECT b FROM u");
+  EXPECT_THROW(rewrite_set_operations(rewritten_sql), InvalidInputException);
+  EXPECT_THROW(rewrite_set_operations("SELECT a FROM t UNION SELECT 'hyrise_set_operation:EXCEPT', b FROM u"),
+               InvalidInputException);
+  EXPECT_THROW(rewrite_set_operations("SELECT a FROM t WHERE b = 'hyrise_set_operation:'"), InvalidInputException);
+}
+
+TEST_F(RewriteSetOperationsTest, ParsesMarkers) {
+  const auto set_operation = parse_set_operation_marker("hyrise_set_operation:EXCEPT ALL");
+  ASSERT_TRUE(set_operation);
+  EXPECT_EQ(set_operation->type, SetOperationType::Except);
+  EXPECT_EQ(set_operation->mode, SetOperationMode::All);
+
+  EXPECT_FALSE(parse_set_operation_marker("EXCEPT ALL"));
+  EXPECT_FALSE(parse_set_operation_marker("hyrise_set_operation:UNION"));
+}
+
+TEST_F(RewriteSetOperationsTest, RejectsInvalidSetOperations) {
+  EXPECT_THROW(rewrite_set_operations("SELECT a FROM t INTERSECT"), InvalidInputException);
+  EXPECT_THROW(rewrite_set_operations("SELECT a FROM t EXCEPT VALUES (1)"), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include <string>
+
+#include "base_test.hpp"
+
+#include "sql/rewrite_table_samples.hpp"
+#include "utils/invalid_input_exception.hpp"
+
+namespace opossum {
+
+class RewriteTableSamplesTest : public BaseTest {};
+
+TEST_F(RewriteTableSamplesTest, MovesSampleIntoTableName) {
+  EXPECT_EQ(rewrite_table_samples("SELECT * FROM t TABLESAMPLE SYSTEM (10) WHERE a = 1"),
+            "SELECT * FROM \"t TABLESAMPLE SYSTEM (10)\" AS t WHERE a = 1");
+  EXPECT_EQ(rewrite_table_samples("SELECT * FROM t AS x tablesample bernoulli (0.5) repeatable (42)"),
+            "SELECT * FROM \"t TABLESAMPLE BERNOULLI (0.5) REPEATABLE (42)\" AS x");
+  EXPECT_EQ(rewrite_table_samples("SELECT * FROM a, \"b\" y TABLESAMPLE SYSTEM (1) JOIN c TABLESAMPLE SYSTEM (2) ON 1"),
+            "SELECT * FROM a, \"b TABLESAMPLE SYSTEM (1)\" AS y JOIN \"c TABLESAMPLE SYSTEM (2)\" AS c ON 1");
+}
+
+TEST_F(RewriteTableSamplesTest, LeavesOtherStatementsAlone) {
+  const auto sql = std::string{"SELECT 'TABLESAMPLE' FROM t -- TABLESAMPLE\n WHERE \"TABLESAMPLE\" = 1"};
+  EXPECT_EQ(rewrite_table_samples(sql), sql);
+}
+
+TEST_F(RewriteTableSamplesTest, RejectsRewrittenSamples) {
+  // Quoted names cannot be mistaken for rewritten samples, so rewritten statements are not rewritten again
+  const auto rewritten_sql = rewrite_table_samples("SELECT * FROM t TABLESAMPLE BERNOULLI (1)");
+  EXPECT_THROW(rewrite_table_samples(rewritten_sql), InvalidInputException);
+  EXPECT_THROW(rewrite_table_samples("SELECT * FROM \"t TABLESAMPLE SYSTEM (1)\""), InvalidInputException);
+  EXPECT_THROW(rewrite_table_samples("SELECT \"a TABLESAMPLE b\" FROM t"), InvalidInputException);
+}
+
+TEST_F(RewriteTableSamplesTest, RejectsInvalidSamples) {
+  EXPECT_THROW(rewrite_table_samples("SELECT * FROM t TABLESAMPLE RANDOM (1)"), InvalidInputException);
+  EXPECT_THROW(rewrite_table_samples("SELECT * FROM t TABLESAMPLE SYSTEM (101)"), InvalidInputException);
+  EXPECT_THROW(rewrite_table_samples("SELECT * FROM t TABLESAMPLE SYSTEM 1"), InvalidInputException);
+  EXPECT_THROW(rewrite_table_samples("SELECT * FROM t TABLESAMPLE SYSTEM (1) REPEATABLE (1.5)"), InvalidInputException);
+  EXPECT_THROW(rewrite_table_samples("SELECT * FROM (SELECT * FROM t) TABLESAMPLE SYSTEM (1)"),
+               InvalidInputException);
+}
+
+TEST_F(RewriteTableSamplesTest, SplitTableSample) {
+  EXPECT_EQ(split_table_sample("t"), std::make_pair(std::string{"t"}, std::optional<TableSample>{}));
+
+  const auto [table_name, table_sample] = split_table_sample("t TABLESAMPLE BERNOULLI (0.5) REPEATABLE (42)");
+  EXPECT_EQ(table_name, "t");
+  ASSERT_TRUE(table_sample);
+  EXPECT_EQ(*table_sample, (TableSample{TableSampleMethod::Bernoulli, 0.5, 42}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include <string>
+
+#include "base_test.hpp"
+
+#include "sql/rewrite_window_functions.hpp"
+#include "utils/invalid_input_exception.hpp"
+
+namespace opossum {
+
+class RewriteWindowFunctionsTest : public BaseTest {};
+
+TEST_F(RewriteWindowFunctionsTest, WrapsWindowFunctions) {
+  EXPECT_EQ(rewrite_window_functions("SELECT ROW_NUMBER() OVER () FROM t"),
+            "SELECT WINDOW_FUNCTION(ROW_NUMBER(), '') FROM t");
+  EXPECT_EQ(rewrite_window_functions("SELECT a, sum(b) over (partition by a, c + 1 order by (d), e desc nulls last) x"),
+            "SELECT a, WINDOW_FUNCTION(sum(b), 'PARTITION BY ?, ? ORDER BY ?, ? DESC NULLS LAST', a, c + 1, (d), e) x");
+  EXPECT_EQ(rewrite_window_functions("SELECT MIN(a) OVER (ORDER BY b ROWS BETWEEN 3 PRECEDING AND 1 FOLLOWING) FROM t"),
+            "SELECT WINDOW_FUNCTION(MIN(a), 'ORDER BY ? ROWS BETWEEN 3 PRECEDING AND 1 FOLLOWING', b) FROM t");
+
+  // The default frame is omitted, `ROWS <start>` ends at the current row
+  EXPECT_EQ(rewrite_window_functions("SELECT COUNT(*) OVER (RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW)"),
+            "SELECT WINDOW_FUNCTION(COUNT(*), '')");
+  EXPECT_EQ(rewrite_window_functions("SELECT AVG(a) OVER (ROWS UNBOUNDED PRECEDING)"),
+            "SELECT WINDOW_FUNCTION(AVG(a), 'ROWS BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW')");
+}
+
+TEST_F(RewriteWindowFunctionsTest, LeavesOtherStatementsAlone) {
+  const auto sql = std::string{"SELECT 'SUM(a) OVER ()', \"over\" FROM t -- MAX(a) OVER ()\n WHERE over = 1"};
+  EXPECT_EQ(rewrite_window_functions(sql), sql);
+}
+
+TEST_F(RewriteWindowFunctionsTest, RejectsInvalidWindows) {
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER w FROM t"), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER (PARTITION a) FROM t"), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER (ORDER BY) FROM t"), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER (ROWS 1 FOLLOWING) FROM t"), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER (RANGE 1 PRECEDING) FROM t"), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER (ORDER BY a GROUPS 1 PRECEDING) FROM t"),
+               InvalidInputException);
+}
+
+TEST_F(RewriteWindowFunctionsTest, RejectsPseudoFunction) {
+  const auto rewritten_sql = rewrite_window_functions("SELECT SUM(a) OVER (PARTITION BY b) FROM t");
+  EXPECT_THROW(rewrite_window_functions(rewritten_sql), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT window_function(SUM(a), '') FROM t"), InvalidInputException);
+  EXPECT_THROW(rewrite_window_functions("SELECT SUM(a) OVER (PARTITION BY WINDOW_FUNCTION(b, '')) FROM t"),
+               InvalidInputException);
+}
+
+TEST_F(RewriteWindowFunctionsTest, ParseWindowSpecification) {
+  const auto specification =
+      parse_window_specification("PARTITION BY ?, ? ORDER BY ? DESC ROWS BETWEEN 1 PRECEDING AND UNBOUNDED FOLLOWING");
+  EXPECT_EQ(specification.partition_by_count, 2u);
+  EXPECT_EQ(specification.order_by_modes, std::vector<OrderByMode>{OrderByMode::Descending});
+  EXPECT_EQ(specification.frame, (WindowFrame{WindowFrameType::Rows, 1, std::nullopt}));
+
+  EXPECT_THROW(parse_window_specification("PARTITION BY a"), InvalidInputException);
+}
+
+}  // namespace opossum
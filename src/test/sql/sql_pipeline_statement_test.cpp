@@ -9,16 +9,21 @@
 
 #include "cache/cache.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "memory/arena_memory_resource.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task_graph.hpp"
 #include "scheduler/topology.hpp"
+#include "sql/normalize_sql_literals.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace {
@@ -485,6 +490,41 @@ TEST_F(SQLPipelineStatementTest, GetResultTableWithScheduler) {
   EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableOutlivesStatement) {
+  auto table = std::shared_ptr<const Table>{};
+  {
+    auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+    table = sql_pipeline.get_result_table();
+  }
+
+  // The PosLists of the result are allocated from the arena of the statement, which they keep alive
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_TRUE(dynamic_cast<ArenaMemoryResource*>(reference_segment->pos_list()->get_allocator().resource()));
+
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithMemoryBudget) {
+  // The join exceeds a budget of a single byte and is executed on partitions that are spilled to disk
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_memory_budget(1).create_pipeline_statement();
+  const auto& table = sql_pipeline.get_result_table();
+
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+}
+
+TEST_F(SQLPipelineStatementTest, PeakMemoryMetrics) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  sql_pipeline.get_result_table();
+
+  // The arena of the statement allocated at least its first block for the PosLists of the join
+  const auto& metrics = sql_pipeline.metrics();
+  EXPECT_GE(metrics->peak_memory_bytes, ArenaMemoryResource::INITIAL_BLOCK_SIZE);
+  EXPECT_EQ(metrics->peak_memory_bytes, sql_pipeline.memory_budget()->peak_bytes());
+  EXPECT_EQ(AdmissionController::get().running_statement_count(), 0u);
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTableNoOutput) {
   const auto sql = "UPDATE table_a SET a = 1 WHERE a < 5";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline_statement();
@@ -555,6 +595,33 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(cache.has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, CachedQueryPlanTaskGraph) {
+  auto first_sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  const auto first_result = first_sql_pipeline.get_result_table();
+
+  auto& cache = SQLPhysicalPlanCache::get();
+  const auto cached_plan = cache.get_entry(_select_query_a);
+  EXPECT_EQ(cached_plan->task_graph(), nullptr);
+
+  // The second execution builds the task graph of the cached plan and executes a copy created from it
+  auto second_sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  const auto& tasks = second_sql_pipeline.get_tasks();
+  EXPECT_TRUE(second_sql_pipeline.metrics()->query_plan_cache_hit);
+
+  const auto task_graph = cached_plan->task_graph();
+  ASSERT_NE(task_graph, nullptr);
+  EXPECT_EQ(tasks.size(), task_graph->task_count());
+  EXPECT_EQ(tasks.back()->get_operator(), second_sql_pipeline.get_physical_plan());
+  EXPECT_NE(second_sql_pipeline.get_physical_plan(), cached_plan);
+
+  EXPECT_TABLE_EQ_UNORDERED(second_sql_pipeline.get_result_table(), first_result);
+
+  // Later executions reuse the graph
+  auto third_sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(third_sql_pipeline.get_result_table(), first_result);
+  EXPECT_EQ(cached_plan->task_graph(), task_graph);
+}
+
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   const auto subquery_query = "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)";
 
@@ -579,4 +646,98 @@ TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   EXPECT_TABLE_EQ_UNORDERED(second_subquery_result, expected_second_result);
 }
 
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCaching) {
+  const auto query_9 = "SELECT * FROM table_int WHERE a = 9";
+  const auto query_11 = "SELECT * FROM table_int WHERE a = 11";
+
+  auto first_sql_pipeline = SQLPipelineBuilder{query_9}.with_parameterized_plan_caching().create_pipeline_statement();
+  const auto first_result = first_sql_pipeline.get_result_table();
+  EXPECT_FALSE(first_sql_pipeline.metrics()->query_plan_cache_hit);
+
+  auto expected_first_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_first_result->append({9, 10, 11});
+  expected_first_result->append({9, 10, 9});
+  EXPECT_TABLE_EQ_UNORDERED(first_result, expected_first_result);
+
+  // The plan is cached under the normalized SQL only
+  const auto& cache = SQLPhysicalPlanCache::get();
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(cache.has(normalize_sql_literals(query_9)->cache_key()));
+
+  // A statement that only differs in its literal reuses the plan, but not the value
+  auto second_sql_pipeline = SQLPipelineBuilder{query_11}.with_parameterized_plan_caching().create_pipeline_statement();
+  const auto second_result = second_sql_pipeline.get_result_table();
+  EXPECT_TRUE(second_sql_pipeline.metrics()->query_plan_cache_hit);
+
+  auto expected_second_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_second_result->append({11, 10, 11});
+  EXPECT_TABLE_EQ_UNORDERED(second_result, expected_second_result);
+
+  // Literals of a different type do not share the plan
+  auto third_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 9.5"}
+                                .with_parameterized_plan_caching()
+                                .create_pipeline_statement();
+  EXPECT_EQ(third_sql_pipeline.get_result_table()->row_count(), 0u);
+  EXPECT_FALSE(third_sql_pipeline.metrics()->query_plan_cache_hit);
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCachingInsertAndUpdate) {
+  for (const auto value : {12, 13}) {
+    const auto insert = std::string{"INSERT INTO table_int VALUES ("} + std::to_string(value) + ", 1, 2)";
+    auto sql_pipeline = SQLPipelineBuilder{insert}.with_parameterized_plan_caching().create_pipeline_statement();
+    sql_pipeline.get_result_table();
+    EXPECT_EQ(sql_pipeline.metrics()->query_plan_cache_hit, value == 13);
+  }
+
+  for (const auto value : {12, 13}) {
+    const auto update = std::string{"UPDATE table_int SET c = "} + std::to_string(value * 2) +
+                        " WHERE a = " + std::to_string(value);
+    auto sql_pipeline = SQLPipelineBuilder{update}.with_parameterized_plan_caching().create_pipeline_statement();
+    sql_pipeline.get_result_table();
+    EXPECT_EQ(sql_pipeline.metrics()->query_plan_cache_hit, value == 13);
+  }
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a > 11"}.create_pipeline_statement();
+
+  auto expected_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_result->append({12, 1, 24});
+  expected_result->append({13, 1, 26});
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), expected_result);
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCachingWithoutLiterals) {
+  auto sql_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_parameterized_plan_caching().create_pipeline_statement();
+  sql_pipeline.get_result_table();
+
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(_select_query_a));
+}
+
+TEST_F(SQLPipelineStatementTest, AdaptiveReoptimization) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("id", DataType::Int);
+  column_definitions.emplace_back("s", DataType::String);
+
+  for (const auto& table_name : {"t1", "t2", "t3"}) {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 50, UseMvcc::Yes);
+    for (auto id = int32_t{0}; id < 100; ++id) table->append({id, "x"});
+    StorageManager::get().add_table(table_name, table);
+  }
+
+  // LIKE predicates are estimated with a fixed selectivity, so that the first join is expected to return a single row
+  const auto query =
+      "SELECT * FROM t1, t2, t3 WHERE t1.id = t2.id AND t2.id = t3.id AND t1.s LIKE '%x%' AND t1.s LIKE 'x%' AND "
+      "t2.s LIKE '%x%' AND t2.s LIKE 'x%'";
+
+  auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline_statement();
+  auto adaptive_sql_pipeline = SQLPipelineBuilder{query}.with_adaptive_reoptimization().create_pipeline_statement();
+
+  const auto& result_table = adaptive_sql_pipeline.get_result_table();
+  EXPECT_EQ(result_table->row_count(), 100u);
+  EXPECT_TABLE_EQ_UNORDERED(result_table, sql_pipeline.get_result_table());
+  EXPECT_GE(adaptive_sql_pipeline.metrics()->reoptimization_count, 1u);
+  EXPECT_EQ(sql_pipeline.metrics()->reoptimization_count, 0u);
+}
+
 }  // namespace opossum
@@ -19,6 +19,7 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/invalid_input_exception.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinOrderingRule and
@@ -419,6 +420,54 @@ TEST_F(SQLPipelineTest, GetResultTableBadQuery) {
   EXPECT_THROW(sql_pipeline.get_result_table(), std::exception);
 }
 
+TEST_F(SQLPipelineTest, GetResultTableMultipleWithScheduler) {
+  // The SELECT is translated while the INSERT is executed, but it is executed in a new transaction that sees the row
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto sql_pipeline = SQLPipelineBuilder{_multi_statement_query}.create_pipeline();
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _table_a_multi);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableBadQueryInBatch) {
+  // The error of the second statement is only thrown after the first statement has been executed
+  const auto row_count = _table_a->row_count();
+  auto sql_pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (11, 11.11); SELECT a + not_a_column FROM table_a"}
+                          .create_pipeline();
+
+  EXPECT_THROW(sql_pipeline.get_result_table(), std::exception);
+  EXPECT_EQ(_table_a->row_count(), row_count + 1);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableCreateAndSelectInBatch) {
+  // Each statement may only be translated once the CREATE statement before it has been executed, even though the
+  // statements are prepared while their predecessors execute
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto sql_pipeline = SQLPipelineBuilder{
+      "CREATE TABLE created_table (a INT); INSERT INTO created_table VALUES (1); INSERT INTO created_table VALUES (2); "
+      "CREATE VIEW created_view AS SELECT * FROM created_table WHERE a > 1; SELECT * FROM created_view"}
+                          .create_pipeline();
+  EXPECT_TRUE(sql_pipeline.requires_execution());
+
+  const auto& tables = sql_pipeline.get_result_tables();
+  ASSERT_EQ(tables.size(), 5u);
+  ASSERT_EQ(tables.back()->row_count(), 1u);
+  EXPECT_EQ(tables.back()->get_value<int32_t>(ColumnID{0}, 0), 2);
+  EXPECT_EQ(StorageManager::get().get_table("created_table")->row_count(), 2u);
+}
+
+TEST_F(SQLPipelineTest, GetResultTablePrepareAndExecuteInBatch) {
+  // The EXECUTE statement is only translated once the PREPARE statement has been executed
+  auto sql_pipeline =
+      SQLPipelineBuilder{"PREPARE select_a FROM 'SELECT * FROM table_a WHERE a = ?'; EXECUTE select_a (12345)"}
+          .create_pipeline();
+
+  EXPECT_FALSE(sql_pipeline.requires_execution());
+  EXPECT_EQ(sql_pipeline.get_result_table()->row_count(), 1u);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableNoOutput) {
   const auto sql = "UPDATE table_a SET a = 1 WHERE a < 150";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
@@ -458,6 +507,36 @@ TEST_F(SQLPipelineTest, GetTimes) {
   EXPECT_GT(statement_metrics->plan_execution_duration, zero_duration);
 }
 
+TEST_F(SQLPipelineTest, ExplainAnalyze) {
+  auto sql_pipeline = SQLPipelineBuilder{"explain analyze SELECT a FROM table_a WHERE a > 1000"}.create_pipeline();
+  const auto& table = sql_pipeline.get_result_table();
+  ASSERT_NE(table, nullptr);
+
+  // One row per operator, starting with the root of the PQP
+  const auto& pqp = sql_pipeline.get_physical_plans().at(0);
+  EXPECT_GE(table->row_count(), 3u);
+  EXPECT_EQ(table->column_names().front(), "operator");
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, 0), pmr_string{pqp->description(DescriptionMode::SingleLine)});
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{4}, 0), 2);
+  EXPECT_GT(table->get_value<int64_t>(ColumnID{1}, 0), 0);
+}
+
+TEST_F(SQLPipelineTest, ExplainAnalyzeMultipleStatements) {
+  EXPECT_THROW(SQLPipelineBuilder{"EXPLAIN ANALYZE " + _multi_statement_query}.create_pipeline(), std::exception);
+}
+
+TEST_F(SQLPipelineTest, Priority) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_priority(SchedulePriority::High).create_pipeline();
+
+  const auto& tasks = sql_pipeline.get_tasks().at(0);
+  ASSERT_FALSE(tasks.empty());
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->priority(), SchedulePriority::High);
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _join_result);
+}
+
 TEST_F(SQLPipelineTest, RequiresExecutionVariations) {
   EXPECT_FALSE(SQLPipelineBuilder{_select_query_a}.create_pipeline().requires_execution());
   EXPECT_FALSE(SQLPipelineBuilder{_join_query}.create_pipeline().requires_execution());
@@ -526,6 +605,32 @@ TEST_F(SQLPipelineTest, CorrectStatementStringSplitting) {
             "SELECT *\n  FROM foo, bar\n  WHERE foo.x = 17\n    AND bar.y = 25\n  ORDER BY foo.x ASC");
 }
 
+TEST_F(SQLPipelineTest, StatementStringsAreNotRewritten) {
+  // The SQL parser only sees the rewritten statements (see rewrite_sql_for_parser()), the statement strings and cache
+  // keys are the SQL as the user wrote it
+  const auto intersect_sql = std::string{"SELECT a FROM table_a INTERSECT SELECT a FROM table_b;"};
+  const auto sample_sql = std::string{"SELECT ';' FROM table_a TABLESAMPLE SYSTEM (100)"};
+  auto sql_pipeline = SQLPipelineBuilder{intersect_sql + "\n  " + sample_sql + "; -- done"}.create_pipeline();
+
+  const auto& statement_strings = sql_pipeline.get_sql_per_statement();
+  ASSERT_EQ(statement_strings.size(), 2u);
+  EXPECT_EQ(statement_strings.at(0), intersect_sql);
+  EXPECT_EQ(statement_strings.at(1), sample_sql + ";");
+
+  sql_pipeline.get_result_table();
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(intersect_sql));
+
+  // Errors are reported for the original SQL as well
+  try {
+    SQLPipelineBuilder{"SELECT a FROM table_a EXCEPT SELECT a FROM table_b WHERE"}.create_pipeline();
+    FAIL();
+  } catch (const InvalidInputException& exception) {
+    const auto message = std::string{exception.what()};
+    EXPECT_NE(message.find("SELECT a FROM table_a EXCEPT SELECT a FROM table_b WHERE"), std::string::npos);
+    EXPECT_EQ(message.find("hyrise_set_operation"), std::string::npos);
+  }
+}
+
 TEST_F(SQLPipelineTest, CacheQueryPlanTwice) {
   auto sql_pipeline1 = SQLPipelineBuilder{_select_query_a}.create_pipeline();
   sql_pipeline1.get_result_table();
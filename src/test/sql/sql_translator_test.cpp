@@ -8,6 +8,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/alias_node.hpp"
@@ -18,7 +19,9 @@
 #include "logical_query_plan/drop_table_node.hpp"
 #include "logical_query_plan/drop_view_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "logical_query_plan/except_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_column_reference.hpp"
@@ -31,7 +34,11 @@
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "logical_query_plan/window_node.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
+#include "sql/rewrite_set_operations.hpp"
+#include "sql/rewrite_table_samples.hpp"
+#include "sql/rewrite_window_functions.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
 #include "testing_assert.hpp"
@@ -618,6 +625,15 @@ TEST_F(SQLTranslatorTest, AggregateCount) {
   // clang-format on
   EXPECT_LQP_EQ(actual_lqp_count_distinct_a_plus_b, expected_lqp_count_distinct_a_plus_b);
 
+  const auto actual_lqp_approx_count_distinct =
+      compile_query("SELECT a, APPROX_COUNT_DISTINCT(b) FROM int_float GROUP BY a");
+  // clang-format off
+  const auto expected_lqp_approx_count_distinct =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(approx_count_distinct_(int_float_b)),
+    stored_table_node_int_float);
+  // clang-format on
+  EXPECT_LQP_EQ(actual_lqp_approx_count_distinct, expected_lqp_approx_count_distinct);
+
   const auto actual_lqp_count_1 = compile_query("SELECT a, COUNT(1) FROM int_float GROUP BY a");
   // clang-format off
   const auto expected_lqp_count_1 =
@@ -1083,6 +1099,50 @@ TEST_F(SQLTranslatorTest, FromColumnAliasingSimple) {
   EXPECT_LQP_EQ(actual_lqp_b, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, TableSample) {
+  const auto actual_lqp =
+      compile_query(rewrite_table_samples("SELECT int_float.a FROM int_float TABLESAMPLE SYSTEM (10) REPEATABLE (1)"));
+
+  const auto sampled_stored_table_node = StoredTableNode::make("int_float");
+  sampled_stored_table_node->set_table_sample(TableSample{TableSampleMethod::System, 10.0, 1});
+
+  // clang-format off
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(LQPColumnReference{sampled_stored_table_node, ColumnID{0}}),
+    sampled_stored_table_node);
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SQLTranslatorTest, WindowFunction) {
+  const auto actual_lqp = compile_query(rewrite_window_functions(
+      "SELECT a, SUM(a + 1) OVER (PARTITION BY b ORDER BY a DESC ROWS 2 PRECEDING) FROM int_float"));
+
+  const auto window_function = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Sum, add_(int_float_a, 1), expression_vector(int_float_b), expression_vector(int_float_a),
+      std::vector<OrderByMode>{OrderByMode::Descending}, WindowFrame{WindowFrameType::Rows, 2, 0});
+
+  // clang-format off
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(int_float_a, window_function),
+    ProjectionNode::make(expression_vector(int_float_a, int_float_b, window_function),
+      WindowNode::make(expression_vector(window_function),
+        ProjectionNode::make(expression_vector(int_float_a, int_float_b, add_(int_float_a, 1)),
+          stored_table_node_int_float))));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SQLTranslatorTest, WindowFunctionInvalid) {
+  EXPECT_THROW(compile_query(rewrite_window_functions("SELECT RANK(a) OVER (ORDER BY a) FROM int_float")),
+               InvalidInputException);
+  EXPECT_THROW(compile_query(rewrite_window_functions("SELECT LAG(a) OVER (ORDER BY a) FROM int_float")),
+               InvalidInputException);
+  EXPECT_THROW(compile_query("SELECT WINDOW_FUNCTION(a) FROM int_float"), InvalidInputException);
+}
+
 TEST_F(SQLTranslatorTest, FromColumnAliasingTablesSwitchNames) {
   // Tricky: Tables "switch names". int_float becomes int_float2 and int_float2 becomes int_float
 
@@ -1390,6 +1450,31 @@ TEST_F(SQLTranslatorTest, UnaryMinus) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, Intersect) {
+  const auto actual_lqp =
+      compile_query(rewrite_set_operations("SELECT a, b FROM int_float INTERSECT SELECT a, b FROM int_float2"));
+
+  const auto expected_lqp =
+      IntersectNode::make(SetOperationMode::Unique, stored_table_node_int_float, stored_table_node_int_float2);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SQLTranslatorTest, ExceptAllWithOrderBy) {
+  const auto actual_lqp =
+      compile_query(rewrite_set_operations("SELECT a FROM int_float EXCEPT ALL SELECT a FROM int_float2 ORDER BY a"));
+
+  // clang-format off
+  const auto expected_lqp =
+  SortNode::make(expression_vector(int_float_a), std::vector<OrderByMode>{OrderByMode::Ascending},
+    ExceptNode::make(SetOperationMode::All,
+      ProjectionNode::make(expression_vector(int_float_a), stored_table_node_int_float),
+      ProjectionNode::make(expression_vector(int_float2_a), stored_table_node_int_float2)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, ShowTables) {
   const auto actual_lqp = compile_query("SHOW TABLES");
   const auto expected_lqp = ShowTablesNode::make();
@@ -1808,6 +1893,11 @@ TEST_F(SQLTranslatorTest, CatchInputErrors) {
   EXPECT_THROW(compile_query("SELECT * FROM int_float WHERE 3 + 4;"), InvalidInputException);
   EXPECT_THROW(compile_query("INSERT INTO int_float VALUES (1, 2, 3, 4)"), InvalidInputException);
   EXPECT_THROW(compile_query("SELECT a, SUM(b) FROM int_float GROUP BY a HAVING b > 10;"), InvalidInputException);
+  EXPECT_THROW(compile_query(rewrite_set_operations("SELECT a FROM int_float INTERSECT SELECT a, b FROM int_float2;")),
+               InvalidInputException);
+  EXPECT_THROW(compile_query(rewrite_set_operations("SELECT a FROM int_float EXCEPT SELECT b FROM int_float2;")),
+               InvalidInputException);
+  EXPECT_THROW(compile_query("SELECT a FROM int_float UNION SELECT a FROM int_float2;"), InvalidInputException);
 }
 
 }  // namespace opossum
@@ -8,6 +8,8 @@ INSTANTIATE_TEST_CASE_P(SQLiteTestRunnerEncodings, SQLiteTestRunner,
                         testing::Combine(testing::ValuesIn(SQLiteTestRunner::queries()), testing::ValuesIn({false}),
                                          testing::ValuesIn({EncodingType::Dictionary, EncodingType::RunLength,
                                                             EncodingType::FixedStringDictionary,
-                                                            EncodingType::FrameOfReference})), );  // NOLINT
+                                                            EncodingType::FrameOfReference,
+                                                            EncodingType::FrontCodedDictionary,
+                                                            EncodingType::Delta})), );  // NOLINT
 
 }  // namespace opossum
@@ -0,0 +1,60 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "statistics/cardinality_estimation_errors.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class CardinalityEstimationErrorsTest : public BaseTest {};
+
+TEST_F(CardinalityEstimationErrorsTest, QError) {
+  EXPECT_DOUBLE_EQ(cardinality_q_error(100.0f, 100), 1.0);
+  EXPECT_DOUBLE_EQ(cardinality_q_error(10.0f, 100), 10.0);
+  EXPECT_DOUBLE_EQ(cardinality_q_error(100.0f, 10), 10.0);
+
+  // Row counts below one are taken to be one
+  EXPECT_DOUBLE_EQ(cardinality_q_error(0.0f, 0), 1.0);
+  EXPECT_DOUBLE_EQ(cardinality_q_error(0.5f, 20), 20.0);
+}
+
+TEST_F(CardinalityEstimationErrorsTest, SummarizeQErrors) {
+  const auto empty_distribution = summarize_q_errors({});
+  EXPECT_EQ(empty_distribution.count, 0);
+
+  const auto distribution = summarize_q_errors({4.0, 1.0, 2.0});
+  EXPECT_EQ(distribution.count, 3);
+  EXPECT_DOUBLE_EQ(distribution.geometric_mean, 2.0);
+  EXPECT_DOUBLE_EQ(distribution.median, 2.0);
+  EXPECT_DOUBLE_EQ(distribution.percentile_90, 4.0);
+  EXPECT_DOUBLE_EQ(distribution.max, 4.0);
+}
+
+TEST_F(CardinalityEstimationErrorsTest, CollectFromExecutedPlan) {
+  StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+
+  auto pipeline_statement =
+      SQLPipelineBuilder{"SELECT a FROM int_float WHERE a > 200"}.disable_mvcc().create_pipeline_statement();
+  pipeline_statement.get_result_table();
+
+  const auto errors = collect_cardinality_estimation_errors(pipeline_statement.get_physical_plan());
+  ASSERT_GE(errors.size(), 2u);
+
+  // Inputs come before outputs, the statistics of a stored table are exact
+  EXPECT_EQ(errors.front().node_type, LQPNodeType::StoredTable);
+  EXPECT_EQ(errors.front().actual_row_count, 3u);
+  EXPECT_DOUBLE_EQ(errors.front().q_error, 1.0);
+
+  EXPECT_EQ(errors.back().node_type, LQPNodeType::Projection);
+  EXPECT_EQ(errors.back().actual_row_count, 2u);
+  EXPECT_DOUBLE_EQ(errors.back().q_error,
+                   cardinality_q_error(errors.back().estimated_row_count, errors.back().actual_row_count));
+}
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/chunk_statistics/block_min_max_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BlockMinMaxFilterTest : public BaseTest {
+ protected:
+  using Ranges = std::vector<std::pair<ChunkOffset, ChunkOffset>>;
+
+  static constexpr auto BLOCK_SIZE = BaseBlockMinMaxFilter::BLOCK_SIZE;
+
+  // Three blocks of ascending values, followed by every third row being NULL
+  static std::shared_ptr<Table> _create_table() {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                               3 * BLOCK_SIZE + 100);
+    for (auto row = int32_t{0}; row < static_cast<int32_t>(3 * BLOCK_SIZE + 100); ++row) {
+      table->append({row % 3 == 1 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row}});
+    }
+    return table;
+  }
+};
+
+TEST_F(BlockMinMaxFilterTest, CandidateRanges) {
+  const auto filter = BlockMinMaxFilter<int32_t>{
+      ChunkOffset{3 * BLOCK_SIZE + 10}, {std::pair{0, 10}, std::pair{5, 20}, std::nullopt, std::pair{30, 40}}};
+
+  EXPECT_EQ(filter.candidate_ranges(PredicateCondition::Equals, 7), (Ranges{{0, 2 * BLOCK_SIZE}}));
+  EXPECT_EQ(filter.candidate_ranges(PredicateCondition::Equals, 15), (Ranges{{BLOCK_SIZE, 2 * BLOCK_SIZE}}));
+  EXPECT_EQ(filter.candidate_ranges(PredicateCondition::GreaterThan, 20),
+            (Ranges{{3 * BLOCK_SIZE, 3 * BLOCK_SIZE + 10}}));
+  EXPECT_EQ(filter.candidate_ranges(PredicateCondition::Between, 0, 35),
+            (Ranges{{0, 2 * BLOCK_SIZE}, {3 * BLOCK_SIZE, 3 * BLOCK_SIZE + 10}}));
+  EXPECT_TRUE(filter.candidate_ranges(PredicateCondition::LessThan, 0).empty());
+  EXPECT_TRUE(filter.can_prune(PredicateCondition::Equals, 25));
+  EXPECT_FALSE(filter.can_prune(PredicateCondition::Equals, 35));
+
+  // Nothing is skipped for NULL values
+  EXPECT_EQ(filter.candidate_ranges(PredicateCondition::Equals, NULL_VALUE), (Ranges{{0, 3 * BLOCK_SIZE + 10}}));
+}
+
+TEST_F(BlockMinMaxFilterTest, BuiltByChunkEncoder) {
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength}) {
+    const auto table = _create_table();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{encoding_type});
+
+    const auto& filter = table->get_chunk(ChunkID{0})->statistics()->statistics()[0]->block_min_max_filter();
+    ASSERT_TRUE(filter);
+    const auto& block_ranges = static_cast<const BlockMinMaxFilter<int32_t>&>(*filter).block_ranges();
+    ASSERT_EQ(block_ranges.size(), 4u);
+    EXPECT_EQ(block_ranges[0], std::pair(0, static_cast<int32_t>(BLOCK_SIZE - 1)));
+    EXPECT_EQ(block_ranges[3], std::pair(static_cast<int32_t>(3 * BLOCK_SIZE),
+                                         static_cast<int32_t>(3 * BLOCK_SIZE + 99)));
+  }
+
+  // Segments of a single block do not need one
+  const auto small_table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(small_table);
+  EXPECT_FALSE(small_table->get_chunk(ChunkID{0})->statistics()->statistics()[0]->block_min_max_filter());
+}
+
+TEST_F(BlockMinMaxFilterTest, ScansMatchUnencodedTable) {
+  const auto unencoded_table = _create_table();
+  const auto expected_wrapper = std::make_shared<TableWrapper>(unencoded_table);
+  expected_wrapper->execute();
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::FrameOfReference}) {
+    const auto table = _create_table();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{encoding_type});
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto predicates = std::vector<std::pair<PredicateCondition, AllTypeVariant>>{
+        {PredicateCondition::Equals, 5000},
+        {PredicateCondition::LessThan, 100},
+        {PredicateCondition::GreaterThanEquals, static_cast<int32_t>(3 * BLOCK_SIZE)},
+        {PredicateCondition::GreaterThan, 0},
+        {PredicateCondition::Equals, -1}};
+    for (const auto& [predicate_condition, value] : predicates) {
+      const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value);
+      scan->execute();
+      const auto expected_scan = create_table_scan(expected_wrapper, ColumnID{0}, predicate_condition, value);
+      expected_scan->execute();
+      EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_scan->get_output());
+    }
+
+    const auto between_scan = std::make_shared<TableScan>(
+        table_wrapper, between_(get_column_expression(table_wrapper, ColumnID{0}), 4000, 4200));
+    between_scan->execute();
+    const auto expected_between_scan = std::make_shared<TableScan>(
+        expected_wrapper, between_(get_column_expression(expected_wrapper, ColumnID{0}), 4000, 4200));
+    expected_between_scan->execute();
+    EXPECT_TABLE_EQ_UNORDERED(between_scan->get_output(), expected_between_scan->get_output());
+  }
+}
+
+}  // namespace opossum
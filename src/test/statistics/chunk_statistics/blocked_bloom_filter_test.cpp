@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/blocked_bloom_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BlockedBloomFilterTest : public BaseTest {
+ protected:
+  void TearDown() override { SegmentStatistics::set_membership_filter_settings({}); }
+
+  // Returns the BlockedBloomFilter of the segment statistics, if any
+  template <typename T>
+  static std::shared_ptr<const BlockedBloomFilter<T>> _bloom_filter(const SegmentStatistics& segment_statistics) {
+    for (const auto& filter : segment_statistics.filters()) {
+      if (const auto bloom_filter = std::dynamic_pointer_cast<const BlockedBloomFilter<T>>(filter)) return bloom_filter;
+    }
+    return nullptr;
+  }
+};
+
+TEST_F(BlockedBloomFilterTest, FalsePositiveRate) {
+  const auto bits_per_value = BaseBlockedBloomFilter::bits_per_value_for_false_positive_rate(0.01);
+  EXPECT_LE(BaseBlockedBloomFilter::false_positive_rate(bits_per_value), 0.01);
+  EXPECT_GT(BaseBlockedBloomFilter::false_positive_rate(bits_per_value - 0.5), 0.01);
+
+  // A blocked Bloom filter needs more bits than the ~9.6 bits per value of a standard Bloom filter
+  EXPECT_GE(bits_per_value, 9.6);
+  EXPECT_LE(bits_per_value, 16.0);
+
+  EXPECT_LT(BaseBlockedBloomFilter::false_positive_rate(16.0), BaseBlockedBloomFilter::false_positive_rate(8.0));
+}
+
+TEST_F(BlockedBloomFilterTest, NoFalseNegatives) {
+  const auto bits_per_value = BaseBlockedBloomFilter::bits_per_value_for_false_positive_rate(0.01);
+
+  auto values = pmr_vector<int32_t>{};
+  for (auto value = int32_t{0}; value < 20'000; value += 2) {
+    values.emplace_back(value);
+  }
+  const auto filter = BlockedBloomFilter<int32_t>::build_filter(values, bits_per_value);
+  EXPECT_EQ(filter->blocks().size(), static_cast<size_t>(std::ceil(values.size() * bits_per_value / 256.0)));
+
+  for (const auto value : values) {
+    EXPECT_TRUE(filter->may_contain(value));
+  }
+
+  // The false-positive rate of the odd values, which were not inserted, is close to the expected one
+  auto false_positive_count = size_t{0};
+  for (auto value = int32_t{1}; value < 200'000; value += 2) {
+    false_positive_count += filter->may_contain(value);
+  }
+  EXPECT_LT(static_cast<double>(false_positive_count) / 100'000.0, 0.02);
+}
+
+TEST_F(BlockedBloomFilterTest, CanPrune) {
+  const auto filter = BlockedBloomFilter<pmr_string>::build_filter({"apple", "banana", "cherry"}, 16.0);
+
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Equals, "banana"));
+  EXPECT_TRUE(filter->can_prune(PredicateCondition::Equals, "blueberry"));
+
+  // Only equality predicates are pruned
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::NotEquals, "blueberry"));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::LessThan, "blueberry"));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Equals, NULL_VALUE));
+}
+
+TEST_F(BlockedBloomFilterTest, BuiltBySegmentStatistics) {
+  // Column a has 1,000 distinct values, so that its filter needs ~1.2 bits per row, column b has only distinct values
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data, 10'000);
+  for (auto row = int32_t{0}; row < 10'000; ++row) {
+    table->append({row % 1'000 * 10, row});
+  }
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+
+  const auto& chunk_statistics = *table->get_chunk(ChunkID{0})->statistics();
+  ASSERT_TRUE(_bloom_filter<int32_t>(*chunk_statistics.statistics()[0]));
+  EXPECT_FALSE(_bloom_filter<int32_t>(*chunk_statistics.statistics()[1]));
+
+  // The values between the multiples of ten lie within the ranges of the RangeFilter, but most of them are pruned
+  auto pruned_count = 0;
+  for (auto value = int32_t{1}; value < 10'000; value += 10) {
+    EXPECT_FALSE(chunk_statistics.can_prune(ColumnID{0}, PredicateCondition::Equals, value - 1));
+    pruned_count += chunk_statistics.can_prune(ColumnID{0}, PredicateCondition::Equals, value);
+  }
+  EXPECT_GT(pruned_count, 950);
+
+  // With a false-positive rate of zero, no filter is built
+  SegmentStatistics::set_membership_filter_settings({0.0, 2.0});
+  const auto segment_statistics =
+      SegmentStatistics::build_statistics(DataType::Int, table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_FALSE(_bloom_filter<int32_t>(*segment_statistics));
+}
+
+}  // namespace opossum
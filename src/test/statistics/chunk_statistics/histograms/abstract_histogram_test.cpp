@@ -4,10 +4,12 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "statistics/chunk_statistics/histograms/chunk_histograms.hpp"
 #include "statistics/chunk_statistics/histograms/equal_distinct_count_histogram.hpp"
 #include "statistics/chunk_statistics/histograms/equal_height_histogram.hpp"
 #include "statistics/chunk_statistics/histograms/equal_width_histogram.hpp"
 #include "statistics/chunk_statistics/histograms/histogram_utils.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -139,6 +141,33 @@ TYPED_TEST(AbstractHistogramIntTest, CardinalityEstimationOutOfBounds) {
   EXPECT_FLOAT_EQ(hist->estimate_cardinality(PredicateCondition::Between, 123'457, 1'000'000), 0.f);
 }
 
+TYPED_TEST(AbstractHistogramIntTest, FromDictionarySegment) {
+  // The value distribution of dictionary segments is read from the dictionary, nulls are not counted
+  for (const auto& path :
+       {"resources/test_data/tbl/int_float4.tbl", "resources/test_data/tbl/int_float_with_null.tbl"}) {
+    const auto table = load_table(path);
+    const auto expected_histogram = TypeParam::from_segment(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), 2u);
+
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    const auto histogram = TypeParam::from_segment(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), 2u);
+
+    EXPECT_EQ(histogram->description(), expected_histogram->description());
+    EXPECT_EQ(histogram->total_count(), expected_histogram->total_count());
+  }
+}
+
+TYPED_TEST(AbstractHistogramIntTest, BuildChunkHistograms) {
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{2}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto histograms = build_chunk_histograms<TypeParam>(*table, ColumnID{0}, 2u);
+  ASSERT_EQ(histograms.size(), table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto expected_histogram = TypeParam::from_segment(table->get_chunk(chunk_id)->get_segment(ColumnID{0}), 2u);
+    EXPECT_EQ(histograms[chunk_id]->description(), expected_histogram->description());
+  }
+}
+
 template <typename T>
 class AbstractHistogramStringTest : public BaseTest {
   void SetUp() override {
@@ -316,4 +345,18 @@ TYPED_TEST(AbstractHistogramStringTest, EstimateCardinalityLike) {
             hist->estimate_cardinality(PredicateCondition::Like, "foo%") / ipow(26, 13));
 }
 
+TYPED_TEST(AbstractHistogramStringTest, FromDictionarySegment) {
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::FixedStringDictionary}) {
+    const auto table = load_table("resources/test_data/tbl/string3.tbl");
+    const auto expected_histogram = TypeParam::from_segment(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), 4u,
+                                                            "abcdefghijklmnopqrstuvwxyz", 4u);
+
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{encoding_type});
+    const auto histogram = TypeParam::from_segment(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), 4u,
+                                                   "abcdefghijklmnopqrstuvwxyz", 4u);
+
+    EXPECT_EQ(histogram->description(), expected_histogram->description());
+  }
+}
+
 }  // namespace opossum
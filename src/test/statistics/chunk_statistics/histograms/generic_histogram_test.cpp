@@ -0,0 +1,138 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/histograms/generic_histogram.hpp"
+
+namespace opossum {
+
+class GenericHistogramTest : public BaseTest {
+ protected:
+  // Values 1 to 10 occur 10 times each, values 11 to 20 once every other value
+  std::shared_ptr<GenericHistogram<int32_t>> _histogram = std::make_shared<GenericHistogram<int32_t>>(
+      std::vector<int32_t>{1, 11}, std::vector<int32_t>{10, 20}, std::vector<HistogramCountType>{100, 10},
+      std::vector<HistogramCountType>{10, 5});
+};
+
+TEST_F(GenericHistogramTest, FromValueDistribution) {
+  const auto value_counts = std::vector<std::pair<int32_t, HistogramCountType>>{{1, 2}, {2, 1}, {5, 3}, {8, 1}, {9, 1}};
+  const auto histogram = GenericHistogram<int32_t>::from_value_distribution(value_counts, 2u);
+
+  EXPECT_EQ(histogram->bin_count(), 2u);
+  EXPECT_EQ(histogram->total_count(), 8u);
+  EXPECT_EQ(histogram->total_distinct_count(), 5u);
+  EXPECT_EQ(histogram->minimum(), 1);
+  EXPECT_EQ(histogram->maximum(), 9);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(PredicateCondition::Equals, 5), 2.0f);
+  EXPECT_TRUE(histogram->can_prune(PredicateCondition::Equals, AllTypeVariant{6}));
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(PredicateCondition::LessThan, 8), 6.0f);
+}
+
+TEST_F(GenericHistogramTest, FromSample) {
+  // The sample of 8 values stands for 80 values with 10 distinct values. Values in the gaps between the sampled values
+  // are not pruned, as they might not have been sampled.
+  const auto value_counts = std::vector<std::pair<int32_t, HistogramCountType>>{{1, 2}, {2, 1}, {5, 3}, {8, 1}, {9, 1}};
+  const auto histogram = GenericHistogram<int32_t>::from_sample(value_counts, 2u, 80.0, 10.0);
+
+  EXPECT_EQ(histogram->bin_count(), 2u);
+  EXPECT_EQ(histogram->total_count(), 80u);
+  EXPECT_EQ(histogram->maximum(), 9);
+
+  // The second bin [8, 9] cannot hold more than two distinct values
+  EXPECT_EQ(histogram->total_distinct_count(), 8u);
+
+  EXPECT_FALSE(histogram->can_prune(PredicateCondition::Equals, AllTypeVariant{6}));
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(PredicateCondition::Equals, 6), 10.0f);
+}
+
+TEST_F(GenericHistogramTest, Merge) {
+  const auto histogram_a = GenericHistogram<int32_t>::from_value_distribution({{1, 1}, {2, 1}, {3, 1}, {4, 1}}, 1u);
+  const auto histogram_b = GenericHistogram<int32_t>::from_value_distribution({{3, 2}, {4, 2}, {5, 2}, {6, 2}}, 1u);
+  ASSERT_EQ(histogram_a->bin_count(), 1u);
+  ASSERT_EQ(histogram_b->bin_count(), 1u);
+
+  // The overlapping values 3 and 4 are assumed to be the same in both histograms
+  const auto merged_histogram = GenericHistogram<int32_t>::merge({histogram_a, histogram_b}, 10u);
+  EXPECT_EQ(merged_histogram->bin_count(), 3u);
+  EXPECT_EQ(merged_histogram->total_count(), 12u);
+  EXPECT_EQ(merged_histogram->total_distinct_count(), 6u);
+  EXPECT_EQ(merged_histogram->minimum(), 1);
+  EXPECT_EQ(merged_histogram->maximum(), 6);
+  EXPECT_FLOAT_EQ(merged_histogram->estimate_cardinality(PredicateCondition::Equals, 1), 1.0f);
+  EXPECT_FLOAT_EQ(merged_histogram->estimate_cardinality(PredicateCondition::Equals, 3), 3.0f);
+
+  // Merging into fewer bins keeps the counts
+  const auto single_bin_histogram = GenericHistogram<int32_t>::merge({histogram_a, histogram_b}, 1u);
+  EXPECT_EQ(single_bin_histogram->bin_count(), 1u);
+  EXPECT_EQ(single_bin_histogram->total_count(), 12u);
+  EXPECT_EQ(single_bin_histogram->total_distinct_count(), 6u);
+
+  EXPECT_EQ(GenericHistogram<int32_t>::merge({}, 10u), nullptr);
+}
+
+TEST_F(GenericHistogramTest, Sliced) {
+  const auto less_than = _histogram->sliced(PredicateCondition::LessThan, 6);
+  EXPECT_EQ(less_than->total_count(), 50u);
+  EXPECT_EQ(less_than->total_distinct_count(), 5u);
+  EXPECT_EQ(less_than->maximum(), 5);
+
+  const auto greater_than_equals = _histogram->sliced(PredicateCondition::GreaterThanEquals, 15);
+  EXPECT_EQ(greater_than_equals->total_count(), 6u);
+  EXPECT_EQ(greater_than_equals->total_distinct_count(), 3u);
+  EXPECT_EQ(greater_than_equals->minimum(), 15);
+
+  const auto equals = _histogram->sliced(PredicateCondition::Equals, 3);
+  EXPECT_EQ(equals->total_count(), 10u);
+  EXPECT_EQ(equals->total_distinct_count(), 1u);
+  EXPECT_EQ(equals->minimum(), 3);
+  EXPECT_EQ(equals->maximum(), 3);
+
+  const auto not_equals = _histogram->sliced(PredicateCondition::NotEquals, 3);
+  EXPECT_EQ(not_equals->total_count(), 100u);
+  EXPECT_EQ(not_equals->total_distinct_count(), 14u);
+
+  const auto between = _histogram->sliced(PredicateCondition::Between, 5, 15);
+  EXPECT_EQ(between->total_count(), 65u);
+  EXPECT_EQ(between->minimum(), 5);
+  EXPECT_EQ(between->maximum(), 15);
+
+  EXPECT_EQ(_histogram->sliced(PredicateCondition::Equals, 25), nullptr);
+  EXPECT_EQ(_histogram->sliced(PredicateCondition::LessThan, 1), nullptr);
+  EXPECT_EQ(_histogram->sliced(PredicateCondition::GreaterThan, 20), nullptr);
+}
+
+TEST_F(GenericHistogramTest, EstimateEquiJoin) {
+  const auto right_histogram = std::make_shared<GenericHistogram<int32_t>>(
+      std::vector<int32_t>{6}, std::vector<int32_t>{15}, std::vector<HistogramCountType>{20},
+      std::vector<HistogramCountType>{10});
+
+  // Only the values 6 to 15 occur on both sides. Of them, 6 to 10 make up half of the left histogram's first bin (50
+  // values with 5 distinct values) and half of the right histogram (10 values with 5 distinct values).
+  const auto [cardinality, joined_histogram] = _histogram->estimate_equi_join(*right_histogram);
+  EXPECT_FLOAT_EQ(cardinality, 50.0f * 10.0f / 5.0f + 5.0f * 10.0f / 5.0f);
+  ASSERT_TRUE(joined_histogram);
+  EXPECT_EQ(joined_histogram->minimum(), 6);
+  EXPECT_EQ(joined_histogram->maximum(), 15);
+  EXPECT_EQ(joined_histogram->total_count(), 110u);
+
+  const auto disjoint_histogram = std::make_shared<GenericHistogram<int32_t>>(
+      std::vector<int32_t>{30}, std::vector<int32_t>{40}, std::vector<HistogramCountType>{20},
+      std::vector<HistogramCountType>{10});
+  const auto disjoint_join = _histogram->estimate_equi_join(*disjoint_histogram);
+  EXPECT_FLOAT_EQ(disjoint_join.first, 0.0f);
+  EXPECT_EQ(disjoint_join.second, nullptr);
+}
+
+TEST_F(GenericHistogramTest, WithoutDuplicates) {
+  const auto histogram = _histogram->without_duplicates();
+  EXPECT_EQ(histogram->bin_count(), 2u);
+  EXPECT_EQ(histogram->total_count(), 15u);
+  EXPECT_EQ(histogram->total_distinct_count(), 15u);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(PredicateCondition::Equals, 3), 1.0f);
+}
+
+}  // namespace opossum
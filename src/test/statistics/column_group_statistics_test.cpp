@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ColumnGroupStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // b is correlated with a, c is not
+    _table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}, {"c", DataType::Int, false}},
+        TableType::Data, 300);
+    for (auto row_id = 0; row_id < 1'000; ++row_id) {
+      const auto b = row_id % 100 == 99 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_id + 100};
+      _table->append({row_id, b, (row_id * 7'919) % 1'000});
+    }
+    _table->set_table_statistics(generate_table_statistics_sampled(*_table));
+  }
+
+  static ColumnGroupPredicate predicate(const size_t column_index, const PredicateCondition predicate_condition,
+                                        const AllTypeVariant& value) {
+    auto predicate = ColumnGroupPredicate{};
+    predicate.column_index = column_index;
+    predicate.predicate_condition = predicate_condition;
+    predicate.value = value;
+    return predicate;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ColumnGroupStatisticsTest, EstimateSelectivity) {
+  const auto correlated_statistics = generate_column_group_statistics(*_table, {ColumnID{0}, ColumnID{1}});
+  const auto independent_statistics = generate_column_group_statistics(*_table, {ColumnID{0}, ColumnID{2}});
+
+  EXPECT_FLOAT_EQ(correlated_statistics->row_count(), 1'000.0f);
+  EXPECT_FLOAT_EQ(correlated_statistics->distinct_count(), 990.0f);
+
+  const auto a_less_than_100 = predicate(0, PredicateCondition::LessThan, 100);
+  EXPECT_NEAR(*correlated_statistics->estimate_selectivity({a_less_than_100}), 0.1f, 0.02f);
+
+  const auto b_less_than_200 = predicate(1, PredicateCondition::LessThan, 200);
+  EXPECT_NEAR(*correlated_statistics->estimate_selectivity({a_less_than_100, b_less_than_200}), 0.1f, 0.02f);
+
+  const auto c_less_than_100 = predicate(1, PredicateCondition::LessThan, 100);
+  EXPECT_NEAR(*independent_statistics->estimate_selectivity({a_less_than_100, c_less_than_100}), 0.01f, 0.01f);
+
+  const auto a_equals_5 = predicate(0, PredicateCondition::Equals, 5);
+  EXPECT_NEAR(*correlated_statistics->estimate_selectivity({a_equals_5}), 0.001f, 0.0001f);
+  const auto a_equals_6 = predicate(0, PredicateCondition::Equals, 6);
+  EXPECT_FLOAT_EQ(*correlated_statistics->estimate_selectivity({a_equals_5, a_equals_6}), 0.0f);
+
+  const auto b_is_null = predicate(1, PredicateCondition::IsNull, NullValue{});
+  EXPECT_NEAR(*correlated_statistics->estimate_selectivity({b_is_null}), 0.01f, 0.001f);
+
+  // a < b holds for all rows where b is not NULL
+  auto a_less_than_b = ColumnGroupPredicate{};
+  a_less_than_b.predicate_condition = PredicateCondition::LessThan;
+  a_less_than_b.compares_columns = true;
+  EXPECT_GT(*correlated_statistics->estimate_selectivity({a_less_than_b}), 0.8f);
+
+  const auto a_like = predicate(0, PredicateCondition::Like, pmr_string{"%"});
+  EXPECT_EQ(correlated_statistics->estimate_selectivity({a_like}), std::nullopt);
+}
+
+TEST_F(ColumnGroupStatisticsTest, ToNumericPreservesOrder) {
+  EXPECT_EQ(ColumnGroupStatistics::to_numeric(NullValue{}), std::nullopt);
+  EXPECT_EQ(ColumnGroupStatistics::to_numeric(int32_t{-3}), -3.0);
+  EXPECT_LT(*ColumnGroupStatistics::to_numeric(pmr_string{"1995-03-15"}),
+            *ColumnGroupStatistics::to_numeric(pmr_string{"1995-04-01"}));
+  EXPECT_LT(*ColumnGroupStatistics::to_numeric(pmr_string{"abc"}),
+            *ColumnGroupStatistics::to_numeric(pmr_string{"abcd"}));
+}
+
+TEST_F(ColumnGroupStatisticsTest, CorrelatedPredicates) {
+  add_column_group_statistics(*_table, {ColumnID{0}, ColumnID{1}});
+  const auto& table_statistics = *_table->table_statistics();
+  ASSERT_EQ(table_statistics.column_groups().size(), 1u);
+
+  // Without column group statistics, the second predicate would reduce the estimate to about 10 rows
+  const auto statistics_a =
+      table_statistics.estimate_predicate(ColumnID{0}, PredicateCondition::LessThan, AllTypeVariant{100});
+  const auto statistics_b =
+      statistics_a.estimate_predicate(ColumnID{1}, PredicateCondition::LessThan, AllTypeVariant{200});
+  EXPECT_NEAR(statistics_b.row_count(), 100.0f, 20.0f);
+
+  // Predicates on other columns still assume independence
+  const auto statistics_c =
+      statistics_b.estimate_predicate(ColumnID{2}, PredicateCondition::LessThan, AllTypeVariant{500});
+  EXPECT_NEAR(statistics_c.row_count(), statistics_b.row_count() / 2.0f, 5.0f);
+}
+
+TEST_F(ColumnGroupStatisticsTest, JoinOnBothColumnsOfGroups) {
+  add_column_group_statistics(*_table, {ColumnID{0}, ColumnID{1}});
+  const auto& table_statistics = *_table->table_statistics();
+
+  // Each row finds exactly one join partner, whereas assuming independence, both predicates together would only be
+  // satisfied by about one row
+  const auto join_statistics = table_statistics.estimate_predicated_join(
+      table_statistics, JoinMode::Inner, {ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  const auto composite_join_statistics =
+      join_statistics.estimate_predicate(ColumnID{1}, PredicateCondition::Equals, AllParameterVariant{ColumnID{4}});
+  EXPECT_NEAR(composite_join_statistics.row_count(), 1'000.0f, 100.0f);
+}
+
+}  // namespace opossum
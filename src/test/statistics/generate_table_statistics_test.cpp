@@ -3,6 +3,7 @@
 #include "statistics/column_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
 #include "statistics_test_utils.hpp"
 #include "utils/load_table.hpp"
 
@@ -24,4 +25,104 @@ TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsUnsampled) {
   EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
 }
 
+TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsSampledFromAllRows) {
+  // Without sampling, the statistics generated from per-chunk sketches match the exact ones
+  const auto table = load_table("resources/test_data/tbl/tpch/sf-0.001/customer.tbl", 40);
+  const auto table_statistics = generate_table_statistics_sampled(*table);
+
+  ASSERT_EQ(table_statistics->column_statistics().size(), 8u);
+  EXPECT_EQ(table_statistics->row_count(), 150u);
+  EXPECT_NE(table_statistics->sketch(), nullptr);
+
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics->column_statistics().at(0), 0.0f, 150, 1, 150);
+  EXPECT_STRING_COLUMN_STATISTICS(table_statistics->column_statistics().at(1), 0.0f, 150, "Customer#000000001",
+                                  "Customer#000000150");
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics->column_statistics().at(3), 0.0f, 25, 0, 24);
+  EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics->column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
+}
+
+TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsSampled) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}},
+                                       TableType::Data, 1'000);
+  // Every third row is NULL. The period must not divide the distance of the sampled rows (here: 10), otherwise the
+  // sample would contain either only NULLs or no NULLs at all.
+  for (auto row_id = 0; row_id < 4'000; ++row_id) {
+    table->append({row_id % 3 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_id}, row_id % 7});
+  }
+
+  const auto table_statistics = generate_table_statistics_sampled(*table, 100);
+  EXPECT_EQ(table_statistics->row_count(), 4'000u);
+
+  const auto& column_statistics_a = table_statistics->column_statistics().at(0);
+  EXPECT_NEAR(column_statistics_a->null_value_ratio(), 1.0f / 3.0f, 0.01f);
+  EXPECT_GT(column_statistics_a->distinct_count(), 2'200.0f);
+  EXPECT_LE(column_statistics_a->distinct_count(), 2'700.0f);
+
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics->column_statistics().at(1), 0.0f, 7, 0, 6);
+}
+
+TEST_F(GenerateTableStatisticsTest, HistogramsCaptureSkew) {
+  // 900 rows have the value 0, the values 1 to 50 occur twice each
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 250);
+  for (auto row_id = 0; row_id < 1'000; ++row_id) {
+    table->append({row_id < 900 ? 0 : (row_id - 900) / 2 + 1});
+  }
+
+  const auto table_statistics = generate_table_statistics_sampled(*table);
+  const auto column_statistics =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics->column_statistics().at(0));
+  ASSERT_TRUE(column_statistics);
+  ASSERT_TRUE(column_statistics->histogram());
+  EXPECT_EQ(column_statistics->histogram()->total_count(), 1'000u);
+
+  // Assuming a uniform distribution, each of the 51 distinct values would occur about 20 times
+  const auto equals_0 =
+      table_statistics->estimate_predicate(ColumnID{0}, PredicateCondition::Equals, AllTypeVariant{0});
+  EXPECT_FLOAT_EQ(equals_0.row_count(), 900.0f);
+  EXPECT_FLOAT_EQ(equals_0.column_statistics().at(0)->distinct_count(), 1.0f);
+
+  const auto equals_7 =
+      table_statistics->estimate_predicate(ColumnID{0}, PredicateCondition::Equals, AllTypeVariant{7});
+  EXPECT_FLOAT_EQ(equals_7.row_count(), 2.0f);
+
+  const auto less_than_10 =
+      table_statistics->estimate_predicate(ColumnID{0}, PredicateCondition::LessThan, AllTypeVariant{10});
+  EXPECT_FLOAT_EQ(less_than_10.row_count(), 918.0f);
+
+  // The sliced histogram is used for further predicates on the same column
+  const auto greater_than_0 =
+      less_than_10.estimate_predicate(ColumnID{0}, PredicateCondition::GreaterThan, AllTypeVariant{0});
+  EXPECT_FLOAT_EQ(greater_than_0.row_count(), 18.0f);
+
+  // In the self-join, the 900 rows with the value 0 find 900 partners each
+  const auto join_statistics = table_statistics->estimate_predicated_join(
+      *table_statistics, JoinMode::Inner, {ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  EXPECT_FLOAT_EQ(join_statistics.row_count(), 900.0f * 900.0f + 50.0f * 2.0f * 2.0f);
+}
+
+TEST_F(GenerateTableStatisticsTest, RefreshTableStatistics) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 3);
+  table->append({1});
+  table->append({2});
+  table->set_table_statistics(generate_table_statistics_sampled(*table));
+  table->table_statistics()->increase_invalid_row_count(1);
+
+  table->append({3});
+  table->append({4});
+
+  refresh_table_statistics(*table, ChunkID{0});
+  EXPECT_EQ(table->table_statistics()->row_count(), 4u);
+  EXPECT_EQ(table->table_statistics()->approx_valid_row_count(), 3u);
+  EXPECT_INT32_COLUMN_STATISTICS(table->table_statistics()->column_statistics().at(0), 0.0f, 3, 1, 3);
+
+  refresh_table_statistics(*table, ChunkID{1});
+  EXPECT_INT32_COLUMN_STATISTICS(table->table_statistics()->column_statistics().at(0), 0.0f, 4, 1, 4);
+
+  // Statistics without a sketch are not refreshed
+  const auto unsketched_statistics = std::make_shared<TableStatistics>(generate_table_statistics(*table));
+  table->set_table_statistics(unsketched_statistics);
+  refresh_table_statistics(*table, ChunkID{1});
+  EXPECT_EQ(table->table_statistics(), unsketched_statistics);
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <set>
 #include <string>
@@ -40,9 +41,10 @@ class AdaptiveRadixTreeIndexTest : public BaseTest {
     values1 = {0x00000001u, 0x00000002u, 0x00000003u, 0x00000004u, 0x00000005u, 0x00000006u, 0x00000007u};
 
     for (size_t i = 0; i < 7; ++i) {
-      auto bc = AdaptiveRadixTreeIndex::BinaryComparable(keys1[i]);
-      pairs.emplace_back(std::make_pair(bc, values1[i]));
+      pairs.emplace_back(keys1[i], values1[i]);
     }
+    std::stable_sort(pairs.begin(), pairs.end(),
+                     [](const auto& left, const auto& right) { return left.first < right.first; });
     root = index1->_bulk_insert(pairs);
 
     std::random_device rd;
@@ -82,8 +84,8 @@ class AdaptiveRadixTreeIndexTest : public BaseTest {
 
   std::shared_ptr<AdaptiveRadixTreeIndex> index1 = nullptr;
   std::shared_ptr<BaseSegment> dict_segment1 = nullptr;
-  std::shared_ptr<ARTNode> root = nullptr;
-  std::vector<std::pair<AdaptiveRadixTreeIndex::BinaryComparable, ChunkOffset>> pairs;
+  std::unique_ptr<ARTNode> root = nullptr;
+  std::vector<std::pair<ValueID, ChunkOffset>> pairs;
   std::vector<ValueID> keys1;
   std::vector<ChunkOffset> values1;
 
@@ -103,34 +105,34 @@ TEST_F(AdaptiveRadixTreeIndexTest, BinaryComparableFromChunkOffset) {
 TEST_F(AdaptiveRadixTreeIndexTest, BulkInsert) {
   std::vector<ChunkOffset> expected_chunk_offsets = {0x00000001u, 0x00000007u, 0x00000002u, 0x00000003u,
                                                      0x00000004u, 0x00000005u, 0x00000006u};
-  EXPECT_FALSE(std::dynamic_pointer_cast<Leaf>(root));
+  EXPECT_FALSE(dynamic_cast<Leaf*>(root.get()));
   EXPECT_EQ(index1->_chunk_offsets, expected_chunk_offsets);
 
-  auto root4 = std::dynamic_pointer_cast<ARTNode4>(root);
+  auto root4 = dynamic_cast<ARTNode4*>(root.get());
   EXPECT_EQ(root4->_partial_keys[0], static_cast<uint8_t>(0x01u));
   EXPECT_EQ(root4->_partial_keys[1], static_cast<uint8_t>(0x02u));
   EXPECT_EQ(root4->_partial_keys[2], static_cast<uint8_t>(0xffu));
   EXPECT_EQ(root4->_partial_keys[3], static_cast<uint8_t>(0xffu));
 
-  auto child01 = std::dynamic_pointer_cast<ARTNode4>(root4->_children[0]);
+  auto child01 = dynamic_cast<ARTNode4*>(root4->_children[0].get());
   EXPECT_EQ(child01->_partial_keys[0], static_cast<uint8_t>(0x01u));
   EXPECT_EQ(child01->_partial_keys[1], static_cast<uint8_t>(0x02u));
   EXPECT_EQ(child01->_partial_keys[2], static_cast<uint8_t>(0xffu));
   EXPECT_EQ(child01->_partial_keys[3], static_cast<uint8_t>(0xffu));
 
-  auto child0101 = std::dynamic_pointer_cast<ARTNode4>(child01->_children[0]);
+  auto child0101 = dynamic_cast<ARTNode4*>(child01->_children[0].get());
   EXPECT_EQ(child0101->_partial_keys[0], static_cast<uint8_t>(0x01u));
   EXPECT_EQ(child0101->_partial_keys[1], static_cast<uint8_t>(0x02u));
   EXPECT_EQ(child0101->_partial_keys[2], static_cast<uint8_t>(0xffu));
   EXPECT_EQ(child0101->_partial_keys[3], static_cast<uint8_t>(0xffu));
 
-  auto child010101 = std::dynamic_pointer_cast<ARTNode4>(child0101->_children[0]);
+  auto child010101 = dynamic_cast<ARTNode4*>(child0101->_children[0].get());
   EXPECT_EQ(child0101->_partial_keys[0], static_cast<uint8_t>(0x01u));
   EXPECT_EQ(child0101->_partial_keys[1], static_cast<uint8_t>(0x02u));
   EXPECT_EQ(child0101->_partial_keys[2], static_cast<uint8_t>(0xffu));
   EXPECT_EQ(child0101->_partial_keys[3], static_cast<uint8_t>(0xffu));
 
-  auto leaf01010101 = std::dynamic_pointer_cast<Leaf>(child010101->_children[0]);
+  auto leaf01010101 = dynamic_cast<Leaf*>(child010101->_children[0].get());
   EXPECT_EQ(*(leaf01010101->begin()), 0x00000001u);
   EXPECT_EQ(*(leaf01010101->end()), 0x00000002u);
   EXPECT_EQ(std::distance(leaf01010101->begin(), leaf01010101->end()), 2);
@@ -139,14 +141,14 @@ TEST_F(AdaptiveRadixTreeIndexTest, BulkInsert) {
   EXPECT_FALSE(std::find(leaf01010101->begin(), leaf01010101->end(), static_cast<uint8_t>(0x00000007u)) ==
                leaf01010101->end());
 
-  auto leaf01010102 = std::dynamic_pointer_cast<Leaf>(child010101->_children[1]);
+  auto leaf01010102 = dynamic_cast<Leaf*>(child010101->_children[1].get());
   EXPECT_EQ(*(leaf01010102->begin()), 0x00000002u);
   EXPECT_EQ(*(leaf01010102->end()), 0x00000003u);
   EXPECT_EQ(std::distance(leaf01010102->begin(), leaf01010102->end()), 1);
   EXPECT_FALSE(std::find(leaf01010102->begin(), leaf01010102->end(), static_cast<uint8_t>(0x00000002u)) ==
                leaf01010102->end());
 
-  auto leaf02 = std::dynamic_pointer_cast<Leaf>(root4->_children[1]);
+  auto leaf02 = dynamic_cast<Leaf*>(root4->_children[1].get());
   EXPECT_EQ(std::distance(leaf02->begin(), leaf02->end()), 1);
   EXPECT_EQ(*(leaf02->begin()), 0x00000006u);
   EXPECT_FALSE(std::find(leaf02->begin(), leaf02->end(), static_cast<uint8_t>(0x00000006u)) == leaf02->end());
@@ -210,6 +212,35 @@ TEST_F(AdaptiveRadixTreeIndexTest, SimpleTest) {
   EXPECT_EQ(index->upper_bound({std::numeric_limits<int32_t>::max()}), index->cend());
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, PathCompression) {
+  // Values 0 to 299 result in the ValueIDs 0x00000000 to 0x0000012b, whose first two bytes are stored as the root's
+  // prefix
+  std::vector<int32_t> values(300);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), _rng);
+
+  auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, values);
+  auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  auto root4 = dynamic_cast<ARTNode4*>(index->_root.get());
+  ASSERT_TRUE(root4);
+  EXPECT_EQ(root4->_prefix_length, 2u);
+  EXPECT_TRUE(dynamic_cast<ARTNode256*>(root4->_children[0].get()));
+  EXPECT_TRUE(dynamic_cast<ARTNode48*>(root4->_children[1].get()));
+
+  for (auto value = int32_t{0}; value < 300; ++value) {
+    EXPECT_EQ((*segment)[*index->lower_bound({value})], AllTypeVariant{value});
+    EXPECT_EQ(std::distance(index->lower_bound({value}), index->upper_bound({value})), 1);
+  }
+  EXPECT_EQ(index->lower_bound({-1}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({300}), index->cend());
+
+  // The chunk offsets take 1200 bytes, the tree less than its estimate
+  EXPECT_GT(index->memory_consumption(), 300 * sizeof(ChunkOffset));
+  EXPECT_LT(index->memory_consumption(),
+            BaseIndex::estimate_memory_consumption(SegmentIndexType::AdaptiveRadixTree, 300, 300, 4));
+}
+
 /**
 * The following two cases try to test two rather extreme situations that both
 * test the node overflow handling of the ART implementation:
@@ -1,4 +1,5 @@
 #include <memory>
+#include <optional>
 #include <random>
 #include <utility>
 #include <vector>
@@ -79,6 +80,43 @@ TEST_P(AnySegmentIterableTest, IntWithPositionFilter) {
   EXPECT_EQ(index, position_filter->size());
 }
 
+TEST_P(AnySegmentIterableTest, FillBlock) {
+  // More values than fit into a single block
+  auto values = std::vector<int32_t>{};
+  auto nulls = std::vector<bool>{};
+  auto expected_positions = std::vector<std::pair<std::optional<int32_t>, ChunkOffset>>{};
+  for (auto index = int32_t{0}; index < 2'500; ++index) {
+    values.emplace_back(index);
+    nulls.emplace_back(index % 7 == 0);
+    expected_positions.emplace_back(index % 7 == 0 ? std::nullopt : std::optional<int32_t>{index}, index);
+  }
+
+  auto segment = std::shared_ptr<BaseSegment>{};
+  segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(nulls));
+
+  const auto param = GetParam();
+  if (param.encoding_type != EncodingType::Unencoded) {
+    segment = encode_segment(param.encoding_type, DataType::Int,
+                             std::dynamic_pointer_cast<ValueSegment<int32_t>>(segment), param.vector_compression_type);
+  }
+
+  auto actual_positions = std::vector<std::pair<std::optional<int32_t>, ChunkOffset>>{};
+  create_any_segment_iterable<int32_t>(*segment).with_iterators([&](auto it, const auto end) {
+    auto block = SegmentPositionBlock<int32_t>{};
+    auto block_count = size_t{0};
+    while (it.fill_block(block, end) > 0) {
+      for (auto index = size_t{0}; index < block.size; ++index) {
+        actual_positions.emplace_back(block.nulls[index] ? std::nullopt : std::optional<int32_t>{block.values[index]},
+                                      block.chunk_offsets[index]);
+      }
+      ++block_count;
+    }
+    EXPECT_EQ(block_count, 3u);
+  });
+
+  EXPECT_EQ(actual_positions, expected_positions);
+}
+
 INSTANTIATE_TEST_CASE_P(
     AnySegmentIterableTestInstances, AnySegmentIterableTest,
     ::testing::Values(SegmentEncodingSpec{EncodingType::Unencoded}, SegmentEncodingSpec{EncodingType::Dictionary},
@@ -0,0 +1,103 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_buffer_manager.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class ChunkBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    _expected_table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+
+    _table->append({1, 2.5f});
+    _expected_table->append({1, 2.5f});
+  }
+
+  std::shared_ptr<Table> _table, _expected_table;
+};
+
+TEST_F(ChunkBufferManagerTest, EvictAndLoadChunk) {
+  auto& buffer_manager = ChunkBufferManager::get();
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  const auto statistics = chunk->statistics();
+
+  EXPECT_TRUE(buffer_manager.evict_chunk(_table, ChunkID{0}));
+  EXPECT_TRUE(chunk->is_evicted());
+  EXPECT_FALSE(buffer_manager.evict_chunk(_table, ChunkID{0}));
+
+  // Evicting a chunk keeps its size and statistics
+  EXPECT_EQ(chunk->size(), 2u);
+  EXPECT_EQ(chunk->statistics(), statistics);
+  EXPECT_EQ(_table->row_count(), 5u);
+
+  // Accessing a segment loads the chunk
+  const auto segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_FALSE(chunk->is_evicted());
+  EXPECT_EQ((*segment)[0], AllTypeVariant{12345});
+  EXPECT_EQ((*segment)[1], AllTypeVariant{123});
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(ChunkBufferManagerTest, DoNotEvictMutableChunks) {
+  EXPECT_FALSE(ChunkBufferManager::get().evict_chunk(_table, ChunkID{2}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->is_evicted());
+}
+
+TEST_F(ChunkBufferManagerTest, EvictColdChunks) {
+  StorageManager::get().add_table("table", _table);
+  auto& buffer_manager = ChunkBufferManager::get();
+
+  // The first chunk is accessed more often and is kept in memory
+  for (auto access = 0; access < 4; ++access) {
+    _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  }
+
+  const auto memory_usage = _table->estimate_memory_usage();
+  EXPECT_EQ(buffer_manager.evict_cold_chunks(memory_usage), 0u);
+
+  EXPECT_EQ(buffer_manager.evict_cold_chunks(memory_usage - 1), 1u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_evicted());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_evicted());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->is_evicted());
+
+  EXPECT_EQ(buffer_manager.evict_cold_chunks(0), 1u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_evicted());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->is_evicted());
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(ChunkBufferManagerTest, EvictChunksReferencedByAccessors) {
+  auto& buffer_manager = ChunkBufferManager::get();
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}});
+  const auto reference_segment = std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list);
+  const auto accessor = create_segment_accessor<int32_t>(reference_segment);
+  EXPECT_EQ(accessor->access(ChunkOffset{0}), 1234);
+  EXPECT_EQ(accessor->access(ChunkOffset{1}), 123);
+
+  const auto segment = std::weak_ptr<const BaseSegment>{_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})};
+  EXPECT_TRUE(buffer_manager.evict_chunk(_table, ChunkID{0}));
+  EXPECT_TRUE(buffer_manager.evict_chunk(_table, ChunkID{1}));
+
+  // The accessor keeps the segments that it reads alive
+  EXPECT_FALSE(segment.expired());
+  EXPECT_EQ(accessor->access(ChunkOffset{0}), 1234);
+  EXPECT_EQ(accessor->access(ChunkOffset{1}), 123);
+}
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_compression_service.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkCompressionServiceTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows, so that the first two chunks are full and the third one is not
+    _table = load_table("resources/test_data/tbl/compression_input.tbl", 5u);
+    StorageManager::get().add_table("table", _table);
+    _expected_table = load_table("resources/test_data/tbl/compression_input.tbl", 5u);
+  }
+
+  std::shared_ptr<Table> _table, _expected_table;
+};
+
+TEST_F(ChunkCompressionServiceTest, CompressCompletedChunks) {
+  auto& service = ChunkCompressionService::get();
+
+  EXPECT_EQ(service.compress_completed_chunks(), 2u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->statistics());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseDictionarySegment>(
+      _table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+
+  // Already compressed chunks are not compressed again
+  EXPECT_EQ(service.compress_completed_chunks(), 0u);
+
+  // The third chunk is full now, but its new rows are not committed
+  for (auto row = 0; row < 3; ++row) {
+    _table->append({"new", row});
+    _expected_table->append({"new", row});
+  }
+  EXPECT_EQ(service.compress_completed_chunks(), 0u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+
+  {
+    auto mvcc_data = _table->get_chunk(ChunkID{2})->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 5; ++chunk_offset) {
+      mvcc_data->begin_cids[chunk_offset] = 0;
+    }
+  }
+
+  EXPECT_EQ(service.compress_completed_chunks(), 1u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->is_mutable());
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(ChunkCompressionServiceTest, CompressInBackground) {
+  auto& service = ChunkCompressionService::get();
+  EXPECT_FALSE(service.is_running());
+
+  service.set_auto_encoding_spec(AutoEncodingSpec{});
+  service.start(std::chrono::milliseconds{1});
+  EXPECT_TRUE(service.is_running());
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+  while (_table->get_chunk(ChunkID{1})->is_mutable() && std::chrono::steady_clock::now() < timeout) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+
+  service.stop();
+  EXPECT_FALSE(service.is_running());
+
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+}  // namespace opossum
@@ -7,11 +7,15 @@
 #include "gtest/gtest.h"
 
 #include "all_type_variant.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -68,6 +72,30 @@ TEST_F(ChunkEncoderTest, EncodeSingleChunk) {
   verify_encoding(chunk, chunk_encoding_spec);
 }
 
+TEST_F(ChunkEncoderTest, EncodeSingleChunkWithScheduler) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{{EncodingType::Dictionary}, {EncodingType::RunLength}, {EncodingType::FrameOfReference}};
+
+  auto types = _table->column_data_types();
+  auto chunk = _table->get_chunk(ChunkID{0u});
+
+  ChunkEncoder::encode_chunk(chunk, types, chunk_encoding_spec);
+
+  verify_encoding(chunk, chunk_encoding_spec);
+  for (auto column_id = ColumnID{0u}; column_id < chunk->column_count(); ++column_id) {
+    for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(column_id))[chunk_offset], AllTypeVariant{static_cast<int32_t>(chunk_offset)});
+    }
+  }
+  EXPECT_NE(chunk->statistics(), nullptr);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
 TEST_F(ChunkEncoderTest, LeaveOneSegmentUnencoded) {
   const auto chunk_encoding_spec =
       ChunkEncodingSpec{{EncodingType::Unencoded}, {EncodingType::RunLength}, {EncodingType::Dictionary}};
@@ -146,4 +174,44 @@ TEST_F(ChunkEncoderTest, EncodeMultipleChunksUsingSameEncoding) {
   verify_encoding(_table->get_chunk(ChunkID{1u}), unencoded_chunk_spec);
 }
 
+TEST_F(ChunkEncoderTest, SelectsRunLengthForLongRuns) {
+  auto values = std::vector<int32_t>(10'000);
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    values[index] = static_cast<int32_t>(index / 1'000);
+  }
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values));
+
+  const auto spec = ChunkEncoder::select_segment_encoding(DataType::Int, value_segment);
+  EXPECT_EQ(spec.encoding_type, EncodingType::RunLength);
+}
+
+TEST_F(ChunkEncoderTest, SelectionFollowsMemoryWeight) {
+  auto values = std::vector<pmr_string>(1'000);
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    const auto number = std::to_string(index);
+    values[index] = pmr_string{"customer#" + std::string(9 - number.size(), '0') + number};
+  }
+  const auto value_segment = std::make_shared<ValueSegment<pmr_string>>(std::move(values));
+
+  const auto fast_spec = ChunkEncoder::select_segment_encoding(DataType::String, value_segment, {0.0f});
+  EXPECT_EQ(fast_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(fast_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+
+  const auto small_spec = ChunkEncoder::select_segment_encoding(DataType::String, value_segment, {1.0f});
+  EXPECT_EQ(small_spec.encoding_type, EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(small_spec.vector_compression_type, VectorCompressionType::BitPacking);
+}
+
+TEST_F(ChunkEncoderTest, EncodeSingleChunkAutomatically) {
+  auto types = _table->column_data_types();
+  auto chunk = _table->get_chunk(ChunkID{0u});
+
+  const auto chunk_encoding_spec = ChunkEncoder::select_chunk_encoding(chunk, types);
+  ASSERT_EQ(chunk_encoding_spec.size(), chunk->column_count());
+
+  ChunkEncoder::encode_chunk(chunk, types, AutoEncodingSpec{});
+
+  verify_encoding(chunk, chunk_encoding_spec);
+}
+
 }  // namespace opossum
@@ -61,6 +61,24 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, ReserveRows) {
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}), std::make_shared<MvccData>(3));
+
+  EXPECT_EQ(chunk->reserve_rows(2, 6), std::make_pair(ChunkOffset{3}, ChunkOffset{2}));
+  EXPECT_EQ(chunk->size(), 5u);
+  EXPECT_EQ(chunk->get_scoped_mvcc_data_lock()->size(), 5u);
+  EXPECT_EQ(chunk->get_scoped_mvcc_data_lock()->get_begin_cid(4), MvccData::MAX_COMMIT_ID);
+
+  // Only a single row is left
+  EXPECT_EQ(chunk->reserve_rows(2, 6), std::make_pair(ChunkOffset{5}, ChunkOffset{1}));
+  EXPECT_EQ(chunk->reserve_rows(2, 6).second, 0u);
+  EXPECT_EQ(chunk->size(), 6u);
+
+  // Appended rows are taken into account
+  chunk->append({2, "two"});
+  EXPECT_EQ(chunk->reserve_rows(1, 8), std::make_pair(ChunkOffset{7}, ChunkOffset{1}));
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
   chunk->append({2, "two"});
@@ -69,6 +87,20 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(base_segment->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, RetrieveSegmentView) {
+  chunk = std::make_shared<Chunk>(Segments({vs_int, vs_str}));
+  chunk->mark_immutable();
+
+  EXPECT_EQ(&chunk->get_segment_view(ColumnID{1}), vs_str.get());
+  // Views do not count as accesses
+  EXPECT_EQ(chunk->access_count(), 0u);
+
+  // The segments of evicted chunks are loaded first
+  chunk->evict([&]() { return Segments({ds_int, ds_str}); });
+  EXPECT_EQ(&chunk->get_segment_view(ColumnID{0}), ds_int.get());
+  EXPECT_FALSE(chunk->is_evicted());
+}
+
 TEST_F(StorageChunkTest, UnknownColumnType) {
   // Exception will only be thrown in debug builds
   if (!HYRISE_DEBUG) GTEST_SKIP();
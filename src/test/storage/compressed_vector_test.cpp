@@ -78,7 +78,8 @@ auto formatter = [](const ::testing::TestParamInfo<VectorCompressionType> info)
 
 INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, CompressedVectorTest,
                         ::testing::Values(VectorCompressionType::SimdBp128,
-                                          VectorCompressionType::FixedSizeByteAligned),
+                                          VectorCompressionType::FixedSizeByteAligned,
+                                          VectorCompressionType::BitPacking),
                         formatter);
 
 TEST_P(CompressedVectorTest, DecodeIncreasingSequenceUsingIterators) {
@@ -125,4 +126,25 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+class BitPackingVectorTest : public BaseTest {};
+
+TEST_F(BitPackingVectorTest, StoresOutliersAsExceptions) {
+  // Small values with a few large outliers. Without a max value hint, the compressor may patch the outliers.
+  auto sequence = pmr_vector<uint32_t>(2'000);
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    sequence[index] = index % 500 == 7 ? 4'000'000'000u : index % 13;
+  }
+
+  const auto encoded_sequence = compress_vector(sequence, VectorCompressionType::BitPacking, {});
+  const auto& bit_packing_vector = static_cast<const BitPackingVector&>(*encoded_sequence);
+  EXPECT_EQ(bit_packing_vector.bit_width(), 4u);
+  EXPECT_EQ(bit_packing_vector.exception_count(), 4u);
+  EXPECT_LT(bit_packing_vector.data_size(), sequence.size());
+
+  auto decompressor = encoded_sequence->create_base_decompressor();
+  for (auto index = size_t{0}; index < sequence.size(); ++index) {
+    EXPECT_EQ(decompressor->get(index), sequence[index]);
+  }
+}
+
 }  // namespace opossum
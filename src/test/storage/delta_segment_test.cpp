@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int64_t>> vs_int = std::make_shared<ValueSegment<int64_t>>(true);
+};
+
+TEST_F(StorageDeltaSegmentTest, EncodeUnsortedValues) {
+  const auto values = std::vector<int64_t>{1'000'000'000'000, 999'999'999'000, 999'999'999'000,
+                                           1'000'000'000'500, 1'002'000'000'000, 1'000'000'000'000};
+  for (const auto value : values) {
+    vs_int->append(value);
+  }
+  vs_int->append(NULL_VALUE);
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Long, vs_int, VectorCompressionType::BitPacking);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int64_t>>(segment);
+  ASSERT_NE(delta_segment, nullptr);
+
+  EXPECT_EQ(delta_segment->size(), 7u);
+  EXPECT_FALSE(delta_segment->is_ascending());
+  EXPECT_EQ(delta_segment->block_checkpoints(), pmr_vector<int64_t>{1'000'000'000'000});
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(delta_segment->get_typed_value(chunk_offset), values[chunk_offset]);
+  }
+  EXPECT_EQ(delta_segment->get_typed_value(ChunkOffset{6}), std::nullopt);
+}
+
+TEST_F(StorageDeltaSegmentTest, RejectLargeDifferences) {
+  vs_int->append(int64_t{0});
+  vs_int->append(int64_t{std::numeric_limits<int32_t>::max()});
+  vs_int->append(int64_t{-1});
+
+  EXPECT_THROW(encode_segment(EncodingType::Delta, DataType::Long, vs_int), std::logic_error);
+}
+
+TEST_F(StorageDeltaSegmentTest, ZigzagEncoding) {
+  EXPECT_EQ(DeltaSegment<int32_t>::encode_delta(0), 0u);
+  EXPECT_EQ(DeltaSegment<int32_t>::encode_delta(-1), 1u);
+  EXPECT_EQ(DeltaSegment<int32_t>::encode_delta(1), 2u);
+  EXPECT_EQ(DeltaSegment<int32_t>::encode_delta(std::numeric_limits<int32_t>::min()),
+            std::numeric_limits<uint32_t>::max());
+
+  for (const auto delta : {int64_t{0}, int64_t{-1}, int64_t{17}, int64_t{std::numeric_limits<int32_t>::max()},
+                           int64_t{std::numeric_limits<int32_t>::min()}}) {
+    EXPECT_EQ(DeltaSegment<int32_t>::decode_delta(DeltaSegment<int32_t>::encode_delta(delta)), delta);
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, BinarySearchSortedSegment) {
+  // Several blocks of increasing values with duplicates and NULLs (which repeat the preceding value)
+  auto values = std::vector<int64_t>{};
+  const auto row_count = DeltaSegment<int64_t>::block_size * 5 + 7;
+  for (auto index = 0u; index < row_count; ++index) {
+    values.emplace_back(int64_t{1'577'836'800} + index / 3 * 7);
+    if (index % 10 == 4) {
+      vs_int->append(NULL_VALUE);
+    } else {
+      vs_int->append(values.back());
+    }
+  }
+  // Leading NULLs repeat the first value
+  vs_int->null_values()[0] = true;
+  values[0] = values[1];
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Long, vs_int);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int64_t>>(segment);
+  ASSERT_NE(delta_segment, nullptr);
+  EXPECT_TRUE(delta_segment->is_ascending());
+
+  // The NULLs were replaced with the preceding values
+  for (auto index = size_t{1}; index < values.size(); ++index) {
+    if (index % 10 == 4) values[index] = values[index - 1];
+  }
+
+  for (const auto search_value : {int64_t{0}, values[0], values[200], values[200] + 1, values.back(),
+                                  values.back() + 1}) {
+    const auto expected_lower_bound =
+        static_cast<ChunkOffset>(std::lower_bound(values.cbegin(), values.cend(), search_value) - values.cbegin());
+    const auto expected_upper_bound =
+        static_cast<ChunkOffset>(std::upper_bound(values.cbegin(), values.cend(), search_value) - values.cbegin());
+    EXPECT_EQ(delta_segment->lower_bound(search_value), expected_lower_bound);
+    EXPECT_EQ(delta_segment->upper_bound(search_value), expected_upper_bound);
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, ScanAndStatisticsOfSortedSegment) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto value = 0; value < 1'000; ++value) {
+    if (value % 100 == 50) {
+      table->append({NULL_VALUE});
+    } else {
+      table->append({value / 2});
+    }
+  }
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Delta);
+
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  ASSERT_TRUE(std::dynamic_pointer_cast<const DeltaSegment<int32_t>>(segment)->is_ascending());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_row_counts = std::vector<std::pair<PredicateCondition, size_t>>{
+      {PredicateCondition::Equals, 2u},      {PredicateCondition::LessThan, 198u},
+      {PredicateCondition::LessThanEquals, 200u}, {PredicateCondition::GreaterThan, 790u},
+      {PredicateCondition::GreaterThanEquals, 792u}, {PredicateCondition::NotEquals, 988u}};
+  for (const auto& [predicate_condition, expected_row_count] : expected_row_counts) {
+    auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, 100);
+    table_scan->execute();
+    EXPECT_EQ(table_scan->get_output()->row_count(), expected_row_count);
+  }
+
+  // The value 25 at offsets 50 and 51 is NULL at offset 50
+  auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::Equals, 25);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 1u);
+
+  const auto statistics = SegmentStatistics::build_statistics(DataType::Int, segment);
+  EXPECT_TRUE(statistics->can_prune(PredicateCondition::GreaterThan, 499));
+  EXPECT_FALSE(statistics->can_prune(PredicateCondition::GreaterThan, 498));
+}
+
+}  // namespace opossum
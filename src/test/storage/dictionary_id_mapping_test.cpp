@@ -0,0 +1,152 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment/dictionary_id_mapping.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class DictionaryIDMappingTest : public BaseTest {
+ protected:
+  // Repeats the string values (empty ones become NULL) and stores the number of each repetition in the int column
+  static std::shared_ptr<Table> _create_table(const std::vector<std::string>& values, const size_t repetitions,
+                                              const ChunkOffset chunk_size) {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"s", DataType::String, true}, {"i", DataType::Int, false}}, TableType::Data,
+        chunk_size);
+    for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+      for (const auto& value : values) {
+        table->append({value.empty() ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{pmr_string{value}},
+                       static_cast<int32_t>(repetition)});
+      }
+    }
+    return table;
+  }
+
+  static std::vector<std::pair<bool, ValueID>> _ids(const DictionaryIDMapping& mapping, const Table& table) {
+    auto ids = std::vector<std::pair<bool, ValueID>>{};
+    for (const auto& chunk : table.chunks()) {
+      mapping.for_each_id(*chunk->get_segment(ColumnID{0}), [&](const bool is_null, const ValueID id,
+                                                                const ChunkOffset chunk_offset) {
+        ids.emplace_back(is_null, id);
+      });
+    }
+    return ids;
+  }
+};
+
+TEST_F(DictionaryIDMappingTest, SharedAndEqualDictionariesAreUsedAsTheyAre) {
+  const auto table_a = _create_table({"b", "a", "c"}, 4, 3);
+  const auto table_b = _create_table({"c", "b", "a"}, 2, 3);
+  ChunkEncoder::encode_all_chunks(table_a, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_all_chunks(table_b, SegmentEncodingSpec{EncodingType::GlobalDictionary});
+
+  const auto mapping = DictionaryIDMapping::create({{table_a, ColumnID{0}}, {table_b, ColumnID{0}}});
+  ASSERT_TRUE(mapping);
+  EXPECT_TRUE(mapping->is_identity());
+  EXPECT_EQ(_ids(*mapping, *table_b).front(), std::make_pair(false, ValueID{2}));
+}
+
+TEST_F(DictionaryIDMappingTest, DifferentDictionariesAreMerged) {
+  const auto table_a = _create_table({"b", "", "d", "f"}, 4, 16);
+  const auto table_b = _create_table({"a", "d", "f", "g"}, 4, 8);
+  ChunkEncoder::encode_all_chunks(table_a, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_all_chunks(table_b, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  // The ReferenceSegments of a scan map to the same ids as the segments that they reference
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_b);
+  table_wrapper->execute();
+  const auto scan = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::GreaterThanEquals, 2);
+  scan->execute();
+
+  const auto mapping = DictionaryIDMapping::create({{table_a, ColumnID{0}}, {scan->get_output(), ColumnID{0}}});
+  ASSERT_TRUE(mapping);
+  EXPECT_FALSE(mapping->is_identity());
+
+  // The merged dictionary is a, b, d, f, g
+  const auto ids_a = _ids(*mapping, *table_a);
+  ASSERT_EQ(ids_a.size(), 16u);
+  EXPECT_EQ(ids_a[0], std::make_pair(false, ValueID{1}));
+  EXPECT_TRUE(ids_a[1].first);
+  EXPECT_EQ(ids_a[2], std::make_pair(false, ValueID{2}));
+  EXPECT_EQ(ids_a[3], std::make_pair(false, ValueID{3}));
+
+  const auto ids_b = _ids(*mapping, *scan->get_output());
+  ASSERT_EQ(ids_b.size(), 8u);
+  EXPECT_EQ(ids_b[0], std::make_pair(false, ValueID{0}));
+  EXPECT_EQ(ids_b[1], std::make_pair(false, ValueID{2}));
+  EXPECT_EQ(ids_b[2], std::make_pair(false, ValueID{3}));
+  EXPECT_EQ(ids_b[3], std::make_pair(false, ValueID{4}));
+}
+
+TEST_F(DictionaryIDMappingTest, NoMappingWithoutDictionaries) {
+  const auto table_a = _create_table({"a", "b"}, 4, 8);
+  const auto table_b = _create_table({"a", "c"}, 6, 8);
+  ChunkEncoder::encode_all_chunks(table_a, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  // Segments that are not dictionary-encoded
+  EXPECT_FALSE(DictionaryIDMapping::create({{table_a, ColumnID{0}}, {table_b, ColumnID{0}}}));
+
+  // Columns of different data types
+  ChunkEncoder::encode_all_chunks(table_b, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FALSE(DictionaryIDMapping::create({{table_a, ColumnID{0}}, {table_b, ColumnID{1}}}));
+
+  // Dictionaries that differ are only merged for strings
+  EXPECT_TRUE(DictionaryIDMapping::create({{table_a, ColumnID{0}}, {table_b, ColumnID{0}}}));
+  EXPECT_FALSE(DictionaryIDMapping::create({{table_a, ColumnID{1}}, {table_b, ColumnID{1}}}));
+
+  // Dictionaries that are not much smaller than the columns are not merged
+  const auto unique_table = _create_table({"a", "b", "c", "d"}, 1, 2);
+  ChunkEncoder::encode_all_chunks(unique_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FALSE(DictionaryIDMapping::create({{unique_table, ColumnID{0}}}));
+}
+
+TEST_F(DictionaryIDMappingTest, JoinsOnIds) {
+  const auto left_values = std::vector<std::string>{"banana", "", "cherry", "apple", "fig"};
+  const auto right_values = std::vector<std::string>{"cherry", "date", "apple", "", "apple"};
+
+  const auto execute = [&](const EncodingType encoding_type) {
+    const auto left_table = _create_table(left_values, 6, 10);
+    const auto right_table = _create_table(right_values, 6, 10);
+    ChunkEncoder::encode_all_chunks(left_table, SegmentEncodingSpec{encoding_type});
+    ChunkEncoder::encode_all_chunks(right_table, SegmentEncodingSpec{encoding_type});
+
+    const auto left = std::make_shared<TableWrapper>(left_table);
+    const auto right = std::make_shared<TableWrapper>(right_table);
+    left->execute();
+    right->execute();
+
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+    auto joins = std::vector<std::shared_ptr<AbstractOperator>>{
+        std::make_shared<JoinHash>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals),
+        std::make_shared<JoinHash>(left, right, JoinMode::Left, column_ids, PredicateCondition::Equals),
+        std::make_shared<JoinSortMerge>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals),
+        std::make_shared<JoinSortMerge>(left, right, JoinMode::Outer, column_ids, PredicateCondition::Equals),
+        std::make_shared<JoinSortMerge>(left, right, JoinMode::Inner, column_ids, PredicateCondition::LessThan)};
+
+    auto results = std::vector<std::shared_ptr<const Table>>{};
+    for (const auto& join : joins) {
+      join->execute();
+      results.emplace_back(join->get_output());
+    }
+    return results;
+  };
+
+  const auto expected_results = execute(EncodingType::Unencoded);
+  const auto results = execute(EncodingType::Dictionary);
+  for (auto join_idx = size_t{0}; join_idx < results.size(); ++join_idx) {
+    EXPECT_TABLE_EQ_UNORDERED(results[join_idx], expected_results[join_idx]);
+  }
+}
+
+}  // namespace opossum
@@ -1,10 +1,12 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
@@ -121,6 +123,34 @@ TEST_F(StorageDictionarySegmentTest, CompressNullableSegmentInt) {
   EXPECT_TRUE(variant_is_null((*dict_segment)[4]));
 }
 
+TEST_F(StorageDictionarySegmentTest, ValueIDsFollowSortOrder) {
+  vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+
+  vs_str->append("Steve");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Alexander");
+  vs_str->append("Bill");
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::FixedStringDictionary}) {
+    const auto segment = encode_segment(encoding_type, DataType::String, vs_str);
+    const auto dict_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+    ASSERT_TRUE(dict_segment);
+
+    EXPECT_EQ(dict_segment->unique_values_count(), 3u);
+    EXPECT_EQ(dict_segment->null_value_id(), ValueID{3});
+
+    const auto expected_value_ids = std::vector<ValueID>{ValueID{2}, ValueID{3}, ValueID{1},
+                                                         ValueID{2}, ValueID{0}, ValueID{1}};
+    const auto decompressor = dict_segment->attribute_vector()->create_base_decompressor();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < expected_value_ids.size(); ++chunk_offset) {
+      EXPECT_EQ(decompressor->get(chunk_offset), expected_value_ids[chunk_offset]);
+      EXPECT_EQ((*segment)[chunk_offset], (*vs_str)[chunk_offset]);
+    }
+  }
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (int i = 0; i <= 10; i += 2) vs_int->append(i);
 
@@ -35,6 +35,8 @@ class EncodedSegmentTest : public BaseTestWithParam<SegmentEncodingSpec> {
       case EncodingType::FrameOfReference:
         // fill three blocks and a bit more
         return static_cast<size_t>(FrameOfReferenceSegment<int32_t>::block_size * (3.3));
+      case EncodingType::Delta:
+        return static_cast<size_t>(DeltaSegment<int32_t>::block_size * (3.3));
       default:
         return default_row_count;
     }
@@ -55,7 +57,7 @@ class EncodedSegmentTest : public BaseTestWithParam<SegmentEncodingSpec> {
 
   std::shared_ptr<ValueSegment<int32_t>> create_int_w_null_value_segment() {
     auto values = pmr_concurrent_vector<int32_t>(row_count());
-    auto null_values = pmr_concurrent_vector<bool>(row_count());
+    auto null_values = NullValueVector(row_count());
 
     std::default_random_engine engine{};
     std::uniform_int_distribution<int32_t> dist{0u, max_value};
@@ -123,8 +125,13 @@ INSTANTIATE_TEST_CASE_P(
     SegmentEncodingSpecs, EncodedSegmentTest,
     ::testing::Values(SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
+                      SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned},
+                      SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::BitPacking},
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::SimdBp128},
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::FixedSizeByteAligned},
+                      SegmentEncodingSpec{EncodingType::Delta, VectorCompressionType::BitPacking},
                       SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{EncodingType::LZ4}),
     formatter);
 
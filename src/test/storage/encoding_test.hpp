@@ -36,6 +36,7 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
     {EncodingType::Dictionary, VectorCompressionType::SimdBp128},
     {EncodingType::FrameOfReference},
+    {EncodingType::Delta},
     {EncodingType::LZ4},
     {EncodingType::RunLength}};
 
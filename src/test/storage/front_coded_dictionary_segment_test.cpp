@@ -0,0 +1,90 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/front_coded_dictionary_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionarySegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+};
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, CompressSegmentString) {
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Alexander");
+  vs_str->append("Steve");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Bill");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<pmr_string>>(segment);
+  ASSERT_TRUE(dict_segment);
+
+  EXPECT_EQ(dict_segment->encoding_type(), EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(dict_segment->size(), 6u);
+  EXPECT_EQ(dict_segment->unique_values_count(), 3u);
+  EXPECT_EQ(dict_segment->null_value_id(), 3u);
+
+  auto dict = dict_segment->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Steve");
+
+  EXPECT_EQ((*dict_segment)[0], AllTypeVariant("Bill"));
+  EXPECT_EQ((*dict_segment)[3], AllTypeVariant("Steve"));
+  EXPECT_TRUE(variant_is_null((*dict_segment)[4]));
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, CommonPrefixesAcrossBlocks) {
+  // Enough values for several blocks of the FrontCodedStringVector, all sharing a long prefix
+  const auto value_count = FrontCodedStringVector::BLOCK_SIZE * 3 + 5;
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    vs_str->append(pmr_string{"https://hyrise.example/products/" + std::to_string(1000 + index * 2)});
+  }
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<pmr_string>>(segment);
+
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    const auto value = pmr_string{"https://hyrise.example/products/" + std::to_string(1000 + index * 2)};
+    EXPECT_EQ(dict_segment->value_of_value_id(ValueID{static_cast<ValueID::base_type>(index)}), AllTypeVariant{value});
+    EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{value}), ValueID{static_cast<ValueID::base_type>(index)});
+    EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{value}), ValueID{static_cast<ValueID::base_type>(index + 1)});
+  }
+
+  // Values between and outside of the dictionary entries
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"https://hyrise.example/products/1001"}), ValueID{1});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{"https://hyrise.example/products/1001"}), ValueID{1});
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"a"}), ValueID{0});
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"z"}), INVALID_VALUE_ID);
+
+  // The front-coded dictionary is smaller than one that stores every string completely
+  EXPECT_LT(dict_segment->estimate_memory_usage(),
+            encode_segment(EncodingType::FixedStringDictionary, DataType::String, vs_str)->estimate_memory_usage());
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, CopyUsingAllocator) {
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Alexander");
+
+  auto segment = encode_segment(EncodingType::FrontCodedDictionary, DataType::String, vs_str);
+  auto dict_segment = std::dynamic_pointer_cast<FrontCodedDictionarySegment<pmr_string>>(segment);
+
+  auto base_segment = dict_segment->copy_using_allocator(PolymorphicAllocator<size_t>{});
+  auto dict_segment_copy = std::dynamic_pointer_cast<FrontCodedDictionarySegment<pmr_string>>(base_segment);
+  ASSERT_TRUE(dict_segment_copy);
+
+  EXPECT_EQ(*dict_segment_copy->dictionary(), *dict_segment->dictionary());
+  EXPECT_EQ((*dict_segment_copy)[2], AllTypeVariant("Alexander"));
+}
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include <string>
+#include <unordered_set>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "memory/arena_memory_resource.hpp"
+#include "storage/german_string.hpp"
+
+namespace opossum {
+
+class GermanStringTest : public BaseTest {
+ protected:
+  GermanString _create(const std::string& string) { return GermanString{string, _arena}; }
+
+  ArenaMemoryResource _arena;
+};
+
+TEST_F(GermanStringTest, InlineAndLongStrings) {
+  EXPECT_EQ(_create("").view(), "");
+  EXPECT_EQ(_create("abc").view(), "abc");
+  EXPECT_TRUE(_create("abcdefghijkl").is_inline());
+  EXPECT_EQ(_create("abcdefghijkl").view(), "abcdefghijkl");
+  EXPECT_FALSE(_create("abcdefghijklm").is_inline());
+  EXPECT_EQ(_create("abcdefghijklm").view(), "abcdefghijklm");
+  EXPECT_EQ(_create("abcdefghijklm").size(), 13u);
+}
+
+TEST_F(GermanStringTest, Equality) {
+  EXPECT_EQ(_create("abc"), _create("abc"));
+  EXPECT_NE(_create("abc"), _create("abd"));
+  EXPECT_NE(_create("abc"), _create("abcd"));
+  EXPECT_EQ(_create("abcdefghijkl"), _create("abcdefghijkl"));
+  EXPECT_NE(_create("abcdefghijkl"), _create("abcdefghijkx"));
+  EXPECT_EQ(_create("a long string with a common prefix"), _create("a long string with a common prefix"));
+  EXPECT_NE(_create("a long string with a common prefix"), _create("a long string with a common prefiX"));
+}
+
+TEST_F(GermanStringTest, Ordering) {
+  EXPECT_LT(_create(""), _create("a"));
+  EXPECT_LT(_create("ab"), _create("abc"));
+  EXPECT_LT(_create("abc"), _create("abd"));
+  EXPECT_LT(_create("abcdefghijkl"), _create("abcdefghijklm"));
+  EXPECT_LT(_create("a long string A"), _create("a long string B"));
+  EXPECT_FALSE(_create("a long string B") < _create("a long string A"));
+  EXPECT_FALSE(_create("abc") < _create("abc"));
+}
+
+TEST_F(GermanStringTest, Hash) {
+  auto strings = std::unordered_set<GermanString>{};
+  strings.emplace(_create("abc"));
+  strings.emplace(_create("a long string that is not inline"));
+
+  EXPECT_EQ(strings.count(_create("abc")), 1u);
+  EXPECT_EQ(strings.count(_create("a long string that is not inline")), 1u);
+  EXPECT_EQ(strings.count(_create("abd")), 0u);
+}
+
+}  // namespace opossum
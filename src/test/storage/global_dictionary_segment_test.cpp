@@ -0,0 +1,151 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/global_dictionary_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+class StorageGlobalDictionarySegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = _create_table();
+  }
+
+  static std::shared_ptr<Table> _create_table() {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data, 3);
+    table->append({3, "Bill"});
+    table->append({1, "Steve"});
+    table->append({3, NULL_VALUE});
+    table->append({2, "Alexander"});
+    table->append({1, "Bill"});
+    table->append({2, "Steve"});
+    return table;
+  }
+
+  static std::vector<AllTypeVariant> _column_values(const Table& table, const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (const auto& chunk : table.chunks()) {
+      const auto& segment = *chunk->get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        values.emplace_back(segment[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  template <typename T>
+  static std::shared_ptr<const GlobalDictionarySegment<T>> _segment(const Table& table, const ChunkID chunk_id,
+                                                                    const ColumnID column_id) {
+    return std::dynamic_pointer_cast<const GlobalDictionarySegment<T>>(
+        table.get_chunk(chunk_id)->get_segment(column_id));
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageGlobalDictionarySegmentTest, SharesDictionaryAcrossChunks) {
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::GlobalDictionary});
+
+  const auto segment_a = _segment<pmr_string>(*_table, ChunkID{0}, ColumnID{1});
+  const auto segment_b = _segment<pmr_string>(*_table, ChunkID{1}, ColumnID{1});
+  ASSERT_TRUE(segment_a);
+  ASSERT_TRUE(segment_b);
+  EXPECT_EQ(segment_a->encoding_type(), EncodingType::GlobalDictionary);
+  EXPECT_EQ(segment_a->dictionary(), segment_b->dictionary());
+  EXPECT_EQ(*segment_a->dictionary(), (pmr_vector<pmr_string>{"Alexander", "Bill", "Steve"}));
+
+  // Chunk 1 does not contain "Bill" and chunk 0 not "Alexander", but both use the ValueIDs of the whole column
+  EXPECT_EQ(segment_a->null_value_id(), 3u);
+  EXPECT_EQ(segment_a->lower_bound("Steve"), ValueID{2});
+  EXPECT_EQ(segment_b->lower_bound("Steve"), ValueID{2});
+  EXPECT_EQ((*segment_a)[0], AllTypeVariant{"Bill"});
+  EXPECT_TRUE(variant_is_null((*segment_a)[2]));
+  EXPECT_EQ((*segment_b)[0], AllTypeVariant{"Alexander"});
+}
+
+TEST_F(StorageGlobalDictionarySegmentTest, MergesValuesOfLaterChunks) {
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::GlobalDictionary});
+  const auto old_dictionary = _segment<int32_t>(*_table, ChunkID{0}, ColumnID{0})->dictionary();
+
+  // Values that are already in the dictionary do not change it
+  _table->append({2, "Bill"});
+  ChunkEncoder::encode_chunks(_table, {ChunkID{2}}, SegmentEncodingSpec{EncodingType::GlobalDictionary});
+  EXPECT_EQ(_segment<int32_t>(*_table, ChunkID{2}, ColumnID{0})->dictionary(), old_dictionary);
+
+  // New values are merged into the dictionary and the ValueIDs of all encoded chunks are remapped
+  _table->append({0, "Zoe"});
+  _table->append({5, "Carl"});
+  _table->append({4, NULL_VALUE});
+  ChunkEncoder::encode_chunks(_table, {ChunkID{3}}, SegmentEncodingSpec{EncodingType::GlobalDictionary});
+
+  const auto new_dictionary = _segment<int32_t>(*_table, ChunkID{0}, ColumnID{0})->dictionary();
+  EXPECT_NE(new_dictionary, old_dictionary);
+  EXPECT_EQ(*new_dictionary, (pmr_vector<int32_t>{0, 1, 2, 3, 4, 5}));
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_segment<int32_t>(*_table, chunk_id, ColumnID{0})->dictionary(), new_dictionary);
+    EXPECT_EQ(_segment<pmr_string>(*_table, chunk_id, ColumnID{1})->null_value_id(), 5u);
+  }
+
+  EXPECT_EQ(_column_values(*_table, ColumnID{0}), (std::vector<AllTypeVariant>{3, 1, 3, 2, 1, 2, 2, 0, 5, 4}));
+  const auto values_b = _column_values(*_table, ColumnID{1});
+  const auto expected_values_b = std::vector<AllTypeVariant>{"Bill", "Steve", NULL_VALUE, "Alexander", "Bill",
+                                                             "Steve", "Bill", "Zoe", "Carl", NULL_VALUE};
+  ASSERT_EQ(values_b.size(), expected_values_b.size());
+  for (auto index = size_t{0}; index < values_b.size(); ++index) {
+    EXPECT_EQ(variant_is_null(values_b[index]), variant_is_null(expected_values_b[index]));
+    if (!variant_is_null(expected_values_b[index])) {
+      EXPECT_EQ(values_b[index], expected_values_b[index]);
+    }
+  }
+}
+
+TEST_F(StorageGlobalDictionarySegmentTest, OperatorsMatchDictionaryEncoding) {
+  const auto dictionary_table = _create_table();
+  ChunkEncoder::encode_all_chunks(dictionary_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::GlobalDictionary});
+
+  const auto execute = [](const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto scan = std::make_shared<TableScan>(
+        table_wrapper, greater_than_equals_(get_column_expression(table_wrapper, ColumnID{1}), "Bill"));
+    const auto like_scan =
+        std::make_shared<TableScan>(table_wrapper, like_(get_column_expression(table_wrapper, ColumnID{1}), "%e%"));
+    const auto aggregate = std::make_shared<Aggregate>(
+        table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Count}},
+        std::vector<ColumnID>{ColumnID{1}});
+    const auto join = std::make_shared<JoinHash>(table_wrapper, table_wrapper, JoinMode::Inner,
+                                                 ColumnIDPair{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals);
+
+    auto results = std::vector<std::shared_ptr<const Table>>{};
+    for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{scan, like_scan, aggregate, join}) {
+      op->execute();
+      results.emplace_back(op->get_output());
+    }
+    return results;
+  };
+
+  const auto expected_results = execute(dictionary_table);
+  const auto results = execute(_table);
+  for (auto index = size_t{0}; index < results.size(); ++index) {
+    EXPECT_TABLE_EQ_UNORDERED(results[index], expected_results[index]);
+  }
+  EXPECT_EQ(results[3]->row_count(), 9u);
+}
+
+}  // namespace opossum
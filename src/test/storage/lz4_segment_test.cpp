@@ -146,4 +146,56 @@ TEST_F(StorageLZ4SegmentTest, CompressSingleCharSegmentString) {
   EXPECT_EQ((*offsets)[5], 0);
 }
 
+TEST_F(StorageLZ4SegmentTest, CompressIntSegmentInBlocks) {
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    if (value % 100 == 0) {
+      vs_int->append(NULL_VALUE);
+    } else {
+      vs_int->append(value);
+    }
+  }
+
+  auto segment = encode_segment(EncodingType::LZ4, DataType::Int, vs_int);
+  auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<int32_t>>(segment);
+
+  // 40'000 bytes are split into blocks of 16 KB
+  EXPECT_EQ(lz4_segment->lz4_blocks().size(), 3u);
+  EXPECT_TRUE(lz4_segment->dictionary().empty());
+
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{0}), std::nullopt);
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{4'095}), 4'095);
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{4'096}), 4'096);
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{9'999}), 9'999);
+
+  const auto decompressed_data = lz4_segment->decompress();
+  ASSERT_EQ(decompressed_data.size(), 10'000u);
+  EXPECT_EQ(decompressed_data[8'193], 8'193);
+}
+
+TEST_F(StorageLZ4SegmentTest, CompressStringSegmentInBlocksWithDictionary) {
+  auto expected_values = std::vector<pmr_string>{};
+  for (auto index = 0; index < 2'000; ++index) {
+    expected_values.emplace_back("customer#" + std::to_string(index * 7919 % 2'000));
+    vs_str->append(expected_values.back());
+  }
+
+  auto segment = encode_segment(EncodingType::LZ4, DataType::String, vs_str);
+  auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<pmr_string>>(segment);
+
+  EXPECT_GT(lz4_segment->lz4_blocks().size(), 1u);
+  EXPECT_FALSE(lz4_segment->dictionary().empty());
+
+  // Strings that span two blocks are decompressed from both of them, the cache then holds the second one
+  auto cached_block_index = std::optional<size_t>{};
+  auto cached_block = std::vector<char>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < expected_values.size(); ++chunk_offset) {
+    EXPECT_EQ(lz4_segment->decompress(chunk_offset, cached_block_index, cached_block), expected_values[chunk_offset]);
+  }
+  EXPECT_EQ(cached_block_index, lz4_segment->lz4_blocks().size() - 1);
+
+  EXPECT_EQ(lz4_segment->get_typed_value(ChunkOffset{1'000}), expected_values[1'000]);
+  EXPECT_EQ(lz4_segment->decompress(), std::vector<pmr_string>(expected_values.cbegin(), expected_values.cend()));
+}
+
 }  // namespace opossum
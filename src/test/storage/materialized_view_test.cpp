@@ -0,0 +1,141 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "storage/lqp_view.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    append_committed({1, 10});
+    append_committed({2, 20});
+    append_committed({1, 30});
+    StorageManager::get().add_table("t", _table);
+
+    _stored_table_node = StoredTableNode::make("t");
+    _a = _stored_table_node->get_column("a");
+    _b = _stored_table_node->get_column("b");
+  }
+
+  void append_committed(const std::vector<AllTypeVariant>& values) {
+    _table->append(values);
+    _table->get_chunk(ChunkID{_table->chunk_count() - 1})->get_scoped_mvcc_data_lock()->begin_cids.back() = 0;
+  }
+
+  // Expected result of the aggregate LQP below for the rows (a, sum, count, min, max)
+  std::shared_ptr<Table> expected_table(const Table& result, const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>(result.column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  std::shared_ptr<LQPView> aggregate_view() {
+    // clang-format off
+    const auto lqp =
+    AggregateNode::make(expression_vector(_a), expression_vector(sum_(_b), count_(_b), min_(_b), max_(_b)),
+      ValidateNode::make(
+        _stored_table_node));
+    // clang-format on
+
+    return std::make_shared<LQPView>(lqp, std::unordered_map<ColumnID, std::string>{});
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  LQPColumnReference _a, _b;
+};
+
+TEST_F(MaterializedViewTest, IncrementalRefresh) {
+  const auto materialized_view = std::make_shared<MaterializedView>(aggregate_view());
+  EXPECT_TRUE(materialized_view->is_incrementally_refreshable());
+  EXPECT_TRUE(materialized_view->is_up_to_date());
+
+  const auto result = materialized_view->table();
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_table(*result, {{1, int64_t{40}, int64_t{2}, 10, 30},
+                                                             {2, int64_t{20}, int64_t{1}, 20, 20}}));
+
+  // The second chunk is completed and a third one is added
+  append_committed({2, 5});
+  append_committed({3, 7});
+  EXPECT_FALSE(materialized_view->is_up_to_date());
+
+  materialized_view->refresh();
+  EXPECT_TRUE(materialized_view->is_up_to_date());
+  EXPECT_TABLE_EQ_UNORDERED(materialized_view->table(),
+                            expected_table(*result, {{1, int64_t{40}, int64_t{2}, 10, 30},
+                                                     {2, int64_t{25}, int64_t{2}, 5, 20},
+                                                     {3, int64_t{7}, int64_t{1}, 7, 7}}));
+
+  // The previous result is not changed by the refresh
+  EXPECT_EQ(result->row_count(), 2u);
+}
+
+TEST_F(MaterializedViewTest, UncommittedRows) {
+  const auto materialized_view = std::make_shared<MaterializedView>(aggregate_view());
+
+  // Rows of an insert that is not committed yet are invisible, but the view becomes outdated once they are committed
+  _table->append({4, 40});
+  materialized_view->refresh();
+  EXPECT_FALSE(materialized_view->is_up_to_date());
+
+  const auto result = materialized_view->table();
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_table(*result, {{1, int64_t{40}, int64_t{2}, 10, 30},
+                                                             {2, int64_t{20}, int64_t{1}, 20, 20}}));
+}
+
+TEST_F(MaterializedViewTest, EntireRefresh) {
+  // AVG cannot be merged, so the view is re-executed on refresh
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(_a), expression_vector(avg_(_b)),
+    PredicateNode::make(greater_than_(_b, 5),
+      _stored_table_node));
+  // clang-format on
+
+  const auto materialized_view =
+      std::make_shared<MaterializedView>(std::make_shared<LQPView>(lqp, std::unordered_map<ColumnID, std::string>{}));
+  EXPECT_FALSE(materialized_view->is_incrementally_refreshable());
+
+  append_committed({2, 40});
+  materialized_view->refresh();
+
+  const auto result = materialized_view->table();
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_table(*result, {{1, 20.0}, {2, 30.0}}));
+}
+
+TEST_F(MaterializedViewTest, NotIncrementallyRefreshable) {
+  // Group by columns that are not part of the output
+  // clang-format off
+  const auto projection_lqp =
+  ProjectionNode::make(expression_vector(sum_(_b)),
+    AggregateNode::make(expression_vector(_a), expression_vector(sum_(_b)),
+      _stored_table_node));
+  // clang-format on
+
+  const auto materialized_view = std::make_shared<MaterializedView>(
+      std::make_shared<LQPView>(projection_lqp, std::unordered_map<ColumnID, std::string>{}));
+  EXPECT_FALSE(materialized_view->is_incrementally_refreshable());
+}
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/meta_tables.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/invalid_input_exception.hpp"
+
+namespace opossum {
+
+class MetaTablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two chunks of which the first is dictionary-encoded and has an index on column a
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    _table->append({1, pmr_string{"x"}});
+    _table->append({2, pmr_string{"x"}});
+    _table->append({2, NULL_VALUE});
+    _table->append({4, pmr_string{"y"}});
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+    _table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    StorageManager::get().add_table("t", _table);
+  }
+
+  std::shared_ptr<const Table> _execute(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MetaTablesTest, MetaTableNames) {
+  EXPECT_EQ(meta_table_names(), (std::vector<std::string>{"meta_chunks", "meta_segments", "meta_tables"}));
+  EXPECT_TRUE(is_meta_table_name("meta_segments"));
+  EXPECT_FALSE(is_meta_table_name("t"));
+
+  // The StorageManager knows the meta tables, but does not list them as stored tables
+  EXPECT_TRUE(StorageManager::get().has_table("meta_tables"));
+  EXPECT_EQ(StorageManager::get().table_names(), std::vector<std::string>{"t"});
+  EXPECT_THROW(StorageManager::get().add_table("meta_tables", _table), std::logic_error);
+}
+
+TEST_F(MetaTablesTest, Tables) {
+  const auto meta_table = generate_meta_table("meta_tables");
+  ASSERT_EQ(meta_table->row_count(), 1u);
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{0}, 0), "t");
+  EXPECT_EQ(meta_table->get_value<int32_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(meta_table->get_value<int32_t>(ColumnID{2}, 0), 2);
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{3}, 0), 4);
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{5}, 0), static_cast<int64_t>(_table->estimate_memory_usage()));
+  EXPECT_GT(meta_table->get_value<int64_t>(ColumnID{6}, 0), 0);
+}
+
+TEST_F(MetaTablesTest, Chunks) {
+  const auto meta_table = generate_meta_table("meta_chunks");
+  ASSERT_EQ(meta_table->row_count(), 2u);
+  for (auto row = size_t{0}; row < 2; ++row) {
+    const auto chunk = _table->get_chunk(ChunkID{static_cast<ChunkID::base_type>(row)});
+    EXPECT_EQ(meta_table->get_value<int32_t>(ColumnID{1}, row), static_cast<int32_t>(row));
+    EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{2}, row), static_cast<int64_t>(chunk->size()));
+    EXPECT_EQ(meta_table->get_value<int32_t>(ColumnID{4}, row), chunk->is_mutable() ? 1 : 0);
+    EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{6}, row), static_cast<int64_t>(chunk->estimate_memory_usage()));
+  }
+  EXPECT_GT(meta_table->get_value<int64_t>(ColumnID{7}, 0), 0);
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{7}, 1), 0);
+}
+
+TEST_F(MetaTablesTest, SegmentsViaSQL) {
+  const auto result = _execute(
+      "SELECT chunk_id, column_id, column_name, encoding_type, vector_compression_type, row_count, distinct_count "
+      "FROM meta_segments ORDER BY chunk_id, column_id");
+
+  const auto expected_table = std::make_shared<Table>(result->column_definitions(), TableType::Data);
+  expected_table->append({0, 0, pmr_string{"a"}, pmr_string{"Dictionary"}, pmr_string{"FixedSize1ByteAligned"},
+                          int64_t{3}, int64_t{2}});
+  expected_table->append({0, 1, pmr_string{"b"}, pmr_string{"Dictionary"}, pmr_string{"FixedSize1ByteAligned"},
+                          int64_t{3}, int64_t{1}});
+  expected_table->append({1, 0, pmr_string{"a"}, pmr_string{"Unencoded"}, NULL_VALUE, int64_t{1}, NULL_VALUE});
+  expected_table->append({1, 1, pmr_string{"b"}, pmr_string{"Unencoded"}, NULL_VALUE, int64_t{1}, NULL_VALUE});
+  EXPECT_TABLE_EQ_ORDERED(result, expected_table);
+
+  // Only the dictionary-encoded segment of column a is indexed
+  const auto index_result = _execute("SELECT chunk_id, column_id FROM meta_segments WHERE index_size_in_bytes > 0");
+  ASSERT_EQ(index_result->row_count(), 1u);
+  EXPECT_EQ(index_result->get_value<int32_t>(ColumnID{0}, 0), 0);
+  EXPECT_EQ(index_result->get_value<int32_t>(ColumnID{1}, 0), 0);
+}
+
+TEST_F(MetaTablesTest, GeneratedOnExecution) {
+  // The meta tables reflect the stored tables at the time the GetTable operator is executed
+  const auto get_table = std::make_shared<GetTable>("meta_chunks");
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->row_count(), 2u);
+
+  // The second chunk is full after two more rows
+  _table->append({5, pmr_string{"z"}});
+  _table->append({6, pmr_string{"z"}});
+  _table->append({7, pmr_string{"z"}});
+  const auto get_table_copy = get_table->deep_copy();
+  get_table_copy->execute();
+  EXPECT_EQ(get_table_copy->get_output()->row_count(), 3u);
+}
+
+TEST_F(MetaTablesTest, ReadOnly) {
+  EXPECT_THROW(_execute("INSERT INTO meta_tables (table_name) VALUES ('u')"), InvalidInputException);
+  EXPECT_THROW(_execute("DELETE FROM meta_chunks"), InvalidInputException);
+  EXPECT_THROW(_execute("UPDATE meta_segments SET row_count = 0"), InvalidInputException);
+  EXPECT_THROW(_execute("DROP TABLE meta_tables"), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -0,0 +1,129 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/base_mutable_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+class StorageMutableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // As the chunks are not encoded, they all get a mutable index
+    _table = load_table("resources/test_data/tbl/int_int3.tbl", 3);
+    _table->create_index<GroupKeyIndex>({ColumnID{0}});
+  }
+
+  std::vector<ChunkOffset> lookup(const ChunkID chunk_id, const PredicateCondition predicate_condition,
+                                  const AllTypeVariant& search_value,
+                                  const std::optional<AllTypeVariant>& search_value2 = std::nullopt) const {
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    _table->get_chunk(chunk_id)->get_mutable_index(ColumnID{0})->append_matches(predicate_condition, search_value,
+                                                                                 search_value2, chunk_offsets);
+    return chunk_offsets;
+  }
+
+  std::shared_ptr<IndexScan> create_index_scan(const PredicateCondition predicate_condition,
+                                               const AllTypeVariant& search_value) const {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+    auto index_scan =
+        std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                    predicate_condition, std::vector<AllTypeVariant>{search_value});
+    index_scan->execute();
+    return index_scan;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageMutableIndexTest, LookupWithAllPredicates) {
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_mutable_index(ColumnID{1}), nullptr);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_mutable_index(ColumnID{0})->size(), 3u);
+
+  // Chunk 0 contains 4, 1, 13. Offsets are returned in the order of their values.
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::Equals, 4), (std::vector<ChunkOffset>{0}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::NotEquals, 4), (std::vector<ChunkOffset>{1, 2}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::LessThan, 13), (std::vector<ChunkOffset>{1, 0}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::LessThanEquals, 13), (std::vector<ChunkOffset>{1, 0, 2}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::GreaterThan, 4), (std::vector<ChunkOffset>{2}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::GreaterThanEquals, 4), (std::vector<ChunkOffset>{0, 2}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::Between, 1, AllTypeVariant{4}), (std::vector<ChunkOffset>{1, 0}));
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::Between, 4, AllTypeVariant{1}), std::vector<ChunkOffset>{});
+  EXPECT_EQ(lookup(ChunkID{0}, PredicateCondition::Equals, NULL_VALUE), std::vector<ChunkOffset>{});
+
+  // Appended rows are indexed, both in the existing mutable chunk and in newly created ones
+  _table->append({4, 20});
+  _table->append({4, 21});
+  EXPECT_EQ(lookup(ChunkID{2}, PredicateCondition::Equals, 4), (std::vector<ChunkOffset>{2}));
+  EXPECT_EQ(lookup(ChunkID{3}, PredicateCondition::Equals, 4), (std::vector<ChunkOffset>{0}));
+}
+
+TEST_F(StorageMutableIndexTest, MaintainedByInsertAndFinalizedByCompression) {
+  StorageManager::get().add_table("table_a", _table);
+
+  auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values_to_insert->append({1, 30});
+  values_to_insert->append({2, 31});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  auto insert_context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+
+  // 1, 1, 0, 2 in chunks 0, 2, 2 and 3
+  EXPECT_EQ(create_index_scan(PredicateCondition::LessThanEquals, 2)->get_output()->row_count(), 4u);
+
+  const auto chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}};
+  std::make_unique<ChunkCompressionTask>("table_a", chunk_ids)->execute();
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{3}; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_NE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}), nullptr);
+    EXPECT_TRUE(chunk->mutable_indexes().empty());
+  }
+  EXPECT_NE(_table->get_chunk(ChunkID{3})->get_mutable_index(ColumnID{0}), nullptr);
+
+  EXPECT_EQ(create_index_scan(PredicateCondition::LessThanEquals, 2)->get_output()->row_count(), 4u);
+}
+
+TEST_F(StorageMutableIndexTest, JoinIndexUsesMutableIndexes) {
+  auto left = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_int3.tbl", 2));
+  auto right = std::make_shared<TableWrapper>(_table);
+  left->execute();
+  right->execute();
+
+  for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan,
+                                         PredicateCondition::GreaterThanEquals, PredicateCondition::NotEquals}) {
+    auto join_index = std::make_shared<JoinIndex>(left, right, JoinMode::Outer, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                  predicate_condition);
+    join_index->execute();
+
+    const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join_index->performance_data());
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, _table->chunk_count());
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+
+    auto join_nested_loop = std::make_shared<JoinNestedLoop>(
+        left, right, JoinMode::Outer, ColumnIDPair(ColumnID{0}, ColumnID{0}), predicate_condition);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_index->get_output(), join_nested_loop->get_output());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/null_value_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+
+namespace opossum {
+
+class NullValueVectorTest : public BaseTest {};
+
+TEST_F(NullValueVectorTest, PushBackAndAccess) {
+  auto null_values = NullValueVector{};
+  for (auto index = size_t{0}; index < 130; ++index) {
+    null_values.push_back(index % 3 == 0);
+  }
+
+  EXPECT_EQ(null_values.size(), 130u);
+  EXPECT_EQ(null_values.word_count(), 3u);
+  EXPECT_FALSE(null_values.all_valid());
+  for (auto index = size_t{0}; index < 130; ++index) {
+    EXPECT_EQ(null_values[index], index % 3 == 0);
+  }
+  EXPECT_EQ(std::count(null_values.cbegin(), null_values.cend(), true), 44);
+  EXPECT_EQ(null_values.memory_usage(), 3 * sizeof(NullValueVector::Word));
+}
+
+TEST_F(NullValueVectorTest, AllValid) {
+  auto null_values = NullValueVector(100);
+  EXPECT_TRUE(null_values.all_valid());
+  EXPECT_EQ(null_values.word(0), 0u);
+
+  null_values[10] = false;
+  EXPECT_TRUE(null_values.all_valid());
+
+  null_values[70] = true;
+  EXPECT_FALSE(null_values.all_valid());
+  EXPECT_EQ(null_values.word(1), uint64_t{1} << 6);
+}
+
+TEST_F(NullValueVectorTest, GrowAddsNonNullRows) {
+  auto null_values = NullValueVector(10, true);
+  EXPECT_TRUE(null_values.back());
+
+  null_values.grow_to_at_least(100);
+  EXPECT_EQ(null_values.size(), 100u);
+  EXPECT_TRUE(null_values[9]);
+  EXPECT_FALSE(null_values[10]);
+  EXPECT_FALSE(null_values[99]);
+
+  // Shrinking is not possible
+  null_values.grow_to_at_least(50);
+  EXPECT_EQ(null_values.size(), 100u);
+}
+
+TEST_F(NullValueVectorTest, CopyAndCompare) {
+  const auto null_values = NullValueVector{true, false, false, true};
+  const auto copy = NullValueVector{null_values, NullValueVector::allocator_type{}};
+  EXPECT_EQ(copy, null_values);
+  EXPECT_EQ(std::vector<bool>(copy.crbegin(), copy.crend()), (std::vector<bool>{true, false, false, true}));
+
+  auto other = NullValueVector{true, false, true, true};
+  EXPECT_FALSE(other == null_values);
+  other[2] = false;
+  EXPECT_EQ(other, null_values);
+}
+
+TEST_F(NullValueVectorTest, ValueSegmentWithoutNullsIsIteratedAsNonNull) {
+  auto segment = ValueSegment<int32_t>{true};
+  segment.append(1);
+  segment.append(2);
+  EXPECT_TRUE(segment.null_values().all_valid());
+
+  ValueSegmentIterable<int32_t>{segment}.with_iterators([&](auto it, auto /* end */) {
+    EXPECT_TRUE((std::is_same_v<std::decay_t<decltype(*it)>, NonNullSegmentPosition<int32_t>>));
+  });
+
+  segment.append(NULL_VALUE);
+  EXPECT_FALSE(segment.null_values().all_valid());
+
+  auto null_count = size_t{0};
+  segment_iterate<int32_t>(segment, [&](const auto& position) { null_count += position.is_null(); });
+  EXPECT_EQ(null_count, 1u);
+}
+
+}  // namespace opossum
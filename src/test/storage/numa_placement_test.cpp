@@ -0,0 +1,84 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class NUMAPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Topology::use_fake_numa_topology(8, 1);
+    _table = load_table("resources/test_data/tbl/int_float.tbl", 1);
+  }
+
+  void TearDown() override { Topology::use_default_topology(); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(NUMAPlacementTest, RoundRobinPlacesConsecutiveChunksOnConsecutiveNodes) {
+  const auto first_node_id = numa_node_for_chunk(NUMAPlacementPolicy::RoundRobin, "table", ChunkID{0}, 4);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 8; ++chunk_id) {
+    EXPECT_EQ(numa_node_for_chunk(NUMAPlacementPolicy::RoundRobin, "table", chunk_id, 4),
+              NodeID{(first_node_id + chunk_id) % 4});
+  }
+}
+
+TEST_F(NUMAPlacementTest, NodesAreWithinBounds) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    EXPECT_LT(numa_node_for_chunk(NUMAPlacementPolicy::RoundRobin, "table", chunk_id, 3), 3u);
+    EXPECT_LT(numa_node_for_chunk(NUMAPlacementPolicy::Hash, "table", chunk_id, 3), 3u);
+    EXPECT_EQ(numa_node_for_chunk(NUMAPlacementPolicy::Hash, "table", chunk_id, 1), NodeID{0});
+  }
+}
+
+TEST_F(NUMAPlacementTest, AddTablePlacesChunks) {
+  const auto node_count = Topology::get().nodes().size();
+  if (node_count < 2) GTEST_SKIP();
+
+  StorageManager::get().add_table("table", _table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto expected_node_id = numa_node_for_chunk(NUMAPlacementPolicy::RoundRobin, "table", chunk_id, node_count);
+    EXPECT_EQ(_table->get_chunk(chunk_id)->numa_node_id(), expected_node_id);
+    EXPECT_EQ(preferred_node_for_chunk(*_table, chunk_id), expected_node_id);
+  }
+}
+
+TEST_F(NUMAPlacementTest, NoPlacementWithoutPolicy) {
+  StorageManager::get().set_numa_placement_policy(std::nullopt);
+  StorageManager::get().add_table("table", _table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->numa_node_id(), INVALID_NODE_ID);
+    EXPECT_EQ(preferred_node_for_chunk(*_table, chunk_id), CURRENT_NODE_ID);
+  }
+}
+
+TEST_F(NUMAPlacementTest, ReferenceChunksPreferNodeOfReferencedChunk) {
+  const auto node_count = Topology::get().nodes().size();
+  if (node_count < 2) GTEST_SKIP();
+
+  StorageManager::get().add_table("table", _table);
+
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  const auto table_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  table_scan->execute();
+
+  const auto& output_table = *table_scan->get_output();
+  ASSERT_EQ(output_table.chunk_count(), _table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(preferred_node_for_chunk(output_table, chunk_id), _table->get_chunk(chunk_id)->numa_node_id());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PosListTest : public BaseTest {
+ protected:
+  PosList _row_ids(const std::vector<ChunkOffset>& chunk_offsets) {
+    auto pos_list = PosList{};
+    for (const auto chunk_offset : chunk_offsets) pos_list.emplace_back(ChunkID{3}, chunk_offset);
+    pos_list.guarantee_single_chunk();
+    return pos_list;
+  }
+};
+
+TEST_F(PosListTest, ChunkRange) {
+  const auto pos_list = PosList::chunk_range(ChunkID{3}, 5, 9);
+
+  EXPECT_EQ(pos_list.representation(), PosListRepresentation::ChunkRange);
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_EQ(pos_list.size(), 4u);
+  EXPECT_EQ(pos_list.memory_usage(), 0u);
+  EXPECT_EQ(pos_list[2], RowID(ChunkID{3}, 7));
+  EXPECT_EQ(pos_list, _row_ids({5, 6, 7, 8}));
+}
+
+TEST_F(PosListTest, ShrinkToRange) {
+  auto pos_list = _row_ids({2, 3, 4, 5});
+  EXPECT_TRUE(pos_list.shrink_to_compact_representation());
+  EXPECT_EQ(pos_list.representation(), PosListRepresentation::ChunkRange);
+  EXPECT_EQ(pos_list.range_begin(), 2u);
+  EXPECT_EQ(pos_list.range_end(), 6u);
+  EXPECT_EQ(pos_list, _row_ids({2, 3, 4, 5}));
+}
+
+TEST_F(PosListTest, ShrinkToBitmap) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; chunk_offset += 3) {
+    chunk_offsets.emplace_back(chunk_offset);
+  }
+
+  auto pos_list = _row_ids(chunk_offsets);
+  EXPECT_TRUE(pos_list.shrink_to_compact_representation());
+  EXPECT_EQ(pos_list.representation(), PosListRepresentation::ChunkBitmap);
+  EXPECT_LT(pos_list.memory_usage(), chunk_offsets.size() * sizeof(ChunkOffset));
+  EXPECT_EQ(pos_list.size(), chunk_offsets.size());
+  EXPECT_EQ(pos_list, _row_ids(chunk_offsets));
+
+  // Random access and iterator arithmetic
+  EXPECT_EQ(pos_list[100], RowID(ChunkID{3}, 300));
+  EXPECT_EQ(*(pos_list.cbegin() + 200), RowID(ChunkID{3}, 600));
+  EXPECT_EQ((pos_list.cend() - 1)->chunk_offset, 999u);
+  EXPECT_EQ(pos_list.cend() - pos_list.cbegin(), static_cast<std::ptrdiff_t>(chunk_offsets.size()));
+
+  auto visited = std::vector<ChunkOffset>{};
+  pos_list.for_each_chunk_offset([&](const auto chunk_offset) { visited.emplace_back(chunk_offset); });
+  EXPECT_EQ(visited, chunk_offsets);
+}
+
+TEST_F(PosListTest, ShrinkToChunkOffsets) {
+  auto pos_list = _row_ids({1, 70, 500, 4000});
+  EXPECT_TRUE(pos_list.shrink_to_compact_representation());
+  EXPECT_EQ(pos_list.representation(), PosListRepresentation::ChunkOffsets);
+  EXPECT_EQ(pos_list.memory_usage(), 4 * sizeof(ChunkOffset));
+  EXPECT_EQ(pos_list, _row_ids({1, 70, 500, 4000}));
+}
+
+TEST_F(PosListTest, NoShrinkIfUnsortedOrMultipleChunks) {
+  auto unsorted = _row_ids({3, 1, 2});
+  EXPECT_FALSE(unsorted.shrink_to_compact_representation());
+  EXPECT_EQ(unsorted.representation(), PosListRepresentation::RowIDs);
+
+  auto multiple_chunks = PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 1}};
+  EXPECT_FALSE(multiple_chunks.shrink_to_compact_representation());
+}
+
+TEST_F(PosListTest, ModificationMaterializes) {
+  auto pos_list = PosList::chunk_range(ChunkID{3}, 0, 3);
+  pos_list.emplace_back(ChunkID{3}, 10);
+
+  EXPECT_EQ(pos_list.representation(), PosListRepresentation::RowIDs);
+  EXPECT_EQ(pos_list, _row_ids({0, 1, 2, 10}));
+}
+
+TEST_F(PosListTest, ReferenceSegmentIteration) {
+  auto table = load_table("resources/test_data/tbl/int_float.tbl", 10);
+
+  auto expected = std::vector<int32_t>{};
+  segment_iterate<int32_t>(*table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), [&](const auto& position) {
+    expected.emplace_back(position.value());
+  });
+
+  const auto check = [&](PosList pos_list) {
+    const auto size = pos_list.size();
+    const auto reference_segment =
+        ReferenceSegment{table, ColumnID{0}, std::make_shared<const PosList>(std::move(pos_list))};
+
+    auto values = std::vector<int32_t>{};
+    segment_iterate<int32_t>(reference_segment, [&](const auto& position) { values.emplace_back(position.value()); });
+    EXPECT_EQ(values, std::vector<int32_t>(expected.begin(), expected.begin() + size));
+  };
+
+  check(PosList::chunk_range(ChunkID{0}, 0, table->row_count()));
+  check(PosList::chunk_offsets(ChunkID{0}, pmr_vector<ChunkOffset>{0, 1}));
+}
+
+}  // namespace opossum
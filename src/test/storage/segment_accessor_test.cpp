@@ -1,9 +1,12 @@
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "storage/base_segment.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
@@ -128,4 +131,75 @@ TEST_F(SegmentAccessorTest, TestSingleChunkReferenceSegmentAccessorNull) {
   EXPECT_FALSE(rc_single_chunk_accessor->access(ChunkOffset{0}).has_value());
 }
 
+TEST_F(SegmentAccessorTest, GatherMatchesAccess) {
+  // Runs of repeated values, NULLs, and more than one SimdBp128 block
+  auto values = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto index = 0; index < 1'000; ++index) {
+    if (index % 37 == 0) {
+      values->append(NULL_VALUE);
+    } else {
+      values->append(index / 3 % 50);
+    }
+  }
+
+  // Ascending offsets, random offsets (which also go backwards), and repeated offsets
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto index = ChunkOffset{0}; index < 1'000; index += 3) chunk_offsets.emplace_back(index);
+  for (auto index = ChunkOffset{0}; index < 500; ++index) chunk_offsets.emplace_back(index * 7919 % 1'000);
+  chunk_offsets.insert(chunk_offsets.end(), {ChunkOffset{5}, ChunkOffset{5}, ChunkOffset{999}, ChunkOffset{0}});
+
+  const auto check_gather = [&](const std::shared_ptr<const BaseSegment>& segment) {
+    const auto accessor = create_segment_accessor<int32_t>(segment);
+    auto gathered_values = std::vector<int32_t>(chunk_offsets.size());
+    auto gathered_null_values = std::make_unique<bool[]>(chunk_offsets.size());
+    accessor->gather(chunk_offsets.data(), chunk_offsets.size(), gathered_values.data(), gathered_null_values.get());
+
+    for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+      const auto expected = accessor->access(chunk_offsets[index]);
+      ASSERT_EQ(gathered_null_values[index], !expected.has_value()) << index;
+      if (expected) {
+        EXPECT_EQ(gathered_values[index], *expected) << index;
+      }
+    }
+  };
+
+  const auto encodings = std::vector<SegmentEncodingSpec>{
+      {EncodingType::Unencoded},
+      {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
+      {EncodingType::Dictionary, VectorCompressionType::SimdBp128},
+      {EncodingType::RunLength},
+      {EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
+      {EncodingType::LZ4}};
+  for (const auto& encoding : encodings) {
+    const auto segment = encoding.encoding_type == EncodingType::Unencoded
+                             ? std::static_pointer_cast<const BaseSegment>(values)
+                             : encode_segment(encoding.encoding_type, DataType::Int, values,
+                                              encoding.vector_compression_type);
+    check_gather(segment);
+
+    // ReferenceSegments to three chunks, gathered in runs of the same chunk, to a single chunk, and to random rows of
+    // the three chunks, whose values are prefetched
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+      table->append_chunk({std::const_pointer_cast<BaseSegment>(segment)});
+    }
+
+    auto multiple_chunks_pos_list = std::make_shared<PosList>();
+    auto single_chunk_pos_list = std::make_shared<PosList>();
+    auto scattered_pos_list = std::make_shared<PosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+      const auto chunk_id = ChunkID{chunk_offset / 100 % 2};
+      multiple_chunks_pos_list->emplace_back(chunk_offset % 11 == 0 ? NULL_ROW_ID : RowID{chunk_id, chunk_offset});
+      single_chunk_pos_list->emplace_back(RowID{ChunkID{1}, 999 - chunk_offset});
+      const auto scattered_row_id = RowID{ChunkID{chunk_offset * 7 % 3}, chunk_offset * 7919 % 1'000};
+      scattered_pos_list->emplace_back(chunk_offset % 13 == 0 ? NULL_ROW_ID : scattered_row_id);
+    }
+    single_chunk_pos_list->guarantee_single_chunk();
+
+    check_gather(std::make_shared<ReferenceSegment>(table, ColumnID{0}, multiple_chunks_pos_list));
+    check_gather(std::make_shared<ReferenceSegment>(table, ColumnID{0}, single_chunk_pos_list));
+    check_gather(std::make_shared<ReferenceSegment>(table, ColumnID{0}, scattered_pos_list));
+  }
+}
+
 }  // namespace opossum
@@ -5,7 +5,10 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "operators/import_binary.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/filesystem.hpp"
@@ -152,4 +155,30 @@ TEST_F(StorageManagerTest, ExportTables) {
   filesystem::remove(filename);
 }
 
+TEST_F(StorageManagerTest, ExportTablesAsBinarySnapshot) {
+  auto& sm = StorageManager::get();
+  sm.drop_table("first_table");
+  sm.drop_table("second_table");
+
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  sm.add_table("third_table", table);
+
+  // A row inserted by a transaction that has not committed yet is not part of the snapshot
+  const auto pending_insert_context = TransactionManager::get().new_transaction_context();
+  table->append({1, 2.5f});
+  const auto last_chunk = table->get_chunk(static_cast<ChunkID>(table->chunk_count() - 1));
+  {
+    auto mvcc_data = last_chunk->get_scoped_mvcc_data_lock();
+    mvcc_data->set_begin_cid(last_chunk->size() - 1, MvccData::MAX_COMMIT_ID);
+    mvcc_data->tids[last_chunk->size() - 1] = pending_insert_context->transaction_id();
+  }
+
+  const auto snapshot_commit_id = sm.export_all_tables_as_binary_snapshot(opossum::test_data_path);
+  EXPECT_EQ(snapshot_commit_id, pending_insert_context->snapshot_commit_id());
+
+  const auto filename = opossum::test_data_path + "/third_table.bin";
+  EXPECT_TABLE_EQ_ORDERED(ImportBinary::read_binary(filename), load_table("resources/test_data/tbl/int_float.tbl"));
+  filesystem::remove(filename);
+}
+
 }  // namespace opossum
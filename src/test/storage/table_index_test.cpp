@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageTableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int3.tbl", 3);
+    _table->create_table_index(ColumnID{0});
+  }
+
+  // Returns the rows with the given value in column a, sorted by RowID
+  PosList lookup(const AllTypeVariant& value) const {
+    auto row_ids = PosList{};
+    _table->get_table_index(ColumnID{0})->append_equal_rows(value, row_ids);
+    std::sort(row_ids.begin(), row_ids.end());
+    return row_ids;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageTableIndexTest, LookupExistingAndAppendedRows) {
+  EXPECT_EQ(_table->get_table_index(ColumnID{1}), nullptr);
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->size(), 8u);
+
+  EXPECT_EQ(lookup(4), (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(lookup(5), PosList{});
+  EXPECT_EQ(lookup(NULL_VALUE), PosList{});
+
+  // Values of other types are cast to the column type if that is lossless
+  EXPECT_EQ(lookup(int64_t{7}), (PosList{RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(lookup(7.0), (PosList{RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(lookup(7.5), PosList{});
+
+  // Rows appended to the table are indexed as well
+  _table->append({4, 20});
+  _table->append({4, 21});
+  EXPECT_EQ(lookup(4),
+            (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 2}, RowID{ChunkID{3}, 0}}));
+
+  // Indexes are also created on and maintained for encoded chunks
+  ChunkEncoder::encode_all_chunks(_table, EncodingType::Dictionary);
+  auto table_copy = std::make_shared<Table>(_table->column_definitions(), TableType::Data, 3, UseMvcc::Yes);
+  table_copy->append_chunk(_table->get_chunk(ChunkID{1}));
+  table_copy->create_table_index(ColumnID{0});
+  table_copy->append_chunk(_table->get_chunk(ChunkID{0}));
+
+  auto row_ids = PosList{};
+  table_copy->get_table_index(ColumnID{0})->append_equal_rows(4, row_ids);
+  std::sort(row_ids.begin(), row_ids.end());
+  EXPECT_EQ(row_ids, (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(StorageTableIndexTest, MaintainedByInsertAndDelete) {
+  StorageManager::get().add_table("table_a", _table);
+
+  auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values_to_insert->append({6, 30});
+  values_to_insert->append({6, 31});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  auto insert_context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+
+  EXPECT_EQ(lookup(6), (PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 2}, RowID{ChunkID{3}, 0}}));
+
+  // Delete the originally loaded row with a = 6
+  auto delete_context = TransactionManager::get().new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->set_transaction_context(delete_context);
+  auto index_scan =
+      std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                  PredicateCondition::Equals, std::vector<AllTypeVariant>{6});
+  auto validate = std::make_shared<Validate>(index_scan);
+  validate->set_transaction_context(delete_context);
+  auto table_scan = create_table_scan(validate, ColumnID{1}, PredicateCondition::Equals, 9);
+  auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(delete_context);
+  for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{get_table, index_scan, validate, table_scan,
+                                                                       delete_op}) {
+    op->execute();
+  }
+  delete_context->commit();
+
+  // The deleted row is still indexed, but filtered by the Validate operator
+  auto read_context = TransactionManager::get().new_transaction_context();
+  auto read_get_table = std::make_shared<GetTable>("table_a");
+  read_get_table->set_transaction_context(read_context);
+  auto read_index_scan =
+      std::make_shared<IndexScan>(read_get_table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                  PredicateCondition::Equals, std::vector<AllTypeVariant>{6});
+  auto read_validate = std::make_shared<Validate>(read_index_scan);
+  read_validate->set_transaction_context(read_context);
+  read_get_table->execute();
+  read_index_scan->execute();
+  read_validate->execute();
+
+  EXPECT_EQ(read_index_scan->get_output()->row_count(), 3u);
+  EXPECT_EQ(read_validate->get_output()->row_count(), 2u);
+  EXPECT_EQ(read_validate->get_output()->get_value<int32_t>(ColumnID{1}, 0u), 30);
+  EXPECT_EQ(read_validate->get_output()->get_value<int32_t>(ColumnID{1}, 1u), 31);
+}
+
+TEST_F(StorageTableIndexTest, JoinIndexUsesTableIndex) {
+  auto left = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_int.tbl", 2));
+  auto right = std::make_shared<TableWrapper>(_table);
+  left->execute();
+  right->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer}) {
+    auto join_index = std::make_shared<JoinIndex>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                  PredicateCondition::Equals);
+    join_index->execute();
+
+    const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join_index->performance_data());
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, _table->chunk_count());
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+
+    auto join_nested_loop = std::make_shared<JoinNestedLoop>(
+        left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_index->get_output(), join_nested_loop->get_output());
+  }
+}
+
+}  // namespace opossum
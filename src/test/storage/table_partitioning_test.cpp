@@ -0,0 +1,214 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class TablePartitioningTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+    _hash_partitioning = TablePartitioning::create_hash_partitioning(ColumnID{0}, DataType::Int, 3);
+    _range_partitioning = TablePartitioning::create_range_partitioning(ColumnID{0}, DataType::Int, {10, 20});
+  }
+
+  // Expects that all rows of each chunk belong to the partition of the chunk
+  void _expect_chunks_match_partitions(const Table& table) {
+    const auto& partitioning = *table.partitioning();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      ASSERT_TRUE(chunk->partition_id());
+      for (const auto partition_id : partitioning.partition_ids(*chunk->get_segment(partitioning.column_id()))) {
+        EXPECT_EQ(partition_id, *chunk->partition_id());
+      }
+    }
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<TablePartitioning> _hash_partitioning;
+  std::shared_ptr<TablePartitioning> _range_partitioning;
+};
+
+TEST_F(TablePartitioningTest, PartitionIds) {
+  EXPECT_EQ(_hash_partitioning->partition_count(), 3u);
+  EXPECT_EQ(_hash_partitioning->partition_id(7), _hash_partitioning->partition_id(int64_t{7}));
+  EXPECT_EQ(_hash_partitioning->partition_id(NULL_VALUE), 0u);
+
+  EXPECT_EQ(_range_partitioning->partition_count(), 3u);
+  EXPECT_EQ(_range_partitioning->partition_id(-5), 0u);
+  EXPECT_EQ(_range_partitioning->partition_id(9), 0u);
+  EXPECT_EQ(_range_partitioning->partition_id(10), 1u);
+  EXPECT_EQ(_range_partitioning->partition_id(19), 1u);
+  EXPECT_EQ(_range_partitioning->partition_id(20), 2u);
+  EXPECT_EQ(_range_partitioning->partition_id(NULL_VALUE), 0u);
+
+  const auto segment = ValueSegment<int32_t>{pmr_concurrent_vector<int32_t>{5, 15, 0, 25},
+                                             NullValueVector{false, false, true, false}};
+  EXPECT_EQ(_range_partitioning->partition_ids(segment), (std::vector<PartitionID>{0, 1, 0, 2}));
+}
+
+TEST_F(TablePartitioningTest, InvalidPartitionings) {
+  EXPECT_THROW(TablePartitioning::create_hash_partitioning(ColumnID{0}, DataType::Int, 0), std::logic_error);
+  EXPECT_THROW(TablePartitioning::create_range_partitioning(ColumnID{0}, DataType::Int, {20, 10}), std::logic_error);
+  EXPECT_THROW(TablePartitioning::create_range_partitioning(ColumnID{0}, DataType::Long, {10}), std::logic_error);
+
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data);
+  EXPECT_THROW(table->set_partitioning(TablePartitioning::create_hash_partitioning(ColumnID{0}, DataType::Long, 2)),
+               std::logic_error);
+  table->append({1, 1});
+  EXPECT_THROW(table->set_partitioning(_hash_partitioning), std::logic_error);
+}
+
+TEST_F(TablePartitioningTest, CanPrune) {
+  // Partition 1 holds the values in [10, 20)
+  const auto partition_id = PartitionID{1};
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::Equals, 5));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::Equals, 15));
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::LessThan, 10));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::LessThan, 11));
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::LessThanEquals, 9));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::LessThanEquals, 10));
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::GreaterThan, 20));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::GreaterThan, 18));
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::GreaterThanEquals, 20));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::GreaterThanEquals, 19));
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::Between, 0, 9));
+  EXPECT_TRUE(_range_partitioning->can_prune(partition_id, PredicateCondition::Between, 20, 30));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::Between, 5, 10));
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::NotEquals, 5));
+
+  // Values of other types are not cast, and the last partition has no upper bound
+  EXPECT_FALSE(_range_partitioning->can_prune(partition_id, PredicateCondition::LessThan, 9.5f));
+  EXPECT_FALSE(_range_partitioning->can_prune(PartitionID{2}, PredicateCondition::GreaterThan, 1'000));
+
+  // Hash partitions can only be pruned for equality predicates
+  const auto other_partition_id = (_hash_partitioning->partition_id(7) + 1) % 3;
+  EXPECT_TRUE(_hash_partitioning->can_prune(other_partition_id, PredicateCondition::Equals, 7));
+  EXPECT_FALSE(_hash_partitioning->can_prune(_hash_partitioning->partition_id(7), PredicateCondition::Equals, 7));
+  EXPECT_FALSE(_hash_partitioning->can_prune(other_partition_id, PredicateCondition::LessThan, 7));
+}
+
+TEST_F(TablePartitioningTest, IsCompatibleWith) {
+  EXPECT_TRUE(_hash_partitioning->is_compatible_with(
+      *TablePartitioning::create_hash_partitioning(ColumnID{1}, DataType::Int, 3)));
+  EXPECT_FALSE(_hash_partitioning->is_compatible_with(
+      *TablePartitioning::create_hash_partitioning(ColumnID{0}, DataType::Int, 4)));
+  EXPECT_FALSE(_hash_partitioning->is_compatible_with(
+      *TablePartitioning::create_hash_partitioning(ColumnID{0}, DataType::Long, 3)));
+  EXPECT_FALSE(_hash_partitioning->is_compatible_with(*_range_partitioning));
+  EXPECT_FALSE(_range_partitioning->is_compatible_with(
+      *TablePartitioning::create_range_partitioning(ColumnID{0}, DataType::Int, {10, 30})));
+}
+
+TEST_F(TablePartitioningTest, AppendRoutesRowsToPartitions) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+  table->set_partitioning(_range_partitioning);
+  for (const auto value : {1, 11, 21, 2, 3, 12}) table->append({value, value});
+  table->append({NULL_VALUE, 0});
+
+  // Partition 0: [1, 2], [3, NULL], partition 1: [11, 12], partition 2: [21]
+  EXPECT_EQ(table->chunk_count(), 4u);
+  EXPECT_EQ(table->last_chunk_id(0), ChunkID{3});
+  EXPECT_EQ(table->last_chunk_id(1), ChunkID{1});
+  EXPECT_EQ(table->last_chunk_id(2), ChunkID{2});
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 2u);
+  _expect_chunks_match_partitions(*table);
+}
+
+TEST_F(TablePartitioningTest, InsertRoutesRowsToPartitions) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 3, UseMvcc::Yes);
+  table->set_partitioning(_hash_partitioning);
+  StorageManager::get().add_table("partitioned", table);
+
+  const auto values = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Long, true},
+                                                                     {"b", DataType::Int, false}},
+                                              TableType::Data, 4);
+  for (auto value = int64_t{0}; value < 20; ++value) values->append({value, static_cast<int32_t>(value)});
+  values->append({NULL_VALUE, 20});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("partitioned", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(table->row_count(), 21u);
+  _expect_chunks_match_partitions(*table);
+
+  // The chunks of partitions of the validated table are found through its references
+  const auto get_table = std::make_shared<GetTable>("partitioned");
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  get_table->execute();
+  validate->execute();
+
+  const auto partitioned_chunks = partition_chunks(*validate->get_output(), ColumnID{0});
+  ASSERT_TRUE(partitioned_chunks);
+  EXPECT_TRUE(partitioned_chunks->partitioning->is_compatible_with(*_hash_partitioning));
+  auto chunk_count = size_t{0};
+  for (auto partition_id = PartitionID{0}; partition_id < 3; ++partition_id) {
+    for (const auto chunk_id : partitioned_chunks->chunk_ids_by_partition[partition_id]) {
+      EXPECT_EQ(table->get_chunk(chunk_id)->partition_id(), partition_id);
+      ++chunk_count;
+    }
+  }
+  EXPECT_EQ(chunk_count, table->chunk_count());
+
+  EXPECT_FALSE(partition_chunks(*validate->get_output(), ColumnID{1}));
+}
+
+TEST_F(TablePartitioningTest, PartitionChunksRequiresSingleChunkReferences) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+  table->set_partitioning(_range_partitioning);
+  for (const auto value : {1, 11, 2, 12}) table->append({value, value});
+
+  EXPECT_TRUE(partition_chunks(*table, ColumnID{0}));
+  EXPECT_FALSE(partition_chunks(*table, ColumnID{1}));
+
+  // A reference chunk that spans two partitions
+  auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}});
+  const auto references = std::make_shared<Table>(_column_definitions, TableType::References);
+  references->append_chunk(
+      {std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list),
+       std::make_shared<ReferenceSegment>(table, ColumnID{1}, pos_list)});
+  EXPECT_FALSE(partition_chunks(*references, ColumnID{0}));
+}
+
+TEST_F(TablePartitioningTest, SplitByPartition) {
+  const auto table = load_table("resources/test_data/tbl/int_int4_with_null.tbl", 3);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::GreaterThanEquals, 0);
+  scan->execute();
+
+  const auto partitions = split_by_partition(scan->get_output(), ColumnID{0}, *_range_partitioning);
+  ASSERT_EQ(partitions.size(), 3u);
+
+  auto row_count = size_t{0};
+  for (auto partition_id = PartitionID{0}; partition_id < partitions.size(); ++partition_id) {
+    row_count += partitions[partition_id]->row_count();
+    for (const auto& chunk : partitions[partition_id]->chunks()) {
+      for (const auto row_partition_id : _range_partitioning->partition_ids(*chunk->get_segment(ColumnID{0}))) {
+        EXPECT_EQ(row_partition_id, partition_id);
+      }
+    }
+  }
+  EXPECT_EQ(row_count, scan->get_output()->row_count());
+}
+
+}  // namespace opossum
@@ -41,6 +41,15 @@ TEST_F(StorageTableTest, GetChunk) {
   EXPECT_NE(t->get_chunk(ChunkID{1}), nullptr);
 }
 
+TEST_F(StorageTableTest, GetChunkView) {
+  t->append({4, "Hello,"});
+  t->append({6, "world"});
+  t->append({3, "!"});
+  ASSERT_EQ(t->chunk_count(), 2u);
+  EXPECT_EQ(&t->get_chunk_view(ChunkID{1}), t->get_chunk(ChunkID{1}).get());
+  EXPECT_EQ(t->get_chunk_view(ChunkID{1}).size(), 1u);
+}
+
 TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t->column_count(), 2u); }
 
 TEST_F(StorageTableTest, RowCount) {
@@ -72,6 +81,21 @@ TEST_F(StorageTableTest, GetColumnIDByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t->max_chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, SetChunkSize) {
+  t->append({4, "Hello,"});
+  t->append({6, "world"});
+
+  // Only chunks appended afterwards have the new size
+  t->set_max_chunk_size(3);
+  EXPECT_EQ(t->max_chunk_size(), 3u);
+  t->append({3, "!"});
+  EXPECT_EQ(t->chunk_count(), 1u);
+  t->append({5, "?"});
+  EXPECT_EQ(t->chunk_count(), 2u);
+
+  EXPECT_THROW(t->set_max_chunk_size(0), std::logic_error);
+}
+
 TEST_F(StorageTableTest, GetValue) {
   t->append({4, "Hello,"});
   t->append({6, "world"});
@@ -198,4 +222,27 @@ TEST_F(StorageTableTest, StableChunks) {
   EXPECT_EQ((*(*first_chunk)->get_segment(ColumnID{0}))[0], AllTypeVariant{100});
 }
 
+TEST_F(StorageTableTest, Constraints) {
+  auto table_column_definitions = TableColumnDefinitions{};
+  table_column_definitions.emplace_back("id", DataType::Int, false);
+  table_column_definitions.emplace_back("name", DataType::String, true);
+  table_column_definitions.emplace_back("other_id", DataType::Int, false);
+  auto table = std::make_shared<Table>(table_column_definitions, TableType::Data);
+
+  table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table->add_unique_constraint({ColumnID{1}, ColumnID{2}});
+  table->add_foreign_key_constraint({ColumnID{2}}, "other_table", {ColumnID{0}});
+
+  EXPECT_EQ(table->get_unique_constraints(), (TableConstraintDefinitions{{{ColumnID{0}}, IsPrimaryKey::Yes},
+                                                                         {{ColumnID{1}, ColumnID{2}}, IsPrimaryKey::No}}));
+  EXPECT_EQ(table->foreign_key_constraints(),
+            (ForeignKeyConstraintDefinitions{{{ColumnID{2}}, "other_table", {ColumnID{0}}}}));
+
+  // Only one primary key, which must not be nullable
+  EXPECT_THROW(table->add_unique_constraint({ColumnID{2}}, IsPrimaryKey::Yes), std::logic_error);
+  auto table_without_primary_key = std::make_shared<Table>(table_column_definitions, TableType::Data);
+  EXPECT_THROW(table_without_primary_key->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::Yes), std::logic_error);
+  EXPECT_THROW(table->add_unique_constraint({ColumnID{3}}), std::logic_error);
+}
+
 }  // namespace opossum
@@ -6,8 +6,10 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
@@ -50,6 +52,25 @@ TEST_F(ChunkCompressionTaskTest, CompressionPreservesTableContent) {
   }
 }
 
+TEST_F(ChunkCompressionTaskTest, AutomaticEncodingPreservesTableContent) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 12u);
+
+  auto table_fast = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_fast", table_fast);
+  auto table_small = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_small", table_small);
+
+  const auto chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}};
+  std::make_unique<ChunkCompressionTask>("table_fast", chunk_ids, AutoEncodingSpec{0.0f})->execute();
+  std::make_unique<ChunkCompressionTask>("table_small", chunk_ids, AutoEncodingSpec{1.0f})->execute();
+
+  for (const auto& compressed_table : {table_fast, table_small}) {
+    EXPECT_FALSE(compressed_table->get_chunk(ChunkID{0})->is_mutable());
+    EXPECT_TRUE(check_table_equal(table, compressed_table, OrderSensitivity::No, TypeCmpMode::Strict,
+                                  FloatComparisonMode::AbsoluteDifference));
+  }
+}
+
 TEST_F(ChunkCompressionTaskTest, DictionarySize) {
   auto table_dict = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
   StorageManager::get().add_table("table_dict", table_dict);
@@ -110,4 +131,106 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, CompressionFreezesMvccData) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_insert", table);
+
+  // This transaction does not see the rows inserted below, so that their chunks cannot be frozen while it is active
+  auto old_context = TransactionManager::get().new_transaction_context();
+
+  auto gt1 = std::make_shared<GetTable>("table_insert");
+  gt1->execute();
+
+  auto ins = std::make_shared<Insert>("table_insert", gt1);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+  context->commit();
+
+  ASSERT_EQ(table->chunk_count(), 4u);
+
+  auto compression = std::make_unique<ChunkCompressionTask>(
+      "table_insert", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}});
+  compression->execute();
+
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->mvcc_data()->is_frozen());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->mvcc_data()->is_frozen());
+  EXPECT_FALSE(table->get_chunk(ChunkID{2})->mvcc_data()->is_frozen());
+
+  old_context.reset();
+  compression = std::make_unique<ChunkCompressionTask>("table_insert", ChunkID{3});
+  compression->execute();
+
+  const auto frozen_mvcc_data = table->get_chunk(ChunkID{3})->mvcc_data();
+  EXPECT_TRUE(frozen_mvcc_data->is_frozen());
+  EXPECT_EQ(frozen_mvcc_data->get_begin_cid(ChunkOffset{0}), context->commit_id());
+  EXPECT_EQ(frozen_mvcc_data->get_end_cid(ChunkOffset{0}), MvccData::MAX_COMMIT_ID);
+  EXPECT_LT(frozen_mvcc_data->estimate_memory_usage(),
+            table->get_chunk(ChunkID{2})->mvcc_data()->estimate_memory_usage());
+
+  auto gt2 = std::make_shared<GetTable>("table_insert");
+  gt2->execute();
+  auto validate = std::make_shared<Validate>(gt2);
+  context = TransactionManager::get().new_transaction_context();
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 24u);
+}
+
+TEST_F(ChunkCompressionTaskTest, CompressionDetectsSortedColumn) {
+  auto table_sorted = load_table("resources/test_data/tbl/int_float2_sorted.tbl", 7u);
+  StorageManager::get().add_table("table_sorted", table_sorted);
+  auto table_unsorted = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_unsorted", table_unsorted);
+
+  std::make_unique<ChunkCompressionTask>("table_sorted", ChunkID{0})->execute();
+  std::make_unique<ChunkCompressionTask>("table_unsorted", ChunkID{0})->execute();
+
+  EXPECT_EQ(table_sorted->get_chunk(ChunkID{0})->ordered_by(), std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+  EXPECT_EQ(table_unsorted->get_chunk(ChunkID{0})->ordered_by(), std::nullopt);
+}
+
+TEST_F(ChunkCompressionTaskTest, DeleteFromFrozenChunk) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_delete", table);
+
+  auto compression = std::make_unique<ChunkCompressionTask>("table_delete", ChunkID{0});
+  compression->execute();
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->mvcc_data()->is_frozen());
+
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  // Delete the rows with b = 3 from the frozen chunk (and the one that is not frozen)
+  auto context = TransactionManager::get().new_transaction_context();
+  auto gt1 = std::make_shared<GetTable>("table_delete");
+  gt1->set_transaction_context(context);
+  gt1->execute();
+  auto validate1 = std::make_shared<Validate>(gt1);
+  validate1->set_transaction_context(context);
+  validate1->execute();
+  auto table_scan = create_table_scan(validate1, ColumnID{1}, PredicateCondition::Equals, 3);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+  context->commit();
+
+  const auto frozen_mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  EXPECT_EQ(frozen_mvcc_data->get_end_cid(ChunkOffset{0}), context->commit_id());
+  EXPECT_EQ(frozen_mvcc_data->get_end_cid(ChunkOffset{2}), MvccData::MAX_COMMIT_ID);
+
+  const auto visible_row_count = [&](const auto& transaction_context) {
+    auto gt2 = std::make_shared<GetTable>("table_delete");
+    gt2->set_transaction_context(transaction_context);
+    gt2->execute();
+    auto validate2 = std::make_shared<Validate>(gt2);
+    validate2->set_transaction_context(transaction_context);
+    validate2->execute();
+    return validate2->get_output()->row_count();
+  };
+
+  EXPECT_EQ(visible_row_count(old_context), 12u);
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 7u);
+}
+
 }  // namespace opossum
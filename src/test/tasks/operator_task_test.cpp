@@ -9,9 +9,11 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/operator_task_graph.hpp"
 #include "storage/storage_manager.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -123,4 +125,155 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, FusePipelines) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 458.0f));
+  auto projection = std::make_shared<Projection>(scan_b, expression_vector(b, add_(a, 1)));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(projection, CleanupTemporaries::Yes, FusePipelines::Yes);
+
+  // The scans and the projection are executed by a single task
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_EQ(tasks[1]->get_operator(), projection);
+
+  std::vector<std::shared_ptr<AbstractTask>> expected_successors_0({tasks[1]});
+  EXPECT_EQ(tasks[0]->successors(), expected_successors_0);
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Float, false}, {"a + 1", DataType::Int, false}}, TableType::Data);
+  expected_result->append({457.7f, 1235});
+  EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), expected_result);
+
+  // The operators within the pipeline do not have an output
+  EXPECT_EQ(gt->get_output(), nullptr);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+  EXPECT_EQ(scan_b->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, FusePipelinesWithEmptyResult) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_(a, 100'000));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(a, 5));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_b, CleanupTemporaries::Yes, FusePipelines::Yes);
+  ASSERT_EQ(tasks.size(), 2u);
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  const auto& output = scan_b->get_output();
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->column_definitions(), _test_table_a->column_definitions());
+  EXPECT_EQ(output->type(), TableType::References);
+}
+
+TEST_F(OperatorTaskTest, FusePipelinesDoesNotFuseSharedInputs) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 1000));
+  auto scan_c = std::make_shared<TableScan>(scan_a, greater_than_(b, 2000));
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  // scan_a has two consumers and its output is needed by both of them
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions, CleanupTemporaries::Yes, FusePipelines::Yes);
+
+  ASSERT_EQ(tasks.size(), 5u);
+  EXPECT_EQ(tasks[1]->get_operator(), scan_a);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_EQ(union_positions->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorTaskTest, TaskGraphOfDiamondShape) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 1000));
+  auto scan_c = std::make_shared<TableScan>(scan_a, greater_than_(b, 2000));
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  const auto task_graph = OperatorTaskGraph{union_positions, FusePipelines::No};
+  EXPECT_EQ(task_graph.operator_count(), 5u);
+  EXPECT_EQ(task_graph.task_count(), 5u);
+
+  // Each instance is a new copy of the PQP, with the same tasks as make_tasks_from_operator() creates
+  for (auto instance_idx = 0; instance_idx < 2; ++instance_idx) {
+    const auto instance = task_graph.instantiate(CleanupTemporaries::Yes, SchedulePriority::Default);
+    const auto& tasks = instance.tasks;
+    ASSERT_EQ(tasks.size(), 5u);
+    EXPECT_EQ(tasks[4]->get_operator(), instance.root);
+    EXPECT_NE(instance.root, union_positions);
+
+    const auto copied_scan_a = tasks[1]->get_operator();
+    EXPECT_EQ(tasks[0]->get_operator(), copied_scan_a->input_left());
+    EXPECT_EQ(copied_scan_a, tasks[2]->get_operator()->input_left());
+    EXPECT_EQ(copied_scan_a, tasks[3]->get_operator()->input_left());
+    EXPECT_EQ(instance.root->input_left(), tasks[2]->get_operator());
+    EXPECT_EQ(instance.root->input_right(), tasks[3]->get_operator());
+
+    std::vector<std::shared_ptr<AbstractTask>> expected_successors_1({tasks[2], tasks[3]});
+    EXPECT_EQ(tasks[1]->successors(), expected_successors_1);
+    std::vector<std::shared_ptr<AbstractTask>> expected_successors_2({tasks[4]});
+    EXPECT_EQ(tasks[2]->successors(), expected_successors_2);
+
+    for (auto& task : tasks) {
+      task->schedule();
+    }
+
+    EXPECT_EQ(instance.root->get_output()->row_count(), 0u);
+    EXPECT_EQ(copied_scan_a->get_output(), nullptr);
+  }
+
+  // The PQP itself is not executed
+  EXPECT_EQ(union_positions->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, TaskGraphFusesPipelines) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 458.0f));
+  auto projection = std::make_shared<Projection>(scan_b, expression_vector(b, add_(a, 1)));
+
+  const auto task_graph = OperatorTaskGraph{projection, FusePipelines::Yes};
+  EXPECT_EQ(task_graph.fuse_pipelines(), FusePipelines::Yes);
+  EXPECT_EQ(task_graph.operator_count(), 4u);
+  EXPECT_EQ(task_graph.task_count(), 2u);
+
+  const auto instance = task_graph.instantiate(CleanupTemporaries::Yes, SchedulePriority::Default);
+  ASSERT_EQ(instance.tasks.size(), 2u);
+  EXPECT_EQ(instance.tasks[1]->get_operator(), instance.root);
+
+  for (auto& task : instance.tasks) {
+    task->schedule();
+  }
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Float, false}, {"a + 1", DataType::Int, false}}, TableType::Data);
+  expected_result->append({457.7f, 1235});
+  EXPECT_TABLE_EQ_UNORDERED(instance.root->get_output(), expected_result);
+
+  // The copied scans are executed within the pipeline and do not have an output
+  EXPECT_EQ(instance.root->input_left()->get_output(), nullptr);
+}
+
 }  // namespace opossum
@@ -48,6 +48,32 @@ TEST(TpchDbGeneratorTest, TableContents) {
                           load_table("resources/test_data/tbl/tpch/sf-0.001/region.tbl", chunk_size));
 }
 
+TEST(TpchDbGeneratorTest, TableContentsWithManyRanges) {
+  /**
+   * Each chunk of the parent tables is generated by its own range, which skips dbgen's seeds ahead. Small chunks make
+   * sure that the skipping yields the same data as generating all rows sequentially.
+   */
+  const auto scale_factor = 0.001f;
+  const auto chunk_size = uint32_t{70};
+  const auto table_info_by_name = TpchTableGenerator(scale_factor, chunk_size).generate();
+
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("part").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/part.tbl", chunk_size));
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("partsupp").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/partsupp.tbl", chunk_size));
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("customer").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/customer.tbl", chunk_size));
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("orders").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/orders.tbl", chunk_size));
+
+  // One LINEITEM chunk is started per range of ORDERs
+  const auto& lineitem = table_info_by_name.at("lineitem").table;
+  EXPECT_GE(lineitem->chunk_count(), table_info_by_name.at("orders").table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < lineitem->chunk_count(); ++chunk_id) {
+    EXPECT_LE(lineitem->get_chunk(chunk_id)->size(), chunk_size);
+  }
+}
+
 TEST(TpchDbGeneratorTest, GenerateAndStore) {
   EXPECT_FALSE(StorageManager::get().has_table("part"));
   EXPECT_FALSE(StorageManager::get().has_table("supplier"));
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+
+#include "utils/date_time_utils.hpp"
+
+namespace opossum {
+
+TEST(DateTimeUtilsTest, StringToDate) {
+  EXPECT_EQ(string_to_date("1970-01-01"), 0);
+  EXPECT_EQ(string_to_date("1970-01-02"), 1);
+  EXPECT_EQ(string_to_date("1969-12-31"), -1);
+  EXPECT_EQ(string_to_date("2000-01-01"), 10957);
+  EXPECT_EQ(string_to_date("2000-02-29"), 11016);
+
+  EXPECT_EQ(string_to_date("1900-02-29"), std::nullopt);
+  EXPECT_EQ(string_to_date("2019-02-29"), std::nullopt);
+  EXPECT_EQ(string_to_date("2019-13-01"), std::nullopt);
+  EXPECT_EQ(string_to_date("2019-04-31"), std::nullopt);
+  EXPECT_EQ(string_to_date("2019-4-1"), std::nullopt);
+  EXPECT_EQ(string_to_date("2019-04-01x"), std::nullopt);
+  EXPECT_EQ(string_to_date("Hello World"), std::nullopt);
+  EXPECT_EQ(string_to_date(""), std::nullopt);
+}
+
+TEST(DateTimeUtilsTest, StringToTimestamp) {
+  EXPECT_EQ(string_to_timestamp("1970-01-01"), 0);
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:00:01"), 1'000'000);
+  EXPECT_EQ(string_to_timestamp("1970-01-02T01:02:03"), int64_t{93'723'000'000});
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:00:00.5"), 500'000);
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:00:00.000001"), 1);
+  EXPECT_EQ(string_to_timestamp("1969-12-31 23:59:59"), -1'000'000);
+
+  EXPECT_EQ(string_to_timestamp("1970-01-01 24:00:00"), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:60:00"), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:00"), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:00:00."), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("1970-01-01 00:00:00.1234567"), std::nullopt);
+}
+
+TEST(DateTimeUtilsTest, ToString) {
+  EXPECT_EQ(date_to_string(0), "1970-01-01");
+  EXPECT_EQ(date_to_string(-1), "1969-12-31");
+  EXPECT_EQ(date_to_string(11016), "2000-02-29");
+
+  EXPECT_EQ(timestamp_to_string(0), "1970-01-01 00:00:00");
+  EXPECT_EQ(timestamp_to_string(-1'000'000), "1969-12-31 23:59:59");
+  EXPECT_EQ(timestamp_to_string(int64_t{93'723'000'042}), "1970-01-02 01:02:03.000042");
+}
+
+TEST(DateTimeUtilsTest, RoundTrip) {
+  for (const auto& date : {"0001-01-01", "1582-10-15", "1992-09-30", "2400-02-29", "9999-12-31"}) {
+    EXPECT_EQ(date_to_string(*string_to_date(date)), date);
+  }
+
+  for (auto days = int32_t{-1000}; days < 1000; days += 7) {
+    const auto civil_date = civil_from_days(days);
+    EXPECT_EQ(days_from_civil(civil_date), days);
+  }
+}
+
+TEST(DateTimeUtilsTest, DateTimeFromString) {
+  EXPECT_EQ(date_time_from_string(DataType::Date, "2000-01-01"), AllTypeVariant{int32_t{10957}});
+  EXPECT_EQ(date_time_from_string(DataType::Timestamp, "1970-01-01 00:00:01"), AllTypeVariant{int64_t{1'000'000}});
+
+  EXPECT_THROW(date_time_from_string(DataType::Date, "2000-01-01 00:00:00"), InvalidInputException);
+  EXPECT_THROW(date_time_from_string(DataType::Date, "01.01.2000"), InvalidInputException);
+  EXPECT_THROW(date_time_from_string(DataType::Timestamp, "2000-01-01 12:00"), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "utils/decimal_utils.hpp"
+
+namespace opossum {
+
+TEST(DecimalUtilsTest, StringToDecimal) {
+  EXPECT_EQ(string_to_decimal("0"), 0);
+  EXPECT_EQ(string_to_decimal("12.34"), 123'400);
+  EXPECT_EQ(string_to_decimal("-12.34"), -123'400);
+  EXPECT_EQ(string_to_decimal("+12"), 120'000);
+  EXPECT_EQ(string_to_decimal(".5"), 5'000);
+  EXPECT_EQ(string_to_decimal("7."), 70'000);
+  EXPECT_EQ(string_to_decimal("0.00005"), 1);
+  EXPECT_EQ(string_to_decimal("0.00004999"), 0);
+  EXPECT_EQ(string_to_decimal("-0.00005"), -1);
+
+  EXPECT_EQ(string_to_decimal(""), std::nullopt);
+  EXPECT_EQ(string_to_decimal("-"), std::nullopt);
+  EXPECT_EQ(string_to_decimal("."), std::nullopt);
+  EXPECT_EQ(string_to_decimal("1.2.3"), std::nullopt);
+  EXPECT_EQ(string_to_decimal("12a"), std::nullopt);
+  EXPECT_EQ(string_to_decimal("1e5"), std::nullopt);
+  EXPECT_EQ(string_to_decimal("1000000000000000"), std::nullopt);
+}
+
+TEST(DecimalUtilsTest, DecimalToString) {
+  EXPECT_EQ(decimal_to_string(0), "0.0000");
+  EXPECT_EQ(decimal_to_string(123'400), "12.3400");
+  EXPECT_EQ(decimal_to_string(-5), "-0.0005");
+  EXPECT_EQ(decimal_to_string(std::numeric_limits<int64_t>::min()), "-922337203685477.5808");
+}
+
+TEST(DecimalUtilsTest, Arithmetic) {
+  // 12.34 * 0.05 = 0.617
+  EXPECT_EQ(decimal_multiply(123'400, 500), 6'170);
+  // 0.0001 * 0.5 = 0.00005, rounded half away from zero
+  EXPECT_EQ(decimal_multiply(1, 5'000), 1);
+  EXPECT_EQ(decimal_multiply(-1, 5'000), -1);
+  EXPECT_EQ(decimal_multiply(1, 4'999), 0);
+
+  // 1 / 3 = 0.3333, 2 / 3 = 0.6667
+  EXPECT_EQ(decimal_divide(10'000, 30'000), 3'333);
+  EXPECT_EQ(decimal_divide(20'000, 30'000), 6'667);
+  EXPECT_EQ(decimal_divide(-20'000, 30'000), -6'667);
+
+  // The intermediate product exceeds 64 bits
+  EXPECT_EQ(decimal_multiply(int64_t{100'000'000'000'000}, 10'000), int64_t{100'000'000'000'000});
+
+  EXPECT_EQ(decimal_from_double(0.07), 700);
+  EXPECT_EQ(decimal_from_double(-1.23456), -12'346);
+  EXPECT_DOUBLE_EQ(decimal_to_double(123'400), 12.34);
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/abstract_operator.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/execution_hooks.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class ExecutionHooksTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+};
+
+TEST_F(ExecutionHooksTest, SubscribeAndUnsubscribe) {
+  auto hook = ExecutionHook<int>{};
+  EXPECT_FALSE(hook.has_subscribers());
+
+  // Firing without subscribers does nothing
+  hook.fire(1);
+
+  auto sum_a = 0;
+  auto sum_b = 0;
+  const auto subscription_a = hook.subscribe([&](const int value) { sum_a += value; });
+  const auto subscription_b = hook.subscribe([&](const int value) { sum_b += value; });
+  EXPECT_NE(subscription_a, subscription_b);
+  EXPECT_TRUE(hook.has_subscribers());
+
+  hook.fire(2);
+  EXPECT_EQ(sum_a, 2);
+  EXPECT_EQ(sum_b, 2);
+
+  hook.unsubscribe(subscription_a);
+  hook.fire(3);
+  EXPECT_EQ(sum_a, 2);
+  EXPECT_EQ(sum_b, 5);
+
+  // The free slot is reused
+  EXPECT_EQ(hook.subscribe([](const int) {}), subscription_a);
+
+  hook.unsubscribe(subscription_a);
+  hook.unsubscribe(subscription_b);
+  EXPECT_FALSE(hook.has_subscribers());
+  EXPECT_THROW(hook.unsubscribe(subscription_b), std::logic_error);
+}
+
+TEST_F(ExecutionHooksTest, StatementAndOperatorHooks) {
+  auto& hooks = ExecutionHooks::get();
+
+  auto started_sql_strings = std::vector<std::string>{};
+  auto finished_sql_strings = std::vector<std::string>{};
+  auto root_row_count = size_t{0};
+  auto finished_operator_names = std::vector<std::string>{};
+
+  const auto started_subscription =
+      hooks.statement_started.subscribe([&](const std::string& sql) { started_sql_strings.emplace_back(sql); });
+  const auto finished_subscription = hooks.statement_finished.subscribe(
+      [&](const std::string& sql, const std::shared_ptr<const AbstractOperator>& root,
+          const SQLPipelineStatementMetrics&) {
+        finished_sql_strings.emplace_back(sql);
+        root_row_count = root->get_output()->row_count();
+      });
+  const auto operator_subscription = hooks.operator_finished.subscribe(
+      [&](const AbstractOperator& op) { finished_operator_names.emplace_back(op.name()); });
+
+  const auto sql = std::string{"SELECT * FROM int_float WHERE a > 200"};
+  SQLPipelineBuilder{sql}.disable_mvcc().create_pipeline().get_result_table();
+
+  hooks.statement_started.unsubscribe(started_subscription);
+  hooks.statement_finished.unsubscribe(finished_subscription);
+  hooks.operator_finished.unsubscribe(operator_subscription);
+
+  EXPECT_EQ(started_sql_strings, std::vector<std::string>{sql});
+  EXPECT_EQ(finished_sql_strings, std::vector<std::string>{sql});
+  EXPECT_EQ(root_row_count, 2u);
+
+  // At least the GetTable and the TableScan were executed
+  EXPECT_GE(finished_operator_names.size(), 2u);
+  EXPECT_NE(std::find(finished_operator_names.cbegin(), finished_operator_names.cend(), "TableScan"),
+            finished_operator_names.cend());
+}
+
+TEST_F(ExecutionHooksTest, TransactionCommittedHook) {
+  auto& hooks = ExecutionHooks::get();
+
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  const auto subscription =
+      hooks.transaction_committed.subscribe([&](const TransactionID transaction_id, const CommitID) {
+        committed_transaction_ids.emplace_back(transaction_id);
+      });
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  transaction_context->commit();
+
+  hooks.transaction_committed.unsubscribe(subscription);
+
+  EXPECT_EQ(committed_transaction_ids, std::vector<TransactionID>{transaction_context->transaction_id()});
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include <memory>
+#include <optional>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_wrapper.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class HardwareCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { HardwareCounters::enable(false); }
+};
+
+TEST_F(HardwareCountersTest, DisabledByDefault) {
+  EXPECT_FALSE(HardwareCounters::is_enabled());
+  EXPECT_FALSE(HardwareCounters::read_this_thread());
+
+  auto values = std::optional<HardwareCounterValues>{};
+  { const auto scope = HardwareCounterScope{values}; }
+  EXPECT_FALSE(values);
+}
+
+TEST_F(HardwareCountersTest, AddAndFormat) {
+  auto values = HardwareCounterValues{};
+  values.values = {2'000'000, 3'000'000, 1'500, 20, 7};
+  values += values;
+
+  EXPECT_EQ(values[HardwareCounter::Cycles], 4'000'000);
+  EXPECT_EQ(values[HardwareCounter::BranchMisses], 14);
+  EXPECT_EQ(values.to_string(),
+            "4M cycles, 6M instructions (IPC 1.5), 3K LLC misses, 40 dTLB misses, 14 branch misses");
+}
+
+TEST_F(HardwareCountersTest, CountOperator) {
+  HardwareCounters::enable();
+  if (!HardwareCounters::read_this_thread()) {
+    GTEST_SKIP() << "Hardware counters are not available";
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl"));
+  table_wrapper->execute();
+
+  const auto& counters = table_wrapper->performance_data().hardware_counters;
+  ASSERT_TRUE(counters);
+  EXPECT_GT((*counters)[HardwareCounter::Instructions], 0);
+  EXPECT_EQ(sum_hardware_counters(table_wrapper)->values, counters->values);
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#include "gtest/gtest.h"
+
+#include "utils/logical_data_types.hpp"
+
+namespace opossum {
+
+TEST(LogicalDataTypesTest, LogicalValueFromString) {
+  EXPECT_EQ(logical_value_from_string(DataType::Date, "2000-01-01"), AllTypeVariant{int32_t{10957}});
+  EXPECT_EQ(logical_value_from_string(DataType::Timestamp, "1970-01-01 00:00:01"), AllTypeVariant{int64_t{1'000'000}});
+  EXPECT_EQ(logical_value_from_string(DataType::Decimal, "-12.34"), AllTypeVariant{int64_t{-123'400}});
+
+  EXPECT_THROW(logical_value_from_string(DataType::Date, "2000-02-30"), InvalidInputException);
+  EXPECT_THROW(logical_value_from_string(DataType::Decimal, "12,34"), InvalidInputException);
+}
+
+TEST(LogicalDataTypesTest, ValueToString) {
+  EXPECT_EQ(value_to_string(DataType::Date, int32_t{10957}), "2000-01-01");
+  EXPECT_EQ(value_to_string(DataType::Timestamp, int64_t{0}), "1970-01-01 00:00:00");
+  EXPECT_EQ(value_to_string(DataType::Decimal, int64_t{123'400}), "12.3400");
+  EXPECT_EQ(value_to_string(DataType::Int, int32_t{10957}), "10957");
+  EXPECT_EQ(value_to_string(DataType::Date, NULL_VALUE), "NULL");
+}
+
+TEST(LogicalDataTypesTest, PhysicalDataType) {
+  EXPECT_EQ(physical_data_type(DataType::Date), DataType::Int);
+  EXPECT_EQ(physical_data_type(DataType::Timestamp), DataType::Long);
+  EXPECT_EQ(physical_data_type(DataType::Decimal), DataType::Long);
+  EXPECT_EQ(physical_data_type(DataType::Float), DataType::Float);
+
+  EXPECT_TRUE(is_logical_data_type(DataType::Decimal));
+  EXPECT_FALSE(is_date_time_data_type(DataType::Decimal));
+  EXPECT_FALSE(is_logical_data_type(DataType::Long));
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/write_combining_scatter.hpp"
+
+namespace opossum {
+
+template <typename T>
+void scatter_and_verify(const std::vector<T>& values) {
+  // Partition i receives the values at positions i, i + 3, ... and starts at an arbitrary offset of the output, so
+  // that destinations are not aligned to cache lines
+  constexpr auto PARTITION_COUNT = size_t{3};
+  auto output = std::vector<T>(values.size() + 5);
+  auto destinations = std::vector<T*>{};
+  auto offset = size_t{5};
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    destinations.emplace_back(output.data() + offset);
+    offset += (values.size() + PARTITION_COUNT - 1 - partition_id) / PARTITION_COUNT;
+  }
+
+  auto scatter = WriteCombiningScatter<T>{destinations};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    scatter.push(index % PARTITION_COUNT, values[index]);
+  }
+  scatter.flush();
+
+  auto expected_output = std::vector<T>(5);
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    for (auto index = partition_id; index < values.size(); index += PARTITION_COUNT) {
+      expected_output.emplace_back(values[index]);
+    }
+  }
+  EXPECT_EQ(output, expected_output);
+}
+
+TEST(WriteCombiningScatterTest, ScatterValues) {
+  auto int_values = std::vector<int32_t>{};
+  auto int64_values = std::vector<int64_t>{};
+  auto string_values = std::vector<std::string>{};
+  for (auto value = 0; value < 1'000; ++value) {
+    int_values.emplace_back(value);
+    int64_values.emplace_back(value);
+    string_values.emplace_back(std::to_string(value));
+  }
+
+  scatter_and_verify(int_values);
+  scatter_and_verify(int64_values);
+  scatter_and_verify(string_values);
+}
+
+}  // namespace opossum
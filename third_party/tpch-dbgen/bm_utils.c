@@ -119,7 +119,8 @@ char     *getenv PROTO((const char *name));
 #endif
 void usage();
 long *permute_dist(distribution *d, long stream);
-extern seed_t Seed[];
+void permute(long *set, int cnt, long stream);
+extern DBGEN_THREAD_LOCAL seed_t Seed[];
 
 /*
  * env_config: look for a environmental variable setting and return its
@@ -445,19 +446,28 @@ tbl_open(int tbl, char *mode)
 void
 agg_str(distribution *set, long count, long col, char *dest)
 {
-	distribution *d;
+	long *permutation;
 	int i;
 
-	d = set;
 	*dest = '\0';
 
-	permute_dist(d, col);
+	/**
+	 * HYRISE: permute_dist() permutes set->permute in place, which is shared between threads. Permute a local array
+	 * instead, which yields the same order.
+	 */
+	permutation = (long *)malloc(sizeof(long) * DIST_SIZE(set));
+	MALLOC_CHECK(permutation);
+	for (i=0; i < DIST_SIZE(set); i++)
+		permutation[i] = i;
+	permute(permutation, DIST_SIZE(set), col);
+
 	for (i=0; i < count; i++)
 		{
-		strcat(dest, DIST_MEMBER(set,DIST_PERMUTE(d, i)));
+		strcat(dest, DIST_MEMBER(set, permutation[i]));
 		strcat(dest, " ");
 		}
 	*(dest + (int)strlen(dest) - 1) = '\0';
+	free(permutation);
 
     return;
 }
@@ -177,6 +177,12 @@ typedef struct SEED_T {
 #endif
 	} seed_t;
 
+/**
+ * HYRISE: The seeds are thread-local, so that multiple threads can generate disjoint row ranges at the same time (see
+ * the sd_* functions in speed_seed.c for skipping to the first row of a range).
+ */
+#define DBGEN_THREAD_LOCAL __thread
+
 
 #if defined(__STDC__)
 #define PROTO(s) s
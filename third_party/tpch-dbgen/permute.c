@@ -82,7 +82,7 @@ void	permute(long *set, int cnt, long stream);
 void	permute_dist(distribution *d, long stream);
 long seed;
 char *eol[2] = {" ", "},"};
-extern seed_t Seed[];
+extern DBGEN_THREAD_LOCAL seed_t Seed[];
 #ifdef TEST
 tdef tdefs = { NULL };
 #endif
@@ -95,8 +95,9 @@ tdef tdefs = { NULL };
 void	permute(long *a, int c, long s)
 {
     int i;
-    static DSS_HUGE source;
-    static long *set, temp;
+    /* HYRISE: not static, so that permute() can be called from multiple threads */
+    DSS_HUGE source;
+    long temp;
     
 	if (a != (long *)NULL)
 	{
@@ -114,7 +115,6 @@ void	permute(long *a, int c, long s)
 
 void	permute_dist(distribution *d, long stream)
 {
-	static distribution *dist = NULL;
 	int i;
 	
 	if (d != NULL)
@@ -236,7 +236,7 @@ UnifInt(DSS_HUGE nLow, DSS_HUGE nHigh, long nStream)
     return (nLow + nTemp);
 }
 
-seed_t Seed[MAX_STREAM + 1] =
+DBGEN_THREAD_LOCAL seed_t Seed[MAX_STREAM + 1] =
 {
 {PART,   1,          0,	1},					/* P_MFG_SD     0 */
 {PART,   46831694,   0, 1},					/* P_BRND_SD    1 */